@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm-config.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace {
+
+/*!
+ * Builds the sparse model of the given PRISM file for the given formulas once and measures the sparse bisimulation minimization of the built model.
+ */
+void BM_SparseBisimulation(benchmark::State& state, std::string const& modelFile, std::string const& formulasString,
+                           storm::storage::BisimulationType bisimulationType) {
+    storm::prism::Program program = storm::api::parseProgram(modelFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(program), formulas);
+
+    uint64_t quotientStates = 0;
+    for (auto _ : state) {
+        auto quotient = storm::api::performBisimulationMinimization<double>(model, formulas, bisimulationType);
+        quotientStates = quotient->getNumberOfStates();
+        benchmark::DoNotOptimize(quotient);
+    }
+    state.counters["states"] = model->getNumberOfStates();
+    state.counters["quotientStates"] = quotientStates;
+    state.SetItemsProcessed(state.iterations() * model->getNumberOfTransitions());
+}
+BENCHMARK_CAPTURE(BM_SparseBisimulation, crowds_5_5_strong, std::string(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"),
+                  std::string("P=? [F \"observe0Greater1\"]"), storm::storage::BisimulationType::Strong)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SparseBisimulation, crowds_5_5_weak, std::string(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"),
+                  std::string("P=? [F \"observe0Greater1\"]"), storm::storage::BisimulationType::Weak)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_SparseBisimulation, leader4_strong, std::string(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm"), std::string("Pmax=? [F \"elected\"]"),
+                  storm::storage::BisimulationType::Strong)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,141 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/FingerprintBitVectorHashMap.h"
+
+namespace {
+
+/*!
+ * Creates a bit vector of the given length in which roughly every second bit is set. A fixed seed keeps the vector identical across runs.
+ */
+storm::storage::BitVector createRandomBitVector(uint64_t length, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    storm::storage::BitVector result(length);
+    for (uint64_t bucket = 0; bucket * 64 < length; ++bucket) {
+        uint64_t bits = std::min<uint64_t>(64, length - bucket * 64);
+        result.setFromInt(bucket * 64, bits, generator() >> (64 - bits));
+    }
+    return result;
+}
+
+void BM_BitVectorAnd(benchmark::State& state) {
+    storm::storage::BitVector first = createRandomBitVector(state.range(0), 1);
+    storm::storage::BitVector second = createRandomBitVector(state.range(0), 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(first & second);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 4);
+}
+BENCHMARK(BM_BitVectorAnd)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void BM_BitVectorOrInPlace(benchmark::State& state) {
+    storm::storage::BitVector first = createRandomBitVector(state.range(0), 1);
+    storm::storage::BitVector second = createRandomBitVector(state.range(0), 2);
+    for (auto _ : state) {
+        first |= second;
+        benchmark::DoNotOptimize(first);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 4);
+}
+BENCHMARK(BM_BitVectorOrInPlace)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void BM_BitVectorComplement(benchmark::State& state) {
+    storm::storage::BitVector vector = createRandomBitVector(state.range(0), 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(~vector);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+BENCHMARK(BM_BitVectorComplement)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void BM_BitVectorGetNumberOfSetBits(benchmark::State& state) {
+    storm::storage::BitVector vector = createRandomBitVector(state.range(0), 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vector.getNumberOfSetBits());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+BENCHMARK(BM_BitVectorGetNumberOfSetBits)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void BM_BitVectorIterateSetBits(benchmark::State& state) {
+    storm::storage::BitVector vector = createRandomBitVector(state.range(0), 1);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (auto index : vector) {
+            sum += index;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * vector.getNumberOfSetBits());
+}
+BENCHMARK(BM_BitVectorIterateSetBits)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+void BM_BitVectorGetAsInt(benchmark::State& state) {
+    storm::storage::BitVector vector = createRandomBitVector(1 << 16, 1);
+    uint64_t const numberOfBits = state.range(0);
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint64_t index = 0; index + numberOfBits <= vector.size(); index += numberOfBits) {
+            sum += vector.getAsInt(index, numberOfBits);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * (vector.size() / numberOfBits));
+}
+BENCHMARK(BM_BitVectorGetAsInt)->Arg(3)->Arg(17)->Arg(64);
+
+/*!
+ * Inserts the given number of distinct states (each with the given number of bits) into a fresh hash map and looks all of them up once more, mimicking
+ * the state storage of the explicit model builder.
+ */
+void BM_BitVectorHashMapFindOrAdd(benchmark::State& state) {
+    uint64_t const numberOfStates = state.range(0);
+    uint64_t const bitsPerState = state.range(1);
+    std::vector<storm::storage::BitVector> states;
+    states.reserve(numberOfStates);
+    for (uint64_t index = 0; index < numberOfStates; ++index) {
+        states.push_back(createRandomBitVector(bitsPerState, index));
+    }
+    for (auto _ : state) {
+        storm::storage::BitVectorHashMap<uint32_t> map(bitsPerState, 1000);
+        for (uint64_t index = 0; index < numberOfStates; ++index) {
+            benchmark::DoNotOptimize(map.findOrAdd(states[index], static_cast<uint32_t>(index)));
+        }
+        for (uint64_t index = 0; index < numberOfStates; ++index) {
+            benchmark::DoNotOptimize(map.findOrAdd(states[index], static_cast<uint32_t>(index)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * numberOfStates);
+}
+BENCHMARK(BM_BitVectorHashMapFindOrAdd)->Args({10000, 40})->Args({10000, 200})->Args({1000000, 40})->Args({1000000, 200});
+
+/*!
+ * The same as BM_BitVectorHashMapFindOrAdd for the fingerprinted hash map.
+ */
+void BM_FingerprintBitVectorHashMapFindOrAdd(benchmark::State& state) {
+    uint64_t const numberOfStates = state.range(0);
+    uint64_t const bitsPerState = state.range(1);
+    std::vector<storm::storage::BitVector> states;
+    states.reserve(numberOfStates);
+    for (uint64_t index = 0; index < numberOfStates; ++index) {
+        states.push_back(createRandomBitVector(bitsPerState, index));
+    }
+    for (auto _ : state) {
+        storm::storage::FingerprintBitVectorHashMap<uint32_t> map(bitsPerState, 1000);
+        for (uint64_t index = 0; index < numberOfStates; ++index) {
+            benchmark::DoNotOptimize(map.findOrAdd(states[index], static_cast<uint32_t>(index)));
+        }
+        for (uint64_t index = 0; index < numberOfStates; ++index) {
+            benchmark::DoNotOptimize(map.findOrAdd(states[index], static_cast<uint32_t>(index)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * numberOfStates);
+}
+BENCHMARK(BM_FingerprintBitVectorHashMapFindOrAdd)->Args({10000, 40})->Args({10000, 200})->Args({1000000, 40})->Args({1000000, 200});
+
+}  // namespace
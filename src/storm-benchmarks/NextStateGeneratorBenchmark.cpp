@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <string>
+
+#include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/prism/Program.h"
+
+namespace {
+
+/*!
+ * Explores the full state space of the given PRISM model with the next-state generator. Apart from the generator, only a hash map from states to indices
+ * and a queue of unexplored states are involved, so the measured time is dominated by PrismNextStateGenerator::expand.
+ */
+void BM_PrismNextStateGeneratorExplore(benchmark::State& state, std::string const& modelFile) {
+    storm::prism::Program program = storm::api::parseProgram(modelFile).substituteConstantsFormulas();
+    storm::generator::PrismNextStateGenerator<double> generator(program);
+
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfChoices = 0;
+    for (auto _ : state) {
+        storm::storage::BitVectorHashMap<uint32_t> stateToId(generator.getStateSize(), 100000);
+        std::deque<storm::generator::CompressedState> statesToExplore;
+        auto stateToIdCallback = [&stateToId, &statesToExplore](storm::generator::CompressedState const& newState) {
+            uint64_t const numberOfKnownStates = stateToId.size();
+            uint32_t id = stateToId.findOrAdd(newState, static_cast<uint32_t>(numberOfKnownStates));
+            if (stateToId.size() > numberOfKnownStates) {
+                statesToExplore.push_back(newState);
+            }
+            return id;
+        };
+        generator.getInitialStates(stateToIdCallback);
+
+        numberOfChoices = 0;
+        while (!statesToExplore.empty()) {
+            storm::generator::CompressedState currentState = std::move(statesToExplore.front());
+            statesToExplore.pop_front();
+            generator.load(currentState);
+            auto behavior = generator.expand(stateToIdCallback);
+            numberOfChoices += behavior.getNumberOfChoices();
+        }
+        numberOfStates = stateToId.size();
+    }
+    state.counters["states"] = numberOfStates;
+    state.counters["choices"] = numberOfChoices;
+    state.SetItemsProcessed(state.iterations() * numberOfStates);
+}
+BENCHMARK_CAPTURE(BM_PrismNextStateGeneratorExplore, crowds_5_5, std::string(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PrismNextStateGeneratorExplore, brp_16_2, std::string(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PrismNextStateGeneratorExplore, csma2_2, std::string(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PrismNextStateGeneratorExplore, leader4, std::string(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm"))->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_QVBS
+
+#include <exception>
+#include <string>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+/*!
+ * Runs the given QVBS instance end-to-end with the sparse engine: the jani file is parsed, the model is built and all properties of the instance are checked.
+ */
+void BM_QvbsSparseEngine(benchmark::State& state, std::string const& modelName, uint64_t instanceIndex) {
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfTransitions = 0;
+    try {
+        storm::storage::QvbsBenchmark qvbsBenchmark(modelName);
+        storm::Environment env;
+        for (auto _ : state) {
+            auto janiInput = storm::api::parseJaniModel(qvbsBenchmark.getJaniFile(instanceIndex));
+            storm::storage::SymbolicModelDescription modelDescription(janiInput.first);
+            auto constantDefinitions = modelDescription.parseConstantDefinitions(qvbsBenchmark.getConstantDefinition(instanceIndex));
+            modelDescription = modelDescription.preprocess(constantDefinitions);
+            auto properties = storm::api::substituteConstantsInProperties(janiInput.second, constantDefinitions);
+            auto formulas = storm::api::extractFormulasFromProperties(properties);
+
+            auto model = storm::api::buildSparseModel<double>(modelDescription, formulas);
+            numberOfStates = model->getNumberOfStates();
+            numberOfTransitions = model->getNumberOfTransitions();
+            for (auto const& formula : formulas) {
+                auto result = storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formula, true));
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    } catch (std::exception const& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    state.counters["states"] = numberOfStates;
+    state.counters["transitions"] = numberOfTransitions;
+}
+
+// A fixed set of small to medium QVBS instances covering DTMCs, CTMCs, MDPs and MAs.
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, brp, std::string("brp"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, crowds, std::string("crowds"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, nand, std::string("nand"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, embedded, std::string("embedded"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, consensus, std::string("consensus"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, csma, std::string("csma"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, zeroconf, std::string("zeroconf"), 0)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_QvbsSparseEngine, ftwc, std::string("ftwc"), 0)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+
+#endif
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+/*!
+ * Creates a random row-grouped matrix with the given number of row groups. Every group has between one and four rows with up to eight successors.
+ * A fixed seed keeps the matrix identical across runs.
+ */
+storm::storage::SparseMatrix<double> createRandomMatrix(uint64_t numberOfRowGroups) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint64_t> rowDistribution(1, 4);
+    std::uniform_int_distribution<uint64_t> successorDistribution(1, 8);
+    std::uniform_int_distribution<uint64_t> columnDistribution(0, numberOfRowGroups - 1);
+
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfRowGroups, 0, false, true);
+    uint64_t row = 0;
+    std::vector<uint64_t> columns;
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t rowsInGroup = rowDistribution(generator); rowsInGroup > 0; --rowsInGroup, ++row) {
+            columns.clear();
+            for (uint64_t successors = successorDistribution(generator); successors > 0; --successors) {
+                columns.push_back(columnDistribution(generator));
+            }
+            std::sort(columns.begin(), columns.end());
+            columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+            for (auto const& column : columns) {
+                builder.addNextValue(row, column, 1.0 / columns.size());
+            }
+        }
+    }
+    return builder.build();
+}
+
+void BM_SparseMatrixMultiplyAndReduce(benchmark::State& state) {
+    storm::storage::SparseMatrix<double> matrix = createRandomMatrix(state.range(0));
+    std::vector<double> vector(matrix.getColumnCount(), 0.5);
+    std::vector<double> summand(matrix.getRowCount(), 0.1);
+    std::vector<double> result(matrix.getRowGroupCount());
+    for (auto _ : state) {
+        matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), vector, &summand, result, nullptr);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+BENCHMARK(BM_SparseMatrixMultiplyAndReduce)->RangeMultiplier(10)->Range(1000, 1000000);
+
+void BM_SparseMatrixMultiplyAndReduceWithChoices(benchmark::State& state) {
+    storm::storage::SparseMatrix<double> matrix = createRandomMatrix(state.range(0));
+    std::vector<double> vector(matrix.getColumnCount(), 0.5);
+    std::vector<double> result(matrix.getRowGroupCount());
+    std::vector<uint64_t> choices(matrix.getRowGroupCount());
+    for (auto _ : state) {
+        matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Minimize, matrix.getRowGroupIndices(), vector, nullptr, result, &choices);
+        benchmark::DoNotOptimize(result.data());
+        benchmark::DoNotOptimize(choices.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * matrix.getEntryCount());
+}
+BENCHMARK(BM_SparseMatrixMultiplyAndReduceWithChoices)->RangeMultiplier(10)->Range(1000, 1000000);
+
+}  // namespace
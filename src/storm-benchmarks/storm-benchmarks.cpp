@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+
+int main(int argc, char** argv) {
+    storm::settings::initializeAll("Storm Benchmark Suite", "storm-benchmarks");
+    storm::utility::initializeLogger();
+    // Only errors are reported so that the output remains machine-readable.
+    storm::utility::setLogLevel(l3pp::LogLevel::ERR);
+
+    // Unless requested otherwise, results are reported as json so that they can be tracked over time.
+    std::vector<char*> arguments(argv, argv + argc);
+    bool formatGiven = false;
+    for (int i = 1; i < argc; ++i) {
+        formatGiven |= std::strncmp(argv[i], "--benchmark_format", 18) == 0;
+    }
+    std::string jsonFormat = "--benchmark_format=json";
+    if (!formatGiven) {
+        arguments.push_back(&jsonFormat[0]);
+    }
+    int numberOfArguments = static_cast<int>(arguments.size());
+
+    ::benchmark::Initialize(&numberOfArguments, arguments.data());
+    if (::benchmark::ReportUnrecognizedArguments(numberOfArguments, arguments.data())) {
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -3,12 +3,17 @@
 #include "storm-cli-utilities/resources.h"
 #include "storm-version-info/storm-version.h"
 #include "storm/io/file.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
 
 #include <boost/algorithm/string/replace.hpp>
+#include <algorithm>
+#include <chrono>
 #include <ctime>
 #include <type_traits>
 
@@ -53,12 +58,15 @@ int64_t process(const int argc, const char** argv) {
         return -1;
     }
 
+    setUpProfiling();
     processOptions();
 
     totalTimer.stop();
     if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
         storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
     }
+    exportProfile();
+    exportSolverTelemetry();
 
     storm::utility::cleanUp();
     return 0;
@@ -208,6 +216,10 @@ void setResourceLimits() {
     if (resources.isTimeoutSet()) {
         storm::utility::resources::setTimeoutAlarm(resources.getTimeoutInSeconds());
     }
+    if (resources.isMemoryLimitSet()) {
+        storm::utility::memory::setMemoryLimit(resources.getMemoryLimitInMegabytes() * 1024 * 1024);
+    }
+    STORM_LOG_WARN_COND(!resources.isMemoryLimitFallbackSet() || resources.isMemoryLimitSet(), "Engine fallback requested without a memory limit.");
 
     // register signal handler to handle aborts
     storm::utility::resources::installSignalHandler(storm::settings::getModule<storm::settings::modules::ResourceSettings>().getSignalWaitingTimeInSeconds());
@@ -244,19 +256,7 @@ void setUrgentOptions() {
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
-void processOptions() {
-    // Start by setting some urgent options (log levels, resources, etc.)
-    setUrgentOptions();
-
-    // Parse symbolic input (PRISM, JANI, properties, etc.)
-    SymbolicInput symbolicInput = parseSymbolicInput();
-
-    // Obtain settings for model processing
-    ModelProcessingInformation mpi;
-
-    // Preprocess the symbolic input
-    std::tie(symbolicInput, mpi) = preprocessSymbolicInput(symbolicInput);
-
+void processPreprocessedInput(SymbolicInput const& symbolicInput, ModelProcessingInformation const& mpi) {
     STORM_LOG_WARN_COND(mpi.isCompatible,
                         "The model checking query does not seem to be supported for the selected engine. Storm will try to solve the query, but you will most "
                         "likely get an error for at least one of the provided properties.");
@@ -283,6 +283,66 @@ void processOptions() {
 #endif
 }
 
+void processConstantSweep(SymbolicInput const& symbolicInput) {
+    auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    STORM_LOG_THROW(symbolicInput.model, storm::exceptions::InvalidSettingsException, "Sweeping over constants requires a symbolic model.");
+    std::vector<std::string> sweepDefinitionStrings = ioSettings.getConstantSweepDefinitionStrings();
+    std::string fixedDefinitionString = ioSettings.getConstantDefinitionString();
+
+    // The constants that are the same for all points are substituted once, the swept constants remain undefined.
+    auto constantSweep = std::make_shared<ConstantSweep>();
+    constantSweep->model = symbolicInput.model->preprocess(fixedDefinitionString);
+
+    // If the properties refer to swept constants, the formulas that are respected while building the model may differ between the points.
+    std::vector<storm::expressions::Variable> sweptConstants = constantSweep->model.getUndefinedConstants();
+    bool propertiesUseSweptConstants = false;
+    for (auto const& property : symbolicInput.properties) {
+        for (auto const& constant : sweptConstants) {
+            propertiesUseSweptConstants |= property.getUndefinedConstants().count(constant) > 0;
+        }
+    }
+    STORM_LOG_WARN_COND(!propertiesUseSweptConstants,
+                        "The properties refer to swept constants, so the model is built from scratch for each point of the sweep.");
+
+    for (uint64_t pointIndex = 0; pointIndex < sweepDefinitionStrings.size(); ++pointIndex) {
+        std::string const& sweepDefinitionString = sweepDefinitionStrings[pointIndex];
+        STORM_PRINT_AND_LOG("Sweep point " << (pointIndex + 1) << " of " << sweepDefinitionStrings.size() << ": " << sweepDefinitionString << "\n\n");
+
+        SymbolicInput pointInput;
+        ModelProcessingInformation mpi;
+        std::tie(pointInput, mpi) =
+            preprocessSymbolicInput(symbolicInput, fixedDefinitionString.empty() ? sweepDefinitionString : fixedDefinitionString + "," + sweepDefinitionString);
+
+        // Only models that are built from the (untransformed) PRISM program are built by the sweep builder.
+        if (!propertiesUseSweptConstants && pointInput.model && pointInput.model->isPrismProgram()) {
+            constantSweep->constantDefinitions = constantSweep->model.parseConstantDefinitions(sweepDefinitionString);
+            pointInput.constantSweep = constantSweep;
+        }
+        processPreprocessedInput(pointInput, mpi);
+    }
+}
+
+void processOptions() {
+    // Start by setting some urgent options (log levels, resources, etc.)
+    setUrgentOptions();
+
+    // Parse symbolic input (PRISM, JANI, properties, etc.)
+    SymbolicInput symbolicInput = parseSymbolicInput();
+
+    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isConstantSweepSet()) {
+        processConstantSweep(symbolicInput);
+        return;
+    }
+
+    // Obtain settings for model processing
+    ModelProcessingInformation mpi;
+
+    // Preprocess the symbolic input
+    std::tie(symbolicInput, mpi) = preprocessSymbolicInput(symbolicInput);
+
+    processPreprocessedInput(symbolicInput, mpi);
+}
+
 void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
     struct rusage ru;
     getrusage(RUSAGE_SELF, &ru);
@@ -305,5 +365,49 @@ void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds) {
     std::cout.fill(oldFillChar);
 }
 
+void setUpProfiling() {
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    if (resourceSettings.isExportProfileSet() || resourceSettings.isExportProfileSummarySet()) {
+#ifdef STORM_DISABLE_PROFILING
+        STORM_LOG_WARN("Profiling was disabled at compile time. The exported profile will be empty.");
+#endif
+        storm::utility::Profiler::getInstance().reset();
+        storm::utility::Profiler::getInstance().enable();
+    }
+    if (resourceSettings.isMetricsSet()) {
+        std::string filename = resourceSettings.getMetricsFilename();
+        storm::utility::Metrics& metrics = storm::utility::Metrics::getInstance();
+        if (filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".prom") == 0) {
+            metrics.addSink(std::make_shared<storm::utility::PrometheusMetricsSink>(filename));
+        } else {
+            metrics.addSink(std::make_shared<storm::utility::JsonLinesMetricsSink>(filename));
+        }
+        auto interval = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(resourceSettings.getMetricsIntervalInSeconds()));
+        metrics.startPublishing(std::max(interval, std::chrono::milliseconds(1)));
+    }
+}
+
+void exportProfile() {
+    auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+    storm::utility::Profiler& profiler = storm::utility::Profiler::getInstance();
+    if (resourceSettings.isExportProfileSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(resourceSettings.getExportProfileFilename(), stream);
+        profiler.exportChromeTrace(stream);
+        storm::utility::closeFile(stream);
+    }
+    if (resourceSettings.isExportProfileSummarySet()) {
+        std::ofstream stream;
+        storm::utility::openFile(resourceSettings.getExportProfileSummaryFilename(), stream);
+        profiler.exportSummary(stream);
+        storm::utility::closeFile(stream);
+    }
+    profiler.disable();
+
+    storm::utility::Metrics& metrics = storm::utility::Metrics::getInstance();
+    metrics.stopPublishing();
+    metrics.disable();
+}
+
 }  // namespace cli
 }  // namespace storm
@@ -24,6 +24,16 @@ void printVersion(std::string const& name);
 
 void printTimeAndMemoryStatistics(uint64_t wallclockMilliseconds = 0);
 
+/*!
+ * Enables the profiler if a profile of the run is to be exported and starts publishing the metrics if requested.
+ */
+void setUpProfiling();
+
+/*!
+ * Exports the profile of the run to the files given in the settings (if any) and publishes the final metrics.
+ */
+void exportProfile();
+
 /*!
  * Parses the given command line arguments.
  *
@@ -5,29 +5,52 @@
 #include "storm-counterexamples/api/counterexamples.h"
 #include "storm-parsers/api/storm-parsers.h"
 
+#include "storm-version-info/storm-version.h"
+
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
 #include "storm/io/file.h"
+#include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/FormulaInformation.h"
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
 #include "storm/utility/AutomaticSettings.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/FileCache.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
+#include "storm/builder/IncrementalModelBuilder.h"
 
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/MemoryLimitExceededException.h"
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/ResultHintStore.h"
+#include "storm/modelchecker/propositional/StateFormulaResultCache.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -44,15 +67,31 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
 #include "storm/settings/modules/TransformationSettings.h"
+#include "storm/solver/AnytimeBounds.h"
+#include "storm/solver/SolverCheckpoints.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/storage/Qvbs.h"
 #include "storm/storage/jani/localeliminator/AutomaticAction.h"
 #include "storm/storage/jani/localeliminator/JaniLocalEliminator.h"
+#include "storm/transformer/StatePermuter.h"
 
 #include "storm/utility/Stopwatch.h"
 
 namespace storm {
 namespace cli {
 
+struct ConstantSweep {
+    // The symbolic model description in which the swept constants are still undefined.
+    storm::storage::SymbolicModelDescription model;
+
+    // The definitions of the swept constants at the current point of the sweep.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
+
+    // The builders are kept between the points of the sweep, such that a model that was built once can be re-instantiated.
+    std::shared_ptr<storm::builder::ConstantSweepModelBuilder<double>> builder;
+    std::shared_ptr<storm::builder::ConstantSweepModelBuilder<storm::RationalNumber>> exactBuilder;
+};
+
 struct SymbolicInput {
     // The symbolic model description.
     boost::optional<storm::storage::SymbolicModelDescription> model;
@@ -62,6 +101,9 @@ struct SymbolicInput {
 
     // The preprocessed properties to check (in case they needed amendment).
     boost::optional<std::vector<storm::jani::Property>> preprocessedProperties;
+
+    // If set, the input is a point of a sweep over the values of constants.
+    std::shared_ptr<ConstantSweep> constantSweep;
 };
 
 void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
@@ -134,6 +176,7 @@ SymbolicInput parseSymbolicInputQvbs(storm::settings::modules::IOSettings const&
 }
 
 SymbolicInput parseSymbolicInput() {
+    STORM_PROFILE_SCOPE("parsing");
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (ioSettings.isQvbsInputSet()) {
         return parseSymbolicInputQvbs(ioSettings);
@@ -204,6 +247,52 @@ void getModelProcessingInformationAutomatic(SymbolicInput const& input, ModelPro
                         << "\t exact=" << (mpi.verificationValueType != ModelProcessingInformation::ValueType::FinitePrecision) << std::noboolalpha << '\n');
 }
 
+/*!
+ * Retrieves the telemetry that collects the per-iteration statistics of all solver invocations.
+ */
+std::shared_ptr<storm::solver::SolverTelemetry> const& getSolverTelemetry() {
+    static std::shared_ptr<storm::solver::SolverTelemetry> telemetry = std::make_shared<storm::solver::SolverTelemetry>();
+    return telemetry;
+}
+
+/*!
+ * Retrieves the anytime bounds to which solvers report when they are aborted (e.g. because the timeout is reached).
+ */
+std::shared_ptr<storm::solver::AnytimeBounds> const& getAnytimeBounds() {
+    static std::shared_ptr<storm::solver::AnytimeBounds> bounds = std::make_shared<storm::solver::AnytimeBounds>();
+    return bounds;
+}
+
+/*!
+ * Retrieves the checkpoints in which the iterative solvers store their iterates (as requested by the settings).
+ */
+std::shared_ptr<storm::solver::SolverCheckpoints> const& getSolverCheckpoints() {
+    static std::shared_ptr<storm::solver::SolverCheckpoints> checkpoints = [] {
+        auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+        auto interval = std::chrono::milliseconds(static_cast<int64_t>(ioSettings.getSolverCheckpointsInterval() * 1000));
+        return std::make_shared<storm::solver::SolverCheckpoints>(ioSettings.getSolverCheckpointsDirectory(), interval, ioSettings.isResumeSet());
+    }();
+    return checkpoints;
+}
+
+/*!
+ * Exports the collected solver telemetry (if requested).
+ */
+void exportSolverTelemetry() {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    if (ioSettings.isExportSolverTelemetrySet()) {
+        std::string filename = ioSettings.getExportSolverTelemetryFilename();
+        std::ofstream stream;
+        storm::utility::openFile(filename, stream);
+        if (filename.size() >= 4 && filename.substr(filename.size() - 4) == ".csv") {
+            getSolverTelemetry()->exportCsv(stream);
+        } else {
+            getSolverTelemetry()->exportJson(stream);
+        }
+        storm::utility::closeFile(stream);
+    }
+}
+
 /*!
  * Sets the model processing information based on the given input.
  * Finding the right model processing information might require a conversion to jani.
@@ -328,6 +417,16 @@ ModelProcessingInformation getModelProcessingInformation(SymbolicInput const& in
             mpi.ddType = storm::dd::DdType::Sylvan;
         }
     }
+
+    // Attach the solver telemetry (if requested)
+    if (ioSettings.isExportSolverTelemetrySet()) {
+        mpi.env.solver().setTelemetry(getSolverTelemetry());
+    }
+    mpi.env.solver().setAnytimeBounds(getAnytimeBounds());
+    // Attach the solver checkpoints (if requested)
+    if (ioSettings.isSolverCheckpointsSet()) {
+        mpi.env.solver().setCheckpoints(getSolverCheckpoints());
+    }
     return mpi;
 }
 
@@ -347,7 +446,7 @@ void ensureNoUndefinedPropertyConstants(std::vector<storm::jani::Property> const
     }
 }
 
-std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input) {
+std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input, std::string const& constantDefinitionString) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
 
     SymbolicInput output = input;
@@ -360,7 +459,6 @@ std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(Sym
     }
 
     // Substitute constant definitions in symbolic input.
-    std::string constantDefinitionString = ioSettings.getConstantDefinitionString();
     std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
     if (output.model) {
         constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
@@ -408,6 +506,10 @@ std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(Sym
     return {output, mpi};
 }
 
+std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input) {
+    return preprocessSymbolicInput(input, storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString());
+}
+
 void exportSymbolicInput(SymbolicInput const& input) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (input.model && input.model.get().isJaniModel()) {
@@ -437,6 +539,129 @@ std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& inpu
                                                              !buildSettings.isApplyNoMaximumProgressAssumptionSet());
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::builder::ConstantSweepModelBuilder<ValueType>>& getConstantSweepModelBuilder(ConstantSweep& constantSweep);
+
+template<>
+std::shared_ptr<storm::builder::ConstantSweepModelBuilder<double>>& getConstantSweepModelBuilder(ConstantSweep& constantSweep) {
+    return constantSweep.builder;
+}
+
+template<>
+std::shared_ptr<storm::builder::ConstantSweepModelBuilder<storm::RationalNumber>>& getConstantSweepModelBuilder(ConstantSweep& constantSweep) {
+    return constantSweep.exactBuilder;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::shared_ptr<storm::models::ModelBase>>::type buildModelSparseSweep(
+    SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+    auto& builder = getConstantSweepModelBuilder<ValueType>(*input.constantSweep);
+    if (!builder) {
+        builder = std::make_shared<storm::builder::ConstantSweepModelBuilder<ValueType>>(input.constantSweep->model, options);
+    }
+    auto model = builder->build(input.constantSweep->constantDefinitions);
+    STORM_LOG_INFO("Sweep: " << builder->getNumberOfBuiltModels() << " models built and " << builder->getNumberOfInstantiatedModels()
+                             << " models re-instantiated so far.");
+    return model;
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::shared_ptr<storm::models::ModelBase>>::type buildModelSparseSweep(
+    SymbolicInput const& input, storm::builder::BuilderOptions const& options) {
+    // Parametric models are built from scratch at each point of the sweep.
+    return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::sparse::Model<ValueType>>>::type buildModelSparseIncremental(
+    SymbolicInput const& input, storm::builder::BuilderOptions const& options, storm::utility::FileCache const& cache) {
+    // The previous build is identified by the input file (rather than by its content and the constants, which are the things that change).
+    std::stringstream key;
+    key << "storm " << storm::StormVersion::shortVersionString() << " incremental model cache, drb version " << storm::exporter::binary::formatVersion << "\n";
+    key << "exploration order: " << storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder() << "\n";
+    key << options.getDescription();
+    key << "file: " << std::filesystem::absolute(storm::settings::getModule<storm::settings::modules::IOSettings>().getPrismInputFilename()).string() << "\n";
+    std::string const modelKey = key.str() + "model\n";
+    std::string const programKey = key.str() + "program\n";
+
+    storm::prism::Program const& program = input.model.get().asPrismProgram();
+    storm::builder::IncrementalModelBuilder<ValueType> builder(options);
+    auto modelFilename = cache.lookup(modelKey);
+    auto programFilename = cache.lookup(programKey);
+    if (modelFilename && programFilename) {
+        try {
+            storm::parser::BinaryModelParserOptions parserOptions;
+            parserOptions.expressionManager = program.getManager().getSharedPointer();
+            builder.setPreviousBuild(storm::api::parseProgram(programFilename.get(), true, false),
+                                     storm::api::buildExplicitDRBModel<ValueType>(modelFilename.get(), parserOptions));
+        } catch (std::exception const& e) {
+            STORM_LOG_WARN("The previous build in the model cache is not usable: " << e.what());
+        }
+    }
+    auto model = builder.build(program);
+    if (builder.wasLastBuildIncremental()) {
+        STORM_PRINT_AND_LOG("Built the model incrementally from the previous build in the model cache (" << builder.getNumberOfExpandedStates()
+                                                                                                         << " states expanded).\n");
+    }
+    cache.store(modelKey, [&model](std::string const& filename) { storm::api::exportSparseModelAsDrb(model, filename); });
+    cache.store(programKey, [&program](std::string const& filename) {
+        std::ofstream stream;
+        storm::utility::openFile(filename, stream);
+        stream << program;
+        storm::utility::closeFile(stream);
+    });
+    return model;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::sparse::Model<ValueType>>>::type buildModelSparseIncremental(
+    SymbolicInput const&, storm::builder::BuilderOptions const&, storm::utility::FileCache const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Incremental builds are only supported for models with floating point values.");
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::ModelBase> buildModelSparseCached(SymbolicInput const& input, storm::builder::BuilderOptions const& options,
+                                                                 storm::settings::modules::BuildSettings const& buildSettings) {
+    // The binary format neither stores choice origins nor observation valuations, so such models are always built.
+    if (!std::is_same<ValueType, double>::value || options.isBuildChoiceOriginsSet() || options.isBuildObservationValuationsSet()) {
+        STORM_LOG_WARN("The model cache is only used for models with floating point values and without choice origins or observation valuations.");
+        return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+    }
+
+    // Everything that influences the built model is part of the key. The constants are substituted in the model description already.
+    std::stringstream key;
+    key << "storm " << storm::StormVersion::shortVersionString() << " model cache, drb version " << storm::exporter::binary::formatVersion << "\n";
+    key << "constants: " << storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString() << "\n";
+    key << "exploration order: " << buildSettings.getExplorationOrder() << "\n";
+    key << options.getDescription();
+    key << "model:\n" << input.model.get();
+
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
+    try {
+        storm::utility::FileCache cache(buildSettings.getModelCacheDirectory(), buildSettings.getModelCacheSize());
+        if (auto filename = cache.lookup(key.str())) {
+            storm::parser::BinaryModelParserOptions parserOptions;
+            parserOptions.expressionManager = input.model.get().getManager().getSharedPointer();
+            model = storm::api::buildExplicitDRBModel<ValueType>(filename.get(), parserOptions);
+            STORM_PRINT_AND_LOG("Loaded model from cache entry " << filename.get() << ".\n");
+            return model;
+        }
+        if (buildSettings.isIncrementalBuildSet() && input.model.get().isPrismProgram() &&
+            storm::settings::getModule<storm::settings::modules::IOSettings>().isPrismInputSet()) {
+            model = buildModelSparseIncremental<ValueType>(input, options, cache);
+        } else {
+            model = storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+        }
+        cache.store(key.str(), [&model](std::string const& filename) { storm::api::exportSparseModelAsDrb(model, filename); });
+    } catch (std::exception const& e) {
+        STORM_LOG_WARN("Model cache is not usable: " << e.what());
+        if (!model) {
+            model = storm::api::buildSparseModel<ValueType>(input.model.get(), options);
+        }
+    }
+    return model;
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
     storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
@@ -460,6 +685,19 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setExplorationChecks();
     }
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
+    options.setMaximalGuardTableBits(buildSettings.getMaximalGuardTableBits());
+    options.setSymmetryReduction(buildSettings.isSymmetryReductionSet());
+    options.setVariableRangeAnalysis(buildSettings.isVariableRangeAnalysisSet());
+    if (buildSettings.isPartialOrderReductionSet()) {
+        // The reduction only preserves the values of stutter-insensitive properties in the initial states.
+        storm::logic::FragmentSpecification stutterInsensitive = storm::logic::reachability().setGloballyFormulasAllowed(true);
+        auto const& properties = input.properties;
+        bool applicable = !properties.empty() && std::all_of(properties.begin(), properties.end(), [&stutterInsensitive](auto const& property) {
+                              return property.getRawFormula()->isInFragment(stutterInsensitive);
+                          });
+        STORM_LOG_WARN_COND(applicable, "Partial order reduction is only applied if all properties are unbounded reachability properties without rewards.");
+        options.setPartialOrderReduction(applicable);
+    }
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
     if (buildSettings.isBuildFullModelSet()) {
@@ -473,6 +711,19 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
         options.setAddOverlappingGuardsLabel(true);
     }
 
+    if (input.constantSweep) {
+        // The model cache is keyed by the constants given via --constants only, so it is not used during sweeps.
+        return buildModelSparseSweep<ValueType>(input, options);
+    }
+    STORM_LOG_WARN_COND(!buildSettings.isIncrementalBuildSet() || buildSettings.isModelCacheSet(),
+                        "Incremental builds are based on the previous build in the model cache, which is not set.");
+    if (buildSettings.isModelCacheSet()) {
+        if (buildSettings.isIncrementalBuildSet()) {
+            // The state valuations identify the states of the previous build.
+            options.setBuildStateValuations(true);
+        }
+        return buildModelSparseCached<ValueType>(input, options, buildSettings);
+    }
     return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
 }
 
@@ -490,6 +741,8 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
         storm::parser::DirectEncodingParserOptions options;
         options.buildChoiceLabeling = buildSettings.isBuildChoiceLabelsSet();
         result = storm::api::buildExplicitDRNModel<ValueType>(ioSettings.getExplicitDRNFilename(), options);
+    } else if (ioSettings.isExplicitDRBSet()) {
+        result = storm::api::buildExplicitDRBModel<ValueType>(ioSettings.getExplicitDRBFilename());
     } else {
         STORM_LOG_THROW(ioSettings.isExplicitIMCASet(), storm::exceptions::InvalidSettingsException, "Unexpected explicit model input type.");
         result = storm::api::buildExplicitIMCAModel<ValueType>(ioSettings.getExplicitIMCAFilename());
@@ -500,6 +753,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelExplicit(storm::settings::mo
 template<storm::dd::DdType DdType, typename ValueType>
 std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings,
                                                      ModelProcessingInformation const& mpi) {
+    STORM_PROFILE_SCOPE("building");
     storm::utility::Stopwatch modelBuildingWatch(true);
 
     auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -511,7 +765,7 @@ std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input,
         } else if (builderType == storm::builder::BuilderType::Explicit) {
             result = buildModelSparse<ValueType>(input, buildSettings);
         }
-    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet()) {
+    } else if (ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitDRBSet() || ioSettings.isExplicitIMCASet()) {
         STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::InvalidSettingsException,
                         "Can only use sparse engine with explicit input.");
         result = buildModelExplicit<ValueType>(ioSettings, buildSettings);
@@ -599,6 +853,13 @@ std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType>>, bool> prepro
         result.second = true;
     }
 
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isStateReorderingSet()) {
+        STORM_LOG_INFO("Renumbering the states in " << buildSettings.getStateReorderingOrder() << " order...");
+        result.first = storm::transformer::permuteStates(*result.first, buildSettings.getStateReorderingOrder()).first;
+        result.second = true;
+    }
+
     return result;
 }
 
@@ -616,6 +877,9 @@ void exportSparseModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>
                                                    input.model ? input.model.get().getParameterNames() : std::vector<std::string>(),
                                                    !ioSettings.isExplicitExportPlaceholdersDisabled());
                 break;
+            case storm::exporter::ModelExportFormat::Drb:
+                storm::api::exportSparseModelAsDrb(model, ioSettings.getExportBuildFilename());
+                break;
             case storm::exporter::ModelExportFormat::Json:
                 storm::api::exportSparseModelAsJson(model, ioSettings.getExportBuildFilename());
                 break;
@@ -761,6 +1025,7 @@ std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessDdModel(std
 template<storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
 std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input,
                                                                            ModelProcessingInformation const& mpi) {
+    STORM_PROFILE_SCOPE("preprocessing");
     storm::utility::Stopwatch preprocessingWatch(true);
 
     std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -817,6 +1082,8 @@ void generateCounterexamples<double>(std::shared_ptr<storm::models::ModelBase> c
     auto counterexampleSettings = storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>();
     if (counterexampleSettings.isMinimalCommandSetGenerationSet()) {
         bool useMilp = counterexampleSettings.isUseMilpBasedMinimalCommandSetGenerationSet();
+        // The relevant states and labels are shared among the properties.
+        auto relevancyCache = std::make_shared<storm::counterexamples::SMTMinimalLabelSetGenerator<ValueType>::RelevancyCache>(*sparseModel);
         for (auto const& property : input.properties) {
             std::shared_ptr<storm::counterexamples::Counterexample> counterexample;
             printComputingCounterexample(property);
@@ -833,10 +1100,10 @@ void generateCounterexamples<double>(std::shared_ptr<storm::models::ModelBase> c
 
                 if (sparseModel->isOfType(storm::models::ModelType::Dtmc)) {
                     counterexample = storm::api::computeHighLevelCounterexampleMaxSmt(
-                        input.model.get(), sparseModel->template as<storm::models::sparse::Dtmc<ValueType>>(), property.getRawFormula());
+                        input.model.get(), sparseModel->template as<storm::models::sparse::Dtmc<ValueType>>(), property.getRawFormula(), relevancyCache);
                 } else {
                     counterexample = storm::api::computeHighLevelCounterexampleMaxSmt(
-                        input.model.get(), sparseModel->template as<storm::models::sparse::Mdp<ValueType>>(), property.getRawFormula());
+                        input.model.get(), sparseModel->template as<storm::models::sparse::Mdp<ValueType>>(), property.getRawFormula(), relevancyCache);
                 }
             }
             watch.stop();
@@ -850,7 +1117,8 @@ void generateCounterexamples<double>(std::shared_ptr<storm::models::ModelBase> c
             STORM_LOG_THROW(sparseModel->isOfType(storm::models::ModelType::Dtmc), storm::exceptions::NotSupportedException,
                             "Counterexample generation using shortest paths is currently only supported for DTMCs.");
             counterexample = storm::api::computeKShortestPathCounterexample(sparseModel->template as<storm::models::sparse::Dtmc<ValueType>>(),
-                                                                            property.getRawFormula(), counterexampleSettings.getShortestPathMaxK());
+                                                                            property.getRawFormula(), counterexampleSettings.getShortestPathMaxK(),
+                                                                            counterexampleSettings.getShortestPathMemoryLimit());
             watch.stop();
             printCounterexample(counterexample, &watch);
         }
@@ -935,6 +1203,12 @@ void printResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result
         STORM_PRINT((storm::utility::resources::isTerminate() ? "Result till abort" : "Result")
                     << " (for " << (property.getFilter().getStatesFormula()->isInitialFormula() ? "initial" : ss.str()) << " states): ");
         printFilteredResult<ValueType>(result, property.getFilter().getFilterType());
+        // Summing up the values also sums up their errors, so the bound only applies to the other filters.
+        if (result->isExplicitQuantitativeCheckResult() && result->template asExplicitQuantitativeCheckResult<ValueType>().hasErrorBound() &&
+            property.getFilter().getFilterType() != storm::modelchecker::FilterType::SUM) {
+            STORM_PRINT("The exact result is within +/- " << result->template asExplicitQuantitativeCheckResult<ValueType>().getErrorBound()
+                                                           << " of the result computed till abort.\n");
+        }
         if (watch) {
             STORM_PRINT("Time for model checking: " << *watch << ".\n");
         }
@@ -949,38 +1223,57 @@ struct PostprocessingIdentity {
     }
 };
 
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyProperty(
+    storm::jani::Property const& property,
+    std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                    std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback,
+    bool& ignored) {
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    STORM_PROFILE_SCOPE("model checking");
+    ignored = false;
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    getAnytimeBounds()->reset();
+    try {
+        auto rawFormula = property.getRawFormula();
+        if (transformationSettings.isChainEliminationSet() && !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
+            STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
+            ignored = true;
+        } else if (transformationSettings.isToDiscreteTimeModelSet()) {
+            auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
+            auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
+            if (propertyFormula && filterFormula) {
+                result = verificationCallback(propertyFormula, filterFormula);
+            } else {
+                ignored = true;
+            }
+        } else {
+            result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+        }
+    } catch (storm::exceptions::BaseException const& ex) {
+        STORM_LOG_WARN("Cannot handle property: " << ex.what());
+    }
+    // Attach the error bound guaranteed by the solvers that were aborted.
+    if (result && result->isExplicitQuantitativeCheckResult() && getAnytimeBounds()->hasAbortedSolver()) {
+        if (auto errorBound = getAnytimeBounds()->getErrorBound()) {
+            result->template asExplicitQuantitativeCheckResult<ValueType>().setErrorBound(errorBound.get());
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 void verifyProperties(
     SymbolicInput const& input,
     std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula,
                                                                     std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback,
     std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
-    auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
     auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
     for (auto const& property : properties) {
         printModelCheckingProperty(property);
         bool ignored = false;
         storm::utility::Stopwatch watch(true);
-        std::unique_ptr<storm::modelchecker::CheckResult> result;
-        try {
-            auto rawFormula = property.getRawFormula();
-            if (transformationSettings.isChainEliminationSet() && !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
-                STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                ignored = true;
-            } else if (transformationSettings.isToDiscreteTimeModelSet()) {
-                auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
-                auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
-                if (propertyFormula && filterFormula) {
-                    result = verificationCallback(propertyFormula, filterFormula);
-                } else {
-                    ignored = true;
-                }
-            } else {
-                result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
-            }
-        } catch (storm::exceptions::BaseException const& ex) {
-            STORM_LOG_WARN("Cannot handle property: " << ex.what());
-        }
+        std::unique_ptr<storm::modelchecker::CheckResult> result = verifyProperty<ValueType>(property, verificationCallback, ignored);
         watch.stop();
         if (!ignored) {
             postprocessingCallback(result);
@@ -989,6 +1282,45 @@ void verifyProperties(
     }
 }
 
+/*!
+ * Verifies the properties concurrently on the given number of threads. The verification callback additionally receives
+ * the index of the calling thread; no two concurrent calls share the same index. The results are postprocessed and
+ * printed in the original order of the properties once all properties have been checked.
+ */
+template<typename ValueType>
+void verifyPropertiesInParallel(
+    SymbolicInput const& input, uint64_t numberOfThreads,
+    std::function<std::unique_ptr<storm::modelchecker::CheckResult>(uint64_t threadIndex, std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                    std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback,
+    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(properties.size());
+    // Flags are stored as chars, as distinct elements of a vector<bool> can not be written concurrently.
+    std::vector<char> ignored(properties.size(), false);
+    std::vector<storm::utility::Stopwatch> watches(properties.size());
+
+    STORM_PRINT("\nModel checking " << properties.size() << " properties on " << std::min<uint64_t>(numberOfThreads, properties.size()) << " threads ...\n");
+    storm::utility::parallel::forEachChunk(0, properties.size(), 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t propertyIndex, uint64_t) {
+        auto threadCallback = [&verificationCallback, threadIndex](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                   std::shared_ptr<storm::logic::Formula const> const& states) {
+            return verificationCallback(threadIndex, formula, states);
+        };
+        bool propertyIgnored = false;
+        watches[propertyIndex].start();
+        results[propertyIndex] = verifyProperty<ValueType>(properties[propertyIndex], threadCallback, propertyIgnored);
+        watches[propertyIndex].stop();
+        ignored[propertyIndex] = propertyIgnored;
+    });
+
+    for (uint64_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex) {
+        printModelCheckingProperty(properties[propertyIndex]);
+        if (!ignored[propertyIndex]) {
+            postprocessingCallback(results[propertyIndex]);
+            printResult<ValueType>(results[propertyIndex], properties[propertyIndex], &watches[propertyIndex]);
+        }
+    }
+}
+
 std::vector<storm::expressions::Expression> parseConstraints(storm::expressions::ExpressionManager const& expressionManager,
                                                              std::string const& constraintsString) {
     std::vector<storm::expressions::Expression> constraints;
@@ -1090,24 +1422,98 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSimulationEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Simulation does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Simulation can only filter initial states.");
+            return storm::api::verifyWithSimulationEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+
+    // If requested, compatible properties are checked together upfront and their results are picked up below.
+    std::map<storm::logic::Formula const*, std::unique_ptr<storm::modelchecker::CheckResult>> batchResults;
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isBatchSet() && !ioSettings.isExportSchedulerSet() &&
+        !transformationSettings.isChainEliminationSet() && !transformationSettings.isToDiscreteTimeModelSet()) {
+        auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+        std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> tasks;
+        for (auto const& property : properties) {
+            tasks.push_back(storm::api::createTask<ValueType>(property.getRawFormula(), property.getFilter().getStatesFormula()->isInitialFormula()));
+        }
+        storm::utility::Stopwatch watch(true);
+        try {
+            auto results = storm::api::verifyBatchWithSparseEngine<ValueType>(mpi.env, sparseModel, tasks);
+            uint64_t batchedProperties = 0;
+            for (uint64_t index = 0; index < results.size(); ++index) {
+                if (results[index]) {
+                    batchResults[properties[index].getRawFormula().get()] = std::move(results[index]);
+                    ++batchedProperties;
+                }
+            }
+            watch.stop();
+            if (batchedProperties > 0) {
+                STORM_PRINT("Time for batched model checking of " << batchedProperties << " properties: " << watch << ".\n");
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot check properties in batches, checking them one by one: " << ex.what());
+            batchResults.clear();
+        }
+    }
+
+    // Results of previous runs and of already checked properties serve as hints for the remaining properties.
+    auto const& hintSettings = storm::settings::getModule<storm::settings::modules::HintSettings>();
+    std::unique_ptr<storm::modelchecker::ResultHintStore<ValueType>> hintStore;
+    if (hintSettings.isPropagateSet() || hintSettings.isImportSet() || hintSettings.isExportSet()) {
+        hintStore = std::make_unique<storm::modelchecker::ResultHintStore<ValueType>>(*sparseModel);
+        if (hintSettings.isImportSet()) {
+            hintStore->importFromFile(hintSettings.getImportFilename());
+        }
+    }
+
+    // The batch results and the hints are shared by all properties, which may be checked concurrently.
+    std::mutex sharedResultsMutex;
+    auto verifyFormula = [&sparseModel, &ioSettings, &batchResults, &hintStore, &sharedResultsMutex](
+                             storm::Environment const& env, std::shared_ptr<storm::logic::Formula const> const& formula,
+                             std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        {
+            std::lock_guard<std::mutex> lock(sharedResultsMutex);
+            if (hintStore) {
+                hintStore->provideHint(task);
+            }
+            auto batchResult = batchResults.find(formula.get());
+            if (batchResult != batchResults.end()) {
+                result = std::move(batchResult->second);
+                batchResults.erase(batchResult);
+            }
+        }
+        if (!result) {
+            result = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, task);
+        }
+        if (hintStore && result) {
+            std::lock_guard<std::mutex> lock(sharedResultsMutex);
+            hintStore->storeResult(*formula, *result);
+        }
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else {
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            filter = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(states, false));
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1154,7 +1560,45 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         }
         ++exportCount;
     };
-    verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+
+    // The results of nested state formulas and of filter formulas are reused across all properties.
+    storm::Environment propertyEnv = mpi.env;
+    propertyEnv.modelchecker().setStateFormulaResultCache(std::make_shared<storm::modelchecker::StateFormulaResultCache>());
+
+    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    uint64_t numberOfThreads =
+        modelCheckerSettings.isParallelPropertiesSet() ? storm::utility::parallel::getNumberOfThreads(modelCheckerSettings.getNumberOfParallelProperties()) : 1;
+    if (numberOfThreads > 1 && properties.size() > 1 && !std::is_same<ValueType, double>::value) {
+        // Exact and parametric numbers (in particular their caches) may not be used concurrently.
+        STORM_LOG_WARN("Properties are only checked in parallel for models with floating point values, checking them one after another.");
+        numberOfThreads = 1;
+    }
+    if (numberOfThreads > 1 && properties.size() > 1) {
+        // Data of the model that is initialized lazily is initialized upfront, such that the model is only read concurrently.
+        sparseModel->getTransitionMatrix().getRowGroupIndices();
+        if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->containsZenoCycle();
+        }
+        // Environments create their sub-environments lazily, so every thread works on its own copy.
+        std::vector<storm::Environment> environments(numberOfThreads, propertyEnv);
+        verifyPropertiesInParallel<ValueType>(
+            input, numberOfThreads,
+            [&verifyFormula, &environments](uint64_t threadIndex, std::shared_ptr<storm::logic::Formula const> const& formula,
+                                            std::shared_ptr<storm::logic::Formula const> const& states) {
+                return verifyFormula(environments[threadIndex], formula, states);
+            },
+            postprocessingCallback);
+    } else {
+        verifyProperties<ValueType>(
+            input,
+            [&verifyFormula, &propertyEnv](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                           std::shared_ptr<storm::logic::Formula const> const& states) { return verifyFormula(propertyEnv, formula, states); },
+            postprocessingCallback);
+    }
+    if (hintSettings.isExportSet()) {
+        hintStore->exportToFile(hintSettings.getExportFilename());
+    }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1243,6 +1687,20 @@ void verifyWithAbstractionRefinementEngine(std::shared_ptr<storm::models::ModelB
     });
 }
 
+/*!
+ * Exports the statistics of the DD library of the given symbolic model (if requested).
+ */
+template<storm::dd::DdType DdType, typename ValueType>
+void exportDdStatistics(std::shared_ptr<storm::models::ModelBase> const& model) {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    if (ioSettings.isExportDdStatisticsSet()) {
+        std::ofstream stream;
+        storm::utility::openFile(ioSettings.getExportDdStatisticsFilename(), stream);
+        model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager().exportStatisticsAsJson(stream);
+        storm::utility::closeFile(stream);
+    }
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueType, double>::value, void>::type verifySymbolicModel(
     std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
@@ -1253,6 +1711,7 @@ typename std::enable_if<DdType != storm::dd::DdType::CUDD || std::is_same<ValueT
     } else {
         verifyWithAbstractionRefinementEngine<DdType, ValueType>(model, input, mpi);
     }
+    exportDdStatistics<DdType, ValueType>(model);
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -1271,6 +1730,19 @@ void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, Symboli
     }
 }
 
+/*!
+ * Prints the memory used by the components of the given model (if it is sparse and time and memory statistics are requested).
+ */
+template<typename ValueType>
+void printModelMemoryUsage(std::shared_ptr<storm::models::ModelBase> const& model, std::string const& phase) {
+    auto sparseModel = std::dynamic_pointer_cast<storm::models::sparse::Model<ValueType>>(model);
+    if (sparseModel && storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+        std::cout << "Memory usage of the model after " << phase << ":\n";
+        sparseModel->getMemoryUsage().printToStream(std::cout);
+        std::cout << '\n';
+    }
+}
+
 template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
 std::shared_ptr<storm::models::ModelBase> buildPreprocessModelWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
@@ -1282,6 +1754,7 @@ std::shared_ptr<storm::models::ModelBase> buildPreprocessModelWithValueTypeAndDd
 
     if (model) {
         model->printModelInformationToStream(std::cout);
+        printModelMemoryUsage<BuildValueType>(model, "building");
     }
 
     STORM_LOG_THROW(model || input.properties.empty(), storm::exceptions::InvalidSettingsException, "No input model.");
@@ -1291,6 +1764,7 @@ std::shared_ptr<storm::models::ModelBase> buildPreprocessModelWithValueTypeAndDd
         if (preprocessingResult.second) {
             model = preprocessingResult.first;
             model->printModelInformationToStream(std::cout);
+            printModelMemoryUsage<VerificationValueType>(model, "preprocessing");
         }
     }
     return model;
@@ -1305,6 +1779,81 @@ std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithValueTyp
     return model;
 }
 
+/*!
+ * Builds, preprocesses and exports the model. If building the model would exceed the memory limit and an engine fallback is requested, the model is built
+ * with the next engine (sparse, hybrid, dd) instead. The engine of the given model processing information is updated accordingly.
+ */
+template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
+std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModelWithEngineFallback(SymbolicInput const& input, ModelProcessingInformation& mpi) {
+    bool const useFallback = storm::settings::getModule<storm::settings::modules::ResourceSettings>().isMemoryLimitFallbackSet();
+    while (true) {
+        try {
+            return buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
+        } catch (storm::exceptions::MemoryLimitExceededException const& e) {
+            boost::optional<storm::utility::Engine> fallbackEngine;
+            if (mpi.engine == storm::utility::Engine::Sparse) {
+                fallbackEngine = storm::utility::Engine::Hybrid;
+            } else if (mpi.engine == storm::utility::Engine::Hybrid) {
+                fallbackEngine = storm::utility::Engine::Dd;
+            }
+            // The dd-based builder only supports Markov automata given as jani models.
+            if (!useFallback || !fallbackEngine || !input.model ||
+                (input.model->getModelType() == storm::storage::SymbolicModelDescription::ModelType::MA && !input.model->isJaniModel()) ||
+                !storm::utility::canHandle<VerificationValueType>(
+                    fallbackEngine.get(), input.preprocessedProperties.is_initialized() ? input.preprocessedProperties.get() : input.properties,
+                    input.model.get())) {
+                throw;
+            }
+            STORM_PRINT_AND_LOG("The " << mpi.engine << " engine exceeds the memory limit: " << e.what() << " Switching to the " << fallbackEngine.get()
+                                       << " engine.\n");
+            mpi.engine = fallbackEngine.get();
+        }
+    }
+}
+
+inline void startLtlPretranslation(SymbolicInput const& input) {
+    // Whether the model is nondeterministic determines the shape of the automaton, so we need a symbolic description.
+    if (!input.model) {
+        STORM_LOG_WARN("LTL formulas are not pre-translated as the model is not given symbolically.");
+        return;
+    }
+    bool nondeterministic = input.model->isPrismProgram() ? !input.model->asPrismProgram().isDeterministicModel()
+                                                          : !input.model->asJaniModel().isDeterministicModel();
+    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    boost::optional<std::string> ltl2daTool;
+    if (modelCheckerSettings.isLtl2daToolSet()) {
+        ltl2daTool = modelCheckerSettings.getLtl2daTool();
+    }
+
+    for (auto const& property : input.properties) {
+        auto const& formula = *property.getRawFormula();
+        if (!formula.isProbabilityOperatorFormula() || !formula.asProbabilityOperatorFormula().getSubformula().info(false).containsComplexPathFormula()) {
+            continue;
+        }
+        auto const& operatorFormula = formula.asProbabilityOperatorFormula();
+        // Prepare the formula exactly as the LTL helper does, such that the model checker finds the automaton in the cache.
+        storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+        std::shared_ptr<storm::logic::Formula const> ltlFormula =
+            storm::logic::ExtractMaximalStateFormulasVisitor::extract(operatorFormula.getSubformula().asPathFormula(), extracted);
+        if (nondeterministic) {
+            // The optimization direction is derived as in the check task. Without one, the model checker rejects the formula anyway.
+            bool minimize;
+            if (operatorFormula.hasOptimalityType()) {
+                minimize = operatorFormula.getOptimalityType() == storm::OptimizationDirection::Minimize;
+            } else if (operatorFormula.hasBound()) {
+                minimize = operatorFormula.getComparisonType() != storm::logic::ComparisonType::Less &&
+                           operatorFormula.getComparisonType() != storm::logic::ComparisonType::LessEqual;
+            } else {
+                continue;
+            }
+            if (minimize) {
+                ltlFormula = std::make_shared<storm::logic::UnaryBooleanPathFormula>(storm::logic::UnaryBooleanOperatorType::Not, ltlFormula);
+            }
+        }
+        storm::automata::LTL2DeterministicAutomaton::startTranslation(ltlFormula, nondeterministic, ltl2daTool);
+    }
+}
+
 template<storm::dd::DdType DdType, typename BuildValueType, typename VerificationValueType = BuildValueType>
 void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto abstractionSettings = storm::settings::getModule<storm::settings::modules::AbstractionSettings>();
@@ -1316,14 +1865,21 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Simulation) {
+        verifyWithSimulationEngine<VerificationValueType>(input, mpi);
     } else {
+        if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isLtlPretranslationSet()) {
+            startLtlPretranslation(input);
+        }
+        // The engine may change if building the model exceeds the memory limit.
+        ModelProcessingInformation modelMpi = mpi;
         std::shared_ptr<storm::models::ModelBase> model =
-            buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
+            buildPreprocessExportModelWithEngineFallback<DdType, BuildValueType, VerificationValueType>(input, modelMpi);
         if (model) {
             if (counterexampleSettings.isCounterexampleSet()) {
                 generateCounterexamples<VerificationValueType>(model, input);
             } else {
-                verifyModel<DdType, VerificationValueType>(model, input, mpi);
+                verifyModel<DdType, VerificationValueType>(model, input, modelMpi);
             }
         }
     }
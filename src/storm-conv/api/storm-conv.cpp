@@ -10,6 +10,7 @@
 #include "storm/storage/prism/Program.h"
 
 #include "storm/api/properties.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/io/file.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -129,12 +130,24 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
     return res;
 }
 
-void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact) {
-    storm::jani::JsonExporter::toFile(model, properties, filename, true, compact);
+void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact,
+                      bool streaming, bool shareExpressions) {
+    STORM_LOG_THROW(streaming || !shareExpressions, storm::exceptions::InvalidArgumentException, "Sharing expressions requires a streamed export.");
+    if (streaming) {
+        storm::jani::JsonExporter::toFileIncrementally(model, properties, filename, true, compact, shareExpressions);
+    } else {
+        storm::jani::JsonExporter::toFile(model, properties, filename, true, compact);
+    }
 }
 
-void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact) {
-    storm::jani::JsonExporter::toStream(model, properties, ostream, true, compact);
+void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact,
+                       bool streaming, bool shareExpressions) {
+    STORM_LOG_THROW(streaming || !shareExpressions, storm::exceptions::InvalidArgumentException, "Sharing expressions requires a streamed export.");
+    if (streaming) {
+        storm::jani::JsonExporter::toStreamIncrementally(model, properties, ostream, true, compact, shareExpressions);
+    } else {
+        storm::jani::JsonExporter::toStream(model, properties, ostream, true, compact);
+    }
 }
 
 void exportPrismToFile(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename) {
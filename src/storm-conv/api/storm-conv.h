@@ -23,8 +23,15 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> convertPrismTo
     storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties = std::vector<storm::jani::Property>(),
     storm::converter::PrismToJaniConverterOptions options = storm::converter::PrismToJaniConverterOptions());
 
-void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact = false);
-void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact = false);
+/*!
+ * Exports the jani model and its properties.
+ * @param streaming If set, the json representation of the whole model is not built in memory but written incrementally.
+ * @param shareExpressions If set (requires streaming), expressions occurring multiple times in an automaton are exported once as function.
+ */
+void exportJaniToFile(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::string const& filename, bool compact = false,
+                      bool streaming = false, bool shareExpressions = false);
+void printJaniToStream(storm::jani::Model const& model, std::vector<storm::jani::Property> const& properties, std::ostream& ostream, bool compact = false,
+                       bool streaming = false, bool shareExpressions = false);
 void exportPrismToFile(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::string const& filename);
 void printPrismToStream(storm::prism::Program const& program, std::vector<storm::jani::Property> const& properties, std::ostream& ostream);
 
@@ -7,6 +7,9 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/macros.h"
+
 #include <boost/algorithm/string.hpp>
 
 namespace storm {
@@ -20,6 +23,8 @@ const std::string JaniExportSettings::locationVariablesOptionName = "location-va
 const std::string JaniExportSettings::globalVariablesOptionName = "globalvars";
 const std::string JaniExportSettings::localVariablesOptionName = "localvars";
 const std::string JaniExportSettings::compactJsonOptionName = "compactjson";
+const std::string JaniExportSettings::streamingOptionName = "streaming";
+const std::string JaniExportSettings::shareExpressionsOptionName = "share-expressions";
 const std::string JaniExportSettings::eliminateArraysOptionName = "remove-arrays";
 const std::string JaniExportSettings::eliminateFunctionsOptionName = "remove-functions";
 const std::string JaniExportSettings::replaceUnassignedVariablesWithConstantsOptionName = "replace-unassigned-vars";
@@ -49,6 +54,15 @@ JaniExportSettings::JaniExportSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, compactJsonOptionName, false,
                                                    "If set, the size of the resulting jani file will be reduced at the cost of (human-)readability.")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, streamingOptionName, false,
+                                                   "If set, the jani file is written incrementally without building its json representation in memory.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, shareExpressionsOptionName, false,
+                                                   "If set, expressions that occur multiple times in an automaton are exported once as a function. Requires "
+                                                   "--" + streamingOptionName + ".")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, eliminateArraysOptionName, false,
                                                    "If set, transforms the model such that array variables/expressions are eliminated.")
                         .build());
@@ -119,6 +133,14 @@ bool JaniExportSettings::isCompactJsonSet() const {
     return this->getOption(compactJsonOptionName).getHasOptionBeenSet();
 }
 
+bool JaniExportSettings::isStreamingSet() const {
+    return this->getOption(streamingOptionName).getHasOptionBeenSet();
+}
+
+bool JaniExportSettings::isShareExpressionsSet() const {
+    return this->getOption(shareExpressionsOptionName).getHasOptionBeenSet();
+}
+
 bool JaniExportSettings::isEliminateArraysSet() const {
     return this->getOption(eliminateArraysOptionName).getHasOptionBeenSet();
 }
@@ -150,6 +172,10 @@ uint64_t JaniExportSettings::getLocationEliminationEdgesHeuristic() const {
 void JaniExportSettings::finalize() {}
 
 bool JaniExportSettings::check() const {
+    STORM_LOG_THROW(!isShareExpressionsSet() || isStreamingSet(), storm::exceptions::InvalidSettingsException,
+                    "Sharing expressions is only supported for streamed jani exports.");
+    STORM_LOG_THROW(!isShareExpressionsSet() || !isEliminateFunctionsSet(), storm::exceptions::InvalidSettingsException,
+                    "Sharing expressions introduces functions which conflicts with removing them.");
     return true;
 }
 }  // namespace modules
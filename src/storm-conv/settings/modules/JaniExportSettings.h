@@ -25,6 +25,10 @@ class JaniExportSettings : public ModuleSettings {
 
     bool isCompactJsonSet() const;
 
+    bool isStreamingSet() const;
+
+    bool isShareExpressionsSet() const;
+
     bool isEliminateArraysSet() const;
 
     bool isEliminateFunctionsSet() const;
@@ -51,6 +55,8 @@ class JaniExportSettings : public ModuleSettings {
     static const std::string globalVariablesOptionName;
     static const std::string localVariablesOptionName;
     static const std::string compactJsonOptionName;
+    static const std::string streamingOptionName;
+    static const std::string shareExpressionsOptionName;
     static const std::string eliminateArraysOptionName;
     static const std::string eliminateFunctionsOptionName;
     static const std::string replaceUnassignedVariablesWithConstantsOptionName;
@@ -15,14 +15,15 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCountere
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCounterexampleMaxSmt(storm::storage::SymbolicModelDescription const& symbolicModel,
                                                                                              std::shared_ptr<storm::models::sparse::Model<double>> model,
-                                                                                             std::shared_ptr<storm::logic::Formula const> const& formula) {
+                                                                                             std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                             std::shared_ptr<storm::counterexamples::SMTMinimalLabelSetGenerator<double>::RelevancyCache> const& relevancyCache) {
     Environment env;
-    return storm::counterexamples::SMTMinimalLabelSetGenerator<double>::computeCounterexample(env, symbolicModel, *model, formula);
+    return storm::counterexamples::SMTMinimalLabelSetGenerator<double>::computeCounterexample(env, symbolicModel, *model, formula, relevancyCache);
 }
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model,
                                                                                            std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                                           size_t maxK) {
+                                                                                           size_t maxK, uint64_t memoryLimitInBytes) {
     // Only accept formulas of the form "P </<= x [F target]
     STORM_LOG_THROW(formula->isProbabilityOperatorFormula(), storm::exceptions::InvalidPropertyException,
                     "Counterexample generation does not support this kind of formula. Expecting a probability operator as the outermost formula element.");
@@ -58,18 +59,23 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCoun
 
     auto generator = storm::utility::ksp::ShortestPathsGenerator<double>(*model, subQualitativeResult.getTruthValuesVector());
     storm::counterexamples::PathCounterexample<double> cex(model);
-    double probability = 0;
+    size_t k = 0;
     bool thresholdExceeded = false;
-    for (size_t k = 1; k <= maxK; ++k) {
-        cex.addPath(generator.getPathAsList(k), k);
-        probability += generator.getDistance(k);
-        // Check if accumulated probability mass is already enough
-        if ((probability > threshold) || (strictBound && probability >= threshold && strictBound)) {
-            thresholdExceeded = true;
-            break;
-        }
-    }
-    STORM_LOG_WARN_COND(thresholdExceeded, "Aborted computation because maximal number of paths was reached. Probability threshold is not yet exceeded.");
+    // Paths are computed lazily and in order of decreasing probability
+    auto enumerationResult = generator.enumeratePaths(
+        [&](storm::utility::ksp::OrderedStateList const& path, double const&, double const& probability) {
+            cex.addPath(path, ++k);
+            // Check if accumulated probability mass is already enough
+            thresholdExceeded = (probability > threshold) || (strictBound && probability >= threshold);
+            return !thresholdExceeded && k < maxK;
+        },
+        memoryLimitInBytes);
+    STORM_LOG_WARN_COND(thresholdExceeded || enumerationResult != storm::utility::ksp::EnumerationResult::stoppedByCallback,
+                        "Aborted computation because maximal number of paths was reached. Probability threshold is not yet exceeded.");
+    STORM_LOG_WARN_COND(enumerationResult != storm::utility::ksp::EnumerationResult::memoryLimitReached,
+                        "Aborted computation because the memory limit was reached after " << k << " paths. Probability threshold is not yet exceeded.");
+    STORM_LOG_WARN_COND(enumerationResult != storm::utility::ksp::EnumerationResult::noFurtherPath,
+                        "All " << k << " paths were enumerated but the probability threshold is not exceeded due to numerical imprecision.");
 
     return std::make_shared<storm::counterexamples::PathCounterexample<double>>(cex);
 }
@@ -13,11 +13,13 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCountere
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeHighLevelCounterexampleMaxSmt(storm::storage::SymbolicModelDescription const& symbolicModel,
                                                                                              std::shared_ptr<storm::models::sparse::Model<double>> model,
-                                                                                             std::shared_ptr<storm::logic::Formula const> const& formula);
+                                                                                             std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                             std::shared_ptr<storm::counterexamples::SMTMinimalLabelSetGenerator<double>::RelevancyCache> const& relevancyCache = nullptr);
 
 std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model,
                                                                                            std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                                           size_t maxK);
+                                                                                           size_t maxK,
+                                                                                           uint64_t memoryLimitInBytes = std::numeric_limits<uint64_t>::max());
 
 }  // namespace api
 }  // namespace storm
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
@@ -21,6 +22,7 @@
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/storage/BoostTypes.h"
+#include "storm/storage/Scheduler.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/JaniChoiceOrigins.h"
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
@@ -842,6 +844,53 @@ class MILPMinimalLabelSetGenerator {
         return numberOfConstraintsCreated;
     }
 
+    /*!
+     * Computes the labels that are taken by the given scheduler in the relevant states.
+     *
+     * @param mdp The MDP.
+     * @param labelSets The label sets of the choices.
+     * @param stateInformation The information about the states in the model.
+     * @param choiceInformation The information about the choices in the model.
+     * @param scheduler A memoryless deterministic scheduler for the MDP.
+     */
+    static storm::storage::FlatSet<uint_fast64_t> getLabelsOfScheduler(storm::models::sparse::Mdp<T> const& mdp,
+                                                                       std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
+                                                                       StateInformation const& stateInformation, ChoiceInformation const& choiceInformation,
+                                                                       storm::storage::Scheduler<T> const& scheduler) {
+        storm::storage::FlatSet<uint_fast64_t> result = choiceInformation.knownLabels;
+        for (auto state : stateInformation.relevantStates) {
+            uint_fast64_t choice = mdp.getNondeterministicChoiceIndices()[state] + scheduler.getChoice(state).getDeterministicChoice();
+            auto const& relevantChoices = choiceInformation.relevantChoicesForRelevantStates.at(state);
+            // Choices that are not relevant do not contribute to the reachability probability, so their labels are not needed.
+            if (std::find(relevantChoices.begin(), relevantChoices.end(), choice) != relevantChoices.end()) {
+                result.insert(labelSets[choice].begin(), labelSets[choice].end());
+            }
+        }
+        return result;
+    }
+
+    /*!
+     * Seeds the solver with the given label set which is known to induce a subsystem that exceeds the probability threshold.
+     * The label set is passed as initial solution (if supported by the solver) and bounds the number of labels that need to be considered.
+     *
+     * @param solver The MILP solver.
+     * @param labelSet A label set whose induced subsystem exceeds the probability threshold.
+     * @param variableInformation A struct with information about the variables of the model.
+     * @return The total number of constraints that were created.
+     */
+    static uint_fast64_t assertHeuristicLabelSet(storm::solver::LpSolver<double>& solver, storm::storage::FlatSet<uint_fast64_t> const& labelSet,
+                                                 VariableInformation const& variableInformation) {
+        storm::expressions::Expression constraint = solver.getConstant(0);
+        for (auto const& labelVariablePair : variableInformation.labelToVariableMap) {
+            constraint = constraint + labelVariablePair.second;
+            solver.setInitialValue(labelVariablePair.second, labelSet.count(labelVariablePair.first) > 0 ? 1.0 : 0.0);
+        }
+        // All taken labels have a variable, so the size of the label set bounds the objective value.
+        constraint = constraint <= solver.getConstant(labelSet.size());
+        solver.addConstraint("HeuristicLabelSetBound", constraint);
+        return 1;
+    }
+
     /*!
      * Builds a system of constraints that express that the reachability probability in the subsystem exceeeds
      * the given threshold.
@@ -985,20 +1034,19 @@ class MILPMinimalLabelSetGenerator {
         STORM_LOG_THROW(mdp.getNumberOfChoices() == labelSets.size(), storm::exceptions::InvalidArgumentException,
                         "The given number of labels does not match the number of choices.");
 
-        // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
+        // (1) Compute the maximal reachability probabilities along with a maximizing scheduler. The labels taken by the scheduler form a first
+        // (heuristic) solution. Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
         double maximalReachabilityProbability = 0;
+        storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelcheckerHelper;
+        auto maximalReachabilityResult = modelcheckerHelper.computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), mdp.getBackwardTransitions(),
+                                                                                      phiStates, psiStates, false, true);
+        for (auto state : mdp.getInitialStates()) {
+            maximalReachabilityProbability = std::max(maximalReachabilityProbability, maximalReachabilityResult.values[state]);
+        }
+        bool thresholdFeasible = (strictBound && maximalReachabilityProbability >= probabilityThreshold) ||
+                                 (!strictBound && maximalReachabilityProbability > probabilityThreshold);
         if (checkThresholdFeasible) {
-            storm::modelchecker::helper::SparseMdpPrctlHelper<T> modelcheckerHelper;
-            std::vector<T> result = std::move(
-                modelcheckerHelper
-                    .computeUntilProbabilities(env, false, mdp.getTransitionMatrix(), mdp.getBackwardTransitions(), phiStates, psiStates, false, false)
-                    .values);
-            for (auto state : mdp.getInitialStates()) {
-                maximalReachabilityProbability = std::max(maximalReachabilityProbability, result[state]);
-            }
-            STORM_LOG_THROW((strictBound && maximalReachabilityProbability >= probabilityThreshold) ||
-                                (!strictBound && maximalReachabilityProbability > probabilityThreshold),
-                            storm::exceptions::InvalidArgumentException,
+            STORM_LOG_THROW(thresholdFeasible, storm::exceptions::InvalidArgumentException,
                             "Given probability threshold " << probabilityThreshold << " can not be " << (strictBound ? "achieved" : "exceeded")
                                                            << " in model with maximal reachability probability of " << maximalReachabilityProbability << ".");
             std::cout << "\nMaximal reachability in model is " << maximalReachabilityProbability << ".\n\n";
@@ -1020,10 +1068,19 @@ class MILPMinimalLabelSetGenerator {
         buildConstraintSystem(*solver, mdp, labelSets, psiStates, stateInformation, choiceInformation, variableInformation, probabilityThreshold, strictBound,
                               includeSchedulerCuts);
 
-        // (4.3) Optimize the model.
+        //  (4.3) Seed the solver with the labels of the maximizing scheduler.
+        if (thresholdFeasible && maximalReachabilityResult.scheduler) {
+            storm::storage::FlatSet<uint_fast64_t> heuristicLabelSet =
+                getLabelsOfScheduler(mdp, labelSets, stateInformation, choiceInformation, *maximalReachabilityResult.scheduler);
+            STORM_LOG_INFO("Seeding MILP with a label set of size " << heuristicLabelSet.size() << " taken by a maximizing scheduler.");
+            assertHeuristicLabelSet(*solver, heuristicLabelSet, variableInformation);
+            solver->update();
+        }
+
+        // (4.4) Optimize the model.
         solver->optimize();
 
-        // (4.4) Read off result from variables.
+        // (4.5) Read off result from variables.
         storm::storage::FlatSet<uint_fast64_t> usedLabelSet = getUsedLabelsInSolution(*solver, variableInformation);
         usedLabelSet.insert(choiceInformation.knownLabels.begin(), choiceInformation.knownLabels.end());
 
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <map>
+#include <mutex>
 #include <queue>
+#include <tuple>
 
 #include "storm-counterexamples/counterexamples/GuaranteedLabelSet.h"
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
@@ -21,6 +25,7 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/utility/cli.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 
@@ -1692,12 +1697,35 @@ class SMTMinimalLabelSetGenerator {
     }
 
    public:
+    /*!
+     * Caches the label sets of the choices of a model as well as its relevant states and labels (per combination of phi states, psi states and
+     * don't care labels). Passing the same cache when generating counterexamples for several properties of the same model avoids repeating
+     * this preprocessing.
+     */
+    class RelevancyCache {
+       public:
+        RelevancyCache(storm::models::sparse::Model<T> const& model) : model(model) {
+            // Intentionally left empty.
+        }
+
+       private:
+        friend class SMTMinimalLabelSetGenerator<T>;
+
+        storm::models::sparse::Model<T> const& model;
+#ifdef STORM_HAVE_Z3
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets;
+        std::map<std::tuple<storm::storage::BitVector, storm::storage::BitVector, storm::storage::FlatSet<uint_fast64_t>>, RelevancyInformation>
+            relevancyInformation;
+#endif
+    };
+
     struct Options {
         Options(bool checkThresholdFeasible = false) : checkThresholdFeasible(checkThresholdFeasible) {
             auto const& settings = storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>();
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            portfolioSize = settings.getPortfolioSize();
         }
 
         bool checkThresholdFeasible;
@@ -1709,6 +1737,10 @@ class SMTMinimalLabelSetGenerator {
         uint64_t maximumCounterexamples = 1;
         uint64_t multipleCounterexampleSizeCap = 100000000;
         uint64_t maximumExtraIterations = 100000000;
+        // The number of differently configured solvers that search for a counterexample in parallel. The result of the first one that finishes is taken.
+        uint64_t portfolioSize = 1;
+        // If set, the preprocessing results are taken from (and stored in) this cache.
+        std::shared_ptr<RelevancyCache> relevancyCache;
     };
 
     struct GeneratorStats {
@@ -1720,84 +1752,165 @@ class SMTMinimalLabelSetGenerator {
         uint64_t iterations;
     };
 
+   private:
+#ifdef STORM_HAVE_Z3
     /*!
-     * Computes the minimal command set that is needed in the given model to exceed the given probability threshold for satisfying phi until psi.
-     *
-     * @param symbolicModel The symbolic model description that was used to build the model.
-     * @param model The sparse model in which to find the minimal command set.
-     * @param phiStates A bit vector characterizing all phi states in the model.
-     * @param psiStates A bit vector characterizing all psi states in the model.
-     * @param propertyThreshold The threshold that is to be achieved or exceeded.
-     * @param rewardName The name of the reward structure to use, or boost::none if probabilities are considerd.
-     * @param strictBound Indicates whether the threshold needs to be achieved (true) or exceeded (false).
-     * @param options A set of options for customization.
+     * Computes the maximal probability to reach the psi states for candidate label sets. The relevant states and choices are extracted once,
+     * a candidate is then checked by value iteration on this part of the model, using only the choices whose labels are contained in the candidate.
+     * As value iteration approaches the result from below, it stops as soon as the threshold is exceeded and it starts from the values of the
+     * previous candidate if that one is a subset of the current one.
      */
-    static std::vector<storm::storage::FlatSet<uint_fast64_t>> getMinimalLabelSet(
-        Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel,
-        storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-        std::vector<double> propertyThreshold, boost::optional<std::vector<std::string>> const& rewardName, bool strictBound,
-        storm::storage::FlatSet<uint_fast64_t> const& dontCareLabels = storm::storage::FlatSet<uint_fast64_t>(), Options const& options = Options()) {
-#ifdef STORM_HAVE_Z3
-        STORM_LOG_THROW(propertyThreshold.size() > 0, storm::exceptions::InvalidArgumentException, "At least one threshold has to be specified.");
-        STORM_LOG_THROW(propertyThreshold.size() == 1 || (rewardName && rewardName.get().size() == propertyThreshold.size()),
-                        storm::exceptions::InvalidArgumentException, "Multiple thresholds is only supported for multiple reward structures");
-        std::vector<storm::storage::FlatSet<uint_fast64_t>> result;
-        // Set up all clocks used for time measurement.
-        auto totalClock = std::chrono::high_resolution_clock::now();
-        auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
-        decltype(std::chrono::high_resolution_clock::now() - totalClock) totalTime(0);
-
-        auto setupTimeClock = std::chrono::high_resolution_clock::now();
-        decltype(std::chrono::high_resolution_clock::now() - setupTimeClock) totalSetupTime(0);
-
-        auto solverClock = std::chrono::high_resolution_clock::now();
-        decltype(std::chrono::high_resolution_clock::now() - solverClock) totalSolverTime(0);
-
-        auto modelCheckingClock = std::chrono::high_resolution_clock::now();
-        decltype(std::chrono::high_resolution_clock::now() - modelCheckingClock) totalModelCheckingTime(0);
-
-        auto analysisClock = std::chrono::high_resolution_clock::now();
-        decltype(std::chrono::high_resolution_clock::now() - analysisClock) totalAnalysisTime(0);
-
-        // (0) Obtain the label sets for each choice.
-        // The label set of a choice corresponds to the set of prism commands that induce the choice.
-        STORM_LOG_THROW(model.hasChoiceOrigins(), storm::exceptions::InvalidArgumentException,
-                        "Restriction to minimal command set is impossible for model without choice origins.");
-        STORM_LOG_THROW(model.getChoiceOrigins()->isPrismChoiceOrigins() || model.getChoiceOrigins()->isJaniChoiceOrigins(),
-                        storm::exceptions::InvalidArgumentException, "Restriction to label set is impossible for model without PRISM or JANI choice origins.");
-
-        std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets(model.getNumberOfChoices());
-        if (model.getChoiceOrigins()->isPrismChoiceOrigins()) {
-            storm::storage::sparse::PrismChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asPrismChoiceOrigins();
-            for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
-                labelSets[choice] = choiceOrigins.getCommandSet(choice);
+    class CandidateChecker {
+       public:
+        CandidateChecker(storm::models::sparse::Model<T> const& model, std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
+                         storm::storage::BitVector const& psiStates, RelevancyInformation const& relevancyInformation)
+            : relevantStates(relevancyInformation.relevantStates), values(relevancyInformation.relevantStates.getNumberOfSetBits()) {
+            std::vector<uint_fast64_t> relevantIndices = relevantStates.getNumberOfSetBitsBeforeIndices();
+            storm::storage::SparseMatrix<T> const& transitionMatrix = model.getTransitionMatrix();
+            storm::storage::SparseMatrixBuilder<T> builder(0, values.size(), 0, false, true, values.size());
+            uint_fast64_t currentRow = 0;
+            for (auto state : relevantStates) {
+                builder.newRowGroup(currentRow);
+                for (auto choice : relevancyInformation.relevantChoicesForRelevantStates.at(state)) {
+                    T targetProbability = storm::utility::zero<T>();
+                    for (auto const& entry : transitionMatrix.getRow(choice)) {
+                        if (psiStates.get(entry.getColumn())) {
+                            targetProbability += entry.getValue();
+                        } else if (relevantStates.get(entry.getColumn())) {
+                            builder.addNextValue(currentRow, relevantIndices[entry.getColumn()], entry.getValue());
+                        }
+                    }
+                    choiceLabelSets.push_back(&labelSets[choice]);
+                    targetProbabilities.push_back(targetProbability);
+                    ++currentRow;
+                }
             }
-        } else {
-            storm::storage::sparse::JaniChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asJaniChoiceOrigins();
-            for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
-                labelSets[choice] = choiceOrigins.getEdgeIndexSet(choice);
+            matrix = builder.build(currentRow, values.size(), values.size());
+            for (auto state : model.getInitialStates()) {
+                if (psiStates.get(state)) {
+                    initialStateIsTarget = true;
+                } else if (relevantStates.get(state)) {
+                    initialStates.push_back(relevantIndices[state]);
+                }
             }
         }
-        assert(labelSets.size() == model.getNumberOfChoices());
 
-        // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
-        std::vector<double> maximalReachabilityProbability;
-        if (options.checkThresholdFeasible) {
-            maximalReachabilityProbability = computeMaximalReachabilityProbability(env, model, phiStates, psiStates, rewardName);
+        /*!
+         * Computes the maximal reachability probability (over all initial states) in the sub-model induced by the given label set.
+         * The computation stops early once the (lower bound on the) value satisfies the threshold.
+         */
+        T computeMaximalReachabilityProbability(storm::storage::FlatSet<uint_fast64_t> const& labelSet, T const& threshold, bool strictBound) {
+            if (initialStateIsTarget) {
+                return storm::utility::one<T>();
+            }
+            storm::storage::BitVector enabledChoices(choiceLabelSets.size());
+            for (uint_fast64_t choice = 0; choice < choiceLabelSets.size(); ++choice) {
+                enabledChoices.set(choice, std::includes(labelSet.begin(), labelSet.end(), choiceLabelSets[choice]->begin(), choiceLabelSets[choice]->end()));
+            }
+            // The previous values are still a lower bound if all previously enabled choices are still enabled.
+            if (previouslyEnabledChoices.size() != enabledChoices.size() || !previouslyEnabledChoices.isSubsetOf(enabledChoices)) {
+                std::fill(values.begin(), values.end(), storm::utility::zero<T>());
+            }
+            previouslyEnabledChoices = enabledChoices;
 
-            for (uint64_t i = 0; i < maximalReachabilityProbability.size(); ++i) {
-                STORM_LOG_THROW((strictBound && maximalReachabilityProbability[i] >= propertyThreshold[i]) ||
-                                    (!strictBound && maximalReachabilityProbability[i] > propertyThreshold[i]),
-                                storm::exceptions::InvalidArgumentException,
-                                "Given probability threshold " << propertyThreshold[i] << " can not be " << (strictBound ? "achieved" : "exceeded")
-                                                               << " in model with maximal reachability probability of " << maximalReachabilityProbability[i]
-                                                               << ".");
-                std::cout << "\nMaximal property value in model is " << maximalReachabilityProbability[i] << ".\n\n";
+            auto getInitialValue = [&]() {
+                T result = storm::utility::zero<T>();
+                for (auto state : initialStates) {
+                    result = std::max(result, values[state]);
+                }
+                return result;
+            };
+            auto const& rowGroupIndices = matrix.getRowGroupIndices();
+            bool converged = false;
+            while (!converged) {
+                // Gauss-Seidel style update, values only increase
+                converged = true;
+                for (uint_fast64_t state = 0; state < values.size(); ++state) {
+                    T best = values[state];
+                    for (auto choice = enabledChoices.getNextSetIndex(rowGroupIndices[state]); choice < rowGroupIndices[state + 1];
+                         choice = enabledChoices.getNextSetIndex(choice + 1)) {
+                        T value = targetProbabilities[choice] + matrix.multiplyRowWithVector(choice, values);
+                        best = std::max(best, value);
+                    }
+                    if (best - values[state] > precision * best) {
+                        converged = false;
+                    }
+                    values[state] = best;
+                }
+                T initialValue = getInitialValue();
+                if ((strictBound && initialValue >= threshold) || (!strictBound && initialValue > threshold)) {
+                    break;
+                }
             }
+            return getInitialValue();
         }
 
-        // (2) Identify all states and commands that are relevant, because only these need to be considered later.
-        RelevancyInformation relevancyInformation = determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels);
+       private:
+        // The relative precision used to detect convergence.
+        static constexpr double precision = 1e-6;
+
+        storm::storage::BitVector relevantStates;
+        // The relevant choices of the relevant states, restricted to transitions between relevant states.
+        storm::storage::SparseMatrix<T> matrix;
+        // For each relevant choice, its labels and the probability to move to a psi state.
+        std::vector<storm::storage::FlatSet<uint_fast64_t> const*> choiceLabelSets;
+        std::vector<T> targetProbabilities;
+        // The indices of the relevant initial states.
+        std::vector<uint_fast64_t> initialStates;
+        bool initialStateIsTarget = false;
+
+        // The values and enabled choices of the previously checked candidate.
+        std::vector<T> values;
+        storm::storage::BitVector previouslyEnabledChoices;
+    };
+
+    // The outcome of the search of one solver configuration.
+    struct SearchResult {
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> labelSets;
+        std::chrono::high_resolution_clock::duration setupTime{0}, solverTime{0}, modelCheckingTime{0}, analysisTime{0};
+        std::chrono::milliseconds cutTime{0};
+        uint_fast64_t iterations = 0;
+        uint_fast64_t zeroProbabilityCount = 0;
+        bool aborted = false;
+    };
+
+    /*!
+     * Returns the configurations for a portfolio of the given size. The first configuration is the given one, the others differ in the encoding of
+     * reachability, the use of dynamic constraints and the backward implication cuts.
+     */
+    static std::vector<Options> getPortfolio(Options const& options) {
+        std::vector<Options> result = {options};
+        std::vector<std::function<void(Options&)>> variations = {[](Options& o) { o.encodeReachability = !o.encodeReachability; },
+                                                                 [](Options& o) { o.useDynamicConstraints = !o.useDynamicConstraints; },
+                                                                 [](Options& o) { o.addBackwardImplicationCuts = !o.addBackwardImplicationCuts; }};
+        for (uint64_t i = 0; result.size() < options.portfolioSize && i < variations.size(); ++i) {
+            result.push_back(options);
+            variations[i](result.back());
+        }
+        STORM_LOG_WARN_COND(result.size() == std::max<uint64_t>(options.portfolioSize, 1),
+                            "Portfolio is restricted to " << result.size() << " solver configurations.");
+        return result;
+    }
+
+    /*!
+     * Searches for minimal label sets with a single solver configured by the given options.
+     * The search stops early (and is marked as aborted) once the given flag is set.
+     */
+    static SearchResult searchMinimalLabelSets(Environment const& env, storm::storage::SymbolicModelDescription const& symbolicModel,
+                                               storm::models::sparse::Model<T> const& model,
+                                               std::vector<storm::storage::FlatSet<uint_fast64_t>> const& labelSets,
+                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                               std::vector<double> const& propertyThreshold, boost::optional<std::vector<std::string>> const& rewardName,
+                                               bool strictBound, RelevancyInformation const& relevancyInformation, Options const& options,
+                                               std::atomic<bool> const& stopSearch) {
+        SearchResult searchResult;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>>& result = searchResult.labelSets;
+        auto totalClock = std::chrono::high_resolution_clock::now();
+        auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+        auto setupTimeClock = std::chrono::high_resolution_clock::now();
+        auto solverClock = std::chrono::high_resolution_clock::now();
+        auto modelCheckingClock = std::chrono::high_resolution_clock::now();
+        auto analysisClock = std::chrono::high_resolution_clock::now();
 
         // (3) Create a solver.
         std::shared_ptr<storm::expressions::ExpressionManager> manager = std::make_shared<storm::expressions::ExpressionManager>();
@@ -1813,12 +1926,18 @@ class SMTMinimalLabelSetGenerator {
         variableInformation.adderVariables = assertAdder(*solver, variableInformation);
         variableInformation.auxiliaryVariables.push_back(assertLessOrEqualKRelaxed(*solver, variableInformation, 0));
 
+        // Probabilities of candidates are checked on the relevant part of the model only.
+        boost::optional<CandidateChecker> candidateChecker;
+        if (!rewardName) {
+            candidateChecker.emplace(model, labelSets, psiStates, relevancyInformation);
+        }
+
         // As we are done with the setup at this point, stop the clock for the setup time.
-        totalSetupTime = std::chrono::high_resolution_clock::now() - setupTimeClock;
+        searchResult.setupTime = std::chrono::high_resolution_clock::now() - setupTimeClock;
 
         // (6) Add constraints that cut off a lot of suboptimal solutions.
         STORM_LOG_DEBUG("Asserting cuts.");
-        stats.cutTime =
+        searchResult.cutTime =
             assertCuts(symbolicModel, model, labelSets, psiStates, variableInformation, relevancyInformation, *solver, options.addBackwardImplicationCuts);
         STORM_LOG_DEBUG("Asserted cuts.");
         if (options.encodeReachability) {
@@ -1830,28 +1949,33 @@ class SMTMinimalLabelSetGenerator {
         // satisfying phi until psi exceeds the given threshold, the set of labels is minimal and can be returned.
         // Otherwise, the current solution has to be ruled out and the next smallest solution is retrieved from
         // the solver.
-
         storm::storage::FlatSet<uint_fast64_t> commandSet(relevancyInformation.knownLabels);
 
         // If there are no relevant labels, return directly.
         if (relevancyInformation.relevantLabels.empty()) {
-            return {commandSet};
+            searchResult.labelSets = {commandSet};
+            return searchResult;
         } else if (relevancyInformation.minimalityLabels.empty()) {
             commandSet.insert(relevancyInformation.relevantLabels.begin(), relevancyInformation.relevantLabels.end());
-            return {commandSet};
+            searchResult.labelSets = {commandSet};
+            return searchResult;
         }
 
         // Set up some variables for the iterations.
         bool done = false;
         uint_fast64_t lastSize = 0;
-        uint_fast64_t iterations = 0;
+        uint_fast64_t& iterations = searchResult.iterations;
         uint_fast64_t currentBound = 0;
         uint64_t firstCounterexampleFound = 0;  // The value is not queried before being set.
         std::vector<double> maximalPropertyValue;
-        uint_fast64_t zeroProbabilityCount = 0;
+        uint_fast64_t& zeroProbabilityCount = searchResult.zeroProbabilityCount;
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
         do {
+            if (stopSearch) {
+                searchResult.aborted = true;
+                break;
+            }
             ++iterations;
 
             if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
@@ -1864,7 +1988,7 @@ class SMTMinimalLabelSetGenerator {
             STORM_LOG_DEBUG("Computing minimal command set.");
             solverClock = std::chrono::high_resolution_clock::now();
             boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
-            totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
+            searchResult.solverTime += std::chrono::high_resolution_clock::now() - solverClock;
             if (smallest == boost::none) {
                 STORM_LOG_DEBUG("No further counterexamples.");
                 break;
@@ -1890,13 +2014,22 @@ class SMTMinimalLabelSetGenerator {
                 break;
             }
 
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
-
             // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
-            totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
+            std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+            std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+            auto buildSubModel = [&]() {
+                auto subChoiceOrigins =
+                    restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+                subModel = subChoiceOrigins.first;
+                subLabelSets = std::move(subChoiceOrigins.second);
+            };
+            if (candidateChecker) {
+                maximalPropertyValue = {candidateChecker->computeMaximalReachabilityProbability(commandSet, propertyThreshold.front(), strictBound)};
+            } else {
+                buildSubModel();
+                maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+            }
+            searchResult.modelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
             // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
             // process.
@@ -1913,6 +2046,11 @@ class SMTMinimalLabelSetGenerator {
                 }
 
                 if (options.useDynamicConstraints) {
+                    // The analysis needs the sub-model
+                    if (!subModel) {
+                        buildSubModel();
+                    }
+
                     // Determine which of the two analysis techniques to call by performing a reachability analysis.
                     storm::storage::BitVector reachableStates =
                         storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
@@ -1951,7 +2089,7 @@ class SMTMinimalLabelSetGenerator {
                 }
                 smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
             }
-            totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
+            searchResult.analysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
 
             auto now = std::chrono::high_resolution_clock::now();
             auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
@@ -1968,14 +2106,136 @@ class SMTMinimalLabelSetGenerator {
             }
         } while (!done);
 
+        return searchResult;
+    }
+#endif
+
+   public:
+    /*!
+     * Computes the minimal command set that is needed in the given model to exceed the given probability threshold for satisfying phi until psi.
+     *
+     * @param symbolicModel The symbolic model description that was used to build the model.
+     * @param model The sparse model in which to find the minimal command set.
+     * @param phiStates A bit vector characterizing all phi states in the model.
+     * @param psiStates A bit vector characterizing all psi states in the model.
+     * @param propertyThreshold The threshold that is to be achieved or exceeded.
+     * @param rewardName The name of the reward structure to use, or boost::none if probabilities are considerd.
+     * @param strictBound Indicates whether the threshold needs to be achieved (true) or exceeded (false).
+     * @param options A set of options for customization.
+     */
+    static std::vector<storm::storage::FlatSet<uint_fast64_t>> getMinimalLabelSet(
+        Environment const& env, GeneratorStats& stats, storm::storage::SymbolicModelDescription const& symbolicModel,
+        storm::models::sparse::Model<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        std::vector<double> propertyThreshold, boost::optional<std::vector<std::string>> const& rewardName, bool strictBound,
+        storm::storage::FlatSet<uint_fast64_t> const& dontCareLabels = storm::storage::FlatSet<uint_fast64_t>(), Options const& options = Options()) {
+#ifdef STORM_HAVE_Z3
+        STORM_LOG_THROW(propertyThreshold.size() > 0, storm::exceptions::InvalidArgumentException, "At least one threshold has to be specified.");
+        STORM_LOG_THROW(propertyThreshold.size() == 1 || (rewardName && rewardName.get().size() == propertyThreshold.size()),
+                        storm::exceptions::InvalidArgumentException, "Multiple thresholds is only supported for multiple reward structures");
+        STORM_LOG_THROW(!options.relevancyCache || &options.relevancyCache->model == &model, storm::exceptions::InvalidArgumentException,
+                        "The given relevancy cache belongs to a different model.");
+        // Set up all clocks used for time measurement.
+        auto totalClock = std::chrono::high_resolution_clock::now();
+        auto setupTimeClock = std::chrono::high_resolution_clock::now();
+
+        // (0) Obtain the label sets for each choice.
+        // The label set of a choice corresponds to the set of prism commands that induce the choice.
+        STORM_LOG_THROW(model.hasChoiceOrigins(), storm::exceptions::InvalidArgumentException,
+                        "Restriction to minimal command set is impossible for model without choice origins.");
+        STORM_LOG_THROW(model.getChoiceOrigins()->isPrismChoiceOrigins() || model.getChoiceOrigins()->isJaniChoiceOrigins(),
+                        storm::exceptions::InvalidArgumentException, "Restriction to label set is impossible for model without PRISM or JANI choice origins.");
+
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> uncachedLabelSets;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>>& labelSets = options.relevancyCache ? options.relevancyCache->labelSets : uncachedLabelSets;
+        if (labelSets.empty()) {
+            labelSets.resize(model.getNumberOfChoices());
+            if (model.getChoiceOrigins()->isPrismChoiceOrigins()) {
+                storm::storage::sparse::PrismChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asPrismChoiceOrigins();
+                for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
+                    labelSets[choice] = choiceOrigins.getCommandSet(choice);
+                }
+            } else {
+                storm::storage::sparse::JaniChoiceOrigins const& choiceOrigins = model.getChoiceOrigins()->asJaniChoiceOrigins();
+                for (uint_fast64_t choice = 0; choice < model.getNumberOfChoices(); ++choice) {
+                    labelSets[choice] = choiceOrigins.getEdgeIndexSet(choice);
+                }
+            }
+        }
+        assert(labelSets.size() == model.getNumberOfChoices());
+
+        // (1) Check whether its possible to exceed the threshold if checkThresholdFeasible is set.
+        std::vector<double> maximalReachabilityProbability;
+        if (options.checkThresholdFeasible) {
+            maximalReachabilityProbability = computeMaximalReachabilityProbability(env, model, phiStates, psiStates, rewardName);
+
+            for (uint64_t i = 0; i < maximalReachabilityProbability.size(); ++i) {
+                STORM_LOG_THROW((strictBound && maximalReachabilityProbability[i] >= propertyThreshold[i]) ||
+                                    (!strictBound && maximalReachabilityProbability[i] > propertyThreshold[i]),
+                                storm::exceptions::InvalidArgumentException,
+                                "Given probability threshold " << propertyThreshold[i] << " can not be " << (strictBound ? "achieved" : "exceeded")
+                                                               << " in model with maximal reachability probability of " << maximalReachabilityProbability[i]
+                                                               << ".");
+                std::cout << "\nMaximal property value in model is " << maximalReachabilityProbability[i] << ".\n\n";
+            }
+        }
+
+        // (2) Identify all states and commands that are relevant, because only these need to be considered later.
+        boost::optional<RelevancyInformation> uncachedRelevancyInformation;
+        RelevancyInformation const* relevancyInformationPtr;
+        if (options.relevancyCache) {
+            auto key = std::make_tuple(phiStates, psiStates, dontCareLabels);
+            auto findRes = options.relevancyCache->relevancyInformation.find(key);
+            if (findRes == options.relevancyCache->relevancyInformation.end()) {
+                findRes = options.relevancyCache->relevancyInformation
+                              .emplace(std::move(key), determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels))
+                              .first;
+            } else {
+                STORM_LOG_DEBUG("Reusing relevant states and labels.");
+            }
+            relevancyInformationPtr = &findRes->second;
+        } else {
+            uncachedRelevancyInformation = determineRelevantStatesAndLabels(model, labelSets, phiStates, psiStates, dontCareLabels);
+            relevancyInformationPtr = &uncachedRelevancyInformation.get();
+        }
+        RelevancyInformation const& relevancyInformation = *relevancyInformationPtr;
+        auto preprocessingTime = std::chrono::high_resolution_clock::now() - setupTimeClock;
+
+        // (3) - (7) Search for minimal label sets, possibly with several differently configured solvers in parallel.
+        std::vector<Options> portfolio = getPortfolio(options);
+        SearchResult searchResult;
+        if (portfolio.size() == 1) {
+            std::atomic<bool> stopSearch(false);
+            searchResult = searchMinimalLabelSets(env, symbolicModel, model, labelSets, phiStates, psiStates, propertyThreshold, rewardName, strictBound,
+                                                  relevancyInformation, portfolio.front(), stopSearch);
+        } else {
+            std::atomic<bool> stopSearch(false);
+            std::mutex resultMutex;
+            boost::optional<uint64_t> winner;
+            storm::utility::parallel::forEachChunk(
+                0, portfolio.size(), 1, portfolio.size(), [&](uint64_t, uint64_t configuration, uint64_t) {
+                    SearchResult configurationResult = searchMinimalLabelSets(env, symbolicModel, model, labelSets, phiStates, psiStates, propertyThreshold,
+                                                                              rewardName, strictBound, relevancyInformation, portfolio[configuration], stopSearch);
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    if (!configurationResult.aborted && !winner) {
+                        winner = configuration;
+                        searchResult = std::move(configurationResult);
+                        stopSearch = true;
+                    }
+                });
+            STORM_LOG_ASSERT(winner, "No solver configuration finished.");
+            STORM_LOG_INFO("Solver configuration " << winner.get() << " of the portfolio finished first.");
+        }
+        searchResult.setupTime += preprocessingTime;
+
         // Compute and emit the time measurements if the corresponding flag was set.
-        totalTime = std::chrono::high_resolution_clock::now() - totalClock;
+        auto totalTime = std::chrono::high_resolution_clock::now() - totalClock;
 
-        stats.analysisTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalAnalysisTime);
-        stats.setupTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSetupTime);
-        stats.modelCheckingTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalModelCheckingTime);
-        stats.solverTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSolverTime);
-        stats.iterations = iterations;
+        stats.analysisTime = std::chrono::duration_cast<std::chrono::milliseconds>(searchResult.analysisTime);
+        stats.setupTime = std::chrono::duration_cast<std::chrono::milliseconds>(searchResult.setupTime);
+        stats.modelCheckingTime = std::chrono::duration_cast<std::chrono::milliseconds>(searchResult.modelCheckingTime);
+        stats.solverTime = std::chrono::duration_cast<std::chrono::milliseconds>(searchResult.solverTime);
+        stats.cutTime = searchResult.cutTime;
+        stats.iterations = searchResult.iterations;
 
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             storm::storage::FlatSet<uint64_t> allLabels;
@@ -1988,19 +2248,19 @@ class SMTMinimalLabelSetGenerator {
             std::cout << "    * known labels: " << relevancyInformation.knownLabels.size() << '\n';
             std::cout << "    * relevant labels: " << (relevancyInformation.knownLabels.size() + relevancyInformation.relevantLabels.size()) << "\n\n";
             std::cout << "Time breakdown:\n";
-            std::cout << "    * time for setup: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSetupTime).count() << "ms\n";
-            std::cout << "    * time for solving: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalSolverTime).count() << "ms\n";
-            std::cout << "    * time for checking: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalModelCheckingTime).count() << "ms\n";
-            std::cout << "    * time for analysis: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalAnalysisTime).count() << "ms\n";
+            std::cout << "    * time for setup: " << stats.setupTime.count() << "ms\n";
+            std::cout << "    * time for solving: " << stats.solverTime.count() << "ms\n";
+            std::cout << "    * time for checking: " << stats.modelCheckingTime.count() << "ms\n";
+            std::cout << "    * time for analysis: " << stats.analysisTime.count() << "ms\n";
             std::cout << "------------------------------------------\n";
             std::cout << "    * total time: " << std::chrono::duration_cast<std::chrono::milliseconds>(totalTime).count() << "ms\n\n";
             std::cout << "Other:\n";
-            std::cout << "    * number of models checked: " << iterations << '\n';
-            std::cout << "    * number of models that could not reach a target state: " << zeroProbabilityCount << " ("
-                      << 100 * static_cast<double>(zeroProbabilityCount) / iterations << "%)\n\n";
+            std::cout << "    * number of models checked: " << searchResult.iterations << '\n';
+            std::cout << "    * number of models that could not reach a target state: " << searchResult.zeroProbabilityCount << " ("
+                      << 100 * static_cast<double>(searchResult.zeroProbabilityCount) / searchResult.iterations << "%)\n\n";
         }
 
-        return result;
+        return searchResult.labelSets;
 #else
         throw storm::exceptions::NotImplementedException() << "This functionality is unavailable since storm has been compiled without support for Z3.";
 #endif
@@ -2232,7 +2492,8 @@ class SMTMinimalLabelSetGenerator {
 
     static std::shared_ptr<HighLevelCounterexample> computeCounterexample(Environment const& env, storm::storage::SymbolicModelDescription const& symbolicModel,
                                                                           storm::models::sparse::Model<T> const& model,
-                                                                          std::shared_ptr<storm::logic::Formula const> const& formula) {
+                                                                          std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                          std::shared_ptr<RelevancyCache> const& relevancyCache = nullptr) {
 #ifdef STORM_HAVE_Z3
         std::cout << "\nGenerating minimal label counterexample for formula " << *formula << '\n';
         GeneratorStats stats;
@@ -2240,7 +2501,9 @@ class SMTMinimalLabelSetGenerator {
         if (prec.lowerBoundedFormula) {
             STORM_LOG_WARN("Generating counterexample for lower-bounded property. The resulting command set need not be minimal.");
         }
-        auto labelSets = computeCounterexampleLabelSet(env, stats, symbolicModel, model, prec);
+        Options options(true);
+        options.relevancyCache = relevancyCache;
+        auto labelSets = computeCounterexampleLabelSet(env, stats, symbolicModel, model, prec, storm::storage::FlatSet<uint_fast64_t>(), options);
 
         if (symbolicModel.isPrismProgram()) {
             storm::prism::Program program = symbolicModel.asPrismProgram().restrictCommands(labelSets[0]);
@@ -1,5 +1,7 @@
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
 
+#include <limits>
+
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/settings/Argument.h"
 #include "storm/settings/ArgumentBuilder.h"
@@ -17,10 +19,12 @@ const std::string CounterexampleGeneratorSettings::counterexampleOptionName = "c
 const std::string CounterexampleGeneratorSettings::counterexampleOptionShortName = "cex";
 const std::string CounterexampleGeneratorSettings::counterexampleTypeOptionName = "cextype";
 const std::string CounterexampleGeneratorSettings::shortestPathMaxKOptionName = "shortestpath-maxk";
+const std::string CounterexampleGeneratorSettings::shortestPathMaxMemoryOptionName = "shortestpath-maxmem";
 const std::string CounterexampleGeneratorSettings::minimalCommandMethodOptionName = "mincmdmethod";
 const std::string CounterexampleGeneratorSettings::encodeReachabilityOptionName = "encreach";
 const std::string CounterexampleGeneratorSettings::schedulerCutsOptionName = "schedcuts";
 const std::string CounterexampleGeneratorSettings::noDynamicConstraintsOptionName = "nodyn";
+const std::string CounterexampleGeneratorSettings::portfolioOptionName = "portfolio";
 
 CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, counterexampleOptionName, false,
@@ -43,6 +47,11 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                          .setDefaultValueUnsignedInteger(10)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, shortestPathMaxMemoryOptionName, false,
+                                                   "Limits the memory used to store (candidate) paths during the generation of shortest paths.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in megabytes.").build())
+                        .build());
     std::vector<std::string> method = {"maxsat", "milp"};
     this->addOption(storm::settings::OptionBuilder(moduleName, minimalCommandMethodOptionName, true,
                                                    "Sets which method is used to derive the counterexample in terms of a minimal command/edge set.")
@@ -64,6 +73,15 @@ CounterexampleGeneratorSettings::CounterexampleGeneratorSettings() : ModuleSetti
                                                    "Disables the generation of dynamic constraints in the MAXSAT-based counterexample generation.")
                         .setIsAdvanced()
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, portfolioOptionName, true,
+                                                   "Sets the number of differently configured solvers that search in parallel in the MAXSAT-based counterexample "
+                                                   "generation. The result of the first solver that finishes is taken.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of solvers (at most 4).")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 4))
+                                         .build())
+                        .build());
 }
 
 bool CounterexampleGeneratorSettings::isCounterexampleSet() const {
@@ -86,6 +104,13 @@ size_t CounterexampleGeneratorSettings::getShortestPathMaxK() const {
     return this->getOption(shortestPathMaxKOptionName).getArgumentByName("maxk").getValueAsUnsignedInteger();
 }
 
+uint64_t CounterexampleGeneratorSettings::getShortestPathMemoryLimit() const {
+    if (!this->getOption(shortestPathMaxMemoryOptionName).getHasOptionBeenSet()) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return this->getOption(shortestPathMaxMemoryOptionName).getArgumentByName("mb").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
 bool CounterexampleGeneratorSettings::isUseMilpBasedMinimalCommandSetGenerationSet() const {
     return this->getOption(minimalCommandMethodOptionName).getArgumentByName("method").getValueAsString() == "milp";
 }
@@ -106,6 +131,10 @@ bool CounterexampleGeneratorSettings::isUseDynamicConstraintsSet() const {
     return !this->getOption(noDynamicConstraintsOptionName).getHasOptionBeenSet();
 }
 
+uint64_t CounterexampleGeneratorSettings::getPortfolioSize() const {
+    return this->getOption(portfolioOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
 bool CounterexampleGeneratorSettings::check() const {
     STORM_LOG_THROW(isCounterexampleSet() || !isCounterexampleTypeSet(), storm::exceptions::InvalidSettingsException,
                     "Counterexample type was set but counterexample flag '-cex' is missing.");
@@ -52,6 +52,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     size_t getShortestPathMaxK() const;
 
+    /*!
+     * Retrieves the memory (in bytes) that the generation of shortest paths may use to store (candidate) paths.
+     *
+     * @return The memory limit or the maximal value if no limit was set.
+     */
+    uint64_t getShortestPathMemoryLimit() const;
+
     /*!
      * Retrieves whether the MILP-based technique is to be used to generate a minimal command set
      * counterexample.
@@ -91,6 +98,13 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseDynamicConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of differently configured solvers that are run in parallel in the MAXSAT-based technique.
+     *
+     * @return The size of the solver portfolio.
+     */
+    uint64_t getPortfolioSize() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -102,10 +116,12 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string counterexampleOptionShortName;
     static const std::string counterexampleTypeOptionName;
     static const std::string shortestPathMaxKOptionName;
+    static const std::string shortestPathMaxMemoryOptionName;
     static const std::string minimalCommandMethodOptionName;
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
     static const std::string noDynamicConstraintsOptionName;
+    static const std::string portfolioOptionName;
 };
 
 }  // namespace modules
@@ -1,17 +1,113 @@
 #include "storm-dft/api/storm-dft.h"
 #include "storm-cli-utilities/cli.h"
+#include "storm-dft/modelchecker/DftInstantiationChecker.h"
 #include "storm-dft/settings/DftSettings.h"
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SimulationSettings.h"
 #include "storm/settings/modules/TransformationSettings.h"
+#include "storm/simulator/StatisticalTests.h"
 #include "storm/utility/initialize.h"
 
+#include <boost/algorithm/string.hpp>
+
+/*!
+ * Parse the valuations given as 'x=0.1:0.2,y=1;x=0.5,y=2', where the values of different parameters separated by ':' are combined.
+ */
+std::vector<storm::dft::modelchecker::DftInstantiationChecker::Valuation> parseValuations(std::set<storm::RationalFunctionVariable> const& parameters,
+                                                                                          std::string const& valuationString) {
+    std::vector<storm::dft::modelchecker::DftInstantiationChecker::Valuation> result;
+    std::vector<std::string> cartesianProducts;
+    boost::split(cartesianProducts, valuationString, boost::is_any_of(";"));
+    for (auto& product : cartesianProducts) {
+        boost::trim(product);
+        if (product.empty()) {
+            continue;
+        }
+        std::vector<std::string> valuesForVariables;
+        boost::split(valuesForVariables, product, boost::is_any_of(","));
+
+        std::vector<storm::dft::modelchecker::DftInstantiationChecker::Valuation> productValuations(1);
+        for (auto& varValues : valuesForVariables) {
+            auto equalsPosition = varValues.find("=");
+            STORM_LOG_THROW(equalsPosition != varValues.npos, storm::exceptions::WrongFormatException, "Incorrect format of valuation '" << varValues << "'.");
+            std::string variableName = varValues.substr(0, equalsPosition);
+            boost::trim(variableName);
+            auto parameter = std::find_if(parameters.begin(), parameters.end(), [&variableName](storm::RationalFunctionVariable const& variable) {
+                std::stringstream variableStream;
+                variableStream << variable;
+                return variableStream.str() == variableName;
+            });
+            STORM_LOG_THROW(parameter != parameters.end(), storm::exceptions::WrongFormatException, "Unknown parameter '" << variableName << "'.");
+
+            std::vector<std::string> values;
+            std::string valuesString = varValues.substr(equalsPosition + 1);
+            boost::split(values, valuesString, boost::is_any_of(":"));
+            std::vector<storm::dft::modelchecker::DftInstantiationChecker::Valuation> extendedValuations;
+            for (auto const& valuation : productValuations) {
+                for (auto& value : values) {
+                    boost::trim(value);
+                    extendedValuations.push_back(valuation);
+                    extendedValuations.back()[*parameter] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value);
+                }
+            }
+            productValuations = std::move(extendedValuations);
+        }
+        result.insert(result.end(), productValuations.begin(), productValuations.end());
+    }
+    return result;
+}
+
+/*!
+ * Analyse the DFT for the valuations of its parameters given in the settings.
+ */
+template<typename ValueType>
+void analyzeInstantiations(storm::dft::storage::DFT<ValueType> const&, std::vector<std::shared_ptr<storm::logic::Formula const>> const&,
+                           storm::dft::utility::RelevantEvents const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Instantiations require a parametric DFT.");
+}
+
+template<>
+void analyzeInstantiations(storm::dft::storage::DFT<storm::RationalFunction> const& dft,
+                           std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
+                           storm::dft::utility::RelevantEvents const& relevantEvents) {
+    auto const& faultTreeSettings = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>();
+    storm::utility::Stopwatch buildingTimer(true);
+    storm::dft::modelchecker::DftInstantiationChecker checker(dft, faultTreeSettings.useSymmetryReduction(), relevantEvents,
+                                                              faultTreeSettings.isAllowDCForRelevantEvents());
+    buildingTimer.stop();
+    auto valuations = parseValuations(checker.getParameters(), faultTreeSettings.getInstantiations());
+
+    storm::utility::Stopwatch checkingTimer(true);
+    auto results = checker.check(properties, valuations);
+    checkingTimer.stop();
+
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        std::stringstream valuationStream;
+        bool first = true;
+        for (auto const& variableValue : valuations[i]) {
+            valuationStream << (first ? "" : ",") << variableValue.first << "=" << storm::utility::convertNumber<double>(variableValue.second);
+            first = false;
+        }
+        STORM_PRINT("Result for " << valuationStream.str() << ": [");
+        for (uint64_t j = 0; j < results[i].size(); ++j) {
+            STORM_PRINT((j > 0 ? ", " : "") << results[i][j]);
+        }
+        STORM_PRINT("]\n");
+    }
+    STORM_PRINT("Times:\n");
+    STORM_PRINT("Building:\t" << buildingTimer << "s\n");
+    STORM_PRINT("Checking " << valuations.size() << " valuations:\t" << checkingTimer << "s\n");
+}
+
 /*!
  * Process commandline options and start computations.
  */
@@ -159,6 +255,41 @@ void processOptions() {
         }
     }
 
+    // Monte-Carlo simulation
+    if (dftIOSettings.isSimulate()) {
+        STORM_LOG_THROW(dftIOSettings.usePropTimebound() || dftIOSettings.usePropTimepoints(), storm::exceptions::InvalidSettingsException,
+                        "Simulation requires a timebound.");
+        auto const& simulationSettings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+        double errorProbability = 1.0 - simulationSettings.getConfidence();
+        double precision = simulationSettings.getEstimationMethod() == storm::settings::modules::SimulationSettings::EstimationMethod::ClopperPearson
+                               ? simulationSettings.getPrecision()
+                               : 0.0;
+        uint64_t maximalNumberOfTraces = storm::simulator::getChernoffHoeffdingNumberOfSamples(simulationSettings.getPrecision(), errorProbability);
+        if (simulationSettings.isMaximalNumberOfTracesSet()) {
+            maximalNumberOfTraces = std::min(maximalNumberOfTraces, simulationSettings.getMaximalNumberOfTraces());
+        }
+        uint64_t seed = simulationSettings.isSeedSet() ? simulationSettings.getSeed() : std::random_device()();
+        uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+
+        std::vector<double> timepoints;
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+        for (double timebound : timepoints) {
+            auto result = storm::dft::api::simulateDFT<ValueType>(dft, timebound, maximalNumberOfTraces, precision, simulationSettings.getConfidence(),
+                                                                  numberOfThreads, seed, simulationSettings.getBatchSize());
+            STORM_PRINT("Unreliability up to " << timebound << ": " << result.unreliability << " (" << result.numberOfFailedTraces << " of "
+                                               << result.numberOfTraces << " traces failed, confidence interval [" << result.confidenceInterval.first
+                                               << ", " << result.confidenceInterval.second << "])\n");
+            STORM_LOG_WARN_COND(result.converged || result.numberOfTraces >= maximalNumberOfTraces,
+                                "The simulation was stopped before reaching the requested confidence.");
+        }
+        return;
+    }
+
     // From now on we analyse the DFT via model checking
 
     // Set min or max
@@ -221,6 +352,8 @@ void processOptions() {
     // TODO allow building of state space even without properties
     if (props.empty()) {
         STORM_LOG_WARN("No property given. No analysis will be performed.");
+    } else if (faultTreeSettings.isInstantiationsSet()) {
+        analyzeInstantiations<ValueType>(*dft, props, relevantEvents);
     } else {
         double approximationError = 0.0;
         if (faultTreeSettings.isApproximationErrorSet()) {
@@ -229,7 +362,7 @@ void processOptions() {
         storm::dft::api::analyzeDFT<ValueType>(*dft, props, faultTreeSettings.useSymmetryReduction(), faultTreeSettings.useModularisation(), relevantEvents,
                                                faultTreeSettings.isAllowDCForRelevantEvents(), approximationError,
                                                faultTreeSettings.getApproximationHeuristic(), transformationSettings.isChainEliminationSet(),
-                                               transformationSettings.getLabelBehavior(), true);
+                                               transformationSettings.getLabelBehavior(), true, faultTreeSettings.useHybridAnalysis());
     }
 }
 
@@ -253,6 +386,7 @@ int main(const int argc, const char** argv) {
 
         // Start by setting some urgent options (log levels, resources, etc.)
         storm::cli::setUrgentOptions();
+        storm::cli::setUpProfiling();
 
         storm::settings::modules::GeneralSettings const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
         if (generalSettings.isParametricSet()) {
@@ -268,6 +402,7 @@ int main(const int argc, const char** argv) {
         if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
             storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
         }
+        storm::cli::exportProfile();
 
         // All operations have now been performed, so we clean up everything and terminate.
         storm::utility::cleanUp();
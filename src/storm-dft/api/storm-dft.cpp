@@ -11,6 +11,7 @@
 #include "storm-dft/modelchecker/DftModularizationChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/SymmetricUnits.h"
 #include "storm-dft/storage/DftJsonExporter.h"
 #include "storm-dft/storage/SylvanBddManager.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
@@ -191,6 +192,25 @@ void exportDFTToSMT(storm::dft::storage::DFT<storm::RationalFunction> const& dft
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export to SMT does not support this data type.");
 }
 
+template<>
+typename storm::dft::simulator::DFTParallelSimulator<double>::Result simulateDFT(std::shared_ptr<storm::dft::storage::DFT<double>> const& dft,
+                                                                                 double timebound, uint64_t maximalNumberOfTraces, double precision,
+                                                                                 double confidence, uint64_t numberOfThreads, uint64_t seed,
+                                                                                 uint64_t batchSize) {
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents(), false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+    storm::dft::simulator::DFTParallelSimulator<double> simulator(*dft, stateGenerationInfo, numberOfThreads, seed, batchSize);
+    return simulator.estimateUnreliability(timebound, maximalNumberOfTraces, precision, confidence);
+}
+
+template<>
+typename storm::dft::simulator::DFTParallelSimulator<storm::RationalFunction>::Result simulateDFT(
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> const&, double, uint64_t, double, double, uint64_t, uint64_t, uint64_t) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation is not supported for parametric DFTs.");
+}
+
 template<>
 void analyzeDFTSMT(storm::dft::storage::DFT<double> const& dft, bool printOutput) {
     uint64_t solverTimeout = 10;
@@ -8,6 +8,7 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/parser/DFTGalileoParser.h"
 #include "storm-dft/parser/DFTJsonParser.h"
+#include "storm-dft/simulator/DFTParallelSimulator.h"
 #include "storm-dft/transformations/DftToGspnTransformator.h"
 #include "storm-dft/transformations/DftTransformer.h"
 #include "storm-dft/utility/DftValidator.h"
@@ -173,6 +174,7 @@ storm::dft::utility::RelevantEvents computeRelevantEvents(storm::dft::storage::D
  * @param eliminateChains If true, chains of non-Markovian states are eliminated from the resulting MA.
  * @param labelBehavior Behavior of labels of eliminated states
  * @param printOutput If true, model information, timings, results, etc. are printed.
+ * @param hybridAnalysis If true and modularisation is allowed, dynamic modules are analysed via CTMCs and the remaining static fault tree via BDDs.
  * @return Results.
  */
 template<typename ValueType>
@@ -181,8 +183,9 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
     bool allowModularisation = true, storm::dft::utility::RelevantEvents const& relevantEvents = {}, bool allowDCForRelevant = false,
     double approximationError = 0.0, storm::dft::builder::ApproximationHeuristic approximationHeuristic = storm::dft::builder::ApproximationHeuristic::DEPTH,
     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels,
-    bool printOutput = false) {
+    bool printOutput = false, bool hybridAnalysis = false) {
     storm::dft::modelchecker::DFTModelChecker<ValueType> modelChecker(printOutput);
+    modelChecker.setHybridAnalysis(hybridAnalysis);
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results results =
         modelChecker.check(dft, properties, symred, allowModularisation, relevantEvents, allowDCForRelevant, approximationError, approximationHeuristic,
                            eliminateChains, labelBehavior);
@@ -249,6 +252,26 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& d
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
                    std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
 
+/*!
+ * Estimate the unreliability of the DFT by Monte-Carlo simulation of failure traces on several threads.
+ * The simulation does not build a state space and is thus also applicable to DFTs that are too large for other analyses.
+ *
+ * @param dft DFT. Its relevant events are set to the top-level event.
+ * @param timebound Time bound for the unreliability.
+ * @param maximalNumberOfTraces Maximal number of traces to simulate.
+ * @param precision Half-width of the confidence interval for which the simulation stops early. If 0, all traces are simulated.
+ * @param confidence Probability with which the unreliability lies in the confidence interval.
+ * @param numberOfThreads Number of threads simulating traces.
+ * @param seed Seed for the random number generators.
+ * @param batchSize Number of traces each thread simulates before the stopping criterion is checked.
+ * @return Result of the simulation.
+ */
+template<typename ValueType>
+typename storm::dft::simulator::DFTParallelSimulator<ValueType>::Result simulateDFT(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& dft,
+                                                                                    double timebound, uint64_t maximalNumberOfTraces, double precision,
+                                                                                    double confidence, uint64_t numberOfThreads, uint64_t seed,
+                                                                                    uint64_t batchSize);
+
 /*!
  * Analyze the DFT using the SMT encoding
  *
@@ -1,6 +1,7 @@
 #include "ExplicitDFTModelBuilder.h"
 
 #include <map>
+#include <type_traits>
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -13,6 +14,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -20,6 +22,9 @@
 namespace storm::dft {
 namespace builder {
 
+// The number of states whose successors are computed together when exploring on several threads.
+static const uint64_t prefetchBatchSize = 256;
+
 template<typename ValueType, typename StateType>
 ExplicitDFTModelBuilder<ValueType, StateType>::ModelComponents::ModelComponents()
     : transitionMatrix(), stateLabeling(), markovianStates(), exitRates(), choiceLabeling() {
@@ -369,6 +374,9 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
     size_t nrSkippedStates = 0;
     storm::utility::ProgressMeasurement progress("explored states");
     progress.startNewMeasurement(0);
+    // Successors are only computed in advance if all states are expanded anyway.
+    // Arithmetic on rational functions is not thread-safe.
+    bool prefetch = approximationThreshold <= 0.0 && std::is_same<ValueType, double>::value && storm::utility::parallel::getDefaultNumberOfThreads() > 1;
     // TODO: do not empty queue every time but break before
     while (!explorationQueue.empty()) {
         // Get the first state in the queue
@@ -391,6 +399,10 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
         }
         STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
 
+        if (prefetch && prefetchedSuccessors.count(currentId) == 0) {
+            prefetchSuccessors(currentState);
+        }
+
         // Remember that the current row group was actually filled with the transitions of a different state
         matrixBuilder.setRemapping(currentId);
 
@@ -415,8 +427,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
         } else {
             // Explore the current state
             ++nrExpandedStates;
-            storm::generator::StateBehavior<ValueType, StateType> behavior =
-                generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            auto prefetchedIt = prefetchedSuccessors.find(currentId);
+            if (prefetchedIt != prefetchedSuccessors.end()) {
+                behavior = generator.expand(prefetchedIt->second, std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+                prefetchedSuccessors.erase(prefetchedIt);
+            } else {
+                behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
+            }
             STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
             setMarkovian(behavior.begin()->isMarkovian());
 
@@ -515,12 +533,42 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
             progress.updateProgress(nrExpandedStates);
         }
     }  // end exploration
+    prefetchedSuccessors.clear();
 
     STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
     STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
     STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::prefetchSuccessors(DFTStatePointer const& state) {
+    // Besides the given state, take the not yet explored states with the smallest ids as they were discovered first
+    std::vector<DFTStatePointer> states = {state};
+    for (auto it = statesNotExplored.begin(); it != statesNotExplored.end() && states.size() < prefetchBatchSize; ++it) {
+        if (prefetchedSuccessors.count(it->first) == 0) {
+            states.push_back(it->second.first);
+        }
+    }
+
+    // Compute the successors concurrently. The state storage is not accessed during this phase.
+    std::vector<std::vector<SuccessorChoice>> successors(states.size());
+    storm::utility::parallel::forEachChunk(0, states.size(), 8, storm::utility::parallel::getDefaultNumberOfThreads(),
+                                           [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                               for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                                                   if (states[i]->isPseudoState()) {
+                                                       // Create concrete state from pseudo state
+                                                       states[i]->construct();
+                                                   }
+                                                   successors[i] = generator.computeSuccessors(states[i]);
+                                               }
+                                           });
+
+    // Ids are assigned later (in the order of exploration) such that the resulting model does not depend on the number of threads
+    for (uint64_t i = 0; i < states.size(); ++i) {
+        prefetchedSuccessors.emplace(states[i]->getId(), std::move(successors[i]));
+    }
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
     bool isAddLabelsClaiming = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
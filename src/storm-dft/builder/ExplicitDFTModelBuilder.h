@@ -3,6 +3,7 @@
 #include <boost/optional/optional.hpp>
 #include <limits>
 #include <stack>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "storm/models/sparse/ChoiceLabeling.h"
@@ -29,6 +30,7 @@ class ExplicitDFTModelBuilder {
     using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
     using ExplorationHeuristic = DFTExplorationHeuristic<ValueType>;
     using ExplorationHeuristicPointer = std::shared_ptr<ExplorationHeuristic>;
+    using SuccessorChoice = typename storm::dft::generator::DftNextStateGenerator<ValueType, StateType>::SuccessorChoice;
 
     // A structure holding the individual components of a model.
     struct ModelComponents {
@@ -190,6 +192,14 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Compute the successors of the given state and of further not yet explored states concurrently.
+     * The results are stored in prefetchedSuccessors. Pseudo states are constructed in the process.
+     *
+     * @param state The state which is explored next.
+     */
+    void prefetchSuccessors(DFTStatePointer const& state);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -317,6 +327,9 @@ class ExplicitDFTModelBuilder {
     // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
     std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
 
+    // Successors of not yet explored states which were computed in advance (on several threads).
+    std::unordered_map<StateType, std::vector<SuccessorChoice>> prefetchedSuccessors;
+
     // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
     // to the corresponding skipped states.
     // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
@@ -97,18 +97,52 @@ void DftNextStateGenerator<ValueType, StateType>::load(DFTStatePointer const& st
 
 template<typename ValueType, typename StateType>
 storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+    return expand(computeSuccessors(state), stateToIdCallback);
+}
+
+template<typename ValueType, typename StateType>
+storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::expand(std::vector<SuccessorChoice> const& successors,
+                                                                                                          StateToIdCallback const& stateToIdCallback) {
     STORM_LOG_DEBUG("Explore state: " << mDft.getStateString(state));
-    // Initialization
+    storm::generator::StateBehavior<ValueType, StateType> result;
+    for (auto const& successorChoice : successors) {
+        storm::generator::Choice<ValueType, StateType> choice(0, successorChoice.markovian);
+        for (auto const& successor : successorChoice.successors) {
+            StateType newStateId;
+            if (!successor.first) {
+                // Use unique failed state
+                newStateId = 0;
+            } else if (successor.first == state) {
+                // Self loop
+                newStateId = state->getId();
+            } else {
+                // Add new state
+                newStateId = stateToIdCallback(successor.first);
+                STORM_LOG_ASSERT(newStateId != state->getId(), "Self loop was added for " << newStateId << ".");
+            }
+            choice.addProbability(newStateId, successor.second);
+            STORM_LOG_TRACE("Added transition to " << newStateId << " with " << (successorChoice.markovian ? "failure rate " : "probability ") << successor.second);
+        }
+        result.addChoice(std::move(choice));
+    }
+    STORM_LOG_TRACE("Finished exploring state: " << mDft.getStateString(state));
+    result.setExpanded();
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<typename DftNextStateGenerator<ValueType, StateType>::SuccessorChoice> DftNextStateGenerator<ValueType, StateType>::computeSuccessors(
+    DFTStatePointer const& state) const {
+    STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
     bool hasDependencies = state->getFailableElements().hasDependencies();
-    return exploreState(stateToIdCallback, hasDependencies, mTakeFirstDependency);
+    return exploreState(state, hasDependencies, mTakeFirstDependency);
 }
 
 template<typename ValueType, typename StateType>
-storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<ValueType, StateType>::exploreState(StateToIdCallback const& stateToIdCallback,
-                                                                                                                bool exploreDependencies,
-                                                                                                                bool takeFirstDependency) {
+std::vector<typename DftNextStateGenerator<ValueType, StateType>::SuccessorChoice> DftNextStateGenerator<ValueType, StateType>::exploreState(
+    DFTStatePointer const& state, bool exploreDependencies, bool takeFirstDependency) const {
     // Prepare the result, in case we return early.
-    storm::generator::StateBehavior<ValueType, StateType> result;
+    std::vector<SuccessorChoice> result;
 
     STORM_LOG_TRACE("Currently failable: " << state->getFailableElements().getCurrentlyFailableString());
     // size_t failableCount = hasDependencies ? state->nrFailableDependencies() : state->nrFailableBEs();
@@ -120,17 +154,14 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
     // - either no relevant event remains (i.e., all relevant events have failed already), or
     // - no BE can fail
     if (!state->hasOperationalRelevantEvent() || iterFailable == state->getFailableElements().end(!exploreDependencies)) {
-        storm::generator::Choice<ValueType, StateType> choice(0, true);
         // Add self loop
-        choice.addProbability(state->getId(), storm::utility::one<ValueType>());
+        result.push_back({true, {std::make_pair(state, storm::utility::one<ValueType>())}});
         STORM_LOG_TRACE("Added self loop for " << state->getId());
         // No further exploration required
-        result.addChoice(std::move(choice));
-        result.setExpanded();
         return result;
     }
 
-    storm::generator::Choice<ValueType, StateType> choice(0, !exploreDependencies);
+    SuccessorChoice choice{!exploreDependencies, {}};
 
     // Let BE fail
     for (; iterFailable != state->getFailableElements().end(!exploreDependencies); ++iterFailable) {
@@ -153,43 +184,30 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
             continue;
         }
 
-        StateType newStateId;
         if (newState->hasFailed(mDft.getTopLevelIndex()) && uniqueFailedState) {
             // Use unique failed state
-            newStateId = 0;
-        } else {
-            // Add new state
-            newStateId = stateToIdCallback(newState);
+            newState = nullptr;
         }
 
         // Set transitions
         if (exploreDependencies) {
             // Failure is due to dependency -> add non-deterministic choice if necessary
             ValueType probability = dependency->probability();
-            choice.addProbability(newStateId, probability);
-            STORM_LOG_TRACE("Added transition to " << newStateId << " with probability " << probability);
+            SuccessorChoice dependencyChoice{false, {std::make_pair(newState, probability)}};
 
             if (!storm::utility::isOne(probability)) {
                 // Add transition to state where dependency was unsuccessful
                 DFTStatePointer unsuccessfulState = createSuccessorState(state, nextBE, dependency, false);
-                // Add state
-                StateType unsuccessfulStateId = stateToIdCallback(unsuccessfulState);
-                ValueType remainingProbability = storm::utility::one<ValueType>() - probability;
-                choice.addProbability(unsuccessfulStateId, remainingProbability);
-                STORM_LOG_TRACE("Added transition to " << unsuccessfulStateId << " with remaining probability " << remainingProbability);
-                STORM_LOG_ASSERT(unsuccessfulStateId != state->getId(),
-                                 "Self loop was added (through PDEP) for " << unsuccessfulStateId << " and failure of " << nextBE->name());
+                dependencyChoice.successors.emplace_back(unsuccessfulState, storm::utility::one<ValueType>() - probability);
             }
-            result.addChoice(std::move(choice));
+            result.push_back(std::move(dependencyChoice));
         } else {
             // Failure is due to "normal" BE failure
             // Set failure rate according to activation
             ValueType rate = state->getBERate(nextBE->id());
             STORM_LOG_ASSERT(!storm::utility::isZero(rate), "Rate is 0.");
-            choice.addProbability(newStateId, rate);
-            STORM_LOG_TRACE("Added transition to " << newStateId << " with failure rate " << rate);
+            choice.successors.emplace_back(newState, rate);
         }
-        STORM_LOG_ASSERT(newStateId != state->getId(), "Self loop was added for " << newStateId << " and failure of " << nextBE->name());
 
         // Handle premature stop for dependencies
         if (iterFailable.isFailureDueToDependency() && !iterFailable.isConflictingDependency()) {
@@ -206,23 +224,19 @@ storm::generator::StateBehavior<ValueType, StateType> DftNextStateGenerator<Valu
         if (result.empty()) {
             // Dependencies might have been prevented from sequence enforcer
             // -> explore BEs now
-            return exploreState(stateToIdCallback, false, takeFirstDependency);
+            return exploreState(state, false, takeFirstDependency);
         }
     } else {
-        if (choice.size() == 0) {
+        if (choice.successors.empty()) {
             // No transition was generated
             STORM_LOG_TRACE("No transitions were generated.");
             // Add self loop
-            choice.addProbability(state->getId(), storm::utility::one<ValueType>());
+            choice.successors.emplace_back(state, storm::utility::one<ValueType>());
             STORM_LOG_TRACE("Added self loop for " << state->getId());
         }
-        STORM_LOG_ASSERT(choice.size() > 0, "At least one choice should have been generated.");
         // Add all rates as one choice
-        result.addChoice(std::move(choice));
+        result.push_back(std::move(choice));
     }
-
-    STORM_LOG_TRACE("Finished exploring state: " << mDft.getStateString(state));
-    result.setExpanded();
     return result;
 }
 
@@ -23,6 +23,15 @@ class DftNextStateGenerator {
    public:
     typedef std::function<StateType(DFTStatePointer const&)> StateToIdCallback;
 
+    /*!
+     * Choice whose successors are given as states instead of ids.
+     * The successor nullptr refers to the unique failed state.
+     */
+    struct SuccessorChoice {
+        bool markovian;
+        std::vector<std::pair<DFTStatePointer, ValueType>> successors;
+    };
+
     DftNextStateGenerator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo);
 
     bool isDeterministicModel() const;
@@ -38,6 +47,23 @@ class DftNextStateGenerator {
      */
     storm::generator::StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback);
 
+    /*!
+     * Expand current state with successors which were computed before.
+     * @param successors Successors of the current state as obtained from computeSuccessors().
+     * @param stateToIdCallback  Callback function which adds new state and returns the corresponding id. It is called for the successors in order.
+     * @return StateBehavior containing successor choices and distributions.
+     */
+    storm::generator::StateBehavior<ValueType, StateType> expand(std::vector<SuccessorChoice> const& successors, StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Compute the successors of the given state without assigning ids to them.
+     * Neither the current state nor any state storage is accessed. Thus, this can be called concurrently for different states.
+     *
+     * @param state State to explore. Must not be a pseudo state.
+     * @return Choices with the successor states. A successor which is the given state itself denotes a self loop.
+     */
+    std::vector<SuccessorChoice> computeSuccessors(DFTStatePointer const& state) const;
+
     /*!
      * Create unique failed state.
      *
@@ -89,15 +115,14 @@ class DftNextStateGenerator {
 
    private:
     /*!
-     * Explore current state and generate all successor states.
-     * @param stateToIdCallback Callback function which adds new state and returns the corresponding id.
+     * Explore given state and generate all successor states.
+     * @param state State to explore.
      * @param exploreDependencies Flag indicating whether failures due to dependencies or due to BEs should be explored.
      * @param takeFirstDependency If true, instead of exploring all possible orders of dependency failures, a fixed order is explored where always the first
      * dependency is considered.
-     * @return StateBehavior containing successor choices and distributions.
+     * @return Choices with the successor states.
      */
-    storm::generator::StateBehavior<ValueType, StateType> exploreState(StateToIdCallback const& stateToIdCallback, bool exploreDependencies,
-                                                                       bool takeFirstDependency);
+    std::vector<SuccessorChoice> exploreState(DFTStatePointer const& state, bool exploreDependencies, bool takeFirstDependency) const;
 
     // The dft used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& mDft;
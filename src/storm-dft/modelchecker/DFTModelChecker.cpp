@@ -12,6 +12,7 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/modelchecker/DftModularizationChecker.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-dft/storage/DFTIsomorphism.h"
@@ -41,7 +42,9 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
 
     // Checking DFT
     // TODO: distinguish for all properties, not only for first one
-    if (properties[0]->isTimeOperatorFormula() && allowModularisation) {
+    if (hybridAnalysis && allowModularisation && approximationError == 0.0 && checkHybrid(dft, properties, results)) {
+        // Dynamic modules were analysed via CTMCs and the remaining static fault tree via BDDs
+    } else if (properties[0]->isTimeOperatorFormula() && allowModularisation) {
         // Use parallel composition as modularisation approach for expected time
         std::shared_ptr<storm::models::sparse::Model<ValueType>> model =
             buildModelViaComposition(dft, properties, symred, true, relevantEvents, allowDCForRelevant);
@@ -156,6 +159,54 @@ typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::che
     }
 }
 
+namespace {
+/*!
+ * Check whether the property is a time-bounded failure probability of the top level event, i.e., P=? [F<=t "failed"].
+ * Other events might be contained in dynamic modules, which are replaced in the hybrid analysis.
+ */
+bool isTopLevelFailureProbability(std::shared_ptr<storm::logic::Formula const> const& property) {
+    if (!property->isProbabilityOperatorFormula() || property->asProbabilityOperatorFormula().hasBound()) {
+        return false;
+    }
+    storm::logic::Formula const& subformula = property->asProbabilityOperatorFormula().getSubformula();
+    if (!subformula.isBoundedUntilFormula()) {
+        return false;
+    }
+    storm::logic::BoundedUntilFormula const& untilFormula = subformula.asBoundedUntilFormula();
+    return !untilFormula.isMultiDimensional() && untilFormula.getTimeBoundReference().isTimeBound() && untilFormula.hasUpperBound() &&
+           !untilFormula.hasLowerBound() && untilFormula.getLeftSubformula().isTrueFormula() && untilFormula.getRightSubformula().isAtomicLabelFormula() &&
+           untilFormula.getRightSubformula().asAtomicLabelFormula().getLabel() == "failed";
+}
+}  // namespace
+
+template<>
+bool DFTModelChecker<double>::checkHybrid(storm::dft::storage::DFT<double> const& dft, property_vector const& properties, dft_results& results) {
+    for (auto const& property : properties) {
+        if (!isTopLevelFailureProbability(property)) {
+            STORM_LOG_INFO("Hybrid analysis is not applicable for property " << *property << ".");
+            return false;
+        }
+    }
+    storm::dft::modelchecker::DftModularizationChecker<double> checker(std::make_shared<storm::dft::storage::DFT<double>>(dft));
+    if (!checker.hasStaticTopModule()) {
+        STORM_LOG_INFO("Hybrid analysis is not applicable as the top module is dynamic.");
+        return false;
+    }
+    STORM_LOG_INFO("Analysing " << checker.getNumberOfDynamicModules() << " dynamic module(s) via CTMCs and the remaining fault tree via BDDs.");
+    modelCheckingTimer.start();
+    for (auto const& result : checker.check(properties)) {
+        results.push_back(result);
+    }
+    modelCheckingTimer.stop();
+    return true;
+}
+
+template<>
+bool DFTModelChecker<storm::RationalFunction>::checkHybrid(storm::dft::storage::DFT<storm::RationalFunction> const&, property_vector const&, dft_results&) {
+    STORM_LOG_INFO("Hybrid analysis is not supported for parametric DFTs.");
+    return false;
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> DFTModelChecker<ValueType>::buildModelViaComposition(
     storm::dft::storage::DFT<ValueType> const& dft, property_vector const& properties, bool symred, bool allowModularisation,
@@ -35,7 +35,18 @@ class DFTModelChecker {
     /*!
      * Constructor.
      */
-    DFTModelChecker(bool printOutput) : printInfo(printOutput) {}
+    DFTModelChecker(bool printOutput) : printInfo(printOutput), hybridAnalysis(false) {}
+
+    /*!
+     * Set whether DFTs with a static top module are analysed in a hybrid way if modularisation is allowed.
+     * The dynamic modules are then analysed via CTMCs and the remaining static fault tree via BDDs.
+     * This is only possible for time-bounded failure probabilities of the top level event.
+     *
+     * @param hybrid Flag whether the hybrid analysis should be used.
+     */
+    void setHybridAnalysis(bool hybrid) {
+        hybridAnalysis = hybrid;
+    }
 
     /*!
      * Main method for checking DFTs.
@@ -76,6 +87,7 @@ class DFTModelChecker {
 
    private:
     bool printInfo;
+    bool hybridAnalysis;
 
     // Timing values
     storm::utility::Stopwatch buildingTimer;
@@ -105,6 +117,16 @@ class DFTModelChecker {
                             bool eliminateChains = false,
                             storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+    /*!
+     * Internal helper for the hybrid analysis of a DFT via DftModularizationChecker.
+     *
+     * @param dft DFT.
+     * @param properties Properties to check for.
+     * @param results Model checking results (only set if the hybrid analysis was applicable).
+     * @return True iff the hybrid analysis was applicable.
+     */
+    bool checkHybrid(storm::dft::storage::DFT<ValueType> const& dft, property_vector const& properties, dft_results& results);
+
     /*!
      * Internal helper for building a CTMC from a DFT via parallel composition.
      *
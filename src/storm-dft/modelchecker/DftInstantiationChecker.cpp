@@ -0,0 +1,97 @@
+#include "storm-dft/modelchecker/DftInstantiationChecker.h"
+
+#include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
+#include "storm/api/verification.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+DftInstantiationChecker::DftInstantiationChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, bool symred,
+                                                 storm::dft::utility::RelevantEvents const& relevantEvents, bool allowDCForRelevant) {
+    dft.setRelevantEvents(relevantEvents, allowDCForRelevant);
+
+    // Find symmetries
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    if (symred) {
+        auto colouring = dft.colourDFT();
+        symmetries = dft.findSymmetries(colouring);
+        STORM_LOG_DEBUG("Found " << symmetries.groups.size() << " symmetries.");
+    }
+
+    storm::dft::builder::ExplicitDFTModelBuilder<storm::RationalFunction> builder(dft, symmetries);
+    builder.buildModel(0, 0.0);
+    parametricModel = builder.getModel();
+    STORM_LOG_INFO("Built parametric model with " << parametricModel->getNumberOfStates() << " states and " << parametricModel->getNumberOfTransitions()
+                                                  << " transitions.");
+
+    if (parametricModel->isOfType(storm::models::ModelType::Ctmc)) {
+        ctmcInstantiator = std::make_unique<
+            storm::utility::ModelInstantiator<storm::models::sparse::Ctmc<storm::RationalFunction>, storm::models::sparse::Ctmc<double>>>(
+            *parametricModel->as<storm::models::sparse::Ctmc<storm::RationalFunction>>());
+    } else {
+        STORM_LOG_THROW(parametricModel->isOfType(storm::models::ModelType::MarkovAutomaton), storm::exceptions::NotSupportedException,
+                        "Instantiating models of type " << parametricModel->getType() << " is not supported.");
+        maInstantiator = std::make_unique<storm::utility::ModelInstantiator<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>,
+                                                                            storm::models::sparse::MarkovAutomaton<double>>>(
+            *parametricModel->as<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>>());
+    }
+}
+
+std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& DftInstantiationChecker::getParametricModel() const {
+    return parametricModel;
+}
+
+std::set<storm::RationalFunctionVariable> DftInstantiationChecker::getParameters() const {
+    return storm::models::sparse::getAllParameters(*parametricModel);
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> DftInstantiationChecker::instantiate(Valuation const& valuation) {
+    std::lock_guard<std::mutex> lock(instantiationMutex);
+    if (ctmcInstantiator) {
+        return std::make_shared<storm::models::sparse::Ctmc<double>>(ctmcInstantiator->instantiate(valuation));
+    } else {
+        return std::make_shared<storm::models::sparse::MarkovAutomaton<double>>(maInstantiator->instantiate(valuation));
+    }
+}
+
+std::vector<std::vector<double>> DftInstantiationChecker::check(property_vector const& properties, std::vector<Valuation> const& valuations) {
+    std::set<storm::RationalFunctionVariable> parameters = getParameters();
+    for (auto const& valuation : valuations) {
+        for (auto const& parameter : parameters) {
+            STORM_LOG_THROW(valuation.count(parameter) > 0, storm::exceptions::InvalidArgumentException,
+                            "No value given for parameter '" << parameter << "'.");
+        }
+    }
+
+    std::vector<std::vector<double>> results(valuations.size());
+    storm::utility::parallel::forEachChunk(
+        0, valuations.size(), 1, storm::utility::parallel::getDefaultNumberOfThreads(), [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                std::shared_ptr<storm::models::sparse::Model<double>> model = instantiate(valuations[i]);
+                for (auto const& property : properties) {
+                    std::unique_ptr<storm::modelchecker::CheckResult> result(
+                        storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property, true)));
+                    if (result) {
+                        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                        results[i].push_back(result->asExplicitQuantitativeCheckResult<double>().getValueMap().begin()->second);
+                    } else {
+                        STORM_LOG_WARN("The property '" << *property << "' could not be checked with the current settings.");
+                        results[i].push_back(-storm::utility::one<double>());
+                    }
+                }
+            }
+        });
+    return results;
+}
+
+}  // namespace modelchecker
+}  // namespace storm::dft
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "storm-dft/storage/DFT.h"
+#include "storm-dft/utility/RelevantEvents.h"
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+
+namespace storm::dft {
+namespace modelchecker {
+
+/*!
+ * Analysis of a parametric DFT (with parametric failure rates) for many valuations of its parameters, e.g. for sensitivity studies.
+ * Instead of building the state space for each instantiated DFT, the state space is built once as a parametric CTMC or MA. For each valuation,
+ * only the values of this model are instantiated and the instantiated model is checked.
+ * The valuations are checked concurrently if several threads are available.
+ *
+ * @note The structure of the model is the one of the parametric DFT, so rates which are zero for some valuation still yield (zero-rate)
+ * transitions. Symmetries are only exploited between elements whose rates are given by the same functions.
+ */
+class DftInstantiationChecker {
+   public:
+    typedef std::vector<std::shared_ptr<storm::logic::Formula const>> property_vector;
+    typedef storm::utility::parametric::Valuation<storm::RationalFunction> Valuation;
+
+    /*!
+     * Builds the parametric state space of the DFT.
+     *
+     * @param dft Parametric DFT which is prepared for the Markovian analysis.
+     * @param symred Flag whether symmetry reduction should be used.
+     * @param relevantEvents Relevant events which should be observed.
+     * @param allowDCForRelevant Whether to allow Don't Care propagation for relevant events.
+     */
+    DftInstantiationChecker(storm::dft::storage::DFT<storm::RationalFunction> const& dft, bool symred = true,
+                            storm::dft::utility::RelevantEvents const& relevantEvents = {}, bool allowDCForRelevant = false);
+
+    /*!
+     * Retrieves the parametric model that is instantiated.
+     */
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> const& getParametricModel() const;
+
+    /*!
+     * Retrieves the parameters occurring in the parametric model.
+     */
+    std::set<storm::RationalFunctionVariable> getParameters() const;
+
+    /*!
+     * Checks the given properties for each of the given valuations.
+     *
+     * @param properties Properties to check.
+     * @param valuations Valuations, each assigning a value to all parameters.
+     * @return For each valuation, the results of the properties in the initial state. A property which could not be checked yields -1.
+     */
+    std::vector<std::vector<double>> check(property_vector const& properties, std::vector<Valuation> const& valuations);
+
+   private:
+    // Instantiates the parametric model for the given valuation. The result is a copy, so it can be used while other valuations are instantiated.
+    std::shared_ptr<storm::models::sparse::Model<double>> instantiate(Valuation const& valuation);
+
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel;
+    std::unique_ptr<storm::utility::ModelInstantiator<storm::models::sparse::Ctmc<storm::RationalFunction>, storm::models::sparse::Ctmc<double>>>
+        ctmcInstantiator;
+    std::unique_ptr<
+        storm::utility::ModelInstantiator<storm::models::sparse::MarkovAutomaton<storm::RationalFunction>, storm::models::sparse::MarkovAutomaton<double>>>
+        maInstantiator;
+
+    // The instantiators keep a single instantiated model, so instantiations must not happen concurrently.
+    std::mutex instantiationMutex;
+};
+
+}  // namespace modelchecker
+}  // namespace storm::dft
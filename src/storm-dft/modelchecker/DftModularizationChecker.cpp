@@ -7,11 +7,13 @@
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/DFTIsomorphism.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -25,7 +27,9 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
     STORM_LOG_DEBUG("Modularization found the following modules:\n" << topModule.toString(*dft));
 
     // Gather all dynamic modules
+    staticTopModule = topModule.isStatic();
     populateDynamicModules(topModule);
+    findIsomorphicModules();
 }
 
 template<typename ValueType>
@@ -41,6 +45,59 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::findIsomorphicModules() {
+    isomorphicModules.clear();
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        isomorphicModules.push_back(i);
+    }
+    if (dynamicModules.size() < 2) {
+        return;
+    }
+
+    // The colouring only supports constant and exponential BEs
+    for (auto const& be : dft->getBasicElements()) {
+        if (be->beType() != storm::dft::storage::elements::BEType::CONSTANT && be->beType() != storm::dft::storage::elements::BEType::EXPONENTIAL) {
+            STORM_LOG_DEBUG("Isomorphic modules are not detected as BE " << be->name() << " has type " << be->beType() << ".");
+            return;
+        }
+    }
+
+    storm::dft::storage::DFTColouring<ValueType> colouring(*dft);
+    for (size_t i = 1; i < dynamicModules.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            // Only compare with the first module of each isomorphism class
+            if (isomorphicModules[j] == j && isIsomorphic(dynamicModules[j], dynamicModules[i], colouring)) {
+                STORM_LOG_DEBUG("Dynamic module " << dynamicModules[i].toString(*dft) << " is isomorphic to " << dynamicModules[j].toString(*dft));
+                isomorphicModules[i] = j;
+                break;
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+bool DftModularizationChecker<ValueType>::isIsomorphic(storm::dft::storage::DftIndependentModule const& module1,
+                                                       storm::dft::storage::DftIndependentModule const& module2,
+                                                       storm::dft::storage::DFTColouring<ValueType> const& colouring) const {
+    std::set<size_t> elements1 = module1.getAllElements();
+    std::set<size_t> elements2 = module2.getAllElements();
+    if (elements1.size() != elements2.size() || dft->getElement(module1.getRepresentative())->type() != dft->getElement(module2.getRepresentative())->type()) {
+        return false;
+    }
+    std::map<size_t, size_t> bijection = dft->findBijection(module1.getRepresentative(), module2.getRepresentative(), colouring, false);
+    // The bijection has to cover exactly the elements of both modules
+    if (bijection.size() != elements1.size()) {
+        return false;
+    }
+    for (auto const& entry : bijection) {
+        if (elements1.count(entry.first) == 0 || elements2.count(entry.second) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -66,21 +123,49 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTi
 
 template<typename ValueType>
 std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<ValueType>::replaceDynamicModules(std::vector<ValueType> const& timepoints) {
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
+    // First analyse all dynamic modules which are not isomorphic to a previous one
+    std::vector<size_t> analysedModules;
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        if (isomorphicModules[i] == i) {
+            analysedModules.push_back(i);
+        }
+    }
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(dynamicModules.size());
+    uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads > 1 && analysedModules.size() > 1) {
+        // Each thread uses its own model checker. Output is disabled as it would be interleaved.
+        storm::utility::parallel::forEachChunk(0, analysedModules.size(), 1, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                storm::dft::modelchecker::DFTModelChecker<ValueType> threadModelchecker(false);
+                results[analysedModules[i]] = analyseDynamicModule(dynamicModules[analysedModules[i]], props, threadModelchecker);
+            }
+        });
+    } else {
+        for (size_t i : analysedModules) {
+            results[i] = analyseDynamicModule(dynamicModules[i], props, modelchecker);
+        }
+    }
+
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
-
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        // Isomorphic modules have the same probabilities
+        auto const& result = results[isomorphicModules[i]];
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
+        for (size_t j{0}; j < timepoints.size(); ++j) {
+            auto const probability{boost::get<ValueType>(result[j])};
+            auto const timebound{timepoints[j]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[i].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +208,14 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties,
+    storm::dft::modelchecker::DFTModelChecker<ValueType>& checker) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
+    STORM_LOG_DEBUG("Analyse dynamic module " << module.toString(*dft));
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    return checker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
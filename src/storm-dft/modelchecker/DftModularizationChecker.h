@@ -15,6 +15,7 @@ namespace modelchecker {
 /*!
  * DFT analysis via modularization.
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
+ * Isomorphic dynamic modules are only analyzed once. If several threads are available, the dynamic modules are analyzed concurrently.
  * The resulting (static) fault tree is then analyzed via BDDs.
  *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
@@ -58,6 +59,23 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Check whether the top module is static, i.e., whether the DFT does not consist of a single dynamic module.
+     * Otherwise, the analysis is not more efficient than analysing the complete DFT via model checking.
+     * @return True iff the top module is static.
+     */
+    bool hasStaticTopModule() const {
+        return staticTopModule;
+    }
+
+    /*!
+     * Get the number of dynamic modules which are replaced by BEs.
+     * @return Number of dynamic modules.
+     */
+    size_t getNumberOfDynamicModules() const {
+        return dynamicModules.size();
+    }
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -65,6 +83,23 @@ class DftModularizationChecker {
      */
     void populateDynamicModules(storm::dft::storage::DftIndependentModule const &module);
 
+    /*!
+     * Find for each dynamic module the first dynamic module which is isomorphic to it.
+     * The results are stored in isomorphicModules.
+     */
+    void findIsomorphicModules();
+
+    /*!
+     * Check whether the given modules are isomorphic, i.e., whether there is a bijection between their elements which preserves the structure and the
+     * failure distributions.
+     * @param module1 First module.
+     * @param module2 Second module.
+     * @param colouring Colouring of the DFT.
+     * @return True iff the modules are isomorphic.
+     */
+    bool isIsomorphic(storm::dft::storage::DftIndependentModule const &module1, storm::dft::storage::DftIndependentModule const &module2,
+                      storm::dft::storage::DFTColouring<ValueType> const &colouring) const;
+
     /*!
      * Calculate results for dynamic modules and replace them with BE's in workDFT.
      * @param timepoints Time points for which the failure probability should be computed.
@@ -75,10 +110,12 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probabilities which should be computed.
+     * @param checker Model checker used for the analysis.
      */
-    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+    typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(
+        storm::dft::storage::DftIndependentModule const &module, FormulaVector const &properties,
+        storm::dft::modelchecker::DFTModelChecker<ValueType> &checker) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +126,10 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // For each dynamic module the index of the first dynamic module which is isomorphic to it (possibly the module itself)
+    std::vector<size_t> isomorphicModules;
+    // Whether the top module is static
+    bool staticTopModule;
 };
 
 }  // namespace modelchecker
@@ -1,11 +1,13 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -113,127 +115,143 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
     return birnbaumFactor;
 }
 
+/**
+ * A bdd given by the list of its nodes.
+ * The children of a node come before the node itself
+ * and the terminals zero and one have the indices 0 and 1.
+ * This allows evaluating the bdd without traversing the Sylvan bdd again.
+ */
+struct FlatBdd {
+    std::vector<uint32_t> variables{0, 0};
+    std::vector<size_t> thenIndices{0, 1};
+    std::vector<size_t> elseIndices{0, 1};
+    size_t root{0};
+
+    size_t size() const {
+        return variables.size();
+    }
+};
+
 /**
  * \returns
- * The probabilities that the bdd is true
- * given the probabilities that the variables are true.
- *
- * \param chunksize
- * The width of the Eigen Arrays
+ * The index of the given bdd in the flat bdd
  *
  * \param bdd
- * The bdd for which to calculate the probabilities
+ * The bdd to add
  *
- * \param indexToProbabilities
- * A reference to a mapping
- * that must map every variable in the bdd to probabilities
+ * \param flatBdd
+ * The flat bdd to which the nodes are added
  *
- * \param bddToProbabilities
+ * \param bddToIndex
  * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
+size_t flattenBdd(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToIndex) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
     }
 
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
+    auto const it{bddToIndex.find(bdd.GetBDD())};
+    if (it != bddToIndex.end()) {
+        return it->second;
     }
 
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+    auto const thenIndex{flattenBdd(bdd.Then(), flatBdd, bddToIndex)};
+    auto const elseIndex{flattenBdd(bdd.Else(), flatBdd, bddToIndex)};
 
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    flatBdd.variables.push_back(bdd.TopVar());
+    flatBdd.thenIndices.push_back(thenIndex);
+    flatBdd.elseIndices.push_back(elseIndex);
+    auto const index{flatBdd.size() - 1};
+    bddToIndex[bdd.GetBDD()] = index;
+    return index;
+}
 
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
+/**
+ * \returns
+ * The flat representation of the given bdd
+ */
+FlatBdd flattenBdd(Bdd const bdd) {
+    FlatBdd flatBdd{};
+    std::unordered_map<uint64_t, size_t> bddToIndex{};
+    flatBdd.root = flattenBdd(bdd, flatBdd, bddToIndex);
+    return flatBdd;
 }
 
 /**
  * \returns
- * The birnbaum importance factors of the given variable
+ * For each node of the bdd the probabilities that it is true
+ * given the probabilities that the variables are true.
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
- * \param bdd
- * The bdd for which to calculate the factors
+ * \param flatBdd
+ * The bdd for which to calculate the probabilities
  *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ */
+std::vector<Eigen::ArrayXd> flatProbabilities(size_t const chunksize, FlatBdd const &flatBdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities) {
+    std::vector<Eigen::ArrayXd> probabilities(flatBdd.size());
+    probabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+    probabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+    for (size_t node{2}; node < flatBdd.size(); ++node) {
+        auto const &currentProbabilities{indexToProbabilities.at(flatBdd.variables[node])};
+        // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+        probabilities[node] =
+            currentProbabilities * probabilities[flatBdd.thenIndices[node]] + (1 - currentProbabilities) * probabilities[flatBdd.elseIndices[node]];
+    }
+    return probabilities;
+}
+
+/**
+ * \returns
+ * The birnbaum importance factors of all variables
  *
- * \param indexToProbability
+ * \param chunksize
+ * The width of the Eigen Arrays
+ *
+ * \param flatBdd
+ * The bdd for which to calculate the factors
+ *
+ * \param indexToProbabilities
  * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
+ * that must map every variable to probabilities
  *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param probabilities
+ * The probabilities of the nodes of the bdd as computed by flatProbabilities
  *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \note
+ * The birnbaum factor of x is the derivative of P(bdd) w.r.t. P(x).
+ * It is the sum of P(reach node) * (P(then) - P(else)) over all nodes labelled with x,
+ * so the factors of all variables are obtained in one top-down pass over the bdd.
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
+std::map<uint32_t, Eigen::ArrayXd> flatBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd,
+                                                       std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                                                       std::vector<Eigen::ArrayXd> const &probabilities) {
+    std::map<uint32_t, Eigen::ArrayXd> birnbaumFactors{};
+    for (auto const &indexProbabilitiesPair : indexToProbabilities) {
+        birnbaumFactors[indexProbabilitiesPair.first] = Eigen::ArrayXd::Constant(chunksize, 0);
     }
 
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
+    // The probabilities that a node is reached from the root
+    std::vector<Eigen::ArrayXd> reachProbabilities(flatBdd.size(), Eigen::ArrayXd::Constant(chunksize, 0));
+    reachProbabilities[flatBdd.root] = Eigen::ArrayXd::Constant(chunksize, 1);
+    // Parents come after their children, so the nodes are handled in reverse order
+    for (size_t node{flatBdd.size()}; node-- > 2;) {
+        auto const currentVar{flatBdd.variables[node]};
+        auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+        auto const thenIndex{flatBdd.thenIndices[node]};
+        auto const elseIndex{flatBdd.elseIndices[node]};
+
+        reachProbabilities[thenIndex] += currentProbabilities * reachProbabilities[node];
+        reachProbabilities[elseIndex] += (1 - currentProbabilities) * reachProbabilities[node];
+        birnbaumFactors[currentVar] += reachProbabilities[node] * (probabilities[thenIndex] - probabilities[elseIndex]);
     }
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
-    }
-
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
+    return birnbaumFactors;
 }
 }  // namespace
 
@@ -287,32 +305,33 @@ std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
 
 template<typename FuncType>
 void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const {
+    uint64_t const numberOfThreads{storm::utility::parallel::getDefaultNumberOfThreads()};
     if (chunksize == 0) {
-        chunksize = timepoints.size();
+        // Distribute the timepoints evenly over the threads
+        chunksize = std::max<size_t>(1, (timepoints.size() + numberOfThreads - 1) / numberOfThreads);
     }
 
-    // caches
     auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
-
-    // The current timepoints we calculate with
-    Eigen::ArrayXd timepointsArray{chunksize};
+    std::vector<uint32_t> beIndices{};
+    beIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        beIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
-    for (size_t currentIndex{0}; currentIndex < timepoints.size(); currentIndex += chunksize) {
-        auto const sizeLeft{timepoints.size() - currentIndex};
-        if (sizeLeft < chunksize) {
-            chunksize = sizeLeft;
-            timepointsArray = Eigen::ArrayXd{chunksize};
-        }
+    // The chunks are independent of each other
+    storm::utility::parallel::forEachChunk(0, timepoints.size(), chunksize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        auto const currentChunksize{chunkEnd - chunkBegin};
 
-        // Update current timepoints
-        for (size_t i{currentIndex}; i < currentIndex + chunksize; ++i) {
-            timepointsArray(i - currentIndex) = timepoints[i];
+        // The current timepoints we calculate with
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{chunkBegin}; i < chunkEnd; ++i) {
+            timepointsArray(i - chunkBegin) = timepoints[i];
         }
 
-        // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
+        // The probabilities of the basic elements
+        std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
+            auto const &be{basicElements[basicElementIndex]};
             // Vectorize known BETypes
             // fallback to getUnreliability() otherwise
             if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
@@ -320,18 +339,18 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 
                 // exponential distribution
                 // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+                indexToProbabilities[beIndices[basicElementIndex]] = 1 - (-failureRate * timepointsArray).exp();
             } else {
                 auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
+                for (size_t i{0}; i < currentChunksize; ++i) {
                     probabilities(i) = be->getUnreliability(timepointsArray(i));
                 }
-                indexToProbabilities[beIndex] = probabilities;
+                indexToProbabilities[beIndices[basicElementIndex]] = probabilities;
             }
         }
 
-        func(chunksize, timepointsArray, indexToProbabilities);
-    }
+        func(chunkBegin, currentChunksize, indexToProbabilities);
+    });
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
@@ -347,23 +366,16 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::vector<ValueType> resultProbabilities{};
-    resultProbabilities.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    auto const flatBdd{flattenBdd(bdd)};
+    std::vector<ValueType> resultProbabilities(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const firstTimepoint, auto const currentChunksize, auto const &indexToProbabilities) {
+        auto const probabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const &probabilitiesArray{probabilities[flatBdd.root]};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities[firstTimepoint + i] = probabilitiesArray(i);
         }
     });
 
@@ -391,26 +403,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const resultVectors{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(resultVectors.size());
+    for (auto const &beResults : resultVectors) {
+        resultVector.push_back(beResults.front());
     }
     return resultVector;
 }
@@ -418,33 +416,20 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    std::vector<ValueType> resultVector(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const firstTimepoint, auto const currentChunksize, auto const &indexToProbabilities) {
+        auto const probabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const birnbaumFactors{flatBirnbaumFactors(currentChunksize, flatBdd, indexToProbabilities, probabilities)};
 
         auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-        auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+        Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilities[flatBdd.root], birnbaumFactors.at(index))};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultVector.push_back(ImportanceMeasureArray(i));
+            resultVector[firstTimepoint + i] = importanceMeasureArray(i);
         }
     });
 
@@ -454,45 +439,30 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
     auto const basicElements{getDFT()->getBasicElements()};
-
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
+    std::vector<uint32_t> beIndices{};
+    beIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        beIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
     }
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    std::vector<std::vector<ValueType>> resultVector(basicElements.size(), std::vector<ValueType>(timepoints.size()));
 
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const firstTimepoint, auto const currentChunksize, auto const &indexToProbabilities) {
+        // The factors of all basic elements are obtained from a single pass over the bdd
+        auto const probabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const birnbaumFactors{flatBirnbaumFactors(currentChunksize, flatBdd, indexToProbabilities, probabilities)};
+        auto const &probabilitiesArray{probabilities[flatBdd.root]};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+            auto const index{beIndices[basicElementIndex]};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+            Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactors.at(index))};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[basicElementIndex][firstTimepoint + i] = importanceMeasureArray(i);
             }
         }
     });
@@ -97,7 +97,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getProbabilitiesAtTimepoints(std::vector<ValueType> const &timepoints, size_t const chunksize = 0) {
         return getProbabilitiesAtTimepoints(getTopLevelElementBdd(), timepoints, chunksize);
@@ -116,7 +117,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize = 0) const;
 
@@ -147,7 +149,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getBirnbaumFactorsAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -160,7 +163,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<std::vector<ValueType>> getAllBirnbaumFactorsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -192,7 +196,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getCIFsAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -204,7 +209,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<std::vector<ValueType>> getAllCIFsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -236,7 +242,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getDIFsAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -248,7 +255,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<std::vector<ValueType>> getAllDIFsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -280,7 +288,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getRAWsAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -292,7 +301,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<std::vector<ValueType>> getAllRAWsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -324,7 +334,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<ValueType> getRRWsAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -336,7 +347,8 @@ class SFTBDDChecker {
      *
      * \param chunksize
      * Splits the timepoints array into chunksize chunks.
-     * A value of 0 represents to calculate the whole array at once.
+     * A value of 0 represents to calculate the whole array at once
+     * (or to split it evenly if several threads are used).
      */
     std::vector<std::vector<ValueType>> getAllRRWsAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize = 0);
 
@@ -357,6 +369,12 @@ class SFTBDDChecker {
      */
     void recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const;
 
+    /**
+     * Splits the timepoints into chunks and calls
+     * func(firstTimepoint, chunksize, indexToProbabilities) for each chunk
+     * with the probabilities of the basic elements at the timepoints of the chunk.
+     * The chunks are processed concurrently if several threads are used.
+     */
     template<typename FuncType>
     void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
 
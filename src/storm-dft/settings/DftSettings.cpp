@@ -25,6 +25,7 @@
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SimulationSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
@@ -60,6 +61,7 @@ void initializeDftSettings(std::string const& name, std::string const& executabl
     storm::settings::addModule<storm::settings::modules::GameSolverSettings>(false);
     // storm::settings::addModule<storm::settings::modules::BisimulationSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
+    storm::settings::addModule<storm::settings::modules::SimulationSettings>();
 
     // For translation into JANI via GSPN.
     storm::settings::addModule<storm::settings::modules::JaniExportSettings>();
@@ -26,6 +26,7 @@ const std::string DftIOSettings::minValueOptionName = "min";
 const std::string DftIOSettings::maxValueOptionName = "max";
 const std::string DftIOSettings::analyzeWithBdds = "bdd";
 const std::string DftIOSettings::minimalCutSets = "mcs";
+const std::string DftIOSettings::simulateOptionName = "simulate";
 const std::string DftIOSettings::exportToJsonOptionName = "export-json";
 const std::string DftIOSettings::exportToSmtOptionName = "export-smt";
 const std::string DftIOSettings::exportToBddDotOptionName = "export-bdd-dot";
@@ -79,6 +80,10 @@ DftIOSettings::DftIOSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, analyzeWithBdds, false, "Try to use Bdds for the analysis. Unsupportet properties will be ignored.")
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, minimalCutSets, false, "Calculate minimal cut sets.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulateOptionName, false,
+                                                   "Estimate the probability of system failure up to the timebound(s) by Monte-Carlo simulation. The simulation is "
+                                                   "configured via the options of the smc module.")
+                        .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, exportToJsonOptionName, false, "Export the model to the Cytoscape JSON format.")
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the JSON file to export to.").build())
@@ -159,6 +164,10 @@ bool DftIOSettings::isAnalyzeWithBdds() const {
     return this->getOption(analyzeWithBdds).getHasOptionBeenSet();
 }
 
+bool DftIOSettings::isSimulate() const {
+    return this->getOption(simulateOptionName).getHasOptionBeenSet();
+}
+
 bool DftIOSettings::isMinimalCutSets() const {
     return this->getOption(minimalCutSets).getHasOptionBeenSet();
 }
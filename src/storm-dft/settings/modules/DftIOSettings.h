@@ -121,6 +121,13 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isAnalyzeWithBdds() const;
 
+    /*!
+     * Retrieves whether the simulate option was set.
+     *
+     * @return True if the simulate option was set.
+     */
+    bool isSimulate() const;
+
     /*!
      * Retrieves whether the minimal cut sets option was set.
      *
@@ -198,6 +205,7 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
     static const std::string maxValueOptionName;
     static const std::string analyzeWithBdds;
     static const std::string minimalCutSets;
+    static const std::string simulateOptionName;
     static const std::string exportToJsonOptionName;
     static const std::string exportToSmtOptionName;
     static const std::string exportToBddDotOptionName;
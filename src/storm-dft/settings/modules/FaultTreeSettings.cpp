@@ -18,6 +18,7 @@ const std::string FaultTreeSettings::moduleName = "dft";
 const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
 const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
 const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+const std::string FaultTreeSettings::hybridOptionName = "hybrid";
 const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
 const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
 const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -35,6 +36,7 @@ const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
 const std::string FaultTreeSettings::mttfStepsizeName = "mttf-stepsize";
 const std::string FaultTreeSettings::mttfAlgorithmName = "mttf-algorithm";
+const std::string FaultTreeSettings::instantiationsOptionName = "instantiations";
 
 FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.")
@@ -42,6 +44,9 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridOptionName, false,
+                                                   "Together with modularisation: analyse dynamic modules via CTMCs and the remaining static fault tree via BDDs.")
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
@@ -106,6 +111,15 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                              .setDefaultValueString("proceeding")
                              .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, instantiationsOptionName, false,
+                                                   "Analyse a parametric DFT for the given valuations of its parameters, where the state space is built only "
+                                                   "once and the valuations are checked in parallel.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "valuations",
+                                         "The valuations separated by ';', each assigning values to all parameters, e.g. 'x=0.1,y=2;x=0.2,y=2'. Values "
+                                         "separated by ':' are combined with the values of the other parameters, e.g. 'x=0.1:0.2,y=1:2' are four valuations.")
+                                         .build())
+                        .build());
 }
 
 bool FaultTreeSettings::useSymmetryReduction() const {
@@ -116,6 +130,10 @@ bool FaultTreeSettings::useModularisation() const {
     return this->getOption(modularisationOptionName).getHasOptionBeenSet();
 }
 
+bool FaultTreeSettings::useHybridAnalysis() const {
+    return this->getOption(hybridOptionName).getHasOptionBeenSet();
+}
+
 bool FaultTreeSettings::isDisableDC() const {
     return this->getOption(disableDCOptionName).getHasOptionBeenSet();
 }
@@ -201,6 +219,14 @@ std::string FaultTreeSettings::getMttfAlgorithm() const {
     return this->getOption(mttfAlgorithmName).getArgumentByName("algorithm").getValueAsString();
 }
 
+bool FaultTreeSettings::isInstantiationsSet() const {
+    return this->getOption(instantiationsOptionName).getHasOptionBeenSet();
+}
+
+std::string FaultTreeSettings::getInstantiations() const {
+    return this->getOption(instantiationsOptionName).getArgumentByName("valuations").getValueAsString();
+}
+
 void FaultTreeSettings::finalize() {}
 
 bool FaultTreeSettings::check() const {
@@ -208,6 +234,7 @@ bool FaultTreeSettings::check() const {
     STORM_LOG_THROW(!isDisableDC() || !areRelevantEventsSet(), storm::exceptions::InvalidSettingsException, "DisableDC and relevantSets can not both be set.");
     STORM_LOG_THROW(!isMaxDepthSet() || getApproximationHeuristic() == storm::dft::builder::ApproximationHeuristic::DEPTH,
                     storm::exceptions::InvalidSettingsException, "Maximal depth requires approximation heuristic depth.");
+    STORM_LOG_THROW(!useHybridAnalysis() || useModularisation(), storm::exceptions::InvalidSettingsException, "Hybrid analysis requires modularisation.");
     return true;
 }
 
@@ -32,6 +32,13 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool useModularisation() const;
 
+    /*!
+     * Retrieves whether the option to use the hybrid analysis (CTMCs for dynamic modules and BDDs for the static rest) is set.
+     *
+     * @return True iff the option was set.
+     */
+    bool useHybridAnalysis() const;
+
     /*!
      * Retrieves whether the option to disable Dont Care propagation is set.
      *
@@ -167,6 +174,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     std::string getMttfAlgorithm() const;
 
+    /*!
+     * Retrieves whether the DFT is to be analysed for several valuations of its parameters.
+     *
+     * @return True iff the option was set.
+     */
+    bool isInstantiationsSet() const;
+
+    /*!
+     * Retrieves the valuations of the parameters for which the DFT is analysed.
+     *
+     * @return The valuations as given by the user.
+     */
+    std::string getInstantiations() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -179,6 +200,7 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string noSymmetryReductionOptionName;
     static const std::string noSymmetryReductionOptionShortName;
     static const std::string modularisationOptionName;
+    static const std::string hybridOptionName;
     static const std::string disableDCOptionName;
     static const std::string allowDCRelevantOptionName;
     static const std::string relevantEventsOptionName;
@@ -196,6 +218,7 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string mttfPrecisionName;
     static const std::string mttfStepsizeName;
     static const std::string mttfAlgorithmName;
+    static const std::string instantiationsOptionName;
 };
 
 }  // namespace modules
@@ -0,0 +1,66 @@
+#include "DFTParallelSimulator.h"
+
+#include <algorithm>
+
+#include "storm/simulator/StatisticalTests.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTParallelSimulator<ValueType>::DFTParallelSimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                      storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t numberOfThreads,
+                                                      uint64_t seed, uint64_t batchSize)
+    : numberOfThreads(std::max<uint64_t>(1, numberOfThreads)), batchSize(std::max<uint64_t>(1, batchSize)) {
+    for (uint64_t thread = 0; thread < this->numberOfThreads; ++thread) {
+        randomGenerators.push_back(std::make_unique<boost::mt19937>(static_cast<uint32_t>(storm::utility::getSeedForStream(seed, thread))));
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, *randomGenerators.back()));
+    }
+}
+
+template<typename ValueType>
+typename DFTParallelSimulator<ValueType>::Result DFTParallelSimulator<ValueType>::estimateUnreliability(double timebound, uint64_t maximalNumberOfTraces,
+                                                                                                       double precision, double confidence) {
+    STORM_LOG_THROW(confidence > 0.0 && confidence < 1.0, storm::exceptions::InvalidArgumentException, "Confidence must lie in (0,1).");
+    double errorProbability = 1.0 - confidence;
+    Result result;
+    std::vector<uint64_t> tracesOfThreads(numberOfThreads, 0);
+    std::vector<uint64_t> failedTracesOfThreads(numberOfThreads, 0);
+    while (result.numberOfTraces < maximalNumberOfTraces && !storm::utility::resources::isTerminate()) {
+        // Simulate (at most) one batch per thread.
+        uint64_t remainingTraces = maximalNumberOfTraces - result.numberOfTraces;
+        uint64_t tracesPerThread = std::min(batchSize, (remainingTraces - 1) / numberOfThreads + 1);
+        storm::utility::parallel::forEachChunk(0, numberOfThreads, 1, numberOfThreads, [&](uint64_t, uint64_t thread, uint64_t) {
+            uint64_t offset = thread * tracesPerThread;
+            tracesOfThreads[thread] = offset < remainingTraces ? std::min(tracesPerThread, remainingTraces - offset) : 0;
+            failedTracesOfThreads[thread] = 0;
+            for (uint64_t trace = 0; trace < tracesOfThreads[thread]; ++trace) {
+                if (simulators[thread]->simulateCompleteTrace(timebound) == SimulationResult::SUCCESSFUL) {
+                    ++failedTracesOfThreads[thread];
+                }
+            }
+        });
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            result.numberOfTraces += tracesOfThreads[thread];
+            result.numberOfFailedTraces += failedTracesOfThreads[thread];
+        }
+
+        result.confidenceInterval = storm::simulator::getClopperPearsonInterval(result.numberOfTraces, result.numberOfFailedTraces, errorProbability);
+        if (precision > 0.0 && result.confidenceInterval.second - result.confidenceInterval.first <= 2 * precision) {
+            result.converged = true;
+            break;
+        }
+    }
+    result.unreliability = result.numberOfTraces > 0 ? static_cast<double>(result.numberOfFailedTraces) / result.numberOfTraces : 0.0;
+    return result;
+}
+
+template class DFTParallelSimulator<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Estimates the unreliability of a DFT by Monte-Carlo simulation on several threads.
+ * Every thread owns a trace simulator (and thus its own DFT states) and a random number generator that is seeded from
+ * an independent stream. Traces are simulated in rounds of one batch per thread. After every round, the stopping
+ * criterion is checked on the combined results.
+ */
+template<typename ValueType>
+class DFTParallelSimulator {
+   public:
+    /*!
+     * Result of a simulation run.
+     */
+    struct Result {
+        // Number of simulated traces.
+        uint64_t numberOfTraces = 0;
+        // Number of traces in which the top-level event failed within the time bound.
+        uint64_t numberOfFailedTraces = 0;
+        // Estimated unreliability.
+        double unreliability = 0.0;
+        // Clopper-Pearson interval containing the unreliability with the requested confidence.
+        std::pair<double, double> confidenceInterval = {0.0, 1.0};
+        // Whether the simulation stopped because the confidence interval was narrow enough.
+        bool converged = false;
+    };
+
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param numberOfThreads Number of threads simulating traces.
+     * @param seed Seed from which the seeds of the random number generators of the threads are derived.
+     * @param batchSize Number of traces each thread simulates before the stopping criterion is checked.
+     */
+    DFTParallelSimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                         uint64_t numberOfThreads, uint64_t seed, uint64_t batchSize = 1000);
+
+    /*!
+     * Estimate the probability that the top-level event fails within the given time bound.
+     * The simulation stops as soon as the confidence interval has at most the width 2 * precision or the given number of traces is reached.
+     *
+     * @param timebound Time bound in which the system failure should occur.
+     * @param maximalNumberOfTraces Maximal number of traces to simulate.
+     * @param precision Half-width of the confidence interval for which the simulation stops. If 0, all traces are simulated.
+     * @param confidence Probability with which the unreliability lies in the confidence interval.
+     * @return Result of the simulation.
+     */
+    Result estimateUnreliability(double timebound, uint64_t maximalNumberOfTraces, double precision = 0.0, double confidence = 0.95);
+
+   private:
+    // Number of threads.
+    uint64_t numberOfThreads;
+
+    // Number of traces each thread simulates per round.
+    uint64_t batchSize;
+
+    // Random number generators (one per thread). They are referenced by the simulators.
+    std::vector<std::unique_ptr<boost::mt19937>> randomGenerators;
+
+    // Simulators (one per thread).
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -8,7 +8,9 @@ DFTTraceSimulator<ValueType>::DFTTraceSimulator(storm::dft::storage::DFT<ValueTy
                                                 storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, boost::mt19937& randomGenerator)
     : dft(dft), stateGenerationInfo(stateGenerationInfo), generator(dft, stateGenerationInfo), randomGenerator(randomGenerator) {
     // Set initial state
-    state = generator.createInitialState();
+    // States are never modified by a step (the successor is always a copy), so the initial state can be reused for all traces.
+    initialState = generator.createInitialState();
+    state = initialState;
 }
 
 template<typename ValueType>
@@ -18,8 +20,7 @@ void DFTTraceSimulator<ValueType>::setRandomNumberGenerator(boost::mt19937& rand
 
 template<typename ValueType>
 void DFTTraceSimulator<ValueType>::resetToInitial() {
-    state = generator.createInitialState();
-    ;
+    state = initialState;
 }
 
 template<typename ValueType>
@@ -105,6 +105,9 @@ class DFTTraceSimulator {
     // Generator for creating next state in DFT
     storm::dft::generator::DftNextStateGenerator<ValueType> generator;
 
+    // Initial state
+    DFTStatePointer initialState;
+
     // Current state
     DFTStatePointer state;
 
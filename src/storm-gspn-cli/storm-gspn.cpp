@@ -1,5 +1,4 @@
 #include "storm-gspn/api/storm-gspn.h"
-#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/parser/GspnParser.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
@@ -25,6 +24,8 @@
 #include <boost/algorithm/string.hpp>
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
@@ -109,13 +110,29 @@ int main(const int argc, const char** argv) {
 
         storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
-        delete gspn;
-        return 0;
+        if (gspnSettings.isExplicitBuildSet()) {
+            // Build the state space directly and check the properties
+            std::vector<storm::expressions::Expression> labelExpressions;
+            for (auto const& property : properties) {
+                for (auto const& atomicFormula : property.getRawFormula()->getAtomicExpressionFormulas()) {
+                    labelExpressions.push_back(atomicFormula->getExpression());
+                }
+            }
+            auto model = storm::api::buildSparseModel(*gspn, labelExpressions);
+            model->printModelInformationToStream(std::cout);
+            for (auto const& property : properties) {
+                std::cout << "Model checking property \"" << property.getName() << "\": " << *property.getRawFormula() << " ...\n";
+                auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+                if (result) {
+                    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model->getInitialStates()));
+                    std::cout << "Result (for initial states): " << *result << '\n';
+                } else {
+                    std::cout << "Property is not supported.\n";
+                }
+            }
+        }
 
-        //        // construct ma
-        //        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-        //        auto ma = builder.translateGspn(gspn, formula);
-        //
+        delete gspn;
         // All operations have now been performed, so we clean up everything and terminate.
         storm::utility::cleanUp();
         return 0;
@@ -16,6 +16,12 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModel(storm::gspn::GSPN const& gspn,
+                                                                       std::vector<storm::expressions::Expression> const& labelExpressions) {
+    storm::builder::ExplicitGspnModelBuilder builder(gspn);
+    return builder.build(labelExpressions);
+}
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
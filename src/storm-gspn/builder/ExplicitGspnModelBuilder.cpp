@@ -1,332 +1,369 @@
-//#include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-//#include "storm/models/sparse/StandardRewardModel.h"
-//
-//#include "storm/utility/macros.h"
-//#include "storm/exceptions/NotImplementedException.h"
-//#include "storm/storage/expressions/ExpressionManager.h"
-//#include "storm-parsers/parser/FormulaParser.h"
-//#include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-// namespace storm {
-//    namespace builder {
-//
-//        template<typename ValueType>
-//        storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string const&
-//        formula) {
-//            // set the given gspn and compute the limits of the net
-//            this->gspn = gspn;
-//            computeCapacities(gspn);
-//
-//            // markings maps markings to their corresponding rowgroups (indices)
-//            markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//            builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//            // add initial marking to todo list
-//            auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//            findOrAddBitvectorToMarkings(*bitvector);
-//            currentRowIndex = 0;
-//
-//            // vector marking markovian states (vector contains an 1 if the state is markovian)
-//            storm::storage::BitVector markovianStates(0);
-//
-//            // vector containing the exit rates for the markovian states
-//            std::vector<ValueType> exitRates;
-//
-//
-//            while (!todo.empty()) {
-//                // take next element from the todo list
-//                auto currentBitvector = todo.front();
-//                todo.pop_front();
-//                auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                // increment list of states by one
-//                markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                // create new row group for the current marking
-//                builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                if (!enabledImmediateTransitions.empty()) {
-//                    markovianStates.set(currentRowIndex, 0);
-//                    exitRates.push_back(0);
-//
-//                    auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                    addRowForPartitions(partitions, currentMarking);
-//                } else {
-//
-//                    auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                    if (!enabledTimedTransitions.empty()) {
-//                        markovianStates.set(currentRowIndex, 1);
-//
-//                        auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                        std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                        exitRates.push_back(accRate);
-//
-//                        addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                    } else {
-//                        markovianStates.set(currentRowIndex, 1);
-//                    }
-//                }
-//                ++currentRowIndex;
-//            }
-//
-//            auto matrix = builder.build();
-//
-//            // create expression manager and add variables from the gspn
-//            auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//            for (auto& place : gspn.getPlaces()) {
-//                expressionManager->declareIntegerVariable(place.getName());
-//            }
-//
-//            // parse formula
-//            storm::parser::FormulaParser formulaParser(expressionManager);
-//            auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//            auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//            // create empty state labeling
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//            storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//            std::cout << '\n';
-//            std::cout << "build labeling:\n";
-//            for (auto& atomicFormula : atomicFormulas) {
-//                std::cout << atomicFormula;
-//                auto label = atomicFormula->toString();
-//                labeling.addLabel(label);
-//
-//                for (auto statePair : markings) {
-//                    auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                    for (auto& place : gspn.getPlaces()) {
-//                        auto variable = expressionManager->getVariable(place.getName());
-//                        expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                    }
-//                    bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                    if (hold) {
-//                        labeling.addLabelToState(label, statePair.second);
-//                    }
-//                }
-//
-//            }
-//
-//            //auto labeling = getStateLabeling();
-//
-//            return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//        const& partitions, storm::gspn::Marking const& currentMarking) {
-//            for (auto& partition : partitions) {
-//                std::cout << "\tnew partition:\n";
-//                auto accWeight = getAccumulatedWeight(partition);
-//                std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                for (auto& trans : partition) {
-//                    std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                    auto newMarking = trans.fire(currentMarking);
-//                    std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                    findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                    auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                    double currentWeight = 0;
-//                    if (it != weights.end()) {
-//                        currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                    }
-//                    currentWeight += trans.getWeight() / accWeight;
-//                    weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                }
-//
-//                addValuesToBuilder(weights);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//        enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//            std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//            for (auto& trans : enabledTimedTransitions) {
-//                std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                auto newMarking = trans.fire(currentMarking);
-//                std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                double currentWeightRate = 0;
-//                if (it != rates.end()) {
-//                    currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                }
-//                currentWeightRate += trans.getRate() / accRate;
-//                rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//            }
-//
-//            addValuesToBuilder(rates);
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//        storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//            for (auto& it : values) {
-//                std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                builder.addNextValue(currentRowIndex, it.first, it.second);
-//            }
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//        ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                storm::gspn::Marking const& marking,
-//                std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//            decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//            for (auto& trans : enabledImmediateTransitions) {
-//                if (trans.noWeightAttached()) {
-//                    decltype(weightedTransitions) singleton;
-//                    singleton.push_back(trans);
-//                    result.push_back(singleton);
-//                } else {
-//                    weightedTransitions.push_back(trans);
-//                }
-//            }
-//
-//            if (weightedTransitions.size() != 0) {
-//                result.push_back(weightedTransitions);
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector)
-//        const {
-//            double result = 0;
-//
-//            for (auto &trans : vector) {
-//                result += trans.getWeight();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//            uint_fast64_t sum = 0;
-//            for (auto& place : gspn.getPlaces()) {//TODO
-//                numberOfBits[place.getID()] = 1;
-//                sum += numberOfBits[place.getID()];
-//            }
-//
-//            // compute next multiple of 64
-//            uint_fast64_t rem = sum % 64;
-//            numberOfTotalBits = sum + 64 - rem;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getTimedTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                storm::gspn::Marking const& marking) {
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//            uint_fast64_t highestSeenPriority = 0;
-//
-//            for (auto& trans : gspn.getImmediateTransitions()) {
-//                if (trans.isEnabled(marking)) {
-//                    if (trans.getPriority() > highestSeenPriority) {
-//                        highestSeenPriority = trans.getPriority();
-//                        result.clear();
-//                    }
-//                    result.push_back(trans);
-//                }
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//            double result = 0;
-//            for (auto trans : vector) {
-//                result += trans.getRate();
-//            }
-//
-//            return result;
-//        }
-//
-//        template<typename ValueType>
-//        storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//            for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                if (std::get<1>(*it) == index) {
-//                    return std::get<0>(*it);
-//                }
-//            }
-//            return storm::storage::BitVector();
-//        }
-//
-//        template<typename ValueType>
-//        uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//            auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//            if (index == nextRowGroupIndex) {
-//                // bitvector was not already in the map
-//                ++nextRowGroupIndex;
-//                // bitvector was also never in the todo list
-//                todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//            }
-//            return index;
-//        }
-//
-//        template<typename ValueType>
-//        storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//            storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//            std::map<uint_fast64_t , std::string> idToName;
-//            for (auto& place : gspn.getPlaces()) {
-//                idToName[place.getID()] = place.getName();
-//                labeling.addLabel(place.getName());
-//            }
-//
-//            auto it = markings.begin();
-//            for ( ; it != markings.end() ; ++it) {
-//                auto bitvector = std::get<0>(*it);
-//                storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                    if (marking.getNumberOfTokensAt(i) > 0) {
-//                        std::cout << i << '\n';
-//                        labeling.addLabelToState(idToName.at(i), i);
-//                    }
-//                }
-//            }
-//
-//            return labeling;
-//        }
-//
-//        template class ExplicitGspnModelBuilder<double>;
-//    }
-//}
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+
+namespace storm {
+namespace builder {
+
+// The maximal number of markings whose successors are computed together. Bounds the memory needed for the successors of one layer.
+static const uint64_t explorationBatchSize = 1024;
+
+ExplicitGspnModelBuilder::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t bitsForUnboundedPlaces)
+    : gspn(gspn), numberOfImmediateTransitions(gspn.getNumberOfImmediateTransitions()) {
+    STORM_LOG_THROW(bitsForUnboundedPlaces > 0 && bitsForUnboundedPlaces < 64, storm::exceptions::InvalidArgumentException,
+                    "Invalid number of bits for unbounded places: " << bitsForUnboundedPlaces << ".");
+
+    // Compute the layout of the markings.
+    uint64_t offset = 0;
+    for (auto const& place : gspn.getPlaces()) {
+        uint64_t limit = place.hasRestrictedCapacity() ? place.getCapacity() : place.getNumberOfInitialTokens();
+        uint64_t bits = place.hasRestrictedCapacity() ? 1 : bitsForUnboundedPlaces;
+        while (bits < 64 && (1ull << bits) <= limit) {
+            ++bits;
+        }
+        STORM_LOG_THROW(bits < 64, storm::exceptions::InvalidModelException, "Capacity of place " << place.getName() << " is too large.");
+        placeOffsets.push_back(offset);
+        placeBits.push_back(bits);
+        maxTokens.push_back(place.hasRestrictedCapacity() ? place.getCapacity() : (1ull << bits) - 1);
+        offset += bits;
+    }
+    // Round to complete words
+    numberOfBits = std::max<uint64_t>(64, ((offset + 63) / 64) * 64);
+
+    // Collect the arcs of all transitions.
+    std::vector<storm::gspn::Transition const*> transitions;
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        transitions.push_back(&transition);
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        STORM_LOG_THROW(transition.hasKServerSemantics() || !transition.getInputPlaces().empty(), storm::exceptions::InvalidModelException,
+                        "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+        transitions.push_back(&transition);
+    }
+    std::vector<std::vector<uint64_t>> dependentTransitions(gspn.getNumberOfPlaces());
+    for (uint64_t transition = 0; transition < transitions.size(); ++transition) {
+        // The arcs are stored in unordered maps, sort them to obtain a deterministic order
+        std::map<uint64_t, uint64_t> inputs(transitions[transition]->getInputPlaces().begin(), transitions[transition]->getInputPlaces().end());
+        std::map<uint64_t, uint64_t> inhibitions(transitions[transition]->getInhibitionPlaces().begin(), transitions[transition]->getInhibitionPlaces().end());
+        std::map<uint64_t, int64_t> changes;
+        for (auto const& arc : inputs) {
+            changes[arc.first] -= arc.second;
+            dependentTransitions[arc.first].push_back(transition);
+        }
+        for (auto const& arc : inhibitions) {
+            dependentTransitions[arc.first].push_back(transition);
+        }
+        for (auto const& arc : transitions[transition]->getOutputPlaces()) {
+            changes[arc.first] += arc.second;
+        }
+        inputArcs.emplace_back(inputs.begin(), inputs.end());
+        inhibitionArcs.emplace_back(inhibitions.begin(), inhibitions.end());
+        effects.emplace_back();
+        for (auto const& change : changes) {
+            if (change.second != 0) {
+                effects.back().push_back(change);
+            }
+        }
+    }
+    for (auto const& transitionEffects : effects) {
+        std::vector<uint64_t> affected;
+        for (auto const& change : transitionEffects) {
+            affected.insert(affected.end(), dependentTransitions[change.first].begin(), dependentTransitions[change.first].end());
+        }
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+        affectedTransitions.push_back(std::move(affected));
+    }
+
+    partitionOfTransition.resize(numberOfImmediateTransitions);
+    for (uint64_t partition = 0; partition < gspn.getPartitions().size(); ++partition) {
+        for (auto const& transition : gspn.getPartitions()[partition].transitions) {
+            partitionOfTransition[storm::gspn::GSPN::transitionIdToImmediateTransitionId(transition)] = partition;
+        }
+    }
+}
+
+uint64_t ExplicitGspnModelBuilder::getNumberOfTokens(storm::storage::BitVector const& marking, uint64_t place) const {
+    return marking.getAsInt(placeOffsets[place], placeBits[place]);
+}
+
+bool ExplicitGspnModelBuilder::isEnabled(storm::storage::BitVector const& marking, uint64_t transition) const {
+    for (auto const& arc : inputArcs[transition]) {
+        if (getNumberOfTokens(marking, arc.first) < arc.second) {
+            return false;
+        }
+    }
+    for (auto const& arc : inhibitionArcs[transition]) {
+        if (getNumberOfTokens(marking, arc.first) >= arc.second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ExplicitGspnModelBuilder::MarkingInfo ExplicitGspnModelBuilder::fire(MarkingInfo const& info, uint64_t transition) const {
+    MarkingInfo result = info;
+    for (auto const& change : effects[transition]) {
+        uint64_t tokens = static_cast<uint64_t>(static_cast<int64_t>(getNumberOfTokens(info.marking, change.first)) + change.second);
+        STORM_LOG_THROW(tokens <= maxTokens[change.first], storm::exceptions::InvalidModelException,
+                        "Number of tokens in place " << gspn.getPlaces()[change.first].getName() << " exceeds the maximum of " << maxTokens[change.first]
+                                                     << ". Set a capacity for this place.");
+        result.marking.setFromInt(placeOffsets[change.first], placeBits[change.first], tokens);
+    }
+    // Only transitions connected to a changed place need to be re-evaluated
+    for (auto const& affected : affectedTransitions[transition]) {
+        result.enabled.set(affected, isEnabled(result.marking, affected));
+    }
+    return result;
+}
+
+bool ExplicitGspnModelBuilder::isVanishing(MarkingInfo const& info) const {
+    return info.enabled.getNextSetIndex(0) < numberOfImmediateTransitions;
+}
+
+ExplicitGspnModelBuilder::Expansion ExplicitGspnModelBuilder::expand(MarkingInfo const& info) const {
+    Expansion result;
+    if (isVanishing(info)) {
+        result.vanishing = true;
+        // Only the immediate transitions with the highest priority may fire
+        uint64_t highestPriority = 0;
+        for (auto transition = info.enabled.getNextSetIndex(0); transition < numberOfImmediateTransitions;
+             transition = info.enabled.getNextSetIndex(transition + 1)) {
+            highestPriority = std::max(highestPriority, gspn.getImmediateTransitions()[transition].getPriority());
+        }
+        // Each partition yields a choice, weights are normalized within a partition
+        std::map<uint64_t, std::vector<uint64_t>> enabledPerPartition;
+        for (auto transition = info.enabled.getNextSetIndex(0); transition < numberOfImmediateTransitions;
+             transition = info.enabled.getNextSetIndex(transition + 1)) {
+            if (gspn.getImmediateTransitions()[transition].getPriority() == highestPriority) {
+                enabledPerPartition[partitionOfTransition[transition]].push_back(transition);
+            }
+        }
+        for (auto const& partition : enabledPerPartition) {
+            double totalWeight = 0.0;
+            for (auto const& transition : partition.second) {
+                totalWeight += gspn.getImmediateTransitions()[transition].getWeight();
+            }
+            result.choices.emplace_back();
+            for (auto const& transition : partition.second) {
+                result.choices.back().emplace_back(fire(info, transition), gspn.getImmediateTransitions()[transition].getWeight() / totalWeight);
+            }
+        }
+    } else {
+        std::vector<std::pair<MarkingInfo, double>> choice;
+        for (auto transition = info.enabled.getNextSetIndex(numberOfImmediateTransitions); transition < info.enabled.size();
+             transition = info.enabled.getNextSetIndex(transition + 1)) {
+            auto const& timedTransition = gspn.getTimedTransitions()[transition - numberOfImmediateTransitions];
+            if (storm::utility::isZero(timedTransition.getRate())) {
+                continue;
+            }
+            double rate = timedTransition.getRate();
+            if (!timedTransition.hasSingleServerSemantics()) {
+                // Multiply the rate with the enabling degree
+                uint64_t enablingDegree = timedTransition.hasKServerSemantics() ? timedTransition.getNumberOfServers() : std::numeric_limits<uint64_t>::max();
+                for (auto const& arc : inputArcs[transition]) {
+                    enablingDegree = std::min(enablingDegree, getNumberOfTokens(info.marking, arc.first) / arc.second);
+                }
+                rate *= enablingDegree;
+            }
+            choice.emplace_back(fire(info, transition), rate);
+        }
+        if (!choice.empty()) {
+            result.choices.push_back(std::move(choice));
+        }
+    }
+    return result;
+}
+
+ExplicitGspnModelBuilder::StateType ExplicitGspnModelBuilder::getOrAddState(MarkingInfo const& info) {
+    StateType newIndex = stateIndices.size();
+    StateType index = stateIndices.findOrAdd(info.marking, newIndex);
+    if (index == newIndex) {
+        statesToExplore.push_back(info);
+    }
+    return index;
+}
+
+std::vector<std::pair<ExplicitGspnModelBuilder::StateType, double>> ExplicitGspnModelBuilder::resolve(MarkingInfo const& info) {
+    if (stateIndices.contains(info.marking)) {
+        return {{stateIndices.getValue(info.marking), storm::utility::one<double>()}};
+    }
+    if (!isVanishing(info)) {
+        return {{getOrAddState(info), storm::utility::one<double>()}};
+    }
+
+    uint64_t newIndex = eliminatedDistributions.size();
+    uint64_t index = eliminatedIndices.findOrAdd(info.marking, newIndex);
+    if (index != newIndex) {
+        if (eliminationInProgress[index]) {
+            // Cycle of immediate transitions, keep the marking as state
+            return {{getOrAddState(info), storm::utility::one<double>()}};
+        }
+        return eliminatedDistributions[index];
+    }
+    eliminatedDistributions.emplace_back();
+    eliminationInProgress.push_back(true);
+
+    Expansion expansion = expand(info);
+    if (expansion.choices.size() > 1) {
+        // Nondeterministic choice, keep the marking as state
+        eliminationInProgress[index] = false;
+        return {{getOrAddState(info), storm::utility::one<double>()}};
+    }
+    std::map<StateType, double> distribution;
+    for (auto const& successor : expansion.choices.front()) {
+        for (auto const& target : resolve(successor.first)) {
+            distribution[target.first] += successor.second * target.second;
+        }
+    }
+    eliminationInProgress[index] = false;
+    if (stateIndices.contains(info.marking)) {
+        // The marking became a state as it lies on a cycle
+        return {{stateIndices.getValue(info.marking), storm::utility::one<double>()}};
+    }
+    eliminatedDistributions[index].assign(distribution.begin(), distribution.end());
+    return eliminatedDistributions[index];
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> ExplicitGspnModelBuilder::build(std::vector<storm::expressions::Expression> const& labelExpressions) {
+    stateIndices = storm::storage::BitVectorHashMap<StateType>(numberOfBits, 100000);
+    statesToExplore.clear();
+    eliminatedIndices = storm::storage::BitVectorHashMap<uint64_t>(numberOfBits, 100000);
+    eliminatedDistributions.clear();
+    eliminationInProgress.clear();
+
+    // The initial marking is always a state
+    MarkingInfo initial{storm::storage::BitVector(numberOfBits), storm::storage::BitVector(inputArcs.size())};
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= maxTokens[place.getID()], storm::exceptions::InvalidModelException,
+                        "Number of initial tokens in place " << place.getName() << " exceeds its capacity.");
+        initial.marking.setFromInt(placeOffsets[place.getID()], placeBits[place.getID()], place.getNumberOfInitialTokens());
+    }
+    for (uint64_t transition = 0; transition < inputArcs.size(); ++transition) {
+        initial.enabled.set(transition, isEnabled(initial.marking, transition));
+    }
+    getOrAddState(initial);
+
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    storm::storage::BitVector markovianStates(100000);
+    storm::storage::BitVector deadlockStates(100000);
+    std::vector<double> exitRates;
+    uint64_t currentRow = 0;
+    uint64_t const numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+
+    while (!statesToExplore.empty()) {
+        // Compute the successors of the next markings (concurrently)
+        std::vector<MarkingInfo> layer;
+        while (!statesToExplore.empty() && layer.size() < explorationBatchSize) {
+            layer.push_back(std::move(statesToExplore.front()));
+            statesToExplore.pop_front();
+        }
+        std::vector<Expansion> expansions(layer.size());
+        storm::utility::parallel::forEachChunk(0, layer.size(), 16, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                expansions[i] = expand(layer[i]);
+            }
+        });
+
+        // Eliminate vanishing successors and add the rows in the order of the states
+        for (auto const& expansion : expansions) {
+            StateType state = exitRates.size();
+            if (state >= markovianStates.size()) {
+                markovianStates.resize(2 * markovianStates.size());
+                deadlockStates.resize(2 * deadlockStates.size());
+            }
+            matrixBuilder.newRowGroup(currentRow);
+            markovianStates.set(state, !expansion.vanishing);
+            if (expansion.choices.empty()) {
+                // Deadlock, add self-loop
+                deadlockStates.set(state);
+                matrixBuilder.addNextValue(currentRow, state, storm::utility::one<double>());
+                exitRates.push_back(storm::utility::one<double>());
+                ++currentRow;
+                continue;
+            }
+            double exitRate = storm::utility::zero<double>();
+            for (auto const& choice : expansion.choices) {
+                std::map<StateType, double> row;
+                for (auto const& successor : choice) {
+                    for (auto const& target : resolve(successor.first)) {
+                        row[target.first] += successor.second * target.second;
+                    }
+                    exitRate += successor.second;
+                }
+                for (auto const& entry : row) {
+                    matrixBuilder.addNextValue(currentRow, entry.first, entry.second);
+                }
+                ++currentRow;
+            }
+            exitRates.push_back(expansion.vanishing ? storm::utility::zero<double>() : exitRate);
+        }
+    }
+
+    uint64_t numberOfStates = stateIndices.size();
+    STORM_LOG_INFO("Explored GSPN " << gspn.getName() << ": " << numberOfStates << " states (" << (numberOfStates - markovianStates.getNumberOfSetBits())
+                                    << " vanishing) and " << eliminatedDistributions.size() << " eliminated vanishing markings.");
+    markovianStates.resize(numberOfStates);
+    deadlockStates.resize(numberOfStates);
+    eliminatedIndices = storm::storage::BitVectorHashMap<uint64_t>(numberOfBits, 1);
+    eliminatedDistributions.clear();
+    eliminationInProgress.clear();
+
+    // Labeling
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("deadlock", std::move(deadlockStates));
+    auto const& manager = *gspn.getExpressionManager();
+    storm::expressions::ExpressionEvaluator<double> evaluator(manager);
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
+    for (auto const& expression : labelExpressions) {
+        std::string label = expression.toString();
+        if (!labeling.containsLabel(label)) {
+            labeling.addLabel(label);
+            labels.emplace_back(label, expression);
+        }
+    }
+    if (!labels.empty()) {
+        for (auto const& stateEntry : stateIndices) {
+            for (auto const& place : gspn.getPlaces()) {
+                if (manager.hasVariable(place.getName())) {
+                    evaluator.setIntegerValue(manager.getVariable(place.getName()), getNumberOfTokens(stateEntry.first, place.getID()));
+                }
+            }
+            for (auto const& label : labels) {
+                if (evaluator.asBool(label.second)) {
+                    labeling.addLabelToState(label.first, stateEntry.second);
+                }
+            }
+        }
+    }
+    stateIndices = storm::storage::BitVectorHashMap<StateType>(numberOfBits, 1);
+
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(currentRow, numberOfStates, numberOfStates);
+    if (markovianStates.full()) {
+        return std::make_shared<storm::models::sparse::Ctmc<double>>(std::move(matrix), std::move(labeling));
+    }
+    storm::storage::sparse::ModelComponents<double> components(std::move(matrix), std::move(labeling));
+    components.rateTransitions = true;
+    components.markovianStates = std::move(markovianStates);
+    components.exitRates = std::move(exitRates);
+    return std::make_shared<storm::models::sparse::MarkovAutomaton<double>>(std::move(components));
+}
+
+}  // namespace builder
+}  // namespace storm
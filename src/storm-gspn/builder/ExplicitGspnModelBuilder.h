@@ -1,175 +1,128 @@
-//#ifndef STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//#define STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
-//
-//#include <string>
-//
-//#include "storm/models/sparse/MarkovAutomaton.h"
-//#include "storm/models/sparse/StandardRewardModel.h"
-//#include "storm/storage/BitVector.h"
-//#include "storm/storage/BitVectorHashMap.h"
-//#include "storm/storage/gspn/GSPN.h"
-//#include "storm/storage/gspn/ImmediateTransition.h"
-//#include "storm/storage/gspn/TimedTransition.h"
-//
-// namespace storm {
-//    namespace builder {
-//
-//        /*!
-//         * This class provides the facilities for building an markov automaton.
-//         */
-//        template<typename ValueType=double>
-//        class ExplicitGspnModelBuilder {
-//        public:
-//
-//            /*!
-//             * Builds an MarkovAutomaton from the given GSPN.
-//             *
-//             * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//             * @return The resulting MarkovAutomaton
-//             */
-//            storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//        private:
-//
-//            /*!
-//             * Add for each partition a new row in the probability matrix.
-//             *
-//             * @param partitions The partitioned immediate transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             */
-//            void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//            storm::gspn::Marking const& currentMarking);
-//
-//
-//            /*!
-//             * Add row for a markovian state.
-//             *
-//             * @param enabledTimedTransitions List of enabled timed transitions.
-//             * @param currentMarking The current marking which is considered at the moment.
-//             * @param accRate The sum of all rates of the enabled timed transisitons
-//             */
-//            void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//            storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//            /*!
-//             * Struct for comparing unsigned integer for maps
-//             */
-//            struct cmpByIndex {
-//                bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                    return a < b;
-//                }
-//            };
-//
-//            /*!
-//             * This method insert the values from a map into the matrix
-//             *
-//             * @param values The values which are inserted
-//             */
-//            void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//            /*!
-//             * This method partitions all enabled immediate transitions w.r.t. a marking.
-//             * All enabled weighted immediate transitions are in one vector. Between these transitions
-//             * is chosen probabilistically by the weights.
-//             *
-//             * All other enabled non-weighted immediate transitions are in an singleton vector.
-//             * Between different vectors is chosen non-deterministically.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//             * @return The vector of vectors which is described above.
-//             */
-//            std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//            const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//            /*!
-//             * Computes the accumulated weight of immediate transisions which are stored in a list.
-//             *
-//             * @param vector List of immediate transisitions.
-//             */
-//            double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//            /*!
-//             * Compute the upper bound for the number of tokens in each place.
-//             * Also computes the number of bits which are used to store a marking.
-//             *
-//             * @param gspn The corresponding gspn.
-//             */
-//            void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//            /*!
-//             * Returns the vector of enabled timed transition with the highest priority.
-//             *
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled timed transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Returns the vector of active immediate transition with the highest priority.
-//             *
-//             * @param marking The current marking which is considered.
-//             * @return The vector of enabled immediate transitions.
-//             */
-//            std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                    storm::gspn::Marking const& marking);
-//
-//            /*!
-//             * Computes the accumulated rate of a vector of timed transitions.
-//             *
-//             * @param vector The vector of timed transitions.
-//             * @return The accumulated rate.
-//             */
-//            double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//            // is only needed for debugging purposes
-//            // since markings is injective, we can determine the bitvector
-//            storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//            /*!
-//             * Adds the bitvector to the marking-map.
-//             * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//             *
-//             * @return The rowGroup index for the bitvector.
-//             */
-//            uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//            /*!
-//             * Computes the state labeling and returns it.
-//             * Every state is labeled with its name.
-//             *
-//             * @return The computed state labeling.
-//             */
-//            storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//            // contains the number of bits which are used the store the number of tokens at each place
-//            std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//            // contains the number of bits used to create markings
-//            uint_fast64_t numberOfTotalBits;
-//
-//            // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//            storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//            // a list of markings for which the outgoing edges need to be computed
-//            std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//            //the gspn which is transformed
-//            storm::gspn::GSPN gspn;
-//
-//            // the next index for a new rowgroup
-//            uint_fast64_t nextRowGroupIndex = 0;
-//
-//            // builder object which is used to create the probability matrix
-//            storm::storage::SparseMatrixBuilder<double> builder;
-//
-//            // contains the current row index during the computation
-//            uint_fast64_t currentRowIndex;
-//        };
-//    }
-//}
-//
-//#endif //STORM_BUILDER_EXPLICITGSPNMODELBUILDER_H_
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the CTMC or Markov automaton of a GSPN directly, i.e., without the detour via JANI.
+ *
+ * - Markings are packed into bit vectors with a fixed number of bits per place, such that markings are hashed and compared word by word.
+ * - Enabledness is tracked incrementally: after firing a transition, only the transitions connected (via input or inhibition arcs) to a place
+ *   whose number of tokens changed are re-evaluated.
+ * - Vanishing markings (in which an immediate transition is enabled) with a single probabilistic choice are eliminated on the fly.
+ *   Only vanishing markings with a nondeterministic choice, vanishing markings on a cycle of immediate transitions and the initial marking are kept
+ *   as (probabilistic) states. If no vanishing marking is kept, a CTMC is built.
+ * - If several threads are used, the successors of the markings of the current exploration layer are computed concurrently. State indices only
+ *   depend on the exploration order and are thus independent of the number of threads.
+ *
+ * The semantics coincides with the one of JaniGSPNBuilder: timed transitions with rate zero are ignored, and the rate of a transition with
+ * k-server (infinite server) semantics is multiplied by its enabling degree.
+ */
+class ExplicitGspnModelBuilder {
+   public:
+    typedef uint64_t StateType;
+
+    /*!
+     * Prepares the exploration of the given GSPN.
+     *
+     * @param gspn The GSPN.
+     * @param bitsForUnboundedPlaces The number of bits used to store the tokens of a place without capacity. Exceeding the resulting maximal
+     * number of tokens during the exploration raises an exception.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t bitsForUnboundedPlaces = 8);
+
+    /*!
+     * Explores the state space and builds the model.
+     * Each state is labelled with 'init' (initial state), 'deadlock' (no transition enabled) and with the string representation of each of the given
+     * expressions that holds in its marking. The expressions may refer to the places via the variables of the GSPN's expression manager.
+     *
+     * @param labelExpressions The expressions for which labels are added.
+     * @return The resulting CTMC or Markov automaton.
+     */
+    std::shared_ptr<storm::models::sparse::Model<double>> build(std::vector<storm::expressions::Expression> const& labelExpressions = {});
+
+   private:
+    // A marking together with the set of transitions enabled in it.
+    struct MarkingInfo {
+        storm::storage::BitVector marking;
+        storm::storage::BitVector enabled;
+    };
+
+    // The successors of a marking: one choice per partition of immediate transitions or a single Markovian choice with the (absolute) rates.
+    struct Expansion {
+        bool vanishing = false;
+        std::vector<std::vector<std::pair<MarkingInfo, double>>> choices;
+    };
+
+    uint64_t getNumberOfTokens(storm::storage::BitVector const& marking, uint64_t place) const;
+
+    bool isEnabled(storm::storage::BitVector const& marking, uint64_t transition) const;
+
+    /*!
+     * Fires the given transition and updates the enabled transitions for the resulting marking.
+     */
+    MarkingInfo fire(MarkingInfo const& info, uint64_t transition) const;
+
+    /*!
+     * Computes the successors of the given marking. Does not modify the builder and can thus be called concurrently.
+     */
+    Expansion expand(MarkingInfo const& info) const;
+
+    /*!
+     * Retrieves whether some immediate transition is enabled.
+     */
+    bool isVanishing(MarkingInfo const& info) const;
+
+    /*!
+     * Retrieves the index of the state of the given marking. Unknown markings are added to the exploration queue.
+     */
+    StateType getOrAddState(MarkingInfo const& info);
+
+    /*!
+     * Replaces the given marking by the distribution over states reached by firing immediate transitions until a state is reached.
+     * Eliminated markings are cached.
+     */
+    std::vector<std::pair<StateType, double>> resolve(MarkingInfo const& info);
+
+    storm::gspn::GSPN const& gspn;
+
+    // The transitions are numbered consecutively: first the immediate, then the timed ones.
+    uint64_t numberOfImmediateTransitions;
+    // For each transition, the input and inhibition arcs as (place, multiplicity) and the net effect on the places as (place, change).
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> inputArcs, inhibitionArcs;
+    std::vector<std::vector<std::pair<uint64_t, int64_t>>> effects;
+    // For each transition, the transitions whose enabledness may change when firing it.
+    std::vector<std::vector<uint64_t>> affectedTransitions;
+    // For each immediate transition, the index of its partition.
+    std::vector<uint64_t> partitionOfTransition;
+
+    // The layout of the packed markings.
+    std::vector<uint64_t> placeOffsets, placeBits;
+    uint64_t numberOfBits;
+    // The maximal number of tokens per place, given by its capacity or by the number of bits.
+    std::vector<uint64_t> maxTokens;
+
+    // The markings of the states and the states that still need to be explored.
+    storm::storage::BitVectorHashMap<StateType> stateIndices;
+    std::deque<MarkingInfo> statesToExplore;
+
+    // The eliminated vanishing markings and their distributions over states. Elimination is in progress while the distribution is computed,
+    // reaching such a marking again reveals a cycle of immediate transitions.
+    storm::storage::BitVectorHashMap<uint64_t> eliminatedIndices;
+    std::vector<std::vector<std::pair<StateType, double>>> eliminatedDistributions;
+    std::vector<bool> eliminationInProgress;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -21,6 +21,7 @@ const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
+const std::string GSPNSettings::explicitBuildOptionName = "explicit";
 
 GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.")
@@ -47,6 +48,9 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitBuildOptionName, false,
+                                                   "Builds the state space directly from the GSPN (without JANI) and checks the properties on it.")
+                        .build());
 }
 
 bool GSPNSettings::isGspnFileSet() const {
@@ -81,6 +85,10 @@ std::string GSPNSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool GSPNSettings::isExplicitBuildSet() const {
+    return this->getOption(explicitBuildOptionName).getHasOptionBeenSet();
+}
+
 void GSPNSettings::finalize() {}
 
 bool GSPNSettings::check() const {
@@ -53,6 +53,11 @@ class GSPNSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the state space is to be built directly from the GSPN.
+     */
+    bool isExplicitBuildSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -66,6 +71,7 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacityOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string explicitBuildOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -38,13 +38,16 @@
 #include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/io/file.h"
+#include "storm/utility/RationalFunctionOperationCache.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/settings/modules/TransformationSettings.h"
@@ -667,6 +670,9 @@ namespace storm {
                 STORM_PRINT("Finding an extremum using Gradient Descent\n");
                 storm::utility::Stopwatch derivativeWatch(true);
                 storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double> derivativeChecker(*dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(), derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet());
+                if (derSettings.getNumberOfStarts() > 1) {
+                    derivativeChecker.setMultiStart(derSettings.getNumberOfStarts(), storm::utility::parallel::getDefaultNumberOfThreads());
+                }
                 storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> checkTask(*formula);
                 derivativeChecker.specifyFormula(Environment(), checkTask);
                 auto instantiationAndValue = derivativeChecker.gradientDescent(Environment());
@@ -861,8 +867,11 @@ namespace storm {
                     if (regionSettings.isDepthLimitSet()) {
                         optionalDepthLimit = regionSettings.getDepthLimit();
                     }
+                    uint64_t presamplesPerParameter = regionSettings.isPresampleSet() ? regionSettings.getPresamplesPerParameter() : 0;
                     // TODO @Jip: change allow model simplification when not using monotonicity, for benchmarking purposes simplification is moved forward.
-                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit, regionSettings.getHypothesis(), false, monotonicitySettings, monThresh);
+                    std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ValueType>> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
+                        model, storm::api::createTask<ValueType>(formula, true), regions.front(), engine, refinementThreshold, optionalDepthLimit,
+                        regionSettings.getHypothesis(), false, monotonicitySettings, monThresh, presamplesPerParameter);
                     return result;
                 };
             } else {
@@ -1054,7 +1063,26 @@ namespace storm {
             auto symbolicInput = storm::cli::parseSymbolicInput();
             storm::cli::ModelProcessingInformation mpi;
             std::tie(symbolicInput, mpi) = storm::cli::preprocessSymbolicInput(symbolicInput);
+
+            // Share the results of operations on rational functions between all parametric computations if requested.
+            auto eliminationSettings = storm::settings::getModule<storm::settings::modules::EliminationSettings>();
+            std::shared_ptr<storm::utility::RationalFunctionOperationCache> operationCache;
+            if (eliminationSettings.isOperationCacheSet()) {
+                operationCache = std::make_shared<storm::utility::RationalFunctionOperationCache>(eliminationSettings.getOperationCacheSize());
+                storm::utility::RationalFunctionOperationCache::setGlobalCache(operationCache);
+            }
+
             processInputWithValueTypeAndDdlib<storm::dd::DdType::Sylvan, storm::RationalFunction>(symbolicInput, mpi);
+
+            if (operationCache) {
+                storm::utility::RationalFunctionOperationCache::setGlobalCache(nullptr);
+                if (coreSettings.isShowStatisticsSet()) {
+                    auto statistics = operationCache->getStatistics();
+                    STORM_PRINT_AND_LOG("Operation cache: " << statistics.entries << " entries, " << statistics.hits << " hits, " << statistics.misses
+                                                            << " misses (hit rate " << statistics.getHitRate() << "), " << statistics.evictions
+                                                            << " evictions.\n");
+                }
+            }
         }
 
     }
@@ -1075,6 +1103,7 @@ int main(const int argc, const char** argv) {
         if (!storm::cli::parseOptions(argc, argv)) {
             return -1;
         }
+        storm::cli::setUpProfiling();
 
         storm::pars::processOptions();
 
@@ -1082,6 +1111,7 @@ int main(const int argc, const char** argv) {
         if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
             storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
         }
+        storm::cli::exportProfile();
 
         storm::utility::cleanUp();
         return 0;
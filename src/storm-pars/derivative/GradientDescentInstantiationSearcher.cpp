@@ -1,7 +1,9 @@
 #include "GradientDescentInstantiationSearcher.h"
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <random>
+#include <tuple>
 #include "analysis/GraphConditions.h"
 #include "environment/Environment.h"
 #include "environment/solver/GmmxxSolverEnvironment.h"
@@ -13,10 +15,12 @@
 #include "settings/modules/GeneralSettings.h"
 #include "solver/helper/SoundValueIterationHelper.h"
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "utility/SignalHandler.h"
 #include "utility/graph.h"
 
@@ -28,6 +32,34 @@ using VariableType = typename utility::parametric::VariableType<FunctionType>::t
 template<typename FunctionType>
 using CoefficientType = typename utility::parametric::CoefficientType<FunctionType>::type;
 
+namespace {
+/*!
+ * Retrieves the given number of smallest prime numbers, which serve as the bases of a Halton sequence.
+ */
+std::vector<uint64_t> getFirstPrimes(uint64_t numberOfPrimes) {
+    std::vector<uint64_t> primes;
+    for (uint64_t candidate = 2; primes.size() < numberOfPrimes; ++candidate) {
+        if (std::none_of(primes.begin(), primes.end(), [candidate](uint64_t prime) { return candidate % prime == 0; })) {
+            primes.push_back(candidate);
+        }
+    }
+    return primes;
+}
+
+/*!
+ * Mirrors the digits of the given index (in the given base) at the decimal point. For index > 0, the result lies in (0, 1).
+ */
+double radicalInverse(uint64_t index, uint64_t base) {
+    double result = 0.0;
+    double digitValue = 1.0 / base;
+    for (; index > 0; index /= base) {
+        result += (index % base) * digitValue;
+        digitValue /= base;
+    }
+    return result;
+}
+}  // namespace
+
 template<typename FunctionType, typename ConstantType>
 ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::doStep(
     VariableType<FunctionType> steppingParameter, std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>& position,
@@ -323,9 +355,9 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            auto checkResults = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, miniBatch, valueVector);
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = checkResults.at(parameter)->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (currentCheckTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     currentCheckTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
@@ -341,6 +373,11 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
             }
         }
 
+        // In a multi-start search, we stop descents that fall behind the other descents or that became obsolete.
+        if (multiStartProgress && !isPromisingDescent(currentValue)) {
+            break;
+        }
+
         // Log position and probability information for later use in visualizing the descent, if wished.
         if (recordRun) {
             VisualizationPoint point;
@@ -402,71 +439,64 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
             break;
     }
 
-    std::random_device device;
-    std::default_random_engine engine(device());
-    std::uniform_real_distribution<> dist(0, 1);
-    bool initialGuess = true;
-    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> point;
-    while (true) {
-        STORM_PRINT_AND_LOG("Trying out a new starting point\n");
-        if (initialGuess) {
-            STORM_PRINT_AND_LOG("Trying initial guess (p->0.5 for every parameter p or set start point)\n");
-        }
-        // Generate random starting point
-        for (auto const& param : this->parameters) {
+    if (numberOfStarts > 1) {
+        std::tie(bestInstantiation, bestValue) = multiStartGradientDescent(env);
+    } else {
+        std::random_device device;
+        std::default_random_engine engine(device());
+        std::uniform_real_distribution<> dist(0, 1);
+        bool initialGuess = true;
+        std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> point;
+        while (true) {
+            STORM_PRINT_AND_LOG("Trying out a new starting point\n");
             if (initialGuess) {
-                logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
-                if (startPoint) {
-                    point[param] = (*startPoint)[param];
+                STORM_PRINT_AND_LOG("Trying initial guess (p->0.5 for every parameter p or set start point)\n");
+            }
+            // Generate random starting point
+            for (auto const& param : this->parameters) {
+                if (initialGuess) {
+                    logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
+                    if (startPoint) {
+                        point[param] = (*startPoint)[param];
+                    } else {
+                        point[param] = utility::convertNumber<CoefficientType<FunctionType>>(0.5 + 1e-6);
+                    }
+                } else if (!initialGuess && constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC &&
+                           logarithmicBarrierTerm > utility::convertNumber<ConstantType>(0.00001)) {
+                    // Do nothing
                 } else {
-                    point[param] = utility::convertNumber<CoefficientType<FunctionType>>(0.5 + 1e-6);
+                    logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
+                    point[param] = utility::convertNumber<CoefficientType<FunctionType>>(dist(engine));
                 }
-            } else if (!initialGuess && constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC &&
-                       logarithmicBarrierTerm > utility::convertNumber<ConstantType>(0.00001)) {
-                // Do nothing
-            } else {
-                logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
-                point[param] = utility::convertNumber<CoefficientType<FunctionType>>(dist(engine));
             }
-        }
-        initialGuess = false;
+            initialGuess = false;
 
-        /* walk.clear(); */
+            /* walk.clear(); */
 
-        stochasticWatch.start();
-        STORM_PRINT_AND_LOG("Starting at " << point << "\n");
-        ConstantType prob = stochasticGradientDescent(env, point);
-        stochasticWatch.stop();
+            stochasticWatch.start();
+            STORM_PRINT_AND_LOG("Starting at " << point << "\n");
+            ConstantType prob = stochasticGradientDescent(env, point);
+            stochasticWatch.stop();
 
-        bool isFoundPointBetter = false;
-        switch (this->currentCheckTask->getBound().comparisonType) {
-            case logic::ComparisonType::Greater:
-            case logic::ComparisonType::GreaterEqual:
-                isFoundPointBetter = prob > bestValue;
+            if (isBetterValue(prob, bestValue)) {
+                bestInstantiation = point;
+                bestValue = prob;
+            }
+
+            if (currentCheckTask->getBound().isSatisfied(bestValue)) {
+                STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
                 break;
-            case logic::ComparisonType::Less:
-            case logic::ComparisonType::LessEqual:
-                isFoundPointBetter = prob < bestValue;
+            } else if (storm::utility::resources::isTerminate()) {
                 break;
-        }
-        if (isFoundPointBetter) {
-            bestInstantiation = point;
-            bestValue = prob;
-        }
-
-        if (currentCheckTask->getBound().isSatisfied(bestValue)) {
-            STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
-            break;
-        } else if (storm::utility::resources::isTerminate()) {
-            break;
-        } else {
-            if (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC) {
-                logarithmicBarrierTerm = logarithmicBarrierTerm / 10;
-                STORM_PRINT_AND_LOG("Smaller term\n" << bestValue << "\n" << logarithmicBarrierTerm << "\n");
+            } else {
+                if (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC) {
+                    logarithmicBarrierTerm = logarithmicBarrierTerm / 10;
+                    STORM_PRINT_AND_LOG("Smaller term\n" << bestValue << "\n" << logarithmicBarrierTerm << "\n");
+                    continue;
+                }
+                STORM_PRINT_AND_LOG("Sorry, couldn't satisfy the bound (yet). Best found value so far: " << bestValue << "\n");
                 continue;
             }
-            STORM_PRINT_AND_LOG("Sorry, couldn't satisfy the bound (yet). Best found value so far: " << bestValue << "\n");
-            continue;
         }
     }
 
@@ -483,6 +513,168 @@ GradientDescentInstantiationSearcher<FunctionType, ConstantType>::gradientDescen
     return std::make_pair(bestInstantiation, bestValue);
 }
 
+template<typename FunctionType, typename ConstantType>
+void GradientDescentInstantiationSearcher<FunctionType, ConstantType>::setMultiStart(uint64_t numberOfStarts, uint64_t numberOfThreads,
+                                                                                     uint64_t pruningInterval) {
+    STORM_LOG_THROW(numberOfStarts > 0, storm::exceptions::InvalidArgumentException, "The number of starts of a multi-start search must be positive.");
+    STORM_LOG_THROW(pruningInterval > 0, storm::exceptions::InvalidArgumentException, "The pruning interval of a multi-start search must be positive.");
+    this->numberOfStarts = numberOfStarts;
+    this->numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+    this->pruningInterval = pruningInterval;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::pair<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>, ConstantType>
+GradientDescentInstantiationSearcher<FunctionType, ConstantType>::multiStartGradientDescent(Environment const& env) {
+    // Exact numbers may not be used concurrently, as they share their (non-atomically) reference counted representations.
+    uint64_t const threads = std::is_same<ConstantType, double>::value ? std::min(numberOfThreads, numberOfStarts) : 1;
+    STORM_LOG_WARN_COND(threads > 1 || numberOfThreads == 1, "Concurrent descents are only supported for double precision. Using a single thread.");
+
+    // The searchers (and their model checkers) are set up in the calling thread and kept for subsequent searches for the same formula.
+    while (workers.size() + 1 < threads) {
+        workers.emplace_back(new GradientDescentInstantiationSearcher<FunctionType, ConstantType>(sharedModel, gradientDescentType, useSignsOnly, miniBatchSize,
+                                                                                                  terminationEpsilon, constraintMethod));
+        workers.back()->specifyFormula(env, *currentCheckTask);
+    }
+    auto progress = std::make_shared<MultiStartProgress>();
+    progress->pruningInterval = pruningInterval;
+    progress->boundSatisfied = false;
+    this->multiStartProgress = progress;
+    for (auto& worker : workers) {
+        worker->multiStartProgress = progress;
+    }
+    std::vector<Environment> environments(threads, env);
+
+    std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> bestInstantiation;
+    ConstantType bestValue;
+    switch (this->currentCheckTask->getBound().comparisonType) {
+        case logic::ComparisonType::Greater:
+        case logic::ComparisonType::GreaterEqual:
+            bestValue = -utility::infinity<ConstantType>();
+            break;
+        case logic::ComparisonType::Less:
+        case logic::ComparisonType::LessEqual:
+            bestValue = utility::infinity<ConstantType>();
+            break;
+    }
+    std::vector<VariableType<FunctionType>> parameterEnumeration(this->parameters.begin(), this->parameters.end());
+    std::vector<uint64_t> const bases = getFirstPrimes(parameterEnumeration.size());
+    uint64_t haltonIndex = 1;
+    stochasticWatch.start();
+    for (uint64_t batch = 0; true; ++batch) {
+        STORM_PRINT_AND_LOG("Trying out " << numberOfStarts << " new starting points on " << threads << " thread(s)\n");
+        // The starting points are kept as doubles, so that every thread creates its own coefficients.
+        std::vector<std::vector<double>> startingPoints(numberOfStarts, std::vector<double>(parameterEnumeration.size()));
+        for (uint64_t start = 0; start < numberOfStarts; ++start) {
+            for (uint64_t parameterIndex = 0; parameterIndex < parameterEnumeration.size(); ++parameterIndex) {
+                if (batch == 0 && start == 0) {
+                    startingPoints[start][parameterIndex] =
+                        startPoint ? utility::convertNumber<double>((*startPoint)[parameterEnumeration[parameterIndex]]) : 0.5 + 1e-6;
+                } else {
+                    startingPoints[start][parameterIndex] = radicalInverse(haltonIndex, bases[parameterIndex]);
+                }
+            }
+            if (batch > 0 || start > 0) {
+                ++haltonIndex;
+            }
+        }
+
+        std::vector<std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>> positions(numberOfStarts);
+        std::vector<ConstantType> values(numberOfStarts);
+        storm::utility::parallel::forEachChunk(0, numberOfStarts, 1, threads, [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+            auto& searcher = threadIndex == 0 ? *this : *workers[threadIndex - 1];
+            for (uint64_t start = chunkBegin; start < chunkEnd; ++start) {
+                for (uint64_t parameterIndex = 0; parameterIndex < parameterEnumeration.size(); ++parameterIndex) {
+                    positions[start][parameterEnumeration[parameterIndex]] =
+                        utility::convertNumber<CoefficientType<FunctionType>>(startingPoints[start][parameterIndex]);
+                }
+                values[start] = searcher.descendFrom(environments[threadIndex], positions[start]);
+            }
+        });
+
+        for (uint64_t start = 0; start < numberOfStarts; ++start) {
+            if (isBetterValue(values[start], bestValue)) {
+                bestInstantiation = std::move(positions[start]);
+                bestValue = values[start];
+            }
+        }
+        if (currentCheckTask->getBound().isSatisfied(bestValue)) {
+            STORM_PRINT_AND_LOG("Aborting because the bound is satisfied\n");
+            break;
+        } else if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+        STORM_PRINT_AND_LOG("Sorry, couldn't satisfy the bound (yet). Best found value so far: " << bestValue << "\n");
+    }
+    stochasticWatch.stop();
+
+    this->multiStartProgress.reset();
+    for (auto& worker : workers) {
+        worker->multiStartProgress.reset();
+    }
+    return std::make_pair(bestInstantiation, bestValue);
+}
+
+template<typename FunctionType, typename ConstantType>
+ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::descendFrom(
+    Environment const& env, std::map<VariableType<FunctionType>, CoefficientType<FunctionType>>& position) {
+    STORM_LOG_INFO("Starting at " << position);
+    resetDynamicValues();
+    logarithmicBarrierTerm = utility::convertNumber<ConstantType>(0.1);
+    descentSteps = 0;
+    descentPruned = false;
+    ConstantType value = stochasticGradientDescent(env, position);
+    // With a logarithmic barrier, we continue the descent with smaller and smaller barrier terms.
+    while (constraintMethod == GradientDescentConstraintMethod::BARRIER_LOGARITHMIC && !currentCheckTask->getBound().isSatisfied(value) && !descentPruned &&
+           !storm::utility::resources::isTerminate() && logarithmicBarrierTerm > utility::convertNumber<ConstantType>(0.00001)) {
+        logarithmicBarrierTerm = logarithmicBarrierTerm / 10;
+        value = stochasticGradientDescent(env, position);
+    }
+    if (currentCheckTask->getBound().isSatisfied(value)) {
+        multiStartProgress->boundSatisfied = true;
+    }
+    return value;
+}
+
+template<typename FunctionType, typename ConstantType>
+bool GradientDescentInstantiationSearcher<FunctionType, ConstantType>::isPromisingDescent(ConstantType const& currentValue) {
+    if (multiStartProgress->boundSatisfied) {
+        descentPruned = true;
+        return false;
+    }
+    ++descentSteps;
+    if (descentSteps % multiStartProgress->pruningInterval != 0) {
+        return true;
+    }
+
+    // We compare the value with the values the other descents had at this checkpoint and prune the descent if most of them were better.
+    uint64_t const checkpoint = descentSteps / multiStartProgress->pruningInterval - 1;
+    std::lock_guard<std::mutex> lock(multiStartProgress->mutex);
+    if (multiStartProgress->checkpointValues.size() <= checkpoint) {
+        multiStartProgress->checkpointValues.resize(checkpoint + 1);
+    }
+    std::vector<ConstantType>& valuesAtCheckpoint = multiStartProgress->checkpointValues[checkpoint];
+    uint64_t const numberOfBetterValues =
+        std::count_if(valuesAtCheckpoint.begin(), valuesAtCheckpoint.end(), [&](ConstantType const& value) { return isBetterValue(value, currentValue); });
+    descentPruned = 2 * numberOfBetterValues > valuesAtCheckpoint.size();
+    valuesAtCheckpoint.push_back(currentValue);
+    STORM_LOG_INFO_COND(!descentPruned, "Pruning a descent at value " << currentValue << " after " << descentSteps << " steps.");
+    return !descentPruned;
+}
+
+template<typename FunctionType, typename ConstantType>
+bool GradientDescentInstantiationSearcher<FunctionType, ConstantType>::isBetterValue(ConstantType const& value, ConstantType const& otherValue) const {
+    switch (this->currentCheckTask->getBound().comparisonType) {
+        case logic::ComparisonType::Greater:
+        case logic::ComparisonType::GreaterEqual:
+            return value > otherValue;
+        case logic::ComparisonType::Less:
+        case logic::ComparisonType::LessEqual:
+            return value < otherValue;
+    }
+    return false;
+}
+
 template<typename FunctionType, typename ConstantType>
 void GradientDescentInstantiationSearcher<FunctionType, ConstantType>::resetDynamicValues() {
     if (Adam* adam = boost::get<Adam>(&gradientDescentType)) {
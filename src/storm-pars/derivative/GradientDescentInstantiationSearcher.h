@@ -1,8 +1,11 @@
 #ifndef STORM_DERIVATIVECHECKER_H
 #define STORM_DERIVATIVECHECKER_H
 
+#include <atomic>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "GradientDescentConstraintMethod.h"
 #include "GradientDescentMethod.h"
 #include "analysis/GraphConditions.h"
@@ -47,10 +50,11 @@ class GradientDescentInstantiationSearcher {
             std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>>
             startPoint = boost::none,
         GradientDescentConstraintMethod constraintMethod = GradientDescentConstraintMethod::PROJECT_WITH_GRADIENT, bool recordRun = false)
-        : model(model),
-          derivativeEvaluationHelper(std::make_unique<SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>>(model)),
+        : sharedModel(std::make_shared<models::sparse::Dtmc<FunctionType> const>(model)),
+          model(*sharedModel),
+          derivativeEvaluationHelper(std::make_unique<SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>>(this->model)),
           instantiationModelChecker(
-              std::make_unique<modelchecker::SparseDtmcInstantiationModelChecker<models::sparse::Dtmc<FunctionType>, ConstantType>>(model)),
+              std::make_unique<modelchecker::SparseDtmcInstantiationModelChecker<models::sparse::Dtmc<FunctionType>, ConstantType>>(this->model)),
           startPoint(startPoint),
           miniBatchSize(miniBatchSize),
           terminationEpsilon(terminationEpsilon),
@@ -134,6 +138,8 @@ class GradientDescentInstantiationSearcher {
      * @param checkTask The CheckTask.
      */
     void specifyFormula(Environment const& env, modelchecker::CheckTask<logic::Formula, FunctionType> const& checkTask) {
+        // The searchers of a multi-start search are set up for the current formula.
+        this->workers.clear();
         this->currentFormula = checkTask.getFormula().asSharedPointer();
         this->currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, FunctionType>>(
             checkTask.substituteFormula(*currentFormula).template convertValueType<FunctionType>());
@@ -169,6 +175,18 @@ class GradientDescentInstantiationSearcher {
               ConstantType>
     gradientDescent(Environment const& env);
 
+    /**
+     * Enables a multi-start search: Instead of trying one starting point after another, gradientDescent runs batches of descents that start at the
+     * points of a low-discrepancy (Halton) sequence, where the very first descent starts at the start point (or the initial guess). The descents of a
+     * batch are distributed over the given number of threads, each of which uses its own instantiation and derivative model checkers. Descents whose
+     * value at a checkpoint is worse than the values most other descents had at that checkpoint are pruned and all descents stop as soon as one of
+     * them satisfies the bound. Concurrent descents are only supported if ConstantType is double, otherwise a single thread is used.
+     * @param numberOfStarts The number of descents per batch.
+     * @param numberOfThreads The number of threads the descents are distributed over.
+     * @param pruningInterval The number of steps between two checkpoints at which the descents are compared.
+     */
+    void setMultiStart(uint64_t numberOfStarts, uint64_t numberOfThreads, uint64_t pruningInterval = 100);
+
     /**
      * Print the previously done run as JSON. This run can be retrieved using getVisualizationWalk.
      */
@@ -195,7 +213,9 @@ class GradientDescentInstantiationSearcher {
     std::shared_ptr<storm::logic::Formula const> currentFormula;
     std::shared_ptr<storm::logic::Formula const> currentFormulaNoBound;
 
-    const models::sparse::Dtmc<FunctionType> model;
+    // The model is shared with the searchers of a multi-start search.
+    std::shared_ptr<models::sparse::Dtmc<FunctionType> const> sharedModel;
+    models::sparse::Dtmc<FunctionType> const& model;
     std::set<typename utility::parametric::VariableType<FunctionType>::type> parameters;
     const std::unique_ptr<storm::derivative::SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>> derivativeEvaluationHelper;
     std::unique_ptr<storm::analysis::MonotonicityHelper<FunctionType, ConstantType>> monotonicityHelper;
@@ -250,6 +270,53 @@ class GradientDescentInstantiationSearcher {
 
     ConstantType logarithmicBarrierTerm;
 
+    // The progress of the descents of a multi-start search, shared by all searchers.
+    struct MultiStartProgress {
+        uint64_t pruningInterval;
+        std::mutex mutex;
+        // For every checkpoint, the values that the descents had when reaching it.
+        std::vector<std::vector<ConstantType>> checkpointValues;
+        std::atomic<bool> boundSatisfied;
+    };
+    uint64_t numberOfStarts = 1;
+    uint64_t numberOfThreads = 1;
+    uint64_t pruningInterval = 100;
+    // The searchers that run the descents of a multi-start search on the threads other than the calling one.
+    std::vector<std::unique_ptr<GradientDescentInstantiationSearcher<FunctionType, ConstantType>>> workers;
+    std::shared_ptr<MultiStartProgress> multiStartProgress;
+    uint64_t descentSteps = 0;
+    bool descentPruned = false;
+
+    /**
+     * Creates a searcher for the descents of a multi-start search that shares the model and the configuration of the calling searcher.
+     */
+    GradientDescentInstantiationSearcher<FunctionType, ConstantType>(std::shared_ptr<models::sparse::Dtmc<FunctionType> const> const& sharedModel,
+                                                                     GradientDescentType const& gradientDescentType, bool useSignsOnly,
+                                                                     uint_fast64_t miniBatchSize, ConstantType terminationEpsilon,
+                                                                     GradientDescentConstraintMethod constraintMethod)
+        : sharedModel(sharedModel),
+          model(*sharedModel),
+          derivativeEvaluationHelper(std::make_unique<SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>>(this->model)),
+          instantiationModelChecker(
+              std::make_unique<modelchecker::SparseDtmcInstantiationModelChecker<models::sparse::Dtmc<FunctionType>, ConstantType>>(this->model)),
+          miniBatchSize(miniBatchSize),
+          terminationEpsilon(terminationEpsilon),
+          constraintMethod(constraintMethod),
+          recordRun(false),
+          gradientDescentType(gradientDescentType),
+          useSignsOnly(useSignsOnly) {
+        // Intentionally left empty.
+    }
+
+    std::pair<std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>,
+              ConstantType>
+    multiStartGradientDescent(Environment const& env);
+    ConstantType descendFrom(
+        Environment const& env,
+        std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>& position);
+    bool isPromisingDescent(ConstantType const& currentValue);
+    bool isBetterValue(ConstantType const& value, ConstantType const& otherValue) const;
+
     ConstantType stochasticGradientDescent(
         Environment const& env,
         std::map<typename utility::parametric::VariableType<FunctionType>::type, typename utility::parametric::CoefficientType<FunctionType>::type>& position);
@@ -22,6 +22,7 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 #include "utility/constants.h"
 #include "utility/graph.h"
@@ -39,6 +40,77 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = getInterestingReachabilityProbabilities(env, valuation, valueVector);
+
+    // Instantiate the matrices with the given instantiation
+    instantiationWatch.start();
+    instantiateEquationSystem(valuation);
+    instantiationWatch.stop();
+
+    approximationWatch.start();
+    std::vector<ConstantType> resultVec = computeRightHandSide(valuation, parameter, interestingReachabilityProbabilities);
+
+    // Here's where the real magic happens - the solver call!
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto solver = factory.create(env);
+
+    // Calculate (1-M)^-1 * resultVec
+    solver->setMatrix(constrainedMatrixInstantiated);
+    std::vector<ConstantType> finalResult(resultVec.size());
+    solver->solveEquations(env, finalResult, resultVec);
+
+    approximationWatch.stop();
+
+    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(Environment const& env,
+                                                                             storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                             std::vector<VariableType<FunctionType>> const& parameters,
+                                                                             boost::optional<std::vector<ConstantType>> const& valueVector) {
+    std::vector<ConstantType> interestingReachabilityProbabilities = getInterestingReachabilityProbabilities(env, valuation, valueVector);
+
+    // All equation systems share the instantiated matrix, so we only instantiate it once.
+    instantiationWatch.start();
+    instantiateEquationSystem(valuation);
+    instantiationWatch.stop();
+
+    approximationWatch.start();
+    // Exact numbers are not safe to be shared among threads.
+    uint64_t numberOfThreads = std::is_same<ConstantType, double>::value ? std::min<uint64_t>(storm::utility::getDefaultNumberOfThreads(), parameters.size()) : 1;
+    numberOfThreads = std::max<uint64_t>(numberOfThreads, 1);
+
+    // Each thread solves its equation systems with its own solver. As the matrix does not change, the solvers keep their caches
+    // (e.g., preconditioners or factorizations) between the solves.
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ConstantType>>> solvers;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        solvers.push_back(factory.create(env, constrainedMatrixInstantiated));
+        solvers.back()->setCachingEnabled(true);
+    }
+
+    std::vector<std::vector<ConstantType>> finalResults(parameters.size());
+    storm::utility::forEachChunk(0, parameters.size(), 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+        for (uint64_t parameterIndex = chunkBegin; parameterIndex < chunkEnd; ++parameterIndex) {
+            std::vector<ConstantType> resultVec = computeRightHandSide(valuation, parameters[parameterIndex], interestingReachabilityProbabilities);
+            finalResults[parameterIndex].resize(resultVec.size());
+            solvers[threadIndex]->solveEquations(env, finalResults[parameterIndex], resultVec);
+        }
+    });
+    approximationWatch.stop();
+
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> result;
+    for (uint64_t parameterIndex = 0; parameterIndex < parameters.size(); ++parameterIndex) {
+        result[parameters[parameterIndex]] = std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(finalResults[parameterIndex]));
+    }
+    return result;
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::getInterestingReachabilityProbabilities(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -58,59 +130,44 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
-    // Instantiate the matrices with the given instantiation
-
-    instantiationWatch.start();
-
-    // STORM_PRINT_AND_LOG(valuation << "\n");
+    return interestingReachabilityProbabilities;
+}
 
+template<typename FunctionType, typename ConstantType>
+void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::instantiateEquationSystem(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation) {
     // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
     // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+}
+
+template<typename FunctionType, typename ConstantType>
+std::vector<ConstantType> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::computeRightHandSide(
+    storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
+    std::vector<ConstantType> const& interestingReachabilityProbabilities) {
+    // Instantiate the derivative of the matrix and the output vector w.r.t. the parameter.
+    // Note that the derived functions and matrices of different parameters are disjoint.
+    for (auto& functionResult : this->functionsDerived.at(parameter)) {
+        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+    }
     for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
+    auto const& deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
 
-    std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
-    for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
-        instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
-    }
-
-    instantiationWatch.stop();
-
-    approximationWatch.start();
-
+    auto const& derivedOutputVec = derivedOutputVecs->at(parameter);
     std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
     deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
-    for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
-        resultVec[i] += instantiatedDerivedOutputVec[i];
+    for (uint_fast64_t i = 0; i < derivedOutputVec.size(); ++i) {
+        resultVec[i] += utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(derivedOutputVec[i], valuation));
     }
-
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
-
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
-
-    approximationWatch.stop();
-
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+    return resultVec;
 }
 
 template<typename FunctionType, typename ConstantType>
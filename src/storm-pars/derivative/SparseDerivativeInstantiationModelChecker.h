@@ -47,6 +47,19 @@ class SparseDerivativeInstantiationModelChecker {
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
     
+    /**
+     * check calculates the derivatives of the model w.r.t. each of the given parameters at an instantiation.
+     * The equation systems of all parameters share their matrix, which is hence instantiated only once. The systems are solved with solvers
+     * that keep their caches (such as preconditioners or factorizations) between the solves. If more than one thread is configured,
+     * the parameters are distributed among the threads (only for floating point computations).
+     * Call specifyFormula first!
+     * @param env The environment.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> check(
+        Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+        std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parameters,
+        boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -81,6 +94,16 @@ class SparseDerivativeInstantiationModelChecker {
         std::unordered_map<FunctionType, ConstantType>& functions);
     void setup(Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask);
 
+    // Retrieves the values of the states that occur in the equation system, computing them if no value vector is given.
+    std::vector<ConstantType> getInterestingReachabilityProbabilities(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                                      boost::optional<std::vector<ConstantType>> const& valueVector);
+    // Instantiates the matrix of the equation system, which is the same for all parameters.
+    void instantiateEquationSystem(storm::utility::parametric::Valuation<FunctionType> const& valuation);
+    // Instantiates the derivatives w.r.t. the given parameter and computes the right-hand side of its equation system.
+    std::vector<ConstantType> computeRightHandSide(storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                                                   typename utility::parametric::VariableType<FunctionType>::type const& parameter,
+                                                   std::vector<ConstantType> const& interestingReachabilityProbabilities);
+
     utility::Stopwatch instantiationWatch;
     utility::Stopwatch approximationWatch;
     utility::Stopwatch generalSetupWatch;
@@ -1,5 +1,6 @@
 #include <sstream>
 #include <queue>
+#include <string>
 
 #include "storm-pars/analysis/OrderExtender.cpp"
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
@@ -11,6 +12,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -57,6 +59,15 @@ namespace storm {
                 auto fractionOfAllSatArea = storm::utility::zero<CoefficientType>();
                 auto fractionOfAllViolatedArea = storm::utility::zero<CoefficientType>();
                 numberOfRegionsKnownThroughMonotonicity = 0;
+                numberOfRegionsRefutedByPresamples = 0;
+                presample(env, region);
+
+                if (createRefinementWorker && numberOfRefinementThreads > 1) {
+                    if (!useMonotonicity) {
+                        return performParallelRegionRefinement(env, region, thresholdAsCoefficient, depthThreshold, hypothesis);
+                    }
+                    STORM_LOG_WARN("Concurrent region refinement is not supported together with monotonicity. Regions are refined sequentially.");
+                }
                 
                 // The resulting (sub-)regions
                 std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
@@ -93,7 +104,12 @@ namespace storm {
                     auto& res = unprocessedRegions.front().second;
                     std::shared_ptr<storm::analysis::Order> order;
                     std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    res = applyPresamples(currentRegion, res);
+                    if (isRefuted(res, hypothesis)) {
+                        ++numberOfRegionsRefutedByPresamples;
+                    } else {
+                        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+                    }
 
                     switch (res) {
                         case RegionResult::AllSat:
@@ -154,30 +170,22 @@ namespace storm {
                     order = orders.front();
                     localMonotonicityResult = localMonotonicityResults.front();
 
-                    if (!order->getDoneBuilding()) {
-                        // we need to use copies for both order and local mon res
-                        while(unprocessedRegions.size() > orders.size()){
-                            orders.emplace(order->copy());
-                            localMonotonicityResults.emplace(localMonotonicityResult->copy());
-                        }
-                    } else if (!localMonotonicityResult->isDone()) {
-                        // the order will not change anymore
-                        while(unprocessedRegions.size() > orders.size()) {
-                            orders.emplace(order);
-                            localMonotonicityResults.emplace(localMonotonicityResult->copy());
-                        }
-                    } else {
-                        // both will not change anymore
-                        while (unprocessedRegions.size() > orders.size()) {
-                            orders.emplace(order);
-                            localMonotonicityResults.emplace(localMonotonicityResult);
-                        }
+                    // All regions share the order and local monotonicity result. They are copied once a region extends them (copy-on-write).
+                    while (unprocessedRegions.size() > orders.size()) {
+                        orders.emplace(order);
+                        localMonotonicityResults.emplace(localMonotonicityResult);
                     }
                     monWatch.stop();
                     STORM_PRINT("\nTime for orderBuilding and monRes initialization: " << monWatch << ".\n\n");
                 }
                 bool useSameOrder = useMonotonicity && order->getDoneBuilding();
                 bool useSameLocalMonotonicityResult = useSameOrder && localMonotonicityResult->isDone();
+                if (!useSameOrder) {
+                    order.reset();
+                }
+                if (!useSameLocalMonotonicityResult) {
+                    localMonotonicityResult.reset();
+                }
 
                 // USEMON WHILE LOOP
                 while (useMonotonicity && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
@@ -191,19 +199,33 @@ namespace storm {
 
                     assert(!orders.empty());
                     if (!useSameOrder) {
-                        order = orders.front();
-                        if (!order->getDoneBuilding()) {
-                            extendOrder(order, currentRegion);
+                        auto& queuedOrder = orders.front();
+                        if (!queuedOrder->getDoneBuilding()) {
+                            // The order may still be shared with other regions (e.g. siblings of the current region).
+                            if (queuedOrder.use_count() > 1) {
+                                queuedOrder = queuedOrder->copy();
+                            }
+                            extendOrder(queuedOrder, currentRegion);
                         }
+                        order = queuedOrder;
                     }
                     if (!useSameLocalMonotonicityResult) {
-                        localMonotonicityResult = localMonotonicityResults.front();
-                        if (!localMonotonicityResult->isDone()) {
-                            extendLocalMonotonicityResult(currentRegion, order, localMonotonicityResult);
+                        auto& queuedLocalMonotonicityResult = localMonotonicityResults.front();
+                        if (!queuedLocalMonotonicityResult->isDone()) {
+                            if (queuedLocalMonotonicityResult.use_count() > 1) {
+                                queuedLocalMonotonicityResult = queuedLocalMonotonicityResult->copy();
+                            }
+                            extendLocalMonotonicityResult(currentRegion, order, queuedLocalMonotonicityResult);
                         }
+                        localMonotonicityResult = queuedLocalMonotonicityResult;
                     }
 
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false, localMonotonicityResult);
+                    res = applyPresamples(currentRegion, res);
+                    if (isRefuted(res, hypothesis)) {
+                        ++numberOfRegionsRefutedByPresamples;
+                    } else {
+                        res = analyzeRegion(env, currentRegion, hypothesis, res, false, localMonotonicityResult);
+                    }
 
                     switch (res) {
                         case RegionResult::AllSat:
@@ -236,39 +258,14 @@ namespace storm {
                                 initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
                                                        ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
                                                         RegionResult::Unknown);
-                                bool first = true;
                                 for (auto& newRegion : newRegions) {
+                                    // The subregions start from the order and local monotonicity result of their parent, which are only copied
+                                    // once a subregion extends them.
                                     if (!useSameOrder) {
-                                        if (first) {
-                                            orders.emplace(order);
-                                            localMonotonicityResults.emplace(localMonotonicityResult);
-                                            first = false;
-                                        } else {
-                                            if (!order->getDoneBuilding()) {
-                                                // we need to use copies for both order and local mon res
-                                                orders.emplace(order->copy());
-                                                localMonotonicityResults.emplace(localMonotonicityResult->copy());
-                                            } else if (!localMonotonicityResult->isDone()) {
-                                                // the order will not change anymore
-                                                orders.emplace(order);
-                                                localMonotonicityResults.emplace(localMonotonicityResult->copy());
-                                            } else {
-                                                // both will not change anymore
-                                                orders.emplace(order);
-                                                localMonotonicityResults.emplace(localMonotonicityResult);
-                                            }
-                                        }
-                                    } else if (!useSameLocalMonotonicityResult) {
-                                        if (first) {
-                                            localMonotonicityResults.emplace(localMonotonicityResult);
-                                            first = false;
-                                        } else {
-                                            if (!localMonotonicityResult->isDone()) {
-                                                localMonotonicityResults.emplace(localMonotonicityResult->copy());
-                                            } else {
-                                                localMonotonicityResults.emplace(localMonotonicityResult);
-                                            }
-                                        }
+                                        orders.emplace(order);
+                                    }
+                                    if (!useSameLocalMonotonicityResult) {
+                                        localMonotonicityResults.emplace(localMonotonicityResult);
                                     }
                                     unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
                                     refinementDepths.push(currentDepth + 1);
@@ -283,11 +280,14 @@ namespace storm {
                     ++numOfAnalyzedRegions;
                     unprocessedRegions.pop();
                     refinementDepths.pop();
+                    // Release the references of the current region such that the shared orders and results are only copied if needed.
                     if (!useSameOrder) {
                         orders.pop();
+                        order.reset();
                     }
                     if (!useSameLocalMonotonicityResult) {
                         localMonotonicityResults.pop();
+                        localMonotonicityResult.reset();
                     }
 
                     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
@@ -313,6 +313,9 @@ namespace storm {
                     
                     STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
                     STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions.\n");
+                    if (!presamples.empty()) {
+                        STORM_PRINT_AND_LOG("    " << numberOfRegionsRefutedByPresamples << " regions were split without analysis due to presampling.\n");
+                    }
 
                     if (useMonotonicity) {
                         STORM_PRINT_AND_LOG("    " << numberOfRegionsKnownThroughMonotonicity << " regions where discovered with help of monotonicity.\n");
@@ -325,6 +328,259 @@ namespace storm {
             }
 
 
+        namespace detail {
+            template <typename NumberType>
+            NumberType copyNumber(NumberType const& number) {
+                // Some number types (e.g. CLN) share their representation between copies through non-atomic reference counters,
+                // so numbers that are used in different threads must not be copies of each other.
+                std::stringstream stream;
+                stream << number;
+                return storm::utility::convertNumber<NumberType>(stream.str());
+            }
+
+            template <typename ParametricType>
+            storm::storage::ParameterRegion<ParametricType> copyRegion(storm::storage::ParameterRegion<ParametricType> const& region) {
+                typename storm::storage::ParameterRegion<ParametricType>::Valuation lowerBoundaries, upperBoundaries;
+                for (auto const& variable : region.getVariables()) {
+                    lowerBoundaries.emplace(variable, copyNumber(region.getLowerBoundary(variable)));
+                    upperBoundaries.emplace(variable, copyNumber(region.getUpperBoundary(variable)));
+                }
+                return storm::storage::ParameterRegion<ParametricType>(std::move(lowerBoundaries), std::move(upperBoundaries));
+            }
+
+            template <typename ParametricType>
+            struct RefinementItem {
+                storm::storage::ParameterRegion<ParametricType> region;
+                RegionResult result;
+                typename storm::storage::ParameterRegion<ParametricType>::CoefficientType area;
+                uint64_t depth;
+                // The indices of the subregions that lead from the initial region to this region. Used to break ties deterministically.
+                std::vector<uint64_t> path;
+            };
+
+            template <typename ParametricType>
+            struct RefinementItemComparator {
+                bool operator()(RefinementItem<ParametricType> const& lhs, RefinementItem<ParametricType> const& rhs) const {
+                    // Regions with a larger area (i.e., a larger potential coverage gain) are processed first.
+                    if (lhs.area != rhs.area) {
+                        return lhs.area < rhs.area;
+                    }
+                    return lhs.path > rhs.path;
+                }
+            };
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setRefinementWorkers(std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> const& createWorker, uint64_t numberOfThreads) {
+            createRefinementWorker = createWorker;
+            numberOfRefinementThreads = std::max<uint64_t>(numberOfThreads, 1);
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::setPresampling(uint64_t samplesPerParameter) {
+            numberOfPresamplesPerParameter = samplesPerParameter;
+        }
+
+        template <typename ParametricType>
+        std::vector<bool> RegionModelChecker<ParametricType>::checkSamples(Environment const& env, std::vector<Valuation> const& samples) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking samples is not supported for this region model checker.");
+            return std::vector<bool>();
+        }
+
+        template <typename ParametricType>
+        void RegionModelChecker<ParametricType>::presample(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region) {
+            presamples.clear();
+            if (numberOfPresamplesPerParameter == 0) {
+                return;
+            }
+            storm::utility::Stopwatch samplingWatch(true);
+
+            // The points are the centers of the cells of a regular grid.
+            // This avoids the boundaries of the region, where instantiations might not be graph preserving.
+            std::vector<VariableType> variables(region.getVariables().begin(), region.getVariables().end());
+            std::vector<std::vector<CoefficientType>> coordinates;
+            for (auto const& variable : variables) {
+                coordinates.emplace_back();
+                auto const& lower = region.getLowerBoundary(variable);
+                auto width = region.getUpperBoundary(variable) - lower;
+                for (uint64_t index = 0; index < numberOfPresamplesPerParameter; ++index) {
+                    auto numerator = storm::utility::convertNumber<CoefficientType>(2 * index + 1);
+                    auto denominator = storm::utility::convertNumber<CoefficientType>(2 * numberOfPresamplesPerParameter);
+                    coordinates.back().push_back(lower + width * numerator / denominator);
+                }
+            }
+
+            // Enumerate the grid with the first parameter changing fastest. Subsequent points are thus mostly neighbors,
+            // such that the solution for one point is a good hint for the next one.
+            std::vector<Valuation> samples;
+            std::vector<uint64_t> indices(variables.size(), 0);
+            bool done = false;
+            while (!done) {
+                Valuation sample;
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    sample.emplace(variables[variableIndex], coordinates[variableIndex][indices[variableIndex]]);
+                }
+                samples.push_back(std::move(sample));
+                done = true;
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    if (++indices[variableIndex] < numberOfPresamplesPerParameter) {
+                        done = false;
+                        break;
+                    }
+                    indices[variableIndex] = 0;
+                }
+            }
+
+            std::vector<bool> results = checkSamples(env, samples);
+            STORM_LOG_ASSERT(results.size() == samples.size(), "Unexpected number of sample results.");
+            for (uint64_t sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex) {
+                presamples.emplace_back(std::move(samples[sampleIndex]), results[sampleIndex]);
+            }
+            samplingWatch.stop();
+            STORM_LOG_INFO("Checked " << presamples.size() << " presamples in " << samplingWatch << ".");
+        }
+
+        template <typename ParametricType>
+        RegionResult RegionModelChecker<ParametricType>::applyPresamples(storm::storage::ParameterRegion<ParametricType> const& region,
+                                                                         RegionResult const& result) const {
+            if (presamples.empty() || result == RegionResult::AllSat || result == RegionResult::AllViolated || result == RegionResult::ExistsBoth) {
+                return result;
+            }
+            bool hasSatPoint = result == RegionResult::ExistsSat || result == RegionResult::CenterSat;
+            bool hasViolatedPoint = result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated;
+            for (auto const& sample : presamples) {
+                if (sample.second ? hasSatPoint : hasViolatedPoint) {
+                    continue;
+                }
+                bool isContained = true;
+                for (auto const& variableValue : sample.first) {
+                    auto const& variable = variableValue.first;
+                    if (variableValue.second < region.getLowerBoundary(variable) || region.getUpperBoundary(variable) < variableValue.second) {
+                        isContained = false;
+                        break;
+                    }
+                }
+                if (isContained) {
+                    (sample.second ? hasSatPoint : hasViolatedPoint) = true;
+                    if (hasSatPoint && hasViolatedPoint) {
+                        return RegionResult::ExistsBoth;
+                    }
+                }
+            }
+            if (hasSatPoint && result != RegionResult::CenterSat) {
+                return RegionResult::ExistsSat;
+            } else if (hasViolatedPoint && result != RegionResult::CenterViolated) {
+                return RegionResult::ExistsViolated;
+            }
+            return result;
+        }
+
+        template <typename ParametricType>
+        bool RegionModelChecker<ParametricType>::isRefuted(RegionResult const& result, RegionResultHypothesis const& hypothesis) {
+            switch (hypothesis) {
+                case RegionResultHypothesis::AllSat:
+                    return result == RegionResult::ExistsBoth || result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated;
+                case RegionResultHypothesis::AllViolated:
+                    return result == RegionResult::ExistsBoth || result == RegionResult::ExistsSat || result == RegionResult::CenterSat;
+                default:
+                    return result == RegionResult::ExistsBoth;
+            }
+        }
+
+        template <typename ParametricType>
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, CoefficientType const& thresholdAsCoefficient, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+            typedef detail::RefinementItem<ParametricType> Item;
+            storm::utility::Stopwatch workerWatch(true);
+            // The calling thread uses this checker, every other thread gets its own.
+            std::vector<std::shared_ptr<RegionModelChecker<ParametricType>>> workers;
+            std::vector<RegionModelChecker<ParametricType>*> checkers = {this};
+            for (uint64_t thread = 1; thread < numberOfRefinementThreads; ++thread) {
+                workers.push_back(createRefinementWorker());
+                checkers.push_back(workers.back().get());
+            }
+            workerWatch.stop();
+            STORM_LOG_INFO("Initialized " << workers.size() << " additional region model checkers in " << workerWatch << ".");
+
+            auto areaOfParameterSpace = region.area();
+            auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+            std::priority_queue<Item, std::vector<Item>, detail::RefinementItemComparator<ParametricType>> unprocessedRegions;
+            unprocessedRegions.push(Item{region, RegionResult::Unknown, areaOfParameterSpace, 0, {}});
+
+            // Enough regions per round such that threads that finish early can pick up more work.
+            uint64_t const regionsPerRound = 2 * numberOfRefinementThreads;
+            uint_fast64_t numOfAnalyzedRegions = 0;
+            while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+                std::vector<Item> round;
+                std::vector<storm::storage::ParameterRegion<ParametricType>> regionCopies;
+                while (round.size() < regionsPerRound && !unprocessedRegions.empty()) {
+                    round.push_back(unprocessedRegions.top());
+                    unprocessedRegions.pop();
+                    round.back().result = applyPresamples(round.back().region, round.back().result);
+                    if (isRefuted(round.back().result, hypothesis)) {
+                        ++numberOfRegionsRefutedByPresamples;
+                    }
+                    regionCopies.push_back(detail::copyRegion(round.back().region));
+                }
+                STORM_LOG_INFO("Analyzing regions #" << numOfAnalyzedRegions << " to #" << numOfAnalyzedRegions + round.size() - 1 << " (" << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+
+                std::vector<RegionResult> roundResults(round.size());
+                storm::utility::parallel::forEachChunk(0, round.size(), 1, numberOfRefinementThreads, [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+                    for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                        if (isRefuted(round[index].result, hypothesis)) {
+                            roundResults[index] = round[index].result;
+                        } else {
+                            roundResults[index] = checkers[threadIndex]->analyzeRegion(env, regionCopies[index], hypothesis, round[index].result, false);
+                        }
+                    }
+                });
+
+                // Merge the results in the order of the round.
+                for (uint64_t index = 0; index < round.size(); ++index) {
+                    auto& item = round[index];
+                    RegionResult res = roundResults[index];
+                    ++numOfAnalyzedRegions;
+                    if (res == RegionResult::AllSat || res == RegionResult::AllViolated) {
+                        fractionOfUndiscoveredArea -= item.area / areaOfParameterSpace;
+                        result.emplace_back(std::move(item.region), res);
+                    } else if (!depthThreshold || item.depth < depthThreshold.get()) {
+                        // Split the region as long as the desired refinement depth is not reached.
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                            ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                             RegionResult::Unknown);
+                        item.region.split(item.region.getCenterPoint(), newRegions);
+                        for (uint64_t subregion = 0; subregion < newRegions.size(); ++subregion) {
+                            auto path = item.path;
+                            path.push_back(subregion);
+                            auto area = newRegions[subregion].area();
+                            unprocessedRegions.push(Item{std::move(newRegions[subregion]), initResForNewRegions, std::move(area), item.depth + 1, std::move(path)});
+                        }
+                    } else {
+                        // If the region is not further refined, it is still added to the result
+                        result.emplace_back(std::move(item.region), res);
+                    }
+                }
+            }
+
+            // Add the still unprocessed regions to the result
+            while (!unprocessedRegions.empty()) {
+                result.emplace_back(unprocessedRegions.top().region, unprocessedRegions.top().result);
+                unprocessedRegions.pop();
+            }
+
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("Region Refinement Statistics:\n");
+                STORM_PRINT_AND_LOG("    Analyzed a total of " << numOfAnalyzedRegions << " regions on " << numberOfRefinementThreads << " threads.\n");
+                if (!presamples.empty()) {
+                    STORM_PRINT_AND_LOG("    " << numberOfRegionsRefutedByPresamples << " regions were split without analysis due to presampling.\n");
+                }
+            }
+
+            auto regionCopyForResult = region;
+            return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+        }
+
         template <typename ParametricType>
         void RegionModelChecker<ParametricType>::extendLocalMonotonicityResult(storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::analysis::Order> order, std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult){
             STORM_LOG_WARN("Initializing local Monotonicity Results not implemented for RegionModelChecker.");
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "storm-pars/analysis/Order.h"
@@ -26,6 +27,7 @@ namespace storm {
             
             typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
             typedef typename storm::storage::ParameterRegion<ParametricType>::VariableType VariableType;
+            typedef typename storm::storage::ParameterRegion<ParametricType>::Valuation Valuation;
 
             RegionModelChecker();
             virtual ~RegionModelChecker() = default;
@@ -50,6 +52,12 @@ namespace storm {
              */
             std::unique_ptr<storm::modelchecker::RegionCheckResult<ParametricType>> analyzeRegions(Environment const& env, std::vector<storm::storage::ParameterRegion<ParametricType>> const& regions, std::vector<RegionResultHypothesis> const& hypotheses, bool sampleVerticesOfRegion = false) ;
 
+            /*!
+             * Checks the property at each of the given parameter valuations.
+             * @return for each valuation, whether the property is satisfied in the initial state.
+             */
+            virtual std::vector<bool> checkSamples(Environment const& env, std::vector<Valuation> const& samples);
+
             virtual ParametricType getBoundAtInitState(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             
             /*!
@@ -96,11 +104,59 @@ namespace storm {
 
             void setMonotoneParameters(std::pair<std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>, std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>> monotoneParameters);
 
+            /*!
+             * Enables concurrent region refinement (without monotonicity).
+             * Each thread analyzes regions with its own region model checker (and thus its own parameter lifter and solver).
+             * This checker is used by the calling thread, the others are obtained from the given function.
+             * @param createWorker creates a region model checker that is specified for the same model and check task as this one.
+             * @param numberOfThreads the number of threads to use.
+             */
+            void setRefinementWorkers(std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> const& createWorker, uint64_t numberOfThreads);
+
+            /*!
+             * Enables sampling before the region refinement. The property is checked on a grid of points within the refined region.
+             * During the refinement, a region that contains both satisfying and violating points is split without analyzing it and
+             * the analysis of any other region that contains points starts from what these points tell about the region.
+             * @param samplesPerParameter the number of points per parameter. Zero disables presampling.
+             */
+            void setPresampling(uint64_t samplesPerParameter);
+
         private:
             bool useMonotonicity = false;
             bool useOnlyGlobal = false;
             bool useBounds = false;
 
+            std::function<std::shared_ptr<RegionModelChecker<ParametricType>>()> createRefinementWorker;
+            uint64_t numberOfRefinementThreads = 1;
+
+            uint64_t numberOfPresamplesPerParameter = 0;
+            // The points checked before the refinement together with whether the property is satisfied at them.
+            std::vector<std::pair<Valuation, bool>> presamples;
+            uint_fast64_t numberOfRegionsRefutedByPresamples = 0;
+
+            /*!
+             * Checks the property on a grid of points within the given region (see setPresampling).
+             */
+            void presample(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region);
+
+            /*!
+             * Combines the given result for the region with the presamples that lie within the region.
+             */
+            RegionResult applyPresamples(storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& result) const;
+
+            /*!
+             * Returns true if the given result shows that the region is neither AllSat nor AllViolated (as far as the hypothesis asks for).
+             * Such regions do not need to be analyzed.
+             */
+            static bool isRefuted(RegionResult const& result, RegionResultHypothesis const& hypothesis);
+
+            /*!
+             * Refines the region concurrently. Regions are processed best-first (largest area first) in rounds:
+             * the regions of a round are analyzed concurrently and their results are merged in a fixed order,
+             * which makes the result independent of the scheduling of the threads.
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, CoefficientType const& thresholdAsCoefficient, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis);
+
         protected:
 
             uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
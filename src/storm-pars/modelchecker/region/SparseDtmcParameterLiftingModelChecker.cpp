@@ -271,6 +271,8 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(resultsForNonMaybeStates);
             }
             parameterLifter->specifyRegion(region, dirForParameters);
+            // Warm-start from the most recent result for this direction
+            std::vector<ConstantType>& x = storm::solver::minimize(dirForParameters) ? minX : maxX;
 
             if (stepBound) {
                 assert(*stepBound > 0);
@@ -487,7 +489,8 @@ namespace storm {
             parameterLifter = nullptr;
             minSchedChoices = boost::none;
             maxSchedChoices = boost::none;
-            x.clear();
+            minX.clear();
+            maxX.clear();
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
             regionSplitEstimationsEnabled = false;
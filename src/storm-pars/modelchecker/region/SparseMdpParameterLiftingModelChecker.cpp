@@ -249,6 +249,7 @@ namespace storm {
             }
             
             parameterLifter->specifyRegion(region, dirForParameters);
+            std::vector<ConstantType>& x = storm::solver::minimize(dirForParameters) ? minX : maxX;
             
             // Set up the solver
             auto solver = solverFactory->create(env, player1Matrix, parameterLifter->getMatrix());
@@ -344,7 +345,8 @@ namespace storm {
             parameterLifter = nullptr;
             minSchedChoices = boost::none;
             maxSchedChoices = boost::none;
-            x.clear();
+            minX.clear();
+            maxX.clear();
             lowerResultBound = boost::none;
             upperResultBound = boost::none;
             applyPreviousResultAsHint = false;
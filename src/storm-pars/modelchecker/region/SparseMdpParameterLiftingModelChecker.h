@@ -65,7 +65,8 @@ namespace storm {
             // Results from the most recent solver call.
             boost::optional<std::vector<uint_fast64_t>> minSchedChoices, maxSchedChoices;
             boost::optional<std::vector<uint_fast64_t>> player1SchedChoices;
-            std::vector<ConstantType> x;
+            // The results for each direction serve as initial guess for the next region, which is typically a subregion.
+            std::vector<ConstantType> minX, maxX;
             boost::optional<ConstantType> lowerResultBound, upperResultBound;
             bool applyPreviousResultAsHint;
         };
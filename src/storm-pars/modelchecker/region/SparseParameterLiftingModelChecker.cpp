@@ -186,6 +186,18 @@ namespace storm {
             return result;
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<bool> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::checkSamples(
+            Environment const& env, std::vector<typename RegionModelChecker<typename SparseModelType::ValueType>::Valuation> const& samples) {
+            std::vector<bool> result;
+            result.reserve(samples.size());
+            auto initialState = *this->parametricModel->getInitialStates().begin();
+            for (auto const& sample : samples) {
+                result.push_back(getInstantiationChecker().check(env, sample)->asExplicitQualitativeCheckResult()[initialState]);
+            }
+            return result;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult) {
             auto quantitativeResult = computeQuantitativeValues(env, region, dirForParameters, localMonotonicityResult);
@@ -38,6 +38,13 @@ namespace storm {
              * Analyzes the 2^#parameters corner points of the given region.
              */
             RegionResult sampleVertices(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult = RegionResult::Unknown);
+
+            /*!
+             * Checks the given points one after another with the instantiation checker, which keeps the instantiated model as well as
+             * the solution of the previous point as a hint.
+             */
+            virtual std::vector<bool> checkSamples(
+                Environment const& env, std::vector<typename RegionModelChecker<typename SparseModelType::ValueType>::Valuation> const& samples) override;
             
             /*!
              * Checks the specified formula on the given region by applying parameter lifting (Parameter choices are lifted to nondeterministic choices)
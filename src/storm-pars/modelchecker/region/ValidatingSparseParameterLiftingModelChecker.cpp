@@ -69,6 +69,12 @@ namespace storm {
             return currentResult;
         }
 
+        template <typename SparseModelType, typename ImpreciseType, typename PreciseType>
+        std::vector<bool> ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::checkSamples(
+            Environment const& env, std::vector<typename RegionModelChecker<typename SparseModelType::ValueType>::Valuation> const& samples) {
+            return getImpreciseChecker().checkSamples(env, samples);
+        }
+
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double, storm::RationalNumber>;
         template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double, storm::RationalNumber>;
 
@@ -25,6 +25,12 @@ namespace storm {
              */
             virtual RegionResult analyzeRegion(Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>> localMonotonicityResult = nullptr) override;
 
+            /*!
+             * Checks the given points with the imprecise checker. As for the center points of regions, these results only guide the analysis.
+             */
+            virtual std::vector<bool> checkSamples(
+                Environment const& env, std::vector<typename RegionModelChecker<typename SparseModelType::ValueType>::Valuation> const& samples) override;
+
         protected:
             
             virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>& getImpreciseChecker() = 0;
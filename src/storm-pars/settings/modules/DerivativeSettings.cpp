@@ -28,6 +28,7 @@ namespace storm {
             const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
             const std::string DerivativeSettings::startPoint = "start-point";
             const std::string DerivativeSettings::constraintMethod = "constraint-method";
+            const std::string DerivativeSettings::multiStart = "multi-start";
 
             DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false, "Search for a feasible instantiation (restart with new instantiation while not feasible)").build());
@@ -50,6 +51,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, omitInconsequentialParams, false, "Parameters that are removed in minimization because they have no effect on the rational function are normally set to 0.5 in the final instantiation. If this flag is set, they will be omitted from the final instantiation entirely.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constraintMethod, false, "Constraint Method").setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument(constraintMethod, "Method for dealing with constraints").setDefaultValueString("project-gradient").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, multiStart, false, "Runs batches of descents from a low-discrepancy sample of start points on the threads set with --threads, pruning descents that fall behind").setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(multiStart, "The number of descents per batch").setDefaultValueUnsignedInteger(1).build()).build());
             }
 
             bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -112,6 +115,10 @@ namespace storm {
                 return boost::none;
             }
 
+            uint_fast64_t DerivativeSettings::getNumberOfStarts() const {
+                return this->getOption(multiStart).getArgumentByName(multiStart).getValueAsUnsignedInteger();
+            }
+
             boost::optional<derivative::GradientDescentMethod> DerivativeSettings::methodFromString(const std::string &str) const {
                   derivative::GradientDescentMethod method;
                   if (str == "adam") {
@@ -93,6 +93,11 @@ namespace storm {
                  */
                 boost::optional<std::string> getStartPoint() const;
 
+                /*!
+                 * Retrieves the number of descents per batch of a multi-start search (one means no multi-start search).
+                 */
+                uint_fast64_t getNumberOfStarts() const;
+
                 const static std::string moduleName;
             private:
                 const static std::string extremumSearch;
@@ -109,6 +114,7 @@ namespace storm {
                 const static std::string omitInconsequentialParams;
                 const static std::string startPoint;
                 const static std::string constraintMethod;
+                const static std::string multiStart;
                 boost::optional<derivative::GradientDescentMethod> methodFromString(const std::string &str) const;
                 boost::optional<derivative::GradientDescentConstraintMethod> constraintMethodFromString(const std::string &str) const;
             };
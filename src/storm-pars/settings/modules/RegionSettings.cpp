@@ -22,6 +22,7 @@ namespace storm {
             const std::string RegionSettings::hypothesisOptionName = "hypothesis";
             const std::string RegionSettings::hypothesisShortOptionName = "hyp";
             const std::string RegionSettings::refineOptionName = "refine";
+            const std::string RegionSettings::presampleOptionName = "presample";
             const std::string RegionSettings::extremumOptionName = "extremum";
             const std::string RegionSettings::extremumSuggestionOptionName = "extremum-init";
             const std::string RegionSettings::splittingThresholdName = "splitting-threshold";
@@ -44,6 +45,13 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("coverage-threshold", "Refinement converges if the fraction of unknown area falls below this threshold.").setDefaultValueDouble(0.05).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0,1.0)).build())
                                 .addArgument(storm::settings::ArgumentBuilder::createIntegerArgument("depth-limit", "If given, limits the number of times a region is refined.").setDefaultValueInteger(-1).makeOptional().build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, presampleOptionName, false,
+                                                               "Checks a grid of points before region refinement to avoid analyzing inconclusive regions.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("samples", "The number of points per parameter.")
+                                                 .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                                 .build())
+                                .build());
+
                 std::vector<std::string> directions = {"min", "max"};
                 std::vector<std::string> precisiontype = {"rel", "abs"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, extremumOptionName, false, "Computes the extremum within the region.")
@@ -201,6 +209,14 @@ namespace storm {
                 return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
             }
 
+            bool RegionSettings::isPresampleSet() const {
+                return this->getOption(presampleOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t RegionSettings::getPresamplesPerParameter() const {
+                return this->getOption(presampleOptionName).getArgumentByName("samples").getValueAsUnsignedInteger();
+            }
+
             int RegionSettings::getSplittingThreshold() const {
                 return this->getOption(splittingThresholdName).getArgumentByName("splitting-threshold").getValueAsInteger();
             }
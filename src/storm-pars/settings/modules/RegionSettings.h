@@ -71,6 +71,16 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves whether a grid of points is checked before the region refinement
+                 */
+                bool isPresampleSet() const;
+
+                /*!
+                 * Retrieves the number of points per parameter that are checked before the region refinement
+                 */
+                uint64_t getPresamplesPerParameter() const;
+
                 /*!
 				 * Retrieves whether an extremal value is to be computed
 				 */
@@ -122,6 +132,7 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string presampleOptionName;
 				const static std::string splittingThresholdName;
 				const static std::string extremumOptionName;
 				const static std::string extremumSuggestionOptionName;
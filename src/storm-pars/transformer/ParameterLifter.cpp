@@ -85,8 +85,12 @@ namespace storm {
                                 builder.addNextValue(newRowIndex, oldToNewColumnIndexMapping[entry.getColumn()], storm::utility::convertNumber<ConstantType>(entry.getValue()));
                             } else {
                                 builder.addNextValue(newRowIndex, oldToNewColumnIndexMapping[entry.getColumn()], storm::utility::one<ConstantType>());
-                                ConstantType& placeholder = functionValuationCollector.add(entry.getValue(), val);
-                                matrixAssignment.push_back(std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType&>(typename storm::storage::SparseMatrix<ConstantType>::iterator(), placeholder));
+                                uint_fast64_t placeholderIndex = functionValuationCollector.add(entry.getValue(), val);
+                                if (placeholderIndex >= matrixAssignmentsOfPlaceholder.size()) {
+                                    matrixAssignmentsOfPlaceholder.resize(placeholderIndex + 1);
+                                }
+                                matrixAssignmentsOfPlaceholder[placeholderIndex].push_back(matrixAssignment.size());
+                                matrixAssignment.push_back(std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType&>(typename storm::storage::SparseMatrix<ConstantType>::iterator(), functionValuationCollector.getPlaceholder(placeholderIndex)));
                                 countPlaceHolders++;
                             }
                         }
@@ -104,8 +108,12 @@ namespace storm {
                                 vectorVal.addParameterUnspecified(vectorVar);
                             }
                         }
-                        ConstantType& placeholder = functionValuationCollector.add(pVectorEntry, vectorVal);
-                        vectorAssignment.push_back(std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>(typename std::vector<ConstantType>::iterator(), placeholder));
+                        uint_fast64_t placeholderIndex = functionValuationCollector.add(pVectorEntry, vectorVal);
+                        if (placeholderIndex >= vectorAssignmentsOfPlaceholder.size()) {
+                            vectorAssignmentsOfPlaceholder.resize(placeholderIndex + 1);
+                        }
+                        vectorAssignmentsOfPlaceholder[placeholderIndex].push_back(vectorAssignment.size());
+                        vectorAssignment.push_back(std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>(typename std::vector<ConstantType>::iterator(), functionValuationCollector.getPlaceholder(placeholderIndex)));
                     }
 
                     ++newRowIndex;
@@ -125,6 +133,9 @@ namespace storm {
             matrixAssignment.shrink_to_fit();
             vectorAssignment.shrink_to_fit();
             nonConstMatrixEntries.resize(pMatrixEntryCount);
+            uint_fast64_t numberOfPlaceholders = std::max(matrixAssignmentsOfPlaceholder.size(), vectorAssignmentsOfPlaceholder.size());
+            matrixAssignmentsOfPlaceholder.resize(numberOfPlaceholders);
+            vectorAssignmentsOfPlaceholder.resize(numberOfPlaceholders);
 
             // Now insert the correct iterators for the matrix and vector assignment
             auto matrixAssignmentIt = matrixAssignment.begin();
@@ -155,16 +166,31 @@ namespace storm {
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
             // write the evaluation result of each function,evaluation pair into the placeholders
-            functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
+            storm::storage::BitVector changedPlaceholders = functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
 
             //apply the matrix and vector assignments to write the contents of the placeholder into the matrix/vector
-            for (auto &assignment : matrixAssignment) {
-                STORM_LOG_WARN_COND(!storm::utility::isZero(assignment.second), "Parameter lifting on region " << region.toString() << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
-                assignment.first->setValue(assignment.second);
-            }
+            if (changedPlaceholders.full()) {
+                for (auto &assignment : matrixAssignment) {
+                    STORM_LOG_WARN_COND(!storm::utility::isZero(assignment.second), "Parameter lifting on region " << region.toString() << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
+                    assignment.first->setValue(assignment.second);
+                }
 
-            for (auto &assignment : vectorAssignment) {
-                *assignment.first = assignment.second;
+                for (auto &assignment : vectorAssignment) {
+                    *assignment.first = assignment.second;
+                }
+            } else {
+                // Only the entries connected with a changed placeholder need to be written
+                for (auto const& placeholderIndex : changedPlaceholders) {
+                    for (auto const& assignmentIndex : matrixAssignmentsOfPlaceholder[placeholderIndex]) {
+                        auto& assignment = matrixAssignment[assignmentIndex];
+                        STORM_LOG_WARN_COND(!storm::utility::isZero(assignment.second), "Parameter lifting on region " << region.toString() << " affects the underlying graph structure (the region is not strictly well defined). The result for this region might be incorrect.");
+                        assignment.first->setValue(assignment.second);
+                    }
+                    for (auto const& assignmentIndex : vectorAssignmentsOfPlaceholder[placeholderIndex]) {
+                        auto& assignment = vectorAssignment[assignmentIndex];
+                        *assignment.first = assignment.second;
+                    }
+                }
             }
         }
 
@@ -317,34 +343,93 @@ namespace storm {
         }
 
         template<typename ParametricType, typename ConstantType>
-        ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::add(ParametricType const& function, AbstractValuation const& valuation) {
+        uint_fast64_t ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::add(ParametricType const& function, AbstractValuation const& valuation) {
             ParametricType simplifiedFunction = function;
             storm::utility::simplify(simplifiedFunction);
             std::set<VariableType> variablesInFunction;
             storm::utility::parametric::gatherOccurringVariables(simplifiedFunction, variablesInFunction);
             AbstractValuation simplifiedValuation = valuation.getSubValuation(variablesInFunction);
             // insert the function and the valuation
-            //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
-            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, ConstantType>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), storm::utility::one<ConstantType>()));
+            auto insertionRes = collectedFunctions.insert(std::pair<FunctionValuation, uint_fast64_t>(FunctionValuation(std::move(simplifiedFunction), std::move(simplifiedValuation)), placeholders.size()));
+            if (insertionRes.second) {
+                uint_fast64_t index = insertionRes.first->second;
+                //Note that references to elements of an unordered map remain valid after calling unordered_map::insert.
+                functionValuations.push_back(&insertionRes.first->first);
+                placeholders.push_back(storm::utility::one<ConstantType>());
+                // Remember the boundaries this placeholder depends on
+                AbstractValuation const& insertedValuation = insertionRes.first->first.second;
+                for (auto const& par : insertedValuation.getLowerParameters()) {
+                    placeholdersAtLowerBoundary[par].push_back(index);
+                }
+                for (auto const& par : insertedValuation.getUpperParameters()) {
+                    placeholdersAtUpperBoundary[par].push_back(index);
+                }
+                for (auto const& par : insertedValuation.getUnspecifiedParameters()) {
+                    placeholdersAtLowerBoundary[par].push_back(index);
+                    placeholdersAtUpperBoundary[par].push_back(index);
+                }
+            }
             return insertionRes.first->second;
         }
+
+        template<typename ParametricType, typename ConstantType>
+        ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::getPlaceholder(uint_fast64_t index) {
+            return placeholders[index];
+        }
     
         template<typename ParametricType, typename ConstantType>
-        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
-            for (auto &collectedFunctionValuationPlaceholder : collectedFunctions) {
-                ParametricType const &function = collectedFunctionValuationPlaceholder.first.first;
-                AbstractValuation const &abstrValuation = collectedFunctionValuationPlaceholder.first.second;
-                ConstantType &placeholder = collectedFunctionValuationPlaceholder.second;
-                auto concreteValuations = abstrValuation.getConcreteValuations(region);
-                auto concreteValuationIt = concreteValuations.begin();
-                placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
-                    ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
-                    if (storm::solver::minimize(dirForUnspecifiedParameters)) {
-                        placeholder = std::min(placeholder, currentResult);
-                    } else {
-                        placeholder = std::max(placeholder, currentResult);
+        storm::storage::BitVector ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            // Functions with unspecified parameters depend on the direction, so we evaluate everything if it changed.
+            bool evaluateAll = !lastDirection || lastDirection.get() != dirForUnspecifiedParameters || lastLowerBoundaries.size() != region.getLowerBoundaries().size();
+            storm::storage::BitVector result(placeholders.size(), evaluateAll);
+            if (!evaluateAll) {
+                // Only consider the placeholders that depend on a boundary that differs from the previous region.
+                // When refining, the subregions share half of their boundaries with the parent region.
+                auto markChanged = [&result](std::map<VariableType, std::vector<uint_fast64_t>> const& placeholdersAtBoundary, storm::utility::parametric::Valuation<ParametricType> const& boundaries, storm::utility::parametric::Valuation<ParametricType> const& lastBoundaries) {
+                    for (auto const& boundary : boundaries) {
+                        auto lastBoundaryIt = lastBoundaries.find(boundary.first);
+                        if (lastBoundaryIt == lastBoundaries.end() || lastBoundaryIt->second != boundary.second) {
+                            auto placeholdersIt = placeholdersAtBoundary.find(boundary.first);
+                            if (placeholdersIt != placeholdersAtBoundary.end()) {
+                                for (auto const& index : placeholdersIt->second) {
+                                    result.set(index, true);
+                                }
+                            }
+                        }
                     }
+                };
+                markChanged(placeholdersAtLowerBoundary, region.getLowerBoundaries(), lastLowerBoundaries);
+                markChanged(placeholdersAtUpperBoundary, region.getUpperBoundaries(), lastUpperBoundaries);
+            }
+
+            for (auto const& index : result) {
+                ConstantType previousValue = placeholders[index];
+                evaluate(index, region, dirForUnspecifiedParameters);
+                if (!evaluateAll && previousValue == placeholders[index]) {
+                    result.set(index, false);
+                }
+            }
+
+            lastDirection = dirForUnspecifiedParameters;
+            lastLowerBoundaries = region.getLowerBoundaries();
+            lastUpperBoundaries = region.getUpperBoundaries();
+            return result;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluate(uint_fast64_t index, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+            ParametricType const &function = functionValuations[index]->first;
+            AbstractValuation const &abstrValuation = functionValuations[index]->second;
+            ConstantType &placeholder = placeholders[index];
+            auto concreteValuations = abstrValuation.getConcreteValuations(region);
+            auto concreteValuationIt = concreteValuations.begin();
+            placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+            for (++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
+                ConstantType currentResult = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
+                if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                    placeholder = std::min(placeholder, currentResult);
+                } else {
+                    placeholder = std::max(placeholder, currentResult);
                 }
             }
         }
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <vector>
 #include <unordered_map>
 #include <set>
 
+#include <boost/optional.hpp>
+
 
 #include "storm-pars/storage/ParameterRegion.h"
 #include "storm-pars/utility/parametric.h"
@@ -25,6 +28,8 @@ namespace storm {
          * The given vector is handled similarly.
          * However, if a vector entry considers a parameter that does not occur in the corresponding matrix row,
          * the parameter is directly set such that the vector entry is maximized (or minimized, depending on the specified optimization direction).
+         * When a region is specified after another one (e.g. a subregion obtained by splitting the previous region), only the entries that depend on a
+         * changed region boundary are re-evaluated and written.
          *
          * @note The row grouping of the original matrix is ignored.
          */
@@ -128,14 +133,24 @@ namespace storm {
 
                 /*!
                  * Adds the provided function and valuation.
-                 * Returns a reference to a placeholder in which the evaluation result will be written upon calling evaluateCollectedFunctions)
+                 * Returns the index of a placeholder in which the evaluation result will be written upon calling evaluateCollectedFunctions
                  */
-                ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
+                uint_fast64_t add(ParametricType const& function, AbstractValuation const& valuation);
 
-                void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+                /*!
+                 * Returns the placeholder with the given index. References to placeholders remain valid when further functions are added.
+                 */
+                ConstantType& getPlaceholder(uint_fast64_t index);
+
+                /*!
+                 * Writes the evaluation results into the placeholders.
+                 * Functions are only re-evaluated if the boundaries they are evaluated at differ from the ones of the previously specified region.
+                 * @return the indices of the placeholders whose value might have changed since the previous call
+                 */
+                storm::storage::BitVector evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
                 
             private:
-                // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
+                // Stores a function and a valuation.
                 typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
                 class FuncValHash{
@@ -148,8 +163,20 @@ namespace storm {
                         }
                 };
 
-                // Stores the collected functions with the valuations together with a placeholder for the result.
-                std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+                void evaluate(uint_fast64_t index, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
+                // Stores the collected functions with the valuations together with the index of the placeholder for the result.
+                std::unordered_map<FunctionValuation, uint_fast64_t, FuncValHash> collectedFunctions;
+                // The collected function and valuation for each placeholder index. Note that references to keys of an unordered map remain valid after insertion.
+                std::vector<FunctionValuation const*> functionValuations;
+                // The placeholders. A deque is used as it does not invalidate references when growing.
+                std::deque<ConstantType> placeholders;
+                // For each variable, the indices of the placeholders whose value depends on the lower (upper) boundary of the variable.
+                std::map<VariableType, std::vector<uint_fast64_t>> placeholdersAtLowerBoundary, placeholdersAtUpperBoundary;
+
+                // The boundaries and direction of the most recent evaluation.
+                boost::optional<storm::solver::OptimizationDirection> lastDirection;
+                storm::utility::parametric::Valuation<ParametricType> lastLowerBoundaries, lastUpperBoundaries;
             };
             
             FunctionValuationCollector functionValuationCollector;
@@ -168,6 +195,9 @@ namespace storm {
             std::vector<ConstantType> vector; //The resulting vector
             std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType&>> vectorAssignment; // Connection of vector entries with placeholders
 
+            // For each placeholder, the indices of the matrix and vector assignments it is connected with. Used to only write changed entries.
+            std::vector<std::vector<uint_fast64_t>> matrixAssignmentsOfPlaceholder, vectorAssignmentsOfPlaceholder;
+
             // Used for monotonicity in sparsedtmcparameterlifter
             std::vector<std::set<VariableType>> occurringVariablesAtState;
             std::map<VariableType, std::set<uint_fast64_t>> occuringStatesAtVariable;
@@ -0,0 +1,136 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        // The number of points that are evaluated together. Chosen such that the intermediate results of typical models fit into the cache.
+        static const uint64_t evaluationBatchSize = 64;
+
+        CompiledRationalFunctions::CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions) {
+            std::map<std::pair<uint64_t, uint64_t>, uint64_t> monomialIndices;
+            std::unordered_map<storm::RawPolynomial, uint64_t> polynomialIndices;
+            auto getPolynomialIndex = [&](storm::RawPolynomial const& polynomial) {
+                auto findRes = polynomialIndices.find(polynomial);
+                if (findRes != polynomialIndices.end()) {
+                    return findRes->second;
+                }
+                uint64_t index = addPolynomial(polynomial, monomialIndices);
+                polynomialIndices.emplace(polynomial, index);
+                return index;
+            };
+
+            polynomialStarts.push_back(0);
+            numerators.reserve(functions.size());
+            denominators.reserve(functions.size());
+            for (auto const& function : functions) {
+                if (function.isConstant()) {
+                    numerators.push_back(getPolynomialIndex(storm::RawPolynomial(function.constantPart())));
+                    denominators.push_back(getPolynomialIndex(storm::RawPolynomial(storm::utility::one<storm::RationalFunctionCoefficient>())));
+                } else {
+                    numerators.push_back(getPolynomialIndex(function.nominator().polynomialWithCoefficient()));
+                    denominators.push_back(getPolynomialIndex(function.denominator().polynomialWithCoefficient()));
+                }
+            }
+            STORM_LOG_DEBUG("Compiled " << functions.size() << " functions into " << (polynomialStarts.size() - 1) << " polynomials with " << termCoefficients.size() << " terms over " << (monomialParents.size() + 1) << " monomials.");
+        }
+
+        uint64_t CompiledRationalFunctions::addPolynomial(storm::RawPolynomial const& polynomial, std::map<std::pair<uint64_t, uint64_t>, uint64_t>& monomialIndices) {
+            for (auto const& term : polynomial) {
+                // Find the monomial by multiplying the variables one by one, starting at the constant monomial
+                uint64_t monomialIndex = 0;
+                if (!term.isConstant()) {
+                    for (auto const& variableWithExponent : term.monomial()->exponents()) {
+                        auto variableIt = std::find(variables.begin(), variables.end(), variableWithExponent.first);
+                        uint64_t variableIndex = std::distance(variables.begin(), variableIt);
+                        if (variableIt == variables.end()) {
+                            variables.push_back(variableWithExponent.first);
+                        }
+                        for (uint64_t exponent = 0; exponent < variableWithExponent.second; ++exponent) {
+                            auto insertionRes = monomialIndices.emplace(std::make_pair(monomialIndex, variableIndex), monomialParents.size() + 1);
+                            if (insertionRes.second) {
+                                monomialParents.push_back(monomialIndex);
+                                monomialVariables.push_back(variableIndex);
+                            }
+                            monomialIndex = insertionRes.first->second;
+                        }
+                    }
+                }
+                termCoefficients.push_back(storm::utility::convertNumber<double>(term.coeff()));
+                termMonomials.push_back(monomialIndex);
+            }
+            polynomialStarts.push_back(termCoefficients.size());
+            return polynomialStarts.size() - 2;
+        }
+
+        uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+            return numerators.size();
+        }
+
+        void CompiledRationalFunctions::evaluate(Valuation const& valuation, std::vector<double>& result) const {
+            evaluate(std::vector<Valuation>({valuation}), result);
+        }
+
+        void CompiledRationalFunctions::evaluate(std::vector<Valuation> const& valuations, std::vector<double>& result) const {
+            result.resize(getNumberOfFunctions() * valuations.size());
+            std::vector<double> monomialValues((monomialParents.size() + 1) * evaluationBatchSize);
+            std::vector<double> polynomialValues((polynomialStarts.size() - 1) * evaluationBatchSize);
+            for (uint64_t firstPoint = 0; firstPoint < valuations.size(); firstPoint += evaluationBatchSize) {
+                evaluateBatch(valuations, firstPoint, std::min<uint64_t>(evaluationBatchSize, valuations.size() - firstPoint), monomialValues, polynomialValues, result, valuations.size());
+            }
+        }
+
+        void CompiledRationalFunctions::evaluateBatch(std::vector<Valuation> const& valuations, uint64_t firstPoint, uint64_t batchSize, std::vector<double>& monomialValues, std::vector<double>& polynomialValues, std::vector<double>& result, uint64_t resultStride) const {
+            // The values of the variables (one block of batchSize values per variable)
+            std::vector<double> variableValues(variables.size() * batchSize);
+            for (uint64_t point = 0; point < batchSize; ++point) {
+                auto const& valuation = valuations[firstPoint + point];
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    auto valuationIt = valuation.find(variables[variableIndex]);
+                    STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException, "No value given for parameter " << variables[variableIndex] << ".");
+                    variableValues[variableIndex * batchSize + point] = storm::utility::convertNumber<double>(valuationIt->second);
+                }
+            }
+
+            // Monomials
+            std::fill(monomialValues.begin(), monomialValues.begin() + batchSize, 1.0);
+            for (uint64_t monomial = 1; monomial <= monomialParents.size(); ++monomial) {
+                double* target = monomialValues.data() + monomial * batchSize;
+                double const* parent = monomialValues.data() + monomialParents[monomial - 1] * batchSize;
+                double const* variable = variableValues.data() + monomialVariables[monomial - 1] * batchSize;
+                for (uint64_t point = 0; point < batchSize; ++point) {
+                    target[point] = parent[point] * variable[point];
+                }
+            }
+
+            // Polynomials
+            for (uint64_t polynomial = 0; polynomial + 1 < polynomialStarts.size(); ++polynomial) {
+                double* target = polynomialValues.data() + polynomial * batchSize;
+                std::fill(target, target + batchSize, 0.0);
+                for (uint64_t term = polynomialStarts[polynomial]; term < polynomialStarts[polynomial + 1]; ++term) {
+                    double const coefficient = termCoefficients[term];
+                    double const* monomial = monomialValues.data() + termMonomials[term] * batchSize;
+                    for (uint64_t point = 0; point < batchSize; ++point) {
+                        target[point] += coefficient * monomial[point];
+                    }
+                }
+            }
+
+            // Functions
+            for (uint64_t function = 0; function < numerators.size(); ++function) {
+                double* target = result.data() + function * resultStride + firstPoint;
+                double const* numerator = polynomialValues.data() + numerators[function] * batchSize;
+                double const* denominator = polynomialValues.data() + denominators[function] * batchSize;
+                for (uint64_t point = 0; point < batchSize; ++point) {
+                    target[point] = numerator[point] / denominator[point];
+                }
+            }
+        }
+    }
+}
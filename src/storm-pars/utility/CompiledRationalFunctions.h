@@ -0,0 +1,75 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Compiles a collection of rational functions into a flat program that evaluates all of them in floating point arithmetic.
+         * Monomials are shared among all functions and every monomial is obtained from a previously computed one by a single multiplication.
+         * Identical numerator and denominator polynomials are only evaluated once.
+         * When evaluating a batch of parameter points, the innermost loops run over the points such that the compiler can vectorize them.
+         *
+         * @note In contrast to storm::utility::parametric::evaluate, the evaluation is not exact.
+         */
+        class CompiledRationalFunctions {
+        public:
+            typedef storm::utility::parametric::Valuation<storm::RationalFunction> Valuation;
+
+            /*!
+             * Compiles the given functions.
+             */
+            CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions);
+
+            /*!
+             * Retrieves the number of compiled functions.
+             */
+            uint64_t getNumberOfFunctions() const;
+
+            /*!
+             * Evaluates all functions at the given point.
+             * @param result the i-th entry is set to the value of the i-th function
+             */
+            void evaluate(Valuation const& valuation, std::vector<double>& result) const;
+
+            /*!
+             * Evaluates all functions at each of the given points.
+             * @param result the value of the i-th function at the j-th point is written to result[i * valuations.size() + j]
+             */
+            void evaluate(std::vector<Valuation> const& valuations, std::vector<double>& result) const;
+
+        private:
+            /*!
+             * Appends the terms of the given polynomial to the program and returns the index of the polynomial.
+             * @param monomialIndices maps (parent monomial, variable) to the index of the product monomial. New monomials are inserted.
+             */
+            uint64_t addPolynomial(storm::RawPolynomial const& polynomial, std::map<std::pair<uint64_t, uint64_t>, uint64_t>& monomialIndices);
+
+            /*!
+             * Evaluates the program for the points in [firstPoint, firstPoint + batchSize) and writes the results for the i-th function to result[i * resultStride + firstPoint + j].
+             * The given buffers are used to store intermediate results.
+             */
+            void evaluateBatch(std::vector<Valuation> const& valuations, uint64_t firstPoint, uint64_t batchSize, std::vector<double>& monomialValues, std::vector<double>& polynomialValues, std::vector<double>& result, uint64_t resultStride) const;
+
+            // The occurring variables. Variables are referred to by their index in this vector.
+            std::vector<storm::RationalFunctionVariable> variables;
+
+            // Monomial 0 is the constant one. Every other monomial i is the product of monomial monomialParents[i-1] and variable monomialVariables[i-1].
+            std::vector<uint64_t> monomialParents;
+            std::vector<uint64_t> monomialVariables;
+
+            // The terms of polynomial p are the ones in [polynomialStarts[p], polynomialStarts[p+1]).
+            std::vector<uint64_t> polynomialStarts;
+            std::vector<double> termCoefficients;
+            std::vector<uint64_t> termMonomials;
+
+            // For each function, the indices of the numerator and denominator polynomial.
+            std::vector<uint64_t> numerators;
+            std::vector<uint64_t> denominators;
+        };
+    }
+}
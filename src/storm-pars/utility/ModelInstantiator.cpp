@@ -140,14 +140,38 @@ namespace storm {
                 instantiate_helper(valuation);
                 
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
+                applyMappings();
+                
+                return *this->instantiatedModel;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            std::vector<std::vector<typename ConstantSparseModelType::ValueType>> ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateTransitionMatrixValues(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+                std::vector<std::vector<ConstantType>> result;
+                result.reserve(valuations.size());
+                instantiateTransitionMatrixValues_helper(valuations, result);
+                return result;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::applyMappings() {
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
                 }
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
-                
-                return *this->instantiatedModel;
+            }
+
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            std::vector<typename ConstantSparseModelType::ValueType> ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getTransitionMatrixValues() const {
+                std::vector<ConstantType> result;
+                auto const& matrix = this->instantiatedModel->getTransitionMatrix();
+                result.reserve(matrix.getEntryCount());
+                for (auto const& entry : matrix) {
+                    result.push_back(entry.getValue());
+                }
+                return result;
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
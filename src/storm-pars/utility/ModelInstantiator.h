@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -47,6 +48,17 @@ namespace storm {
                  * @return The instantiated model
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
+
+                /*!
+                 * Evaluates the occurring parametric functions for each of the given valuations.
+                 * All instantiations share the structure of the model returned by instantiate, i.e., only the values of the transition matrix differ.
+                 * For floating point models, the functions are compiled once and then evaluated for all valuations in one (vectorized) pass.
+                 * In contrast to instantiate, this evaluation is then subject to rounding errors.
+                 *
+                 * @param valuations The valuations, each mapping the occurring variables to the value with which they should be substituted
+                 * @return For each valuation, the values of the transition matrix entries (in the order of the entries of the instantiated transition matrix)
+                 */
+                std::vector<std::vector<ConstantType>> instantiateTransitionMatrixValues(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
                 
                 /*!
                  *  Check validity
@@ -140,6 +152,52 @@ namespace storm {
                     }
                 }
 
+                template<typename CT = ConstantType>
+                typename std::enable_if<
+                        !std::is_same<CT,double>::value
+                >::type
+                instantiateTransitionMatrixValues_helper(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::vector<std::vector<ConstantType>>& result) {
+                    for (auto const& valuation : valuations) {
+                        instantiate_helper(valuation);
+                        applyMappings();
+                        result.push_back(getTransitionMatrixValues());
+                    }
+                }
+
+                template<typename CT = ConstantType>
+                typename std::enable_if<
+                        std::is_same<CT,double>::value
+                >::type
+                instantiateTransitionMatrixValues_helper(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::vector<std::vector<ConstantType>>& result) {
+                    if (!this->compiledFunctions) {
+                        std::vector<ParametricType> functionVector;
+                        for (auto& functionResult : this->functions) {
+                            functionVector.push_back(functionResult.first);
+                            this->compiledFunctionPlaceholders.push_back(&functionResult.second);
+                        }
+                        this->compiledFunctions = std::make_unique<storm::utility::CompiledRationalFunctions>(functionVector);
+                    }
+                    std::vector<double> functionValues;
+                    this->compiledFunctions->evaluate(valuations, functionValues);
+                    for (uint_fast64_t point = 0; point < valuations.size(); ++point) {
+                        for (uint_fast64_t function = 0; function < this->compiledFunctionPlaceholders.size(); ++function) {
+                            *this->compiledFunctionPlaceholders[function] = functionValues[function * valuations.size() + point];
+                        }
+                        applyMappings();
+                        result.push_back(getTransitionMatrixValues());
+                    }
+                }
+
+                /*!
+                 * Writes the values of the placeholders to the matrices and vectors according to the stored mappings
+                 */
+                void applyMappings();
+
+                /*!
+                 * Retrieves the values of the transition matrix entries of the instantiated model.
+                 */
+                std::vector<ConstantType> getTransitionMatrixValues() const;
+
                 /*!
                  * Creates a matrix that has entries at the same position as the given matrix.
                  * The returned matrix is a stochastic matrix, i.e., the rows sum up to one.
@@ -189,6 +247,10 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The occurring functions compiled for a fast (floating point) evaluation of many valuations. Only initialized on demand.
+                std::unique_ptr<storm::utility::CompiledRationalFunctions> compiledFunctions;
+                /// The placeholders of the compiled functions (in the order of the compiled functions)
+                std::vector<ConstantType*> compiledFunctionPlaceholders;
                 
                 
             };
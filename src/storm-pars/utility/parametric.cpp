@@ -1,3 +1,4 @@
+#include <mutex>
 #include <string>
 
 #include "storm-pars/utility/parametric.h"
@@ -17,13 +18,22 @@ namespace storm {
         namespace parametric {
             
 #ifdef STORM_HAVE_CARL
+            // Rational functions share their polynomials (and the polynomial cache) between copies, so concurrent evaluations
+            // (e.g. by the workers of a concurrent region refinement) are serialized.
+            static std::mutex& getEvaluationMutex() {
+                static std::mutex evaluationMutex;
+                return evaluationMutex;
+            }
+
             template<>
             typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function, Valuation<storm::RationalFunction> const& valuation){
+                std::lock_guard<std::mutex> lock(getEvaluationMutex());
                 return function.evaluate(valuation);
             }
 
             template<>
             typename storm::RationalFunction substitute<storm::RationalFunction>(storm::RationalFunction const& function, Valuation<storm::RationalFunction> const& valuation){
+                std::lock_guard<std::mutex> lock(getEvaluationMutex());
                 return function.substitute(valuation);
             }
 
@@ -0,0 +1,316 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+
+using namespace storm::exporter::binary;
+
+/*!
+ * Reads words, strings and arrays from (a part of) a mapped file.
+ */
+class BinaryReader {
+   public:
+    BinaryReader(char const* begin, char const* end) : current(begin), end(end) {
+        // Intentionally left empty.
+    }
+
+    uint64_t readWord() {
+        uint64_t result;
+        std::memcpy(&result, advance(sizeof(result)), sizeof(result));
+        return result;
+    }
+
+    std::string readString() {
+        uint64_t length = readWord();
+        char const* data = advance(padToWord(length));
+        return std::string(data, length);
+    }
+
+    /*!
+     * Retrieves a pointer to the elements of the next array (without copying them).
+     */
+    template<typename T>
+    T const* readArrayData(uint64_t& numberOfElements) {
+        numberOfElements = readWord();
+        STORM_LOG_THROW(numberOfElements <= getRemainingBytes() / sizeof(T), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file.");
+        return reinterpret_cast<T const*>(advance(padToWord(numberOfElements * sizeof(T))));
+    }
+
+    template<typename T>
+    std::vector<T> readArray() {
+        uint64_t numberOfElements;
+        T const* data = readArrayData<T>(numberOfElements);
+        return std::vector<T>(data, data + numberOfElements);
+    }
+
+    storm::storage::BitVector readBitVector() {
+        uint64_t length = readWord();
+        uint64_t numberOfWords = (length + 63) / 64;
+        STORM_LOG_THROW(numberOfWords <= getRemainingBytes() / sizeof(uint64_t), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file.");
+        return storm::storage::BitVector::fromWords(length, reinterpret_cast<uint64_t const*>(advance(numberOfWords * sizeof(uint64_t))));
+    }
+
+    char const* advance(uint64_t numberOfBytes) {
+        STORM_LOG_THROW(numberOfBytes <= getRemainingBytes(), storm::exceptions::WrongFormatException, "Unexpected end of binary model file.");
+        char const* result = current;
+        current += numberOfBytes;
+        return result;
+    }
+
+    uint64_t getRemainingBytes() const {
+        return end - current;
+    }
+
+    bool isAtEnd() const {
+        return current == end;
+    }
+
+   private:
+    char const* current;
+    char const* end;
+};
+
+storm::storage::SparseMatrix<double> readMatrix(BinaryReader& reader) {
+    typedef storm::storage::SparseMatrix<double>::index_type index_type;
+    static_assert(sizeof(index_type) == sizeof(uint64_t), "Matrix indices are expected to be words.");
+
+    uint64_t columnCount = reader.readWord();
+    std::vector<index_type> rowIndications = reader.readArray<index_type>();
+    uint64_t numberOfColumns, numberOfValues;
+    index_type const* columns = reader.readArrayData<index_type>(numberOfColumns);
+    double const* values = reader.readArrayData<double>(numberOfValues);
+    std::vector<index_type> rowGroupIndices = reader.readArray<index_type>();
+
+    STORM_LOG_THROW(!rowIndications.empty() && numberOfColumns == numberOfValues && rowIndications.back() == numberOfColumns,
+                    storm::exceptions::WrongFormatException, "Inconsistent matrix in binary model file.");
+    std::vector<storm::storage::MatrixEntry<index_type, double>> columnsAndValues;
+    columnsAndValues.reserve(numberOfColumns);
+    for (uint64_t entry = 0; entry < numberOfColumns; ++entry) {
+        columnsAndValues.emplace_back(columns[entry], values[entry]);
+    }
+
+    boost::optional<std::vector<index_type>> optionalRowGroupIndices;
+    if (!rowGroupIndices.empty()) {
+        optionalRowGroupIndices = std::move(rowGroupIndices);
+    }
+    return storm::storage::SparseMatrix<double>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(optionalRowGroupIndices));
+}
+
+template<typename LabelingType>
+LabelingType readLabeling(BinaryReader& reader, uint64_t numberOfItems) {
+    LabelingType labeling(numberOfItems);
+    uint64_t numberOfLabels = reader.readWord();
+    for (uint64_t label = 0; label < numberOfLabels; ++label) {
+        std::string name = reader.readString();
+        storm::storage::BitVector items = reader.readBitVector();
+        STORM_LOG_THROW(items.size() == numberOfItems, storm::exceptions::WrongFormatException, "Unexpected size of label '" << name << "'.");
+        labeling.addLabel(name, std::move(items));
+    }
+    return labeling;
+}
+
+std::pair<std::string, storm::models::sparse::StandardRewardModel<double>> readRewardModel(BinaryReader& reader) {
+    std::string name = reader.readString();
+    uint64_t flags = reader.readWord();
+    boost::optional<std::vector<double>> stateRewards, stateActionRewards;
+    boost::optional<storm::storage::SparseMatrix<double>> transitionRewards;
+    if (flags & HasStateRewards) {
+        stateRewards = reader.readArray<double>();
+    }
+    if (flags & HasStateActionRewards) {
+        stateActionRewards = reader.readArray<double>();
+    }
+    if (flags & HasTransitionRewards) {
+        transitionRewards = readMatrix(reader);
+    }
+    return std::make_pair(std::move(name), storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                              std::move(transitionRewards)));
+}
+
+storm::storage::sparse::StateValuations readStateValuations(BinaryReader& reader, uint64_t numberOfStates, storm::expressions::ExpressionManager& manager) {
+    storm::storage::BitVector statesWithValuation = reader.readBitVector();
+    STORM_LOG_THROW(statesWithValuation.size() == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected size of state valuations.");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    std::vector<VariableTypeTag> variableTypes;
+    uint64_t numberOfVariables = reader.readWord();
+    for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+        std::string name = reader.readString();
+        VariableTypeTag type = static_cast<VariableTypeTag>(reader.readWord());
+        storm::expressions::Variable variable;
+        if (manager.hasVariable(name)) {
+            variable = manager.getVariable(name);
+        } else if (type == VariableTypeTag::Boolean) {
+            variable = manager.declareBooleanVariable(name);
+        } else if (type == VariableTypeTag::Integer) {
+            variable = manager.declareIntegerVariable(name);
+        } else {
+            STORM_LOG_THROW(type == VariableTypeTag::Rational, storm::exceptions::WrongFormatException, "Unknown type of variable '" << name << "'.");
+            variable = manager.declareRationalVariable(name);
+        }
+        STORM_LOG_THROW((type == VariableTypeTag::Boolean && variable.hasBooleanType()) || (type == VariableTypeTag::Integer && variable.hasIntegerType()) ||
+                            (type == VariableTypeTag::Rational && variable.hasRationalType()),
+                        storm::exceptions::WrongFormatException, "The type of variable '" << name << "' does not match the expression manager.");
+        builder.addVariable(variable);
+        variableTypes.push_back(type);
+    }
+    uint64_t numberOfLabels = reader.readWord();
+    for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+        builder.addObservationLabel(reader.readString());
+    }
+
+    std::vector<storm::storage::BitVector> booleanColumns;
+    std::vector<int64_t const*> integerColumns;
+    std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+    for (auto type : variableTypes) {
+        if (type == VariableTypeTag::Boolean) {
+            booleanColumns.push_back(reader.readBitVector());
+            STORM_LOG_THROW(booleanColumns.back().size() == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected size of state valuations.");
+        } else if (type == VariableTypeTag::Integer) {
+            uint64_t numberOfValues;
+            integerColumns.push_back(reader.readArrayData<int64_t>(numberOfValues));
+            STORM_LOG_THROW(numberOfValues == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected size of state valuations.");
+        } else {
+            STORM_LOG_THROW(reader.readWord() == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected size of state valuations.");
+            rationalColumns.emplace_back();
+            rationalColumns.back().reserve(numberOfStates);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                std::string value = reader.readString();
+                rationalColumns.back().push_back(value.empty() ? storm::utility::zero<storm::RationalNumber>()
+                                                               : storm::utility::convertNumber<storm::RationalNumber>(value));
+            }
+        }
+    }
+    std::vector<int64_t const*> labelColumns;
+    for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+        uint64_t numberOfValues;
+        labelColumns.push_back(reader.readArrayData<int64_t>(numberOfValues));
+        STORM_LOG_THROW(numberOfValues == numberOfStates, storm::exceptions::WrongFormatException, "Unexpected size of state valuations.");
+    }
+
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (!statesWithValuation.get(state)) {
+            builder.addState(state);
+            continue;
+        }
+        std::vector<bool> booleanValues;
+        for (auto const& column : booleanColumns) {
+            booleanValues.push_back(column.get(state));
+        }
+        std::vector<int64_t> integerValues;
+        for (auto const& column : integerColumns) {
+            integerValues.push_back(column[state]);
+        }
+        std::vector<storm::RationalNumber> rationalValues;
+        for (auto const& column : rationalColumns) {
+            rationalValues.push_back(column[state]);
+        }
+        std::vector<int64_t> labelValues;
+        for (auto const& column : labelColumns) {
+            labelValues.push_back(column[state]);
+        }
+        builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(labelValues));
+    }
+    return builder.build(numberOfStates);
+}
+
+}  // namespace
+
+std::shared_ptr<storm::models::sparse::Model<double>> BinaryModelParser::parseModel(std::string const& filename, BinaryModelParserOptions const& options) {
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile file(filename.c_str());
+    BinaryReader reader(file.getData(), file.getDataEnd());
+
+    // Parse header
+    STORM_LOG_THROW(std::memcmp(reader.advance(sizeof(magic)), magic, sizeof(magic)) == 0, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " does not contain a model in binary direct encoding.");
+    uint64_t version = reader.readWord();
+    STORM_LOG_THROW(version == formatVersion, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " has format version " << version << " but version " << formatVersion << " is expected.");
+    STORM_LOG_THROW(reader.readWord() == byteOrderMark, storm::exceptions::WrongFormatException,
+                    "The file " << filename << " was written on a machine with a different byte order.");
+    STORM_LOG_THROW(reader.readWord() == static_cast<uint64_t>(ValueTypeTag::Double), storm::exceptions::WrongFormatException,
+                    "Unknown value type in file " << filename << ".");
+    storm::models::ModelType type = storm::models::getModelType(reader.readString());
+    uint64_t numberOfStates = reader.readWord();
+    uint64_t numberOfChoices = reader.readWord();
+
+    storm::storage::sparse::ModelComponents<double> components;
+    components.rateTransitions = (type == storm::models::ModelType::Ctmc);
+    bool sawTransitionMatrix = false;
+    bool sawEnd = false;
+    while (!sawEnd) {
+        SectionType sectionType = static_cast<SectionType>(reader.readWord());
+        uint64_t sectionSize = reader.readWord();
+        char const* sectionBegin = reader.advance(sectionSize);
+        BinaryReader sectionReader(sectionBegin, sectionBegin + sectionSize);
+        switch (sectionType) {
+            case SectionType::End:
+                sawEnd = true;
+                break;
+            case SectionType::TransitionMatrix:
+                components.transitionMatrix = readMatrix(sectionReader);
+                STORM_LOG_THROW(components.transitionMatrix.getRowGroupCount() == numberOfStates &&
+                                    components.transitionMatrix.getRowCount() == numberOfChoices,
+                                storm::exceptions::WrongFormatException, "The size of the transition matrix does not match the header.");
+                sawTransitionMatrix = true;
+                break;
+            case SectionType::StateLabeling:
+                components.stateLabeling = readLabeling<storm::models::sparse::StateLabeling>(sectionReader, numberOfStates);
+                break;
+            case SectionType::ChoiceLabeling:
+                components.choiceLabeling = readLabeling<storm::models::sparse::ChoiceLabeling>(sectionReader, numberOfChoices);
+                break;
+            case SectionType::RewardModel:
+                components.rewardModels.insert(readRewardModel(sectionReader));
+                break;
+            case SectionType::ExitRates:
+                components.exitRates = sectionReader.readArray<double>();
+                break;
+            case SectionType::MarkovianStates:
+                components.markovianStates = sectionReader.readBitVector();
+                break;
+            case SectionType::Observations:
+                components.observabilityClasses = sectionReader.readArray<uint32_t>();
+                break;
+            case SectionType::StateValuations:
+                if (options.expressionManager) {
+                    components.stateValuations = readStateValuations(sectionReader, numberOfStates, *options.expressionManager);
+                } else {
+                    STORM_LOG_INFO("Skipping the state valuations as no expression manager was given.");
+                    continue;
+                }
+                break;
+            default:
+                STORM_LOG_WARN("Skipping unknown section of type " << static_cast<uint64_t>(sectionType) << " in file " << filename << ".");
+                continue;
+        }
+        STORM_LOG_THROW(sectionReader.isAtEnd(), storm::exceptions::WrongFormatException, "Inconsistent section size in file " << filename << ".");
+    }
+    STORM_LOG_THROW(sawTransitionMatrix, storm::exceptions::WrongFormatException, "The file " << filename << " does not contain a transition matrix.");
+
+    // Build model
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+}  // namespace parser
+}  // namespace storm
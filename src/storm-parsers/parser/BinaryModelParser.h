@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace expressions {
+class ExpressionManager;
+}
+
+namespace parser {
+
+struct BinaryModelParserOptions {
+    /*!
+     * The expression manager in which the variables of the state valuations are declared (or looked up, if the manager
+     * already has variables with the same names). As the state valuations only refer to the manager, it needs to outlive
+     * the model. If no manager is given, state valuations stored in the file are not loaded.
+     */
+    std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
+};
+
+/*!
+ * Parser for models in the binary direct encoding (drb) as written by explicitExportSparseModelBinary.
+ *
+ * The file is mapped to memory and the arrays of the model are taken from the mapping as they are. Hence, loading a
+ * model essentially costs reading the file once (page faults) and copying the arrays into the model.
+ */
+class BinaryModelParser {
+   public:
+    /*!
+     * Load a model in binary direct encoding from a file and create the model.
+     *
+     * @param filename The file to be loaded.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<double>> parseModel(std::string const& filename,
+                                                                            BinaryModelParserOptions const& options = BinaryModelParserOptions());
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -1,11 +1,13 @@
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
@@ -15,6 +17,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
@@ -47,6 +50,22 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
+    uint_fast64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads > 1) {
+        // Skip the format hint if it is there.
+        buf = trimWhitespaces(buf);
+        if (buf[0] < '0' || buf[0] > '9') {
+            buf = forwardToLineEnd(buf);
+        }
+        storm::storage::SparseMatrix<ValueType> result =
+            parseInParallel(buf, file.getDataEnd(), isRewardFile, transitionMatrix.getRowCount(), numberOfThreads);
+        if (isRewardFile && !result.isSubmatrixOf(transitionMatrix)) {
+            STORM_LOG_ERROR("There are rewards for non existent transitions given in the reward file.");
+            throw storm::exceptions::WrongFormatException() << "There are rewards for non existent transitions given in the reward file.";
+        }
+        return result;
+    }
+
     // Perform first pass, i.e. count entries that are not zero.
     DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass =
         DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
@@ -168,6 +187,170 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     return result;
 }
 
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<ValueType>::parseInParallel(char const* begin, char const* end, bool isRewardFile,
+                                                                                                      uint_fast64_t rowCount,
+                                                                                                      uint_fast64_t numberOfThreads) {
+    // Split the input into chunks that start at the beginning of a line. We use more chunks than threads to balance the load.
+    uint_fast64_t numberOfChunks = numberOfThreads * 8;
+    std::vector<char const*> chunkBegins;
+    chunkBegins.push_back(begin);
+    for (uint_fast64_t chunk = 1; chunk < numberOfChunks; ++chunk) {
+        char const* chunkBegin = begin + static_cast<uint_fast64_t>(end - begin) * chunk / numberOfChunks;
+        chunkBegin = std::max(chunkBegin, chunkBegins.back());
+        while (chunkBegin < end && *chunkBegin != '\n') {
+            ++chunkBegin;
+        }
+        chunkBegins.push_back(std::min(chunkBegin + 1, end));
+    }
+    chunkBegins.push_back(end);
+    numberOfChunks = chunkBegins.size() - 1;
+
+    // The information obtained for each chunk in the first pass.
+    struct ChunkInfo {
+        uint_fast64_t numberOfEntries = 0;
+        // The number of rows without transitions that lie between two rows of this chunk.
+        uint_fast64_t numberOfSkippedRows = 0;
+        uint_fast64_t highestStateIndex = 0;
+        uint_fast64_t firstRow, firstColumn, lastRow, lastColumn;
+    };
+    std::vector<ChunkInfo> chunkInfos(numberOfChunks);
+
+    // First pass: count and check the transitions of each chunk.
+    storm::utility::parallel::forEachChunk(0, numberOfChunks, 1, numberOfThreads, [&](uint64_t, uint64_t chunk, uint64_t) {
+        ChunkInfo& info = chunkInfos[chunk];
+        char const* buf = trimWhitespaces(chunkBegins[chunk]);
+        while (buf < chunkBegins[chunk + 1] && buf[0] != '\0') {
+            uint_fast64_t row = checked_strtol(buf, &buf);
+            uint_fast64_t col = checked_strtol(buf, &buf);
+            // The actual read value is not needed here.
+            checked_strtod(buf, &buf);
+
+            if (info.numberOfEntries == 0) {
+                info.firstRow = row;
+                info.firstColumn = col;
+            } else {
+                STORM_LOG_THROW(row >= info.lastRow, storm::exceptions::InvalidArgumentException,
+                                "Adding an element in row " << row << ", but an element in row " << info.lastRow << " has already been added.");
+                STORM_LOG_THROW(row != info.lastRow || col != info.lastColumn, storm::exceptions::InvalidArgumentException,
+                                "The same transition (" << row << ", " << col << ") is given twice.");
+                if (row > info.lastRow) {
+                    info.numberOfSkippedRows += row - info.lastRow - 1;
+                }
+            }
+            info.highestStateIndex = std::max(info.highestStateIndex, std::max(row, col));
+            info.lastRow = row;
+            info.lastColumn = col;
+            ++info.numberOfEntries;
+            buf = trimWhitespaces(buf);
+        }
+    });
+
+    // Combine the information of the chunks: check the chunk boundaries and determine where the entries of each chunk are placed.
+    uint_fast64_t highestStateIndex = 0;
+    uint_fast64_t numberOfDeadlockStates = 0;
+    std::vector<uint_fast64_t> chunkOffsets(numberOfChunks);
+    // For each chunk, the first row that starts within the chunk and the number of rows without transitions before its first row.
+    std::vector<uint_fast64_t> firstRowStartingInChunk(numberOfChunks, 0);
+    std::vector<uint_fast64_t> skippedRowsBeforeChunk(numberOfChunks, 0);
+    uint_fast64_t numberOfEntries = 0;
+    ChunkInfo const* previousInfo = nullptr;
+    for (uint_fast64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+        ChunkInfo const& info = chunkInfos[chunk];
+        chunkOffsets[chunk] = numberOfEntries;
+        if (info.numberOfEntries == 0) {
+            continue;
+        }
+        if (previousInfo == nullptr) {
+            skippedRowsBeforeChunk[chunk] = info.firstRow;
+        } else {
+            firstRowStartingInChunk[chunk] = previousInfo->lastRow + 1;
+            STORM_LOG_THROW(info.firstRow >= previousInfo->lastRow, storm::exceptions::InvalidArgumentException,
+                            "Adding an element in row " << info.firstRow << ", but an element in row " << previousInfo->lastRow << " has already been added.");
+            STORM_LOG_THROW(info.firstRow != previousInfo->lastRow || info.firstColumn != previousInfo->lastColumn, storm::exceptions::InvalidArgumentException,
+                            "The same transition (" << info.firstRow << ", " << info.firstColumn << ") is given twice.");
+            if (info.firstRow > previousInfo->lastRow) {
+                skippedRowsBeforeChunk[chunk] = info.firstRow - previousInfo->lastRow - 1;
+            }
+        }
+        numberOfDeadlockStates += skippedRowsBeforeChunk[chunk] + info.numberOfSkippedRows;
+        numberOfEntries += info.numberOfEntries;
+        if (!isRewardFile) {
+            // A self-loop is inserted for each skipped row.
+            numberOfEntries += skippedRowsBeforeChunk[chunk] + info.numberOfSkippedRows;
+        }
+        highestStateIndex = std::max(highestStateIndex, info.highestStateIndex);
+        previousInfo = &info;
+    }
+
+    // If there are no transitions, the file format was wrong.
+    if (previousInfo == nullptr) {
+        STORM_LOG_ERROR("Error while parsing: empty or erroneous file format.");
+        throw storm::exceptions::WrongFormatException();
+    }
+
+    if (isRewardFile) {
+        // The reward matrix should match the size of the transition matrix.
+        if (highestStateIndex + 1 > rowCount) {
+            STORM_LOG_ERROR("Reward matrix has more rows or columns than transition matrix.");
+            throw storm::exceptions::WrongFormatException() << "Reward matrix has more rows or columns than transition matrix.";
+        }
+    } else {
+        rowCount = highestStateIndex + 1;
+        if (numberOfDeadlockStates > 0) {
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet()) {
+                STORM_LOG_ERROR("Error while parsing: " << numberOfDeadlockStates << " states have no outgoing transitions.");
+                throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
+            }
+            STORM_LOG_WARN("Warning while parsing: " << numberOfDeadlockStates << " states have no outgoing transitions. Self-loops were inserted.");
+        }
+    }
+
+    // Second pass: write the entries of each chunk to their final position. The rows after the last given row do not have entries.
+    std::vector<uint_fast64_t> rowIndications(rowCount + 1, numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(numberOfEntries);
+    storm::utility::parallel::forEachChunk(0, numberOfChunks, 1, numberOfThreads, [&](uint64_t, uint64_t chunk, uint64_t) {
+        if (chunkInfos[chunk].numberOfEntries == 0) {
+            return;
+        }
+        uint_fast64_t position = chunkOffsets[chunk];
+        uint_fast64_t nextRow = firstRowStartingInChunk[chunk];
+        char const* buf = trimWhitespaces(chunkBegins[chunk]);
+        while (buf < chunkBegins[chunk + 1] && buf[0] != '\0') {
+            uint_fast64_t row = checked_strtol(buf, &buf);
+            uint_fast64_t col = checked_strtol(buf, &buf);
+            double val = checked_strtod(buf, &buf);
+
+            // Start the new rows. Rows without transitions get a self-loop (unless we are parsing rewards).
+            for (; nextRow <= row; ++nextRow) {
+                rowIndications[nextRow] = position;
+                if (nextRow < row && !isRewardFile) {
+                    columnsAndValues[position] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(nextRow, storm::utility::one<ValueType>());
+                    ++position;
+                }
+            }
+            columnsAndValues[position] = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(col, ValueType(val));
+            ++position;
+            buf = trimWhitespaces(buf);
+        }
+    });
+
+    // The entries of a row need to be sorted by their column.
+    storm::utility::parallel::forEachChunk(0, rowCount, 1024, numberOfThreads, [&](uint64_t, uint64_t firstRow, uint64_t lastRow) {
+        for (uint_fast64_t row = firstRow; row < lastRow; ++row) {
+            auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+            auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+            auto compareColumns = [](storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& lhs,
+                                     storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& rhs) { return lhs.getColumn() < rhs.getColumn(); };
+            if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+                std::sort(rowBegin, rowEnd, compareColumns);
+            }
+        }
+    });
+
+    return storm::storage::SparseMatrix<ValueType>(rowCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+}
+
 template<typename ValueType>
 typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(
     char const* buf, bool reserveDiagonalElements) {
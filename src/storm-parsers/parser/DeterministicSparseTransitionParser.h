@@ -71,6 +71,21 @@ class DeterministicSparseTransitionParser {
      */
     static FirstPassResult firstPass(char const* buffer, bool reserveDiagonalElements);
 
+    /*
+     * Parses the transitions given in the buffer (without format hint) on several threads. The buffer is split into chunks at line boundaries.
+     * In a first parallel pass, the transitions of each chunk are counted and checked. In a second parallel pass, each chunk writes its
+     * transitions directly to their final position in the matrix.
+     *
+     * @param begin The first character of the transitions.
+     * @param end The position after the last character of the transitions.
+     * @param isRewardFile A flag set iff the transitions are transition rewards.
+     * @param rowCount The number of rows of the transition matrix (this is only meaningful if isRewardFile is set to true).
+     * @param numberOfThreads The number of threads to use.
+     * @return A SparseMatrix containing the parsed transitions.
+     */
+    static storm::storage::SparseMatrix<ValueType> parseInParallel(char const* begin, char const* end, bool isRewardFile, uint_fast64_t rowCount,
+                                                                   uint_fast64_t numberOfThreads);
+
     /*
      * The main parsing routine.
      * Opens the given file, calls the first pass and performs the second pass, parsing the content of the file into a SparseMatrix.
@@ -18,6 +18,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include "storm/io/CompressedFile.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -35,8 +36,9 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     std::string const& filename, DirectEncodingParserOptions const& options) {
     // Load file
     STORM_LOG_INFO("Reading from file " << filename);
-    std::ifstream file;
-    storm::utility::openFile(filename, file);
+    // Compressed files are decompressed on the fly.
+    std::unique_ptr<std::istream> input = storm::utility::openInputFile(filename);
+    std::istream& file = *input;
     std::string line;
 
     // Initialize
@@ -125,7 +127,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         }
     }
     // Done parsing
-    storm::utility::closeFile(file);
+    input.reset();
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
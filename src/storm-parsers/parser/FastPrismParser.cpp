@@ -0,0 +1,1341 @@
+#include "storm-parsers/parser/FastPrismParser.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+namespace words {
+// The words with a special meaning. They are interned before all other identifiers, so their index is known in advance.
+// The words up to NumberOfKeywords are keywords that can not be used as identifiers.
+enum : uint32_t {
+    Dtmc,
+    Ctmc,
+    Mdp,
+    Ctmdp,
+    Ma,
+    Pomdp,
+    Pta,
+    Smg,
+    Const,
+    Int,
+    Bool,
+    Module,
+    EndModule,
+    Rewards,
+    EndRewards,
+    True,
+    False,
+    Min,
+    Max,
+    Floor,
+    Ceil,
+    Init,
+    AtLeastOneOf,
+    AtMostOneOf,
+    ExactlyOneOf,
+    EndInit,
+    Invariant,
+    EndInvariant,
+    Player,
+    EndPlayer,
+    NumberOfKeywords,
+    Double = NumberOfKeywords,
+    Clock,
+    Global,
+    Formula,
+    Label,
+    Observable,
+    Observables,
+    EndObservables,
+    System,
+    EndSystem,
+    Round,
+    Pow,
+    Mod,
+    Func,
+    NumberOfWords
+};
+
+char const* const names[] = {"dtmc", "ctmc", "mdp", "ctmdp", "ma", "pomdp", "pta", "smg", "const", "int", "bool", "module", "endmodule", "rewards",
+                             "endrewards", "true", "false", "min", "max", "floor", "ceil", "init", "atLeastOneOf", "atMostOneOf", "exactlyOneOf",
+                             "endinit", "invariant", "endinvariant", "player", "endplayer", "double", "clock", "global", "formula", "label",
+                             "observable", "observables", "endobservables", "system", "endsystem", "round", "pow", "mod", "func"};
+}  // namespace words
+
+// The number of commands that are parsed by a thread at once.
+uint64_t const commandChunkSize = 64;
+}  // namespace
+
+boost::optional<storm::prism::Program> FastPrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
+    FastPrismParser parser(input, filename, prismCompatibility);
+    try {
+        parser.parse();
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_DEBUG("Unable to parse PRISM input with the fast parser: " << e.what());
+        return boost::none;
+    }
+    return parser.createProgram();
+}
+
+FastPrismParser::FastPrismParser(std::string const& input, std::string const& filename, bool prismCompatibility)
+    : input(input),
+      filename(filename),
+      prismCompatibility(prismCompatibility),
+      manager(new storm::expressions::ExpressionManager()),
+      cursor(0),
+      modelType(storm::prism::Program::ModelType::UNDEFINED),
+      currentCommandIndex(0),
+      currentUpdateIndex(0) {
+    // Map the empty action to index 0.
+    actionIndices.emplace("", 0);
+}
+
+void FastPrismParser::parse() {
+    tokenize();
+    declareIdentifiers();
+    resolveIdentifiers();
+    createFormulas();
+    parseCommands();
+
+    // Create the elements of the program in the order in which they appear in the input, such that the commands and
+    // updates get the same indices as with the Spirit parser.
+    for (auto const& construct : constructs) {
+        cursor = construct.index;
+        switch (construct.type) {
+            case ConstructType::Constant:
+                constants.push_back(createConstant());
+                break;
+            case ConstructType::GlobalVariable:
+                createGlobalVariable();
+                break;
+            case ConstructType::Module:
+                cursor = modules[construct.index].firstToken;
+                if (modules[construct.index].isRenamed) {
+                    programModules.push_back(createRenamedModule(modules[construct.index]));
+                } else {
+                    programModules.push_back(createModule(modules[construct.index], parsedCommands[construct.index]));
+                }
+                break;
+            case ConstructType::InitialConstruct:
+                initialConstruct = createInitialConstruct();
+                break;
+            case ConstructType::RewardModel:
+                rewardModels.push_back(createRewardModel());
+                break;
+            case ConstructType::Label:
+                labels.push_back(createLabel());
+                break;
+            case ConstructType::ObservationLabel:
+                observationLabels.push_back(createObservationLabel());
+                break;
+        }
+    }
+}
+
+storm::prism::Program FastPrismParser::createProgram() const {
+    return storm::prism::Program(manager, modelType, constants, globalBooleanVariables, globalIntegerVariables, formulas, {}, programModules, actionIndices,
+                                 rewardModels, labels, observationLabels, initialConstruct, boost::none, prismCompatibility, filename, 1, true);
+}
+
+void FastPrismParser::tokenize() {
+    for (uint32_t word = 0; word < words::NumberOfWords; ++word) {
+        intern(words::names[word]);
+    }
+
+    STORM_LOG_THROW(input.size() < std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "The input is too large.");
+    bool hasByteOrderMark = input.size() >= 3 && input[0] == '\xEF' && input[1] == '\xBB' && input[2] == '\xBF';
+    uint32_t const size = input.size();
+    uint32_t position = hasByteOrderMark ? 3 : 0;
+    uint32_t line = 1;
+    auto isDigit = [&](uint32_t index) { return index < size && std::isdigit(static_cast<unsigned char>(input[index])); };
+    auto isIdentifierCharacter = [&](uint32_t index) {
+        return index < size && (std::isalnum(static_cast<unsigned char>(input[index])) || input[index] == '_');
+    };
+    auto next = [&](uint32_t offset) { return position + offset < size ? input[position + offset] : '\0'; };
+
+    while (true) {
+        // Skip whitespaces and comments.
+        while (position < size) {
+            char const c = input[position];
+            if (c == '\n') {
+                ++line;
+                ++position;
+            } else if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+                ++position;
+            } else if (c == '/' && next(1) == '/') {
+                while (position < size && input[position] != '\n') {
+                    ++position;
+                }
+            } else {
+                break;
+            }
+        }
+        if (position == size) {
+            break;
+        }
+
+        Token token{TokenType::End, line, position, 1, 0};
+        char const c = input[position];
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            while (isIdentifierCharacter(position + token.length)) {
+                ++token.length;
+            }
+            token.type = TokenType::Identifier;
+            token.identifier = intern(std::string_view(input.data() + position, token.length));
+        } else if (isDigit(position) || (c == '.' && isDigit(position + 1))) {
+            // As in the Spirit parser, rational literals need a dot (but may omit the integral part).
+            token.type = TokenType::IntegerLiteral;
+            token.length = 0;
+            while (isDigit(position + token.length)) {
+                ++token.length;
+            }
+            if (next(token.length) == '.' && isDigit(position + token.length + 1)) {
+                token.type = TokenType::RationalLiteral;
+                ++token.length;
+                while (isDigit(position + token.length)) {
+                    ++token.length;
+                }
+                char const exponentSign = next(token.length + 1);
+                if ((next(token.length) == 'e' || next(token.length) == 'E') &&
+                    (isDigit(position + token.length + 1) || ((exponentSign == '+' || exponentSign == '-') && isDigit(position + token.length + 2)))) {
+                    token.length += isDigit(position + token.length + 1) ? 1 : 2;
+                    while (isDigit(position + token.length)) {
+                        ++token.length;
+                    }
+                }
+            }
+        } else {
+            switch (c) {
+                case '(':
+                    token.type = TokenType::LeftParenthesis;
+                    break;
+                case ')':
+                    token.type = TokenType::RightParenthesis;
+                    break;
+                case '[':
+                    token.type = TokenType::LeftBracket;
+                    break;
+                case ']':
+                    token.type = TokenType::RightBracket;
+                    break;
+                case ',':
+                    token.type = TokenType::Comma;
+                    break;
+                case ';':
+                    token.type = TokenType::Semicolon;
+                    break;
+                case ':':
+                    token.type = TokenType::Colon;
+                    break;
+                case '?':
+                    token.type = TokenType::QuestionMark;
+                    break;
+                case '"':
+                    token.type = TokenType::Quote;
+                    break;
+                case '\'':
+                    token.type = TokenType::Prime;
+                    break;
+                case '+':
+                    token.type = TokenType::Plus;
+                    break;
+                case '-':
+                    token.type = next(1) == '>' ? TokenType::Arrow : TokenType::Minus;
+                    break;
+                case '*':
+                    token.type = TokenType::Times;
+                    break;
+                case '/':
+                    token.type = TokenType::Divide;
+                    break;
+                case '^':
+                    token.type = TokenType::Power;
+                    break;
+                case '%':
+                    token.type = TokenType::Modulo;
+                    break;
+                case '!':
+                    token.type = next(1) == '=' ? TokenType::NotEqual : TokenType::Not;
+                    break;
+                case '&':
+                    token.type = TokenType::And;
+                    break;
+                case '|':
+                    token.type = TokenType::Or;
+                    break;
+                case '=':
+                    token.type = next(1) == '>' ? TokenType::Implies : TokenType::Equal;
+                    break;
+                case '<':
+                    token.type = next(1) == '=' ? TokenType::LessOrEqual : TokenType::Less;
+                    break;
+                case '>':
+                    token.type = next(1) == '=' ? TokenType::GreaterOrEqual : TokenType::Greater;
+                    break;
+                case '.':
+                    if (next(1) == '.') {
+                        token.type = TokenType::Range;
+                        break;
+                    }
+                    [[fallthrough]];
+                default:
+                    throw storm::exceptions::WrongFormatException() << "Unexpected character '" << c << "' in line " << line << ".";
+            }
+            if (token.type == TokenType::Arrow || token.type == TokenType::NotEqual || token.type == TokenType::Implies ||
+                token.type == TokenType::LessOrEqual || token.type == TokenType::GreaterOrEqual || token.type == TokenType::Range) {
+                token.length = 2;
+            }
+        }
+        tokens.push_back(token);
+        position += token.length;
+    }
+    tokens.push_back(Token{TokenType::End, line, position, 0, 0});
+}
+
+uint32_t FastPrismParser::intern(std::string_view const& identifier) {
+    auto insertionResult = identifierIndices.emplace(identifier, identifiers.size());
+    if (insertionResult.second) {
+        identifiers.emplace_back(identifier);
+    }
+    return insertionResult.first->second;
+}
+
+void FastPrismParser::declareIdentifiers() {
+    static std::map<uint32_t, storm::prism::Program::ModelType> const modelTypes = {
+        {words::Dtmc, storm::prism::Program::ModelType::DTMC}, {words::Ctmc, storm::prism::Program::ModelType::CTMC},
+        {words::Mdp, storm::prism::Program::ModelType::MDP},   {words::Ctmdp, storm::prism::Program::ModelType::CTMDP},
+        {words::Ma, storm::prism::Program::ModelType::MA},     {words::Pomdp, storm::prism::Program::ModelType::POMDP},
+        {words::Pta, storm::prism::Program::ModelType::PTA},   {words::Smg, storm::prism::Program::ModelType::SMG}};
+    auto modelTypeIt = tokens[cursor].type == TokenType::Identifier ? modelTypes.find(tokens[cursor].identifier) : modelTypes.end();
+    if (modelTypeIt == modelTypes.end()) {
+        fail(cursor, "expected model type");
+    }
+    modelType = modelTypeIt->second;
+    ++cursor;
+
+    std::set<std::string> labelNames;
+    std::set<std::string> observationLabelNames;
+    if (isWord(cursor, words::Observables)) {
+        declareObservables();
+    }
+    std::set<std::string> undeclaredObservables = observables;
+    bool hasInitialConstruct = false;
+
+    while (tokens[cursor].type != TokenType::End) {
+        if (isWord(cursor, words::Const)) {
+            constructs.push_back({ConstructType::Constant, cursor});
+            declareConstant();
+        } else if (isWord(cursor, words::Formula)) {
+            declareFormula();
+        } else if (isWord(cursor, words::Global)) {
+            constructs.push_back({ConstructType::GlobalVariable, cursor});
+            ++cursor;
+            std::vector<std::string> globalVariables;
+            declareVariable(&globalVariables, &globalVariables, nullptr);
+        } else if (isWord(cursor, words::Module)) {
+            declareModule();
+        } else if (isWord(cursor, words::Init)) {
+            if (hasInitialConstruct) {
+                fail(cursor, "program must not define two initial constructs");
+            }
+            hasInitialConstruct = true;
+            constructs.push_back({ConstructType::InitialConstruct, cursor});
+            while (!isWord(cursor, words::EndInit)) {
+                cursor = skipUntil(cursor + 1, TokenType::Identifier);
+            }
+            ++cursor;
+        } else if (isWord(cursor, words::Rewards)) {
+            declareRewardModel();
+        } else if (isWord(cursor, words::Label)) {
+            constructs.push_back({ConstructType::Label, cursor});
+            declareLabel(labelNames);
+        } else if (isWord(cursor, words::Observable)) {
+            constructs.push_back({ConstructType::ObservationLabel, cursor});
+            declareLabel(observationLabelNames);
+        } else if (isWord(cursor, words::Player) || isWord(cursor, words::System)) {
+            throw storm::exceptions::NotSupportedException() << "The construct '" << getIdentifier(cursor) << "' is not supported.";
+        } else {
+            fail(cursor, "unexpected token");
+        }
+    }
+
+    // All observables need to be declared as variables.
+    for (auto const& variable : manager->getVariables()) {
+        undeclaredObservables.erase(variable.getName());
+    }
+    if (!undeclaredObservables.empty()) {
+        fail(cursor, "some variables are marked as observable, but never declared");
+    }
+}
+
+void FastPrismParser::declareObservables() {
+    ++cursor;
+    observables.insert(parseIdentifier(cursor));
+    while (tokens[cursor].type == TokenType::Comma) {
+        ++cursor;
+        observables.insert(parseIdentifier(cursor));
+    }
+    expectWord(cursor, words::EndObservables);
+}
+
+void FastPrismParser::declareConstant() {
+    ++cursor;
+    VariableType type = VariableType::Integer;
+    if (isWord(cursor, words::Bool)) {
+        type = VariableType::Boolean;
+        ++cursor;
+    } else if (isWord(cursor, words::Int)) {
+        ++cursor;
+    } else if (isWord(cursor, words::Double)) {
+        type = VariableType::Rational;
+        ++cursor;
+    }
+    declare(parseIdentifier(cursor), type, true);
+    if (tokens[cursor].type == TokenType::Equal) {
+        cursor = skipUntil(cursor, TokenType::Semicolon);
+    }
+    expect(cursor, TokenType::Semicolon);
+}
+
+void FastPrismParser::declareFormula() {
+    ++cursor;
+    uint64_t const namePosition = cursor;
+    std::string name = parseIdentifier(cursor);
+    if (manager->hasVariable(name)) {
+        fail(namePosition, "duplicate identifier");
+    }
+    expect(cursor, TokenType::Equal);
+    formulaDeclarations.emplace_back(std::move(name), cursor);
+    cursor = skipUntil(cursor, TokenType::Semicolon) + 1;
+}
+
+void FastPrismParser::declareVariable(std::vector<std::string>* booleanVariables, std::vector<std::string>* integerVariables,
+                                      std::vector<std::string>* clockVariables) {
+    std::string name = parseIdentifier(cursor);
+    expect(cursor, TokenType::Colon);
+    if (isWord(cursor, words::Bool)) {
+        declare(name, VariableType::Boolean, false);
+        booleanVariables->push_back(std::move(name));
+    } else if (tokens[cursor].type == TokenType::LeftBracket || isWord(cursor, words::Int)) {
+        declare(name, VariableType::Integer, false);
+        integerVariables->push_back(std::move(name));
+    } else if (clockVariables != nullptr && isWord(cursor, words::Clock)) {
+        declare(name, VariableType::Clock, false);
+        clockVariables->push_back(std::move(name));
+    } else {
+        fail(cursor, "expected variable type");
+    }
+    cursor = skipUntil(cursor, TokenType::Semicolon) + 1;
+}
+
+void FastPrismParser::declareModule() {
+    uint64_t const firstToken = cursor;
+    ++cursor;
+    std::string name = parseIdentifier(cursor);
+    if (moduleToIndexMap.count(name) != 0) {
+        fail(firstToken + 1, "duplicate module name");
+    }
+    if (tokens[cursor].type == TokenType::Equal) {
+        declareRenamedModule(name, firstToken);
+        return;
+    }
+
+    ModuleDeclaration module;
+    module.name = std::move(name);
+    module.firstToken = firstToken;
+    module.isRenamed = false;
+    while (isValidIdentifier(cursor) && tokens[cursor + 1].type == TokenType::Colon) {
+        declareVariable(&module.booleanVariables, &module.integerVariables, &module.clockVariables);
+    }
+    if (isWord(cursor, words::Invariant)) {
+        while (!isWord(cursor, words::EndInvariant)) {
+            cursor = skipUntil(cursor + 1, TokenType::Identifier);
+        }
+        ++cursor;
+    }
+    // The commands are only parsed later, but their action names are registered right away (as in the Spirit parser).
+    while (tokens[cursor].type == TokenType::LeftBracket || tokens[cursor].type == TokenType::Less) {
+        module.commandTokens.push_back(cursor);
+        TokenType closingType = tokens[cursor].type == TokenType::LeftBracket ? TokenType::RightBracket : TokenType::Greater;
+        ++cursor;
+        std::string actionName = parseActionName(cursor, closingType);
+        registerAction(actionName);
+        module.commandActionNames.push_back(std::move(actionName));
+        cursor = skipUntil(cursor, TokenType::Semicolon) + 1;
+    }
+    expectWord(cursor, words::EndModule);
+
+    moduleToIndexMap[module.name] = modules.size();
+    constructs.push_back({ConstructType::Module, modules.size()});
+    modules.push_back(std::move(module));
+}
+
+void FastPrismParser::declareRenamedModule(std::string const& moduleName, uint64_t firstToken) {
+    ++cursor;
+    uint64_t const baseModulePosition = cursor;
+    ModuleDeclaration module;
+    module.name = moduleName;
+    module.firstToken = firstToken;
+    module.isRenamed = true;
+    module.baseModule = parseIdentifier(cursor);
+    auto moduleIndexPair = moduleToIndexMap.find(module.baseModule);
+    if (moduleIndexPair == moduleToIndexMap.end() || modules[moduleIndexPair->second].isRenamed) {
+        fail(baseModulePosition, "illegal module to rename");
+    }
+    ModuleDeclaration const& baseModule = modules[moduleIndexPair->second];
+
+    module.renamingLine = tokens[cursor].line;
+    expect(cursor, TokenType::LeftBracket);
+    do {
+        std::string from = parseIdentifier(cursor);
+        expect(cursor, TokenType::Equal);
+        module.renaming.emplace(std::move(from), parseIdentifier(cursor));
+    } while (tokens[cursor].type == TokenType::Comma && ++cursor);
+    expect(cursor, TokenType::RightBracket);
+    expectWord(cursor, words::EndModule);
+
+    // Declare the renamed variables. Note that the Spirit parser declares the variables ordered by their type. The
+    // renamed actions are only registered when the module is created (as in the Spirit parser).
+    auto declareRenamedVariables = [&](std::vector<std::string> const& variables, VariableType type) {
+        for (auto const& variable : variables) {
+            auto renamingPair = module.renaming.find(variable);
+            if (renamingPair == module.renaming.end()) {
+                fail(baseModulePosition, "variable '" + variable + "' was not renamed");
+            }
+            declare(renamingPair->second, type, false);
+        }
+    };
+    declareRenamedVariables(baseModule.booleanVariables, VariableType::Boolean);
+    declareRenamedVariables(baseModule.integerVariables, VariableType::Integer);
+    declareRenamedVariables(baseModule.clockVariables, VariableType::Clock);
+
+    moduleToIndexMap[module.name] = modules.size();
+    constructs.push_back({ConstructType::Module, modules.size()});
+    modules.push_back(std::move(module));
+}
+
+void FastPrismParser::declareRewardModel() {
+    constructs.push_back({ConstructType::RewardModel, cursor});
+    ++cursor;
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+        uint64_t const namePosition = cursor;
+        if (!rewardModelNames.insert(parseIdentifier(cursor)).second) {
+            fail(namePosition, "duplicate reward model name");
+        }
+        expect(cursor, TokenType::Quote);
+    }
+    if (isWord(cursor, words::EndRewards)) {
+        fail(cursor, "expected reward item");
+    }
+    do {
+        cursor = skipUntil(cursor, TokenType::Semicolon) + 1;
+    } while (!isWord(cursor, words::EndRewards));
+    ++cursor;
+}
+
+void FastPrismParser::declareLabel(std::set<std::string>& existingLabels) {
+    ++cursor;
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+    }
+    uint64_t const namePosition = cursor;
+    if (!existingLabels.insert(parseIdentifier(cursor)).second) {
+        fail(namePosition, "duplicate label name");
+    }
+    cursor = skipUntil(cursor, TokenType::Semicolon) + 1;
+}
+
+void FastPrismParser::registerAction(std::string const& actionName) {
+    if (actionIndices.count(actionName) == 0) {
+        std::size_t nextIndex = actionIndices.size();
+        actionIndices.emplace(actionName, nextIndex);
+    }
+}
+
+storm::expressions::Variable FastPrismParser::declare(std::string const& name, VariableType type, bool isConstant) {
+    try {
+        switch (type) {
+            case VariableType::Boolean:
+                return manager->declareBooleanVariable(name, isConstant);
+            case VariableType::Integer:
+                return manager->declareIntegerVariable(name, isConstant);
+            case VariableType::Rational:
+            case VariableType::Clock:
+                return manager->declareRationalVariable(name, isConstant);
+        }
+    } catch (storm::exceptions::InvalidArgumentException const&) {
+        // The identifier was already declared.
+    }
+    throw storm::exceptions::WrongFormatException() << "Illegal identifier '" << name << "'.";
+}
+
+void FastPrismParser::resolveIdentifiers() {
+    identifierExpressions.resize(identifiers.size());
+    identifierVariables.resize(identifiers.size());
+    for (uint32_t identifier = words::NumberOfKeywords; identifier < identifiers.size(); ++identifier) {
+        if (manager->hasVariable(identifiers[identifier])) {
+            identifierVariables[identifier] = manager->getVariable(identifiers[identifier]);
+            identifierExpressions[identifier] = identifierVariables[identifier].getExpression();
+        }
+    }
+}
+
+void FastPrismParser::createFormulas() {
+    // As in the Spirit parser, formulas may refer to formulas that are defined later. We thus repeatedly try to parse
+    // the remaining formulas until no further progress is made. The variables of the formulas are declared in the order
+    // in which the formulas could be parsed.
+    storm::storage::BitVector unprocessed(formulaDeclarations.size(), true);
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (uint64_t formulaIndex : unprocessed) {
+            uint64_t position = formulaDeclarations[formulaIndex].second;
+            storm::expressions::Expression expression;
+            try {
+                expression = parseExpression(position);
+            } catch (storm::exceptions::BaseException const&) {
+                continue;
+            }
+            expect(position, TokenType::Semicolon);
+            progress = true;
+            unprocessed.set(formulaIndex, false);
+
+            std::string const& name = formulaDeclarations[formulaIndex].first;
+            VariableType type = expression.hasIntegerType() ? VariableType::Integer
+                                                             : (expression.hasBooleanType() ? VariableType::Boolean : VariableType::Rational);
+            storm::expressions::Variable variable = declare(name, type, false);
+            uint32_t identifier = identifierIndices.at(name);
+            identifierVariables[identifier] = variable;
+            identifierExpressions[identifier] = variable.getExpression();
+            formulas.emplace_back(variable, expression, filename, tokens[formulaDeclarations[formulaIndex].second].line);
+        }
+    }
+    if (!unprocessed.empty()) {
+        fail(formulaDeclarations[unprocessed.getNextSetIndex(0)].second, "unable to parse formula");
+    }
+}
+
+void FastPrismParser::parseCommands() {
+    // The manager creates the types lazily, so we create them before expressions are built concurrently.
+    manager->getBooleanType();
+    manager->getIntegerType();
+    manager->getRationalType();
+
+    std::vector<std::pair<uint64_t, uint64_t>> commands;
+    parsedCommands.resize(modules.size());
+    for (uint64_t moduleIndex = 0; moduleIndex < modules.size(); ++moduleIndex) {
+        parsedCommands[moduleIndex].resize(modules[moduleIndex].commandTokens.size());
+        for (uint64_t commandIndex = 0; commandIndex < modules[moduleIndex].commandTokens.size(); ++commandIndex) {
+            commands.emplace_back(moduleIndex, commandIndex);
+        }
+    }
+
+    storm::utility::parallel::forEachChunk(0, commands.size(), commandChunkSize, storm::utility::parallel::getDefaultNumberOfThreads(),
+                                           [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                               for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                                                   auto const& command = commands[index];
+                                                   parsedCommands[command.first][command.second] =
+                                                       parseCommand(modules[command.first].commandTokens[command.second]);
+                                               }
+                                           });
+}
+
+storm::prism::Constant FastPrismParser::createConstant() {
+    uint64_t const line = tokens[cursor].line;
+    ++cursor;
+    VariableType type = VariableType::Integer;
+    if (isWord(cursor, words::Bool)) {
+        type = VariableType::Boolean;
+        ++cursor;
+    } else if (isWord(cursor, words::Int)) {
+        ++cursor;
+    } else if (isWord(cursor, words::Double)) {
+        type = VariableType::Rational;
+        ++cursor;
+    }
+    storm::expressions::Variable variable = manager->getVariable(parseIdentifier(cursor));
+    if (tokens[cursor].type == TokenType::Semicolon) {
+        ++cursor;
+        return storm::prism::Constant(variable, filename, line);
+    }
+    expect(cursor, TokenType::Equal);
+    storm::expressions::Expression expression;
+    if (type == VariableType::Boolean) {
+        expression = parseBooleanExpression(cursor);
+    } else if (type == VariableType::Integer) {
+        expression = parseIntegerExpression(cursor);
+    } else {
+        expression = parseNumericalExpression(cursor);
+    }
+    expect(cursor, TokenType::Semicolon);
+    return storm::prism::Constant(variable, expression, filename, line);
+}
+
+void FastPrismParser::createGlobalVariable() {
+    ++cursor;
+    uint64_t const line = tokens[cursor].line;
+    std::string name = parseIdentifier(cursor);
+    expect(cursor, TokenType::Colon);
+    if (isWord(cursor, words::Bool)) {
+        ++cursor;
+        globalBooleanVariables.push_back(createBooleanVariable(name, line, cursor));
+    } else {
+        globalIntegerVariables.push_back(createIntegerVariable(name, line, cursor));
+    }
+}
+
+storm::prism::Module FastPrismParser::createModule(ModuleDeclaration const& module, std::vector<ParsedCommand>& parsedCommands) {
+    uint64_t const line = tokens[cursor].line;
+    cursor += 2;
+
+    std::vector<storm::prism::BooleanVariable> booleanVariables;
+    std::vector<storm::prism::IntegerVariable> integerVariables;
+    std::vector<storm::prism::ClockVariable> clockVariables;
+    while (isValidIdentifier(cursor) && tokens[cursor + 1].type == TokenType::Colon) {
+        uint64_t const variableLine = tokens[cursor].line;
+        std::string name = parseIdentifier(cursor);
+        ++cursor;
+        if (isWord(cursor, words::Bool)) {
+            ++cursor;
+            booleanVariables.push_back(createBooleanVariable(name, variableLine, cursor));
+        } else if (isWord(cursor, words::Clock)) {
+            ++cursor;
+            expect(cursor, TokenType::Semicolon);
+            clockVariables.emplace_back(manager->getVariable(name), observables.count(name) > 0, filename, variableLine);
+        } else {
+            integerVariables.push_back(createIntegerVariable(name, variableLine, cursor));
+        }
+    }
+
+    storm::expressions::Expression invariant;
+    if (isWord(cursor, words::Invariant)) {
+        ++cursor;
+        invariant = parseBooleanExpression(cursor);
+        expectWord(cursor, words::EndInvariant);
+    }
+
+    std::vector<storm::prism::Command> commands;
+    commands.reserve(parsedCommands.size());
+    for (uint64_t commandIndex = 0; commandIndex < parsedCommands.size(); ++commandIndex) {
+        commands.push_back(createCommand(parsedCommands[commandIndex], module.commandActionNames[commandIndex]));
+    }
+    return storm::prism::Module(module.name, booleanVariables, integerVariables, clockVariables, invariant, commands, filename, line);
+}
+
+storm::prism::Module FastPrismParser::createRenamedModule(ModuleDeclaration const& module) {
+    // This mirrors the creation of renamed modules in the Spirit parser.
+    storm::prism::Module const& moduleToRename = programModules[moduleToIndexMap.at(module.baseModule)];
+    auto const& renaming = module.renaming;
+    uint64_t const line = module.renamingLine;
+
+    // Create a mapping from identifiers to the expressions they need to be replaced with.
+    std::map<storm::expressions::Variable, storm::expressions::Expression> expressionRenaming;
+    for (auto const& namePair : renaming) {
+        auto identifierIndexPair = identifierIndices.find(namePair.second);
+        if (identifierIndexPair != identifierIndices.end() && identifierExpressions[identifierIndexPair->second].isInitialized()) {
+            expressionRenaming.emplace(manager->getVariable(namePair.first), identifierExpressions[identifierIndexPair->second]);
+        }
+    }
+
+    std::vector<storm::prism::BooleanVariable> booleanVariables;
+    for (auto const& variable : moduleToRename.getBooleanVariables()) {
+        std::string const& newName = renaming.at(variable.getName());
+        booleanVariables.emplace_back(
+            manager->getVariable(newName),
+            variable.hasInitialValue() ? variable.getInitialValueExpression().substitute(expressionRenaming) : variable.getInitialValueExpression(),
+            observables.count(newName) > 0, filename, line);
+    }
+    std::vector<storm::prism::IntegerVariable> integerVariables;
+    for (auto const& variable : moduleToRename.getIntegerVariables()) {
+        std::string const& newName = renaming.at(variable.getName());
+        integerVariables.emplace_back(
+            manager->getVariable(newName), variable.getLowerBoundExpression().substitute(expressionRenaming),
+            variable.getUpperBoundExpression().substitute(expressionRenaming),
+            variable.hasInitialValue() ? variable.getInitialValueExpression().substitute(expressionRenaming) : variable.getInitialValueExpression(),
+            observables.count(newName) > 0, filename, line);
+    }
+    std::vector<storm::prism::ClockVariable> clockVariables;
+    for (auto const& variable : moduleToRename.getClockVariables()) {
+        std::string const& newName = renaming.at(variable.getName());
+        clockVariables.emplace_back(manager->getVariable(newName), observables.count(newName) > 0, filename, line);
+    }
+
+    storm::expressions::Expression invariant;
+    if (moduleToRename.hasInvariant()) {
+        invariant = moduleToRename.getInvariant().substitute(expressionRenaming);
+    }
+
+    std::vector<storm::prism::Command> commands;
+    for (auto const& command : moduleToRename.getCommands()) {
+        std::vector<storm::prism::Update> updates;
+        for (auto const& update : command.getUpdates()) {
+            std::vector<storm::prism::Assignment> assignments;
+            for (auto const& assignment : update.getAssignments()) {
+                auto const& renamingPair = renaming.find(assignment.getVariableName());
+                assignments.emplace_back(renamingPair != renaming.end() ? manager->getVariable(renamingPair->second) : assignment.getVariable(),
+                                         assignment.getExpression().substitute(expressionRenaming), filename, line);
+            }
+            updates.emplace_back(currentUpdateIndex, update.getLikelihoodExpression().substitute(expressionRenaming), assignments, filename, line);
+            ++currentUpdateIndex;
+        }
+
+        auto const& renamingPair = renaming.find(command.getActionName());
+        std::string const& newActionName = renamingPair != renaming.end() ? renamingPair->second : command.getActionName();
+        registerAction(newActionName);
+        commands.emplace_back(currentCommandIndex, command.isMarkovian(), actionIndices.at(newActionName), newActionName,
+                              command.getGuardExpression().substitute(expressionRenaming), updates, filename, line);
+        ++currentCommandIndex;
+    }
+
+    return storm::prism::Module(module.name, booleanVariables, integerVariables, clockVariables, invariant, commands, module.baseModule, renaming);
+}
+
+storm::prism::InitialConstruct FastPrismParser::createInitialConstruct() {
+    uint64_t const line = tokens[cursor].line;
+    ++cursor;
+    storm::expressions::Expression initialStatesExpression = parseBooleanExpression(cursor);
+    expectWord(cursor, words::EndInit);
+    return storm::prism::InitialConstruct(initialStatesExpression, filename, line);
+}
+
+storm::prism::RewardModel FastPrismParser::createRewardModel() {
+    uint64_t const line = tokens[cursor].line;
+    ++cursor;
+    std::string name;
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+        name = parseIdentifier(cursor);
+        ++cursor;
+    }
+
+    std::vector<storm::prism::StateReward> stateRewards;
+    std::vector<storm::prism::StateActionReward> stateActionRewards;
+    std::vector<storm::prism::TransitionReward> transitionRewards;
+    while (!isWord(cursor, words::EndRewards)) {
+        uint64_t const rewardLine = tokens[cursor].line;
+        if (tokens[cursor].type == TokenType::LeftBracket) {
+            ++cursor;
+            std::string actionName = parseActionName(cursor, TokenType::RightBracket);
+            auto nameIndexPair = actionIndices.find(actionName);
+            if (nameIndexPair == actionIndices.end()) {
+                fail(cursor, "reward refers to illegal action '" + actionName + "'");
+            }
+            storm::expressions::Expression statePredicate = parseBooleanExpression(cursor);
+            if (tokens[cursor].type == TokenType::Arrow) {
+                ++cursor;
+                storm::expressions::Expression targetStatePredicate = parseBooleanExpression(cursor);
+                expect(cursor, TokenType::Colon);
+                storm::expressions::Expression rewardValue = parseNumericalExpression(cursor);
+                transitionRewards.emplace_back(nameIndexPair->second, actionName, statePredicate, targetStatePredicate, rewardValue, filename, rewardLine);
+            } else {
+                expect(cursor, TokenType::Colon);
+                storm::expressions::Expression rewardValue = parseNumericalExpression(cursor);
+                stateActionRewards.emplace_back(nameIndexPair->second, actionName, statePredicate, rewardValue, filename, rewardLine);
+            }
+        } else {
+            storm::expressions::Expression statePredicate = parseBooleanExpression(cursor);
+            expect(cursor, TokenType::Colon);
+            storm::expressions::Expression rewardValue = parseNumericalExpression(cursor);
+            stateRewards.emplace_back(statePredicate, rewardValue, filename, rewardLine);
+        }
+        expect(cursor, TokenType::Semicolon);
+    }
+    return storm::prism::RewardModel(name, stateRewards, stateActionRewards, transitionRewards, filename, line);
+}
+
+storm::prism::Label FastPrismParser::createLabel() {
+    uint64_t const line = tokens[cursor].line;
+    ++cursor;
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+    }
+    std::string name = parseIdentifier(cursor);
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+    }
+    expect(cursor, TokenType::Equal);
+    storm::expressions::Expression statePredicate = parseBooleanExpression(cursor);
+    expect(cursor, TokenType::Semicolon);
+    return storm::prism::Label(name, statePredicate, filename, line);
+}
+
+storm::prism::ObservationLabel FastPrismParser::createObservationLabel() {
+    uint64_t const line = tokens[cursor].line;
+    ++cursor;
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+    }
+    std::string name = parseIdentifier(cursor);
+    if (tokens[cursor].type == TokenType::Quote) {
+        ++cursor;
+    }
+    expect(cursor, TokenType::Equal);
+    uint64_t const expressionPosition = cursor;
+    storm::expressions::Expression expression = parseExpression(cursor);
+    if (!expression.hasIntegerType() && !expression.hasBooleanType()) {
+        fail(expressionPosition, "expected integer or boolean expression");
+    }
+    expect(cursor, TokenType::Semicolon);
+    return storm::prism::ObservationLabel(name, expression, filename, line);
+}
+
+storm::prism::BooleanVariable FastPrismParser::createBooleanVariable(std::string const& name, uint64_t line, uint64_t& position) const {
+    storm::expressions::Expression initialValue;
+    if (isWord(position, words::Init)) {
+        ++position;
+        initialValue = parseBooleanExpression(position);
+    }
+    expect(position, TokenType::Semicolon);
+    return storm::prism::BooleanVariable(manager->getVariable(name), initialValue, observables.count(name) > 0, filename, line);
+}
+
+storm::prism::IntegerVariable FastPrismParser::createIntegerVariable(std::string const& name, uint64_t line, uint64_t& position) const {
+    storm::expressions::Expression lowerBound;
+    storm::expressions::Expression upperBound;
+    if (tokens[position].type == TokenType::LeftBracket) {
+        ++position;
+        lowerBound = parseIntegerExpression(position);
+        expect(position, TokenType::Range);
+        upperBound = parseIntegerExpression(position);
+        expect(position, TokenType::RightBracket);
+    } else {
+        expectWord(position, words::Int);
+    }
+    storm::expressions::Expression initialValue;
+    if (isWord(position, words::Init)) {
+        ++position;
+        initialValue = parseIntegerExpression(position);
+    }
+    expect(position, TokenType::Semicolon);
+    return storm::prism::IntegerVariable(manager->getVariable(name), lowerBound, upperBound, initialValue, observables.count(name) > 0, filename, line);
+}
+
+FastPrismParser::ParsedCommand FastPrismParser::parseCommand(uint64_t position) const {
+    ParsedCommand result;
+    result.line = tokens[position].line;
+    result.markovian = tokens[position].type == TokenType::Less;
+    ++position;
+    parseActionName(position, result.markovian ? TokenType::Greater : TokenType::RightBracket);
+    result.guard = parseExpression(position);
+    expect(position, TokenType::Arrow);
+
+    do {
+        result.updateLines.push_back(tokens[position].line);
+        // An update without likelihood starts with an assignment or with 'true'.
+        bool startsWithAssignment =
+            (tokens[position].type == TokenType::LeftParenthesis && tokens[position + 1].type == TokenType::Identifier &&
+             tokens[position + 2].type == TokenType::Prime) ||
+            (isWord(position, words::True) && (tokens[position + 1].type == TokenType::Semicolon || tokens[position + 1].type == TokenType::Plus));
+        if (startsWithAssignment) {
+            result.likelihoods.push_back(manager->rational(1));
+        } else {
+            result.likelihoods.push_back(parseNumericalExpression(position));
+            expect(position, TokenType::Colon);
+        }
+        result.assignments.push_back(parseAssignments(position));
+    } while (tokens[position].type == TokenType::Plus && ++position);
+    expect(position, TokenType::Semicolon);
+    return result;
+}
+
+std::vector<storm::prism::Assignment> FastPrismParser::parseAssignments(uint64_t& position) const {
+    std::vector<storm::prism::Assignment> result;
+    if (isWord(position, words::True)) {
+        ++position;
+        return result;
+    }
+    do {
+        uint64_t const line = tokens[position].line;
+        expect(position, TokenType::LeftParenthesis);
+        if (!isValidIdentifier(position) || !identifierExpressions[tokens[position].identifier].isInitialized()) {
+            fail(position, "expected variable");
+        }
+        storm::expressions::Variable const& variable = identifierVariables[tokens[position].identifier];
+        ++position;
+        expect(position, TokenType::Prime);
+        expect(position, TokenType::Equal);
+        storm::expressions::Expression expression = parseExpression(position);
+        expect(position, TokenType::RightParenthesis);
+        result.emplace_back(variable, expression, filename, line);
+    } while (tokens[position].type == TokenType::And && ++position);
+    return result;
+}
+
+storm::prism::Command FastPrismParser::createCommand(ParsedCommand& parsedCommand, std::string const& actionName) {
+    std::vector<storm::prism::Update> updates;
+    updates.reserve(parsedCommand.likelihoods.size());
+    for (uint64_t updateIndex = 0; updateIndex < parsedCommand.likelihoods.size(); ++updateIndex) {
+        updates.emplace_back(currentUpdateIndex, parsedCommand.likelihoods[updateIndex], std::move(parsedCommand.assignments[updateIndex]), filename,
+                             parsedCommand.updateLines[updateIndex]);
+        ++currentUpdateIndex;
+    }
+    storm::prism::Command command(currentCommandIndex, parsedCommand.markovian, actionIndices.at(actionName), actionName, parsedCommand.guard, updates,
+                                  filename, parsedCommand.line);
+    ++currentCommandIndex;
+    return command;
+}
+
+storm::expressions::Expression FastPrismParser::parseExpression(uint64_t& position) const {
+    storm::expressions::Expression condition = parseOrExpression(position);
+    if (tokens[position].type != TokenType::QuestionMark) {
+        return condition;
+    }
+    ++position;
+    storm::expressions::Expression thenExpression = parseExpression(position);
+    expect(position, TokenType::Colon);
+    storm::expressions::Expression elseExpression = parseExpression(position);
+    return storm::expressions::ite(condition, thenExpression, elseExpression);
+}
+
+storm::expressions::Expression FastPrismParser::parseBooleanExpression(uint64_t& position) const {
+    uint64_t const start = position;
+    storm::expressions::Expression result = parseExpression(position);
+    if (!result.hasBooleanType()) {
+        fail(start, "expected boolean expression");
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseIntegerExpression(uint64_t& position) const {
+    uint64_t const start = position;
+    storm::expressions::Expression result = parseExpression(position);
+    if (!result.hasIntegerType()) {
+        fail(start, "expected integer expression");
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseNumericalExpression(uint64_t& position) const {
+    uint64_t const start = position;
+    storm::expressions::Expression result = parseExpression(position);
+    if (!result.hasNumericalType()) {
+        fail(start, "expected numerical expression");
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseOrExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parseAndExpression(position);
+    while (tokens[position].type == TokenType::Or || tokens[position].type == TokenType::Implies) {
+        bool isImplication = tokens[position].type == TokenType::Implies;
+        ++position;
+        storm::expressions::Expression operand = parseAndExpression(position);
+        result = isImplication ? storm::expressions::implies(result, operand) : result || operand;
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseAndExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parseEqualityExpression(position);
+    while (tokens[position].type == TokenType::And) {
+        ++position;
+        result = result && parseEqualityExpression(position);
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseEqualityExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parseRelationalExpression(position);
+    while (tokens[position].type == TokenType::Equal || tokens[position].type == TokenType::NotEqual) {
+        bool isEquality = tokens[position].type == TokenType::Equal;
+        ++position;
+        storm::expressions::Expression operand = parseRelationalExpression(position);
+        if (!isEquality) {
+            result = result != operand;
+        } else if (result.hasBooleanType() && operand.hasBooleanType()) {
+            result = storm::expressions::iff(result, operand);
+        } else {
+            result = result == operand;
+        }
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseRelationalExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parsePlusExpression(position);
+    TokenType const type = tokens[position].type;
+    if (type == TokenType::GreaterOrEqual || type == TokenType::Greater || type == TokenType::LessOrEqual || type == TokenType::Less) {
+        ++position;
+        storm::expressions::Expression operand = parsePlusExpression(position);
+        switch (type) {
+            case TokenType::GreaterOrEqual:
+                return result >= operand;
+            case TokenType::Greater:
+                return result > operand;
+            case TokenType::LessOrEqual:
+                return result <= operand;
+            default:
+                return result < operand;
+        }
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parsePlusExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parseMultiplicationExpression(position);
+    while (tokens[position].type == TokenType::Plus || tokens[position].type == TokenType::Minus) {
+        bool isPlus = tokens[position].type == TokenType::Plus;
+        ++position;
+        storm::expressions::Expression operand = parseMultiplicationExpression(position);
+        result = isPlus ? result + operand : result - operand;
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseMultiplicationExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parsePowerModuloExpression(position);
+    while (tokens[position].type == TokenType::Times || tokens[position].type == TokenType::Divide) {
+        bool isTimes = tokens[position].type == TokenType::Times;
+        ++position;
+        storm::expressions::Expression operand = parsePowerModuloExpression(position);
+        result = isTimes ? result * operand : result / operand;
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parsePowerModuloExpression(uint64_t& position) const {
+    storm::expressions::Expression result = parseUnaryExpression(position);
+    if (tokens[position].type == TokenType::Power) {
+        ++position;
+        return storm::expressions::pow(result, parseUnaryExpression(position), true);
+    } else if (tokens[position].type == TokenType::Modulo) {
+        ++position;
+        return result % parseUnaryExpression(position);
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseUnaryExpression(uint64_t& position) const {
+    // As in the Spirit parser, the operators are applied in the order in which they appear.
+    uint64_t const firstOperator = position;
+    while (tokens[position].type == TokenType::Not || tokens[position].type == TokenType::Minus) {
+        ++position;
+    }
+    uint64_t const lastOperator = position;
+    storm::expressions::Expression result = parseAtomicExpression(position);
+    for (uint64_t operatorPosition = firstOperator; operatorPosition < lastOperator; ++operatorPosition) {
+        result = tokens[operatorPosition].type == TokenType::Not ? !result : -result;
+    }
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::parseAtomicExpression(uint64_t& position) const {
+    Token const& token = tokens[position];
+    switch (token.type) {
+        case TokenType::LeftParenthesis: {
+            ++position;
+            storm::expressions::Expression result = parseExpression(position);
+            expect(position, TokenType::RightParenthesis);
+            return result;
+        }
+        case TokenType::Plus:
+            // Literals may have a (positive) sign.
+            if (tokens[position + 1].type != TokenType::IntegerLiteral && tokens[position + 1].type != TokenType::RationalLiteral) {
+                fail(position, "unexpected token");
+            }
+            ++position;
+            return createLiteral(tokens[position++]);
+        case TokenType::IntegerLiteral:
+        case TokenType::RationalLiteral:
+            ++position;
+            return createLiteral(token);
+        case TokenType::Identifier:
+            break;
+        default:
+            fail(position, "unexpected token");
+    }
+
+    if (tokens[position + 1].type == TokenType::LeftParenthesis) {
+        switch (token.identifier) {
+            case words::AtLeastOneOf:
+                position += 2;
+                return storm::expressions::atLeastOneOf(parseArguments(position));
+            case words::AtMostOneOf:
+                position += 2;
+                return storm::expressions::atMostOneOf(parseArguments(position));
+            case words::ExactlyOneOf:
+                position += 2;
+                return storm::expressions::exactlyOneOf(parseArguments(position));
+            case words::Floor:
+            case words::Ceil:
+            case words::Round: {
+                position += 2;
+                storm::expressions::Expression operand = parseExpression(position);
+                expect(position, TokenType::RightParenthesis);
+                if (token.identifier == words::Floor) {
+                    return storm::expressions::floor(operand);
+                }
+                return token.identifier == words::Ceil ? storm::expressions::ceil(operand) : storm::expressions::round(operand);
+            }
+            case words::Min:
+            case words::Max: {
+                position += 2;
+                std::vector<storm::expressions::Expression> operands = parseArguments(position);
+                if (operands.size() < 2) {
+                    fail(position, "expected at least two operands");
+                }
+                storm::expressions::Expression result = operands.front();
+                for (auto operandIt = operands.begin() + 1; operandIt != operands.end(); ++operandIt) {
+                    result = token.identifier == words::Min ? storm::expressions::minimum(result, *operandIt) : storm::expressions::maximum(result, *operandIt);
+                }
+                return result;
+            }
+            case words::Pow:
+            case words::Mod:
+            case words::Func: {
+                bool isPower = token.identifier == words::Pow;
+                position += 2;
+                if (token.identifier == words::Func) {
+                    if (!isWord(position, words::Pow) && !isWord(position, words::Mod)) {
+                        fail(position, "expected pow or mod");
+                    }
+                    isPower = isWord(position, words::Pow);
+                    ++position;
+                    expect(position, TokenType::Comma);
+                }
+                std::vector<storm::expressions::Expression> operands = parseArguments(position);
+                if (operands.size() != 2) {
+                    fail(position, "expected two operands");
+                }
+                return isPower ? storm::expressions::pow(operands[0], operands[1], true) : operands[0] % operands[1];
+            }
+        }
+    }
+
+    ++position;
+    if (token.identifier == words::True) {
+        return manager->boolean(true);
+    } else if (token.identifier == words::False) {
+        return manager->boolean(false);
+    } else if (token.identifier < words::NumberOfKeywords || !identifierExpressions[token.identifier].isInitialized()) {
+        fail(position - 1, "unknown identifier");
+    }
+    return identifierExpressions[token.identifier];
+}
+
+std::vector<storm::expressions::Expression> FastPrismParser::parseArguments(uint64_t& position) const {
+    std::vector<storm::expressions::Expression> result;
+    result.push_back(parseExpression(position));
+    while (tokens[position].type == TokenType::Comma) {
+        ++position;
+        result.push_back(parseExpression(position));
+    }
+    expect(position, TokenType::RightParenthesis);
+    return result;
+}
+
+storm::expressions::Expression FastPrismParser::createLiteral(Token const& token) const {
+    char const* const begin = input.data() + token.begin;
+    char const* const end = begin + token.length;
+    if (token.type == TokenType::IntegerLiteral) {
+        int64_t value;
+        if (std::from_chars(begin, end, value).ec != std::errc()) {
+            fail(&token - tokens.data(), "integer literal out of range");
+        }
+        return manager->integer(value);
+    }
+
+    // Compute the exact value of the rational literal from its digits and its (decimal) exponent.
+    std::string digits;
+    int64_t exponent = 0;
+    char const* current = begin;
+    bool afterDot = false;
+    for (; current != end && *current != 'e' && *current != 'E'; ++current) {
+        if (*current == '.') {
+            afterDot = true;
+        } else {
+            digits.push_back(*current);
+            exponent -= afterDot ? 1 : 0;
+        }
+    }
+    if (current != end) {
+        ++current;
+        bool negative = *current == '-';
+        if (*current == '+' || *current == '-') {
+            ++current;
+        }
+        int64_t explicitExponent;
+        if (std::from_chars(current, end, explicitExponent).ec != std::errc() || explicitExponent > 10000) {
+            fail(&token - tokens.data(), "exponent out of range");
+        }
+        exponent += negative ? -explicitExponent : explicitExponent;
+    }
+    digits.erase(0, std::min(digits.find_first_not_of('0'), digits.size() - 1));
+    storm::RationalNumber value = storm::utility::convertNumber<storm::RationalNumber>(digits);
+    storm::RationalNumber scale = storm::utility::pow(storm::RationalNumber(10), static_cast<uint_fast64_t>(std::abs(exponent)));
+    return manager->rational(exponent >= 0 ? storm::RationalNumber(value * scale) : storm::RationalNumber(value / scale));
+}
+
+bool FastPrismParser::isWord(uint64_t position, uint32_t word) const {
+    return tokens[position].type == TokenType::Identifier && tokens[position].identifier == word;
+}
+
+bool FastPrismParser::isValidIdentifier(uint64_t position) const {
+    return tokens[position].type == TokenType::Identifier && tokens[position].identifier >= words::NumberOfKeywords;
+}
+
+void FastPrismParser::expect(uint64_t& position, TokenType type) const {
+    if (tokens[position].type != type) {
+        fail(position, "unexpected token");
+    }
+    ++position;
+}
+
+void FastPrismParser::expectWord(uint64_t& position, uint32_t word) const {
+    if (!isWord(position, word)) {
+        fail(position, std::string("expected '") + words::names[word] + "'");
+    }
+    ++position;
+}
+
+std::string const& FastPrismParser::getIdentifier(uint64_t position) const {
+    return identifiers[tokens[position].identifier];
+}
+
+std::string FastPrismParser::parseIdentifier(uint64_t& position) const {
+    if (!isValidIdentifier(position)) {
+        fail(position, "expected identifier");
+    }
+    return getIdentifier(position++);
+}
+
+std::string FastPrismParser::parseActionName(uint64_t& position, TokenType closingType) const {
+    std::string actionName;
+    if (isValidIdentifier(position)) {
+        actionName = getIdentifier(position++);
+    }
+    expect(position, closingType);
+    return actionName;
+}
+
+uint64_t FastPrismParser::skipUntil(uint64_t position, TokenType type) const {
+    while (tokens[position].type != type) {
+        if (tokens[position].type == TokenType::End) {
+            fail(position, "unexpected end of input");
+        }
+        ++position;
+    }
+    return position;
+}
+
+void FastPrismParser::fail(uint64_t position, std::string const& message) const {
+    throw storm::exceptions::WrongFormatException() << "Parsing error in " << filename << " in line " << tokens[position].line << ": " << message << ".";
+}
+
+}  // namespace parser
+}  // namespace storm
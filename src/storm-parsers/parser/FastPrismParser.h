@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace expressions {
+class ExpressionManager;
+}
+
+namespace parser {
+
+/*!
+ * A hand-written recursive-descent parser for PRISM programs that produces the same programs as the (Spirit-based)
+ * PrismParser. In contrast to the latter, the input is tokenized once and identifiers are interned, i.e. every
+ * identifier is resolved to the corresponding expression of the ExpressionManager only once instead of every time it
+ * occurs. The commands of the modules are parsed in parallel (using the default number of threads).
+ *
+ * The parser does not support player and system composition constructs and does not report syntax errors. It is
+ * therefore meant to be used as a front end of the PrismParser that falls back to the Spirit grammar (which also
+ * produces the error messages) whenever this parser rejects the input.
+ */
+class FastPrismParser {
+   public:
+    /*!
+     * Parses the given input into the PRISM storage classes.
+     *
+     * @param input The input string to parse.
+     * @param filename The name of the file from which the input was read.
+     * @param prismCompatibility Whether PRISM compatibility mode is enabled.
+     * @return The resulting PRISM program or none if the input is malformed or uses constructs that are not supported.
+     * Errors that are detected while constructing the program (e.g. by the validity checks of the program) are thrown.
+     */
+    static boost::optional<storm::prism::Program> parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility = false);
+
+   private:
+    enum class TokenType : uint8_t {
+        Identifier,
+        IntegerLiteral,
+        RationalLiteral,
+        LeftParenthesis,
+        RightParenthesis,
+        LeftBracket,
+        RightBracket,
+        Comma,
+        Semicolon,
+        Colon,
+        QuestionMark,
+        Quote,
+        Prime,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Not,
+        And,
+        Or,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Implies,
+        Arrow,
+        Range,
+        End
+    };
+
+    struct Token {
+        TokenType type;
+        uint32_t line;
+        // The position of the token in the input.
+        uint32_t begin;
+        uint32_t length;
+        // For identifiers, the index of the interned identifier.
+        uint32_t identifier;
+    };
+
+    enum class VariableType : uint8_t { Boolean, Integer, Rational, Clock };
+
+    // The declaration of a module that is collected in the first pass.
+    struct ModuleDeclaration {
+        std::string name;
+        uint64_t firstToken;
+        bool isRenamed;
+        // For modules that are defined directly: the names of their variables and the tokens at which their commands start.
+        std::vector<std::string> booleanVariables;
+        std::vector<std::string> integerVariables;
+        std::vector<std::string> clockVariables;
+        std::vector<std::string> commandActionNames;
+        std::vector<uint64_t> commandTokens;
+        // For renamed modules: the name of the base module and the renaming.
+        std::string baseModule;
+        std::map<std::string, std::string> renaming;
+        uint64_t renamingLine;
+    };
+
+    // The top-level constructs of the program in the order in which they appear in the input.
+    enum class ConstructType : uint8_t { Constant, GlobalVariable, Module, InitialConstruct, RewardModel, Label, ObservationLabel };
+
+    struct Construct {
+        ConstructType type;
+        // The token at which the construct starts. For modules, the index of the module.
+        uint64_t index;
+    };
+
+    // A command whose updates have not yet been assigned their (global) indices.
+    struct ParsedCommand {
+        bool markovian;
+        uint64_t line;
+        storm::expressions::Expression guard;
+        std::vector<storm::expressions::Expression> likelihoods;
+        std::vector<std::vector<storm::prism::Assignment>> assignments;
+        std::vector<uint64_t> updateLines;
+    };
+
+    FastPrismParser(std::string const& input, std::string const& filename, bool prismCompatibility);
+
+    void parse();
+    storm::prism::Program createProgram() const;
+
+    // Tokenization.
+    void tokenize();
+    uint32_t intern(std::string_view const& identifier);
+
+    // The first pass that declares all identifiers and collects the top-level constructs.
+    void declareIdentifiers();
+    void declareObservables();
+    void declareConstant();
+    void declareFormula();
+    void declareVariable(std::vector<std::string>* booleanVariables, std::vector<std::string>* integerVariables, std::vector<std::string>* clockVariables);
+    void declareModule();
+    void declareRenamedModule(std::string const& moduleName, uint64_t firstToken);
+    void declareRewardModel();
+    void declareLabel(std::set<std::string>& existingLabels);
+    void registerAction(std::string const& actionName);
+    storm::expressions::Variable declare(std::string const& name, VariableType type, bool isConstant);
+    void resolveIdentifiers();
+    void createFormulas();
+
+    // The second pass that creates the elements of the program.
+    void parseCommands();
+    storm::prism::Constant createConstant();
+    void createGlobalVariable();
+    storm::prism::Module createModule(ModuleDeclaration const& module, std::vector<ParsedCommand>& parsedCommands);
+    storm::prism::Module createRenamedModule(ModuleDeclaration const& module);
+    storm::prism::InitialConstruct createInitialConstruct();
+    storm::prism::RewardModel createRewardModel();
+    storm::prism::Label createLabel();
+    storm::prism::ObservationLabel createObservationLabel();
+    storm::prism::BooleanVariable createBooleanVariable(std::string const& name, uint64_t line, uint64_t& position) const;
+    storm::prism::IntegerVariable createIntegerVariable(std::string const& name, uint64_t line, uint64_t& position) const;
+    ParsedCommand parseCommand(uint64_t position) const;
+    std::vector<storm::prism::Assignment> parseAssignments(uint64_t& position) const;
+    storm::prism::Command createCommand(ParsedCommand& parsedCommand, std::string const& actionName);
+
+    // Expressions.
+    storm::expressions::Expression parseExpression(uint64_t& position) const;
+    storm::expressions::Expression parseBooleanExpression(uint64_t& position) const;
+    storm::expressions::Expression parseIntegerExpression(uint64_t& position) const;
+    storm::expressions::Expression parseNumericalExpression(uint64_t& position) const;
+    storm::expressions::Expression parseOrExpression(uint64_t& position) const;
+    storm::expressions::Expression parseAndExpression(uint64_t& position) const;
+    storm::expressions::Expression parseEqualityExpression(uint64_t& position) const;
+    storm::expressions::Expression parseRelationalExpression(uint64_t& position) const;
+    storm::expressions::Expression parsePlusExpression(uint64_t& position) const;
+    storm::expressions::Expression parseMultiplicationExpression(uint64_t& position) const;
+    storm::expressions::Expression parsePowerModuloExpression(uint64_t& position) const;
+    storm::expressions::Expression parseUnaryExpression(uint64_t& position) const;
+    storm::expressions::Expression parseAtomicExpression(uint64_t& position) const;
+    std::vector<storm::expressions::Expression> parseArguments(uint64_t& position) const;
+    storm::expressions::Expression createLiteral(Token const& token) const;
+
+    // Helpers for inspecting the tokens.
+    bool isWord(uint64_t position, uint32_t word) const;
+    bool isValidIdentifier(uint64_t position) const;
+    void expect(uint64_t& position, TokenType type) const;
+    void expectWord(uint64_t& position, uint32_t word) const;
+    std::string const& getIdentifier(uint64_t position) const;
+    std::string parseIdentifier(uint64_t& position) const;
+    std::string parseActionName(uint64_t& position, TokenType closingType) const;
+    uint64_t skipUntil(uint64_t position, TokenType type) const;
+    [[noreturn]] void fail(uint64_t position, std::string const& message) const;
+
+    std::string const& input;
+    std::string filename;
+    bool prismCompatibility;
+    std::shared_ptr<storm::expressions::ExpressionManager> manager;
+
+    std::vector<Token> tokens;
+    // The position of the token that is processed next by the (sequential) passes.
+    uint64_t cursor;
+
+    std::unordered_map<std::string_view, uint32_t> identifierIndices;
+    std::vector<std::string> identifiers;
+    // The expressions and variables to which the interned identifiers refer (uninitialized if there is none).
+    std::vector<storm::expressions::Expression> identifierExpressions;
+    std::vector<storm::expressions::Variable> identifierVariables;
+
+    storm::prism::Program::ModelType modelType;
+    std::vector<Construct> constructs;
+    std::vector<ModuleDeclaration> modules;
+    std::map<std::string, uint64_t> moduleToIndexMap;
+    std::map<std::string, uint_fast64_t> actionIndices;
+    std::set<std::string> observables;
+    std::set<std::string> rewardModelNames;
+
+    // The formulas together with the token at which their defining expression starts.
+    std::vector<std::pair<std::string, uint64_t>> formulaDeclarations;
+    std::vector<storm::prism::Formula> formulas;
+
+    // The commands of the modules that are defined directly (indexed by module and command).
+    std::vector<std::vector<ParsedCommand>> parsedCommands;
+
+    // The elements of the program that are created in the second pass.
+    std::vector<storm::prism::Constant> constants;
+    std::vector<storm::prism::BooleanVariable> globalBooleanVariables;
+    std::vector<storm::prism::IntegerVariable> globalIntegerVariables;
+    std::vector<storm::prism::Module> programModules;
+    std::vector<storm::prism::RewardModel> rewardModels;
+    std::vector<storm::prism::Label> labels;
+    std::vector<storm::prism::ObservationLabel> observationLabels;
+    boost::optional<storm::prism::InitialConstruct> initialConstruct;
+    uint64_t currentCommandIndex;
+    uint64_t currentUpdateIndex;
+};
+
+}  // namespace parser
+}  // namespace storm
@@ -21,6 +21,7 @@
 
 #include "storm/logic/RewardAccumulationEliminationVisitor.h"
 
+#include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/InvalidJaniException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -32,6 +33,8 @@
 #include <boost/lexical_cast.hpp>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <set>
 #include <sstream>
 
 #include "storm/io/file.h"
@@ -94,39 +97,119 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     return parser.parseModel(parseProperties);
 }
 
+template<typename ValueType>
+struct JaniParser<ValueType>::ModelDeclarations {
+    ModelDeclarations(std::string const& name, storm::jani::ModelType const& type, uint64_t version,
+                      std::shared_ptr<storm::expressions::ExpressionManager> const& expressionManager)
+        : model(name, type, version, expressionManager) {}
+
+    Scope getScope() const {
+        return Scope(model.getName(), &constants, &globalVars, &globalFunctions);
+    }
+
+    storm::jani::Model model;
+    ConstantsMap constants;
+    VariablesMap globalVars;
+    FunctionsMap globalFunctions;
+};
+
+template<typename ValueType>
+JaniParser<ValueType>::JaniParser() : expressionManager(new storm::expressions::ExpressionManager()) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType>
 JaniParser<ValueType>::JaniParser(std::string const& jsonstring) : expressionManager(new storm::expressions::ExpressionManager()) {
-    parsedStructure = Json::parse(jsonstring);
+    std::istringstream input(jsonstring);
+    readJson(input);
 }
 
+template<typename ValueType>
+JaniParser<ValueType>::~JaniParser() = default;
+
 template<typename ValueType>
 void JaniParser<ValueType>::readFile(std::string const& path) {
     std::ifstream file;
     storm::utility::openFile(path, file);
-    parsedStructure << file;
+    readJson(file);
     storm::utility::closeFile(file);
 }
 
 template<typename ValueType>
-std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseModel(bool parseProperties) {
+void JaniParser<ValueType>::readJson(std::istream& input) {
+    // The entries of the model structure that are required to parse an automaton.
+    static const std::set<std::string> declarationKeys = {"jani-version", "name", "type", "features", "actions", "constants", "variables", "functions"};
+    Json declarationStructure = Json::object();
+    std::string currentKey;
+    bool parseAutomataWhileReading = true;
+    // Depth 0 is the model structure, depth 1 its entries and depth 2 the elements of its entries (e.g. the automata).
+    auto callback = [&](int depth, typename Json::parse_event_t event, Json& parsed) {
+        if (!parseAutomataWhileReading) {
+            return true;
+        }
+        if (depth == 1 && event == Json::parse_event_t::key) {
+            currentKey = parsed.template get<std::string>();
+            if (declarations && declarationKeys.count(currentKey) > 0) {
+                // A declaration that might be needed by the already parsed automata.
+                parseAutomataWhileReading = false;
+            }
+        } else if (depth == 1 && declarationKeys.count(currentKey) > 0 &&
+                   (event == Json::parse_event_t::value || event == Json::parse_event_t::object_end || event == Json::parse_event_t::array_end)) {
+            declarationStructure[currentKey] = parsed;
+        } else if (depth == 2 && currentKey == "automata" && event == Json::parse_event_t::object_end) {
+            try {
+                if (!declarations) {
+                    declarations = parseDeclarations(declarationStructure);
+                }
+                storm::jani::Model& model = declarations->model;
+                model.addAutomaton(
+                    parseAutomaton(parsed, model, declarations->getScope().refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+            } catch (storm::exceptions::BaseException const&) {
+                // The error might be due to declarations that only occur later. Errors are reported when parsing the input as a whole.
+                parseAutomataWhileReading = false;
+                return true;
+            }
+            // Discard the structure of the parsed automaton.
+            return false;
+        }
+        return true;
+    };
+    parsedStructure = Json::parse(input, callback);
+
+    if (!parseAutomataWhileReading) {
+        STORM_LOG_INFO("Automata of the JANI model could not be parsed while reading the input. Reading the input again.");
+        declarations.reset();
+        expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+        integerLiterals.clear();
+        variableExpressions.clear();
+        labels.clear();
+        input.clear();
+        input.seekg(0);
+        parsedStructure = Json::parse(input);
+    }
+}
+
+template<typename ValueType>
+std::unique_ptr<typename JaniParser<ValueType>::ModelDeclarations> JaniParser<ValueType>::parseDeclarations(Json const& modelStructure) {
     // jani-version
-    STORM_LOG_THROW(parsedStructure.count("jani-version") == 1, storm::exceptions::InvalidJaniException, "Jani-version must be given exactly once.");
-    uint64_t version = getUnsignedInt<ValueType>(parsedStructure.at("jani-version"), "jani version");
+    STORM_LOG_THROW(modelStructure.count("jani-version") == 1, storm::exceptions::InvalidJaniException, "Jani-version must be given exactly once.");
+    uint64_t version = getUnsignedInt<ValueType>(modelStructure.at("jani-version"), "jani version");
     STORM_LOG_WARN_COND(version >= 1 && version <= 1, "JANI Version " << version << " is not supported. Results may be wrong.");
     // name
-    STORM_LOG_THROW(parsedStructure.count("name") == 1, storm::exceptions::InvalidJaniException, "A model must have a (single) name");
-    std::string name = getString<ValueType>(parsedStructure.at("name"), "model name");
+    STORM_LOG_THROW(modelStructure.count("name") == 1, storm::exceptions::InvalidJaniException, "A model must have a (single) name");
+    std::string name = getString<ValueType>(modelStructure.at("name"), "model name");
     // model type
-    STORM_LOG_THROW(parsedStructure.count("type") == 1, storm::exceptions::InvalidJaniException, "A type must be given exactly once");
-    std::string modeltypestring = getString<ValueType>(parsedStructure.at("type"), "type of the model");
+    STORM_LOG_THROW(modelStructure.count("type") == 1, storm::exceptions::InvalidJaniException, "A type must be given exactly once");
+    std::string modeltypestring = getString<ValueType>(modelStructure.at("type"), "type of the model");
     storm::jani::ModelType type = storm::jani::getModelType(modeltypestring);
     STORM_LOG_THROW(type != storm::jani::ModelType::UNDEFINED, storm::exceptions::InvalidJaniException, "model type " + modeltypestring + " not recognized");
-    storm::jani::Model model(name, type, version, expressionManager);
-    uint_fast64_t featuresCount = parsedStructure.count("features");
+    auto result = std::make_unique<ModelDeclarations>(name, type, version, expressionManager);
+    storm::jani::Model& model = result->model;
+    uint_fast64_t featuresCount = modelStructure.count("features");
     STORM_LOG_THROW(featuresCount < 2, storm::exceptions::InvalidJaniException, "features-declarations can be given at most once.");
     if (featuresCount == 1) {
         auto allKnownModelFeatures = storm::jani::getAllKnownModelFeatures();
-        for (auto const& feature : parsedStructure.at("features")) {
+        for (auto const& feature : modelStructure.at("features")) {
             std::string featureStr = getString<ValueType>(feature, "Model feature");
             bool found = false;
             for (auto const& knownFeature : allKnownModelFeatures.asSet()) {
@@ -139,23 +222,22 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             STORM_LOG_THROW(found, storm::exceptions::NotSupportedException, "Storm does not support the model feature " << featureStr);
         }
     }
-    uint_fast64_t actionCount = parsedStructure.count("actions");
+    uint_fast64_t actionCount = modelStructure.count("actions");
     STORM_LOG_THROW(actionCount < 2, storm::exceptions::InvalidJaniException, "Action-declarations can be given at most once.");
     if (actionCount > 0) {
-        parseActions(parsedStructure.at("actions"), model);
+        parseActions(modelStructure.at("actions"), model);
     }
 
-    Scope scope(name);
+    Scope scope = result->getScope();
 
     // Parse constants
-    ConstantsMap constants;
-    scope.constants = &constants;
-    uint_fast64_t constantsCount = parsedStructure.count("constants");
+    ConstantsMap& constants = result->constants;
+    uint_fast64_t constantsCount = modelStructure.count("constants");
     STORM_LOG_THROW(constantsCount < 2, storm::exceptions::InvalidJaniException, "Constant-declarations can be given at most once.");
     if (constantsCount == 1) {
         // Reserve enough space to make sure that pointers to constants remain valid after adding new ones.
-        model.getConstants().reserve(parsedStructure.at("constants").size());
-        for (auto const& constStructure : parsedStructure.at("constants")) {
+        model.getConstants().reserve(modelStructure.at("constants").size());
+        for (auto const& constStructure : modelStructure.at("constants")) {
             std::shared_ptr<storm::jani::Constant> constant =
                 parseConstant(constStructure, scope.refine("constants[" + std::to_string(constants.size()) + "]"));
             model.addConstant(*constant);
@@ -165,25 +247,23 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
     }
 
     // Parse variables
-    uint_fast64_t variablesCount = parsedStructure.count("variables");
+    uint_fast64_t variablesCount = modelStructure.count("variables");
     STORM_LOG_THROW(variablesCount < 2, storm::exceptions::InvalidJaniException, "Variable-declarations can be given at most once for global variables.");
-    VariablesMap globalVars;
-    scope.globalVars = &globalVars;
+    VariablesMap& globalVars = result->globalVars;
     if (variablesCount == 1) {
-        for (auto const& varStructure : parsedStructure.at("variables")) {
+        for (auto const& varStructure : modelStructure.at("variables")) {
             std::shared_ptr<storm::jani::Variable> variable = parseVariable(varStructure, scope.refine("variables[" + std::to_string(globalVars.size())));
             globalVars.emplace(variable->getName(), &model.addVariable(*variable));
         }
     }
 
-    uint64_t funDeclCount = parsedStructure.count("functions");
+    uint64_t funDeclCount = modelStructure.count("functions");
     STORM_LOG_THROW(funDeclCount < 2, storm::exceptions::InvalidJaniException, "Model '" << name << "' has more than one list of functions");
-    FunctionsMap globalFuns;
-    scope.globalFunctions = &globalFuns;
+    FunctionsMap& globalFuns = result->globalFunctions;
     if (funDeclCount > 0) {
         // We require two passes through the function definitions array to allow referring to functions before they were defined.
         std::vector<storm::jani::FunctionDefinition> dummyFunctionDefinitions;
-        for (auto const& funStructure : parsedStructure.at("functions")) {
+        for (auto const& funStructure : modelStructure.at("functions")) {
             // Skip parsing of function body
             dummyFunctionDefinitions.push_back(
                 parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(globalFuns.size()) + "] of model " + name), true));
@@ -195,7 +275,7 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             STORM_LOG_THROW(unused, storm::exceptions::InvalidJaniException,
                             "Multiple definitions of functions with the name " << funDef.getName() << " in " << scope.description);
         }
-        for (auto const& funStructure : parsedStructure.at("functions")) {
+        for (auto const& funStructure : modelStructure.at("functions")) {
             // Actually parse the function body
             storm::jani::FunctionDefinition funDef =
                 parseFunctionDefinition(funStructure, scope.refine("functions[" + std::to_string(globalFuns.size()) + "] of model " + name), false);
@@ -203,11 +283,22 @@ std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<Val
             globalFuns[funDef.getName()] = &model.addFunctionDefinition(funDef);
         }
     }
+    return result;
+}
+
+template<typename ValueType>
+std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parseModel(bool parseProperties) {
+    // The declarations have already been parsed if the automata were parsed while reading the input.
+    if (!declarations) {
+        declarations = parseDeclarations(parsedStructure);
+    }
+    storm::jani::Model& model = declarations->model;
+    Scope scope = declarations->getScope();
 
     // Parse Automata
     STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
     STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
-    // Automatons can only be parsed after constants and variables.
+    // Automatons can only be parsed after constants and variables. Automata that were parsed while reading the input are no longer contained.
     for (auto const& automataEntry : parsedStructure.at("automata")) {
         model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
     }
@@ -1116,12 +1207,22 @@ storm::expressions::Expression JaniParser<ValueType>::parseExpression(Json const
             return expressionManager->boolean(false);
         }
     } else if (expressionStructure.is_number_integer()) {
-        return expressionManager->integer(expressionStructure.template get<int64_t>());
+        int64_t value = expressionStructure.template get<int64_t>();
+        auto literalIt = integerLiterals.find(value);
+        if (literalIt == integerLiterals.end()) {
+            literalIt = integerLiterals.emplace(value, expressionManager->integer(value)).first;
+        }
+        return literalIt->second;
     } else if (expressionStructure.is_number_float()) {
         return expressionManager->rational(storm::utility::convertNumber<storm::RationalNumber>(expressionStructure.template get<ValueType>()));
     } else if (expressionStructure.is_string()) {
         std::string ident = expressionStructure.template get<std::string>();
-        return storm::expressions::Expression(getVariableOrConstantExpression(ident, scope, auxiliaryVariables));
+        storm::expressions::Variable variable = getVariableOrConstantExpression(ident, scope, auxiliaryVariables);
+        auto variableIt = variableExpressions.find(variable);
+        if (variableIt == variableExpressions.end()) {
+            variableIt = variableExpressions.emplace(variable, storm::expressions::Expression(variable)).first;
+        }
+        return variableIt->second;
     } else if (expressionStructure.is_object()) {
         if (expressionStructure.count("distribution") == 1) {
             STORM_LOG_THROW(
@@ -1,4 +1,8 @@
 #pragma once
+#include <istream>
+#include <memory>
+#include <unordered_map>
+
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/logic/Bound.h"
@@ -38,8 +42,9 @@ class JaniParser {
     typedef std::unordered_map<std::string, storm::jani::FunctionDefinition const*> FunctionsMap;
     typedef storm::json<ValueType> Json;
 
-    JaniParser() : expressionManager(new storm::expressions::ExpressionManager()) {}
+    JaniParser();
     JaniParser(std::string const& jsonstring);
+    ~JaniParser();
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parse(std::string const& path, bool parseProperties = true);
     static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseFromString(std::string const& jsonstring, bool parseProperties = true);
 
@@ -91,6 +96,23 @@ class JaniParser {
                                                    std::unordered_map<std::string, storm::expressions::Variable> const& auxiliaryVariables = {});
 
    private:
+    /*!
+     * The model together with the declarations of its global scope.
+     */
+    struct ModelDeclarations;
+
+    /*!
+     * Reads the JSON input into the parsed structure. If the declarations of the global scope (constants, variables, functions, ...) precede the
+     * automata, each automaton is parsed as soon as it has been read and its JSON structure is discarded afterwards. Hence, the structure of all
+     * automata (usually the largest part of the input) is never kept in memory at once. Otherwise, the input is read again as a whole.
+     */
+    void readJson(std::istream& input);
+
+    /*!
+     * Creates the model and parses the declarations of its global scope from the given structure.
+     */
+    std::unique_ptr<ModelDeclarations> parseDeclarations(storm::json<ValueType> const& modelStructure);
+
     std::shared_ptr<storm::jani::Constant> parseConstant(storm::json<ValueType> const& constantStructure, Scope const& scope);
     storm::jani::FunctionDefinition parseFunctionDefinition(storm::json<ValueType> const& functionDefinitionStructure, Scope const& scope, bool firstPass,
                                                             std::string const& parameterNamePrefix = "");
@@ -128,10 +150,19 @@ class JaniParser {
      * The overall structure currently under inspection.
      */
     storm::json<ValueType> parsedStructure;
+    /**
+     * The model and its global declarations. Only set once the declarations have been parsed.
+     */
+    std::unique_ptr<ModelDeclarations> declarations;
     /**
      * The expression manager to be used.
      */
     std::shared_ptr<storm::expressions::ExpressionManager> expressionManager;
+    /**
+     * Expressions for the occurring literals and variables. These are shared among all expressions that refer to them.
+     */
+    std::unordered_map<int64_t, storm::expressions::Expression> integerLiterals;
+    std::unordered_map<storm::expressions::Variable, storm::expressions::Expression> variableExpressions;
 
     std::set<std::string> labels = {};
 
@@ -15,10 +15,11 @@
 #include "storm/storage/expressions/VariableExpression.h"
 
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm-parsers/parser/FastPrismParser.h"
 
 namespace storm {
 namespace parser {
-storm::prism::Program PrismParser::parse(std::string const& filename, bool prismCompatibility) {
+storm::prism::Program PrismParser::parse(std::string const& filename, bool prismCompatibility, bool useFastParser) {
     // Open file and initialize result.
     std::ifstream inputFileStream;
     storm::utility::openFile(filename, inputFileStream);
@@ -27,7 +28,7 @@ storm::prism::Program PrismParser::parse(std::string const& filename, bool prism
     // Now try to parse the contents of the file.
     try {
         std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-        result = parseFromString(fileContent, filename, prismCompatibility);
+        result = parseFromString(fileContent, filename, prismCompatibility, useFastParser);
     } catch (storm::exceptions::WrongFormatException& e) {
         // In case of an exception properly close the file before passing exception.
         storm::utility::closeFile(inputFileStream);
@@ -43,7 +44,15 @@ storm::prism::Program PrismParser::parse(std::string const& filename, bool prism
     return result;
 }
 
-storm::prism::Program PrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
+storm::prism::Program PrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility, bool useFastParser) {
+    if (useFastParser) {
+        boost::optional<storm::prism::Program> program = FastPrismParser::parseFromString(input, filename, prismCompatibility);
+        if (program) {
+            return std::move(program.get());
+        }
+        STORM_LOG_DEBUG("Falling back to the Spirit-based PRISM parser.");
+    }
+
     bool hasByteOrderMark = input.size() >= 3 && input[0] == '\xEF' && input[1] == '\xBB' && input[2] == '\xBF';
 
     PositionIteratorType first(hasByteOrderMark ? input.begin() + 3 : input.begin());
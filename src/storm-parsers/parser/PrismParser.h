@@ -98,18 +98,23 @@ class PrismParser : public qi::grammar<Iterator, storm::prism::Program(), Skippe
      * Parses the given file into the PRISM storage classes assuming it complies with the PRISM syntax.
      *
      * @param filename the name of the file to parse.
+     * @param useFastParser If set, the input is first parsed with the FastPrismParser and the Spirit grammar is only
+     * used if the former rejects the input.
      * @return The resulting PRISM program.
      */
-    static storm::prism::Program parse(std::string const& filename, bool prismCompatability = false);
+    static storm::prism::Program parse(std::string const& filename, bool prismCompatability = false, bool useFastParser = true);
 
     /*!
      * Parses the given input stream into the PRISM storage classes assuming it complies with the PRISM syntax.
      *
      * @param input The input string to parse.
      * @param filename The name of the file from which the input was read.
+     * @param useFastParser If set, the input is first parsed with the FastPrismParser and the Spirit grammar is only
+     * used if the former rejects the input.
      * @return The resulting PRISM program.
      */
-    static storm::prism::Program parseFromString(std::string const& input, std::string const& filename, bool prismCompatability = false);
+    static storm::prism::Program parseFromString(std::string const& input, std::string const& filename, bool prismCompatability = false,
+                                                 bool useFastParser = true);
 
    private:
     struct modelTypeStruct : qi::symbols<char, storm::prism::Program::ModelType> {
@@ -1,6 +1,8 @@
 #include "storm-parsers/util/cstring.h"
 
+#include <charconv>
 #include <cstring>
+#include <system_error>
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/macros.h"
@@ -11,14 +13,24 @@ namespace utility {
 namespace cstring {
 
 /*!
- *	Calls strtol() internally and checks if the new pointer is different
- *	from the original one, i.e. if str != *end. If they are the same, a
+ *	Parses a (non-negative) decimal integer. Leading whitespaces are skipped.
+ *	Uses std::from_chars for plain digit sequences and falls back to strtol()
+ *	otherwise (e.g. for signed numbers). If nothing could be parsed, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
  *	@param end New pointer will be written there
- *	@return Result of strtol()
+ *	@return The parsed integer
  */
 uint_fast64_t checked_strtol(char const* str, char const** end) {
+    char const* first = trimWhitespaces(str);
+    if (*first >= '0' && *first <= '9') {
+        uint_fast64_t res;
+        auto parseResult = std::from_chars(first, skipWord(first), res);
+        if (parseResult.ec == std::errc()) {
+            *end = parseResult.ptr;
+            return res;
+        }
+    }
     uint_fast64_t res = strtol(str, const_cast<char**>(end), 10);
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing integer. Next input token is not a number.");
@@ -29,14 +41,31 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
 }
 
 /*!
- *	Calls strtod() internally and checks if the new pointer is different
- *	from the original one, i.e. if str != *end. If they are the same, a
+ *	Parses a floating point number. Leading whitespaces are skipped.
+ *	Uses std::from_chars (if the standard library supports it for floating
+ *	point types), which is locale-independent and considerably faster than
+ *	strtod(). Falls back to strtod() for inputs that std::from_chars does not
+ *	accept (e.g. hexadecimal numbers). If nothing could be parsed, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
  *	@param end New pointer will be written there
- *	@return Result of strtod()
+ *	@return The parsed number
  */
 double checked_strtod(char const* str, char const** end) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    char const* first = trimWhitespaces(str);
+    if (*first == '+') {
+        ++first;
+    }
+    char const* last = skipWord(first);
+    double fastRes;
+    auto parseResult = std::from_chars(first, last, fastRes);
+    // Hexadecimal numbers are only recognized by strtod().
+    if (parseResult.ec == std::errc() && (parseResult.ptr == last || *parseResult.ptr != 'x')) {
+        *end = parseResult.ptr;
+        return fastRes;
+    }
+#endif
     double res = strtod(str, const_cast<char**>(end));
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing floating point. Next input token is not a number.");
@@ -21,6 +21,7 @@ namespace storm {
             
             const std::string refineOption = "refine";
             const std::string explorationTimeLimitOption = "exploration-time";
+            const std::string refineBudgetOption = "refine-budget";
             const std::string resolutionOption = "resolution";
             const std::string sizeThresholdOption = "size-threshold";
             const std::string gapThresholdOption = "gap-threshold";
@@ -35,6 +36,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationTimeLimitOption, false, "Sets after which time no further states shall be explored.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds.").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refineBudgetOption, false, "Stops refining (and exploring) once the budget is exceeded and reports improved bounds as soon as they are found.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time","In seconds, measured from the start of the analysis.").build()).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("memory","In megabytes, the memory occupied by the beliefs of each approximation (0 means no limit).").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, resolutionOption, false,"Sets the resolution of the discretization and how it is increased in case of refinement").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("init","the initial resolution (higher means more precise)").setDefaultValueUnsignedInteger(3).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Multiplied to the resolution of refined observations (higher means more precise).").setDefaultValueDouble(2).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(1)).build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, observationThresholdOption, false,"Only observations whose score is below this threshold will be refined.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("init","initial threshold (higher means more precise").setDefaultValueDouble(0.1).addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("factor","Controlls how fast the threshold is increased in each refinement step (higher means more precise).").setDefaultValueDouble(0.1).makeOptional().addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0,1)).build()).build());
@@ -77,6 +80,22 @@ namespace storm {
                 return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
             }
             
+            bool BeliefExplorationSettings::isRefineBudgetSet() const {
+                return this->getOption(refineBudgetOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getRefineTimeLimit() const {
+                return this->getOption(refineBudgetOption).getArgumentByName("time").getValueAsUnsignedInteger();
+            }
+            
+            bool BeliefExplorationSettings::isRefineMemoryLimitSet() const {
+                return isRefineBudgetSet() && this->getOption(refineBudgetOption).getArgumentByName("memory").getValueAsUnsignedInteger() != 0;
+            }
+            
+            uint64_t BeliefExplorationSettings::getRefineMemoryLimit() const {
+                return this->getOption(refineBudgetOption).getArgumentByName("memory").getValueAsUnsignedInteger();
+            }
+            
             uint64_t BeliefExplorationSettings::getResolutionInit() const {
                 return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
             }
@@ -147,6 +166,16 @@ namespace storm {
                 } else {
                     options.explorationTimeLimit = boost::none;
                 }
+                if (isRefineBudgetSet()) {
+                    options.refineTimeLimit = getRefineTimeLimit();
+                } else {
+                    options.refineTimeLimit = boost::none;
+                }
+                if (isRefineMemoryLimitSet()) {
+                    options.refineMemoryLimit = getRefineMemoryLimit();
+                } else {
+                    options.refineMemoryLimit = boost::none;
+                }
                 options.resolutionInit = getResolutionInit();
                 options.resolutionFactor = storm::utility::convertNumber<ValueType>(getResolutionFactor());
                 options.sizeThresholdInit = getSizeThresholdInit();
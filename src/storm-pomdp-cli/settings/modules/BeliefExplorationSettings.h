@@ -34,6 +34,12 @@ namespace storm {
                 
                 bool isExplorationTimeLimitSet() const;
                 uint64_t getExplorationTimeLimit() const;
+
+                /// The budget for the refinement (anytime mode)
+                bool isRefineBudgetSet() const;
+                uint64_t getRefineTimeLimit() const;
+                bool isRefineMemoryLimitSet() const;
+                uint64_t getRefineMemoryLimit() const;
                 
                 /// Discretization Resolution
                 uint64_t getResolutionInit() const;
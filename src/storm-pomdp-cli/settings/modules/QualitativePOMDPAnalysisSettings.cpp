@@ -25,7 +25,7 @@ namespace storm {
             const std::string preventGraphPreprocessing = "nographprocessing";
             const std::string beliefSupportMCOption = "belsupmc";
             const std::string memlessSearchOption = "memlesssearch";
-            std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative"};
+            std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative", "portfolio"};
 
 
 
@@ -26,6 +26,7 @@
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 
 #include "storm/api/storm.h"
@@ -156,6 +157,7 @@ namespace storm {
                 storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
                         formula.asProbabilityOperatorFormula());
                 pomdp.getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+                pomdp.resetAnalysisCache();
                 storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula.asProbabilityOperatorFormula());
                 bool computedSomething = false;
                 if (qualSettings.isMemlessSearchSet()) {
@@ -243,6 +245,29 @@ namespace storm {
                             search.getStatistics().print();
                         }
 
+                    } else if (qualSettings.getMemlessSearchMethod() == "portfolio") {
+                        // Several iterative searches with different lookahead encodings run concurrently and share their winning regions.
+                        auto configurations = storm::pomdp::PolicySearchPortfolio<ValueType>::createConfigurations(fillMemlessSearchOptionsFromSettings());
+                        storm::pomdp::PolicySearchPortfolio<ValueType> portfolio(pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory,
+                                                                                 configurations);
+                        if (qualSettings.isWinningRegionSet()) {
+                            portfolio.computeWinningRegion(lookahead);
+                        } else if (portfolio.analyzeForInitialStates(lookahead)) {
+                            STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target.\n");
+                        } else {
+                            STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target.\n");
+                        }
+                        if (qualSettings.isPrintWinningRegionSet()) {
+                            portfolio.getLastWinningRegion().print();
+                            std::cout << '\n';
+                        }
+                        if (qualSettings.isExportWinningRegionSet()) {
+                            std::size_t hash = pomdp.hash();
+                            portfolio.getLastWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(), "model hash: " + std::to_string(hash));
+                        }
+                        if (coreSettings.isShowStatisticsSet()) {
+                            portfolio.printStatistics();
+                        }
                     } else {
                         STORM_LOG_ERROR("This method is not implemented.");
                     }
@@ -269,6 +294,13 @@ namespace storm {
                     auto const& beliefExplorationSettings = storm::settings::getModule<storm::settings::modules::BeliefExplorationSettings>();
                     beliefExplorationSettings.setValuesInOptionsStruct(options);
                     storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(pomdp, options);
+                    if (beliefExplorationSettings.isRefineBudgetSet()) {
+                        // Report intermediate results
+                        checker.setBoundsCallback([](ValueType const& lowerBound, ValueType const& upperBound) {
+                            STORM_PRINT_AND_LOG("\nIntermediate result: ");
+                            printResult(lowerBound, upperBound);
+                        });
+                    }
                     auto result = checker.check(formula);
                     checker.printStatisticsToStream(std::cout);
                     if (storm::utility::resources::isTerminate()) {
@@ -503,6 +535,7 @@ int main(const int argc, const char** argv) {
         }
         storm::utility::Stopwatch totalTimer(true);
         storm::cli::setUrgentOptions();
+        storm::cli::setUpProfiling();
 
         // Invoke storm-pomdp with obtained settings
         storm::pomdp::cli::processOptions();
@@ -511,6 +544,7 @@ int main(const int argc, const char** argv) {
         if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
             storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
         }
+        storm::cli::exportProfile();
 
     // All operations have now been performed, so we clean up everything and terminate.
         storm::utility::cleanUp();
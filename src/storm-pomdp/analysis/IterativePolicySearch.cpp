@@ -40,6 +40,7 @@ namespace storm {
             STORM_PRINT_AND_LOG("#STATS SAT Calls time: " << smtCheckTimer << '\n');
             STORM_PRINT_AND_LOG("#STATS Outer iterations: " << outerIterations << '\n');
             STORM_PRINT_AND_LOG("#STATS Solver initialization time: " << initializeSolverTimer << '\n');
+            STORM_PRINT_AND_LOG("#STATS Restarts that kept the encoding: " << reusedEncodings << '\n');
             STORM_PRINT_AND_LOG("#STATS Obtain partial scheduler time: " << evaluateExtensionSolverTime << '\n' );
             STORM_PRINT_AND_LOG("#STATS Update solver to extend partial scheduler time: " << encodeExtensionSolverTime << '\n');
             STORM_PRINT_AND_LOG("#STATS Update solver with new scheduler time: " << updateNewStrategySolverTime << '\n');
@@ -393,11 +394,28 @@ namespace storm {
             STORM_LOG_DEBUG("Target states " << targetStates);
             STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
             stats.initializeSolverTimer.start();
-            // TODO: When do we need to reinitialize? When the solver has been reset.
-            bool lookaheadConstraintsRequired = initialize(k);
-            if(lookaheadConstraintsRequired) {
-                maxK = k;
+            if (sharedWinningRegion) {
+                synchronizeWinningRegion();
             }
+            bool lookaheadConstraintsRequired;
+            if (encodingIsValid && encodedLookahead == k && encodedTargetStates == targetStates) {
+                // Only remove the constraints of the previous analysis.
+                smtSolver->pop();
+                lookaheadConstraintsRequired = encodingRequiresLookahead;
+                stats.incrementReusedEncodings();
+            } else {
+                smtSolver->reset();
+                lookaheadConstraintsRequired = initialize(k);
+                if(lookaheadConstraintsRequired) {
+                    maxK = k;
+                }
+                encodingIsValid = true;
+                encodingRequiresLookahead = lookaheadConstraintsRequired;
+                encodedLookahead = k;
+                encodedTargetStates = targetStates;
+            }
+            // The constraints that depend on the winning region are added on top of the encoding.
+            smtSolver->push();
 
             stats.winningRegionUpdatesTimer.start();
             storm::storage::BitVector updated(pomdp.getNrObservations());
@@ -539,6 +557,11 @@ namespace storm {
 
             bool foundWhatWeLookFor = false;
             while(true) {
+                if (sharedWinningRegion && sharedWinningRegion->isDone()) {
+                    STORM_LOG_INFO("Stop search as another search found what we look for.");
+                    smtSolver->pop();
+                    break;
+                }
                 stats.incrementOuterIterations();
                 // TODO consider what we really want to store about the schedulers.
                 scheduler.reset(pomdp.getNrObservations(), maximalNrActions);
@@ -685,6 +708,7 @@ namespace storm {
                     //smtSolver->setTimeout(options.extensionCallTimeout);
                 }
                 if (!newSchedulerDiscovered) {
+                    smtSolver->pop();
                     break;
                 }
                 //smtSolver->unsetTimeout();
@@ -730,6 +754,11 @@ namespace storm {
                     }
                 }
                 stats.winningRegionUpdatesTimer.stop();
+                if (sharedWinningRegion && synchronizeWinningRegion() && !foundWhatWeLookFor) {
+                    // Restart such that the progress of the other searches is taken into account.
+                    reset();
+                    return analyze(k, ~targetStates & ~surelyReachSinkStates, allOfTheseStates);
+                }
                 if (foundWhatWeLookFor) {
                     return true;
                 }
@@ -871,6 +900,9 @@ namespace storm {
                 validator->validateIsMaximal(surelyReachSinkStates);
             }
 
+            if (sharedWinningRegion) {
+                synchronizeWinningRegion();
+            }
             if (!allOfTheseStates.empty()) {
                 for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
                     storm::storage::BitVector check(statesPerObservation[observation].size());
@@ -916,6 +948,23 @@ namespace storm {
             return stats;
         }
 
+        template <typename ValueType>
+        bool IterativePolicySearch<ValueType>::synchronizeWinningRegion() {
+            stats.winningRegionUpdatesTimer.start();
+            bool changed = sharedWinningRegion->synchronize(winningRegion, sharedWinningRegionVersion);
+            if (changed) {
+                for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+                    if (winningRegion.observationIsWinning(observation)) {
+                        for (uint64_t state : statesPerObservation[observation]) {
+                            targetStates.set(state);
+                        }
+                    }
+                }
+            }
+            stats.winningRegionUpdatesTimer.stop();
+            return changed;
+        }
+
         template <typename ValueType>
         bool IterativePolicySearch<ValueType>::smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions) {
             if(options.isExportSATSet()) {
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <vector>
 #include <sstream>
 #include "storm/storage/expressions/Expressions.h"
@@ -7,6 +9,7 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/exceptions/UnexpectedException.h"
 
+#include "storm-pomdp/analysis/SharedWinningRegion.h"
 #include "storm-pomdp/analysis/WinningRegion.h"
 #include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
 
@@ -16,7 +19,7 @@ namespace pomdp {
     enum class MemlessSearchPathVariables {
         BooleanRanking, IntegerRanking, RealRanking
     };
-    MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+    inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
         if(in == "int") {
             return MemlessSearchPathVariables::IntegerRanking;
         } else if (in == "real") {
@@ -156,10 +159,15 @@ namespace pomdp {
                 void incrementGraphBasedWinningObservations() {
                     graphBasedAnalysisWinOb++;
                 }
+
+                void incrementReusedEncodings() {
+                    reusedEncodings++;
+                }
         private:
                 uint64_t satCalls = 0;
                 uint64_t outerIterations = 0;
                 uint64_t graphBasedAnalysisWinOb = 0;
+                uint64_t reusedEncodings = 0;
         };
 
         IterativePolicySearch(storm::models::sparse::Pomdp<ValueType> const& pomdp,
@@ -189,6 +197,15 @@ namespace pomdp {
             return winningRegion;
         }
 
+        /*!
+         * Shares the winning region with other searches (that may run concurrently).
+         * The search adds its progress to the shared region after every iteration and restarts whenever other searches extended it.
+         * It stops once the shared region is marked as done.
+         */
+        void setSharedWinningRegion(std::shared_ptr<SharedWinningRegion> const& sharedRegion) {
+            sharedWinningRegion = sharedRegion;
+        }
+
         uint64_t getOffsetFromObservation(uint64_t state, uint64_t observation) const;
 
         bool analyze(uint64_t k, storm::storage::BitVector const& oneOfTheseStates, storm::storage::BitVector const& allOfTheseStates = storm::storage::BitVector());
@@ -202,9 +219,7 @@ namespace pomdp {
             STORM_LOG_INFO("Reset solver to restart with current winning region");
             schedulerForObs.clear();
             finalSchedulers.clear();
-            smtSolver->reset();
-
-
+            // The solver itself is reset in analyze, unless the encoding of the POMDP can be kept.
         }
         void printScheduler(std::vector<InternalObservationScheduler> const& );
         void printCoveredStates(storm::storage::BitVector const& remaining) const;
@@ -213,6 +228,12 @@ namespace pomdp {
 
         bool smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions = {});
 
+        /*!
+         * Exchanges the winning region with the shared region. Observations that became winning are added to the target states.
+         * @return true if the winning region of this search changed.
+         */
+        bool synchronizeWinningRegion();
+
 
         std::unique_ptr<storm::solver::SmtSolver> smtSolver;
         storm::models::sparse::Pomdp<ValueType> const& pomdp;
@@ -254,6 +275,16 @@ namespace pomdp {
         std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory;
         std::shared_ptr<WinningRegionQueryInterface<ValueType>> validator;
 
+        std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+        uint64_t sharedWinningRegionVersion = 0;
+
+        // The encoding of the POMDP only depends on the target states and the lookahead. As long as these do not change,
+        // restarts keep the encoding (and what the solver learned from it) and only remove the constraints on top.
+        bool encodingIsValid = false;
+        bool encodingRequiresLookahead = false;
+        uint64_t encodedLookahead = 0;
+        storm::storage::BitVector encodedTargetStates;
+
         mutable  bool useFindOffset = false;
 
 
@@ -0,0 +1,129 @@
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
+
+#include <exception>
+#include <thread>
+
+namespace storm {
+    namespace pomdp {
+        namespace detail {
+            std::string toString(MemlessSearchPathVariables pathVariableType) {
+                switch (pathVariableType) {
+                    case MemlessSearchPathVariables::BooleanRanking:
+                        return "bool";
+                    case MemlessSearchPathVariables::IntegerRanking:
+                        return "int";
+                    case MemlessSearchPathVariables::RealRanking:
+                        return "real";
+                }
+                return "unknown";
+            }
+        }
+
+        template<typename ValueType>
+        PolicySearchPortfolio<ValueType>::PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                                                storm::storage::BitVector const& targetStates,
+                                                                storm::storage::BitVector const& surelyReachSinkStates,
+                                                                std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory,
+                                                                std::vector<MemlessSearchOptions> const& configurations) :
+            configurations(configurations)
+        {
+            STORM_LOG_THROW(!configurations.empty(), storm::exceptions::UnexpectedException, "The portfolio needs at least one configuration.");
+            std::vector<uint64_t> nrStatesPerObservation(pomdp.getNrObservations(), 0);
+            for (auto obs : pomdp.getObservations()) {
+                ++nrStatesPerObservation[obs];
+            }
+            sharedWinningRegion = std::make_shared<SharedWinningRegion>(nrStatesPerObservation);
+            winningRegion = WinningRegion(nrStatesPerObservation);
+            for (auto const& options : configurations) {
+                searches.push_back(std::make_unique<IterativePolicySearch<ValueType>>(pomdp, targetStates, surelyReachSinkStates, smtSolverFactory, options));
+                searches.back()->setSharedWinningRegion(sharedWinningRegion);
+            }
+        }
+
+        template<typename ValueType>
+        std::vector<MemlessSearchOptions> PolicySearchPortfolio<ValueType>::createConfigurations(MemlessSearchOptions const& options) {
+            std::vector<MemlessSearchOptions> result = {options};
+            for (auto pathVariableType : {MemlessSearchPathVariables::RealRanking, MemlessSearchPathVariables::IntegerRanking}) {
+                if (pathVariableType != options.pathVariableType) {
+                    result.push_back(options);
+                    result.back().pathVariableType = pathVariableType;
+                }
+            }
+            if (!options.onlyDeterministicStrategies) {
+                // Deterministic policies are found faster but may win from fewer belief supports.
+                result.push_back(options);
+                result.back().onlyDeterministicStrategies = true;
+            }
+            if (options.isExportSATSet()) {
+                // Each search exports its calls separately.
+                for (uint64_t index = 0; index < result.size(); ++index) {
+                    result[index].setExportSATCalls(options.getExportSATCallsPath() + "search" + std::to_string(index) + "_");
+                }
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        bool PolicySearchPortfolio<ValueType>::analyzeForInitialStates(uint64_t k) {
+            return run(k, true);
+        }
+
+        template<typename ValueType>
+        void PolicySearchPortfolio<ValueType>::computeWinningRegion(uint64_t k) {
+            run(k, false);
+        }
+
+        template<typename ValueType>
+        bool PolicySearchPortfolio<ValueType>::run(uint64_t k, bool onlyInitialStates) {
+            STORM_LOG_INFO("Run a portfolio of " << searches.size() << " policy searches.");
+            sharedWinningRegion->setDone(false);
+            std::atomic<bool> found(false);
+            std::vector<std::exception_ptr> exceptions(searches.size());
+            std::vector<std::thread> threads;
+            for (uint64_t index = 0; index < searches.size(); ++index) {
+                threads.emplace_back([&, index]() {
+                    try {
+                        if (onlyInitialStates) {
+                            if (searches[index]->analyzeForInitialStates(k)) {
+                                found = true;
+                                sharedWinningRegion->setDone();
+                            }
+                        } else {
+                            searches[index]->computeWinningRegion(k);
+                        }
+                    } catch (...) {
+                        exceptions[index] = std::current_exception();
+                        sharedWinningRegion->setDone();
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+            winningRegion = sharedWinningRegion->getWinningRegion();
+            return found;
+        }
+
+        template<typename ValueType>
+        WinningRegion const& PolicySearchPortfolio<ValueType>::getLastWinningRegion() const {
+            return winningRegion;
+        }
+
+        template<typename ValueType>
+        void PolicySearchPortfolio<ValueType>::printStatistics() const {
+            for (uint64_t index = 0; index < searches.size(); ++index) {
+                STORM_PRINT_AND_LOG("#STATS Search " << index << " (lookahead type: " << detail::toString(configurations[index].pathVariableType)
+                                                     << (configurations[index].onlyDeterministicStrategies ? ", deterministic" : "") << ")\n");
+                searches[index]->getStatistics().print();
+            }
+        }
+
+        template class PolicySearchPortfolio<double>;
+        template class PolicySearchPortfolio<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/SharedWinningRegion.h"
+
+namespace storm {
+    namespace pomdp {
+        /*!
+         * Runs several iterative policy searches with different configurations concurrently.
+         * Every search uses its own SMT solver. The searches share their winning regions as they grow.
+         */
+        template<typename ValueType>
+        class PolicySearchPortfolio {
+        public:
+            PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp,
+                                  storm::storage::BitVector const& targetStates,
+                                  storm::storage::BitVector const& surelyReachSinkStates,
+                                  std::shared_ptr<storm::utility::solver::SmtSolverFactory>& smtSolverFactory,
+                                  std::vector<MemlessSearchOptions> const& configurations);
+
+            /*!
+             * Creates configurations that extend the given one with different encodings of the lookahead.
+             */
+            static std::vector<MemlessSearchOptions> createConfigurations(MemlessSearchOptions const& options);
+
+            /*!
+             * Runs the searches until one of them finds a policy that wins from the initial states or all of them are done.
+             * @return true if such a policy has been found.
+             */
+            bool analyzeForInitialStates(uint64_t k);
+
+            /*!
+             * Runs all searches until they are done. The winning region is the union of the winning regions found by the searches.
+             */
+            void computeWinningRegion(uint64_t k);
+
+            WinningRegion const& getLastWinningRegion() const;
+
+            void printStatistics() const;
+
+        private:
+            /*!
+             * Runs the searches, each in its own thread.
+             * @return true if a search found a policy that wins from the initial states (if only these are considered).
+             */
+            bool run(uint64_t k, bool onlyInitialStates);
+
+            std::vector<MemlessSearchOptions> configurations;
+            std::vector<std::unique_ptr<IterativePolicySearch<ValueType>>> searches;
+            std::shared_ptr<SharedWinningRegion> sharedWinningRegion;
+            WinningRegion winningRegion;
+        };
+    }
+}
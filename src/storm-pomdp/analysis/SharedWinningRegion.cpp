@@ -0,0 +1,35 @@
+#include "storm-pomdp/analysis/SharedWinningRegion.h"
+
+namespace storm {
+    namespace pomdp {
+        SharedWinningRegion::SharedWinningRegion(std::vector<uint64_t> const& observationSizes) : winningRegion(observationSizes), version(0), done(false) {
+            // Intentionally left empty.
+        }
+
+        bool SharedWinningRegion::synchronize(WinningRegion& localRegion, uint64_t& localVersion) {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool localChanged = false;
+            if (localVersion != version) {
+                localChanged = localRegion.merge(winningRegion);
+            }
+            if (winningRegion.merge(localRegion)) {
+                ++version;
+            }
+            localVersion = version;
+            return localChanged;
+        }
+
+        WinningRegion SharedWinningRegion::getWinningRegion() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return winningRegion;
+        }
+
+        void SharedWinningRegion::setDone(bool value) {
+            done = value;
+        }
+
+        bool SharedWinningRegion::isDone() const {
+            return done;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "storm-pomdp/analysis/WinningRegion.h"
+
+namespace storm {
+    namespace pomdp {
+        /*!
+         * A winning region that several policy searches (possibly running concurrently) contribute to.
+         * Any union of winning regions is again winning, so the searches exchange what they found so far.
+         */
+        class SharedWinningRegion {
+        public:
+            SharedWinningRegion(std::vector<uint64_t> const& observationSizes);
+
+            /*!
+             * Adds the given local region to the shared region and vice versa.
+             * @param localRegion the region of the calling search.
+             * @param version the version of the shared region that the local region already contains. Is set to the current version.
+             * @return true if the local region changed.
+             */
+            bool synchronize(WinningRegion& localRegion, uint64_t& version);
+
+            WinningRegion getWinningRegion() const;
+
+            /*!
+             * Signals the searches that they can stop (e.g., because one of them found what we look for).
+             */
+            void setDone(bool value = true);
+            bool isDone() const;
+
+        private:
+            mutable std::mutex mutex;
+            WinningRegion winningRegion;
+            // Increased whenever the shared region changes.
+            uint64_t version;
+            std::atomic<bool> done;
+        };
+    }
+}
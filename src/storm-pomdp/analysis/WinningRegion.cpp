@@ -66,6 +66,19 @@ namespace pomdp {
 
     }
 
+    bool WinningRegion::merge(WinningRegion const& other) {
+        assert(observationSizes == other.observationSizes);
+        bool changed = false;
+        for (uint64_t observation = 0; observation < winningRegion.size(); ++observation) {
+            for (auto const& support : other.winningRegion[observation]) {
+                if (update(observation, support)) {
+                    changed = true;
+                }
+            }
+        }
+        return changed;
+    }
+
     bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
         for(storm::storage::BitVector winning : winningRegion[observation]) {
             if(currently.isSubsetOf(winning)) {
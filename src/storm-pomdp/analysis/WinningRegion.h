@@ -1,7 +1,9 @@
 #pragma once
 
 #include <vector>
+#include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
 
 namespace storm {
     namespace pomdp {
@@ -10,6 +12,11 @@ namespace storm {
             WinningRegion(std::vector<uint64_t> const& observationSizes = {});
 
             bool update(uint64_t observation, storm::storage::BitVector const& winning);
+            /*!
+             * Adds all winning supports of the given region (for the same POMDP) to this region.
+             * @return true if this region changed.
+             */
+            bool merge(WinningRegion const& other);
             bool query(uint64_t observation, storm::storage::BitVector const& currently) const;
             bool isWinning(uint64_t observation, uint64_t offset) const {
                 assert(observation < observationSizes.size());
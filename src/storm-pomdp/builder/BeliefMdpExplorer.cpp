@@ -151,6 +151,20 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefsOfUpcomingNewStates(uint64_t numberOfStates) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            auto end = mdpStatesToExplore.begin() + std::min<uint64_t>(numberOfStates, mdpStatesToExplore.size());
+            for (auto stateIt = mdpStatesToExplore.begin(); stateIt != end; ++stateIt) {
+                bool hasOldBehavior = exploredMdp && *stateIt < exploredMdp->getNumberOfStates();
+                if (mdpStateToBeliefIdMap[*stateIt] != beliefManager->noId() && (!hasOldBehavior || exploredMdp->getStateLabeling().getStateHasLabel("truncated", *stateIt))) {
+                    result.push_back(mdpStateToBeliefIdMap[*stateIt]);
+                }
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
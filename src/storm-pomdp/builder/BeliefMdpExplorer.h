@@ -58,6 +58,13 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs of the states among the given number of states at the front of the exploration queue that will be explored from scratch,
+             * i.e., states without behavior from a previous exploration or whose previous behavior was truncated.
+             * These can be passed to BeliefManager::prefetchExpansions.
+             */
+            std::vector<BeliefId> getBeliefsOfUpcomingNewStates(uint64_t numberOfStates) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
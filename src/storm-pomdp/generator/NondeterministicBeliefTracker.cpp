@@ -5,6 +5,7 @@
 #include "storm/storage/geometry/ReduceVertexCloud.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace generator {
@@ -20,6 +21,7 @@ namespace storm {
                 statePerObservationAndOffset[pomdp.getObservation(state)].push_back(state);
                 observationOffsetId.push_back(statePerObservationAndOffset[pomdp.getObservation(state)].size() - 1);
             }
+            observationSlices.resize(pomdp.getNrObservations());
         }
 
         template<typename ValueType>
@@ -54,8 +56,45 @@ namespace storm {
 
         template<typename ValueType>
         uint64_t BeliefStateManager<ValueType>::getFreshId() {
-            beliefIdCounter++;
-            return beliefIdCounter;
+            return ++beliefIdCounter;
+        }
+
+        template<typename ValueType>
+        void BeliefStateManager<ValueType>::prepareObservationSlice(uint32_t observation) {
+            STORM_LOG_ASSERT(observation < observationSlices.size(), "Observation " << observation << " not an observation id");
+            if (observationSlices[observation]) {
+                return;
+            }
+            auto slice = std::make_unique<ObservationSlice>();
+            auto const& transitionMatrix = pomdp.getTransitionMatrix();
+            slice->rowIndications.reserve(transitionMatrix.getRowCount() + 1);
+            slice->rowIndications.push_back(0);
+            for (uint64_t row = 0; row < transitionMatrix.getRowCount(); ++row) {
+                for (auto const& transition : transitionMatrix.getRow(row)) {
+                    if (pomdp.getObservation(transition.getColumn()) == observation) {
+                        slice->entries.emplace_back(transition.getColumn(), transition.getValue());
+                    }
+                }
+                slice->rowIndications.push_back(slice->entries.size());
+            }
+            observationSlices[observation] = std::move(slice);
+        }
+
+        template<typename ValueType>
+        typename BeliefStateManager<ValueType>::ObservationSlice const& BeliefStateManager<ValueType>::getObservationSlice(uint32_t observation) const {
+            STORM_LOG_ASSERT(observation < observationSlices.size() && observationSlices[observation],
+                             "Slice of observation " << observation << " not prepared");
+            return *observationSlices[observation];
+        }
+
+        template<typename ValueType>
+        void BeliefStateManager<ValueType>::setPruningThreshold(ValueType const& threshold) {
+            pruningThreshold = threshold;
+        }
+
+        template<typename ValueType>
+        ValueType const& BeliefStateManager<ValueType>::getPruningThreshold() const {
+            return pruningThreshold;
         }
 
         template<typename ValueType>
@@ -156,7 +195,80 @@ namespace storm {
 
         template<typename ValueType>
         void SparseBeliefState<ValueType>::update(uint32_t newObservation, std::unordered_set<SparseBeliefState<ValueType>>& previousBeliefs) const {
-            updateHelper({{}}, {storm::utility::zero<ValueType>()}, belief.begin(), newObservation, previousBeliefs);
+            typedef std::vector<std::pair<uint64_t, ValueType>> PartialBelief;
+            auto const& slice = manager->getObservationSlice(newObservation);
+            auto const& rowGroupIndices = manager->getPomdp().getNondeterministicChoiceIndices();
+
+            // Each state of the belief can take each of its choices, so we combine the (unnormalized) successors of the choices state by state.
+            // The partial beliefs are sorted by the successor states. Partial beliefs that coincide yield the same beliefs, so we only keep them once.
+            std::vector<PartialBelief> partialBeliefs(1);
+            std::vector<PartialBelief> newPartialBeliefs;
+            for (auto const& beliefEntry : belief) {
+                newPartialBeliefs.clear();
+                for (auto const& partialBelief : partialBeliefs) {
+                    for (uint64_t row = rowGroupIndices[beliefEntry.first]; row < rowGroupIndices[beliefEntry.first + 1]; ++row) {
+                        newPartialBeliefs.emplace_back();
+                        PartialBelief& newPartialBelief = newPartialBeliefs.back();
+                        newPartialBelief.reserve(partialBelief.size() + slice.rowIndications[row + 1] - slice.rowIndications[row]);
+                        auto partialIt = partialBelief.begin();
+                        auto transitionIt = slice.entries.begin() + slice.rowIndications[row];
+                        auto transitionIte = slice.entries.begin() + slice.rowIndications[row + 1];
+                        while (partialIt != partialBelief.end() || transitionIt != transitionIte) {
+                            if (transitionIt == transitionIte || (partialIt != partialBelief.end() && partialIt->first < transitionIt->first)) {
+                                newPartialBelief.push_back(*partialIt);
+                                ++partialIt;
+                            } else if (partialIt == partialBelief.end() || transitionIt->first < partialIt->first) {
+                                newPartialBelief.emplace_back(transitionIt->first, transitionIt->second * beliefEntry.second);
+                                ++transitionIt;
+                            } else {
+                                newPartialBelief.emplace_back(partialIt->first, partialIt->second + transitionIt->second * beliefEntry.second);
+                                ++partialIt;
+                                ++transitionIt;
+                            }
+                        }
+                    }
+                }
+                std::sort(newPartialBeliefs.begin(), newPartialBeliefs.end());
+                newPartialBeliefs.erase(std::unique(newPartialBeliefs.begin(), newPartialBeliefs.end()), newPartialBeliefs.end());
+                std::swap(partialBeliefs, newPartialBeliefs);
+            }
+
+            ValueType const& pruningThreshold = manager->getPruningThreshold();
+            for (auto const& partialBelief : partialBeliefs) {
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (auto const& entry : partialBelief) {
+                    sum += entry.second;
+                }
+                if (storm::utility::isZero(sum)) {
+                    continue;
+                }
+
+                // Remove the entries below the threshold, unless this would remove all entries.
+                ValueType keptSum = storm::utility::zero<ValueType>();
+                for (auto const& entry : partialBelief) {
+                    if (!(entry.second / sum < pruningThreshold)) {
+                        keptSum += entry.second;
+                    }
+                }
+                bool prune = !storm::utility::isZero(keptSum);
+                if (!prune) {
+                    keptSum = sum;
+                }
+
+                std::size_t newHash = 0;
+                ValueType risk = storm::utility::zero<ValueType>();
+                std::map<uint64_t, ValueType> finalBelief;
+                for (auto const& entry : partialBelief) {
+                    if (prune && entry.second / sum < pruningThreshold) {
+                        continue;
+                    }
+                    ValueType probability = entry.second / keptSum;
+                    finalBelief.emplace_hint(finalBelief.end(), entry.first, probability);
+                    boost::hash_combine(newHash, entry.first);
+                    risk += probability * manager->getRisk(entry.first);
+                }
+                previousBeliefs.insert(SparseBeliefState<ValueType>(manager, finalBelief, newHash, risk, id));
+            }
         }
 
         template<typename ValueType>
@@ -177,61 +289,6 @@ namespace storm {
             }
         }
 
-        template<typename ValueType>
-        void SparseBeliefState<ValueType>::updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums, typename std::map<uint64_t, ValueType>::const_iterator nextStateIt, uint32_t newObservation, std::unordered_set<SparseBeliefState<ValueType>>& previousBeliefs) const {
-            if(nextStateIt == belief.end()) {
-                for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-                    auto const& partialBelief = partialBeliefs[i];
-                    auto const& sum = sums[i];
-                    if (storm::utility::isZero(sum)) {
-                        continue;
-                    }
-                    std::size_t newHash = 0;
-                    ValueType risk = storm::utility::zero<ValueType>();
-                    std::map<uint64_t, ValueType> finalBelief;
-                    for (auto &entry : partialBelief) {
-                        assert(!storm::utility::isZero(sum));
-                        finalBelief[entry.first] = entry.second / sum;
-                        //boost::hash_combine(newHash, std::hash<ValueType>()(entry.second));
-                        boost::hash_combine(newHash, entry.first);
-                        risk += entry.second / sum * manager->getRisk(entry.first);
-                    }
-                    previousBeliefs.insert(SparseBeliefState<ValueType>(manager, finalBelief, newHash, risk, id));
-                }
-            } else {
-                uint64_t state = nextStateIt->first;
-                auto newNextStateIt = nextStateIt;
-                newNextStateIt++;
-                std::vector<std::map<uint64_t, ValueType>> newPartialBeliefs;
-                std::vector<ValueType> newSums;
-                for (uint64_t i = 0; i < partialBeliefs.size(); ++i) {
-
-                    for (auto row = manager->getPomdp().getNondeterministicChoiceIndices()[state];
-                         row < manager->getPomdp().getNondeterministicChoiceIndices()[state + 1]; ++row) {
-                        std::map<uint64_t, ValueType> newPartialBelief = partialBeliefs[i];
-                        ValueType newSum = sums[i];
-                        for (auto const &transition : manager->getPomdp().getTransitionMatrix().getRow(row)) {
-                            if (newObservation != manager->getPomdp().getObservation(transition.getColumn())) {
-                                continue;
-                            }
-
-                            if (newPartialBelief.count(transition.getColumn()) == 0) {
-                                newPartialBelief[transition.getColumn()] = transition.getValue() * nextStateIt->second;
-                            } else {
-                                newPartialBelief[transition.getColumn()] += transition.getValue() * nextStateIt->second;
-                            }
-                            newSum += transition.getValue() * nextStateIt->second;
-
-                        }
-                        newPartialBeliefs.push_back(newPartialBelief);
-                        newSums.push_back(newSum);
-                    }
-                }
-                updateHelper(newPartialBeliefs, newSums, newNextStateIt, newObservation, previousBeliefs);
-
-            }
-        }
-
         template<typename ValueType>
         bool operator==(ObservationDenseBeliefState<ValueType> const& lhs, ObservationDenseBeliefState<ValueType> const& rhs) {
             if (lhs.hash() != rhs.hash()) {
@@ -408,17 +465,69 @@ namespace storm {
             STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Cannot track without a belief (need to reset).");
             std::unordered_set<BeliefState> newBeliefs;
             storm::utility::Stopwatch trackTimer(true);
-            for (auto const& belief : beliefs) {
-                belief.update(newObservation, newBeliefs);
-                if (options.trackTimeOut > 0 && static_cast<uint64_t>(trackTimer.getTimeInMilliseconds()) > options.trackTimeOut) {
+            // Observations that the POMDP does not have lead to no beliefs.
+            if (newObservation < pomdp.getNrObservations()) {
+                manager->setPruningThreshold(options.pruningThreshold);
+                manager->prepareObservationSlice(newObservation);
+
+                // The beliefs are updated independently, where every thread collects the new beliefs in its own set.
+                std::vector<BeliefState const*> currentBeliefs;
+                currentBeliefs.reserve(beliefs.size());
+                for (auto const& belief : beliefs) {
+                    currentBeliefs.push_back(&belief);
+                }
+                uint64_t numberOfThreads = std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(options.numberOfThreads), currentBeliefs.size());
+                std::vector<std::unordered_set<BeliefState>> newBeliefsOfOtherThreads(numberOfThreads - 1);
+                std::atomic<bool> timedOut(false);
+                auto updateBeliefs = [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+                    std::unordered_set<BeliefState>& threadBeliefs = threadIndex == 0 ? newBeliefs : newBeliefsOfOtherThreads[threadIndex - 1];
+                    for (uint64_t index = chunkBegin; index < chunkEnd && !timedOut; ++index) {
+                        currentBeliefs[index]->update(newObservation, threadBeliefs);
+                        if (options.trackTimeOut > 0 && static_cast<uint64_t>(trackTimer.getTimeInMilliseconds()) > options.trackTimeOut) {
+                            timedOut = true;
+                        }
+                    }
+                };
+                storm::utility::parallel::forEachChunk(0, currentBeliefs.size(), 1, numberOfThreads, updateBeliefs);
+                if (timedOut) {
                     return false;
                 }
+                for (auto& threadBeliefs : newBeliefsOfOtherThreads) {
+                    newBeliefs.insert(threadBeliefs.begin(), threadBeliefs.end());
+                }
             }
-            beliefs = newBeliefs;
+            beliefs = std::move(newBeliefs);
+            boundBeliefs();
             lastObservation = newObservation;
+
+            trackTimer.stop();
+            uint64_t time = trackTimer.getTimeInNanoseconds();
+            ++statistics.numberOfSteps;
+            statistics.totalTime += time;
+            statistics.maximalTime = std::max(statistics.maximalTime, time);
+            statistics.lastTime = time;
+            statistics.maximalNumberOfBeliefs = std::max<uint64_t>(statistics.maximalNumberOfBeliefs, beliefs.size());
+            STORM_LOG_DEBUG("Tracked observation " << newObservation << " with " << beliefs.size() << " beliefs in " << time / 1000 << "us.");
             return !beliefs.empty();
         }
 
+        template<typename ValueType, typename BeliefState>
+        void NondeterministicBeliefTracker<ValueType, BeliefState>::boundBeliefs() {
+            if (options.maximalNumberOfBeliefs == 0 || beliefs.size() <= options.maximalNumberOfBeliefs) {
+                return;
+            }
+            std::vector<typename std::unordered_set<BeliefState>::const_iterator> iterators;
+            iterators.reserve(beliefs.size());
+            for (auto it = beliefs.begin(); it != beliefs.end(); ++it) {
+                iterators.push_back(it);
+            }
+            std::nth_element(iterators.begin(), iterators.begin() + options.maximalNumberOfBeliefs, iterators.end(),
+                             [](auto const& lhs, auto const& rhs) { return lhs->getRisk() > rhs->getRisk(); });
+            for (auto it = iterators.begin() + options.maximalNumberOfBeliefs; it != iterators.end(); ++it) {
+                beliefs.erase(*it);
+            }
+        }
+
         template<typename ValueType, typename BeliefState>
         ValueType NondeterministicBeliefTracker<ValueType, BeliefState>::getCurrentRisk(bool max) {
             STORM_LOG_THROW(!beliefs.empty(), storm::exceptions::InvalidOperationException, "Risk is only defined for beliefs (run reset() first).");
@@ -501,6 +610,11 @@ namespace storm {
             return reductionTimedOut;
         }
 
+        template<typename ValueType, typename BeliefState>
+        typename NondeterministicBeliefTracker<ValueType, BeliefState>::Statistics const& NondeterministicBeliefTracker<ValueType, BeliefState>::getStatistics() const {
+            return statistics;
+        }
+
 
         template class SparseBeliefState<double>;
         template bool operator==(SparseBeliefState<double> const&, SparseBeliefState<double> const&);
@@ -1,5 +1,9 @@
 #pragma once
+#include <atomic>
+#include <memory>
+#include <unordered_set>
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/utility/constants.h"
 
 namespace storm {
     namespace generator {
@@ -22,11 +26,36 @@ namespace storm {
             uint64_t getNumberOfStates() const;
             uint64_t numberOfStatesPerObservation(uint32_t observation) const;
 
+            /**
+             * The transitions of the POMDP restricted to the successors with a given observation.
+             * The entries of row r are the entries with indices rowIndications[r], ..., rowIndications[r+1]-1 (ordered by the successor).
+             */
+            struct ObservationSlice {
+                std::vector<uint64_t> rowIndications;
+                std::vector<std::pair<uint64_t, ValueType>> entries;
+            };
+            /**
+             * Computes the slice of the given observation unless it was computed before. Must not be called concurrently.
+             */
+            void prepareObservationSlice(uint32_t observation);
+            /**
+             * Get the slice of the given observation, which needs to be prepared before.
+             */
+            ObservationSlice const& getObservationSlice(uint32_t observation) const;
+
+            /**
+             * Probabilities below this threshold are removed from updated beliefs (which are then normalized again).
+             */
+            void setPruningThreshold(ValueType const& threshold);
+            ValueType const& getPruningThreshold() const;
+
         private:
             storm::models::sparse::Pomdp<ValueType> const& pomdp;
             std::vector<ValueType> riskPerState;
             std::vector<uint64_t> numberActionsPerObservation;
-            uint64_t beliefIdCounter = 0;
+            std::atomic<uint64_t> beliefIdCounter{0};
+            std::vector<std::unique_ptr<ObservationSlice>> observationSlices;
+            ValueType pruningThreshold = storm::utility::zero<ValueType>();
             std::vector<uint64_t> observationOffsetId;
             std::vector<std::vector<uint64_t>> statePerObservationAndOffset;
         };
@@ -45,7 +74,8 @@ namespace storm {
         public:
             SparseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, uint64_t state);
             /**
-             * Update the belief using the new observation
+             * Update the belief using the new observation. The slice of the observation needs to be prepared in the manager.
+             * Different beliefs can be updated concurrently (into different sets).
              * @param newObservation
              * @param previousBeliefs put the new belief in this set
              */
@@ -72,7 +102,6 @@ namespace storm {
 
             friend bool operator==<>(SparseBeliefState<ValueType> const& lhs, SparseBeliefState<ValueType> const& rhs);
         private:
-            void updateHelper(std::vector<std::map<uint64_t, ValueType>> const& partialBeliefs, std::vector<ValueType> const& sums, typename std::map<uint64_t, ValueType>::const_iterator nextStateIt, uint32_t newObservation, std::unordered_set<SparseBeliefState<ValueType>>& previousBeliefs) const;
             SparseBeliefState(std::shared_ptr<BeliefStateManager<ValueType>> const& manager, std::map<uint64_t, ValueType> const& belief, std::size_t newHash,  ValueType const& risk, uint64_t prevId);
             std::shared_ptr<BeliefStateManager<ValueType>> manager;
 
@@ -130,6 +159,20 @@ namespace storm {
                 uint64_t trackTimeOut = 0;
                 uint64_t timeOut = 0; // for reduction, in milliseconds, 0 is no timeout
                 ValueType wiggle; // tolerance, anything above 0 means that we are incomplete.
+                // probabilities below are removed from beliefs, anything above 0 means that we are incomplete.
+                ValueType pruningThreshold = storm::utility::zero<ValueType>();
+                uint64_t maximalNumberOfBeliefs = 0; // only the beliefs with the highest risk are kept, 0 is no bound.
+                uint64_t numberOfThreads = 1; // for updating the beliefs, 0 is auto-detect.
+            };
+            /**
+             * Statistics about the latency of the tracking steps (in nanoseconds).
+             */
+            struct Statistics {
+                uint64_t numberOfSteps = 0;
+                uint64_t totalTime = 0;
+                uint64_t maximalTime = 0;
+                uint64_t lastTime = 0;
+                uint64_t maximalNumberOfBeliefs = 0;
             };
             NondeterministicBeliefTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp, typename NondeterministicBeliefTracker<ValueType, BeliefState>::Options options = Options());
             /**
@@ -186,14 +229,25 @@ namespace storm {
              * @return
              */
             bool hasTimedOut() const;
+            /**
+             * Get the latency statistics of the tracking steps since construction.
+             * @return
+             */
+            Statistics const& getStatistics() const;
 
         private:
+            /**
+             * Only keep the beliefs with the highest risk, if more than the maximal number of beliefs are tracked.
+             */
+            void boundBeliefs();
+
             storm::models::sparse::Pomdp<ValueType> const& pomdp;
             std::shared_ptr<BeliefStateManager<ValueType>> manager;
             std::unordered_set<BeliefState> beliefs;
             bool reductionTimedOut = false;
             Options options;
             uint32_t lastObservation;
+            Statistics statistics;
         };
     }
 }
@@ -1,5 +1,6 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <algorithm>
 #include <tuple>
 
 #include <boost/algorithm/string.hpp>
@@ -24,6 +25,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
@@ -80,6 +82,29 @@ namespace storm {
                 cc = storm::utility::ConstantsComparator<ValueType>(storm::utility::convertNumber<ValueType>(this->options.numericPrecision), false);
             }
 
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::setBoundsCallback(std::function<void(ValueType const& lowerBound, ValueType const& upperBound)> const& callback) {
+                boundsCallback = callback;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::updateResult(Result& result, ValueType const& value, bool lowerBound) {
+                std::lock_guard<std::mutex> lock(resultMutex);
+                bool betterBound = lowerBound ? result.updateLowerBound(value) : result.updateUpperBound(value);
+                if (betterBound && boundsCallback) {
+                    boundsCallback(result.lowerBound, result.upperBound);
+                }
+                return betterBound;
+            }
+
+            template<typename PomdpModelType, typename BeliefValueType>
+            bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::isRefineBudgetExceeded(BeliefManagerType const& beliefManager) const {
+                if (options.refineTimeLimit && static_cast<uint64_t>(statistics.totalTime.getTimeInSeconds()) >= options.refineTimeLimit.get()) {
+                    return true;
+                }
+                return options.refineMemoryLimit && beliefManager.getApproximateMemoryUsage() / (1024 * 1024) >= options.refineMemoryLimit.get();
+            }
+
             template<typename PomdpModelType, typename BeliefValueType>
             typename BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::Result BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::check(storm::logic::Formula const& formula) {
                 STORM_LOG_ASSERT(options.unfold || options.discretize, "Invoked belief exploration but no task (unfold or discretize) given.");
@@ -235,6 +260,9 @@ namespace storm {
                         STORM_LOG_INFO(printInfo());
                         ValueType& resultValue = min ? result.lowerBound : result.upperBound;
                         resultValue = approx->getComputedValueAtInitialState();
+                        if (boundsCallback) {
+                            boundsCallback(result.lowerBound, result.upperBound);
+                        }
                     }
                 }
                 if (options.unfold) { // Underapproximation (uses a fresh Belief manager)
@@ -266,6 +294,9 @@ namespace storm {
                         STORM_LOG_INFO(printInfo());
                         ValueType& resultValue = min ? result.upperBound : result.lowerBound;
                         resultValue = approx->getComputedValueAtInitialState();
+                        if (boundsCallback) {
+                            boundsCallback(result.lowerBound, result.upperBound);
+                        }
                     }
                 }
             }
@@ -295,7 +326,7 @@ namespace storm {
                         return;
                     }
                     ValueType const& newValue = overApproximation->getComputedValueAtInitialState();
-                    bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
+                    bool betterBound = updateResult(result, newValue, min);
                     if (betterBound) {
                         STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'.\n");
                     }
@@ -322,7 +353,7 @@ namespace storm {
                         return;
                     }
                     ValueType const& newValue = underApproximation->getComputedValueAtInitialState();
-                    bool betterBound = min ? result.updateUpperBound(newValue) : result.updateLowerBound(newValue);
+                    bool betterBound = updateResult(result, newValue, !min);
                     if (betterBound) {
                         STORM_LOG_INFO("Under-approx result for refinement improved after " << statistics.totalTime << " seconds in refinement step #" << statistics.refinementSteps.get() << ". New value is '" << newValue << "'.\n");
                     }
@@ -351,11 +382,21 @@ namespace storm {
                 // Start refinement
                 STORM_LOG_WARN_COND(options.refineStepLimit.is_initialized() || !storm::utility::isZero(options.refinePrecision), "No termination criterion for refinement given. Consider to specify a steplimit, a non-zero precisionlimit, or a timeout");
                 STORM_LOG_WARN_COND(storm::utility::isZero(options.refinePrecision) || (options.unfold && options.discretize), "Refinement goal precision is given, but only one bound is going to be refined.");
+                // Refinement steps of the over- and under-approximation are independent of each other. With floating point numbers, they can be done concurrently
+                bool refineConcurrently = options.discretize && options.unfold && storm::utility::parallel::getDefaultNumberOfThreads() > 1 && std::is_same<ValueType, double>::value && std::is_same<BeliefValueType, double>::value;
+                STORM_LOG_INFO_COND(!refineConcurrently, "Refining the over- and under-approximation concurrently.");
+                auto refineBudgetExceeded = [&]() {
+                    return (options.discretize && isRefineBudgetExceeded(*overApproxBeliefManager)) || (options.unfold && isRefineBudgetExceeded(*underApproxBeliefManager));
+                };
                 while ((!options.refineStepLimit.is_initialized() || statistics.refinementSteps.get() < options.refineStepLimit.get()) && result.diff() > options.refinePrecision) {
+                    if (refineBudgetExceeded()) {
+                        STORM_LOG_INFO("Refinement budget exceeded after " << statistics.totalTime << " in refinement step #" << (statistics.refinementSteps.get() + 1) << ".");
+                        break;
+                    }
                     bool overApproxFixPoint = true;
                     bool underApproxFixPoint = true;
-                    if (options.discretize) {
-                        // Refine over-approximation
+                    // Both steps return false if the approximation could not be checked
+                    auto refineOverApproximation = [&]() {
                         if (min) {
                             overApproximation->takeCurrentValuesAsLowerBounds();
                         } else {
@@ -368,28 +409,47 @@ namespace storm {
                         overApproxFixPoint = buildOverApproximation(targetObservations, min, rewardModelName.is_initialized(), true, overApproxHeuristicPar, observationResolutionVector, overApproxBeliefManager, overApproximation);
                         if (overApproximation->hasComputedValues() && !storm::utility::resources::isTerminate()) {
                             ValueType const& newValue = overApproximation->getComputedValueAtInitialState();
-                            bool betterBound = min ? result.updateLowerBound(newValue) : result.updateUpperBound(newValue);
+                            bool betterBound = updateResult(result, newValue, min);
                             if (betterBound) {
                                 STORM_LOG_INFO("Over-approx result for refinement improved after " << statistics.totalTime << " in refinement step #" << (statistics.refinementSteps.get() + 1) << ". New value is '" << newValue << "'.");
                             }
-                        } else {
-                            break;
+                            return true;
                         }
-                    }
-                    
-                    if (options.unfold && result.diff() > options.refinePrecision) {
-                        // Refine under-approximation
+                        return false;
+                    };
+                    auto refineUnderApproximation = [&]() {
                         underApproxHeuristicPar.gapThreshold *= options.gapThresholdFactor;
                         underApproxHeuristicPar.sizeThreshold = storm::utility::convertNumber<uint64_t, ValueType>(storm::utility::convertNumber<ValueType, uint64_t>(underApproximation->getExploredMdp()->getNumberOfStates()) * options.sizeThresholdFactor);
                         underApproxHeuristicPar.optimalChoiceValueEpsilon *= options.optimalChoiceValueThresholdFactor;
                         underApproxFixPoint = buildUnderApproximation(targetObservations, min, rewardModelName.is_initialized(), true, underApproxHeuristicPar, underApproxBeliefManager, underApproximation);
                         if (underApproximation->hasComputedValues() && !storm::utility::resources::isTerminate()) {
                             ValueType const& newValue = underApproximation->getComputedValueAtInitialState();
-                            bool betterBound = min ? result.updateUpperBound(newValue) : result.updateLowerBound(newValue);
+                            bool betterBound = updateResult(result, newValue, !min);
                             if (betterBound) {
                                 STORM_LOG_INFO("Under-approx result for refinement improved after " << statistics.totalTime << " in refinement step #" << (statistics.refinementSteps.get() + 1) << ". New value is '" << newValue << "'.");
                             }
-                        } else {
+                            return true;
+                        }
+                        return false;
+                    };
+
+                    if (refineConcurrently) {
+                        bool refinedBoth = true;
+                        storm::utility::parallel::forEachChunk(0, 2, 1, 2, [&](uint64_t, uint64_t task, uint64_t) {
+                            bool refined = (task == 0) ? refineOverApproximation() : refineUnderApproximation();
+                            if (!refined) {
+                                std::lock_guard<std::mutex> lock(resultMutex);
+                                refinedBoth = false;
+                            }
+                        });
+                        if (!refinedBoth) {
+                            break;
+                        }
+                    } else {
+                        if (options.discretize && !refineOverApproximation()) {
+                            break;
+                        }
+                        if (options.unfold && result.diff() > options.refinePrecision && !refineUnderApproximation()) {
                             break;
                         }
                     }
@@ -505,6 +565,17 @@ namespace storm {
                     return storm::utility::abs<ValueType>(u-l) * storm::utility::convertNumber<ValueType, uint64_t>(2) / (l+u);
                 }
             }
+
+            // The number of upcoming states whose successors are computed concurrently in one go.
+            static const uint64_t prefetchLookahead = 256;
+
+            template<typename ExplorerType, typename BeliefManagerType>
+            std::vector<typename BeliefManagerType::BeliefId> getBeliefsToPrefetch(ExplorerType const& explorer, BeliefManagerType& beliefManager, std::set<uint32_t> const& targetObservations) {
+                auto beliefs = explorer.getBeliefsOfUpcomingNewStates(prefetchLookahead);
+                // Beliefs with a target observation are not expanded
+                beliefs.erase(std::remove_if(beliefs.begin(), beliefs.end(), [&](typename BeliefManagerType::BeliefId const& beliefId) { return targetObservations.count(beliefManager.getBeliefObservation(beliefId)) != 0; }), beliefs.end());
+                return beliefs;
+            }
             
             template<typename PomdpModelType, typename BeliefValueType>
             bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::buildOverApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::vector<BeliefValueType>& observationResolutionVector, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& overApproximation) {
@@ -558,9 +629,16 @@ namespace storm {
                 bool timeLimitExceeded = false;
                 std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations; // Declare here to avoid reallocations
                 uint64_t numRewiredOrExploredStates = 0;
+                uint64_t numStatesUntilPrefetch = 0;
                 while (overApproximation->hasUnexploredState()) {
-                    if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
-                        STORM_LOG_INFO("Exploration time limit exceeded.");
+                    if (numStatesUntilPrefetch == 0) {
+                        // Expand and triangulate the upcoming states concurrently
+                        beliefManager->prefetchExpansions(getBeliefsToPrefetch(*overApproximation, *beliefManager, targetObservations), observationResolutionVector);
+                        numStatesUntilPrefetch = prefetchLookahead;
+                    }
+                    --numStatesUntilPrefetch;
+                    if (!timeLimitExceeded && ((options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) || (options.refine && isRefineBudgetExceeded(*beliefManager)))) {
+                        STORM_LOG_INFO("Exploration time limit or refinement budget exceeded.");
                         timeLimitExceeded = true;
                         STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because the exploration time limit is exceeded.");
                         fixPoint = false;
@@ -766,9 +844,16 @@ namespace storm {
                     explorationTime.start();
                 }
                 bool timeLimitExceeded = false;
+                uint64_t numStatesUntilPrefetch = 0;
                 while (underApproximation->hasUnexploredState()) {
-                    if (!timeLimitExceeded && options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) {
-                        STORM_LOG_INFO("Exploration time limit exceeded.");
+                    if (numStatesUntilPrefetch == 0) {
+                        // Expand the upcoming states concurrently
+                        beliefManager->prefetchExpansions(getBeliefsToPrefetch(*underApproximation, *beliefManager, targetObservations));
+                        numStatesUntilPrefetch = prefetchLookahead;
+                    }
+                    --numStatesUntilPrefetch;
+                    if (!timeLimitExceeded && ((options.explorationTimeLimit && static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit.get()) || (options.refine && isRefineBudgetExceeded(*beliefManager)))) {
+                        STORM_LOG_INFO("Exploration time limit or refinement budget exceeded.");
                         timeLimitExceeded = true;
                     }
                     uint64_t currId = underApproximation->exploreNextState();
@@ -1,3 +1,6 @@
+#include <functional>
+#include <mutex>
+
 #include "storm/api/storm.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/utility/logging.h"
@@ -41,6 +44,12 @@ namespace storm {
                 
                 Result check(storm::logic::Formula const& formula);
 
+                /*!
+                 * Sets a function that is called whenever the lower or the upper bound of the result improves, i.e., the bounds obtained so far
+                 * are reported while the check is still running. Calls are not concurrent but might happen from different threads.
+                 */
+                void setBoundsCallback(std::function<void(ValueType const& lowerBound, ValueType const& upperBound)> const& callback);
+
                 void printStatisticsToStream(std::ostream& stream) const;
                 
             private:
@@ -92,6 +101,17 @@ namespace storm {
                  */
                 bool buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation);
 
+                /*!
+                 * Improves the lower (or upper) bound of the given result to the given value (if possible) and reports an improvement to the bounds callback.
+                 * @return true iff the bound was improved
+                 */
+                bool updateResult(Result& result, ValueType const& value, bool lowerBound);
+
+                /*!
+                 * Retrieves whether the time limit for the refinement is exceeded or the beliefs stored by the given manager exceed the memory limit.
+                 */
+                bool isRefineBudgetExceeded(BeliefManagerType const& beliefManager) const;
+
                 BeliefValueType rateObservation(typename ExplorerType::SuccessorObservationInformation const& info, BeliefValueType const& observationResolution, BeliefValueType const& maxResolution);
                 
                 std::vector<BeliefValueType> getObservationRatings(std::shared_ptr<ExplorerType> const& overApproximation, std::vector<BeliefValueType> const& observationResolutionVector);
@@ -125,6 +145,10 @@ namespace storm {
                 
                 Options options;
                 storm::utility::ConstantsComparator<ValueType> cc;
+
+                std::function<void(ValueType const&, ValueType const&)> boundsCallback;
+                // Guards the result if the over- and under-approximation are refined concurrently
+                std::mutex resultMutex;
             };
 
         }
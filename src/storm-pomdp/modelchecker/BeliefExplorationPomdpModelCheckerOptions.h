@@ -19,6 +19,9 @@ namespace storm {
                 boost::optional<uint64_t> refineStepLimit;
                 ValueType refinePrecision = storm::utility::zero<ValueType>();
                 boost::optional<uint64_t> explorationTimeLimit;
+                // Budget for the refinement (anytime mode). Once it is exceeded, no further beliefs are explored and the bounds obtained so far are returned.
+                boost::optional<uint64_t> refineTimeLimit; // In seconds, measured from the start of the check
+                boost::optional<uint64_t> refineMemoryLimit; // In megabytes, the (approximate) memory occupied by the beliefs of each approximation
                 
                 // Controlparameters for the refinement heuristic
                 // Discretization Resolution
@@ -1,8 +1,11 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/models/sparse/Pomdp.h"
 
 namespace storm {
@@ -29,7 +32,28 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::BeliefView(const_iterator first, const_iterator last) : first(first), last(last) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::begin() const {
+            return first;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::end() const {
+            return last;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::size() const {
+            return std::distance(first, last);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        template<typename BeliefRange>
+        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(BeliefRange const &belief) const {
             std::size_t seed = 0;
             // Assumes that beliefs are ordered
             for (auto const &entry : belief) {
@@ -43,7 +67,8 @@ namespace storm {
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            beliefStarts.push_back(0);
+            beliefIdTables.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -133,7 +158,8 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            auto const &belief = getBelief(beliefId);
+            return triangulateBelief(BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end()), resolution);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -155,7 +181,15 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefHashes.size();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getApproximateMemoryUsage() const {
+            uint64_t result = beliefEntries.capacity() * sizeof(typename decltype(beliefEntries)::value_type);
+            result += beliefStarts.capacity() * sizeof(uint64_t) + beliefHashes.capacity() * sizeof(std::size_t);
+            result += numberOfBeliefIdTableSlots * sizeof(BeliefId);
+            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,23 +206,115 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prefetchExpansions(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+            uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+            // Arithmetic on exact numbers is not thread-safe
+            if (numberOfThreads <= 1 || !std::is_same<BeliefValueType, double>::value || !std::is_same<ValueType, double>::value) {
+                return;
+            }
+            if (prefetchedResolutions != observationResolutions) {
+                prefetchedExpansions.clear();
+                prefetchedResolutions = observationResolutions;
+            }
+
+            std::vector<std::pair<BeliefId, uint64_t>> expansions;
+            for (auto const &beliefId : beliefIds) {
+                for (uint64_t action = 0, numActions = getBeliefNumberOfChoices(beliefId); action < numActions; ++action) {
+                    auto expansion = std::make_pair(beliefId, action);
+                    if (prefetchedExpansions.count(expansion) == 0) {
+                        expansions.push_back(expansion);
+                    }
+                }
+            }
+
+            // Compute the successors and look up the known ones concurrently. The belief store is not modified during this phase.
+            std::vector<std::vector<std::pair<BeliefType, ValueType>>> successors(expansions.size());
+            std::vector<std::vector<BeliefId>> successorIds(expansions.size());
+            storm::utility::parallel::forEachChunk(0, expansions.size(), 8, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                for (uint64_t expansion = chunkBegin; expansion < chunkEnd; ++expansion) {
+                    successors[expansion] = computeSuccessors(expansions[expansion].first, expansions[expansion].second, observationResolutions);
+                    successorIds[expansion].reserve(successors[expansion].size());
+                    for (auto const &successor : successors[expansion]) {
+                        successorIds[expansion].push_back(findId(successor.first));
+                    }
+                }
+            });
+
+            // Insert the new beliefs sequentially. A belief that was unknown before might have been inserted for a previous expansion.
+            for (uint64_t expansion = 0; expansion < expansions.size(); ++expansion) {
+                std::vector<std::pair<BeliefId, ValueType>> destinations;
+                destinations.reserve(successors[expansion].size());
+                for (uint64_t i = 0; i < successors[expansion].size(); ++i) {
+                    BeliefId successorId = successorIds[expansion][i];
+                    if (successorId == noId()) {
+                        successorId = getOrAddBeliefId(successors[expansion][i].first);
+                    }
+                    destinations.emplace_back(successorId, successors[expansion][i].second);
+                }
+                prefetchedExpansions.emplace(expansions[expansion], std::move(destinations));
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return BeliefView(beliefEntries.data() + beliefStarts[id], beliefEntries.data() + beliefStarts[id + 1]);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::findId(BeliefType const &belief) const {
+            return findId(belief, getBeliefObservation(belief), BeliefHash()(belief));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::findId(BeliefType const &belief, uint32_t observation, std::size_t hash) const {
+            STORM_LOG_ASSERT(observation < beliefIdTables.size(), "Belief has unknown observation.");
+            auto const &slots = beliefIdTables[observation].slots;
+            if (slots.empty()) {
+                return noId();
+            }
+            // The number of slots is a power of two and at least half of the slots are free
+            uint64_t const mask = slots.size() - 1;
+            for (uint64_t slot = hash & mask; slots[slot] != noId(); slot = (slot + 1) & mask) {
+                BeliefId const &id = slots[slot];
+                if (beliefHashes[id] == hash) {
+                    // Compare the entries exactly (as opposed to isEqual, which considers the precision)
+                    auto const &storedBelief = getBelief(id);
+                    if (storedBelief.size() == belief.size() && std::equal(storedBelief.begin(), storedBelief.end(), belief.begin())) {
+                        return id;
+                    }
+                }
+            }
+            return noId();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::insertId(BeliefIdTable &table, BeliefId id) {
+            if (2 * (table.numberOfEntries + 1) > table.slots.size()) {
+                // Double the number of slots and re-insert the present ids
+                std::vector<BeliefId> oldSlots(std::max<uint64_t>(16, 2 * table.slots.size()), noId());
+                std::swap(oldSlots, table.slots);
+                numberOfBeliefIdTableSlots += table.slots.size() - oldSlots.size();
+                table.numberOfEntries = 0;
+                for (auto const &oldId : oldSlots) {
+                    if (oldId != noId()) {
+                        insertId(table, oldId);
+                    }
+                }
+            }
+            uint64_t const mask = table.slots.size() - 1;
+            uint64_t slot = beliefHashes[id] & mask;
+            while (table.slots[slot] != noId()) {
+                slot = (slot + 1) & mask;
+            }
+            table.slots[slot] = id;
+            ++table.numberOfEntries;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        template<typename BeliefRange>
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRange const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,7 +331,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        template<typename FirstBeliefRange, typename SecondBeliefRange>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRange const &first, SecondBeliefRange const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
@@ -223,7 +350,8 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+        template<typename BeliefRange>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRange const &belief) const {
             BeliefValueType sum = storm::utility::zero<ValueType>();
             boost::optional<uint32_t> observation;
             for (auto const &entry : belief) {
@@ -264,34 +392,30 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
-            if (triangulation.weights.size() != triangulation.gridPoints.size()) {
-                STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
-                return false;
-            }
-            if (triangulation.size() == 0) {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, TriangulationGridPoints const &triangulation) const {
+            if (triangulation.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
             BeliefType triangulatedBelief;
             BeliefValueType weightSum = storm::utility::zero<BeliefValueType>();
-            for (uint64_t i = 0; i < triangulation.weights.size(); ++i) {
-                if (cc.isZero(triangulation.weights[i])) {
+            for (auto const &gridPointWithWeight : triangulation) {
+                BeliefValueType const &weight = gridPointWithWeight.second;
+                if (cc.isZero(weight)) {
                     STORM_LOG_ERROR("Zero weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(triangulation.weights[i], storm::utility::zero<BeliefValueType>())) {
+                if (cc.isLess(weight, storm::utility::zero<BeliefValueType>())) {
                     STORM_LOG_ERROR("Negative weight in triangulation.");
                     return false;
                 }
-                if (cc.isLess(storm::utility::one<BeliefValueType>(), triangulation.weights[i])) {
+                if (cc.isLess(storm::utility::one<BeliefValueType>(), weight)) {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
-                weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                weightSum += weight;
+                for (auto const &pointEntry : gridPointWithWeight.first) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
-                    triangulatedValue += triangulation.weights[i] * pointEntry.second;
+                    triangulatedValue += weight * pointEntry.second;
                 }
             }
             if (!cc.isOne(weightSum)) {
@@ -309,14 +433,15 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        template<typename BeliefRange>
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefRange const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, TriangulationGridPoints &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -340,8 +465,7 @@ namespace storm {
             // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
             qsRow.push_back(storm::utility::zero<BeliefValueType>());
 
-            result.weights.reserve(numEntries);
-            result.gridPoints.reserve(numEntries);
+            result.reserve(numEntries);
             auto currentSortedDiff = sorted_diffs.begin();
             auto previousSortedDiff = sorted_diffs.end();
             --previousSortedDiff;
@@ -356,7 +480,6 @@ namespace storm {
                     qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
                 }
                 if (!cc.isZero(weight)) {
-                    result.weights.push_back(weight);
                     // Compute the grid point
                     BeliefType gridPoint;
                     for (StateType j = 0; j < numEntries; ++j) {
@@ -365,14 +488,14 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.emplace_back(std::move(gridPoint), weight);
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, TriangulationGridPoints &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +532,13 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::TriangulationGridPoints
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulationGridPoints(BeliefType const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            TriangulationGridPoints result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
-                result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.emplace_back(belief, storm::utility::one<BeliefValueType>());
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,17 +552,28 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+            Triangulation result;
+            for (auto &gridPoint : computeTriangulationGridPoints(belief, resolution)) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint.first));
+                result.weights.push_back(std::move(gridPoint.second));
+            }
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessors(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                                boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            std::vector<std::pair<BeliefType, ValueType>> destinations;
 
-            BeliefType belief = getBelief(beliefId);
+            BeliefView belief = getBelief(beliefId);
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -470,13 +603,12 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
-                        // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                    for (auto &gridPoint : computeTriangulationGridPoints(successorBelief, observationTriangulationResolutions.get()[successor.first])) {
+                        // Here we additionally assume that the triangulation does not contain the same point multiple times
+                        destinations.emplace_back(std::move(gridPoint.first), gridPoint.second * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
 
@@ -484,6 +616,26 @@ namespace storm {
 
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            if (!prefetchedExpansions.empty() && prefetchedResolutions == observationTriangulationResolutions) {
+                auto prefetchedIt = prefetchedExpansions.find(std::make_pair(beliefId, actionIndex));
+                if (prefetchedIt != prefetchedExpansions.end()) {
+                    auto destinations = std::move(prefetchedIt->second);
+                    prefetchedExpansions.erase(prefetchedIt);
+                    return destinations;
+                }
+            }
+
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            for (auto &successor : computeSuccessors(beliefId, actionIndex, observationTriangulationResolutions)) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
+            return destinations;
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::computeInitialBelief() {
             STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() < 2,
@@ -500,14 +652,17 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
             uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            std::size_t hash = BeliefHash()(belief);
+            BeliefId id = findId(belief, obs, hash);
+            if (id == noId()) {
+                // Add the new belief to the arena
+                id = getNumberOfBeliefIds();
+                beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+                beliefStarts.push_back(beliefEntries.size());
+                beliefHashes.push_back(hash);
+                insertId(beliefIdTables[obs], id);
+            }
+            return id;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -1,7 +1,7 @@
 #pragma once
 
+#include <map>
 #include <vector>
-#include <unordered_map>
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
@@ -64,15 +64,60 @@ namespace storm {
 
             BeliefId getNumberOfBeliefIds() const;
 
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the stored beliefs.
+             */
+            uint64_t getApproximateMemoryUsage() const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex, std::vector<BeliefValueType> const &observationResolutions);
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successors of the given beliefs under all of their actions concurrently such that subsequent calls of expand
+             * (or expandAndTriangulate, if resolutions are given) for these beliefs can be answered without further computations.
+             * Successor beliefs and their triangulations are computed in parallel while the belief store is only read.
+             * Afterwards, new beliefs are inserted in a fixed order, i.e., the assigned belief ids do not depend on the thread schedule.
+             * Does nothing if only a single thread is available or if the values are not of type double.
+             * @param beliefIds the beliefs to expand
+             * @param observationResolutions if given, the successor beliefs are triangulated with the given resolutions
+             */
+            void prefetchExpansions(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions = boost::none);
+
         private:
 
+            /*!
+             * A read-only view on a belief that is stored in the arena. Iterating yields pairs of a state and its probability, ordered by state.
+             * @note Views are invalidated when new beliefs are added.
+             */
+            class BeliefView {
+            public:
+                typedef std::pair<StateType, BeliefValueType> const* const_iterator;
+
+                BeliefView(const_iterator first, const_iterator last);
+
+                const_iterator begin() const;
+                const_iterator end() const;
+                uint64_t size() const;
+
+            private:
+                const_iterator first;
+                const_iterator last;
+            };
+
+            /*!
+             * An open addressing hash table containing the ids of all beliefs with a certain observation. Free slots contain noId().
+             * The hashes of the beliefs are not stored in the table but looked up in beliefHashes.
+             */
+            struct BeliefIdTable {
+                std::vector<BeliefId> slots;
+                uint64_t numberOfEntries = 0;
+            };
+
             struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
+                template<typename BeliefRange>
+                std::size_t operator()(BeliefRange const &belief) const;
             };
 
             struct FreudenthalDiff {
@@ -83,26 +128,49 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            BeliefView getBelief(BeliefId const &id) const;
+
+            /*!
+             * Returns the id of the given belief or noId() if the belief is not known.
+             */
+            BeliefId findId(BeliefType const &belief) const;
+
+            BeliefId findId(BeliefType const &belief, uint32_t observation, std::size_t hash) const;
+
+            void insertId(BeliefIdTable &table, BeliefId id);
 
-            BeliefId getId(BeliefType const &belief) const;
+            template<typename BeliefRange>
+            std::string toString(BeliefRange const &belief) const;
 
-            std::string toString(BeliefType const &belief) const;
+            template<typename FirstBeliefRange, typename SecondBeliefRange>
+            bool isEqual(FirstBeliefRange const &first, SecondBeliefRange const &second) const;
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            template<typename BeliefRange>
+            bool assertBelief(BeliefRange const &belief) const;
 
-            bool assertBelief(BeliefType const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            template<typename BeliefRange>
+            uint32_t getBeliefObservation(BeliefRange const &belief) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            // The grid points of a triangulation together with their weights. In contrast to Triangulation, the grid points are not (yet) in the belief store.
+            typedef std::vector<std::pair<BeliefType, BeliefValueType>> TriangulationGridPoints;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            bool assertTriangulation(BeliefType const &belief, TriangulationGridPoints const &triangulation) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, TriangulationGridPoints &result) const;
+
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, TriangulationGridPoints &result) const;
+
+            TriangulationGridPoints computeTriangulationGridPoints(BeliefType const &belief, BeliefValueType const &resolution) const;
 
             Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+            /*!
+             * Computes the (possibly triangulated) successor beliefs of the given belief without modifying the belief store.
+             */
+            std::vector<std::pair<BeliefType, ValueType>>
+            computeSuccessors(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
@@ -113,9 +181,18 @@ namespace storm {
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // All beliefs are stored consecutively in one arena: The entries of the belief with id i are beliefEntries[beliefStarts[i]], ..., beliefEntries[beliefStarts[i+1]-1].
+            std::vector<std::pair<StateType, BeliefValueType>> beliefEntries;
+            std::vector<uint64_t> beliefStarts;
+            std::vector<std::size_t> beliefHashes;
+            // For each observation, the ids of the beliefs with that observation
+            std::vector<BeliefIdTable> beliefIdTables;
+            uint64_t numberOfBeliefIdTableSlots = 0;
             BeliefId initialBeliefId;
+
+            // Expansions computed by prefetchExpansions that have not been requested yet, together with the resolutions they were computed for.
+            std::map<std::pair<BeliefId, uint64_t>, std::vector<std::pair<BeliefId, ValueType>>> prefetchedExpansions;
+            boost::optional<std::vector<BeliefValueType>> prefetchedResolutions;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
@@ -2,7 +2,7 @@
 
 #include <limits>
 #include "storm/storage/sparse/ModelComponents.h"
-#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -19,23 +19,21 @@ namespace storm {
             
             template<typename ValueType>
             std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> PomdpMemoryUnfolder<ValueType>::transform() const {
-                // For simplicity we first build the 'full' product of pomdp and memory (with pomdp.numStates * memory.numStates states).
                 STORM_LOG_THROW(pomdp.isCanonic() , storm::exceptions::InvalidArgumentException, "POMDP must be canonical to unfold memory into it");
+                // Only the product states that are reachable from the initial states are built.
+                storm::storage::BitVector reachableStates = exploreReachableStates();
+                std::vector<uint64_t> modelStateOffsets = computeModelStateOffsets(reachableStates);
+
                 storm::storage::sparse::ModelComponents<ValueType> components;
-                components.transitionMatrix = transformTransitions();
-                components.stateLabeling = transformStateLabeling();
-                
-                // Now delete unreachable states.
-                storm::storage::BitVector allStates(components.transitionMatrix.getRowGroupCount(), true);
-                auto reachableStates = storm::utility::graph::getReachableStates(components.transitionMatrix, components.stateLabeling.getStates("init"), allStates, ~allStates);
-                components.transitionMatrix = components.transitionMatrix.getSubmatrix(true, reachableStates, reachableStates);
-                components.stateLabeling = components.stateLabeling.getSubLabeling(reachableStates);
+                components.transitionMatrix = transformTransitions(reachableStates, modelStateOffsets);
+                components.stateLabeling = transformStateLabeling(reachableStates, modelStateOffsets);
                 if (keepStateValuations && pomdp.hasStateValuations()) {
-                    std::vector<uint64_t> newToOldStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), 0);
-                    for (uint64_t newState = 0; newState < newToOldStates.size(); newState++) {
-                        newToOldStates[newState] = getModelState(newState);
+                    std::vector<uint64_t> newToOldStates;
+                    newToOldStates.reserve(reachableStates.getNumberOfSetBits());
+                    for (auto const& productState : reachableStates) {
+                        newToOldStates.push_back(getModelState(productState));
                     }
-                    components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates).selectStates(reachableStates);
+                    components.stateValuations = pomdp.getStateValuations().blowup(newToOldStates);
                 }
 
                 // build the remaining components
@@ -46,69 +44,115 @@ namespace storm {
 
                 return std::make_shared<storm::models::sparse::Pomdp<ValueType>>(std::move(components), true);
             }
-        
+
             template<typename ValueType>
-            storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions() const {
+            storm::storage::BitVector PomdpMemoryUnfolder<ValueType>::exploreReachableStates() const {
                 storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
-                uint64_t numRows = 0;
-                uint64_t numEntries = 0;
+                storm::storage::BitVector reachableStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
+                std::vector<uint64_t> stack;
+                for (auto const& modelState : pomdp.getInitialStates()) {
+                    uint64_t productState = getProductState(modelState, memory.getInitialState());
+                    if (!reachableStates.get(productState)) {
+                        reachableStates.set(productState);
+                        stack.push_back(productState);
+                    }
+                }
+                while (!stack.empty()) {
+                    uint64_t productState = stack.back();
+                    stack.pop_back();
+                    // The memory update does not depend on the chosen action or the successor state.
+                    storm::storage::BitVector const& memorySuccessors = memory.getTransitions(getMemoryState(productState));
+                    for (auto const& entry : origTransitions.getRowGroup(getModelState(productState))) {
+                        for (auto const& memStatePrime : memorySuccessors) {
+                            uint64_t successor = getProductState(entry.getColumn(), memStatePrime);
+                            if (!reachableStates.get(successor)) {
+                                reachableStates.set(successor);
+                                stack.push_back(successor);
+                            }
+                        }
+                    }
+                }
+                return reachableStates;
+            }
+
+            template<typename ValueType>
+            std::vector<uint64_t> PomdpMemoryUnfolder<ValueType>::computeModelStateOffsets(storm::storage::BitVector const& reachableStates) const {
+                std::vector<uint64_t> offsets;
+                offsets.reserve(pomdp.getNumberOfStates() + 1);
+                uint64_t numberOfStates = 0;
                 for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
+                    offsets.push_back(numberOfStates);
                     for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
-                        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
+                        if (reachableStates.get(getProductState(modelState, memState))) {
+                            ++numberOfStates;
+                        }
                     }
                 }
-                storm::storage::SparseMatrixBuilder<ValueType> builder(numRows,
-                                                                        pomdp.getNumberOfStates() * memory.getNumberOfStates(),
-                                                                        numEntries,
-                                                                        true,
-                                                                        true,
-                                                                        pomdp.getNumberOfStates() * memory.getNumberOfStates());
-                
+                offsets.push_back(numberOfStates);
+                return offsets;
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> PomdpMemoryUnfolder<ValueType>::transformTransitions(storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const {
+                storm::storage::SparseMatrix<ValueType> const& origTransitions = pomdp.getTransitionMatrix();
+                uint64_t numStates = reachableStates.getNumberOfSetBits();
+                uint64_t numRows = 0;
+                uint64_t numEntries = 0;
+                for (auto const& productState : reachableStates) {
+                    uint64_t modelState = getModelState(productState);
+                    uint64_t numMemSuccessors = memory.getNumberOfOutgoingTransitions(getMemoryState(productState));
+                    numRows += origTransitions.getRowGroupSize(modelState) * numMemSuccessors;
+                    numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * numMemSuccessors;
+                }
+                storm::storage::SparseMatrixBuilder<ValueType> builder(numRows, numStates, numEntries, true, true, numStates);
+
                 uint64_t row = 0;
-                for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        builder.newRowGroup(row);
-                        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
-                            for (auto const& memStatePrime : memory.getTransitions(memState)) {
-                                for (auto const& entry : origTransitions.getRow(origRow)) {
-                                    builder.addNextValue(row, getUnfoldingState(entry.getColumn(), memStatePrime), entry.getValue());
-                                }
-                                ++row;
+                for (auto const& productState : reachableStates) {
+                    uint64_t modelState = getModelState(productState);
+                    storm::storage::BitVector const& memorySuccessors = memory.getTransitions(getMemoryState(productState));
+                    builder.newRowGroup(row);
+                    for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+                        for (auto const& memStatePrime : memorySuccessors) {
+                            for (auto const& entry : origTransitions.getRow(origRow)) {
+                                builder.addNextValue(row, getUnfoldingState(entry.getColumn(), memStatePrime, reachableStates, modelStateOffsets), entry.getValue());
                             }
+                            ++row;
                         }
                     }
                 }
                 return builder.build();
             }
-        
+
             template<typename ValueType>
-            storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling() const {
-                storm::models::sparse::StateLabeling labeling(pomdp.getNumberOfStates() * memory.getNumberOfStates());
+            storm::models::sparse::StateLabeling PomdpMemoryUnfolder<ValueType>::transformStateLabeling(storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const {
+                uint64_t numStates = reachableStates.getNumberOfSetBits();
+                storm::models::sparse::StateLabeling labeling(numStates);
                 for (auto const& labelName : pomdp.getStateLabeling().getLabels()) {
-                    storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
-                    
+                    storm::storage::BitVector newStates(numStates, false);
+
                     // The init label is only assigned to unfolding states with the initial memory state
                     if (labelName == "init") {
                         for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
-                            newStates.set(getUnfoldingState(modelState, memory.getInitialState()));
+                            newStates.set(getUnfoldingState(modelState, memory.getInitialState(), reachableStates, modelStateOffsets));
                         }
                     } else {
                         for (auto const& modelState : pomdp.getStateLabeling().getStates(labelName)) {
-                            for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                                newStates.set(getUnfoldingState(modelState, memState));
+                            for (uint64_t unfoldingState = modelStateOffsets[modelState]; unfoldingState < modelStateOffsets[modelState + 1]; ++unfoldingState) {
+                                newStates.set(unfoldingState);
                             }
                         }
                     }
                     labeling.addLabel(labelName, std::move(newStates));
                 }
                 if (addMemoryLabels) {
+                    std::vector<storm::storage::BitVector> memoryLabels(memory.getNumberOfStates(), storm::storage::BitVector(numStates, false));
+                    uint64_t unfoldingState = 0;
+                    for (auto const& productState : reachableStates) {
+                        memoryLabels[getMemoryState(productState)].set(unfoldingState);
+                        ++unfoldingState;
+                    }
                     for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        storm::storage::BitVector newStates(pomdp.getNumberOfStates() * memory.getNumberOfStates(), false);
-                        for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                            newStates.set(getUnfoldingState(modelState, memState));
-                        }
-                        labeling.addLabel("memstate_"+std::to_string(memState), newStates);
+                        labeling.addLabel("memstate_"+std::to_string(memState), std::move(memoryLabels[memState]));
                     }
                 }
                 return labeling;
@@ -117,19 +161,15 @@ namespace storm {
             template<typename ValueType>
             std::vector<uint32_t> PomdpMemoryUnfolder<ValueType>::transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const {
                 std::vector<uint32_t> observations;
-                observations.reserve(pomdp.getNumberOfStates() * memory.getNumberOfStates());
-                for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        if (reachableStates.get(getUnfoldingState(modelState, memState))) {
-                            observations.push_back(getUnfoldingObersvation(pomdp.getObservation(modelState), memState));
-                        }
-                    }
+                observations.reserve(reachableStates.getNumberOfSetBits());
+                storm::storage::BitVector occuringObservations(pomdp.getNrObservations() * memory.getNumberOfStates(), false);
+                for (auto const& productState : reachableStates) {
+                    observations.push_back(getUnfoldingObersvation(pomdp.getObservation(getModelState(productState)), getMemoryState(productState)));
+                    occuringObservations.set(observations.back());
                 }
-                
+
                 // Eliminate observations that are not in use (as they are not reachable).
-                std::set<uint32_t> occuringObservations(observations.begin(), observations.end());
-                uint32_t highestObservation = *occuringObservations.rbegin();
-                std::vector<uint32_t> oldToNewObservationMapping(highestObservation + 1, std::numeric_limits<uint32_t>::max());
+                std::vector<uint32_t> oldToNewObservationMapping(occuringObservations.size(), std::numeric_limits<uint32_t>::max());
                 uint32_t newObs = 0;
                 for (auto const& oldObs : occuringObservations) {
                     oldToNewObservationMapping[oldObs] = newObs;
@@ -147,25 +187,19 @@ namespace storm {
                 boost::optional<std::vector<ValueType>> stateRewards, actionRewards;
                 if (rewardModel.hasStateRewards()) {
                     stateRewards = std::vector<ValueType>();
-                    stateRewards->reserve(pomdp.getNumberOfStates() * memory.getNumberOfStates());
-                    for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                        for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                            if (reachableStates.get(getUnfoldingState(modelState, memState))) {
-                                stateRewards->push_back(rewardModel.getStateReward(modelState));
-                            }
-                        }
+                    stateRewards->reserve(reachableStates.getNumberOfSetBits());
+                    for (auto const& productState : reachableStates) {
+                        stateRewards->push_back(rewardModel.getStateReward(getModelState(productState)));
                     }
                 }
                 if (rewardModel.hasStateActionRewards()) {
                     actionRewards = std::vector<ValueType>();
-                    for (uint64_t modelState = 0; modelState < pomdp.getNumberOfStates(); ++modelState) {
-                        for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                            if (reachableStates.get(getUnfoldingState(modelState, memState))) {
-                                for (uint64_t origRow = pomdp.getTransitionMatrix().getRowGroupIndices()[modelState]; origRow < pomdp.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++origRow) {
-                                    ValueType const& actionReward = rewardModel.getStateActionReward(origRow);
-                                    actionRewards->insert(actionRewards->end(), memory.getNumberOfOutgoingTransitions(memState), actionReward);
-                                }
-                            }
+                    for (auto const& productState : reachableStates) {
+                        uint64_t modelState = getModelState(productState);
+                        uint64_t numMemSuccessors = memory.getNumberOfOutgoingTransitions(getMemoryState(productState));
+                        for (uint64_t origRow = pomdp.getTransitionMatrix().getRowGroupIndices()[modelState]; origRow < pomdp.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++origRow) {
+                            ValueType const& actionReward = rewardModel.getStateActionReward(origRow);
+                            actionRewards->insert(actionRewards->end(), numMemSuccessors, actionReward);
                         }
                     }
                 }
@@ -174,18 +208,30 @@ namespace storm {
             }
 
             template<typename ValueType>
-            uint64_t PomdpMemoryUnfolder<ValueType>::getUnfoldingState(uint64_t modelState, uint64_t memoryState) const {
+            uint64_t PomdpMemoryUnfolder<ValueType>::getUnfoldingState(uint64_t modelState, uint64_t memoryState, storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const {
+                STORM_LOG_ASSERT(reachableStates.get(getProductState(modelState, memoryState)), "Product state is not reachable.");
+                uint64_t result = modelStateOffsets[modelState];
+                for (uint64_t memState = 0; memState < memoryState; ++memState) {
+                    if (reachableStates.get(getProductState(modelState, memState))) {
+                        ++result;
+                    }
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            uint64_t PomdpMemoryUnfolder<ValueType>::getProductState(uint64_t modelState, uint64_t memoryState) const {
                 return modelState * memory.getNumberOfStates() + memoryState;
             }
             
             template<typename ValueType>
-            uint64_t PomdpMemoryUnfolder<ValueType>::getModelState(uint64_t unfoldingState) const {
-                return unfoldingState / memory.getNumberOfStates();
+            uint64_t PomdpMemoryUnfolder<ValueType>::getModelState(uint64_t productState) const {
+                return productState / memory.getNumberOfStates();
             }
             
             template<typename ValueType>
-            uint64_t PomdpMemoryUnfolder<ValueType>::getMemoryState(uint64_t unfoldingState) const {
-                return unfoldingState % memory.getNumberOfStates();
+            uint64_t PomdpMemoryUnfolder<ValueType>::getMemoryState(uint64_t productState) const {
+                return productState % memory.getNumberOfStates();
             }
             
             template<typename ValueType>
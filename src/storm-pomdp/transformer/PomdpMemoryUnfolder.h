@@ -17,14 +17,27 @@ namespace storm {
             std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> transform() const;
 
         private:
-            storm::storage::SparseMatrix<ValueType> transformTransitions() const;
-            storm::models::sparse::StateLabeling transformStateLabeling() const;
+            /*!
+             * Explores the product of POMDP and memory starting from the initial states.
+             * @return the product states (w.r.t. getProductState) that are reachable.
+             */
+            storm::storage::BitVector exploreReachableStates() const;
+
+            /*!
+             * Computes for each model state the number of reachable product states with a smaller model state.
+             * Together with the reachable states, this yields the index of a product state in the unfolding.
+             */
+            std::vector<uint64_t> computeModelStateOffsets(storm::storage::BitVector const& reachableStates) const;
+
+            storm::storage::SparseMatrix<ValueType> transformTransitions(storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const;
+            storm::models::sparse::StateLabeling transformStateLabeling(storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const;
             std::vector<uint32_t> transformObservabilityClasses(storm::storage::BitVector const& reachableStates) const;
             storm::models::sparse::StandardRewardModel<ValueType> transformRewardModel(storm::models::sparse::StandardRewardModel<ValueType> const& rewardModel, storm::storage::BitVector const& reachableStates) const;
-            
-            uint64_t getUnfoldingState(uint64_t modelState, uint64_t memoryState) const;
-            uint64_t getModelState(uint64_t unfoldingState) const;
-            uint64_t getMemoryState(uint64_t unfoldingState) const;
+
+            uint64_t getUnfoldingState(uint64_t modelState, uint64_t memoryState, storm::storage::BitVector const& reachableStates, std::vector<uint64_t> const& modelStateOffsets) const;
+            uint64_t getProductState(uint64_t modelState, uint64_t memoryState) const;
+            uint64_t getModelState(uint64_t productState) const;
+            uint64_t getMemoryState(uint64_t productState) const;
             
             uint32_t getUnfoldingObersvation(uint32_t modelObservation, uint64_t memoryState) const;
             uint32_t getModelObersvation(uint32_t unfoldingObservation) const;
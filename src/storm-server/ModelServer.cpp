@@ -0,0 +1,319 @@
+#include "storm-server/ModelServer.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace server {
+
+namespace {
+// The error codes of JSON-RPC.
+int64_t const parseErrorCode = -32700;
+int64_t const invalidRequestCode = -32600;
+int64_t const methodNotFoundCode = -32601;
+int64_t const invalidParamsCode = -32602;
+int64_t const serverErrorCode = -32000;
+int64_t const abortedCode = -32001;
+
+// The interval (in milliseconds) in which the server checks whether it has to terminate.
+int const pollInterval = 250;
+
+// The maximal number of clients that are served concurrently. Further clients are rejected.
+uint64_t const maximalNumberOfConnections = 256;
+
+std::string toString(QueryScheduler::AbortReason reason) {
+    switch (reason) {
+        case QueryScheduler::AbortReason::Timeout:
+            return "time limit exceeded";
+        case QueryScheduler::AbortReason::MemoryLimit:
+            return "memory limit exceeded";
+        case QueryScheduler::AbortReason::Shutdown:
+            return "server shut down";
+        default:
+            return "aborted";
+    }
+}
+}  // namespace
+
+/*!
+ * A client connection. Responses may be sent from several threads.
+ */
+class ModelServer::Connection {
+   public:
+    explicit Connection(int socket) : socket(socket), finished(false) {
+    }
+
+    ~Connection() {
+        ::close(socket);
+    }
+
+    int getSocket() const {
+        return socket;
+    }
+
+    /*!
+     * Marks that the client disconnected and the serving thread is done.
+     */
+    void markFinished() {
+        finished = true;
+    }
+
+    bool isFinished() const {
+        return finished;
+    }
+
+    void send(Json const& message) {
+        std::string line = message.dump() + "\n";
+        std::lock_guard<std::mutex> lock(mutex);
+        char const* data = line.data();
+        std::size_t remaining = line.size();
+        while (remaining > 0) {
+            ssize_t sent = ::send(socket, data, remaining, MSG_NOSIGNAL);
+            if (sent <= 0) {
+                STORM_LOG_DEBUG("Unable to send response: " << std::strerror(errno));
+                return;
+            }
+            data += sent;
+            remaining -= static_cast<std::size_t>(sent);
+        }
+    }
+
+    void sendResult(Json const& id, Json const& result) {
+        Json response;
+        response["jsonrpc"] = "2.0";
+        response["id"] = id;
+        response["result"] = result;
+        send(response);
+    }
+
+    void sendError(Json const& id, int64_t code, std::string const& message) {
+        Json response;
+        response["jsonrpc"] = "2.0";
+        response["id"] = id;
+        response["error"]["code"] = code;
+        response["error"]["message"] = message;
+        send(response);
+    }
+
+   private:
+    int socket;
+    std::atomic<bool> finished;
+    std::mutex mutex;
+};
+
+ModelServer::ModelServer(std::unique_ptr<QueryScheduler>&& scheduler) : scheduler(std::move(scheduler)), nextSessionId(0), listeningPort(0) {
+    // Intentionally left empty.
+}
+
+void ModelServer::run(uint16_t port) {
+    int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    STORM_LOG_THROW(listener >= 0, storm::exceptions::NotSupportedException, "Unable to create socket: " << std::strerror(errno));
+    int reuse = 1;
+    ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 16) != 0) {
+        std::string error = std::strerror(errno);
+        ::close(listener);
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unable to listen on port " << port << ": " << error);
+    }
+    socklen_t addressLength = sizeof(address);
+    ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &addressLength);
+    listeningPort = ntohs(address.sin_port);
+    STORM_PRINT_AND_LOG("Listening on localhost:" << listeningPort << ".\n");
+
+    while (!storm::utility::resources::isTerminate()) {
+        reapFinishedConnections();
+        pollfd descriptor{listener, POLLIN, 0};
+        if (::poll(&descriptor, 1, pollInterval) <= 0) {
+            continue;
+        }
+        int client = ::accept(listener, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+        auto connection = std::make_shared<Connection>(client);
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        if (connections.size() >= maximalNumberOfConnections) {
+            STORM_LOG_WARN("Rejecting a client as " << maximalNumberOfConnections << " clients are connected.");
+            connection->sendError(nullptr, serverErrorCode, "Too many connections.");
+            continue;
+        }
+        connections.push_back(ConnectionThread{connection, std::thread([this, connection]() {
+                                                   serve(connection);
+                                                   connection->markFinished();
+                                               })});
+    }
+    ::close(listener);
+    listeningPort = 0;
+
+    // Closing the connections lets the reading threads return.
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    for (auto const& connectionThread : connections) {
+        ::shutdown(connectionThread.connection->getSocket(), SHUT_RDWR);
+    }
+    for (auto& connectionThread : connections) {
+        connectionThread.thread.join();
+    }
+    scheduler.reset();
+    connections.clear();
+    STORM_PRINT_AND_LOG("Server stopped.\n");
+}
+
+uint16_t ModelServer::getPort() const {
+    return listeningPort;
+}
+
+uint64_t ModelServer::getNumberOfConnections() const {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    return connections.size();
+}
+
+void ModelServer::reapFinishedConnections() {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    for (auto it = connections.begin(); it != connections.end();) {
+        if (it->connection->isFinished()) {
+            // Pending responses to the client keep the connection (but not the thread) alive.
+            it->thread.join();
+            it = connections.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ModelServer::serve(std::shared_ptr<Connection> const& connection) {
+    std::string buffer;
+    char data[4096];
+    while (true) {
+        ssize_t received = ::recv(connection->getSocket(), data, sizeof(data), 0);
+        if (received <= 0) {
+            return;
+        }
+        buffer.append(data, static_cast<std::size_t>(received));
+        std::size_t end;
+        while ((end = buffer.find('\n')) != std::string::npos) {
+            std::string line = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                handleRequest(line, connection);
+            }
+        }
+    }
+}
+
+void ModelServer::handleRequest(std::string const& line, std::shared_ptr<Connection> const& connection) {
+    Json request;
+    try {
+        request = Json::parse(line);
+    } catch (std::exception const& e) {
+        connection->sendError(nullptr, parseErrorCode, e.what());
+        return;
+    }
+    Json id = request.is_object() && request.count("id") > 0 ? request["id"] : Json();
+    if (!request.is_object() || request.count("method") == 0 || !request["method"].is_string()) {
+        connection->sendError(id, invalidRequestCode, "The request has to be an object with a method.");
+        return;
+    }
+    std::string method = request["method"];
+    Json parameters = request.count("params") > 0 ? request["params"] : Json::object();
+
+    std::function<Json(QueryScheduler::Cancellation const&)> handler;
+    if (method == "load") {
+        handler = [this, parameters](QueryScheduler::Cancellation const&) { return load(parameters); };
+    } else if (method == "check") {
+        handler = [this, parameters](QueryScheduler::Cancellation const& cancellation) { return check(parameters, &cancellation.getTerminationFlag()); };
+    } else if (method == "unload") {
+        handler = [this, parameters](QueryScheduler::Cancellation const&) { return unload(parameters); };
+    } else if (method == "sessions") {
+        handler = [this](QueryScheduler::Cancellation const&) { return listSessions(); };
+    } else {
+        connection->sendError(id, methodNotFoundCode, "Unknown method '" + method + "'.");
+        return;
+    }
+
+    auto respond = [connection, id, handler](QueryScheduler::Cancellation const& cancellation) {
+        try {
+            connection->sendResult(id, handler(cancellation));
+        } catch (storm::exceptions::InvalidArgumentException const& e) {
+            connection->sendError(id, invalidParamsCode, e.what());
+        } catch (std::exception const& e) {
+            QueryScheduler::AbortReason reason = cancellation.getAbortReason();
+            if (reason != QueryScheduler::AbortReason::None) {
+                connection->sendError(id, abortedCode, toString(reason));
+            } else {
+                connection->sendError(id, serverErrorCode, e.what());
+            }
+        }
+    };
+    if (method == "load" || method == "check") {
+        // Expensive requests are run by the scheduler.
+        scheduler->submit(respond);
+    } else {
+        respond(QueryScheduler::Cancellation());
+    }
+}
+
+ModelServer::Json ModelServer::load(Json const& parameters) {
+    STORM_LOG_THROW(parameters.count("model") > 0 && parameters["model"].is_string(), storm::exceptions::InvalidArgumentException,
+                    "Expected the model file as parameter 'model'.");
+    std::string constants = parameters.count("constants") > 0 ? parameters["constants"].get<std::string>() : "";
+    auto session = std::make_shared<ModelSession>(parameters["model"].get<std::string>(), constants);
+    Json result = session->getInformation();
+    std::lock_guard<std::mutex> lock(sessionsMutex);
+    result["session"] = nextSessionId;
+    sessions[nextSessionId++] = session;
+    return result;
+}
+
+ModelServer::Json ModelServer::unload(Json const& parameters) {
+    getSession(parameters);
+    std::lock_guard<std::mutex> lock(sessionsMutex);
+    // Running queries keep their session alive until they are done.
+    sessions.erase(parameters["session"].get<uint64_t>());
+    return true;
+}
+
+ModelServer::Json ModelServer::listSessions() const {
+    Json result = Json::array();
+    std::lock_guard<std::mutex> lock(sessionsMutex);
+    for (auto const& session : sessions) {
+        Json information = session.second->getInformation();
+        information["session"] = session.first;
+        result.push_back(information);
+    }
+    return result;
+}
+
+ModelServer::Json ModelServer::check(Json const& parameters, std::atomic<bool> const* terminationFlag) const {
+    STORM_LOG_THROW(parameters.count("properties") > 0 && parameters["properties"].is_string(), storm::exceptions::InvalidArgumentException,
+                    "Expected the properties as parameter 'properties'.");
+    return getSession(parameters)->check(parameters["properties"].get<std::string>(), terminationFlag);
+}
+
+std::shared_ptr<ModelSession> ModelServer::getSession(Json const& parameters) const {
+    STORM_LOG_THROW(parameters.count("session") > 0 && parameters["session"].is_number_unsigned(), storm::exceptions::InvalidArgumentException,
+                    "Expected the id of the session as parameter 'session'.");
+    std::lock_guard<std::mutex> lock(sessionsMutex);
+    auto it = sessions.find(parameters["session"].get<uint64_t>());
+    STORM_LOG_THROW(it != sessions.end(), storm::exceptions::InvalidArgumentException, "There is no session " << parameters["session"] << ".");
+    return it->second;
+}
+
+}  // namespace server
+}  // namespace storm
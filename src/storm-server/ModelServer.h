@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "storm-server/ModelSession.h"
+#include "storm-server/QueryScheduler.h"
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace server {
+
+/*!
+ * A server that keeps models in memory and answers queries on them. Clients connect via TCP and send JSON-RPC 2.0
+ * requests, one per line. Responses are sent as single lines as well, but not necessarily in the order of the
+ * requests (they are matched by their id). The supported methods are
+ *  - load (params: model, [constants]): builds the given model and returns the id of its session,
+ *  - unload (params: session): removes the session,
+ *  - sessions: lists all sessions,
+ *  - check (params: session, properties): checks the properties on the model of the session.
+ * Loading models and checking properties are performed by the query scheduler, i.e., concurrently and within its limits.
+ * Connections are served by one thread each, which is released once the client disconnects.
+ */
+class ModelServer {
+   public:
+    typedef storm::json<double> Json;
+
+    /*!
+     * Creates a server that runs its queries with the given scheduler.
+     */
+    ModelServer(std::unique_ptr<QueryScheduler>&& scheduler);
+
+    /*!
+     * Listens on the given port and serves the clients until the process (or the calling thread) is told to terminate.
+     *
+     * @param port The port. If zero, some free port is chosen (see getPort).
+     */
+    void run(uint16_t port);
+
+    /*!
+     * Retrieves the port on which the server listens or zero if it does not (yet) listen.
+     */
+    uint16_t getPort() const;
+
+    /*!
+     * Retrieves the number of clients that are currently connected.
+     */
+    uint64_t getNumberOfConnections() const;
+
+   private:
+    class Connection;
+
+    struct ConnectionThread {
+        std::shared_ptr<Connection> connection;
+        std::thread thread;
+    };
+
+    /*!
+     * Joins and removes the connections whose clients have disconnected.
+     */
+    void reapFinishedConnections();
+
+    /*!
+     * Reads and handles the requests sent over the given connection until it is closed.
+     */
+    void serve(std::shared_ptr<Connection> const& connection);
+
+    /*!
+     * Handles the given request. Responses are sent over the given connection (possibly later).
+     */
+    void handleRequest(std::string const& line, std::shared_ptr<Connection> const& connection);
+
+    Json load(Json const& parameters);
+    Json unload(Json const& parameters);
+    Json listSessions() const;
+    Json check(Json const& parameters, std::atomic<bool> const* terminationFlag) const;
+
+    std::shared_ptr<ModelSession> getSession(Json const& parameters) const;
+
+    std::unique_ptr<QueryScheduler> scheduler;
+
+    mutable std::mutex sessionsMutex;
+    std::map<uint64_t, std::shared_ptr<ModelSession>> sessions;
+    uint64_t nextSessionId;
+
+    std::atomic<uint16_t> listeningPort;
+
+    mutable std::mutex connectionsMutex;
+    std::list<ConnectionThread> connections;
+};
+
+}  // namespace server
+}  // namespace storm
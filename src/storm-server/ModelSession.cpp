@@ -0,0 +1,120 @@
+#include "storm-server/ModelSession.h"
+
+#include <sstream>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/logic/Formula.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace server {
+
+namespace {
+// The maximal number of results that are cached per session.
+uint64_t const maximalNumberOfCachedResults = 10000;
+
+// Installs a termination flag for the calling thread and restores the previous one on destruction.
+class TerminationFlagGuard {
+   public:
+    explicit TerminationFlagGuard(std::atomic<bool> const* flag) : previousFlag(storm::utility::resources::threadTerminationFlag) {
+        if (flag != nullptr) {
+            storm::utility::resources::setThreadTerminationFlag(flag);
+        }
+    }
+
+    ~TerminationFlagGuard() {
+        storm::utility::resources::setThreadTerminationFlag(previousFlag);
+    }
+
+   private:
+    std::atomic<bool> const* previousFlag;
+};
+}  // namespace
+
+ModelSession::ModelSession(std::string const& modelFile, std::string const& constantDefinitions)
+    : modelFile(modelFile), constantDefinitions(constantDefinitions), resultCache(maximalNumberOfCachedResults, 16) {
+    if (boost::algorithm::ends_with(modelFile, ".jani")) {
+        modelDescription = storm::storage::SymbolicModelDescription(storm::api::parseJaniModel(modelFile).first);
+    } else {
+        modelDescription = storm::storage::SymbolicModelDescription(storm::api::parseProgram(modelFile, false, true));
+    }
+    modelDescription = modelDescription.preprocess(constantDefinitions);
+
+    // Build all labels and reward models such that any property can be checked on the same model.
+    storm::builder::BuilderOptions options(true, true);
+    model = storm::api::buildSparseModel<double>(modelDescription, options);
+    STORM_LOG_THROW(model, storm::exceptions::NotSupportedException, "Unable to build the model '" << modelFile << "'.");
+    STORM_LOG_INFO("Loaded model '" << modelFile << "' with " << model->getNumberOfStates() << " states and " << model->getNumberOfTransitions()
+                                    << " transitions.");
+}
+
+storm::json<double> ModelSession::check(std::string const& propertyString, std::atomic<bool> const* terminationFlag) {
+    TerminationFlagGuard terminationFlagGuard(terminationFlag);
+    std::vector<storm::jani::Property> properties = storm::api::parsePropertiesForSymbolicModelDescription(propertyString, modelDescription);
+    storm::json<double> results = storm::json<double>::array();
+    for (auto const& property : properties) {
+        std::string formulaString = property.getRawFormula()->toString();
+        auto cachedResult = resultCache.lookup(formulaString);
+        if (cachedResult) {
+            results.push_back(cachedResult.get());
+            continue;
+        }
+
+        storm::Environment env;
+        std::unique_ptr<storm::modelchecker::CheckResult> checkResult =
+            storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(property.getRawFormula(), true));
+        // Results of aborted computations are not valid (and in particular must not be cached).
+        STORM_LOG_THROW(!storm::utility::resources::isTerminate(), storm::exceptions::AbortException, "Checking '" << formulaString << "' was aborted.");
+        STORM_LOG_THROW(checkResult, storm::exceptions::NotSupportedException, "The property '" << formulaString << "' is not supported.");
+
+        storm::json<double> result;
+        result["property"] = formulaString;
+        storm::json<double> values = storm::json<double>::array();
+        for (auto const& initialState : model->getInitialStates()) {
+            if (checkResult->isExplicitQuantitativeCheckResult()) {
+                values.push_back(checkResult->asExplicitQuantitativeCheckResult<double>()[initialState]);
+            } else if (checkResult->isExplicitQualitativeCheckResult()) {
+                values.push_back(checkResult->asExplicitQualitativeCheckResult()[initialState]);
+            } else {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The result of '" << formulaString << "' can not be reported.");
+            }
+        }
+        result["values"] = values;
+        resultCache.insert(formulaString, result);
+        results.push_back(std::move(result));
+    }
+    return results;
+}
+
+storm::json<double> ModelSession::getInformation() const {
+    storm::json<double> information;
+    information["model"] = modelFile;
+    information["constants"] = constantDefinitions;
+    std::stringstream modelType;
+    modelType << model->getType();
+    information["type"] = modelType.str();
+    information["states"] = static_cast<uint64_t>(model->getNumberOfStates());
+    information["transitions"] = static_cast<uint64_t>(model->getNumberOfTransitions());
+    auto statistics = resultCache.getStatistics();
+    information["cached-results"] = statistics.entries;
+    information["cache-hits"] = statistics.hits;
+    return information;
+}
+
+}  // namespace server
+}  // namespace storm
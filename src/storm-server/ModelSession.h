@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/ShardedCache.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace sparse
+}  // namespace models
+
+namespace server {
+
+/*!
+ * A model that is kept in memory by the server. The (sparse) model is built once with all labels and reward models
+ * such that every property over the model description can be checked without rebuilding it. Results are cached and
+ * shared by all queries on the session. Properties may be checked concurrently.
+ */
+class ModelSession {
+   public:
+    /*!
+     * Loads and builds the given model.
+     *
+     * @param modelFile The PRISM or (if the file ends with .jani) JANI file.
+     * @param constantDefinitions The definitions of the undefined constants, e.g., "N=3,p=0.1".
+     */
+    ModelSession(std::string const& modelFile, std::string const& constantDefinitions = "");
+
+    /*!
+     * Checks the given properties (separated by semicolons). The results are given for the initial states of the model.
+     * Computations are aborted if the given termination flag (or the one of the calling thread) is set.
+     *
+     * @param terminationFlag If given, the flag that aborts the computations. It is used by all threads that work on them.
+     * @return A JSON array with one object per property, holding the property and its results.
+     */
+    storm::json<double> check(std::string const& propertyString, std::atomic<bool> const* terminationFlag = nullptr);
+
+    /*!
+     * Retrieves a JSON object that describes the session, i.e., the model and the statistics of the result cache.
+     */
+    storm::json<double> getInformation() const;
+
+   private:
+    std::string modelFile;
+    std::string constantDefinitions;
+    storm::storage::SymbolicModelDescription modelDescription;
+    std::shared_ptr<storm::models::sparse::Model<double, storm::models::sparse::StandardRewardModel<double>>> model;
+    storm::utility::ShardedCache<std::string, storm::json<double>> resultCache;
+};
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,147 @@
+#include "storm-server/QueryScheduler.h"
+
+#include <algorithm>
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
+
+namespace storm {
+namespace server {
+
+namespace {
+// The interval in which the watchdog checks the limits.
+std::chrono::milliseconds const watchdogInterval(100);
+}  // namespace
+
+std::atomic<bool> const& QueryScheduler::Cancellation::getTerminationFlag() const {
+    return terminate;
+}
+
+bool QueryScheduler::Cancellation::isCancelled() const {
+    return terminate.load();
+}
+
+QueryScheduler::AbortReason QueryScheduler::Cancellation::getAbortReason() const {
+    return abortReason.load();
+}
+
+void QueryScheduler::Cancellation::abort(AbortReason reason) {
+    AbortReason expected = AbortReason::None;
+    // Only the first reason is kept.
+    abortReason.compare_exchange_strong(expected, reason);
+    terminate = true;
+}
+
+QueryScheduler::QueryScheduler(uint64_t numberOfWorkers, boost::optional<std::chrono::seconds> const& timeout, boost::optional<uint64_t> const& memoryLimit)
+    : timeout(timeout), memoryLimit(memoryLimit), stop(false) {
+    STORM_LOG_WARN_COND(!memoryLimit || getResidentMemory() > 0, "The memory of the process can not be determined on this system. Ignoring the memory limit.");
+    for (uint64_t worker = 0; worker < std::max<uint64_t>(1, numberOfWorkers); ++worker) {
+        workers.emplace_back([this]() { runWorker(); });
+    }
+    if (timeout || memoryLimit) {
+        watchdog = std::thread([this]() { runWatchdog(); });
+    }
+}
+
+QueryScheduler::~QueryScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+        pendingQueries.clear();
+        for (auto& query : runningQueries) {
+            query->cancellation.abort(AbortReason::Shutdown);
+        }
+    }
+    queryAvailable.notify_all();
+    stopRequested.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (watchdog.joinable()) {
+        watchdog.join();
+    }
+}
+
+void QueryScheduler::submit(Query const& query) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingQueries.push_back(query);
+    }
+    queryAvailable.notify_one();
+}
+
+uint64_t QueryScheduler::getNumberOfRunningQueries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return runningQueries.size();
+}
+
+uint64_t QueryScheduler::getNumberOfPendingQueries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pendingQueries.size();
+}
+
+uint64_t QueryScheduler::getResidentMemory() {
+    return storm::utility::memory::getResidentBytes() / (1024 * 1024);
+}
+
+void QueryScheduler::runWorker() {
+    while (true) {
+        Query query;
+        auto runningQuery = std::make_shared<RunningQuery>();
+        std::list<std::shared_ptr<RunningQuery>>::iterator position;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queryAvailable.wait(lock, [this]() { return stop || !pendingQueries.empty(); });
+            if (stop) {
+                return;
+            }
+            query = std::move(pendingQueries.front());
+            pendingQueries.pop_front();
+            runningQuery->start = std::chrono::steady_clock::now();
+            position = runningQueries.insert(runningQueries.end(), runningQuery);
+        }
+
+        storm::utility::resources::setThreadTerminationFlag(&runningQuery->cancellation.getTerminationFlag());
+        try {
+            query(runningQuery->cancellation);
+        } catch (std::exception const& e) {
+            STORM_LOG_ERROR("A query terminated with an exception: " << e.what());
+        }
+        storm::utility::resources::setThreadTerminationFlag(nullptr);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        runningQueries.erase(position);
+    }
+}
+
+void QueryScheduler::runWatchdog() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stop) {
+        stopRequested.wait_for(lock, watchdogInterval, [this]() { return stop; });
+        if (stop) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (timeout) {
+            for (auto& query : runningQueries) {
+                if (now - query->start > timeout.get()) {
+                    query->cancellation.abort(AbortReason::Timeout);
+                }
+            }
+        }
+        if (memoryLimit && getResidentMemory() > memoryLimit.get()) {
+            // Abort the most recent query that is not yet aborted. As aborting takes a while, at most one query is aborted per interval.
+            for (auto it = runningQueries.rbegin(); it != runningQueries.rend(); ++it) {
+                if (!(*it)->cancellation.isCancelled()) {
+                    STORM_LOG_WARN("The memory limit of " << memoryLimit.get() << "MB is exceeded. Aborting the most recent query.");
+                    (*it)->cancellation.abort(AbortReason::MemoryLimit);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace server
+}  // namespace storm
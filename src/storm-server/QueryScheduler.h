@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+namespace server {
+
+/*!
+ * Runs queries concurrently on a fixed number of worker threads and enforces resource limits on them. Every query
+ * gets its own cancellation whose termination flag is installed for the worker thread (see
+ * storm::utility::resources::setThreadTerminationFlag), such that a single query can be aborted while the others
+ * continue. A watchdog thread aborts queries that exceed the time limit. As memory
+ * can not be attributed to single threads, the memory limit refers to the whole process: while it is exceeded, the
+ * most recently started query is aborted.
+ */
+class QueryScheduler {
+   public:
+    // The reasons for which a query may be aborted.
+    enum class AbortReason { None, Timeout, MemoryLimit, Shutdown };
+
+    /*!
+     * Tells a query whether (and why) it is aborted. Queries that run computations on threads other than the worker
+     * thread have to install the termination flag there.
+     */
+    class Cancellation {
+       public:
+        /*!
+         * Retrieves the flag that is set once the query is aborted.
+         */
+        std::atomic<bool> const& getTerminationFlag() const;
+
+        /*!
+         * Retrieves whether the query is aborted.
+         */
+        bool isCancelled() const;
+
+        /*!
+         * Retrieves why the query is aborted (or AbortReason::None).
+         */
+        AbortReason getAbortReason() const;
+
+       private:
+        friend class QueryScheduler;
+
+        void abort(AbortReason reason);
+
+        std::atomic<bool> terminate{false};
+        std::atomic<AbortReason> abortReason{AbortReason::None};
+    };
+
+    typedef std::function<void(Cancellation const& cancellation)> Query;
+
+    /*!
+     * Creates a scheduler and starts its threads.
+     *
+     * @param numberOfWorkers The number of queries that are run concurrently.
+     * @param timeout If given, the maximal time per query.
+     * @param memoryLimit If given, the maximal memory (in megabytes) of the process.
+     */
+    QueryScheduler(uint64_t numberOfWorkers, boost::optional<std::chrono::seconds> const& timeout, boost::optional<uint64_t> const& memoryLimit);
+
+    /*!
+     * Aborts all running queries, discards the pending ones and stops the threads.
+     */
+    ~QueryScheduler();
+
+    /*!
+     * Enqueues the given query. Exceptions thrown by the query are logged and otherwise ignored.
+     */
+    void submit(Query const& query);
+
+    /*!
+     * Retrieves the number of queries that are currently running.
+     */
+    uint64_t getNumberOfRunningQueries() const;
+
+    /*!
+     * Retrieves the number of queries that wait for a worker.
+     */
+    uint64_t getNumberOfPendingQueries() const;
+
+    /*!
+     * Retrieves the resident memory of this process in megabytes (or zero if it can not be determined).
+     */
+    static uint64_t getResidentMemory();
+
+   private:
+    struct RunningQuery {
+        std::chrono::steady_clock::time_point start;
+        Cancellation cancellation;
+    };
+
+    void runWorker();
+    void runWatchdog();
+
+    boost::optional<std::chrono::seconds> timeout;
+    boost::optional<uint64_t> memoryLimit;
+
+    mutable std::mutex mutex;
+    std::condition_variable queryAvailable;
+    std::condition_variable stopRequested;
+    bool stop;
+    std::deque<Query> pendingQueries;
+    std::list<std::shared_ptr<RunningQuery>> runningQueries;
+
+    std::vector<std::thread> workers;
+    std::thread watchdog;
+};
+
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,84 @@
+#include "storm-server/settings/modules/ServerSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace server {
+namespace settings {
+namespace modules {
+
+using storm::settings::ArgumentBuilder;
+using storm::settings::ArgumentValidatorFactory;
+using storm::settings::OptionBuilder;
+
+const std::string ServerSettings::moduleName = "server";
+const std::string ServerSettings::portOptionName = "port";
+const std::string ServerSettings::workersOptionName = "workers";
+const std::string ServerSettings::timeoutOptionName = "querytimeout";
+const std::string ServerSettings::memoryLimitOptionName = "memlimit";
+
+ServerSettings::ServerSettings() : ModuleSettings(moduleName) {
+    this->addOption(OptionBuilder(moduleName, portOptionName, false, "Sets the port on which the server listens.")
+                        .addArgument(ArgumentBuilder::createUnsignedIntegerArgument("port", "The port.")
+                                         .setDefaultValueUnsignedInteger(7523)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(1, 65535))
+                                         .build())
+                        .build());
+    this->addOption(OptionBuilder(moduleName, workersOptionName, false, "Sets the number of queries that are answered concurrently.")
+                        .addArgument(ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of worker threads.")
+                                         .setDefaultValueUnsignedInteger(storm::utility::parallel::getDefaultNumberOfThreads())
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(OptionBuilder(moduleName, timeoutOptionName, false, "If set, queries that take longer than the given time are aborted.")
+                        .addArgument(ArgumentBuilder::createUnsignedIntegerArgument("time", "The time in seconds.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(OptionBuilder(moduleName, memoryLimitOptionName, false,
+                                  "If set, running queries are aborted (most recent first) while the server uses more than the given memory.")
+                        .addArgument(ArgumentBuilder::createUnsignedIntegerArgument("memory", "The memory in megabytes.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+uint64_t ServerSettings::getPort() const {
+    return this->getOption(portOptionName).getArgumentByName("port").getValueAsUnsignedInteger();
+}
+
+uint64_t ServerSettings::getNumberOfWorkers() const {
+    return this->getOption(workersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ServerSettings::isQueryTimeoutSet() const {
+    return this->getOption(timeoutOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ServerSettings::getQueryTimeout() const {
+    return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
+}
+
+bool ServerSettings::isMemoryLimitSet() const {
+    return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ServerSettings::getMemoryLimit() const {
+    return this->getOption(memoryLimitOptionName).getArgumentByName("memory").getValueAsUnsignedInteger();
+}
+
+}  // namespace modules
+
+void initializeServerSettings(std::string const& name, std::string const& executableName) {
+    storm::settings::initializeAll(name, executableName);
+    storm::settings::addModule<modules::ServerSettings>();
+}
+
+}  // namespace settings
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace server {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the model checking server.
+ */
+class ServerSettings : public storm::settings::modules::ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of server settings.
+     */
+    ServerSettings();
+
+    /*!
+     * Retrieves the port on which the server listens.
+     */
+    uint64_t getPort() const;
+
+    /*!
+     * Retrieves the number of queries that are answered concurrently.
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Retrieves whether the time per query is limited.
+     */
+    bool isQueryTimeoutSet() const;
+
+    /*!
+     * Retrieves the maximal time (in seconds) per query.
+     */
+    uint64_t getQueryTimeout() const;
+
+    /*!
+     * Retrieves whether the memory of the server is limited.
+     */
+    bool isMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the maximal memory (in megabytes) of the server. If it is exceeded, running queries are aborted.
+     */
+    uint64_t getMemoryLimit() const;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string portOptionName;
+    static const std::string workersOptionName;
+    static const std::string timeoutOptionName;
+    static const std::string memoryLimitOptionName;
+};
+
+}  // namespace modules
+
+/*!
+ * Registers all settings modules relevant for the server.
+ */
+void initializeServerSettings(std::string const& name, std::string const& executableName);
+
+}  // namespace settings
+}  // namespace server
+}  // namespace storm
@@ -0,0 +1,64 @@
+#include "storm-cli-utilities/cli.h"
+#include "storm-server/ModelServer.h"
+#include "storm-server/QueryScheduler.h"
+#include "storm-server/settings/modules/ServerSettings.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+/*!
+ * Starts the server with the given settings and serves the clients until the process is told to terminate.
+ */
+void serve() {
+    auto const& serverSettings = storm::settings::getModule<storm::server::settings::modules::ServerSettings>();
+    boost::optional<std::chrono::seconds> timeout;
+    if (serverSettings.isQueryTimeoutSet()) {
+        timeout = std::chrono::seconds(serverSettings.getQueryTimeout());
+    }
+    boost::optional<uint64_t> memoryLimit;
+    if (serverSettings.isMemoryLimitSet()) {
+        memoryLimit = serverSettings.getMemoryLimit();
+    }
+
+    storm::server::ModelServer server(std::make_unique<storm::server::QueryScheduler>(serverSettings.getNumberOfWorkers(), timeout, memoryLimit));
+    server.run(static_cast<uint16_t>(serverSettings.getPort()));
+}
+
+/*!
+ * Main entry point of the executable storm-server.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-server", argc, argv);
+        storm::server::settings::initializeServerSettings("Storm-server", "storm-server");
+
+        storm::utility::Stopwatch totalTimer(true);
+        if (!storm::cli::parseOptions(argc, argv)) {
+            return -1;
+        }
+
+        // Start by setting some urgent options (log levels, resources, etc.)
+        storm::cli::setUrgentOptions();
+
+        serve();
+
+        totalTimer.stop();
+        if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+            storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
+        }
+
+        // All operations have now been performed, so we clean up everything and terminate.
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-server to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-server to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -84,14 +84,18 @@ void StateSetAbstractor<DdType, ValueType>::refine(std::vector<uint_fast64_t> co
 template<storm::dd::DdType DdType, typename ValueType>
 void StateSetAbstractor<DdType, ValueType>::constrain(storm::expressions::Expression const& constraint) {
     smtSolver->add(constraint);
+    forceRecomputation = true;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
 void StateSetAbstractor<DdType, ValueType>::constrain(storm::dd::Bdd<DdType> const& newConstraint) {
-    // If the constraint is different from the last one, we add it to the solver.
+    // If the constraint is different from the last one, we replace it in the solver. Keeping the old constraints would make the SMT
+    // problem grow with every refinement step.
     if (newConstraint != this->constraint) {
+        this->popConstraintBdd();
         constraint = newConstraint;
         this->pushConstraintBdd();
+        forceRecomputation = true;
     }
 }
 
@@ -119,6 +123,7 @@ void StateSetAbstractor<DdType, ValueType>::recomputeCachedBdd() {
     });
 
     cachedBdd = result;
+    forceRecomputation = false;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
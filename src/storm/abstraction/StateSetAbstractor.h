@@ -71,14 +71,15 @@ class StateSetAbstractor {
     void constrain(storm::expressions::Expression const& constraint);
 
     /*!
-     * Constraints the abstract states with the given BDD.
+     * Constraints the abstract states with the given BDD. The constraint replaces the previously given BDD constraint (if any).
      *
      * @param newConstraint The BDD used as the constraint.
      */
     void constrain(storm::dd::Bdd<DdType> const& newConstraint);
 
     /*!
-     * Retrieves the set of abstract states matching all predicates added to this abstractor.
+     * Retrieves the set of abstract states matching all predicates added to this abstractor. The set is only recomputed if the relevant
+     * predicates or the constraints changed since the last call.
      *
      * @return The set of matching abstract states in the form of a BDD
      */
@@ -86,6 +86,7 @@ void ValidBlockAbstractor<DdType>::recomputeValidBlocks() {
     }
 
     validBlocks = newValidBlocks;
+    checkForRecomputation = false;
 }
 
 template<storm::dd::DdType DdType>
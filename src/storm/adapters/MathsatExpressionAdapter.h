@@ -3,7 +3,9 @@
 
 #include "storm-config.h"
 
+#include <memory>
 #include <stack>
+#include <unordered_map>
 
 #ifdef STORM_HAVE_MSAT
 #include "mathsat.h"
@@ -59,7 +61,7 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
      */
     msat_term translateExpression(storm::expressions::Expression const& expression) {
         additionalConstraints.clear();
-        msat_term result = boost::any_cast<msat_term>(expression.getBaseExpression().accept(*this, boost::none));
+        msat_term result = translateSubexpression(expression.getBaseExpressionPointer(), boost::none);
         if (MSAT_ERROR_TERM(result)) {
             std::string errorMessage(msat_last_error_message(env));
             STORM_LOG_THROW(!MSAT_ERROR_TERM(result), storm::exceptions::ExpressionEvaluationException,
@@ -113,8 +115,8 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
-        msat_term leftResult = boost::any_cast<msat_term>(expression.getFirstOperand()->accept(*this, data));
-        msat_term rightResult = boost::any_cast<msat_term>(expression.getSecondOperand()->accept(*this, data));
+        msat_term leftResult = translateSubexpression(expression.getFirstOperand(), data);
+        msat_term rightResult = translateSubexpression(expression.getSecondOperand(), data);
 
         switch (expression.getOperatorType()) {
             case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
@@ -133,8 +135,8 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
-        msat_term leftResult = boost::any_cast<msat_term>(expression.getFirstOperand()->accept(*this, data));
-        msat_term rightResult = boost::any_cast<msat_term>(expression.getSecondOperand()->accept(*this, data));
+        msat_term leftResult = translateSubexpression(expression.getFirstOperand(), data);
+        msat_term rightResult = translateSubexpression(expression.getSecondOperand(), data);
 
         msat_term result = leftResult;
         int_fast64_t exponent;
@@ -193,8 +195,8 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
-        msat_term leftResult = boost::any_cast<msat_term>(expression.getFirstOperand()->accept(*this, data));
-        msat_term rightResult = boost::any_cast<msat_term>(expression.getSecondOperand()->accept(*this, data));
+        msat_term leftResult = translateSubexpression(expression.getFirstOperand(), data);
+        msat_term rightResult = translateSubexpression(expression.getSecondOperand(), data);
 
         switch (expression.getRelationType()) {
             case storm::expressions::BinaryRelationExpression::RelationType::Equal:
@@ -225,9 +227,9 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
-        msat_term conditionResult = boost::any_cast<msat_term>(expression.getCondition()->accept(*this, data));
-        msat_term thenResult = boost::any_cast<msat_term>(expression.getThenExpression()->accept(*this, data));
-        msat_term elseResult = boost::any_cast<msat_term>(expression.getElseExpression()->accept(*this, data));
+        msat_term conditionResult = translateSubexpression(expression.getCondition(), data);
+        msat_term thenResult = translateSubexpression(expression.getThenExpression(), data);
+        msat_term elseResult = translateSubexpression(expression.getElseExpression(), data);
 
         // MathSAT does not allow ite with boolean arguments, so we have to encode it ourselves.
         if (expression.getThenExpression()->hasBooleanType() && expression.getElseExpression()->hasBooleanType()) {
@@ -252,7 +254,7 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
-        msat_term childResult = boost::any_cast<msat_term>(expression.getOperand()->accept(*this, data));
+        msat_term childResult = translateSubexpression(expression.getOperand(), data);
 
         switch (expression.getOperatorType()) {
             case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not:
@@ -266,7 +268,7 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
     }
 
     virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
-        msat_term childResult = boost::any_cast<msat_term>(expression.getOperand()->accept(*this, data));
+        msat_term childResult = translateSubexpression(expression.getOperand(), data);
 
         switch (expression.getOperatorType()) {
             case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus:
@@ -360,6 +362,30 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
         return msatDeclaration;
     }
 
+    /*!
+     * Translates the given subexpression. Translations that did not introduce additional constraints are cached, such that subexpressions
+     * shared by several expressions (for example predicates that are asserted repeatedly) are only translated once.
+     */
+    msat_term translateSubexpression(std::shared_ptr<storm::expressions::BaseExpression const> const& subexpression, boost::any const& data) {
+        auto cacheIt = expressionCache.find(subexpression.get());
+        if (cacheIt != expressionCache.end()) {
+            return cacheIt->second.second;
+        }
+
+        uint64_t numberOfAdditionalConstraints = additionalConstraints.size();
+        msat_term result = boost::any_cast<msat_term>(subexpression->accept(*this, data));
+        if (additionalConstraints.size() == numberOfAdditionalConstraints && !MSAT_ERROR_TERM(result)) {
+            if (expressionCache.size() >= maximalCacheSize) {
+                expressionCache.clear();
+            }
+            expressionCache.emplace(subexpression.get(), std::make_pair(subexpression, result));
+        }
+        return result;
+    }
+
+    // The maximal number of cached translations. Once it is reached, the cache is cleared.
+    static const uint64_t maximalCacheSize = 1ull << 16;
+
     // The expression manager to use.
     storm::expressions::ExpressionManager& manager;
 
@@ -375,6 +401,10 @@ class MathsatExpressionAdapter : public storm::expressions::ExpressionVisitor {
 
     // A mapping from MathSAT variable declarations to our variables.
     std::unordered_map<msat_decl, storm::expressions::Variable> declarationToVariableMapping;
+
+    // The cached translations. The expressions are kept alive such that their addresses are not reused by other expressions.
+    std::unordered_map<storm::expressions::BaseExpression const*, std::pair<std::shared_ptr<storm::expressions::BaseExpression const>, msat_term>>
+        expressionCache;
 };
 #endif
 }  // namespace adapters
@@ -23,6 +23,9 @@ typedef long long Z3_SIGNED_INTEGER;
 typedef unsigned long long Z3_UNSIGNED_INTEGER;
 #endif
 
+// The maximal number of translations that are kept across expressions. Once it is reached, the cache is cleared.
+static const uint64_t maximalPersistentCacheSize = 1ull << 16;
+
 Z3ExpressionAdapter::Z3ExpressionAdapter(storm::expressions::ExpressionManager& manager, z3::context& context)
     : manager(manager), context(context), additionalAssertions(), variableToExpressionMapping() {
     // Intentionally left empty.
@@ -41,6 +44,30 @@ z3::expr Z3ExpressionAdapter::translateExpression(storm::expressions::Expression
     return result.simplify();
 }
 
+z3::expr const* Z3ExpressionAdapter::getCachedTranslation(storm::expressions::BaseExpression const& expression) const {
+    auto cacheIt = expressionCache.find(&expression);
+    if (cacheIt != expressionCache.end()) {
+        return &cacheIt->second;
+    }
+    auto persistentCacheIt = persistentExpressionCache.find(&expression);
+    if (persistentCacheIt != persistentExpressionCache.end()) {
+        return &persistentCacheIt->second.second;
+    }
+    return nullptr;
+}
+
+void Z3ExpressionAdapter::cacheTranslation(storm::expressions::BaseExpression const& expression, z3::expr const& result,
+                                           uint64_t numberOfAdditionalAssertions) {
+    if (additionalAssertions.size() == numberOfAdditionalAssertions) {
+        if (persistentExpressionCache.size() >= maximalPersistentCacheSize) {
+            persistentExpressionCache.clear();
+        }
+        persistentExpressionCache.emplace(&expression, std::make_pair(expression.shared_from_this(), result));
+    } else {
+        expressionCache.emplace(&expression, result);
+    }
+}
+
 z3::expr Z3ExpressionAdapter::translateExpression(storm::expressions::Variable const& variable) {
     STORM_LOG_ASSERT(variable.getManager() == this->manager, "Invalid expression for solver.");
 
@@ -182,10 +209,10 @@ storm::expressions::Expression Z3ExpressionAdapter::translateExpression(z3::expr
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr leftResult = boost::any_cast<z3::expr>(expression.getFirstOperand()->accept(*this, data));
     z3::expr rightResult = boost::any_cast<z3::expr>(expression.getSecondOperand()->accept(*this, data));
@@ -213,15 +240,15 @@ boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryBooleanFunctionE
                                                                                             << "' in expression " << expression << ".");
     }
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr leftResult = boost::any_cast<z3::expr>(expression.getFirstOperand()->accept(*this, data));
     z3::expr rightResult = boost::any_cast<z3::expr>(expression.getSecondOperand()->accept(*this, data));
@@ -258,15 +285,15 @@ boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryNumericalFunctio
                                                                                               << "' in expression " << expression << ".");
     }
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr leftResult = boost::any_cast<z3::expr>(expression.getFirstOperand()->accept(*this, data));
     z3::expr rightResult = boost::any_cast<z3::expr>(expression.getSecondOperand()->accept(*this, data));
@@ -297,53 +324,53 @@ boost::any Z3ExpressionAdapter::visit(storm::expressions::BinaryRelationExpressi
                                                                                             << "' in expression " << expression << ".");
     }
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr result = context.bool_val(expression.getValue());
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     std::stringstream fractionStream;
     fractionStream << expression.getValue();
     z3::expr result = context.real_val(fractionStream.str().c_str());
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr result = context.int_val(static_cast<Z3_SIGNED_INTEGER>(expression.getValue()));
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr result = boost::any_cast<z3::expr>(expression.getOperand()->accept(*this, data));
 
@@ -357,15 +384,15 @@ boost::any Z3ExpressionAdapter::visit(storm::expressions::UnaryBooleanFunctionEx
                                                                                             << "' in expression " << expression << ".");
     }
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr result = boost::any_cast<z3::expr>(expression.getOperand()->accept(*this, data));
 
@@ -394,22 +421,22 @@ boost::any Z3ExpressionAdapter::visit(storm::expressions::UnaryNumericalFunction
                             "Cannot evaluate expression: unknown numerical unary operator '" << static_cast<int>(expression.getOperatorType()) << "'.");
     }
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
 boost::any Z3ExpressionAdapter::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
-    auto cacheIt = expressionCache.find(&expression);
-    if (cacheIt != expressionCache.end()) {
-        return cacheIt->second;
+    if (z3::expr const* cachedResult = getCachedTranslation(expression)) {
+        return *cachedResult;
     }
+    uint64_t numberOfAdditionalAssertions = additionalAssertions.size();
 
     z3::expr conditionResult = boost::any_cast<z3::expr>(expression.getCondition()->accept(*this, data));
     z3::expr thenResult = boost::any_cast<z3::expr>(expression.getThenExpression()->accept(*this, data));
     z3::expr elseResult = boost::any_cast<z3::expr>(expression.getElseExpression()->accept(*this, data));
     z3::expr result = z3::expr(context, Z3_mk_ite(context, conditionResult, thenResult, elseResult));
 
-    expressionCache.emplace(&expression, result);
+    cacheTranslation(expression, result, numberOfAdditionalAssertions);
     return result;
 }
 
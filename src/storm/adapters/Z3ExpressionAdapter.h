@@ -1,6 +1,7 @@
 #ifndef STORM_ADAPTERS_Z3EXPRESSIONADAPTER_H_
 #define STORM_ADAPTERS_Z3EXPRESSIONADAPTER_H_
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -104,8 +105,26 @@ class Z3ExpressionAdapter : public storm::expressions::ExpressionVisitor {
     // A mapping from z3 declarations to the corresponding variables.
     std::unordered_map<Z3_func_decl, storm::expressions::Variable> declarationToVariableMapping;
 
-    // A cache of already translated constraints. Only valid during the translation of one expression.
+    /*!
+     * Retrieves the cached translation of the given expression, or null if there is none.
+     */
+    z3::expr const* getCachedTranslation(storm::expressions::BaseExpression const& expression) const;
+
+    /*!
+     * Caches the translation of the given expression. If the translation did not introduce additional assertions, it stays valid when
+     * translating other expressions and is therefore cached persistently.
+     *
+     * @param numberOfAdditionalAssertions The number of additional assertions before the expression was translated.
+     */
+    void cacheTranslation(storm::expressions::BaseExpression const& expression, z3::expr const& result, uint64_t numberOfAdditionalAssertions);
+
+    // A cache of already translated constraints that introduced additional assertions. Only valid during the translation of one expression.
     std::unordered_map<storm::expressions::BaseExpression const*, z3::expr> expressionCache;
+
+    // A cache of translations that remain valid across expressions, for example for predicates that are asserted repeatedly as parts of
+    // different expressions. The expressions are kept alive such that their addresses are not reused by other expressions.
+    std::unordered_map<storm::expressions::BaseExpression const*, std::pair<std::shared_ptr<storm::expressions::BaseExpression const>, z3::expr>>
+        persistentExpressionCache;
 };
 #endif
 }  // namespace adapters
@@ -3,6 +3,7 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
@@ -16,34 +17,69 @@
 namespace storm {
 namespace api {
 
+/*!
+ * Computes the quotient of the given model with the given decomposition. The quotients are stored in the analysis cache of the model, such that
+ * properties over different subsets of the labels can be handled by one quotient: If a quotient preserving all required information is stored, it is
+ * returned directly (if it preserves exactly the required information) or minimized further instead of the (larger) model.
+ */
+template<typename DecompositionType, typename ModelType>
+std::shared_ptr<ModelType> performSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
+                                                                 std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+                                                                 storm::storage::BisimulationType type) {
+    auto createOptions = [&formulas, &type](ModelType const& modelToMinimize) {
+        typename DecompositionType::Options options;
+        if (!formulas.empty()) {
+            options = typename DecompositionType::Options(modelToMinimize, formulas);
+        }
+        options.setType(type);
+        options.signatureRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMode() ==
+                                      storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+        return options;
+    };
+    typename DecompositionType::Options options = createOptions(*model);
+
+    typedef typename storm::models::sparse::ModelAnalysisCache<typename ModelType::ValueType>::BisimulationPreservation PreservationType;
+    PreservationType preservation{options.getType(),
+                                  options.respectedAtomicPropositions ? options.respectedAtomicPropositions.get() : model->getStateLabeling().getLabels(),
+                                  options.getKeepRewards(), options.getBounded()};
+    auto& cache = model->getAnalysisCache();
+
+    // Quotients based on a measure driven initial partition only preserve the single formula, so they are neither reused nor stored.
+    if (!options.measureDrivenInitialPartition) {
+        if (auto quotient = cache.getBisimulationQuotient(preservation)) {
+            STORM_LOG_INFO("Reusing the stored bisimulation quotient with " << quotient->getNumberOfStates() << " states.");
+            return quotient->template as<ModelType>();
+        }
+    }
+
+    std::shared_ptr<ModelType> modelToMinimize = model;
+    if (auto coarseQuotient = cache.getCoveringBisimulationQuotient(preservation)) {
+        STORM_LOG_INFO("Minimizing the stored bisimulation quotient with " << coarseQuotient->getNumberOfStates() << " states further.");
+        modelToMinimize = coarseQuotient->template as<ModelType>();
+        options = createOptions(*modelToMinimize);
+    }
+
+    DecompositionType bisimulationDecomposition(*modelToMinimize, options);
+    bisimulationDecomposition.computeBisimulationDecomposition();
+    std::shared_ptr<ModelType> quotient = bisimulationDecomposition.getQuotient();
+    if (!options.measureDrivenInitialPartition) {
+        cache.storeBisimulationQuotient(preservation, quotient);
+    }
+    return quotient;
+}
+
 template<typename ModelType>
 std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
                                                                               std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
                                                                               storm::storage::BisimulationType type) {
-    typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
-    if (!formulas.empty()) {
-        options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
-    }
-    options.setType(type);
-
-    storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
-    bisimulationDecomposition.computeBisimulationDecomposition();
-    return bisimulationDecomposition.getQuotient();
+    return performSparseBisimulationMinimization<storm::storage::DeterministicModelBisimulationDecomposition<ModelType>>(model, formulas, type);
 }
 
 template<typename ModelType>
 std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model,
                                                                                  std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
                                                                                  storm::storage::BisimulationType type) {
-    typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options options;
-    if (!formulas.empty()) {
-        options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
-    }
-    options.setType(type);
-
-    storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
-    bisimulationDecomposition.computeBisimulationDecomposition();
-    return bisimulationDecomposition.getQuotient();
+    return performSparseBisimulationMinimization<storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>>(model, formulas, type);
 }
 
 template<typename ValueType>
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
@@ -18,6 +19,7 @@
 #include "storm/storage/sparse/ModelComponents.h"
 
 #include "storm/builder/BuilderType.h"
+#include "storm/builder/CompositionalJaniModelBuilder.h"
 #include "storm/builder/DdJaniModelBuilder.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 
@@ -27,6 +29,7 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/VariableRangeExceededException.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -87,12 +90,15 @@ inline std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, s
  * @param model SymbolicModelDescription of the model
  * @param options Builder options
  * @param actionMask An object to restrict which actions are expanded in the builder
+ * @param builderOptions Options of the builder itself (such as the exploration order)
  * @return A builder
  */
 template<typename ValueType>
-storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model,
-                                                                         storm::builder::BuilderOptions const& options,
-                                                                         std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
+storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(
+    storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+    std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr,
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options const& builderOptions =
+        typename storm::builder::ExplicitModelBuilder<ValueType>::Options()) {
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
     if (model.isPrismProgram()) {
         generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask);
@@ -102,13 +108,27 @@ storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
     }
-    return storm::builder::ExplicitModelBuilder<ValueType>(generator);
+    return storm::builder::ExplicitModelBuilder<ValueType>(generator, builderOptions);
 }
 
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
                                                                           storm::builder::BuilderOptions const& options) {
-    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options);
+    // The builder is discarded after building, so the explored states can be released early.
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options builderOptions;
+    builderOptions.releaseStateStorage = true;
+    if (options.isVariableRangeAnalysisSet()) {
+        // If a variable leaves the range computed by the analysis, the states need to be encoded with the declared ranges.
+        try {
+            return makeExplicitModelBuilder<ValueType>(model, options, nullptr, builderOptions).build();
+        } catch (storm::exceptions::VariableRangeExceededException const& e) {
+            STORM_LOG_WARN("Rebuilding the model without the variable range analysis: " << e.what());
+            storm::builder::BuilderOptions fallbackOptions = options;
+            fallbackOptions.setVariableRangeAnalysis(false);
+            return makeExplicitModelBuilder<ValueType>(model, fallbackOptions, nullptr, builderOptions).build();
+        }
+    }
+    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options, nullptr, builderOptions);
     return builder.build();
 }
 
@@ -119,6 +139,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return buildSparseModel<ValueType>(model, options);
 }
 
+/*!
+ * Builds the MDP of the given JANI model compositionally, i.e. by building and minimizing the automata separately and
+ * composing the minimized automata. The result is bisimilar to the model built by buildSparseModel.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> buildSparseModelCompositionally(
+    storm::jani::Model const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    return storm::builder::CompositionalJaniModelBuilder<ValueType>(model, formulas).build();
+}
+
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> buildSparseModel(
     storm::models::ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components) {
@@ -164,6 +194,18 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRNModel(
     return storm::parser::DirectEncodingParser<ValueType>::parseModel(drnFile, options);
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitDRBModel(
+    std::string const&, storm::parser::BinaryModelParserOptions const& = storm::parser::BinaryModelParserOptions()) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact or parametric models in the binary direct encoding are not supported.");
+}
+
+template<>
+inline std::shared_ptr<storm::models::sparse::Model<double>> buildExplicitDRBModel(std::string const& drbFile,
+                                                                                   storm::parser::BinaryModelParserOptions const& options) {
+    return storm::parser::BinaryModelParser::parseModel(drbFile, options);
+}
+
 template<typename ValueType>
 std::shared_ptr<storm::models::sparse::Model<ValueType>> buildExplicitIMCAModel(std::string const&) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exact models with direct encoding are not supported.");
@@ -3,12 +3,15 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/io/CompressedFile.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/file.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/CompactScheduler.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/macros.h"
 
@@ -25,11 +28,22 @@ void exportJaniModelAsDot(storm::jani::Model const& model, std::string const& fi
 template<typename ValueType>
 void exportSparseModelAsDrn(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename,
                             std::vector<std::string> const& parameterNames = {}, bool allowPlaceholders = true) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
+    auto stream = storm::utility::openOutputFile(filename);
     storm::exporter::DirectEncodingOptions options;
     options.allowPlaceholders = allowPlaceholders;
-    storm::exporter::explicitExportSparseModel(stream, model, parameterNames, options);
+    storm::exporter::explicitExportSparseModel(*stream, model, parameterNames, options);
+}
+
+template<typename ValueType>
+void exportSparseModelAsDrb(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, std::string const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting exact or parametric models in the binary direct encoding is not supported.");
+}
+
+template<>
+inline void exportSparseModelAsDrb<double>(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+    std::ofstream stream;
+    storm::utility::openFile(filename, stream, false, false, true);
+    storm::exporter::explicitExportSparseModelBinary(stream, model);
     storm::utility::closeFile(stream);
 }
 
@@ -40,18 +54,14 @@ void exportSymbolicModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Ty
 
 template<typename ValueType>
 void exportSparseModelAsDot(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename, size_t maxWidth = 30) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
-    model->writeDotToStream(stream, maxWidth);
-    storm::utility::closeFile(stream);
+    auto stream = storm::utility::openOutputFile(filename);
+    model->writeDotToStream(*stream, maxWidth);
 }
 
 template<typename ValueType>
 void exportSparseModelAsJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::string const& filename) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
-    model->writeJsonToStream(stream);
-    storm::utility::closeFile(stream);
+    auto stream = storm::utility::openOutputFile(filename);
+    model->writeJsonToStream(*stream);
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -62,32 +72,38 @@ void exportSymbolicModelAsDot(std::shared_ptr<storm::models::symbolic::Model<Typ
 template<typename ValueType>
 void exportScheduler(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::storage::Scheduler<ValueType> const& scheduler,
                      std::string const& filename) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
-    std::string jsonFileExtension = ".json";
-    if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
-        scheduler.printJsonToStream(stream, model, false, true);
+    std::string binaryFileExtension = ".bin";
+    if (filename.size() > 4 && std::equal(binaryFileExtension.rbegin(), binaryFileExtension.rend(), filename.rbegin())) {
+        STORM_LOG_THROW(scheduler.isMemorylessScheduler(), storm::exceptions::NotSupportedException,
+                        "The binary scheduler format only supports memoryless schedulers.");
+        std::ofstream stream;
+        storm::utility::openFile(filename, stream, false, false, true);
+        storm::storage::CompactScheduler<ValueType>(scheduler).exportBinary(stream);
+        storm::utility::closeFile(stream);
+        return;
+    }
+    auto stream = storm::utility::openOutputFile(filename);
+    std::string jsonFileExtension = storm::utility::isCompressedFile(filename) ? ".json.gz" : ".json";
+    if (filename.size() > jsonFileExtension.size() && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
+        scheduler.printJsonToStream(*stream, model, false, true);
     } else {
-        scheduler.printToStream(stream, model, false, true);
+        scheduler.printToStream(*stream, model, false, true);
     }
-    storm::utility::closeFile(stream);
 }
 
 template<typename ValueType>
 inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
                                     std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
-    std::ofstream stream;
-    storm::utility::openFile(filename, stream);
+    auto stream = storm::utility::openOutputFile(filename);
     if (checkResult->isExplicitQualitativeCheckResult()) {
-        stream << checkResult->asExplicitQualitativeCheckResult().toJson(model->getOptionalStateValuations(), model->getStateLabeling()).dump(4);
+        *stream << checkResult->asExplicitQualitativeCheckResult().toJson(model->getOptionalStateValuations(), model->getStateLabeling()).dump(4);
     } else {
         STORM_LOG_THROW(checkResult->isExplicitQuantitativeCheckResult(), storm::exceptions::NotSupportedException,
                         "Export of check results is only supported for explicit check results (e.g. in the sparse engine)");
-        stream << checkResult->template asExplicitQuantitativeCheckResult<ValueType>()
-                      .toJson(model->getOptionalStateValuations(), model->getStateLabeling())
-                      .dump(4);
+        *stream << checkResult->template asExplicitQuantitativeCheckResult<ValueType>()
+                       .toJson(model->getOptionalStateValuations(), model->getStateLabeling())
+                       .dump(4);
     }
-    storm::utility::closeFile(stream);
 }
 
 template<>
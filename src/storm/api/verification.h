@@ -4,6 +4,9 @@
 
 #include "storm/environment/Environment.h"
 
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/logic/Formulas.h"
+
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
@@ -18,7 +21,9 @@
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/simulation/StatisticalModelChecker.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
@@ -33,6 +38,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/EliminationSettings.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
@@ -183,6 +189,43 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with Simulation engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    STORM_LOG_THROW(model.isPrismProgram(), storm::exceptions::NotSupportedException, "Simulation engine is currently only applicable to PRISM models.");
+    storm::prism::Program const& program = model.asPrismProgram();
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
+        storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(program);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << program.getModelType() << " is not supported by the simulation engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSimulationEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSimulationEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                             storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSimulationEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
@@ -350,6 +393,36 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(std::sh
     return verifyWithSparseEngine(env, model, task);
 }
 
+/*!
+ * Checks several tasks on the given model at once, where compatible tasks share the passes over the transition matrix.
+ * Currently, step-bounded until probabilities and cumulative rewards on MDPs as well as time-bounded until probabilities
+ * on CTMCs are batched.
+ *
+ * @return The results in the order of the tasks. Results of tasks that were not batched are null.
+ */
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyBatchWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    if (model->getType() == storm::models::ModelType::Mdp) {
+        auto mdp = model->template as<storm::models::sparse::Mdp<ValueType>>();
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+        return modelchecker.checkBatch(env, tasks);
+    } else if (model->getType() == storm::models::ModelType::Ctmc) {
+        auto ctmc = model->template as<storm::models::sparse::Ctmc<ValueType>>();
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+        return modelchecker.checkBatch(env, tasks);
+    }
+    return std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>(tasks.size());
+}
+
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>>::type
+verifyBatchWithSparseEngine(storm::Environment const&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&,
+                            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+    return std::vector<std::unique_ptr<storm::modelchecker::CheckResult>>(tasks.size());
+}
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
@@ -412,6 +485,81 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWi
     return result;
 }
 
+/*!
+ * Computes a lower and an upper bound on the value of the given unbounded reachability probability in the initial state
+ * by building the model only partially. The states that are not explored are made absorbing and considered to not reach
+ * (resp. to reach) the target states. As long as the bounds differ by more than the given precision, the exploration
+ * budget is doubled and the exploration continues, where the previously explored part of the model is reused.
+ *
+ * @param model The PRISM program or JANI model.
+ * @param formula The formula, which needs to be of the form P=? [ F psi ] or P=? [ phi U psi ] (possibly with min/max).
+ * @param precision The maximal difference between the bounds.
+ * @param initialBudget The number of states that are explored in the first iteration.
+ * @return The lower and the upper bound.
+ */
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::pair<ValueType, ValueType>>::type computeBoundsWithPartialExploration(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model, std::shared_ptr<storm::logic::Formula const> const& formula,
+    ValueType const& precision, uint64_t initialBudget = 10000) {
+    STORM_LOG_THROW(formula->isProbabilityOperatorFormula(), storm::exceptions::NotSupportedException,
+                    "Partial exploration only supports probability operator formulas.");
+    STORM_LOG_THROW(initialBudget > 0, storm::exceptions::InvalidArgumentException, "The exploration budget must be positive.");
+    auto const& operatorFormula = formula->asProbabilityOperatorFormula();
+    auto const& pathFormula = operatorFormula.getSubformula();
+
+    // The upper bound is obtained by additionally considering the unexplored states as target states.
+    auto unexploredFormula = std::make_shared<storm::logic::AtomicLabelFormula const>(storm::builder::ExplicitModelBuilder<ValueType>::getUnexploredLabel());
+    std::shared_ptr<storm::logic::Formula const> upperPathFormula;
+    if (pathFormula.isEventuallyFormula()) {
+        upperPathFormula = std::make_shared<storm::logic::EventuallyFormula const>(std::make_shared<storm::logic::BinaryBooleanStateFormula const>(
+            storm::logic::BinaryBooleanStateFormula::OperatorType::Or, pathFormula.asEventuallyFormula().getSubformula().asSharedPointer(), unexploredFormula));
+    } else if (pathFormula.isUntilFormula()) {
+        auto const& untilFormula = pathFormula.asUntilFormula();
+        upperPathFormula = std::make_shared<storm::logic::UntilFormula const>(
+            untilFormula.getLeftSubformula().asSharedPointer(),
+            std::make_shared<storm::logic::BinaryBooleanStateFormula const>(storm::logic::BinaryBooleanStateFormula::OperatorType::Or,
+                                                                            untilFormula.getRightSubformula().asSharedPointer(), unexploredFormula));
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Partial exploration only supports unbounded reachability probabilities.");
+    }
+    auto upperFormula = std::make_shared<storm::logic::ProbabilityOperatorFormula const>(upperPathFormula, operatorFormula.getOperatorInformation());
+
+    storm::builder::BuilderOptions builderOptions(std::vector<std::shared_ptr<storm::logic::Formula const>>{formula}, model);
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options explorationOptions;
+    explorationOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    explorationOptions.explorationBudget = initialBudget;
+    std::unique_ptr<storm::builder::ExplicitModelBuilder<ValueType>> builder;
+    if (model.isPrismProgram()) {
+        builder = std::make_unique<storm::builder::ExplicitModelBuilder<ValueType>>(model.asPrismProgram(), builderOptions, explorationOptions);
+    } else {
+        STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Partial exploration requires a PRISM program or JANI model.");
+        builder = std::make_unique<storm::builder::ExplicitModelBuilder<ValueType>>(model.asJaniModel(), builderOptions, explorationOptions);
+    }
+
+    uint64_t budget = initialBudget;
+    while (true) {
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> partialModel = builder->build();
+        STORM_LOG_THROW(partialModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException,
+                        "Partial exploration requires a unique initial state.");
+        uint64_t initialState = *partialModel->getInitialStates().begin();
+
+        auto lowerResult = verifyWithSparseEngine<ValueType>(env, partialModel, createTask<ValueType>(formula, true));
+        ValueType lowerBound = lowerResult->template asExplicitQuantitativeCheckResult<ValueType>()[initialState];
+        if (!builder->hasUnexploredStates()) {
+            return std::make_pair(lowerBound, lowerBound);
+        }
+        auto upperResult = verifyWithSparseEngine<ValueType>(env, partialModel, createTask<ValueType>(upperFormula, true));
+        ValueType upperBound = upperResult->template asExplicitQuantitativeCheckResult<ValueType>()[initialState];
+        STORM_LOG_INFO("Bounds [" << lowerBound << ", " << upperBound << "] after exploring with a budget of " << budget << " states.");
+        if (upperBound - lowerBound <= precision) {
+            return std::make_pair(lowerBound, upperBound);
+        }
+
+        budget *= 2;
+        builder->setExplorationBudget(budget);
+    }
+}
+
 //
 // Verifying with Hybrid engine
 //
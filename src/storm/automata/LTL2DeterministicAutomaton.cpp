@@ -8,6 +8,12 @@
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <atomic>
+#include <filesystem>
+#include <future>
+#include <map>
+#include <mutex>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
@@ -20,8 +26,87 @@
 namespace storm {
 namespace automata {
 
+namespace {
+typedef std::shared_future<std::shared_ptr<DeterministicAutomaton>> AutomatonFuture;
+
+// The cached automata (or running translations) by formula, tool and DNF flag.
+std::mutex automatonCacheMutex;
+std::map<std::string, AutomatonFuture> automatonCache;
+
+// Spot (in particular its BDD library) is not thread-safe, so only one translation with Spot may run at a time.
+std::mutex spotMutex;
+
+// Used to give the output files of concurrent calls of external tools distinct names.
+std::atomic<uint64_t> externalToolCallCounter(0);
+
+std::string getCacheKey(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool) {
+    return (ltl2daTool ? "tool " + *ltl2daTool : std::string("spot")) + (dnf ? " dnf " : " ") + f.toPrefixString();
+}
+
+std::shared_ptr<DeterministicAutomaton> translate(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool) {
+    if (ltl2daTool) {
+        return LTL2DeterministicAutomaton::ltl2daExternalTool(f, *ltl2daTool);
+    } else {
+        return LTL2DeterministicAutomaton::ltl2daSpot(f, dnf);
+    }
+}
+}  // namespace
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2da(storm::logic::Formula const& f, bool dnf,
+                                                                           boost::optional<std::string> const& ltl2daTool) {
+    std::string key = getCacheKey(f, dnf, ltl2daTool);
+    std::promise<std::shared_ptr<DeterministicAutomaton>> promise;
+    AutomatonFuture future;
+    bool translateHere = false;
+    {
+        std::lock_guard<std::mutex> lock(automatonCacheMutex);
+        auto it = automatonCache.find(key);
+        if (it == automatonCache.end()) {
+            future = promise.get_future().share();
+            automatonCache.emplace(key, future);
+            translateHere = true;
+        } else {
+            STORM_LOG_INFO("Using the cached deterministic automaton for " << f.toPrefixString() << ".");
+            future = it->second;
+        }
+    }
+    if (translateHere) {
+        try {
+            promise.set_value(translate(f, dnf, ltl2daTool));
+        } catch (...) {
+            // Remove the failed translation such that it is retried upon the next request.
+            {
+                std::lock_guard<std::mutex> lock(automatonCacheMutex);
+                automatonCache.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+        }
+    }
+    return future.get();
+}
+
+void LTL2DeterministicAutomaton::startTranslation(std::shared_ptr<storm::logic::Formula const> const& f, bool dnf,
+                                                  boost::optional<std::string> const& ltl2daTool) {
+    std::string key = getCacheKey(*f, dnf, ltl2daTool);
+    std::lock_guard<std::mutex> lock(automatonCacheMutex);
+    if (automatonCache.count(key) == 0) {
+        STORM_LOG_INFO("Translating " << f->toPrefixString() << " into a deterministic automaton in the background.");
+        automatonCache.emplace(key, std::async(std::launch::async, [f, dnf, ltl2daTool]() { return translate(*f, dnf, ltl2daTool); }).share());
+    }
+}
+
+void LTL2DeterministicAutomaton::clearCache() {
+    std::map<std::string, AutomatonFuture> entries;
+    {
+        std::lock_guard<std::mutex> lock(automatonCacheMutex);
+        std::swap(entries, automatonCache);
+    }
+    // Destroying the entries (outside of the lock) waits for running background translations.
+}
+
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
+    std::lock_guard<std::mutex> spotLock(spotMutex);
     std::string prefixLtl = f.toPrefixString();
 
     spot::parsed_formula spotPrefixLtl = spot::parse_prefix_ltl(prefixLtl);
@@ -64,8 +149,11 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
     std::string prefixLtl = f.toPrefixString();
+    std::string outputFile =
+        (std::filesystem::temp_directory_path() / ("storm-da-" + std::to_string(getpid()) + "-" + std::to_string(externalToolCallCounter++) + ".hoa"))
+            .string();
 
-    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' da.hoa");
+    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' " << outputFile);
 
     pid_t pid;
 
@@ -74,7 +162,7 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
 
     if (pid == 0) {
         // we are in the child process
-        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), "da.hoa", NULL) < 0) {
+        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), outputFile.c_str(), NULL) < 0) {
             std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
             std::exit(1);
         }
@@ -83,8 +171,8 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     } else {  // in the parent
         int status;
 
-        // wait for completion
-        while (wait(&status) != pid)
+        // wait for completion (of this child, as other threads may run tools concurrently)
+        while (waitpid(pid, &status, 0) != pid)
             ;
 
         int rv;
@@ -96,9 +184,12 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
         STORM_LOG_THROW(rv == 0, storm::exceptions::FileIoException,
                         "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
 
-        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from da.hoa");
+        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from " << outputFile);
 
-        return DeterministicAutomaton::parseFromFile("da.hoa");
+        DeterministicAutomaton::ptr da = DeterministicAutomaton::parseFromFile(outputFile);
+        std::error_code error;
+        std::filesystem::remove(outputFile, error);
+        return da;
     }
 }
 
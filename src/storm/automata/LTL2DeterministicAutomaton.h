@@ -1,6 +1,8 @@
 #pragma
 
+#include <boost/optional.hpp>
 #include <memory>
+#include <string>
 
 namespace storm {
 
@@ -35,6 +37,30 @@ class LTL2DeterministicAutomaton {
      * @return An automaton equivalent to the formula.
      */
     static std::shared_ptr<DeterministicAutomaton> ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool);
+
+    /*!
+     * Converts an LTL formula into a deterministic omega-automaton using the given external tool or (if none is given) Spot.
+     * The automata are kept in a process-wide cache whose keys are the prefix string of the formula, the tool and the DNF flag, so each formula is
+     * only translated once. If the formula is currently being translated by another thread (see startTranslation), this waits for the result.
+     * As the automaton may be shared, it must not be modified.
+     *
+     * @param f The LTL formula.
+     * @param dnf A Flag indicating whether the acceptance condition is transformed into DNF (only considered for Spot).
+     * @param ltl2daTool The external tool (if any).
+     * @return An automaton equivalent to the formula.
+     */
+    static std::shared_ptr<DeterministicAutomaton> ltl2da(storm::logic::Formula const& f, bool dnf, boost::optional<std::string> const& ltl2daTool);
+
+    /*!
+     * Starts translating the formula (like ltl2da) in a background thread unless it is already in the cache. Errors of the translation are reported
+     * once the automaton is retrieved with ltl2da.
+     */
+    static void startTranslation(std::shared_ptr<storm::logic::Formula const> const& f, bool dnf, boost::optional<std::string> const& ltl2daTool);
+
+    /*!
+     * Removes all automata from the cache. Translations that are still running are waited for.
+     */
+    static void clearCache();
 };
 
 }  // namespace automata
@@ -1,5 +1,7 @@
 #include "storm/builder/BuilderOptions.h"
 
+#include <sstream>
+
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
@@ -49,8 +51,12 @@ BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels)
       explorationChecks(false),
       inferObservationsFromActions(false),
       addOverlappingGuardsLabel(false),
+      symmetryReduction(false),
+      partialOrderReduction(false),
+      variableRangeAnalysis(false),
       addOutOfBoundsState(false),
       reservedBitsForUnboundedVariables(32),
+      maximalGuardTableBits(16),
       showProgress(false),
       showProgressDelay(0) {
     // Intentionally left empty.
@@ -70,6 +76,8 @@ BuilderOptions::BuilderOptions(std::vector<std::shared_ptr<storm::logic::Formula
         }
         if (formulas.size() == 1) {
             this->setTerminalStatesFromFormula(*formulas.front());
+        } else {
+            this->setTerminalStatesFromFormulas(formulas);
         }
     }
 
@@ -117,6 +125,27 @@ void BuilderOptions::setTerminalStatesFromFormula(storm::logic::Formula const& f
         [this](std::string const& label, bool inverted) { this->addTerminalLabel(label, inverted); });
 }
 
+void BuilderOptions::setTerminalStatesFromFormulas(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    std::vector<std::vector<std::pair<LabelOrExpression, bool>>> newTerminalStateSets;
+    for (auto const& formula : formulas) {
+        std::vector<std::pair<LabelOrExpression, bool>> terminalStateSet;
+        getTerminalStatesFromFormula(
+            *formula,
+            [&terminalStateSet](storm::expressions::Expression const& expr, bool inverted) {
+                terminalStateSet.emplace_back(LabelOrExpression(expr), inverted);
+            },
+            [&terminalStateSet](std::string const& label, bool inverted) { terminalStateSet.emplace_back(LabelOrExpression(label), inverted); });
+        if (terminalStateSet.empty()) {
+            // The exploration must not stop anywhere for this formula.
+            return;
+        }
+        newTerminalStateSets.push_back(std::move(terminalStateSet));
+    }
+    for (auto const& terminalStateSet : newTerminalStateSets) {
+        addTerminalStateSet(terminalStateSet);
+    }
+}
+
 std::set<std::string> const& BuilderOptions::getRewardModelNames() const {
     return rewardModelNames;
 }
@@ -133,12 +162,17 @@ std::vector<std::pair<LabelOrExpression, bool>> const& BuilderOptions::getTermin
     return terminalStates;
 }
 
+std::vector<std::vector<std::pair<LabelOrExpression, bool>>> const& BuilderOptions::getTerminalStateSets() const {
+    return terminalStateSets;
+}
+
 bool BuilderOptions::hasTerminalStates() const {
-    return !terminalStates.empty();
+    return !terminalStates.empty() || !terminalStateSets.empty();
 }
 
 void BuilderOptions::clearTerminalStates() {
     terminalStates.clear();
+    terminalStateSets.clear();
 }
 
 bool BuilderOptions::isApplyMaximalProgressAssumptionSet() const {
@@ -185,10 +219,26 @@ uint64_t BuilderOptions::getReservedBitsForUnboundedVariables() const {
     return reservedBitsForUnboundedVariables;
 }
 
+uint64_t BuilderOptions::getMaximalGuardTableBits() const {
+    return maximalGuardTableBits;
+}
+
 bool BuilderOptions::isAddOverlappingGuardLabelSet() const {
     return addOverlappingGuardsLabel;
 }
 
+bool BuilderOptions::isSymmetryReductionSet() const {
+    return symmetryReduction;
+}
+
+bool BuilderOptions::isPartialOrderReductionSet() const {
+    return partialOrderReduction;
+}
+
+bool BuilderOptions::isVariableRangeAnalysisSet() const {
+    return variableRangeAnalysis;
+}
+
 BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
     buildAllRewardModels = newValue;
     return *this;
@@ -206,6 +256,56 @@ uint64_t BuilderOptions::getShowProgressDelay() const {
     return showProgressDelay;
 }
 
+std::string BuilderOptions::getDescription() const {
+    std::stringstream stream;
+    stream << "reward models: ";
+    if (buildAllRewardModels) {
+        stream << "all";
+    } else {
+        for (auto const& name : rewardModelNames) {
+            stream << "'" << name << "' ";
+        }
+    }
+    stream << "\nlabels: ";
+    if (buildAllLabels) {
+        stream << "all";
+    } else {
+        for (auto const& name : labelNames) {
+            stream << "'" << name << "' ";
+        }
+    }
+    stream << "\nexpression labels: ";
+    for (auto const& label : expressionLabels) {
+        stream << "'" << label.first << "'=" << label.second << " ";
+    }
+    stream << "\nterminal states: ";
+    for (auto const& terminalState : terminalStates) {
+        if (terminalState.first.isLabel()) {
+            stream << "'" << terminalState.first.getLabel() << "'";
+        } else {
+            stream << terminalState.first.getExpression();
+        }
+        stream << "=" << terminalState.second << " ";
+    }
+    for (auto const& terminalStateSet : terminalStateSets) {
+        stream << "{ ";
+        for (auto const& terminalState : terminalStateSet) {
+            if (terminalState.first.isLabel()) {
+                stream << "'" << terminalState.first.getLabel() << "'";
+            } else {
+                stream << terminalState.first.getExpression();
+            }
+            stream << "=" << terminalState.second << " ";
+        }
+        stream << "} ";
+    }
+    stream << "\nflags: " << applyMaximalProgressAssumption << buildChoiceLabels << buildStateValuations << buildObservationValuations << buildChoiceOrigins
+           << scaleAndLiftTransitionRewards << explorationChecks << inferObservationsFromActions << addOverlappingGuardsLabel << addOutOfBoundsState
+           << symmetryReduction << partialOrderReduction;
+    stream << "\nreserved bits for unbounded variables: " << reservedBitsForUnboundedVariables << "\n";
+    return stream.str();
+}
+
 BuilderOptions& BuilderOptions::setExplorationChecks(bool newValue) {
     explorationChecks = newValue;
     return *this;
@@ -245,6 +345,11 @@ BuilderOptions& BuilderOptions::addTerminalLabel(std::string const& label, bool
     return *this;
 }
 
+BuilderOptions& BuilderOptions::addTerminalStateSet(std::vector<std::pair<LabelOrExpression, bool>> const& terminalStateSet) {
+    terminalStateSets.push_back(terminalStateSet);
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setApplyMaximalProgressAssumption(bool newValue) {
     applyMaximalProgressAssumption = newValue;
     return *this;
@@ -285,11 +390,31 @@ BuilderOptions& BuilderOptions::setReservedBitsForUnboundedVariables(uint64_t ne
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setMaximalGuardTableBits(uint64_t newValue) {
+    maximalGuardTableBits = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::setAddOverlappingGuardsLabel(bool newValue) {
     addOverlappingGuardsLabel = newValue;
     return *this;
 }
 
+BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+    symmetryReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+    partialOrderReduction = newValue;
+    return *this;
+}
+
+BuilderOptions& BuilderOptions::setVariableRangeAnalysis(bool newValue) {
+    variableRangeAnalysis = newValue;
+    return *this;
+}
+
 BuilderOptions& BuilderOptions::substituteExpressions(
     std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
     for (auto& e : expressionLabels) {
@@ -301,6 +426,13 @@ BuilderOptions& BuilderOptions::substituteExpressions(
             t.first = LabelOrExpression(substitutionFunction(t.first.getExpression()));
         }
     }
+    for (auto& terminalStateSet : terminalStateSets) {
+        for (auto& t : terminalStateSet) {
+            if (t.first.isExpression()) {
+                t.first = LabelOrExpression(substitutionFunction(t.first.getExpression()));
+            }
+        }
+    }
     return *this;
 }
 
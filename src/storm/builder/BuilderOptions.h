@@ -86,6 +86,15 @@ class BuilderOptions {
      */
     void setTerminalStatesFromFormula(storm::logic::Formula const& formula);
 
+    /*!
+     * Analyzes the given formulas and sets the terminal states such that the exploration only stops at states that
+     * are terminal for each of the formulas, i.e. the union of the parts of the model that are relevant for the
+     * formulas is explored. If one of the formulas does not allow for terminal states, no terminal states are set.
+     *
+     * @param formulas The formulas used to (possibly) derive the terminal states of the model.
+     */
+    void setTerminalStatesFromFormulas(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas);
+
     /*!
      * Which reward models are built
      * @return
@@ -104,6 +113,7 @@ class BuilderOptions {
      */
     std::vector<std::pair<std::string, storm::expressions::Expression>> const& getExpressionLabels() const;
     std::vector<std::pair<LabelOrExpression, bool>> const& getTerminalStates() const;
+    std::vector<std::vector<std::pair<LabelOrExpression, bool>>> const& getTerminalStateSets() const;
     bool hasTerminalStates() const;
     void clearTerminalStates();
     bool isApplyMaximalProgressAssumptionSet() const;
@@ -120,8 +130,18 @@ class BuilderOptions {
     bool isAddOutOfBoundsStateSet() const;
     uint64_t getReservedBitsForUnboundedVariables() const;
     bool isAddOverlappingGuardLabelSet() const;
+    bool isSymmetryReductionSet() const;
+    bool isPartialOrderReductionSet() const;
+    bool isVariableRangeAnalysisSet() const;
+    uint64_t getMaximalGuardTableBits() const;
     uint64_t getShowProgressDelay() const;
 
+    /*!
+     * Retrieves a textual description of all options that influence the model that is built. Options that only
+     * affect the output during model building (such as showing the progress) are not part of the description.
+     */
+    std::string getDescription() const;
+
     /**
      * Should all reward models be built? If not set, only required reward models are build.
      * @param newValue The new value (default true)
@@ -144,6 +164,13 @@ class BuilderOptions {
     BuilderOptions& addLabel(std::string const& labelName);
     BuilderOptions& addTerminalExpression(storm::expressions::Expression const& expression, bool value);
     BuilderOptions& addTerminalLabel(std::string const& label, bool value);
+    /**
+     * Adds a set of labels/expressions such that the exploration can only stop at a state if one of them evaluates to
+     * the given bool (and the same holds for all other added sets).
+     * @param terminalStateSet The labels/expressions of the set.
+     * @return this
+     */
+    BuilderOptions& addTerminalStateSet(std::vector<std::pair<LabelOrExpression, bool>> const& terminalStateSet);
     /**
      * Should the maximal progress assumption be applied when building a Markov Automaton?
      * @param newValue If this is true, Markovian edges are not explored from probabilistic states
@@ -206,11 +233,37 @@ class BuilderOptions {
      */
     BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+    /**
+     * Should the symmetry of modules that are renamed from the same module be exploited (only for PRISM programs)
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+    /**
+     * Should only singleton ample sets of independent, invisible commands be explored where possible (only for PRISM
+     * MDPs). This preserves the minimal and maximal probabilities of stutter-insensitive properties of the initial states.
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setPartialOrderReduction(bool newValue = true);
+
+    /**
+     * Should the ranges of integer variables be narrowed to the values they can take in reachable states (as determined by an interval analysis,
+     * only for PRISM programs). This reduces the number of bits of the states but does not change the built model.
+     * @param newValue the new value (default true)
+     */
+    BuilderOptions& setVariableRangeAnalysis(bool newValue = true);
+
     /**
      * Sets the number of bits that will be reserved for unbounded integer variables.
      */
     BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
 
+    /**
+     * Sets the maximal number of bits of the variables over which the values of a guard are cached. Zero disables the
+     * caching of guards.
+     */
+    BuilderOptions& setMaximalGuardTableBits(uint64_t value);
+
     /**
      * Substitutes all expressions occurring in these options.
      */
@@ -236,6 +289,9 @@ class BuilderOptions {
     /// If one of these labels/expressions evaluates to the given bool, the builder can abort the exploration.
     std::vector<std::pair<LabelOrExpression, bool>> terminalStates;
 
+    /// The builder can also abort the exploration if for each of these sets, one of the labels/expressions evaluates to the given bool.
+    std::vector<std::vector<std::pair<LabelOrExpression, bool>>> terminalStateSets;
+
     /// A flag indicating whether the maximal progress assumption is applied when building a Markov Automaton.
     /// If this is true, Markovian edges are not explored from probabilistic states.
     bool applyMaximalProgressAssumption;
@@ -265,12 +321,24 @@ class BuilderOptions {
     /// A flag for states with overlapping guards
     bool addOverlappingGuardsLabel;
 
+    /// A flag indicating whether states that only differ in the order of symmetric modules are merged.
+    bool symmetryReduction;
+
+    /// A flag indicating whether the interleavings of independent commands are reduced.
+    bool partialOrderReduction;
+
+    /// A flag indicating whether the ranges of integer variables are narrowed by an interval analysis.
+    bool variableRangeAnalysis;
+
     /// A flag indicating that the an additional state for out of bounds should be created.
     bool addOutOfBoundsState;
 
     /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
     uint64_t reservedBitsForUnboundedVariables;
 
+    /// The maximal number of bits of the variables over which the values of a guard are cached.
+    uint64_t maximalGuardTableBits;
+
     /// A flag that stores whether the progress of exploration is to be printed.
     bool showProgress;
 
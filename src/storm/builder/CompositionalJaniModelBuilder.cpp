@@ -0,0 +1,379 @@
+#include "storm/builder/CompositionalJaniModelBuilder.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/logic/Formulas.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/visitor/CompositionInformationVisitor.h"
+#include "storm/storage/sparse/JaniChoiceOrigins.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+// The action of the self-loops that are added to deadlock states. These choices can not be taken in compositions.
+uint64_t const DEADLOCK_ACTION = std::numeric_limits<uint64_t>::max();
+
+std::string getLabelName(storm::expressions::Expression const& expression) {
+    // Expression labels are named like in the builder options, such that the atomic expressions of the formulas refer to them.
+    std::stringstream stream;
+    stream << expression;
+    return stream.str();
+}
+}  // namespace
+
+template<typename ValueType>
+CompositionalJaniModelBuilder<ValueType>::CompositionalJaniModelBuilder(storm::jani::Model const& model,
+                                                                        std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas)
+    : model(model), peakNumberOfStates(0) {
+    std::set<std::string> labelNames;
+    for (auto const& formula : formulas) {
+        for (auto const& atomicExpressionFormula : formula->getAtomicExpressionFormulas()) {
+            if (labelNames.insert(getLabelName(atomicExpressionFormula->getExpression())).second) {
+                atomicExpressions.push_back(atomicExpressionFormula->getExpression());
+            }
+        }
+        for (auto const& atomicLabelFormula : formula->getAtomicLabelFormulas()) {
+            STORM_LOG_THROW(atomicLabelFormula->getLabel() == "init" || atomicLabelFormula->getLabel() == "deadlock", storm::exceptions::NotSupportedException,
+                            "Compositional building does not support the label '" << atomicLabelFormula->getLabel() << "'.");
+        }
+    }
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Mdp<ValueType>> CompositionalJaniModelBuilder<ValueType>::build() {
+    STORM_LOG_THROW(model.getModelType() == storm::jani::ModelType::MDP, storm::exceptions::NotSupportedException,
+                    "Compositional building is only supported for MDPs.");
+    STORM_LOG_THROW(!model.hasUndefinedConstants(), storm::exceptions::InvalidArgumentException, "The model has undefined constants.");
+    STORM_LOG_THROW(model.hasStandardComposition(), storm::exceptions::NotSupportedException,
+                    "Compositional building requires the automata to be composed in parallel, synchronizing on their common actions.");
+    STORM_LOG_THROW(model.getGlobalVariables().getNumberOfNontransientVariables() == 0, storm::exceptions::NotSupportedException,
+                    "Compositional building does not support global variables.");
+    STORM_LOG_THROW(!model.hasInitialStatesRestriction() || model.getInitialStatesRestriction().isTrue(), storm::exceptions::NotSupportedException,
+                    "Compositional building does not support restrictions of the initial states.");
+    peakNumberOfStates = 0;
+
+    // Collect the automata in the order of their declaration.
+    storm::jani::CompositionInformation information = storm::jani::CompositionInformationVisitor(model, model.getSystemComposition()).getInformation();
+    std::vector<std::reference_wrapper<storm::jani::Automaton const>> automata;
+    for (auto const& automaton : model.getAutomata()) {
+        if (information.getAutomatonToMultiplicityMap().count(automaton.getName()) > 0) {
+            automata.push_back(automaton);
+        }
+    }
+    STORM_LOG_THROW(!automata.empty(), storm::exceptions::InvalidArgumentException, "The model does not have any automaton.");
+
+    // Every atomic expression is a label of the automaton whose variables it refers to.
+    std::vector<std::vector<storm::expressions::Expression>> labelExpressions(automata.size());
+    for (auto const& expression : atomicExpressions) {
+        boost::optional<uint64_t> owner;
+        for (auto const& variable : expression.getVariables()) {
+            if (model.hasConstant(variable.getName())) {
+                continue;
+            }
+            auto automatonIt = std::find_if(automata.begin(), automata.end(), [&variable](storm::jani::Automaton const& automaton) {
+                return automaton.getVariables().hasVariable(variable);
+            });
+            STORM_LOG_THROW(automatonIt != automata.end(), storm::exceptions::NotSupportedException,
+                            "Atomic expression '" << expression << "' refers to variable '" << variable.getName() << "' that is not local to an automaton.");
+            uint64_t automatonIndex = std::distance(automata.begin(), automatonIt);
+            STORM_LOG_THROW(!owner || owner.get() == automatonIndex, storm::exceptions::NotSupportedException,
+                            "Atomic expression '" << expression << "' refers to the variables of multiple automata.");
+            owner = automatonIndex;
+        }
+        labelExpressions[owner.get_value_or(0)].push_back(expression);
+    }
+
+    // Build and minimize the components. Actions that no other component synchronizes on are hidden right away.
+    std::vector<Component> components;
+    for (uint64_t automatonIndex = 0; automatonIndex < automata.size(); ++automatonIndex) {
+        components.push_back(buildComponent(automata[automatonIndex], labelExpressions[automatonIndex]));
+    }
+    for (uint64_t componentIndex = 0; componentIndex < components.size(); ++componentIndex) {
+        std::set<uint64_t> otherAlphabet;
+        for (uint64_t otherComponentIndex = 0; otherComponentIndex < components.size(); ++otherComponentIndex) {
+            if (otherComponentIndex != componentIndex) {
+                otherAlphabet.insert(components[otherComponentIndex].alphabet.begin(), components[otherComponentIndex].alphabet.end());
+            }
+        }
+        hide(components[componentIndex], otherAlphabet);
+        minimize(components[componentIndex]);
+        STORM_LOG_INFO("Minimized automaton '" << automata[componentIndex].get().getName() << "' to " << components[componentIndex].model->getNumberOfStates()
+                                               << " states.");
+    }
+
+    // Compose the components one after the other, minimizing every intermediate result.
+    Component result = std::move(components.front());
+    for (uint64_t componentIndex = 1; componentIndex < components.size(); ++componentIndex) {
+        result = compose(result, components[componentIndex]);
+        std::set<uint64_t> remainingAlphabet;
+        for (uint64_t remainingComponentIndex = componentIndex + 1; remainingComponentIndex < components.size(); ++remainingComponentIndex) {
+            remainingAlphabet.insert(components[remainingComponentIndex].alphabet.begin(), components[remainingComponentIndex].alphabet.end());
+        }
+        STORM_LOG_INFO("Composed the first " << (componentIndex + 1) << " automata to " << result.model->getNumberOfStates() << " states.");
+        hide(result, remainingAlphabet);
+        minimize(result);
+        STORM_LOG_INFO("Minimized the composition to " << result.model->getNumberOfStates() << " states.");
+    }
+
+    // The deadlock states are the ones with the self-loop that was added to them.
+    storm::storage::BitVector deadlockStates(result.model->getNumberOfStates());
+    auto const& rowGroupIndices = result.model->getTransitionMatrix().getRowGroupIndices();
+    for (uint64_t state = 0; state < result.model->getNumberOfStates(); ++state) {
+        deadlockStates.set(state, result.choiceActions[rowGroupIndices[state]] == DEADLOCK_ACTION);
+    }
+    result.model->getStateLabeling().addLabel("deadlock", std::move(deadlockStates));
+    return result.model;
+}
+
+template<typename ValueType>
+uint64_t CompositionalJaniModelBuilder<ValueType>::getPeakNumberOfStates() const {
+    return peakNumberOfStates;
+}
+
+template<typename ValueType>
+typename CompositionalJaniModelBuilder<ValueType>::Component CompositionalJaniModelBuilder<ValueType>::buildComponent(
+    storm::jani::Automaton const& automaton, std::vector<storm::expressions::Expression> const& labelExpressions) {
+    storm::builder::BuilderOptions options;
+    options.setBuildChoiceOrigins();
+    for (auto const& expression : labelExpressions) {
+        options.addLabel(expression);
+    }
+    auto generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.createModelFromAutomaton(automaton), options);
+    auto builtModel = storm::builder::ExplicitModelBuilder<ValueType>(generator).build()->template as<storm::models::sparse::Mdp<ValueType>>();
+    peakNumberOfStates = std::max<uint64_t>(peakNumberOfStates, builtModel->getNumberOfStates());
+
+    // Retrieve the actions of the choices from the edges they originate from.
+    Component result;
+    auto const& choiceOrigins = builtModel->getChoiceOrigins()->asJaniChoiceOrigins();
+    for (uint64_t choice = 0; choice < builtModel->getNumberOfChoices(); ++choice) {
+        auto const& edgeIndices = choiceOrigins.getEdgeIndexSet(choice);
+        if (edgeIndices.empty()) {
+            result.choiceActions.push_back(DEADLOCK_ACTION);
+        } else {
+            auto automatonAndEdgeIndex = storm::jani::Model::decodeAutomatonAndEdgeIndices(*edgeIndices.begin());
+            storm::jani::Model const& builtJaniModel = choiceOrigins.getModel();
+            uint64_t actionIndex = builtJaniModel.getAutomaton(automatonAndEdgeIndex.first).getEdge(automatonAndEdgeIndex.second).getActionIndex();
+            result.choiceActions.push_back(model.getActionIndex(builtJaniModel.getAction(actionIndex).getName()));
+        }
+    }
+    for (auto const& edge : automaton.getEdges()) {
+        if (!edge.hasSilentAction()) {
+            result.alphabet.insert(edge.getActionIndex());
+        }
+    }
+
+    // Only keep the labels that are to be preserved.
+    storm::models::sparse::StateLabeling labeling(builtModel->getNumberOfStates());
+    labeling.addLabel("init", builtModel->getInitialStates());
+    for (auto const& expression : labelExpressions) {
+        std::string labelName = getLabelName(expression);
+        labeling.addLabel(labelName, builtModel->getStateLabeling().getStates(labelName));
+    }
+    result.model = std::make_shared<storm::models::sparse::Mdp<ValueType>>(builtModel->getTransitionMatrix(), std::move(labeling));
+    return result;
+}
+
+template<typename ValueType>
+typename CompositionalJaniModelBuilder<ValueType>::Component CompositionalJaniModelBuilder<ValueType>::compose(Component const& first,
+                                                                                                               Component const& second) {
+    std::set<uint64_t> synchronizingActions;
+    std::set_intersection(first.alphabet.begin(), first.alphabet.end(), second.alphabet.begin(), second.alphabet.end(),
+                          std::inserter(synchronizingActions, synchronizingActions.end()));
+
+    storm::storage::SparseMatrix<ValueType> const& firstMatrix = first.model->getTransitionMatrix();
+    storm::storage::SparseMatrix<ValueType> const& secondMatrix = second.model->getTransitionMatrix();
+    uint64_t const numberOfSecondStates = second.model->getNumberOfStates();
+
+    // The reachable pairs of states are numbered in the order of their discovery.
+    std::unordered_map<uint64_t, uint64_t> pairToState;
+    std::vector<std::pair<uint64_t, uint64_t>> stateToPair;
+    auto getOrAddState = [&](uint64_t firstState, uint64_t secondState) {
+        auto insertionResult = pairToState.emplace(firstState * numberOfSecondStates + secondState, stateToPair.size());
+        if (insertionResult.second) {
+            stateToPair.emplace_back(firstState, secondState);
+        }
+        return insertionResult.first->second;
+    };
+    for (auto firstState : first.model->getInitialStates()) {
+        for (auto secondState : second.model->getInitialStates()) {
+            getOrAddState(firstState, secondState);
+        }
+    }
+    uint64_t const numberOfInitialStates = stateToPair.size();
+
+    Component result;
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
+    std::map<uint64_t, ValueType> distribution;
+    uint64_t currentRow = 0;
+    auto addProbability = [&distribution](uint64_t state, ValueType const& probability) {
+        distribution.emplace(state, storm::utility::zero<ValueType>()).first->second += probability;
+    };
+    auto addChoice = [&](uint64_t action) {
+        for (auto const& entry : distribution) {
+            builder.addNextValue(currentRow, entry.first, entry.second);
+        }
+        distribution.clear();
+        result.choiceActions.push_back(action);
+        ++currentRow;
+    };
+
+    for (uint64_t state = 0; state < stateToPair.size(); ++state) {
+        uint64_t const firstState = stateToPair[state].first;
+        uint64_t const secondState = stateToPair[state].second;
+        builder.newRowGroup(currentRow);
+        uint64_t const firstRowOfState = currentRow;
+
+        // The choices of actions that are not synchronized are interleaved.
+        for (auto firstChoice : firstMatrix.getRowGroupIndices(firstState)) {
+            uint64_t action = first.choiceActions[firstChoice];
+            if (action != DEADLOCK_ACTION && synchronizingActions.count(action) == 0) {
+                for (auto const& entry : firstMatrix.getRow(firstChoice)) {
+                    addProbability(getOrAddState(entry.getColumn(), secondState), entry.getValue());
+                }
+                addChoice(action);
+            }
+        }
+        for (auto secondChoice : secondMatrix.getRowGroupIndices(secondState)) {
+            uint64_t action = second.choiceActions[secondChoice];
+            if (action != DEADLOCK_ACTION && synchronizingActions.count(action) == 0) {
+                for (auto const& entry : secondMatrix.getRow(secondChoice)) {
+                    addProbability(getOrAddState(firstState, entry.getColumn()), entry.getValue());
+                }
+                addChoice(action);
+            }
+        }
+
+        // The choices of synchronizing actions are combined.
+        for (auto firstChoice : firstMatrix.getRowGroupIndices(firstState)) {
+            uint64_t action = first.choiceActions[firstChoice];
+            if (synchronizingActions.count(action) == 0) {
+                continue;
+            }
+            for (auto secondChoice : secondMatrix.getRowGroupIndices(secondState)) {
+                if (second.choiceActions[secondChoice] != action) {
+                    continue;
+                }
+                for (auto const& firstEntry : firstMatrix.getRow(firstChoice)) {
+                    for (auto const& secondEntry : secondMatrix.getRow(secondChoice)) {
+                        addProbability(getOrAddState(firstEntry.getColumn(), secondEntry.getColumn()), firstEntry.getValue() * secondEntry.getValue());
+                    }
+                }
+                addChoice(action);
+            }
+        }
+
+        // States without any choice are deadlocks of the composition.
+        if (currentRow == firstRowOfState) {
+            addProbability(state, storm::utility::one<ValueType>());
+            addChoice(DEADLOCK_ACTION);
+        }
+    }
+    uint64_t const numberOfStates = stateToPair.size();
+    peakNumberOfStates = std::max(peakNumberOfStates, numberOfStates);
+
+    // The labels of the components are lifted to the composition.
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    storm::storage::BitVector initialStates(numberOfStates);
+    for (uint64_t state = 0; state < numberOfInitialStates; ++state) {
+        initialStates.set(state);
+    }
+    labeling.addLabel("init", std::move(initialStates));
+    for (auto const& component : {std::cref(first), std::cref(second)}) {
+        bool isFirst = &component.get() == &first;
+        auto const& componentLabeling = component.get().model->getStateLabeling();
+        for (auto const& label : componentLabeling.getLabels()) {
+            if (label == "init") {
+                continue;
+            }
+            storm::storage::BitVector const& componentStates = componentLabeling.getStates(label);
+            storm::storage::BitVector labelStates(numberOfStates);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                labelStates.set(state, componentStates.get(isFirst ? stateToPair[state].first : stateToPair[state].second));
+            }
+            if (labeling.containsLabel(label)) {
+                labelStates |= labeling.getStates(label);
+                labeling.setStates(label, std::move(labelStates));
+            } else {
+                labeling.addLabel(label, std::move(labelStates));
+            }
+        }
+    }
+
+    result.model = std::make_shared<storm::models::sparse::Mdp<ValueType>>(builder.build(currentRow, numberOfStates, numberOfStates), std::move(labeling));
+    std::set_union(first.alphabet.begin(), first.alphabet.end(), second.alphabet.begin(), second.alphabet.end(),
+                   std::inserter(result.alphabet, result.alphabet.end()));
+    return result;
+}
+
+template<typename ValueType>
+void CompositionalJaniModelBuilder<ValueType>::hide(Component& component, std::set<uint64_t> const& alphabet) const {
+    for (auto& action : component.choiceActions) {
+        if (action != DEADLOCK_ACTION && alphabet.count(action) == 0) {
+            action = storm::jani::Model::SILENT_ACTION_INDEX;
+        }
+    }
+    std::set<uint64_t> visibleAlphabet;
+    std::set_intersection(component.alphabet.begin(), component.alphabet.end(), alphabet.begin(), alphabet.end(),
+                          std::inserter(visibleAlphabet, visibleAlphabet.end()));
+    component.alphabet = std::move(visibleAlphabet);
+}
+
+template<typename ValueType>
+void CompositionalJaniModelBuilder<ValueType>::minimize(Component& component) const {
+    // The actions are encoded as state-action rewards (of their index among the occurring actions), such that the
+    // bisimulation respects them.
+    std::vector<uint64_t> actions = component.choiceActions;
+    std::sort(actions.begin(), actions.end());
+    actions.erase(std::unique(actions.begin(), actions.end()), actions.end());
+    std::vector<ValueType> actionRewards;
+    actionRewards.reserve(component.choiceActions.size());
+    for (auto action : component.choiceActions) {
+        uint_fast64_t actionCode = std::distance(actions.begin(), std::lower_bound(actions.begin(), actions.end(), action));
+        actionRewards.push_back(storm::utility::convertNumber<ValueType>(actionCode));
+    }
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    rewardModels.emplace("actions", storm::models::sparse::StandardRewardModel<ValueType>(boost::none, std::move(actionRewards)));
+    storm::models::sparse::Mdp<ValueType> modelWithActions(component.model->getTransitionMatrix(), component.model->getStateLabeling(),
+                                                           std::move(rewardModels));
+
+    typedef storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<ValueType>> Decomposition;
+    typename Decomposition::Options options;
+    options.setKeepRewards(true);
+    options.signatureRefinement = true;
+    Decomposition decomposition(modelWithActions, options);
+    decomposition.computeBisimulationDecomposition();
+    auto quotient = decomposition.getQuotient()->template as<storm::models::sparse::Mdp<ValueType>>();
+
+    component.choiceActions.clear();
+    for (auto const& actionReward : quotient->getUniqueRewardModel().getStateActionRewardVector()) {
+        component.choiceActions.push_back(actions[storm::utility::convertNumber<uint_fast64_t>(actionReward)]);
+    }
+    component.model = std::make_shared<storm::models::sparse::Mdp<ValueType>>(quotient->getTransitionMatrix(), quotient->getStateLabeling());
+}
+
+template class CompositionalJaniModelBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class CompositionalJaniModelBuilder<storm::RationalNumber>;
+#endif
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/jani/Model.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the MDP of a JANI model compositionally: Every automaton of the (standard) parallel composition is built
+ * separately and minimized w.r.t. strong bisimulation respecting the actions it synchronizes on. The minimized
+ * components are then composed pairwise, each composition again being minimized. Actions that do not synchronize with
+ * any of the remaining components are hidden, which allows the minimization to merge them. The resulting model is
+ * bisimilar to the one obtained by building the flattened model, but the intermediate models are typically much
+ * smaller than the flat product.
+ *
+ * The atomic expressions of the given formulas may only refer to the variables of a single automaton each.
+ */
+template<typename ValueType>
+class CompositionalJaniModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given model that preserves the given formulas.
+     */
+    CompositionalJaniModelBuilder(storm::jani::Model const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = {});
+
+    /*!
+     * Builds the (minimized) model.
+     */
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> build();
+
+    /*!
+     * Retrieves the maximal number of states of an intermediate (not yet minimized) model of the last build.
+     */
+    uint64_t getPeakNumberOfStates() const;
+
+   private:
+    struct Component {
+        // The model of the component. Its labels are the ones of the atomic expressions that are preserved.
+        std::shared_ptr<storm::models::sparse::Mdp<ValueType>> model;
+        // The action of every choice.
+        std::vector<uint64_t> choiceActions;
+        // The (visible) actions the component may synchronize on.
+        std::set<uint64_t> alphabet;
+    };
+
+    /*!
+     * Builds the component of the given automaton.
+     */
+    Component buildComponent(storm::jani::Automaton const& automaton, std::vector<storm::expressions::Expression> const& labelExpressions);
+
+    /*!
+     * Composes the two components, synchronizing on their common actions.
+     */
+    Component compose(Component const& first, Component const& second);
+
+    /*!
+     * Hides all actions that are not in the given alphabet, i.e. replaces them by the silent action.
+     */
+    void hide(Component& component, std::set<uint64_t> const& alphabet) const;
+
+    /*!
+     * Replaces the component by its quotient w.r.t. strong bisimulation that respects the labels and the actions.
+     */
+    void minimize(Component& component) const;
+
+    // The model that is built.
+    storm::jani::Model model;
+
+    // The atomic expressions that are to be preserved.
+    std::vector<storm::expressions::Expression> atomicExpressions;
+
+    // The maximal number of states of an intermediate model.
+    uint64_t peakNumberOfStates;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,277 @@
+#include "storm/builder/ConstantSweepModelBuilder.h"
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
+                                                                          storm::builder::BuilderOptions const& options) {
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
+    if (model.isPrismProgram()) {
+        generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options);
+    } else if (model.isJaniModel()) {
+        generator = std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, uint32_t>>(model.asJaniModel(), options);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
+    }
+    return storm::builder::ExplicitModelBuilder<ValueType>(generator).build();
+}
+
+#ifdef STORM_HAVE_CARL
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> createMatrixWithSamePositions(storm::storage::SparseMatrix<storm::RationalFunction> const& parametricMatrix) {
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(parametricMatrix.getRowCount(), parametricMatrix.getColumnCount(),
+                                                                 parametricMatrix.getEntryCount(), true, !parametricMatrix.hasTrivialRowGrouping(),
+                                                                 parametricMatrix.hasTrivialRowGrouping() ? 0 : parametricMatrix.getRowGroupCount());
+    for (uint64_t rowGroup = 0; rowGroup < parametricMatrix.getRowGroupCount(); ++rowGroup) {
+        if (!parametricMatrix.hasTrivialRowGrouping()) {
+            matrixBuilder.newRowGroup(parametricMatrix.getRowGroupIndices()[rowGroup]);
+        }
+        for (uint64_t row : parametricMatrix.getRowGroupIndices(rowGroup)) {
+            // The actual values are set when the model is instantiated, but the rows need to be valid distributions already.
+            auto parametricRow = parametricMatrix.getRow(row);
+            ValueType dummyValue = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(parametricRow.getNumberOfEntries());
+            for (auto const& entry : parametricRow) {
+                matrixBuilder.addNextValue(row, entry.getColumn(), dummyValue);
+            }
+        }
+    }
+    return matrixBuilder.build();
+}
+#endif
+}  // namespace
+
+template<typename ValueType>
+ConstantSweepModelBuilder<ValueType>::ConstantSweepModelBuilder(storm::storage::SymbolicModelDescription const& model,
+                                                                 storm::builder::BuilderOptions const& options)
+    : model(model), options(options), graphPreserving(false), numberOfBuiltModels(0), numberOfInstantiatedModels(0) {
+    for (auto const& constant : model.getUndefinedConstants()) {
+        undefinedConstants.insert(constant);
+    }
+
+#ifdef STORM_HAVE_CARL
+    numberOfTransitionMatrixMappings = 0;
+    // Only models whose matrix determines the model entirely are re-instantiated.
+    auto modelType = model.getModelType();
+    if (modelType == storm::storage::SymbolicModelDescription::ModelType::DTMC || modelType == storm::storage::SymbolicModelDescription::ModelType::CTMC ||
+        modelType == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        graphPreserving = model.isPrismProgram() ? model.asPrismProgram().undefinedConstantsAreGraphPreserving()
+                                                 : model.asJaniModel().undefinedConstantsAreGraphPreserving();
+    }
+#endif
+    STORM_LOG_INFO_COND(graphPreserving,
+                        "The undefined constants influence the structure of the model, so the model is built from scratch for each definition.");
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::build(
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    for (auto const& constant : undefinedConstants) {
+        STORM_LOG_THROW(constantDefinitions.count(constant) > 0, storm::exceptions::InvalidArgumentException,
+                        "No definition for the undefined constant '" << constant.getName() << "' given.");
+    }
+    for (auto const& definition : constantDefinitions) {
+        STORM_LOG_THROW(undefinedConstants.count(definition.first) > 0, storm::exceptions::InvalidArgumentException,
+                        "The constant '" << definition.first.getName() << "' is not an undefined constant of the model.");
+    }
+
+#ifdef STORM_HAVE_CARL
+    if (graphPreserving && !instantiatedModel) {
+        try {
+            buildParametricModel();
+        } catch (storm::exceptions::BaseException const& e) {
+            STORM_LOG_WARN("Unable to build the model with the undefined constants as parameters (" << e.what() << "), so the model is built from "
+                                                                                                                     "scratch for each definition.");
+            graphPreserving = false;
+            instantiatedModel = nullptr;
+        }
+    }
+    if (graphPreserving) {
+        if (instantiate(constantDefinitions)) {
+            ++numberOfInstantiatedModels;
+            return instantiatedModel;
+        }
+        STORM_LOG_INFO("The definition of the constants removes transitions of the model, so the model is built from scratch.");
+    }
+#endif
+    return buildFromScratch(constantDefinitions);
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::build(std::string const& constantDefinitionString) {
+    return build(model.parseConstantDefinitions(constantDefinitionString));
+}
+
+template<typename ValueType>
+bool ConstantSweepModelBuilder<ValueType>::isInstantiating() const {
+    return graphPreserving;
+}
+
+template<typename ValueType>
+uint64_t ConstantSweepModelBuilder<ValueType>::getNumberOfBuiltModels() const {
+    return numberOfBuiltModels;
+}
+
+template<typename ValueType>
+uint64_t ConstantSweepModelBuilder<ValueType>::getNumberOfInstantiatedModels() const {
+    return numberOfInstantiatedModels;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ConstantSweepModelBuilder<ValueType>::buildFromScratch(
+    std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    ++numberOfBuiltModels;
+    return buildSparseModel<ValueType>(model.preprocess(constantDefinitions), options);
+}
+
+#ifdef STORM_HAVE_CARL
+template<typename ValueType>
+void ConstantSweepModelBuilder<ValueType>::buildParametricModel() {
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> parametricModel = buildSparseModel<storm::RationalFunction>(model, options);
+
+    // The parameters are created while exploring the model, so we identify them by their names.
+    std::map<std::string, storm::RationalFunctionVariable> nameToParameter;
+    for (auto const& parameter : storm::models::sparse::getAllParameters(*parametricModel)) {
+        nameToParameter.emplace(parameter.name(), parameter);
+    }
+    for (auto const& constant : undefinedConstants) {
+        auto parameterIt = nameToParameter.find(constant.getName());
+        if (parameterIt != nameToParameter.end()) {
+            constantToParameter.emplace(constant, parameterIt->second);
+        }
+    }
+
+    // Create a model with the structure of the parametric model whose values are set upon instantiation.
+    storm::storage::sparse::ModelComponents<ValueType> components(createMatrixWithSamePositions<ValueType>(parametricModel->getTransitionMatrix()),
+                                                                  parametricModel->getStateLabeling());
+    for (auto const& rewardModel : parametricModel->getRewardModels()) {
+        boost::optional<std::vector<ValueType>> stateRewardVector;
+        if (rewardModel.second.hasStateRewards()) {
+            stateRewardVector = std::vector<ValueType>(rewardModel.second.getStateRewardVector().size());
+        }
+        boost::optional<std::vector<ValueType>> stateActionRewardVector;
+        if (rewardModel.second.hasStateActionRewards()) {
+            stateActionRewardVector = std::vector<ValueType>(rewardModel.second.getStateActionRewardVector().size());
+        }
+        boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewardMatrix;
+        if (rewardModel.second.hasTransitionRewards()) {
+            transitionRewardMatrix = createMatrixWithSamePositions<ValueType>(rewardModel.second.getTransitionRewardMatrix());
+        }
+        components.rewardModels.emplace(rewardModel.first, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector),
+                                                                                                                 std::move(stateActionRewardVector),
+                                                                                                                 std::move(transitionRewardMatrix)));
+    }
+    components.rateTransitions = parametricModel->isOfType(storm::models::ModelType::Ctmc);
+    components.choiceLabeling = parametricModel->getOptionalChoiceLabeling();
+    components.stateValuations = parametricModel->getOptionalStateValuations();
+    components.choiceOrigins = parametricModel->getOptionalChoiceOrigins();
+    instantiatedModel = storm::utility::builder::buildModelFromComponents(parametricModel->getType(), std::move(components));
+
+    // Connect the values of the model to the functions. This is done only now as the matrices are moved into the model.
+    connectMatrix(instantiatedModel->getTransitionMatrix(), parametricModel->getTransitionMatrix());
+    numberOfTransitionMatrixMappings = matrixMapping.size();
+    for (auto& rewardModel : instantiatedModel->getRewardModels()) {
+        auto const& parametricRewardModel = parametricModel->getRewardModel(rewardModel.first);
+        if (rewardModel.second.hasStateRewards()) {
+            connectVector(rewardModel.second.getStateRewardVector(), parametricRewardModel.getStateRewardVector());
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            connectVector(rewardModel.second.getStateActionRewardVector(), parametricRewardModel.getStateActionRewardVector());
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            connectMatrix(rewardModel.second.getTransitionRewardMatrix(), parametricRewardModel.getTransitionRewardMatrix());
+        }
+    }
+    ++numberOfBuiltModels;
+    STORM_LOG_INFO("Built the model with " << constantToParameter.size() << " parameters and " << functions.size()
+                                           << " distinct functions for re-instantiation.");
+}
+
+template<typename ValueType>
+bool ConstantSweepModelBuilder<ValueType>::instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions) {
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    for (auto const& constantParameterPair : constantToParameter) {
+        storm::RationalNumber value = constantDefinitions.at(constantParameterPair.first).evaluateAsRational();
+        valuation.emplace(constantParameterPair.second, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+    }
+    for (auto& functionValuePair : functions) {
+        functionValuePair.second = storm::utility::convertNumber<ValueType>(functionValuePair.first.evaluate(valuation));
+    }
+
+    // A transition whose probability (or rate) vanishes would change the structure of the model.
+    for (uint64_t index = 0; index < numberOfTransitionMatrixMappings; ++index) {
+        if (storm::utility::isZero(*matrixMapping[index].second)) {
+            return false;
+        }
+    }
+
+    for (auto& entryValuePair : matrixMapping) {
+        entryValuePair.first->setValue(*entryValuePair.second);
+    }
+    for (auto& entryValuePair : vectorMapping) {
+        *entryValuePair.first = *entryValuePair.second;
+    }
+    if (instantiatedModel->isOfType(storm::models::ModelType::Ctmc)) {
+        auto ctmc = instantiatedModel->template as<storm::models::sparse::Ctmc<ValueType>>();
+        ctmc->getExitRateVector() = ctmc->getTransitionMatrix().getRowSumVector();
+    }
+    return true;
+}
+
+template<typename ValueType>
+void ConstantSweepModelBuilder<ValueType>::connectMatrix(storm::storage::SparseMatrix<ValueType>& matrix,
+                                                         storm::storage::SparseMatrix<storm::RationalFunction> const& parametricMatrix) {
+    auto entryIt = matrix.begin();
+    for (auto const& parametricEntry : parametricMatrix) {
+        STORM_LOG_ASSERT(entryIt->getColumn() == parametricEntry.getColumn(),
+                         "Entries of the parametric and the instantiated matrix are at different positions.");
+        if (storm::utility::isConstant(parametricEntry.getValue())) {
+            entryIt->setValue(storm::utility::convertNumber<ValueType>(parametricEntry.getValue()));
+        } else {
+            // References to the values of an unordered map remain valid upon insertion.
+            auto functionIt = functions.emplace(parametricEntry.getValue(), storm::utility::one<ValueType>()).first;
+            matrixMapping.emplace_back(entryIt, &functionIt->second);
+        }
+        ++entryIt;
+    }
+    STORM_LOG_ASSERT(entryIt == matrix.end(), "The parametric and the instantiated matrix have different numbers of entries.");
+    matrix.updateNonzeroEntryCount();
+}
+
+template<typename ValueType>
+void ConstantSweepModelBuilder<ValueType>::connectVector(std::vector<ValueType>& vector, std::vector<storm::RationalFunction> const& parametricVector) {
+    STORM_LOG_ASSERT(vector.size() == parametricVector.size(), "The parametric and the instantiated vector have different sizes.");
+    auto entryIt = vector.begin();
+    for (auto const& parametricEntry : parametricVector) {
+        if (storm::utility::isConstant(parametricEntry)) {
+            *entryIt = storm::utility::convertNumber<ValueType>(parametricEntry);
+        } else {
+            auto functionIt = functions.emplace(parametricEntry, storm::utility::one<ValueType>()).first;
+            vectorMapping.emplace_back(entryIt, &functionIt->second);
+        }
+        ++entryIt;
+    }
+}
+#endif
+
+template class ConstantSweepModelBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ConstantSweepModelBuilder<storm::RationalNumber>;
+#endif
+}  // namespace builder
+}  // namespace storm
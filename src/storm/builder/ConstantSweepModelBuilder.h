@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds sparse models of a symbolic model description for many definitions of its undefined constants, e.g. during a
+ * parameter sweep. The model description is kept (and thus needs to be parsed and preprocessed only once) and the
+ * constants are substituted for each definition.
+ *
+ * If the undefined constants only appear in update probabilities and reward values (i.e., they do not influence the
+ * structure of the model), the model is explored only once with the constants as parameters. For each definition of
+ * the constants, the resulting functions are evaluated (each distinct function only once) and the values are written to
+ * the matrix and the reward vectors of the previously built model, similar to storm::utility::ModelInstantiator.
+ * Otherwise (or if a definition makes a transition vanish), the model is built from scratch.
+ */
+template<typename ValueType>
+class ConstantSweepModelBuilder {
+   public:
+    /*!
+     * Creates a builder for the given model description.
+     *
+     * @param model The model description. Its undefined constants are the ones that are defined for each model.
+     * @param options The options used to build each model.
+     */
+    ConstantSweepModelBuilder(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options);
+
+    /*!
+     * Builds the model for the given definition of the undefined constants.
+     *
+     * @note If the model is re-instantiated, the same model object is returned for each definition, i.e., models that
+     * were previously returned by this method are changed.
+     *
+     * @param constantDefinitions The definitions of all undefined constants.
+     * @return The model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+    /*!
+     * Builds the model for the given definition of the undefined constants.
+     *
+     * @param constantDefinitionString The definitions of all undefined constants, e.g. a=1,b=2.
+     * @return The model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(std::string const& constantDefinitionString);
+
+    /*!
+     * Retrieves whether the models are obtained by re-instantiating a model that was built once.
+     */
+    bool isInstantiating() const;
+
+    /*!
+     * Retrieves the number of models that were built from scratch so far.
+     */
+    uint64_t getNumberOfBuiltModels() const;
+
+    /*!
+     * Retrieves the number of models that were obtained by re-instantiating the previously built model so far.
+     */
+    uint64_t getNumberOfInstantiatedModels() const;
+
+   private:
+    // Builds the model for the given definitions from scratch.
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> buildFromScratch(
+        std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+#ifdef STORM_HAVE_CARL
+    // Builds the model in which the undefined constants are parameters and prepares its instantiation.
+    void buildParametricModel();
+
+    // Instantiates the model for the given definitions. Returns false if some function evaluates to zero, i.e., if the
+    // structure of the instantiated model differs from the structure of the parametric model.
+    bool instantiate(std::map<storm::expressions::Variable, storm::expressions::Expression> const& constantDefinitions);
+
+    // Connects the entries of the given matrix to the functions at the same positions of the parametric matrix.
+    void connectMatrix(storm::storage::SparseMatrix<ValueType>& matrix, storm::storage::SparseMatrix<storm::RationalFunction> const& parametricMatrix);
+
+    // Connects the entries of the given vector to the functions of the parametric vector.
+    void connectVector(std::vector<ValueType>& vector, std::vector<storm::RationalFunction> const& parametricVector);
+#endif
+
+    // The model description in which the undefined constants are not yet substituted.
+    storm::storage::SymbolicModelDescription model;
+    storm::builder::BuilderOptions options;
+
+    // The undefined constants of the model description.
+    std::set<storm::expressions::Variable> undefinedConstants;
+
+    // Whether the undefined constants only influence the probabilities and rewards of the model.
+    bool graphPreserving;
+
+    // The model that is re-instantiated for each definition of the constants (if any).
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> instantiatedModel;
+
+#ifdef STORM_HAVE_CARL
+    // The parameters of the parametric model, indexed by the constants of the model description.
+    std::map<storm::expressions::Variable, storm::RationalFunctionVariable> constantToParameter;
+
+    // The occurring functions together with the placeholders for their values.
+    std::unordered_map<storm::RationalFunction, ValueType> functions;
+
+    // The connection of the matrix and vector entries of the instantiated model to the placeholders.
+    std::vector<std::pair<typename storm::storage::SparseMatrix<ValueType>::iterator, ValueType*>> matrixMapping;
+    std::vector<std::pair<typename std::vector<ValueType>::iterator, ValueType*>> vectorMapping;
+
+    // The number of leading entries of the matrix mapping that belong to the transition matrix.
+    uint64_t numberOfTransitionMatrixMappings;
+#endif
+
+    uint64_t numberOfBuiltModels;
+    uint64_t numberOfInstantiatedModels;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -19,6 +19,7 @@
 #include "storm/storage/jani/visitor/CompositionInformationVisitor.h"
 
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/builder/DdVariableOrdering.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
@@ -375,38 +376,49 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
         }
 
+        // Collect the location variables and the non-transient variables in the order of their declaration.
+        std::vector<storm::expressions::Variable> variableOrder;
+        std::map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomaton;
+        std::map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariable;
         for (auto const& automatonName : this->automata) {
             storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+            variableOrder.push_back(automaton.getLocationExpressionVariable());
+            locationVariableToAutomaton.emplace(automaton.getLocationExpressionVariable(), &automaton);
+        }
+        for (auto const& variable : this->model.getGlobalVariables()) {
+            if (!variable.isTransient()) {
+                variableOrder.push_back(variable.getExpressionVariable());
+                expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+            }
+        }
+        for (auto const& automaton : this->model.getAutomata()) {
+            for (auto const& variable : automaton.getVariables()) {
+                if (!variable.isTransient()) {
+                    variableOrder.push_back(variable.getExpressionVariable());
+                    expressionVariableToVariable.emplace(variable.getExpressionVariable(), &variable);
+                }
+            }
+        }
+        if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdForceOrderSet()) {
+            variableOrder = storm::builder::computeForceOrder(variableOrder, storm::builder::getInteractingVariables(this->model));
+        }
 
-            // Start by creating a meta variable for the location of the automaton.
-            storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-            result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-            result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-            result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-            result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-
-            // Add the location variable to the row/column variables.
-            result.rowMetaVariables.insert(variablePair.first);
-            result.columnMetaVariables.insert(variablePair.second);
-
-            // Add the legal range for the location variables.
-            result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-            result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+        // Create the meta variables in the determined order.
+        for (auto const& variable : variableOrder) {
+            auto locationVariableIt = locationVariableToAutomaton.find(variable);
+            if (locationVariableIt != locationVariableToAutomaton.end()) {
+                createLocationVariable(*locationVariableIt->second, result);
+            } else {
+                createVariable(*expressionVariableToVariable.at(variable), result);
+            }
         }
 
-        // Create global variables.
+        // Compose the ranges of the global variables.
         storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
         for (auto const& variable : this->model.getGlobalVariables()) {
-            // Only create the variable if it's non-transient.
-            if (variable.isTransient()) {
-                continue;
+            if (!variable.isTransient()) {
+                globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
-
-            createVariable(variable, result);
-            globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
         }
         result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
 
@@ -422,14 +434,13 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
             identity &= variableIdentity;
             range &= result.manager->getRange(locationVariables.first);
 
-            // Then create variables for the variables of the automaton.
+            // Then add the identities and ranges of the variables of the automaton.
             for (auto const& variable : automaton.getVariables()) {
-                // Only create the variable if it's non-transient.
+                // Only non-transient variables have meta variables.
                 if (variable.isTransient()) {
                     continue;
                 }
 
-                createVariable(variable, result);
                 identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                 range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
             }
@@ -447,6 +458,25 @@ class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         return result;
     }
 
+    void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+        storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
+            result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+        result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+        result.rowColumnMetaVariablePairs.push_back(variablePair);
+
+        result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+        result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+
+        // Add the location variable to the row/column variables.
+        result.rowMetaVariables.insert(variablePair.first);
+        result.columnMetaVariables.insert(variablePair.second);
+
+        // Add the legal range for the location variables.
+        result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+        result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+    }
+
     void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
         auto const& type = variable.getType();
         if (type.isBasicType() && type.asBasicType().isBooleanType()) {
@@ -1625,14 +1655,19 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
     }
 
     ActionDd buildActionDdForActionInstantiation(storm::jani::Automaton const& automaton, ActionInstantiation const& instantiation) {
-        // Translate the individual edges.
-        std::vector<EdgeDd> edgeDds;
+        // Translate the individual edges. As the edges are translated independently, this may happen concurrently.
+        std::vector<storm::jani::Edge const*> edges;
         for (auto const& edge : automaton.getEdges()) {
             if (edge.getActionIndex() == instantiation.actionIndex && edge.hasRate() == instantiation.isMarkovian()) {
-                EdgeDd result = buildEdgeDd(automaton, edge);
-                edgeDds.emplace_back(result);
+                edges.push_back(&edge);
             }
         }
+        std::vector<boost::optional<EdgeDd>> translatedEdges(edges.size());
+        this->variables.manager->executeTasks(edges.size(), [&](uint64_t index) { translatedEdges[index] = buildEdgeDd(automaton, *edges[index]); });
+        std::vector<EdgeDd> edgeDds;
+        for (auto& edgeDd : translatedEdges) {
+            edgeDds.emplace_back(std::move(edgeDd.get()));
+        }
 
         // Now combine the edges to a single action.
         uint64_t localNondeterminismVariableOffset = instantiation.localNondeterminismVariableOffset;
@@ -1926,33 +1961,44 @@ class CombinedEdgesSystemComposer : public SystemComposer<Type, ValueType> {
         // Disjunction of all guards of non-markovian actions (only required for maximum progress assumption).
         storm::dd::Bdd<Type> nonMarkovianActionGuards = this->variables.manager->getBddZero();
 
+        // Gather the instantiations of the actions for which the automaton has edges. As they are built
+        // independently of each other, this may happen concurrently.
         storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+        std::vector<std::pair<uint64_t, ActionInstantiation const*>> instantiations;
         for (auto const& actionInstantiation : actionInstantiations) {
             uint64_t actionIndex = actionInstantiation.first;
             if (!automaton.hasEdgeLabeledWithActionIndex(actionIndex)) {
                 continue;
             }
-            bool inputEnabled = false;
+            for (auto const& instantiation : actionInstantiation.second) {
+                instantiations.emplace_back(actionIndex, &instantiation);
+            }
+        }
+        std::vector<ActionDd> actionDds(instantiations.size());
+        this->variables.manager->executeTasks(instantiations.size(), [&](uint64_t index) {
+            uint64_t actionIndex = instantiations[index].first;
+            ActionInstantiation const& instantiation = *instantiations[index].second;
+            STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "")
+                                        << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action "
+                                        << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ")
+                                        << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
+            actionDds[index] = buildActionDdForActionInstantiation(automaton, instantiation);
+        });
+
+        for (uint64_t index = 0; index < instantiations.size(); ++index) {
+            uint64_t actionIndex = instantiations[index].first;
+            ActionInstantiation const& instantiation = *instantiations[index].second;
+            ActionDd& actionDd = actionDds[index];
             if (inputEnabledActionIndices.find(actionIndex) != inputEnabledActionIndices.end()) {
-                inputEnabled = true;
+                actionDd.setIsInputEnabled();
             }
-            for (auto const& instantiation : actionInstantiation.second) {
-                STORM_LOG_TRACE("Building " << (instantiation.isMarkovian() ? "(Markovian) " : "")
-                                            << (actionInformation.getActionName(actionIndex).empty() ? "silent " : "") << "action "
-                                            << (actionInformation.getActionName(actionIndex).empty() ? "" : actionInformation.getActionName(actionIndex) + " ")
-                                            << "from offset " << instantiation.localNondeterminismVariableOffset << ".");
-                ActionDd actionDd = buildActionDdForActionInstantiation(automaton, instantiation);
-                if (inputEnabled) {
-                    actionDd.setIsInputEnabled();
-                }
-                if (applyMaximumProgress && isTopLevelAutomaton && !instantiation.isMarkovian()) {
-                    nonMarkovianActionGuards |= actionDd.guard;
-                }
-                STORM_LOG_TRACE("Used local nondeterminism variables are " << actionDd.getLowestLocalNondeterminismVariable() << " to "
-                                                                           << actionDd.getHighestLocalNondeterminismVariable() << ".");
-                result.actions[ActionIdentification(actionIndex, instantiation.synchronizationVectorIndex, instantiation.isMarkovian())] = actionDd;
-                result.extendLocalNondeterminismVariables(actionDd.getLocalNondeterminismVariables());
+            if (applyMaximumProgress && isTopLevelAutomaton && !instantiation.isMarkovian()) {
+                nonMarkovianActionGuards |= actionDd.guard;
             }
+            STORM_LOG_TRACE("Used local nondeterminism variables are " << actionDd.getLowestLocalNondeterminismVariable() << " to "
+                                                                       << actionDd.getHighestLocalNondeterminismVariable() << ".");
+            result.actions[ActionIdentification(actionIndex, instantiation.synchronizationVectorIndex, instantiation.isMarkovian())] = actionDd;
+            result.extendLocalNondeterminismVariables(actionDd.getLocalNondeterminismVariables());
         }
 
         if (applyMaximumProgress && isTopLevelAutomaton) {
@@ -2444,6 +2490,8 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuil
     modelComponents.rewardModels =
         buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, preparedModel.getModelType(), variables, system, rewardVariables);
 
+    variables.manager->recordStatistics("build");
+
     // Finally, create the model.
     return createModel(preparedModel.getModelType(), variables, modelComponents);
 }
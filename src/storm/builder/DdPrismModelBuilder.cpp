@@ -17,6 +17,8 @@
 #include "storm/utility/math.h"
 #include "storm/utility/prism.h"
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -188,93 +190,63 @@ class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
             allNondeterminismVariables.insert(variablePair.first);
         }
 
-        // Create meta variables for global program variables.
+        // Collect the program variables in the order of their declaration.
+        std::vector<storm::expressions::Variable> variableOrder;
+        std::map<storm::expressions::Variable, storm::prism::IntegerVariable const*> integerVariables;
         for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-            int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-            int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-
-            STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
-
-            rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-            columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-            storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-            rowColumnMetaVariablePairs.push_back(variablePair);
-
+            variableOrder.push_back(integerVariable.getExpressionVariable());
+            integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
             allGlobalVariables.insert(integerVariable.getExpressionVariable());
         }
         for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+            variableOrder.push_back(booleanVariable.getExpressionVariable());
+            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+        }
+        for (storm::prism::Module const& module : program.getModules()) {
+            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                variableOrder.push_back(integerVariable.getExpressionVariable());
+                integerVariables.emplace(integerVariable.getExpressionVariable(), &integerVariable);
+            }
+            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                variableOrder.push_back(booleanVariable.getExpressionVariable());
+            }
+        }
+        if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdForceOrderSet()) {
+            variableOrder = storm::builder::computeForceOrder(variableOrder, storm::builder::getInteractingVariables(program));
+        }
 
-            STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                   << "] and " << variablePair.second.getName() << "["
-                                                                                   << variablePair.second.getIndex() << "]");
+        // Create the meta variables in the determined order.
+        for (auto const& variable : variableOrder) {
+            std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+            auto integerVariableIt = integerVariables.find(variable);
+            if (integerVariableIt != integerVariables.end()) {
+                int_fast64_t low = integerVariableIt->second->getLowerBoundExpression().evaluateAsInt();
+                int_fast64_t high = integerVariableIt->second->getUpperBoundExpression().evaluateAsInt();
+                variablePair = manager->addMetaVariable(variable.getName(), low, high);
+            } else {
+                variablePair = manager->addMetaVariable(variable.getName());
+            }
+            STORM_LOG_TRACE("Created meta variables for variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and "
+                                                                    << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
 
             rowMetaVariables.insert(variablePair.first);
-            variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+            variableToRowMetaVariableMap->emplace(variable, variablePair.first);
 
             columnMetaVariables.insert(variablePair.second);
-            variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+            variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
 
             storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-            variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-
+            variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
             rowColumnMetaVariablePairs.push_back(variablePair);
-            allGlobalVariables.insert(booleanVariable.getExpressionVariable());
         }
 
-        // Create meta variables for each of the modules' variables.
+        // Compose the identities and ranges of the modules.
         for (storm::prism::Module const& module : program.getModules()) {
             storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
             storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
-
-            for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair =
-                    manager->addMetaVariable(integerVariable.getName(), low, high);
-                STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
-            }
-            for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex()
-                                                                                << "] and " << variablePair.second.getName() << "["
-                                                                                << variablePair.second.getIndex() << "]");
-
-                rowMetaVariables.insert(variablePair.first);
-                variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-
-                columnMetaVariables.insert(variablePair.second);
-                variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-
-                storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                moduleIdentity &= variableIdentity;
-                moduleRange &= manager->getRange(variablePair.first);
-
-                rowColumnMetaVariablePairs.push_back(variablePair);
+            for (auto const& variable : module.getAllExpressionVariables()) {
+                moduleIdentity &= variableToIdentityMap.at(variable).toBdd();
+                moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(variable));
             }
             moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
             moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
@@ -732,7 +704,7 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
     GenerationInformation& generationInfo, storm::prism::Module const& module, storm::prism::Command const& command) {
     STORM_LOG_TRACE("Translating guard " << command.getGuardExpression());
     storm::dd::Bdd<Type> guard = generationInfo.rowExpressionAdapter->translateBooleanExpression(command.getGuardExpression()) &&
-                                 generationInfo.moduleToRangeMap[module.getName()].notZero();
+                                 generationInfo.moduleToRangeMap.at(module.getName()).notZero();
     STORM_LOG_WARN_COND(!guard.isZero(), "The guard '" << command.getGuardExpression() << "' is unsatisfiable.");
 
     if (!guard.isZero()) {
@@ -788,22 +760,24 @@ template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createActionDecisionDiagram(
     GenerationInformation& generationInfo, storm::prism::Module const& module, uint_fast64_t synchronizationActionIndex,
     uint_fast64_t nondeterminismVariableOffset) {
-    std::vector<ActionDecisionDiagram> commandDds;
+    std::vector<storm::prism::Command const*> commands;
     for (storm::prism::Command const& command : module.getCommands()) {
         // Determine whether the command is relevant for the selected action.
         bool relevant = (synchronizationActionIndex == 0 && !command.isLabeled()) ||
                         (synchronizationActionIndex && command.isLabeled() && command.getActionIndex() == synchronizationActionIndex);
 
-        if (!relevant) {
-            continue;
+        if (relevant) {
+            commands.push_back(&command);
         }
-
-        STORM_LOG_TRACE("Translating command " << command);
-
-        // At this point, the command is known to be relevant for the action.
-        commandDds.push_back(createCommandDecisionDiagram(generationInfo, module, command));
     }
 
+    // The relevant commands are translated independently of each other, so this may happen concurrently.
+    std::vector<ActionDecisionDiagram> commandDds(commands.size());
+    generationInfo.manager->executeTasks(commands.size(), [&](uint64_t index) {
+        STORM_LOG_TRACE("Translating command " << *commands[index]);
+        commandDds[index] = createCommandDecisionDiagram(generationInfo, module, *commands[index]);
+    });
+
     ActionDecisionDiagram result(*generationInfo.manager);
     if (!commandDds.empty()) {
         switch (generationInfo.program.getModelType()) {
@@ -1092,17 +1066,27 @@ typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismMode
 template<storm::dd::DdType Type, typename ValueType>
 typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(
     GenerationInformation& generationInfo, storm::prism::Module const& module, std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap) {
-    // Start by creating the action DD for the independent action.
-    ActionDecisionDiagram independentActionDd = createActionDecisionDiagram(generationInfo, module, 0, 0);
-    uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
+    // Create the action DDs for the independent action (index zero) and all synchronizing actions of the module.
+    // As the offsets of the nondeterminism variables are already known, the actions may be built concurrently.
+    std::vector<uint_fast64_t> actionIndices = {0};
+    actionIndices.insert(actionIndices.end(), module.getSynchronizingActionIndices().begin(), module.getSynchronizingActionIndices().end());
+    std::vector<ActionDecisionDiagram> actionDds(actionIndices.size());
+    generationInfo.manager->executeTasks(actionIndices.size(), [&](uint64_t index) {
+        uint_fast64_t actionIndex = actionIndices[index];
+        if (actionIndex == 0) {
+            actionDds[index] = createActionDecisionDiagram(generationInfo, module, 0, 0);
+        } else {
+            STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
+            actionDds[index] = createActionDecisionDiagram(generationInfo, module, actionIndex, synchronizingActionToOffsetMap.at(actionIndex));
+        }
+    });
 
-    // Create module DD for all synchronizing actions of the module.
+    ActionDecisionDiagram independentActionDd = actionDds.front();
+    uint_fast64_t numberOfUsedNondeterminismVariables = independentActionDd.numberOfUsedNondeterminismVariables;
     std::map<uint_fast64_t, ActionDecisionDiagram> actionIndexToDdMap;
-    for (auto const& actionIndex : module.getSynchronizingActionIndices()) {
-        STORM_LOG_TRACE("Creating DD for action '" << actionIndex << "'.");
-        ActionDecisionDiagram tmp = createActionDecisionDiagram(generationInfo, module, actionIndex, synchronizingActionToOffsetMap.at(actionIndex));
-        numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, tmp.numberOfUsedNondeterminismVariables);
-        actionIndexToDdMap.emplace(actionIndex, tmp);
+    for (uint64_t index = 1; index < actionIndices.size(); ++index) {
+        numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, actionDds[index].numberOfUsedNondeterminismVariables);
+        actionIndexToDdMap.emplace(actionIndices[index], actionDds[index]);
     }
 
     return ModuleDecisionDiagram(independentActionDd, actionIndexToDdMap, generationInfo.moduleToIdentityMap.at(module.getName()),
@@ -1587,6 +1571,7 @@ std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBui
         result->addParameters(generationInfo.parameters);
     }
 
+    generationInfo.manager->recordStatistics("build");
     return result;
 }
 
@@ -0,0 +1,164 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "storm/storage/jani/Automaton.h"
+#include "storm/storage/jani/Edge.h"
+#include "storm/storage/jani/EdgeDestination.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+// FORCE typically converges after a few iterations. The bound only guards against oscillation.
+static const uint64_t maximalNumberOfForceIterations = 100;
+
+std::vector<storm::expressions::Variable> computeForceOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                            std::vector<std::set<storm::expressions::Variable>> const& hyperedges) {
+    std::map<storm::expressions::Variable, uint64_t> variableToIndex;
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        variableToIndex.emplace(variables[index], index);
+    }
+
+    // Translate the hyperedges to variable indices. Edges with less than two variables do not influence the order.
+    std::vector<std::vector<uint64_t>> edges;
+    std::vector<std::vector<uint64_t>> edgesOfVariable(variables.size());
+    for (auto const& hyperedge : hyperedges) {
+        std::vector<uint64_t> edge;
+        for (auto const& variable : hyperedge) {
+            auto indexIt = variableToIndex.find(variable);
+            if (indexIt != variableToIndex.end()) {
+                edge.push_back(indexIt->second);
+            }
+        }
+        if (edge.size() > 1) {
+            for (auto const& index : edge) {
+                edgesOfVariable[index].push_back(edges.size());
+            }
+            edges.push_back(std::move(edge));
+        }
+    }
+
+    // position[i] is the position of the i-th variable in the current order.
+    std::vector<uint64_t> position(variables.size());
+    std::iota(position.begin(), position.end(), 0);
+    auto computeSpan = [&edges](std::vector<uint64_t> const& position) {
+        uint64_t span = 0;
+        for (auto const& edge : edges) {
+            auto minMax = std::minmax_element(edge.begin(), edge.end(), [&position](uint64_t a, uint64_t b) { return position[a] < position[b]; });
+            span += position[*minMax.second] - position[*minMax.first];
+        }
+        return span;
+    };
+
+    std::vector<uint64_t> bestPosition = position;
+    uint64_t bestSpan = computeSpan(position);
+    std::vector<double> centers(edges.size());
+    std::vector<double> targets(variables.size());
+    std::vector<uint64_t> order(variables.size());
+    for (uint64_t iteration = 0; iteration < maximalNumberOfForceIterations && bestSpan > 0; ++iteration) {
+        for (uint64_t edge = 0; edge < edges.size(); ++edge) {
+            uint64_t sum = 0;
+            for (auto const& index : edges[edge]) {
+                sum += position[index];
+            }
+            centers[edge] = static_cast<double>(sum) / edges[edge].size();
+        }
+        for (uint64_t index = 0; index < variables.size(); ++index) {
+            if (edgesOfVariable[index].empty()) {
+                targets[index] = position[index];
+            } else {
+                double sum = 0;
+                for (auto const& edge : edgesOfVariable[index]) {
+                    sum += centers[edge];
+                }
+                targets[index] = sum / edgesOfVariable[index].size();
+            }
+        }
+
+        // Sort the variables by their target, breaking ties by the current position.
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](uint64_t a, uint64_t b) {
+            return targets[a] < targets[b] || (targets[a] == targets[b] && position[a] < position[b]);
+        });
+        for (uint64_t newPosition = 0; newPosition < order.size(); ++newPosition) {
+            position[order[newPosition]] = newPosition;
+        }
+
+        uint64_t span = computeSpan(position);
+        if (span >= bestSpan) {
+            break;
+        }
+        bestSpan = span;
+        bestPosition = position;
+    }
+    STORM_LOG_TRACE("FORCE variable order has a total span of " << bestSpan << ".");
+
+    std::vector<storm::expressions::Variable> result(variables.size());
+    for (uint64_t index = 0; index < variables.size(); ++index) {
+        result[bestPosition[index]] = variables[index];
+    }
+    return result;
+}
+
+std::vector<std::set<storm::expressions::Variable>> getInteractingVariables(storm::prism::Program const& program) {
+    std::vector<std::set<storm::expressions::Variable>> result;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            std::set<storm::expressions::Variable> variables = command.getGuardExpression().getVariables();
+            for (auto const& update : command.getUpdates()) {
+                auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                variables.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                for (auto const& assignment : update.getAssignments()) {
+                    variables.insert(assignment.getVariable());
+                    auto expressionVariables = assignment.getExpression().getVariables();
+                    variables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+            if (command.isLabeled()) {
+                actionToVariables[command.getActionIndex()].insert(variables.begin(), variables.end());
+            }
+            result.push_back(std::move(variables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        result.push_back(std::move(actionVariables.second));
+    }
+    return result;
+}
+
+std::vector<std::set<storm::expressions::Variable>> getInteractingVariables(storm::jani::Model const& model) {
+    std::vector<std::set<storm::expressions::Variable>> result;
+    std::map<uint64_t, std::set<storm::expressions::Variable>> actionToVariables;
+    for (auto const& automaton : model.getAutomata()) {
+        for (auto const& edge : automaton.getEdges()) {
+            std::set<storm::expressions::Variable> variables = edge.getGuard().getVariables();
+            variables.insert(automaton.getLocationExpressionVariable());
+            for (auto const& destination : edge.getDestinations()) {
+                auto probabilityVariables = destination.getProbability().getVariables();
+                variables.insert(probabilityVariables.begin(), probabilityVariables.end());
+                for (auto const& assignment : destination.getOrderedAssignments()) {
+                    variables.insert(assignment.getLValue().getVariable().getExpressionVariable());
+                    auto expressionVariables = assignment.getAssignedExpression().getVariables();
+                    variables.insert(expressionVariables.begin(), expressionVariables.end());
+                }
+            }
+            if (!edge.hasSilentAction()) {
+                actionToVariables[edge.getActionIndex()].insert(variables.begin(), variables.end());
+            }
+            result.push_back(std::move(variables));
+        }
+    }
+    for (auto& actionVariables : actionToVariables) {
+        result.push_back(std::move(actionVariables.second));
+    }
+    return result;
+}
+
+}  // namespace builder
+}  // namespace storm
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+
+namespace prism {
+class Program;
+}
+namespace jani {
+class Model;
+}
+
+namespace builder {
+
+/*!
+ * Orders the given variables with the FORCE heuristic (Aloul, Markov, Sakallah: "FORCE: A Fast and Easy-To-Implement Variable-Ordering Heuristic").
+ * Starting from the given order, every variable is repeatedly moved to the average center of gravity of the hyperedges it occurs in, until the total span
+ * of the hyperedges no longer decreases. Variables of the same hyperedge thus end up close to each other, which typically keeps the DDs of the
+ * transition relation small.
+ *
+ * @param variables The variables in their initial order.
+ * @param hyperedges Sets of variables that interact. Variables that are not contained in the given variables are ignored.
+ * @return The reordered variables.
+ */
+std::vector<storm::expressions::Variable> computeForceOrder(std::vector<storm::expressions::Variable> const& variables,
+                                                            std::vector<std::set<storm::expressions::Variable>> const& hyperedges);
+
+/*!
+ * Retrieves the sets of variables that interact in the given program: one set per command (the variables of its guard and updates, including the
+ * written ones) and one set per synchronizing action (all variables of the commands labeled with the action).
+ */
+std::vector<std::set<storm::expressions::Variable>> getInteractingVariables(storm::prism::Program const& program);
+
+/*!
+ * Retrieves the sets of variables that interact in the given model: one set per edge (the location variable of its automaton and the variables of its
+ * guard, probabilities and assignments) and one set per non-silent action (all variables of the edges labeled with the action).
+ */
+std::vector<std::set<storm::expressions::Variable>> getInteractingVariables(storm::jani::Model const& model);
+
+}  // namespace builder
+}  // namespace storm
@@ -1,12 +1,22 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <map>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 
 #include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/MemoryLimitExceededException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -20,22 +30,260 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/StreamingSparseMatrixBuilder.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
 #include "storm/storage/jani/AutomatonComposition.h"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ParallelComposition.h"
+#include "storm/storage/sparse/ExternalStateStorage.h"
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/MemoryUsage.h"
+#include "storm/utility/Metrics.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 namespace storm {
 namespace builder {
 
+namespace {
+// The number of states whose labels are computed at once during an external (or minimizing) exploration.
+uint64_t const statesPerLabelingChunk = 65536;
+
+// The prefix of the labels that distinguish the rewards of the states during a minimizing exploration.
+std::string const rewardClassLabelPrefix = "__reward_class_";
+
+/*!
+ * Estimates the probability of taking a transition with the given value in a choice with the given total mass.
+ */
+template<typename ValueType>
+double estimateProbability(ValueType const& value, ValueType const& totalMass) {
+    return storm::utility::convertNumber<double>(value) / storm::utility::convertNumber<double>(totalMass);
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+double estimateProbability(storm::RationalFunction const& value, storm::RationalFunction const& totalMass) {
+    // Parametric transitions are estimated conservatively, i.e., they never prevent exploring a state.
+    if (!storm::utility::isConstant(value) || !storm::utility::isConstant(totalMass)) {
+        return 1.0;
+    }
+    return storm::utility::convertNumber<double>(value) / storm::utility::convertNumber<double>(totalMass);
+}
+#endif
+
+/*!
+ * A directory for temporary files that is removed (with its contents) upon destruction.
+ */
+class TemporaryDirectory {
+   public:
+    TemporaryDirectory(std::string const& parentDirectory) {
+        static thread_local std::mt19937_64 generator(std::random_device{}());
+        std::stringstream name;
+        name << "storm-exploration-" << std::hex << generator();
+        path = std::filesystem::path(parentDirectory) / name.str();
+        std::error_code error;
+        std::filesystem::create_directories(path, error);
+        STORM_LOG_THROW(std::filesystem::is_directory(path), storm::exceptions::FileIoException,
+                        "Could not create directory " << path.string() << ": " << error.message());
+    }
+
+    ~TemporaryDirectory() {
+        std::error_code error;
+        std::filesystem::remove_all(path, error);
+    }
+
+    std::string getPath() const {
+        return path.string();
+    }
+
+    std::string getFilename(std::string const& name) const {
+        return (path / name).string();
+    }
+
+   private:
+    std::filesystem::path path;
+};
+
+/*!
+ * The transitions of the layer that is currently explored. Their columns are the preliminary indices of the
+ * successor states, so they are kept in a file until the successors have been resolved.
+ */
+template<typename ValueType>
+class PendingTransitions {
+   public:
+    PendingTransitions(std::string const& filename) : filename(filename) {
+        open();
+    }
+
+    ~PendingTransitions() {
+        stream.close();
+        std::error_code error;
+        std::filesystem::remove(filename, error);
+    }
+
+    void add(uint64_t row, uint64_t column, ValueType const& value) {
+        Transition transition{row, column, value};
+        stream.write(reinterpret_cast<char const*>(&transition), sizeof(transition));
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write to file " << filename << ".");
+    }
+
+    /*!
+     * Adds the pending transitions to the given builder, where the columns are translated with the given mapping.
+     */
+    void flush(std::vector<uint64_t> const& indices, storm::storage::StreamingSparseMatrixBuilder<ValueType>& builder) {
+        stream.close();
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write to file " << filename << ".");
+
+        std::ifstream input(filename, std::ios::in | std::ios::binary);
+        STORM_LOG_THROW(input, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        std::vector<std::pair<uint64_t, ValueType>> row;
+        uint64_t currentRow = 0;
+        auto flushRow = [&]() {
+            // Different preliminary indices may refer to the same state, so the entries are combined as needed.
+            std::sort(row.begin(), row.end(), [](std::pair<uint64_t, ValueType> const& a, std::pair<uint64_t, ValueType> const& b) { return a.first < b.first; });
+            for (auto it = row.begin(); it != row.end();) {
+                ValueType value = it->second;
+                auto next = it + 1;
+                for (; next != row.end() && next->first == it->first; ++next) {
+                    value += next->second;
+                }
+                builder.addNextValue(currentRow, it->first, value);
+                it = next;
+            }
+            row.clear();
+        };
+
+        Transition transition;
+        while (input.read(reinterpret_cast<char*>(&transition), sizeof(transition))) {
+            if (transition.row != currentRow) {
+                flushRow();
+                currentRow = transition.row;
+            }
+            row.emplace_back(indices[transition.column], transition.value);
+        }
+        flushRow();
+        open();
+    }
+
+   private:
+    struct Transition {
+        uint64_t row;
+        uint64_t column;
+        ValueType value;
+    };
+
+    void open() {
+        stream.clear();
+        stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    }
+
+    std::string filename;
+    std::ofstream stream;
+};
+
+/*!
+ * Sorts the given transitions by their target states and sums up the values of transitions to the same state.
+ */
+template<typename StateType, typename ValueType>
+void mergeTransitions(std::vector<std::pair<StateType, ValueType>>& transitions) {
+    std::sort(transitions.begin(), transitions.end(),
+              [](std::pair<StateType, ValueType> const& lhs, std::pair<StateType, ValueType> const& rhs) { return lhs.first < rhs.first; });
+    auto target = transitions.begin();
+    for (auto source = transitions.begin(); source != transitions.end(); ++source) {
+        if (target != transitions.begin() && std::prev(target)->first == source->first) {
+            std::prev(target)->second += source->second;
+        } else {
+            *target = std::move(*source);
+            ++target;
+        }
+    }
+    transitions.erase(target, transitions.end());
+}
+
+/*!
+ * Computes the classes of the strong bisimulation of the given DTMC or CTMC.
+ */
+template<typename ModelType>
+std::vector<std::vector<uint64_t>> computeBisimulationClasses(ModelType const& model) {
+    typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options bisimulationOptions;
+    bisimulationOptions.buildQuotient = false;
+    storm::storage::DeterministicModelBisimulationDecomposition<ModelType> decomposition(model, bisimulationOptions);
+    decomposition.computeBisimulationDecomposition();
+
+    std::vector<std::vector<uint64_t>> result;
+    result.reserve(decomposition.size());
+    for (auto const& block : decomposition) {
+        result.emplace_back(block.begin(), block.end());
+    }
+    return result;
+}
+
+/*!
+ * Computes the classes of the strong bisimulation of the DTMC (or CTMC) with the given transitions and labeling.
+ */
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> computeBisimulationClasses(storm::storage::SparseMatrix<ValueType>&& transitionMatrix,
+                                                              storm::models::sparse::StateLabeling&& stateLabeling, bool continuousTime) {
+    if (continuousTime) {
+        return computeBisimulationClasses(storm::models::sparse::Ctmc<ValueType>(std::move(transitionMatrix), std::move(stateLabeling)));
+    }
+    return computeBisimulationClasses(storm::models::sparse::Dtmc<ValueType>(std::move(transitionMatrix), std::move(stateLabeling)));
+}
+
+/*!
+ * Adds a label for each combination of rewards among the given states to the given labeling (which only contains the given states), such that a
+ * bisimulation respecting the labels also respects the rewards. The rewards of state i are the entries i * rewardsPerState, ..., (i + 1) *
+ * rewardsPerState - 1 of the given vector.
+ */
+template<typename RewardValueType>
+void addRewardClassLabels(std::vector<RewardValueType> const& rewards, uint64_t rewardsPerState, storm::storage::BitVector const& states,
+                          storm::models::sparse::StateLabeling& stateLabeling) {
+    std::map<std::vector<RewardValueType>, storm::storage::BitVector> rewardsToStates;
+    uint64_t localState = 0;
+    for (auto state : states) {
+        std::vector<RewardValueType> stateRewards(rewards.begin() + state * rewardsPerState, rewards.begin() + (state + 1) * rewardsPerState);
+        auto rewardsStatesPair = rewardsToStates.emplace(std::move(stateRewards), storm::storage::BitVector(stateLabeling.getNumberOfItems())).first;
+        rewardsStatesPair->second.set(localState);
+        ++localState;
+    }
+
+    // If all states have the same rewards, there is nothing to distinguish.
+    if (rewardsToStates.size() <= 1) {
+        return;
+    }
+    uint64_t rewardClass = 0;
+    for (auto& rewardsStatesPair : rewardsToStates) {
+        std::string label = rewardClassLabelPrefix + std::to_string(rewardClass);
+        STORM_LOG_THROW(!stateLabeling.containsLabel(label), storm::exceptions::WrongFormatException,
+                        "The label '" << label << "' is reserved for the minimization during the exploration.");
+        stateLabeling.addLabel(label, std::move(rewardsStatesPair.second));
+        ++rewardClass;
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+std::vector<std::vector<uint64_t>> computeBisimulationClasses(storm::storage::SparseMatrix<storm::RationalFunction>&&, storm::models::sparse::StateLabeling&&,
+                                                              bool) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The minimization during the exploration is not supported for parametric models.");
+}
+
+void addRewardClassLabels(std::vector<storm::Interval> const&, uint64_t, storm::storage::BitVector const&, storm::models::sparse::StateLabeling&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The minimization during the exploration is not supported for interval rewards.");
+}
+#endif
+}  // namespace
+
 template<typename StateType>
 StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
     auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
@@ -51,16 +299,78 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
     return this->stateToId.size();
 }
 
+template<typename ValueType, typename StateType>
+LazyStateInformation<ValueType, StateType>::LazyStateInformation(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                                                                 storm::storage::sparse::StateToIdMap<StateType> const& stateToId)
+    : generator(generator),
+      stateSize(generator->getStateSize()),
+      bitsPerState(((stateSize + 63) / 64) * 64),
+      numberOfStates(stateToId.size()),
+      states(bitsPerState * numberOfStates) {
+    for (auto const& stateIndexPair : stateToId) {
+        states.set(stateIndexPair.second * bitsPerState, stateIndexPair.first);
+    }
+}
+
+template<typename ValueType, typename StateType>
+uint64_t LazyStateInformation<ValueType, StateType>::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+template<typename ValueType, typename StateType>
+CompressedState LazyStateInformation<ValueType, StateType>::getCompressedState(StateType const& state) const {
+    STORM_LOG_THROW(state < numberOfStates, storm::exceptions::IllegalArgumentException, "Invalid state index " << state << ".");
+    CompressedState result(stateSize);
+    uint64_t const offset = state * bitsPerState;
+    for (uint64_t bitIndex = 0; bitIndex < stateSize; bitIndex += 64) {
+        uint64_t const numberOfBits = std::min<uint64_t>(64, stateSize - bitIndex);
+        result.setFromInt(bitIndex, numberOfBits, states.getAsInt(offset + bitIndex, numberOfBits));
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+storm::expressions::SimpleValuation LazyStateInformation<ValueType, StateType>::getStateValuation(StateType const& state) const {
+    CompressedState compressedState = getCompressedState(state);
+    generator->load(compressedState);
+    return generator->currentStateToSimpleValuation();
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::storage::sparse::ChoiceOrigins> LazyStateInformation<ValueType, StateType>::getChoiceOrigins(StateType const& state) const {
+    return generator->generateChoiceOriginsOfState(getCompressedState(state));
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-    // Intentionally left empty.
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      numberOfThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()),
+      externalExplorationMemoryLimit(1024 * 1024 * 1024),
+      stateCompression(storm::settings::getModule<storm::settings::modules::BuildSettings>().isStateCompressionSet()),
+      fingerprintedStateStorage(storm::settings::getModule<storm::settings::modules::BuildSettings>().isFingerprintedStateStorageSet()),
+      guardBatchSize(storm::settings::getModule<storm::settings::modules::BuildSettings>().getGuardBatchSize()),
+      matrixBlockSize(storm::settings::getModule<storm::settings::modules::BuildSettings>().getMatrixBlockSize()),
+      releaseStateStorage(false),
+      explorationBudget(0),
+      explorationProbabilityThreshold(0.0),
+      bisimulationInterval(storm::settings::getModule<storm::settings::modules::BuildSettings>().getBisimulationInterval()) {
+    auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    if (buildSettings.isExternalExplorationSet()) {
+        externalExplorationDirectory = buildSettings.getExternalExplorationDirectory();
+        externalExplorationMemoryLimit = buildSettings.getExternalExplorationMemoryLimit();
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator),
+      options(options),
+      stateStorage(createStateStorage()),
+      exploredExternally(false),
+      exploredMinimizing(false),
+      stateStorageReleased(false),
+      numberOfPartiallyExpandedStates(0) {
     // Intentionally left empty.
 }
 
@@ -69,7 +379,9 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    generatorFactory = [program, generatorOptions]() {
+        return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+    };
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -77,7 +389,9 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    generatorFactory = [model, generatorOptions]() {
+        return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+    };
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -114,6 +428,11 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     StateType actualIndex = actualIndexBucketPair.first;
 
     if (actualIndex == newIndex) {
+        if (isPartialExploration()) {
+            partialExplorationStates.push_back(state);
+            partialExplorationProbabilities.push_back(0.0);
+            partialExplorationBehaviors.emplace_back();
+        }
         if (options.explorationOrder == ExplorationOrder::Dfs) {
             statesToExplore.emplace_front(state, actualIndex);
 
@@ -129,15 +448,270 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
     return actualIndex;
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::supportsConcurrentValueConstruction() {
+    // Carl's rational functions share (non-thread-safe) caches of polynomials and their factorizations.
+    bool result =
+        !std::is_same<ValueType, storm::RationalFunction>::value && !std::is_same<typename RewardModelType::ValueType, storm::RationalFunction>::value;
+#if defined(STORM_HAVE_CLN) && defined(STORM_USE_CLN_EA)
+    // CLN numbers share their representation via reference counts that are not updated atomically.
+    result &= !std::is_same<ValueType, storm::RationalNumber>::value && !std::is_same<typename RewardModelType::ValueType, storm::RationalNumber>::value;
+#endif
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::prepareParallelExploration() {
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(options.numberOfThreads);
+    if (numberOfThreads <= 1) {
+        return false;
+    }
+    if (!supportsConcurrentValueConstruction()) {
+        STORM_LOG_WARN("Parallel exploration is not supported for the value type of the model as its values can not be created concurrently. Falling back to "
+                       "sequential exploration.");
+        return false;
+    }
+    if (!generatorFactory) {
+        STORM_LOG_WARN("Parallel exploration is only available when building from a PRISM program or JANI model. Falling back to sequential exploration.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Parallel exploration requires breadth-first exploration order. Falling back to sequential exploration.");
+        return false;
+    }
+    if (isPartialExploration()) {
+        STORM_LOG_WARN("Parallel exploration does not support an exploration budget. Falling back to sequential exploration.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Parallel exploration does not support building the overlapping guards label. Falling back to sequential exploration.");
+        return false;
+    }
+    if (generator->getOptions().isPartialOrderReductionSet()) {
+        STORM_LOG_WARN("Parallel exploration does not support partial order reduction. Falling back to sequential exploration.");
+        return false;
+    }
+
+    workerGenerators.clear();
+    workerGenerators.push_back(generator);
+    while (workerGenerators.size() < numberOfThreads) {
+        workerGenerators.push_back(generatorFactory());
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandInParallel(
+    uint64_t numberOfStates, std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors,
+    std::vector<std::vector<CompressedState>>& successors) {
+    STORM_LOG_ASSERT(numberOfStates <= statesToExplore.size(), "Cannot expand more states than there are in the queue.");
+    behaviors.clear();
+    behaviors.resize(numberOfStates);
+    successors.resize(numberOfStates);
+
+    storm::utility::parallel::forEachChunk(0, numberOfStates, 64, workerGenerators.size(), [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+        auto& workerGenerator = *workerGenerators[threadIndex];
+
+        // Assign local indices to the successors of a state in the order in which they are requested.
+        std::unordered_map<CompressedState, StateType> localIndices;
+        std::vector<CompressedState>* currentSuccessors = nullptr;
+        std::function<StateType(CompressedState const&)> localStateToIdCallback = [&localIndices, &currentSuccessors](CompressedState const& state) {
+            auto insertionResult = localIndices.emplace(state, static_cast<StateType>(localIndices.size()));
+            if (insertionResult.second) {
+                currentSuccessors->push_back(state);
+            }
+            return insertionResult.first->second;
+        };
+
+        if (options.guardBatchSize > 0) {
+            std::vector<CompressedState> chunkStates;
+            chunkStates.reserve(chunkEnd - chunkBegin);
+            for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                chunkStates.push_back(statesToExplore[index].first);
+            }
+            workerGenerator.prepareBatch(chunkStates);
+        }
+
+        for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+            localIndices.clear();
+            currentSuccessors = &successors[index];
+            currentSuccessors->clear();
+
+            workerGenerator.load(statesToExplore[index].first);
+            behaviors[index] = workerGenerator.expand(localStateToIdCallback);
+        }
+    });
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::prepareExternalExploration() const {
+    if (!options.externalExplorationDirectory) {
+        return false;
+    }
+    if (!std::is_trivially_copyable<ValueType>::value) {
+        STORM_LOG_WARN("External exploration is only available for floating point values. Falling back to in-memory exploration.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("External exploration requires breadth-first exploration order. Falling back to in-memory exploration.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("External exploration does not support building the overlapping guards label. Falling back to in-memory exploration.");
+        return false;
+    }
+    if (generator->getOptions().isPartialOrderReductionSet()) {
+        STORM_LOG_WARN("External exploration does not support partial order reduction. Falling back to in-memory exploration.");
+        return false;
+    }
+    if (isPartialExploration()) {
+        STORM_LOG_WARN("External exploration does not support an exploration budget. Falling back to in-memory exploration.");
+        return false;
+    }
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "External exploration is done sequentially, ignoring the number of exploration threads.");
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::prepareMinimizingExploration() const {
+    if (options.bisimulationInterval == 0) {
+        return false;
+    }
+    if (!generator->isDeterministicModel()) {
+        STORM_LOG_WARN("Minimization during the exploration is only available for DTMCs and CTMCs. Falling back to exploration without minimization.");
+        return false;
+    }
+    if (std::is_same<ValueType, storm::RationalFunction>::value || !std::is_same<ValueType, typename RewardModelType::ValueType>::value) {
+        STORM_LOG_WARN("Minimization during the exploration is not available for parametric models or interval rewards. Falling back to exploration "
+                       "without minimization.");
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Minimization during the exploration requires breadth-first exploration order. Falling back to exploration without minimization.");
+        return false;
+    }
+    if (isPartialExploration()) {
+        STORM_LOG_WARN("Minimization during the exploration does not support an exploration budget. Falling back to exploration without minimization.");
+        return false;
+    }
+    auto const& generatorOptions = generator->getOptions();
+    if (generatorOptions.isBuildStateValuationsSet() || generatorOptions.isBuildChoiceLabelsSet() || generatorOptions.isBuildChoiceOriginsSet() ||
+        generatorOptions.isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN(
+            "Minimization during the exploration does not support building state valuations, choice labels, choice origins or the overlapping guards "
+            "label. Falling back to exploration without minimization.");
+        return false;
+    }
+    STORM_LOG_WARN_COND(options.numberOfThreads == 1, "Minimization during the exploration is done sequentially, ignoring the number of exploration threads.");
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isPartialExploration() const {
+    // Once the exploration was partial, later builds continue it (even if the budget is lifted).
+    return options.explorationBudget > 0 || options.explorationProbabilityThreshold > 0.0 || !partialExplorationStates.empty();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+storm::generator::StateBehavior<ValueType, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::expandPartially(
+    StateType const& state, std::function<StateType(CompressedState const&)> const& stateToIdCallback) {
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (partialExplorationBehaviors[state]) {
+        behavior = partialExplorationBehaviors[state].get();
+    } else if ((options.explorationBudget == 0 || numberOfPartiallyExpandedStates < options.explorationBudget) &&
+               partialExplorationProbabilities[state] >= options.explorationProbabilityThreshold) {
+        behavior = generator->expand(stateToIdCallback);
+        partialExplorationBehaviors[state] = behavior;
+        ++numberOfPartiallyExpandedStates;
+    } else {
+        // The state is not expanded, which (as the behavior is marked as not expanded) makes it absorbing.
+        unexploredStateIndices.push_back(state);
+        return behavior;
+    }
+
+    // Propagate the reachability estimate to the successors.
+    double const stateProbability = partialExplorationProbabilities[state];
+    for (auto const& choice : behavior) {
+        ValueType const totalMass = choice.getTotalMass();
+        for (auto const& stateProbabilityPair : choice) {
+            double& successorProbability = partialExplorationProbabilities[stateProbabilityPair.first];
+            successorProbability = std::max(successorProbability, stateProbability * estimateProbability(stateProbabilityPair.second, totalMass));
+        }
+    }
+    return behavior;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::setExplorationBudget(uint64_t explorationBudget, double explorationProbabilityThreshold) {
+    options.explorationBudget = explorationBudget;
+    options.explorationProbabilityThreshold = explorationProbabilityThreshold;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::hasUnexploredStates() const {
+    return !unexploredStateIndices.empty();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+std::string const& ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getUnexploredLabel() {
+    static const std::string label = "unexplored";
+    return label;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addChoiceInformation(
+    storm::generator::Choice<ValueType, StateType> const& choice, uint64_t row, uint64_t rowGroup, bool firstChoiceOfState,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+        for (auto const& label : choice.getLabels()) {
+            stateAndChoiceInformationBuilder.addChoiceLabel(label, row);
+        }
+    }
+    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+        stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), row);
+    }
+    if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+        STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), rowGroup),
+                         "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+        if (firstChoiceOfState) {
+            stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), rowGroup);
+        }
+    }
+    if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+        stateAndChoiceInformationBuilder.addMarkovianState(rowGroup);
+    }
+
+    // Add the rewards to the reward models.
+    auto choiceRewardIt = choice.getRewards().begin();
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        if (rewardModelBuilder.hasStateActionRewards()) {
+            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+        }
+        ++choiceRewardIt;
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
+    STORM_LOG_THROW(!exploredExternally && !exploredMinimizing, storm::exceptions::NotSupportedException,
+                    "The state lookup is not available after an external or minimizing exploration.");
+    STORM_LOG_THROW(!stateStorageReleased, storm::exceptions::NotSupportedException, "The state lookup is not available as the states were released.");
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
+LazyStateInformation<ValueType, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportLazyStateInformation() const {
+    STORM_LOG_THROW(!exploredExternally && !exploredMinimizing, storm::exceptions::NotSupportedException,
+                    "The state information is not available after an external or minimizing exploration.");
+    STORM_LOG_THROW(!stateStorageReleased, storm::exceptions::NotSupportedException, "The state information is not available as the states were released.");
+    return LazyStateInformation<ValueType, StateType>(this->generator, this->stateStorage.stateToId);
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+template<typename MatrixBuilderType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
-    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
     StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
     // Initialize building state valuations (if necessary)
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
@@ -155,10 +729,30 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         stateRemapping = std::vector<uint_fast64_t>();
     }
 
+    // A partial exploration continues the exploration of a previous build (if any), so the states that were already
+    // discovered are revisited in the order of their indices.
+    bool const partialExploration = isPartialExploration();
+    if (partialExploration) {
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::NotSupportedException,
+                        "Partial exploration requires breadth-first exploration order.");
+        STORM_LOG_THROW(partialExplorationStates.size() == stateStorage.getNumberOfStates(), storm::exceptions::NotSupportedException,
+                        "Partial exploration can only continue an exploration that was partial as well.");
+        this->stateStorage.deadlockStateIndices.clear();
+        unexploredStateIndices.clear();
+        for (StateType state = 0; state < partialExplorationStates.size(); ++state) {
+            statesToExplore.emplace_back(partialExplorationStates[state], state);
+        }
+    }
+
     // Let the generator create all initial states.
     this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
     STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
                     "The model does not have a single initial state.");
+    if (partialExploration) {
+        for (auto const& initialState : this->stateStorage.initialStateIndices) {
+            partialExplorationProbabilities[initialState] = 1.0;
+        }
+    }
 
     // Now explore the current state until there is no more reachable state.
     uint_fast64_t currentRowGroup = 0;
@@ -169,8 +763,51 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
+    // If a memory limit is set, the memory is checked periodically such that the exploration can be aborted before the limit is exceeded.
+    bool const checkMemoryLimit = storm::utility::memory::getMemoryLimit() > 0;
+    uint64_t const memoryCheckInterval = 4096;
+
+    // If metrics are collected, the progress of the exploration is reported periodically.
+    uint64_t const metricsUpdateInterval = 1024;
+
+    // If the exploration is done in parallel, the states at the front of the queue are expanded in batches by the
+    // worker threads. The results are then processed here in the order of the queue, which assigns the indices of
+    // new states exactly as the sequential exploration does.
+    bool parallelExploration = prepareParallelExploration();
+    uint64_t const maximalBatchSize = 16384 * workerGenerators.size();
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> batchBehaviors;
+    std::vector<std::vector<CompressedState>> batchSuccessors;
+    uint64_t batchPosition = 0;
+    uint64_t numberOfBatches = 0;
+
+    // In a sequential breadth-first exploration, the generator may evaluate the guards of the states at the front of
+    // the queue at once. As the states are expanded in the order of the queue, the batch is prepared whenever the
+    // states of the previous batch have been expanded.
+    bool const batchGuards = !parallelExploration && !partialExploration && options.guardBatchSize > 0 && options.explorationOrder == ExplorationOrder::Bfs;
+    std::vector<CompressedState> guardBatchStates;
+    uint64_t remainingGuardBatchStates = 0;
+    std::vector<StateType> successorIndices;
+    std::vector<std::pair<StateType, ValueType>> remappedEntries;
+
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
+        if (parallelExploration && batchPosition == batchBehaviors.size()) {
+            expandInParallel(std::min<uint64_t>(statesToExplore.size(), maximalBatchSize), batchBehaviors, batchSuccessors);
+            batchPosition = 0;
+            ++numberOfBatches;
+        }
+        if (batchGuards && remainingGuardBatchStates == 0) {
+            remainingGuardBatchStates = std::min<uint64_t>(statesToExplore.size(), options.guardBatchSize);
+            guardBatchStates.clear();
+            for (uint64_t index = 0; index < remainingGuardBatchStates; ++index) {
+                guardBatchStates.push_back(statesToExplore[index].first);
+            }
+            generator->prepareBatch(guardBatchStates);
+        }
+        if (batchGuards) {
+            --remainingGuardBatchStates;
+        }
+
         // Get the first state in the queue.
         CompressedState currentState = statesToExplore.front().first;
         StateType currentIndex = statesToExplore.front().second;
@@ -186,11 +823,26 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
         }
 
-        generator->load(currentState);
+        // In a parallel exploration, the state only needs to be loaded to obtain its valuation.
+        if (!parallelExploration || stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+            generator->load(currentState);
+        }
         if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
-        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+        if (parallelExploration) {
+            behavior = std::move(batchBehaviors[batchPosition]);
+            successorIndices.clear();
+            for (auto const& successor : batchSuccessors[batchPosition]) {
+                successorIndices.push_back(getOrAddStateIndex(successor));
+            }
+            ++batchPosition;
+        } else if (partialExploration) {
+            behavior = expandPartially(currentIndex, stateToIdCallback);
+        } else {
+            behavior = generator->expand(stateToIdCallback);
+        }
 
         // If there is no behavior, we might have to introduce a self-loop.
         if (behavior.empty()) {
@@ -249,39 +901,25 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             // Now add all choices.
             bool firstChoiceOfState = true;
             for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
+                // Add the generated choice information and the rewards.
+                addChoiceInformation(choice, currentRow, currentRowGroup, firstChoiceOfState, rewardModelBuilders, stateAndChoiceInformationBuilder);
 
                 // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                if (parallelExploration) {
+                    // The choice refers to local indices, so we translate them and restore the order of the columns.
+                    remappedEntries.clear();
+                    for (auto const& stateProbabilityPair : choice) {
+                        remappedEntries.emplace_back(successorIndices[stateProbabilityPair.first], stateProbabilityPair.second);
+                    }
+                    std::sort(remappedEntries.begin(), remappedEntries.end(),
+                              [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                    for (auto const& stateProbabilityPair : remappedEntries) {
+                        transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                } else {
+                    for (auto const& stateProbabilityPair : choice) {
+                        transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
                     }
-                    ++choiceRewardIt;
                 }
                 ++currentRow;
                 firstChoiceOfState = false;
@@ -300,18 +938,63 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
                 auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
                 auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
                 std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
-                          << " states per second).\n";
+                          << " states per second";
+                if (parallelExploration) {
+                    std::cout << " using " << workerGenerators.size() << " threads";
+                }
+                std::cout << ").\n";
                 timeOfLastMessage = std::chrono::high_resolution_clock::now();
                 numberOfExploredStatesSinceLastMessage = 0;
             }
         }
 
+        if (numberOfExploredStates % metricsUpdateInterval == 0 && storm::utility::Metrics::getInstance().isEnabled()) {
+            auto& metrics = storm::utility::Metrics::getInstance();
+            metrics.setGauge("storm_explored_states", static_cast<double>(numberOfExploredStates));
+            metrics.setGauge("storm_exploration_frontier_states", static_cast<double>(statesToExplore.size()));
+            metrics.setGauge("storm_state_storage_load_factor", stateStorage.stateToId.getLoadFactor());
+            metrics.setGauge("storm_matrix_entries", static_cast<double>(transitionMatrixBuilder.getNumberOfEntries()));
+        }
+
         if (storm::utility::resources::isTerminate()) {
             auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
             std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
             STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
             break;
         }
+
+        if (checkMemoryLimit && numberOfExploredStates % memoryCheckInterval == 0) {
+            // The transition matrix and the state storage grow geometrically, so their next growth allocates about as much memory as they currently reserve.
+            uint64_t projectedBytes = transitionMatrixBuilder.getReservedBytes() + stateStorage.getSizeInMemory();
+            if (!storm::utility::memory::isWithinMemoryLimit(projectedBytes)) {
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states (" << statesToExplore.size() << " more states found) with " << currentRow
+                          << " choices in " << durationSinceStart << " seconds using " << storm::utility::formatBytes(storm::utility::memory::getUsedBytes())
+                          << " before reaching the memory limit.\n";
+                STORM_LOG_THROW(false, storm::exceptions::MemoryLimitExceededException,
+                                "Building the model would exceed the memory limit of "
+                                    << storm::utility::formatBytes(storm::utility::memory::getMemoryLimit()) << " (another "
+                                    << storm::utility::formatBytes(projectedBytes) << " are projected to be allocated after exploring "
+                                    << numberOfExploredStates << " states).");
+            }
+        }
+    }
+
+    if (parallelExploration) {
+        auto durationSinceStart = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+        STORM_LOG_INFO("Explored " << numberOfExploredStates << " states in " << durationSinceStart << "ms using " << workerGenerators.size()
+                                   << " threads and " << numberOfBatches << " batches.");
+        // Only keep the generator of the main thread.
+        workerGenerators.clear();
+    }
+    if (partialExploration) {
+        STORM_LOG_INFO("Partially explored " << numberOfPartiallyExpandedStates << " states, leaving " << unexploredStateIndices.size()
+                                             << " states unexplored.");
+    }
+    if (stateStorage.stateToId.isCompressed()) {
+        auto const& compressedStates = stateStorage.stateToId.getCompressedMap();
+        STORM_LOG_INFO("Stored " << compressedStates.size() << " states tree-compressed along " << compressedStates.getNumberOfComponents()
+                                 << " components in " << compressedStates.getSizeInMemory() / 1024 << "KB.");
     }
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
@@ -343,6 +1026,421 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesExternally(
+    storm::storage::StreamingSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::string const& directory,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    // Initialize building state valuations (if necessary)
+    if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+        stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
+    }
+
+    // The generator only obtains preliminary indices of the successors, which are resolved after each layer.
+    storm::storage::sparse::ExternalStateStorage<StateType> externalStateStorage(directory, generator->getStateSize(),
+                                                                                   options.externalExplorationMemoryLimit);
+    std::function<StateType(CompressedState const&)> stateToIdCallback = [&externalStateStorage](CompressedState const& state) {
+        return externalStateStorage.registerCandidate(state);
+    };
+    PendingTransitions<ValueType> pendingTransitions((std::filesystem::path(directory) / "transitions").string());
+
+    // Let the generator create all initial states.
+    std::vector<StateType> initialCandidates = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!initialCandidates.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+    auto const& initialIndices = externalStateStorage.resolveCandidates();
+    for (auto candidate : initialCandidates) {
+        this->stateStorage.initialStateIndices.push_back(static_cast<StateType>(initialIndices[candidate]));
+    }
+
+    // As the states are not kept in memory, they are labeled in chunks while they are explored.
+    std::map<std::string, storm::storage::BitVector> labelsToStates;
+    storm::storage::sparse::StateStorage<StateType> labelingChunk(generator->getStateSize());
+    uint64_t firstStateOfChunk = 0;
+    auto labelChunk = [&]() {
+        uint64_t endOfChunk = firstStateOfChunk + labelingChunk.getNumberOfStates();
+        for (auto index : this->stateStorage.initialStateIndices) {
+            if (index >= firstStateOfChunk && index < endOfChunk) {
+                labelingChunk.initialStateIndices.push_back(index - firstStateOfChunk);
+            }
+        }
+        storm::models::sparse::StateLabeling chunkLabeling =
+            generator->label(labelingChunk, labelingChunk.initialStateIndices, labelingChunk.deadlockStateIndices);
+        for (auto const& label : chunkLabeling.getLabels()) {
+            storm::storage::BitVector& states = labelsToStates[label];
+            states.resize(endOfChunk);
+            for (auto state : chunkLabeling.getStates(label)) {
+                states.set(firstStateOfChunk + state);
+            }
+        }
+        firstStateOfChunk = endOfChunk;
+        labelingChunk = storm::storage::sparse::StateStorage<StateType>(generator->getStateSize());
+    };
+
+    uint_fast64_t currentRowGroup = 0;
+    uint_fast64_t currentRow = 0;
+
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStatesSinceLastMessage = 0;
+
+    CompressedState currentState;
+    StateType currentIndex;
+    while (externalStateStorage.beginLayer()) {
+        while (externalStateStorage.getNextState(currentState, currentIndex)) {
+            STORM_LOG_ASSERT(currentIndex == currentRowGroup, "Unexpected order of states in external exploration.");
+
+            generator->load(currentState);
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            if (generator->isPartiallyObservable()) {
+                externalObservabilityClasses.push_back(generator->observabilityClass(currentState));
+            }
+            storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                STORM_LOG_THROW(!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded(),
+                                storm::exceptions::WrongFormatException,
+                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+                if (behavior.wasExpanded()) {
+                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    labelingChunk.deadlockStateIndices.push_back(currentIndex - firstStateOfChunk);
+                }
+                pendingTransitions.add(currentRow, externalStateStorage.registerCandidate(currentState), storm::utility::one<ValueType>());
+
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                    }
+                    if (rewardModelBuilder.hasStateActionRewards()) {
+                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                    }
+                }
+
+                // This state shall be Markovian (to not introduce Zeno behavior)
+                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+                }
+                ++currentRow;
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+
+                bool firstChoiceOfState = true;
+                for (auto const& choice : behavior) {
+                    addChoiceInformation(choice, currentRow, currentRowGroup, firstChoiceOfState, rewardModelBuilders, stateAndChoiceInformationBuilder);
+                    for (auto const& stateProbabilityPair : choice) {
+                        pendingTransitions.add(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    ++currentRow;
+                    firstChoiceOfState = false;
+                }
+            }
+            ++currentRowGroup;
+
+            labelingChunk.stateToId.findOrAdd(currentState, static_cast<StateType>(currentIndex - firstStateOfChunk));
+            if (labelingChunk.getNumberOfStates() == statesPerLabelingChunk) {
+                labelChunk();
+            }
+
+            if (generator->getOptions().isShowProgressSet()) {
+                ++numberOfExploredStatesSinceLastMessage;
+
+                auto now = std::chrono::high_resolution_clock::now();
+                auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                    auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                    auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                    std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
+                              << " states per second, layer " << externalStateStorage.getNumberOfLayers() << ").\n";
+                    timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    numberOfExploredStatesSinceLastMessage = 0;
+                }
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+                std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds before abort.\n";
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+            }
+        }
+
+        // Now that the successors of the layer are known, its transitions can be added to the matrix.
+        pendingTransitions.flush(externalStateStorage.resolveCandidates(), transitionMatrixBuilder);
+    }
+    labelChunk();
+
+    auto durationSinceStart = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+    STORM_LOG_INFO("Explored " << currentRowGroup << " states in " << externalStateStorage.getNumberOfLayers() << " layers and " << durationSinceStart
+                               << "ms using external memory.");
+
+    externalStateLabeling = storm::models::sparse::StateLabeling(currentRowGroup);
+    for (auto& labelStatesPair : labelsToStates) {
+        labelStatesPair.second.resize(currentRowGroup);
+        externalStateLabeling->addLabel(labelStatesPair.first, std::move(labelStatesPair.second));
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+storm::storage::SparseMatrix<ValueType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesMinimizing(
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders) {
+    typedef typename RewardModelType::ValueType RewardValueType;
+
+    std::function<StateType(CompressedState const&)> stateToIdCallback =
+        std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+
+    // Let the generator create all initial states.
+    this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
+                    "The model does not have a single initial state.");
+
+    // For every explored state, we store its successors (given by their representatives) and its state and action rewards (for every reward model
+    // consecutively). The successors of collapsed states are released.
+    std::vector<std::vector<std::pair<StateType, ValueType>>> successors;
+    uint64_t const rewardsPerState = 2 * rewardModelBuilders.size();
+    std::vector<RewardValueType> rewards;
+
+    // Every collapsed state points to another state of its bisimulation class. Following these pointers leads to the representative of the class.
+    std::vector<StateType> representatives;
+    storm::storage::BitVector collapsedStates;
+    auto getRepresentative = [&representatives](StateType state) {
+        if (state >= representatives.size()) {
+            return state;
+        }
+        StateType representative = state;
+        while (representatives[representative] != representative) {
+            representative = representatives[representative];
+        }
+        while (representatives[state] != representative) {
+            StateType next = representatives[state];
+            representatives[state] = representative;
+            state = next;
+        }
+        return representative;
+    };
+
+    // As the minimization needs the labels of the explored states, they are labeled in chunks while they are explored.
+    std::map<std::string, storm::storage::BitVector> labelsToStates;
+    storm::storage::sparse::StateStorage<StateType> labelingChunk(generator->getStateSize());
+    uint64_t firstStateOfChunk = 0;
+    auto labelChunk = [&]() {
+        uint64_t endOfChunk = firstStateOfChunk + labelingChunk.getNumberOfStates();
+        for (auto index : this->stateStorage.initialStateIndices) {
+            if (index >= firstStateOfChunk && index < endOfChunk) {
+                labelingChunk.initialStateIndices.push_back(index - firstStateOfChunk);
+            }
+        }
+        storm::models::sparse::StateLabeling chunkLabeling =
+            generator->label(labelingChunk, labelingChunk.initialStateIndices, labelingChunk.deadlockStateIndices);
+        for (auto const& label : chunkLabeling.getLabels()) {
+            storm::storage::BitVector& states = labelsToStates[label];
+            states.resize(endOfChunk);
+            for (auto state : chunkLabeling.getStates(label)) {
+                states.set(firstStateOfChunk + state);
+            }
+        }
+        firstStateOfChunk = endOfChunk;
+        labelingChunk = storm::storage::sparse::StateStorage<StateType>(generator->getStateSize());
+    };
+
+    // Minimizes the explored states that cannot reach a state that is still to be explored. As the behavior of these (closed) states is
+    // completely known, bisimilar closed states can be collapsed.
+    uint64_t numberOfMinimizedStates = 0;
+    uint64_t numberOfMinimizations = 0;
+    auto minimize = [&]() {
+        labelChunk();
+        uint64_t const numberOfStates = stateStorage.getNumberOfStates();
+        for (StateType state = representatives.size(); state < numberOfStates; ++state) {
+            representatives.push_back(state);
+        }
+        collapsedStates.resize(numberOfStates);
+
+        storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(numberOfStates, numberOfStates, 0, true);
+        for (uint64_t state = 0; state < successors.size(); ++state) {
+            for (auto const& entry : successors[state]) {
+                matrixBuilder.addNextValue(state, entry.first, entry.second);
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> transitionMatrix = matrixBuilder.build();
+        storm::storage::BitVector pendingStates(numberOfStates);
+        for (uint64_t state = successors.size(); state < numberOfStates; ++state) {
+            pendingStates.set(state);
+        }
+        storm::storage::BitVector closedStates =
+            ~storm::utility::graph::performProbGreater0(transitionMatrix.transpose(), storm::storage::BitVector(numberOfStates, true), pendingStates);
+        closedStates &= ~collapsedStates;
+
+        // Closed states remain closed, so we only need to minimize if new states became closed.
+        uint64_t const numberOfClosedStates = closedStates.getNumberOfSetBits();
+        if (numberOfClosedStates == numberOfMinimizedStates) {
+            return;
+        }
+
+        storm::models::sparse::StateLabeling closedStateLabeling(numberOfClosedStates);
+        for (auto const& labelStatesPair : labelsToStates) {
+            storm::storage::BitVector states = labelStatesPair.second;
+            states.resize(numberOfStates);
+            closedStateLabeling.addLabel(labelStatesPair.first, states % closedStates);
+        }
+        addRewardClassLabels(rewards, rewardsPerState, closedStates, closedStateLabeling);
+        std::vector<std::vector<uint64_t>> bisimulationClasses = computeBisimulationClasses(
+            transitionMatrix.getSubmatrix(false, closedStates, closedStates), std::move(closedStateLabeling), !generator->isDiscreteTimeModel());
+
+        // Collapse each class into one of its states, where initial states are preferred such that the initial states are kept.
+        std::vector<StateType> closedStateIndices(closedStates.begin(), closedStates.end());
+        storm::storage::BitVector initialStates(numberOfStates, this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end());
+        uint64_t numberOfCollapsedStates = 0;
+        for (auto const& bisimulationClass : bisimulationClasses) {
+            StateType representative = closedStateIndices[bisimulationClass.front()];
+            for (auto localState : bisimulationClass) {
+                if (initialStates.get(closedStateIndices[localState])) {
+                    representative = closedStateIndices[localState];
+                    break;
+                }
+            }
+            for (auto localState : bisimulationClass) {
+                StateType state = closedStateIndices[localState];
+                if (state != representative) {
+                    representatives[state] = representative;
+                    collapsedStates.set(state);
+                    std::vector<std::pair<StateType, ValueType>>().swap(successors[state]);
+                    ++numberOfCollapsedStates;
+                }
+            }
+        }
+        if (numberOfCollapsedStates > 0) {
+            for (auto& stateSuccessors : successors) {
+                bool redirected = false;
+                for (auto& entry : stateSuccessors) {
+                    StateType representative = getRepresentative(entry.first);
+                    if (representative != entry.first) {
+                        entry.first = representative;
+                        redirected = true;
+                    }
+                }
+                if (redirected) {
+                    mergeTransitions(stateSuccessors);
+                }
+            }
+        }
+        numberOfMinimizedStates = numberOfClosedStates - numberOfCollapsedStates;
+        ++numberOfMinimizations;
+        STORM_LOG_DEBUG("Minimized " << numberOfClosedStates << " closed states to " << numberOfMinimizedStates << " states after exploring "
+                                     << successors.size() << " states.");
+    };
+
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    while (!statesToExplore.empty()) {
+        CompressedState currentState = std::move(statesToExplore.front().first);
+        StateType currentIndex = statesToExplore.front().second;
+        statesToExplore.pop_front();
+        STORM_LOG_ASSERT(currentIndex == successors.size(), "Unexpected order of states in minimizing exploration.");
+
+        generator->load(currentState);
+        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+        successors.emplace_back();
+        std::vector<std::pair<StateType, ValueType>>& currentSuccessors = successors.back();
+        rewards.resize(rewards.size() + rewardsPerState, storm::utility::zero<RewardValueType>());
+        auto currentRewardsIt = rewards.end() - rewardsPerState;
+
+        // If there is no behavior, we might have to introduce a self-loop.
+        if (behavior.empty()) {
+            STORM_LOG_THROW(!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded(),
+                            storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                labelingChunk.deadlockStateIndices.push_back(currentIndex - firstStateOfChunk);
+            }
+            currentSuccessors.emplace_back(currentIndex, storm::utility::one<ValueType>());
+        } else {
+            for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+                currentRewardsIt[2 * rewardModelIndex] = behavior.getStateRewards()[rewardModelIndex];
+            }
+            for (auto const& choice : behavior) {
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+                    currentRewardsIt[2 * rewardModelIndex + 1] += choice.getRewards()[rewardModelIndex];
+                }
+                for (auto const& stateProbabilityPair : choice) {
+                    currentSuccessors.emplace_back(getRepresentative(stateProbabilityPair.first), stateProbabilityPair.second);
+                }
+            }
+            mergeTransitions(currentSuccessors);
+        }
+
+        labelingChunk.stateToId.findOrAdd(currentState, static_cast<StateType>(currentIndex - firstStateOfChunk));
+        if (labelingChunk.getNumberOfStates() == statesPerLabelingChunk) {
+            labelChunk();
+        }
+
+        // Once all states are explored, the minimization yields the bisimulation quotient of the whole model.
+        if (successors.size() % options.bisimulationInterval == 0 || statesToExplore.empty()) {
+            minimize();
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << successors.size() << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+
+    // Renumber the remaining states and build the matrix, the rewards and the labeling over them.
+    collapsedStates.resize(successors.size());
+    storm::storage::BitVector remainingStates = ~collapsedStates;
+    std::vector<StateType> newIndices(successors.size());
+    uint64_t numberOfRemainingStates = 0;
+    uint64_t numberOfEntries = 0;
+    for (auto state : remainingStates) {
+        newIndices[state] = numberOfRemainingStates;
+        ++numberOfRemainingStates;
+        numberOfEntries += successors[state].size();
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(numberOfRemainingStates, numberOfRemainingStates, numberOfEntries, true);
+    for (auto state : remainingStates) {
+        for (auto const& entry : successors[state]) {
+            transitionMatrixBuilder.addNextValue(newIndices[state], newIndices[entry.first], entry.second);
+        }
+        std::vector<std::pair<StateType, ValueType>>().swap(successors[state]);
+
+        auto rewardIt = rewards.begin() + state * rewardsPerState;
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*rewardIt);
+            }
+            ++rewardIt;
+            if (rewardModelBuilder.hasStateActionRewards()) {
+                rewardModelBuilder.addStateActionReward(*rewardIt);
+            }
+            ++rewardIt;
+        }
+    }
+
+    externalStateLabeling = storm::models::sparse::StateLabeling(numberOfRemainingStates);
+    for (auto& labelStatesPair : labelsToStates) {
+        labelStatesPair.second.resize(successors.size());
+        externalStateLabeling->addLabel(labelStatesPair.first, labelStatesPair.second % remainingStates);
+    }
+
+    auto durationSinceStart = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+    STORM_LOG_INFO("Explored " << successors.size() << " states and minimized them to " << numberOfRemainingStates << " states in " << numberOfMinimizations
+                               << " minimizations and " << durationSinceStart << "ms.");
+    return transitionMatrixBuilder.build();
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
@@ -350,7 +1448,6 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     bool deterministicModel = generator->isDeterministicModel();
 
     // Prepare the component builders
-    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
     std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
     for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
         rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -362,71 +1459,145 @@ storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitMode
     stateAndChoiceInformationBuilder.setBuildMarkovianStates(generator->getModelType() == storm::generator::ModelType::MA);
     stateAndChoiceInformationBuilder.setBuildStateValuations(generator->getOptions().isBuildStateValuationsSet());
 
-    buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+    storm::storage::SparseMatrix<ValueType> transitionMatrix;
+    stateStorageReleased = false;
+    exploredExternally = prepareExternalExploration();
+    exploredMinimizing = !exploredExternally && prepareMinimizingExploration();
+    if (exploredExternally) {
+        TemporaryDirectory directory(options.externalExplorationDirectory.get());
+        storm::storage::StreamingSparseMatrixBuilder<ValueType> transitionMatrixBuilder(directory.getFilename("matrix"), !deterministicModel);
+        buildMatricesExternally(transitionMatrixBuilder, directory.getPath(), rewardModelBuilders, stateAndChoiceInformationBuilder);
+        transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+    } else if (exploredMinimizing) {
+        transitionMatrix = buildMatricesMinimizing(rewardModelBuilders);
+    } else {
+        if (options.matrixBlockSize > 0) {
+            storm::storage::ChunkedSparseMatrixBuilder<ValueType> transitionMatrixBuilder(!deterministicModel, options.matrixBlockSize);
+            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+        } else {
+            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
+            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+            transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+        }
+        STORM_LOG_INFO("Memory usage after exploration: " << storm::utility::formatBytes(stateStorage.getSizeInMemory()) << " for storing "
+                                                          << stateStorage.getNumberOfStates() << " states and "
+                                                          << storm::utility::formatBytes(transitionMatrix.getSizeInBytes()) << " for the transition matrix.");
+    }
 
     // Initialize the model components with the obtained information.
-    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(
-        transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(),
-        std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel());
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(std::move(transitionMatrix), storm::models::sparse::StateLabeling(),
+                                                                                         std::unordered_map<std::string, RewardModelType>(),
+                                                                                         !generator->isDiscreteTimeModel());
 
     uint_fast64_t numStates = modelComponents.transitionMatrix.getColumnCount();
     uint_fast64_t numChoices = modelComponents.transitionMatrix.getRowCount();
 
+    // The remaining components are independent of each other, so they are assembled concurrently. All components that
+    // need the generator (or the explored states) are assembled by the same task, as the generator is not thread-safe.
+    std::vector<std::function<void()>> tasks;
+    tasks.push_back([&]() {
+        modelComponents.stateLabeling = buildStateLabeling();
+        if (generator->isPartiallyObservable()) {
+            if (exploredExternally) {
+                modelComponents.observabilityClasses = std::move(externalObservabilityClasses);
+            } else {
+                std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
+                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
+                    uint32_t varObservation = generator->observabilityClass(bitVectorIndexPair.first);
+                    classes[bitVectorIndexPair.second] = varObservation;
+                }
+                modelComponents.observabilityClasses = classes;
+            }
+        }
+        // The explored states are not needed anymore.
+        if (options.releaseStateStorage && !isPartialExploration()) {
+            stateStorage = createStateStorage();
+            stateStorageReleased = true;
+        }
+        if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins()) {
+            auto originData = stateAndChoiceInformationBuilder.buildDataOfChoiceOrigins(numChoices);
+            modelComponents.choiceOrigins = generator->generateChoiceOrigins(originData);
+        }
+        if (generator->isPartiallyObservable() && generator->getOptions().isBuildObservationValuationsSet()) {
+            modelComponents.observationValuations = generator->makeObservationValuation();
+        }
+    });
     // Now finalize all reward models.
-    for (auto& rewardModelBuilder : rewardModelBuilders) {
-        modelComponents.rewardModels.emplace(rewardModelBuilder.getName(),
-                                             rewardModelBuilder.build(numChoices, modelComponents.transitionMatrix.getColumnCount(), numStates));
+    std::vector<boost::optional<RewardModelType>> rewardModels(rewardModelBuilders.size());
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+        tasks.push_back([&, rewardModelIndex]() {
+            rewardModels[rewardModelIndex] = rewardModelBuilders[rewardModelIndex].build(numChoices, numStates, numStates);
+        });
     }
     // Build the player assignment
     if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications()) {
-        modelComponents.statePlayerIndications = stateAndChoiceInformationBuilder.buildStatePlayerIndications(numStates);
         modelComponents.playerNameToIndexMap = generator->getPlayerNameToIndexMap();
+        tasks.push_back([&]() { modelComponents.statePlayerIndications = stateAndChoiceInformationBuilder.buildStatePlayerIndications(numStates); });
     }
     // Build Markovian states
     if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-        modelComponents.markovianStates = stateAndChoiceInformationBuilder.buildMarkovianStates(numStates);
+        tasks.push_back([&]() { modelComponents.markovianStates = stateAndChoiceInformationBuilder.buildMarkovianStates(numStates); });
     }
     // Build the choice labeling
     if (stateAndChoiceInformationBuilder.isBuildChoiceLabels()) {
-        modelComponents.choiceLabeling = stateAndChoiceInformationBuilder.buildChoiceLabeling(numChoices);
+        tasks.push_back([&]() { modelComponents.choiceLabeling = stateAndChoiceInformationBuilder.buildChoiceLabeling(numChoices); });
     }
-    // If requested, build the state valuations and choice origins
+    // If requested, build the state valuations
     if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
-        modelComponents.stateValuations = stateAndChoiceInformationBuilder.stateValuationsBuilder().build(numStates);
+        tasks.push_back([&]() { modelComponents.stateValuations = stateAndChoiceInformationBuilder.stateValuationsBuilder().build(numStates); });
     }
-    if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins()) {
-        auto originData = stateAndChoiceInformationBuilder.buildDataOfChoiceOrigins(numChoices);
-        modelComponents.choiceOrigins = generator->generateChoiceOrigins(originData);
+
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(options.numberOfThreads);
+    if (!supportsConcurrentValueConstruction()) {
+        numberOfThreads = 1;
     }
-    if (generator->isPartiallyObservable()) {
-        std::vector<uint32_t> classes(stateStorage.getNumberOfStates());
-        std::unordered_map<uint32_t, std::vector<std::pair<std::vector<std::string>, uint32_t>>> observationActions;
-        for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-            uint32_t varObservation = generator->observabilityClass(bitVectorIndexPair.first);
-            classes[bitVectorIndexPair.second] = varObservation;
-        }
+    storm::utility::parallel::forEachTaskInDependencyOrder(std::vector<std::vector<uint64_t>>(tasks.size()), std::min<uint64_t>(numberOfThreads, tasks.size()),
+                                                           [&tasks](uint64_t, uint64_t task) { tasks[task](); });
 
-        modelComponents.observabilityClasses = classes;
-        if (generator->getOptions().isBuildObservationValuationsSet()) {
-            modelComponents.observationValuations = generator->makeObservationValuation();
-        }
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+        modelComponents.rewardModels.emplace(rewardModelBuilders[rewardModelIndex].getName(), std::move(rewardModels[rewardModelIndex].get()));
     }
+    storm::models::sparse::shareIdenticalRewards(modelComponents.rewardModels);
     return modelComponents;
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
-    return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    if (externalStateLabeling) {
+        storm::models::sparse::StateLabeling result = std::move(externalStateLabeling.get());
+        externalStateLabeling = boost::none;
+        return result;
+    }
+    storm::models::sparse::StateLabeling result = generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+    if (isPartialExploration()) {
+        STORM_LOG_THROW(!result.containsLabel(getUnexploredLabel()), storm::exceptions::WrongFormatException,
+                        "The label '" << getUnexploredLabel() << "' is reserved for the unexplored states of a partial exploration.");
+        storm::storage::BitVector unexploredStates(result.getNumberOfItems(), unexploredStateIndices.begin(), unexploredStateIndices.end());
+        result.addLabel(getUnexploredLabel(), std::move(unexploredStates));
+    }
+    return result;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+storm::storage::sparse::StateStorage<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::createStateStorage() const {
+    if (options.stateCompression) {
+        return storm::storage::sparse::StateStorage<StateType>(generator->getStateSize(), generator->getVariableInformation().componentBitOffsets);
+    }
+    return storm::storage::sparse::StateStorage<StateType>(generator->getStateSize(), options.fingerprintedStateStorage);
 }
 
 // Explicitly instantiate the class.
 template class ExplicitModelBuilder<double, storm::models::sparse::StandardRewardModel<double>, uint32_t>;
 template class ExplicitStateLookup<uint32_t>;
+template class LazyStateInformation<double, uint32_t>;
 
 #ifdef STORM_HAVE_CARL
 template class ExplicitModelBuilder<RationalNumber, storm::models::sparse::StandardRewardModel<RationalNumber>, uint32_t>;
 template class ExplicitModelBuilder<RationalFunction, storm::models::sparse::StandardRewardModel<RationalFunction>, uint32_t>;
 template class ExplicitModelBuilder<double, storm::models::sparse::StandardRewardModel<storm::Interval>, uint32_t>;
+template class LazyStateInformation<RationalNumber, uint32_t>;
+template class LazyStateInformation<RationalFunction, uint32_t>;
 #endif
 }  // namespace builder
 }  // namespace storm
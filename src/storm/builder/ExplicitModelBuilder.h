@@ -6,7 +6,9 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -33,6 +35,11 @@
 
 namespace storm {
 
+namespace storage {
+template<typename ValueType>
+class StreamingSparseMatrixBuilder;
+}
+
 namespace builder {
 
 using namespace storm::utility::prism;
@@ -46,7 +53,7 @@ class StateAndChoiceInformationBuilder;
 template<typename StateType>
 class ExplicitStateLookup {
    public:
-    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::BitVectorHashMap<StateType> const& stateToId)
+    ExplicitStateLookup(VariableInformation const& varInfo, storm::storage::sparse::StateToIdMap<StateType> const& stateToId)
         : varInfo(varInfo), stateToId(stateToId) {
         // intentionally left empty.
     }
@@ -64,7 +71,48 @@ class ExplicitStateLookup {
 
    private:
     VariableInformation varInfo;
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    storm::storage::sparse::StateToIdMap<StateType> stateToId;
+};
+
+/*!
+ * Provides the valuations and the choice origins of the states of an explicitly built model on demand. Instead of building this information
+ * for all states, only the states are kept in a compact store. The information of a single state is reconstructed when it is queried, where the
+ * choice origins are obtained by expanding the state again. As the generator of the builder is used, queries must not be issued concurrently.
+ */
+template<typename ValueType, typename StateType>
+class LazyStateInformation {
+   public:
+    LazyStateInformation(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                         storm::storage::sparse::StateToIdMap<StateType> const& stateToId);
+
+    /*!
+     * Retrieves the number of states of the model.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves the (compressed) state with the given index.
+     */
+    CompressedState getCompressedState(StateType const& state) const;
+
+    /*!
+     * Retrieves the valuation of the variables in the state with the given index.
+     */
+    storm::expressions::SimpleValuation getStateValuation(StateType const& state) const;
+
+    /*!
+     * Retrieves the origins of the choices of the state with the given index. The choices are indexed locally, i.e., the first choice of the
+     * state has index zero.
+     */
+    std::shared_ptr<storm::storage::sparse::ChoiceOrigins> getChoiceOrigins(StateType const& state) const;
+
+   private:
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+    uint64_t stateSize;
+    // The number of bits reserved for each state. States start at multiples of 64 bits.
+    uint64_t bitsPerState;
+    uint64_t numberOfStates;
+    storm::storage::BitVector states;
 };
 
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -78,6 +126,54 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to expand states (0 means 'auto-detect'). Parallel exploration requires the
+        // exploration order to be breadth-first and the builder to be constructed from a PRISM program or JANI model.
+        // After the exploration, this many threads assemble the components of the model (such as the labeling and
+        // the reward models) concurrently.
+        uint64_t numberOfThreads;
+
+        // If set, the explored states are released as soon as the assembly of the model components no longer needs
+        // them, which lowers the peak memory consumption. The state lookup and the state information can then not be
+        // exported anymore. The states are kept during a partial exploration, as later builds continue from them.
+        bool releaseStateStorage;
+
+        // If set, the states are explored breadth-first with the visited states and the transitions being kept in
+        // (temporary) files in this directory. This is only available for floating point values.
+        boost::optional<std::string> externalExplorationDirectory;
+
+        // The number of bytes that the external exploration uses for detecting duplicate states in memory.
+        uint64_t externalExplorationMemoryLimit;
+
+        // If set, the explored states are stored tree-compressed along the components (modules or automata) of the model.
+        bool stateCompression;
+
+        // If set (and the states are not compressed), the explored states are stored in a hash map that only compares
+        // states whose 1-byte fingerprints match. This speeds up the exploration of models in which most of the found
+        // states were already visited.
+        bool fingerprintedStateStorage;
+
+        // The number of states for which the generator evaluates the guards at once (0 disables the batching). Batching
+        // requires the exploration order to be breadth-first.
+        uint64_t guardBatchSize;
+
+        // If non-zero, the entries of the transition matrix are collected in blocks of this many entries during the
+        // exploration (instead of a vector that is grown geometrically) and copied into the matrix at the end.
+        uint64_t matrixBlockSize;
+
+        // The number of states that are expanded at most (0 means 'unbounded'). If the budget is exhausted (or a state
+        // falls below the probability threshold), the remaining states are kept as unexplored absorbing states that carry
+        // the label returned by getUnexploredLabel(). Partial exploration requires the exploration order to be breadth-first.
+        uint64_t explorationBudget;
+
+        // States whose (estimated) probability of being reached from the initial states is below this threshold are not
+        // expanded. The estimate of a state is the maximal probability of a path leading to it that was seen so far.
+        double explorationProbabilityThreshold;
+
+        // If non-zero, the explored part of a DTMC or CTMC is minimized w.r.t. strong bisimulation whenever this many
+        // states were explored. Only the states that cannot reach an unexplored state are minimized, as the behavior
+        // of the others is not yet known. Minimization requires the exploration order to be breadth-first.
+        uint64_t bisimulationInterval;
     };
 
     /*!
@@ -121,6 +217,40 @@ class ExplicitModelBuilder {
      */
     ExplicitStateLookup<StateType> exportExplicitStateLookup() const;
 
+    /*!
+     * Exports the valuations and the choice origins of the states of the last model that was built such that they can be queried for single states.
+     * In contrast to building the state valuations or the choice origins along with the model, memory is only spent on a compact copy of the states.
+     */
+    LazyStateInformation<ValueType, StateType> exportLazyStateInformation() const;
+
+    /*!
+     * Sets the exploration budget and the probability threshold for the next call to build(). When building again, the
+     * states that were expanded in a previous call are not expanded again, but their behavior is reused, so that only the
+     * previously unexplored states are explored further. The indices of the states remain stable over the calls.
+     *
+     * @param explorationBudget The number of states that are expanded at most (0 means 'unbounded').
+     * @param explorationProbabilityThreshold States whose estimated reachability probability is below this value are not expanded.
+     */
+    void setExplorationBudget(uint64_t explorationBudget, double explorationProbabilityThreshold = 0.0);
+
+    /*!
+     * Retrieves whether the last model that was built contains states that were not explored due to the exploration budget.
+     */
+    bool hasUnexploredStates() const;
+
+    /*!
+     * Retrieves the label of the states that were not explored due to the exploration budget. As these states are made
+     * absorbing, treating them as failing (resp. satisfying) the property yields a lower (resp. upper) bound.
+     */
+    static std::string const& getUnexploredLabel();
+
+    /*!
+     * Retrieves whether values of the value type (and the reward value type) may be created by several threads at once.
+     * If not, the states are explored and the model components are assembled sequentially, regardless of the requested
+     * number of threads.
+     */
+    static bool supportsConcurrentValueConstruction();
+
    private:
     /*!
      * Retrieves the state id of the given state. If the state has not been encountered yet, it will be added to
@@ -133,17 +263,92 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Retrieves whether the states are expanded by multiple threads. If so, this also creates the generators of
+     * the additional worker threads.
+     *
+     * @return True iff the exploration is done in parallel.
+     */
+    bool prepareParallelExploration();
+
+    /*!
+     * Expands the first states that are waiting in the exploration queue in parallel. The successors of each state
+     * are identified by a local index. The list of successors of a state is given in the order in which the
+     * generator requested their indices, so that assigning global indices to them in this order reproduces the
+     * numbering of the sequential exploration.
+     *
+     * @param numberOfStates The number of states (from the front of the queue) to expand.
+     * @param behaviors This vector is filled with the behaviors of the expanded states.
+     * @param successors This vector is filled with the successors of the expanded states.
+     */
+    void expandInParallel(uint64_t numberOfStates, std::vector<storm::generator::StateBehavior<ValueType, StateType>>& behaviors,
+                          std::vector<std::vector<CompressedState>>& successors);
+
+    /*!
+     * Retrieves whether the visited states and the transitions are to be kept on disk during the exploration.
+     */
+    bool prepareExternalExploration() const;
+
+    /*!
+     * Retrieves whether the model is explored only partially, i.e., whether an exploration budget or a probability threshold is set.
+     */
+    bool isPartialExploration() const;
+
+    /*!
+     * Retrieves the behavior of the given state during a partial exploration. The behavior of states that were expanded
+     * in a previous build is reused. States that exceed the exploration budget are not expanded and get an empty behavior.
+     */
+    storm::generator::StateBehavior<ValueType, StateType> expandPartially(StateType const& state,
+                                                                          std::function<StateType(CompressedState const&)> const& stateToIdCallback);
+
+    /*!
+     * Adds the information of the given choice (apart from its transitions) to the builders.
+     */
+    void addChoiceInformation(storm::generator::Choice<ValueType, StateType> const& choice, uint64_t row, uint64_t rowGroup, bool firstChoiceOfState,
+                              std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                              StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
-     * @param transitionMatrixBuilder The builder of the transition matrix.
+     * @param transitionMatrixBuilder The builder of the transition matrix (a SparseMatrixBuilder or a ChunkedSparseMatrixBuilder).
      * @param rewardModelBuilders The builders for the selected reward models.
      * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
      */
-    void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
-                       std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    template<typename MatrixBuilderType>
+    void buildMatrices(MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Builds the matrices like buildMatrices, but explores the state space layer by layer with the visited states and
+     * the transitions kept on disk. As the state storage is not filled, the state labeling (and the observations) are
+     * built during the exploration.
+     *
+     * @param transitionMatrixBuilder The builder of the transition matrix.
+     * @param directory The directory in which the temporary files are placed.
+     * @param rewardModelBuilders The builders for the selected reward models.
+     * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+     */
+    void buildMatricesExternally(storm::storage::StreamingSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::string const& directory,
+                                 std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                                 StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Retrieves whether the explored part of the model is to be minimized w.r.t. bisimulation during the exploration.
+     */
+    bool prepareMinimizingExploration() const;
+
+    /*!
+     * Builds the matrices like buildMatrices, but periodically minimizes the states that were explored so far and
+     * that cannot reach an unexplored state w.r.t. strong bisimulation. Each bisimulation class is collapsed into one
+     * of its states, whose index then replaces the indices of the other states (also when they are found again). As
+     * the resulting states do not correspond to the state storage, the state labeling is built during the exploration.
+     *
+     * @param rewardModelBuilders The builders for the selected reward models.
+     * @return The transition matrix of the minimized model.
+     */
+    storm::storage::SparseMatrix<ValueType> buildMatricesMinimizing(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -158,9 +363,21 @@ class ExplicitModelBuilder {
      */
     storm::models::sparse::StateLabeling buildStateLabeling();
 
+    /*!
+     * Creates an empty state storage as configured by the options.
+     */
+    storm::storage::sparse::StateStorage<StateType> createStateStorage() const;
+
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// A function creating (additional) generators for the given input. Only available if the builder was created
+    /// from a PRISM program or JANI model.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
+    /// The generators used by the worker threads during a parallel exploration. The first one is the generator above.
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators;
+
     /// The options to be used for the building process.
     Options options;
 
@@ -173,6 +390,26 @@ class ExplicitModelBuilder {
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
     boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+
+    /// Whether the state space was explored externally, in which case the state storage only holds the initial and
+    /// deadlock states. The labeling and observations are then built during the exploration (as is the labeling of
+    /// a minimizing exploration).
+    bool exploredExternally;
+    /// Whether the state space was minimized during the exploration, in which case the indices of the state storage
+    /// do not match the states of the model.
+    bool exploredMinimizing;
+    /// Whether the state storage was released after the last model was built (see Options::releaseStateStorage).
+    bool stateStorageReleased;
+    boost::optional<storm::models::sparse::StateLabeling> externalStateLabeling;
+    std::vector<uint32_t> externalObservabilityClasses;
+
+    /// During a partial exploration, the states (in the order of their indices), their estimated reachability
+    /// probabilities and their behaviors (if they were expanded) are kept to continue the exploration in later builds.
+    std::vector<CompressedState> partialExplorationStates;
+    std::vector<double> partialExplorationProbabilities;
+    std::vector<boost::optional<storm::generator::StateBehavior<ValueType, StateType>>> partialExplorationBehaviors;
+    uint64_t numberOfPartiallyExpandedStates;
+    std::vector<StateType> unexploredStateIndices;
 };
 
 }  // namespace builder
@@ -0,0 +1,528 @@
+#include "storm/builder/IncrementalModelBuilder.h"
+
+#include <deque>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/RewardModelBuilder.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace builder {
+
+namespace {
+typedef uint32_t StateType;
+typedef std::map<std::string, std::vector<storm::expressions::Expression>> GuardsByText;
+
+// Retrieves whether the states of both programs are encoded in the same way.
+bool haveSameEncoding(storm::generator::VariableInformation const& first, storm::generator::VariableInformation const& second) {
+    if (first.booleanVariables.size() != second.booleanVariables.size() || first.integerVariables.size() != second.integerVariables.size() ||
+        !first.locationVariables.empty() || !second.locationVariables.empty() || first.getTotalBitOffset(true) != second.getTotalBitOffset(true)) {
+        return false;
+    }
+    for (uint64_t index = 0; index < first.booleanVariables.size(); ++index) {
+        auto const& firstVariable = first.booleanVariables[index];
+        auto const& secondVariable = second.booleanVariables[index];
+        if (firstVariable.getName() != secondVariable.getName() || firstVariable.bitOffset != secondVariable.bitOffset) {
+            return false;
+        }
+    }
+    for (uint64_t index = 0; index < first.integerVariables.size(); ++index) {
+        auto const& firstVariable = first.integerVariables[index];
+        auto const& secondVariable = second.integerVariables[index];
+        if (firstVariable.getName() != secondVariable.getName() || firstVariable.bitOffset != secondVariable.bitOffset ||
+            firstVariable.bitWidth != secondVariable.bitWidth || firstVariable.lowerBound != secondVariable.lowerBound ||
+            firstVariable.upperBound != secondVariable.upperBound) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Retrieves the names of the actions of each module.
+std::map<std::string, std::set<std::string>> getActionsOfModules(storm::prism::Program const& program) {
+    std::map<std::string, std::set<std::string>> result;
+    for (auto const& module : program.getModules()) {
+        auto& actions = result[module.getName()];
+        for (auto const& command : module.getCommands()) {
+            if (command.isLabeled()) {
+                actions.insert(command.getActionName());
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ItemType>
+void addItems(std::string const& prefix, std::vector<ItemType> const& items, storm::expressions::Expression (*getGuard)(ItemType const&),
+              GuardsByText& result) {
+    for (auto const& item : items) {
+        std::stringstream text;
+        text << prefix << item;
+        result[text.str()].push_back(getGuard(item));
+    }
+}
+
+storm::expressions::Expression getCommandGuard(storm::prism::Command const& command) {
+    return command.getGuardExpression();
+}
+
+storm::expressions::Expression getStateRewardGuard(storm::prism::StateReward const& reward) {
+    return reward.getStatePredicateExpression();
+}
+
+storm::expressions::Expression getStateActionRewardGuard(storm::prism::StateActionReward const& reward) {
+    return reward.getStatePredicateExpression();
+}
+
+// Retrieves the guards of the commands and of the items of the given reward models, grouped by the textual representation of the command or item.
+GuardsByText getGuardsByText(storm::prism::Program const& program, std::vector<std::string> const& rewardModelNames) {
+    GuardsByText result;
+    for (auto const& module : program.getModules()) {
+        addItems("module " + module.getName() + ": ", module.getCommands(), &getCommandGuard, result);
+    }
+    for (auto const& name : rewardModelNames) {
+        auto const& rewardModel = program.getRewardModel(name);
+        addItems("rewards " + name + ": ", rewardModel.getStateRewards(), &getStateRewardGuard, result);
+        addItems("rewards " + name + ": ", rewardModel.getStateActionRewards(), &getStateActionRewardGuard, result);
+    }
+    return result;
+}
+
+// Collects the guards of the commands and items of the first program that do not occur (as often) in the second one.
+void collectChangedGuards(GuardsByText const& first, GuardsByText const& second, std::vector<storm::expressions::Expression>& guards) {
+    for (auto const& textGuardsPair : first) {
+        auto it = second.find(textGuardsPair.first);
+        if (it == second.end() || it->second.size() != textGuardsPair.second.size()) {
+            guards.insert(guards.end(), textGuardsPair.second.begin(), textGuardsPair.second.end());
+        }
+    }
+}
+
+std::string getLabelsAsText(storm::prism::Program const& program) {
+    std::stringstream text;
+    for (auto const& label : program.getLabels()) {
+        text << label << "\n";
+    }
+    return text.str();
+}
+
+// Encodes the states of the given valuations. Returns none if a variable of the encoding has no value.
+boost::optional<std::vector<storm::generator::CompressedState>> encodeStates(storm::storage::sparse::StateValuations const& valuations,
+                                                                            storm::generator::VariableInformation const& variableInformation,
+                                                                            uint64_t numberOfStates) {
+    std::vector<storm::generator::CompressedState> result;
+    if (numberOfStates == 0) {
+        return result;
+    }
+    // The variables appear in the same order in the valuations of all states, so we match them by name once.
+    std::map<std::string, storm::generator::BooleanVariableInformation const*> booleanVariables;
+    for (auto const& variable : variableInformation.booleanVariables) {
+        booleanVariables.emplace(variable.getName(), &variable);
+    }
+    std::map<std::string, storm::generator::IntegerVariableInformation const*> integerVariables;
+    for (auto const& variable : variableInformation.integerVariables) {
+        integerVariables.emplace(variable.getName(), &variable);
+    }
+    std::vector<storm::generator::BooleanVariableInformation const*> booleanPositions;
+    std::vector<storm::generator::IntegerVariableInformation const*> integerPositions;
+    uint64_t numberOfMatchedVariables = 0;
+    for (auto valueIt = valuations.at(0).begin(); valueIt != valuations.at(0).end(); ++valueIt) {
+        booleanPositions.push_back(nullptr);
+        integerPositions.push_back(nullptr);
+        if (!valueIt.isVariableAssignment()) {
+            continue;
+        }
+        if (valueIt.isBoolean() && booleanVariables.count(valueIt.getName()) > 0) {
+            booleanPositions.back() = booleanVariables.at(valueIt.getName());
+            ++numberOfMatchedVariables;
+        } else if (valueIt.isInteger() && integerVariables.count(valueIt.getName()) > 0) {
+            integerPositions.back() = integerVariables.at(valueIt.getName());
+            ++numberOfMatchedVariables;
+        }
+    }
+    if (numberOfMatchedVariables != booleanVariables.size() + integerVariables.size()) {
+        return boost::none;
+    }
+
+    result.reserve(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        storm::generator::CompressedState compressedState(variableInformation.getTotalBitOffset(true));
+        uint64_t position = 0;
+        for (auto valueIt = valuations.at(state).begin(); valueIt != valuations.at(state).end(); ++valueIt, ++position) {
+            if (booleanPositions[position]) {
+                compressedState.set(booleanPositions[position]->bitOffset, valueIt.getBooleanValue());
+            } else if (integerPositions[position]) {
+                auto const& variable = *integerPositions[position];
+                int64_t value = valueIt.getIntegerValue();
+                if (value < variable.lowerBound || value > variable.upperBound) {
+                    return boost::none;
+                }
+                compressedState.setFromInt(variable.bitOffset, variable.bitWidth, value - variable.lowerBound);
+            }
+        }
+        result.push_back(std::move(compressedState));
+    }
+    return result;
+}
+
+storm::models::ModelType getModelType(storm::generator::ModelType const& modelType) {
+    switch (modelType) {
+        case storm::generator::ModelType::DTMC:
+            return storm::models::ModelType::Dtmc;
+        case storm::generator::ModelType::CTMC:
+            return storm::models::ModelType::Ctmc;
+        case storm::generator::ModelType::MDP:
+            return storm::models::ModelType::Mdp;
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Incremental builds are only supported for DTMCs, CTMCs and MDPs.");
+    }
+}
+}  // namespace
+
+template<typename ValueType>
+IncrementalModelBuilder<ValueType>::IncrementalModelBuilder(storm::builder::BuilderOptions const& options)
+    : options(options), lastBuildIncremental(false), numberOfExpandedStates(0) {
+    // The state valuations identify the states of the previous build.
+    this->options.setBuildStateValuations(true);
+    incrementalOptions = !options.isBuildChoiceLabelsSet() && !options.isBuildChoiceOriginsSet() && !options.isBuildObservationValuationsSet() &&
+                         !options.isAddOutOfBoundsStateSet() && !options.isSymmetryReductionSet() && !options.isPartialOrderReductionSet() &&
+                         !options.isVariableRangeAnalysisSet();
+    STORM_LOG_WARN_COND(incrementalOptions,
+                        "Models are built from scratch as incremental builds do not support choice labels, choice origins, observation valuations, "
+                        "out-of-bounds states, symmetry reduction, partial order reduction and variable range analysis.");
+}
+
+template<typename ValueType>
+void IncrementalModelBuilder<ValueType>::setPreviousBuild(storm::prism::Program const& program,
+                                                          std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+    STORM_LOG_THROW(model->hasStateValuations(), storm::exceptions::WrongFormatException, "The previous model needs to have state valuations.");
+    previousProgram = program.substituteConstantsFormulas();
+    previousModel = model;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalModelBuilder<ValueType>::build(storm::prism::Program const& program) {
+    storm::prism::Program substitutedProgram = program.substituteConstantsFormulas();
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> result;
+    if (incrementalOptions && previousModel) {
+        result = buildIncrementally(program, substitutedProgram);
+    }
+    lastBuildIncremental = result != nullptr;
+    if (!result) {
+        result = buildFromScratch(program);
+    }
+    previousProgram = std::move(substitutedProgram);
+    previousModel = result;
+    return result;
+}
+
+template<typename ValueType>
+bool IncrementalModelBuilder<ValueType>::wasLastBuildIncremental() const {
+    return lastBuildIncremental;
+}
+
+template<typename ValueType>
+uint64_t IncrementalModelBuilder<ValueType>::getNumberOfExpandedStates() const {
+    return numberOfExpandedStates;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalModelBuilder<ValueType>::buildFromScratch(storm::prism::Program const& program) {
+    auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, options);
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> result = storm::builder::ExplicitModelBuilder<ValueType>(generator).build();
+    numberOfExpandedStates = result->getNumberOfStates();
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> IncrementalModelBuilder<ValueType>::buildIncrementally(
+    storm::prism::Program const& program, storm::prism::Program const& substitutedProgram) {
+    auto generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, options);
+    auto const& variableInformation = generator->getVariableInformation();
+    storm::generator::VariableInformation previousVariableInformation(previousProgram.get(), options.getReservedBitsForUnboundedVariables());
+
+    // Check whether the previous build can be reused.
+    auto generatorModelType = generator->getModelType();
+    if (generatorModelType != storm::generator::ModelType::DTMC && generatorModelType != storm::generator::ModelType::CTMC &&
+        generatorModelType != storm::generator::ModelType::MDP) {
+        STORM_LOG_INFO("Building the model from scratch as incremental builds are only supported for DTMCs, CTMCs and MDPs.");
+        return nullptr;
+    }
+    if (getModelType(generatorModelType) != previousModel->getType() || !haveSameEncoding(variableInformation, previousVariableInformation)) {
+        STORM_LOG_INFO("Building the model from scratch as the model type or the variables changed.");
+        return nullptr;
+    }
+    if (getActionsOfModules(substitutedProgram) != getActionsOfModules(previousProgram.get())) {
+        STORM_LOG_INFO("Building the model from scratch as the modules synchronize on different actions.");
+        return nullptr;
+    }
+    if (options.hasTerminalStates() && getLabelsAsText(substitutedProgram) != getLabelsAsText(previousProgram.get())) {
+        STORM_LOG_INFO("Building the model from scratch as the labels (which may determine terminal states) changed.");
+        return nullptr;
+    }
+    std::vector<RewardModelBuilder<ValueType>> rewardModelBuilders;
+    std::vector<std::string> rewardModelNames;
+    for (uint64_t index = 0; index < generator->getNumberOfRewardModels(); ++index) {
+        rewardModelBuilders.emplace_back(generator->getRewardModelInformation(index));
+        auto const& builder = rewardModelBuilders.back();
+        if (!previousProgram->hasRewardModel(builder.getName()) || !previousModel->hasRewardModel(builder.getName()) ||
+            previousModel->getRewardModel(builder.getName()).hasStateRewards() != builder.hasStateRewards() ||
+            previousModel->getRewardModel(builder.getName()).hasStateActionRewards() != builder.hasStateActionRewards()) {
+            STORM_LOG_INFO("Building the model from scratch as the reward models changed.");
+            return nullptr;
+        }
+        rewardModelNames.push_back(builder.getName());
+    }
+    uint64_t const numberOfPreviousStates = previousModel->getNumberOfStates();
+    auto previousStates = encodeStates(previousModel->getStateValuations(), variableInformation, numberOfPreviousStates);
+    if (!previousStates) {
+        STORM_LOG_INFO("Building the model from scratch as the state valuations of the previous model do not match the variables.");
+        return nullptr;
+    }
+
+    // Determine the commands and reward items that changed. A state needs to be expanded again iff one of them is enabled before or after the change.
+    GuardsByText previousGuards = getGuardsByText(previousProgram.get(), rewardModelNames);
+    GuardsByText currentGuards = getGuardsByText(substitutedProgram, rewardModelNames);
+    std::vector<storm::expressions::Expression> changedPreviousGuards;
+    std::vector<storm::expressions::Expression> changedCurrentGuards;
+    collectChangedGuards(previousGuards, currentGuards, changedPreviousGuards);
+    collectChangedGuards(currentGuards, previousGuards, changedCurrentGuards);
+
+    // Store the previous states, such that they keep their indices.
+    std::vector<storm::generator::CompressedState> states = std::move(previousStates.get());
+    storm::storage::sparse::StateStorage<StateType> stateStorage(generator->getStateSize());
+    for (StateType state = 0; state < states.size(); ++state) {
+        if (stateStorage.stateToId.findOrAdd(states[state], state) != state) {
+            STORM_LOG_INFO("Building the model from scratch as the previous model has states with the same valuation.");
+            return nullptr;
+        }
+    }
+
+    std::deque<StateType> statesToExpand;
+    if (!changedPreviousGuards.empty() || !changedCurrentGuards.empty()) {
+        boost::optional<storm::expressions::Expression> previousTrigger;
+        boost::optional<storm::expressions::Expression> currentTrigger;
+        storm::expressions::ExpressionEvaluator<ValueType> previousEvaluator(previousProgram->getManager());
+        storm::expressions::ExpressionEvaluator<ValueType> currentEvaluator(substitutedProgram.getManager());
+        if (!changedPreviousGuards.empty()) {
+            previousTrigger = storm::expressions::disjunction(changedPreviousGuards);
+        }
+        if (!changedCurrentGuards.empty()) {
+            currentTrigger = storm::expressions::disjunction(changedCurrentGuards);
+        }
+        for (StateType state = 0; state < states.size(); ++state) {
+            bool affected = false;
+            if (previousTrigger) {
+                storm::generator::unpackStateIntoEvaluator(states[state], previousVariableInformation, previousEvaluator);
+                affected = previousEvaluator.asBool(previousTrigger.get());
+            }
+            if (!affected && currentTrigger) {
+                storm::generator::unpackStateIntoEvaluator(states[state], variableInformation, currentEvaluator);
+                affected = currentEvaluator.asBool(currentTrigger.get());
+            }
+            if (affected) {
+                statesToExpand.push_back(state);
+            }
+        }
+    }
+    STORM_LOG_INFO("Incremental build: " << changedPreviousGuards.size() << " removed and " << changedCurrentGuards.size()
+                                         << " added commands or reward items affect " << statesToExpand.size() << " of " << states.size() << " states.");
+
+    // Expand the affected states and the states that are discovered from them.
+    auto stateToIdCallback = [&](storm::generator::CompressedState const& state) -> StateType {
+        StateType newIndex = static_cast<StateType>(states.size());
+        StateType actualIndex = stateStorage.stateToId.findOrAdd(state, newIndex);
+        if (actualIndex == newIndex) {
+            states.push_back(state);
+            statesToExpand.push_back(newIndex);
+        }
+        return actualIndex;
+    };
+    stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+
+    bool const fixDeadlocks = !storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    std::unordered_map<StateType, storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+    while (!statesToExpand.empty()) {
+        StateType state = statesToExpand.front();
+        statesToExpand.pop_front();
+        generator->load(states[state]);
+        storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+        STORM_LOG_THROW(!behavior.empty() || fixDeadlocks || !behavior.wasExpanded(), storm::exceptions::WrongFormatException,
+                        "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                            << generator->stateToString(states[state]) << "). For fixing these, please provide the appropriate option.");
+        behaviors[state] = std::move(behavior);
+    }
+    numberOfExpandedStates = behaviors.size();
+
+    // Remove the states that are no longer reachable.
+    storm::storage::SparseMatrix<ValueType> const& previousMatrix = previousModel->getTransitionMatrix();
+    std::vector<uint64_t> const& previousRowGroupIndices = previousMatrix.getRowGroupIndices();
+    storm::storage::BitVector reachableStates(states.size());
+    std::vector<StateType> stack;
+    for (auto const& initialState : stateStorage.initialStateIndices) {
+        if (!reachableStates.get(initialState)) {
+            reachableStates.set(initialState);
+            stack.push_back(initialState);
+        }
+    }
+    auto visit = [&reachableStates, &stack](StateType successor) {
+        if (!reachableStates.get(successor)) {
+            reachableStates.set(successor);
+            stack.push_back(successor);
+        }
+    };
+    while (!stack.empty()) {
+        StateType state = stack.back();
+        stack.pop_back();
+        auto behaviorIt = behaviors.find(state);
+        if (behaviorIt != behaviors.end()) {
+            for (auto const& choice : behaviorIt->second) {
+                for (auto const& stateProbabilityPair : choice) {
+                    visit(stateProbabilityPair.first);
+                }
+            }
+        } else {
+            for (uint64_t row = previousRowGroupIndices[state]; row < previousRowGroupIndices[state + 1]; ++row) {
+                for (auto const& entry : previousMatrix.getRow(row)) {
+                    visit(entry.getColumn());
+                }
+            }
+        }
+    }
+    std::vector<StateType> newIndices(states.size());
+    StateType numberOfStates = 0;
+    for (auto state : reachableStates) {
+        newIndices[state] = numberOfStates++;
+    }
+
+    // Assemble the model. As the new indices preserve the order of the states, the columns of the rows remain sorted.
+    bool const deterministicModel = generator->isDeterministicModel();
+    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, numberOfStates, 0, false, !deterministicModel, 0);
+    storm::storage::BitVector previousDeadlockStates = previousModel->getStateLabeling().containsLabel("deadlock")
+                                                           ? previousModel->getStateLabeling().getStates("deadlock")
+                                                           : storm::storage::BitVector(numberOfPreviousStates);
+    std::vector<StateType> deadlockStateIndices;
+    uint64_t currentRow = 0;
+    for (auto state : reachableStates) {
+        StateType newIndex = newIndices[state];
+        if (!deterministicModel) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+        auto behaviorIt = behaviors.find(state);
+        if (behaviorIt == behaviors.end()) {
+            // Copy the rows and rewards of the previous model.
+            if (previousDeadlockStates.get(state)) {
+                deadlockStateIndices.push_back(newIndex);
+            }
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(previousModel->getRewardModel(rewardModelBuilder.getName()).getStateRewardVector()[state]);
+                }
+            }
+            for (uint64_t row = previousRowGroupIndices[state]; row < previousRowGroupIndices[state + 1]; ++row, ++currentRow) {
+                for (auto const& entry : previousMatrix.getRow(row)) {
+                    transitionMatrixBuilder.addNextValue(currentRow, newIndices[entry.getColumn()], entry.getValue());
+                }
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateActionRewards()) {
+                        rewardModelBuilder.addStateActionReward(previousModel->getRewardModel(rewardModelBuilder.getName()).getStateActionRewardVector()[row]);
+                    }
+                }
+            }
+        } else if (behaviorIt->second.empty()) {
+            // As in the explicit model builder, states without behavior get a self-loop.
+            if (behaviorIt->second.wasExpanded()) {
+                deadlockStateIndices.push_back(newIndex);
+            }
+            transitionMatrixBuilder.addNextValue(currentRow, newIndex, storm::utility::one<ValueType>());
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+            ++currentRow;
+        } else {
+            auto stateRewardIt = behaviorIt->second.getStateRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(*stateRewardIt);
+                }
+                ++stateRewardIt;
+            }
+            for (auto const& choice : behaviorIt->second) {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, newIndices[stateProbabilityPair.first], stateProbabilityPair.second);
+                }
+                auto choiceRewardIt = choice.getRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateActionRewards()) {
+                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                    }
+                    ++choiceRewardIt;
+                }
+                ++currentRow;
+            }
+        }
+    }
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = transitionMatrixBuilder.build(0, numberOfStates);
+
+    // Label all states and compute their valuations.
+    storm::storage::sparse::StateStorage<StateType> reachableStateStorage(generator->getStateSize());
+    storm::storage::sparse::StateValuationsBuilder stateValuationsBuilder = generator->initializeStateValuationsBuilder();
+    for (auto state : reachableStates) {
+        reachableStateStorage.stateToId.findOrAdd(states[state], newIndices[state]);
+        generator->load(states[state]);
+        generator->addStateValuation(newIndices[state], stateValuationsBuilder);
+    }
+    for (auto const& initialState : stateStorage.initialStateIndices) {
+        reachableStateStorage.initialStateIndices.push_back(newIndices[initialState]);
+    }
+    reachableStateStorage.deadlockStateIndices = std::move(deadlockStateIndices);
+    storm::models::sparse::StateLabeling stateLabeling =
+        generator->label(reachableStateStorage, reachableStateStorage.initialStateIndices, reachableStateStorage.deadlockStateIndices);
+
+    storm::storage::sparse::ModelComponents<ValueType> modelComponents(std::move(transitionMatrix), std::move(stateLabeling),
+                                                                       std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>(),
+                                                                       !generator->isDiscreteTimeModel());
+    uint64_t numberOfChoices = modelComponents.transitionMatrix.getRowCount();
+    for (auto& rewardModelBuilder : rewardModelBuilders) {
+        modelComponents.rewardModels.emplace(rewardModelBuilder.getName(), rewardModelBuilder.build(numberOfChoices, numberOfStates, numberOfStates));
+    }
+    storm::models::sparse::shareIdenticalRewards(modelComponents.rewardModels);
+    modelComponents.stateValuations = stateValuationsBuilder.build(numberOfStates);
+
+    STORM_LOG_INFO("Incremental build: expanded " << numberOfExpandedStates << " states, removed " << (states.size() - numberOfStates)
+                                                  << " unreachable states.");
+    return storm::utility::builder::buildModelFromComponents(getModelType(generatorModelType), std::move(modelComponents));
+}
+
+template class IncrementalModelBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+template class IncrementalModelBuilder<storm::RationalNumber>;
+#endif
+}  // namespace builder
+}  // namespace storm
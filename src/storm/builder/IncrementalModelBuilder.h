@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <boost/optional.hpp>
+
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds sparse models of PRISM programs incrementally, e.g. while a program is developed. The builder remembers the previously built program and
+ * model. If the program is changed, the commands (and reward items) of both programs are compared after substituting constants and formulas, so
+ * changing a constant changes exactly the commands that use it. Only the states in which a changed command or reward item is enabled before or
+ * after the change are expanded again (together with the states that are discovered from them). The rows of all other states are copied from the
+ * previous model and the labels are evaluated for all states again.
+ *
+ * The previous model is only reused if the states are encoded in the same way (i.e. the variables and their ranges did not change), the modules
+ * synchronize on the same actions and the model is a DTMC, CTMC or MDP. Otherwise, the model is built from scratch.
+ *
+ * States that are no longer reachable are removed. The remaining states keep their relative order and new states are appended, so the order of the
+ * states generally differs from the one of a model that is built from scratch. The models always contain state valuations, which identify the
+ * states of the previous model in the next build.
+ */
+template<typename ValueType>
+class IncrementalModelBuilder {
+   public:
+    /*!
+     * Creates a builder without a previous build.
+     *
+     * @param options The options used to build each model. Options that change the exploration (e.g. symmetry reduction) or the information that
+     * is attached to the choices (e.g. choice labels) are not supported incrementally, in which case each model is built from scratch.
+     */
+    IncrementalModelBuilder(storm::builder::BuilderOptions const& options);
+
+    /*!
+     * Sets the build on which the next build is based, e.g. a model that was loaded from a cache.
+     *
+     * @param program The program (with all constants defined).
+     * @param model The model that was built for the program with the same options. It needs to have state valuations.
+     */
+    void setPreviousBuild(storm::prism::Program const& program, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model);
+
+    /*!
+     * Builds the model of the given program, incrementally if possible. The program and the model then become the previous build.
+     *
+     * @param program The program (with all constants defined).
+     * @return The model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build(storm::prism::Program const& program);
+
+    /*!
+     * Retrieves whether the last model was obtained from the previous build.
+     */
+    bool wasLastBuildIncremental() const;
+
+    /*!
+     * Retrieves the number of states that were expanded during the last build.
+     */
+    uint64_t getNumberOfExpandedStates() const;
+
+   private:
+    // Builds the model from scratch.
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> buildFromScratch(storm::prism::Program const& program);
+
+    // Builds the model from the previous build. Returns null if the previous build can not be reused.
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> buildIncrementally(storm::prism::Program const& program,
+                                                                               storm::prism::Program const& substitutedProgram);
+
+    storm::builder::BuilderOptions options;
+    bool incrementalOptions;
+
+    // The previous program (with constants and formulas substituted) and its model.
+    boost::optional<storm::prism::Program> previousProgram;
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> previousModel;
+
+    bool lastBuildIncremental;
+    uint64_t numberOfExpandedStates;
+};
+
+}  // namespace builder
+}  // namespace storm
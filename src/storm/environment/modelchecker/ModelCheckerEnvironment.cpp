@@ -16,6 +16,9 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    if (mcSettings.isHybridSccSet()) {
+        hybridSccBlockSize = mcSettings.getHybridSccBlockSize();
+    }
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +49,28 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isHybridSccSet() const {
+    return hybridSccBlockSize.is_initialized();
+}
+
+uint64_t ModelCheckerEnvironment::getHybridSccBlockSize() const {
+    return hybridSccBlockSize.get();
+}
+
+void ModelCheckerEnvironment::setHybridSccBlockSize(uint64_t value) {
+    hybridSccBlockSize = value;
+}
+
+void ModelCheckerEnvironment::unsetHybridScc() {
+    hybridSccBlockSize = boost::none;
+}
+
+std::shared_ptr<storm::modelchecker::StateFormulaResultCache> const& ModelCheckerEnvironment::getStateFormulaResultCache() const {
+    return stateFormulaResultCache;
+}
+
+void ModelCheckerEnvironment::setStateFormulaResultCache(std::shared_ptr<storm::modelchecker::StateFormulaResultCache> const& value) {
+    stateFormulaResultCache = value;
+}
+
 }  // namespace storm
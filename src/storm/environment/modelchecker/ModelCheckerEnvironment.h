@@ -12,6 +12,10 @@ namespace storm {
 // Forward declare subenvironments
 class MultiObjectiveModelCheckerEnvironment;
 
+namespace modelchecker {
+class StateFormulaResultCache;
+}
+
 class ModelCheckerEnvironment {
    public:
     ModelCheckerEnvironment();
@@ -25,8 +29,24 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    /*!
+     * Retrieves whether the hybrid engine extracts and solves equation systems block-wise along the SCCs of the maybe-states.
+     */
+    bool isHybridSccSet() const;
+    uint64_t getHybridSccBlockSize() const;
+    void setHybridSccBlockSize(uint64_t value);
+    void unsetHybridScc();
+
+    /*!
+     * The cache in which the sparse model checkers store the results of state formulas (if any). Copies of the environment share the cache.
+     */
+    std::shared_ptr<storm::modelchecker::StateFormulaResultCache> const& getStateFormulaResultCache() const;
+    void setStateFormulaResultCache(std::shared_ptr<storm::modelchecker::StateFormulaResultCache> const& value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    boost::optional<uint64_t> hybridSccBlockSize;
+    std::shared_ptr<storm::modelchecker::StateFormulaResultCache> stateFormulaResultCache;
 };
 }  // namespace storm
@@ -1,6 +1,7 @@
 #include "storm/environment/solver/GameSolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GameSolverSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -23,6 +24,7 @@ GameSolverEnvironment::GameSolverEnvironment() {
     STORM_LOG_ASSERT(considerRelativeTerminationCriterion ||
                          gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute,
                      "Unknown convergence criterion");
+    numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
 }
 
 GameSolverEnvironment::~GameSolverEnvironment() {
@@ -66,4 +68,12 @@ void GameSolverEnvironment::setRelativeTerminationCriterion(bool value) {
     considerRelativeTerminationCriterion = value;
 }
 
+uint64_t const& GameSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void GameSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
 }  // namespace storm
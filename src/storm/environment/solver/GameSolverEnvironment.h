@@ -25,11 +25,19 @@ class GameSolverEnvironment {
     storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
 
+    /*!
+     * The number of threads used to reduce over the choices of player 1 in each iteration. If this is not one, the
+     * player 1 states are reduced in parallel (the multiplier decides on its own how to reduce over player 2).
+     */
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     storm::solver::GameMethod gameMethod;
     bool methodSetFromDefault;
     uint64_t maxIterationCount;
     storm::RationalNumber precision;
     bool considerRelativeTerminationCriterion;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
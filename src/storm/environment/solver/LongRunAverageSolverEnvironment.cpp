@@ -19,6 +19,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    numberOfThreads = lraSettings.getNumberOfThreads();
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +92,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+uint64_t const& LongRunAverageSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void LongRunAverageSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
 }  // namespace storm
@@ -31,6 +31,9 @@ class LongRunAverageSolverEnvironment {
     storm::RationalNumber const& getAperiodicFactor() const;
     void setAperiodicFactor(storm::RationalNumber value);
 
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     storm::solver::LraMethod detMethod;
     bool detMethodSetFromDefault;
@@ -43,5 +46,7 @@ class LongRunAverageSolverEnvironment {
     boost::optional<uint64_t> maxIters;
 
     storm::RationalNumber aperiodicFactor;
+
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
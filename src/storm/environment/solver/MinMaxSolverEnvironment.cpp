@@ -25,6 +25,9 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    mixedPrecision = minMaxSettings.isMixedPrecisionSet();
+    portfolioRace = minMaxSettings.isPortfolioRaceSet();
+    policyEvaluationSweeps = minMaxSettings.getPolicyEvaluationSweeps();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +87,28 @@ void MinMaxSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool MinMaxSolverEnvironment::isMixedPrecisionSet() const {
+    return mixedPrecision;
+}
+
+void MinMaxSolverEnvironment::setMixedPrecision(bool value) {
+    mixedPrecision = value;
+}
+
+bool MinMaxSolverEnvironment::isPortfolioRaceSet() const {
+    return portfolioRace;
+}
+
+void MinMaxSolverEnvironment::setPortfolioRace(bool value) {
+    portfolioRace = value;
+}
+
+uint64_t const& MinMaxSolverEnvironment::getPolicyEvaluationSweeps() const {
+    return policyEvaluationSweeps;
+}
+
+void MinMaxSolverEnvironment::setPolicyEvaluationSweeps(uint64_t value) {
+    policyEvaluationSweeps = value;
+}
+
 }  // namespace storm
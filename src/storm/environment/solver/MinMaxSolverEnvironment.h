@@ -26,6 +26,12 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    bool isMixedPrecisionSet() const;
+    void setMixedPrecision(bool value);
+    bool isPortfolioRaceSet() const;
+    void setPortfolioRace(bool value);
+    uint64_t const& getPolicyEvaluationSweeps() const;
+    void setPolicyEvaluationSweeps(uint64_t value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +41,8 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool symmetricUpdates;
+    bool mixedPrecision;
+    bool portfolioRace;
+    uint64_t policyEvaluationSweeps;
 };
 }  // namespace storm
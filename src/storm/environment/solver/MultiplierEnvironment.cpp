@@ -5,12 +5,17 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/IllegalArgumentValueException.h"
+
 namespace storm {
 
 MultiplierEnvironment::MultiplierEnvironment() {
     auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
     type = multiplierSettings.getMultiplierType();
     typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+    gaussSeidelThreads = multiplierSettings.getNumberOfGaussSeidelThreads();
+    gaussSeidelBlockSize = multiplierSettings.getGaussSeidelBlockSize();
+    temporalBlockingWindow = multiplierSettings.getTemporalBlockingWindow();
 }
 
 MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +35,29 @@ void MultiplierEnvironment::setType(storm::solver::MultiplierType value, bool is
     typeSetFromDefault = isSetFromDefault;
 }
 
+uint64_t const& MultiplierEnvironment::getNumberOfGaussSeidelThreads() const {
+    return gaussSeidelThreads;
+}
+
+void MultiplierEnvironment::setNumberOfGaussSeidelThreads(uint64_t value) {
+    gaussSeidelThreads = value;
+}
+
+uint64_t const& MultiplierEnvironment::getGaussSeidelBlockSize() const {
+    return gaussSeidelBlockSize;
+}
+
+void MultiplierEnvironment::setGaussSeidelBlockSize(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentValueException, "The block size must be positive.");
+    gaussSeidelBlockSize = value;
+}
+
+uint64_t const& MultiplierEnvironment::getTemporalBlockingWindow() const {
+    return temporalBlockingWindow;
+}
+
+void MultiplierEnvironment::setTemporalBlockingWindow(uint64_t value) {
+    temporalBlockingWindow = value;
+}
+
 }  // namespace storm
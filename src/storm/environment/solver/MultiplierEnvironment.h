@@ -14,8 +14,32 @@ class MultiplierEnvironment {
     bool const& isTypeSetFromDefault() const;
     void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
 
+    /*!
+     * The number of threads used for Gauss-Seidel style multiplications. If this is not one, the rows are split into
+     * blocks that are processed in parallel, where Gauss-Seidel updates are only made within a block
+     * (and values of other blocks are taken from the previous sweep). Zero means 'auto-detect'.
+     */
+    uint64_t const& getNumberOfGaussSeidelThreads() const;
+    void setNumberOfGaussSeidelThreads(uint64_t value);
+
+    /*!
+     * The number of rows (or row groups) per block of a parallel Gauss-Seidel style multiplication.
+     */
+    uint64_t const& getGaussSeidelBlockSize() const;
+    void setGaussSeidelBlockSize(uint64_t value);
+
+    /*!
+     * The number of matrix entries that repeated multiplications keep in cache while they advance several steps on one part of the matrix
+     * (temporal blocking). Zero disables temporal blocking.
+     */
+    uint64_t const& getTemporalBlockingWindow() const;
+    void setTemporalBlockingWindow(uint64_t value);
+
    private:
     storm::solver::MultiplierType type;
     bool typeSetFromDefault;
+    uint64_t gaussSeidelThreads;
+    uint64_t gaussSeidelBlockSize;
+    uint64_t temporalBlockingWindow;
 };
 }  // namespace storm
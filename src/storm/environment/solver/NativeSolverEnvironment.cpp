@@ -25,6 +25,7 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
                      "Unknown convergence criterion");
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
+    gaussSeidelOrdering = nativeSettings.getGaussSeidelOrdering();
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
 }
 
@@ -85,6 +86,14 @@ void NativeSolverEnvironment::setSorOmega(storm::RationalNumber const& value) {
     sorOmega = value;
 }
 
+storm::solver::GaussSeidelOrdering const& NativeSolverEnvironment::getGaussSeidelOrdering() const {
+    return gaussSeidelOrdering;
+}
+
+void NativeSolverEnvironment::setGaussSeidelOrdering(storm::solver::GaussSeidelOrdering value) {
+    gaussSeidelOrdering = value;
+}
+
 bool NativeSolverEnvironment::isSymmetricUpdatesSet() const {
     return symmetricUpdates;
 }
@@ -26,6 +26,8 @@ class NativeSolverEnvironment {
     void setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle value);
     storm::RationalNumber const& getSorOmega() const;
     void setSorOmega(storm::RationalNumber const& value);
+    storm::solver::GaussSeidelOrdering const& getGaussSeidelOrdering() const;
+    void setGaussSeidelOrdering(storm::solver::GaussSeidelOrdering value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
 
@@ -37,6 +39,7 @@ class NativeSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
+    storm::solver::GaussSeidelOrdering gaussSeidelOrdering;
     bool symmetricUpdates;
 };
 }  // namespace storm
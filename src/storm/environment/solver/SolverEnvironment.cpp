@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -16,8 +17,14 @@ SolverEnvironment::SolverEnvironment() {
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     forceSoundness = generalSettings.isSoundSet();
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
-    linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
-    linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    exactFloatFirst = generalSettings.isExactFloatFirstSet();
+    auto const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
+    linearEquationSolverType = coreSettings.getEquationSolver();
+    linearEquationSolverTypeSetFromDefault = coreSettings.isEquationSolverSetFromDefaultValue();
+    if (coreSettings.isDdTerminalRoundingSet()) {
+        ddTerminalRoundingGrid = storm::utility::convertNumber<storm::RationalNumber>(coreSettings.getDdTerminalRoundingGrid());
+    }
+    ddTerminalRoundingMode = coreSettings.getDdTerminalRoundingMode();
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -120,6 +127,59 @@ void SolverEnvironment::setForceExact(bool value) {
     SolverEnvironment::forceExact = value;
 }
 
+bool SolverEnvironment::isExactFloatFirst() const {
+    return exactFloatFirst;
+}
+
+void SolverEnvironment::setExactFloatFirst(bool value) {
+    SolverEnvironment::exactFloatFirst = value;
+}
+
+boost::optional<storm::RationalNumber> const& SolverEnvironment::getDdTerminalRoundingGrid() const {
+    return ddTerminalRoundingGrid;
+}
+
+storm::solver::DdTerminalRounding const& SolverEnvironment::getDdTerminalRoundingMode() const {
+    return ddTerminalRoundingMode;
+}
+
+void SolverEnvironment::setDdTerminalRounding(boost::optional<storm::RationalNumber> const& grid, storm::solver::DdTerminalRounding const& mode) {
+    ddTerminalRoundingGrid = grid;
+    ddTerminalRoundingMode = mode;
+}
+
+std::shared_ptr<storm::solver::SolverTelemetry> const& SolverEnvironment::getTelemetry() const {
+    return telemetry;
+}
+
+void SolverEnvironment::setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& value) {
+    telemetry = value;
+}
+
+std::shared_ptr<storm::solver::AnytimeBounds> const& SolverEnvironment::getAnytimeBounds() const {
+    return anytimeBounds;
+}
+
+void SolverEnvironment::setAnytimeBounds(std::shared_ptr<storm::solver::AnytimeBounds> const& value) {
+    anytimeBounds = value;
+}
+
+std::shared_ptr<storm::solver::SolverWorkspace> const& SolverEnvironment::getWorkspace() const {
+    return workspace;
+}
+
+void SolverEnvironment::setWorkspace(std::shared_ptr<storm::solver::SolverWorkspace> const& value) {
+    workspace = value;
+}
+
+std::shared_ptr<storm::solver::SolverCheckpoints> const& SolverEnvironment::getCheckpoints() const {
+    return checkpoints;
+}
+
+void SolverEnvironment::setCheckpoints(std::shared_ptr<storm::solver::SolverCheckpoints> const& value) {
+    checkpoints = value;
+}
+
 storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
     return linearEquationSolverType;
 }
@@ -22,6 +22,13 @@ class GameSolverEnvironment;
 class TopologicalSolverEnvironment;
 class OviSolverEnvironment;
 
+namespace solver {
+class SolverTelemetry;
+class AnytimeBounds;
+class SolverWorkspace;
+class SolverCheckpoints;
+}
+
 class SolverEnvironment {
    public:
     SolverEnvironment();
@@ -53,6 +60,20 @@ class SolverEnvironment {
     bool isForceExact() const;
     void setForceExact(bool value);
 
+    /*!
+     * Whether exact computations first solve in floating point arithmetic and only verify (and, if necessary, repair) the result exactly.
+     */
+    bool isExactFloatFirst() const;
+    void setExactFloatFirst(bool value);
+
+    /*!
+     * If set, the symbolic iterative solvers round the values of their ADDs to multiples of the given grid distance after each iteration.
+     */
+    boost::optional<storm::RationalNumber> const& getDdTerminalRoundingGrid() const;
+    storm::solver::DdTerminalRounding const& getDdTerminalRoundingMode() const;
+    void setDdTerminalRounding(boost::optional<storm::RationalNumber> const& grid,
+                               storm::solver::DdTerminalRounding const& mode = storm::solver::DdTerminalRounding::Nearest);
+
     storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
     void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
     bool isLinearEquationSolverTypeSetFromDefaultValue() const;
@@ -62,6 +83,30 @@ class SolverEnvironment {
     void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision,
                                           boost::optional<bool> const& relativePrecision = boost::none);
 
+    /*!
+     * The telemetry to which iterative solvers report their iterations (if any). Copies of the environment share the telemetry.
+     */
+    std::shared_ptr<storm::solver::SolverTelemetry> const& getTelemetry() const;
+    void setTelemetry(std::shared_ptr<storm::solver::SolverTelemetry> const& value);
+
+    /*!
+     * The anytime bounds to which solvers report when they are aborted before convergence (if any). Copies of the environment share the bounds.
+     */
+    std::shared_ptr<storm::solver::AnytimeBounds> const& getAnytimeBounds() const;
+    void setAnytimeBounds(std::shared_ptr<storm::solver::AnytimeBounds> const& value);
+
+    /*!
+     * The workspace from which solvers obtain their auxiliary vectors (if any). Copies of the environment share the workspace.
+     */
+    std::shared_ptr<storm::solver::SolverWorkspace> const& getWorkspace() const;
+    void setWorkspace(std::shared_ptr<storm::solver::SolverWorkspace> const& value);
+
+    /*!
+     * The checkpoints in which long-running iterative solvers store their iterates (if any). Copies of the environment share the checkpoints.
+     */
+    std::shared_ptr<storm::solver::SolverCheckpoints> const& getCheckpoints() const;
+    void setCheckpoints(std::shared_ptr<storm::solver::SolverCheckpoints> const& value);
+
    private:
     SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
     SubEnvironment<GmmxxSolverEnvironment> gmmxxSolverEnvironment;
@@ -78,5 +123,12 @@ class SolverEnvironment {
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
     bool forceExact;
+    bool exactFloatFirst;
+    boost::optional<storm::RationalNumber> ddTerminalRoundingGrid;
+    storm::solver::DdTerminalRounding ddTerminalRoundingMode;
+    std::shared_ptr<storm::solver::SolverTelemetry> telemetry;
+    std::shared_ptr<storm::solver::AnytimeBounds> anytimeBounds;
+    std::shared_ptr<storm::solver::SolverWorkspace> workspace;
+    std::shared_ptr<storm::solver::SolverCheckpoints> checkpoints;
 };
 }  // namespace storm
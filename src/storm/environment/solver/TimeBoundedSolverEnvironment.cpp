@@ -11,9 +11,11 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     auto const& tbSettings = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>();
     maMethod = tbSettings.getMaMethod();
     maMethodSetFromDefault = tbSettings.isMaMethodSetFromDefaultValue();
+    ctmcMethod = tbSettings.getCtmcMethod();
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    stepBoundedEarlyTermination = tbSettings.isStepBoundedEarlyTerminationSet();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -33,6 +35,14 @@ void TimeBoundedSolverEnvironment::setMaMethod(storm::solver::MaBoundedReachabil
     maMethodSetFromDefault = isSetFromDefault;
 }
 
+storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+    return ctmcMethod;
+}
+
+void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+    ctmcMethod = value;
+}
+
 storm::RationalNumber const& TimeBoundedSolverEnvironment::getPrecision() const {
     return precision;
 }
@@ -57,4 +67,12 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+bool const& TimeBoundedSolverEnvironment::isStepBoundedEarlyTerminationSet() const {
+    return stepBoundedEarlyTermination;
+}
+
+void TimeBoundedSolverEnvironment::setStepBoundedEarlyTermination(bool value) {
+    stepBoundedEarlyTermination = value;
+}
+
 }  // namespace storm
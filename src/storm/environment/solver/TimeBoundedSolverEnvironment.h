@@ -14,6 +14,9 @@ class TimeBoundedSolverEnvironment {
     bool const& isMaMethodSetFromDefault() const;
     void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+
     storm::RationalNumber const& getPrecision() const;
     void setPrecision(storm::RationalNumber value);
     bool const& getRelativeTerminationCriterion() const;
@@ -22,13 +25,22 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    /*!
+     * Whether step-bounded computations stop once their result is known up to the precision (rather than only once the iterates stop changing).
+     */
+    bool const& isStepBoundedEarlyTerminationSet() const;
+    void setStepBoundedEarlyTermination(bool value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
 
+    storm::solver::CtmcTransientMethod ctmcMethod;
+
     storm::RationalNumber precision;
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+    bool stepBoundedEarlyTermination;
 };
 }  // namespace storm
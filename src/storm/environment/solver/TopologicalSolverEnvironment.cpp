@@ -4,6 +4,7 @@
 #include "storm/settings/modules/TopologicalEquationSolverSettings.h"
 #include "storm/utility/macros.h"
 
+#include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
@@ -15,6 +16,9 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    numberOfThreads = topologicalSettings.getNumberOfThreads();
+    batchSize = topologicalSettings.getBatchSize();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +55,21 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
+uint64_t const& TopologicalSolverEnvironment::getBatchSize() const {
+    return batchSize;
+}
+
+void TopologicalSolverEnvironment::setBatchSize(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentValueException, "The batch size must be positive.");
+    batchSize = value;
+}
+
 }  // namespace storm
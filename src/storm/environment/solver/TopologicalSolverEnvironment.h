@@ -19,11 +19,27 @@ class TopologicalSolverEnvironment {
     bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
     void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
 
+    /*!
+     * The number of threads used to solve SCCs concurrently. If this is not one, an SCC is solved as soon as all
+     * SCCs it depends on are solved. Zero means 'auto-detect'.
+     */
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
+    /*!
+     * The number of states up to which consecutive SCCs are solved as one task when solving SCCs concurrently.
+     */
+    uint64_t const& getBatchSize() const;
+    void setBatchSize(uint64_t value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
 
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
+
+    uint64_t numberOfThreads;
+    uint64_t batchSize;
 };
 }  // namespace storm
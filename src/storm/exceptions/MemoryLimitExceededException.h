@@ -0,0 +1,12 @@
+#pragma once
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/ExceptionMacros.h"
+
+namespace storm {
+namespace exceptions {
+
+STORM_NEW_EXCEPTION(MemoryLimitExceededException)
+
+}
+}  // namespace storm
@@ -0,0 +1,87 @@
+#include "storm/generator/GuardBatch.h"
+
+#include <algorithm>
+
+#include "storm/storage/expressions/Variable.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+GuardBatch::GuardBatch() : supported(false), numberOfBooleanVariables(0), numberOfIntegerVariables(0) {
+    // Intentionally left empty.
+}
+
+GuardBatch::GuardBatch(VariableInformation const& variableInformation)
+    : variableInformation(variableInformation),
+      supported(variableInformation.locationVariables.empty()),
+      numberOfBooleanVariables(0),
+      numberOfIntegerVariables(0) {
+    // Location variables (that only occur in JANI models) are not supported.
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        stateVariables.insert(booleanVariable.variable);
+        numberOfBooleanVariables = std::max<uint64_t>(numberOfBooleanVariables, booleanVariable.variable.getOffset() + 1);
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        stateVariables.insert(integerVariable.variable);
+        numberOfIntegerVariables = std::max<uint64_t>(numberOfIntegerVariables, integerVariable.variable.getOffset() + 1);
+    }
+}
+
+void GuardBatch::addGuard(uint64_t index, storm::expressions::Expression const& guard) {
+    if (!supported) {
+        return;
+    }
+
+    std::set<storm::expressions::Variable> guardVariables = guard.getVariables();
+    if (!std::includes(stateVariables.begin(), stateVariables.end(), guardVariables.begin(), guardVariables.end())) {
+        STORM_LOG_DEBUG("Disabling the batch evaluation of guards as guard " << guard << " depends on variables that are not part of the states.");
+        supported = false;
+        return;
+    }
+
+    if (guardToOutput.size() <= index) {
+        guardToOutput.resize(index + 1);
+    }
+    guardToOutput[index] = compiler.addExpression(guard);
+}
+
+bool GuardBatch::isSupported() const {
+    return supported;
+}
+
+void GuardBatch::evaluate(std::vector<CompressedState> const& states) {
+    STORM_LOG_ASSERT(supported, "Unable to evaluate guards in batches.");
+    uint64_t const numberOfStates = states.size();
+    registers.numberOfLanes = numberOfStates;
+    registers.booleanVariables.resize(numberOfBooleanVariables * numberOfStates);
+    registers.integerVariables.resize(numberOfIntegerVariables * numberOfStates);
+
+    // Unpack the states such that the values of each variable are stored contiguously.
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        uint8_t* values = registers.booleanVariables.data() + booleanVariable.variable.getOffset() * numberOfStates;
+        for (uint64_t position = 0; position < numberOfStates; ++position) {
+            values[position] = states[position].get(booleanVariable.bitOffset);
+        }
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        int64_t* values = registers.integerVariables.data() + integerVariable.variable.getOffset() * numberOfStates;
+        for (uint64_t position = 0; position < numberOfStates; ++position) {
+            values[position] =
+                static_cast<int64_t>(states[position].getAsInt(integerVariable.bitOffset, integerVariable.bitWidth)) + integerVariable.lowerBound;
+        }
+    }
+
+    compiler.getProgram().evaluateBatch(registers);
+}
+
+uint64_t GuardBatch::getNumberOfStates() const {
+    return registers.numberOfLanes;
+}
+
+bool GuardBatch::getValue(uint64_t index, uint64_t position) const {
+    return compiler.getProgram().getBooleanValue(registers, guardToOutput[index], position);
+}
+
+}  // namespace generator
+}  // namespace storm
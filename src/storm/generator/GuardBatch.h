@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/BytecodeCompiler.h"
+#include "storm/storage/expressions/BytecodeProgram.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Evaluates the guards of a model for a batch of states at once. All guards are compiled into a single bytecode program
+ * (such that subexpressions shared by several guards are computed once) which is evaluated for all states of the batch
+ * in one pass, i.e. each instruction is applied to the values of all states before the next instruction is executed.
+ * This replaces the evaluation of the guards state by state, whose costs are dominated by the dispatch of the
+ * instructions (or, for the expression evaluator, the traversal of the expressions).
+ *
+ * Batches are only supported if all guards depend on the (boolean and integer) variables of the states only.
+ */
+class GuardBatch {
+   public:
+    /*!
+     * Creates an empty batch evaluator that does not support any guard.
+     */
+    GuardBatch();
+
+    /*!
+     * Creates a batch evaluator without guards.
+     *
+     * @param variableInformation The information about the encoding of the variables in the states.
+     */
+    GuardBatch(VariableInformation const& variableInformation);
+
+    /*!
+     * Adds the given guard.
+     *
+     * @param index The index under which the guard is added.
+     * @param guard The guard.
+     */
+    void addGuard(uint64_t index, storm::expressions::Expression const& guard);
+
+    /*!
+     * Retrieves whether all guards can be evaluated in batches.
+     */
+    bool isSupported() const;
+
+    /*!
+     * Evaluates all guards for the given states. The values remain available until the next batch is evaluated.
+     */
+    void evaluate(std::vector<CompressedState> const& states);
+
+    /*!
+     * Retrieves the number of states of the batch that was evaluated last.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves the value of the guard with the given index in the state at the given position of the last batch.
+     */
+    bool getValue(uint64_t index, uint64_t position) const;
+
+   private:
+    VariableInformation variableInformation;
+    std::set<storm::expressions::Variable> stateVariables;
+    bool supported;
+
+    storm::expressions::BytecodeCompiler compiler;
+
+    // The output of the program that holds the value of each guard (indexed by the index of the guard).
+    std::vector<uint64_t> guardToOutput;
+
+    // The number of boolean and integer variables (i.e. one plus the largest offset of such a variable in the states).
+    uint64_t numberOfBooleanVariables;
+    uint64_t numberOfIntegerVariables;
+
+    storm::expressions::BytecodeBatchRegisters registers;
+};
+
+}  // namespace generator
+}  // namespace storm
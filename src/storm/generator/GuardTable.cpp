@@ -0,0 +1,77 @@
+#include "storm/generator/GuardTable.h"
+
+#include <algorithm>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace generator {
+
+GuardTable::GuardTable() : maximalNumberOfBits(0) {
+    // Intentionally left empty.
+}
+
+GuardTable::GuardTable(VariableInformation const& variableInformation, uint64_t maximalNumberOfBits) : maximalNumberOfBits(maximalNumberOfBits) {
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableToBitRange.emplace(booleanVariable.variable, std::make_pair(booleanVariable.bitOffset, 1ull));
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableToBitRange.emplace(integerVariable.variable, std::make_pair(integerVariable.bitOffset, integerVariable.bitWidth));
+    }
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        variableToBitRange.emplace(locationVariable.variable, std::make_pair(locationVariable.bitOffset, locationVariable.bitWidth));
+    }
+}
+
+void GuardTable::addGuard(uint64_t index, storm::expressions::Expression const& guard) {
+    if (guards.size() <= index) {
+        guards.resize(index + 1);
+    }
+    Guard& newGuard = guards[index];
+    newGuard.expression = guard;
+    newGuard.tabulated = false;
+    newGuard.numberOfBits = 0;
+
+    if (maximalNumberOfBits == 0) {
+        return;
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> bitRanges;
+    for (auto const& variable : guard.getVariables()) {
+        auto it = variableToBitRange.find(variable);
+        if (it == variableToBitRange.end()) {
+            // The guard depends on a variable that is not part of the state.
+            return;
+        }
+        bitRanges.push_back(it->second);
+        newGuard.numberOfBits += it->second.second;
+        if (newGuard.numberOfBits > maximalNumberOfBits) {
+            return;
+        }
+    }
+
+    // Merge adjacent ranges such that the bits of, e.g., the variables of a module are extracted at once.
+    std::sort(bitRanges.begin(), bitRanges.end());
+    for (auto const& bitRange : bitRanges) {
+        if (!newGuard.bitRanges.empty() && newGuard.bitRanges.back().first + newGuard.bitRanges.back().second == bitRange.first) {
+            newGuard.bitRanges.back().second += bitRange.second;
+        } else {
+            newGuard.bitRanges.push_back(bitRange);
+        }
+    }
+    newGuard.tabulated = true;
+}
+
+uint64_t GuardTable::getIndex(Guard const& guard, CompressedState const& state) const {
+    uint64_t result = 0;
+    for (auto const& bitRange : guard.bitRanges) {
+        result = (result << bitRange.second) | state.getAsInt(bitRange.first, bitRange.second);
+    }
+    return result;
+}
+
+uint64_t GuardTable::getNumberOfTabulatedGuards() const {
+    return std::count_if(guards.begin(), guards.end(), [](Guard const& guard) { return guard.tabulated; });
+}
+
+}  // namespace generator
+}  // namespace storm
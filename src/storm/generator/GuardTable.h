@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * A table that caches the values of guards. Each guard is tabulated over the bits of the (encoded) variables it depends
+ * on: Whenever a guard is evaluated in a state, the bits of its variables form the index of its entry in the table. The
+ * guard is only evaluated by the expression evaluator if the entry is not yet known. As guards typically depend on few
+ * variables (e.g. the local variables of a module), the guards are evaluated only for few valuations and most states
+ * just look up their entries.
+ *
+ * Guards that depend on more than the given number of bits (or on variables that are not part of the state) are not
+ * tabulated and are always evaluated.
+ */
+class GuardTable {
+   public:
+    /*!
+     * Creates an empty table that is not able to tabulate any guard.
+     */
+    GuardTable();
+
+    /*!
+     * Creates an empty table.
+     *
+     * @param variableInformation The information about the encoding of the variables in the states.
+     * @param maximalNumberOfBits The maximal number of bits over which a guard is tabulated. If zero, no guard is
+     * tabulated.
+     */
+    GuardTable(VariableInformation const& variableInformation, uint64_t maximalNumberOfBits);
+
+    /*!
+     * Adds the given guard to the table.
+     *
+     * @param index The index under which the guard is added.
+     * @param guard The guard.
+     */
+    void addGuard(uint64_t index, storm::expressions::Expression const& guard);
+
+    /*!
+     * Retrieves the value of the guard with the given index in the given state.
+     *
+     * @param index The index of the guard.
+     * @param state The state in which to evaluate the guard.
+     * @param evaluator An evaluator into which the given state has been loaded. It is used if the guard is not
+     * tabulated or its value is unknown.
+     * @return True iff the guard is satisfied in the given state.
+     */
+    template<typename EvaluatorType>
+    bool evaluate(uint64_t index, CompressedState const& state, EvaluatorType const& evaluator);
+
+    /*!
+     * Retrieves the number of guards that are tabulated.
+     */
+    uint64_t getNumberOfTabulatedGuards() const;
+
+   private:
+    struct Guard {
+        // The guard itself.
+        storm::expressions::Expression expression;
+
+        // The bit ranges (given as offset and width) of the state that determine the value of the guard if the guard
+        // is tabulated.
+        std::vector<std::pair<uint64_t, uint64_t>> bitRanges;
+        bool tabulated = false;
+
+        // The known values of the guard, where 0 means unknown, 1 means false and 2 means true. As long as the guard
+        // was not looked up, this is empty.
+        std::vector<uint8_t> values;
+        uint64_t numberOfBits = 0;
+    };
+
+    // Computes the index of the given state in the values of the given guard.
+    uint64_t getIndex(Guard const& guard, CompressedState const& state) const;
+
+    // The offsets and widths of the encoded variables.
+    std::unordered_map<storm::expressions::Variable, std::pair<uint64_t, uint64_t>> variableToBitRange;
+    uint64_t maximalNumberOfBits;
+
+    std::vector<Guard> guards;
+};
+
+template<typename EvaluatorType>
+bool GuardTable::evaluate(uint64_t index, CompressedState const& state, EvaluatorType const& evaluator) {
+    Guard& guard = guards[index];
+    if (!guard.tabulated) {
+        return evaluator.asBool(guard.expression);
+    }
+    if (guard.values.empty()) {
+        guard.values.resize(1ull << guard.numberOfBits, 0);
+    }
+    uint8_t& value = guard.values[getIndex(guard, state)];
+    if (value == 0) {
+        value = evaluator.asBool(guard.expression) ? 2 : 1;
+    }
+    return value == 2;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -49,6 +49,10 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
       evaluateRewardExpressionsAtDestinations(false) {
     STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
                     "JANI next-state generator cannot generate choice labels.");
+    STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet(), "Symmetry reduction is only supported for PRISM programs and is therefore ignored.");
+    STORM_LOG_WARN_COND(!this->options.isVariableRangeAnalysisSet(),
+                        "The variable range analysis is only supported for PRISM programs and is therefore ignored.");
+    STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(), "Partial order reduction is only supported for PRISM programs and is therefore ignored.");
 
     auto features = this->model.getModelFeatures();
     features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -104,27 +108,30 @@ JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani
 
     // If there are terminal states we need to handle, we now need to translate all labels to expressions.
     if (this->options.hasTerminalStates()) {
+        auto translate = [this](storm::builder::LabelOrExpression const& labelOrExpression) -> boost::optional<storm::expressions::Expression> {
+            if (labelOrExpression.isExpression()) {
+                return labelOrExpression.getExpression();
+            }
+            // If it's a label, i.e. refers to a transient boolean variable we do some sanity checks first
+            if (labelOrExpression.getLabel() == "init" || labelOrExpression.getLabel() == "deadlock") {
+                return boost::none;
+            }
+            STORM_LOG_THROW(this->model.getGlobalVariables().hasVariable(labelOrExpression.getLabel()), storm::exceptions::InvalidArgumentException,
+                            "Terminal states refer to illegal label '" << labelOrExpression.getLabel() << "'.");
+
+            storm::jani::Variable const& variable = this->model.getGlobalVariables().getVariable(labelOrExpression.getLabel());
+            STORM_LOG_THROW(variable.getType().isBasicType() && variable.getType().asBasicType().isBooleanType(), storm::exceptions::InvalidArgumentException,
+                            "Terminal states refer to non-boolean variable '" << labelOrExpression.getLabel() << "'.");
+            STORM_LOG_THROW(variable.isTransient(), storm::exceptions::InvalidArgumentException,
+                            "Terminal states refer to non-transient variable '" << labelOrExpression.getLabel() << "'.");
+            return variable.getExpressionVariable().getExpression();
+        };
         for (auto const& expressionOrLabelAndBool : this->options.getTerminalStates()) {
-            if (expressionOrLabelAndBool.first.isExpression()) {
-                this->terminalStates.emplace_back(expressionOrLabelAndBool.first.getExpression(), expressionOrLabelAndBool.second);
-            } else {
-                // If it's a label, i.e. refers to a transient boolean variable we do some sanity checks first
-                if (expressionOrLabelAndBool.first.getLabel() != "init" && expressionOrLabelAndBool.first.getLabel() != "deadlock") {
-                    STORM_LOG_THROW(this->model.getGlobalVariables().hasVariable(expressionOrLabelAndBool.first.getLabel()),
-                                    storm::exceptions::InvalidArgumentException,
-                                    "Terminal states refer to illegal label '" << expressionOrLabelAndBool.first.getLabel() << "'.");
-
-                    storm::jani::Variable const& variable = this->model.getGlobalVariables().getVariable(expressionOrLabelAndBool.first.getLabel());
-                    STORM_LOG_THROW(variable.getType().isBasicType() && variable.getType().asBasicType().isBooleanType(),
-                                    storm::exceptions::InvalidArgumentException,
-                                    "Terminal states refer to non-boolean variable '" << expressionOrLabelAndBool.first.getLabel() << "'.");
-                    STORM_LOG_THROW(variable.isTransient(), storm::exceptions::InvalidArgumentException,
-                                    "Terminal states refer to non-transient variable '" << expressionOrLabelAndBool.first.getLabel() << "'.");
-
-                    this->terminalStates.emplace_back(variable.getExpressionVariable().getExpression(), expressionOrLabelAndBool.second);
-                }
+            if (auto expression = translate(expressionOrLabelAndBool.first)) {
+                this->terminalStates.emplace_back(expression.get(), expressionOrLabelAndBool.second);
             }
         }
+        this->addTerminalStateSets(translate);
     }
 }
 
@@ -725,6 +732,115 @@ StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>
     return result;
 }
 
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::sampleSuccessor(storm::utility::RandomProbabilityGenerator<double>& generator,
+                                                                   CompressedState& successor) {
+    STORM_LOG_ASSERT(this->isDiscreteTimeModel(), "Sampling successors is only supported for discrete-time models.");
+    for (auto const& expressionBool : this->terminalStates) {
+        if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+            return false;
+        }
+    }
+
+    // Collect the enabled edges. Every synchronization contributes one choice per combination of enabled edges of
+    // the participating automata (and non-synchronizing edges one choice per edge).
+    enabledEdgesMemory.clear();
+    enabledEdgeSetsMemory.clear();
+    enabledSynchronizationsMemory.clear();
+    uint64_t totalNumberOfChoices = 0;
+    for (OutputAndEdges const& outputAndEdges : edges) {
+        uint64_t firstEdge = enabledEdgesMemory.size();
+        uint64_t firstEdgeSet = enabledEdgeSetsMemory.size();
+        uint64_t numberOfChoices = 1;
+        for (auto const& automatonAndEdges : outputAndEdges.second) {
+            uint64_t automatonIndex = automatonAndEdges.first;
+            uint64_t edgeSetBegin = enabledEdgesMemory.size();
+            auto edgesIt = automatonAndEdges.second.find(getLocation(*this->state, this->variableInformation.locationVariables[automatonIndex]));
+            if (edgesIt != automatonAndEdges.second.end()) {
+                for (auto const& indexAndEdge : edgesIt->second) {
+                    if (this->evaluator->asBool(indexAndEdge.second->getGuard())) {
+                        enabledEdgesMemory.emplace_back(automatonIndex, indexAndEdge.second);
+                    }
+                }
+            }
+            if (enabledEdgesMemory.size() == edgeSetBegin) {
+                numberOfChoices = 0;
+                break;
+            }
+            enabledEdgeSetsMemory.push_back(edgeSetBegin);
+            numberOfChoices *= enabledEdgesMemory.size() - edgeSetBegin;
+        }
+        if (numberOfChoices == 0) {
+            // Discard the edges of this synchronization.
+            enabledEdgesMemory.resize(firstEdge);
+            enabledEdgeSetsMemory.resize(firstEdgeSet);
+        } else {
+            enabledSynchronizationsMemory.emplace_back(firstEdgeSet, numberOfChoices);
+            totalNumberOfChoices += numberOfChoices;
+        }
+    }
+    if (totalNumberOfChoices == 0) {
+        return false;
+    }
+    enabledEdgeSetsMemory.push_back(enabledEdgesMemory.size());
+
+    // Sample a choice uniformly and determine the sampled edge of every participating automaton.
+    uint64_t choice = std::min(static_cast<uint64_t>(generator.random() * totalNumberOfChoices), totalNumberOfChoices - 1);
+    auto synchronizationIt = enabledSynchronizationsMemory.begin();
+    while (choice >= synchronizationIt->second) {
+        choice -= synchronizationIt->second;
+        ++synchronizationIt;
+    }
+    uint64_t edgeSetEnd = synchronizationIt + 1 == enabledSynchronizationsMemory.end() ? enabledEdgeSetsMemory.size() - 1 : (synchronizationIt + 1)->first;
+
+    // For every sampled edge, sample one of its destinations. As the destinations of synchronizing edges are combined
+    // by multiplying their probabilities, they can be sampled independently.
+    sampledDestinationsMemory.clear();
+    int64_t lowestAssignmentLevel = std::numeric_limits<int64_t>::max();
+    int64_t highestAssignmentLevel = std::numeric_limits<int64_t>::min();
+    for (uint64_t edgeSet = synchronizationIt->first; edgeSet < edgeSetEnd; ++edgeSet) {
+        uint64_t numberOfEdges = enabledEdgeSetsMemory[edgeSet + 1] - enabledEdgeSetsMemory[edgeSet];
+        auto const& automatonAndEdge = enabledEdgesMemory[enabledEdgeSetsMemory[edgeSet] + choice % numberOfEdges];
+        choice /= numberOfEdges;
+        storm::jani::Edge const& edge = *automatonAndEdge.second;
+        lowestAssignmentLevel = std::min(lowestAssignmentLevel, edge.getLowestAssignmentLevel());
+        highestAssignmentLevel = std::max(highestAssignmentLevel, edge.getHighestAssignmentLevel());
+
+        double randomValue = generator.random();
+        double probabilitySum = 0.0;
+        storm::jani::EdgeDestination const* sampledDestination = nullptr;
+        for (auto const& destination : edge.getDestinations()) {
+            double probability = storm::utility::convertNumber<double>(this->evaluator->asRational(destination.getProbability()));
+            if (probability > 0.0) {
+                sampledDestination = &destination;
+                probabilitySum += probability;
+                if (randomValue < probabilitySum) {
+                    break;
+                }
+            }
+        }
+        STORM_LOG_THROW(sampledDestination != nullptr, storm::exceptions::WrongFormatException, "Found an enabled edge without a feasible destination.");
+        sampledDestinationsMemory.emplace_back(&this->variableInformation.locationVariables[automatonAndEdge.first], sampledDestination);
+    }
+
+    // Finally, apply the updates of the sampled destinations.
+    successor = *this->state;
+    for (auto const& locationVariableAndDestination : sampledDestinationsMemory) {
+        applyUpdate(successor, *locationVariableAndDestination.second, *locationVariableAndDestination.first, lowestAssignmentLevel, *this->evaluator);
+    }
+    if (lowestAssignmentLevel < highestAssignmentLevel) {
+        for (int64_t assignmentLevel = lowestAssignmentLevel + 1; assignmentLevel <= highestAssignmentLevel; ++assignmentLevel) {
+            unpackStateIntoEvaluator(successor, this->variableInformation, *this->evaluator);
+            for (auto const& locationVariableAndDestination : sampledDestinationsMemory) {
+                applyUpdate(successor, *locationVariableAndDestination.second, *locationVariableAndDestination.first, assignmentLevel, *this->evaluator);
+            }
+        }
+        // Restore the old variable valuation
+        unpackStateIntoEvaluator(*this->state, this->variableInformation, *this->evaluator);
+    }
+    return true;
+}
+
 template<typename ValueType, typename StateType>
 Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchronizingEdge(storm::jani::Edge const& edge, uint64_t outputActionIndex,
                                                                                            uint64_t automatonIndex, CompressedState const& state,
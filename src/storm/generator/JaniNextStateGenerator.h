@@ -7,6 +7,7 @@
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/OrderedAssignments.h"
 #include "storm/storage/jani/eliminator/ArrayEliminator.h"
+#include "storm/utility/random.h"
 
 namespace storm {
 namespace jani {
@@ -50,6 +51,19 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
 
+    /*!
+     * Samples a successor of the currently loaded state. In contrast to expand, this neither constructs the behavior of
+     * the state nor evaluates rewards: only the guards of the edges and the destinations of the sampled edges are
+     * evaluated, and no memory is allocated once the internal buffers have grown to their final size.
+     * Nondeterminism is resolved uniformly at random, which coincides with the semantics of (fused) choices in DTMCs.
+     *
+     * @pre The model is discrete-time.
+     * @param generator The random number generator used for sampling.
+     * @param successor The compressed state to which the sampled successor is written.
+     * @return false, if the state is terminal or has no enabled edge. In that case, the successor is not changed.
+     */
+    bool sampleSuccessor(storm::utility::RandomProbabilityGenerator<double>& generator, CompressedState& successor);
+
     /// Adds the valuation for the currently loaded state to the given builder
     virtual void addStateValuation(storm::storage::sparse::state_type const& currentStateIndex,
                                    storm::storage::sparse::StateValuationsBuilder& valuationsBuilder) const override;
@@ -231,6 +245,14 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// Buffers for sampling successors: the enabled edges (together with the index of their automaton), the start
+    /// indices of the sets of enabled edges per automaton and synchronization (followed by the end index), and for each
+    /// synchronization (with at least one enabled combination of edges) its first edge set and number of choices.
+    std::vector<std::pair<uint64_t, storm::jani::Edge const*>> enabledEdgesMemory;
+    std::vector<uint64_t> enabledEdgeSetsMemory;
+    std::vector<std::pair<uint64_t, uint64_t>> enabledSynchronizationsMemory;
+    std::vector<std::pair<LocationVariableInformation const*, storm::jani::EdgeDestination const*>> sampledDestinationsMemory;
 };
 
 }  // namespace generator
@@ -1,8 +1,10 @@
 #include "storm/generator/NextStateGenerator.h"
 #include <storm/exceptions/NotImplementedException.h>
+#include <storm/exceptions/NotSupportedException.h>
 #include <storm/exceptions/WrongFormatException.h>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/generator/GuardBatch.h"
 
 #include "storm/logic/Formulas.h"
 
@@ -12,6 +14,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace generator {
@@ -114,6 +117,11 @@ void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state
     this->state = &state;
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::prepareBatch(std::vector<CompressedState> const&) {
+    // Intentionally left empty.
+}
+
 template<typename ValueType, typename StateType>
 bool NextStateGenerator<ValueType, StateType>::satisfies(storm::expressions::Expression const& expression) const {
     if (expression.isTrue()) {
@@ -193,15 +201,74 @@ storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::l
         result.addLabel(label.first);
     }
 
+    // If the label expressions only depend on the variables of the states, they are compiled and evaluated for batches of states.
+    GuardBatch labelBatch(variableInformation);
+    for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+        labelBatch.addGuard(labelIndex, labelsAndExpressions[labelIndex].second);
+    }
+
     auto const& states = stateStorage.stateToId;
-    for (auto const& stateIndexPair : states) {
-        unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
-        unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
-
-        for (auto const& label : labelsAndExpressions) {
-            // Add label to state, if the corresponding expression is true.
-            if (evaluator->asBool(label.second)) {
-                result.addLabelToState(label.first, stateIndexPair.second);
+    if (!labelsAndExpressions.empty() && labelBatch.isSupported()) {
+        // The batches of a round (one per thread) are evaluated concurrently, each thread using its own copy of the
+        // evaluator. The labeled states are collected per thread and added afterwards, as the threads may not set bits
+        // of the same bit vector concurrently.
+        uint64_t const statesPerBatch = 4096;
+        uint64_t const numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+        std::vector<GuardBatch> threadLabelBatches(numberOfThreads, labelBatch);
+        std::vector<std::vector<std::vector<StateType>>> threadLabeledStates(numberOfThreads,
+                                                                             std::vector<std::vector<StateType>>(labelsAndExpressions.size()));
+        std::vector<std::vector<CompressedState>> batchStates(numberOfThreads);
+        std::vector<std::vector<StateType>> batchIndices(numberOfThreads);
+        uint64_t numberOfBatches = 0;
+        auto labelBatchStates = [&]() {
+            storm::utility::parallel::forEachChunk(0, numberOfBatches, 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t batch, uint64_t) {
+                GuardBatch& threadLabelBatch = threadLabelBatches[threadIndex];
+                threadLabelBatch.evaluate(batchStates[batch]);
+                for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+                    for (uint64_t position = 0; position < batchStates[batch].size(); ++position) {
+                        if (threadLabelBatch.getValue(labelIndex, position)) {
+                            threadLabeledStates[threadIndex][labelIndex].push_back(batchIndices[batch][position]);
+                        }
+                    }
+                }
+            });
+            for (auto& labeledStates : threadLabeledStates) {
+                for (uint64_t labelIndex = 0; labelIndex < labelsAndExpressions.size(); ++labelIndex) {
+                    for (auto index : labeledStates[labelIndex]) {
+                        result.addLabelToState(labelsAndExpressions[labelIndex].first, index);
+                    }
+                    labeledStates[labelIndex].clear();
+                }
+            }
+            for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+                batchStates[batch].clear();
+                batchIndices[batch].clear();
+            }
+            numberOfBatches = 0;
+        };
+        for (auto const& stateIndexPair : states) {
+            if (numberOfBatches == 0 || batchStates[numberOfBatches - 1].size() == statesPerBatch) {
+                if (numberOfBatches == numberOfThreads) {
+                    labelBatchStates();
+                }
+                ++numberOfBatches;
+            }
+            batchStates[numberOfBatches - 1].push_back(stateIndexPair.first);
+            batchIndices[numberOfBatches - 1].push_back(stateIndexPair.second);
+        }
+        if (numberOfBatches > 0) {
+            labelBatchStates();
+        }
+    } else {
+        for (auto const& stateIndexPair : states) {
+            unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            unpackTransientVariableValuesIntoEvaluator(stateIndexPair.first, *this->evaluator);
+
+            for (auto const& label : labelsAndExpressions) {
+                // Add label to state, if the corresponding expression is true.
+                if (evaluator->asBool(label.second)) {
+                    result.addLabelToState(label.first, stateIndexPair.second);
+                }
             }
         }
     }
@@ -246,6 +313,29 @@ void NextStateGenerator<ValueType, StateType>::unpackTransientVariableValuesInto
     // This method should be overwritten in case there are transient variables (e.g. JANI).
 }
 
+template<typename ValueType, typename StateType>
+void NextStateGenerator<ValueType, StateType>::addTerminalStateSets(
+    std::function<boost::optional<storm::expressions::Expression>(storm::builder::LabelOrExpression const&)> const& translate) {
+    if (this->options.getTerminalStateSets().empty()) {
+        return;
+    }
+    std::vector<storm::expressions::Expression> terminalStateSetExpressions;
+    for (auto const& terminalStateSet : this->options.getTerminalStateSets()) {
+        std::vector<storm::expressions::Expression> expressions;
+        for (auto const& labelOrExpressionAndBool : terminalStateSet) {
+            if (auto expression = translate(labelOrExpressionAndBool.first)) {
+                expressions.push_back(labelOrExpressionAndBool.second ? expression.get() : !expression.get());
+            }
+        }
+        if (expressions.empty()) {
+            STORM_LOG_DEBUG("Ignoring the terminal state sets as one of them does not contain a supported label or expression.");
+            return;
+        }
+        terminalStateSetExpressions.push_back(storm::expressions::disjunction(expressions));
+    }
+    this->terminalStates.emplace_back(storm::expressions::conjunction(terminalStateSetExpressions), true);
+}
+
 template<typename ValueType, typename StateType>
 void NextStateGenerator<ValueType, StateType>::postprocess(StateBehavior<ValueType, StateType>& result) {
     // If the model we build is a Markov Automaton, we postprocess the choices to sum all Markovian choices
@@ -317,6 +407,34 @@ std::shared_ptr<storm::storage::sparse::ChoiceOrigins> NextStateGenerator<ValueT
     return nullptr;
 }
 
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::storage::sparse::ChoiceOrigins> NextStateGenerator<ValueType, StateType>::generateChoiceOriginsOfState(CompressedState const& state) {
+    // With these reductions, the choices of a state depend on the previously explored states.
+    STORM_LOG_THROW(!options.isSymmetryReductionSet() && !options.isPartialOrderReductionSet(), storm::exceptions::NotSupportedException,
+                    "Choice origins of single states can not be generated when reducing the state space.");
+    bool const buildChoiceOrigins = options.isBuildChoiceOriginsSet();
+    options.setBuildChoiceOrigins(true);
+    std::vector<boost::any> dataForChoiceOrigins;
+    try {
+        load(state);
+        // The successors are irrelevant for the origins, so no ids need to be assigned to them.
+        StateBehavior<ValueType, StateType> behavior = expand([](CompressedState const&) { return static_cast<StateType>(0); });
+        for (auto const& choice : behavior) {
+            dataForChoiceOrigins.push_back(choice.hasOriginData() ? choice.getOriginData() : boost::any());
+        }
+        if (dataForChoiceOrigins.empty()) {
+            // The builder adds a self-loop to states without behavior.
+            dataForChoiceOrigins.emplace_back();
+        }
+    } catch (...) {
+        options.setBuildChoiceOrigins(buildChoiceOrigins);
+        throw;
+    }
+    auto result = generateChoiceOrigins(dataForChoiceOrigins);
+    options.setBuildChoiceOrigins(buildChoiceOrigins);
+    return result;
+}
+
 template<typename ValueType, typename StateType>
 uint32_t NextStateGenerator<ValueType, StateType>::observabilityClass(CompressedState const& state) const {
     if (this->mask.size() == 0) {
@@ -95,6 +95,10 @@ class NextStateGenerator {
 
     void load(CompressedState const& state);
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
+
+    /// Announces that the given states are going to be loaded and expanded next (in this order). Generators may use
+    /// this to evaluate the guards for all these states at once. By default, nothing is done.
+    virtual void prepareBatch(std::vector<CompressedState> const& states);
     bool satisfies(storm::expressions::Expression const& expression) const;
 
     /// Adds the valuation for the currently loaded state to the given builder
@@ -125,6 +129,14 @@ class NextStateGenerator {
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
 
+    /*!
+     * Expands the given state and creates the origins of its choices. This also works if the choice origins are not built during the exploration.
+     * The choices are ordered as in the built model, where a state without behavior has a single choice without origin.
+     *
+     * @param state The state whose choice origins to create.
+     */
+    std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOriginsOfState(CompressedState const& state);
+
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
      *
@@ -158,6 +170,13 @@ class NextStateGenerator {
 
     void postprocess(StateBehavior<ValueType, StateType>& result);
 
+    /*!
+     * Adds a terminal state expression that holds in the states that are terminal w.r.t. all terminal state sets of
+     * the options. Labels and expressions are translated using the given function, which may return none for labels
+     * (such as 'init') that are to be ignored.
+     */
+    void addTerminalStateSets(std::function<boost::optional<storm::expressions::Expression>(storm::builder::LabelOrExpression const&)> const& translate);
+
     /// The options to be used for next-state generation.
     NextStateGeneratorOptions options;
 
@@ -0,0 +1,97 @@
+#include "storm/generator/PartialOrderReduction.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm/storage/expressions/Variable.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+typedef std::set<storm::expressions::Variable> VariableSet;
+
+bool intersects(VariableSet const& first, VariableSet const& second) {
+    return std::any_of(first.begin(), first.end(), [&second](storm::expressions::Variable const& variable) { return second.count(variable) > 0; });
+}
+
+void insertVariables(storm::expressions::Expression const& expression, VariableSet& variables) {
+    auto expressionVariables = expression.getVariables();
+    variables.insert(expressionVariables.begin(), expressionVariables.end());
+}
+}  // namespace
+
+PartialOrderReduction::PartialOrderReduction(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& visibleExpressions) {
+    VariableSet visibleVariables;
+    for (auto const& expression : visibleExpressions) {
+        insertVariables(expression, visibleVariables);
+    }
+
+    // Determine the variables that are read and written by the commands and modules.
+    uint64_t numberOfModules = program.getNumberOfModules();
+    std::vector<std::vector<VariableSet>> readVariables(numberOfModules), writtenVariables(numberOfModules);
+    std::vector<VariableSet> moduleReadVariables(numberOfModules), moduleWrittenVariables(numberOfModules);
+    for (uint64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+        for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+            VariableSet read, written;
+            insertVariables(command.getGuardExpression(), read);
+            for (auto const& update : command.getUpdates()) {
+                insertVariables(update.getLikelihoodExpression(), read);
+                for (auto const& assignment : update.getAssignments()) {
+                    insertVariables(assignment.getExpression(), read);
+                    written.insert(assignment.getVariable());
+                }
+            }
+            moduleReadVariables[moduleIndex].insert(read.begin(), read.end());
+            moduleWrittenVariables[moduleIndex].insert(written.begin(), written.end());
+            readVariables[moduleIndex].push_back(std::move(read));
+            writtenVariables[moduleIndex].push_back(std::move(written));
+        }
+    }
+
+    for (uint64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+        // Collect the variables that are accessed by the other modules.
+        VariableSet otherReadVariables, otherWrittenVariables;
+        for (uint64_t otherModuleIndex = 0; otherModuleIndex < numberOfModules; ++otherModuleIndex) {
+            if (otherModuleIndex != moduleIndex) {
+                otherReadVariables.insert(moduleReadVariables[otherModuleIndex].begin(), moduleReadVariables[otherModuleIndex].end());
+                otherWrittenVariables.insert(moduleWrittenVariables[otherModuleIndex].begin(), moduleWrittenVariables[otherModuleIndex].end());
+            }
+        }
+
+        // The commands of the module can only become enabled by the module itself if their guards only read variables
+        // that are not written by other modules.
+        storm::prism::Module const& module = program.getModule(moduleIndex);
+        auto const& commands = module.getCommands();
+        bool guardsAreLocal = std::none_of(commands.begin(), commands.end(), [&otherWrittenVariables](storm::prism::Command const& command) {
+            return intersects(command.getGuardExpression().getVariables(), otherWrittenVariables);
+        });
+        if (!guardsAreLocal) {
+            continue;
+        }
+
+        for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+            storm::prism::Command const& command = module.getCommand(commandIndex);
+            VariableSet const& read = readVariables[moduleIndex][commandIndex];
+            VariableSet const& written = writtenVariables[moduleIndex][commandIndex];
+            if (program.getPossiblySynchronizingCommands().get(command.getGlobalIndex()) || intersects(written, visibleVariables) ||
+                intersects(written, otherReadVariables) || intersects(written, otherWrittenVariables) || intersects(read, otherWrittenVariables)) {
+                continue;
+            }
+            candidates.push_back(Candidate{moduleIndex, commandIndex});
+        }
+    }
+    STORM_LOG_DEBUG("Found " << candidates.size() << " commands that may form ample sets.");
+}
+
+bool PartialOrderReduction::empty() const {
+    return candidates.empty();
+}
+
+std::vector<PartialOrderReduction::Candidate> const& PartialOrderReduction::getCandidates() const {
+    return candidates;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Determines the commands of a PRISM program that may form singleton ample sets for a partial order reduction that
+ * preserves the minimal and maximal probabilities of stutter-insensitive properties (like unbounded reachability).
+ *
+ * The independence of commands is computed statically from the variables they read and write. A command is a
+ * candidate if
+ * - it is not (possibly) synchronizing,
+ * - it does not write any variable that is visible, i.e. that occurs in one of the given expressions,
+ * - it is independent of all commands of the other modules, i.e. it does not write a variable they access and does not
+ *   read a variable they write, and
+ * - the guards of the other commands of its module do not read variables written by other modules, such that these
+ *   commands can not become enabled before a command of the module is executed.
+ *
+ * In a state in which a candidate is enabled and all other commands of its module are disabled, the candidate forms an
+ * ample set on its own. The cycle proviso needs to be ensured by the exploration.
+ */
+class PartialOrderReduction {
+   public:
+    struct Candidate {
+        // The index of the module of the command.
+        uint64_t moduleIndex;
+        // The index of the command within its module.
+        uint64_t commandIndex;
+    };
+
+    /*!
+     * Creates a partial order reduction that does not have any candidates.
+     */
+    PartialOrderReduction() = default;
+
+    /*!
+     * Determines the candidates for ample sets of the given program.
+     *
+     * @param program The (preprocessed) program that is explored.
+     * @param visibleExpressions The expressions that need to be preserved by the reduction (e.g. of labels that are built).
+     */
+    PartialOrderReduction(storm::prism::Program const& program, std::vector<storm::expressions::Expression> const& visibleExpressions);
+
+    /*!
+     * Retrieves whether there is no candidate for ample sets, i.e. whether the reduction leaves all states unchanged.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves the candidates for ample sets.
+     */
+    std::vector<Candidate> const& getCandidates() const;
+
+   private:
+    std::vector<Candidate> candidates;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/any.hpp>
 #include <boost/container/flat_map.hpp>
 
@@ -9,11 +11,13 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 
 #include "storm/generator/Distribution.h"
+#include "storm/generator/VariableRangeAnalysis.h"
 
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/exceptions/VariableRangeExceededException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/combinatorics.h"
 #include "storm/utility/constants.h"
@@ -26,7 +30,9 @@ template<typename ValueType, typename StateType>
 PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options,
                                                                        std::shared_ptr<ActionMask<ValueType, StateType>> const& mask)
     : PrismNextStateGenerator<ValueType, StateType>(program.substituteConstantsFormulas(), options, mask, false) {
-    // Intentionally left empty.
+    // The renamings of the modules are only available in the original program.
+    initializeSymmetryReduction(program);
+    initializePartialOrderReduction();
 }
 
 template<typename ValueType, typename StateType>
@@ -39,11 +45,36 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 
     // Only after checking validity of the program, we initialize the variable information.
     this->checkValid();
-    this->variableInformation = VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet());
+    std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> integerVariableRanges;
+    if (options.isVariableRangeAnalysisSet()) {
+        // Symmetric modules need to be encoded in the same way and the out-of-bounds state relies on the declared bounds.
+        if (options.isSymmetryReductionSet() || options.isAddOutOfBoundsStateSet()) {
+            STORM_LOG_WARN("The variable range analysis is not applied together with symmetry reduction or an out-of-bounds state.");
+        } else {
+            integerVariableRanges = computeIntegerVariableRanges(program, options.getReservedBitsForUnboundedVariables());
+        }
+    }
+    this->variableInformation =
+        VariableInformation(program, options.getReservedBitsForUnboundedVariables(), options.isAddOutOfBoundsStateSet(), integerVariableRanges);
+    if (!integerVariableRanges.empty()) {
+        auto const& integerVariables = this->variableInformation.integerVariables;
+        STORM_LOG_INFO("Narrowed the ranges of " << std::count_if(integerVariables.begin(), integerVariables.end(),
+                                                                  [](auto const& variable) { return variable.narrowedRange; })
+                                                 << " integer variables, which leads to " << this->variableInformation.getTotalBitOffset()
+                                                 << " bits per state.");
+    }
 
     // Create a proper evalator.
     this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
 
+    // Prepare the caching of the values of the guards.
+    guardTable = GuardTable(this->variableInformation, options.getMaximalGuardTableBits());
+    for (auto const& module : this->program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            guardTable.addGuard(command.getGlobalIndex(), command.getGuardExpression());
+        }
+    }
+
     if (this->options.isBuildAllRewardModelsSet()) {
         for (auto const& rewardModel : this->program.getRewardModels()) {
             rewardModels.push_back(rewardModel);
@@ -75,21 +106,25 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
 
     // If there are terminal states we need to handle, we now need to translate all labels to expressions.
     if (this->options.hasTerminalStates()) {
-        for (auto const& expressionOrLabelAndBool : this->options.getTerminalStates()) {
-            if (expressionOrLabelAndBool.first.isExpression()) {
-                this->terminalStates.push_back(std::make_pair(expressionOrLabelAndBool.first.getExpression(), expressionOrLabelAndBool.second));
+        auto translate = [this](storm::builder::LabelOrExpression const& labelOrExpression) -> boost::optional<storm::expressions::Expression> {
+            if (labelOrExpression.isExpression()) {
+                return labelOrExpression.getExpression();
+            } else if (this->program.hasLabel(labelOrExpression.getLabel())) {
+                return this->program.getLabelExpression(labelOrExpression.getLabel());
             } else {
-                if (program.hasLabel(expressionOrLabelAndBool.first.getLabel())) {
-                    this->terminalStates.push_back(
-                        std::make_pair(this->program.getLabelExpression(expressionOrLabelAndBool.first.getLabel()), expressionOrLabelAndBool.second));
-                } else {
-                    // If the label is not present in the program and is not a special one, we raise an error.
-                    STORM_LOG_THROW(expressionOrLabelAndBool.first.getLabel() == "init" || expressionOrLabelAndBool.first.getLabel() == "deadlock",
-                                    storm::exceptions::InvalidArgumentException,
-                                    "Terminal states refer to illegal label '" << expressionOrLabelAndBool.first.getLabel() << "'.");
-                }
+                // If the label is not present in the program and is not a special one, we raise an error.
+                STORM_LOG_THROW(labelOrExpression.getLabel() == "init" || labelOrExpression.getLabel() == "deadlock",
+                                storm::exceptions::InvalidArgumentException,
+                                "Terminal states refer to illegal label '" << labelOrExpression.getLabel() << "'.");
+                return boost::none;
+            }
+        };
+        for (auto const& expressionOrLabelAndBool : this->options.getTerminalStates()) {
+            if (auto expression = translate(expressionOrLabelAndBool.first)) {
+                this->terminalStates.push_back(std::make_pair(expression.get(), expressionOrLabelAndBool.second));
             }
         }
+        this->addTerminalStateSets(translate);
     }
 
     if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
@@ -98,6 +133,143 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
     }
 }
 
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializeSymmetryReduction(storm::prism::Program const& originalProgram) {
+    if (!this->options.isSymmetryReductionSet()) {
+        return;
+    }
+    if (program.isPartiallyObservable() || program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        STORM_LOG_WARN("Symmetry reduction is not supported for partially observable models and games.");
+        return;
+    }
+
+    auto addRewardModel = [](storm::prism::RewardModel const& rewardModel, std::vector<storm::expressions::Expression>& expressions,
+                             std::set<std::string>& actions) {
+        for (auto const& stateReward : rewardModel.getStateRewards()) {
+            expressions.push_back(stateReward.getStatePredicateExpression());
+            expressions.push_back(stateReward.getRewardValueExpression());
+        }
+        for (auto const& stateActionReward : rewardModel.getStateActionRewards()) {
+            expressions.push_back(stateActionReward.getStatePredicateExpression());
+            expressions.push_back(stateActionReward.getRewardValueExpression());
+            if (stateActionReward.isLabeled()) {
+                actions.insert(stateActionReward.getActionName());
+            }
+        }
+        for (auto const& transitionReward : rewardModel.getTransitionRewards()) {
+            expressions.push_back(transitionReward.getSourceStatePredicateExpression());
+            expressions.push_back(transitionReward.getTargetStatePredicateExpression());
+            expressions.push_back(transitionReward.getRewardValueExpression());
+            if (transitionReward.isLabeled()) {
+                actions.insert(transitionReward.getActionName());
+            }
+        }
+    };
+
+    // Everything that is built needs to respect the symmetry, except for the labels and reward models that are only
+    // built because all of them are requested.
+    std::vector<storm::expressions::Expression> requiredExpressions;
+    std::set<std::string> requiredActions;
+    for (auto const& expressionBool : this->terminalStates) {
+        requiredExpressions.push_back(expressionBool.first);
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        requiredExpressions.push_back(expressionLabel.second);
+    }
+    if (!this->options.isBuildAllLabelsSet()) {
+        for (auto const& labelName : this->options.getLabelNames()) {
+            if (program.hasLabel(labelName)) {
+                requiredExpressions.push_back(program.getLabelExpression(labelName));
+            }
+        }
+    }
+    if (!this->options.isBuildAllRewardModelsSet()) {
+        for (auto const& rewardModel : rewardModels) {
+            addRewardModel(rewardModel.get(), requiredExpressions, requiredActions);
+        }
+    }
+
+    symmetryReduction = SymmetryReduction(originalProgram, program, this->variableInformation, requiredExpressions, requiredActions);
+    STORM_LOG_WARN_COND(!symmetryReduction.empty(), "Symmetry reduction was requested, but no fully symmetric set of modules was found.");
+    if (symmetryReduction.empty() || !this->options.isBuildAllRewardModelsSet()) {
+        return;
+    }
+
+    std::vector<std::reference_wrapper<storm::prism::RewardModel const>> symmetricRewardModels;
+    hasStateActionRewards = false;
+    for (auto const& rewardModel : rewardModels) {
+        std::vector<storm::expressions::Expression> expressions;
+        std::set<std::string> actions;
+        addRewardModel(rewardModel.get(), expressions, actions);
+        bool symmetric = std::all_of(expressions.begin(), expressions.end(),
+                                     [this](storm::expressions::Expression const& expression) { return symmetryReduction.isSymmetric(expression); }) &&
+                         std::all_of(actions.begin(), actions.end(), [this](std::string const& action) { return symmetryReduction.isSymmetric(action); });
+        if (symmetric) {
+            symmetricRewardModels.push_back(rewardModel);
+            hasStateActionRewards |= rewardModel.get().hasStateActionRewards();
+        } else {
+            STORM_LOG_WARN("Not building reward model '" << rewardModel.get().getName() << "' as it does not respect the symmetry of the modules.");
+        }
+    }
+    rewardModels = std::move(symmetricRewardModels);
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::reduceSymmetry(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        canonicalState = state;
+        symmetryReduction.canonicalize(canonicalState);
+        return stateToIdCallback(canonicalState);
+    };
+}
+
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+    if (!this->options.isPartialOrderReductionSet()) {
+        return;
+    }
+    if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+        STORM_LOG_WARN("Partial order reduction is only supported for MDPs.");
+        return;
+    }
+    if (!symmetryReduction.empty()) {
+        STORM_LOG_WARN("Partial order reduction can not be combined with symmetry reduction and is therefore not applied.");
+        return;
+    }
+    if (!rewardModels.empty()) {
+        STORM_LOG_WARN("Partial order reduction does not preserve rewards and is therefore not applied.");
+        return;
+    }
+
+    // The commands in ample sets must not change the labels or the terminal states.
+    std::vector<storm::expressions::Expression> visibleExpressions;
+    for (auto const& expressionBool : this->terminalStates) {
+        visibleExpressions.push_back(expressionBool.first);
+    }
+    for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+        visibleExpressions.push_back(expressionLabel.second);
+    }
+    for (auto const& label : program.getLabels()) {
+        if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+            visibleExpressions.push_back(label.getStatePredicateExpression());
+        }
+    }
+
+    partialOrderReduction = PartialOrderReduction(program, visibleExpressions);
+    STORM_LOG_WARN_COND(!partialOrderReduction.empty(), "Partial order reduction was requested, but no command can form an ample set.");
+}
+
+template<typename ValueType, typename StateType>
+typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::trackKnownStates(
+    StateToIdCallback const& stateToIdCallback) {
+    return [this, &stateToIdCallback](CompressedState const& state) {
+        StateType stateIndex = stateToIdCallback(state);
+        numberOfKnownStates = std::max<StateType>(numberOfKnownStates, stateIndex + 1);
+        return stateIndex;
+    };
+}
+
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::canHandle(storm::prism::Program const& program) {
     // We can handle all valid prism programs (except for PTAs)
@@ -173,7 +345,17 @@ bool PrismNextStateGenerator<ValueType, StateType>::isPartiallyObservable() cons
 }
 
 template<typename ValueType, typename StateType>
-std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& originalStateToIdCallback) {
+    // If the symmetry of modules is exploited, only the representatives of the states are registered.
+    // For the partial order reduction, the registered states are tracked.
+    StateToIdCallback reducedStateToIdCallback;
+    if (!symmetryReduction.empty()) {
+        reducedStateToIdCallback = reduceSymmetry(originalStateToIdCallback);
+    } else if (!partialOrderReduction.empty()) {
+        reducedStateToIdCallback = trackKnownStates(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = reducedStateToIdCallback ? reducedStateToIdCallback : originalStateToIdCallback;
+
     std::vector<StateType> initialStateIndices;
 
     // If all states are initial, we can simplify the enumeration substantially.
@@ -274,10 +456,46 @@ std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitial
 }
 
 template<typename ValueType, typename StateType>
-StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+void PrismNextStateGenerator<ValueType, StateType>::prepareBatch(std::vector<CompressedState> const& states) {
+    batchStates.clear();
+    batchPosition = 0;
+    if (!guardBatch) {
+        guardBatch = GuardBatch(this->variableInformation);
+        for (auto const& module : this->program.getModules()) {
+            for (auto const& command : module.getCommands()) {
+                guardBatch->addGuard(command.getGlobalIndex(), command.getGuardExpression());
+            }
+        }
+    }
+    if (guardBatch->isSupported()) {
+        guardBatch->evaluate(states);
+        batchStates = states;
+    }
+}
+
+template<typename ValueType, typename StateType>
+StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& originalStateToIdCallback) {
+    // If the symmetry of modules is exploited, only the representatives of the successors are registered.
+    // For the partial order reduction, the registered states are tracked.
+    StateToIdCallback reducedStateToIdCallback;
+    if (!symmetryReduction.empty()) {
+        reducedStateToIdCallback = reduceSymmetry(originalStateToIdCallback);
+    } else if (!partialOrderReduction.empty()) {
+        reducedStateToIdCallback = trackKnownStates(originalStateToIdCallback);
+    }
+    StateToIdCallback const& stateToIdCallback = reducedStateToIdCallback ? reducedStateToIdCallback : originalStateToIdCallback;
+
     // Prepare the result, in case we return early.
     StateBehavior<ValueType, StateType> result;
 
+    // Use the values of the guards of the prepared batch if the loaded state is the next state of the batch.
+    batchGuardsAvailable = batchPosition < batchStates.size() && batchStates[batchPosition] == *this->state;
+    if (batchGuardsAvailable) {
+        currentBatchPosition = batchPosition++;
+    } else {
+        batchStates.clear();
+    }
+
     // First, construct the state rewards, as we may return early if there are no choices later and we already
     // need the state rewards then.
     for (auto const& rewardModel : rewardModels) {
@@ -304,19 +522,25 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     // Get all choices for the state.
     result.setExpanded();
 
+    // If possible, only the choice of an ample set is explored.
     std::vector<Choice<ValueType>> allChoices;
-    if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
-        // First explore only edges without a rate
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
-        if (allChoices.empty()) {
-            // Expand the Markovian edges if there are no probabilistic ones.
-            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
-            addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
+    if (!partialOrderReduction.empty() && this->actionMask == nullptr) {
+        allChoices = getAmpleChoices(*this->state, stateToIdCallback);
+    }
+    if (allChoices.empty()) {
+        if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+            // First explore only edges without a rate
+            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+            addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
+            if (allChoices.empty()) {
+                // Expand the Markovian edges if there are no probabilistic ones.
+                allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+                addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
+            }
+        } else {
+            allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
+            addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
         }
-    } else {
-        allChoices = getAsynchronousChoices(*this->state, stateToIdCallback);
-        addSynchronousChoices(allChoices, *this->state, stateToIdCallback);
     }
 
     std::size_t totalNumberOfChoices = allChoices.size();
@@ -409,10 +633,9 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
         }
     }
 
-    // Move all remaining choices in place.
-    for (auto& choice : allChoices) {
-        result.addChoice(std::move(choice));
-    }
+    // Move all remaining choices in place. As the result does not have any choices yet, the vector is moved as a whole.
+    STORM_LOG_ASSERT(result.getChoices().empty(), "Expected no choices.");
+    result.getChoices() = std::move(allChoices);
 
     this->postprocess(result);
 
@@ -425,9 +648,15 @@ bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInC
 }
 
 template<typename ValueType, typename StateType>
-CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
-    CompressedState newState(state);
+bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(prism::Command const& command) {
+    if (batchGuardsAvailable) {
+        return guardBatch->getValue(command.getGlobalIndex(), currentBatchPosition);
+    }
+    return guardTable.evaluate(command.getGlobalIndex(), *this->state, *this->evaluator);
+}
 
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState& newState, storm::prism::Update const& update) {
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
     // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -452,9 +681,15 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
             ++integerIt;
         }
         int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        STORM_LOG_THROW(!integerIt->narrowedRange || (assignedValue >= integerIt->lowerBound && assignedValue <= integerIt->upperBound),
+                        storm::exceptions::VariableRangeExceededException,
+                        "The update " << update << " leads to the value " << assignedValue << " of variable '" << assignmentIt->getVariableName()
+                                      << "', which is outside of its range [" << integerIt->lowerBound << ", " << integerIt->upperBound
+                                      << "] computed by the variable range analysis.");
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
-                return this->outOfBoundsState;
+                newState = this->outOfBoundsState;
+                return;
             }
         } else if (integerIt->forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
             STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException,
@@ -472,31 +707,28 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
 
     // Check that we processed all assignments.
     STORM_LOG_ASSERT(assignmentIt == assignmentIte, "Not all assignments were consumed.");
-
-    return newState;
 }
 
-struct ActiveCommandData {
-    ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
-                      typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
-        : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
-        // Intentionally left empty
-    }
-    storm::prism::Module const* modulePtr;
-    std::set<uint_fast64_t> const* commandIndicesPtr;
-    typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
-};
+template<typename ValueType, typename StateType>
+PrismNextStateGenerator<ValueType, StateType>::ActiveCommandData::ActiveCommandData(storm::prism::Module const* modulePtr,
+                                                                                    std::set<uint_fast64_t> const* commandIndicesPtr,
+                                                                                    typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt)
+    : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+    // Intentionally left empty
+}
 
 template<typename ValueType, typename StateType>
-boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>>
-PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(uint_fast64_t const& actionIndex, CommandFilter const& commandFilter) {
+bool PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(
+    uint_fast64_t const& actionIndex, std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>& activeCommandLists,
+    CommandFilter const& commandFilter) {
     // First check whether there is at least one enabled command at each module
     // This avoids evaluating unnecessarily many guards.
-    // If we find one module without an enabled command, we return boost::none.
+    // If we find one module without an enabled command, we return false.
     // At the same time, we store pointers to the relevant modules, the relevant command sets and the first enabled command within each set.
 
     // Iterate over all modules.
-    std::vector<ActiveCommandData> activeCommands;
+    auto& activeCommands = activeCommandData;
+    activeCommands.clear();
     for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
         storm::prism::Module const& module = program.getModule(i);
 
@@ -510,7 +742,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         // If the module contains the action, but there is no command in the module that is labeled with
         // this action, we don't have any feasible command combinations.
         if (commandIndices.empty()) {
-            return boost::none;
+            return false;
         }
 
         // Look up commands by their indices and check if the guard evaluates to true in the given state.
@@ -526,7 +758,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -535,16 +767,19 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
         }
 
         if (!hasOneEnabledCommand) {
-            return boost::none;
+            return false;
         }
     }
 
-    // If we reach this point, there has to be at least one active command for each relevant module.
-    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> result;
+    // If we reach this point, there has to be at least one active command for each relevant module. The lists of
+    // a previous call are cleared (rather than discarded) to reuse their storage.
+    activeCommandLists.resize(activeCommands.size());
 
     // Iterate over all command sets.
-    for (auto const& activeCommand : activeCommands) {
-        std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
+    for (uint64_t listIndex = 0; listIndex < activeCommands.size(); ++listIndex) {
+        auto const& activeCommand = activeCommands[listIndex];
+        auto& commands = activeCommandLists[listIndex];
+        commands.clear();
 
         auto commandIndexIt = activeCommand.currentCommandIndexIt;
         // The command at the current position is already known to be enabled
@@ -560,16 +795,14 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (isCommandEnabled(command)) {
                 commands.push_back(command);
             }
         }
-
-        result.push_back(std::move(commands));
     }
 
-    STORM_LOG_ASSERT(!result.empty(), "Expected non-empty list.");
-    return result;
+    STORM_LOG_ASSERT(!activeCommandLists.empty(), "Expected non-empty list.");
+    return true;
 }
 
 template<typename ValueType, typename StateType>
@@ -603,71 +836,117 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!isCommandEnabled(command)) {
                 continue;
             }
 
-            result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-            Choice<ValueType>& choice = result.back();
-
-            // Remember the choice origin only if we were asked to.
-            if (this->options.isBuildChoiceOriginsSet()) {
-                CommandSet commandIndex{command.getGlobalIndex()};
-                choice.addOriginData(boost::any(std::move(commandIndex)));
-            }
+            addAsynchronousChoice(result, i, command, state, stateToIdCallback);
+        }
+    }
 
-            // Iterate over all updates of the current command.
-            ValueType probabilitySum = storm::utility::zero<ValueType>();
-            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                storm::prism::Update const& update = command.getUpdate(k);
+    return result;
+}
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                if (probability != storm::utility::zero<ValueType>()) {
-                    // Obtain target state index and add it to the list of known states. If it has not yet been
-                    // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint64_t moduleIndex,
+                                                                          storm::prism::Command const& command, CompressedState const& state,
+                                                                          StateToIdCallback stateToIdCallback) {
+    choices.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+    Choice<ValueType>& choice = choices.back();
+    choice.reserve(command.getNumberOfUpdates());
+
+    // Remember the choice origin only if we were asked to.
+    if (this->options.isBuildChoiceOriginsSet()) {
+        CommandSet commandIndex{command.getGlobalIndex()};
+        choice.addOriginData(boost::any(std::move(commandIndex)));
+    }
 
-                    // Update the choice by adding the probability/target state to it.
-                    choice.addProbability(stateIndex, probability);
-                    if (this->options.isExplorationChecksSet()) {
-                        probabilitySum += probability;
-                    }
-                }
+    // Iterate over all updates of the current command.
+    ValueType probabilitySum = storm::utility::zero<ValueType>();
+    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+        storm::prism::Update const& update = command.getUpdate(k);
+
+        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+        if (probability != storm::utility::zero<ValueType>()) {
+            // Obtain target state index and add it to the list of known states. If it has not yet been
+            // seen, we also add it to the set of states that have yet to be explored.
+            successorState = state;
+            applyUpdate(successorState, update);
+            StateType stateIndex = stateToIdCallback(successorState);
+
+            // Update the choice by adding the probability/target state to it.
+            choice.addProbability(stateIndex, probability);
+            if (this->options.isExplorationChecksSet()) {
+                probabilitySum += probability;
             }
+        }
+    }
 
-            // Create the state-action reward for the newly created choice.
-            for (auto const& rewardModel : rewardModels) {
-                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                if (rewardModel.get().hasStateActionRewards()) {
-                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                        if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
-                            this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                        }
-                    }
+    // Create the state-action reward for the newly created choice.
+    for (auto const& rewardModel : rewardModels) {
+        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+        if (rewardModel.get().hasStateActionRewards()) {
+            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                if (stateActionReward.getActionIndex() == choice.getActionIndex() &&
+                    this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                 }
-                choice.addReward(stateActionRewardValue);
             }
+        }
+        choice.addReward(stateActionRewardValue);
+    }
 
-            if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
-                choice.addLabel(program.getActionName(command.getActionIndex()));
-            }
+    if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+        choice.addLabel(program.getActionName(command.getActionIndex()));
+    }
 
-            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
-                storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(i);
-                STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
-                                "Module " << module.getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
-                choice.setPlayerIndex(playerOfModule);
-            }
+    if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+        storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(moduleIndex);
+        STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException,
+                        "Module " << program.getModule(moduleIndex).getName()
+                                  << " is not owned by any player but has at least one enabled, unlabeled command.");
+        choice.setPlayerIndex(playerOfModule);
+    }
 
-            if (this->options.isExplorationChecksSet()) {
-                // Check that the resulting distribution is in fact a distribution.
-                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
-                                "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
-            }
-        }
+    if (this->options.isExplorationChecksSet()) {
+        // Check that the resulting distribution is in fact a distribution.
+        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException,
+                        "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
     }
+}
 
+template<typename ValueType, typename StateType>
+std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoices(CompressedState const& state,
+                                                                                              StateToIdCallback stateToIdCallback) {
+    std::vector<Choice<ValueType>> result;
+    for (auto const& candidate : partialOrderReduction.getCandidates()) {
+        storm::prism::Module const& module = program.getModule(candidate.moduleIndex);
+        storm::prism::Command const& command = module.getCommand(candidate.commandIndex);
+        if (!isCommandEnabled(command)) {
+            continue;
+        }
+
+        // The command only forms an ample set if no other command of its module is enabled.
+        bool otherCommandEnabled = false;
+        for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands() && !otherCommandEnabled; ++commandIndex) {
+            otherCommandEnabled = commandIndex != candidate.commandIndex && isCommandEnabled(module.getCommand(commandIndex));
+        }
+        if (otherCommandEnabled) {
+            continue;
+        }
+
+        // Successors that turn out to be known are registered anyway. This is fine, as the choice of the command is also
+        // part of the full expansion.
+        StateType numberOfPreviouslyKnownStates = numberOfKnownStates;
+        addAsynchronousChoice(result, candidate.moduleIndex, command, state, stateToIdCallback);
+        bool onlyNewSuccessors = std::all_of(result.back().begin(), result.back().end(), [numberOfPreviouslyKnownStates](auto const& stateProbabilityPair) {
+            return stateProbabilityPair.first >= numberOfPreviouslyKnownStates;
+        });
+        if (onlyNewSuccessors) {
+            return result;
+        }
+        result.clear();
+    }
     return result;
 }
 
@@ -684,11 +963,15 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         StateType id = stateToIdCallback(state);
         distribution.add(id, probability);
     } else {
+        // Every position has its own successor state, which is reused for all updates.
+        CompressedState& successor = synchronizedSuccessorStates[position];
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            successor = state;
+            applyUpdate(successor, update);
+            generateSynchronizedDistribution(successor, probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1,
+                                             iteratorList, distribution, stateToIdCallback);
         }
     }
 }
@@ -702,20 +985,21 @@ void PrismNextStateGenerator<ValueType, StateType>::addSynchronousChoices(std::v
                 continue;
             }
         }
-        boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> optionalActiveCommandLists =
-            getActiveCommandsByActionIndex(actionIndex, commandFilter);
-
         // Only process this action label, if there is at least one feasible solution.
-        if (optionalActiveCommandLists) {
-            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> const& activeCommandList = optionalActiveCommandLists.get();
-            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> iteratorList(activeCommandList.size());
+        if (getActiveCommandsByActionIndex(actionIndex, activeCommandLists, commandFilter)) {
+            std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> const& activeCommandList = activeCommandLists;
+            auto& iteratorList = activeCommandIterators;
+            iteratorList.resize(activeCommandList.size());
+            if (synchronizedSuccessorStates.size() < activeCommandList.size()) {
+                synchronizedSuccessorStates.resize(activeCommandList.size());
+            }
 
             // Initialize the list of iterators.
             for (size_t i = 0; i < activeCommandList.size(); ++i) {
                 iteratorList[i] = activeCommandList[i].cbegin();
             }
 
-            storm::generator::Distribution<StateType, ValueType> distribution;
+            auto& distribution = synchronizedDistribution;
 
             // As long as there is one feasible combination of commands, keep on expanding it.
             bool done = false;
@@ -814,6 +1098,10 @@ storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateTyp
     std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
     if (this->options.isBuildAllLabelsSet()) {
         for (auto const& label : program.getLabels()) {
+            if (!symmetryReduction.isSymmetric(label.getStatePredicateExpression())) {
+                STORM_LOG_WARN("Not building label '" << label.getName() << "' as it does not respect the symmetry of the modules.");
+                continue;
+            }
             labels.push_back(std::make_pair(label.getName(), label.getStatePredicateExpression()));
         }
     } else {
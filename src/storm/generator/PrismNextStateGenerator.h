@@ -1,15 +1,20 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <boost/optional.hpp>
+
+#include "storm/generator/Distribution.h"
+#include "storm/generator/GuardBatch.h"
+#include "storm/generator/GuardTable.h"
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/PartialOrderReduction.h"
+#include "storm/generator/SymmetryReduction.h"
 
 #include "storm/storage/BoostTypes.h"
 #include "storm/storage/prism/Program.h"
 
 namespace storm {
 namespace generator {
-template<typename StateType, typename ValueType>
-class Distribution;
 
 template<typename ValueType, typename StateType = uint32_t>
 class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
@@ -35,6 +40,7 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
 
     virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+    virtual void prepareBatch(std::vector<CompressedState> const& states) override;
     bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const&) const;
 
     virtual std::size_t getNumberOfRewardModels() const override;
@@ -50,6 +56,40 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
    private:
     void checkValid() const;
 
+    /*!
+     * Detects the fully symmetric sets of modules if symmetry reduction is requested. Reward models that do not respect
+     * the symmetry are dropped if they are only built because all reward models are requested.
+     *
+     * @param originalProgram The program as it was given, which contains the information about renamed modules.
+     */
+    void initializeSymmetryReduction(storm::prism::Program const& originalProgram);
+
+    /*!
+     * Creates a callback that replaces the states by the representatives of their equivalence classes under the
+     * symmetry before passing them to the given callback.
+     */
+    StateToIdCallback reduceSymmetry(StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Determines the commands that may form ample sets if partial order reduction is requested and applicable.
+     */
+    void initializePartialOrderReduction();
+
+    /*!
+     * Creates a callback that keeps track of the number of states registered by the given callback, which is needed
+     * to ensure the cycle proviso of the partial order reduction.
+     */
+    StateToIdCallback trackKnownStates(StateToIdCallback const& stateToIdCallback);
+
+    /*!
+     * Retrieves the choice of a command that forms an ample set in the given state. A command only qualifies if all
+     * its successors are new states, which ensures that every cycle of the reduced model contains a fully expanded
+     * state (cycle proviso).
+     *
+     * @return The choice of the ample set or no choice if the state needs to be fully expanded.
+     */
+    std::vector<Choice<ValueType>> getAmpleChoices(CompressedState const& state, StateToIdCallback stateToIdCallback);
+
     /*!
      * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
      * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -61,11 +101,11 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     /*!
      * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
      * the given compressed state.
-     * @params state The state to which to apply the new values.
+     * @params state The state to which to apply the new values. If the update leads out of bounds and the
+     * out-of-bounds state is built, it is replaced by the out-of-bounds state.
      * @params update The update to apply.
-     * @return The resulting state.
      */
-    CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+    void applyUpdate(CompressedState& state, storm::prism::Update const& update);
 
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -81,10 +121,13 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      * @param The program in which to search for active commands.
      * @param state The current state.
      * @param actionIndex The index of the action label to select.
-     * @return A list of lists of active commands or nothing.
+     * @param activeCommandLists If there is a legal transition, this is set to the list of lists of active commands.
+     * The storage of the lists is reused between calls.
+     * @return True iff there is a legal transition.
      */
-    boost::optional<std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>> getActiveCommandsByActionIndex(
-        uint_fast64_t const& actionIndex, CommandFilter const& commandFilter = CommandFilter::All);
+    bool getActiveCommandsByActionIndex(uint_fast64_t const& actionIndex,
+                                        std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>>& activeCommandLists,
+                                        CommandFilter const& commandFilter = CommandFilter::All);
 
     /*!
      * Retrieves all choices that are definitively asynchronous, possible from the given state.
@@ -95,6 +138,12 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback,
                                                           CommandFilter const& commandFilter = CommandFilter::All);
 
+    /*!
+     * Adds the choice of the given (enabled and asynchronous) command of the module with the given index to the choices.
+     */
+    void addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint64_t moduleIndex, storm::prism::Command const& command,
+                               CompressedState const& state, StateToIdCallback stateToIdCallback);
+
     /*!
      * Retrieves all (potentially) synchronous choices possible from the given state.
      * Note that these may include choices that run asynchronously for this state.
@@ -125,18 +174,63 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Checks whether the guard of the given command is satisfied in the state that is currently loaded.
+     */
+    bool isCommandEnabled(prism::Command const& command);
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
+    // The cached values of the guards of the commands (indexed by the global command index).
+    GuardTable guardTable;
+
+    // The evaluator of the guards for batches of states (created when the first batch is prepared), the states of the
+    // prepared batch and the position of the next state to expand within the batch. If the state that is expanded is
+    // not the next state of the batch, the batch is discarded.
+    boost::optional<GuardBatch> guardBatch;
+    std::vector<CompressedState> batchStates;
+    uint64_t batchPosition = 0;
+
+    // Whether the guards of the currently expanded state are available from the batch, and its position in the batch.
+    bool batchGuardsAvailable = false;
+    uint64_t currentBatchPosition = 0;
+
     // The reward models that need to be considered.
     std::vector<std::reference_wrapper<storm::prism::RewardModel const>> rewardModels;
 
+    // The symmetry of the modules that is exploited (if requested) and the storage for the canonicalized states.
+    SymmetryReduction symmetryReduction;
+    CompressedState canonicalState;
+
+    // The commands that may form ample sets (if partial order reduction is requested) and the number of states that
+    // were registered so far. States are assumed to be numbered consecutively in the order of their registration.
+    PartialOrderReduction partialOrderReduction;
+    StateType numberOfKnownStates = 0;
+
     // A flag that stores whether at least one of the selected reward models has state-action rewards.
     bool hasStateActionRewards;
 
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    struct ActiveCommandData {
+        ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr,
+                          typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt);
+
+        storm::prism::Module const* modulePtr;
+        std::set<uint_fast64_t> const* commandIndicesPtr;
+        typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
+    };
+
+    // Storage that is reused while expanding states to avoid allocating memory for every state.
+    CompressedState successorState;
+    std::vector<CompressedState> synchronizedSuccessorStates;
+    std::vector<ActiveCommandData> activeCommandData;
+    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> activeCommandLists;
+    std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>::const_iterator> activeCommandIterators;
+    storm::generator::Distribution<StateType, ValueType> synchronizedDistribution;
 };
 
 }  // namespace generator
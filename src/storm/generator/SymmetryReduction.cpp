@@ -0,0 +1,382 @@
+#include "storm/generator/SymmetryReduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/OperatorType.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+bool isAssociative(storm::expressions::OperatorType const& operatorType) {
+    switch (operatorType) {
+        case storm::expressions::OperatorType::And:
+        case storm::expressions::OperatorType::Or:
+        case storm::expressions::OperatorType::Xor:
+        case storm::expressions::OperatorType::Iff:
+        case storm::expressions::OperatorType::Plus:
+        case storm::expressions::OperatorType::Times:
+        case storm::expressions::OperatorType::Min:
+        case storm::expressions::OperatorType::Max:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isCommutative(storm::expressions::OperatorType const& operatorType) {
+    switch (operatorType) {
+        case storm::expressions::OperatorType::Equal:
+        case storm::expressions::OperatorType::NotEqual:
+        case storm::expressions::OperatorType::AtLeastOneOf:
+        case storm::expressions::OperatorType::AtMostOneOf:
+        case storm::expressions::OperatorType::ExactlyOneOf:
+            return true;
+        default:
+            return isAssociative(operatorType);
+    }
+}
+
+std::string toCanonicalString(storm::expressions::Expression const& expression);
+
+void collectOperands(storm::expressions::Expression const& expression, storm::expressions::OperatorType const& operatorType,
+                     std::vector<std::string>& operands) {
+    if (expression.isFunctionApplication() && expression.getOperator() == operatorType && expression.getArity() == 2) {
+        collectOperands(expression.getOperand(0), operatorType, operands);
+        collectOperands(expression.getOperand(1), operatorType, operands);
+    } else {
+        operands.push_back(toCanonicalString(expression));
+    }
+}
+
+/*!
+ * Creates a string representation of the expression that is equal for all expressions that only differ in the order of
+ * the operands of associative and commutative operators.
+ */
+std::string toCanonicalString(storm::expressions::Expression const& expression) {
+    if (!expression.isFunctionApplication()) {
+        return expression.toString();
+    }
+
+    storm::expressions::OperatorType operatorType = expression.getOperator();
+    std::vector<std::string> operands;
+    if (isAssociative(operatorType) && expression.getArity() == 2) {
+        collectOperands(expression, operatorType, operands);
+    } else {
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            operands.push_back(toCanonicalString(expression.getOperand(operandIndex)));
+        }
+    }
+    if (isCommutative(operatorType)) {
+        std::sort(operands.begin(), operands.end());
+    }
+
+    std::stringstream stream;
+    stream << "(" << operatorType << "/" << operands.size();
+    for (auto const& operand : operands) {
+        stream << " " << operand;
+    }
+    stream << ")";
+    return stream.str();
+}
+
+std::vector<storm::expressions::Expression> getExpressions(storm::prism::Module const& module) {
+    std::vector<storm::expressions::Expression> result;
+    for (auto const& command : module.getCommands()) {
+        result.push_back(command.getGuardExpression());
+        for (auto const& update : command.getUpdates()) {
+            result.push_back(update.getLikelihoodExpression());
+            for (auto const& assignment : update.getAssignments()) {
+                result.push_back(assignment.getExpression());
+            }
+        }
+    }
+    return result;
+}
+}  // namespace
+
+SymmetryReduction::SymmetryReduction(storm::prism::Program const& originalProgram, storm::prism::Program const& program,
+                                     VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& requiredExpressions,
+                                     std::set<std::string> const& requiredActions) {
+    // Group the modules by the module they are renamed from.
+    std::map<std::string, uint64_t> moduleIndices;
+    for (uint64_t moduleIndex = 0; moduleIndex < originalProgram.getNumberOfModules(); ++moduleIndex) {
+        moduleIndices[originalProgram.getModule(moduleIndex).getName()] = moduleIndex;
+    }
+    std::map<uint64_t, std::vector<uint64_t>> renamedModules;
+    for (uint64_t moduleIndex = 0; moduleIndex < originalProgram.getNumberOfModules(); ++moduleIndex) {
+        auto const& module = originalProgram.getModule(moduleIndex);
+        if (module.isRenamedFromModule()) {
+            auto baseIt = moduleIndices.find(module.getBaseModule());
+            if (baseIt != moduleIndices.end() && !originalProgram.getModule(baseIt->second).isRenamedFromModule()) {
+                renamedModules[baseIt->second].push_back(moduleIndex);
+            }
+        }
+    }
+
+    auto getBlock = [&variableInformation](storm::expressions::Variable const& variable) -> boost::optional<std::pair<std::pair<uint64_t, uint64_t>, int64_t>> {
+        for (auto const& booleanVariable : variableInformation.booleanVariables) {
+            if (booleanVariable.variable == variable) {
+                return std::make_pair(std::make_pair(static_cast<uint64_t>(booleanVariable.bitOffset), static_cast<uint64_t>(1)), static_cast<int64_t>(0));
+            }
+        }
+        for (auto const& integerVariable : variableInformation.integerVariables) {
+            if (integerVariable.variable == variable) {
+                return std::make_pair(std::make_pair(static_cast<uint64_t>(integerVariable.bitOffset), static_cast<uint64_t>(integerVariable.bitWidth)),
+                                      static_cast<int64_t>(integerVariable.lowerBound));
+            }
+        }
+        return boost::none;
+    };
+
+    for (auto const& baseAndRenamedModules : renamedModules) {
+        uint64_t const baseIndex = baseAndRenamedModules.first;
+        std::vector<uint64_t> setIndices = {baseIndex};
+        setIndices.insert(setIndices.end(), baseAndRenamedModules.second.begin(), baseAndRenamedModules.second.end());
+        storm::prism::Module const& baseModule = originalProgram.getModule(baseIndex);
+
+        auto detect = [&](ModuleSet& moduleSet) {
+            std::vector<std::string> baseVariableNames;
+            for (auto const& booleanVariable : baseModule.getBooleanVariables()) {
+                baseVariableNames.push_back(booleanVariable.getName());
+            }
+            for (auto const& integerVariable : baseModule.getIntegerVariables()) {
+                baseVariableNames.push_back(integerVariable.getName());
+            }
+            if (baseVariableNames.empty() || !baseModule.getClockVariables().empty()) {
+                STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as it does not have (only) discrete variables.");
+                return false;
+            }
+            std::set<std::string> baseActions;
+            for (auto const& actionIndex : baseModule.getSynchronizingActionIndices()) {
+                baseActions.insert(originalProgram.getActionName(actionIndex));
+            }
+
+            // The renamings may only rename the variables and actions of the base module.
+            for (auto const& moduleIndex : baseAndRenamedModules.second) {
+                for (auto const& oldAndNewName : originalProgram.getModule(moduleIndex).getRenaming()) {
+                    if (std::find(baseVariableNames.begin(), baseVariableNames.end(), oldAndNewName.first) == baseVariableNames.end() &&
+                        baseActions.count(oldAndNewName.first) == 0) {
+                        STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as module "
+                                                                                << originalProgram.getModule(moduleIndex).getName() << " renames '"
+                                                                                << oldAndNewName.first << "'.");
+                        return false;
+                    }
+                }
+            }
+
+            // Collect the variables of the modules and their positions in the states.
+            for (auto const& moduleIndex : setIndices) {
+                std::vector<storm::expressions::Variable> variables;
+                std::vector<std::pair<uint64_t, uint64_t>> block;
+                for (uint64_t position = 0; position < baseVariableNames.size(); ++position) {
+                    std::string name = baseVariableNames[position];
+                    if (moduleIndex != baseIndex) {
+                        auto const& renaming = originalProgram.getModule(moduleIndex).getRenaming();
+                        auto renamingIt = renaming.find(name);
+                        if (renamingIt == renaming.end()) {
+                            return false;
+                        }
+                        name = renamingIt->second;
+                    }
+                    if (!program.getManager().hasVariable(name)) {
+                        return false;
+                    }
+                    variables.push_back(program.getManager().getVariable(name));
+                    auto variableBlock = getBlock(variables.back());
+                    auto baseBlock = getBlock(moduleSet.variables.empty() ? variables.back() : moduleSet.variables.front()[position]);
+                    if (!variableBlock || !baseBlock || variableBlock->first.second != baseBlock->first.second || variableBlock->second != baseBlock->second) {
+                        STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as the ranges of its variables differ.");
+                        return false;
+                    }
+                    block.push_back(variableBlock->first);
+                }
+                moduleSet.variables.push_back(std::move(variables));
+                moduleSet.blocks.push_back(std::move(block));
+            }
+
+            // The actions need to be either shared by all modules or belong to a single module of the set.
+            for (auto const& action : baseActions) {
+                std::set<std::string> actions = {action};
+                for (auto const& moduleIndex : baseAndRenamedModules.second) {
+                    auto const& renaming = originalProgram.getModule(moduleIndex).getRenaming();
+                    auto renamingIt = renaming.find(action);
+                    actions.insert(renamingIt == renaming.end() ? action : renamingIt->second);
+                }
+                if (actions.size() == 1) {
+                    continue;
+                }
+                bool ownedBySingleModules = actions.size() == setIndices.size();
+                for (auto const& moduleAction : actions) {
+                    ownedBySingleModules &= moduleAction == action || baseActions.count(moduleAction) == 0;
+                    if (ownedBySingleModules && originalProgram.hasAction(moduleAction)) {
+                        for (auto const& moduleIndex : originalProgram.getModuleIndicesByAction(moduleAction)) {
+                            ownedBySingleModules &= std::find(setIndices.begin(), setIndices.end(), moduleIndex) != setIndices.end();
+                        }
+                    }
+                }
+                if (!ownedBySingleModules) {
+                    STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as action '" << action
+                                                                            << "' is not renamed symmetrically.");
+                    return false;
+                }
+                moduleSet.moduleActions.insert(actions.begin(), actions.end());
+            }
+            for (auto const& action : requiredActions) {
+                if (moduleSet.moduleActions.count(action) > 0) {
+                    STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as action '" << action
+                                                                            << "' is required but belongs to a single module.");
+                    return false;
+                }
+            }
+
+            // The base module must not refer to the variables of the other modules of the set.
+            std::set<storm::expressions::Variable> otherVariables;
+            for (uint64_t setIndex = 1; setIndex < setIndices.size(); ++setIndex) {
+                otherVariables.insert(moduleSet.variables[setIndex].begin(), moduleSet.variables[setIndex].end());
+            }
+            for (auto const& expression : getExpressions(program.getModule(baseIndex))) {
+                for (auto const& variable : expression.getVariables()) {
+                    if (otherVariables.count(variable) > 0) {
+                        STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as it refers to variable "
+                                                                                << variable.getName() << ".");
+                        return false;
+                    }
+                }
+            }
+
+            // Swapping the first two modules and shifting all modules generates all permutations.
+            uint64_t const numberOfModules = setIndices.size();
+            std::map<storm::expressions::Variable, storm::expressions::Expression> swap;
+            std::map<storm::expressions::Variable, storm::expressions::Expression> shift;
+            for (uint64_t position = 0; position < baseVariableNames.size(); ++position) {
+                swap[moduleSet.variables[0][position]] = moduleSet.variables[1][position].getExpression();
+                swap[moduleSet.variables[1][position]] = moduleSet.variables[0][position].getExpression();
+                for (uint64_t setIndex = 0; setIndex < numberOfModules; ++setIndex) {
+                    shift[moduleSet.variables[setIndex][position]] = moduleSet.variables[(setIndex + 1) % numberOfModules][position].getExpression();
+                }
+            }
+            moduleSet.generators.push_back(std::move(swap));
+            if (numberOfModules > 2) {
+                moduleSet.generators.push_back(std::move(shift));
+            }
+
+            // All remaining parts of the program need to be invariant under the permutations.
+            std::vector<storm::expressions::Expression> expressions = requiredExpressions;
+            expressions.push_back(program.getInitialStatesExpression());
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                if (std::find(setIndices.begin(), setIndices.end(), moduleIndex) == setIndices.end()) {
+                    auto moduleExpressions = getExpressions(program.getModule(moduleIndex));
+                    expressions.insert(expressions.end(), moduleExpressions.begin(), moduleExpressions.end());
+                }
+            }
+            for (auto const& expression : expressions) {
+                if (!isSymmetric(moduleSet, expression)) {
+                    STORM_LOG_INFO("Not exploiting the symmetry of module " << baseModule.getName() << " as expression " << expression
+                                                                            << " is not symmetric.");
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        ModuleSet moduleSet;
+        if (detect(moduleSet)) {
+            STORM_LOG_INFO("Exploiting the symmetry of module " << baseModule.getName() << " and the " << baseAndRenamedModules.second.size()
+                                                                << " modules renamed from it.");
+            moduleSets.push_back(std::move(moduleSet));
+        }
+    }
+}
+
+bool SymmetryReduction::empty() const {
+    return moduleSets.empty();
+}
+
+uint64_t SymmetryReduction::getNumberOfSymmetricModuleSets() const {
+    return moduleSets.size();
+}
+
+void SymmetryReduction::canonicalize(CompressedState& state) const {
+    for (auto const& moduleSet : moduleSets) {
+        uint64_t const numberOfModules = moduleSet.blocks.size();
+        uint64_t const blockSize = moduleSet.blocks.front().size();
+        values.resize(numberOfModules * blockSize);
+        for (uint64_t setIndex = 0; setIndex < numberOfModules; ++setIndex) {
+            for (uint64_t position = 0; position < blockSize; ++position) {
+                auto const& offsetAndWidth = moduleSet.blocks[setIndex][position];
+                values[setIndex * blockSize + position] = state.getAsInt(offsetAndWidth.first, offsetAndWidth.second);
+            }
+        }
+
+        // Sort the blocks lexicographically and write them back in this order.
+        order.resize(numberOfModules);
+        std::iota(order.begin(), order.end(), 0);
+        auto isBlockLess = [this, blockSize](uint64_t first, uint64_t second) {
+            auto firstBlock = values.begin() + first * blockSize;
+            auto secondBlock = values.begin() + second * blockSize;
+            return std::lexicographical_compare(firstBlock, firstBlock + blockSize, secondBlock, secondBlock + blockSize);
+        };
+        if (std::is_sorted(order.begin(), order.end(), isBlockLess)) {
+            continue;
+        }
+        std::sort(order.begin(), order.end(), isBlockLess);
+        for (uint64_t setIndex = 0; setIndex < numberOfModules; ++setIndex) {
+            for (uint64_t position = 0; position < blockSize; ++position) {
+                auto const& offsetAndWidth = moduleSet.blocks[setIndex][position];
+                state.setFromInt(offsetAndWidth.first, offsetAndWidth.second, values[order[setIndex] * blockSize + position]);
+            }
+        }
+    }
+}
+
+bool SymmetryReduction::isSymmetric(storm::expressions::Expression const& expression) const {
+    for (auto const& moduleSet : moduleSets) {
+        if (!isSymmetric(moduleSet, expression)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SymmetryReduction::isSymmetric(std::string const& actionName) const {
+    for (auto const& moduleSet : moduleSets) {
+        if (moduleSet.moduleActions.count(actionName) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SymmetryReduction::isSymmetric(ModuleSet const& moduleSet, storm::expressions::Expression const& expression) const {
+    if (!expression.isInitialized()) {
+        return true;
+    }
+
+    // The last generator affects the variables of all modules.
+    auto const& allVariables = moduleSet.generators.back();
+    bool refersToModules = false;
+    for (auto const& variable : expression.getVariables()) {
+        refersToModules |= allVariables.count(variable) > 0;
+    }
+    if (!refersToModules) {
+        return true;
+    }
+
+    std::string canonicalString = toCanonicalString(expression);
+    for (auto const& generator : moduleSet.generators) {
+        if (toCanonicalString(expression.substitute(generator)) != canonicalString) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Exploits the symmetry of PRISM programs in which several modules are renamed from the same module. If such a set of
+ * modules is fully symmetric, i.e. the program (and everything that is to be built) is invariant under any permutation
+ * of the modules, the states that differ only in the order of the values of these modules are bisimilar. The states are
+ * then canonicalized by sorting the blocks of variables of the modules, such that only one state per equivalence class
+ * is explored.
+ *
+ * A set of modules is considered fully symmetric if
+ * - the renamings only rename the variables and actions of the base module,
+ * - the actions of the base module are either shared by all modules of the set or renamed to actions that are used only
+ *   by a single module of the set,
+ * - the base module does not refer to the variables of the other modules of the set and
+ * - all other expressions of the program (commands of other modules, the initial states) as well as the given ones are
+ *   invariant under permutations of the modules (modulo commutativity and associativity).
+ */
+class SymmetryReduction {
+   public:
+    /*!
+     * Creates a symmetry reduction that does not reduce any state.
+     */
+    SymmetryReduction() = default;
+
+    /*!
+     * Detects the fully symmetric sets of modules of the given program.
+     *
+     * @param originalProgram The program as it was given, which contains the information about renamed modules.
+     * @param program The preprocessed program (with the constants and formulas substituted) that is explored.
+     * @param variableInformation The information about the encoding of the variables in the states.
+     * @param requiredExpressions Expressions that need to be invariant under the symmetry (e.g. of labels that are built).
+     * @param requiredActions Actions that need to be invariant under the symmetry (e.g. of reward models that are built).
+     */
+    SymmetryReduction(storm::prism::Program const& originalProgram, storm::prism::Program const& program, VariableInformation const& variableInformation,
+                      std::vector<storm::expressions::Expression> const& requiredExpressions, std::set<std::string> const& requiredActions);
+
+    /*!
+     * Retrieves whether no symmetric set of modules was found, i.e. whether the reduction leaves all states unchanged.
+     */
+    bool empty() const;
+
+    /*!
+     * Retrieves the number of fully symmetric sets of modules.
+     */
+    uint64_t getNumberOfSymmetricModuleSets() const;
+
+    /*!
+     * Replaces the given state by the representative of its equivalence class.
+     */
+    void canonicalize(CompressedState& state) const;
+
+    /*!
+     * Retrieves whether the given expression is invariant under all permutations of the symmetric sets of modules.
+     */
+    bool isSymmetric(storm::expressions::Expression const& expression) const;
+
+    /*!
+     * Retrieves whether the given action is invariant under all permutations of the symmetric sets of modules.
+     */
+    bool isSymmetric(std::string const& actionName) const;
+
+   private:
+    struct ModuleSet {
+        // The variables of the modules (in the order of the variables of the base module).
+        std::vector<std::vector<storm::expressions::Variable>> variables;
+        // The bit offsets and widths of these variables.
+        std::vector<std::vector<std::pair<uint64_t, uint64_t>>> blocks;
+        // The actions that are renamed such that they belong to a single module of the set.
+        std::set<std::string> moduleActions;
+        // The substitutions that swap the first two modules and that shift all modules by one, which generate all permutations.
+        std::vector<std::map<storm::expressions::Variable, storm::expressions::Expression>> generators;
+    };
+
+    bool isSymmetric(ModuleSet const& moduleSet, storm::expressions::Expression const& expression) const;
+
+    std::vector<ModuleSet> moduleSets;
+
+    // Buffers for the canonicalization of a state.
+    mutable std::vector<uint64_t> values;
+    mutable std::vector<uint64_t> order;
+};
+
+}  // namespace generator
+}  // namespace storm
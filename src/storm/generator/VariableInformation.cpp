@@ -14,6 +14,7 @@
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/macros.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace storm {
@@ -26,7 +27,7 @@ BooleanVariableInformation::BooleanVariableInformation(storm::expressions::Varia
 
 IntegerVariableInformation::IntegerVariableInformation(storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound,
                                                        uint_fast64_t bitOffset, uint_fast64_t bitWidth, bool global, bool observable,
-                                                       bool forceOutOfBoundsCheck)
+                                                       bool forceOutOfBoundsCheck, bool narrowedRange)
     : variable(variable),
       lowerBound(lowerBound),
       upperBound(upperBound),
@@ -34,7 +35,8 @@ IntegerVariableInformation::IntegerVariableInformation(storm::expressions::Varia
       bitWidth(bitWidth),
       global(global),
       observable(observable),
-      forceOutOfBoundsCheck(forceOutOfBoundsCheck) {
+      forceOutOfBoundsCheck(forceOutOfBoundsCheck),
+      narrowedRange(narrowedRange) {
     // Intentionally left empty.
 }
 
@@ -48,18 +50,6 @@ ObservationLabelInformation::ObservationLabelInformation(const std::string& name
     // Intentionally left empty.
 }
 
-/*!
- * Small helper function that sets unspecified lower/upper bounds for an integer variable based on the provided reservedBitsForUnboundedVariables and returns
- * the number of bits required to represent the final variable range
- * @pre If has[Lower,Upper]Bound is true, [lower,upper]Bound must be set to the corresponding bound.
- * @post lowerBound and upperBound are set to the considered bound for this variable
- * @param hasLowerBound shall be true iff there is a lower bound given
- * @param lowerBound a reference to the lower bound value
- * @param hasUpperBound shall be true iff there is an upper bound given
- * @param upperBound a reference to the upper bound
- * @param reservedBitsForUnboundedVariables the number of bits that shall be used to represent unbounded variables
- * @return the number of bits required to represent the final variable range
- */
 uint64_t getBitWidthLowerUpperBound(bool const& hasLowerBound, int64_t& lowerBound, bool const& hasUpperBound, int64_t& upperBound,
                                     uint64_t const& reservedBitsForUnboundedVariables) {
     if (hasLowerBound) {
@@ -92,8 +82,27 @@ uint64_t getBitWidthLowerUpperBound(bool const& hasLowerBound, int64_t& lowerBou
     return reservedBitsForUnboundedVariables;
 }
 
-VariableInformation::VariableInformation(storm::prism::Program const& program, uint64_t reservedBitsForUnboundedVariables, bool outOfBoundsState)
+/*!
+ * Replaces the given bounds of the variable by its range in the given ranges (if any) if the latter is narrower.
+ * @return true iff the bounds were narrowed.
+ */
+bool narrowBounds(storm::expressions::Variable const& variable, std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> const& ranges,
+                  int64_t& lowerBound, int64_t& upperBound, uint64_t& bitwidth) {
+    auto rangeIt = ranges.find(variable);
+    if (rangeIt == ranges.end() || (rangeIt->second.first <= lowerBound && rangeIt->second.second >= upperBound)) {
+        return false;
+    }
+    lowerBound = std::max(lowerBound, rangeIt->second.first);
+    upperBound = std::min(upperBound, rangeIt->second.second);
+    bitwidth = getBitWidthLowerUpperBound(true, lowerBound, true, upperBound, 0);
+    return true;
+}
+
+VariableInformation::VariableInformation(storm::prism::Program const& program, uint64_t reservedBitsForUnboundedVariables, bool outOfBoundsState,
+                                         std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> const& integerVariableRanges)
     : totalBitOffset(0) {
+    // The first component holds the out-of-bounds bit (if any) and the global variables.
+    startComponent();
     if (outOfBoundsState) {
         outOfBoundsBit = 0;
         ++totalBitOffset;
@@ -115,11 +124,14 @@ VariableInformation::VariableInformation(storm::prism::Program const& program, u
         }
         uint64_t bitwidth = getBitWidthLowerUpperBound(integerVariable.hasLowerBoundExpression(), lowerBound, integerVariable.hasUpperBoundExpression(),
                                                        upperBound, reservedBitsForUnboundedVariables);
+        bool narrowed = narrowBounds(integerVariable.getExpressionVariable(), integerVariableRanges, lowerBound, upperBound, bitwidth);
         integerVariables.emplace_back(integerVariable.getExpressionVariable(), lowerBound, upperBound, totalBitOffset, bitwidth, true,
-                                      integerVariable.isObservable(), !integerVariable.hasLowerBoundExpression() || !integerVariable.hasUpperBoundExpression());
+                                      integerVariable.isObservable(), !integerVariable.hasLowerBoundExpression() || !integerVariable.hasUpperBoundExpression(),
+                                      narrowed);
         totalBitOffset += bitwidth;
     }
     for (auto const& module : program.getModules()) {
+        startComponent();
         for (auto const& booleanVariable : module.getBooleanVariables()) {
             booleanVariables.emplace_back(booleanVariable.getExpressionVariable(), totalBitOffset, false, booleanVariable.isObservable());
             ++totalBitOffset;
@@ -134,9 +146,10 @@ VariableInformation::VariableInformation(storm::prism::Program const& program, u
             }
             uint64_t bitwidth = getBitWidthLowerUpperBound(integerVariable.hasLowerBoundExpression(), lowerBound, integerVariable.hasUpperBoundExpression(),
                                                            upperBound, reservedBitsForUnboundedVariables);
+            bool narrowed = narrowBounds(integerVariable.getExpressionVariable(), integerVariableRanges, lowerBound, upperBound, bitwidth);
             integerVariables.emplace_back(integerVariable.getExpressionVariable(), lowerBound, upperBound, totalBitOffset, bitwidth, false,
                                           integerVariable.isObservable(),
-                                          !integerVariable.hasLowerBoundExpression() || !integerVariable.hasUpperBoundExpression());
+                                          !integerVariable.hasLowerBoundExpression() || !integerVariable.hasUpperBoundExpression(), narrowed);
             totalBitOffset += bitwidth;
         }
     }
@@ -159,6 +172,8 @@ VariableInformation::VariableInformation(storm::jani::Model const& model,
                         "Cannot build model from JANI model that contains non-transient real variables in automaton '" << automaton.getName() << "'.");
     }
 
+    // The first component holds the out-of-bounds bit (if any) and the global variables.
+    startComponent();
     if (outOfBoundsState) {
         outOfBoundsBit = 0;
         ++totalBitOffset;
@@ -209,6 +224,7 @@ IntegerVariableInformation const& VariableInformation::getIntegerArrayVariableRe
 }
 
 void VariableInformation::createVariablesForAutomaton(storm::jani::Automaton const& automaton, uint64_t reservedBitsForUnboundedVariables) {
+    startComponent();
     uint_fast64_t bitwidth = static_cast<uint_fast64_t>(std::ceil(std::log2(automaton.getNumberOfLocations())));
     locationVariables.emplace_back(automaton.getLocationExpressionVariable(), automaton.getNumberOfLocations() - 1, totalBitOffset, bitwidth, true);
     totalBitOffset += bitwidth;
@@ -251,6 +267,13 @@ void VariableInformation::createVariablesForVariableSet(storm::jani::VariableSet
     }
 }
 
+void VariableInformation::startComponent() {
+    // Components without any bits are merged into the next one.
+    if (componentBitOffsets.empty() || componentBitOffsets.back() != totalBitOffset) {
+        componentBitOffsets.push_back(totalBitOffset);
+    }
+}
+
 uint_fast64_t VariableInformation::getTotalBitOffset(bool roundTo64Bit) const {
     uint_fast64_t result = totalBitOffset;
     if (roundTo64Bit & ((result & ((1ull << 6) - 1)) != 0)) {
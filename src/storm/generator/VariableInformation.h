@@ -3,6 +3,7 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/optional/optional.hpp>
+#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -46,7 +47,8 @@ struct BooleanVariableInformation {
 // A structure storing information about the integer variables of the model.
 struct IntegerVariableInformation {
     IntegerVariableInformation(storm::expressions::Variable const& variable, int_fast64_t lowerBound, int_fast64_t upperBound, uint_fast64_t bitOffset,
-                               uint_fast64_t bitWidth, bool global = false, bool observable = true, bool forceOutOfBoundsCheck = false);
+                               uint_fast64_t bitWidth, bool global = false, bool observable = true, bool forceOutOfBoundsCheck = false,
+                               bool narrowedRange = false);
 
     std::string const& getName() const {
         return variable.getName();
@@ -74,6 +76,10 @@ struct IntegerVariableInformation {
 
     // A flag indicating whether an out of bounds check is enforced for this variable.
     bool forceOutOfBoundsCheck;
+
+    // A flag indicating whether the range is narrower than the declared one (due to a range analysis), such that values outside of the range
+    // require to re-encode the states.
+    bool narrowedRange;
 };
 
 // A structure storing information about the location variables of the model.
@@ -104,7 +110,12 @@ struct ObservationLabelInformation {
 
 // A structure storing information about the used variables of the program.
 struct VariableInformation {
-    VariableInformation(storm::prism::Program const& program, uint64_t reservedBitsForUnboundedVariables, bool outOfBoundsState = false);
+    /*!
+     * Creates the variable information of the given program. If ranges are given for integer variables (e.g. by computeIntegerVariableRanges),
+     * they are used instead of the declared ones if they are narrower.
+     */
+    VariableInformation(storm::prism::Program const& program, uint64_t reservedBitsForUnboundedVariables, bool outOfBoundsState = false,
+                        std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> const& integerVariableRanges = {});
     VariableInformation(storm::jani::Model const& model, std::vector<std::reference_wrapper<storm::jani::Automaton const>> const& parallelAutomata,
                         uint64_t reservedBitsForUnboundedVariables, bool outOfBoundsState);
 
@@ -132,6 +143,10 @@ struct VariableInformation {
     /// The observation labels
     std::vector<ObservationLabelInformation> observationLabels;
 
+    /// The bit offsets at which the components of the state start, i.e. the global variables (including the out-of-bounds
+    /// bit) and the variables of each module (or automaton). Components without any bits are omitted.
+    std::vector<uint_fast64_t> componentBitOffsets;
+
     /// Replacements for each array variable
     std::unordered_map<storm::expressions::Variable, ArrayVariableReplacementInformation> arrayVariableToElementInformations;
 
@@ -142,6 +157,11 @@ struct VariableInformation {
    private:
     boost::optional<uint64_t> outOfBoundsBit;
 
+    /*!
+     * Marks the current bit offset as the start of a new component.
+     */
+    void startComponent();
+
     /*!
      * Sorts the variables to establish a known ordering.
      */
@@ -158,6 +178,21 @@ struct VariableInformation {
     void createVariablesForVariableSet(storm::jani::VariableSet const& variableSet, uint64_t reservedBitsForUnboundedVariables, bool global);
 };
 
+/*!
+ * Small helper function that sets unspecified lower/upper bounds for an integer variable based on the provided reservedBitsForUnboundedVariables and returns
+ * the number of bits required to represent the final variable range
+ * @pre If has[Lower,Upper]Bound is true, [lower,upper]Bound must be set to the corresponding bound.
+ * @post lowerBound and upperBound are set to the considered bound for this variable
+ * @param hasLowerBound shall be true iff there is a lower bound given
+ * @param lowerBound a reference to the lower bound value
+ * @param hasUpperBound shall be true iff there is an upper bound given
+ * @param upperBound a reference to the upper bound
+ * @param reservedBitsForUnboundedVariables the number of bits that shall be used to represent unbounded variables
+ * @return the number of bits required to represent the final variable range
+ */
+uint64_t getBitWidthLowerUpperBound(bool const& hasLowerBound, int64_t& lowerBound, bool const& hasUpperBound, int64_t& upperBound,
+                                    uint64_t const& reservedBitsForUnboundedVariables);
+
 }  // namespace generator
 }  // namespace storm
 
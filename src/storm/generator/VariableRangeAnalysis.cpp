@@ -0,0 +1,329 @@
+#include "storm/generator/VariableRangeAnalysis.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+
+// An interval of (possibly non-integral) values. Infinite bounds represent unknown values.
+struct Interval {
+    double lower;
+    double upper;
+
+    static Interval point(double value) {
+        return {value, value};
+    }
+
+    static Interval unknown() {
+        return {-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+    }
+
+    bool isEmpty() const {
+        return lower > upper;
+    }
+
+    bool contains(double value) const {
+        return lower <= value && value <= upper;
+    }
+};
+
+typedef std::unordered_map<storm::expressions::Variable, Interval> IntervalValuation;
+
+// Builds the smallest interval containing the given values, where undefined values (such as infinity minus infinity) make the result unknown.
+Interval hull(std::initializer_list<double> values) {
+    if (std::any_of(values.begin(), values.end(), [](double value) { return std::isnan(value); })) {
+        return Interval::unknown();
+    }
+    return {std::min(values), std::max(values)};
+}
+
+// Multiplies two bounds, where zero times infinity is zero (as the infinite bound is never attained).
+double multiply(double first, double second) {
+    return first == 0.0 || second == 0.0 ? 0.0 : first * second;
+}
+
+/*!
+ * Evaluates numerical expressions over intervals of the values of the variables. Boolean expressions evaluate to unknown intervals.
+ */
+class IntervalEvaluationVisitor : public storm::expressions::ExpressionVisitor {
+   public:
+    IntervalEvaluationVisitor(IntervalValuation const& valuation) : valuation(valuation) {
+        // Intentionally left empty.
+    }
+
+    Interval evaluate(storm::expressions::BaseExpression const& expression) {
+        return boost::any_cast<Interval>(expression.accept(*this, boost::none));
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+        Interval thenInterval = evaluate(*expression.getThenExpression());
+        Interval elseInterval = evaluate(*expression.getElseExpression());
+        return Interval{std::min(thenInterval.lower, elseInterval.lower), std::max(thenInterval.upper, elseInterval.upper)};
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const&, boost::any const&) override {
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+        Interval first = evaluate(*expression.getFirstOperand());
+        Interval second = evaluate(*expression.getSecondOperand());
+        switch (expression.getOperatorType()) {
+            case OperatorType::Plus:
+                return hull({first.lower + second.lower, first.upper + second.upper});
+            case OperatorType::Minus:
+                return hull({first.lower - second.upper, first.upper - second.lower});
+            case OperatorType::Times:
+                return hull({multiply(first.lower, second.lower), multiply(first.lower, second.upper), multiply(first.upper, second.lower),
+                             multiply(first.upper, second.upper)});
+            case OperatorType::Divide:
+                if (second.contains(0.0)) {
+                    return Interval::unknown();
+                }
+                return hull({first.lower / second.lower, first.lower / second.upper, first.upper / second.lower, first.upper / second.upper});
+            case OperatorType::Min:
+                return Interval{std::min(first.lower, second.lower), std::min(first.upper, second.upper)};
+            case OperatorType::Max:
+                return Interval{std::max(first.lower, second.lower), std::max(first.upper, second.upper)};
+            case OperatorType::Power:
+                // For non-negative bases and exponents, the power is monotone in both arguments, so its extremal values are attained at the corners.
+                if (first.lower < 0.0 || second.lower < 0.0) {
+                    return Interval::unknown();
+                }
+                return hull({std::pow(first.lower, second.lower), std::pow(first.lower, second.upper), std::pow(first.upper, second.lower),
+                             std::pow(first.upper, second.upper)});
+            case OperatorType::Modulo: {
+                if (second.lower <= 0.0 || std::isinf(second.upper)) {
+                    return Interval::unknown();
+                }
+                // The absolute value of the result is below the divisor and does not exceed the absolute value of the dividend.
+                double bound = expression.hasIntegerType() ? second.upper - 1 : second.upper;
+                if (first.lower >= 0.0) {
+                    return Interval{0.0, std::min(first.upper, bound)};
+                }
+                return Interval{std::max(first.lower, -bound), std::min(std::max(first.upper, 0.0), bound)};
+            }
+        }
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const&, boost::any const&) override {
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        auto intervalIt = valuation.find(expression.getVariable());
+        return intervalIt != valuation.end() ? intervalIt->second : Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const&, boost::any const&) override {
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+        typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+        Interval operand = evaluate(*expression.getOperand());
+        switch (expression.getOperatorType()) {
+            case OperatorType::Minus:
+                return Interval{-operand.upper, -operand.lower};
+            case OperatorType::Floor:
+                return Interval{std::floor(operand.lower), std::floor(operand.upper)};
+            case OperatorType::Ceil:
+                return Interval{std::ceil(operand.lower), std::ceil(operand.upper)};
+        }
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const&, boost::any const&) override {
+        return Interval::unknown();
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        return Interval::point(static_cast<double>(expression.getValue()));
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+        return Interval::point(expression.getValueAsDouble());
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        return Interval::unknown();
+    }
+
+   private:
+    IntervalValuation const& valuation;
+};
+
+/*!
+ * Restricts the intervals of the integer variables to the values that satisfy the conjuncts of the given condition that compare a variable to an
+ * expression. Other conjuncts are ignored, so the restricted intervals still contain all values satisfying the condition.
+ *
+ * @return False if the condition is found to be unsatisfiable.
+ */
+bool restrict(storm::expressions::BaseExpression const& condition, IntervalValuation& valuation) {
+    typedef storm::expressions::BinaryRelationExpression::RelationType RelationType;
+    if (condition.isFalse()) {
+        return false;
+    }
+    if (condition.isBinaryBooleanFunctionExpression()) {
+        auto const& conjunction = condition.asBinaryBooleanFunctionExpression();
+        if (conjunction.getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And) {
+            return restrict(*conjunction.getFirstOperand(), valuation) && restrict(*conjunction.getSecondOperand(), valuation);
+        }
+        return true;
+    }
+    if (!condition.isBinaryRelationExpression()) {
+        return true;
+    }
+
+    auto const& relation = condition.asBinaryRelationExpression();
+    // Restricts the variable (if any) of the first operand such that the relation to the second operand can hold.
+    auto restrictOperand = [&valuation](storm::expressions::BaseExpression const& variableOperand, storm::expressions::BaseExpression const& otherOperand,
+                                        RelationType relationType) {
+        if (!variableOperand.isVariableExpression()) {
+            return true;
+        }
+        auto intervalIt = valuation.find(variableOperand.asVariableExpression().getVariable());
+        if (intervalIt == valuation.end()) {
+            return true;
+        }
+        Interval other = IntervalEvaluationVisitor(valuation).evaluate(otherOperand);
+        Interval& interval = intervalIt->second;
+        // As the variable is integral, strict bounds are tightened to the next integer.
+        switch (relationType) {
+            case RelationType::Equal:
+                interval.lower = std::max(interval.lower, std::ceil(other.lower));
+                interval.upper = std::min(interval.upper, std::floor(other.upper));
+                break;
+            case RelationType::NotEqual:
+                break;
+            case RelationType::Less:
+                interval.upper = std::min(interval.upper, std::ceil(other.upper) - 1);
+                break;
+            case RelationType::LessOrEqual:
+                interval.upper = std::min(interval.upper, std::floor(other.upper));
+                break;
+            case RelationType::Greater:
+                interval.lower = std::max(interval.lower, std::floor(other.lower) + 1);
+                break;
+            case RelationType::GreaterOrEqual:
+                interval.lower = std::max(interval.lower, std::ceil(other.lower));
+                break;
+        }
+        return !interval.isEmpty();
+    };
+
+    RelationType mirrored = relation.getRelationType();
+    switch (relation.getRelationType()) {
+        case RelationType::Less:
+            mirrored = RelationType::Greater;
+            break;
+        case RelationType::LessOrEqual:
+            mirrored = RelationType::GreaterOrEqual;
+            break;
+        case RelationType::Greater:
+            mirrored = RelationType::Less;
+            break;
+        case RelationType::GreaterOrEqual:
+            mirrored = RelationType::LessOrEqual;
+            break;
+        default:
+            break;
+    }
+    return restrictOperand(*relation.getFirstOperand(), *relation.getSecondOperand(), relation.getRelationType()) &&
+           restrictOperand(*relation.getSecondOperand(), *relation.getFirstOperand(), mirrored);
+}
+
+}  // namespace
+
+std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> computeIntegerVariableRanges(storm::prism::Program const& program,
+                                                                                                 uint64_t reservedBitsForUnboundedVariables,
+                                                                                                 uint64_t iterationsBeforeWidening) {
+    // Determine the declared bounds, which are also the initial ranges if the initial values are not restricted.
+    IntervalValuation declaredBounds;
+    auto addDeclaredBounds = [&declaredBounds, &reservedBitsForUnboundedVariables](storm::prism::IntegerVariable const& variable) {
+        int64_t lowerBound, upperBound;
+        if (variable.hasLowerBoundExpression()) {
+            lowerBound = variable.getLowerBoundExpression().evaluateAsInt();
+        }
+        if (variable.hasUpperBoundExpression()) {
+            upperBound = variable.getUpperBoundExpression().evaluateAsInt();
+        }
+        getBitWidthLowerUpperBound(variable.hasLowerBoundExpression(), lowerBound, variable.hasUpperBoundExpression(), upperBound,
+                                   reservedBitsForUnboundedVariables);
+        declaredBounds[variable.getExpressionVariable()] = Interval{static_cast<double>(lowerBound), static_cast<double>(upperBound)};
+    };
+    for (auto const& variable : program.getGlobalIntegerVariables()) {
+        addDeclaredBounds(variable);
+    }
+    for (auto const& module : program.getModules()) {
+        for (auto const& variable : module.getIntegerVariables()) {
+            addDeclaredBounds(variable);
+        }
+    }
+
+    // The initial ranges are given by the conjuncts of the initial states expression, which are the initial values if there is no initial construct.
+    IntervalValuation ranges = declaredBounds;
+    if (!restrict(program.getInitialStatesExpression().getBaseExpression(), ranges)) {
+        STORM_LOG_WARN("The program does not seem to have initial states, so the ranges of its variables are not narrowed.");
+        ranges = declaredBounds;
+    }
+
+    bool changed = true;
+    uint64_t iterations = 0;
+    for (; changed; ++iterations) {
+        changed = false;
+        bool widen = iterations >= iterationsBeforeWidening;
+        for (auto const& module : program.getModules()) {
+            for (auto const& command : module.getCommands()) {
+                IntervalValuation enabledRanges = ranges;
+                if (!restrict(command.getGuardExpression().getBaseExpression(), enabledRanges)) {
+                    continue;
+                }
+                IntervalEvaluationVisitor visitor(enabledRanges);
+                for (auto const& update : command.getUpdates()) {
+                    for (auto const& assignment : update.getAssignments()) {
+                        auto rangeIt = ranges.find(assignment.getVariable());
+                        if (rangeIt == ranges.end()) {
+                            continue;
+                        }
+                        Interval& range = rangeIt->second;
+                        Interval const& declared = declaredBounds.at(assignment.getVariable());
+                        Interval value = visitor.evaluate(assignment.getExpression().getBaseExpression());
+                        // Values outside the declared bounds are errors that are detected during the exploration.
+                        if (value.lower < range.lower && range.lower > declared.lower) {
+                            range.lower = widen ? declared.lower : std::max(std::floor(value.lower), declared.lower);
+                            changed = true;
+                        }
+                        if (value.upper > range.upper && range.upper < declared.upper) {
+                            range.upper = widen ? declared.upper : std::min(std::ceil(value.upper), declared.upper);
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    STORM_LOG_DEBUG("Variable range analysis terminated after " << iterations << " iterations.");
+
+    std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> result;
+    for (auto const& variableRange : ranges) {
+        result[variableRange.first] = std::make_pair(static_cast<int64_t>(variableRange.second.lower), static_cast<int64_t>(variableRange.second.upper));
+    }
+    return result;
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <utility>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+namespace prism {
+class Program;
+}
+
+namespace generator {
+
+/*!
+ * Over-approximates the values that the integer variables of the given program take in reachable states by an interval analysis: Starting from the
+ * initial values, the range of a variable is extended by the values that the updates of the commands may assign to it. Before evaluating the
+ * updates of a command, the ranges are restricted by the conjuncts of its guard that compare a variable to an expression. Ranges that still grow
+ * after the given number of iterations are widened to the declared bounds, which guarantees termination.
+ *
+ * The resulting ranges are contained in the declared bounds (where the bounds of unbounded variables are given by the number of bits reserved for
+ * them). Updates that leave the declared bounds are not considered and have to be detected during the exploration.
+ *
+ * @param program The program, whose constants need to be defined.
+ * @param reservedBitsForUnboundedVariables The number of bits that are reserved for unbounded integer variables.
+ * @param iterationsBeforeWidening The number of iterations after which growing ranges are widened.
+ * @return For each integer variable of the program the (inclusive) lower and upper bound of its range.
+ */
+std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> computeIntegerVariableRanges(storm::prism::Program const& program,
+                                                                                                 uint64_t reservedBitsForUnboundedVariables,
+                                                                                                 uint64_t iterationsBeforeWidening = 16);
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,367 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/BinaryModelFormat.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+
+using namespace storm::exporter::binary;
+
+/*!
+ * Writes words, strings and arrays to a stream and keeps track of the number of written bytes.
+ */
+class BinaryWriter {
+   public:
+    explicit BinaryWriter(std::ostream& os) : os(os), numberOfWrittenBytes(0) {
+        // Intentionally left empty.
+    }
+
+    void writeWord(uint64_t word) {
+        write(&word, sizeof(word));
+    }
+
+    template<typename T>
+    void writeElement(T const& element) {
+        static_assert(sizeof(T) == sizeof(uint64_t), "Elements of arrays that are written incrementally must have the size of a word.");
+        write(&element, sizeof(element));
+    }
+
+    void writeString(std::string const& string) {
+        writeWord(string.size());
+        write(string.data(), string.size());
+        pad(string.size());
+    }
+
+    template<typename T>
+    void writeArray(std::vector<T> const& array) {
+        writeWord(array.size());
+        write(array.data(), array.size() * sizeof(T));
+        pad(array.size() * sizeof(T));
+    }
+
+    void writeBitVector(storm::storage::BitVector const& bitVector) {
+        writeWord(bitVector.size());
+        write(bitVector.getWords(), getNumberOfWords(bitVector) * sizeof(uint64_t));
+    }
+
+    uint64_t getNumberOfWrittenBytes() const {
+        return numberOfWrittenBytes;
+    }
+
+    static uint64_t getNumberOfWords(storm::storage::BitVector const& bitVector) {
+        return (bitVector.size() + 63) / 64;
+    }
+
+   private:
+    void write(void const* data, uint64_t numberOfBytes) {
+        os.write(static_cast<char const*>(data), numberOfBytes);
+        numberOfWrittenBytes += numberOfBytes;
+    }
+
+    void pad(uint64_t numberOfBytes) {
+        static const char zeros[8] = {};
+        write(zeros, padToWord(numberOfBytes) - numberOfBytes);
+    }
+
+    std::ostream& os;
+    uint64_t numberOfWrittenBytes;
+};
+
+uint64_t getSize(std::string const& string) {
+    return sizeof(uint64_t) + padToWord(string.size());
+}
+
+template<typename T>
+uint64_t getArraySize(uint64_t numberOfElements) {
+    return sizeof(uint64_t) + padToWord(numberOfElements * sizeof(T));
+}
+
+uint64_t getSize(storm::storage::BitVector const& bitVector) {
+    return sizeof(uint64_t) + BinaryWriter::getNumberOfWords(bitVector) * sizeof(uint64_t);
+}
+
+uint64_t getSize(storm::storage::SparseMatrix<double> const& matrix) {
+    uint64_t rowGroupIndicesSize = getArraySize<uint64_t>(matrix.hasTrivialRowGrouping() ? 0 : matrix.getRowGroupCount() + 1);
+    return sizeof(uint64_t) + getArraySize<uint64_t>(matrix.getRowCount() + 1) + getArraySize<uint64_t>(matrix.getEntryCount()) +
+           getArraySize<double>(matrix.getEntryCount()) + rowGroupIndicesSize;
+}
+
+storm::storage::BitVector const& getItems(storm::models::sparse::StateLabeling const& labeling, std::string const& label) {
+    return labeling.getStates(label);
+}
+
+storm::storage::BitVector const& getItems(storm::models::sparse::ChoiceLabeling const& labeling, std::string const& label) {
+    return labeling.getChoices(label);
+}
+
+template<typename LabelingType>
+uint64_t getLabelingSize(LabelingType const& labeling) {
+    uint64_t result = sizeof(uint64_t);
+    for (auto const& label : labeling.getLabels()) {
+        result += getSize(label) + getSize(getItems(labeling, label));
+    }
+    return result;
+}
+
+template<typename SectionWriter>
+void writeSection(BinaryWriter& writer, SectionType type, uint64_t payloadSize, SectionWriter const& writePayload) {
+    writer.writeWord(static_cast<uint64_t>(type));
+    writer.writeWord(payloadSize);
+    uint64_t payloadStart = writer.getNumberOfWrittenBytes();
+    writePayload();
+    STORM_LOG_ASSERT(writer.getNumberOfWrittenBytes() - payloadStart == payloadSize, "Unexpected size of binary model section.");
+}
+
+void writeMatrix(BinaryWriter& writer, storm::storage::SparseMatrix<double> const& matrix) {
+    writer.writeWord(matrix.getColumnCount());
+
+    writer.writeWord(matrix.getRowCount() + 1);
+    uint64_t numberOfEntries = 0;
+    writer.writeWord(numberOfEntries);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        numberOfEntries += matrix.getRow(row).getNumberOfEntries();
+        writer.writeWord(numberOfEntries);
+    }
+
+    writer.writeWord(matrix.getEntryCount());
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            writer.writeWord(entry.getColumn());
+        }
+    }
+    writer.writeWord(matrix.getEntryCount());
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            writer.writeElement(entry.getValue());
+        }
+    }
+
+    if (matrix.hasTrivialRowGrouping()) {
+        writer.writeArray(std::vector<uint64_t>());
+    } else {
+        writer.writeArray(matrix.getRowGroupIndices());
+    }
+}
+
+template<typename LabelingType>
+void writeLabeling(BinaryWriter& writer, LabelingType const& labeling) {
+    writer.writeWord(labeling.getNumberOfLabels());
+    for (auto const& label : labeling.getLabels()) {
+        writer.writeString(label);
+        writer.writeBitVector(getItems(labeling, label));
+    }
+}
+
+void writeRewardModel(BinaryWriter& writer, std::string const& name, storm::models::sparse::StandardRewardModel<double> const& rewardModel) {
+    uint64_t flags = 0;
+    uint64_t payloadSize = getSize(name) + sizeof(uint64_t);
+    if (rewardModel.hasStateRewards()) {
+        flags |= HasStateRewards;
+        payloadSize += getArraySize<double>(rewardModel.getStateRewardVector().size());
+    }
+    if (rewardModel.hasStateActionRewards()) {
+        flags |= HasStateActionRewards;
+        payloadSize += getArraySize<double>(rewardModel.getStateActionRewardVector().size());
+    }
+    if (rewardModel.hasTransitionRewards()) {
+        flags |= HasTransitionRewards;
+        payloadSize += getSize(rewardModel.getTransitionRewardMatrix());
+    }
+
+    writeSection(writer, SectionType::RewardModel, payloadSize, [&]() {
+        writer.writeString(name);
+        writer.writeWord(flags);
+        if (rewardModel.hasStateRewards()) {
+            writer.writeArray(rewardModel.getStateRewardVector());
+        }
+        if (rewardModel.hasStateActionRewards()) {
+            writer.writeArray(rewardModel.getStateActionRewardVector());
+        }
+        if (rewardModel.hasTransitionRewards()) {
+            writeMatrix(writer, rewardModel.getTransitionRewardMatrix());
+        }
+    });
+}
+
+void writeStateValuations(BinaryWriter& writer, storm::storage::sparse::StateValuations const& stateValuations, uint64_t numberOfStates) {
+    // Retrieve the variables and observation labels from the first state that has a valuation.
+    storm::storage::BitVector statesWithValuation(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        statesWithValuation.set(state, !stateValuations.isEmpty(state));
+    }
+    std::vector<std::pair<std::string, VariableTypeTag>> variables;
+    std::vector<std::string> labels;
+    if (!statesWithValuation.empty()) {
+        auto valuation = stateValuations.at(*statesWithValuation.begin());
+        for (auto valueIt = valuation.begin(); valueIt != valuation.end(); ++valueIt) {
+            if (valueIt.isVariableAssignment()) {
+                VariableTypeTag type = valueIt.isBoolean() ? VariableTypeTag::Boolean : (valueIt.isInteger() ? VariableTypeTag::Integer : VariableTypeTag::Rational);
+                variables.emplace_back(valueIt.getName(), type);
+            } else {
+                labels.push_back(valueIt.getLabel());
+            }
+        }
+    }
+
+    // Collect the values column by column.
+    std::vector<storm::storage::BitVector> booleanColumns;
+    std::vector<std::vector<int64_t>> integerColumns;
+    std::vector<std::vector<std::string>> rationalColumns;
+    for (auto const& variable : variables) {
+        if (variable.second == VariableTypeTag::Boolean) {
+            booleanColumns.emplace_back(numberOfStates);
+        } else if (variable.second == VariableTypeTag::Integer) {
+            integerColumns.emplace_back(numberOfStates, 0);
+        } else {
+            rationalColumns.emplace_back(numberOfStates);
+        }
+    }
+    std::vector<std::vector<int64_t>> labelColumns(labels.size(), std::vector<int64_t>(numberOfStates, 0));
+    for (auto state : statesWithValuation) {
+        uint64_t booleanIndex = 0, integerIndex = 0, rationalIndex = 0, labelIndex = 0;
+        auto valuation = stateValuations.at(state);
+        for (auto valueIt = valuation.begin(); valueIt != valuation.end(); ++valueIt) {
+            if (valueIt.isVariableAssignment()) {
+                if (valueIt.isBoolean()) {
+                    booleanColumns[booleanIndex++].set(state, valueIt.getBooleanValue());
+                } else if (valueIt.isInteger()) {
+                    integerColumns[integerIndex++][state] = valueIt.getIntegerValue();
+                } else {
+                    rationalColumns[rationalIndex++][state] = storm::utility::to_string(valueIt.getRationalValue());
+                }
+            } else {
+                labelColumns[labelIndex++][state] = valueIt.getLabelValue();
+            }
+        }
+        STORM_LOG_THROW(booleanIndex == booleanColumns.size() && integerIndex == integerColumns.size() && rationalIndex == rationalColumns.size() &&
+                            labelIndex == labelColumns.size(),
+                        storm::exceptions::NotSupportedException, "State valuations that do not assign the same variables to all states can not be exported.");
+    }
+
+    uint64_t payloadSize = getSize(statesWithValuation) + 2 * sizeof(uint64_t);
+    for (auto const& variable : variables) {
+        payloadSize += getSize(variable.first) + sizeof(uint64_t);
+    }
+    for (auto const& label : labels) {
+        payloadSize += getSize(label);
+    }
+    for (auto const& column : booleanColumns) {
+        payloadSize += getSize(column);
+    }
+    payloadSize += integerColumns.size() * getArraySize<int64_t>(numberOfStates);
+    for (auto const& column : rationalColumns) {
+        payloadSize += sizeof(uint64_t);
+        for (auto const& value : column) {
+            payloadSize += getSize(value);
+        }
+    }
+    payloadSize += labelColumns.size() * getArraySize<int64_t>(numberOfStates);
+
+    writeSection(writer, SectionType::StateValuations, payloadSize, [&]() {
+        writer.writeBitVector(statesWithValuation);
+        writer.writeWord(variables.size());
+        for (auto const& variable : variables) {
+            writer.writeString(variable.first);
+            writer.writeWord(static_cast<uint64_t>(variable.second));
+        }
+        writer.writeWord(labels.size());
+        for (auto const& label : labels) {
+            writer.writeString(label);
+        }
+        for (auto const& column : booleanColumns) {
+            writer.writeBitVector(column);
+        }
+        for (auto const& column : integerColumns) {
+            writer.writeArray(column);
+        }
+        for (auto const& column : rationalColumns) {
+            writer.writeWord(column.size());
+            for (auto const& value : column) {
+                writer.writeString(value);
+            }
+        }
+        for (auto const& column : labelColumns) {
+            writer.writeArray(column);
+        }
+    });
+}
+
+}  // namespace
+
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel) {
+    STORM_LOG_THROW(sparseModel->getType() != storm::models::ModelType::S2pg && sparseModel->getType() != storm::models::ModelType::Smg,
+                    storm::exceptions::NotSupportedException, "Games can not be exported in the binary format.");
+    STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "Choice origins are not exported in the binary format.");
+
+    BinaryWriter writer(os);
+
+    // Write header
+    os.write(magic, sizeof(magic));
+    writer.writeWord(formatVersion);
+    writer.writeWord(byteOrderMark);
+    writer.writeWord(static_cast<uint64_t>(ValueTypeTag::Double));
+    std::stringstream modelType;
+    modelType << sparseModel->getType();
+    writer.writeString(modelType.str());
+    writer.writeWord(sparseModel->getNumberOfStates());
+    writer.writeWord(sparseModel->getNumberOfChoices());
+
+    // Write sections
+    auto const& transitionMatrix = sparseModel->getTransitionMatrix();
+    writeSection(writer, SectionType::TransitionMatrix, getSize(transitionMatrix), [&]() { writeMatrix(writer, transitionMatrix); });
+    writeSection(writer, SectionType::StateLabeling, getLabelingSize(sparseModel->getStateLabeling()), [&]() { writeLabeling(writer, sparseModel->getStateLabeling()); });
+    if (sparseModel->hasChoiceLabeling()) {
+        writeSection(writer, SectionType::ChoiceLabeling, getLabelingSize(sparseModel->getChoiceLabeling()),
+                     [&]() { writeLabeling(writer, sparseModel->getChoiceLabeling()); });
+    }
+
+    // Sort the reward models to obtain the same file for the same model.
+    std::vector<std::string> rewardModelNames;
+    for (auto const& rewardModel : sparseModel->getRewardModels()) {
+        rewardModelNames.push_back(rewardModel.first);
+    }
+    std::sort(rewardModelNames.begin(), rewardModelNames.end());
+    for (auto const& name : rewardModelNames) {
+        writeRewardModel(writer, name, sparseModel->getRewardModel(name));
+    }
+
+    std::vector<double> const* exitRates = nullptr;
+    if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+        exitRates = &sparseModel->template as<storm::models::sparse::Ctmc<double>>()->getExitRateVector();
+    } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+        auto const& ma = *sparseModel->template as<storm::models::sparse::MarkovAutomaton<double>>();
+        exitRates = &ma.getExitRates();
+        writeSection(writer, SectionType::MarkovianStates, getSize(ma.getMarkovianStates()), [&]() { writer.writeBitVector(ma.getMarkovianStates()); });
+    }
+    if (exitRates) {
+        writeSection(writer, SectionType::ExitRates, getArraySize<double>(exitRates->size()), [&]() { writer.writeArray(*exitRates); });
+    }
+    if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+        auto const& observations = sparseModel->template as<storm::models::sparse::Pomdp<double>>()->getObservations();
+        writeSection(writer, SectionType::Observations, getArraySize<uint32_t>(observations.size()), [&]() { writer.writeArray(observations); });
+    }
+    if (sparseModel->hasStateValuations()) {
+        writeStateValuations(writer, sparseModel->getStateValuations(), sparseModel->getNumberOfStates());
+    }
+
+    writer.writeWord(static_cast<uint64_t>(SectionType::End));
+    writer.writeWord(0);
+    STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the binary model.");
+}
+
+}  // namespace exporter
+}  // namespace storm
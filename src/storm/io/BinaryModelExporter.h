@@ -0,0 +1,24 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/*!
+ * Exports a sparse model into the binary direct encoding (drb). In contrast to the DRN format, the file stores the
+ * internal arrays of the model (transition matrix, labelings, reward vectors, ...) as they are, such that loading the
+ * model does not require any parsing. See BinaryModelFormat.h for a description of the layout.
+ *
+ * Choice origins and observation valuations are not exported.
+ *
+ * @param os          Stream to export to (should be opened in binary mode)
+ * @param sparseModel Model to export
+ */
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> const& sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace exporter {
+namespace binary {
+
+/*
+ * Layout of the binary direct encoding (drb) of sparse models.
+ *
+ * The file consists of 64-bit words in native byte order. It starts with a header (magic, format version, byte order
+ * mark, value type, model type, number of states and number of choices) followed by a sequence of sections. Each
+ * section starts with its type and the size of its payload in bytes; the last section has type End. Strings are
+ * stored as their length followed by their characters and arrays are stored as their number of elements followed by
+ * the elements. Strings and arrays are padded to a multiple of eight bytes, such that all arrays are properly aligned
+ * when the file is mapped to memory and can be copied (or used) without any parsing.
+ */
+
+// The magic at the very beginning of every file.
+constexpr char magic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'R', 'B'};
+
+// The version of the format. Readers reject files with a different version.
+constexpr uint64_t formatVersion = 1;
+
+// A word that allows to detect files that were written on a machine with a different byte order.
+constexpr uint64_t byteOrderMark = 0x0102030405060708ull;
+
+/*!
+ * The types of the values stored in the file.
+ */
+enum class ValueTypeTag : uint64_t { Double = 1 };
+
+/*!
+ * The types of the sections of a file. Readers skip sections of unknown type.
+ */
+enum class SectionType : uint64_t {
+    End = 0,
+    TransitionMatrix = 1,
+    StateLabeling = 2,
+    ChoiceLabeling = 3,
+    RewardModel = 4,
+    ExitRates = 5,
+    MarkovianStates = 6,
+    Observations = 7,
+    StateValuations = 8
+};
+
+/*!
+ * The flags that indicate which components a reward model section contains.
+ */
+enum RewardModelFlags : uint64_t { HasStateRewards = 1, HasStateActionRewards = 2, HasTransitionRewards = 4 };
+
+/*!
+ * The types of the variables of a state valuations section.
+ */
+enum class VariableTypeTag : uint64_t { Boolean = 0, Integer = 1, Rational = 2 };
+
+/*!
+ * Retrieves the given number of bytes rounded up to the next multiple of eight.
+ */
+inline uint64_t padToWord(uint64_t numberOfBytes) {
+    return (numberOfBytes + 7) & ~static_cast<uint64_t>(7);
+}
+
+}  // namespace binary
+}  // namespace exporter
+}  // namespace storm
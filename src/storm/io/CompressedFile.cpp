@@ -0,0 +1,155 @@
+#include "storm/io/CompressedFile.h"
+
+#include <algorithm>
+#include <fstream>
+#include <streambuf>
+#include <vector>
+
+#include "storm-config.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/io/file.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace storm {
+namespace utility {
+
+namespace {
+// The size of the buffers between the streams and zlib.
+std::size_t const bufferSize = 1 << 20;
+
+#ifdef STORM_HAVE_ZLIB
+/*!
+ * A stream buffer that reads from or writes to a gzip-compressed file.
+ */
+class GzipStreamBuffer : public std::streambuf {
+   public:
+    GzipStreamBuffer(std::string const& filepath, bool write) : buffer(bufferSize), write(write) {
+        file = gzopen(filepath.c_str(), write ? "wb" : "rb");
+        STORM_LOG_THROW(file != nullptr, storm::exceptions::FileIoException, "Could not open file " << filepath << ".");
+        gzbuffer(file, static_cast<unsigned>(bufferSize));
+        if (write) {
+            setp(buffer.data(), buffer.data() + buffer.size());
+        } else {
+            setg(buffer.data(), buffer.data(), buffer.data());
+        }
+    }
+
+    ~GzipStreamBuffer() {
+        if (write) {
+            flushBuffer();
+        }
+        gzclose(file);
+    }
+
+   protected:
+    int_type overflow(int_type character) override {
+        if (!flushBuffer()) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(character, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(character);
+            pbump(1);
+        }
+        return traits_type::not_eof(character);
+    }
+
+    int sync() override {
+        return write && !flushBuffer() ? -1 : 0;
+    }
+
+    int_type underflow() override {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());
+        }
+        int read = gzread(file, buffer.data(), static_cast<unsigned>(buffer.size()));
+        if (read <= 0) {
+            return traits_type::eof();
+        }
+        setg(buffer.data(), buffer.data(), buffer.data() + read);
+        return traits_type::to_int_type(*gptr());
+    }
+
+   private:
+    bool flushBuffer() {
+        int size = static_cast<int>(pptr() - pbase());
+        if (size > 0 && gzwrite(file, pbase(), static_cast<unsigned>(size)) != size) {
+            return false;
+        }
+        setp(buffer.data(), buffer.data() + buffer.size());
+        return true;
+    }
+
+    gzFile file;
+    std::vector<char> buffer;
+    bool write;
+};
+
+/*!
+ * A stream that owns its (gzip) stream buffer.
+ */
+template<typename StreamType>
+class GzipStream : public StreamType {
+   public:
+    GzipStream(std::string const& filepath, bool write) : StreamType(nullptr), buffer(filepath, write) {
+        this->rdbuf(&buffer);
+    }
+
+   private:
+    GzipStreamBuffer buffer;
+};
+#endif
+}  // namespace
+
+bool isCompressedFile(std::string const& filepath) {
+    std::string const extension = ".gz";
+    return filepath.size() > extension.size() && std::equal(extension.rbegin(), extension.rend(), filepath.rbegin());
+}
+
+bool isCompressionSupported() {
+#ifdef STORM_HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::unique_ptr<std::ostream> openOutputFile(std::string const& filepath, bool silent) {
+    if (isCompressedFile(filepath)) {
+#ifdef STORM_HAVE_ZLIB
+        auto stream = std::make_unique<GzipStream<std::ostream>>(filepath, true);
+        stream->precision(std::cout.precision());
+        if (!silent) {
+            STORM_PRINT_AND_LOG("Write to file " << filepath << ".\n");
+        }
+        return stream;
+#else
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Cannot write compressed file " << filepath << " because Storm was built without zlib.");
+#endif
+    }
+    auto stream = std::make_unique<std::ofstream>();
+    openFile(filepath, *stream, false, silent);
+    return stream;
+}
+
+std::unique_ptr<std::istream> openInputFile(std::string const& filepath) {
+    if (isCompressedFile(filepath)) {
+#ifdef STORM_HAVE_ZLIB
+        return std::make_unique<GzipStream<std::istream>>(filepath, false);
+#else
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "Cannot read compressed file " << filepath << " because Storm was built without zlib.");
+#endif
+    }
+    auto stream = std::make_unique<std::ifstream>();
+    openFile(filepath, *stream);
+    return stream;
+}
+
+}  // namespace utility
+}  // namespace storm
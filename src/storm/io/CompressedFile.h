@@ -0,0 +1,39 @@
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Retrieves whether the given file is (to be) gzip-compressed, i.e., whether its name ends with '.gz'.
+ */
+bool isCompressedFile(std::string const& filepath);
+
+/*!
+ * Retrieves whether compressed files are supported, i.e., whether Storm was built with zlib.
+ */
+bool isCompressionSupported();
+
+/*!
+ * Opens the given file for writing. If the name of the file ends with '.gz', the content is gzip-compressed while it
+ * is written. The stream has the same precision as std::cout and the file is closed once the stream is destroyed.
+ *
+ * @param filepath Path and name of the file to be written to.
+ * @param silent If false, the name of the file is printed.
+ */
+std::unique_ptr<std::ostream> openOutputFile(std::string const& filepath, bool silent = false);
+
+/*!
+ * Opens the given file for reading. Gzip-compressed files (whose name ends with '.gz') are decompressed on the fly.
+ * The file is closed once the stream is destroyed.
+ *
+ * @param filepath Path and name of the file to be read.
+ */
+std::unique_ptr<std::istream> openInputFile(std::string const& filepath);
+
+}  // namespace utility
+}  // namespace storm
@@ -1,4 +1,6 @@
 #include "storm/io/DirectEncodingExporter.h"
+#include <charconv>
+#include <sstream>
 #include <storm/exceptions/NotSupportedException.h>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -10,12 +12,141 @@
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 namespace storm {
 namespace exporter {
 
+namespace {
+
+/*!
+ * Writes the given index without going through the (locale-aware) number formatting of the stream.
+ */
+void writeIndex(std::ostream& os, uint64_t index) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), index);
+    os.write(buffer, result.ptr - buffer);
+}
+
+/*!
+ * Writes the given state, i.e., its rewards, labels, and outgoing transitions.
+ */
+template<typename ValueType>
+void writeState(std::ostream& os, storm::models::sparse::Model<ValueType> const& model, uint64_t group, std::vector<ValueType> const& exitRates,
+                std::unordered_map<ValueType, std::string> const& placeholders) {
+    storm::storage::SparseMatrix<ValueType> const& matrix = model.getTransitionMatrix();
+    os << "state ";
+    writeIndex(os, group);
+
+    // Write exit rates for CTMCs and MAs
+    if (!exitRates.empty()) {
+        os << " !";
+        writeValue(os, exitRates.at(group), placeholders);
+    }
+
+    if (model.getType() == storm::models::ModelType::Pomdp) {
+        os << " {" << dynamic_cast<storm::models::sparse::Pomdp<ValueType> const&>(model).getObservation(group) << "}";
+    }
+
+    // Write state rewards
+    bool first = true;
+    for (auto const& rewardModelEntry : model.getRewardModels()) {
+        if (first) {
+            os << " [";
+            first = false;
+        } else {
+            os << ", ";
+        }
+
+        if (rewardModelEntry.second.hasStateRewards()) {
+            writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
+        } else {
+            os << "0";
+        }
+    }
+
+    if (!first) {
+        os << "]";
+    }
+
+    // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+    for (auto const& label : model.getStateLabeling().getLabelsOfState(group)) {
+        STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                        "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+        // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+        if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+            os << " \"" << label << "\"";
+        } else {
+            os << " " << label;
+        }
+    }
+    os << '\n';
+    // Write state valuations as comments
+    if (model.hasStateValuations()) {
+        os << "//" << model.getStateValuations().getStateInfo(group) << '\n';
+    }
+
+    // Write probabilities
+    typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
+    typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
+
+    // Iterate over all actions
+    for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
+        // Write choice
+        if (model.hasChoiceLabeling()) {
+            os << "\taction ";
+            bool lfirst = true;
+            if (model.getChoiceLabeling().getLabelsOfChoice(row).empty()) {
+                os << "__NOLABEL__";
+            }
+            for (auto const& label : model.getChoiceLabeling().getLabelsOfChoice(row)) {
+                if (!lfirst) {
+                    os << "_";
+                    lfirst = false;
+                }
+                os << label;
+            }
+        } else {
+            os << "\taction " << row - start;
+        }
+
+        // Write action rewards
+        bool first = true;
+        for (auto const& rewardModelEntry : model.getRewardModels()) {
+            if (first) {
+                os << " [";
+                first = false;
+            } else {
+                os << ", ";
+            }
+
+            if (rewardModelEntry.second.hasStateActionRewards()) {
+                writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
+            } else {
+                os << "0";
+            }
+        }
+        if (!first) {
+            os << "]";
+        }
+        os << '\n';
+
+        // Write transitions
+        for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
+            ValueType prob = it->getValue();
+            os << "\t\t";
+            writeIndex(os, it->getColumn());
+            os << " : ";
+            writeValue(os, prob, placeholders);
+            os << '\n';
+        }
+    }
+}
+
+}  // namespace
+
 template<typename ValueType>
 void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel,
                                std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
@@ -68,114 +199,38 @@ void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::
     os << "@nr_choices\n" << sparseModel->getNumberOfChoices() << '\n';
     os << "@model\n";
 
-    storm::storage::SparseMatrix<ValueType> const& matrix = sparseModel->getTransitionMatrix();
-
-    // Iterate over states and export state information and outgoing transitions
-    for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
-        os << "state " << group;
-
-        // Write exit rates for CTMCs and MAs
-        if (!exitRates.empty()) {
-            os << " !";
-            writeValue(os, exitRates.at(group), placeholders);
-        }
-
-        if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
-            os << " {" << sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservation(group) << "}";
-        }
-
-        // Write state rewards
-        bool first = true;
-        for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-            if (first) {
-                os << " [";
-                first = false;
-            } else {
-                os << ", ";
-            }
-
-            if (rewardModelEntry.second.hasStateRewards()) {
-                writeValue(os, rewardModelEntry.second.getStateRewardVector().at(group), placeholders);
-            } else {
-                os << "0";
-            }
-        }
-
-        if (!first) {
-            os << "]";
-        }
-
-        // Write labels. Only labels with a whitespace are put in (double) quotation marks.
-        for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-            STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                            "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-            // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-            if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                os << " \"" << label << "\"";
-            } else {
-                os << " " << label;
-            }
-        }
-        os << '\n';
-        // Write state valuations as comments
-        if (sparseModel->hasStateValuations()) {
-            os << "//" << sparseModel->getStateValuations().getStateInfo(group) << '\n';
+    uint64_t numberOfThreads = options.numberOfThreads == 0 ? storm::utility::parallel::getDefaultNumberOfThreads() : options.numberOfThreads;
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Printing rational functions accesses the (not thread-safe) variable pool of carl.
+        numberOfThreads = 1;
+    }
+    uint64_t numberOfStates = sparseModel->getNumberOfStates();
+    if (numberOfThreads <= 1) {
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            writeState(os, *sparseModel, state, exitRates, placeholders);
         }
-
-        // Write probabilities
-        typename storm::storage::SparseMatrix<ValueType>::index_type start = matrix.hasTrivialRowGrouping() ? group : matrix.getRowGroupIndices()[group];
-        typename storm::storage::SparseMatrix<ValueType>::index_type end = matrix.hasTrivialRowGrouping() ? group + 1 : matrix.getRowGroupIndices()[group + 1];
-
-        // Iterate over all actions
-        for (typename storm::storage::SparseMatrix<ValueType>::index_type row = start; row < end; ++row) {
-            // Write choice
-            if (sparseModel->hasChoiceLabeling()) {
-                os << "\taction ";
-                bool lfirst = true;
-                if (sparseModel->getChoiceLabeling().getLabelsOfChoice(row).empty()) {
-                    os << "__NOLABEL__";
-                }
-                for (auto const& label : sparseModel->getChoiceLabeling().getLabelsOfChoice(row)) {
-                    if (!lfirst) {
-                        os << "_";
-                        lfirst = false;
-                    }
-                    os << label;
-                }
-            } else {
-                os << "\taction " << row - start;
-            }
-
-            // Write action rewards
-            bool first = true;
-            for (auto const& rewardModelEntry : sparseModel->getRewardModels()) {
-                if (first) {
-                    os << " [";
-                    first = false;
-                } else {
-                    os << ", ";
-                }
-
-                if (rewardModelEntry.second.hasStateActionRewards()) {
-                    writeValue(os, rewardModelEntry.second.getStateActionRewardVector().at(row), placeholders);
-                } else {
-                    os << "0";
+    } else {
+        // Format chunks of states in parallel. To keep the memory consumption bounded, only a window of chunks is
+        // formatted at a time before it is written (in order).
+        uint64_t const chunkSize = 1024;
+        uint64_t const windowSize = chunkSize * numberOfThreads * 8;
+        std::vector<std::string> chunks;
+        for (uint64_t windowBegin = 0; windowBegin < numberOfStates; windowBegin += windowSize) {
+            uint64_t windowEnd = std::min(windowBegin + windowSize, numberOfStates);
+            chunks.assign((windowEnd - windowBegin + chunkSize - 1) / chunkSize, std::string());
+            storm::utility::parallel::forEachChunk(windowBegin, windowEnd, chunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                std::ostringstream stream;
+                stream.copyfmt(os);
+                for (uint64_t state = chunkBegin; state < chunkEnd; ++state) {
+                    writeState(stream, *sparseModel, state, exitRates, placeholders);
                 }
-            }
-            if (!first) {
-                os << "]";
-            }
-            os << '\n';
-
-            // Write transitions
-            for (auto it = matrix.begin(row); it != matrix.end(row); ++it) {
-                ValueType prob = it->getValue();
-                os << "\t\t" << it->getColumn() << " : ";
-                writeValue(os, prob, placeholders);
-                os << '\n';
+                chunks[(chunkBegin - windowBegin) / chunkSize] = stream.str();
+            });
+            for (auto const& chunk : chunks) {
+                os.write(chunk.data(), chunk.size());
             }
         }
-    }  // end state iteration
+    }
 }
 
 template<typename ValueType>
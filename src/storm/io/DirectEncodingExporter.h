@@ -10,6 +10,9 @@ namespace exporter {
 
 struct DirectEncodingOptions {
     bool allowPlaceholders = true;
+    // The number of threads that format the states in parallel (zero means the default number of threads).
+    // Parametric models are always written by a single thread.
+    uint64_t numberOfThreads = 0;
 };
 /*!
  * Exports a sparse model into the explicit DRN format.
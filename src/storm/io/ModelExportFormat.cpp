@@ -1,6 +1,7 @@
 #include "ModelExportFormat.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/io/CompressedFile.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -13,6 +14,8 @@ ModelExportFormat getModelExportFormatFromString(std::string const& input) {
         return ModelExportFormat::Drdd;
     } else if (input == "drn") {
         return ModelExportFormat::Drn;
+    } else if (input == "drb") {
+        return ModelExportFormat::Drb;
     } else if (input == "json") {
         return ModelExportFormat::Json;
     }
@@ -27,6 +30,8 @@ std::string toString(ModelExportFormat const& input) {
             return "drdd";
         case ModelExportFormat::Drn:
             return "drn";
+        case ModelExportFormat::Drb:
+            return "drb";
         case ModelExportFormat::Json:
             return "json";
     }
@@ -34,11 +39,12 @@ std::string toString(ModelExportFormat const& input) {
 }
 
 ModelExportFormat getModelExportFormatFromFileExtension(std::string const& filename) {
-    auto pos = filename.find_last_of('.');
+    // The format of compressed files is given by the extension before '.gz'.
+    auto pos = storm::utility::isCompressedFile(filename) ? filename.find_last_of('.', filename.size() - 4) : filename.find_last_of('.');
     STORM_LOG_THROW(pos != std::string::npos, storm::exceptions::InvalidArgumentException,
                     "Couldn't detect a file extension from input filename '" << filename << "'.");
     ++pos;
-    return getModelExportFormatFromString(filename.substr(pos));
+    return getModelExportFormatFromString(filename.substr(pos, storm::utility::isCompressedFile(filename) ? filename.size() - 3 - pos : std::string::npos));
 }
 
 }  // namespace exporter
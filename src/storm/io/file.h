@@ -14,13 +14,17 @@ namespace utility {
  * @param filepath Path and name of the file to be written to.
  * @param filestream Contains the file handler afterwards.
  * @param append If true, the new content is appended instead of clearing the existing content.
+ * @param binary If true, the file is opened in binary mode.
  */
-inline void openFile(std::string const& filepath, std::ofstream& filestream, bool append = false, bool silent = false) {
+inline void openFile(std::string const& filepath, std::ofstream& filestream, bool append = false, bool silent = false, bool binary = false) {
+    std::ios::openmode mode = std::ios::out;
     if (append) {
-        filestream.open(filepath, std::ios::app);
-    } else {
-        filestream.open(filepath);
+        mode |= std::ios::app;
     }
+    if (binary) {
+        mode |= std::ios::binary;
+    }
+    filestream.open(filepath, mode);
     STORM_LOG_THROW(filestream, storm::exceptions::FileIoException, "Could not open file " << filepath << ".");
     filestream.precision(std::cout.precision());
     if (!silent) {
@@ -1,12 +1,16 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 
+#include <map>
+
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseDeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/utility/SetInformationFromCheckTask.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/utility/FilteredRewardModel.h"
 #include "storm/utility/graph.h"
@@ -219,6 +223,8 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     auto probabilisticTransitions = this->getModel().computeProbabilityMatrix();
     storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType> helper(probabilisticTransitions, this->getModel().getExitRateVector());
     storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+    // The BSCCs of the embedded DTMC coincide with those of the CTMC.
+    helper.provideLongRunComponentDecomposition(this->getModel().getAnalysisCache().getBottomSccDecomposition(this->getModel().getTransitionMatrix()));
     auto values = helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
 
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
@@ -232,6 +238,8 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     auto probabilisticTransitions = this->getModel().computeProbabilityMatrix();
     storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType> helper(probabilisticTransitions, this->getModel().getExitRateVector());
     storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+    // The BSCCs of the embedded DTMC coincide with those of the CTMC.
+    helper.provideLongRunComponentDecomposition(this->getModel().getAnalysisCache().getBottomSccDecomposition(this->getModel().getTransitionMatrix()));
     auto values = helper.computeLongRunAverageRewards(env, rewardModel.get());
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
 }
@@ -312,6 +320,58 @@ std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::com
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(result)));
 }
 
+template<typename SparseCtmcModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::checkBatch(
+    Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+    std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+    if (!storm::NumberTraits<ValueType>::SupportsExponential) {
+        return results;
+    }
+
+    // Group the tasks that can be batched by the states satisfying their left and right subformulas.
+    std::map<std::pair<storm::storage::BitVector, storm::storage::BitVector>, std::vector<uint64_t>> batches;
+    for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+        storm::logic::Formula const& formula = checkTasks[taskIndex].getFormula();
+        if (!formula.isProbabilityOperatorFormula() || formula.asOperatorFormula().hasBound() ||
+            !formula.asOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+            continue;
+        }
+        auto const& boundedUntil = formula.asOperatorFormula().getSubformula().asBoundedUntilFormula();
+        if (boundedUntil.isMultiDimensional() || !boundedUntil.getTimeBoundReference().isTimeBound() || boundedUntil.hasLowerBound() ||
+            !boundedUntil.hasUpperBound()) {
+            continue;
+        }
+        storm::storage::BitVector phiStates = this->check(env, boundedUntil.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        storm::storage::BitVector psiStates = this->check(env, boundedUntil.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        batches[std::make_pair(std::move(phiStates), std::move(psiStates))].push_back(taskIndex);
+    }
+
+    for (auto const& batch : batches) {
+        auto const& taskIndices = batch.second;
+        if (taskIndices.size() < 2) {
+            continue;
+        }
+        STORM_LOG_INFO("Checking " << taskIndices.size() << " properties in one batch.");
+
+        std::vector<double> upperBounds;
+        bool onlyInitialStatesRelevant = true;
+        for (auto taskIndex : taskIndices) {
+            auto const& boundedUntil = checkTasks[taskIndex].getFormula().asOperatorFormula().getSubformula().asBoundedUntilFormula();
+            upperBounds.push_back(boundedUntil.template getNonStrictUpperBound<double>());
+            onlyInitialStatesRelevant &= checkTasks[taskIndex].isOnlyInitialStatesRelevantSet();
+        }
+        storm::storage::BitVector relevantValues =
+            onlyInitialStatesRelevant ? this->getModel().getInitialStates() : storm::storage::BitVector(this->getModel().getNumberOfStates(), true);
+        std::vector<std::vector<ValueType>> values = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+            env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), batch.first.first, batch.first.second,
+            this->getModel().getExitRateVector(), relevantValues, upperBounds);
+        for (uint64_t vector = 0; vector < taskIndices.size(); ++vector) {
+            results[taskIndices[vector]] = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(values[vector]));
+        }
+    }
+    return results;
+}
+
 // Explicitly instantiate the model checker.
 template class SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>>;
 
@@ -72,6 +72,15 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
      * Assumes a uniform distribution over initial states.
      */
     std::unique_ptr<CheckResult> computeExpectedVisitingTimes(Environment const& env);
+
+    /*!
+     * Checks several tasks at once. Time-bounded until probabilities (P=? [phi U<=t psi]) that share the left and
+     * right subformulas are computed in batches that need only one uniformization sweep for all time bounds.
+     *
+     * @return The results of the tasks in the same order. Tasks that are not part of a batch with at least two tasks
+     * are not checked and their result is null.
+     */
+    std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks);
 };
 
 }  // namespace modelchecker
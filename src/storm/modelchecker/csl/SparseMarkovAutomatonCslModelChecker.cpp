@@ -9,6 +9,7 @@
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/utility/FilteredRewardModel.h"
 #include "storm/utility/macros.h"
@@ -259,6 +260,8 @@ std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAu
     storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(
         this->getModel().getTransitionMatrix(), this->getModel().getMarkovianStates(), this->getModel().getExitRates());
     storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getMaximalEndComponentDecomposition());
     auto values = helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
 
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
@@ -281,6 +284,8 @@ std::unique_ptr<CheckResult> SparseMarkovAutomatonCslModelChecker<SparseMarkovAu
     storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(
         this->getModel().getTransitionMatrix(), this->getModel().getMarkovianStates(), this->getModel().getExitRates());
     storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getMaximalEndComponentDecomposition());
     auto values = helper.computeLongRunAverageRewards(env, rewardModel.get());
 
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
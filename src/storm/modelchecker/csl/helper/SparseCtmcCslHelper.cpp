@@ -6,15 +6,21 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/AdaptiveUniformizationHelper.h"
+#include "storm/solver/helper/KrylovTransientHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/NativeMultiplier.h"
 
+#include "storm/storage/SparseMatrixView.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -35,6 +41,210 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+namespace {
+/*!
+ * Creates the multiplier for the iterations of uniformization. Unless a multiplier is requested explicitly, this is
+ * the native multiplier since it adds the weighted result vectors while multiplying (in parallel if multiple threads
+ * are requested).
+ */
+template<typename ValueType>
+std::unique_ptr<storm::solver::Multiplier<ValueType>> createUniformizationMultiplier(Environment const& env,
+                                                                                     storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix) {
+    if (env.solver().multiplier().isTypeSetFromDefault() && env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
+        return std::make_unique<storm::solver::NativeMultiplier<ValueType>>(uniformizedMatrix);
+    }
+    return storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+}
+
+/*!
+ * Decides whether the iterations of uniformization can be performed on a view on the rate matrix. This saves the copy of
+ * the uniformized matrix, but the multiplications with the view are sequential. Hence, the view is only used if neither
+ * the Krylov method nor a specific multiplier needs the matrix and the native multiplier would not run in parallel.
+ */
+bool canUseUniformizedMatrixView(Environment const& env) {
+    return env.solver().timeBounded().getCtmcMethod() != storm::solver::CtmcTransientMethod::Krylov &&
+           (env.solver().multiplier().isTypeSetFromDefault() || env.solver().multiplier().getType() == storm::solver::MultiplierType::Native) &&
+           storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads() <= 1;
+}
+
+/*!
+ * Performs the matrix-vector multiplications of uniformization, either with a multiplier on the uniformized matrix or
+ * with a view on the rate matrix.
+ */
+template<typename ValueType>
+class UniformizationIterator {
+   public:
+    UniformizationIterator(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix)
+        : multiplier(createUniformizationMultiplier(env, uniformizedMatrix)), view(nullptr) {
+        // Intentionally left empty.
+    }
+
+    UniformizationIterator(storm::storage::SparseMatrixView<ValueType> const& uniformizedMatrix)
+        : view(&uniformizedMatrix), buffer(uniformizedMatrix.getRowCount()) {
+        // Intentionally left empty.
+    }
+
+    // Performs n iterations of x := A*x + b.
+    void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) {
+        if (multiplier) {
+            multiplier->repeatedMultiply(env, x, b, n);
+            return;
+        }
+        for (uint64_t iteration = 0; iteration < n; ++iteration) {
+            view->multiplyWithVector(x, buffer, b);
+            std::swap(x, buffer);
+        }
+    }
+
+    // Performs x := A*x + b and adds the new x, scaled with the given weights, to the given accumulators.
+    void multiplyAndAccumulate(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<ValueType> const& weights,
+                               std::vector<std::vector<ValueType>*> const& accumulators) {
+        if (multiplier) {
+            multiplier->multiplyAndAccumulate(env, x, b, x, weights, accumulators);
+            return;
+        }
+        view->multiplyWithVector(x, buffer, b);
+        std::swap(x, buffer);
+        for (uint64_t index = 0; index < weights.size(); ++index) {
+            storm::utility::vector::addScaledVector(*accumulators[index], x, weights[index]);
+        }
+    }
+
+   private:
+    std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplier;
+    storm::storage::SparseMatrixView<ValueType> const* view;
+    std::vector<ValueType> buffer;
+};
+
+/*!
+ * Performs the iterations of uniformization for a single time bound, see SparseCtmcCslHelper::computeTransientProbabilities.
+ */
+template<typename ValueType, bool useMixedPoissonProbabilities>
+std::vector<ValueType> performUniformization(Environment const& env, UniformizationIterator<ValueType>& iterator, std::vector<ValueType> const* addVector,
+                                             ValueType lambda, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    // Use Fox-Glynn to get the truncation points and the weights.
+    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+    // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+
+    // If the cumulative reward is to be computed, we need to adjust the weights.
+    if (useMixedPoissonProbabilities) {
+        ValueType sum = storm::utility::zero<ValueType>();
+
+        for (auto& element : foxGlynnResult.weights) {
+            sum += element;
+            element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
+        }
+    }
+
+    STORM_LOG_DEBUG("Starting iterations with " << values.size() << " states.");
+
+    // Initialize result.
+    std::vector<ValueType> result;
+    uint_fast64_t startingIteration = foxGlynnResult.left;
+    if (startingIteration == 0) {
+        result = values;
+        storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
+        ++startingIteration;
+    } else {
+        if (useMixedPoissonProbabilities) {
+            result = std::vector<ValueType>(values.size());
+            std::function<ValueType(ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate](ValueType const& a) -> ValueType {
+                return a / uniformizationRate;
+            };
+            storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
+        } else {
+            result = std::vector<ValueType>(values.size());
+        }
+    }
+
+    if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
+        // Perform the matrix-vector multiplications (without adding).
+        iterator.repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+    } else if (useMixedPoissonProbabilities) {
+        // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
+        std::vector<ValueType> const weights = {storm::utility::one<ValueType>() / uniformizationRate};
+        std::vector<std::vector<ValueType>*> const accumulators = {&result};
+        for (uint_fast64_t index = 1; index < startingIteration; ++index) {
+            iterator.multiplyAndAccumulate(env, values, nullptr, weights, accumulators);
+        }
+        // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
+        // between the left and right truncation point, we scale them here with the total sum of the weights.
+        // Note that we divide with this value afterwards. This is to improve numerical stability.
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
+    }
+
+    // For the indices that fall in between the truncation points, we need to perform the matrix-vector
+    // multiplication, scale and add the result. The multiplier does the latter while traversing the matrix.
+    std::vector<ValueType> weights(1);
+    std::vector<std::vector<ValueType>*> const accumulators = {&result};
+    for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
+        weights.front() = foxGlynnResult.weights[index - foxGlynnResult.left];
+        iterator.multiplyAndAccumulate(env, values, addVector, weights, accumulators);
+    }
+
+    // Finally, divide the result by the total weight
+    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+    return result;
+}
+
+/*!
+ * Performs the iterations of uniformization for several time bounds in one sweep, see SparseCtmcCslHelper::computeTransientProbabilitiesBatch.
+ */
+template<typename ValueType>
+std::vector<std::vector<ValueType>> performUniformizationBatch(Environment const& env, UniformizationIterator<ValueType>& iterator,
+                                                               std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+                                                               ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+    // Get the truncation points and the weights for each time bound.
+    std::vector<std::vector<ValueType>> result(timeBounds.size(), std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>()));
+    std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults;
+    std::vector<uint64_t> pendingBounds;
+    uint64_t maximalRight = 0;
+    for (uint64_t bound = 0; bound < timeBounds.size(); ++bound) {
+        ValueType lambda = timeBounds[bound] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            // If no time can pass, the current values are the result.
+            result[bound] = values;
+            foxGlynnResults.emplace_back();
+            continue;
+        }
+        foxGlynnResults.push_back(storm::utility::numerical::foxGlynn(lambda, epsilon));
+        auto const& foxGlynnResult = foxGlynnResults.back();
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[bound] << ": left=" << foxGlynnResult.left
+                                                                 << ", right=" << foxGlynnResult.right);
+        maximalRight = std::max<uint64_t>(maximalRight, foxGlynnResult.right);
+        if (foxGlynnResult.left == 0) {
+            storm::utility::vector::addScaledVector(result[bound], values, foxGlynnResult.weights.front());
+        }
+        pendingBounds.push_back(bound);
+    }
+
+    // Perform one sweep up to the largest right truncation point. In each iteration, the current vector is added to
+    // the results of all time bounds whose truncation points enclose the iteration.
+    std::vector<ValueType> currentValues = values;
+    std::vector<ValueType> weights;
+    std::vector<std::vector<ValueType>*> accumulators;
+    for (uint64_t index = 1; index <= maximalRight && !pendingBounds.empty(); ++index) {
+        weights.clear();
+        accumulators.clear();
+        for (auto bound : pendingBounds) {
+            auto const& foxGlynnResult = foxGlynnResults[bound];
+            if (index >= foxGlynnResult.left && index <= foxGlynnResult.right) {
+                weights.push_back(foxGlynnResult.weights[index - foxGlynnResult.left]);
+                accumulators.push_back(&result[bound]);
+            }
+        }
+        iterator.multiplyAndAccumulate(env, currentValues, addVector, weights, accumulators);
+    }
+
+    // Finally, divide the results by the total weights.
+    for (auto bound : pendingBounds) {
+        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[bound], storm::utility::one<ValueType>() / foxGlynnResults[bound].totalWeight);
+    }
+    return result;
+}
+}  // namespace
+
 template<typename ValueType>
 bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon,
                                                                     std::vector<ValueType> const& resultVector,
@@ -132,8 +342,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
                         // Compute the uniformized matrix.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                        auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
 
                         // Compute the vector that is to be added as a compensation for removing the absorbing states.
                         std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -144,7 +353,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         // Finally compute the transient probabilities.
                         std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                         std::vector<ValueType> subresult =
-                            computeTransientProbabilities(env, uniformizedMatrix, &b, upperBound, uniformizationRate, values, epsilon);
+                            computeTransientProbabilities(env, *uniformizedMatrix, &b, upperBound, uniformizationRate, values, epsilon);
                         storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult);
                     }
                 } else if (upperBound == storm::utility::infinity<ValueType>()) {
@@ -168,11 +377,10 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
                     // Compute the uniformized matrix.
-                    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                        computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                    auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, relevantStates, uniformizationRate, exitRates);
 
                     // Compute the transient probabilities.
-                    subResult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult, epsilon);
+                    subResult = computeTransientProbabilities<ValueType>(env, *uniformizedMatrix, nullptr, lowerBound, uniformizationRate, subResult, epsilon);
 
                     // Fill in the correct values.
                     storm::utility::vector::setVectorValues(result, ~relevantStates, storm::utility::zero<ValueType>());
@@ -196,8 +404,8 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                             STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
                             // Compute the (first) uniformized matrix.
-                            storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                                computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                            auto uniformizedMatrix =
+                                computeUniformizedMatrixView(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
 
                             // Compute the vector that is to be added as a compensation for removing the absorbing states.
                             std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
@@ -209,7 +417,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                             std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                             // divide the possible error by two since we will make this error two times.
                             std::vector<ValueType> subresult =
-                                computeTransientProbabilities(env, uniformizedMatrix, &b, upperBound - lowerBound, uniformizationRate, values,
+                                computeTransientProbabilities(env, *uniformizedMatrix, &b, upperBound - lowerBound, uniformizationRate, values,
                                                               epsilon / storm::utility::convertNumber<ValueType>(2.0));
                             storm::utility::vector::setVectorValues(newSubresult, statesWithProbabilityGreater0NonPsi % relevantStates, subresult);
                         }
@@ -224,9 +432,8 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
                         // Finally, we compute the second set of transient probabilities.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, relevantStates, uniformizationRate, exitRates);
-                        newSubresult = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult,
+                        auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, relevantStates, uniformizationRate, exitRates);
+                        newSubresult = computeTransientProbabilities<ValueType>(env, *uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult,
                                                                                 epsilon / storm::utility::convertNumber<ValueType>(2.0));
 
                         // Fill in the correct values.
@@ -249,10 +456,9 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
                         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
                         // Finally, we compute the second set of transient probabilities.
-                        storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-                            computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
+                        auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, statesWithProbabilityGreater0, uniformizationRate, exitRates);
                         newSubresult =
-                            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
+                            computeTransientProbabilities<ValueType>(env, *uniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
 
                         // Fill in the correct values.
                         result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
@@ -277,6 +483,71 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+    storm::storage::BitVector const& relevantValues, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<ValueType> timeBounds;
+    for (auto upperBound : upperBounds) {
+        STORM_LOG_THROW(upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidOperationException,
+                        "Expected finite time bounds for batched bounded until probabilities.");
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+    }
+
+    std::vector<std::vector<ValueType>> result(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+    for (auto& boundResult : result) {
+        storm::utility::vector::setVectorValues<ValueType>(boundResult, psiStates, storm::utility::one<ValueType>());
+    }
+
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+    if (statesWithProbabilityGreater0NonPsi.empty()) {
+        return result;
+    }
+
+    // As all time bounds are of the form [0, t], they share the uniformized matrix and the compensation vector,
+    // see computeBoundedUntilProbabilities.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+    auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+    storm::storage::BitVector relevantPositions = relevantValues & statesWithProbabilityGreater0;
+    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<std::vector<ValueType>> subresults =
+            computeTransientProbabilitiesBatch(env, *uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+        repeat = false;
+        for (uint64_t bound = 0; bound < result.size(); ++bound) {
+            storm::utility::vector::setVectorValues(result[bound], statesWithProbabilityGreater0NonPsi, subresults[bound]);
+            repeat |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result[bound], relevantPositions);
+        }
+    } while (repeat);
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+    Environment const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&,
+    storm::storage::BitVector const&, std::vector<ValueType> const&, storm::storage::BitVector const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -302,7 +573,21 @@ template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                      std::vector<ValueType> const& exitRateVector,
                                                                      storm::storage::BitVector const& nextStates) {
-    return SparseDtmcPrctlHelper<ValueType>::computeNextProbabilities(env, computeProbabilityMatrix(rateMatrix, exitRateVector), nextStates);
+    // As the embedded DTMC is only multiplied once, we multiply with a view on the rate matrix that scales the rows instead of copying it.
+    storm::storage::SparseMatrixView<ValueType> probabilityMatrix(rateMatrix, storm::storage::BitVector(rateMatrix.getRowCount(), true),
+                                                                  storm::storage::BitVector(rateMatrix.getColumnCount(), true));
+    std::vector<ValueType> rowFactors;
+    rowFactors.reserve(rateMatrix.getRowCount());
+    for (auto const& exitRate : exitRateVector) {
+        rowFactors.push_back(storm::utility::isZero(exitRate) ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>() / exitRate);
+    }
+    probabilityMatrix.setScaling(std::move(rowFactors));
+
+    std::vector<ValueType> nextStatesVector(nextStates.size(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(nextStatesVector, nextStates, storm::utility::one<ValueType>());
+    std::vector<ValueType> result(rateMatrix.getRowCount());
+    probabilityMatrix.multiplyWithVector(nextStatesVector, result);
+    return result;
 }
 
 template<typename ValueType, typename RewardModelType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -336,8 +621,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeInstantaneousRewards(Environm
     uniformizationRate *= 1.02;
     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
-    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-        computeUniformizedMatrix(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
+    auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
 
     // Set the possible error allowed for truncation (epsilon for fox-glynn)
     ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision());
@@ -358,7 +642,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeInstantaneousRewards(Environm
 
     // Loop until the desired precision is reached.
     do {
-        result = computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, result, epsilon);
+        result = computeTransientProbabilities<ValueType>(env, *uniformizedMatrix, nullptr, timeBound, uniformizationRate, result, epsilon);
     } while (checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
 
     return result;
@@ -399,8 +683,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeCumulativeRewards(Environment
     uniformizationRate *= 1.02;
     STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
-    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
-        computeUniformizedMatrix(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
+    auto uniformizedMatrix = computeUniformizedMatrixView(rateMatrix, storm::storage::BitVector(numberOfStates, true), uniformizationRate, exitRateVector);
 
     // Compute the total state reward vector.
     std::vector<ValueType> totalRewardVector = rewardModel.getTotalRewardVector(rateMatrix, exitRateVector);
@@ -431,7 +714,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeCumulativeRewards(Environment
     // Loop until the desired precision is reached.
     std::vector<ValueType> result;
     do {
-        result = computeTransientProbabilities<ValueType, true>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, totalRewardVector, epsilon);
+        result = computeTransientProbabilities<ValueType, true>(env, *uniformizedMatrix, nullptr, timeBound, uniformizationRate, totalRewardVector, epsilon);
     } while (checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
 
     return result;
@@ -581,10 +864,23 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
         uniformizationRate *= 1.02;
         STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
 
+        ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+        STORM_LOG_WARN_COND(!env.solver().timeBounded().getRelativeTerminationCriterion(),
+                            "Computation of transient probabilities with relative precision not supported. Using absolute precision instead.");
+        ValueType initDist = storm::utility::one<ValueType>() / initialStates.getNumberOfSetBits();
+
+        if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::AdaptiveUniformization) {
+            // Adaptive uniformization works on the forward (untransposed) chain.
+            std::vector<ValueType> initialDistribution(numberOfStates, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(initialDistribution, initialStates, initDist);
+            return storm::solver::helper::computeTransientDistributionAdaptiveUniformization(transposedMatrix, newRates, initialDistribution,
+                                                                                             storm::utility::convertNumber<ValueType>(timeBound), epsilon);
+        }
+
         transposedMatrix = transposedMatrix.transpose();
 
         // Compute the uniformized matrix.
-        storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(transposedMatrix, relevantStates, uniformizationRate, newRates);
+        auto uniformizedMatrix = computeUniformizedMatrixView(transposedMatrix, relevantStates, uniformizationRate, newRates);
 
         // Compute the vector that is to be added as a compensation for removing the absorbing states.
         /*std::vector<ValueType> b = transposedMatrix.getConstrainedRowSumVector(relevantStates, initialStates);
@@ -593,13 +889,9 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
             std::cout << element << '\n';
         }*/
 
-        ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
-        STORM_LOG_WARN_COND(!env.solver().timeBounded().getRelativeTerminationCriterion(),
-                            "Computation of transient probabilities with relative precision not supported. Using absolute precision instead.");
         std::vector<ValueType> values(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
         // Set initial states
         size_t i = 0;
-        ValueType initDist = storm::utility::one<ValueType>() / initialStates.getNumberOfSetBits();
         for (auto state : relevantStates) {
             if (initialStates.get(state)) {
                 values[i] = initDist;
@@ -608,7 +900,7 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
         }
         // Finally compute the transient probabilities.
         std::vector<ValueType> subresult =
-            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
+            computeTransientProbabilities<ValueType>(env, *uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
 
         storm::utility::vector::setVectorValues(result, relevantStates, subresult);
     }
@@ -630,26 +922,24 @@ storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeUniformizedM
     STORM_LOG_DEBUG("Computing uniformized matrix using uniformization rate " << uniformizationRate << ".");
     STORM_LOG_DEBUG("Keeping " << maybeStates.getNumberOfSetBits() << " rows.");
 
-    // Create the submatrix that only contains the states with a positive probability (including the
-    // psi states) and reserve space for elements on the diagonal.
-    storm::storage::SparseMatrix<ValueType> uniformizedMatrix = rateMatrix.getSubmatrix(false, maybeStates, maybeStates, true);
+    return computeUniformizedMatrixView(rateMatrix, maybeStates, uniformizationRate, exitRates)->materialize();
+}
 
-    // Now we need to perform the actual uniformization. That is, all entries need to be divided by
-    // the uniformization rate, and the diagonal needs to be set to the negative exit rate of the
-    // state plus the self-loop rate and then increased by one.
-    uint_fast64_t currentRow = 0;
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::unique_ptr<storm::storage::SparseMatrixView<ValueType>> SparseCtmcCslHelper::computeUniformizedMatrixView(
+    storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& maybeStates, ValueType uniformizationRate,
+    std::vector<ValueType> const& exitRates) {
+    // The uniformized matrix is obtained by dividing all entries by the uniformization rate and adding one minus the
+    // scaled exit rate of the state to the diagonal. The view does both on the fly.
+    auto result = std::make_unique<storm::storage::SparseMatrixView<ValueType>>(rateMatrix, maybeStates, maybeStates);
+    std::vector<ValueType> rowFactors(maybeStates.getNumberOfSetBits(), storm::utility::one<ValueType>() / uniformizationRate);
+    std::vector<ValueType> diagonalSummands;
+    diagonalSummands.reserve(rowFactors.size());
     for (auto state : maybeStates) {
-        for (auto& element : uniformizedMatrix.getRow(currentRow)) {
-            if (element.getColumn() == currentRow) {
-                element.setValue((element.getValue() - exitRates[state]) / uniformizationRate + storm::utility::one<ValueType>());
-            } else {
-                element.setValue(element.getValue() / uniformizationRate);
-            }
-        }
-        ++currentRow;
+        diagonalSummands.push_back(storm::utility::one<ValueType>() - exitRates[state] / uniformizationRate);
     }
-
-    return uniformizedMatrix;
+    result->setScaling(std::move(rowFactors), std::move(diagonalSummands));
+    return result;
 }
 
 template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
@@ -666,76 +956,85 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
-    // Use Fox-Glynn to get the truncation points and the weights.
-    storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
-    STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
-    // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
+    auto const method = env.solver().timeBounded().getCtmcMethod();
+    if (method == storm::solver::CtmcTransientMethod::Krylov) {
+        return storm::solver::helper::computeTransientProbabilitiesKrylov(uniformizedMatrix, uniformizationRate, addVector, values, {timeBound}, epsilon,
+                                                                          useMixedPoissonProbabilities)
+            .front();
+    }
+    STORM_LOG_INFO_COND(method != storm::solver::CtmcTransientMethod::AdaptiveUniformization,
+                        "Adaptive uniformization is only applicable to transient distributions. Using standard uniformization instead.");
 
-    // If the cumulative reward is to be computed, we need to adjust the weights.
-    if (useMixedPoissonProbabilities) {
-        ValueType sum = storm::utility::zero<ValueType>();
+    UniformizationIterator<ValueType> iterator(env, uniformizedMatrix);
+    return performUniformization<ValueType, useMixedPoissonProbabilities>(env, iterator, addVector, lambda, uniformizationRate, std::move(values), epsilon);
+}
 
-        for (auto& element : foxGlynnResult.weights) {
-            sum += element;
-            element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
-        }
+template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                          storm::storage::SparseMatrixView<ValueType> const& uniformizedMatrix,
+                                                                          std::vector<ValueType> const* addVector, ValueType timeBound,
+                                                                          ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+    if (!canUseUniformizedMatrixView(env)) {
+        return computeTransientProbabilities<ValueType, useMixedPoissonProbabilities>(env, uniformizedMatrix.materialize(), addVector, timeBound,
+                                                                                      uniformizationRate, std::move(values), epsilon);
     }
 
-    STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    ValueType lambda = timeBound * uniformizationRate;
 
-    // Initialize result.
-    std::vector<ValueType> result;
-    uint_fast64_t startingIteration = foxGlynnResult.left;
-    if (startingIteration == 0) {
-        result = values;
-        storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
-        ++startingIteration;
-    } else {
-        if (useMixedPoissonProbabilities) {
-            result = std::vector<ValueType>(values.size());
-            std::function<ValueType(ValueType const&)> scaleWithUniformizationRate = [&uniformizationRate](ValueType const& a) -> ValueType {
-                return a / uniformizationRate;
-            };
-            storm::utility::vector::applyPointwise(values, result, scaleWithUniformizationRate);
-        } else {
-            result = std::vector<ValueType>(values.size());
-        }
+    // If no time can pass, the current values are the result.
+    if (storm::utility::isZero(lambda)) {
+        return values;
     }
+    STORM_LOG_INFO_COND(env.solver().timeBounded().getCtmcMethod() != storm::solver::CtmcTransientMethod::AdaptiveUniformization,
+                        "Adaptive uniformization is only applicable to transient distributions. Using standard uniformization instead.");
 
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-    if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-        // Perform the matrix-vector multiplications (without adding).
-        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-    } else if (useMixedPoissonProbabilities) {
-        std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate](ValueType const& a, ValueType const& b) {
-            return a + b / uniformizationRate;
-        };
+    UniformizationIterator<ValueType> iterator(uniformizedMatrix);
+    return performUniformization<ValueType, useMixedPoissonProbabilities>(env, iterator, addVector, lambda, uniformizationRate, std::move(values), epsilon);
+}
 
-        // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-        for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-            multiplier->multiply(env, values, nullptr, values);
-            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+        // The Krylov method handles all time bounds in a single pass, but needs them in ascending order.
+        std::vector<uint64_t> order(timeBounds.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&timeBounds](uint64_t a, uint64_t b) { return timeBounds[a] < timeBounds[b]; });
+        std::vector<ValueType> sortedTimeBounds;
+        for (auto bound : order) {
+            sortedTimeBounds.push_back(timeBounds[bound]);
         }
-        // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
-        // between the left and right truncation point, we scale them here with the total sum of the weights.
-        // Note that we divide with this value afterwards. This is to improve numerical stability.
-        storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, foxGlynnResult.totalWeight);
+        auto sortedResult =
+            storm::solver::helper::computeTransientProbabilitiesKrylov(uniformizedMatrix, uniformizationRate, addVector, values, sortedTimeBounds, epsilon);
+        std::vector<std::vector<ValueType>> result(timeBounds.size());
+        for (uint64_t index = 0; index < order.size(); ++index) {
+            result[order[index]] = std::move(sortedResult[index]);
+        }
+        return result;
     }
 
-    // For the indices that fall in between the truncation points, we need to perform the matrix-vector
-    // multiplication, scale and add the result.
-    ValueType weight = 0;
-    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
-    for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-        multiplier->multiply(env, values, addVector, values);
+    UniformizationIterator<ValueType> iterator(env, uniformizedMatrix);
+    return performUniformizationBatch(env, iterator, addVector, timeBounds, uniformizationRate, values, epsilon);
+}
 
-        weight = foxGlynnResult.weights[index - foxGlynnResult.left];
-        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrixView<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+    if (!canUseUniformizedMatrixView(env)) {
+        return computeTransientProbabilitiesBatch(env, uniformizedMatrix.materialize(), addVector, timeBounds, uniformizationRate, values, epsilon);
     }
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
 
-    // Finally, divide the result by the total weight
-    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-    return result;
+    UniformizationIterator<ValueType> iterator(uniformizedMatrix);
+    return performUniformizationBatch(env, iterator, addVector, timeBounds, uniformizationRate, values, epsilon);
 }
 
 template<typename ValueType>
@@ -773,6 +1072,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates,
+    storm::storage::BitVector const& relevantValues, std::vector<double> const& upperBounds);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -835,6 +1139,29 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::unique_ptr<storm::storage::SparseMatrixView<double>> SparseCtmcCslHelper::computeUniformizedMatrixView(
+    storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate,
+    std::vector<double> const& exitRates);
+
+template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities<double, true>(Environment const& env,
+                                                                                              storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                                              std::vector<double> const* addVector, double timeBound,
+                                                                                              double uniformizationRate, std::vector<double> values,
+                                                                                              double epsilon);
+
+template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                storm::storage::SparseMatrixView<double> const& uniformizedMatrix,
+                                                                                std::vector<double> const* addVector, double timeBound,
+                                                                                double uniformizationRate, std::vector<double> values, double epsilon);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> const& values, double epsilon);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrixView<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> const& values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
@@ -845,6 +1172,17 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, storm::storage::BitVector const& relevantValues,
+    std::vector<double> const& upperBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesBatch(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, storm::storage::BitVector const& relevantValues,
+    std::vector<double> const& upperBounds);
+
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
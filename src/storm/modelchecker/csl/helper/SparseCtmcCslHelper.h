@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_SPARSE_CTMC_CSL_MODELCHECKER_HELPER_H_
 #define STORM_MODELCHECKER_SPARSE_CTMC_CSL_MODELCHECKER_HELPER_H_
 
+#include <memory>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/solver/LinearEquationSolver.h"
@@ -16,6 +18,8 @@ class Environment;
 
 namespace storage {
 class StronglyConnectedComponent;
+template<typename ValueType>
+class SparseMatrixView;
 }
 
 namespace modelchecker {
@@ -38,6 +42,27 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi U[0,t] psi for several time bounds t at once. As the time bounds
+     * share the uniformized matrix, all of them are obtained within a single uniformization sweep whose length is
+     * determined by the largest time bound.
+     *
+     * @param relevantValues The states for which the precision needs to be guaranteed (if a relative precision is requested).
+     * @param upperBounds The (finite) time bounds.
+     * @return For each time bound, the probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesBatch(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+        storm::storage::BitVector const& relevantValues, std::vector<double> const& upperBounds);
+
+    template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesBatch(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+        storm::storage::BitVector const& relevantValues, std::vector<double> const& upperBounds);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -122,6 +147,17 @@ class SparseCtmcCslHelper {
                                                                             storm::storage::BitVector const& maybeStates, ValueType uniformizationRate,
                                                                             std::vector<ValueType> const& exitRates);
 
+    /*!
+     * Computes a view on the rate matrix that represents the uniformized matrix (see computeUniformizedMatrix) by scaling
+     * the rows on the fly. As opposed to computeUniformizedMatrix, this does not copy the transitions. The view refers to
+     * the given rate matrix, which must outlive it.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::unique_ptr<storm::storage::SparseMatrixView<ValueType>> computeUniformizedMatrixView(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                                    storm::storage::BitVector const& maybeStates,
+                                                                                                    ValueType uniformizationRate,
+                                                                                                    std::vector<ValueType> const& exitRates);
+
     /*!
      * Computes the transient probabilities for lambda time steps.
      *
@@ -142,6 +178,39 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for lambda time steps by multiplying with a view on the rate matrix (see
+     * computeUniformizedMatrixView). If the requested method or multiplier needs the uniformized matrix explicitly (or the
+     * multiplications are to be performed in parallel), the view is materialized.
+     */
+    template<typename ValueType, bool useMixedPoissonProbabilities = false,
+             typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrixView<ValueType> const& uniformizedMatrix,
+                                                                std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
+                                                                std::vector<ValueType> values, ValueType epsilon);
+
+    /*!
+     * Computes the transient probabilities for several time bounds within a single sweep, see computeTransientProbabilities.
+     * In every iteration, the current vector is accumulated into the results of all time bounds whose truncation
+     * points enclose the iteration.
+     *
+     * @param timeBounds The time bounds to use.
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesBatch(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+        std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon);
+
+    /*!
+     * Computes the transient probabilities for several time bounds within a single sweep by multiplying with a view on the
+     * rate matrix, see computeTransientProbabilitiesBatch.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeTransientProbabilitiesBatch(
+        Environment const& env, storm::storage::SparseMatrixView<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+        std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -24,6 +24,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -131,19 +132,32 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // Set up the data for the inner iterations. The iterations for the upper and the lower bound are independent of each other, so each of them
+        // gets its own auxiliary memory and solver for the transitions between probabilistic states (if there are some).
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
-
-        // Allocate auxiliary memory that can be used during the iterations
-        std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
-        std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
+        uint64_t const numberOfMaybeStates = maybeStates.getNumberOfSetBits();
+        std::array<InnerIterationData, 2> innerIterationData;
+        for (auto& data : innerIterationData) {
+            data.values.resize(numberOfMaybeStates, storm::utility::zero<ValueType>());
+            data.bound.resize(numberOfMaybeStates, storm::utility::zero<ValueType>());
+            data.nextMarkovianStateValues.resize(markovianMaybeStates.getNumberOfSetBits());
+            data.nextProbabilisticStateValues.resize(probabilisticToProbabilisticTransitions.getRowGroupCount());
+            data.eqSysRhs.resize(probabilisticToProbabilisticTransitions.getRowCount());
+            data.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        }
+        InnerIterationData& upperData = innerIterationData[0];
+        InnerIterationData& lowerData = innerIterationData[1];
+        // The iterations for both bounds run concurrently if more than one thread is available. Otherwise, the lower bound is only computed if the
+        // upper bound is not already close enough to the lower bound obtained for the previous uniformization rate.
+        bool const computeBoundsInParallel = storm::utility::parallel::getDefaultNumberOfThreads() > 1;
+
+        // The bounds on the values of the maybe states. Since the bounds obtained for a uniformization rate remain valid when the rate is refined, they
+        // are combined with the bounds of the previous rates.
+        std::vector<ValueType> maybeStatesValuesLower(numberOfMaybeStates, storm::utility::zero<ValueType>());
+        std::vector<ValueType> maybeStatesValuesUpper(numberOfMaybeStates, storm::utility::zero<ValueType>());
+        // The kappa for which the upper bounds were computed. Upper bounds are only comparable if they were computed with the same truncation error.
+        boost::optional<ValueType> upperBoundKappa;
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -161,14 +175,19 @@ class UnifPlusHelper {
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
             // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            for (auto& data : innerIterationData) {
+                data.markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+                data.probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            }
 
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
-                auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
+            // Performs the inner iterations for the upper or the lower bound. Returns false if the iterations were aborted.
+            auto performInnerIterations = [&](bool computeLowerBound, InnerIterationData& data) {
+                auto& maybeStatesValues = computeLowerBound ? data.bound : data.values;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                if (!computeLowerBound) {
+                    // The upper bound is accumulated over the steps.
+                    std::fill(data.bound.begin(), data.bound.end(), storm::utility::zero<ValueType>());
+                }
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
                 progressSteps.setMaxCount(N);
@@ -199,12 +218,12 @@ class UnifPlusHelper {
                         // Reaching this point means that this is the very first relevant iteration.
                         // If we are in the very first relevant iteration, we know that all states from the previous iteration have value zero.
                         // It is therefore valid (and necessary) to just set the values of Markovian states to zero.
-                        std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
+                        std::fill(data.nextMarkovianStateValues.begin(), data.nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        data.markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, data.nextMarkovianStateValues);
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
-                            nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
+                            data.nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
                     }
 
@@ -216,46 +235,77 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    data.probabilisticToMarkovianMultiplier->multiply(env, data.nextMarkovianStateValues, nullptr, data.eqSysRhs);
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
-                        eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
+                        data.eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (data.solver) {
+                        data.solver->solveEquations(solverEnv, dir, data.nextProbabilisticStateValues, data.eqSysRhs);
                     } else {
-                        storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
+                        storm::utility::vector::reduceVectorMinOrMax(dir, data.eqSysRhs, data.nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
                     }
 
                     // Create the new values for the maybestates
                     // Fuse the results together
-                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, nextMarkovianStateValues);
-                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, nextProbabilisticStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, markovianStatesModMaybeStates, data.nextMarkovianStateValues);
+                    storm::utility::vector::setVectorValues(maybeStatesValues, probabilisticStatesModMaybeStates, data.nextProbabilisticStateValues);
                     if (!computeLowerBound) {
                         // Add the scaled values to the actual result vector
                         uint64_t i = N - 1 - k;
                         if (i >= foxGlynnResult.left) {
                             assert(i <= foxGlynnResult.right);  // has to hold since this iteration is considered relevant.
                             ValueType const& weight = foxGlynnResult.weights[i - foxGlynnResult.left];
-                            storm::utility::vector::addScaledVector(maybeStatesValuesUpper, maybeStatesValuesWeightedUpper, weight);
+                            storm::utility::vector::addScaledVector(data.bound, maybeStatesValues, weight);
                         }
                     }
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
-                        break;
+                        return false;
                     }
                 }
-
-                if (computeLowerBound) {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesLower, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
-                } else {
-                    storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                storm::utility::vector::scaleVectorInPlace(data.bound, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+                return true;
+            };
+
+            // Perform the inner iterations for the upper bound and, if both bounds are computed in parallel, for the lower bound.
+            std::array<bool, 2> finishedInnerIterations = {false, false};
+            uint64_t const numberOfBounds = computeBoundsInParallel ? 2 : 1;
+            storm::utility::parallel::forEachChunk(0, numberOfBounds, 1, numberOfBounds, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                for (uint64_t bound = chunkBegin; bound < chunkEnd; ++bound) {
+                    finishedInnerIterations[bound] = performInnerIterations(bound == 1, innerIterationData[bound]);
                 }
+            });
+            abortedInnerIterations = !finishedInnerIterations[0] || (computeBoundsInParallel && !finishedInnerIterations[1]);
+            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                break;
+            }
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
+            // Combine the new upper bound with the previous one.
+            if (upperBoundKappa && upperBoundKappa.get() == kappa) {
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                    maybeStatesValuesUpper, upperData.bound, maybeStatesValuesUpper,
+                    [](ValueType const& a, ValueType const& b) -> ValueType { return storm::utility::min(a, b); });
+            } else {
+                maybeStatesValuesUpper = upperData.bound;
+                upperBoundKappa = kappa;
+            }
+            for (uint64_t bound = 0; bound < 2 && !converged; ++bound) {
+                if (bound == 1) {
+                    if (!computeBoundsInParallel) {
+                        if (!performInnerIterations(true, lowerData)) {
+                            abortedInnerIterations = true;
+                            break;
+                        }
+                    }
+                    // Combine the new lower bound with the previous one.
+                    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                        maybeStatesValuesLower, lowerData.bound, maybeStatesValuesLower,
+                        [](ValueType const& a, ValueType const& b) -> ValueType { return storm::utility::max(a, b); });
+                } else if (computeBoundsInParallel) {
+                    // The new lower bound is already available, so the bounds are only compared once it is taken into account.
+                    continue;
                 }
 
                 // Check if the lower and upper bound are sufficiently close to each other
@@ -274,6 +324,9 @@ class UnifPlusHelper {
                     }
                 }
             }
+            if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                break;
+            }
 
             if (!converged) {
                 // Increase the uniformization rate and prepare the next run
@@ -298,9 +351,6 @@ class UnifPlusHelper {
 
                 // Apply uniformization with new rate
                 uniformize(markovianToMaybeTransitions, markovianToPsiProbabilities, oldLambda, lambda, markovianStatesModMaybeStates);
-
-                // Reset the values of the maybe states to zero.
-                std::fill(maybeStatesValuesUpper.begin(), maybeStatesValuesUpper.end(), storm::utility::zero<ValueType>());
             }
             progressIterations.updateProgress(++iteration);
             if (storm::utility::resources::isTerminate()) {
@@ -481,6 +531,20 @@ class UnifPlusHelper {
         return sparseResult;
     }
 
+    // The auxiliary memory for the inner iterations computing either the upper or the lower bound.
+    struct InnerIterationData {
+        // The values of the maybe states in the current step.
+        std::vector<ValueType> values;
+        // The (upper or lower) bound obtained by the inner iterations.
+        std::vector<ValueType> bound;
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+    };
+
     storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
     std::vector<ValueType> const& exitRateVector;
     storm::storage::BitVector const& markovianStates;
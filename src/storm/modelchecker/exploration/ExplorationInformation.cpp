@@ -45,7 +45,10 @@ void ExplorationInformation<StateType, ValueType>::removeUnexploredState(const_i
 
 template<typename StateType, typename ValueType>
 void ExplorationInformation<StateType, ValueType>::addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState) {
-    stateToRowGroupMapping.push_back(unexploredMarker);
+    // States may be registered out of order if they were discovered by the workers of a multi-threaded exploration.
+    if (stateId >= stateToRowGroupMapping.size()) {
+        stateToRowGroupMapping.resize(stateId + 1, unexploredMarker);
+    }
     unexploredStates[stateId] = compressedState;
 }
 
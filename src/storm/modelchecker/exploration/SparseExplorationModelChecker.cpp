@@ -1,5 +1,9 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -25,8 +29,10 @@
 #include "storm/settings/modules/ExplorationSettings.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/Stopwatch.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/prism.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -85,6 +91,12 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                     "Currently only models with one initial state are supported by the exploration engine.");
     StateType initialStateIndex = stateGeneration.getFirstInitialState();
 
+    // If requested, sample paths with several workers concurrently.
+    uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads();
+    if (numberOfThreads > 1) {
+        return performConcurrentExploration(stateGeneration, explorationInformation, initialStateIndex, numberOfThreads);
+    }
+
     // Create a structure that holds the bounds for the states and actions.
     Bounds<StateType, ValueType> bounds;
 
@@ -134,6 +146,201 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+struct SparseExplorationModelChecker<ModelType, StateType>::ConcurrentExploration {
+    // Guards the exploration information and the bounds. Sampling a path only requires shared access, whereas adding
+    // explored states, updating the bounds and performing precomputations requires exclusive access.
+    std::shared_mutex mutex;
+
+    // Counts the performed precomputations. As a precomputation may collapse MECs (and thereby invalidate the
+    // actions on the stacks of the workers), paths that were sampled across a precomputation are discarded.
+    uint64_t epoch = 0;
+
+    // The counters that trigger a precomputation.
+    std::atomic<std::size_t> explorationStepsSinceLastPrecomputation{0};
+    std::size_t pathsSampledSinceLastPrecomputation = 0;
+
+    // Set as soon as the workers need to stop, i.e., if the bounds of the initial state converged or a worker failed.
+    std::atomic<bool> done{false};
+};
+
+template<typename ModelType, typename StateType>
+std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType>
+SparseExplorationModelChecker<ModelType, StateType>::performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                  ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                  StateType const& initialStateIndex, uint64_t numberOfThreads) const {
+    STORM_LOG_INFO("Sampling paths with " << numberOfThreads << " workers.");
+    Bounds<StateType, ValueType> bounds;
+    ConcurrentExploration concurrentExploration;
+
+    // Each worker gets its own state generation (sharing the state storage), random number generator and statistics.
+    std::vector<std::unique_ptr<StateGeneration<StateType, ValueType>>> workerStateGenerations;
+    std::vector<std::default_random_engine> workerGenerators;
+    std::vector<Statistics<StateType, ValueType>> workerStatistics(numberOfThreads);
+    std::vector<double> workerSeconds(numberOfThreads);
+    for (uint64_t worker = 0; worker < numberOfThreads; ++worker) {
+        workerStateGenerations.push_back(std::make_unique<StateGeneration<StateType, ValueType>>(program, stateGeneration));
+        workerGenerators.emplace_back(randomGenerator());
+    }
+
+    storm::utility::parallel::forEachChunk(0, numberOfThreads, 1, numberOfThreads, [&](uint64_t, uint64_t worker, uint64_t) {
+        storm::utility::Stopwatch workerWatch(true);
+        try {
+            samplePathsConcurrently(concurrentExploration, *workerStateGenerations[worker], explorationInformation, initialStateIndex, bounds,
+                                    workerStatistics[worker], workerGenerators[worker]);
+        } catch (...) {
+            // Make the other workers stop as well.
+            concurrentExploration.done = true;
+            throw;
+        }
+        workerWatch.stop();
+        workerSeconds[worker] = workerWatch.getTimeInMilliseconds() / 1000.0;
+    });
+
+    // Show statistics if required.
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        Statistics<StateType, ValueType> stats;
+        for (uint64_t worker = 0; worker < numberOfThreads; ++worker) {
+            stats.addWorker(workerStatistics[worker], workerSeconds[worker]);
+        }
+        stats.printToStream(std::cout, explorationInformation);
+    }
+
+    return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation),
+                           bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::samplePathsConcurrently(ConcurrentExploration& concurrentExploration,
+                                                                                  StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                  ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                  StateType const& initialStateIndex, Bounds<StateType, ValueType>& bounds,
+                                                                                  Statistics<StateType, ValueType>& stats,
+                                                                                  std::default_random_engine& generator) const {
+    StateActionStack stack;
+    while (!concurrentExploration.done) {
+        uint64_t epoch;
+        bool result = samplePathConcurrently(concurrentExploration, stateGeneration, explorationInformation, stack, bounds, stats, generator, epoch);
+
+        stats.sampledPath();
+        stats.updateMaxPathLength(stack.size());
+
+        std::unique_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+
+        // The bounds can only be updated if no precomputation changed the structure since the path was sampled.
+        if (result && epoch == concurrentExploration.epoch) {
+            STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+        }
+        stack.clear();
+
+        if (comparator.isZero(bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation))) {
+            concurrentExploration.done = true;
+        } else if (explorationInformation.performPrecomputationExcessiveSampledPaths(++concurrentExploration.pathsSampledSinceLastPrecomputation)) {
+            performPrecomputation(stack, explorationInformation, bounds, stats);
+            ++concurrentExploration.epoch;
+            concurrentExploration.explorationStepsSinceLastPrecomputation = 0;
+        }
+    }
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::samplePathConcurrently(ConcurrentExploration& concurrentExploration,
+                                                                                 StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                 ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                 StateActionStack& stack, Bounds<StateType, ValueType>& bounds,
+                                                                                 Statistics<StateType, ValueType>& stats, std::default_random_engine& generator,
+                                                                                 uint64_t& epoch) const {
+    std::shared_lock<std::shared_mutex> lock(concurrentExploration.mutex);
+    epoch = concurrentExploration.epoch;
+
+    // Start the search from the initial state.
+    stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
+
+    bool foundTerminalState = false;
+    while (!foundTerminalState && !concurrentExploration.done) {
+        StateType currentStateId = stack.back().first;
+
+        auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+        if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+            // Expand the state without holding the lock, such that the other workers can proceed meanwhile.
+            storm::generator::CompressedState compressedState = unexploredIt->second;
+            lock.unlock();
+            stateGeneration.load(compressedState);
+            bool isTargetState = stateGeneration.isTargetState();
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            if (!isTargetState && stateGeneration.isConditionState()) {
+                behavior = stateGeneration.expand();
+            }
+            std::vector<std::pair<StateType, storm::generator::CompressedState>> discoveredStates = stateGeneration.takeDiscoveredStates();
+
+            {
+                std::unique_lock<std::shared_mutex> exclusiveLock(concurrentExploration.mutex);
+                if (epoch != concurrentExploration.epoch) {
+                    return false;
+                }
+
+                // Another worker may have explored the state in the meantime, in which case the behavior is dropped.
+                unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                    registerDiscoveredStates(discoveredStates, explorationInformation);
+                    foundTerminalState = addExploredState(currentStateId, isTargetState, behavior, explorationInformation, bounds, stats);
+                    explorationInformation.removeUnexploredState(unexploredIt);
+                } else {
+                    foundTerminalState = explorationInformation.isTerminal(currentStateId);
+                }
+            }
+
+            lock.lock();
+            if (epoch != concurrentExploration.epoch) {
+                return false;
+            }
+        } else if (explorationInformation.isTerminal(currentStateId)) {
+            foundTerminalState = true;
+        }
+
+        stats.explorationStep();
+
+        if (!foundTerminalState) {
+            ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+            stack.back().second = chosenAction;
+            stack.emplace_back(sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator), 0);
+
+            // If the number of exploration steps exceeds a certain threshold, do a precomputation (unless another
+            // worker did so in the meantime) and start over.
+            std::size_t explorationSteps = ++concurrentExploration.explorationStepsSinceLastPrecomputation;
+            if (explorationInformation.performPrecomputationExcessiveExplorationSteps(explorationSteps)) {
+                lock.unlock();
+                std::unique_lock<std::shared_mutex> exclusiveLock(concurrentExploration.mutex);
+                if (epoch == concurrentExploration.epoch) {
+                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                    ++concurrentExploration.epoch;
+                    concurrentExploration.explorationStepsSinceLastPrecomputation = 0;
+                }
+                return false;
+            }
+        }
+    }
+
+    return foundTerminalState;
+}
+
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::registerDiscoveredStates(
+    std::vector<std::pair<StateType, storm::generator::CompressedState>> const& discoveredStates,
+    ExplorationInformation<StateType, ValueType>& explorationInformation) const {
+    for (auto const& indexStatePair : discoveredStates) {
+        StateType const& state = indexStatePair.first;
+
+        // States that are neither explored nor waiting to be explored have not been registered yet.
+        if (state >= explorationInformation.getNumberOfDiscoveredStates() ||
+            (explorationInformation.isUnexplored(state) &&
+             explorationInformation.findUnexploredState(state) == explorationInformation.unexploredStatesEnd())) {
+            explorationInformation.addUnexploredState(state, indexStatePair.second);
+        }
+    }
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -175,11 +382,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -204,8 +411,32 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
                                                                        storm::generator::CompressedState const& currentState,
                                                                        ExplorationInformation<StateType, ValueType>& explorationInformation,
                                                                        Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
-    bool isTerminalState = false;
-    bool isTargetState = false;
+    // Before generating the behavior of the state, we need to determine whether it's a target state that
+    // does not need to be expanded.
+    stateGeneration.load(currentState);
+    bool isTargetState = stateGeneration.isTargetState();
+
+    // If the state is neither a target state nor a condition state, it is a rejecting terminal state and its
+    // behavior remains empty.
+    storm::generator::StateBehavior<ValueType, StateType> behavior;
+    if (!isTargetState && stateGeneration.isConditionState()) {
+        STORM_LOG_TRACE("Exploring state.");
+
+        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
+        behavior = stateGeneration.expand();
+        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
+    }
+
+    return addExploredState(currentStateId, isTargetState, behavior, explorationInformation, bounds, stats);
+}
+
+template<typename ModelType, typename StateType>
+bool SparseExplorationModelChecker<ModelType, StateType>::addExploredState(StateType const& currentStateId, bool isTargetState,
+                                                                           storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                           ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                           Bounds<StateType, ValueType>& bounds,
+                                                                           Statistics<StateType, ValueType>& stats) const {
+    bool isTerminalState = isTargetState;
 
     ++stats.numberOfExploredStates;
 
@@ -217,20 +448,9 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
     // all states that have been assigned to a row-group.
     bounds.initializeBoundsForNextState();
 
-    // Before generating the behavior of the state, we need to determine whether it's a target state that
-    // does not need to be expanded.
-    stateGeneration.load(currentState);
-    if (stateGeneration.isTargetState()) {
+    if (isTargetState) {
         ++stats.numberOfTargetStates;
-        isTargetState = true;
-        isTerminalState = true;
-    } else if (stateGeneration.isConditionState()) {
-        STORM_LOG_TRACE("Exploring state.");
-
-        // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-        storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
-        STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
-
+    } else {
         // Clumsily check whether we have found a state that forms a trivial BMEC.
         bool otherSuccessor = false;
         for (auto const& choice : behavior) {
@@ -280,10 +500,6 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
             STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation)
                                                             << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
         }
-    } else {
-        // In this case, the state is neither a target state nor a condition state and therefore a rejecting
-        // terminal state.
-        isTerminalState = true;
     }
 
     if (isTerminalState) {
@@ -312,7 +528,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds,
+    std::default_random_engine& generator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -348,13 +565,13 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(generator)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
     ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -375,11 +592,11 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     }
 }
 
@@ -24,6 +24,10 @@ class SparseMatrix;
 namespace prism {
 class Program;
 }
+namespace generator {
+template<typename ValueType, typename StateType>
+class StateBehavior;
+}
 
 namespace modelchecker {
 namespace exploration_detail {
@@ -57,6 +61,25 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    // The data that is shared by the workers of a multi-threaded exploration.
+    struct ConcurrentExploration;
+
+    std::tuple<StateType, ValueType, ValueType> performConcurrentExploration(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                             ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                             StateType const& initialStateIndex, uint64_t numberOfThreads) const;
+
+    void samplePathsConcurrently(ConcurrentExploration& concurrentExploration, StateGeneration<StateType, ValueType>& stateGeneration,
+                                 ExplorationInformation<StateType, ValueType>& explorationInformation, StateType const& initialStateIndex,
+                                 Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& generator) const;
+
+    bool samplePathConcurrently(ConcurrentExploration& concurrentExploration, StateGeneration<StateType, ValueType>& stateGeneration,
+                                ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
+                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& generator,
+                                uint64_t& epoch) const;
+
+    void registerDiscoveredStates(std::vector<std::pair<StateType, storm::generator::CompressedState>> const& discoveredStates,
+                                  ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -65,11 +88,15 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation,
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
+    bool addExploredState(StateType const& currentStateId, bool isTargetState, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds,
+                          Statistics<StateType, ValueType>& stats) const;
+
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType>& bounds, std::default_random_engine& generator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -1,7 +1,12 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 
+#include <algorithm>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+
 namespace storm {
 namespace modelchecker {
 namespace exploration_detail {
@@ -12,14 +17,17 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
                                                        storm::expressions::Expression const& conditionStateExpression,
                                                        storm::expressions::Expression const& targetStateExpression)
     : generator(program),
-      stateStorage(generator.getStateSize()),
+      stateStorage(storm::settings::getModule<storm::settings::modules::BuildSettings>().isStateCompressionSet()
+                       ? std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator.getStateSize(),
+                                                                                            generator.getVariableInformation().componentBitOffsets)
+                       : std::make_shared<storm::storage::sparse::StateStorage<StateType>>(generator.getStateSize())),
       conditionStateExpression(conditionStateExpression),
       targetStateExpression(targetStateExpression) {
     stateToIdCallback = [&explorationInformation, this](storm::generator::CompressedState const& state) -> StateType {
-        StateType newIndex = stateStorage.getNumberOfStates();
+        StateType newIndex = stateStorage->getNumberOfStates();
 
         // Check, if the state was already registered.
-        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+        std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage->stateToId.findOrAddAndGetBucket(state, newIndex);
 
         if (actualIndexBucketPair.first == newIndex) {
             explorationInformation.addUnexploredState(newIndex, state);
@@ -29,6 +37,33 @@ StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program con
     };
 }
 
+template<typename StateType, typename ValueType>
+StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program, StateGeneration<StateType, ValueType>& sharedStateGeneration)
+    : generator(program),
+      stateStorage(sharedStateGeneration.stateStorage),
+      conditionStateExpression(sharedStateGeneration.conditionStateExpression),
+      targetStateExpression(sharedStateGeneration.targetStateExpression) {
+    if (!sharedStateGeneration.concurrentStateToId) {
+        auto const& stateToId = stateStorage->stateToId;
+        sharedStateGeneration.concurrentStateToId =
+            std::make_shared<storm::storage::ConcurrentBitVectorHashMap<StateType>>(stateStorage->bitsPerState, std::max<uint64_t>(stateToId.size(), 1000));
+        for (auto const& stateIndexPair : stateToId) {
+            sharedStateGeneration.concurrentStateToId->findOrAdd(stateIndexPair.first, stateIndexPair.second);
+        }
+        sharedStateGeneration.nextStateIndex = std::make_shared<std::atomic<StateType>>(stateToId.size());
+    }
+    concurrentStateToId = sharedStateGeneration.concurrentStateToId;
+    nextStateIndex = sharedStateGeneration.nextStateIndex;
+
+    stateToIdCallback = [this](storm::generator::CompressedState const& state) -> StateType {
+        StateType index = concurrentStateToId->findOrAddUsingGenerator(state, [this]() { return (*nextStateIndex)++; }).first;
+
+        // Whether the state needs to be registered is decided by the owner of the exploration information.
+        discoveredStates.emplace_back(index, state);
+        return index;
+    };
+}
+
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
     generator.load(state);
@@ -36,7 +71,7 @@ void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedSta
 
 template<typename StateType, typename ValueType>
 std::vector<StateType> StateGeneration<StateType, ValueType>::getInitialStates() {
-    return stateStorage.initialStateIndices;
+    return stateStorage->initialStateIndices;
 }
 
 template<typename StateType, typename ValueType>
@@ -56,17 +91,24 @@ bool StateGeneration<StateType, ValueType>::isTargetState() const {
 
 template<typename StateType, typename ValueType>
 void StateGeneration<StateType, ValueType>::computeInitialStates() {
-    stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+    stateStorage->initialStateIndices = generator.getInitialStates(stateToIdCallback);
 }
 
 template<typename StateType, typename ValueType>
 StateType StateGeneration<StateType, ValueType>::getFirstInitialState() const {
-    return stateStorage.initialStateIndices.front();
+    return stateStorage->initialStateIndices.front();
 }
 
 template<typename StateType, typename ValueType>
 std::size_t StateGeneration<StateType, ValueType>::getNumberOfInitialStates() const {
-    return stateStorage.initialStateIndices.size();
+    return stateStorage->initialStateIndices.size();
+}
+
+template<typename StateType, typename ValueType>
+std::vector<std::pair<StateType, storm::generator::CompressedState>> StateGeneration<StateType, ValueType>::takeDiscoveredStates() {
+    std::vector<std::pair<StateType, storm::generator::CompressedState>> result;
+    std::swap(result, discoveredStates);
+    return result;
 }
 
 template class StateGeneration<uint32_t, double>;
@@ -1,9 +1,13 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <atomic>
+#include <memory>
+
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/sparse/StateStorage.h"
 
 namespace storm {
@@ -24,6 +28,15 @@ class StateGeneration {
     StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation,
                     storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
 
+    /*!
+     * Creates a state generation that shares the state storage with the given one, e.g. for one of the workers of a
+     * multi-threaded exploration. The workers insert into a sharded concurrent map that is seeded with the states
+     * known to the given state generation, so they only contend if they insert into the same shard. Newly encountered states are
+     * not registered with the exploration information, but recorded such that they can be retrieved via
+     * takeDiscoveredStates.
+     */
+    StateGeneration(storm::prism::Program const& program, StateGeneration<StateType, ValueType>& sharedStateGeneration);
+
     void load(storm::generator::CompressedState const& state);
 
     std::vector<StateType> getInitialStates();
@@ -40,11 +53,24 @@ class StateGeneration {
 
     bool isTargetState() const;
 
+    /*!
+     * Retrieves (and forgets) the states (together with their indices) that were encountered by the expansions since
+     * the last call. Note that this only records states for state generations that share their state storage.
+     */
+    std::vector<std::pair<StateType, storm::generator::CompressedState>> takeDiscoveredStates();
+
    private:
     storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
     std::function<StateType(storm::generator::CompressedState const&)> stateToIdCallback;
 
-    storm::storage::sparse::StateStorage<StateType> stateStorage;
+    std::shared_ptr<storm::storage::sparse::StateStorage<StateType>> stateStorage;
+
+    // The state storage of the workers of a multi-threaded exploration and the index of the next new state.
+    std::shared_ptr<storm::storage::ConcurrentBitVectorHashMap<StateType>> concurrentStateToId;
+    std::shared_ptr<std::atomic<StateType>> nextStateIndex;
+
+    // The states encountered since the last call to takeDiscoveredStates (only used for shared state storages).
+    std::vector<std::pair<StateType, storm::generator::CompressedState>> discoveredStates;
 
     storm::expressions::Expression conditionStateExpression;
     storm::expressions::Expression targetStateExpression;
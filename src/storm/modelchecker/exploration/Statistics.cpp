@@ -39,6 +39,20 @@ void Statistics<StateType, ValueType>::updateMaxPathLength(std::size_t const& cu
     maxPathLength = std::max(maxPathLength, currentPathLength);
 }
 
+template<typename StateType, typename ValueType>
+void Statistics<StateType, ValueType>::addWorker(Statistics<StateType, ValueType> const& workerStatistics, double seconds) {
+    pathsSampled += workerStatistics.pathsSampled;
+    explorationSteps += workerStatistics.explorationSteps;
+    maxPathLength = std::max(maxPathLength, workerStatistics.maxPathLength);
+    numberOfTargetStates += workerStatistics.numberOfTargetStates;
+    numberOfExploredStates += workerStatistics.numberOfExploredStates;
+    numberOfPrecomputations += workerStatistics.numberOfPrecomputations;
+    ecDetections += workerStatistics.ecDetections;
+    failedEcDetections += workerStatistics.failedEcDetections;
+    totalNumberOfEcDetected += workerStatistics.totalNumberOfEcDetected;
+    workerPathsAndSeconds.emplace_back(workerStatistics.pathsSampled, seconds);
+}
+
 template<typename StateType, typename ValueType>
 void Statistics<StateType, ValueType>::printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
     out << "\nExploration statistics:\n";
@@ -49,6 +63,11 @@ void Statistics<StateType, ValueType>::printToStream(std::ostream& out, Explorat
     out << "Maximal path length: " << maxPathLength << '\n';
     out << "Precomputations: " << numberOfPrecomputations << '\n';
     out << "EC detections: " << ecDetections << " (" << failedEcDetections << " failed, " << totalNumberOfEcDetected << " EC(s) detected)\n";
+    for (std::size_t worker = 0; worker < workerPathsAndSeconds.size(); ++worker) {
+        auto const& pathsAndSeconds = workerPathsAndSeconds[worker];
+        out << "Worker " << worker << ": " << pathsAndSeconds.first << " sampled paths in " << pathsAndSeconds.second << "s ("
+            << (pathsAndSeconds.second > 0 ? pathsAndSeconds.first / pathsAndSeconds.second : 0.0) << " paths per second)\n";
+    }
 }
 
 template struct Statistics<uint32_t, double>;
@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace storm {
 namespace modelchecker {
@@ -22,6 +24,9 @@ struct Statistics {
 
     void updateMaxPathLength(std::size_t const& currentPathLength);
 
+    // Adds the statistics of a worker of a multi-threaded exploration that sampled paths for the given time.
+    void addWorker(Statistics<StateType, ValueType> const& workerStatistics, double seconds);
+
     void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
 
     std::size_t pathsSampled;
@@ -35,6 +40,9 @@ struct Statistics {
     std::size_t ecDetections;
     std::size_t failedEcDetections;
     std::size_t totalNumberOfEcDetected;
+
+    // The number of sampled paths and the time spent sampling them (in seconds) per worker of a multi-threaded exploration.
+    std::vector<std::pair<std::size_t, double>> workerPathsAndSeconds;
 };
 
 }  // namespace exploration_detail
@@ -1,4 +1,5 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
@@ -9,10 +10,14 @@
 #include "storm/utility/vector.h"
 
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SparseMatrixView.h"
 #include "storm/storage/expressions/Expression.h"
+#include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 namespace storm {
 namespace modelchecker {
@@ -39,7 +44,7 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
     } else {
-        maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, upperBound);
+        maybeStates = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates, true, upperBound);
         if (lowerBound == 0) {
             maybeStates &= ~psiStates;
         } else {
@@ -53,25 +58,54 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
     }
 
     if (!maybeStates.empty()) {
-        // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
-        storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true, makeZeroColumns);
-
         // Create the vector of one-step probabilities to go to target states.
         std::vector<ValueType> b = transitionMatrix.getConstrainedRowSumVector(maybeStates, psiStates);
 
         // Create the vector with which to multiply.
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
-        // Perform the matrix vector multiplication
-        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+        // Performs the given number of multiplications with the matrix restricted to the maybe states (where the given columns are treated as zero). Unless
+        // a specific multiplier was requested, we multiply with a view on the transition matrix instead of copying the submatrix.
+        bool const useMatrixView =
+            env.solver().multiplier().isTypeSetFromDefault() || env.solver().multiplier().getType() == storm::solver::MultiplierType::Native;
+        // The iterates are probabilities. If b is non-zero, they start from (a lower bound on) the result for fewer steps and are thus non-decreasing.
+        auto repeatedMultiply = [&](storm::storage::BitVector const& zeroColumns, uint64_t steps) {
+            boost::optional<ValueType> upperBound;
+            if (storm::utility::vector::hasNonZeroEntry(b)) {
+                upperBound = storm::utility::one<ValueType>();
+            }
+            if (useMatrixView) {
+                storm::storage::SparseMatrixView<ValueType> submatrix(transitionMatrix, maybeStates, maybeStates, zeroColumns);
+                StepBoundedIterationHelper<ValueType> iterationHelper(
+                    [&](std::vector<ValueType> const& x, std::vector<ValueType>& result) { submatrix.multiplyWithVector(x, result, &b); });
+                iterationHelper.perform(env, subresult, steps, upperBound);
+            } else {
+                // We can eliminate the rows and columns from the original transition probability matrix that have probability 0.
+                storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true, zeroColumns);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+                StepBoundedIterationHelper<ValueType> iterationHelper(
+                    [&](std::vector<ValueType> const& x, std::vector<ValueType>& result) { multiplier->multiply(env, x, &b, result); });
+                iterationHelper.perform(env, subresult, steps, upperBound);
+            }
+        };
+
         if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
+            // If the result for fewer steps is known, we can continue from there.
+            uint64_t startStep = 0;
+            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasStepBoundedResultHint()) {
+                auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                if (explicitHint.getStepBoundedResultHintSteps() <= upperBound &&
+                    explicitHint.getStepBoundedResultHint().size() == transitionMatrix.getRowGroupCount()) {
+                    startStep = explicitHint.getStepBoundedResultHintSteps();
+                    subresult = storm::utility::vector::filterVector(explicitHint.getStepBoundedResultHint(), maybeStates);
+                    STORM_LOG_INFO("Continuing step-bounded computation from the result for " << startStep << " steps.");
+                }
+            }
+            repeatedMultiply(makeZeroColumns, upperBound - startStep);
         } else {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
-            submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
-            multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+            repeatedMultiply(makeZeroColumns, upperBound - lowerBound + 1);
             b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
+            repeatedMultiply(storm::storage::BitVector(), lowerBound - 1);
         }
 
         // Set the values of the resulting vector accordingly.
@@ -1,4 +1,5 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
@@ -64,14 +65,32 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
         std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
 
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
+        // The iterates are probabilities. As long as b is added, they start from (a lower bound on) the result for fewer steps and are thus
+        // non-decreasing.
+        StepBoundedIterationHelper<ValueType> iterationHelper([&](std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+            multiplier->multiplyAndReduce(env, goal.direction(), x, &b, result);
+        });
         if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
+            // If the result for fewer steps is known, we can continue from there.
+            uint64_t startStep = 0;
+            if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().hasStepBoundedResultHint()) {
+                auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                if (explicitHint.getStepBoundedResultHintSteps() <= upperBound &&
+                    explicitHint.getStepBoundedResultHint().size() == transitionMatrix.getRowGroupCount()) {
+                    startStep = explicitHint.getStepBoundedResultHintSteps();
+                    subresult = storm::utility::vector::filterVector(explicitHint.getStepBoundedResultHint(), maybeStates);
+                    STORM_LOG_INFO("Continuing step-bounded computation from the result for " << startStep << " steps.");
+                }
+            }
+            iterationHelper.perform(env, subresult, upperBound - startStep, storm::utility::one<ValueType>());
         } else {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
+            iterationHelper.perform(env, subresult, upperBound - lowerBound + 1, storm::utility::one<ValueType>());
             storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
             auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
+            StepBoundedIterationHelper<ValueType> secondIterationHelper([&](std::vector<ValueType> const& x, std::vector<ValueType>& result) {
+                multiplier->multiplyAndReduce(env, goal.direction(), x, nullptr, result);
+            });
+            secondIterationHelper.perform(env, subresult, lowerBound - 1);
         }
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
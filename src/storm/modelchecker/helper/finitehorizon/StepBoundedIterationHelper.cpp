@@ -0,0 +1,89 @@
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+bool boundsWithinPrecision(std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX, ValueType const& precision, bool relative) {
+    return storm::utility::vector::equalModuloPrecision(lowerX, upperX, precision, relative);
+}
+
+template<>
+bool boundsWithinPrecision(std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, storm::RationalFunction const&, bool) {
+    // Parametric results are never approximated.
+    return false;
+}
+
+template<typename ValueType>
+StepBoundedIterationHelper<ValueType>::StepBoundedIterationHelper(StepFunction const& step) : step(step) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+uint64_t StepBoundedIterationHelper<ValueType>::perform(Environment const& env, std::vector<ValueType>& x, uint64_t n,
+                                                        boost::optional<ValueType> const& upperBound) const {
+    // Stopping up to the precision would spoil exact results.
+    bool iterateUpperBound = upperBound && env.solver().timeBounded().isStepBoundedEarlyTerminationSet() && !storm::NumberTraits<ValueType>::IsExact;
+    std::vector<ValueType> upperX;
+    ValueType doublePrecision;
+    bool relative = env.solver().timeBounded().getRelativeTerminationCriterion();
+    if (iterateUpperBound) {
+        upperX.assign(x.size(), upperBound.get());
+        doublePrecision = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) * storm::utility::convertNumber<ValueType>(2);
+    }
+
+    std::vector<ValueType> tmp(x.size());
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    for (uint64_t i = 0; i < n; ++i) {
+        progress.updateProgress(i);
+        step(x, tmp);
+        if (tmp == x) {
+            STORM_LOG_INFO("Iterates of the step-bounded computation did not change after " << (i + 1) << " of " << n
+                                                                                             << " steps. Skipping the remaining steps.");
+            return i + 1;
+        }
+        std::swap(x, tmp);
+
+        if (iterateUpperBound) {
+            step(upperX, tmp);
+            std::swap(upperX, tmp);
+            if (boundsWithinPrecision(x, upperX, doublePrecision, relative)) {
+                // The exact result lies between both bounds, so their mean is within the precision of it.
+                ValueType two = storm::utility::convertNumber<ValueType>(2);
+                storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+                    x, upperX, x, [&two](ValueType const& lower, ValueType const& upper) -> ValueType { return (lower + upper) / two; });
+                STORM_LOG_INFO("The result of the step-bounded computation is known up to the precision after " << (i + 1) << " of " << n
+                                                                                                                 << " steps. Skipping the remaining steps.");
+                return i + 1;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << (i + 1) << " of " << n << " multiplications.");
+            return i + 1;
+        }
+    }
+    return n;
+}
+
+template class StepBoundedIterationHelper<double>;
+template class StepBoundedIterationHelper<storm::RationalNumber>;
+template class StepBoundedIterationHelper<storm::RationalFunction>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
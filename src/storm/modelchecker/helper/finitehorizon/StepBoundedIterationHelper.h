@@ -0,0 +1,47 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Repeatedly applies a step of a step-bounded computation (such as x <- Ax + b or its min/max variant) and stops as soon as further steps are known not
+ * to change the result (up to the precision, if requested).
+ */
+template<typename ValueType>
+class StepBoundedIterationHelper {
+   public:
+    typedef std::function<void(std::vector<ValueType> const& x, std::vector<ValueType>& result)> StepFunction;
+
+    /*!
+     * @param step Writes f(x) into result (for distinct vectors), where f is a monotone function.
+     */
+    StepBoundedIterationHelper(StepFunction const& step);
+
+    /*!
+     * Replaces x by the result of n applications of the step function. Once an iterate equals its predecessor, all further iterates are equal as well,
+     * so the remaining steps are skipped without changing the result.
+     *
+     * If an upper bound is given, the iterates are assumed to be non-decreasing (i.e. x <= f(x)) and bounded from above by the given value. If requested
+     * in the environment, the constant upper bound is then iterated as well: after i steps, the result of all n steps lies between both iterates, so the
+     * computation stops once they are equal up to the precision and returns their mean.
+     *
+     * @return The number of steps that were actually performed.
+     */
+    uint64_t perform(Environment const& env, std::vector<ValueType>& x, uint64_t n, boost::optional<ValueType> const& upperBound = boost::none) const;
+
+   private:
+    StepFunction step;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,15 +1,20 @@
 #include "SparseDeterministicVisitingTimesHelper.h"
 
 #include <algorithm>
+#include <atomic>
+#include <type_traits>
 
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/DenseEquationSystemSolver.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -84,55 +89,30 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::computeExpectedVisitingT
     createDecomposition(env);
     auto sccEnv = getEnvironmentForSccSolver(env);
 
-    // Create auxiliary data and lambdas
-    storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
-    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
-    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
-        auto row = this->_transitionMatrix.getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransition);
-    };
-    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
-        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
-    };
-    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
-        if (!storm::utility::isZero(stateValues[state])) {
-            return true;
-        }
-        auto row = this->_backwardTransitions->getRow(state);
-        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
-    };
-
-    // We solve each SCC individually in *forward* topological order
-    storm::utility::ProgressMeasurement progress("sccs");
-    progress.setMaxCount(_sccDecomposition->size());
-    progress.startNewMeasurement(0);
-    uint64_t sccIndex = 0;
-    auto sccItEnd = std::make_reverse_iterator(_sccDecomposition->begin());
-    for (auto sccIt = std::make_reverse_iterator(_sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
-        auto const& scc = *sccIt;
-        if (scc.size() == 1) {
-            processSingletonScc(*scc.begin(), stateValues);
-        } else {
-            sccAsBitVector.set(scc.begin(), scc.end(), true);
-            if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isExitState)) {
-                // This is not a BSCC
-                auto sccResult = computeValueForNonTrivialScc(sccEnv, sccAsBitVector, stateValues);
-                storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
-            } else {
-                // This is a BSCC
-                if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
-                } else {
-                    storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
-                }
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+    if (numberOfThreads > 1 && std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Operations on rational functions share caches that are not thread-safe.
+        STORM_LOG_INFO("Processing SCCs sequentially since concurrent computations are not supported for rational functions.");
+        numberOfThreads = 1;
+    }
+    if (numberOfThreads > 1 && _sccDecomposition->size() > 1) {
+        processSccsConcurrently(sccEnv, numberOfThreads, env.solver().topological().getBatchSize(), stateValues);
+    } else {
+        // We solve each SCC individually in *forward* topological order
+        storm::storage::BitVector sccAsBitVector(stateValues.size(), false);
+        storm::utility::ProgressMeasurement progress("sccs");
+        progress.setMaxCount(_sccDecomposition->size());
+        progress.startNewMeasurement(0);
+        uint64_t sccIndex = 0;
+        auto sccItEnd = std::make_reverse_iterator(_sccDecomposition->begin());
+        for (auto sccIt = std::make_reverse_iterator(_sccDecomposition->end()); sccIt != sccItEnd; ++sccIt) {
+            processScc(sccEnv, *sccIt, sccAsBitVector, stateValues);
+            ++sccIndex;
+            progress.updateProgress(sccIndex);
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << _sccDecomposition->size() << " SCCs.");
+                break;
             }
-            sccAsBitVector.clear();
-        }
-        ++sccIndex;
-        progress.updateProgress(sccIndex);
-        if (storm::utility::resources::isTerminate()) {
-            STORM_LOG_WARN("Visiting times computation aborted after analyzing " << sccIndex << "/" << this->_computedSccDecomposition->size() << " SCCs.");
-            break;
         }
     }
 
@@ -194,6 +174,84 @@ storm::Environment SparseDeterministicVisitingTimesHelper<ValueType>::getEnviron
     return subEnv;
 }
 
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc,
+                                                                   storm::storage::BitVector& sccAsBitVector, std::vector<ValueType>& stateValues) const {
+    if (scc.size() == 1) {
+        processSingletonScc(*scc.begin(), stateValues);
+        return;
+    }
+
+    auto isLeavingTransition = [&sccAsBitVector](auto const& e) { return !sccAsBitVector.get(e.getColumn()); };
+    auto isExitState = [this, &isLeavingTransition](uint64_t state) {
+        auto row = this->_transitionMatrix.getRow(state);
+        return std::any_of(row.begin(), row.end(), isLeavingTransition);
+    };
+    auto isLeavingTransitionWithNonZeroValue = [&isLeavingTransition, &stateValues](auto const& e) {
+        return isLeavingTransition(e) && !storm::utility::isZero(stateValues[e.getColumn()]);
+    };
+    auto isReachableInState = [this, &isLeavingTransitionWithNonZeroValue, &stateValues](uint64_t state) {
+        if (!storm::utility::isZero(stateValues[state])) {
+            return true;
+        }
+        auto row = this->_backwardTransitions->getRow(state);
+        return std::any_of(row.begin(), row.end(), isLeavingTransitionWithNonZeroValue);
+    };
+
+    sccAsBitVector.set(scc.begin(), scc.end(), true);
+    if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isExitState)) {
+        // This is not a BSCC
+        auto sccResult = computeValueForNonTrivialScc(sccEnv, sccAsBitVector, stateValues);
+        storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, sccResult);
+    } else {
+        // This is a BSCC
+        if (std::any_of(sccAsBitVector.begin(), sccAsBitVector.end(), isReachableInState)) {
+            storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::infinity<ValueType>());
+        } else {
+            storm::utility::vector::setVectorValues(stateValues, sccAsBitVector, storm::utility::zero<ValueType>());
+        }
+    }
+    sccAsBitVector.clear();
+}
+
+template<typename ValueType>
+void SparseDeterministicVisitingTimesHelper<ValueType>::processSccsConcurrently(storm::Environment const& sccEnv, uint64_t numberOfThreads,
+                                                                                uint64_t batchSize, std::vector<ValueType>& stateValues) const {
+    storm::solver::helper::SccTaskGraph<ValueType> taskGraph(_transitionMatrix, *_sccDecomposition, batchSize);
+    numberOfThreads = std::min(numberOfThreads, taskGraph.getNumberOfTasks());
+    STORM_LOG_INFO("Processing " << _sccDecomposition->size() << " SCC(s) in " << taskGraph.getNumberOfTasks() << " task(s) using " << numberOfThreads
+                                 << " threads.");
+
+    std::vector<storm::storage::BitVector> sccAsBitVectors(numberOfThreads, storm::storage::BitVector(stateValues.size(), false));
+    std::atomic<bool> aborted(false);
+    std::atomic<uint64_t> numberOfProcessedSccs(0);
+    storm::utility::ProgressMeasurement progress("sccs");
+    progress.setMaxCount(_sccDecomposition->size());
+    progress.startNewMeasurement(0);
+
+    // The values are propagated forward, i.e., a task has to wait for the tasks with transitions into it.
+    // Each SCC only reads the values of its predecessors and writes its own values, so tasks do not interfere.
+    storm::utility::parallel::forEachTaskInDependencyOrder(taskGraph.getReversedDependencies(), numberOfThreads, [&](uint64_t threadIndex, uint64_t task) {
+        if (aborted.load()) {
+            return;
+        }
+        for (uint64_t sccIndex = taskGraph.getEndScc(task); sccIndex > taskGraph.getFirstScc(task);) {
+            --sccIndex;
+            processScc(sccEnv, _sccDecomposition->getBlock(sccIndex), sccAsBitVectors[threadIndex], stateValues);
+        }
+        uint64_t numberOfSccs = taskGraph.getEndScc(task) - taskGraph.getFirstScc(task);
+        numberOfSccs += numberOfProcessedSccs.fetch_add(numberOfSccs);
+        if (threadIndex == 0) {
+            progress.updateProgress(numberOfSccs);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            aborted.store(true);
+        }
+    });
+    STORM_LOG_WARN_COND(!aborted.load(), "Visiting times computation aborted after analyzing " << numberOfProcessedSccs.load() << "/"
+                                                                                               << _sccDecomposition->size() << " SCCs.");
+}
+
 template<typename ValueType>
 void SparseDeterministicVisitingTimesHelper<ValueType>::processSingletonScc(uint64_t sccState, std::vector<ValueType>& stateValues) const {
     auto& stateVal = stateValues[sccState];
@@ -234,15 +292,6 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
     STORM_LOG_WARN_COND(!env.solver().isForceSoundness(),
                         "Sound computations are not properly implemented for the computation of expected number of visits in non-trival SCCs. You might get "
                         "incorrect results.");
-    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
-    bool isFixpointFormat = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem;
-
-    // Get the matrix for the equation system
-    auto sccMatrix = _backwardTransitions->getSubmatrix(false, sccAsBitVector, sccAsBitVector, !isFixpointFormat);
-    if (!isFixpointFormat) {
-        sccMatrix.convertToEquationSystem();
-    }
-
     // Get the vector for the equation system
     auto sccVector = storm::utility::vector::filterVector(stateValues, sccAsBitVector);
     auto valIt = sccVector.begin();
@@ -255,6 +304,36 @@ std::vector<ValueType> SparseDeterministicVisitingTimesHelper<ValueType>::comput
         ++valIt;
     }
 
+    if (sccVector.size() <= storm::solver::helper::MaximalDenseEquationSystemSize) {
+        // Solve (1-P^T) * x = b directly.
+        std::vector<uint64_t> sccStates(sccAsBitVector.begin(), sccAsBitVector.end());
+        uint64_t const dimension = sccStates.size();
+        std::vector<ValueType> denseMatrix(dimension * dimension, storm::utility::zero<ValueType>());
+        for (uint64_t localState = 0; localState < dimension; ++localState) {
+            denseMatrix[localState * dimension + localState] = storm::utility::one<ValueType>();
+            for (auto const& entry : _backwardTransitions->getRow(sccStates[localState])) {
+                if (sccAsBitVector.get(entry.getColumn())) {
+                    uint64_t localColumn = std::lower_bound(sccStates.begin(), sccStates.end(), entry.getColumn()) - sccStates.begin();
+                    denseMatrix[localState * dimension + localColumn] -= entry.getValue();
+                }
+            }
+        }
+        std::vector<ValueType> denseSolution = sccVector;
+        if (storm::solver::helper::solveDenseEquationSystem(dimension, denseMatrix, denseSolution)) {
+            return denseSolution;
+        }
+        STORM_LOG_WARN("Dense equation system for SCC with " << dimension << " states is singular. Falling back to the linear equation solver.");
+    }
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool isFixpointFormat = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem;
+
+    // Get the matrix for the equation system
+    auto sccMatrix = _backwardTransitions->getSubmatrix(false, sccAsBitVector, sccAsBitVector, !isFixpointFormat);
+    if (!isFixpointFormat) {
+        sccMatrix.convertToEquationSystem();
+    }
+
     // Get the solver object and satisfy requirements
     auto solver = linearEquationSolverFactory.create(env, std::move(sccMatrix));
     solver->setLowerBound(storm::utility::zero<ValueType>());
@@ -104,6 +104,20 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
      */
     storm::Environment getEnvironmentForSccSolver(storm::Environment const& env) const;
 
+    /*!
+     * Processes the given SCC, assuming that all SCCs with a transition into it have already been processed. The resulting values are directly inserted
+     * into stateValues.
+     * @param sccAsBitVector auxiliary bit vector (over all states) that is empty when this method is called and when it returns.
+     */
+    void processScc(storm::Environment const& sccEnv, storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccAsBitVector,
+                    std::vector<ValueType>& stateValues) const;
+
+    /*!
+     * Processes all SCCs following the SCC DAG using the given number of threads. Consecutive SCCs are batched into tasks of (roughly) the given number
+     * of states.
+     */
+    void processSccsConcurrently(storm::Environment const& sccEnv, uint64_t numberOfThreads, uint64_t batchSize, std::vector<ValueType>& stateValues) const;
+
     /*!
      * Processes (bottom or non-bottom SCCs consisting of a single state). The resulting value is directly inserted into stateValues
      */
@@ -111,6 +125,7 @@ class SparseDeterministicVisitingTimesHelper : public SingleValueModelCheckerHel
 
     /*!
      * Solves the equation system for non-trivial SCCs (i.e. non-bottom SCCs with more than 1 state).
+     * Small SCCs are solved directly with a dense LU decomposition, larger ones with the linear equation solver of the given environment.
      * @return for each state of the given SCC the expected number of times that state is visited.
      */
     std::vector<ValueType> computeValueForNonTrivialScc(storm::Environment const& env, storm::storage::BitVector const& sccAsBitVector,
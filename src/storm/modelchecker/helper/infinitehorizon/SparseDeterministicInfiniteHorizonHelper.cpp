@@ -1,5 +1,9 @@
 #include "SparseDeterministicInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
@@ -10,8 +14,10 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/DenseEquationSystemSolver.h"
 
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -63,6 +69,22 @@ ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComp
     }
 
     // Solve nontrivial BSCC with the method specified  in the settings
+    storm::solver::LraMethod method = getLraMethod(env);
+    STORM_LOG_TRACE("Computing LRA for BSCC of size " << component.size() << " using '" << storm::solver::toString(method) << "'.");
+    if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForBsccVi(env, stateValueGetter, actionValueGetter, component);
+    } else if (method == storm::solver::LraMethod::LraDistributionEquations) {
+        // We only need the first element of the pair as the lra distribution is not relevant at this point.
+        return computeLraForBsccSteadyStateDistr(env, stateValueGetter, actionValueGetter, component).first;
+    }
+    STORM_LOG_WARN_COND(method == storm::solver::LraMethod::GainBiasEquations,
+                        "Unsupported lra method selected. Defaulting to " << storm::solver::toString(storm::solver::LraMethod::GainBiasEquations) << ".");
+    // We don't need the bias values
+    return computeLraForBsccGainBias(env, stateValueGetter, actionValueGetter, component).first;
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseDeterministicInfiniteHorizonHelper<ValueType>::getLraMethod(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getDetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isDetLraMethodSetFromDefault() &&
         method == storm::solver::LraMethod::ValueIteration) {
@@ -76,17 +98,15 @@ ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComp
                                     << " as the solution technique for long-run properties to guarantee sound results. If you want to override this, please "
                                        "explicitly specify a different LRA method.");
     }
-    STORM_LOG_TRACE("Computing LRA for BSCC of size " << component.size() << " using '" << storm::solver::toString(method) << "'.");
-    if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForBsccVi(env, stateValueGetter, actionValueGetter, component);
-    } else if (method == storm::solver::LraMethod::LraDistributionEquations) {
-        // We only need the first element of the pair as the lra distribution is not relevant at this point.
-        return computeLraForBsccSteadyStateDistr(env, stateValueGetter, actionValueGetter, component).first;
-    }
-    STORM_LOG_WARN_COND(method == storm::solver::LraMethod::GainBiasEquations,
-                        "Unsupported lra method selected. Defaulting to " << storm::solver::toString(storm::solver::LraMethod::GainBiasEquations) << ".");
-    // We don't need the bias values
-    return computeLraForBsccGainBias(env, stateValueGetter, actionValueGetter, component).first;
+    return method;
+}
+
+template<typename ValueType>
+bool SparseDeterministicInfiniteHorizonHelper<ValueType>::isConcurrentComponentComputationSupported(Environment const& env) const {
+    // Value iteration only uses data local to the BSCC and the distribution equations are set up (and solved) for each BSCC individually.
+    // The gain/bias equations may use solvers that share global state.
+    auto method = getLraMethod(env);
+    return method == storm::solver::LraMethod::ValueIteration || method == storm::solver::LraMethod::LraDistributionEquations;
 }
 
 template<typename ValueType>
@@ -257,6 +277,35 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
         return {storm::utility::one<ValueType>()};
     }
 
+    if (bscc.size() <= storm::solver::helper::MaximalDenseEquationSystemSize) {
+        // Small BSCCs are solved directly. Row j of the dense matrix corresponds to column j of A, except for the last row which contains the ones.
+        uint64_t const dimension = bscc.size();
+        std::vector<ValueType> denseMatrix(dimension * dimension, storm::utility::zero<ValueType>());
+        uint64_t localState = 0;
+        for (auto const& globalIndex : bscc) {
+            ValueType rateAtState = this->_exitRates ? (*this->_exitRates)[globalIndex] : storm::utility::one<ValueType>();
+            denseMatrix[localState * dimension + localState] -= rateAtState;
+            for (auto const& entry : this->_transitionMatrix.getRow(globalIndex)) {
+                uint64_t localColumn = std::lower_bound(bscc.begin(), bscc.end(), entry.getColumn()) - bscc.begin();
+                if (localColumn + 1 < dimension) {
+                    denseMatrix[localColumn * dimension + localState] += rateAtState * entry.getValue();
+                }
+            }
+            denseMatrix[(dimension - 1) * dimension + localState] = storm::utility::one<ValueType>();
+            ++localState;
+        }
+        std::vector<ValueType> steadyStateDistr(dimension, storm::utility::zero<ValueType>());
+        steadyStateDistr.back() = storm::utility::one<ValueType>();
+        if (storm::solver::helper::solveDenseEquationSystem(dimension, denseMatrix, steadyStateDistr)) {
+            if (!env.solver().isForceExact()) {
+                ValueType sum = std::accumulate(steadyStateDistr.begin(), steadyStateDistr.end(), storm::utility::zero<ValueType>());
+                storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(steadyStateDistr, storm::utility::one<ValueType>() / sum);
+            }
+            return steadyStateDistr;
+        }
+        STORM_LOG_WARN("Dense equation system for BSCC with " << dimension << " states is singular. Falling back to the linear equation solver.");
+    }
+
     // Prepare an environment for the underlying linear equation solver
     auto subEnv = env;
     if (subEnv.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological) {
@@ -507,7 +556,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     auto bsccReachProbs = computeBsccReachabilityProbabilities(env, initialDistributionGetter);
     // We are now ready to compute the resulting lra distribution
     std::vector<ValueType> steadyStateDistr(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-    for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+    auto processComponent = [&](uint64_t currentComponentIndex) {
         auto const& component = (*this->_longRunComponentDecomposition)[currentComponentIndex];
         // Compute distribution for current bscc
         auto bsccDistr = this->computeSteadyStateDistrForBscc(env, component);
@@ -524,6 +573,30 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
             ++bsccDistrIt;
         }
         STORM_LOG_ASSERT(bsccDistrIt == bsccDistr.end(), "Unexpected number of entries in bscc distribution");
+    };
+
+    uint64_t numberOfThreads = 1;
+    if (std::is_same<ValueType, double>::value && this->_longRunComponentDecomposition->size() > 1) {
+        // Computations with exact or parametric values use number types that are not safe to share between threads.
+        numberOfThreads = std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(env.solver().lra().getNumberOfThreads()),
+                                             this->_longRunComponentDecomposition->size());
+    }
+    if (numberOfThreads > 1) {
+        STORM_LOG_INFO("Computing steady state distributions of " << this->_longRunComponentDecomposition->size() << " BSCCs using " << numberOfThreads
+                                                                  << " threads.");
+        // Processing large BSCCs first avoids that a single large BSCC is left over at the end.
+        std::vector<uint64_t> componentOrder(this->_longRunComponentDecomposition->size());
+        std::iota(componentOrder.begin(), componentOrder.end(), 0);
+        std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t const& first, uint64_t const& second) {
+            return this->_longRunComponentDecomposition->getBlock(first).size() > this->_longRunComponentDecomposition->getBlock(second).size();
+        });
+        // Every BSCC only writes the values of its own states, so the computations do not interfere.
+        storm::utility::parallel::forEachChunk(0, componentOrder.size(), 1, numberOfThreads,
+                                               [&](uint64_t, uint64_t index, uint64_t) { processComponent(componentOrder[index]); });
+    } else {
+        for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+            processComponent(currentComponentIndex);
+        }
     }
     return steadyStateDistr;
 }
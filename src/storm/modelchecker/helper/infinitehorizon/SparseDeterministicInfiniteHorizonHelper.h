@@ -1,5 +1,6 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
+#include "storm/solver/SolverSelectionOptions.h"
 
 namespace storm {
 
@@ -55,6 +56,13 @@ class SparseDeterministicInfiniteHorizonHelper : public SparseInfiniteHorizonHel
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool isConcurrentComponentComputationSupported(Environment const& env) const override;
+
+    /*!
+     * Selects the method for non-trivial components, taking into account whether exact or sound results are required.
+     */
+    storm::solver::LraMethod getLraMethod(Environment const& env) const;
+
     /*!
      * Computes for each BSCC the probability to reach that SCC assuming the given distribution over initial states.
      */
@@ -1,5 +1,10 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <type_traits>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -12,11 +17,13 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
 
@@ -147,6 +154,10 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
         underlyingSolverEnvironment.solver().setLinearEquationSolverPrecision(newPrecision, env.solver().lra().getRelativeTerminationCriterion());
         underlyingSolverEnvironment.solver().lra().setPrecision(newPrecision);
     }
+    // The components are analyzed one after another (each with its own solvers), so the auxiliary vectors are shared via a workspace.
+    if (!underlyingSolverEnvironment.solver().getWorkspace()) {
+        underlyingSolverEnvironment.solver().setWorkspace(std::make_shared<storm::solver::SolverWorkspace>());
+    }
 
     // If requested, allocate memory for the choices made
     if (Nondeterministic && this->isProduceSchedulerSet()) {
@@ -169,10 +180,25 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
     std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
+    uint64_t numberOfThreads = 1;
+    if (std::is_same<ValueType, double>::value && _longRunComponentDecomposition->size() > 1) {
+        // Computations with exact or parametric values use number types that are not safe to share between threads.
+        numberOfThreads = std::min<uint64_t>(storm::utility::parallel::getNumberOfThreads(env.solver().lra().getNumberOfThreads()),
+                                             _longRunComponentDecomposition->size());
+        if (numberOfThreads > 1 && !isConcurrentComponentComputationSupported(underlyingSolverEnvironment)) {
+            STORM_LOG_INFO("Components are processed sequentially as the selected LRA method does not support concurrent computations.");
+            numberOfThreads = 1;
+        }
+    }
+    if (numberOfThreads > 1) {
+        componentLraValues = computeLraForComponentsConcurrently(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, numberOfThreads,
+                                                                 progress);
+    } else {
+        componentLraValues.reserve(_longRunComponentDecomposition->size());
+        for (auto const& c : *_longRunComponentDecomposition) {
+            componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
+            progress.updateProgress(componentLraValues.size());
+        }
     }
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
@@ -180,6 +206,33 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     return buildAndSolveSsp(underlyingSolverEnvironment, componentLraValues);
 }
 
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::computeLraForComponentsConcurrently(
+    Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter, uint64_t numberOfThreads,
+    storm::utility::ProgressMeasurement& progress) {
+    STORM_LOG_INFO("Processing components using " << numberOfThreads << " threads.");
+    // Threads fetch components dynamically. Processing large components first avoids that a single large component is left over at the end.
+    std::vector<uint64_t> componentOrder(_longRunComponentDecomposition->size());
+    std::iota(componentOrder.begin(), componentOrder.end(), 0);
+    std::stable_sort(componentOrder.begin(), componentOrder.end(), [this](uint64_t const& first, uint64_t const& second) {
+        return _longRunComponentDecomposition->getBlock(first).size() > _longRunComponentDecomposition->getBlock(second).size();
+    });
+
+    // Every component only writes its own value (and the choices of its own states), so the computations do not interfere.
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+    std::atomic<uint64_t> numberOfProcessedComponents(0);
+    storm::utility::parallel::forEachChunk(0, componentOrder.size(), 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t index, uint64_t) {
+        uint64_t component = componentOrder[index];
+        componentLraValues[component] =
+            computeLraForComponent(env, stateRewardsGetter, actionRewardsGetter, _longRunComponentDecomposition->getBlock(component));
+        uint64_t processed = numberOfProcessedComponents.fetch_add(1) + 1;
+        if (threadIndex == 0) {
+            progress.updateProgress(processed);
+        }
+    });
+    return componentLraValues;
+}
+
 template<typename ValueType, bool Nondeterministic>
 bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isContinuousTime() const {
     STORM_LOG_ASSERT((_markovianStates == nullptr) || (_exitRates != nullptr), "Inconsistent information given: Have Markovian states but no exit rates.");
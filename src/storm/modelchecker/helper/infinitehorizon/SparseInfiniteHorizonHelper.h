@@ -16,6 +16,10 @@ class StandardRewardModel;
 }
 }  // namespace models
 
+namespace utility {
+class ProgressMeasurement;
+}
+
 namespace modelchecker {
 namespace helper {
 
@@ -123,6 +127,19 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     virtual void createDecomposition() = 0;
 
+    /*!
+     * @return true iff computeLraForComponent may be invoked concurrently for different components, given the methods selected in the environment.
+     */
+    virtual bool isConcurrentComponentComputationSupported(Environment const& env) const = 0;
+
+    /*!
+     * Computes the LRA values of all components using the given number of threads.
+     * @return the LRA value of each component (in the order of the decomposition).
+     */
+    std::vector<ValueType> computeLraForComponentsConcurrently(Environment const& env, ValueGetter const& stateRewardsGetter,
+                                                               ValueGetter const& actionRewardsGetter, uint64_t numberOfThreads,
+                                                               storm::utility::ProgressMeasurement& progress);
+
     /*!
      * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield
      * optimal values w.r.t. the individual components.
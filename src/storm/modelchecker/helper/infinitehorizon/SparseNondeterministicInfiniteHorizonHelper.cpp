@@ -80,12 +80,14 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
                                                                                          storm::storage::MaximalEndComponent const& component) {
     // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
 
-    // Allocate memory for the nondeterministic choices.
+    // Allocate memory for the nondeterministic choices. If components are processed concurrently, this has already been done.
     if (this->isProduceSchedulerSet()) {
         if (!this->_producedOptimalChoices.is_initialized()) {
             this->_producedOptimalChoices.emplace();
         }
-        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+            this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+        }
     }
 
     auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -94,6 +96,20 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
     }
 
     // Solve nontrivial MEC with the method specified in the settings
+    storm::solver::LraMethod method = getLraMethod(env);
+    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
+                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
+    if (method == storm::solver::LraMethod::LinearProgramming) {
+        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else if (method == storm::solver::LraMethod::ValueIteration) {
+        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
+    }
+}
+
+template<typename ValueType>
+storm::solver::LraMethod SparseNondeterministicInfiniteHorizonHelper<ValueType>::getLraMethod(Environment const& env) const {
     storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
     if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().lra().isNondetLraMethodSetFromDefault() &&
         method != storm::solver::LraMethod::LinearProgramming) {
@@ -107,15 +123,15 @@ ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForC
             "specify a different LRA method.");
         method = storm::solver::LraMethod::ValueIteration;
     }
-    STORM_LOG_ERROR_COND(!this->isProduceSchedulerSet() || method == storm::solver::LraMethod::ValueIteration,
-                         "Scheduler generation not supported for the chosen LRA method. Try value-iteration.");
-    if (method == storm::solver::LraMethod::LinearProgramming) {
-        return computeLraForMecLp(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else if (method == storm::solver::LraMethod::ValueIteration) {
-        return computeLraForMecVi(env, stateRewardsGetter, actionRewardsGetter, component);
-    } else {
-        STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
-    }
+    return method;
+}
+
+template<typename ValueType>
+bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isConcurrentComponentComputationSupported(Environment const& env) const {
+    // Value iteration only uses data local to the MEC (and writes choices of the MEC's states). LP solvers may share global state, which also applies to
+    // the solvers for the instant states of Markov automata.
+    return getLraMethod(env) == storm::solver::LraMethod::ValueIteration &&
+           (!this->isContinuousTime() || env.solver().minMax().getMethod() != storm::solver::MinMaxMethod::LinearProgramming);
 }
 
 template<typename ValueType>
@@ -173,7 +173,7 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
                                                                                         std::vector<ValueType> const* exitRates,
                                                                                         storm::solver::OptimizationDirection const* dir,
                                                                                         std::vector<uint64_t>* choices) {
-    initializeNewValues(stateValueGetter, actionValueGetter, exitRates);
+    initializeNewValues(env, stateValueGetter, actionValueGetter, exitRates);
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().lra().getPrecision());
     bool relative = env.solver().lra().getRelativeTerminationCriterion();
     boost::optional<uint64_t> maxIter;
@@ -217,7 +217,8 @@ ValueType LraViHelper<ValueType, ComponentType, TransitionsType>::performValueIt
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
-void LraViHelper<ValueType, ComponentType, TransitionsType>::initializeNewValues(ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter,
+void LraViHelper<ValueType, ComponentType, TransitionsType>::initializeNewValues(Environment const& env, ValueGetter const& stateValueGetter,
+                                                                                 ValueGetter const& actionValueGetter,
                                                                                  std::vector<ValueType> const* exitRates) {
     // clear potential old values and reserve enough space for new values
     _TsChoiceValues.clear();
@@ -250,8 +251,11 @@ void LraViHelper<ValueType, ComponentType, TransitionsType>::initializeNewValues
     }
 
     // Set-up new iteration vectors for timed states
-    _Tsx1.assign(_TsTransitions.getRowGroupCount(), storm::utility::zero<ValueType>());
-    _Tsx2 = _Tsx1;
+    // The vectors are obtained from the workspace (if any), as a helper is created for every component.
+    _Tsx1 = storm::solver::SolverWorkspace::acquireVector<ValueType>(env, _TsTransitions.getRowGroupCount());
+    _Tsx2 = storm::solver::SolverWorkspace::acquireVector<ValueType>(env, _TsTransitions.getRowGroupCount());
+    _Tsx1->assign(_Tsx1->size(), storm::utility::zero<ValueType>());
+    _Tsx2->assign(_Tsx2->size(), storm::utility::zero<ValueType>());
 
     if (_hasInstantStates) {
         // Set-up vectors for storing intermediate results for instant states.
@@ -489,22 +493,22 @@ bool LraViHelper<ValueType, ComponentType, TransitionsType>::isTimedState(uint64
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
 std::vector<ValueType>& LraViHelper<ValueType, ComponentType, TransitionsType>::xNew() {
-    return _Tsx1IsCurrent ? _Tsx1 : _Tsx2;
+    return _Tsx1IsCurrent ? *_Tsx1 : *_Tsx2;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
 std::vector<ValueType> const& LraViHelper<ValueType, ComponentType, TransitionsType>::xNew() const {
-    return _Tsx1IsCurrent ? _Tsx1 : _Tsx2;
+    return _Tsx1IsCurrent ? *_Tsx1 : *_Tsx2;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
 std::vector<ValueType>& LraViHelper<ValueType, ComponentType, TransitionsType>::xOld() {
-    return _Tsx1IsCurrent ? _Tsx2 : _Tsx1;
+    return _Tsx1IsCurrent ? *_Tsx2 : *_Tsx1;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
 std::vector<ValueType> const& LraViHelper<ValueType, ComponentType, TransitionsType>::xOld() const {
-    return _Tsx1IsCurrent ? _Tsx2 : _Tsx1;
+    return _Tsx1IsCurrent ? *_Tsx2 : *_Tsx1;
 }
 
 template<typename ValueType, typename ComponentType, LraViTransitionsType TransitionsType>
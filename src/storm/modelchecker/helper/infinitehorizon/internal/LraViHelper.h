@@ -80,10 +80,12 @@ class LraViHelper {
      * Initializes the value iterations with the provided values.
      * Resets all information from potential previous calls.
      * Must be called before the first call to performIterationStep.
+     * @param env The environment, whose solver workspace (if any) provides the iteration vectors.
      * @param stateValueGetter Function that returns for each state index (w.r.t. the input transitions) the value (e.g. reward) for that state
      * @param stateValueGetter Function that returns for each global choice index (w.r.t. the input transitions) the value (e.g. reward) for that choice
      */
-    void initializeNewValues(ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter, std::vector<ValueType> const* exitRates = nullptr);
+    void initializeNewValues(Environment const& env, ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter,
+                             std::vector<ValueType> const* exitRates = nullptr);
 
     /*!
      * Performs a single iteration step.
@@ -146,7 +148,8 @@ class LraViHelper {
     bool _hasInstantStates;
     ValueType _uniformizationRate;
     storm::storage::SparseMatrix<ValueType> _TsTransitions, _TsToIsTransitions, _IsTransitions, _IsToTsTransitions;
-    std::vector<ValueType> _Tsx1, _Tsx2, _TsChoiceValues;
+    storm::solver::WorkspaceVector<ValueType> _Tsx1, _Tsx2;
+    std::vector<ValueType> _TsChoiceValues;
     bool _Tsx1IsCurrent;
     std::vector<ValueType> _Isx, _Isb, _IsChoiceValues;
     std::unique_ptr<storm::solver::Multiplier<ValueType>> _TsMultiplier, _TsToIsMultiplier, _IsToTsMultiplier;
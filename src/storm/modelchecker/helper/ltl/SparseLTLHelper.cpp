@@ -220,7 +220,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
 
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
-    transformer::DAProductBuilder productBuilder(da, statesForAP);
+    // Product states behind automaton sinks are only needed to reconstruct schedulers
+    transformer::DAProductBuilder productBuilder(da, statesForAP, !this->isProduceSchedulerSet());
 
     auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
 
@@ -314,16 +315,14 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO("Resulting LTL path formula: " << ltlFormula->toString());
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
-    // Convert LTL formula to a deterministic automaton
-    std::shared_ptr<storm::automata::DeterministicAutomaton> da;
+    // Convert LTL formula to a deterministic automaton, either with the external tool given via ltl2da or with the internal tool (Spot).
+    // For nondeterministic models the acceptance condition is transformed into DNF. The automaton might be cached (or pre-translated).
+    boost::optional<std::string> ltl2daTool;
     if (env.modelchecker().isLtl2daToolSet()) {
-        // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
-    } else {
-        // Use the internal tool (Spot)
-        // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+        ltl2daTool = env.modelchecker().getLtl2daTool();
     }
+    std::shared_ptr<storm::automata::DeterministicAutomaton> da =
+        storm::automata::LTL2DeterministicAutomaton::ltl2da(*ltlFormula, Nondeterministic, ltl2daTool);
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
                                                                   << " atomic propositions and " << *da->getAcceptance()->getAcceptanceExpression()
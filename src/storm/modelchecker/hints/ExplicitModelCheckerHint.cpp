@@ -9,7 +9,7 @@ namespace modelchecker {
 
 template<typename ValueType>
 bool ExplicitModelCheckerHint<ValueType>::isEmpty() const {
-    return !hasResultHint() && !hasSchedulerHint() && !hasMaybeStates();
+    return !hasResultHint() && !hasSchedulerHint() && !hasMaybeStates() && !hasStepBoundedResultHint();
 }
 
 template<typename ValueType>
@@ -116,6 +116,26 @@ void ExplicitModelCheckerHint<ValueType>::setNoEndComponentsInMaybeStates(bool v
     noEndComponentsInMaybeStates = value;
 }
 
+template<typename ValueType>
+bool ExplicitModelCheckerHint<ValueType>::hasStepBoundedResultHint() const {
+    return stepBoundedResultHint.is_initialized();
+}
+
+template<typename ValueType>
+uint64_t ExplicitModelCheckerHint<ValueType>::getStepBoundedResultHintSteps() const {
+    return stepBoundedResultHint->first;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& ExplicitModelCheckerHint<ValueType>::getStepBoundedResultHint() const {
+    return stepBoundedResultHint->second;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerHint<ValueType>::setStepBoundedResultHint(uint64_t steps, std::vector<ValueType> const& values) {
+    stepBoundedResultHint = std::make_pair(steps, values);
+}
+
 template class ExplicitModelCheckerHint<double>;
 template class ExplicitModelCheckerHint<storm::RationalNumber>;
 template class ExplicitModelCheckerHint<storm::RationalFunction>;
@@ -55,13 +55,22 @@ class ExplicitModelCheckerHint : public ModelCheckerHint {
     bool getNoEndComponentsInMaybeStates() const;
     void setNoEndComponentsInMaybeStates(bool value);
 
+    // A result of the same step-bounded property (without lower bound) for a smaller number of steps.
+    // Step-bounded computations may continue from these values instead of starting from scratch.
+    bool hasStepBoundedResultHint() const;
+    uint64_t getStepBoundedResultHintSteps() const;
+    std::vector<ValueType> const& getStepBoundedResultHint() const;
+    void setStepBoundedResultHint(uint64_t steps, std::vector<ValueType> const& values);
+
    private:
     boost::optional<std::vector<ValueType>> resultHint;
     boost::optional<storm::storage::Scheduler<ValueType>> schedulerHint;
 
-    bool computeOnlyMaybeStates;
+    bool computeOnlyMaybeStates = false;
     boost::optional<storm::storage::BitVector> maybeStates;
-    bool noEndComponentsInMaybeStates;
+    bool noEndComponentsInMaybeStates = false;
+
+    boost::optional<std::pair<uint64_t, std::vector<ValueType>>> stepBoundedResultHint;
 };
 
 }  // namespace modelchecker
@@ -0,0 +1,288 @@
+#include "storm/modelchecker/hints/ResultHintStore.h"
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/io/file.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace detail {
+inline void combineFingerprint(uint64_t& fingerprint, uint64_t value) {
+    // 64-bit FNV-1a step.
+    fingerprint ^= value;
+    fingerprint *= 1099511628211ull;
+}
+
+template<typename T>
+std::string vectorToString(std::vector<T> const& vector) {
+    std::stringstream stream;
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    bool first = true;
+    for (auto const& value : vector) {
+        if (!first) {
+            stream << " ";
+        }
+        first = false;
+        stream << value;
+    }
+    return stream.str();
+}
+
+template<typename T>
+std::vector<T> vectorFromString(std::string const& line, uint64_t expectedSize) {
+    std::vector<T> result;
+    result.reserve(expectedSize);
+    std::stringstream stream(line);
+    std::string token;
+    while (stream >> token) {
+        result.push_back(storm::utility::convertNumber<T>(token));
+    }
+    STORM_LOG_THROW(result.size() == expectedSize, storm::exceptions::WrongFormatException,
+                    "Expected " << expectedSize << " entries in hint file but got " << result.size() << ".");
+    return result;
+}
+
+template<>
+std::vector<uint64_t> vectorFromString<uint64_t>(std::string const& line, uint64_t expectedSize) {
+    std::vector<uint64_t> result;
+    result.reserve(expectedSize);
+    std::stringstream stream(line);
+    uint64_t value;
+    while (stream >> value) {
+        result.push_back(value);
+    }
+    STORM_LOG_THROW(result.size() == expectedSize, storm::exceptions::WrongFormatException,
+                    "Expected " << expectedSize << " entries in hint file but got " << result.size() << ".");
+    return result;
+}
+}  // namespace detail
+
+template<typename ValueType>
+ResultHintStore<ValueType>::ResultHintStore(ModelType const& model)
+    : numberOfStates(model.getNumberOfStates()),
+      numberOfChoices(model.getTransitionMatrix().getRowCount()),
+      fingerprint(14695981039346656037ull),
+      valueFingerprint(14695981039346656037ull),
+      nondeterministic(model.isNondeterministicModel()) {
+    auto const& matrix = model.getTransitionMatrix();
+    boost::hash<ValueType> valueHash;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        detail::combineFingerprint(fingerprint, matrix.getRowGroupSize(state));
+        for (uint64_t row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                detail::combineFingerprint(fingerprint, entry.getColumn());
+                detail::combineFingerprint(valueFingerprint, valueHash(entry.getValue()));
+            }
+            detail::combineFingerprint(fingerprint, std::numeric_limits<uint64_t>::max());
+        }
+    }
+}
+
+template<typename ValueType>
+boost::optional<typename ResultHintStore<ValueType>::FormulaKeys> ResultHintStore<ValueType>::getKeys(storm::logic::Formula const& formula) const {
+    if (!formula.isProbabilityOperatorFormula() && !formula.isRewardOperatorFormula()) {
+        return boost::none;
+    }
+    auto const& operatorFormula = formula.asOperatorFormula();
+    std::string prefix = formula.isProbabilityOperatorFormula() ? "P" : "R";
+    if (formula.isRewardOperatorFormula() && formula.asRewardOperatorFormula().hasRewardModelName()) {
+        prefix += "{\"" + formula.asRewardOperatorFormula().getRewardModelName() + "\"}";
+    }
+    if (operatorFormula.hasOptimalityType()) {
+        prefix += storm::solver::minimize(operatorFormula.getOptimalityType()) ? "min" : "max";
+    }
+
+    auto const& subformula = operatorFormula.getSubformula();
+    FormulaKeys keys;
+    keys.valueKey = prefix + "=? [" + subformula.toString() + "]";
+    if (subformula.isReachabilityProbabilityFormula() || subformula.isReachabilityRewardFormula()) {
+        keys.schedulerKey = "(true) U (" + subformula.asEventuallyFormula().getSubformula().toString() + ")";
+    } else if (subformula.isUntilFormula() && formula.isProbabilityOperatorFormula()) {
+        auto const& untilFormula = subformula.asUntilFormula();
+        keys.schedulerKey = "(" + untilFormula.getLeftSubformula().toString() + ") U (" + untilFormula.getRightSubformula().toString() + ")";
+    } else if (subformula.isBoundedUntilFormula() && formula.isProbabilityOperatorFormula()) {
+        auto const& boundedUntilFormula = subformula.asBoundedUntilFormula();
+        if (boundedUntilFormula.isMultiDimensional() || !boundedUntilFormula.getTimeBoundReference().isStepBound() || boundedUntilFormula.hasLowerBound() ||
+            !boundedUntilFormula.hasUpperBound() || !boundedUntilFormula.hasIntegerUpperBound()) {
+            return boost::none;
+        }
+        std::string unboundedKey = prefix + "=? [(" + boundedUntilFormula.getLeftSubformula().toString() + ") U<= (" +
+                                   boundedUntilFormula.getRightSubformula().toString() + ")]";
+        keys.stepBoundedKey = std::make_pair(unboundedKey, boundedUntilFormula.getNonStrictUpperBound<uint64_t>());
+    } else {
+        return boost::none;
+    }
+    return keys;
+}
+
+template<typename ValueType>
+void ResultHintStore<ValueType>::provideHint(CheckTask<storm::logic::Formula, ValueType>& task) const {
+    auto keys = getKeys(task.getFormula());
+    if (!keys) {
+        return;
+    }
+
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    if (keys->stepBoundedKey) {
+        auto stepValues = stepBoundedValues.find(keys->stepBoundedKey->first);
+        if (stepValues != stepBoundedValues.end()) {
+            // Take the result for the largest number of steps that does not exceed the bound.
+            auto stepResult = stepValues->second.upper_bound(keys->stepBoundedKey->second);
+            if (stepResult != stepValues->second.begin()) {
+                --stepResult;
+                hint->setStepBoundedResultHint(stepResult->first, stepResult->second);
+            }
+        }
+    } else {
+        auto valueResult = values.find(keys->valueKey);
+        if (valueResult != values.end()) {
+            hint->setResultHint(valueResult->second);
+        }
+    }
+    if (nondeterministic && keys->schedulerKey) {
+        auto schedulerResult = schedulers.find(keys->schedulerKey.get());
+        if (schedulerResult != schedulers.end()) {
+            storm::storage::Scheduler<ValueType> scheduler(numberOfStates);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                scheduler.setChoice(schedulerResult->second[state], state);
+            }
+            hint->setSchedulerHint(std::move(scheduler));
+        }
+    }
+    if (!hint->isEmpty()) {
+        STORM_LOG_INFO("Providing hint from previous results for " << task.getFormula() << ".");
+        task.setHint(hint);
+    }
+}
+
+template<typename ValueType>
+void ResultHintStore<ValueType>::storeResult(storm::logic::Formula const& formula, CheckResult const& result) {
+    auto keys = getKeys(formula);
+    if (!keys || !result.isExplicitQuantitativeCheckResult()) {
+        return;
+    }
+    auto const& quantitativeResult = result.template asExplicitQuantitativeCheckResult<ValueType>();
+    if (!quantitativeResult.isResultForAllStates()) {
+        return;
+    }
+    if (keys->stepBoundedKey) {
+        stepBoundedValues[keys->stepBoundedKey->first][keys->stepBoundedKey->second] = quantitativeResult.getValueVector();
+    } else {
+        values[keys->valueKey] = quantitativeResult.getValueVector();
+    }
+    if (nondeterministic && keys->schedulerKey && quantitativeResult.hasScheduler()) {
+        auto const& scheduler = quantitativeResult.getScheduler();
+        if (scheduler.isMemorylessScheduler() && scheduler.isDeterministicScheduler()) {
+            std::vector<uint64_t> choices(numberOfStates, 0);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                auto const& choice = scheduler.getChoice(state);
+                if (choice.isDefined()) {
+                    choices[state] = choice.getDeterministicChoice();
+                }
+            }
+            schedulers[keys->schedulerKey.get()] = std::move(choices);
+        }
+    }
+}
+
+template<typename ValueType>
+bool ResultHintStore<ValueType>::isEmpty() const {
+    return values.empty() && stepBoundedValues.empty() && schedulers.empty();
+}
+
+template<typename ValueType>
+void ResultHintStore<ValueType>::exportToFile(std::string const& filename) const {
+    std::ofstream stream;
+    storm::io::openFile(filename, stream);
+    stream << "// storm result hints\n";
+    stream << "model " << numberOfStates << " " << numberOfChoices << " " << fingerprint << " " << valueFingerprint << '\n';
+    for (auto const& entry : values) {
+        stream << "values\n" << entry.first << '\n' << detail::vectorToString(entry.second) << '\n';
+    }
+    for (auto const& entry : stepBoundedValues) {
+        for (auto const& stepEntry : entry.second) {
+            stream << "steps " << stepEntry.first << '\n' << entry.first << '\n' << detail::vectorToString(stepEntry.second) << '\n';
+        }
+    }
+    for (auto const& entry : schedulers) {
+        stream << "scheduler\n" << entry.first << '\n' << detail::vectorToString(entry.second) << '\n';
+    }
+    storm::io::closeFile(stream);
+}
+
+template<typename ValueType>
+void ResultHintStore<ValueType>::importFromFile(std::string const& filename) {
+    std::ifstream stream;
+    storm::io::openFile(filename, stream);
+    std::string line;
+    bool headerRead = false;
+    bool sameValues = false;
+    uint64_t droppedStepBoundedResults = 0;
+    while (storm::io::getline(stream, line)) {
+        if (line.empty() || line.compare(0, 2, "//") == 0) {
+            continue;
+        }
+        std::stringstream lineStream(line);
+        std::string kind;
+        lineStream >> kind;
+        if (kind == "model") {
+            uint64_t fileStates = 0, fileChoices = 0, fileFingerprint = 0, fileValueFingerprint = 0;
+            lineStream >> fileStates >> fileChoices >> fileFingerprint >> fileValueFingerprint;
+            STORM_LOG_THROW(fileStates == numberOfStates && fileChoices == numberOfChoices && fileFingerprint == fingerprint,
+                            storm::exceptions::WrongFormatException,
+                            "The hints in file " << filename << " were computed for a model with a different structure (" << fileStates << " states, "
+                                                 << fileChoices << " choices).");
+            headerRead = true;
+            sameValues = static_cast<bool>(lineStream) && fileValueFingerprint == valueFingerprint;
+            continue;
+        }
+        STORM_LOG_THROW(headerRead, storm::exceptions::WrongFormatException, "Hint file " << filename << " does not start with a model description.");
+        std::string key, data;
+        STORM_LOG_THROW(storm::io::getline(stream, key) && storm::io::getline(stream, data), storm::exceptions::WrongFormatException,
+                        "Unexpected end of hint file " << filename << ".");
+        if (kind == "values") {
+            values[key] = detail::vectorFromString<ValueType>(data, numberOfStates);
+        } else if (kind == "steps") {
+            uint64_t steps;
+            lineStream >> steps;
+            auto stepValues = detail::vectorFromString<ValueType>(data, numberOfStates);
+            // Step-bounded results are not a guess but the exact starting point of the remaining steps, so they are only valid for the same probabilities.
+            if (sameValues) {
+                stepBoundedValues[key][steps] = std::move(stepValues);
+            } else {
+                ++droppedStepBoundedResults;
+            }
+        } else if (kind == "scheduler") {
+            schedulers[key] = detail::vectorFromString<uint64_t>(data, numberOfStates);
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Unknown entry '" << kind << "' in hint file " << filename << ".");
+        }
+    }
+    storm::io::closeFile(stream);
+    STORM_LOG_WARN_COND(droppedStepBoundedResults == 0, "Ignoring " << droppedStepBoundedResults << " step-bounded results in hint file " << filename
+                                                                    << " as they were computed for a model with different transition probabilities.");
+}
+
+template class ResultHintStore<double>;
+template class ResultHintStore<storm::RationalNumber>;
+template class ResultHintStore<storm::RationalFunction>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/CheckTask.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+template<typename ValueType, typename RewardModelType>
+class Model;
+template<typename ValueType>
+class StandardRewardModel;
+}  // namespace sparse
+}  // namespace models
+
+namespace modelchecker {
+
+class CheckResult;
+
+/*!
+ * Collects results of previously checked properties on a sparse model and derives model checker hints for related properties from them:
+ * - the values of a property are used as initial values when the same property is checked again,
+ * - the values of a step-bounded reachability property for k steps are the starting point for the same property with more steps,
+ * - schedulers computed (if requested) for a reachability probability or reward serve as scheduler hint for all other reachability probabilities
+ *   and rewards with the same target (e.g. Pmax=? [F "goal"] seeds policy iteration for Rmax=? [F "goal"]).
+ *
+ * The store can be exported to and imported from a file. Stored results are keyed to the structure (states, choices and transitions) of the
+ * model, which allows reusing them across runs and across models that only differ in the transition probabilities. Step-bounded results are
+ * continued rather than refined, so they are only imported if the transition probabilities match as well.
+ * @note The model checkers verify whether a hint is applicable, stale values and schedulers only affect the speed of convergence.
+ */
+template<typename ValueType>
+class ResultHintStore {
+   public:
+    typedef storm::models::sparse::Model<ValueType, storm::models::sparse::StandardRewardModel<ValueType>> ModelType;
+
+    ResultHintStore(ModelType const& model);
+
+    /*!
+     * Sets a hint for the given task if related results are stored.
+     */
+    void provideHint(CheckTask<storm::logic::Formula, ValueType>& task) const;
+
+    /*!
+     * Stores the given result of the given formula if it can be used to derive hints.
+     * Results that are not available for all states are ignored.
+     */
+    void storeResult(storm::logic::Formula const& formula, CheckResult const& result);
+
+    /*!
+     * Adds the results stored in the given file. Throws if the file was written for a model with a different structure.
+     * Step-bounded results are skipped if the file was written for a model with different transition probabilities.
+     */
+    void importFromFile(std::string const& filename);
+
+    /*!
+     * Writes all stored results to the given file.
+     */
+    void exportToFile(std::string const& filename) const;
+
+    /*!
+     * Retrieves whether no result is stored.
+     */
+    bool isEmpty() const;
+
+   private:
+    struct FormulaKeys {
+        // The key of the formula itself, used for value hints.
+        std::string valueKey;
+        // If the formula is a step-bounded reachability probability, the key of the formula without step bound and the bound.
+        boost::optional<std::pair<std::string, uint64_t>> stepBoundedKey;
+        // If the formula is an (unbounded) reachability probability or reward, the key of the target, used for scheduler hints.
+        boost::optional<std::string> schedulerKey;
+    };
+
+    boost::optional<FormulaKeys> getKeys(storm::logic::Formula const& formula) const;
+
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t fingerprint;
+    uint64_t valueFingerprint;
+    bool nondeterministic;
+
+    std::map<std::string, std::vector<ValueType>> values;
+    std::map<std::string, std::map<uint64_t, std::vector<ValueType>>> stepBoundedValues;
+    // Schedulers are stored as local choice index per state.
+    std::map<std::string, std::vector<uint64_t>> schedulers;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,4 +1,8 @@
 #include "storm/modelchecker/lexicographic/lexicographicModelCheckerHelper.h"
+
+#include <limits>
+#include <numeric>
+
 #include "storm//modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/automata/APSet.h"
 #include "storm/automata/DeterministicAutomaton.h"
@@ -75,10 +79,19 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
     // they are ordered from last to first, so reverse the array
     std::reverse(acceptancePairs.begin(), acceptancePairs.end());
 
+    // get easy access to incoming transitions of a state. This is shared by all MECs and conditions.
+    productModelType const& model = productModel->getProductModel();
+    auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
+    auto incomingStatesMatrix = model.getBackwardTransitions();
+
     // Iterate over the end-components and find their lex-array
     for (storm::storage::MaximalEndComponent& mec : mecs) {
         std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> sprime;
         std::vector<bool> bsccAccepting;
+        // the states and choices of the end components in which the Streett-pairs in sprime can be fulfilled
+        storm::storage::BitVector acceptingStates(model.getNumberOfStates(), false);
+        std::for_each(mec.begin(), mec.end(), [&acceptingStates](auto const& state) { acceptingStates.set(state.first); });
+        storm::storage::BitVector acceptingChoices = model.getTransitionMatrix().getRowFilter(acceptingStates, acceptingStates);
         for (uint i = 0; i < acceptanceConditions.size() - 1; i++) {
             // copy the current list of Streett-pairs that can be fulfilled together
             std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> sprimeTemp(sprime);
@@ -87,13 +100,18 @@ lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::g
                                                                                            acceptancePairs.begin() + acceptanceConditions[i + 1]};
             sprimeTemp.insert(sprimeTemp.end(), sub.begin(), sub.end());
 
-            // check whether the Streett-condition in sprimeTemp can be fulfilled in the mec
-            bool accepts = isAcceptingStreettConditions(mec, sprimeTemp, acceptance, productModel->getProductModel());
+            // check whether the Streett-condition in sprimeTemp can be fulfilled in the mec, starting from the end components for sprime
+            storm::storage::BitVector mecStates = acceptingStates;
+            storm::storage::BitVector mecChoices = acceptingChoices;
+            bool accepts =
+                isAcceptingStreettConditions(sprimeTemp, acceptance, model, incomingChoicesMatrix, incomingStatesMatrix, mecStates, mecChoices);
 
             if (accepts) {
                 // if the condition can be fulfilled, add the Streett-pairs to the current list of pairs, and mark this property as true for this MEC
                 bsccAccepting.push_back(true);
                 sprime.insert(sprime.end(), sub.begin(), sub.end());
+                acceptingStates = std::move(mecStates);
+                acceptingChoices = std::move(mecChoices);
             } else {
                 bsccAccepting.push_back(false);
             }
@@ -120,42 +138,57 @@ MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelpe
         eliminator.transform(newMatrixWithNewStates, mecs, eliminationStates, storm::storage::BitVector(eliminationStates.size(), false), true);
 
     STORM_LOG_ASSERT(!mecLexArray.empty(), "No MECs in the model!");
-    std::vector<std::vector<bool>> bccLexArrayCurrent(mecLexArray);
     // prepare the result (one reachability probability for each objective)
     MDPSparseModelCheckingHelperReturnType<ValueType> retResult(std::vector<ValueType>(mecLexArray[0].size()));
-    std::vector<uint_fast64_t> compressedToReducedMapping(compressionResult.matrix.getColumnCount());
-    std::iota(std::begin(compressedToReducedMapping), std::end(compressedToReducedMapping), 0);
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = compressionResult.matrix;
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = std::move(compressionResult.matrix);
+    // For each state of the compressed model its index in the model that is reduced to optimal choices. This is updated whenever states are removed.
+    std::vector<uint_fast64_t> compressedToReducedIndex(transitionMatrix.getRowGroupCount());
+    std::iota(compressedToReducedIndex.begin(), compressedToReducedIndex.end(), 0);
+    uint_fast64_t const invalidIndex = std::numeric_limits<uint_fast64_t>::max();
+
+    // Get initial states in the compressed model
+    std::vector<uint_fast64_t> compressedInitialStates;
+    for (auto const& initialState : originalMdp.getInitialStates()) {
+        compressedInitialStates.push_back(compressionResult.oldToNewStateMapping[initialState]);
+    }
 
     // check reachability for each condition and restrict the model to optimal choices
     for (uint condition = 0; condition < mecLexArray[0].size(); condition++) {
         // get the goal-states for this objective (i.e. the st-states of the MECs where the objective can be fulfilled
-        storm::storage::BitVector psiStates = getGoodStates(mecs, bccLexArrayCurrent, compressionResult.oldToNewStateMapping, condition,
-                                                            transitionMatrix.getColumnCount(), compressedToReducedMapping, bccToStStateMapping);
+        storm::storage::BitVector psiStates = getGoodStates(mecs, mecLexArray, compressionResult.oldToNewStateMapping, condition,
+                                                            transitionMatrix.getColumnCount(), compressedToReducedIndex, bccToStStateMapping);
         if (psiStates.getNumberOfSetBits() == 0) {
             retResult.values[condition] = 0;
             continue;
         }
 
-        // solve the reachability query for this set of goal states
         std::vector<uint_fast64_t> newInitalStates;
-        auto res =
-            solveOneReachability(newInitalStates, psiStates, transitionMatrix, originalMdp, compressedToReducedMapping, compressionResult.oldToNewStateMapping);
+        for (auto const& compressedState : compressedInitialStates) {
+            if (compressedState < compressedToReducedIndex.size() && compressedToReducedIndex[compressedState] != invalidIndex) {
+                newInitalStates.push_back(compressedToReducedIndex[compressedState]);
+            }
+        }
         if (newInitalStates.empty()) {
             retResult.values[condition] = 0;
             continue;
         }
+
+        // solve the reachability query for this set of goal states
+        auto res = solveOneReachability(newInitalStates, psiStates, transitionMatrix);
         retResult.values[condition] = res.values[newInitalStates[0]];
 
         // create a reduced subsystem that only contains the optimal actions for this objective
         auto subsystem = getReducedSubsystem(transitionMatrix, res, newInitalStates, psiStates);
-        std::vector<uint_fast64_t> compressedToReducedMappingTemp;
-        compressedToReducedMappingTemp.reserve(compressedToReducedMapping.size());
-        // create a new mapping for the states
-        for (uint_fast64_t newState : subsystem.newToOldStateIndexMapping) {
-            compressedToReducedMappingTemp.push_back(compressedToReducedMapping[newState]);
+        // update the mapping for the states
+        std::vector<uint_fast64_t> reducedToNewIndex(transitionMatrix.getRowGroupCount(), invalidIndex);
+        for (uint_fast64_t newState = 0; newState < subsystem.newToOldStateIndexMapping.size(); ++newState) {
+            reducedToNewIndex[subsystem.newToOldStateIndexMapping[newState]] = newState;
+        }
+        for (auto& reducedIndex : compressedToReducedIndex) {
+            if (reducedIndex != invalidIndex) {
+                reducedIndex = reducedToNewIndex[reducedIndex];
+            }
         }
-        compressedToReducedMapping = compressedToReducedMappingTemp;
         transitionMatrix = subsystem.model->getTransitionMatrix();
     }
     return retResult;
@@ -191,19 +224,13 @@ const storm::storage::BitVector& getStreettSet(storm::automata::AcceptanceCondit
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::isAcceptingStreettConditions(
-    storm::storage::MaximalEndComponent const& scc, std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-    storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model) {
-    // initialize the states and choices we have to consider for mec decomposition
-    storm::storage::BitVector mecStates = storm::storage::BitVector(model.getNumberOfStates(), false);
-    std::for_each(scc.begin(), scc.end(), [&mecStates](auto const& state) { mecStates.set(state.first); });
-    auto mecChoices = model.getTransitionMatrix().getRowFilter(mecStates, mecStates);
+    std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs, storm::automata::AcceptanceCondition::ptr const& acceptance,
+    productModelType const& model, storm::storage::SparseMatrix<ValueType> const& incomingChoicesMatrix,
+    storm::storage::SparseMatrix<ValueType> const& incomingStatesMatrix, storm::storage::BitVector& mecStates, storm::storage::BitVector& mecChoices) {
     // catch the simple case where there are no mecs
     if (mecChoices.empty()) {
         return false;
     }
-    // get easy access to incoming transitions of a state
-    auto incomingChoicesMatrix = model.getTransitionMatrix().transpose();
-    auto incomingStatesMatrix = model.getBackwardTransitions();
     bool changedSomething = true;
     while (changedSomething) {
         // iterate until there is no change
@@ -217,8 +244,8 @@ bool lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministi
             for (storm::automata::AcceptanceCondition::acceptance_expr::ptr const& streettPair : acceptancePairs) {
                 // check whether (i) the MEC contains states from the Inf-set (the condition holds) or (ii) states from the Fin-set (unclear whether it can be
                 // fulfilled)
-                auto infSet = getStreettSet(acceptance, streettPair->getRight());
-                auto finSet = getStreettSet(acceptance, streettPair->getLeft());
+                auto const& infSet = getStreettSet(acceptance, streettPair->getRight());
+                auto const& finSet = getStreettSet(acceptance, streettPair->getLeft());
                 if (mec.containsAnyState(infSet)) {
                     // streett-condition is true (INF is fulfilled)
                     continue;
@@ -256,7 +283,7 @@ template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::getGoodStates(
     storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc, std::vector<std::vector<bool>> const& bccLexArray,
     std::vector<uint_fast64_t> const& oldToNewStateMapping, uint const& condition, uint const numStates,
-    std::vector<uint_fast64_t> const& compressedToReducedMapping, std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
+    std::vector<uint_fast64_t> const& compressedToReducedIndex, std::map<uint, uint_fast64_t> const& bccToStStateMapping) {
     STORM_LOG_ASSERT(!bccLexArray.empty(), "Lex-Array is empty!");
     STORM_LOG_ASSERT(condition < bccLexArray[0].size(), "Condition is not in Lex-Array!");
     std::vector<uint_fast64_t> goodStates;
@@ -265,11 +292,9 @@ storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, Value
         if (bccLex[condition]) {
             uint_fast64_t bccStateOld = bccToStStateMapping.at(i);
             uint_fast64_t bccState = oldToNewStateMapping[bccStateOld];
-            auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), bccState);
-            if (pointer != compressedToReducedMapping.end()) {
-                // We have to check whether the state has already been removed
-                uint_fast64_t bccStateReduced = pointer - compressedToReducedMapping.begin();
-                goodStates.push_back(bccStateReduced);
+            // We have to check whether the state has already been removed
+            if (bccState < compressedToReducedIndex.size() && compressedToReducedIndex[bccState] < numStates) {
+                goodStates.push_back(compressedToReducedIndex[bccState]);
             }
         }
     }
@@ -278,26 +303,14 @@ storm::storage::BitVector lexicographicModelCheckerHelper<SparseModelType, Value
 
 template<typename SparseModelType, typename ValueType, bool Nondeterministic>
 MDPSparseModelCheckingHelperReturnType<ValueType> lexicographicModelCheckerHelper<SparseModelType, ValueType, Nondeterministic>::solveOneReachability(
-    std::vector<uint_fast64_t>& newInitalStates, storm::storage::BitVector const& psiStates, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-    SparseModelType const& originalMdp, std::vector<uint_fast64_t> const& compressedToReducedMapping, std::vector<uint_fast64_t> const& oldToNewStateMapping) {
+    std::vector<uint_fast64_t> const& initialStates, storm::storage::BitVector const& psiStates,
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     Environment env;
     // A reachability condition "F x" is transformed to "true U x"
     // phi states are all states
     // psi states are the ones from the "good bccs"
     storm::storage::BitVector phiStates(transitionMatrix.getColumnCount(), true);
-
-    // Get initial states in the compressed model
-    storm::storage::BitVector const& originalInitialStates = originalMdp.getInitialStates();
-
-    uint pos = 0;
-    while (originalInitialStates.getNextSetIndex(pos) != originalInitialStates.size()) {
-        pos = originalInitialStates.getNextSetIndex(pos) + 1;
-        auto pointer = std::find(compressedToReducedMapping.begin(), compressedToReducedMapping.end(), oldToNewStateMapping[pos - 1]);
-        if (pointer != compressedToReducedMapping.end()) {
-            newInitalStates.push_back(pointer - compressedToReducedMapping.begin());
-        }
-    }
-    storm::storage::BitVector i(transitionMatrix.getColumnCount(), newInitalStates);
+    storm::storage::BitVector i(transitionMatrix.getColumnCount(), initialStates);
 
     ModelCheckerHint hint;
     MDPSparseModelCheckingHelperReturnType<ValueType> ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
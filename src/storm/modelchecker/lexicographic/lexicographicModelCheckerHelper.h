@@ -85,16 +85,23 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
         storm::automata::AcceptanceCondition::acceptance_expr::ptr const& current);
 
     /*!
-     * Checks whether a Streett-condition can be fulfilled in an MEC
-     * @param mec MEC
+     * Checks whether a Streett-condition can be fulfilled in (a part of) an MEC
+     * The given states and choices are refined to the end components in which the condition can be fulfilled. As adding Streett-pairs only
+     * refines these end components further, the refinement for a subset of the pairs can be used as starting point.
      * @param acceptancePairs list of Streett-pairs that create the Streett-condition
      * @param acceptance original acceptance condition of the automaton
      * @param model copy of the product-model
+     * @param incomingChoicesMatrix the transposed transition matrix of the model (without joined row groups)
+     * @param incomingStatesMatrix the backward transitions of the model
+     * @param mecStates the states that are considered, refined upon return
+     * @param mecChoices the choices that are considered, refined upon return
      * @return whether the condition can be fulfilled or not
      */
-    bool isAcceptingStreettConditions(storm::storage::MaximalEndComponent const& scc,
-                                      std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
-                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model);
+    bool isAcceptingStreettConditions(std::vector<storm::automata::AcceptanceCondition::acceptance_expr::ptr> const& acceptancePairs,
+                                      storm::automata::AcceptanceCondition::ptr const& acceptance, productModelType const& model,
+                                      storm::storage::SparseMatrix<ValueType> const& incomingChoicesMatrix,
+                                      storm::storage::SparseMatrix<ValueType> const& incomingStatesMatrix, storm::storage::BitVector& mecStates,
+                                      storm::storage::BitVector& mecChoices);
 
     /*!
      * For a given objective, iterates over the MECs and finds the corresponding sink state
@@ -104,23 +111,20 @@ class lexicographicModelCheckerHelper : public helper::SingleValueModelCheckerHe
      * @param condition the condition to be checked
      * @param numStatesTotal the number of states in total in the compressed model
      * @param mecToStateMapping mapping of the MECs to their corresponding sink state
-     * @param compressedToReducedMapping mapping of the compressed model to the reduced to optimal
+     * @param compressedToReducedIndex for each state of the compressed model its index in the reduced model (or an invalid index if it was removed)
      * @return set of "good" states for the given condition
      */
     storm::storage::BitVector getGoodStates(storm::storage::MaximalEndComponentDecomposition<ValueType> const& bcc,
                                             std::vector<std::vector<bool>> const& bccLexArray, std::vector<uint_fast64_t> const& oldToNewStateMapping,
-                                            uint const& condition, uint const numStates, std::vector<uint_fast64_t> const& compressedToReducedMapping,
+                                            uint const& condition, uint const numStates, std::vector<uint_fast64_t> const& compressedToReducedIndex,
                                             std::map<uint, uint_fast64_t> const& bccToStStateMapping);
 
     /*!
      * Solves the reachability-query for a given set of goal-states and initial-states
      */
-    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(std::vector<uint_fast64_t>& newInitalStates,
+    MDPSparseModelCheckingHelperReturnType<ValueType> solveOneReachability(std::vector<uint_fast64_t> const& initialStates,
                                                                            storm::storage::BitVector const& psiStates,
-                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                           SparseModelType const& originalMdp,
-                                                                           std::vector<uint_fast64_t> const& compressedToReducedMapping,
-                                                                           std::vector<uint_fast64_t> const& oldToNewStateMapping);
+                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
 
     /*!
      * Reduces the model to actions that are optimal for the given strategy.
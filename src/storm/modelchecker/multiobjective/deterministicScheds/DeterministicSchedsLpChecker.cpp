@@ -57,24 +57,23 @@ void DeterministicSchedsLpChecker<ModelType, GeometryValueType>::setCurrentWeigh
     swAll.start();
     initialize(env);
     STORM_LOG_ASSERT(weightVector.size() == objectiveHelper.size(), "Setting a weight vector with invalid number of entries.");
-    if (!currentWeightVector.empty()) {
-        // Pop information of the current weight vector.
-        lpModel->pop();
-        lpModel->update();
-        currentObjectiveVariables.clear();
-    }
-
     currentWeightVector = weightVector;
 
-    lpModel->push();
-    // set up objective function for the given weight vector
-    for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
-        currentObjectiveVariables.push_back(
-            lpModel->addUnboundedContinuousVariable("w_" + std::to_string(objIndex), storm::utility::convertNumber<ValueType>(weightVector[objIndex])));
-        if (objectiveHelper[objIndex].minimizing() && flowEncoding) {
-            lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == -initialStateResults[objIndex]);
-        } else {
-            lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == initialStateResults[objIndex]);
+    if (currentObjectiveVariables.empty()) {
+        // set up objective function for the given weight vector
+        for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
+            currentObjectiveVariables.push_back(
+                lpModel->addUnboundedContinuousVariable("w_" + std::to_string(objIndex), storm::utility::convertNumber<ValueType>(weightVector[objIndex])));
+            if (objectiveHelper[objIndex].minimizing() && flowEncoding) {
+                lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == -initialStateResults[objIndex]);
+            } else {
+                lpModel->addConstraint("", currentObjectiveVariables.back().getExpression() == initialStateResults[objIndex]);
+            }
+        }
+    } else {
+        // Only the coefficients of the objective function change, so the LP does not have to be rebuilt.
+        for (uint64_t objIndex = 0; objIndex < initialStateResults.size(); ++objIndex) {
+            lpModel->setObjectiveFunctionCoefficient(currentObjectiveVariables[objIndex], storm::utility::convertNumber<ValueType>(weightVector[objIndex]));
         }
     }
     lpModel->update();
@@ -25,6 +25,13 @@ class DeterministicSchedsLpChecker {
 
     DeterministicSchedsLpChecker(ModelType const& model, std::vector<DeterministicSchedsObjectiveHelper<ModelType>> const& objectiveHelper);
 
+    /*!
+     * Builds the LP model (if this did not happen already). This is done implicitly when the first weight vector is set.
+     * The objective helpers might compute (and cache) some values during this call, i.e., checkers that share objective helpers
+     * should not be initialized concurrently.
+     */
+    void initialize(Environment const& env);
+
     /*!
      * Specifies the current direction.
      */
@@ -51,8 +58,6 @@ class DeterministicSchedsLpChecker {
     std::string getStatistics(std::string const& prefix = "") const;
 
    private:
-    void initialize(Environment const& env);
-
     bool processEndComponents(std::vector<std::vector<storm::expressions::Expression>>& ecVars);
     void initializeLpModel(Environment const& env);
 
@@ -16,6 +16,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/io/export.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/solver.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -303,7 +304,7 @@ DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::Determini
     for (auto const& obj : objectives) {
         objectiveHelper.emplace_back(*model, obj);
     }
-    lpChecker = std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper);
+    lpCheckers.push_back(std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper));
     if (preprocessorResult.containsOnlyTotalRewardFormulas()) {
         wvChecker = storm::modelchecker::multiobjective::WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
     } else {
@@ -393,11 +394,7 @@ std::unique_ptr<CheckResult> DeterministicSchedsParetoExplorer<SparseModelType,
         ei += ei;
         eps = std::vector<GeometryValueType>(objectives.size(), ei);
     }
-    while (!unprocessedFacets.empty()) {
-        Facet f = std::move(unprocessedFacets.front());
-        unprocessedFacets.pop();
-        processFacet(env, f);
-    }
+    processFacets(env);
 
     std::vector<std::vector<ModelValueType>> paretoPoints;
     paretoPoints.reserve(pointset.size());
@@ -411,7 +408,9 @@ std::unique_ptr<CheckResult> DeterministicSchedsParetoExplorer<SparseModelType,
         STORM_PRINT_AND_LOG("#STATS " << paretoPoints.size() << " Pareto points\n");
         STORM_PRINT_AND_LOG("#STATS " << unachievableAreas.size() << " unachievable areas\n");
         STORM_PRINT_AND_LOG("#STATS " << overApproximation->getHalfspaces().size() << " unachievable halfspaces\n");
-        STORM_PRINT_AND_LOG(lpChecker->getStatistics("#STATS "));
+        for (auto const& lpChecker : lpCheckers) {
+            STORM_PRINT_AND_LOG(lpChecker->getStatistics("#STATS "));
+        }
     }
     return std::make_unique<storm::modelchecker::ExplicitParetoCurveCheckResult<ModelValueType>>(originalModelInitialState, std::move(paretoPoints), nullptr,
                                                                                                  nullptr);
@@ -515,8 +514,8 @@ void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::init
             point = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getUnderApproximationOfInitialStateResults());
             negateMinObjectives(point);
         } else {
-            lpChecker->setCurrentWeightVector(env, weightVector);
-            auto optionalPoint = lpChecker->check(env, overApproximation);
+            lpCheckers.front()->setCurrentWeightVector(env, weightVector);
+            auto optionalPoint = lpCheckers.front()->check(env, overApproximation);
             STORM_LOG_THROW(optionalPoint.is_initialized(), storm::exceptions::UnexpectedException, "Unable to find a point in the current overapproximation.");
             point = std::move(optionalPoint.get());
         }
@@ -561,15 +560,53 @@ std::vector<GeometryValueType> DeterministicSchedsParetoExplorer<SparseModelType
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(Environment const& env, Facet& f) {
+void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacets(Environment const& env) {
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.modelchecker().multi().getNumberOfThreads());
+    if (numberOfThreads > 1) {
+        // The LP checkers are initialized sequentially as they share the objective helpers.
+        while (lpCheckers.size() < numberOfThreads) {
+            lpCheckers.push_back(std::make_shared<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>(*model, objectiveHelper));
+        }
+        for (auto& lpChecker : lpCheckers) {
+            lpChecker->initialize(env);
+        }
+    }
+
+    while (!unprocessedFacets.empty()) {
+        if (numberOfThreads > 1 && unprocessedFacets.size() > 1) {
+            // The facets that are currently unprocessed are handled concurrently. Facets generated on the way are processed in the next round.
+            std::vector<Facet> currentFacets;
+            currentFacets.reserve(unprocessedFacets.size());
+            while (!unprocessedFacets.empty()) {
+                currentFacets.push_back(std::move(unprocessedFacets.front()));
+                unprocessedFacets.pop();
+            }
+            storm::utility::parallel::forEachChunk(0, currentFacets.size(), 1, numberOfThreads,
+                                                   [&](uint64_t threadIndex, uint64_t first, uint64_t last) {
+                                                       for (uint64_t facetIndex = first; facetIndex < last; ++facetIndex) {
+                                                           processFacet(env, currentFacets[facetIndex], *lpCheckers[threadIndex]);
+                                                       }
+                                                   });
+        } else {
+            Facet f = std::move(unprocessedFacets.front());
+            unprocessedFacets.pop();
+            processFacet(env, f, *lpCheckers.front());
+        }
+    }
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::processFacet(
+    Environment const& env, Facet& f, DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& lpChecker) {
     if (!wvChecker) {
-        lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
+        lpChecker.setCurrentWeightVector(env, f.getHalfspace().normalVector());
     }
 
-    if (optimizeAndSplitFacet(env, f)) {
+    if (optimizeAndSplitFacet(env, f, lpChecker)) {
         return;
     }
 
+    std::unique_lock<std::mutex> lock(explorationMutex);
     storm::storage::geometry::PolytopeTree<GeometryValueType> polytopeTree(f.getInducedPolytope(pointset, getReferenceCoordinates(env)));
     for (auto const& point : pointset) {
         polytopeTree.substractDownwardClosure(point.second.get(), eps);
@@ -578,10 +615,12 @@ void DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::proc
         }
     }
     if (!polytopeTree.isEmpty()) {
+        lock.unlock();
         if (wvChecker) {
-            lpChecker->setCurrentWeightVector(env, f.getHalfspace().normalVector());
+            lpChecker.setCurrentWeightVector(env, f.getHalfspace().normalVector());
         }
-        auto res = lpChecker->check(env, polytopeTree, eps);
+        auto res = lpChecker.check(env, polytopeTree, eps);
+        lock.lock();
         for (auto const& infeasableArea : res.second) {
             addUnachievableArea(env, infeasableArea);
         }
@@ -602,24 +641,30 @@ bool closePoints(std::vector<GeometryValueType> const& first, std::vector<Geomet
 }
 
 template<class SparseModelType, typename GeometryValueType>
-bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(Environment const& env, Facet& f) {
+bool DeterministicSchedsParetoExplorer<SparseModelType, GeometryValueType>::optimizeAndSplitFacet(
+    Environment const& env, Facet& f, DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& lpChecker) {
     // Invoke optimization and insert the explored points
     boost::optional<PointId> optPointId;
     std::vector<GeometryValueType> point;
     if (wvChecker) {
+        std::lock_guard<std::mutex> wvCheckerLock(wvCheckerMutex);
         wvChecker->check(env, storm::utility::vector::convertNumericVector<ModelValueType>(f.getHalfspace().normalVector()));
         point = storm::utility::vector::convertNumericVector<GeometryValueType>(wvChecker->getUnderApproximationOfInitialStateResults());
         negateMinObjectives(point);
     } else {
+        std::unique_lock<std::mutex> lock(explorationMutex);
         auto currentArea = overApproximation->intersection(f.getHalfspace().invert());
-        auto optionalPoint = lpChecker->check(env, currentArea);
+        lock.unlock();
+        auto optionalPoint = lpChecker.check(env, currentArea);
         if (optionalPoint.is_initialized()) {
             point = std::move(optionalPoint.get());
         } else {
             // As we did not find any feasable solution in the given area, we take a point that lies on the facet
+            lock.lock();
             point = pointset.getPoint(f.getPoints().front()).get();
         }
     }
+    std::lock_guard<std::mutex> lock(explorationMutex);
     Point p(point);
     p.setOnFacet();
     GeometryValueType offset = storm::utility::vector::dotProduct(f.getHalfspace().normalVector(), p.get());
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <queue>
 
 #include "storm/modelchecker/multiobjective/deterministicScheds/DeterministicSchedsLpChecker.h"
@@ -149,9 +150,17 @@ class DeterministicSchedsParetoExplorer {
     std::vector<GeometryValueType> getReferenceCoordinates(Environment const& env) const;
 
     /*!
-     * Processes the given facet
+     * Processes all unprocessed facets (including the ones that are generated on the way).
+     * Facets that are unprocessed at the same time do not depend on each other and are processed concurrently if multiple threads are requested.
      */
-    void processFacet(Environment const& env, Facet& f);
+    void processFacets(Environment const& env);
+
+    /*!
+     * Processes the given facet using the given LP checker.
+     * Accesses to the pointset, the approximations and the unprocessed facets are guarded by the exploration mutex, so different facets can be processed
+     * concurrently as long as they use different LP checkers.
+     */
+    void processFacet(Environment const& env, Facet& f, DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& lpChecker);
 
     /*!
      * Optimizes in the facet direction. If this results in a point that does not lie on the facet,
@@ -159,7 +168,7 @@ class DeterministicSchedsParetoExplorer {
      * 2. New facets are generated and (if not already precise enough) added to unprocessedFacets
      * 3. true is returned
      */
-    bool optimizeAndSplitFacet(Environment const& env, Facet& f);
+    bool optimizeAndSplitFacet(Environment const& env, Facet& f, DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>& lpChecker);
 
     Polytope negateMinObjectives(Polytope const& polytope) const;
     void negateMinObjectives(std::vector<GeometryValueType>& vector) const;
@@ -169,8 +178,11 @@ class DeterministicSchedsParetoExplorer {
     Polytope overApproximation;
     std::vector<Polytope> unachievableAreas;
     std::vector<GeometryValueType> eps;
-    std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>> lpChecker;
+    // One LP checker (with its own LP model) per thread. The first one is also used for the initial facets.
+    std::vector<std::shared_ptr<DeterministicSchedsLpChecker<SparseModelType, GeometryValueType>>> lpCheckers;
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> wvChecker;
+    std::mutex explorationMutex;
+    std::mutex wvCheckerMutex;
     std::vector<DeterministicSchedsObjectiveHelper<SparseModelType>> objectiveHelper;
 
     std::shared_ptr<SparseModelType> const& model;
@@ -141,11 +141,11 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
     swEpochModelBuild.stop();
     swEpochModelAnalysis.start();
     std::vector<typename helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, false>::SolutionType> result;
-    result.reserve(epochModel.epochInStates.getNumberOfSetBits());
+    result.reserve(epochModel.structure->epochInStates.getNumberOfSetBits());
     uint64_t solutionSize = this->objectives.size() + 1;
 
     // If the epoch matrix is empty we do not need to solve linear equation systems
-    if (epochModel.epochMatrix.getEntryCount() == 0) {
+    if (epochModel.structure->epochMatrix.getEntryCount() == 0) {
         std::vector<ValueType> weights = weightVector;
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
             if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -154,20 +154,20 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
         }
 
         auto stepSolutionIt = epochModel.stepSolutions.begin();
-        auto stepChoiceIt = epochModel.stepChoices.begin();
-        for (auto state : epochModel.epochInStates) {
+        auto stepChoiceIt = epochModel.structure->stepChoices.begin();
+        for (auto state : epochModel.structure->epochInStates) {
             // Obtain the best choice for this state according to the weighted combination of objectives
             ValueType bestValue;
             uint64_t bestChoice = std::numeric_limits<uint64_t>::max();
             auto bestChoiceStepSolutionIt = epochModel.stepSolutions.end();
-            uint64_t lastChoice = epochModel.epochMatrix.getRowGroupIndices()[state + 1];
+            uint64_t lastChoice = epochModel.structure->epochMatrix.getRowGroupIndices()[state + 1];
             bool firstChoice = true;
-            for (uint64_t choice = epochModel.epochMatrix.getRowGroupIndices()[state]; choice < lastChoice; ++choice) {
+            for (uint64_t choice = epochModel.structure->epochMatrix.getRowGroupIndices()[state]; choice < lastChoice; ++choice) {
                 ValueType choiceValue = storm::utility::zero<ValueType>();
                 // Obtain the (weighted) objective rewards
                 for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (epochModel.objectiveRewardFilter[objIndex].get(choice)) {
-                        choiceValue += weights[objIndex] * epochModel.objectiveRewards[objIndex][choice];
+                        choiceValue += weights[objIndex] * epochModel.structure->objectiveRewards[objIndex][choice];
                     }
                 }
 
@@ -200,7 +200,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             if (bestChoiceStepSolutionIt != epochModel.stepSolutions.end()) {
                 for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (epochModel.objectiveRewardFilter[objIndex].get(bestChoice)) {
-                        result.back().push_back((epochModel.objectiveRewards[objIndex][bestChoice] + (*bestChoiceStepSolutionIt)[objIndex + 1]));
+                        result.back().push_back((epochModel.structure->objectiveRewards[objIndex][bestChoice] + (*bestChoiceStepSolutionIt)[objIndex + 1]));
                     } else {
                         result.back().push_back((*bestChoiceStepSolutionIt)[objIndex + 1]);
                     }
@@ -208,7 +208,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             } else {
                 for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (epochModel.objectiveRewardFilter[objIndex].get(bestChoice)) {
-                        result.back().push_back((epochModel.objectiveRewards[objIndex][bestChoice]));
+                        result.back().push_back((epochModel.structure->objectiveRewards[objIndex][bestChoice]));
                     } else {
                         result.back().push_back(storm::utility::zero<ValueType>());
                     }
@@ -219,28 +219,28 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
         updateCachedData(env, epochModel, cachedData, weightVector);
 
         // Formulate a min-max equation system max(A*x+b)=x for the weighted sum of the objectives
-        assert(cachedData.bMinMax.capacity() >= epochModel.epochMatrix.getRowCount());
-        assert(cachedData.xMinMax.size() == epochModel.epochMatrix.getRowGroupCount());
-        cachedData.bMinMax.assign(epochModel.epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
+        assert(cachedData.bMinMax.capacity() >= epochModel.structure->epochMatrix.getRowCount());
+        assert(cachedData.xMinMax.size() == epochModel.structure->epochMatrix.getRowGroupCount());
+        cachedData.bMinMax.assign(epochModel.structure->epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
             ValueType weight =
                 storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType()) ? -weightVector[objIndex] : weightVector[objIndex];
             if (!storm::utility::isZero(weight)) {
-                std::vector<ValueType> const& objectiveReward = epochModel.objectiveRewards[objIndex];
+                std::vector<ValueType> const& objectiveReward = epochModel.structure->objectiveRewards[objIndex];
                 for (auto choice : epochModel.objectiveRewardFilter[objIndex]) {
                     cachedData.bMinMax[choice] += weight * objectiveReward[choice];
                 }
             }
         }
         auto stepSolutionIt = epochModel.stepSolutions.begin();
-        for (auto choice : epochModel.stepChoices) {
+        for (auto choice : epochModel.structure->stepChoices) {
             cachedData.bMinMax[choice] += stepSolutionIt->front();
             ++stepSolutionIt;
         }
 
         // Invoke the min max solver
         cachedData.minMaxSolver->solveEquations(env, cachedData.xMinMax, cachedData.bMinMax);
-        for (auto state : epochModel.epochInStates) {
+        for (auto state : epochModel.structure->epochInStates) {
             result.emplace_back();
             result.back().reserve(solutionSize);
             result.back().push_back(cachedData.xMinMax[state]);
@@ -254,7 +254,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             cachedData.schedulerChoices = choices;
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linEqSolverFactory;
             bool needEquationSystem = linEqSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> subMatrix = epochModel.epochMatrix.selectRowsFromRowGroups(choices, needEquationSystem);
+            storm::storage::SparseMatrix<ValueType> subMatrix = epochModel.structure->epochMatrix.selectRowsFromRowGroups(choices, needEquationSystem);
             if (needEquationSystem) {
                 subMatrix.convertToEquationSystem();
             }
@@ -262,18 +262,18 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
             cachedData.linEqSolver->setCachingEnabled(true);
         }
 
-        // Formulate for each objective the linear equation system induced by the performed choices
-        assert(cachedData.bLinEq.size() == choices.size());
+        // Formulate for each objective the linear equation system induced by the performed choices. The systems only differ in their right-hand sides.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            auto const& obj = this->objectives[objIndex];
-            std::vector<ValueType> const& objectiveReward = epochModel.objectiveRewards[objIndex];
-            auto rowGroupIndexIt = epochModel.epochMatrix.getRowGroupIndices().begin();
+            std::vector<ValueType> const& objectiveReward = epochModel.structure->objectiveRewards[objIndex];
+            auto rowGroupIndexIt = epochModel.structure->epochMatrix.getRowGroupIndices().begin();
             auto choiceIt = choices.begin();
-            auto stepChoiceIt = epochModel.stepChoices.begin();
+            auto stepChoiceIt = epochModel.structure->stepChoices.begin();
             auto stepSolutionIt = epochModel.stepSolutions.begin();
             std::vector<ValueType>& x = cachedData.xLinEq[objIndex];
+            std::vector<ValueType>& b = cachedData.bLinEq[objIndex];
+            assert(b.size() == choices.size());
             auto xIt = x.begin();
-            for (auto& b_i : cachedData.bLinEq) {
+            for (auto& b_i : b) {
                 uint64_t i = *rowGroupIndexIt + *choiceIt;
                 if (epochModel.objectiveRewardFilter[objIndex].get(i)) {
                     b_i = objectiveReward[i];
@@ -291,7 +291,7 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 }
                 // We can already set x_i correctly if row i is empty.
                 // Appearingly, some linear equation solvers struggle to converge otherwise.
-                if (epochModel.epochMatrix.getRow(i).getNumberOfEntries() == 0) {
+                if (epochModel.structure->epochMatrix.getRow(i).getNumberOfEntries() == 0) {
                     *xIt = b_i;
                 }
                 ++xIt;
@@ -299,22 +299,38 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::computeEpochSo
                 ++choiceIt;
             }
             assert(x.size() == choices.size());
-            auto req = cachedData.linEqSolver->getRequirements(env);
-            cachedData.linEqSolver->clearBounds();
-            if (obj.lowerResultBound) {
-                req.clearLowerBounds();
-                cachedData.linEqSolver->setLowerBound(*obj.lowerResultBound);
-            }
-            if (obj.upperResultBound) {
-                cachedData.linEqSolver->setUpperBound(*obj.upperResultBound);
-                req.clearUpperBounds();
-            }
+        }
+
+        auto req = cachedData.linEqSolver->getRequirements(env);
+        cachedData.linEqSolver->clearBounds();
+        if (!req.lowerBounds() && !req.upperBounds()) {
+            // As no (objective specific) bounds are required, the systems of all objectives are solved at once.
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            cachedData.linEqSolver->solveEquations(env, x, cachedData.bLinEq);
+            cachedData.linEqSolver->solveEquationsBatch(env, cachedData.xLinEq, cachedData.bLinEq);
+        } else {
+            for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+                auto const& obj = this->objectives[objIndex];
+                auto objReq = req;
+                cachedData.linEqSolver->clearBounds();
+                if (obj.lowerResultBound) {
+                    objReq.clearLowerBounds();
+                    cachedData.linEqSolver->setLowerBound(*obj.lowerResultBound);
+                }
+                if (obj.upperResultBound) {
+                    cachedData.linEqSolver->setUpperBound(*obj.upperResultBound);
+                    objReq.clearUpperBounds();
+                }
+                STORM_LOG_THROW(!objReq.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                                "Solver requirements " + objReq.getEnabledRequirementsAsString() + " not checked.");
+                cachedData.linEqSolver->solveEquations(env, cachedData.xLinEq[objIndex], cachedData.bLinEq[objIndex]);
+            }
+        }
+
+        for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
             auto resultIt = result.begin();
-            for (auto state : epochModel.epochInStates) {
-                resultIt->push_back(x[state]);
+            for (auto state : epochModel.structure->epochInStates) {
+                resultIt->push_back(cachedData.xLinEq[objIndex][state]);
                 ++resultIt;
             }
         }
@@ -329,10 +345,10 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedDa
                                                                                    EpochCheckingData& cachedData, std::vector<ValueType> const& weightVector) {
     if (epochModel.epochMatrixChanged) {
         // Update the cached MinMaxSolver data
-        cachedData.bMinMax.resize(epochModel.epochMatrix.getRowCount());
-        cachedData.xMinMax.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        cachedData.bMinMax.resize(epochModel.structure->epochMatrix.getRowCount());
+        cachedData.xMinMax.assign(epochModel.structure->epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
         storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxSolverFactory;
-        cachedData.minMaxSolver = minMaxSolverFactory.create(env, epochModel.epochMatrix);
+        cachedData.minMaxSolver = minMaxSolverFactory.create(env, epochModel.structure->epochMatrix);
         cachedData.minMaxSolver->setHasUniqueSolution();
         cachedData.minMaxSolver->setHasNoEndComponents();
         cachedData.minMaxSolver->setTrackScheduler(true);
@@ -355,13 +371,16 @@ void RewardBoundedMdpPcaaWeightVectorChecker<SparseMdpModelType>::updateCachedDa
 
         // Clear the scheduler choices so that an update of the linEqSolver is enforced
         cachedData.schedulerChoices.clear();
-        cachedData.schedulerChoices.reserve(epochModel.epochMatrix.getRowGroupCount());
+        cachedData.schedulerChoices.reserve(epochModel.structure->epochMatrix.getRowGroupCount());
 
         // Update data for linear equation solving
-        cachedData.bLinEq.resize(epochModel.epochMatrix.getRowGroupCount());
+        cachedData.bLinEq.resize(this->objectives.size());
+        for (auto& b_o : cachedData.bLinEq) {
+            b_o.resize(epochModel.structure->epochMatrix.getRowGroupCount());
+        }
         cachedData.xLinEq.resize(this->objectives.size());
         for (auto& x_o : cachedData.xLinEq) {
-            x_o.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+            x_o.assign(epochModel.structure->epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
         }
     }
 }
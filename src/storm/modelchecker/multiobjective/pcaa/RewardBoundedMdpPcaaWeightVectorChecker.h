@@ -53,7 +53,7 @@ class RewardBoundedMdpPcaaWeightVectorChecker : public PcaaWeightVectorChecker<S
 
         std::vector<uint64_t> schedulerChoices;
 
-        std::vector<ValueType> bLinEq;
+        std::vector<std::vector<ValueType>> bLinEq;
         std::vector<std::vector<ValueType>> xLinEq;
         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
 
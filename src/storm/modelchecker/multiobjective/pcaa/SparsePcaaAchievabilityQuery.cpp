@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaAchievabilityQuery.h"
 
+#include <boost/optional.hpp>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
@@ -57,9 +59,9 @@ template<class SparseModelType, typename GeometryValueType>
 bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchievability(Environment const& env) {
     // repeatedly refine the over/ under approximation until the threshold point is either in the under approx. or not in the over approx.
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        WeightVector separatingVector = this->findSeparatingVector(thresholds);
-        this->updateWeightedPrecision(separatingVector);
-        this->performRefinementStep(env, std::move(separatingVector));
+        std::vector<WeightVector> separatingVectors = this->findSeparatingVectors(thresholds, this->getNumberOfRefinementStepsPerRound(env));
+        this->updateWeightedPrecision(separatingVectors);
+        this->performRefinementSteps(env, std::move(separatingVectors));
         if (!checkIfThresholdsAreSatisfied(this->overApproximation)) {
             return false;
         }
@@ -72,22 +74,31 @@ bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchi
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWeightedPrecision(WeightVector const& weights) {
-    // Our heuristic considers the distance between the under- and the over approximation w.r.t. the given direction
-    std::pair<Point, bool> optimizationResOverApprox = this->overApproximation->optimize(weights);
-    if (optimizationResOverApprox.second) {
-        std::pair<Point, bool> optimizationResUnderApprox = this->underApproximation->optimize(weights);
-        if (optimizationResUnderApprox.second) {
-            GeometryValueType distance = storm::utility::vector::dotProduct(optimizationResOverApprox.first, weights) -
-                                         storm::utility::vector::dotProduct(optimizationResUnderApprox.first, weights);
-            STORM_LOG_ASSERT(distance >= storm::utility::zero<GeometryValueType>(), "Negative distance between under- and over approximation was not expected");
-            // Normalize the distance by dividing it with the Euclidean Norm of the weight-vector
-            distance /= storm::utility::sqrt(storm::utility::vector::dotProduct(weights, weights));
-            distance /= GeometryValueType(2);
-            this->weightVectorChecker->setWeightedPrecision(storm::utility::convertNumber<typename SparseModelType::ValueType>(distance));
+void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWeightedPrecision(std::vector<WeightVector> const& weightVectors) {
+    // Our heuristic considers the distance between the under- and the over approximation w.r.t. the given directions
+    boost::optional<GeometryValueType> minimalDistance;
+    for (auto const& weights : weightVectors) {
+        std::pair<Point, bool> optimizationResOverApprox = this->overApproximation->optimize(weights);
+        if (optimizationResOverApprox.second) {
+            std::pair<Point, bool> optimizationResUnderApprox = this->underApproximation->optimize(weights);
+            if (optimizationResUnderApprox.second) {
+                GeometryValueType distance = storm::utility::vector::dotProduct(optimizationResOverApprox.first, weights) -
+                                             storm::utility::vector::dotProduct(optimizationResUnderApprox.first, weights);
+                STORM_LOG_ASSERT(distance >= storm::utility::zero<GeometryValueType>(),
+                                 "Negative distance between under- and over approximation was not expected");
+                // Normalize the distance by dividing it with the Euclidean Norm of the weight-vector
+                distance /= storm::utility::sqrt(storm::utility::vector::dotProduct(weights, weights));
+                distance /= GeometryValueType(2);
+                if (!minimalDistance || distance < minimalDistance.get()) {
+                    minimalDistance = distance;
+                }
+            }
         }
     }
-    // do not update the precision if one of the approximations is unbounded in the provided direction
+    // do not update the precision if one of the approximations is unbounded in all provided directions
+    if (minimalDistance) {
+        this->weightVectorChecker->setWeightedPrecision(storm::utility::convertNumber<typename SparseModelType::ValueType>(minimalDistance.get()));
+    }
 }
 
 template<class SparseModelType, typename GeometryValueType>
@@ -40,9 +40,9 @@ class SparsePcaaAchievabilityQuery : public SparsePcaaQuery<SparseModelType, Geo
     bool checkAchievability(Environment const& env);
 
     /*
-     * Updates the precision of the weightVectorChecker w.r.t. the provided weights
+     * Updates the precision of the weightVectorChecker w.r.t. the provided weight vectors (that are checked in the next round)
      */
-    void updateWeightedPrecision(WeightVector const& weights);
+    void updateWeightedPrecision(std::vector<WeightVector> const& weightVectors);
 
     /*
      * Returns true iff there is one point in the given polytope that satisfies the given thresholds.
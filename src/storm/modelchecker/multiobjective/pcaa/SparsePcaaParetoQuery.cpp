@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -63,38 +65,51 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
     STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute,
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
-    // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    // First consider the objectives individually. Several objectives are considered at once if weight vectors can be checked in parallel.
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        uint64_t numberOfDirections = this->getNumberOfRefinementStepsPerRound(env);
+        std::vector<WeightVector> directions;
+        for (; directions.size() < numberOfDirections && objIndex < this->objectives.size(); ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
+    GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        // For each halfspace, its index and the maximal distance to a vertex of the overApproximation
+        std::vector<std::pair<uint_fast64_t, GeometryValueType>> halfspaceDistances;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (farestDistance > storm::utility::zero<GeometryValueType>()) {
+                halfspaceDistances.emplace_back(halfspaceIndex, std::move(farestDistance));
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        // Ties are broken by the index of the halfspace
+        std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [](auto const& lhs, auto const& rhs) { return lhs.second > rhs.second; });
+        if (halfspaceDistances.empty() || halfspaceDistances.front().second < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().second));
+
+        // Refine in the directions of the halfspaces that are not yet precise enough
+        uint64_t numberOfDirections = std::min<uint64_t>(this->getNumberOfRefinementStepsPerRound(env), halfspaceDistances.size());
+        std::vector<WeightVector> directions;
+        for (uint64_t i = 0; i < numberOfDirections && halfspaceDistances[i].second >= precision; ++i) {
+            directions.push_back(underApproxHalfspaces[halfspaceDistances[i].first].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,9 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -12,6 +16,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,7 +34,10 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
@@ -40,78 +48,140 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessi
 template<class SparseModelType, typename GeometryValueType>
 typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVector(
     Point const& pointToBeSeparated) {
+    return findSeparatingVectors(pointToBeSeparated, 1).front();
+}
+
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    STORM_LOG_ASSERT(maxNumberOfVectors > 0, "Requested no separating vector.");
     STORM_LOG_DEBUG("Searching a weight vector to seperate the point given by "
                     << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
 
+    std::vector<WeightVector> result;
     if (underApproximation->isEmpty()) {
         // In this case, every weight vector is separating
-        uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
-        WeightVector result(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
-        result[objIndex] = storm::utility::one<GeometryValueType>();
-        diracWeightVectorsToBeChecked.set(objIndex, false);
+        do {
+            uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
+            result.emplace_back(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+            result.back()[objIndex] = storm::utility::one<GeometryValueType>();
+            diracWeightVectorsToBeChecked.set(objIndex, false);
+        } while (result.size() < maxNumberOfVectors && !diracWeightVectorsToBeChecked.empty());
         return result;
     }
 
     // Reaching this point means that the underApproximation contains halfspaces. The seperating vector has to be the normal vector of one of these halfspaces.
-    // We pick one with maximal distance to the given point. However, Dirac weight vectors that only assign a non-zero weight to a single objective take
-    // precedence.
+    // We prefer the ones with maximal distance to the given point. However, Dirac weight vectors that only assign a non-zero weight to a single objective
+    // take precedence.
     STORM_LOG_ASSERT(!underApproximation->contains(pointToBeSeparated),
                      "Tried to find a separating point but the point is already contained in the underApproximation");
     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
-    uint_fast64_t farestHalfspaceIndex = halfspaces.size();
-    GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
-    bool foundSeparatingDiracVector = false;
+    // The separating halfspaces as (index, is dirac vector, distance)
+    std::vector<std::tuple<uint_fast64_t, bool, GeometryValueType>> candidates;
     for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
         GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
         if (!storm::utility::isZero(distance)) {
             storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
             bool isSingleObjectiveVector =
                 nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
-            // Check if this halfspace is a better candidate than the current one
-            if ((!foundSeparatingDiracVector && isSingleObjectiveVector) ||
-                (foundSeparatingDiracVector == isSingleObjectiveVector && distance > farestDistance)) {
-                foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
-                farestHalfspaceIndex = halfspaceIndex;
-                farestDistance = distance;
-            }
+            candidates.emplace_back(halfspaceIndex, isSingleObjectiveVector, std::move(distance));
         }
     }
-    if (foundSeparatingDiracVector) {
-        diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
+    STORM_LOG_THROW(!candidates.empty(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
+    // Ties are broken by the index of the halfspace
+    std::stable_sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) {
+        if (std::get<1>(lhs) != std::get<1>(rhs)) {
+            return std::get<1>(lhs);
+        }
+        return std::get<2>(lhs) > std::get<2>(rhs);
+    });
+    candidates.resize(std::min<uint64_t>(candidates.size(), maxNumberOfVectors));
+    for (auto const& candidate : candidates) {
+        if (std::get<1>(candidate)) {
+            diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[std::get<0>(candidate)].normalVector());
+        }
+        STORM_LOG_DEBUG("Found separating weight vector: "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[std::get<0>(candidate)].normalVector()))
+                        << ".");
+        result.push_back(halfspaces[std::get<0>(candidate)].normalVector());
     }
-
-    STORM_LOG_THROW(farestHalfspaceIndex < halfspaces.size(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
-    STORM_LOG_DEBUG("Found separating weight vector: "
-                    << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[farestHalfspaceIndex].normalVector()))
-                    << ".");
-    return halfspaces[farestHalfspaceIndex].normalVector();
+    return result;
 }
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    typedef typename SparseModelType::ValueType ValueType;
+    // Normalize the direction vectors so that the entries sum up to one
+    // The conversions of the (exact) geometry values are done here as they are not necessarily thread safe.
+    std::vector<std::vector<ValueType>> weightVectors;
+    for (auto& direction : directions) {
+        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(),
+                                                                                                                        storm::utility::zero<GeometryValueType>()));
+        weightVectors.push_back(storm::utility::vector::convertNumericVector<ValueType>(direction));
+    }
+
+    std::vector<std::vector<ValueType>> lowerBoundPoints(directions.size()), upperBoundPoints(directions.size());
+    auto checkWeightVector = [&](PcaaWeightVectorChecker<SparseModelType>& checker, uint64_t index) {
+        checker.check(env, weightVectors[index]);
+        lowerBoundPoints[index] = checker.getUnderApproximationOfInitialStateResults();
+        upperBoundPoints[index] = checker.getOverApproximationOfInitialStateResults();
+    };
+    if (directions.size() == 1) {
+        checkWeightVector(*weightVectorChecker, 0);
+    } else {
+        while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+            additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+        }
+        for (auto& checker : additionalWeightVectorCheckers) {
+            checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
         }
+        storm::utility::parallel::forEachChunk(0, directions.size(), 1, directions.size(), [&](uint64_t, uint64_t index, uint64_t) {
+            checkWeightVector(index == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[index - 1], index);
+        });
     }
-    refinementSteps.push_back(std::move(step));
 
-    updateOverApproximation();
+    for (uint64_t index = 0; index < directions.size(); ++index) {
+        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(lowerBoundPoints[index])));
+        RefinementStep step;
+        step.weightVector = std::move(directions[index]);
+        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(lowerBoundPoints[index]);
+        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(upperBoundPoints[index]);
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
+        }
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
     updateUnderApproximation();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getNumberOfRefinementStepsPerRound(Environment const& env) const {
+    uint64_t result = 1;
+    // Weight vectors are only checked in parallel for floating point models. Checkers for reward bounded objectives are not considered as they
+    // maintain large (cached) unfoldings.
+    if (std::is_same<typename SparseModelType::ValueType, double>::value && preprocessorResult.containsOnlyTrivialObjectives()) {
+        result = std::max<uint64_t>(1, storm::utility::parallel::getDefaultNumberOfThreads());
+    }
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 1);
+    }
+    return result;
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
     storm::storage::geometry::Halfspace<GeometryValueType> h(
@@ -63,11 +63,29 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns (at most) the given number of weight vectors that separate the under approximation from the given point.
+     * The vectors are ordered by preference as in findSeparatingVector, i.e., the first one coincides with the result of findSeparatingVector.
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. each of the given direction vectors.
+     * If there are multiple directions, they are checked in parallel, each with its own weight vector checker.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of refinement steps that should be performed in the next round, i.e., the number of weight vectors that can be checked in parallel
+     * (without exceeding the maximum number of refinement steps).
+     */
+    uint64_t getNumberOfRefinementStepsPerRound(Environment const& env) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -94,6 +112,10 @@ class SparsePcaaQuery {
 
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+    // Further weight vector checkers (created on demand) that are used to check multiple weight vectors in parallel
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    // The preprocessed query. Required to create further weight vector checkers
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
 
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
@@ -101,25 +101,40 @@ StandardMaPcaaWeightVectorChecker<SparseMdpModelType>::createDetInfiniteHorizonH
 template<class SparseMaModelType>
 void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::boundedPhase(Environment const& env, std::vector<ValueType> const& weightVector,
                                                                         std::vector<ValueType>& weightedRewardVector) {
-    // Split the preprocessed model into transitions from/to probabilistic/Markovian states.
-    SubModel MS = createSubModel(true, weightedRewardVector);
-    SubModel PS = createSubModel(false, weightedRewardVector);
-
-    // Apply digitization to Markovian transitions
     ValueType digitizationConstant = getDigitizationConstant(weightVector);
-    digitize(MS, digitizationConstant);
+    if (!boundedPhaseData || boundedPhaseData->digitizationConstant != digitizationConstant) {
+        boundedPhaseData = std::make_unique<BoundedPhaseData>();
+        boundedPhaseData->digitizationConstant = digitizationConstant;
+
+        // Split the preprocessed model into transitions from/to probabilistic/Markovian states.
+        boundedPhaseData->MS = createSubModel(true);
+        boundedPhaseData->PS = createSubModel(false);
+
+        // Apply digitization to Markovian transitions
+        digitize(boundedPhaseData->MS, digitizationConstant);
+
+        // Check whether there is a cycle in of probabilistic states
+        boundedPhaseData->acyclic = !storm::utility::graph::hasCycle(boundedPhaseData->PS.toPS);
+
+        // Initialize a minMaxSolver to compute an optimal scheduler (w.r.t. PS) for each epoch. As only the right-hand side changes, the solver is
+        // reused for all epochs (and all weight vectors with this digitization constant).
+        // No EC elimination is necessary as we assume non-zenoness
+        boundedPhaseData->minMax = initMinMaxSolver(env, boundedPhaseData->PS, boundedPhaseData->acyclic);
+    } else {
+        STORM_LOG_DEBUG("Reusing the digitized model for digitization constant " << digitizationConstant << ".");
+    }
+    SubModel& MS = boundedPhaseData->MS;
+    SubModel& PS = boundedPhaseData->PS;
+    bool acyclic = boundedPhaseData->acyclic;
+    MinMaxSolverData* minMax = boundedPhaseData->minMax.get();
+    initializeSubModelValues(MS, weightedRewardVector);
+    initializeSubModelValues(PS, weightedRewardVector);
+    prepareMinMaxSolver(*minMax, acyclic, weightVector);
 
     // Get for each occurring (digitized) timeBound the indices of the objectives with that bound.
     TimeBoundMap upperTimeBounds;
     digitizeTimeBounds(upperTimeBounds, digitizationConstant);
 
-    // Check whether there is a cycle in of probabilistic states
-    bool acyclic = !storm::utility::graph::hasCycle(PS.toPS);
-
-    // Initialize a minMaxSolver to compute an optimal scheduler (w.r.t. PS) for each epoch
-    // No EC elimination is necessary as we assume non-zenoness
-    std::unique_ptr<MinMaxSolverData> minMax = initMinMaxSolver(env, PS, acyclic, weightVector);
-
     // create a linear equation solver for the model induced by the optimal choice vector.
     // the solver will be updated whenever the optimal choice vector has changed.
     std::unique_ptr<LinEqSolverData> linEq = initLinEqSolver(env, PS, acyclic);
@@ -161,7 +176,7 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::boundedPhase(Environm
 
 template<class SparseMaModelType>
 typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::SubModel StandardMaPcaaWeightVectorChecker<SparseMaModelType>::createSubModel(
-    bool createMS, std::vector<ValueType> const& weightedRewardVector) const {
+    bool createMS) const {
     SubModel result;
 
     storm::storage::BitVector probabilisticStates = ~markovianStates;
@@ -180,8 +195,6 @@ typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::SubModel Standard
                          result.getNumberOfChoices() == result.toPS.getRowCount(),
                      "Invalid choice count for subsystem");
 
-    result.weightedRewardVector.resize(result.getNumberOfChoices());
-    storm::utility::vector::selectVectorValues(result.weightedRewardVector, result.choices, weightedRewardVector);
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         std::vector<ValueType> const& objRewards = this->actionRewards[objIndex];
         std::vector<ValueType> subModelObjRewards;
@@ -192,19 +205,29 @@ typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::SubModel Standard
         result.objectiveRewardVectors.push_back(std::move(subModelObjRewards));
     }
 
-    result.weightedSolutionVector.resize(result.getNumberOfStates());
-    storm::utility::vector::selectVectorValues(result.weightedSolutionVector, result.states, this->weightedResult);
-    result.objectiveSolutionVectors.resize(this->objectives.size());
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        result.objectiveSolutionVectors[objIndex].resize(result.weightedSolutionVector.size());
-        storm::utility::vector::selectVectorValues(result.objectiveSolutionVectors[objIndex], result.states, this->objectiveResults[objIndex]);
-    }
-
     result.auxChoiceValues.resize(result.getNumberOfChoices());
 
     return result;
 }
 
+template<class SparseMaModelType>
+void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initializeSubModelValues(SubModel& subModel,
+                                                                                    std::vector<ValueType> const& weightedRewardVector) const {
+    subModel.weightedRewardVector.resize(subModel.getNumberOfChoices());
+    storm::utility::vector::selectVectorValues(subModel.weightedRewardVector, subModel.choices, weightedRewardVector);
+    if (!subModel.digitizationFactors.empty()) {
+        storm::utility::vector::multiplyVectorsPointwise(subModel.weightedRewardVector, subModel.digitizationFactors, subModel.weightedRewardVector);
+    }
+
+    subModel.weightedSolutionVector.resize(subModel.getNumberOfStates());
+    storm::utility::vector::selectVectorValues(subModel.weightedSolutionVector, subModel.states, this->weightedResult);
+    subModel.objectiveSolutionVectors.resize(this->objectives.size());
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+        subModel.objectiveSolutionVectors[objIndex].resize(subModel.weightedSolutionVector.size());
+        storm::utility::vector::selectVectorValues(subModel.objectiveSolutionVectors[objIndex], subModel.states, this->objectiveResults[objIndex]);
+    }
+}
+
 template<class SparseMaModelType>
 template<typename VT, typename std::enable_if<storm::NumberTraits<VT>::SupportsExponential, int>::type>
 VT StandardMaPcaaWeightVectorChecker<SparseMaModelType>::getDigitizationConstant(std::vector<ValueType> const& weightVector) const {
@@ -291,6 +314,7 @@ template<typename VT, typename std::enable_if<storm::NumberTraits<VT>::SupportsE
 void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::digitize(SubModel& MS, VT const& digitizationConstant) const {
     std::vector<VT> rateVector(MS.getNumberOfChoices());
     storm::utility::vector::selectVectorValues(rateVector, MS.states, exitRates);
+    MS.digitizationFactors.resize(rateVector.size());
     for (uint_fast64_t row = 0; row < rateVector.size(); ++row) {
         VT const eToMinusRateTimesDelta = std::exp(-rateVector[row] * digitizationConstant);
         for (auto& entry : MS.toMS.getRow(row)) {
@@ -302,7 +326,7 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::digitize(SubModel& MS
         for (auto& entry : MS.toPS.getRow(row)) {
             entry.setValue((storm::utility::one<VT>() - eToMinusRateTimesDelta) * entry.getValue());
         }
-        MS.weightedRewardVector[row] *= storm::utility::one<VT>() - eToMinusRateTimesDelta;
+        MS.digitizationFactors[row] = storm::utility::one<VT>() - eToMinusRateTimesDelta;
         for (auto& objVector : MS.objectiveRewardVectors) {
             objVector[row] *= storm::utility::one<VT>() - eToMinusRateTimesDelta;
         }
@@ -351,8 +375,7 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::digitizeTimeBounds(Ti
 
 template<class SparseMaModelType>
 std::unique_ptr<typename StandardMaPcaaWeightVectorChecker<SparseMaModelType>::MinMaxSolverData>
-StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initMinMaxSolver(Environment const& env, SubModel const& PS, bool acyclic,
-                                                                       std::vector<ValueType> const& weightVector) const {
+StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initMinMaxSolver(Environment const& env, SubModel const& PS, bool acyclic) const {
     std::unique_ptr<MinMaxSolverData> result(new MinMaxSolverData());
     result->env = std::make_unique<storm::Environment>(env);
     // For acyclic models we switch to the more efficient acyclic solver (Unless the solver / method was explicitly specified)
@@ -365,15 +388,28 @@ StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initMinMaxSolver(Environme
     result->solver->setHasNoEndComponents(true);  // Non-zeno MA
     result->solver->setTrackScheduler(true);
     result->solver->setCachingEnabled(true);
-    auto req = result->solver->getRequirements(*result->env, storm::solver::OptimizationDirection::Maximize, false);
+    result->solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
+
+    result->b.resize(PS.getNumberOfChoices());
+
+    return result;
+}
+
+template<class SparseMaModelType>
+void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::prepareMinMaxSolver(MinMaxSolverData& minMax, bool acyclic,
+                                                                               std::vector<ValueType> const& weightVector) const {
+    // The bounds depend on the weight vector, so data that the solver cached for previous bounds is dropped.
+    minMax.solver->clearBounds();
+    minMax.solver->clearCache();
+    auto req = minMax.solver->getRequirements(*minMax.env, storm::solver::OptimizationDirection::Maximize, false);
     boost::optional<ValueType> lowerBound = this->computeWeightedResultBound(true, weightVector, storm::storage::BitVector(weightVector.size(), true));
     if (lowerBound) {
-        result->solver->setLowerBound(lowerBound.get());
+        minMax.solver->setLowerBound(lowerBound.get());
         req.clearLowerBounds();
     }
     boost::optional<ValueType> upperBound = this->computeWeightedResultBound(false, weightVector, storm::storage::BitVector(weightVector.size(), true));
     if (upperBound) {
-        result->solver->setUpperBound(upperBound.get());
+        minMax.solver->setUpperBound(upperBound.get());
         req.clearUpperBounds();
     }
     if (acyclic) {
@@ -381,12 +417,7 @@ StandardMaPcaaWeightVectorChecker<SparseMaModelType>::initMinMaxSolver(Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    result->solver->setRequirementsChecked(true);
-    result->solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
-
-    result->b.resize(PS.getNumberOfChoices());
-
-    return result;
+    minMax.solver->setRequirementsChecked(true);
 }
 
 template<class SparseMaModelType>
@@ -429,8 +460,7 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::updateDataToCurrentEp
     }
 
     // Update the solver data
-    PS.toMS.multiplyWithVector(MS.weightedSolutionVector, minMax.b);
-    storm::utility::vector::addVectors(minMax.b, PS.weightedRewardVector, minMax.b);
+    PS.toMS.multiplyWithVectorParallel(MS.weightedSolutionVector, minMax.b, &PS.weightedRewardVector);
 }
 
 template<class SparseMaModelType>
@@ -496,10 +526,10 @@ template<class SparseMaModelType>
 void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::performMSStep(Environment const& env, SubModel& MS, SubModel const& PS,
                                                                          storm::storage::BitVector const& consideredObjectives,
                                                                          std::vector<ValueType> const& weightVector) const {
-    MS.toMS.multiplyWithVector(MS.weightedSolutionVector, MS.auxChoiceValues);
-    storm::utility::vector::addVectors(MS.weightedRewardVector, MS.auxChoiceValues, MS.weightedSolutionVector);
-    MS.toPS.multiplyWithVector(PS.weightedSolutionVector, MS.auxChoiceValues);
-    storm::utility::vector::addVectors(MS.weightedSolutionVector, MS.auxChoiceValues, MS.weightedSolutionVector);
+    // The rows of the Markovian states are distributed over several threads (if available).
+    // Each step first computes rewards + toMS * x_MS and then adds toPS * x_PS.
+    MS.toMS.multiplyWithVectorParallel(MS.weightedSolutionVector, MS.auxChoiceValues, &MS.weightedRewardVector);
+    MS.toPS.multiplyWithVectorParallel(PS.weightedSolutionVector, MS.weightedSolutionVector, &MS.auxChoiceValues);
     if (consideredObjectives.getNumberOfSetBits() == 1 && storm::utility::isOne(weightVector[*consideredObjectives.begin()])) {
         // In this case there is no need to perform the computation on the individual objectives
         MS.objectiveSolutionVectors[*consideredObjectives.begin()] = MS.weightedSolutionVector;
@@ -508,10 +538,8 @@ void StandardMaPcaaWeightVectorChecker<SparseMaModelType>::performMSStep(Environ
         }
     } else {
         for (auto objIndex : consideredObjectives) {
-            MS.toMS.multiplyWithVector(MS.objectiveSolutionVectors[objIndex], MS.auxChoiceValues);
-            storm::utility::vector::addVectors(MS.objectiveRewardVectors[objIndex], MS.auxChoiceValues, MS.objectiveSolutionVectors[objIndex]);
-            MS.toPS.multiplyWithVector(PS.objectiveSolutionVectors[objIndex], MS.auxChoiceValues);
-            storm::utility::vector::addVectors(MS.objectiveSolutionVectors[objIndex], MS.auxChoiceValues, MS.objectiveSolutionVectors[objIndex]);
+            MS.toMS.multiplyWithVectorParallel(MS.objectiveSolutionVectors[objIndex], MS.auxChoiceValues, &MS.objectiveRewardVectors[objIndex]);
+            MS.toPS.multiplyWithVectorParallel(PS.objectiveSolutionVectors[objIndex], MS.objectiveSolutionVectors[objIndex], &MS.auxChoiceValues);
         }
     }
 }
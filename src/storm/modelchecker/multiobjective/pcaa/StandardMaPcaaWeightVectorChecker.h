@@ -59,6 +59,8 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
 
         std::vector<ValueType> auxChoiceValues;  // stores auxiliary values for every choice
 
+        std::vector<ValueType> digitizationFactors;  // for digitized sub models, the factor with which the reward of every choice is scaled
+
         uint_fast64_t getNumberOfStates() const {
             return toMS.getRowGroupCount();
         };
@@ -76,6 +78,18 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
         std::vector<ValueType> b;
     };
 
+    /*
+     * Stores the data of the bounded phase that does not depend on the weight vector, i.e., the sub models (where the Markovian one is digitized)
+     * and the solver for the probabilistic states. The data is reused for all weight vectors that yield the same digitization constant.
+     */
+    struct BoundedPhaseData {
+        ValueType digitizationConstant;
+        SubModel MS;
+        SubModel PS;
+        bool acyclic;
+        std::unique_ptr<MinMaxSolverData> minMax;
+    };
+
     struct LinEqSolverData {
         std::unique_ptr<Environment> env;
         bool acyclic;
@@ -96,7 +110,13 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
      * @param createMS if true, the submodel containing the Markovian states is created.
      *                 if false, the submodel containing the probabilistic states is created.
      */
-    SubModel createSubModel(bool createMS, std::vector<ValueType> const& weightedRewardVector) const;
+    SubModel createSubModel(bool createMS) const;
+
+    /*!
+     * Sets the weighted reward vector as well as the initial solution vectors of the given submodel for the current weight vector.
+     * @param weightedRewardVector the weighted rewards considering the unbounded objectives.
+     */
+    void initializeSubModelValues(SubModel& subModel, std::vector<ValueType> const& weightedRewardVector) const;
 
     /*!
      * Retrieves the delta used for digitization
@@ -108,6 +128,7 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
 
     /*!
      * Digitizes the given matrix and vectors w.r.t. the given digitization constant and the given rate vector.
+     * The factors with which the rewards are scaled are stored such that weighted reward vectors can be digitized later.
      */
     template<typename VT = ValueType, typename std::enable_if<storm::NumberTraits<VT>::SupportsExponential, int>::type = 0>
     void digitize(SubModel& subModel, VT const& digitizationConstant) const;
@@ -126,8 +147,12 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
     /*!
      * Initializes the data for the MinMax solver
      */
-    std::unique_ptr<MinMaxSolverData> initMinMaxSolver(Environment const& env, SubModel const& PS, bool acyclic,
-                                                       std::vector<ValueType> const& weightVector) const;
+    std::unique_ptr<MinMaxSolverData> initMinMaxSolver(Environment const& env, SubModel const& PS, bool acyclic) const;
+
+    /*!
+     * Sets the bounds of the MinMax solver for the given weight vector and checks the requirements of the solver.
+     */
+    void prepareMinMaxSolver(MinMaxSolverData& minMax, bool acyclic, std::vector<ValueType> const& weightVector) const;
 
     /*!
      * Initializes the data for the LinEq solver
@@ -169,6 +194,9 @@ class StandardMaPcaaWeightVectorChecker : public StandardPcaaWeightVectorChecker
     // Data regarding the given Markov automaton
     storm::storage::BitVector markovianStates;
     std::vector<ValueType> exitRates;
+
+    // The data of the last bounded phase
+    std::unique_ptr<BoundedPhaseData> boundedPhaseData;
 };
 
 }  // namespace multiobjective
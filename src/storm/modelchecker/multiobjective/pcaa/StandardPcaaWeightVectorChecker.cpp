@@ -478,12 +478,36 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
     } else {
         storm::storage::SparseMatrix<ValueType> deterministicMatrix = transitionMatrix.selectRowsFromRowGroups(this->optimalChoices, false);
         storm::storage::SparseMatrix<ValueType> deterministicBackwardTransitions = deterministicMatrix.transpose();
-        std::vector<ValueType> deterministicStateRewards(deterministicMatrix.getRowCount());  // allocate here
         storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+        bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
 
         auto infiniteHorizonHelper = createDetInfiniteHorizonHelper(deterministicMatrix);
         infiniteHorizonHelper.provideBackwardTransitions(deterministicBackwardTransitions);
 
+        // For each total reward objective, the rewards under the scheduler and the states from which a state with reward is reachable (the maybestates)
+        storm::storage::BitVector totalRewardObjectives = objectivesWithNoUpperTimeBound & ~lraObjectives;
+        std::vector<std::vector<ValueType>> deterministicStateRewards(this->objectives.size());
+        std::vector<storm::storage::BitVector> maybeStates(this->objectives.size());
+        storm::storage::BitVector objectivesWithMaybeStates(this->objectives.size(), false);
+        for (auto objIndex : totalRewardObjectives) {
+            deterministicStateRewards[objIndex].resize(deterministicMatrix.getRowCount());
+            storm::utility::vector::selectVectorValues(deterministicStateRewards[objIndex], this->optimalChoices, transitionMatrix.getRowGroupIndices(),
+                                                       actionRewards[objIndex]);
+            storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards[objIndex]);
+            maybeStates[objIndex] = storm::utility::graph::performProbGreater0(
+                deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
+            objectivesWithMaybeStates.set(objIndex, !maybeStates[objIndex].empty());
+        }
+
+        // The equation systems of the total reward objectives only differ in their right-hand sides (restricted to the union of the maybestates, the
+        // solution is zero at the states that are not a maybestate of the objective). We solve them at once, unless the solver requires objective
+        // specific bounds.
+        bool solveBatched = false;
+        if (objectivesWithMaybeStates.getNumberOfSetBits() > 1) {
+            auto req = linearEquationSolverFactory.create(env)->getRequirements(env);
+            solveBatched = !req.lowerBounds() && !req.upperBounds();
+        }
+
         // We compute an estimate for the results of the individual objectives which is obtained from the weighted result and the result of the objectives
         // computed so far. Note that weightedResult = Sum_{i=1}^{n} w_i * objectiveResult_i.
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
@@ -506,13 +530,6 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
                 } else {  // i.e. a total reward objective
-                    storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
-                                                               actionRewards[objIndex]);
-                    storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
-                    // As maybestates we pick the states from which a state with reward is reachable
-                    storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(
-                        deterministicBackwardTransitions, storm::storage::BitVector(deterministicMatrix.getRowCount(), true), statesWithRewards);
-
                     // Compute the estimate for this objective
                     if (!storm::utility::isZero(weightVector[objIndex])) {
                         objectiveResults[objIndex] = weightedSumOfUncheckedObjectives;
@@ -526,11 +543,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                     // Make sure that the objectiveResult is initialized correctly
                     objectiveResults[objIndex].resize(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
-                    if (!maybeStates.empty()) {
-                        bool needEquationSystem =
-                            linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                    if (!maybeStates[objIndex].empty() && !solveBatched) {
                         storm::storage::SparseMatrix<ValueType> submatrix =
-                            deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates, needEquationSystem);
+                            deterministicMatrix.getSubmatrix(true, maybeStates[objIndex], maybeStates[objIndex], needEquationSystem);
                         if (needEquationSystem) {
                             // Converting the matrix from the fixpoint notation to the form needed for the equation
                             // system. That is, we go from x = A*x + b to (I-A)x = b.
@@ -538,14 +553,15 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                         }
 
                         // Prepare solution vector and rhs of the equation system.
-                        std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates);
-                        std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards, maybeStates);
+                        std::vector<ValueType> x = storm::utility::vector::filterVector(objectiveResults[objIndex], maybeStates[objIndex]);
+                        std::vector<ValueType> b = storm::utility::vector::filterVector(deterministicStateRewards[objIndex], maybeStates[objIndex]);
 
                         // Now solve the resulting equation system.
                         std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, submatrix);
                         auto req = solver->getRequirements(env);
                         solver->clearBounds();
-                        storm::storage::BitVector submatrixRowsWithSumLessOne = deterministicMatrix.getRowFilter(maybeStates, maybeStates) % maybeStates;
+                        storm::storage::BitVector submatrixRowsWithSumLessOne =
+                            deterministicMatrix.getRowFilter(maybeStates[objIndex], maybeStates[objIndex]) % maybeStates[objIndex];
                         submatrixRowsWithSumLessOne.complement();
                         this->setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), objIndex, submatrix, submatrixRowsWithSumLessOne, b);
                         if (solver->hasLowerBound()) {
@@ -558,9 +574,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                                         "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
                         solver->solveEquations(env, x, b);
                         // Set the result for this objective accordingly
-                        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates, x);
+                        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], maybeStates[objIndex], x);
                     }
-                    storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates[objIndex], storm::utility::zero<ValueType>());
                 }
                 // Update the estimate for the next objectives.
                 if (!storm::utility::isZero(weightVector[objIndex])) {
@@ -571,6 +587,53 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                 objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
             }
         }
+
+        if (solveBatched) {
+            unboundedIndividualPhaseBatch(env, deterministicMatrix, objectivesWithMaybeStates, deterministicStateRewards, maybeStates);
+        }
+    }
+}
+
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhaseBatch(Environment const& env,
+                                                                                     storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                                                                     storm::storage::BitVector const& objectiveFilter,
+                                                                                     std::vector<std::vector<ValueType>> const& deterministicStateRewards,
+                                                                                     std::vector<storm::storage::BitVector> const& maybeStates) {
+    storm::storage::BitVector allMaybeStates(deterministicMatrix.getRowCount(), false);
+    for (auto objIndex : objectiveFilter) {
+        allMaybeStates |= maybeStates[objIndex];
+    }
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool needEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, allMaybeStates, allMaybeStates, needEquationSystem);
+    if (needEquationSystem) {
+        // Converting the matrix from the fixpoint notation to the form needed for the equation
+        // system. That is, we go from x = A*x + b to (I-A)x = b.
+        submatrix.convertToEquationSystem();
+    }
+
+    // Prepare the solution vectors (initialized with the estimates) and the right-hand sides. Note that the rewards of an objective are zero at the
+    // states that are not one of its maybestates.
+    std::vector<std::vector<ValueType>> x, b;
+    for (auto objIndex : objectiveFilter) {
+        x.push_back(storm::utility::vector::filterVector(objectiveResults[objIndex], allMaybeStates));
+        b.push_back(storm::utility::vector::filterVector(deterministicStateRewards[objIndex], allMaybeStates));
+    }
+
+    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(submatrix));
+    auto req = solver->getRequirements(env);
+    STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+    solver->solveEquationsBatch(env, x, b);
+
+    // Set the results accordingly
+    auto xIt = x.begin();
+    for (auto objIndex : objectiveFilter) {
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], allMaybeStates, *xIt);
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates[objIndex], storm::utility::zero<ValueType>());
+        ++xIt;
     }
 }
 
@@ -90,6 +90,19 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the values of the given total reward objectives w.r.t. the scheduler computed in the unboundedWeightedPhase by solving their equation
+     * systems at once. The results have to be initialized with an estimate.
+     *
+     * @param deterministicMatrix the transition matrix induced by the scheduler
+     * @param objectiveFilter the considered objectives
+     * @param deterministicStateRewards for each objective the rewards induced by the scheduler
+     * @param maybeStates for each objective the states from which a state with reward is reachable
+     */
+    void unboundedIndividualPhaseBatch(Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                       storm::storage::BitVector const& objectiveFilter, std::vector<std::vector<ValueType>> const& deterministicStateRewards,
+                                       std::vector<storm::storage::BitVector> const& maybeStates);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
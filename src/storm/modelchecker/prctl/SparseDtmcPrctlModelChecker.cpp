@@ -24,7 +24,9 @@
 #include "storm/solver/SolveGoal.h"
 
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -129,7 +131,7 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.getHint());
+        checkTask.getHint(), &this->getModel().getAnalysisCache());
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
 }
 
@@ -260,6 +262,8 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
 
     storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
     storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getAnalysisCache().getBottomSccDecomposition(this->getModel().getTransitionMatrix()));
     auto values = helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
 
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
@@ -272,6 +276,8 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
     storm::modelchecker::helper::SparseDeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
     storm::modelchecker::helper::setInformationFromCheckTaskDeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getAnalysisCache().getBottomSccDecomposition(this->getModel().getTransitionMatrix()));
     auto values = helper.computeLongRunAverageRewards(env, rewardModel.get());
     return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
 }
@@ -14,6 +14,7 @@
 #include "storm/logic/FragmentSpecification.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
@@ -167,7 +168,7 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
-        checkTask.isProduceSchedulersSet(), checkTask.getHint());
+        checkTask.isProduceSchedulersSet(), checkTask.getHint(), &this->getModel().getAnalysisCache());
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(ret.values)));
     if (checkTask.isProduceSchedulersSet() && ret.scheduler) {
         result->asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(ret.scheduler));
@@ -261,7 +262,7 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
 
     return storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(
         env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
-        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector());
+        this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), &this->getModel().getAnalysisCache());
 }
 
 template<typename SparseMdpModelType>
@@ -375,6 +376,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
 
     storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
     storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getMaximalEndComponentDecomposition());
     auto values = helper.computeLongRunAverageProbabilities(env, subResult.getTruthValuesVector());
 
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
@@ -393,6 +396,8 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
     storm::modelchecker::helper::SparseNondeterministicInfiniteHorizonHelper<ValueType> helper(this->getModel().getTransitionMatrix());
     storm::modelchecker::helper::setInformationFromCheckTaskNondeterministic(helper, checkTask, this->getModel());
+    helper.provideBackwardTransitions(this->getModel().getBackwardTransitions());
+    helper.provideLongRunComponentDecomposition(this->getModel().getMaximalEndComponentDecomposition());
     auto values = helper.computeLongRunAverageRewards(env, rewardModel.get());
     std::unique_ptr<CheckResult> result(new ExplicitQuantitativeCheckResult<ValueType>(std::move(values)));
     if (checkTask.isProduceSchedulersSet()) {
@@ -437,6 +442,86 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::che
     }
 }
 
+template<typename SparseMdpModelType>
+std::vector<std::unique_ptr<CheckResult>> SparseMdpPrctlModelChecker<SparseMdpModelType>::checkBatch(
+    Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks) {
+    std::vector<std::unique_ptr<CheckResult>> results(checkTasks.size());
+
+    // Group the tasks that can be batched by their kind (probabilities or rewards) and optimization direction.
+    std::map<std::pair<bool, OptimizationDirection>, std::vector<uint64_t>> batches;
+    for (uint64_t taskIndex = 0; taskIndex < checkTasks.size(); ++taskIndex) {
+        auto const& checkTask = checkTasks[taskIndex];
+        storm::logic::Formula const& formula = checkTask.getFormula();
+        if (checkTask.isProduceSchedulersSet() || !formula.isOperatorFormula() || formula.asOperatorFormula().hasBound()) {
+            continue;
+        }
+        storm::logic::OperatorFormula const& operatorFormula = formula.asOperatorFormula();
+        OptimizationDirection dir;
+        if (operatorFormula.hasOptimalityType()) {
+            dir = operatorFormula.getOptimalityType();
+        } else if (checkTask.isOptimizationDirectionSet()) {
+            dir = checkTask.getOptimizationDirection();
+        } else {
+            continue;
+        }
+
+        storm::logic::Formula const& subformula = operatorFormula.getSubformula();
+        if (formula.isProbabilityOperatorFormula() && subformula.isBoundedUntilFormula()) {
+            auto const& boundedUntil = subformula.asBoundedUntilFormula();
+            if (!boundedUntil.isMultiDimensional() && !boundedUntil.getTimeBoundReference().isRewardBound() && !boundedUntil.hasLowerBound() &&
+                boundedUntil.hasUpperBound() && boundedUntil.hasIntegerUpperBound()) {
+                batches[std::make_pair(false, dir)].push_back(taskIndex);
+            }
+        } else if (formula.isRewardOperatorFormula() && subformula.isCumulativeRewardFormula()) {
+            auto const& cumulative = subformula.asCumulativeRewardFormula();
+            if (formula.asRewardOperatorFormula().getMeasureType() == storm::logic::RewardMeasureType::Expectation && !cumulative.isMultiDimensional() &&
+                !cumulative.getTimeBoundReference().isRewardBound() && cumulative.hasIntegerBound() && !cumulative.hasRewardAccumulation()) {
+                batches[std::make_pair(true, dir)].push_back(taskIndex);
+            }
+        }
+    }
+
+    for (auto const& batch : batches) {
+        bool isRewardBatch = batch.first.first;
+        OptimizationDirection dir = batch.first.second;
+        auto const& taskIndices = batch.second;
+        if (taskIndices.size() < 2) {
+            continue;
+        }
+        STORM_LOG_INFO("Checking " << taskIndices.size() << " properties in one batch.");
+
+        std::vector<uint64_t> stepBounds;
+        std::vector<std::vector<ValueType>> values;
+        if (isRewardBatch) {
+            std::vector<RewardModelType const*> rewardModels;
+            for (auto taskIndex : taskIndices) {
+                auto const& rewardOperator = checkTasks[taskIndex].getFormula().asRewardOperatorFormula();
+                std::string rewardModelName = rewardOperator.hasRewardModelName() ? rewardOperator.getRewardModelName()
+                                                                                  : (checkTasks[taskIndex].isRewardModelSet() ? checkTasks[taskIndex].getRewardModel() : "");
+                rewardModels.push_back(&this->getModel().getRewardModel(rewardModelName));
+                stepBounds.push_back(rewardOperator.getSubformula().asCumulativeRewardFormula().template getNonStrictBound<uint64_t>());
+            }
+            values = helper::SparseMdpPrctlHelper<ValueType>::computeCumulativeRewardsBatch(env, dir, this->getModel().getTransitionMatrix(), rewardModels,
+                                                                                           stepBounds);
+        } else {
+            std::vector<storm::storage::BitVector> phiStates;
+            std::vector<storm::storage::BitVector> psiStates;
+            for (auto taskIndex : taskIndices) {
+                auto const& boundedUntil = checkTasks[taskIndex].getFormula().asOperatorFormula().getSubformula().asBoundedUntilFormula();
+                phiStates.push_back(this->check(env, boundedUntil.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                psiStates.push_back(this->check(env, boundedUntil.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                stepBounds.push_back(boundedUntil.template getNonStrictUpperBound<uint64_t>());
+            }
+            values = helper::SparseMdpPrctlHelper<ValueType>::computeStepBoundedUntilProbabilitiesBatch(env, dir, this->getModel().getTransitionMatrix(),
+                                                                                                       phiStates, psiStates, stepBounds);
+        }
+        for (uint64_t vector = 0; vector < taskIndices.size(); ++vector) {
+            results[taskIndices[vector]] = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(values[vector]));
+        }
+    }
+    return results;
+}
+
 template class SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>;
 
 #ifdef STORM_HAVE_CARL
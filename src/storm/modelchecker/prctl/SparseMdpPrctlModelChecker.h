@@ -61,6 +61,16 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
                                                                   CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env,
                                                               CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Checks several tasks at once. Step-bounded until probabilities (P=? [phi U<=k psi]) and cumulative rewards (R=? [C<=k])
+     * that share the optimization direction are computed in batches whose iterations only traverse the transition
+     * matrix once for all tasks of the batch.
+     *
+     * @return The results of the tasks in the same order. Tasks that are not part of a batch with at least two tasks
+     * are not checked and their result is null.
+     */
+    std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<CheckTask<storm::logic::Formula, ValueType>> const& checkTasks);
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -10,8 +10,12 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Odd.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/utility/constants.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/vector.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -30,6 +34,54 @@ namespace storm {
 namespace modelchecker {
 namespace helper {
 
+// Solves x = A * x + b for the given maybe states one block of SCCs at a time in topological order. Only the rows of the current block are
+// translated to an explicit matrix, so the explicitly stored part of the matrix is bounded by the size of the largest block.
+template<storm::dd::DdType DdType, typename ValueType>
+std::vector<ValueType> solveEquationSystemSccWise(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                  storm::dd::Add<DdType, ValueType> const& submatrix, storm::dd::Bdd<DdType> const& maybeStates,
+                                                  storm::dd::Odd const& odd, std::vector<ValueType> const& b, boost::optional<ValueType> const& upperBound) {
+    std::vector<storm::dd::Bdd<DdType>> blocks =
+        storm::utility::graph::getTopologicallyOrderedSccBlocks(model, submatrix.notZero(), maybeStates, env.modelchecker().getHybridSccBlockSize());
+    STORM_LOG_INFO("Solving the equation system in " << blocks.size() << " blocks of SCCs.");
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    bool convertToEquationSystem =
+        linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+    std::vector<ValueType> x(odd.getTotalOffset(), storm::utility::zero<ValueType>());
+    for (auto const& block : blocks) {
+        storm::dd::Odd blockOdd = block.createOdd();
+        storm::storage::BitVector blockStates = block.toVector(odd);
+
+        // Translate the rows of the block. The columns refer to all maybe states such that the transitions to states of previous blocks can be
+        // replaced by the (already computed) values of these states.
+        storm::storage::SparseMatrix<ValueType> blockRows = (submatrix * block.template toAdd<ValueType>()).toMatrix(blockOdd, odd);
+        std::vector<ValueType> blockB = storm::utility::vector::filterVector(b, blockStates);
+        for (uint64_t row = 0; row < blockRows.getRowCount(); ++row) {
+            for (auto const& entry : blockRows.getRow(row)) {
+                if (!blockStates.get(entry.getColumn())) {
+                    blockB[row] += entry.getValue() * x[entry.getColumn()];
+                }
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> blockMatrix =
+            blockRows.getSubmatrix(false, storm::storage::BitVector(blockRows.getRowCount(), true), blockStates, convertToEquationSystem);
+        blockRows = storm::storage::SparseMatrix<ValueType>();
+        if (convertToEquationSystem) {
+            blockMatrix.convertToEquationSystem();
+        }
+
+        std::vector<ValueType> blockX(blockMatrix.getRowCount(), storm::utility::convertNumber<ValueType>(0.5));
+        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(blockMatrix));
+        solver->setLowerBound(storm::utility::zero<ValueType>());
+        if (upperBound) {
+            solver->setUpperBound(upperBound.get());
+        }
+        solver->solveEquations(env, blockX, blockB);
+        storm::utility::vector::setVectorValues(x, blockStates, blockX);
+    }
+    return x;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env,
                                                                                                  storm::models::symbolic::Model<DdType, ValueType> const& model,
@@ -85,13 +137,24 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
 
-            // Check whether we need to create an equation system.
+            // Cut away all columns targeting non-maybe states.
+            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+
+            if (env.modelchecker().isHybridSccSet()) {
+                conversionWatch.start();
+                std::vector<ValueType> b = subvector.toVector(odd);
+                conversionWatch.stop();
+                std::vector<ValueType> x =
+                    solveEquationSystemSccWise(env, model, submatrix, maybeStates, odd, b, boost::optional<ValueType>(storm::utility::one<ValueType>()));
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), model.getReachableStates() && !maybeStates, statesWithProbability01.second.template toAdd<ValueType>(),
+                    maybeStates, odd, x));
+            }
+
+            // Check whether we need to create an equation system and potentially convert the matrix into the matrix needed for solving
+            // the equation system (i.e. compute (I-A)).
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
             if (convertToEquationSystem) {
                 submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
             }
@@ -337,13 +400,28 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeRe
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                             "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
 
-            // Check whether we need to create an equation system.
+            // Cut away all columns targeting non-maybe states.
+            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+
+            // Upper reward bounds are computed on the complete matrix, so in this case the equation system is not solved SCC-wise.
+            STORM_LOG_WARN_COND(!env.modelchecker().isHybridSccSet() || !oneStepTargetProbs,
+                                "Not solving the equation system SCC-wise as the solver requires upper bounds.");
+            if (env.modelchecker().isHybridSccSet() && !oneStepTargetProbs) {
+                conversionWatch.start();
+                std::vector<ValueType> b = subvector.toVector(odd);
+                conversionWatch.stop();
+                std::vector<ValueType> x = solveEquationSystemSccWise(env, model, submatrix, maybeStates, odd, b, boost::optional<ValueType>());
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+                    model.getReachableStates(), model.getReachableStates() && !maybeStates,
+                    infinityStates.ite(model.getManager().getConstant(storm::utility::infinity<ValueType>()),
+                                       model.getManager().template getAddZero<ValueType>()),
+                    maybeStates, odd, x));
+            }
+
+            // Check whether we need to create an equation system and potentially convert the matrix into the matrix needed for solving
+            // the equation system (i.e. compute (I-A)).
             bool convertToEquationSystem =
                 linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
-
-            // Finally cut away all columns targeting non-maybe states and potentially convert the matrix
-            // into the matrix needed for solving the equation system (i.e. compute (I-A)).
-            submatrix *= maybeStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
             if (convertToEquationSystem) {
                 submatrix = (model.getRowColumnIdentity() * maybeStatesAdd) - submatrix;
             }
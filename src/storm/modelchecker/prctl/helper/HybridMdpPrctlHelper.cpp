@@ -13,13 +13,14 @@
 
 #include "storm/models/symbolic/StandardRewardModel.h"
 
-#include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
-#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/SccUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
 
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -561,17 +562,13 @@ void eliminateEndComponentsAndTargetStatesReachabilityRewards(
 }
 
 template<typename ValueType>
-void setUpperRewardBounds(storm::solver::MinMaxLinearEquationSolver<ValueType>& solver, storm::OptimizationDirection const& direction,
+void setUpperRewardBounds(Environment const& env, storm::solver::MinMaxLinearEquationSolver<ValueType>& solver, storm::OptimizationDirection const& direction,
                           storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& choiceRewards,
                           std::vector<ValueType> const& oneStepTargetProbabilities) {
-    // For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
-    if (direction == storm::OptimizationDirection::Minimize) {
-        DsMpiMdpUpperRewardBoundsComputer<ValueType> dsmpi(submatrix, choiceRewards, oneStepTargetProbabilities);
-        solver.setUpperBounds(dsmpi.computeUpperBounds());
-    } else {
-        BaierUpperRewardBoundsComputer<ValueType> baier(submatrix, choiceRewards, oneStepTargetProbabilities);
-        solver.setUpperBound(baier.computeUpperBound());
-    }
+    // The bounds are computed SCC by SCC. For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
+    SccUpperRewardBoundsComputer<ValueType> boundsComputer(submatrix, choiceRewards, oneStepTargetProbabilities);
+    solver.setUpperBounds(
+        boundsComputer.computeUpperBounds(direction, env.solver().topological().getNumberOfThreads(), env.solver().topological().getBatchSize()));
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -736,7 +733,7 @@ std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeRea
 
             // If the solver requires upper bounds, compute them now.
             if (requirements.upperBounds()) {
-                setUpperRewardBounds(*solver, dir, explicitRepresentation.first, explicitRepresentation.second,
+                setUpperRewardBounds(env, *solver, dir, explicitRepresentation.first, explicitRepresentation.second,
                                      solverRequirementsData.oneStepTargetProbabilities.get());
             }
 
@@ -0,0 +1,171 @@
+#include "storm/modelchecker/prctl/helper/SccUpperRewardBoundsComputer.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "storm-config.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/solver/helper/SccTaskGraph.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+SccUpperRewardBoundsComputer<ValueType>::SccUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                      std::vector<ValueType> const& rewards,
+                                                                      std::vector<ValueType> const& oneStepTargetProbabilities)
+    : _transitionMatrix(transitionMatrix), _rewards(rewards), _oneStepTargetProbabilities(oneStepTargetProbabilities) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::vector<ValueType> SccUpperRewardBoundsComputer<ValueType>::computeUpperBounds(storm::OptimizationDirection const& direction, uint64_t numberOfThreads,
+                                                                                   uint64_t batchSize) {
+    // For deterministic models, minimal and maximal rewards coincide.
+    bool const maximize = !_transitionMatrix.hasTrivialRowGrouping() && storm::solver::maximize(direction);
+
+    STORM_LOG_TRACE("Computing upper reward bounds SCC by SCC.");
+    storm::utility::Stopwatch stopwatch(true);
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(
+        _transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> stateToScc(_transitionMatrix.getRowGroupCount());
+    std::vector<uint64_t> stateToLocalIndex(_transitionMatrix.getRowGroupCount());
+    for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+        uint64_t localIndex = 0;
+        for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+            stateToLocalIndex[state] = localIndex;
+            ++localIndex;
+        }
+    }
+
+    std::vector<ValueType> bounds(_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    numberOfThreads = storm::utility::parallel::getNumberOfThreads(numberOfThreads);
+    if (numberOfThreads > 1 && sccDecomposition.size() > 1) {
+        storm::solver::helper::SccTaskGraph<ValueType> taskGraph(_transitionMatrix, sccDecomposition, batchSize);
+        numberOfThreads = std::min(numberOfThreads, taskGraph.getNumberOfTasks());
+        // An SCC only reads the bounds of the SCCs it has transitions into and writes its own bounds, so tasks do not interfere.
+        storm::utility::parallel::forEachTaskInDependencyOrder(taskGraph.getDependencies(), numberOfThreads, [&](uint64_t, uint64_t task) {
+            for (uint64_t sccIndex = taskGraph.getFirstScc(task); sccIndex < taskGraph.getEndScc(task); ++sccIndex) {
+                processScc(sccDecomposition.getBlock(sccIndex), sccIndex, maximize, stateToScc, stateToLocalIndex, bounds);
+            }
+        });
+    } else {
+        for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+            processScc(sccDecomposition.getBlock(sccIndex), sccIndex, maximize, stateToScc, stateToLocalIndex, bounds);
+        }
+    }
+    stopwatch.stop();
+    STORM_LOG_TRACE("Computed upper bounds on rewards for " << sccDecomposition.size() << " SCCs in " << stopwatch << ".");
+
+    return bounds;
+}
+
+template<typename ValueType>
+void SccUpperRewardBoundsComputer<ValueType>::processScc(storm::storage::StronglyConnectedComponent const& scc, uint64_t sccIndex, bool maximize,
+                                                         std::vector<uint64_t> const& stateToScc, std::vector<uint64_t> const& stateToLocalIndex,
+                                                         std::vector<ValueType>& bounds) const {
+    auto const& rowGroupIndices = _transitionMatrix.getRowGroupIndices();
+    if (scc.size() == 1) {
+        // For a single state, the optimal choice can be taken in every visit of the state, so we can compute the bound directly.
+        uint64_t state = *scc.begin();
+        boost::optional<ValueType> stateBound;
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            ValueType rowValue = _rewards[row];
+            ValueType leavingProbability = storm::utility::one<ValueType>();
+            for (auto const& entry : _transitionMatrix.getRow(row)) {
+                if (entry.getColumn() == state) {
+                    leavingProbability -= entry.getValue();
+                } else {
+                    rowValue += entry.getValue() * bounds[entry.getColumn()];
+                }
+            }
+            if (storm::utility::isZero(leavingProbability)) {
+                // This choice never leaves the state. Such choices can only occur when minimizing and are never taken then.
+                STORM_LOG_ASSERT(!maximize, "Unexpected self-loop choice when maximizing.");
+                continue;
+            }
+            rowValue /= leavingProbability;
+            if (!stateBound || (maximize ? rowValue > stateBound.get() : rowValue < stateBound.get())) {
+                stateBound = std::move(rowValue);
+            }
+        }
+        STORM_LOG_THROW(stateBound.is_initialized(), storm::exceptions::InvalidOperationException,
+                        "Can not compute upper reward bound for state " << state << " that has no choice leaving it.");
+        bounds[state] = std::move(stateBound.get());
+        return;
+    }
+
+    // Build the system restricted to the SCC, where leaving the SCC is treated like reaching the goal.
+    // When minimizing, DS-MPI collects the bound of the reached state as reward when leaving the SCC. As variant 2 of Baier et al. multiplies the
+    // rewards with bounds on the expected number of visits, we instead add the largest bound of a state reached when leaving the SCC when maximizing.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, scc.size(), 0, false, !_transitionMatrix.hasTrivialRowGrouping());
+    std::vector<ValueType> localRewards;
+    std::vector<ValueType> localTargetProbabilities;
+    ValueType maximalExitBound = storm::utility::zero<ValueType>();
+    uint64_t localRow = 0;
+    for (auto const& state : scc) {
+        if (!_transitionMatrix.hasTrivialRowGrouping()) {
+            builder.newRowGroup(localRow);
+        }
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+            ValueType rowReward = _rewards[row];
+            ValueType rowTargetProbability = _oneStepTargetProbabilities[row];
+            for (auto const& entry : _transitionMatrix.getRow(row)) {
+                if (stateToScc[entry.getColumn()] == sccIndex) {
+                    builder.addNextValue(localRow, stateToLocalIndex[entry.getColumn()], entry.getValue());
+                } else {
+                    if (maximize) {
+                        maximalExitBound = std::max(maximalExitBound, bounds[entry.getColumn()]);
+                    } else {
+                        rowReward += entry.getValue() * bounds[entry.getColumn()];
+                    }
+                    rowTargetProbability += entry.getValue();
+                }
+            }
+            localRewards.push_back(std::move(rowReward));
+            localTargetProbabilities.push_back(std::move(rowTargetProbability));
+            ++localRow;
+        }
+    }
+    auto localMatrix = builder.build(localRow, scc.size(), scc.size());
+
+    if (maximize) {
+        ValueType sccBound =
+            BaierUpperRewardBoundsComputer<ValueType>(localMatrix, localRewards, localTargetProbabilities).computeUpperBound() + maximalExitBound;
+        for (auto const& state : scc) {
+            bounds[state] = sccBound;
+        }
+    } else {
+        std::vector<ValueType> localBounds;
+        if (_transitionMatrix.hasTrivialRowGrouping()) {
+            localBounds = DsMpiDtmcUpperRewardBoundsComputer<ValueType>(localMatrix, localRewards, localTargetProbabilities).computeUpperBounds();
+        } else {
+            localBounds = DsMpiMdpUpperRewardBoundsComputer<ValueType>(localMatrix, localRewards, localTargetProbabilities).computeUpperBounds();
+        }
+        auto localBoundIt = localBounds.begin();
+        for (auto const& state : scc) {
+            bounds[state] = std::move(*localBoundIt);
+            ++localBoundIt;
+        }
+    }
+}
+
+template class SccUpperRewardBoundsComputer<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SccUpperRewardBoundsComputer<storm::RationalNumber>;
+#endif
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
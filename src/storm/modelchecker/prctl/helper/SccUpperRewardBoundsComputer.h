@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponent.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Computes upper bounds on the expected rewards SCC by SCC. The SCCs are processed in reverse topological order. Within an SCC, the transitions
+ * leaving the SCC are treated like transitions to the goal, taking the (already computed) bounds of the reached states into account. The bounds
+ * for the states of the SCC are then obtained with DS-MPI (for deterministic models and minimal rewards) or with variant 2 of Baier et al. (for
+ * maximal rewards) on the SCC only. As the bounds are no longer derived from a single estimate for the whole system, they are typically much
+ * tighter. SCCs that do not depend on each other are processed concurrently.
+ */
+template<typename ValueType>
+class SccUpperRewardBoundsComputer {
+   public:
+    /*!
+     * Creates an object that can compute upper bounds on the expected rewards for the provided DTMC or MDP.
+     * @param transitionMatrix The matrix defining the transitions of the system without the transitions
+     * that lead directly to the goal state.
+     * @param rewards The rewards of each choice.
+     * @param oneStepTargetProbabilities For each choice the probability to go to a goal state in one step.
+     */
+    SccUpperRewardBoundsComputer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
+                                 std::vector<ValueType> const& oneStepTargetProbabilities);
+
+    /*!
+     * Computes for each state an upper bound on the optimal expected rewards.
+     * @param direction Whether the minimal or the maximal expected rewards are bounded. This is irrelevant for deterministic models.
+     * @param numberOfThreads The number of threads to use, where 0 means 'auto-detect'.
+     * @param batchSize Consecutive SCCs are processed in one task as long as the task has at most this many states.
+     */
+    std::vector<ValueType> computeUpperBounds(storm::OptimizationDirection const& direction, uint64_t numberOfThreads = 1, uint64_t batchSize = 1000);
+
+   private:
+    /*!
+     * Computes the bounds for the states of the given SCC, assuming that the bounds of all states reachable from the SCC are already known.
+     */
+    void processScc(storm::storage::StronglyConnectedComponent const& scc, uint64_t sccIndex, bool maximize, std::vector<uint64_t> const& stateToScc,
+                    std::vector<uint64_t> const& stateToLocalIndex, std::vector<ValueType>& bounds) const;
+
+    storm::storage::SparseMatrix<ValueType> const& _transitionMatrix;
+    std::vector<ValueType> const& _rewards;
+    std::vector<ValueType> const& _oneStepTargetProbabilities;
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
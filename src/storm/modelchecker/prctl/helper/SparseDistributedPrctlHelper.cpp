@@ -0,0 +1,72 @@
+#include "storm/modelchecker/prctl/helper/SparseDistributedPrctlHelper.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+namespace {
+template<typename ValueType>
+std::vector<ValueType> solveDistributed(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                        storm::storage::distributed::DistributedSparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>&& x,
+                                        std::vector<ValueType> const* b, storm::storage::BitVector const& fixedStates) {
+    // Nondeterministic models are configured via the min-max environment, deterministic ones via the native environment.
+    bool relative = dir ? env.solver().minMax().getRelativeTerminationCriterion() : env.solver().native().getRelativeTerminationCriterion();
+    ValueType precision = storm::utility::convertNumber<ValueType>(dir ? env.solver().minMax().getPrecision() : env.solver().native().getPrecision());
+    uint64_t maxIterations = dir ? env.solver().minMax().getMaximalNumberOfIterations() : env.solver().native().getMaximalNumberOfIterations();
+
+    storm::solver::helper::DistributedValueIterationHelper<ValueType> helper(transitionMatrix);
+    auto statusIters = helper.solveEquations(x, b, relative, precision, maxIterations, dir, &fixedStates);
+    STORM_LOG_WARN_COND(statusIters.first == storm::solver::SolverStatus::Converged || transitionMatrix.getCommunicator().getRank() != 0,
+                        "Distributed value iteration did not converge within " << statusIters.second << " iterations.");
+    return std::move(x);
+}
+}  // namespace
+
+template<typename ValueType>
+std::vector<ValueType> SparseDistributedPrctlHelper<ValueType>::computeUntilProbabilities(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+    storm::storage::distributed::DistributedSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates) {
+    uint64_t const numberOfLocalStates = transitionMatrix.getNumberOfLocalStates();
+    STORM_LOG_THROW(phiStates.size() == numberOfLocalStates && psiStates.size() == numberOfLocalStates, storm::exceptions::InvalidArgumentException,
+                    "The state sets have to be restricted to the " << numberOfLocalStates << " local states.");
+
+    // Starting from zero, value iteration converges to the least fixed point, which is the reachability probability.
+    // Psi states keep the value one and states that are neither phi nor psi states keep the value zero.
+    std::vector<ValueType> x(numberOfLocalStates, storm::utility::zero<ValueType>());
+    for (auto const& state : psiStates) {
+        x[state] = storm::utility::one<ValueType>();
+    }
+    return solveDistributed(env, dir, transitionMatrix, std::move(x), nullptr, ~phiStates | psiStates);
+}
+
+template<typename ValueType>
+std::vector<ValueType> SparseDistributedPrctlHelper<ValueType>::computeReachabilityRewards(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+    storm::storage::distributed::DistributedSparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& choiceRewards,
+    storm::storage::BitVector const& targetStates) {
+    uint64_t const numberOfLocalStates = transitionMatrix.getNumberOfLocalStates();
+    STORM_LOG_THROW(targetStates.size() == numberOfLocalStates, storm::exceptions::InvalidArgumentException,
+                    "The target states have to be restricted to the " << numberOfLocalStates << " local states.");
+    STORM_LOG_THROW(choiceRewards.size() == transitionMatrix.getLocalMatrix().getRowCount(), storm::exceptions::InvalidArgumentException,
+                    "Expected one reward per local row.");
+
+    // Target states keep the value zero.
+    std::vector<ValueType> x(numberOfLocalStates, storm::utility::zero<ValueType>());
+    return solveDistributed(env, dir, transitionMatrix, std::move(x), &choiceRewards, targetStates);
+}
+
+template class SparseDistributedPrctlHelper<double>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
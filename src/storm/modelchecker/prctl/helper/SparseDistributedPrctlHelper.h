@@ -0,0 +1,50 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/distributed/DistributedSparseMatrix.h"
+
+namespace storm {
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Computes reachability properties of DTMCs and MDPs whose transition matrix is distributed over several ranks.
+ * All functions have to be called on all ranks, take state sets and vectors restricted to the local states of the
+ * calling rank and return the values of the local states.
+ * The values are computed with value iteration from below without a qualitative preprocessing, so they are not sound
+ * in the sense of sound value iteration.
+ */
+template<typename ValueType>
+class SparseDistributedPrctlHelper {
+   public:
+    /*!
+     * Computes the probabilities to reach a psi state via phi states.
+     *
+     * @param dir The optimization direction for MDPs. Has to be none for DTMCs.
+     */
+    static std::vector<ValueType> computeUntilProbabilities(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                            storm::storage::distributed::DistributedSparseMatrix<ValueType> const& transitionMatrix,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Computes the expected rewards accumulated until reaching a target state. The target has to be reached with
+     * probability one from every state (under every scheduler when maximizing, under some scheduler when minimizing),
+     * as the iteration diverges otherwise.
+     *
+     * @param dir The optimization direction for MDPs. Has to be none for DTMCs.
+     * @param choiceRewards The rewards of the local rows.
+     */
+    static std::vector<ValueType> computeReachabilityRewards(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                             storm::storage::distributed::DistributedSparseMatrix<ValueType> const& transitionMatrix,
+                                                             std::vector<ValueType> const& choiceRewards, storm::storage::BitVector const& targetStates);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
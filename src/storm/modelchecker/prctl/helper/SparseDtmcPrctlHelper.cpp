@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include <type_traits>
+
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
 #include "storm/utility/graph.h"
@@ -14,11 +16,13 @@
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
-#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/SccUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -30,6 +34,7 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/macros.h"
@@ -55,7 +60,7 @@ std::map<storm::storage::sparse::state_type, storm::RationalFunction> SparseDtmc
 template<typename ValueType, typename RewardModelType>
 std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeRewardBoundedValues(
     Environment const& env, storm::models::sparse::Dtmc<ValueType> const& model, std::shared_ptr<storm::logic::OperatorFormula const> rewardBoundedFormula) {
-    storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+    storm::utility::Stopwatch swAll(true), swCheck;
 
     storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, rewardBoundedFormula);
 
@@ -67,9 +72,14 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+    // Independent epochs are analyzed concurrently. This is not done in case of cdf export (where the order of the entries matters) and for exact
+    // computations.
+    bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value && !exportCdf ? storm::utility::parallel::getDefaultNumberOfThreads() : 1;
+
+    // initialize data that will be needed for each epoch (one instance per thread)
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);
 
     Environment preciseEnv = env;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
@@ -87,30 +97,28 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    swCheck.start();
+    rewardUnfolding.analyzeEpochs(
+        epochOrder, numberOfThreads,
+        [&](uint64_t threadIndex, typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const&,
+            rewardbounded::EpochModel<ValueType, true>& epochModel) {
+            return epochModel.analyzeSingleObjective(preciseEnv, x[threadIndex], b[threadIndex], linEqSolvers[threadIndex], lowerBound, upperBound);
+        },
+        [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
+            if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+        });
+    swCheck.stop();
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : model.getInitialStates()) {
@@ -119,7 +127,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
 
     swAll.stop();
 
-    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+    if (exportCdf) {
         std::vector<std::string> headers;
         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
             headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
@@ -133,10 +141,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         STORM_PRINT_AND_LOG("---------------------------------\n");
         STORM_PRINT_AND_LOG("Statistics:\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
-        STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
-        STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+        STORM_PRINT_AND_LOG("                       #checked epochs: " << numCheckedEpochs << ".\n");
+        STORM_PRINT_AND_LOG("                          overall Time: " << swAll << ".\n");
+        STORM_PRINT_AND_LOG("Epoch Model building and checking Time: " << swCheck << ".\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
     }
 
@@ -147,7 +154,7 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
@@ -175,8 +182,18 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
+        auto computeStatesWithProbability01 = [&]() {
+            if (analysisCache) {
+                // The graph analysis only needs the (smaller) pattern of the backward transitions, which is kept in the cache.
+                return storm::utility::graph::performProb01(transitionMatrix, analysisCache->getBackwardTransitionPattern(transitionMatrix), phiStates,
+                                                            psiStates);
+            }
+            return storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, phiStates, psiStates);
+        };
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            analysisCache ? analysisCache->getQualitativeResult(storm::models::sparse::ModelAnalysisCache<ValueType>::QualitativeAnalysis::Prob01, phiStates,
+                                                                psiStates, computeStatesWithProbability01)
+                          : computeStatesWithProbability01();
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -198,6 +215,15 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
         storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::convertNumber<ValueType>(0.5));
     } else {
+        if (goal.hasRelevantValues()) {
+            // Only solve for the maybe states that the relevant states depend on. The values of the other maybe states are set to 0.5 as above.
+            storm::storage::BitVector relevantMaybeStates = storm::utility::graph::getRelevantMaybeStates(transitionMatrix, goal.relevantValues(), maybeStates);
+            STORM_LOG_INFO("Preprocessing: " << relevantMaybeStates.getNumberOfSetBits() << " of " << maybeStates.getNumberOfSetBits()
+                                             << " maybe states are relevant.");
+            storm::utility::vector::setVectorValues<ValueType>(result, maybeStates & ~relevantMaybeStates, storm::utility::convertNumber<ValueType>(0.5));
+            maybeStates = std::move(relevantMaybeStates);
+        }
+
         if (!maybeStates.empty()) {
             // In this case we have to compute the probabilities.
 
@@ -372,7 +398,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     // Identify the states from which only states with zero reward are reachable.
     // We can then compute reachability rewards assuming these states as target set.
     storm::storage::BitVector statesWithoutReward = rewardModel.getStatesWithZeroReward(transitionMatrix);
-    storm::storage::BitVector rew0States = storm::utility::graph::performProbGreater0(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+    storm::storage::BitVector rew0States =
+        storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, statesWithoutReward, ~statesWithoutReward);
     rew0States.complement();
     return computeReachabilityRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, rew0States, qualitative, hint);
 }
@@ -418,17 +445,18 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         targetStates, qualitative, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); }, hint);
 }
 
-// This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
+// This function computes upper bounds on the reachability rewards (using DS-MPI on each SCC).
 template<typename ValueType>
-std::vector<ValueType> computeUpperRewardBounds(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& rewards,
-                                                std::vector<ValueType> const& oneStepTargetProbabilities) {
-    DsMpiDtmcUpperRewardBoundsComputer<ValueType> dsmpi(transitionMatrix, rewards, oneStepTargetProbabilities);
-    std::vector<ValueType> bounds = dsmpi.computeUpperBounds();
-    return bounds;
+std::vector<ValueType> computeUpperRewardBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                std::vector<ValueType> const& rewards, std::vector<ValueType> const& oneStepTargetProbabilities) {
+    SccUpperRewardBoundsComputer<ValueType> boundsComputer(transitionMatrix, rewards, oneStepTargetProbabilities);
+    return boundsComputer.computeUpperBounds(storm::OptimizationDirection::Minimize, env.solver().topological().getNumberOfThreads(),
+                                             env.solver().topological().getBatchSize());
 }
 
 template<>
-std::vector<storm::RationalFunction> computeUpperRewardBounds(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+std::vector<storm::RationalFunction> computeUpperRewardBounds(Environment const&,
+                                                              storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                               std::vector<storm::RationalFunction> const& rewards,
                                                               std::vector<storm::RationalFunction> const& oneStepTargetProbabilities) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Computing upper reward bounds is not supported for rational functions.");
@@ -481,6 +509,15 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
         // are neither 0 nor infinity.
         storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::one<ValueType>());
     } else {
+        if (goal.hasRelevantValues()) {
+            // Only solve for the maybe states that the relevant states depend on. The values of the other maybe states are set to 1 as above.
+            storm::storage::BitVector relevantMaybeStates = storm::utility::graph::getRelevantMaybeStates(transitionMatrix, goal.relevantValues(), maybeStates);
+            STORM_LOG_INFO("Preprocessing: " << relevantMaybeStates.getNumberOfSetBits() << " of " << maybeStates.getNumberOfSetBits()
+                                             << " maybe states are relevant.");
+            storm::utility::vector::setVectorValues<ValueType>(result, maybeStates & ~relevantMaybeStates, storm::utility::one<ValueType>());
+            maybeStates = std::move(relevantMaybeStates);
+        }
+
         if (!maybeStates.empty()) {
             // Check whether we need to convert the input to equation system format.
             storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
@@ -507,7 +544,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
             boost::optional<std::vector<ValueType>> upperRewardBounds;
             requirements.clearLowerBounds();
             if (requirements.upperBounds()) {
-                upperRewardBounds = computeUpperRewardBounds(submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
+                upperRewardBounds = computeUpperRewardBounds(env, submatrix, b, transitionMatrix.getConstrainedRowSumVector(maybeStates, rew0States));
                 requirements.clearUpperBounds();
             }
             STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
@@ -575,7 +612,8 @@ typename SparseDtmcPrctlHelper<ValueType, RewardModelType>::BaierTransformedMode
         // First, compute the relevant states and some offsets.
         storm::storage::BitVector allStates(targetStates.size(), true);
         std::vector<uint_fast64_t> numberOfBeforeStatesUpToState = result.beforeStates.getNumberOfSetBitsBeforeIndices();
-        storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, targetStates);
+        storm::storage::BitVector statesWithProbabilityGreater0 =
+            storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, allStates, targetStates);
         statesWithProbabilityGreater0 &= storm::utility::graph::getReachableStates(transitionMatrix, conditionStates, allStates, targetStates);
         uint_fast64_t normalStatesOffset = result.beforeStates.getNumberOfSetBits();
         std::vector<uint_fast64_t> numberOfNormalStatesUpToState = statesWithProbabilityGreater0.getNumberOfSetBitsBeforeIndices();
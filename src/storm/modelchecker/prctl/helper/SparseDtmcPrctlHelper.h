@@ -32,11 +32,16 @@ class SparseDtmcPrctlHelper {
     static std::vector<ValueType> computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                            storm::storage::BitVector const& nextStates);
 
+    /*!
+     * Computes the until probabilities. If an analysis cache is given, it must belong to the model with the given transition
+     * matrix and is used to look up and store the states with probability zero and one.
+     */
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                            storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
 
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -1,13 +1,17 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
-#include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
-#include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
+#include "storm/modelchecker/prctl/helper/SccUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
@@ -35,10 +39,12 @@
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
@@ -56,7 +62,7 @@ template<typename ValueType>
 std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<ValueType>::computeRewardBoundedValues(
     Environment const& env, OptimizationDirection dir, rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding,
     storm::storage::BitVector const& initialStates) {
-    storm::utility::Stopwatch swAll(true), swBuild, swCheck;
+    storm::utility::Stopwatch swAll(true), swCheck;
 
     // Get lower and upper bounds for the solution.
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
@@ -66,9 +72,14 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     auto initEpoch = rewardUnfolding.getStartEpoch();
     auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+    // Independent epochs are analyzed concurrently. This is not done in case of cdf export (where the order of the entries matters) and for exact
+    // computations.
+    bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value && !exportCdf ? storm::utility::parallel::getDefaultNumberOfThreads() : 1;
+
+    // initialize data that will be needed for each epoch (one instance per thread)
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);
 
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
@@ -82,30 +93,28 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    swCheck.start();
+    rewardUnfolding.analyzeEpochs(
+        epochOrder, numberOfThreads,
+        [&](uint64_t threadIndex, typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const&,
+            rewardbounded::EpochModel<ValueType, true>& epochModel) {
+            return epochModel.analyzeSingleObjective(preciseEnv, dir, x[threadIndex], b[threadIndex], minMaxSolvers[threadIndex], lowerBound, upperBound);
+        },
+        [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
+            if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+        });
+    swCheck.stop();
 
     std::map<storm::storage::sparse::state_type, ValueType> result;
     for (auto initState : initialStates) {
@@ -114,7 +123,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
 
     swAll.stop();
 
-    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+    if (exportCdf) {
         std::vector<std::string> headers;
         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
             headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
@@ -128,10 +137,9 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
         STORM_PRINT_AND_LOG("---------------------------------\n");
         STORM_PRINT_AND_LOG("Statistics:\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
-        STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
-        STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
-        STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
+        STORM_PRINT_AND_LOG("                       #checked epochs: " << numCheckedEpochs << ".\n");
+        STORM_PRINT_AND_LOG("                          overall Time: " << swAll << ".\n");
+        STORM_PRINT_AND_LOG("Epoch Model building and checking Time: " << swCheck << ".\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
     }
 
@@ -511,17 +519,34 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
+    auto computeStatesWithProbability01 = [&]() {
+        if (analysisCache) {
+            // The graph analysis only needs the (smaller) pattern of the backward transitions, which is kept in the cache.
+            storm::storage::SparsePattern const& backwardPattern = analysisCache->getBackwardTransitionPattern(transitionMatrix);
+            if (goal.minimize()) {
+                return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates);
+            } else {
+                return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates);
+            }
+        }
+        if (goal.minimize()) {
+            return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        } else {
+            return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        }
+    };
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    if (analysisCache) {
+        auto analysis = goal.minimize() ? storm::models::sparse::ModelAnalysisCache<ValueType>::QualitativeAnalysis::Prob01Min
+                                        : storm::models::sparse::ModelAnalysisCache<ValueType>::QualitativeAnalysis::Prob01Max;
+        statesWithProbability01 = analysisCache->getQualitativeResult(analysis, phiStates, psiStates, computeStatesWithProbability01);
     } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        statesWithProbability01 = computeStatesWithProbability01();
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -535,11 +560,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, analysisCache);
     }
 }
 
@@ -592,6 +618,16 @@ void computeFixedPointSystemUntilProbabilities(storm::solver::SolveGoal<ValueTyp
     goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
 }
 
+template<typename ValueType>
+void restrictToRelevantMaybeStates(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                   storm::storage::BitVector& maybeStates, std::vector<ValueType>& result, ValueType const& irrelevantValue) {
+    storm::storage::BitVector relevantMaybeStates = storm::utility::graph::getRelevantMaybeStates(transitionMatrix, goal.relevantValues(), maybeStates);
+    STORM_LOG_INFO("Preprocessing: " << relevantMaybeStates.getNumberOfSetBits() << " of " << maybeStates.getNumberOfSetBits()
+                                     << " maybe states are relevant.");
+    storm::utility::vector::setVectorValues<ValueType>(result, maybeStates & ~relevantMaybeStates, irrelevantValue);
+    maybeStates = std::move(relevantMaybeStates);
+}
+
 template<typename ValueType>
 boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(
     storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -642,7 +678,7 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
 
@@ -652,7 +688,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, analysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -681,6 +717,11 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
         storm::utility::vector::setVectorValues<ValueType>(result, qualitativeStateSets.maybeStates, storm::utility::convertNumber<ValueType>(0.5));
     } else {
+        if (goal.hasRelevantValues() && !produceScheduler) {
+            // Only solve for the maybe states that the relevant states depend on. The values of the other maybe states are set to 0.5 as above.
+            restrictToRelevantMaybeStates(goal, transitionMatrix, qualitativeStateSets.maybeStates, result, storm::utility::convertNumber<ValueType>(0.5));
+        }
+
         if (!qualitativeStateSets.maybeStates.empty()) {
             // In this case we have have to compute the remaining probabilities.
 
@@ -805,6 +846,113 @@ std::vector<ValueType> SparseMdpPrctlHelper<ValueType>::computeCumulativeRewards
     return result;
 }
 
+namespace {
+/*!
+ * Performs step-bounded value iteration for a batch of interleaved vectors. After each step, the given function may
+ * fix the values of some states. The values of each vector are extracted once its step bound is reached.
+ */
+template<typename ValueType>
+std::vector<std::vector<ValueType>> performStepBoundedIterationBatch(Environment const& env, OptimizationDirection dir,
+                                                                     storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const* b, std::vector<uint64_t> const& stepBounds,
+                                                                     std::function<void(std::vector<ValueType>&)> const& fixValues) {
+    uint64_t const batchSize = stepBounds.size();
+    uint64_t const stateCount = transitionMatrix.getRowGroupCount();
+    std::vector<std::vector<ValueType>> result(batchSize);
+    auto extract = [&](uint64_t vector) {
+        result[vector].resize(stateCount);
+        for (uint64_t state = 0; state < stateCount; ++state) {
+            result[vector][state] = x[state * batchSize + vector];
+        }
+    };
+
+    uint64_t const maximalStepBound = batchSize == 0 ? 0 : *std::max_element(stepBounds.begin(), stepBounds.end());
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, transitionMatrix);
+    storm::utility::ProgressMeasurement progress("steps");
+    progress.setMaxCount(maximalStepBound);
+    progress.startNewMeasurement(0);
+    for (uint64_t step = 0;; ++step) {
+        for (uint64_t vector = 0; vector < batchSize; ++vector) {
+            if (stepBounds[vector] == step) {
+                extract(vector);
+            }
+        }
+        if (step == maximalStepBound) {
+            break;
+        }
+        multiplier->multiplyAndReduceBatch(env, dir, batchSize, x, b, x);
+        if (fixValues) {
+            fixValues(x);
+        }
+        progress.updateProgress(step);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << step << " of " << maximalStepBound << " steps.");
+            for (uint64_t vector = 0; vector < batchSize; ++vector) {
+                if (result[vector].empty()) {
+                    extract(vector);
+                }
+            }
+            break;
+        }
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> SparseMdpPrctlHelper<ValueType>::computeStepBoundedUntilProbabilitiesBatch(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<storm::storage::BitVector> const& phiStates, std::vector<storm::storage::BitVector> const& psiStates, std::vector<uint64_t> const& stepBounds) {
+    STORM_LOG_THROW(phiStates.size() == psiStates.size() && psiStates.size() == stepBounds.size(), storm::exceptions::IllegalArgumentException,
+                    "The number of phi states, psi states and step bounds differ.");
+    uint64_t const batchSize = stepBounds.size();
+
+    // The psi states have value one and the states that satisfy neither phi nor psi have value zero, independent of the step.
+    std::vector<storm::storage::BitVector> zeroStates;
+    zeroStates.reserve(batchSize);
+    for (uint64_t vector = 0; vector < batchSize; ++vector) {
+        zeroStates.push_back(~(phiStates[vector] | psiStates[vector]));
+    }
+    auto fixValues = [&](std::vector<ValueType>& values) {
+        for (uint64_t vector = 0; vector < batchSize; ++vector) {
+            for (auto state : psiStates[vector]) {
+                values[state * batchSize + vector] = storm::utility::one<ValueType>();
+            }
+            for (auto state : zeroStates[vector]) {
+                values[state * batchSize + vector] = storm::utility::zero<ValueType>();
+            }
+        }
+    };
+
+    std::vector<ValueType> x(transitionMatrix.getRowGroupCount() * batchSize, storm::utility::zero<ValueType>());
+    fixValues(x);
+    return performStepBoundedIterationBatch<ValueType>(env, dir, transitionMatrix, x, nullptr, stepBounds, fixValues);
+}
+
+template<typename ValueType>
+template<typename RewardModelType>
+std::vector<std::vector<ValueType>> SparseMdpPrctlHelper<ValueType>::computeCumulativeRewardsBatch(Environment const& env, OptimizationDirection dir,
+                                                                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                                   std::vector<RewardModelType const*> const& rewardModels,
+                                                                                                   std::vector<uint64_t> const& stepBounds) {
+    STORM_LOG_THROW(rewardModels.size() == stepBounds.size(), storm::exceptions::IllegalArgumentException,
+                    "The number of reward models and step bounds differ.");
+    uint64_t const batchSize = stepBounds.size();
+
+    // Interleave the reward vectors that are added in each step.
+    std::vector<ValueType> b(transitionMatrix.getRowCount() * batchSize);
+    for (uint64_t vector = 0; vector < batchSize; ++vector) {
+        STORM_LOG_THROW(!rewardModels[vector]->empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
+        std::vector<ValueType> totalRewardVector = rewardModels[vector]->getTotalRewardVector(transitionMatrix);
+        for (uint64_t row = 0; row < totalRewardVector.size(); ++row) {
+            b[row * batchSize + vector] = totalRewardVector[row];
+        }
+    }
+
+    std::vector<ValueType> x(transitionMatrix.getRowGroupCount() * batchSize, storm::utility::zero<ValueType>());
+    return performStepBoundedIterationBatch<ValueType>(env, dir, transitionMatrix, x, &b, stepBounds, nullptr);
+}
+
 template<typename ValueType>
 template<typename RewardModelType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeTotalRewards(
@@ -1207,17 +1355,13 @@ boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSy
 }
 
 template<typename ValueType>
-void computeUpperRewardBounds(SparseMdpHintType<ValueType>& hintInformation, storm::OptimizationDirection const& direction,
+void computeUpperRewardBounds(Environment const& env, SparseMdpHintType<ValueType>& hintInformation, storm::OptimizationDirection const& direction,
                               storm::storage::SparseMatrix<ValueType> const& submatrix, std::vector<ValueType> const& choiceRewards,
                               std::vector<ValueType> const& oneStepTargetProbabilities) {
-    // For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
-    if (direction == storm::OptimizationDirection::Minimize) {
-        DsMpiMdpUpperRewardBoundsComputer<ValueType> dsmpi(submatrix, choiceRewards, oneStepTargetProbabilities);
-        hintInformation.upperResultBounds = dsmpi.computeUpperBounds();
-    } else {
-        BaierUpperRewardBoundsComputer<ValueType> baier(submatrix, choiceRewards, oneStepTargetProbabilities);
-        hintInformation.upperResultBound = baier.computeUpperBound();
-    }
+    // The bounds are computed SCC by SCC. For the min-case, we use DS-MPI, for the max-case variant 2 of the Baier et al. paper (CAV'17).
+    SccUpperRewardBoundsComputer<ValueType> boundsComputer(submatrix, choiceRewards, oneStepTargetProbabilities);
+    hintInformation.upperResultBounds =
+        boundsComputer.computeUpperBounds(direction, env.solver().topological().getNumberOfThreads(), env.solver().topological().getBatchSize());
 }
 
 template<typename ValueType>
@@ -1258,6 +1402,11 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         // are neither 0 nor infinity.
         storm::utility::vector::setVectorValues<ValueType>(result, qualitativeStateSets.maybeStates, storm::utility::one<ValueType>());
     } else {
+        if (goal.hasRelevantValues() && !produceScheduler) {
+            // Only solve for the maybe states that the relevant states depend on. The values of the other maybe states are set to 1 as above.
+            restrictToRelevantMaybeStates(goal, transitionMatrix, qualitativeStateSets.maybeStates, result, storm::utility::one<ValueType>());
+        }
+
         if (!qualitativeStateSets.maybeStates.empty()) {
             // In this case we have to compute the reward values for the remaining states.
 
@@ -1298,7 +1447,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             // If we need to compute upper bounds, do so now.
             if (hintInformation.getComputeUpperBounds()) {
                 STORM_LOG_ASSERT(oneStepTargetProbabilities, "Expecting one step target probability vector to be available.");
-                computeUpperRewardBounds(hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
+                computeUpperRewardBounds(env, hintInformation, goal.direction(), submatrix, b, oneStepTargetProbabilities.get());
             }
 
             // Now compute the results for the maybe states.
@@ -1341,7 +1490,7 @@ template<typename ValueType>
 std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditionalProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
-    storm::storage::BitVector const& conditionStates) {
+    storm::storage::BitVector const& conditionStates, storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
     std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
     // For the max-case, we can simply take the given target states. For the min-case, however, we need to
@@ -1361,10 +1510,34 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditional
 
     storm::storage::BitVector allStates(fixedTargetStates.size(), true);
 
+    // The qualitative analyses are looked up in (and stored to) the analysis cache, such that they are shared with other
+    // (conditional) queries and with the reachability computations below.
+    auto getQualitativeStateSets = [&](OptimizationDirection dir, storm::storage::BitVector const& psiStates) {
+        return computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType>(dir), transitionMatrix, backwardTransitions, allStates,
+                                                             psiStates, analysisCache);
+    };
+    auto getStatesWithProbability1A = [&](storm::storage::BitVector const& psiStates) {
+        if (analysisCache) {
+            return getQualitativeStateSets(OptimizationDirection::Minimize, psiStates).statesWithProbability1;
+        }
+        return storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+    };
+    auto getStatesWithProbability0A = [&](storm::storage::BitVector const& psiStates) {
+        if (analysisCache) {
+            return getQualitativeStateSets(OptimizationDirection::Maximize, psiStates).statesWithProbability0;
+        }
+        return storm::utility::graph::performProb0A(backwardTransitions, allStates, psiStates);
+    };
+    auto getStatesWithProbability0E = [&](storm::storage::BitVector const& psiStates) {
+        if (analysisCache) {
+            return getQualitativeStateSets(OptimizationDirection::Minimize, psiStates).statesWithProbability0;
+        }
+        return storm::utility::graph::performProb0E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+    };
+
     // Extend the target states by computing all states that have probability 1 to go to a target state
     // under *all* schedulers.
-    fixedTargetStates =
-        storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, fixedTargetStates);
+    fixedTargetStates = getStatesWithProbability1A(fixedTargetStates);
 
     // We solve the max-case and later adjust the result if the optimization direction was to minimize.
     storm::storage::BitVector initialStatesBitVector = goal.relevantValues();
@@ -1374,46 +1547,53 @@ std::unique_ptr<CheckResult> SparseMdpPrctlHelper<ValueType>::computeConditional
 
     // Extend the condition states by computing all states that have probability 1 to go to a condition state
     // under *all* schedulers.
-    storm::storage::BitVector extendedConditionStates =
-        storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, conditionStates);
-
-    STORM_LOG_DEBUG("Computing probabilities to satisfy condition.");
-    std::chrono::high_resolution_clock::time_point conditionStart = std::chrono::high_resolution_clock::now();
-    std::vector<ValueType> conditionProbabilities = std::move(
-        computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, extendedConditionStates, false, false)
-            .values);
-    std::chrono::high_resolution_clock::time_point conditionEnd = std::chrono::high_resolution_clock::now();
-    STORM_LOG_DEBUG("Computed probabilities to satisfy for condition in "
-                    << std::chrono::duration_cast<std::chrono::milliseconds>(conditionEnd - conditionStart).count() << "ms.");
-
-    // If the conditional probability is undefined for the initial state, we return directly.
-    if (storm::utility::isZero(conditionProbabilities[initialState])) {
+    storm::storage::BitVector extendedConditionStates = getStatesWithProbability1A(conditionStates);
+
+    // The states that reach a condition state with probability 0 under all schedulers are the ones that need to be reset.
+    // If the initial state is one of them, the conditional probability is undefined and we return directly.
+    storm::storage::BitVector pureResetStates = getStatesWithProbability0A(extendedConditionStates);
+    if (pureResetStates.get(initialState)) {
         return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(initialState, storm::utility::infinity<ValueType>()));
     }
 
-    STORM_LOG_DEBUG("Computing probabilities to reach target.");
-    std::chrono::high_resolution_clock::time_point targetStart = std::chrono::high_resolution_clock::now();
-    std::vector<ValueType> targetProbabilities = std::move(
-        computeUntilProbabilities(env, OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates, fixedTargetStates, false, false)
-            .values);
-    std::chrono::high_resolution_clock::time_point targetEnd = std::chrono::high_resolution_clock::now();
-    STORM_LOG_DEBUG("Computed probabilities to reach target in " << std::chrono::duration_cast<std::chrono::milliseconds>(targetEnd - targetStart).count()
-                                                                 << "ms.");
-
-    storm::storage::BitVector statesWithProbabilityGreater0E(transitionMatrix.getRowGroupCount(), true);
-    storm::storage::sparse::state_type state = 0;
-    for (auto const& element : conditionProbabilities) {
-        if (storm::utility::isZero(element)) {
-            statesWithProbabilityGreater0E.set(state, false);
-        }
-        ++state;
+    // The probabilities to satisfy the condition and to reach the target are independent of each other, so (for floating
+    // point computations) they are computed concurrently, each with its own copy of the environment. Both use the
+    // original transition matrix and share its qualitative analyses via the cache.
+    STORM_LOG_DEBUG("Computing probabilities to satisfy condition and to reach target.");
+    std::chrono::high_resolution_clock::time_point reachabilityStart = std::chrono::high_resolution_clock::now();
+    std::vector<storm::storage::BitVector const*> reachabilityTargets = {&extendedConditionStates, &fixedTargetStates};
+    std::vector<std::vector<ValueType>> reachabilityProbabilities(reachabilityTargets.size());
+    std::vector<Environment> environments(reachabilityTargets.size(), env);
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? std::min<uint64_t>(storm::utility::parallel::getDefaultNumberOfThreads(), 2) : 1;
+    if (numberOfThreads > 1) {
+        // Data of the matrices that is initialized lazily is initialized upfront, such that the matrices are only read concurrently.
+        transitionMatrix.getRowGroupIndices();
+        backwardTransitions.getRowGroupIndices();
+    }
+    storm::utility::parallel::forEachTaskInDependencyOrder(
+        std::vector<std::vector<uint64_t>>(reachabilityTargets.size()), numberOfThreads, [&](uint64_t, uint64_t task) {
+            reachabilityProbabilities[task] =
+                std::move(computeUntilProbabilities(environments[task], OptimizationDirection::Maximize, transitionMatrix, backwardTransitions, allStates,
+                                                    *reachabilityTargets[task], false, false, ModelCheckerHint(), analysisCache)
+                              .values);
+        });
+    std::vector<ValueType> const& conditionProbabilities = reachabilityProbabilities[0];
+    std::vector<ValueType> const& targetProbabilities = reachabilityProbabilities[1];
+    std::chrono::high_resolution_clock::time_point reachabilityEnd = std::chrono::high_resolution_clock::now();
+    STORM_LOG_DEBUG("Computed probabilities to satisfy condition and to reach target in "
+                    << std::chrono::duration_cast<std::chrono::milliseconds>(reachabilityEnd - reachabilityStart).count() << "ms.");
+
+    // If the initial state satisfies the condition almost surely, the conditional probability is the probability to reach the target.
+    // Otherwise, if the initial state reaches the target almost surely, the reset mechanism makes it reach the goal almost surely.
+    if (extendedConditionStates.get(initialState) || fixedTargetStates.get(initialState)) {
+        ValueType result = fixedTargetStates.get(initialState) ? storm::utility::one<ValueType>() : targetProbabilities[initialState];
+        return std::unique_ptr<CheckResult>(
+            new ExplicitQuantitativeCheckResult<ValueType>(initialState, goal.minimize() ? storm::utility::one<ValueType>() - result : result));
     }
 
     // Determine those states that need to be equipped with a restart mechanism.
     STORM_LOG_DEBUG("Computing problematic states.");
-    storm::storage::BitVector pureResetStates = storm::utility::graph::performProb0A(backwardTransitions, allStates, extendedConditionStates);
-    storm::storage::BitVector problematicStates = storm::utility::graph::performProb0E(
-        transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, extendedConditionStates | fixedTargetStates);
+    storm::storage::BitVector problematicStates = getStatesWithProbability0E(extendedConditionStates | fixedTargetStates);
 
     // Otherwise, we build the transformed MDP.
     storm::storage::BitVector relevantStates = storm::utility::graph::getReachableStates(transitionMatrix, initialStatesBitVector, allStates,
@@ -1514,6 +1694,9 @@ template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewa
                                                                                     storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                                     storm::models::sparse::StandardRewardModel<double> const& rewardModel,
                                                                                     uint_fast64_t stepBound);
+template std::vector<std::vector<double>> SparseMdpPrctlHelper<double>::computeCumulativeRewardsBatch(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<storm::models::sparse::StandardRewardModel<double> const*> const& rewardModels, std::vector<uint64_t> const& stepBounds);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
@@ -1531,6 +1714,9 @@ template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::Rational
 template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeCumulativeRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, uint_fast64_t stepBound);
+template std::vector<std::vector<storm::RationalNumber>> SparseMdpPrctlHelper<storm::RationalNumber>::computeCumulativeRewardsBatch(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<storm::models::sparse::StandardRewardModel<storm::RationalNumber> const*> const& rewardModels, std::vector<uint64_t> const& stepBounds);
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
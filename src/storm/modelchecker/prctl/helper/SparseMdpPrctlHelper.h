@@ -27,7 +27,9 @@ namespace models {
 namespace sparse {
 template<typename ValueType>
 class StandardRewardModel;
-}
+template<typename ValueType>
+class ModelAnalysisCache;
+}  // namespace sparse
 }  // namespace models
 
 namespace modelchecker {
@@ -46,10 +48,15 @@ class SparseMdpPrctlHelper {
                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                            storm::storage::BitVector const& nextStates);
 
+    /*!
+     * Computes the until probabilities. If an analysis cache is given, it must belong to the model with the given transition
+     * matrix and is used to look up and store the states with probability zero and one.
+     */
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -67,6 +74,33 @@ class SparseMdpPrctlHelper {
                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix, RewardModelType const& rewardModel,
                                                            uint_fast64_t stepBound);
 
+    /*!
+     * Computes the step-bounded until probabilities for several pairs of phi and psi states at once. The multiplications
+     * for all pairs are performed in a single pass over the transition matrix.
+     *
+     * @param phiStates The phi states of each pair.
+     * @param psiStates The psi states of each pair.
+     * @param stepBounds The (non-strict) step bound of each pair.
+     * @return The values of each pair for all states.
+     */
+    static std::vector<std::vector<ValueType>> computeStepBoundedUntilProbabilitiesBatch(Environment const& env, OptimizationDirection dir,
+                                                                                         storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                         std::vector<storm::storage::BitVector> const& phiStates,
+                                                                                         std::vector<storm::storage::BitVector> const& psiStates,
+                                                                                         std::vector<uint64_t> const& stepBounds);
+
+    /*!
+     * Computes the cumulative rewards for several reward models (and step bounds) at once. The multiplications for all
+     * reward models are performed in a single pass over the transition matrix.
+     *
+     * @return The values of each reward model for all states.
+     */
+    template<typename RewardModelType>
+    static std::vector<std::vector<ValueType>> computeCumulativeRewardsBatch(Environment const& env, OptimizationDirection dir,
+                                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                             std::vector<RewardModelType const*> const& rewardModels,
+                                                                             std::vector<uint64_t> const& stepBounds);
+
     template<typename RewardModelType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeTotalRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -94,11 +128,17 @@ class SparseMdpPrctlHelper {
                                                              bool lowerBoundOfIntervals, storm::storage::BitVector const& targetStates, bool qualitative);
 #endif
 
+    /*!
+     * Computes the conditional probabilities by transforming the MDP such that the conditional probabilities are the reachability probabilities of
+     * a goal state. If an analysis cache is given, it must belong to the model with the given transition matrix and is used to look up and store
+     * the qualitative analyses.
+     */
     static std::unique_ptr<CheckResult> computeConditionalProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                         storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                         storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                         storm::storage::BitVector const& targetStates,
-                                                                        storm::storage::BitVector const& conditionStates);
+                                                                        storm::storage::BitVector const& conditionStates,
+                                                                        storm::models::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
 
    private:
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityRewardsHelper(
@@ -16,19 +16,19 @@ namespace rewardbounded {
 template<typename ValueType>
 std::vector<ValueType> analyzeTrivialDtmcEpochModel(EpochModel<ValueType, true> &epochModel) {
     std::vector<ValueType> epochResult;
-    epochResult.reserve(epochModel.epochInStates.getNumberOfSetBits());
+    epochResult.reserve(epochModel.structure->epochInStates.getNumberOfSetBits());
     auto stepSolutionIt = epochModel.stepSolutions.begin();
-    auto stepChoiceIt = epochModel.stepChoices.begin();
-    for (auto state : epochModel.epochInStates) {
+    auto stepChoiceIt = epochModel.structure->stepChoices.begin();
+    for (auto state : epochModel.structure->epochInStates) {
         while (*stepChoiceIt < state) {
             ++stepChoiceIt;
             ++stepSolutionIt;
         }
         if (epochModel.objectiveRewardFilter.front().get(state)) {
             if (*stepChoiceIt == state) {
-                epochResult.push_back(epochModel.objectiveRewards.front()[state] + *stepSolutionIt);
+                epochResult.push_back(epochModel.structure->objectiveRewards.front()[state] + *stepSolutionIt);
             } else {
-                epochResult.push_back(epochModel.objectiveRewards.front()[state]);
+                epochResult.push_back(epochModel.structure->objectiveRewards.front()[state]);
             }
         } else {
             if (*stepChoiceIt == state) {
@@ -47,20 +47,20 @@ std::vector<ValueType> analyzeNonTrivialDtmcEpochModel(Environment const &env, E
                                                        boost::optional<ValueType> const &lowerBound, boost::optional<ValueType> const &upperBound) {
     // Update some data for the case that the Matrix has changed
     if (epochModel.epochMatrixChanged) {
-        x.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        x.assign(epochModel.structure->epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
         storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
         // We only check for acyclic models if the equation problem has the fixedPointSystem format.
         // We could also do this for other formats, however, this requires either matrix conversions or a different 'hasCycle' implementation.
         // Also, we would have to match the equationProblemFormat of the acyclic solver.
         bool epochMatrixAcyclic = epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem &&
-                                  !storm::utility::graph::hasCycle(epochModel.epochMatrix);
+                                  !storm::utility::graph::hasCycle(epochModel.structure->epochMatrix);
         Environment acyclicEnv;
         if (epochMatrixAcyclic) {
             acyclicEnv = env;
             acyclicEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Acyclic);
-            linEqSolver = linearEquationSolverFactory.create(acyclicEnv, epochModel.epochMatrix);
+            linEqSolver = linearEquationSolverFactory.create(acyclicEnv, epochModel.structure->epochMatrix);
         } else {
-            linEqSolver = linearEquationSolverFactory.create(env, epochModel.epochMatrix);
+            linEqSolver = linearEquationSolverFactory.create(env, epochModel.structure->epochMatrix);
         }
         linEqSolver->setCachingEnabled(true);
         auto req = linEqSolver->getRequirements(epochMatrixAcyclic ? acyclicEnv : env);
@@ -83,13 +83,13 @@ std::vector<ValueType> analyzeNonTrivialDtmcEpochModel(Environment const &env, E
     }
 
     // Prepare the right hand side of the equation system
-    b.assign(epochModel.epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
-    std::vector<ValueType> const &objectiveValues = epochModel.objectiveRewards.front();
+    b.assign(epochModel.structure->epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
+    std::vector<ValueType> const &objectiveValues = epochModel.structure->objectiveRewards.front();
     for (auto choice : epochModel.objectiveRewardFilter.front()) {
         b[choice] = objectiveValues[choice];
     }
     auto stepSolutionIt = epochModel.stepSolutions.begin();
-    for (auto choice : epochModel.stepChoices) {
+    for (auto choice : epochModel.structure->stepChoices) {
         b[choice] += *stepSolutionIt;
         ++stepSolutionIt;
     }
@@ -98,25 +98,25 @@ std::vector<ValueType> analyzeNonTrivialDtmcEpochModel(Environment const &env, E
     // Solve the minMax equation system
     linEqSolver->solveEquations(env, x, b);
 
-    return storm::utility::vector::filterVector(x, epochModel.epochInStates);
+    return storm::utility::vector::filterVector(x, epochModel.structure->epochInStates);
 }
 
 template<typename ValueType>
 std::vector<ValueType> analyzeTrivialMdpEpochModel(OptimizationDirection dir, EpochModel<ValueType, true> &epochModel) {
     // Assert that the epoch model is indeed trivial
-    assert(epochModel.epochMatrix.getEntryCount() == 0);
+    assert(epochModel.structure->epochMatrix.getEntryCount() == 0);
 
     std::vector<ValueType> epochResult;
-    epochResult.reserve(epochModel.epochInStates.getNumberOfSetBits());
+    epochResult.reserve(epochModel.structure->epochInStates.getNumberOfSetBits());
 
     auto stepSolutionIt = epochModel.stepSolutions.begin();
-    auto stepChoiceIt = epochModel.stepChoices.begin();
-    for (auto state : epochModel.epochInStates) {
+    auto stepChoiceIt = epochModel.structure->stepChoices.begin();
+    for (auto state : epochModel.structure->epochInStates) {
         // Obtain the best choice for this state
         ValueType bestValue;
-        uint64_t lastChoice = epochModel.epochMatrix.getRowGroupIndices()[state + 1];
+        uint64_t lastChoice = epochModel.structure->epochMatrix.getRowGroupIndices()[state + 1];
         bool isFirstChoice = true;
-        for (uint64_t choice = epochModel.epochMatrix.getRowGroupIndices()[state]; choice < lastChoice; ++choice) {
+        for (uint64_t choice = epochModel.structure->epochMatrix.getRowGroupIndices()[state]; choice < lastChoice; ++choice) {
             while (*stepChoiceIt < choice) {
                 ++stepChoiceIt;
                 ++stepSolutionIt;
@@ -124,7 +124,7 @@ std::vector<ValueType> analyzeTrivialMdpEpochModel(OptimizationDirection dir, Ep
 
             ValueType choiceValue = storm::utility::zero<ValueType>();
             if (epochModel.objectiveRewardFilter.front().get(choice)) {
-                choiceValue += epochModel.objectiveRewards.front()[choice];
+                choiceValue += epochModel.structure->objectiveRewards.front()[choice];
             }
             if (*stepChoiceIt == choice) {
                 choiceValue += *stepSolutionIt;
@@ -158,16 +158,16 @@ std::vector<ValueType> analyzeNonTrivialMdpEpochModel(Environment const &env, Op
                                                       boost::optional<ValueType> const &lowerBound, boost::optional<ValueType> const &upperBound) {
     // Update some data for the case that the Matrix has changed
     if (epochModel.epochMatrixChanged) {
-        x.assign(epochModel.epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+        x.assign(epochModel.structure->epochMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
         storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
-        bool epochMatrixAcyclic = !storm::utility::graph::hasCycle(epochModel.epochMatrix);
+        bool epochMatrixAcyclic = !storm::utility::graph::hasCycle(epochModel.structure->epochMatrix);
         Environment acyclicEnv;
         if (epochMatrixAcyclic) {
             acyclicEnv = env;
             acyclicEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::Acyclic);
-            minMaxSolver = minMaxLinearEquationSolverFactory.create(acyclicEnv, epochModel.epochMatrix);
+            minMaxSolver = minMaxLinearEquationSolverFactory.create(acyclicEnv, epochModel.structure->epochMatrix);
         } else {
-            minMaxSolver = minMaxLinearEquationSolverFactory.create(env, epochModel.epochMatrix);
+            minMaxSolver = minMaxLinearEquationSolverFactory.create(env, epochModel.structure->epochMatrix);
         }
         minMaxSolver->setHasUniqueSolution();
         minMaxSolver->setHasNoEndComponents();
@@ -197,13 +197,13 @@ std::vector<ValueType> analyzeNonTrivialMdpEpochModel(Environment const &env, Op
     }
 
     // Prepare the right hand side of the equation system
-    b.assign(epochModel.epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
-    std::vector<ValueType> const &objectiveValues = epochModel.objectiveRewards.front();
+    b.assign(epochModel.structure->epochMatrix.getRowCount(), storm::utility::zero<ValueType>());
+    std::vector<ValueType> const &objectiveValues = epochModel.structure->objectiveRewards.front();
     for (auto choice : epochModel.objectiveRewardFilter.front()) {
         b[choice] = objectiveValues[choice];
     }
     auto stepSolutionIt = epochModel.stepSolutions.begin();
-    for (auto choice : epochModel.stepChoices) {
+    for (auto choice : epochModel.structure->stepChoices) {
         b[choice] += *stepSolutionIt;
         ++stepSolutionIt;
     }
@@ -212,18 +212,18 @@ std::vector<ValueType> analyzeNonTrivialMdpEpochModel(Environment const &env, Op
     // Solve the minMax equation system
     minMaxSolver->solveEquations(env, x, b);
 
-    return storm::utility::vector::filterVector(x, epochModel.epochInStates);
+    return storm::utility::vector::filterVector(x, epochModel.structure->epochInStates);
 }
 
 template<>
 std::vector<double> EpochModel<double, true>::analyzeSingleObjective(const storm::Environment &env, std::vector<double> &x, std::vector<double> &b,
                                                                      std::unique_ptr<storm::solver::LinearEquationSolver<double>> &linEqSolver,
                                                                      const boost::optional<double> &lowerBound, const boost::optional<double> &upperBound) {
-    STORM_LOG_ASSERT(epochMatrix.hasTrivialRowGrouping(), "This operation is only allowed if no nondeterminism is present.");
+    STORM_LOG_ASSERT(structure->epochMatrix.hasTrivialRowGrouping(), "This operation is only allowed if no nondeterminism is present.");
     STORM_LOG_ASSERT(equationSolverProblemFormat.is_initialized(), "Unknown equation problem format.");
     // If the epoch matrix is empty we do not need to solve a linear equation system
     bool convertToEquationSystem = (equationSolverProblemFormat == storm::solver::LinearEquationSolverProblemFormat::EquationSystem);
-    if ((convertToEquationSystem && epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochMatrix.getEntryCount() == 0)) {
+    if ((convertToEquationSystem && structure->epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && structure->epochMatrix.getEntryCount() == 0)) {
         return analyzeTrivialDtmcEpochModel<double>(*this);
     } else {
         return analyzeNonTrivialDtmcEpochModel<double>(env, *this, x, b, linEqSolver, lowerBound, upperBound);
@@ -236,7 +236,7 @@ std::vector<double> EpochModel<double, true>::analyzeSingleObjective(const storm
                                                                      std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<double>> &minMaxSolver,
                                                                      const boost::optional<double> &lowerBound, const boost::optional<double> &upperBound) {
     // If the epoch matrix is empty we do not need to solve a linear equation system
-    if (epochMatrix.getEntryCount() == 0) {
+    if (structure->epochMatrix.getEntryCount() == 0) {
         return analyzeTrivialMdpEpochModel<double>(dir, *this);
     } else {
         return analyzeNonTrivialMdpEpochModel<double>(env, dir, *this, x, b, minMaxSolver, lowerBound, upperBound);
@@ -248,11 +248,11 @@ std::vector<storm::RationalNumber> EpochModel<storm::RationalNumber, true>::anal
     const storm::Environment &env, std::vector<storm::RationalNumber> &x, std::vector<storm::RationalNumber> &b,
     std::unique_ptr<storm::solver::LinearEquationSolver<storm::RationalNumber>> &linEqSolver, const boost::optional<storm::RationalNumber> &lowerBound,
     const boost::optional<storm::RationalNumber> &upperBound) {
-    STORM_LOG_ASSERT(epochMatrix.hasTrivialRowGrouping(), "This operation is only allowed if no nondeterminism is present.");
+    STORM_LOG_ASSERT(structure->epochMatrix.hasTrivialRowGrouping(), "This operation is only allowed if no nondeterminism is present.");
     STORM_LOG_ASSERT(equationSolverProblemFormat.is_initialized(), "Unknown equation problem format.");
     // If the epoch matrix is empty we do not need to solve a linear equation system
     bool convertToEquationSystem = (equationSolverProblemFormat == storm::solver::LinearEquationSolverProblemFormat::EquationSystem);
-    if ((convertToEquationSystem && epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochMatrix.getEntryCount() == 0)) {
+    if ((convertToEquationSystem && structure->epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && structure->epochMatrix.getEntryCount() == 0)) {
         return analyzeTrivialDtmcEpochModel<storm::RationalNumber>(*this);
     } else {
         return analyzeNonTrivialDtmcEpochModel<storm::RationalNumber>(env, *this, x, b, linEqSolver, lowerBound, upperBound);
@@ -265,7 +265,7 @@ std::vector<storm::RationalNumber> EpochModel<storm::RationalNumber, true>::anal
     std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>> &minMaxSolver, const boost::optional<storm::RationalNumber> &lowerBound,
     const boost::optional<storm::RationalNumber> &upperBound) {
     // If the epoch matrix is empty we do not need to solve a linear equation system
-    if (epochMatrix.getEntryCount() == 0) {
+    if (structure->epochMatrix.getEntryCount() == 0) {
         return analyzeTrivialMdpEpochModel<storm::RationalNumber>(dir, *this);
     } else {
         return analyzeNonTrivialMdpEpochModel<storm::RationalNumber>(env, dir, *this, x, b, minMaxSolver, lowerBound, upperBound);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolverProblemFormat.h"
@@ -14,17 +15,28 @@ class Environment;
 namespace modelchecker {
 namespace helper {
 namespace rewardbounded {
+
+/*!
+ * The part of an epoch model that only depends on the class of the epoch. It is not modified once built, so all epochs of the class share it.
+ */
+template<typename ValueType>
+struct EpochModelStructure {
+    storm::storage::SparseMatrix<ValueType> epochMatrix;
+    storm::storage::BitVector stepChoices;
+    std::vector<std::vector<ValueType>> objectiveRewards;
+    /// The objective reward filters of the epoch model, except for the step choices (which depend on the epoch).
+    std::vector<storm::storage::BitVector> objectiveRewardFilter;
+    storm::storage::BitVector epochInStates;
+};
+
 template<typename ValueType, bool SingleObjectiveMode>
 struct EpochModel {
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
 
     bool epochMatrixChanged;
-    storm::storage::SparseMatrix<ValueType> epochMatrix;
-    storm::storage::BitVector stepChoices;
+    std::shared_ptr<EpochModelStructure<ValueType> const> structure;
     std::vector<SolutionType> stepSolutions;
-    std::vector<std::vector<ValueType>> objectiveRewards;
     std::vector<storm::storage::BitVector> objectiveRewardFilter;
-    storm::storage::BitVector epochInStates;
     /// In case of DTMCs we have different options for the equation problem format the epoch model will have.
     boost::optional<storm::solver::LinearEquationSolverProblemFormat> equationSolverProblemFormat;
 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <set>
 #include <string>
@@ -17,6 +19,8 @@
 #include "storm/storage/expressions/Expressions.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -399,19 +403,24 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
 
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    return setCurrentEpoch(epoch, epochData);
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch, EpochAnalysisData& data) {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
 
     // Check if we need to update the current epoch class
-    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
-        epochModel.epochMatrixChanged = true;
+    if (!data.currentEpoch || !epochManager.compareEpochClass(epoch, data.currentEpoch.get())) {
+        setCurrentEpochClass(epoch, data);
+        data.epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+            if (storm::utility::graph::hasCycle(data.epochModel.structure->epochMatrix)) {
                 std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
             }
         }
     } else {
-        epochModel.epochMatrixChanged = false;
+        data.epochModel.epochMatrixChanged = false;
     }
 
     bool containsLowerBoundedObjective = false;
@@ -422,6 +431,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         }
     }
     std::map<Epoch, EpochSolution const*> subSolutions;
+    std::unique_lock<std::mutex> solutionsLock(epochSolutionsMutex);
     for (auto const& step : possibleEpochSteps) {
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
         if (successorEpoch != epoch) {
@@ -430,10 +440,11 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             subSolutions.emplace(successorEpoch, &successorSolIt->second);
         }
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
-        uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
+    solutionsLock.unlock();
+    data.epochModel.stepSolutions.resize(data.epochModel.structure->stepChoices.getNumberOfSetBits());
+    auto stepSolIt = data.epochModel.stepSolutions.begin();
+    for (auto reducedChoice : data.epochModel.structure->stepChoices) {
+        uint64_t productChoice = data.epochClassData->epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, productModel->getSteps()[productChoice]);
@@ -443,7 +454,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(data.epochModel.structure->objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -453,7 +464,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            data.epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -486,33 +497,65 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         ++stepSolIt;
     }
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+    assert(data.epochModel.structure->objectiveRewards.size() == objectives.size());
+    assert(data.epochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(data.epochModel.structure->epochMatrix.getRowCount() == data.epochModel.structure->stepChoices.size());
+    assert(data.epochModel.structure->stepChoices.size() == data.epochModel.structure->objectiveRewards.front().size());
+    assert(data.epochModel.structure->objectiveRewards.front().size() == data.epochModel.structure->objectiveRewards.back().size());
+    assert(data.epochModel.structure->objectiveRewards.front().size() == data.epochModel.objectiveRewardFilter.front().size());
+    assert(data.epochModel.structure->objectiveRewards.back().size() == data.epochModel.objectiveRewardFilter.back().size());
+    assert(data.epochModel.structure->stepChoices.getNumberOfSetBits() == data.epochModel.stepSolutions.size());
 
-    currentEpoch = epoch;
+    data.currentEpoch = epoch;
     /*
     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "Matrix: \n" << data.epochModel.structure->epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(data.epochModel.structure->objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << data.epochModel.structure->stepChoices << '\n';
     std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+    for (int i = 0; i < data.epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << data.epochModel.stepSolutions[i].weightedValue;
     }
     std::cout << '\n';
     */
-    return epochModel;
+    return data.epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch, EpochAnalysisData& data) {
+    EpochClass epochClass = epochManager.getEpochClass(epoch);
+    std::shared_ptr<EpochClassData const> classData;
+    {
+        std::lock_guard<std::mutex> cacheLock(epochClassCacheMutex);
+        auto cacheIt = epochClassCache.find(epochClass);
+        if (cacheIt != epochClassCache.end()) {
+            STORM_LOG_TRACE("Taking epoch model structure for epoch " << epochManager.toString(epoch) << " from the cache.");
+            classData = cacheIt->second;
+        }
+    }
+    if (!classData) {
+        classData = buildEpochClassData(epoch, data);
+        // Cache the data, unless the cached matrices would exceed the product matrix
+        std::lock_guard<std::mutex> cacheLock(epochClassCacheMutex);
+        uint64_t const entryCount = classData->epochModelStructure->epochMatrix.getEntryCount();
+        uint64_t const maxCacheEntryCount = productModel->getProduct().getTransitionMatrix().getEntryCount();
+        if (epochClassCache.count(epochClass) == 0 && epochClassCacheEntryCount + entryCount <= maxCacheEntryCount) {
+            epochClassCacheEntryCount += entryCount;
+            epochClassCache.emplace(epochClass, classData);
+        }
+    }
+    data.epochClassData = classData;
+    data.epochModel.structure = classData->epochModelStructure;
+    // The filters of the step choices are set per epoch.
+    data.epochModel.objectiveRewardFilter = classData->epochModelStructure->objectiveRewardFilter;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+std::shared_ptr<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochClassData const>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::buildEpochClassData(Epoch const& epoch, EpochAnalysisData const& data) {
     EpochClass epochClass = epochManager.getEpochClass(epoch);
+    auto classData = std::make_shared<EpochClassData>();
+    auto structure = std::make_shared<EpochModelStructure<ValueType>>();
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
 
@@ -524,7 +567,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
         ++choice;
     }
-    epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
+    structure->epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
     // redirect transitions for the case where the lower reward bounds are not met yet
     storm::storage::BitVector violatedLowerBoundedDimensions(dimensions.size(), false);
     for (uint64_t dim = 0; dim < dimensions.size(); ++dim) {
@@ -533,9 +576,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
     }
     if (!violatedLowerBoundedDimensions.empty()) {
-        for (uint64_t state = 0; state < epochModel.epochMatrix.getRowGroupCount(); ++state) {
+        for (uint64_t state = 0; state < structure->epochMatrix.getRowGroupCount(); ++state) {
             auto const& memoryState = productModel->getMemoryState(state);
-            for (auto& entry : epochModel.epochMatrix.getRowGroup(state)) {
+            for (auto& entry : structure->epochMatrix.getRowGroup(state)) {
                 entry.setColumn(productModel->transformProductState(entry.getColumn(), epochClass, memoryState));
             }
         }
@@ -553,10 +596,10 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     storm::storage::BitVector productInStates = productModel->getInStates(epochClass);
     // The epoch model only needs to consider the states that are reachable from a relevant state
     storm::storage::BitVector consideredStates =
-        storm::utility::graph::getReachableStates(epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
+        storm::utility::graph::getReachableStates(structure->epochMatrix, productInStates, allProductStates, ~allProductStates);
 
     // We assume that there is no end component in which objective reward is earned
-    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(epochModel.epochMatrix, epochModel.epochMatrix.transpose(true), allProductStates,
+    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(structure->epochMatrix, structure->epochMatrix.transpose(true), allProductStates,
                                                                        ~zeroObjRewardChoices & ~stepChoices),
                      "There is a scheduler that yields infinite reward for one objective. This case should be excluded");
 
@@ -565,11 +608,11 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     if (model.isOfType(storm::models::ModelType::Dtmc)) {
         assert(zeroObjRewardChoices.size() == productModel->getProduct().getNumberOfStates());
         assert(stepChoices.size() == productModel->getProduct().getNumberOfStates());
-        STORM_LOG_ASSERT(epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
-        bool convertToEquationSystem = epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+        STORM_LOG_ASSERT(data.epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
+        bool convertToEquationSystem = data.epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
         // For DTMCs we consider the subsystem induced by the considered states.
         // The transitions for states with zero reward are filtered out to guarantee a unique solution of the eq-system.
-        auto backwardTransitions = epochModel.epochMatrix.transpose(true);
+        auto backwardTransitions = structure->epochMatrix.transpose(true);
         storm::storage::BitVector nonZeroRewardStates =
             storm::utility::graph::performProbGreater0(backwardTransitions, consideredStates, consideredStates & (~zeroObjRewardChoices | stepChoices));
         // If there is at least one considered state with reward zero, we have to add a 'zero-reward-state' to the epoch model.
@@ -582,93 +625,100 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         storm::storage::SparseMatrixBuilder<ValueType> builder;
         if (!nonZeroRewardStates.empty()) {
             builder = storm::storage::SparseMatrixBuilder<ValueType>(
-                epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
+                structure->epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
         }
         if (requiresZeroRewardState) {
             if (convertToEquationSystem) {
                 // add a diagonal entry
                 builder.addNextValue(zeroRewardInState, zeroRewardInState, storm::utility::zero<ValueType>());
             }
-            epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
+            structure->epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
         } else {
             assert(!nonZeroRewardStates.empty());
-            epochModel.epochMatrix = builder.build();
+            structure->epochMatrix = builder.build();
         }
         if (convertToEquationSystem) {
-            epochModel.epochMatrix.convertToEquationSystem();
+            structure->epochMatrix.convertToEquationSystem();
         }
 
-        epochModelToProductChoiceMap.clear();
-        epochModelToProductChoiceMap.reserve(numEpochModelStates);
+        classData->epochModelToProductChoiceMap.clear();
+        classData->epochModelToProductChoiceMap.reserve(numEpochModelStates);
         productToEpochModelStateMapping.assign(nonZeroRewardStates.size(), zeroRewardInState);
         for (auto productState : nonZeroRewardStates) {
-            productToEpochModelStateMapping[productState] = epochModelToProductChoiceMap.size();
-            epochModelToProductChoiceMap.push_back(productState);
+            productToEpochModelStateMapping[productState] = classData->epochModelToProductChoiceMap.size();
+            classData->epochModelToProductChoiceMap.push_back(productState);
         }
         if (requiresZeroRewardState) {
             uint64_t zeroRewardProductState = (consideredStates & ~nonZeroRewardStates).getNextSetIndex(0);
             assert(zeroRewardProductState < consideredStates.size());
-            epochModelToProductChoiceMap.push_back(zeroRewardProductState);
+            classData->epochModelToProductChoiceMap.push_back(zeroRewardProductState);
         }
     } else if (model.isOfType(storm::models::ModelType::Mdp)) {
         // Eliminate zero-reward end components
-        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(epochModel.epochMatrix, consideredStates,
+        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(structure->epochMatrix, consideredStates,
                                                                                              zeroObjRewardChoices & ~stepChoices, consideredStates);
-        epochModel.epochMatrix = std::move(ecElimResult.matrix);
-        epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
+        structure->epochMatrix = std::move(ecElimResult.matrix);
+        classData->epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
         productToEpochModelStateMapping = std::move(ecElimResult.oldToNewStateMapping);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unsupported model type.");
     }
 
-    epochModel.stepChoices = storm::storage::BitVector(epochModel.epochMatrix.getRowCount(), false);
-    for (uint64_t choice = 0; choice < epochModel.epochMatrix.getRowCount(); ++choice) {
-        if (stepChoices.get(epochModelToProductChoiceMap[choice])) {
-            epochModel.stepChoices.set(choice, true);
+    structure->stepChoices = storm::storage::BitVector(structure->epochMatrix.getRowCount(), false);
+    for (uint64_t choice = 0; choice < structure->epochMatrix.getRowCount(); ++choice) {
+        if (stepChoices.get(classData->epochModelToProductChoiceMap[choice])) {
+            structure->stepChoices.set(choice, true);
         }
     }
 
-    epochModel.objectiveRewards.clear();
+    structure->objectiveRewards.clear();
     for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
         std::vector<ValueType> const& productObjRew = productObjectiveRewards[objIndex];
         std::vector<ValueType> reducedModelObjRewards;
-        reducedModelObjRewards.reserve(epochModel.epochMatrix.getRowCount());
-        for (auto const& productChoice : epochModelToProductChoiceMap) {
+        reducedModelObjRewards.reserve(structure->epochMatrix.getRowCount());
+        for (auto const& productChoice : classData->epochModelToProductChoiceMap) {
             reducedModelObjRewards.push_back(productObjRew[productChoice]);
         }
         // Check if the objective is violated in the current epoch
         if (!violatedLowerBoundedDimensions.isDisjointFrom(objectiveDimensions[objIndex])) {
-            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~epochModel.stepChoices, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~structure->stepChoices, storm::utility::zero<ValueType>());
         }
-        epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
+        structure->objectiveRewards.push_back(std::move(reducedModelObjRewards));
     }
 
-    epochModel.epochInStates = storm::storage::BitVector(epochModel.epochMatrix.getRowGroupCount(), false);
+    structure->epochInStates = storm::storage::BitVector(structure->epochMatrix.getRowGroupCount(), false);
     for (auto productState : productInStates) {
-        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < epochModel.epochMatrix.getRowGroupCount(),
+        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < structure->epochMatrix.getRowGroupCount(),
                          "Selected product state does not exist in the epoch model.");
-        epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
+        structure->epochInStates.set(productToEpochModelStateMapping[productState], true);
     }
 
     std::vector<uint64_t> toEpochModelInStatesMap(productModel->getProduct().getNumberOfStates(), std::numeric_limits<uint64_t>::max());
-    std::vector<uint64_t> epochModelStateToInStateMap = epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint64_t> epochModelStateToInStateMap = structure->epochInStates.getNumberOfSetBitsBeforeIndices();
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    classData->productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
-    epochModel.objectiveRewardFilter.clear();
-    for (auto const& objRewards : epochModel.objectiveRewards) {
-        epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
-        epochModel.objectiveRewardFilter.back().complement();
+    structure->objectiveRewardFilter.clear();
+    for (auto const& objRewards : structure->objectiveRewards) {
+        structure->objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
+        structure->objectiveRewardFilter.back().complement();
     }
+
+    classData->epochModelStructure = std::move(structure);
+    return classData;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    epochData.epochModel.equationSolverProblemFormat = eqSysFormat;
+    // The cached epoch models might have a different format.
+    std::lock_guard<std::mutex> cacheLock(epochClassCacheMutex);
+    epochClassCache.clear();
+    epochClassCacheEntryCount = 0;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -859,17 +909,29 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    storeEpochSolution(epochData, std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(EpochAnalysisData const& data,
+                                                                                         std::vector<SolutionType>&& inStateSolutions,
+                                                                                         boost::optional<uint64_t> const& numberOfDependentEpochs,
+                                                                                         EpochSolutionCallback const& callback) {
+    STORM_LOG_ASSERT(data.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == data.epochModel.structure->epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    Epoch const& epoch = data.currentEpoch.get();
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        if (!numberOfDependentEpochs) {
+            epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        }
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
+    std::lock_guard<std::mutex> solutionsLock(epochSolutionsMutex);
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
         auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
@@ -882,10 +944,80 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
 
     // add the new solution
     EpochSolution solution;
-    solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.count = numberOfDependentEpochs ? numberOfDependentEpochs.get() : predecessorEpochs.size();
+    solution.productStateToSolutionVectorMap = data.epochClassData->productStateToEpochModelInStateMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
+
+    if (callback) {
+        callback(epoch);
+    }
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads,
+                                                                                    EpochAnalysis const& analysis, EpochSolutionCallback const& callback,
+                                                                                    bool releaseSolutions) {
+    // Determine for each epoch the given epochs it depends on and the number of given epochs that depend on it.
+    std::map<Epoch, uint64_t> epochIndices;
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        epochIndices.emplace(epochs[epochIndex], epochIndex);
+    }
+    std::vector<std::vector<uint64_t>> dependencies(epochs.size());
+    std::vector<uint64_t> numberOfDependentEpochs(epochs.size(), 0);
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        std::set<uint64_t> successorIndices;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epochs[epochIndex], step);
+            if (successorEpoch != epochs[epochIndex]) {
+                auto successorIndexIt = epochIndices.find(successorEpoch);
+                if (successorIndexIt != epochIndices.end()) {
+                    successorIndices.insert(successorIndexIt->second);
+                } else {
+                    STORM_LOG_ASSERT(epochSolutions.count(successorEpoch) > 0, "Solution for successor epoch does not exist (anymore).");
+                }
+            }
+        }
+        for (auto successorIndex : successorIndices) {
+            STORM_LOG_ASSERT(successorIndex < epochIndex, "The given epochs are not ordered correctly.");
+            ++numberOfDependentEpochs[successorIndex];
+        }
+        dependencies[epochIndex].assign(successorIndices.begin(), successorIndices.end());
+    }
+
+    auto analyzeEpoch = [&](uint64_t threadIndex, uint64_t epochIndex, EpochAnalysisData& data) {
+        auto& epochModel = setCurrentEpoch(epochs[epochIndex], data);
+        std::vector<SolutionType> solutions = analysis(threadIndex, epochs[epochIndex], epochModel);
+        storeEpochSolution(data, std::move(solutions),
+                           releaseSolutions ? boost::optional<uint64_t>(numberOfDependentEpochs[epochIndex]) : boost::optional<uint64_t>(), callback);
+    };
+
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, epochs.size()));
+    if (numberOfThreads == 1) {
+        for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+            analyzeEpoch(0, epochIndex, epochData);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+    } else {
+        STORM_LOG_INFO("Analyzing " << epochs.size() << " epochs with " << numberOfThreads << " threads.");
+        // The first thread uses the data of this object, each other thread gets its own epoch model.
+        std::vector<EpochAnalysisData> threadData(numberOfThreads - 1);
+        for (auto& data : threadData) {
+            data.epochModel.equationSolverProblemFormat = epochData.epochModel.equationSolverProblemFormat;
+        }
+        // Once termination is requested, no further epoch is started. As all epochs that are started afterwards are skipped, the dependencies of the
+        // analyzed epochs are always available.
+        std::atomic<bool> terminated(false);
+        storm::utility::parallel::forEachTaskInDependencyOrder(dependencies, numberOfThreads, [&](uint64_t threadIndex, uint64_t epochIndex) {
+            if (terminated || storm::utility::resources::isTerminate()) {
+                terminated = true;
+                return;
+            }
+            analyzeEpoch(threadIndex, epochIndex, threadIndex == 0 ? epochData : threadData[threadIndex - 1]);
+        });
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -913,6 +1045,12 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::clearEpochSolutions() {
+    std::lock_guard<std::mutex> lock(epochSolutionsMutex);
+    epochSolutions.clear();
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getInitialStateResult(Epoch const& epoch) {
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+#include <mutex>
+
 #include <boost/optional.hpp>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
@@ -27,6 +30,11 @@ class MultiDimensionalRewardUnfolding {
     typedef typename EpochManager::EpochClass EpochClass;
 
     typedef typename std::conditional<SingleObjectiveMode, ValueType, std::vector<ValueType>>::type SolutionType;
+    // Computes the solutions for the in-states of the given epoch model. The thread index allows to maintain data (e.g. solvers) for each thread.
+    typedef std::function<std::vector<SolutionType>(uint64_t threadIndex, Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModel)>
+        EpochAnalysis;
+    // Called after the solution of the given epoch has been stored. Calls are not concurrent.
+    typedef std::function<void(Epoch const& epoch)> EpochSolutionCallback;
 
     /*
      *
@@ -78,6 +86,27 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Analyzes the given epochs (e.g. obtained via getEpochComputationOrder) with the given function. An epoch is only analyzed once the solutions of all its
+     * successor epochs are available. Epochs that do not depend on each other are analyzed concurrently, each thread maintains its own epoch model.
+     * With a single thread, the epochs are analyzed in the given order.
+     *
+     * @param epochs the epochs to analyze. Each successor epoch of one of these epochs must either be contained or have been analyzed before.
+     * @param numberOfThreads the number of threads to use.
+     * @param analysis the function that computes the solutions of an epoch model.
+     * @param callback if set, this function is called after each analyzed epoch. The solution of the epoch is available during the call.
+     * @param releaseSolutions if set, a solution is released as soon as all the given epochs that depend on it have been analyzed. Otherwise, solutions
+     * are kept until all their predecessor epochs have been analyzed (which is required if further epochs are analyzed later).
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochs, uint64_t numberOfThreads, EpochAnalysis const& analysis,
+                       EpochSolutionCallback const& callback = EpochSolutionCallback(), bool releaseSolutions = true);
+
+    /*!
+     * Removes all stored epoch solutions, e.g., to recompute them with a higher precision. The product model and the epoch models are kept.
+     */
+    void clearEpochSolutions();
+
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
@@ -85,7 +114,41 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    // The data that only depends on the epoch class. It is not modified once built, so all epochs of the class share it.
+    struct EpochClassData {
+        std::shared_ptr<EpochModelStructure<ValueType> const> epochModelStructure;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    // The data that is maintained while analyzing an epoch. Epochs that are analyzed concurrently each have their own data.
+    struct EpochAnalysisData {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        boost::optional<Epoch> currentEpoch;
+        std::shared_ptr<EpochClassData const> epochClassData;
+    };
+
+    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch, EpochAnalysisData& data);
+
+    /*!
+     * Sets the epoch model structure (matrix, step choices, rewards and in-states) for the class of the given epoch.
+     * The structure only depends on the epoch class. It is therefore built once per class and then taken from the cache (if it fits in).
+     */
+    void setCurrentEpochClass(Epoch const& epoch, EpochAnalysisData& data);
+
+    /*!
+     * Builds the data for the class of the given epoch.
+     */
+    std::shared_ptr<EpochClassData const> buildEpochClassData(Epoch const& epoch, EpochAnalysisData const& data);
+
+    /*!
+     * Stores the solution for the current epoch of the given data.
+     * @param numberOfDependentEpochs if given, the number of epochs that need this solution. Otherwise, all predecessor epochs are considered.
+     */
+    void storeEpochSolution(EpochAnalysisData const& data, std::vector<SolutionType>&& inStateSolutions,
+                            boost::optional<uint64_t> const& numberOfDependentEpochs = boost::none,
+                            EpochSolutionCallback const& callback = EpochSolutionCallback());
+
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,6 +184,8 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
+    // Guards epochSolutions when epochs are analyzed concurrently. Stored solutions are not modified until they are released.
+    std::mutex epochSolutionsMutex;
     EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
     SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
 
@@ -129,12 +194,15 @@ class MultiDimensionalRewardUnfolding {
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    EpochAnalysisData epochData;
+
+    // The epoch model structures of the epoch classes that have been considered so far. Threads and later epochs of the same class share them.
+    std::map<EpochClass, std::shared_ptr<EpochClassData const>> epochClassCache;
+    // The number of matrix entries stored in the cache. Epoch classes are no longer cached once the product matrix is exceeded.
+    uint64_t epochClassCacheEntryCount = 0;
+    std::mutex epochClassCacheMutex;
 
     EpochManager epochManager;
 
@@ -3,6 +3,7 @@
 #include <boost/optional.hpp>
 #include <memory>
 #include <set>
+#include <type_traits>
 #include <vector>
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -16,6 +17,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/logic/BoundedUntilFormula.h"
@@ -253,17 +255,96 @@ std::vector<std::vector<typename ModelType::ValueType>> QuantileHelper<ModelType
     return result;
 }
 
+storm::storage::BitVector getSubQueryKey(storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) {
+    storm::storage::BitVector key = consideredDimensions;
+    key.resize(key.size() + 1, complementaryQuery);
+    return key;
+}
+
 template<typename ModelType>
 std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::ValueType>> QuantileHelper<ModelType>::computeQuantile(
     Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) {
+    // Collect the given query and the sub-queries it (transitively) depends on.
+    std::vector<storm::storage::BitVector> queries = {getSubQueryKey(consideredDimensions, complementaryQuery)};
+    std::map<storm::storage::BitVector, uint64_t> queryIndices = {{queries.front(), 0}};
+    std::vector<std::vector<uint64_t>> dependencies(1);
+    for (uint64_t query = 0; query < queries.size(); ++query) {
+        uint64_t const dimension = queries[query].size() - 1;
+        storm::storage::BitVector queryDimensions = queries[query];
+        queryDimensions.resize(dimension);
+        for (auto const& subQuery : getSubQueries(queryDimensions, queries[query].get(dimension))) {
+            auto indexIt = queryIndices.emplace(subQuery, queries.size());
+            if (indexIt.second) {
+                queries.push_back(subQuery);
+                dependencies.emplace_back();
+            }
+            dependencies[query].push_back(indexIt.first->second);
+        }
+    }
+
+    // Sub-queries that do not depend on each other (e.g. the ones dropping different dimensions) are computed concurrently (only for floating point
+    // computations). Each query has its own environment, which starts with the finest precision that one of its sub-queries required.
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? storm::utility::parallel::getDefaultNumberOfThreads() : 1;
+    if (numberOfThreads > 1 && queries.size() > 1) {
+        // Data of the model that is initialized lazily is initialized upfront, such that the model is only read concurrently.
+        model.getTransitionMatrix().getRowGroupIndices();
+    }
+    std::vector<Environment> environments(queries.size(), env);
+    std::vector<uint64_t> precisionRefinements(queries.size(), 0);
+    storm::utility::parallel::forEachTaskInDependencyOrder(dependencies, numberOfThreads, [&](uint64_t, uint64_t query) {
+        for (auto const& subQuery : dependencies[query]) {
+            precisionRefinements[query] = std::max(precisionRefinements[query], precisionRefinements[subQuery]);
+        }
+        for (uint64_t refinement = 0; refinement < precisionRefinements[query]; ++refinement) {
+            increasePrecision(environments[query]);
+        }
+        uint64_t const dimension = queries[query].size() - 1;
+        storm::storage::BitVector queryDimensions = queries[query];
+        queryDimensions.resize(dimension);
+        precisionRefinements[query] += computeSubQuery(environments[query], queryDimensions, queries[query].get(dimension));
+    });
+    env = environments.front();
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cachedSubQueryResults.at(queries.front());
+}
+
+template<typename ModelType>
+std::vector<storm::storage::BitVector> QuantileHelper<ModelType>::getSubQueries(storm::storage::BitVector const& consideredDimensions,
+                                                                                bool complementaryQuery) const {
+    std::vector<storm::storage::BitVector> result;
+    // The sub-queries are only needed to guarantee termination if there are only upper or only lower cost bounds.
+    auto const& boundedUntil = quantileFormula.getSubformula().asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+    storm::storage::BitVector lowerBoundedDimensions(getDimension());
+    for (auto d : consideredDimensions) {
+        lowerBoundedDimensions.set(d, boundedUntil.hasLowerBound(d));
+    }
+    bool onlyUpperCostBounds = lowerBoundedDimensions.empty();
+    bool onlyLowerCostBounds = lowerBoundedDimensions == consideredDimensions;
+    if (onlyUpperCostBounds || onlyLowerCostBounds) {
+        bool hasLowerValueBound =
+            storm::logic::isLowerBound(quantileFormula.getSubformula().asProbabilityOperatorFormula().getComparisonType()) != complementaryQuery;
+        for (auto k : consideredDimensions) {
+            storm::storage::BitVector subQueryDimensions = consideredDimensions;
+            subQueryDimensions.set(k, false);
+            bool subQueryComplement = complementaryQuery != ((onlyUpperCostBounds && hasLowerValueBound) || (onlyLowerCostBounds && !hasLowerValueBound));
+            result.push_back(getSubQueryKey(subQueryDimensions, subQueryComplement));
+        }
+    }
+    return result;
+}
+
+template<typename ModelType>
+uint64_t QuantileHelper<ModelType>::computeSubQuery(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) {
     STORM_LOG_ASSERT(consideredDimensions.isSubsetOf(getOpenDimensions()),
                      "Considered dimensions for a quantile query should be a subset of the set of dimensions without a fixed bound.");
 
-    storm::storage::BitVector cacheKey = consideredDimensions;
-    cacheKey.resize(cacheKey.size() + 1, complementaryQuery);
-    auto cacheIt = cachedSubQueryResults.find(cacheKey);
-    if (cacheIt != cachedSubQueryResults.end()) {
-        return cacheIt->second;
+    storm::storage::BitVector cacheKey = getSubQueryKey(consideredDimensions, complementaryQuery);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (cachedSubQueryResults.count(cacheKey) > 0) {
+            return 0;
+        }
     }
 
     auto boundedUntilOp = transformBoundedUntilOperator(quantileFormula.getSubformula().asProbabilityOperatorFormula(),
@@ -284,55 +365,61 @@ std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::Valu
     downwardClosedDimensions = downwardClosedDimensions % consideredDimensions;
     CostLimitClosure satCostLimits(downwardClosedDimensions), unsatCostLimits(~downwardClosedDimensions);
 
-    // Initialize the (un)sat cost limits to guarantee termination
-    bool onlyUpperCostBounds = lowerBoundedDimensions.empty();
-    bool onlyLowerCostBounds = lowerBoundedDimensions == consideredDimensions;
-    if (onlyUpperCostBounds || onlyLowerCostBounds) {
-        for (auto k : consideredDimensions) {
-            storm::storage::BitVector subQueryDimensions = consideredDimensions;
-            subQueryDimensions.set(k, false);
-            bool subQueryComplement = complementaryQuery != ((onlyUpperCostBounds && hasLowerValueBound) || (onlyLowerCostBounds && !hasLowerValueBound));
-            auto subQueryResult = computeQuantile(env, subQueryDimensions, subQueryComplement);
-            for (auto const& subQueryCostLimit : subQueryResult.first.getGenerator()) {
-                CostLimits initPoint;
-                uint64_t i = 0;
-                for (auto dim : consideredDimensions) {
-                    if (dim == k) {
-                        initPoint.push_back(CostLimit::infinity());
-                    } else {
-                        initPoint.push_back(subQueryCostLimit[i]);
-                        ++i;
-                    }
-                }
-                if (subQueryComplement == complementaryQuery) {
-                    satCostLimits.insert(initPoint);
+    // Initialize the (un)sat cost limits with the results of the sub-queries (which have been computed before) to guarantee termination
+    STORM_LOG_WARN_COND(lowerBoundedDimensions.empty() || lowerBoundedDimensions == consideredDimensions,
+                        "Quantile formula considers mixtures of upper and lower reward-bounds. Termination is not guaranteed.");
+    for (auto const& subQuery : getSubQueries(consideredDimensions, complementaryQuery)) {
+        // The sub-query considers all dimensions but k.
+        bool subQueryComplement = subQuery.get(getDimension());
+        storm::storage::BitVector subQueryDimensions = subQuery;
+        subQueryDimensions.resize(getDimension());
+        uint64_t k = (consideredDimensions & ~subQueryDimensions).getNextSetIndex(0);
+        std::unique_lock<std::mutex> lock(cacheMutex);
+        STORM_LOG_ASSERT(cachedSubQueryResults.count(subQuery) > 0, "The result of a sub-query has not been computed.");
+        CostLimitClosure const& subQueryResult = cachedSubQueryResults.at(subQuery).first;
+        lock.unlock();
+        for (auto const& subQueryCostLimit : subQueryResult.getGenerator()) {
+            CostLimits initPoint;
+            uint64_t i = 0;
+            for (auto dim : consideredDimensions) {
+                if (dim == k) {
+                    initPoint.push_back(CostLimit::infinity());
                 } else {
-                    unsatCostLimits.insert(initPoint);
+                    initPoint.push_back(subQueryCostLimit[i]);
+                    ++i;
                 }
             }
+            if (subQueryComplement == complementaryQuery) {
+                satCostLimits.insert(initPoint);
+            } else {
+                unsatCostLimits.insert(initPoint);
+            }
         }
-    } else {
-        STORM_LOG_WARN("Quantile formula considers mixtures of upper and lower reward-bounds. Termination is not guaranteed.");
     }
 
-    // Loop until the goal precision is reached.
+    // Loop until the goal precision is reached. The reward unfolding (in particular its product model and epoch models) is kept when the precision
+    // needs to be increased, only the epoch solutions are recomputed.
     STORM_LOG_DEBUG("Computing quantile for dimensions: " << consideredDimensions);
-    while (true) {
-        // initialize reward unfolding and data that will be needed for each epoch
-        MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
-        if (computeQuantile(env, consideredDimensions, *boundedUntilOp, lowerBoundedDimensions, satCostLimits, unsatCostLimits, rewardUnfolding)) {
-            std::vector<ValueType> scalingFactors;
-            for (auto dim : consideredDimensions) {
-                scalingFactors.push_back(rewardUnfolding.getDimension(dim).scalingFactor);
-            }
-            std::pair<CostLimitClosure, std::vector<ValueType>> result(satCostLimits, scalingFactors);
-            cachedSubQueryResults.emplace(cacheKey, result);
-            return result;
-        }
-        STORM_LOG_WARN("Restarting quantile computation after " << swExploration << " seconds due to insufficient precision.");
+    MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
+    storm::utility::Stopwatch explorationWatch, epochAnalysisWatch;
+    uint64_t precisionRefinements = 0;
+    while (!computeQuantile(env, consideredDimensions, *boundedUntilOp, lowerBoundedDimensions, satCostLimits, unsatCostLimits, rewardUnfolding,
+                            explorationWatch, epochAnalysisWatch)) {
+        STORM_LOG_WARN("Restarting quantile computation after " << explorationWatch << " seconds due to insufficient precision.");
         ++numPrecisionRefinements;
+        ++precisionRefinements;
         increasePrecision(env);
+        rewardUnfolding.clearEpochSolutions();
+    }
+    std::vector<ValueType> scalingFactors;
+    for (auto dim : consideredDimensions) {
+        scalingFactors.push_back(rewardUnfolding.getDimension(dim).scalingFactor);
     }
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cachedSubQueryResults.emplace(cacheKey, std::make_pair(std::move(satCostLimits), std::move(scalingFactors)));
+    swExploration.add(explorationWatch);
+    swEpochAnalysis.add(epochAnalysisWatch);
+    return precisionRefinements;
 }
 
 bool getNextCandidateCostLimit(CostLimit const& candidateCostLimitSum, CostLimits& current) {
@@ -392,17 +479,20 @@ template<typename ModelType>
 bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions,
                                                 storm::logic::ProbabilityOperatorFormula const& boundedUntilOperator,
                                                 storm::storage::BitVector const& lowerBoundedDimensions, CostLimitClosure& satCostLimits,
-                                                CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
+                                                CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding,
+                                                storm::utility::Stopwatch& explorationWatch, storm::utility::Stopwatch& epochAnalysisWatch) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+    // Independent epochs are analyzed concurrently (only for floating point computations). Each thread has its own data.
+    uint64_t numberOfThreads = std::is_same<ValueType, double>::value ? storm::utility::parallel::getDefaultNumberOfThreads() : 1;
+    std::vector<std::vector<ValueType>> x(numberOfThreads), b(numberOfThreads);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numberOfThreads);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numberOfThreads);         // Needed for DTMC
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
 
-    swExploration.start();
+    explorationWatch.start();
     bool progress = true;
     for (CostLimit candidateCostLimitSum(0); progress; ++candidateCostLimitSum.get()) {
         CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
@@ -432,42 +522,51 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
-                    swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swEpochAnalysis.stop();
-
-                    CostLimits epochAsCostLimits;
-                    if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
-                                                   epochAsCostLimits)) {
-                        ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
-                        bool propertySatisfied;
-                        if (env.solver().isForceSoundness()) {
-                            ValueType sumOfEpochDimensions =
-                                storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
-                            auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
-                            if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
-                                // unclear result due to insufficient precision.
-                                swExploration.stop();
-                                return false;
-                            }
+                // The solutions are kept as the epochs of later candidates might depend on them.
+                bool insufficientPrecision = false;
+                epochAnalysisWatch.start();
+                rewardUnfolding.analyzeEpochs(
+                    epochSequence, numberOfThreads,
+                    [&](uint64_t threadIndex, EpochManager::Epoch const&, EpochModel<ValueType, true>& epochModel) {
+                        if (model.isNondeterministicModel()) {
+                            return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x[threadIndex], b[threadIndex],
+                                                                     minMaxSolvers[threadIndex], lowerBound, upperBound);
                         } else {
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
+                            return epochModel.analyzeSingleObjective(env, x[threadIndex], b[threadIndex], linEqSolvers[threadIndex], lowerBound, upperBound);
                         }
-                        if (propertySatisfied) {
-                            satCostLimits.insert(epochAsCostLimits);
-                        } else {
-                            unsatCostLimits.insert(epochAsCostLimits);
+                    },
+                    [&](EpochManager::Epoch const& epoch) {
+                        ++numCheckedEpochs;
+                        CostLimits epochAsCostLimits;
+                        if (!insufficientPrecision && translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions,
+                                                                                 rewardUnfolding.getEpochManager(), epochAsCostLimits)) {
+                            ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
+                            bool propertySatisfied;
+                            if (env.solver().isForceSoundness()) {
+                                ValueType sumOfEpochDimensions =
+                                    storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
+                                auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
+                                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
+                                if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
+                                    // unclear result due to insufficient precision.
+                                    insufficientPrecision = true;
+                                    return;
+                                }
+                            } else {
+                                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
+                            }
+                            if (propertySatisfied) {
+                                satCostLimits.insert(epochAsCostLimits);
+                            } else {
+                                unsatCostLimits.insert(epochAsCostLimits);
+                            }
                         }
-                    }
+                    },
+                    false);
+                epochAnalysisWatch.stop();
+                if (insufficientPrecision) {
+                    explorationWatch.stop();
+                    return false;
                 }
             }
         } while (getNextCandidateCostLimit(candidateCostLimitSum, currentCandidate));
@@ -475,7 +574,7 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
             progress = !CostLimitClosure::unionFull(satCostLimits, unsatCostLimits);
         }
     }
-    swExploration.stop();
+    explorationWatch.stop();
     return true;
 }
 
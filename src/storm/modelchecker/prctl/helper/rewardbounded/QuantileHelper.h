@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <boost/optional.hpp>
 #include <map>
+#include <mutex>
 
 #include "storm/logic/ProbabilityOperatorFormula.h"
 #include "storm/logic/QuantileFormula.h"
@@ -29,9 +31,22 @@ class QuantileHelper {
    private:
     std::pair<CostLimitClosure, std::vector<ValueType>> computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions,
                                                                         bool complementaryQuery);
+
+    /*!
+     * Gets the (cache keys of the) sub-queries whose results are used to initialize the cost limits of the given query.
+     */
+    std::vector<storm::storage::BitVector> getSubQueries(storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) const;
+
+    /*!
+     * Computes the result of the given query and caches it. The results of all its sub-queries need to be cached already.
+     * @return the number of precision refinements that were necessary
+     */
+    uint64_t computeSubQuery(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery);
+
     bool computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions,
                          storm::logic::ProbabilityOperatorFormula const& boundedUntilOperator, storm::storage::BitVector const& lowerBoundedDimensions,
-                         CostLimitClosure& satCostLimits, CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding);
+                         CostLimitClosure& satCostLimits, CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding,
+                         storm::utility::Stopwatch& explorationWatch, storm::utility::Stopwatch& epochAnalysisWatch);
 
     /*!
      * Gets the number of dimensions of the underlying boudned until formula
@@ -50,10 +65,12 @@ class QuantileHelper {
     ModelType const& model;
     storm::logic::QuantileFormula const& quantileFormula;
     std::map<storm::storage::BitVector, std::pair<CostLimitClosure, std::vector<ValueType>>> cachedSubQueryResults;
+    // Guards the cached results and the stopwatches as sub-queries are computed concurrently.
+    std::mutex cacheMutex;
 
     /// Statistics
-    mutable uint64_t numCheckedEpochs;
-    mutable uint64_t numPrecisionRefinements;
+    mutable std::atomic<uint64_t> numCheckedEpochs;
+    mutable std::atomic<uint64_t> numPrecisionRefinements;
     mutable storm::utility::Stopwatch swEpochAnalysis;
     mutable storm::utility::Stopwatch swExploration;
 };
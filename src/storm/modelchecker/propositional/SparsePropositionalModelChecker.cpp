@@ -1,7 +1,12 @@
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
 
+#include <sstream>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -10,10 +15,13 @@
 #include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/modelchecker/propositional/StateFormulaResultCache.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/exceptions/InternalTypeErrorException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/utility/macros.h"
 
@@ -30,6 +38,82 @@ bool SparsePropositionalModelChecker<SparseModelType>::canHandle(CheckTask<storm
     return formula.isInFragment(storm::logic::propositional());
 }
 
+template<typename SparseModelType>
+std::unique_ptr<CheckResult> SparsePropositionalModelChecker<SparseModelType>::checkStateFormula(
+    Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+    storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+    if (stateFormula.isInFragment(storm::logic::propositional())) {
+        storm::storage::BitVector result;
+        evaluatePropositionalFormula(stateFormula, result);
+        return std::unique_ptr<CheckResult>(new ExplicitQualitativeCheckResult(std::move(result)));
+    }
+
+    std::string key = getResultCacheKey(checkTask);
+    if (key.empty()) {
+        return AbstractModelChecker<SparseModelType>::checkStateFormula(env, checkTask);
+    }
+    std::shared_ptr<StateFormulaResultCache> cache = env.modelchecker().getStateFormulaResultCache();
+    if (!cache) {
+        if (!localResultCache) {
+            localResultCache = std::make_shared<StateFormulaResultCache>();
+        }
+        cache = localResultCache;
+    }
+    storm::storage::BitVector cachedResult;
+    if (cache->getResult(model, key, cachedResult)) {
+        STORM_LOG_DEBUG("Reusing the result of state formula " << stateFormula << ".");
+        return std::unique_ptr<CheckResult>(new ExplicitQualitativeCheckResult(std::move(cachedResult)));
+    }
+    std::unique_ptr<CheckResult> result = AbstractModelChecker<SparseModelType>::checkStateFormula(env, checkTask);
+    if (result->isExplicitQualitativeCheckResult() && result->isResultForAllStates()) {
+        cache->storeResult(model, key, result->asExplicitQualitativeCheckResult().getTruthValuesVector());
+    }
+    return result;
+}
+
+template<typename SparseModelType>
+std::unique_ptr<CheckResult> SparsePropositionalModelChecker<SparseModelType>::checkBinaryBooleanStateFormula(
+    Environment const& env, CheckTask<storm::logic::BinaryBooleanStateFormula, ValueType> const& checkTask) {
+    storm::logic::BinaryBooleanStateFormula const& stateFormula = checkTask.getFormula();
+    STORM_LOG_THROW(stateFormula.getLeftSubformula().isStateFormula() && stateFormula.getRightSubformula().isStateFormula(),
+                    storm::exceptions::InvalidArgumentException, "The given formula is invalid.");
+    STORM_LOG_THROW(stateFormula.isAnd() || stateFormula.isOr(), storm::exceptions::InvalidArgumentException,
+                    "The given formula '" << stateFormula << "' is invalid.");
+
+    // Check a propositional operand first, as the (expensive) other operand can be skipped if the first one already decides all relevant states.
+    bool swapOperands = !stateFormula.getLeftSubformula().isInFragment(storm::logic::propositional()) &&
+                        stateFormula.getRightSubformula().isInFragment(storm::logic::propositional());
+    storm::logic::Formula const& firstOperand = swapOperands ? stateFormula.getRightSubformula() : stateFormula.getLeftSubformula();
+    storm::logic::Formula const& secondOperand = swapOperands ? stateFormula.getLeftSubformula() : stateFormula.getRightSubformula();
+
+    std::unique_ptr<CheckResult> result = this->check(env, checkTask.template substituteFormula<storm::logic::Formula>(firstOperand.asStateFormula()));
+    STORM_LOG_THROW(result->isQualitative(), storm::exceptions::InternalTypeErrorException, "Expected qualitative results.");
+
+    if (result->isExplicitQualitativeCheckResult() && result->isResultForAllStates()) {
+        storm::storage::BitVector const& firstStates = result->asExplicitQualitativeCheckResult().getTruthValuesVector();
+        bool decided;
+        if (checkTask.isOnlyInitialStatesRelevantSet()) {
+            decided = stateFormula.isAnd() ? firstStates.isDisjointFrom(model.getInitialStates()) : model.getInitialStates().isSubsetOf(firstStates);
+        } else {
+            decided = stateFormula.isAnd() ? firstStates.empty() : firstStates.full();
+        }
+        if (decided) {
+            STORM_LOG_DEBUG("Skipping operand " << secondOperand << " of formula " << stateFormula << " as the other operand decides all relevant states.");
+            return result;
+        }
+    }
+
+    std::unique_ptr<CheckResult> secondResult =
+        this->check(env, checkTask.template substituteFormula<storm::logic::Formula>(secondOperand.asStateFormula()));
+    STORM_LOG_THROW(secondResult->isQualitative(), storm::exceptions::InternalTypeErrorException, "Expected qualitative results.");
+    if (stateFormula.isAnd()) {
+        result->asQualitativeCheckResult() &= secondResult->asQualitativeCheckResult();
+    } else {
+        result->asQualitativeCheckResult() |= secondResult->asQualitativeCheckResult();
+    }
+    return result;
+}
+
 template<typename SparseModelType>
 std::unique_ptr<CheckResult> SparsePropositionalModelChecker<SparseModelType>::checkBooleanLiteralFormula(
     Environment const& env, CheckTask<storm::logic::BooleanLiteralFormula, ValueType> const& checkTask) {
@@ -55,6 +139,77 @@ SparseModelType const& SparsePropositionalModelChecker<SparseModelType>::getMode
     return model;
 }
 
+template<typename SparseModelType>
+void SparsePropositionalModelChecker<SparseModelType>::evaluatePropositionalFormula(storm::logic::Formula const& formula,
+                                                                                   storm::storage::BitVector& result) const {
+    if (formula.isBooleanLiteralFormula()) {
+        result = storm::storage::BitVector(model.getNumberOfStates(), formula.asBooleanLiteralFormula().isTrueFormula());
+    } else if (formula.isAtomicLabelFormula() || formula.isAtomicExpressionFormula()) {
+        result = getLabeledStates(formula);
+    } else if (formula.isUnaryBooleanStateFormula()) {
+        evaluatePropositionalFormula(formula.asUnaryBooleanStateFormula().getSubformula(), result);
+        result.complement();
+    } else if (formula.isBinaryBooleanStateFormula()) {
+        storm::logic::BinaryBooleanStateFormula const& binaryFormula = formula.asBinaryBooleanStateFormula();
+        evaluatePropositionalFormula(binaryFormula.getLeftSubformula(), result);
+        if (binaryFormula.isAnd() ? result.empty() : result.full()) {
+            return;
+        }
+        // Labels are combined with the result directly to avoid copying their states.
+        storm::logic::Formula const& rightFormula = binaryFormula.getRightSubformula();
+        if (rightFormula.isAtomicLabelFormula() || rightFormula.isAtomicExpressionFormula()) {
+            if (binaryFormula.isAnd()) {
+                result &= getLabeledStates(rightFormula);
+            } else {
+                result |= getLabeledStates(rightFormula);
+            }
+        } else {
+            storm::storage::BitVector rightResult;
+            evaluatePropositionalFormula(rightFormula, rightResult);
+            if (binaryFormula.isAnd()) {
+                result &= rightResult;
+            } else {
+                result |= rightResult;
+            }
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given formula '" << formula << "' is not propositional.");
+    }
+}
+
+template<typename SparseModelType>
+storm::storage::BitVector const& SparsePropositionalModelChecker<SparseModelType>::getLabeledStates(storm::logic::Formula const& formula) const {
+    std::string label;
+    if (formula.isAtomicLabelFormula()) {
+        label = formula.asAtomicLabelFormula().getLabel();
+    } else {
+        std::stringstream stream;
+        stream << formula.asAtomicExpressionFormula().getExpression();
+        label = stream.str();
+    }
+    STORM_LOG_THROW(model.hasLabel(label), storm::exceptions::InvalidPropertyException, "The property refers to unknown label '" << label << "'.");
+    return model.getStates(label);
+}
+
+template<typename SparseModelType>
+std::string SparsePropositionalModelChecker<SparseModelType>::getResultCacheKey(CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) const {
+    // Only results of bounded operators that are computed for all states can be reused.
+    storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+    if (!stateFormula.isOperatorFormula() || !stateFormula.asOperatorFormula().hasBound() || checkTask.isOnlyInitialStatesRelevantSet() ||
+        checkTask.isProduceSchedulersSet() || checkTask.isPlayerCoalitionSet()) {
+        return "";
+    }
+    std::stringstream stream;
+    stream << stateFormula;
+    if (checkTask.isOptimizationDirectionSet()) {
+        stream << " [" << checkTask.getOptimizationDirection() << "]";
+    }
+    if (checkTask.isRewardModelSet()) {
+        stream << " [" << checkTask.getRewardModel() << "]";
+    }
+    return stream.str();
+}
+
 // Explicitly instantiate the template class.
 template class SparsePropositionalModelChecker<storm::models::sparse::Model<double>>;
 template class SparsePropositionalModelChecker<storm::models::sparse::Dtmc<double>>;
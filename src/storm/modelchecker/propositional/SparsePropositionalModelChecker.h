@@ -1,11 +1,16 @@
 #ifndef STORM_MODELCHECKER_SPARSEPROPOSITIONALMODELCHECKER_H_
 #define STORM_MODELCHECKER_SPARSEPROPOSITIONALMODELCHECKER_H_
 
+#include <memory>
+
 #include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/BitVector.h"
 
 namespace storm {
 namespace modelchecker {
 
+class StateFormulaResultCache;
+
 template<typename SparseModelType>
 class SparsePropositionalModelChecker : public AbstractModelChecker<SparseModelType> {
    public:
@@ -16,6 +21,9 @@ class SparsePropositionalModelChecker : public AbstractModelChecker<SparseModelT
 
     // The implemented methods of the AbstractModelChecker interface.
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+    virtual std::unique_ptr<CheckResult> checkStateFormula(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> checkBinaryBooleanStateFormula(
+        Environment const& env, CheckTask<storm::logic::BinaryBooleanStateFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkBooleanLiteralFormula(Environment const& env,
                                                                     CheckTask<storm::logic::BooleanLiteralFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkAtomicLabelFormula(Environment const& env,
@@ -30,8 +38,30 @@ class SparsePropositionalModelChecker : public AbstractModelChecker<SparseModelT
     SparseModelType const& getModel() const;
 
    private:
+    /*!
+     * Evaluates the given formula of the propositional fragment on all states of the model. Conjunctions and disjunctions are evaluated in place
+     * and the second operand is skipped if the first one already decides all states.
+     *
+     * @param formula The formula to evaluate.
+     * @param result The vector into which the satisfying states are written.
+     */
+    void evaluatePropositionalFormula(storm::logic::Formula const& formula, storm::storage::BitVector& result) const;
+
+    /*!
+     * Retrieves the states of the model that carry the label to which the given atomic label or expression formula refers.
+     */
+    storm::storage::BitVector const& getLabeledStates(storm::logic::Formula const& formula) const;
+
+    /*!
+     * Retrieves the key under which the result of the given check task is cached or an empty string if the result must not be cached.
+     */
+    std::string getResultCacheKey(CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) const;
+
     // The model that is to be analyzed by the model checker.
     SparseModelType const& model;
+
+    // The cache for state formula results that is used if the environment does not provide one.
+    std::shared_ptr<StateFormulaResultCache> localResultCache;
 };
 }  // namespace modelchecker
 }  // namespace storm
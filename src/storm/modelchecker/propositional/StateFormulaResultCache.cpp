@@ -0,0 +1,42 @@
+#include "storm/modelchecker/propositional/StateFormulaResultCache.h"
+
+namespace storm {
+namespace modelchecker {
+
+StateFormulaResultCache::StateFormulaResultCache() : numberOfHits(0) {
+    // Intentionally left empty.
+}
+
+bool StateFormulaResultCache::getResult(storm::models::ModelBase const& model, std::string const& key, storm::storage::BitVector& result) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = results.find(std::make_pair(&model, key));
+    if (it == results.end()) {
+        return false;
+    }
+    ++numberOfHits;
+    result = it->second;
+    return true;
+}
+
+void StateFormulaResultCache::storeResult(storm::models::ModelBase const& model, std::string const& key, storm::storage::BitVector const& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    results[std::make_pair(&model, key)] = result;
+}
+
+uint64_t StateFormulaResultCache::getNumberOfResults() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return results.size();
+}
+
+uint64_t StateFormulaResultCache::getNumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfHits;
+}
+
+void StateFormulaResultCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    results.clear();
+}
+
+}  // namespace modelchecker
+}  // namespace storm
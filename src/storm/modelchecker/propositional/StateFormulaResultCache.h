@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace models {
+class ModelBase;
+}
+
+namespace modelchecker {
+
+/*!
+ * Stores the results of (nested) state formulas that were checked on sparse models, such that identical subformulas are only checked once, both
+ * within a formula and across the properties of a property file. Only results that hold for all states of the model are stored. An instance is
+ * attached to the model checker environment, so all model checkers (and their copies of the environment) use it. As the results also depend on the
+ * environment (e.g. the precision of the solvers), a cache must only be shared by checks with the same settings. The cache is thread-safe.
+ */
+class StateFormulaResultCache {
+   public:
+    StateFormulaResultCache();
+
+    /*!
+     * Retrieves the stored result of the state formula with the given key on the given model (if any).
+     *
+     * @param result If a result is stored, it is written to this vector.
+     * @return True iff a result is stored.
+     */
+    bool getResult(storm::models::ModelBase const& model, std::string const& key, storm::storage::BitVector& result) const;
+
+    /*!
+     * Stores the result of the state formula with the given key on the given model.
+     */
+    void storeResult(storm::models::ModelBase const& model, std::string const& key, storm::storage::BitVector const& result);
+
+    /*!
+     * Retrieves the number of results that are currently stored.
+     */
+    uint64_t getNumberOfResults() const;
+
+    /*!
+     * Retrieves the number of times a stored result was retrieved.
+     */
+    uint64_t getNumberOfHits() const;
+
+    /*!
+     * Removes all stored results. This needs to be called whenever a model for which results are stored changes.
+     */
+    void clear();
+
+   private:
+    mutable std::mutex mutex;
+    std::map<std::pair<storm::models::ModelBase const*, std::string>, storm::storage::BitVector> results;
+    mutable uint64_t numberOfHits;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -83,7 +83,9 @@ ExplicitQuantitativeCheckResult<ValueType>::ExplicitQuantitativeCheckResult(Expl
 
 template<typename ValueType>
 std::unique_ptr<CheckResult> ExplicitQuantitativeCheckResult<ValueType>::clone() const {
-    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    auto result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(this->values, this->scheduler);
+    result->errorBound = this->errorBound;
+    return result;
 }
 
 template<typename ValueType>
@@ -232,6 +234,22 @@ storm::storage::Scheduler<ValueType>& ExplicitQuantitativeCheckResult<ValueType>
     return *scheduler.get();
 }
 
+template<typename ValueType>
+bool ExplicitQuantitativeCheckResult<ValueType>::hasErrorBound() const {
+    return static_cast<bool>(errorBound);
+}
+
+template<typename ValueType>
+void ExplicitQuantitativeCheckResult<ValueType>::setErrorBound(double errorBound) {
+    this->errorBound = errorBound;
+}
+
+template<typename ValueType>
+double ExplicitQuantitativeCheckResult<ValueType>::getErrorBound() const {
+    STORM_LOG_THROW(this->hasErrorBound(), storm::exceptions::InvalidOperationException, "Unable to retrieve non-existing error bound.");
+    return errorBound.get();
+}
+
 template<typename ValueType>
 void print(std::ostream& out, ValueType const& value) {
     if (value == storm::utility::infinity<ValueType>()) {
@@ -80,6 +80,17 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
     storm::storage::Scheduler<ValueType> const& getScheduler() const;
     storm::storage::Scheduler<ValueType>& getScheduler();
 
+    /*!
+     * Retrieves whether the values were computed by solvers that were aborted before convergence, but that guarantee an error bound for them.
+     */
+    bool hasErrorBound() const;
+
+    /*!
+     * Sets the (absolute) distance within which all values are of the exact result.
+     */
+    void setErrorBound(double errorBound);
+    double getErrorBound() const;
+
     storm::json<ValueType> toJson(boost::optional<storm::storage::sparse::StateValuations> const& stateValuations = boost::none,
                                   boost::optional<storm::models::sparse::StateLabeling> const& stateLabels = boost::none) const;
 
@@ -89,6 +100,9 @@ class ExplicitQuantitativeCheckResult : public QuantitativeCheckResult<ValueType
 
     // An optional scheduler that accompanies the values.
     boost::optional<std::shared_ptr<storm::storage::Scheduler<ValueType>>> scheduler;
+
+    // An optional bound on the error of the values (for results of aborted computations).
+    boost::optional<double> errorBound;
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -0,0 +1,216 @@
+#include "storm/modelchecker/simulation/StatisticalModelChecker.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SimulationSettings.h"
+
+#include "storm/simulator/BoundedReachabilitySampler.h"
+#include "storm/simulator/StatisticalTests.h"
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/random.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+namespace {
+/*!
+ * Samples traces for a step-bounded until formula with one sampler (and thus one independent random number stream)
+ * per thread.
+ */
+template<typename ValueType>
+class TraceSampling {
+   public:
+    TraceSampling(storm::prism::Program const& program, storm::logic::BoundedUntilFormula const& formula)
+        : numberOfThreads(storm::utility::parallel::getDefaultNumberOfThreads()), numberOfTraces(0), numberOfSatisfyingTraces(0) {
+        STORM_LOG_THROW(formula.hasUpperBound() && formula.hasIntegerUpperBound(), storm::exceptions::InvalidPropertyException,
+                        "Formula needs to have a discrete upper step bound.");
+        storm::expressions::Expression conditionExpression =
+            formula.getLeftSubformula().toExpression(program.getManager(), program.getLabelToExpressionMapping());
+        storm::expressions::Expression targetExpression =
+            formula.getRightSubformula().toExpression(program.getManager(), program.getLabelToExpressionMapping());
+        uint64_t stepBound = formula.template getNonStrictUpperBound<uint64_t>();
+
+        auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+        batchSize = settings.getBatchSize();
+        uint64_t seed = settings.isSeedSet() ? settings.getSeed() : std::random_device()();
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            samplers.push_back(std::make_unique<storm::simulator::BoundedReachabilitySampler<ValueType>>(
+                program, conditionExpression, targetExpression, stepBound, settings.getCacheSize(), storm::utility::getSeedForStream(seed, thread)));
+        }
+        tracesOfThreads.resize(numberOfThreads);
+        satisfyingTracesOfThreads.resize(numberOfThreads);
+        watch.start();
+    }
+
+    /*!
+     * Samples (at most) one batch of traces on every thread, but no more than the given number of traces in total.
+     *
+     * @return The number of sampled traces and the number of traces that satisfy the formula.
+     */
+    std::pair<uint64_t, uint64_t> sampleRound(uint64_t maximalNumberOfTraces) {
+        uint64_t tracesPerThread = std::min(batchSize, (maximalNumberOfTraces - 1) / numberOfThreads + 1);
+        storm::utility::parallel::forEachChunk(0, numberOfThreads, 1, numberOfThreads, [&](uint64_t, uint64_t thread, uint64_t) {
+            uint64_t offset = thread * tracesPerThread;
+            tracesOfThreads[thread] = offset < maximalNumberOfTraces ? std::min(tracesPerThread, maximalNumberOfTraces - offset) : 0;
+            satisfyingTracesOfThreads[thread] = samplers[thread]->sampleBatch(tracesOfThreads[thread]);
+        });
+
+        std::pair<uint64_t, uint64_t> result(0, 0);
+        for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+            result.first += tracesOfThreads[thread];
+            result.second += satisfyingTracesOfThreads[thread];
+        }
+        numberOfTraces += result.first;
+        numberOfSatisfyingTraces += result.second;
+        return result;
+    }
+
+    void printStatistics() {
+        watch.stop();
+        double seconds = watch.getTimeInMilliseconds() / 1000.0;
+        STORM_LOG_INFO("Sampled " << numberOfTraces << " traces (" << numberOfSatisfyingTraces << " satisfying) with " << numberOfThreads << " thread(s) in "
+                                  << seconds << "s (" << (seconds > 0 ? numberOfTraces / seconds : 0.0) << " traces per second).");
+    }
+
+   private:
+    uint64_t numberOfThreads;
+    uint64_t batchSize;
+    std::vector<std::unique_ptr<storm::simulator::BoundedReachabilitySampler<ValueType>>> samplers;
+    std::vector<uint64_t> tracesOfThreads;
+    std::vector<uint64_t> satisfyingTracesOfThreads;
+    uint64_t numberOfTraces;
+    uint64_t numberOfSatisfyingTraces;
+    storm::utility::Stopwatch watch;
+};
+}  // namespace
+
+template<typename ModelType>
+StatisticalModelChecker<ModelType>::StatisticalModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()) {
+    STORM_LOG_THROW(this->program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "The simulation engine currently only supports DTMCs.");
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    if (!checkTask.isOnlyInitialStatesRelevantSet() || !formula.isProbabilityOperatorFormula()) {
+        return false;
+    }
+    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+    if (!pathFormula.isBoundedUntilFormula()) {
+        return false;
+    }
+    storm::logic::BoundedUntilFormula const& untilFormula = pathFormula.asBoundedUntilFormula();
+    storm::logic::FragmentSpecification propositional = storm::logic::propositional();
+    return !untilFormula.isMultiDimensional() && !untilFormula.getTimeBoundReference().isRewardBound() && !untilFormula.hasLowerBound() &&
+           untilFormula.hasUpperBound() && untilFormula.getLeftSubformula().isInFragment(propositional) &&
+           untilFormula.getRightSubformula().isInFragment(propositional);
+}
+
+template<typename ModelType>
+bool StatisticalModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    return canHandleStatic(checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    if (!checkTask.isBoundSet()) {
+        return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+    }
+
+    // Decide the bound with a hypothesis test instead of estimating the probability.
+    storm::logic::Formula const& pathFormula = checkTask.getFormula().getSubformula();
+    STORM_LOG_THROW(pathFormula.isBoundedUntilFormula(), storm::exceptions::NotSupportedException,
+                    "The simulation engine does not support the formula: " << pathFormula << ".");
+    TraceSampling<ValueType> sampling(program, pathFormula.asBoundedUntilFormula());
+
+    auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    double threshold = storm::utility::convertNumber<double>(checkTask.getBoundThreshold());
+    double errorProbability = 1.0 - settings.getConfidence();
+    storm::simulator::SequentialProbabilityRatioTest test(threshold, settings.getIndifference(), errorProbability, errorProbability);
+    uint64_t maximalNumberOfTraces = settings.isMaximalNumberOfTracesSet() ? settings.getMaximalNumberOfTraces() : std::numeric_limits<uint64_t>::max();
+    while (test.getDecision() == storm::simulator::SequentialProbabilityRatioTest::Decision::Undecided &&
+           test.getNumberOfSamples() < maximalNumberOfTraces && !storm::utility::resources::isTerminate()) {
+        std::pair<uint64_t, uint64_t> tracesAndSatisfyingTraces = sampling.sampleRound(maximalNumberOfTraces - test.getNumberOfSamples());
+        test.addSamples(tracesAndSatisfyingTraces.first, tracesAndSatisfyingTraces.second);
+    }
+    sampling.printStatistics();
+
+    bool aboveThreshold;
+    if (test.getDecision() == storm::simulator::SequentialProbabilityRatioTest::Decision::Undecided) {
+        STORM_LOG_WARN("The hypothesis test was stopped before reaching the requested confidence, the result is based on the estimated probability.");
+        aboveThreshold = test.getNumberOfSamples() > 0 && test.getNumberOfSuccesses() >= threshold * test.getNumberOfSamples();
+    } else {
+        aboveThreshold = test.getDecision() == storm::simulator::SequentialProbabilityRatioTest::Decision::AboveThreshold;
+    }
+    bool result = storm::logic::isLowerBound(checkTask.getBoundComparisonType()) ? aboveThreshold : !aboveThreshold;
+    return std::make_unique<ExplicitQualitativeCheckResult>(0, result);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> StatisticalModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const&, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    TraceSampling<ValueType> sampling(program, checkTask.getFormula());
+
+    auto const& settings = storm::settings::getModule<storm::settings::modules::SimulationSettings>();
+    double precision = settings.getPrecision();
+    double errorProbability = 1.0 - settings.getConfidence();
+    bool sequential = settings.getEstimationMethod() == storm::settings::modules::SimulationSettings::EstimationMethod::ClopperPearson;
+
+    // The Chernoff-Hoeffding bound gives the number of traces that suffices in any case. When using Clopper-Pearson
+    // intervals, the sampling typically stops earlier (in particular for probabilities close to zero or one).
+    uint64_t sufficientNumberOfTraces = storm::simulator::getChernoffHoeffdingNumberOfSamples(precision, errorProbability);
+    uint64_t maximalNumberOfTraces = sufficientNumberOfTraces;
+    if (settings.isMaximalNumberOfTracesSet()) {
+        maximalNumberOfTraces = std::min(maximalNumberOfTraces, settings.getMaximalNumberOfTraces());
+    }
+
+    bool confident = false;
+    uint64_t numberOfTraces = 0;
+    uint64_t numberOfSatisfyingTraces = 0;
+    while (numberOfTraces < maximalNumberOfTraces && !storm::utility::resources::isTerminate()) {
+        std::pair<uint64_t, uint64_t> tracesAndSatisfyingTraces = sampling.sampleRound(maximalNumberOfTraces - numberOfTraces);
+        numberOfTraces += tracesAndSatisfyingTraces.first;
+        numberOfSatisfyingTraces += tracesAndSatisfyingTraces.second;
+        if (sequential) {
+            std::pair<double, double> interval = storm::simulator::getClopperPearsonInterval(numberOfTraces, numberOfSatisfyingTraces, errorProbability);
+            if (interval.second - interval.first <= 2 * precision) {
+                STORM_LOG_INFO("The probability lies in [" << interval.first << ", " << interval.second << "] with confidence " << settings.getConfidence()
+                                                           << ".");
+                confident = true;
+                break;
+            }
+        }
+    }
+    sampling.printStatistics();
+    confident |= numberOfTraces >= sufficientNumberOfTraces;
+    STORM_LOG_WARN_COND(confident, "The sampling was stopped before reaching the requested confidence.");
+
+    double estimate = numberOfTraces > 0 ? static_cast<double>(numberOfSatisfyingTraces) / numberOfTraces : 0.0;
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, storm::utility::convertNumber<ValueType>(estimate));
+}
+
+template class StatisticalModelChecker<storm::models::sparse::Dtmc<double>>;
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+/*!
+ * A model checker that estimates probabilities by sampling traces of a PRISM program (statistical model checking).
+ * As the model is never built, it is applicable to models whose state space is too large for the other engines, but the
+ * results are only correct with a (configurable) confidence.
+ *
+ * Step-bounded until properties on DTMCs are supported. If the property has a probability bound, a sequential
+ * probability ratio test decides the bound. Otherwise, the probability is estimated such that it is precise with the
+ * given confidence, either by sampling until the Clopper-Pearson interval is narrow enough or by sampling the number of
+ * traces given by the Chernoff-Hoeffding bound. The traces are sampled in batches on all threads.
+ */
+template<typename ModelType>
+class StatisticalModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    explicit StatisticalModelChecker(storm::prism::Program const& program);
+
+    static bool canHandleStatic(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+
+   private:
+    // The program that defines the model to check.
+    storm::prism::Program program;
+};
+}  // namespace modelchecker
+}  // namespace storm
@@ -73,8 +73,10 @@ std::vector<ValueType> Ctmc<ValueType, RewardModelType>::createExitRateVector(st
 
 template<typename ValueType, typename RewardModelType>
 void Ctmc<ValueType, RewardModelType>::reduceToStateBasedRewards() {
+    // The transition matrix is not changed, so the results of analyses on it remain valid.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = static_cast<Model<ValueType, RewardModelType> const&>(*this).getTransitionMatrix();
     for (auto& rewardModel : this->getRewardModels()) {
-        rewardModel.second.reduceToStateBasedRewards(this->getTransitionMatrix(), true, &exitRates);
+        rewardModel.second.reduceToStateBasedRewards(transitionMatrix, true, &exitRates);
     }
 }
 
@@ -90,6 +92,13 @@ storm::storage::SparseMatrix<ValueType> Ctmc<ValueType, RewardModelType>::comput
     return result;
 }
 
+template<typename ValueType, typename RewardModelType>
+storm::utility::MemoryUsage Ctmc<ValueType, RewardModelType>::getMemoryUsage() const {
+    storm::utility::MemoryUsage result = DeterministicModel<ValueType, RewardModelType>::getMemoryUsage();
+    result.add("exit rates", exitRates.capacity() * sizeof(ValueType));
+    return result;
+}
+
 template class Ctmc<double>;
 
 #ifdef STORM_HAVE_CARL
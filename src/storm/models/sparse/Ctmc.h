@@ -69,6 +69,8 @@ class Ctmc : public DeterministicModel<ValueType, RewardModelType> {
      */
     storm::storage::SparseMatrix<ValueType> computeProbabilityMatrix() const;
 
+    virtual storm::utility::MemoryUsage getMemoryUsage() const override;
+
    private:
     /*!
      * Computes the exit rate vector based on the given rate matrix.
@@ -39,8 +39,10 @@ Dtmc<ValueType, RewardModelType>::Dtmc(storm::storage::sparse::ModelComponents<V
 
 template<typename ValueType, typename RewardModelType>
 void Dtmc<ValueType, RewardModelType>::reduceToStateBasedRewards() {
+    // The transition matrix is not changed, so the results of analyses on it remain valid.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = static_cast<Model<ValueType, RewardModelType> const&>(*this).getTransitionMatrix();
     for (auto& rewardModel : this->getRewardModels()) {
-        rewardModel.second.reduceToStateBasedRewards(this->getTransitionMatrix(), true);
+        rewardModel.second.reduceToStateBasedRewards(transitionMatrix, true);
     }
 }
 
@@ -44,7 +44,7 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
         if (!other.containsLabel(labelIndexPair.first)) {
             return false;
         }
-        if (labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
+        if (*labelings[labelIndexPair.second] != other.getItems(labelIndexPair.first)) {
             return false;
         }
     }
@@ -52,9 +52,13 @@ bool ItemLabeling::operator==(ItemLabeling const& other) const {
 }
 
 ItemLabeling ItemLabeling::getSubLabeling(storm::storage::BitVector const& items) const {
+    if (items.size() == itemCount && items.full()) {
+        // All items are kept, so the labels can be shared.
+        return *this;
+    }
     ItemLabeling result(items.getNumberOfSetBits());
     for (auto const& labelIndexPair : nameToLabelingIndexMap) {
-        result.addLabel(labelIndexPair.first, labelings[labelIndexPair.second] % items);
+        result.addLabel(labelIndexPair.first, *labelings[labelIndexPair.second] % items);
     }
     return result;
 }
@@ -114,9 +118,9 @@ std::set<std::string> ItemLabeling::getLabelsOfItem(uint64_t item) const {
 
 void ItemLabeling::permuteItems(std::vector<uint64_t> const& inversePermutation) {
     STORM_LOG_THROW(inversePermutation.size() == itemCount, storm::exceptions::InvalidArgumentException, "Permutation does not match number of items");
-    std::vector<storm::storage::BitVector> newLabelings;
-    for (storm::storage::BitVector const& source : this->labelings) {
-        newLabelings.push_back(source.permute(inversePermutation));
+    std::vector<std::shared_ptr<storm::storage::BitVector>> newLabelings;
+    for (auto const& source : this->labelings) {
+        newLabelings.push_back(std::make_shared<storm::storage::BitVector>(source->permute(inversePermutation)));
     }
 
     this->labelings = newLabelings;
@@ -127,7 +131,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector const&
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.push_back(labeling);
+    labelings.push_back(std::make_shared<storm::storage::BitVector>(labeling));
 }
 
 void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -135,7 +139,7 @@ void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& label
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException,
                     "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
     nameToLabelingIndexMap.emplace(label, labelings.size());
-    labelings.emplace_back(std::move(labeling));
+    labelings.push_back(std::make_shared<storm::storage::BitVector>(std::move(labeling)));
 }
 
 std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -157,20 +161,20 @@ bool ItemLabeling::containsLabel(std::string const& label) const {
 void ItemLabeling::addLabelToItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+    getModifiableLabeling(nameToLabelingIndexMap.at(label)).set(item, true);
 }
 
 void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
     STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
     STORM_LOG_THROW(this->getItemHasLabel(label, item), storm::exceptions::InvalidArgumentException,
                     "Item " << item << " does not have label '" << label << "'.");
-    this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+    getModifiableLabeling(nameToLabelingIndexMap.at(label)).set(item, false);
 }
 
 bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label '" << label << "' is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)].get(item);
+    return this->labelings[nameToLabelingIndexMap.at(label)]->get(item);
 }
 
 std::size_t ItemLabeling::getNumberOfLabels() const {
@@ -184,27 +188,27 @@ std::size_t ItemLabeling::getNumberOfItems() const {
 storm::storage::BitVector const& ItemLabeling::getItems(std::string const& label) const {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
-    return this->labelings[nameToLabelingIndexMap.at(label)];
+    return *this->labelings[nameToLabelingIndexMap.at(label)];
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector const& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    this->labelings[nameToLabelingIndexMap.at(label)] = std::make_shared<storm::storage::BitVector>(labeling);
 }
 
 void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
     STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException,
                     "The label " << label << " is invalid for the labeling of the model.");
     STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
-    this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+    this->labelings[nameToLabelingIndexMap.at(label)] = std::make_shared<storm::storage::BitVector>(std::move(labeling));
 }
 
 void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
     out << this->getNumberOfLabels() << " labels\n";
     for (auto const& labelIndexPair : this->nameToLabelingIndexMap) {
-        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second].getNumberOfSetBits() << " item(s)\n";
+        out << "   * " << labelIndexPair.first << " -> " << this->labelings[labelIndexPair.second]->getNumberOfSetBits() << " item(s)\n";
     }
 }
 
@@ -212,7 +216,7 @@ void ItemLabeling::printCompleteLabelingInformationToStream(std::ostream& out) c
     out << "Labels: \t" << this->getNumberOfLabels() << '\n';
     for (auto label : nameToLabelingIndexMap) {
         out << "Label '" << label.first << "': ";
-        for (auto index : this->labelings[label.second]) {
+        for (auto index : *this->labelings[label.second]) {
             out << index << " ";
         }
         out << '\n';
@@ -223,6 +227,26 @@ std::size_t ItemLabeling::hash() const {
     return 0;
 }
 
+uint64_t ItemLabeling::getSizeInBytes() const {
+    uint64_t result = sizeof(*this);
+    for (auto const& nameIndexPair : nameToLabelingIndexMap) {
+        // Account for the node of the map as well as for the name.
+        result += sizeof(nameIndexPair) + sizeof(void*) + nameIndexPair.first.capacity();
+    }
+    for (auto const& labeling : labelings) {
+        result += labeling->getSizeInBytes();
+    }
+    return result;
+}
+
+storm::storage::BitVector& ItemLabeling::getModifiableLabeling(uint64_t labelIndex) {
+    auto& labeling = labelings[labelIndex];
+    if (labeling.use_count() > 1) {
+        labeling = std::make_shared<storm::storage::BitVector>(*labeling);
+    }
+    return *labeling;
+}
+
 std::ostream& operator<<(std::ostream& out, ItemLabeling const& labeling) {
     labeling.printLabelingInformationToStream(out);
     return out;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <ostream>
 #include <set>
 #include <string>
@@ -142,6 +143,11 @@ class ItemLabeling {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Retrieves the (approximate) number of bytes allocated by the labeling.
+     */
+    uint64_t getSizeInBytes() const;
+
     /*!
      * Prints information about the labeling to the specified stream.
      *
@@ -229,8 +235,14 @@ class ItemLabeling {
     // A mapping from labels to the index of the corresponding bit vector in the vector.
     std::unordered_map<std::string, uint64_t> nameToLabelingIndexMap;
 
-    // A vector that holds the labeling for all known labels.
-    std::vector<storm::storage::BitVector> labelings;
+    // A vector that holds the labeling for all known labels. The bit vectors are shared between copies of the labeling
+    // (e.g. across model transformations) and are only copied once they are modified.
+    std::vector<std::shared_ptr<storm::storage::BitVector>> labelings;
+
+    /*!
+     * Retrieves the labeling with the given index for modification, copying it first if it is shared with other labelings.
+     */
+    storm::storage::BitVector& getModifiableLabeling(uint64_t labelIndex);
 
     /*!
      * Generate a unique, previously unused label from the given prefix string.
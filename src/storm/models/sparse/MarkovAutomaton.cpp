@@ -257,6 +257,13 @@ void MarkovAutomaton<ValueType, RewardModelType>::printModelInformationToStream(
     this->printModelInformationFooterToStream(out);
 }
 
+template<typename ValueType, typename RewardModelType>
+storm::utility::MemoryUsage MarkovAutomaton<ValueType, RewardModelType>::getMemoryUsage() const {
+    storm::utility::MemoryUsage result = NondeterministicModel<ValueType, RewardModelType>::getMemoryUsage();
+    result.add("Markovian states and exit rates", markovianStates.getSizeInBytes() + exitRates.capacity() * sizeof(ValueType));
+    return result;
+}
+
 template class MarkovAutomaton<double>;
 #ifdef STORM_HAVE_CARL
 
@@ -157,6 +157,8 @@ class MarkovAutomaton : public NondeterministicModel<ValueType, RewardModelType>
 
     virtual void printModelInformationToStream(std::ostream& out) const override;
 
+    virtual storm::utility::MemoryUsage getMemoryUsage() const override;
+
    private:
     /*!
      * Under the assumption that the Markovian choices of this Markov automaton are expressed in terms of
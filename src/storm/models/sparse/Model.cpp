@@ -9,6 +9,7 @@
 #include "storm/io/export.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/vector.h"
@@ -27,7 +28,8 @@ Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sp
       rewardModels(components.rewardModels),
       choiceLabeling(components.choiceLabeling),
       stateValuations(components.stateValuations),
-      choiceOrigins(components.choiceOrigins) {
+      choiceOrigins(components.choiceOrigins),
+      analysisCache(std::make_shared<ModelAnalysisCache<ValueType>>()) {
     assertValidityOfComponents(components);
 }
 
@@ -39,7 +41,8 @@ Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sp
       rewardModels(std::move(components.rewardModels)),
       choiceLabeling(std::move(components.choiceLabeling)),
       stateValuations(std::move(components.stateValuations)),
-      choiceOrigins(std::move(components.choiceOrigins)) {
+      choiceOrigins(std::move(components.choiceOrigins)),
+      analysisCache(std::make_shared<ModelAnalysisCache<ValueType>>()) {
     assertValidityOfComponents(components);
 }
 
@@ -143,7 +146,25 @@ void Model<ValueType, RewardModelType>::assertValidityOfComponents(
 
 template<typename ValueType, typename RewardModelType>
 storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
-    return this->getTransitionMatrix().transpose(true);
+    return analysisCache->getBackwardTransitions(this->getTransitionMatrix());
+}
+
+template<typename ValueType, typename RewardModelType>
+storm::storage::SparsePattern const& Model<ValueType, RewardModelType>::getBackwardTransitionPattern() const {
+    return analysisCache->getBackwardTransitionPattern(this->getTransitionMatrix());
+}
+
+template<typename ValueType, typename RewardModelType>
+ModelAnalysisCache<ValueType>& Model<ValueType, RewardModelType>::getAnalysisCache() const {
+    return *analysisCache;
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::resetAnalysisCache() {
+    // Copies of this model may still use the current cache, so we replace it instead of clearing it.
+    if (!analysisCache->empty()) {
+        analysisCache = std::make_shared<ModelAnalysisCache<ValueType>>();
+    }
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -251,6 +272,7 @@ void Model<ValueType, RewardModelType>::addRewardModel(std::string const& reward
     }
     STORM_LOG_ASSERT(newRewardModel.isCompatible(this->getNumberOfStates(), this->getTransitionMatrix().getRowCount()), "New reward model is not compatible.");
     this->rewardModels.emplace(rewardModelName, newRewardModel);
+    analysisCache->clearBisimulationQuotients();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -259,6 +281,7 @@ bool Model<ValueType, RewardModelType>::removeRewardModel(std::string const& rew
     bool res = (it != this->rewardModels.end());
     if (res) {
         this->rewardModels.erase(it->first);
+        analysisCache->clearBisimulationQuotients();
     }
     return res;
 }
@@ -315,6 +338,8 @@ storm::models::sparse::StateLabeling const& Model<ValueType, RewardModelType>::g
 
 template<typename ValueType, typename RewardModelType>
 storm::models::sparse::StateLabeling& Model<ValueType, RewardModelType>::getStateLabeling() {
+    // The labels may be changed, so quotients preserving them can no longer be used.
+    analysisCache->clearBisimulationQuotients();
     return stateLabeling;
 }
 
@@ -404,6 +429,26 @@ std::size_t Model<ValueType, RewardModelType>::hash() const {
     return seed;
 }
 
+template<typename ValueType, typename RewardModelType>
+storm::utility::MemoryUsage Model<ValueType, RewardModelType>::getMemoryUsage() const {
+    storm::utility::MemoryUsage result;
+    result.add("transition matrix", transitionMatrix.getSizeInBytes());
+    result.add("state labeling", stateLabeling.getSizeInBytes());
+    for (auto const& rewardModel : rewardModels) {
+        result.add("reward model '" + rewardModel.first + "'", rewardModel.second.getSizeInBytes());
+    }
+    if (choiceLabeling) {
+        result.add("choice labeling", choiceLabeling->getSizeInBytes());
+    }
+    if (stateValuations) {
+        result.add("state valuations", stateValuations->getSizeInBytes());
+    }
+    if (choiceOrigins) {
+        result.add("choice origins", choiceOrigins.get()->getSizeInBytes());
+    }
+    return result;
+}
+
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::printModelInformationHeaderToStream(std::ostream& out) const {
     out << "-------------------------------------------------------------- \n";
@@ -613,11 +658,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    resetAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    resetAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -703,7 +750,7 @@ std::set<storm::RationalFunctionVariable> getAllParameters(Model<storm::Rational
     std::set<storm::RationalFunctionVariable> parameters = getProbabilityParameters(model);
     std::set<storm::RationalFunctionVariable> rewardParameters = getRewardParameters(model);
     parameters.insert(rewardParameters.begin(), rewardParameters.end());
-    std::set<storm::RationalFunctionVariable> rateParameters = getRewardParameters(model);
+    std::set<storm::RationalFunctionVariable> rateParameters = getRateParameters(model);
     parameters.insert(rateParameters.begin(), rateParameters.end());
     return parameters;
 }
@@ -2,6 +2,7 @@
 #define STORM_MODELS_SPARSE_MODEL_H_
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -10,10 +11,12 @@
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparsePattern.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/MemoryUsage.h"
 #include "storm/utility/OsDetection.h"
 
 namespace storm {
@@ -27,6 +30,9 @@ namespace sparse {
 template<typename ValueType>
 class StandardRewardModel;
 
+template<typename ValueType>
+class ModelAnalysisCache;
+
 /*!
  * Base class for all sparse models.
  */
@@ -55,10 +61,36 @@ class Model : public storm::models::Model<CValueType> {
      * Retrieves the backward transition relation of the model, i.e. a set of transitions between states
      * that correspond to the reversed transition relation of this model.
      *
+     * The backward transitions are computed upon the first call and then kept in the analysis cache of this model, so
+     * subsequent calls only copy them.
+     *
      * @return A sparse matrix that represents the backward transitions of this model.
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Retrieves the pattern of the backward transitions of the model, i.e. the backward transitions without values. As
+     * it is considerably smaller, graph analyses should prefer it over the backward transitions.
+     *
+     * The pattern is computed upon the first call and then kept in the analysis cache of this model.
+     */
+    storm::storage::SparsePattern const& getBackwardTransitionPattern() const;
+
+    /*!
+     * Retrieves the cache that holds the results of graph analyses on the transition matrix of this model. Copies of this
+     * model share the cache until their transition matrix is modified.
+     *
+     * @note Setting the transition matrix of this model (or calling resetAnalysisCache) replaces the cache, so any
+     * references obtained from the previous one must not be used afterwards.
+     */
+    ModelAnalysisCache<ValueType>& getAnalysisCache() const;
+
+    /*!
+     * Discards the results in the analysis cache of this model. This needs to be called after the transition matrix was
+     * modified through the reference returned by the non-const getTransitionMatrix.
+     */
+    void resetAnalysisCache();
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -128,6 +160,9 @@ class Model : public storm::models::Model<CValueType> {
     /*!
      * Retrieves the matrix representing the transitions of the model.
      *
+     * @note The analysis cache of this model is kept, so resetAnalysisCache needs to be called after modifying the matrix
+     * through the returned reference.
+     *
      * @return A matrix representing the transitions of the model.
      */
     storm::storage::SparseMatrix<ValueType>& getTransitionMatrix();
@@ -386,6 +421,12 @@ class Model : public storm::models::Model<CValueType> {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Retrieves a breakdown of the memory allocated by the components of the model (transition matrix, labelings, reward models, etc.).
+     * Memory that is allocated by the values themselves (e.g. for rational numbers) is not taken into account.
+     */
+    virtual storm::utility::MemoryUsage getMemoryUsage() const;
+
    protected:
     RewardModelType& rewardModel(std::string const& rewardModelName);
     /*!
@@ -452,6 +493,9 @@ class Model : public storm::models::Model<CValueType> {
 
     // if set, gives information about where each choice originates w.r.t. the input model description
     boost::optional<std::shared_ptr<storm::storage::sparse::ChoiceOrigins>> choiceOrigins;
+
+    // The results of graph analyses on the transition matrix.
+    std::shared_ptr<ModelAnalysisCache<ValueType>> analysisCache;
 };
 
 #ifdef STORM_HAVE_CARL
@@ -0,0 +1,213 @@
+#include "storm/models/sparse/ModelAnalysisCache.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/ModelBase.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace models {
+namespace sparse {
+
+template<typename ValueType>
+const uint64_t ModelAnalysisCache<ValueType>::defaultMaximalSizeOfQualitativeResults = 256ull * 1024 * 1024;
+
+template<typename ValueType>
+ModelAnalysisCache<ValueType>::ModelAnalysisCache(uint64_t maximalSizeOfQualitativeResults)
+    : sizeOfQualitativeResults(0), maximalSizeOfQualitativeResults(maximalSizeOfQualitativeResults) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ModelAnalysisCache<ValueType>::~ModelAnalysisCache() = default;
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& ModelAnalysisCache<ValueType>::getBackwardTransitions(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return getBackwardTransitionsUnsynchronized(transitionMatrix);
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& ModelAnalysisCache<ValueType>::getBackwardTransitionsUnsynchronized(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    if (!backwardTransitions) {
+        backwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(transitionMatrix.transpose(true));
+    }
+    return *backwardTransitions;
+}
+
+template<typename ValueType>
+storm::storage::SparsePattern const& ModelAnalysisCache<ValueType>::getBackwardTransitionPattern(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return getBackwardTransitionPatternUnsynchronized(transitionMatrix);
+}
+
+template<typename ValueType>
+storm::storage::SparsePattern const& ModelAnalysisCache<ValueType>::getBackwardTransitionPatternUnsynchronized(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    if (!backwardTransitionPattern) {
+        backwardTransitionPattern = std::make_unique<storm::storage::SparsePattern>(transitionMatrix, true, true);
+    }
+    return *backwardTransitionPattern;
+}
+
+template<typename ValueType>
+storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& ModelAnalysisCache<ValueType>::getBottomSccDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!bottomSccDecomposition) {
+        bottomSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
+            transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+    }
+    return *bottomSccDecomposition;
+}
+
+template<typename ValueType>
+storm::storage::MaximalEndComponentDecomposition<ValueType> const& ModelAnalysisCache<ValueType>::getMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!maximalEndComponentDecomposition) {
+        maximalEndComponentDecomposition = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(
+            transitionMatrix, getBackwardTransitionPatternUnsynchronized(transitionMatrix));
+    }
+    return *maximalEndComponentDecomposition;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> ModelAnalysisCache<ValueType>::getQualitativeResult(
+    QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& computeResult) {
+    std::size_t hash = std::hash<storm::storage::BitVector>()(phiStates) ^ (std::hash<storm::storage::BitVector>()(psiStates) << 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = qualitativeResults.begin(); it != qualitativeResults.end(); ++it) {
+            if (it->analysis == analysis && it->hash == hash && it->phiStates == phiStates && it->psiStates == psiStates) {
+                // Mark the result as the most recently used one.
+                qualitativeResults.splice(qualitativeResults.begin(), qualitativeResults, it);
+                return qualitativeResults.front().result;
+            }
+        }
+    }
+
+    // The lock is not held while computing the result, so other analyses can proceed in the meantime.
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result = computeResult();
+    uint64_t size = phiStates.getSizeInBytes() + psiStates.getSizeInBytes() + result.first.getSizeInBytes() + result.second.getSizeInBytes();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (size <= maximalSizeOfQualitativeResults) {
+        evictQualitativeResults(maximalSizeOfQualitativeResults - size);
+        qualitativeResults.push_front(QualitativeResult{analysis, hash, phiStates, psiStates, result, size});
+        sizeOfQualitativeResults += size;
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool ModelAnalysisCache<ValueType>::BisimulationPreservation::covers(BisimulationPreservation const& other) const {
+    // Strong bisimulation is finer than weak bisimulation.
+    return (type == other.type || type == storm::storage::BisimulationType::Strong) && (rewards || !other.rewards) && (bounded || !other.bounded) &&
+           std::includes(atomicPropositions.begin(), atomicPropositions.end(), other.atomicPropositions.begin(), other.atomicPropositions.end());
+}
+
+template<typename ValueType>
+bool ModelAnalysisCache<ValueType>::BisimulationPreservation::operator==(BisimulationPreservation const& other) const {
+    return type == other.type && atomicPropositions == other.atomicPropositions && rewards == other.rewards && bounded == other.bounded;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::ModelBase> ModelAnalysisCache<ValueType>::getBisimulationQuotient(BisimulationPreservation const& preservation) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto const& entry : bisimulationQuotients) {
+        if (entry.first == preservation) {
+            return entry.second;
+        }
+    }
+    return nullptr;
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::ModelBase> ModelAnalysisCache<ValueType>::getCoveringBisimulationQuotient(BisimulationPreservation const& preservation) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<storm::models::ModelBase> result;
+    for (auto const& entry : bisimulationQuotients) {
+        if (entry.first.covers(preservation) && (!result || entry.second->getNumberOfStates() < result->getNumberOfStates())) {
+            result = entry.second;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::storeBisimulationQuotient(BisimulationPreservation const& preservation,
+                                                              std::shared_ptr<storm::models::ModelBase> const& quotient) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& entry : bisimulationQuotients) {
+        if (entry.first == preservation) {
+            entry.second = quotient;
+            return;
+        }
+    }
+    bisimulationQuotients.emplace_back(preservation, quotient);
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::clearBisimulationQuotients() {
+    std::lock_guard<std::mutex> lock(mutex);
+    bisimulationQuotients.clear();
+}
+
+template<typename ValueType>
+uint64_t ModelAnalysisCache<ValueType>::getNumberOfBisimulationQuotients() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bisimulationQuotients.size();
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::evictQualitativeResults(uint64_t size) {
+    while (sizeOfQualitativeResults > size) {
+        STORM_LOG_ASSERT(!qualitativeResults.empty(), "Expected stored results.");
+        sizeOfQualitativeResults -= qualitativeResults.back().size;
+        qualitativeResults.pop_back();
+    }
+}
+
+template<typename ValueType>
+uint64_t ModelAnalysisCache<ValueType>::getNumberOfQualitativeResults() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return qualitativeResults.size();
+}
+
+template<typename ValueType>
+uint64_t ModelAnalysisCache<ValueType>::getSizeOfQualitativeResults() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return sizeOfQualitativeResults;
+}
+
+template<typename ValueType>
+void ModelAnalysisCache<ValueType>::setMaximalSizeOfQualitativeResults(uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    maximalSizeOfQualitativeResults = value;
+    evictQualitativeResults(value);
+}
+
+template<typename ValueType>
+bool ModelAnalysisCache<ValueType>::empty() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !backwardTransitions && !backwardTransitionPattern && !bottomSccDecomposition && !maximalEndComponentDecomposition && qualitativeResults.empty() &&
+           bisimulationQuotients.empty();
+}
+
+template class ModelAnalysisCache<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ModelAnalysisCache<storm::RationalNumber>;
+template class ModelAnalysisCache<storm::RationalFunction>;
+#endif
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
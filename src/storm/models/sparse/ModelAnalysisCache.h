@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparsePattern.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace models {
+class ModelBase;
+
+namespace sparse {
+
+/*!
+ * Stores the results of graph analyses on the transition matrix of a sparse model, such that checking several properties
+ * on the same model performs every analysis only once. This comprises results that do not depend on the property (the
+ * backward transitions and the decompositions into bottom SCCs and MECs) as well as qualitative results for given sets of
+ * constraint and target states. As the latter may accumulate, their memory consumption is bounded and the least recently
+ * used results are evicted first. Moreover, the cache holds the bisimulation quotients of the model, such that a quotient
+ * that preserves all relevant properties only needs to be computed once.
+ *
+ * All methods may be called concurrently. References returned by this cache remain valid as long as the cache exists.
+ */
+template<typename ValueType>
+class ModelAnalysisCache {
+   public:
+    enum class QualitativeAnalysis { Prob01, Prob01Min, Prob01Max };
+
+    /*!
+     * Describes the information of the model that is preserved by a bisimulation quotient.
+     */
+    struct BisimulationPreservation {
+        storm::storage::BisimulationType type;
+        std::set<std::string> atomicPropositions;
+        bool rewards;
+        bool bounded;
+
+        /*!
+         * Retrieves whether a quotient preserving this information also preserves the given information, i.e. whether
+         * minimizing the quotient further yields a quotient preserving the given information.
+         */
+        bool covers(BisimulationPreservation const& other) const;
+
+        bool operator==(BisimulationPreservation const& other) const;
+    };
+
+    /*!
+     * Creates an empty cache.
+     *
+     * @param maximalSizeOfQualitativeResults The number of bytes that the stored qualitative results may occupy.
+     */
+    explicit ModelAnalysisCache(uint64_t maximalSizeOfQualitativeResults = defaultMaximalSizeOfQualitativeResults);
+    ~ModelAnalysisCache();
+
+    /*!
+     * Retrieves the backward transitions of the given transition matrix, i.e. its transpose in which the row grouping is
+     * ignored. They are computed upon the first call.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the pattern of the backward transitions of the given transition matrix (i.e. the backward transitions
+     * without values), which is computed upon the first call. Graph analyses should prefer it over the backward
+     * transitions as it occupies only a fraction of their memory.
+     */
+    storm::storage::SparsePattern const& getBackwardTransitionPattern(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the decomposition of the given (deterministic) transition matrix into its bottom SCCs, which is computed
+     * upon the first call.
+     */
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& getBottomSccDecomposition(
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the maximal end component decomposition of the given (nondeterministic) transition matrix, which is computed
+     * upon the first call.
+     */
+    storm::storage::MaximalEndComponentDecomposition<ValueType> const& getMaximalEndComponentDecomposition(
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the result of the given qualitative analysis for the given constraint and target states. If no such result
+     * is stored, it is obtained from the given function and stored (possibly evicting other results).
+     *
+     * @param analysis The analysis whose result is requested.
+     * @param phiStates The constraint states.
+     * @param psiStates The target states.
+     * @param computeResult A function that computes the result if it is not stored.
+     * @return The states with probability zero and one, respectively.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> getQualitativeResult(
+        QualitativeAnalysis analysis, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+        std::function<std::pair<storm::storage::BitVector, storm::storage::BitVector>()> const& computeResult);
+
+    /*!
+     * Retrieves the stored bisimulation quotient that preserves exactly the given information (if any).
+     */
+    std::shared_ptr<storm::models::ModelBase> getBisimulationQuotient(BisimulationPreservation const& preservation) const;
+
+    /*!
+     * Retrieves the smallest stored bisimulation quotient that preserves (at least) the given information (if any).
+     */
+    std::shared_ptr<storm::models::ModelBase> getCoveringBisimulationQuotient(BisimulationPreservation const& preservation) const;
+
+    /*!
+     * Stores the given bisimulation quotient of the model, replacing a quotient that preserves the same information.
+     */
+    void storeBisimulationQuotient(BisimulationPreservation const& preservation, std::shared_ptr<storm::models::ModelBase> const& quotient);
+
+    /*!
+     * Removes all stored bisimulation quotients. This needs to be called whenever the labels or reward models of the model change.
+     */
+    void clearBisimulationQuotients();
+
+    /*!
+     * Retrieves the number of bisimulation quotients that are currently stored.
+     */
+    uint64_t getNumberOfBisimulationQuotients() const;
+
+    /*!
+     * Retrieves the number of qualitative results that are currently stored.
+     */
+    uint64_t getNumberOfQualitativeResults() const;
+
+    /*!
+     * Retrieves the number of bytes occupied by the stored qualitative results.
+     */
+    uint64_t getSizeOfQualitativeResults() const;
+
+    /*!
+     * Sets the number of bytes that the stored qualitative results may occupy and evicts results if necessary.
+     */
+    void setMaximalSizeOfQualitativeResults(uint64_t value);
+
+    /*!
+     * Retrieves whether nothing is stored in this cache.
+     */
+    bool empty() const;
+
+    static const uint64_t defaultMaximalSizeOfQualitativeResults;
+
+   private:
+    struct QualitativeResult {
+        QualitativeAnalysis analysis;
+        std::size_t hash;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+        uint64_t size;
+    };
+
+    storm::storage::SparseMatrix<ValueType> const& getBackwardTransitionsUnsynchronized(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+    storm::storage::SparsePattern const& getBackwardTransitionPatternUnsynchronized(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Evicts the least recently used qualitative results until the stored results fit into the given size.
+     */
+    void evictQualitativeResults(uint64_t size);
+
+    mutable std::mutex mutex;
+
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+    std::unique_ptr<storm::storage::SparsePattern> backwardTransitionPattern;
+    std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> bottomSccDecomposition;
+    std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>> maximalEndComponentDecomposition;
+
+    // The stored qualitative results, ordered from the most to the least recently used.
+    std::list<QualitativeResult> qualitativeResults;
+    uint64_t sizeOfQualitativeResults;
+    uint64_t maximalSizeOfQualitativeResults;
+
+    std::vector<std::pair<BisimulationPreservation, std::shared_ptr<storm::models::ModelBase>>> bisimulationQuotients;
+};
+
+}  // namespace sparse
+}  // namespace models
+}  // namespace storm
@@ -4,7 +4,9 @@
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/io/export.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/memorystructure/MemoryStructureBuilder.h"
 #include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
@@ -41,11 +43,19 @@ uint_fast64_t NondeterministicModel<ValueType, RewardModelType>::getNumberOfChoi
 
 template<typename ValueType, typename RewardModelType>
 void NondeterministicModel<ValueType, RewardModelType>::reduceToStateBasedRewards() {
+    // The transition matrix is not changed, so the results of analyses on it remain valid.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix = static_cast<Model<ValueType, RewardModelType> const&>(*this).getTransitionMatrix();
     for (auto& rewardModel : this->getRewardModels()) {
-        rewardModel.second.reduceToStateBasedRewards(this->getTransitionMatrix(), false);
+        rewardModel.second.reduceToStateBasedRewards(transitionMatrix, false);
     }
 }
 
+template<typename ValueType, typename RewardModelType>
+storm::storage::MaximalEndComponentDecomposition<ValueType> const& NondeterministicModel<ValueType, RewardModelType>::getMaximalEndComponentDecomposition()
+    const {
+    return this->getAnalysisCache().getMaximalEndComponentDecomposition(this->getTransitionMatrix());
+}
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> NondeterministicModel<ValueType, RewardModelType>::applyScheduler(
     storm::storage::Scheduler<ValueType> const& scheduler, bool dropUnreachableStates, bool preserveModelType) const {
@@ -10,7 +10,9 @@ namespace storm {
 namespace storage {
 template<typename ValueType>
 class Scheduler;
-}
+template<typename ValueType>
+class MaximalEndComponentDecomposition;
+}  // namespace storage
 
 namespace models {
 namespace sparse {
@@ -65,6 +67,12 @@ class NondeterministicModel : public Model<ValueType, RewardModelType> {
                                                                                              bool dropUnreachableStates = true,
                                                                                              bool preserveModelType = false) const;
 
+    /*!
+     * Retrieves the maximal end component decomposition of this model. The decomposition is computed upon the first call and
+     * then kept in the analysis cache of this model, such that checking the model against several properties computes it only once.
+     */
+    storm::storage::MaximalEndComponentDecomposition<ValueType> const& getMaximalEndComponentDecomposition() const;
+
     virtual void printModelInformationToStream(std::ostream& out) const override;
 
     virtual void writeDotToStream(std::ostream& outStream, size_t maxWidthLabel = 30, bool includeLabeling = true,
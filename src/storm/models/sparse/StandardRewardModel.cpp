@@ -9,13 +9,34 @@
 namespace storm {
 namespace models {
 namespace sparse {
+namespace detail {
+template<typename T>
+std::shared_ptr<T> makeShared(boost::optional<T> const& value) {
+    return value ? std::make_shared<T>(value.get()) : nullptr;
+}
+
+template<typename T>
+std::shared_ptr<T> makeShared(boost::optional<T>&& value) {
+    return value ? std::make_shared<T>(std::move(value.get())) : nullptr;
+}
+
+// Makes sure that the given data is not shared with other reward models before it is modified.
+template<typename T>
+T& detach(std::shared_ptr<T>& value) {
+    if (value.use_count() > 1) {
+        value = std::make_shared<T>(*value);
+    }
+    return *value;
+}
+}  // namespace detail
+
 template<typename ValueType>
 StandardRewardModel<ValueType>::StandardRewardModel(boost::optional<std::vector<ValueType>> const& optionalStateRewardVector,
                                                     boost::optional<std::vector<ValueType>> const& optionalStateActionRewardVector,
                                                     boost::optional<storm::storage::SparseMatrix<ValueType>> const& optionalTransitionRewardMatrix)
-    : optionalStateRewardVector(optionalStateRewardVector),
-      optionalStateActionRewardVector(optionalStateActionRewardVector),
-      optionalTransitionRewardMatrix(optionalTransitionRewardMatrix) {
+    : stateRewardVector(detail::makeShared(optionalStateRewardVector)),
+      stateActionRewardVector(detail::makeShared(optionalStateActionRewardVector)),
+      transitionRewardMatrix(detail::makeShared(optionalTransitionRewardMatrix)) {
     // Intentionally left empty.
 }
 
@@ -23,139 +44,149 @@ template<typename ValueType>
 StandardRewardModel<ValueType>::StandardRewardModel(boost::optional<std::vector<ValueType>>&& optionalStateRewardVector,
                                                     boost::optional<std::vector<ValueType>>&& optionalStateActionRewardVector,
                                                     boost::optional<storm::storage::SparseMatrix<ValueType>>&& optionalTransitionRewardMatrix)
-    : optionalStateRewardVector(std::move(optionalStateRewardVector)),
-      optionalStateActionRewardVector(std::move(optionalStateActionRewardVector)),
-      optionalTransitionRewardMatrix(std::move(optionalTransitionRewardMatrix)) {
+    : stateRewardVector(detail::makeShared(std::move(optionalStateRewardVector))),
+      stateActionRewardVector(detail::makeShared(std::move(optionalStateActionRewardVector))),
+      transitionRewardMatrix(detail::makeShared(std::move(optionalTransitionRewardMatrix))) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasStateRewards() const {
-    return static_cast<bool>(this->optionalStateRewardVector);
+    return static_cast<bool>(this->stateRewardVector);
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasOnlyStateRewards() const {
-    return static_cast<bool>(this->optionalStateRewardVector) && !static_cast<bool>(this->optionalStateActionRewardVector) &&
-           !static_cast<bool>(this->optionalTransitionRewardMatrix);
+    return static_cast<bool>(this->stateRewardVector) && !static_cast<bool>(this->stateActionRewardVector) && !static_cast<bool>(this->transitionRewardMatrix);
 }
 
 template<typename ValueType>
 std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateRewardVector() const {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
-    return this->optionalStateRewardVector.get();
+    return *this->stateRewardVector;
 }
 
 template<typename ValueType>
 std::vector<ValueType>& StandardRewardModel<ValueType>::getStateRewardVector() {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
-    return this->optionalStateRewardVector.get();
+    return detail::detach(this->stateRewardVector);
 }
 
 template<typename ValueType>
-boost::optional<std::vector<ValueType>> const& StandardRewardModel<ValueType>::getOptionalStateRewardVector() const {
-    return this->optionalStateRewardVector;
+boost::optional<std::vector<ValueType>> StandardRewardModel<ValueType>::getOptionalStateRewardVector() const {
+    if (this->hasStateRewards()) {
+        return *this->stateRewardVector;
+    }
+    return boost::none;
 }
 
 template<typename ValueType>
 ValueType const& StandardRewardModel<ValueType>::getStateReward(uint_fast64_t state) const {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
-    STORM_LOG_ASSERT(state < this->optionalStateRewardVector.get().size(), "Invalid state.");
-    return this->optionalStateRewardVector.get()[state];
+    STORM_LOG_ASSERT(state < this->stateRewardVector->size(), "Invalid state.");
+    return (*this->stateRewardVector)[state];
 }
 
 template<typename ValueType>
 template<typename T>
 void StandardRewardModel<ValueType>::setStateReward(uint_fast64_t state, T const& newReward) {
     STORM_LOG_ASSERT(this->hasStateRewards(), "No state rewards available.");
-    STORM_LOG_ASSERT(state < this->optionalStateRewardVector.get().size(), "Invalid state.");
-    this->optionalStateRewardVector.get()[state] = newReward;
+    STORM_LOG_ASSERT(state < this->stateRewardVector->size(), "Invalid state.");
+    detail::detach(this->stateRewardVector)[state] = newReward;
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasStateActionRewards() const {
-    return static_cast<bool>(this->optionalStateActionRewardVector);
+    return static_cast<bool>(this->stateActionRewardVector);
 }
 
 template<typename ValueType>
 std::vector<ValueType> const& StandardRewardModel<ValueType>::getStateActionRewardVector() const {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
-    return this->optionalStateActionRewardVector.get();
+    return *this->stateActionRewardVector;
 }
 
 template<typename ValueType>
 std::vector<ValueType>& StandardRewardModel<ValueType>::getStateActionRewardVector() {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
-    return this->optionalStateActionRewardVector.get();
+    return detail::detach(this->stateActionRewardVector);
 }
 
 template<typename ValueType>
 ValueType const& StandardRewardModel<ValueType>::getStateActionReward(uint_fast64_t choiceIndex) const {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
-    STORM_LOG_ASSERT(choiceIndex < this->optionalStateActionRewardVector.get().size(), "Invalid choiceIndex.");
-    return this->optionalStateActionRewardVector.get()[choiceIndex];
+    STORM_LOG_ASSERT(choiceIndex < this->stateActionRewardVector->size(), "Invalid choiceIndex.");
+    return (*this->stateActionRewardVector)[choiceIndex];
 }
 
 template<typename ValueType>
 template<typename T>
 void StandardRewardModel<ValueType>::setStateActionReward(uint_fast64_t choiceIndex, T const& newValue) {
     STORM_LOG_ASSERT(this->hasStateActionRewards(), "No state action rewards available.");
-    STORM_LOG_ASSERT(choiceIndex < this->optionalStateActionRewardVector.get().size(), "Invalid choiceIndex.");
-    this->optionalStateActionRewardVector.get()[choiceIndex] = newValue;
+    STORM_LOG_ASSERT(choiceIndex < this->stateActionRewardVector->size(), "Invalid choiceIndex.");
+    detail::detach(this->stateActionRewardVector)[choiceIndex] = newValue;
 }
 
 template<typename ValueType>
-boost::optional<std::vector<ValueType>> const& StandardRewardModel<ValueType>::getOptionalStateActionRewardVector() const {
-    return this->optionalStateActionRewardVector;
+boost::optional<std::vector<ValueType>> StandardRewardModel<ValueType>::getOptionalStateActionRewardVector() const {
+    if (this->hasStateActionRewards()) {
+        return *this->stateActionRewardVector;
+    }
+    return boost::none;
 }
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::hasTransitionRewards() const {
-    return static_cast<bool>(this->optionalTransitionRewardMatrix);
+    return static_cast<bool>(this->transitionRewardMatrix);
 }
 
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> const& StandardRewardModel<ValueType>::getTransitionRewardMatrix() const {
-    return this->optionalTransitionRewardMatrix.get();
+    return *this->transitionRewardMatrix;
 }
 
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType>& StandardRewardModel<ValueType>::getTransitionRewardMatrix() {
-    return this->optionalTransitionRewardMatrix.get();
+    return detail::detach(this->transitionRewardMatrix);
 }
 
 template<typename ValueType>
-boost::optional<storm::storage::SparseMatrix<ValueType>> const& StandardRewardModel<ValueType>::getOptionalTransitionRewardMatrix() const {
-    return this->optionalTransitionRewardMatrix;
+boost::optional<storm::storage::SparseMatrix<ValueType>> StandardRewardModel<ValueType>::getOptionalTransitionRewardMatrix() const {
+    if (this->hasTransitionRewards()) {
+        return *this->transitionRewardMatrix;
+    }
+    return boost::none;
 }
 
 template<typename ValueType>
 StandardRewardModel<ValueType> StandardRewardModel<ValueType>::restrictActions(storm::storage::BitVector const& enabledActions) const {
-    boost::optional<std::vector<ValueType>> newStateRewardVector(this->getOptionalStateRewardVector());
-    boost::optional<std::vector<ValueType>> newStateActionRewardVector;
+    // The state rewards are not affected, so they are shared with the result.
+    StandardRewardModel<ValueType> result(*this);
     if (this->hasStateActionRewards()) {
-        newStateActionRewardVector = std::vector<ValueType>(enabledActions.getNumberOfSetBits());
-        storm::utility::vector::selectVectorValues(newStateActionRewardVector.get(), enabledActions, this->getStateActionRewardVector());
+        auto newStateActionRewardVector = std::make_shared<std::vector<ValueType>>(enabledActions.getNumberOfSetBits());
+        storm::utility::vector::selectVectorValues(*newStateActionRewardVector, enabledActions, this->getStateActionRewardVector());
+        result.stateActionRewardVector = std::move(newStateActionRewardVector);
     }
-    boost::optional<storm::storage::SparseMatrix<ValueType>> newTransitionRewardMatrix;
     if (this->hasTransitionRewards()) {
-        newTransitionRewardMatrix = this->getTransitionRewardMatrix().restrictRows(enabledActions);
+        result.transitionRewardMatrix =
+            std::make_shared<storm::storage::SparseMatrix<ValueType>>(this->getTransitionRewardMatrix().restrictRows(enabledActions));
     }
-    return StandardRewardModel(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    return result;
 }
 
 template<typename ValueType>
 StandardRewardModel<ValueType> StandardRewardModel<ValueType>::permuteActions(std::vector<uint64_t> const& inversePermutation) const {
-    boost::optional<std::vector<ValueType>> newStateRewardVector(this->getOptionalStateRewardVector());
-    boost::optional<std::vector<ValueType>> newStateActionRewardVector;
+    // The state rewards are not affected, so they are shared with the result.
+    StandardRewardModel<ValueType> result(*this);
     if (this->hasStateActionRewards()) {
-        newStateActionRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, this->getStateActionRewardVector());
+        result.stateActionRewardVector =
+            std::make_shared<std::vector<ValueType>>(storm::utility::vector::applyInversePermutation(inversePermutation, this->getStateActionRewardVector()));
     }
-    boost::optional<storm::storage::SparseMatrix<ValueType>> newTransitionRewardMatrix;
     if (this->hasTransitionRewards()) {
-        newTransitionRewardMatrix = this->getTransitionRewardMatrix().permuteRows(inversePermutation);
+        result.transitionRewardMatrix =
+            std::make_shared<storm::storage::SparseMatrix<ValueType>>(this->getTransitionRewardMatrix().permuteRows(inversePermutation));
     }
-    return StandardRewardModel(std::move(newStateRewardVector), std::move(newStateActionRewardVector), std::move(newTransitionRewardMatrix));
+    return result;
 }
 
 template<typename ValueType>
@@ -187,12 +218,13 @@ void StandardRewardModel<ValueType>::reduceToStateBasedRewards(storm::storage::S
                                                                std::vector<MatrixValueType> const* weights) {
     if (this->hasTransitionRewards()) {
         if (this->hasStateActionRewards()) {
-            storm::utility::vector::addVectors<ValueType>(this->getStateActionRewardVector(),
-                                                          transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix()),
-                                                          this->getStateActionRewardVector());
-            this->optionalTransitionRewardMatrix = boost::none;
+            std::vector<ValueType>& stateActionRewards = detail::detach(this->stateActionRewardVector);
+            storm::utility::vector::addVectors<ValueType>(stateActionRewards, transitionMatrix.getPointwiseProductRowSumVector(*this->transitionRewardMatrix),
+                                                          stateActionRewards);
+            this->transitionRewardMatrix.reset();
         } else {
-            this->optionalStateActionRewardVector = transitionMatrix.getPointwiseProductRowSumVector(this->getTransitionRewardMatrix());
+            this->stateActionRewardVector =
+                std::make_shared<std::vector<ValueType>>(transitionMatrix.getPointwiseProductRowSumVector(*this->transitionRewardMatrix));
         }
     }
 
@@ -202,21 +234,23 @@ void StandardRewardModel<ValueType>::reduceToStateBasedRewards(storm::storage::S
         if (weights) {
             if (this->hasStateRewards()) {
                 storm::utility::vector::applyPointwiseTernary<ValueType, MatrixValueType, ValueType>(
-                    this->getStateActionRewardVector(), *weights, this->getStateRewardVector(),
+                    *this->stateActionRewardVector, *weights, this->getStateRewardVector(),
                     [](ValueType const& sar, MatrixValueType const& w, ValueType const& sr) -> ValueType { return sr + w * sar; });
             } else {
-                this->optionalStateRewardVector = std::move(this->optionalStateActionRewardVector);
-                storm::utility::vector::applyPointwise<ValueType, MatrixValueType, ValueType, std::multiplies<>>(
-                    this->optionalStateRewardVector.get(), *weights, this->optionalStateRewardVector.get());
+                this->stateRewardVector = std::move(this->stateActionRewardVector);
+                std::vector<ValueType>& newStateRewardVector = detail::detach(this->stateRewardVector);
+                storm::utility::vector::applyPointwise<ValueType, MatrixValueType, ValueType, std::multiplies<>>(newStateRewardVector, *weights,
+                                                                                                                  newStateRewardVector);
             }
         } else {
             if (this->hasStateRewards()) {
-                storm::utility::vector::addVectors<ValueType>(this->getStateActionRewardVector(), this->getStateRewardVector(), this->getStateRewardVector());
+                std::vector<ValueType>& stateRewards = this->getStateRewardVector();
+                storm::utility::vector::addVectors<ValueType>(*this->stateActionRewardVector, stateRewards, stateRewards);
             } else {
-                this->optionalStateRewardVector = std::move(this->optionalStateActionRewardVector);
+                this->stateRewardVector = std::move(this->stateActionRewardVector);
             }
         }
-        this->optionalStateActionRewardVector = boost::none;
+        this->stateActionRewardVector.reset();
     }
 }
 
@@ -395,8 +429,7 @@ void StandardRewardModel<ValueType>::clearRewardAtState(uint_fast64_t state, sto
 
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::empty() const {
-    return !(static_cast<bool>(this->optionalStateRewardVector) || static_cast<bool>(this->optionalStateActionRewardVector) ||
-             static_cast<bool>(this->optionalTransitionRewardMatrix));
+    return !(static_cast<bool>(this->stateRewardVector) || static_cast<bool>(this->stateActionRewardVector) || static_cast<bool>(this->transitionRewardMatrix));
 }
 
 template<typename ValueType>
@@ -419,31 +452,62 @@ bool StandardRewardModel<ValueType>::isAllZero() const {
 template<typename ValueType>
 bool StandardRewardModel<ValueType>::isCompatible(uint_fast64_t nrStates, uint_fast64_t nrChoices) const {
     if (hasStateRewards()) {
-        if (optionalStateRewardVector.get().size() != nrStates)
+        if (stateRewardVector->size() != nrStates)
             return false;
     }
     if (hasStateActionRewards()) {
-        if (optionalStateActionRewardVector.get().size() != nrChoices)
+        if (stateActionRewardVector->size() != nrChoices)
             return false;
     }
     return true;
 }
 
+template<typename ValueType>
+void StandardRewardModel<ValueType>::shareIdenticalRewards(StandardRewardModel<ValueType> const& other) {
+    if (this->hasStateRewards() && other.hasStateRewards() && this->stateRewardVector != other.stateRewardVector &&
+        *this->stateRewardVector == *other.stateRewardVector) {
+        this->stateRewardVector = other.stateRewardVector;
+    }
+    if (this->hasStateActionRewards() && other.hasStateActionRewards() && this->stateActionRewardVector != other.stateActionRewardVector &&
+        *this->stateActionRewardVector == *other.stateActionRewardVector) {
+        this->stateActionRewardVector = other.stateActionRewardVector;
+    }
+    if (this->hasTransitionRewards() && other.hasTransitionRewards() && this->transitionRewardMatrix != other.transitionRewardMatrix &&
+        *this->transitionRewardMatrix == *other.transitionRewardMatrix) {
+        this->transitionRewardMatrix = other.transitionRewardMatrix;
+    }
+}
+
 template<typename ValueType>
 std::size_t StandardRewardModel<ValueType>::hash() const {
     size_t seed = 0;
     if (hasStateRewards()) {
-        boost::hash_combine(seed, boost::hash_range(optionalStateRewardVector->begin(), optionalStateRewardVector->end()));
+        boost::hash_combine(seed, boost::hash_range(stateRewardVector->begin(), stateRewardVector->end()));
     }
     if (hasStateActionRewards()) {
-        boost::hash_combine(seed, boost::hash_range(optionalStateActionRewardVector->begin(), optionalStateActionRewardVector->end()));
+        boost::hash_combine(seed, boost::hash_range(stateActionRewardVector->begin(), stateActionRewardVector->end()));
     }
     if (hasTransitionRewards()) {
-        boost::hash_combine(seed, optionalTransitionRewardMatrix->hash());
+        boost::hash_combine(seed, transitionRewardMatrix->hash());
     }
     return seed;
 }
 
+template<typename ValueType>
+uint64_t StandardRewardModel<ValueType>::getSizeInBytes() const {
+    uint64_t result = sizeof(*this);
+    if (hasStateRewards()) {
+        result += stateRewardVector->capacity() * sizeof(ValueType);
+    }
+    if (hasStateActionRewards()) {
+        result += stateActionRewardVector->capacity() * sizeof(ValueType);
+    }
+    if (hasTransitionRewards()) {
+        result += transitionRewardMatrix->getSizeInBytes();
+    }
+    return result;
+}
+
 template<typename ValueType>
 std::ostream& operator<<(std::ostream& out, StandardRewardModel<ValueType> const& rewardModel) {
     out << std::boolalpha << "reward model [state reward: " << rewardModel.hasStateRewards()
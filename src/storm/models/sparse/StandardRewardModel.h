@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <vector>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -38,6 +39,9 @@ class StandardRewardModel {
                         boost::optional<std::vector<ValueType>>&& optionalStateActionRewardVector = boost::none,
                         boost::optional<storm::storage::SparseMatrix<ValueType>>&& optionalTransitionRewardMatrix = boost::none);
 
+    // Copies of a reward model share the reward vectors (and the matrix) until one of them is modified (copy-on-write).
+    // Note that the non-const accessors detach the data of a shared reward model, so references obtained from them
+    // must not be kept across copies of the reward model.
     StandardRewardModel(StandardRewardModel<ValueType> const& other) = default;
     StandardRewardModel& operator=(StandardRewardModel<ValueType> const& other) = default;
 
@@ -87,7 +91,7 @@ class StandardRewardModel {
      *
      * @return The state reward vector if there is one.
      */
-    boost::optional<std::vector<ValueType>> const& getOptionalStateRewardVector() const;
+    boost::optional<std::vector<ValueType>> getOptionalStateRewardVector() const;
 
     /*!
      * Retrieves whether the reward model has state-action rewards.
@@ -134,7 +138,7 @@ class StandardRewardModel {
      *
      * @return The state-action reward vector if there is one.
      */
-    boost::optional<std::vector<ValueType>> const& getOptionalStateActionRewardVector() const;
+    boost::optional<std::vector<ValueType>> getOptionalStateActionRewardVector() const;
 
     /*!
      * Retrieves whether the reward model has transition rewards.
@@ -164,7 +168,7 @@ class StandardRewardModel {
      *
      * @return The transition reward matrix if there is one.
      */
-    boost::optional<storm::storage::SparseMatrix<ValueType>> const& getOptionalTransitionRewardMatrix() const;
+    boost::optional<storm::storage::SparseMatrix<ValueType>> getOptionalTransitionRewardMatrix() const;
 
     /*!
      * @param choiceIndex The index of the considered choice
@@ -331,25 +335,50 @@ class StandardRewardModel {
      */
     bool isCompatible(uint_fast64_t nrStates, uint_fast64_t nrChoices) const;
 
+    /*!
+     * Lets this reward model share the rewards of the given reward model wherever they are equal, such that identical
+     * rewards are stored only once.
+     *
+     * @param other The reward model whose rewards are to be shared.
+     */
+    void shareIdenticalRewards(StandardRewardModel<ValueType> const& other);
+
     std::size_t hash() const;
 
+    /*!
+     * Retrieves the number of bytes allocated by the reward model (not taking into account memory allocated by the values themselves).
+     */
+    uint64_t getSizeInBytes() const;
+
     template<typename ValueTypePrime>
     friend std::ostream& operator<<(std::ostream& out, StandardRewardModel<ValueTypePrime> const& rewardModel);
 
    private:
     // An (optional) vector representing the state rewards.
-    boost::optional<std::vector<ValueType>> optionalStateRewardVector;
+    std::shared_ptr<std::vector<ValueType>> stateRewardVector;
 
     // An (optional) vector representing the state-action rewards.
-    boost::optional<std::vector<ValueType>> optionalStateActionRewardVector;
+    std::shared_ptr<std::vector<ValueType>> stateActionRewardVector;
 
     // An (optional) matrix representing the transition rewards.
-    boost::optional<storm::storage::SparseMatrix<ValueType>> optionalTransitionRewardMatrix;
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType>> transitionRewardMatrix;
 };
 
 template<typename ValueType>
 std::ostream& operator<<(std::ostream& out, StandardRewardModel<ValueType> const& rewardModel);
 
+/*!
+ * Lets the reward models of the given map (from names to reward models) share their rewards wherever they are equal.
+ */
+template<typename RewardModelMap>
+void shareIdenticalRewards(RewardModelMap& rewardModels) {
+    for (auto it = rewardModels.begin(); it != rewardModels.end(); ++it) {
+        for (auto otherIt = rewardModels.begin(); otherIt != it; ++otherIt) {
+            it->second.shareIdenticalRewards(otherIt->second);
+        }
+    }
+}
+
 std::set<storm::RationalFunctionVariable> getRewardModelParameters(StandardRewardModel<storm::RationalFunction> const& rewModel);
 }  // namespace sparse
 }  // namespace models
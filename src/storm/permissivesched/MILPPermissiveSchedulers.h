@@ -22,6 +22,10 @@ template<typename RM>
 class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation<RM> {
    private:
     bool mCalledOptimizer = false;
+    bool mCreatedMILP = false;
+    bool mLowerBound = false;
+    double mBoundary = 0.0;
+    storm::storage::BitVector mRelevantStates;
     storm::solver::LpSolver<double>& solver;
     std::unordered_map<storm::storage::StateActionPair, storm::expressions::Variable> multistrategyVariables;
     std::unordered_map<uint_fast64_t, storm::expressions::Variable> mProbVariables;
@@ -35,13 +39,28 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
         : PermissiveSchedulerComputation<RM>(mdp, goalstates, sinkstates), solver(milpsolver) {}
 
     void calculatePermissiveScheduler(bool lowerBound, double boundary) override {
-        createMILP(lowerBound, boundary, this->mPenalties);
-        // STORM_LOG_DEBUG("Calling optimizer");
-        solver.optimize();
-        // STORM_LOG_DEBUG("Done optimizing.")
+        if (!mCreatedMILP) {
+            createMILP(lowerBound, boundary, this->mPenalties);
+        } else {
+            // Only the bound constraints and the objective depend on the query, so the remaining encoding is kept.
+            if (lowerBound != mLowerBound || boundary != mBoundary) {
+                solver.pop();
+                solver.push();
+                createBoundConstraints(lowerBound, boundary);
+            }
+            updateObjective(this->mPenalties);
+        }
+        if (!this->isInterrupted()) {
+            solver.optimize();
+        }
         mCalledOptimizer = true;
     }
 
+    void interrupt() override {
+        PermissiveSchedulerComputation<RM>::interrupt();
+        solver.interrupt();
+    }
+
     bool foundSolution() const override {
         STORM_LOG_ASSERT(mCalledOptimizer, "Optimizer not called.");
         return !solver.isInfeasible();
@@ -133,37 +152,35 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
     }
 
     /**
-     * Create constraints
+     * Updates the objective to the given penalties.
      */
-    void createConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
-        // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
+    void updateObjective(PermissiveSchedulerPenalties const& penalties) {
+        for (auto const& entry : multistrategyVariables) {
+            solver.setObjectiveFunctionCoefficient(entry.second, -penalties.get(entry.first));
+        }
+    }
 
+    /**
+     * Create the constraints that depend on the bound, i.e., (1) and (3).
+     */
+    void createBoundConstraints(bool lowerBound, double boundary) {
         // (1)
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
-        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
+        STORM_LOG_ASSERT(mRelevantStates[initialStateIndex], "Initial state not relevant.");
         if (lowerBound) {
             solver.addConstraint("c1", mProbVariables[initialStateIndex] >= solver.getConstant(boundary));
         } else {
             solver.addConstraint("c1", mProbVariables[initialStateIndex] <= solver.getConstant(boundary));
         }
-        for (uint_fast64_t s : relevantStates) {
+        for (uint_fast64_t s : mRelevantStates) {
             std::string stateString = std::to_string(s);
-            storm::expressions::Expression expr = solver.getConstant(0.0);
-            // (2)
-            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
-            }
-            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
-            // (5)
-            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
-
             // (3) For the relevant states.
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 std::string sastring(stateString + "_" + std::to_string(a));
-                expr = solver.getConstant(0.0);
+                storm::expressions::Expression expr = solver.getConstant(0.0);
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
-                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
+                    if (entry.getValue() != 0 && mRelevantStates.get(entry.getColumn())) {
                         expr = expr + solver.getConstant(entry.getValue()) * mProbVariables[entry.getColumn()];
                     } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
                         expr = expr + solver.getConstant(entry.getValue());
@@ -177,6 +194,26 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
                                          mProbVariables[s] >= (solver.getConstant(1) - multistrategyVariables[storage::StateActionPair(s, a)]) + expr);
                 }
             }
+        }
+        mLowerBound = lowerBound;
+        mBoundary = boundary;
+    }
+
+    /**
+     * Create the constraints that do not depend on the bound.
+     */
+    void createConstraints(storm::storage::BitVector const& relevantStates) {
+        // (5) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
+        for (uint_fast64_t s : relevantStates) {
+            std::string stateString = std::to_string(s);
+            storm::expressions::Expression expr = solver.getConstant(0.0);
+            // (2)
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                expr = expr + multistrategyVariables[storage::StateActionPair(s, a)];
+            }
+            solver.addConstraint("c2-" + stateString, solver.getConstant(1) <= expr);
+            // (5)
+            solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
 
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                 // (6)
@@ -213,15 +250,18 @@ class MilpPermissiveSchedulerComputation : public PermissiveSchedulerComputation
      *
      */
     void createMILP(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
+        mRelevantStates = this->computeRelevantStates();
         // Notice that the separated construction of variables and
         // constraints slows down the construction of the MILP.
         // In the future, we might want to merge this.
-        createVariables(penalties, relevantStates);
-        createConstraints(lowerBound, boundary, relevantStates);
+        createVariables(penalties, mRelevantStates);
+        createConstraints(mRelevantStates);
+        // The bound constraints are put on a separate level, such that they can be replaced for another bound.
+        solver.push();
+        createBoundConstraints(lowerBound, boundary);
 
         solver.setOptimizationDirection(storm::OptimizationDirection::Minimize);
+        mCreatedMILP = true;
     }
 };
 }  // namespace ps
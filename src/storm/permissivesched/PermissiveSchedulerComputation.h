@@ -1,10 +1,12 @@
 #ifndef PERMISSIVESCHEDULERCOMPUTATION_H
 #define PERMISSIVESCHEDULERCOMPUTATION_H
 
+#include <atomic>
 #include <memory>
 
 #include "../models/sparse/Mdp.h"
 #include "../storage/BitVector.h"
+#include "../utility/graph.h"
 #include "PermissiveSchedulerPenalty.h"
 #include "PermissiveSchedulers.h"
 
@@ -18,16 +20,42 @@ class PermissiveSchedulerComputation {
     storm::storage::BitVector const& mGoals;
     storm::storage::BitVector const& mSinks;
     PermissiveSchedulerPenalties mPenalties;
+    std::atomic<bool> mInterrupted;
+
+    /*!
+     * Retrieves the states that need to be encoded, i.e., the states that are reachable from the initial state without visiting a goal or sink
+     * state, excluding the goal and sink states themselves. Successors of these states are either encoded or goal or sink states.
+     */
+    storm::storage::BitVector computeRelevantStates() const {
+        storm::storage::BitVector irrelevant = mGoals | mSinks;
+        return storm::utility::graph::getReachableStates(mdp.getTransitionMatrix(), mdp.getInitialStates(), ~irrelevant, irrelevant) & ~irrelevant;
+    }
 
    public:
     PermissiveSchedulerComputation(storm::models::sparse::Mdp<double, RM> const& mdp, storm::storage::BitVector const& goalstates,
                                    storm::storage::BitVector const& sinkstates)
-        : mdp(mdp), mGoals(goalstates), mSinks(sinkstates) {}
+        : mdp(mdp), mGoals(goalstates), mSinks(sinkstates), mInterrupted(false) {}
 
     virtual ~PermissiveSchedulerComputation() = default;
 
+    /*!
+     * Computes a permissive scheduler for the current penalties. The encoding is created by the first call and reused by subsequent calls, so
+     * changing the penalties (or the bound) and calling this method again does not encode the MDP again.
+     */
     virtual void calculatePermissiveScheduler(bool lowerBound, double boundary) = 0;
 
+    /*!
+     * Requests the termination of a running (or the next) call to calculatePermissiveScheduler. In contrast to all other methods, this method may
+     * be called from another thread. The result of an interrupted computation must not be used.
+     */
+    virtual void interrupt() {
+        mInterrupted = true;
+    }
+
+    bool isInterrupted() const {
+        return mInterrupted;
+    }
+
     void setPenalties(PermissiveSchedulerPenalties penalties) {
         mPenalties = penalties;
     }
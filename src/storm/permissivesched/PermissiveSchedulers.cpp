@@ -1,12 +1,17 @@
 
 #include "PermissiveSchedulers.h"
 
+#include <exception>
+#include <mutex>
+
 #include "../modelchecker/propositional/SparsePropositionalModelChecker.h"
 #include "../modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "../utility/graph.h"
+#include "../utility/parallel.h"
 #include "../utility/solver.h"
 #include "MILPPermissiveSchedulers.h"
 #include "SmtBasedPermissiveSchedulers.h"
+#include "storm/exceptions/BaseException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/macros.h"
@@ -14,9 +19,14 @@
 namespace storm {
 namespace ps {
 
+namespace {
+
+/*!
+ * Computes the states that reach the goal almost surely and the states that reach it with probability zero under all schedulers, respectively.
+ */
 template<typename RM>
-boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
-                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
+std::pair<storm::storage::BitVector, storm::storage::BitVector> computeGoalAndSinkStates(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                         storm::logic::ProbabilityOperatorFormula const& safeProp) {
     storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
     STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
     auto backwardTransitions = mdp.getBackwardTransitions();
@@ -25,6 +35,15 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP
     goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
     storm::storage::BitVector sinkstates =
         storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
+    return std::make_pair(std::move(goalstates), std::move(sinkstates));
+}
+
+}  // namespace
+
+template<typename RM>
+boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
+    auto [goalstates, sinkstates] = computeGoalAndSinkStates(mdp, safeProp);
 
     auto solver = storm::utility::solver::getLpSolver<double>("Gurobi", storm::solver::LpSolverTypeSelection::Gurobi);
     MilpPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, mdp, goalstates, sinkstates);
@@ -46,14 +65,7 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMC(s
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp) {
-    storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<double, RM>> propMC(mdp);
-    STORM_LOG_ASSERT(safeProp.getSubformula().isEventuallyFormula(), "No eventually formula.");
-    auto backwardTransitions = mdp.getBackwardTransitions();
-    storm::storage::BitVector goalstates =
-        propMC.check(safeProp.getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
-    goalstates = storm::utility::graph::performProb1A(mdp, backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
-    storm::storage::BitVector sinkstates =
-        storm::utility::graph::performProb0A(backwardTransitions, storm::storage::BitVector(goalstates.size(), true), goalstates);
+    auto [goalstates, sinkstates] = computeGoalAndSinkStates(mdp, safeProp);
 
     std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
     auto solver = storm::utility::solver::getSmtSolver(*expressionManager);
@@ -68,10 +80,73 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(
     return boost::none;
 }
 
+template<typename RM>
+boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaPortfolio(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                      storm::logic::ProbabilityOperatorFormula const& safeProp) {
+    STORM_LOG_THROW(!storm::logic::isStrict(safeProp.getComparisonType()), storm::exceptions::NotImplementedException, "Strict bounds are not supported");
+    bool lowerBound = storm::logic::isLowerBound(safeProp.getComparisonType());
+    double boundary = safeProp.getThresholdAs<double>();
+    auto [goalstates, sinkstates] = computeGoalAndSinkStates(mdp, safeProp);
+
+    std::vector<std::unique_ptr<PermissiveSchedulerComputation<RM>>> computations;
+    std::vector<std::string> names;
+    std::unique_ptr<storm::solver::LpSolver<double>> lpSolver;
+    try {
+        lpSolver = storm::utility::solver::getLpSolver<double>("permissive scheduler");
+        computations.push_back(std::make_unique<MilpPermissiveSchedulerComputation<RM>>(*lpSolver, mdp, goalstates, sinkstates));
+        names.push_back("MILP");
+    } catch (storm::exceptions::BaseException const& e) {
+        STORM_LOG_WARN("Unable to create an MILP solver (" << e.what() << "). Only the SMT based computation is performed.");
+    }
+    std::shared_ptr<storm::expressions::ExpressionManager> expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+    auto smtSolver = storm::utility::solver::getSmtSolver(*expressionManager);
+    computations.push_back(std::make_unique<SmtPermissiveSchedulerComputation<RM>>(*smtSolver, mdp, goalstates, sinkstates));
+    names.push_back("SMT");
+
+    // The first computation that finishes interrupts all others.
+    std::mutex mutex;
+    boost::optional<uint64_t> winner;
+    std::vector<std::exception_ptr> failures(computations.size());
+    // Data of the matrix that is initialized lazily is initialized upfront, such that the matrix is only read concurrently.
+    mdp.getTransitionMatrix().getRowGroupIndices();
+    storm::utility::parallel::forEachTaskInDependencyOrder(
+        std::vector<std::vector<uint64_t>>(computations.size()), computations.size(), [&](uint64_t, uint64_t task) {
+            try {
+                computations[task]->calculatePermissiveScheduler(lowerBound, boundary);
+            } catch (std::exception const& e) {
+                STORM_LOG_WARN("The " << names[task] << " based computation of the permissive scheduler failed (" << e.what() << ").");
+                failures[task] = std::current_exception();
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!winner && !computations[task]->isInterrupted()) {
+                winner = task;
+                for (auto& computation : computations) {
+                    if (computation != computations[task]) {
+                        computation->interrupt();
+                    }
+                }
+            }
+        });
+
+    if (!winner) {
+        // All computations failed.
+        std::rethrow_exception(failures.back());
+    }
+    STORM_LOG_INFO("The permissive scheduler was computed by the " << names[*winner] << " based computation.");
+    if (computations[*winner]->foundSolution()) {
+        return boost::optional<SubMDPPermissiveScheduler<RM>>(computations[*winner]->getScheduler());
+    } else {
+        return boost::optional<SubMDPPermissiveScheduler<RM>>();
+    }
+}
+
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaMILP(storm::models::sparse::Mdp<double> const& mdp,
                                                                                         storm::logic::ProbabilityOperatorFormula const& safeProp);
 template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double> const& mdp,
                                                                                        storm::logic::ProbabilityOperatorFormula const& safeProp);
+template boost::optional<SubMDPPermissiveScheduler<>> computePermissiveSchedulerViaPortfolio(storm::models::sparse::Mdp<double> const& mdp,
+                                                                                             storm::logic::ProbabilityOperatorFormula const& safeProp);
 
 }  // namespace ps
 }  // namespace storm
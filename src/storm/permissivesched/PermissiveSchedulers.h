@@ -82,6 +82,14 @@ boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaMILP
 template<typename RM>
 boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaSMT(storm::models::sparse::Mdp<double, RM> const& mdp,
                                                                                 storm::logic::ProbabilityOperatorFormula const& safeProp);
+
+/*!
+ * Runs the MILP and the SMT based computation concurrently and returns the result of the computation that finishes first. The other computation
+ * is interrupted. If no MILP solver is available, only the SMT based computation is performed.
+ */
+template<typename RM>
+boost::optional<SubMDPPermissiveScheduler<RM>> computePermissiveSchedulerViaPortfolio(storm::models::sparse::Mdp<double, RM> const& mdp,
+                                                                                      storm::logic::ProbabilityOperatorFormula const& safeProp);
 }  // namespace ps
 }  // namespace storm
 
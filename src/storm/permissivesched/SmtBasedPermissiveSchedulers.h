@@ -1,7 +1,13 @@
 #ifndef SMTBASEDPERMISSIVESCHEDULERS_H
 #define SMTBASEDPERMISSIVESCHEDULERS_H
 
+#include <unordered_map>
+
+#include "PermissiveSchedulerComputation.h"
 #include "storm/solver/SmtSolver.h"
+#include "storm/storage/StateActionPair.h"
+#include "storm/storage/StateActionTargetTuple.h"
+#include "storm/storage/expressions/ExpressionManager.h"
 
 namespace storm {
 namespace ps {
@@ -11,6 +17,8 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
    private:
     bool mPerformedSmtLoop = false;
     bool mFoundSolution = false;
+    bool mCreatedEncoding = false;
+    storm::storage::BitVector mRelevantStates;
     storm::solver::SmtSolver& solver;
     storm::expressions::ExpressionManager& manager;
     std::unordered_map<storm::storage::StateActionPair, storm::expressions::Variable> multistrategyVariables;
@@ -30,7 +38,18 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
           manager(solver.getManager()) {}
 
     void calculatePermissiveScheduler(bool lowerBound, double boundary) override {
-        performSmtLoop(lowerBound, boundary, this->mPenalties);
+        if (!mCreatedEncoding) {
+            mRelevantStates = this->computeRelevantStates();
+            createVariables(mRelevantStates);
+            createConstraints(mRelevantStates);
+            mCreatedEncoding = true;
+        } else {
+            // Drop the bound constraints and the decisions of the previous loop, the remaining encoding is kept.
+            solver.pop();
+        }
+        solver.push();
+        createBoundConstraints(lowerBound, boundary);
+        performSmtLoop(this->mPenalties);
         mPerformedSmtLoop = true;
     }
 
@@ -92,42 +111,24 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
     }
 
     /**
-     * Create constraints
+     * Create the constraints that depend on the bound, i.e., (1) and (3).
      */
-    void createConstraints(bool lowerBound, double boundary, storm::storage::BitVector const& relevantStates) {
-        // (4) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
-
+    void createBoundConstraints(bool lowerBound, double boundary) {
         // (1)
         STORM_LOG_ASSERT(this->mdp.getInitialStates().getNumberOfSetBits() == 1, "No unique initial state.");
         uint_fast64_t initialStateIndex = this->mdp.getInitialStates().getNextSetIndex(0);
-        STORM_LOG_ASSERT(relevantStates[initialStateIndex], "Initial state not relevant.");
+        STORM_LOG_ASSERT(mRelevantStates[initialStateIndex], "Initial state not relevant.");
         if (lowerBound) {
             solver.add(mProbVariables[initialStateIndex] >= manager.rational(boundary));
         } else {
             solver.add(mProbVariables[initialStateIndex] <= manager.rational(boundary));
         }
-        for (uint_fast64_t s : relevantStates) {
-            std::string stateString = std::to_string(s);
-            std::vector<storm::expressions::Expression> expressions;
-            // (2)
-            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                expressions.push_back(multistrategyVariables[storage::StateActionPair(s, a)]);
-            }
-            solver.add(storm::expressions::disjunction(expressions));
-            expressions.clear();
-
-            // (5) These constraints are only necessary for lower-bounded properties.
-            if (lowerBound) {
-                //                        TODO
-                //                        solver.addConstraint("c5-" + std::to_string(s), mProbVariables[s] <= mAlphaVariables[s]);
-            }
-
+        std::vector<storm::expressions::Expression> expressions;
+        for (uint_fast64_t s : mRelevantStates) {
             // (3) For the relevant states.
             for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
-                std::string sastring(stateString + "_" + std::to_string(a));
-
                 for (auto const& entry : this->mdp.getTransitionMatrix().getRow(this->mdp.getNondeterministicChoiceIndices()[s] + a)) {
-                    if (entry.getValue() != 0 && relevantStates.get(entry.getColumn())) {
+                    if (entry.getValue() != 0 && mRelevantStates.get(entry.getColumn())) {
                         expressions.push_back(manager.rational(entry.getValue()) * mProbVariables[entry.getColumn()]);
                     } else if (entry.getValue() != 0 && this->mGoals.get(entry.getColumn())) {
                         expressions.push_back(manager.rational(entry.getValue()));
@@ -182,13 +183,33 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
     }
 
     /**
-     *
+     * Create the constraints that do not depend on the bound.
      */
-    void performSmtLoop(bool lowerBound, double boundary, PermissiveSchedulerPenalties const& penalties) {
-        storm::storage::BitVector irrelevant = this->mGoals | this->mSinks;
-        storm::storage::BitVector relevantStates = ~irrelevant;
-        createVariables(relevantStates);
-        createConstraints(lowerBound, boundary, relevantStates);
+    void createConstraints(storm::storage::BitVector const& relevantStates) {
+        // (4) and (7) are omitted on purpose (-- we currenty do not support controllability of actions -- )
+        std::vector<storm::expressions::Expression> expressions;
+        for (uint_fast64_t s : relevantStates) {
+            // (2)
+            for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
+                expressions.push_back(multistrategyVariables[storage::StateActionPair(s, a)]);
+            }
+            solver.add(storm::expressions::disjunction(expressions));
+            expressions.clear();
+        }
+    }
+
+    /**
+     * Greedily enables as many state-action pairs as possible, starting with the ones with the highest penalty. The decisions are asserted on the
+     * current level of the solver.
+     */
+    void performSmtLoop(PermissiveSchedulerPenalties const& penalties) {
+        mFoundSolution = false;
+        for (auto& entry : multistrategyVariablesToTakenMap) {
+            entry.second = false;
+        }
+        if (this->isInterrupted()) {
+            return;
+        }
 
         // Find the initial solution (if possible).
         storm::solver::SmtSolver::CheckResult result = solver.check();
@@ -199,7 +220,7 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
             std::shared_ptr<storm::solver::SmtSolver::ModelReference> model = solver.getModel();
 
             std::vector<storage::StateActionPair> availableStateActionPairs;
-            for (uint_fast64_t s : relevantStates) {
+            for (uint_fast64_t s : mRelevantStates) {
                 for (uint_fast64_t a = 0; a < this->mdp.getNumberOfChoices(s); ++a) {
                     auto stateAndAction = storage::StateActionPair(s, a);
 
@@ -220,7 +241,8 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                           return penalties.get(first) < penalties.get(second);
                       });
 
-            do {
+            // An interruption is only checked between two checks of the solver.
+            while (!availableStateActionPairs.empty() && !this->isInterrupted()) {
                 auto multistrategyVariable = multistrategyVariables.at(availableStateActionPairs.back());
 
                 result = solver.checkWithAssumptions({multistrategyVariable});
@@ -233,12 +255,9 @@ class SmtPermissiveSchedulerComputation : public PermissiveSchedulerComputation<
                     }
                 }
                 availableStateActionPairs.pop_back();
-
-            } while (!availableStateActionPairs.empty());
+            }
 
             mFoundSolution = true;
-        } else {
-            mFoundSolution = false;
         }
     }
 };
@@ -37,6 +37,7 @@
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm/settings/modules/OviSolverSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/SimulationSettings.h"
 #include "storm/settings/modules/Smt2SmtSolverSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
@@ -48,7 +49,7 @@
 namespace storm {
 namespace settings {
 
-SettingsManager::SettingsManager() : modules(), longNameToOptions(), shortNameToOptions(), moduleOptions() {}
+SettingsManager::SettingsManager() : modules(), hasLazyModules(false), modulesFinalized(false), longNameToOptions(), shortNameToOptions(), moduleOptions() {}
 
 SettingsManager::~SettingsManager() {
     // Intentionally left empty.
@@ -86,6 +87,7 @@ void SettingsManager::setFromString(std::string const& commandLineString) {
 }
 
 void SettingsManager::handleUnknownOption(std::string const& optionName, bool isShort) const {
+    constructAllLazyModules();
     std::string optionNameWithDashes = (isShort ? "-" : "--") + optionName;
     storm::utility::string::SimilarStrings similarStrings(optionNameWithDashes, 0.6, false);
     std::map<std::string, std::vector<std::string>> similarOptionNames;
@@ -133,6 +135,7 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 // At this point we know that a new option is about to come. Hence, we need to assign the current
                 // cache content to the option that was active until now.
                 setOptionsArguments(activeOptionName, activeOptionIsShortName ? this->shortNameToOptions : this->longNameToOptions, argumentCache);
+                commandLineOptions.emplace_back(activeOptionName, activeOptionIsShortName, argumentCache);
 
                 // After the assignment, the argument cache needs to be cleared.
                 argumentCache.clear();
@@ -146,7 +149,11 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 std::string optionName = currentArgument.substr(2);
                 auto optionIterator = this->longNameToOptions.find(optionName);
                 if (optionIterator == this->longNameToOptions.end()) {
-                    handleUnknownOption(optionName, false);
+                    // The option may belong to a module that is not yet constructed.
+                    constructAllLazyModules();
+                    if (this->longNameToOptions.find(optionName) == this->longNameToOptions.end()) {
+                        handleUnknownOption(optionName, false);
+                    }
                 }
                 activeOptionIsShortName = false;
                 activeOptionName = optionName;
@@ -156,7 +163,10 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
                 std::string optionName = currentArgument.substr(1);
                 auto optionIterator = this->shortNameToOptions.find(optionName);
                 if (optionIterator == this->shortNameToOptions.end()) {
-                    handleUnknownOption(optionName, true);
+                    constructAllLazyModules();
+                    if (this->shortNameToOptions.find(optionName) == this->shortNameToOptions.end()) {
+                        handleUnknownOption(optionName, true);
+                    }
                 }
                 activeOptionIsShortName = true;
                 activeOptionName = optionName;
@@ -173,6 +183,7 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
     // If an option is still active at this point, we need to set it.
     if (optionActive) {
         setOptionsArguments(activeOptionName, activeOptionIsShortName ? this->shortNameToOptions : this->longNameToOptions, argumentCache);
+        commandLineOptions.emplace_back(activeOptionName, activeOptionIsShortName, argumentCache);
     }
 
     // Include the options from a possibly specified configuration file, but don't overwrite existing settings.
@@ -186,6 +197,8 @@ void SettingsManager::setFromExplodedString(std::vector<std::string> const& comm
 }
 
 void SettingsManager::setFromConfigurationFile(std::string const& configFilename) {
+    // The configuration file may refer to any module.
+    constructAllLazyModules();
     std::map<std::string, std::vector<std::string>> configurationFileSettings = parseConfigFile(configFilename);
 
     for (auto const& optionArgumentsPair : configurationFileSettings) {
@@ -214,6 +227,7 @@ void SettingsManager::setFromConfigurationFile(std::string const& configFilename
 }
 
 void SettingsManager::printHelp(std::string const& filter) const {
+    constructAllLazyModules();
     STORM_PRINT("usage: " << executableName << " [options]\n\n");
 
     if (filter == "frequent" || filter == "all") {
@@ -405,13 +419,25 @@ uint_fast64_t SettingsManager::getPrintLengthOfLongestOption(std::string const&
 }
 
 void SettingsManager::addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
-    auto moduleIterator = this->modules.find(moduleSettings->getModuleName());
-    STORM_LOG_THROW(moduleIterator == this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Unable to register module '" << moduleSettings->getModuleName() << "' because a module with the same name already exists.");
+    std::string moduleName = moduleSettings->getModuleName();
+    STORM_LOG_THROW(!hasModule(moduleName), storm::exceptions::IllegalFunctionCallException,
+                    "Unable to register module '" << moduleName << "' because a module with the same name already exists.");
+    this->moduleNames.push_back(moduleName);
+    registerModule(std::move(moduleSettings), doRegister);
+}
 
+void SettingsManager::addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister) {
+    STORM_LOG_THROW(!hasModule(moduleName), storm::exceptions::IllegalFunctionCallException,
+                    "Unable to register module '" << moduleName << "' because a module with the same name already exists.");
+    std::lock_guard<std::recursive_mutex> lock(lazyModulesMutex);
+    this->moduleNames.push_back(moduleName);
+    this->lazyModules.emplace(moduleName, std::make_pair(factory, doRegister));
+    hasLazyModules = true;
+}
+
+void SettingsManager::registerModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister) {
     // Take over the module settings object.
     std::string moduleName = moduleSettings->getModuleName();
-    this->moduleNames.push_back(moduleName);
     this->modules.emplace(moduleSettings->getModuleName(), std::move(moduleSettings));
     auto iterator = this->modules.find(moduleName);
     std::unique_ptr<modules::ModuleSettings> const& settings = iterator->second;
@@ -456,7 +482,63 @@ void SettingsManager::addOption(std::shared_ptr<Option> const& option) {
     }
 }
 
+void SettingsManager::constructLazyModule(std::string const& moduleName) {
+    auto lazyModuleIterator = this->lazyModules.find(moduleName);
+    STORM_LOG_ASSERT(lazyModuleIterator != this->lazyModules.end(), "Module " << moduleName << " is not registered lazily.");
+    auto factory = std::move(lazyModuleIterator->second.first);
+    bool doRegister = lazyModuleIterator->second.second;
+    this->lazyModules.erase(lazyModuleIterator);
+
+    std::unique_ptr<modules::ModuleSettings> moduleSettings = factory();
+    STORM_LOG_ASSERT(moduleSettings->getModuleName() == moduleName, "Lazily constructed module has unexpected name " << moduleSettings->getModuleName() << ".");
+    modules::ModuleSettings& settings = *moduleSettings;
+    registerModule(std::move(moduleSettings), doRegister);
+
+    if (doRegister) {
+        // Apply the options that were set before the module existed.
+        for (auto const& commandLineOption : commandLineOptions) {
+            auto const& optionMap = std::get<1>(commandLineOption) ? this->shortNameToOptions : this->longNameToOptions;
+            auto optionIterator = optionMap.find(std::get<0>(commandLineOption));
+            if (optionIterator != optionMap.end()) {
+                for (auto const& option : optionIterator->second) {
+                    if (option->getModuleName() == moduleName) {
+                        setOptionArguments(std::get<0>(commandLineOption), option, std::get<2>(commandLineOption));
+                    }
+                }
+            }
+        }
+    }
+    if (modulesFinalized) {
+        settings.finalize();
+        settings.check();
+    }
+    hasLazyModules = !this->lazyModules.empty();
+}
+
+void SettingsManager::constructAllLazyModules() const {
+    if (!hasLazyModules) {
+        return;
+    }
+    // The manager is a singleton that is never actually constant, constructing a module does not change its observable state.
+    SettingsManager& manager = const_cast<SettingsManager&>(*this);
+    std::lock_guard<std::recursive_mutex> lock(manager.lazyModulesMutex);
+    // Construct the modules in the order in which they were added.
+    for (auto const& moduleName : this->moduleNames) {
+        if (this->lazyModules.count(moduleName) > 0) {
+            manager.constructLazyModule(moduleName);
+        }
+    }
+}
+
 bool SettingsManager::hasModule(std::string const& moduleName, bool checkHidden) const {
+    std::unique_lock<std::recursive_mutex> lock(const_cast<std::recursive_mutex&>(lazyModulesMutex), std::defer_lock);
+    if (hasLazyModules) {
+        lock.lock();
+        auto lazyModuleIterator = this->lazyModules.find(moduleName);
+        if (lazyModuleIterator != this->lazyModules.end()) {
+            return !checkHidden || lazyModuleIterator->second.second;
+        }
+    }
     if (checkHidden) {
         return this->moduleOptions.find(moduleName) != this->moduleOptions.end();
     } else {
@@ -465,13 +547,18 @@ bool SettingsManager::hasModule(std::string const& moduleName, bool checkHidden)
 }
 
 modules::ModuleSettings const& SettingsManager::getModule(std::string const& moduleName) const {
-    auto moduleIterator = this->modules.find(moduleName);
-    STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
-                    "Cannot retrieve unknown module '" << moduleName << "'.");
-    return *moduleIterator->second;
+    return const_cast<SettingsManager&>(*this).getModule(moduleName);
 }
 
 modules::ModuleSettings& SettingsManager::getModule(std::string const& moduleName) {
+    // Accesses only need to be synchronized as long as modules may still be constructed.
+    std::unique_lock<std::recursive_mutex> lock(lazyModulesMutex, std::defer_lock);
+    if (hasLazyModules) {
+        lock.lock();
+        if (this->lazyModules.count(moduleName) > 0) {
+            constructLazyModule(moduleName);
+        }
+    }
     auto moduleIterator = this->modules.find(moduleName);
     STORM_LOG_THROW(moduleIterator != this->modules.end(), storm::exceptions::IllegalFunctionCallException,
                     "Cannot retrieve unknown module '" << moduleName << "'.");
@@ -545,9 +632,15 @@ void SettingsManager::addOptionToMap(std::string const& name, std::shared_ptr<Op
 }
 
 void SettingsManager::finalizeAllModules() {
+    modulesFinalized = true;
+    // Checking a module may construct further (lazy) modules, which are then finalized on construction.
+    std::vector<modules::ModuleSettings*> constructedModules;
     for (auto const& nameModulePair : this->modules) {
-        nameModulePair.second->finalize();
-        nameModulePair.second->check();
+        constructedModules.push_back(nameModulePair.second.get());
+    }
+    for (auto const& module : constructedModules) {
+        module->finalize();
+        module->check();
     }
 }
 
@@ -675,39 +768,45 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
 
+storm::settings::modules::ExplorationSettings& mutableExplorationSettings() {
+    return dynamic_cast<storm::settings::modules::ExplorationSettings&>(mutableManager().getModule(storm::settings::modules::ExplorationSettings::moduleName));
+}
+
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
-    // Register all known settings modules.
+    // Register all known settings modules. Modules that are only needed by some engines, solvers, or backends are only
+    // constructed once they are needed.
     storm::settings::addModule<storm::settings::modules::GeneralSettings>();
     storm::settings::addModule<storm::settings::modules::IOSettings>();
     storm::settings::addModule<storm::settings::modules::BuildSettings>();
     storm::settings::addModule<storm::settings::modules::CoreSettings>();
     storm::settings::addModule<storm::settings::modules::ModelCheckerSettings>();
     storm::settings::addModule<storm::settings::modules::DebugSettings>();
-    storm::settings::addModule<storm::settings::modules::CuddSettings>();
-    storm::settings::addModule<storm::settings::modules::SylvanSettings>();
-    storm::settings::addModule<storm::settings::modules::GmmxxEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::EigenEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::CuddSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::SylvanSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GmmxxEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::EigenEquationSolverSettings>();
     storm::settings::addModule<storm::settings::modules::NativeEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::EliminationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::EliminationSettings>();
     storm::settings::addModule<storm::settings::modules::LongRunAverageSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::TimeBoundedSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::TimeBoundedSolverSettings>();
     storm::settings::addModule<storm::settings::modules::MinMaxEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::GameSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GameSolverSettings>();
     storm::settings::addModule<storm::settings::modules::BisimulationSettings>();
-    storm::settings::addModule<storm::settings::modules::GlpkSettings>();
-    storm::settings::addModule<storm::settings::modules::GurobiSettings>();
-    storm::settings::addModule<storm::settings::modules::TopologicalEquationSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::Smt2SmtSolverSettings>();
-    storm::settings::addModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GlpkSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::GurobiSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::TopologicalEquationSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::Smt2SmtSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::ExplorationSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::SimulationSettings>();
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
-    storm::settings::addModule<storm::settings::modules::AbstractionSettings>();
-    storm::settings::addModule<storm::settings::modules::MultiObjectiveSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::AbstractionSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::MultiObjectiveSettings>();
     storm::settings::addModule<storm::settings::modules::MultiplierSettings>();
     storm::settings::addModule<storm::settings::modules::TransformationSettings>();
-    storm::settings::addModule<storm::settings::modules::HintSettings>();
-    storm::settings::addModule<storm::settings::modules::OviSolverSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::HintSettings>();
+    storm::settings::addLazyModule<storm::settings::modules::OviSolverSettings>();
 }
 
 }  // namespace settings
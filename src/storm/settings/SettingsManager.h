@@ -1,10 +1,13 @@
 #ifndef STORM_SETTINGS_SETTINGSMANAGER_H_
 #define STORM_SETTINGS_SETTINGSMANAGER_H_
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,6 +18,7 @@ namespace modules {
 class BuildSettings;
 class ModuleSettings;
 class AbstractionSettings;
+class ExplorationSettings;
 }  // namespace modules
 class Option;
 
@@ -109,6 +113,16 @@ class SettingsManager {
      */
     void addModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister = true);
 
+    /*!
+     * Adds a module that is only constructed once it is needed, i.e., when it is retrieved, when the command line
+     * contains an option that no constructed module knows, or when the help is printed. Options that were set before
+     * the construction are applied to the module when it is constructed.
+     *
+     * @param moduleName The name of the module.
+     * @param factory A function that creates the settings of the module.
+     */
+    void addLazyModule(std::string const& moduleName, std::function<std::unique_ptr<modules::ModuleSettings>()> const& factory, bool doRegister = true);
+
     /*!
      * Checks whether the module with the given name exists.
      *
@@ -165,6 +179,19 @@ class SettingsManager {
     std::vector<std::string> moduleNames;
     std::unordered_map<std::string, std::unique_ptr<modules::ModuleSettings>> modules;
 
+    // The registered modules that are not yet constructed, together with whether their options are to be registered.
+    std::unordered_map<std::string, std::pair<std::function<std::unique_ptr<modules::ModuleSettings>()>, bool>> lazyModules;
+    // Set iff there are modules that are not yet constructed. Only then, accesses to the modules need to be synchronized.
+    std::atomic<bool> hasLazyModules;
+    std::recursive_mutex lazyModulesMutex;
+
+    // The options that were set on the command line (name, whether it is the short name, arguments). They are applied
+    // to modules that are constructed later.
+    std::vector<std::tuple<std::string, bool, std::vector<std::string>>> commandLineOptions;
+
+    // Whether the modules were finalized, i.e., whether lazily constructed modules need to be finalized as well.
+    bool modulesFinalized;
+
     // Mappings from all known option names to the options that match it. All options for one option name need
     // to be compatible in the sense that calling isCompatible(...) pairwise on all options must always return true.
     std::unordered_map<std::string, std::vector<std::shared_ptr<Option>>> longNameToOptions;
@@ -177,6 +204,21 @@ class SettingsManager {
     // to match the regular expression given to the help option against the option names.
     std::vector<std::string> longOptionNames;
 
+    /*!
+     * Registers the given module and its options.
+     */
+    void registerModule(std::unique_ptr<modules::ModuleSettings>&& moduleSettings, bool doRegister);
+
+    /*!
+     * Constructs the lazily added module with the given name and applies the options set so far.
+     */
+    void constructLazyModule(std::string const& moduleName);
+
+    /*!
+     * Constructs all lazily added modules.
+     */
+    void constructAllLazyModules() const;
+
     /*!
      * Adds the given option to the known options.
      *
@@ -274,6 +316,16 @@ void addModule(bool doRegister = true) {
     mutableManager().addModule(std::unique_ptr<modules::ModuleSettings>(new SettingsType()), doRegister);
 }
 
+/*!
+ * Add new module that is only constructed once it is needed. The new module is given as a template argument.
+ */
+template<typename SettingsType>
+void addLazyModule(bool doRegister = true) {
+    static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
+    mutableManager().addLazyModule(
+        SettingsType::moduleName, []() { return std::unique_ptr<modules::ModuleSettings>(new SettingsType()); }, doRegister);
+}
+
 /*!
  * Initialize the settings manager with all available modules.
  * @param name Name of the tool.
@@ -321,6 +373,14 @@ storm::settings::modules::BuildSettings& mutableBuildSettings();
  */
 storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
 
+/*!
+ * Retrieves the exploration settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the exploration settings.
+ */
+storm::settings::modules::ExplorationSettings& mutableExplorationSettings();
+
 }  // namespace settings
 }  // namespace storm
 
@@ -22,6 +22,7 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -91,6 +92,18 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, false,
+                                       "Sets how sparse bisimulation refines the partition: one splitter at a time or all blocks at once based on the signatures of "
+                                       "the states, which are computed in parallel (see --threads).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                             .setDefaultValueString("splitter")
+                             .build())
+            .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +186,14 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+    std::string modeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+    if (modeAsString == "signature") {
+        return SparseRefinementMode::Signature;
+    }
+    return SparseRefinementMode::Splitter;
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -24,6 +24,8 @@ class BisimulationSettings : public ModuleSettings {
 
     enum class RefinementMode { Full, ChangedStates };
 
+    enum class SparseRefinementMode { Splitter, Signature };
+
     /*!
      * Creates a new set of bisimulation settings.
      */
@@ -96,6 +98,12 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the refinement mode to use in sparse bisimulation.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    SparseRefinementMode getSparseRefinementMode() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -112,6 +120,7 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
+    static const std::string sparseRefinementModeOptionName;
     static const std::string exactArithmeticDdOptionName;
 };
 }  // namespace modules
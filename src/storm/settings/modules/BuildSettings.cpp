@@ -38,6 +38,21 @@ const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-gua
 const std::string noSimplifyOptionName = "no-simplify";
 const std::string bitsForUnboundedVariablesOptionName = "int-bits";
 const std::string performLocationElimination = "location-elimination";
+const std::string explorationThreadsOptionName = "buildthreads";
+const std::string modelCacheOptionName = "modelcache";
+const std::string incrementalBuildOptionName = "incremental";
+const std::string externalExplorationOptionName = "buildexternal";
+const std::string stateCompressionOptionName = "statecompression";
+const std::string fingerprintedStateStorageOptionName = "fingerprintstates";
+const std::string symmetryReductionOptionName = "symmetry";
+const std::string partialOrderReductionOptionName = "por";
+const std::string variableRangeAnalysisOptionName = "rangeanalysis";
+const std::string guardTableBitsOptionName = "guard-table-bits";
+const std::string guardBatchSizeOptionName = "guard-batch-size";
+const std::string matrixBlockSizeOptionName = "matrix-block-size";
+const std::string bisimulationIntervalOptionName = "explore-bisim";
+const std::string stateReorderingOptionName = "reorder-states";
+const std::string ddForceOrderOptionName = "dd-force-order";
 
 BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, prismCompatibilityOptionName, false,
@@ -110,6 +125,116 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .makeOptional()
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for explicit state-space exploration (requires bfs exploration order).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false,
+                                                   "If set, sparse models built from PRISM or JANI input are cached in (and loaded from) the given directory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory of the cache.").build())
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                "size", "The maximal size of the cache in megabytes. If exceeded, the least recently used models are removed.")
+                                .setDefaultValueUnsignedInteger(4096)
+                                .makeOptional()
+                                .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, incrementalBuildOptionName, false,
+                                                   "If set, the sparse model of a PRISM program is built from the previous build of the same file in the "
+                                                   "model cache, where only the states affected by the changed commands are explored again.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, externalExplorationOptionName, false,
+                                       "If set, the explicit state space is explored breadth-first with the visited states and the transitions kept on disk "
+                                       "(requires bfs exploration order and floating point values).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory in which the temporary files are placed.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                             "memory", "The amount of memory in megabytes that is used for detecting duplicate states before they are written to disk.")
+                             .setDefaultValueUnsignedInteger(1024)
+                             .makeOptional()
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stateCompressionOptionName, false,
+                                                   "If set, the states found during explicit state space exploration are stored tree-compressed along the "
+                                                   "modules (or automata) of the model. This saves memory for models with many modules.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, fingerprintedStateStorageOptionName, false,
+                                                   "If set, the states found during explicit state space exploration are stored in a hash map that only "
+                                                   "compares states whose 1-byte fingerprints match. This speeds up the exploration of models in which most "
+                                                   "found states were already visited. Has no effect if the states are stored tree-compressed.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false,
+                                                   "If set, states of PRISM programs that only differ in the order of fully symmetric modules (i.e. modules "
+                                                   "renamed from the same module) are merged during explicit state space exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false,
+                                                   "If set, only one of the interleavings of independent commands of PRISM MDPs is explored where possible. "
+                                                   "This is only applied if all properties are unbounded reachability properties without rewards.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, variableRangeAnalysisOptionName, false,
+                                                   "If set, the ranges of the integer variables of PRISM programs are narrowed to the values they can take in "
+                                                   "reachable states (as determined by an interval analysis) to reduce the number of bits per state during "
+                                                   "explicit state space exploration.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, guardTableBitsOptionName, false,
+                                                   "Sets the maximal number of bits of the variables over which the values of a guard are cached during explicit "
+                                                   "state space exploration. Zero disables the caching.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorIncluding(0, 30))
+                                         .setDefaultValueUnsignedInteger(16)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, guardBatchSizeOptionName, false,
+                                                   "Sets the number of states for which the guards are evaluated at once during explicit state space "
+                                                   "exploration (requires bfs exploration order). Zero disables the batching.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of states.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, matrixBlockSizeOptionName, false,
+                                                   "Sets the number of entries per block in which the transition matrix is collected during explicit "
+                                                   "state space exploration. Zero collects the entries in one growing vector.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of entries.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bisimulationIntervalOptionName, false,
+                                                   "If set, the explored part of a DTMC or CTMC is minimized w.r.t. strong bisimulation whenever the given "
+                                                   "number of states was explored, which collapses the states whose behavior is completely explored.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval", "The number of states per minimization.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    std::vector<std::string> stateOrders = {"bfs", "rcm", "scc"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, stateReorderingOptionName, false,
+                                                   "If set, the states of the built model are renumbered to improve the locality of memory accesses.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "order", "The order of the states: breadth-first search, reverse Cuthill-McKee or topologically sorted SCCs.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrders))
+                                         .setDefaultValueString("rcm")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddForceOrderOptionName, false,
+                                                   "If set, the symbolic model builders order the DD variables of the model variables with the FORCE heuristic "
+                                                   "such that variables that occur in the same guards and updates are close.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BuildSettings::isExplorationOrderSet() const {
@@ -186,6 +311,25 @@ uint64_t BuildSettings::getBitsForUnboundedVariables() const {
     return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+uint64_t BuildSettings::getMaximalGuardTableBits() const {
+    return this->getOption(guardTableBitsOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+uint64_t BuildSettings::getGuardBatchSize() const {
+    return this->getOption(guardBatchSizeOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+uint64_t BuildSettings::getMatrixBlockSize() const {
+    return this->getOption(matrixBlockSizeOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+uint64_t BuildSettings::getBisimulationInterval() const {
+    if (!this->getOption(bisimulationIntervalOptionName).getHasOptionBeenSet()) {
+        return 0;
+    }
+    return this->getOption(bisimulationIntervalOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
 bool BuildSettings::isLocationEliminationSet() const {
     return this->getOption(performLocationElimination).getHasOptionBeenSet();
 }
@@ -197,6 +341,78 @@ uint64_t BuildSettings::getLocationEliminationLocationHeuristic() const {
 uint64_t BuildSettings::getLocationEliminationEdgesHeuristic() const {
     return this->getOption(performLocationElimination).getArgumentByName("edges-heuristic").getValueAsUnsignedInteger();
 }
+
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BuildSettings::isModelCacheSet() const {
+    return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isIncrementalBuildSet() const {
+    return this->getOption(incrementalBuildOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getModelCacheDirectory() const {
+    return this->getOption(modelCacheOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t BuildSettings::getModelCacheSize() const {
+    return this->getOption(modelCacheOptionName).getArgumentByName("size").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
+bool BuildSettings::isExternalExplorationSet() const {
+    return this->getOption(externalExplorationOptionName).getHasOptionBeenSet();
+}
+
+std::string BuildSettings::getExternalExplorationDirectory() const {
+    return this->getOption(externalExplorationOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+uint64_t BuildSettings::getExternalExplorationMemoryLimit() const {
+    return this->getOption(externalExplorationOptionName).getArgumentByName("memory").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
+bool BuildSettings::isStateCompressionSet() const {
+    return this->getOption(stateCompressionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isFingerprintedStateStorageSet() const {
+    return this->getOption(fingerprintedStateStorageOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isSymmetryReductionSet() const {
+    return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isPartialOrderReductionSet() const {
+    return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isVariableRangeAnalysisSet() const {
+    return this->getOption(variableRangeAnalysisOptionName).getHasOptionBeenSet();
+}
+
+bool BuildSettings::isStateReorderingSet() const {
+    return this->getOption(stateReorderingOptionName).getHasOptionBeenSet();
+}
+
+storm::utility::permutation::OrderKind BuildSettings::getStateReorderingOrder() const {
+    std::string orderAsString = this->getOption(stateReorderingOptionName).getArgumentByName("order").getValueAsString();
+    if (orderAsString == "bfs") {
+        return storm::utility::permutation::OrderKind::Bfs;
+    } else if (orderAsString == "rcm") {
+        return storm::utility::permutation::OrderKind::ReverseCuthillMcKee;
+    } else if (orderAsString == "scc") {
+        return storm::utility::permutation::OrderKind::SccTopological;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state order '" << orderAsString << "'.");
+}
+
+bool BuildSettings::isDdForceOrderSet() const {
+    return this->getOption(ddForceOrderOptionName).getHasOptionBeenSet();
+}
 }  // namespace modules
 
 }  // namespace settings
@@ -3,6 +3,7 @@
 #include "storm-config.h"
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/settings/modules/ModuleSettings.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
 namespace settings {
@@ -113,6 +114,26 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getBitsForUnboundedVariables() const;
 
+    /*!
+     * Retrieves the maximal number of bits of the variables over which the values of a guard are cached.
+     */
+    uint64_t getMaximalGuardTableBits() const;
+
+    /*!
+     * Retrieves the number of states for which the guards are evaluated at once (where zero means no batching).
+     */
+    uint64_t getGuardBatchSize() const;
+
+    /*!
+     * Retrieves the number of entries per block of the transition matrix during explicit exploration (where zero means no blocks).
+     */
+    uint64_t getMatrixBlockSize() const;
+
+    /*!
+     * Retrieves the number of explored states between two bisimulation minimizations during explicit exploration (where zero means no minimization).
+     */
+    uint64_t getBisimulationInterval() const;
+
     /*!
      * Retrieves whether simplification of symbolic inputs through static analysis shall be disabled
      */
@@ -133,6 +154,92 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getLocationEliminationEdgesHeuristic() const;
 
+    /*!
+     * Retrieves the number of threads that are used to explore the state space of the model.
+     *
+     * @return The number of threads where 0 means 'auto-detect'.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves whether built models are to be cached on disk.
+     */
+    bool isModelCacheSet() const;
+
+    /*!
+     * Retrieves the directory in which built models are cached.
+     */
+    std::string getModelCacheDirectory() const;
+
+    /*!
+     * Retrieves the maximal size of the model cache.
+     *
+     * @return The size in bytes.
+     */
+    uint64_t getModelCacheSize() const;
+
+    /*!
+     * Retrieves whether models of PRISM programs are to be built incrementally from the previous build in the model cache.
+     */
+    bool isIncrementalBuildSet() const;
+
+    /*!
+     * Retrieves whether the explicit state space is to be explored with the visited states and transitions on disk.
+     */
+    bool isExternalExplorationSet() const;
+
+    /*!
+     * Retrieves the directory in which the temporary files of the external exploration are placed.
+     */
+    std::string getExternalExplorationDirectory() const;
+
+    /*!
+     * Retrieves the amount of memory that the external exploration uses for detecting duplicate states.
+     *
+     * @return The size in bytes.
+     */
+    uint64_t getExternalExplorationMemoryLimit() const;
+
+    /*!
+     * Retrieves whether the states found during explicit state space exploration are to be stored tree-compressed.
+     */
+    bool isStateCompressionSet() const;
+
+    /*!
+     * Retrieves whether the states found during explicit state space exploration are to be stored in a fingerprinted hash map.
+     */
+    bool isFingerprintedStateStorageSet() const;
+
+    /*!
+     * Retrieves whether the symmetry of modules that are renamed from the same module is to be exploited.
+     */
+    bool isSymmetryReductionSet() const;
+
+    /*!
+     * Retrieves whether the interleavings of independent commands are to be reduced.
+     */
+    bool isPartialOrderReductionSet() const;
+
+    /*!
+     * Retrieves whether the ranges of integer variables are to be narrowed by an interval analysis.
+     */
+    bool isVariableRangeAnalysisSet() const;
+
+    /*!
+     * Retrieves whether the states of the built model are to be renumbered.
+     */
+    bool isStateReorderingSet() const;
+
+    /*!
+     * Retrieves the order in which the states of the built model are to be arranged.
+     */
+    storm::utility::permutation::OrderKind getStateReorderingOrder() const;
+
+    /*!
+     * Retrieves whether the symbolic model builders are to order the DD variables with the FORCE heuristic.
+     */
+    bool isDdForceOrderSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
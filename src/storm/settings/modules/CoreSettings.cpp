@@ -14,6 +14,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOptionException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace settings {
@@ -28,9 +29,13 @@ const std::string CoreSettings::statisticsOptionShortName = "stats";
 const std::string CoreSettings::engineOptionName = "engine";
 const std::string CoreSettings::engineOptionShortName = "e";
 const std::string CoreSettings::ddLibraryOptionName = "ddlib";
+const std::string CoreSettings::ddTerminalRoundingOptionName = "ddround";
 const std::string CoreSettings::cudaOptionName = "cuda";
 const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
 const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+const std::string CoreSettings::threadsOptionName = "threads";
+const std::string CoreSettings::hugePagesOptionName = "hugepages";
+const std::string CoreSettings::numaOptionName = "numa";
 
 CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility::Engine::Sparse) {
     std::vector<std::string> engines;
@@ -64,6 +69,22 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
                                          .build())
                         .build());
 
+    std::vector<std::string> roundingModes = {"nearest", "down", "up"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ddTerminalRoundingOptionName, false,
+                                                   "Sets whether the symbolic iterative solvers round the values of their ADDs to a grid after each iteration, "
+                                                   "which bounds the number of distinct terminals (and thereby the number of nodes) at the cost of precision.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("grid", "The distance of the grid points.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "mode", "The rounding direction. 'down' ('up') keeps iterations from below (above) sound.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(roundingModes))
+                                         .setDefaultValueString("nearest")
+                                         .makeOptional()
+                                         .build())
+                        .build());
+
     std::vector<std::string> lpSolvers = {"gurobi", "glpk", "z3"};
     this->addOption(storm::settings::OptionBuilder(moduleName, lpSolverOptionName, false, "Sets which LP solver is preferred.")
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of an LP solver.")
@@ -88,6 +109,34 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
         storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).")
             .setShortName(intelTbbOptionShortName)
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads used for parallelized matrix-vector multiplications and vector operations. "
+                                                   "If Storm was built without TBB, a built-in thread pool is used.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means auto-detect.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    std::vector<std::string> hugePagePolicies = {"none", "transparent", "explicit"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, hugePagesOptionName, false,
+                                                   "Sets whether large matrices and vectors (e.g. the transition matrix and the vectors of the solvers) are "
+                                                   "backed by huge pages, which reduces TLB misses.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "policy", "The policy. 'explicit' uses reserved huge pages where possible and transparent huge pages otherwise.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(hugePagePolicies))
+                                         .setDefaultValueString("none")
+                                         .build())
+                        .build());
+    std::vector<std::string> numaPolicies = {"default", "interleave", "firsttouch"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, numaOptionName, false,
+                                                   "Sets how the pages of large matrices and vectors are placed on the NUMA nodes.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "policy", "The policy. 'firsttouch' lets the threads of parallelized operations touch new memory first.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(numaPolicies))
+                                         .setDefaultValueString("default")
+                                         .build())
+                        .build());
 }
 
 storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
@@ -156,6 +205,24 @@ bool CoreSettings::isDdLibraryTypeSetFromDefaultValue() const {
            this->getOption(ddLibraryOptionName).getArgumentByName("name").wasSetFromDefaultValue();
 }
 
+bool CoreSettings::isDdTerminalRoundingSet() const {
+    return this->getOption(ddTerminalRoundingOptionName).getHasOptionBeenSet();
+}
+
+double CoreSettings::getDdTerminalRoundingGrid() const {
+    return this->getOption(ddTerminalRoundingOptionName).getArgumentByName("grid").getValueAsDouble();
+}
+
+storm::solver::DdTerminalRounding CoreSettings::getDdTerminalRoundingMode() const {
+    std::string modeAsString = this->getOption(ddTerminalRoundingOptionName).getArgumentByName("mode").getValueAsString();
+    if (modeAsString == "down") {
+        return storm::solver::DdTerminalRounding::Down;
+    } else if (modeAsString == "up") {
+        return storm::solver::DdTerminalRounding::Up;
+    }
+    return storm::solver::DdTerminalRounding::Nearest;
+}
+
 bool CoreSettings::isShowStatisticsSet() const {
     return this->getOption(statisticsOptionName).getHasOptionBeenSet();
 }
@@ -164,6 +231,38 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+bool CoreSettings::isNumberOfThreadsSet() const {
+    return this->getOption(threadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t CoreSettings::getNumberOfThreads() const {
+    if (isNumberOfThreadsSet()) {
+        return storm::utility::parallel::getNumberOfThreads(this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+    }
+    // For backwards compatibility, enabling TBB without specifying a number of threads uses all available cores.
+    return isUseIntelTbbSet() ? storm::utility::parallel::getNumberOfThreads(0) : 1;
+}
+
+storm::utility::memory::HugePagePolicy CoreSettings::getHugePagePolicy() const {
+    std::string policy = this->getOption(hugePagesOptionName).getArgumentByName("policy").getValueAsString();
+    if (policy == "transparent") {
+        return storm::utility::memory::HugePagePolicy::Transparent;
+    } else if (policy == "explicit") {
+        return storm::utility::memory::HugePagePolicy::Explicit;
+    }
+    return storm::utility::memory::HugePagePolicy::None;
+}
+
+storm::utility::memory::NumaPolicy CoreSettings::getNumaPolicy() const {
+    std::string policy = this->getOption(numaOptionName).getArgumentByName("policy").getValueAsString();
+    if (policy == "interleave") {
+        return storm::utility::memory::NumaPolicy::Interleave;
+    } else if (policy == "firsttouch") {
+        return storm::utility::memory::NumaPolicy::FirstTouch;
+    }
+    return storm::utility::memory::NumaPolicy::Default;
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
@@ -181,13 +280,22 @@ void CoreSettings::finalize() {
     std::string engineStr = this->getOption(engineOptionName).getArgumentByName("name").getValueAsString();
     engine = storm::utility::engineFromString(engineStr);
     STORM_LOG_THROW(engine != storm::utility::Engine::Unknown, storm::exceptions::IllegalArgumentValueException, "Unknown engine '" << engineStr << "'.");
+
+    // Propagate the number of threads to the parallelized operations.
+    storm::utility::parallel::setDefaultNumberOfThreads(getNumberOfThreads());
+
+    // Propagate the memory policies.
+    storm::utility::memory::setHugePagePolicy(getHugePagePolicy());
+    storm::utility::memory::setNumaPolicy(getNumaPolicy());
 }
 
 bool CoreSettings::check() const {
 #ifdef STORM_HAVE_INTELTBB
     return true;
 #else
-    STORM_LOG_WARN_COND(!isUseIntelTbbSet(), "Enabling TBB is not supported in this version of Storm as it was not built with support for it.");
+    STORM_LOG_WARN_COND(!isUseIntelTbbSet(),
+                        "Storm was not built with support for TBB. Parallelized operations use the built-in thread pool instead (see option --"
+                            << threadsOptionName << ").");
     return true;
 #endif
 }
@@ -6,10 +6,12 @@
 
 #include "storm/builder/ExplorationOrder.h"
 #include "storm/utility/Engine.h"
+#include "storm/utility/memory.h"
 
 namespace storm {
 namespace solver {
 enum class EquationSolverType;
+enum class DdTerminalRounding;
 enum class LpSolverType;
 enum class MinMaxMethod;
 enum class SmtSolverType;
@@ -88,6 +90,21 @@ class CoreSettings : public ModuleSettings {
      */
     bool isDdLibraryTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves whether the terminals of the ADDs computed by the symbolic iterative solvers are to be rounded to a grid.
+     */
+    bool isDdTerminalRoundingSet() const;
+
+    /*!
+     * Retrieves the distance of the grid points to which the terminals of the ADDs computed by the symbolic iterative solvers are rounded.
+     */
+    double getDdTerminalRoundingGrid() const;
+
+    /*!
+     * Retrieves the direction in which the terminals of the ADDs computed by the symbolic iterative solvers are rounded.
+     */
+    storm::solver::DdTerminalRounding getDdTerminalRoundingMode() const;
+
     /*!
      * Retrieves whether statistics are to be shown
      *
@@ -102,6 +119,29 @@ class CoreSettings : public ModuleSettings {
      */
     bool isUseIntelTbbSet() const;
 
+    /*!
+     * Retrieves whether the number of threads for parallelized operations was set explicitly.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads for parallelized operations (at least one). If no number was set explicitly,
+     * this is one unless TBB is enabled, in which case all available cores are used.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the policy that determines whether large matrices and vectors are backed by huge pages.
+     */
+    storm::utility::memory::HugePagePolicy getHugePagePolicy() const;
+
+    /*!
+     * Retrieves the policy that determines how the pages of large matrices and vectors are placed on the NUMA nodes.
+     */
+    storm::utility::memory::NumaPolicy getNumaPolicy() const;
+
     /*!
      * Retrieves whether the option to use CUDA is set.
      *
@@ -139,9 +179,13 @@ class CoreSettings : public ModuleSettings {
     static const std::string engineOptionName;
     static const std::string engineOptionShortName;
     static const std::string ddLibraryOptionName;
+    static const std::string ddTerminalRoundingOptionName;
     static const std::string intelTbbOptionName;
     static const std::string intelTbbOptionShortName;
     static const std::string cudaOptionName;
+    static const std::string threadsOptionName;
+    static const std::string hugePagesOptionName;
+    static const std::string numaOptionName;
 };
 
 }  // namespace modules
@@ -18,9 +18,10 @@ const std::string EliminationSettings::eliminationOrderOptionName = "order";
 const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
 const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
 const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+const std::string EliminationSettings::operationCacheOptionName = "operation-cache";
 
 EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+    std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "amd"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.")
             .setIsAdvanced()
@@ -54,6 +55,16 @@ EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether to use the dedicated model elimination checker (only DTMCs).")
                         .setIsAdvanced()
                         .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, operationCacheOptionName, true,
+                                       "Sets whether the results of products and sums of rational functions are cached (and shared between threads).")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The maximal number of cached results.")
+                             .setDefaultValueUnsignedInteger(1000000)
+                             .makeOptional()
+                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
 }
 
 EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -85,6 +96,8 @@ EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder()
         return EliminationOrder::DynamicPenalty;
     } else if (eliminationOrderAsString == "regex") {
         return EliminationOrder::RegularExpression;
+    } else if (eliminationOrderAsString == "amd") {
+        return EliminationOrder::ApproximateMinimumDegree;
     } else {
         STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
     }
@@ -101,6 +114,14 @@ uint_fast64_t EliminationSettings::getMaximalSccSize() const {
 bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
     return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
 }
+
+bool EliminationSettings::isOperationCacheSet() const {
+    return this->getOption(operationCacheOptionName).getHasOptionBeenSet();
+}
+
+uint64_t EliminationSettings::getOperationCacheSize() const {
+    return this->getOption(operationCacheOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+}
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
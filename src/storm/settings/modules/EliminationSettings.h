@@ -15,7 +15,17 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder {
+        Forward,
+        ForwardReversed,
+        Backward,
+        BackwardReversed,
+        Random,
+        StaticPenalty,
+        DynamicPenalty,
+        RegularExpression,
+        ApproximateMinimumDegree
+    };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -62,6 +72,18 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves whether the results of operations on rational functions are to be cached.
+     *
+     * @return True iff the option was set.
+     */
+    bool isOperationCacheSet() const;
+
+    /*!
+     * Retrieves the maximal number of entries of the cache for operations on rational functions.
+     */
+    uint64_t getOperationCacheSize() const;
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +92,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string operationCacheOptionName;
 };
 
 }  // namespace modules
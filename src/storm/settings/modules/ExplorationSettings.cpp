@@ -9,6 +9,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/utility/Engine.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace settings {
@@ -21,6 +22,7 @@ const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOp
 const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
 const std::string ExplorationSettings::precisionOptionName = "precision";
 const std::string ExplorationSettings::precisionOptionShortName = "eps";
+const std::string ExplorationSettings::numberOfThreadsOptionName = "threads";
 
 ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"local", "global"};
@@ -67,6 +69,14 @@ ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of workers that sample paths concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of workers. If set to 0, the number of available hardware threads is used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -121,11 +131,20 @@ double ExplorationSettings::getPrecision() const {
     return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint_fast64_t ExplorationSettings::getNumberOfThreads() const {
+    return storm::utility::parallel::getNumberOfThreads(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+}
+
+void ExplorationSettings::setNumberOfThreads(uint_fast64_t value) {
+    this->getOption(numberOfThreadsOptionName).getArgumentByName("count").setFromStringValue(std::to_string(value));
+}
+
 bool ExplorationSettings::check() const {
     bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                       this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                      this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                      this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Exploration || !optionsSet,
                         "Exploration engine is not selected, so setting options for it has no effect.");
     return true;
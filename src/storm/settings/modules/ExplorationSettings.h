@@ -79,6 +79,20 @@ class ExplorationSettings : public ModuleSettings {
      */
     double getPrecision() const;
 
+    /*!
+     * Retrieves the number of workers that sample paths concurrently.
+     *
+     * @return The number of workers (at least one).
+     */
+    uint_fast64_t getNumberOfThreads() const;
+
+    /*!
+     * Sets the number of workers that sample paths concurrently.
+     *
+     * @param value The new number of workers, where 0 means 'auto-detect'.
+     */
+    void setNumberOfThreads(uint_fast64_t value);
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -91,6 +105,7 @@ class ExplorationSettings : public ModuleSettings {
     static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
     static const std::string nextStateHeuristicOptionName;
     static const std::string precisionOptionName;
+    static const std::string numberOfThreadsOptionName;
     static const std::string precisionOptionShortName;
 };
 }  // namespace modules
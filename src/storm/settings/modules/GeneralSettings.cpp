@@ -32,6 +32,7 @@ const std::string GeneralSettings::bisimulationOptionShortName = "bisim";
 const std::string GeneralSettings::parametricOptionName = "parametric";
 const std::string GeneralSettings::exactOptionName = "exact";
 const std::string GeneralSettings::soundOptionName = "sound";
+const std::string GeneralSettings::exactFloatFirstOptionName = "exact-float-first";
 
 GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -85,6 +86,11 @@ GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
                              .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, soundOptionName, false, "Sets whether to force sound model checking.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exactFloatFirstOptionName, false,
+                                                   "If set, exact computations first solve in floating point arithmetic and then verify (and if necessary "
+                                                   "repair) the result in exact arithmetic.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool GeneralSettings::isHelpSet() const {
@@ -152,6 +158,10 @@ bool GeneralSettings::isSoundSet() const {
     return this->getOption(soundOptionName).getHasOptionBeenSet();
 }
 
+bool GeneralSettings::isExactFloatFirstSet() const {
+    return this->getOption(exactFloatFirstOptionName).getHasOptionBeenSet();
+}
+
 void GeneralSettings::finalize() {
     // Intentionally left empty.
 }
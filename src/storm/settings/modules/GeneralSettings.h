@@ -123,6 +123,13 @@ class GeneralSettings : public ModuleSettings {
      */
     bool isSoundSet() const;
 
+    /*!
+     * Retrieves whether exact computations are to be performed in floating point arithmetic first.
+     *
+     * @return True iff the option was set.
+     */
+    bool isExactFloatFirstSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -149,6 +156,7 @@ class GeneralSettings : public ModuleSettings {
     static const std::string parametricOptionName;
     static const std::string exactOptionName;
     static const std::string soundOptionName;
+    static const std::string exactFloatFirstOptionName;
 };
 
 }  // namespace modules
@@ -3,6 +3,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/ArgumentValidators.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 
@@ -13,11 +14,30 @@ namespace modules {
 const std::string HintSettings::moduleName = "hints";
 
 const std::string stateHintOption = "states";
+const std::string propagateOption = "propagate";
+const std::string importOption = "import";
+const std::string exportOption = "export";
 
 HintSettings::HintSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, stateHintOption, true, "Estimate of the number of reachable states")
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "size.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, propagateOption, true,
+                                                   "If set, results of checked properties serve as hints for related properties, e.g. P=? [F<=k \"a\"] "
+                                                   "continues from P=? [F<=k-1 \"a\"] and the scheduler of Pmax=? [F \"a\"] seeds Rmax=? [F \"a\"].")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, importOption, true,
+                                                   "Uses the results stored in the given file as hints. The file must have been written for a model with the same "
+                                                   "structure.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to import.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportOption, true,
+                                                   "Exports the results of the checked properties (values and schedulers) to the given file, from which they can be "
+                                                   "imported as hints in later runs. Implies --" + propagateOption + ".")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to export to.").build())
+                        .build());
 }
 
 bool HintSettings::isNumberStatesSet() const {
@@ -28,6 +48,26 @@ uint64_t HintSettings::getNumberStates() const {
     return this->getOption(stateHintOption).getArgumentByName("number").getValueAsUnsignedInteger();
 }
 
+bool HintSettings::isPropagateSet() const {
+    return this->getOption(propagateOption).getHasOptionBeenSet();
+}
+
+bool HintSettings::isImportSet() const {
+    return this->getOption(importOption).getHasOptionBeenSet();
+}
+
+std::string HintSettings::getImportFilename() const {
+    return this->getOption(importOption).getArgumentByName("filename").getValueAsString();
+}
+
+bool HintSettings::isExportSet() const {
+    return this->getOption(exportOption).getHasOptionBeenSet();
+}
+
+std::string HintSettings::getExportFilename() const {
+    return this->getOption(exportOption).getArgumentByName("filename").getValueAsString();
+}
+
 bool HintSettings::check() const {
     return true;
 }
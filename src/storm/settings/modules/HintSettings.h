@@ -24,6 +24,31 @@ class HintSettings : public ModuleSettings {
 
     uint64_t getNumberStates() const;
 
+    /*!
+     * Retrieves whether results of checked properties are to be used as hints for related properties.
+     */
+    bool isPropagateSet() const;
+
+    /*!
+     * Retrieves whether hints are to be imported from a file.
+     */
+    bool isImportSet() const;
+
+    /*!
+     * Retrieves the file from which hints are to be imported.
+     */
+    std::string getImportFilename() const;
+
+    /*!
+     * Retrieves whether the results of checked properties are to be exported as hints for later runs.
+     */
+    bool isExportSet() const;
+
+    /*!
+     * Retrieves the file to which hints are to be exported.
+     */
+    std::string getExportFilename() const;
+
     bool check() const override;
 
     void finalize() override;
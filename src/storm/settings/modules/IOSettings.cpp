@@ -1,5 +1,8 @@
 #include "storm/settings/modules/IOSettings.h"
 
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
 #include "storm/settings/Argument.h"
@@ -27,10 +30,16 @@ const std::string IOSettings::exportCdfOptionName = "exportcdf";
 const std::string IOSettings::exportCdfOptionShortName = "cdf";
 const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
 const std::string IOSettings::exportCheckResultOptionName = "exportresult";
+const std::string IOSettings::exportSolverTelemetryOptionName = "exportsolvertelemetry";
+const std::string IOSettings::exportDdStatisticsOptionName = "exportddstats";
+const std::string IOSettings::solverCheckpointsOptionName = "checkpoint";
+const std::string IOSettings::resumeOptionName = "resume";
 const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
 const std::string IOSettings::explicitDrnOptionName = "explicit-drn";
 const std::string IOSettings::explicitDrnOptionShortName = "drn";
+const std::string IOSettings::explicitDrbOptionName = "explicit-drb";
+const std::string IOSettings::explicitDrbOptionShortName = "drb";
 const std::string IOSettings::explicitImcaOptionName = "explicit-imca";
 const std::string IOSettings::explicitImcaOptionShortName = "imca";
 const std::string IOSettings::prismInputOptionName = "prism";
@@ -42,6 +51,7 @@ const std::string IOSettings::stateRewardsOptionName = "staterew";
 const std::string IOSettings::choiceLabelingOptionName = "choicelab";
 const std::string IOSettings::constantsOptionName = "constants";
 const std::string IOSettings::constantsOptionShortName = "const";
+const std::string IOSettings::constantSweepOptionName = "constantsweep";
 
 const std::string IOSettings::janiPropertyOptionName = "janiproperty";
 const std::string IOSettings::janiPropertyOptionShortName = "jprop";
@@ -74,7 +84,7 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
-    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "json"});
+    std::vector<std::string> exportFormats({"auto", "dot", "drdd", "drn", "drb", "json"});
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportBuildOptionName, false, "Exports the built model to a file.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The output file.").build())
@@ -103,14 +113,44 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, exportSchedulerOptionName, false,
                                        "Exports the choices of an optimal scheduler to the given file (if supported by engine).")
             .setIsAdvanced()
-            .addArgument(
-                storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file. Use file extension '.json' to export in json.").build())
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename",
+                                                                                "The output file. Use file extension '.json' to export in json and '.bin' "
+                                                                                "for a compact binary format (memoryless schedulers only).")
+                             .build())
             .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, exportCheckResultOptionName, false,
                                                    "Exports the result to a given file (if supported by engine). The export will be in json.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportSolverTelemetryOptionName, false,
+                                                   "Exports per-iteration statistics of the iterative equation solvers (differences, bounds, throughput).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "filename", "The output file. Use file extension '.csv' to export in csv, otherwise json is used.")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, solverCheckpointsOptionName, false,
+                                                   "Periodically stores the iterates of long-running iterative equation solvers in the given directory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The (existing) checkpoint directory.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("interval", "The time between two checkpoints (in seconds).")
+                                         .setDefaultValueDouble(600.0)
+                                         .makeOptional()
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false,
+                                                   "Resumes the iterative equation solvers from the latest checkpoints in the checkpoint directory. "
+                                                   "Requires the same input and settings as the interrupted run.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportDdStatisticsOptionName, false,
+                                                   "Exports the statistics of the DD library (node counts, cache hits, garbage collections and "
+                                                   "reorderings) after building, bisimulation and solving to a json file.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The output file.").build())
+                        .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, exportExplicitOptionName, "",
                                        "If given, the loaded model will be written to the specified file in the drn format.")
@@ -143,6 +183,12 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explicitDrbOptionName, false, "Parses the model given in the binary direct encoding (drb).")
+                        .setShortName(explicitDrbOptionShortName)
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("drb filename", "The name of the drb file containing the model.")
+                                         .addValidatorString(ArgumentValidatorFactory::createExistingFileValidator())
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explicitImcaOptionName, false, "Parses the model given in the IMCA format.")
                         .setShortName(explicitImcaOptionShortName)
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("imca filename", "The name of the imca file containing the model.")
@@ -211,6 +257,16 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                     .setDefaultValueString("")
                     .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, constantSweepOptionName, false,
+                                                   "Processes the symbolic model once for each of the given constant definitions. The model is parsed only "
+                                                   "once and, if the swept constants only appear in probabilities or rewards, also built only once. Constants "
+                                                   "that are the same for all definitions are given via --" +
+                                                       constantsOptionName + ".")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "values", "A semicolon separated list of constant definitions (each as for --" + constantsOptionName +
+                                                       "), e.g. p=0.1,q=1;p=0.2,q=1;p=0.3,q=2.")
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, janiPropertyOptionName, false,
                                                    "Specifies the properties from the jani model (given by --" + janiInputOptionName + ") to be checked.")
                         .setShortName(janiPropertyOptionShortName)
@@ -338,6 +394,38 @@ std::string IOSettings::getExportSchedulerFilename() const {
     return this->getOption(exportSchedulerOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool IOSettings::isExportSolverTelemetrySet() const {
+    return this->getOption(exportSolverTelemetryOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportSolverTelemetryFilename() const {
+    return this->getOption(exportSolverTelemetryOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool IOSettings::isSolverCheckpointsSet() const {
+    return this->getOption(solverCheckpointsOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getSolverCheckpointsDirectory() const {
+    return this->getOption(solverCheckpointsOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+double IOSettings::getSolverCheckpointsInterval() const {
+    return this->getOption(solverCheckpointsOptionName).getArgumentByName("interval").getValueAsDouble();
+}
+
+bool IOSettings::isResumeSet() const {
+    return this->getOption(resumeOptionName).getHasOptionBeenSet();
+}
+
+bool IOSettings::isExportDdStatisticsSet() const {
+    return this->getOption(exportDdStatisticsOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExportDdStatisticsFilename() const {
+    return this->getOption(exportDdStatisticsOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isExportCheckResultSet() const {
     return this->getOption(exportCheckResultOptionName).getHasOptionBeenSet();
 }
@@ -366,6 +454,14 @@ std::string IOSettings::getExplicitDRNFilename() const {
     return this->getOption(explicitDrnOptionName).getArgumentByName("drn filename").getValueAsString();
 }
 
+bool IOSettings::isExplicitDRBSet() const {
+    return this->getOption(explicitDrbOptionName).getHasOptionBeenSet();
+}
+
+std::string IOSettings::getExplicitDRBFilename() const {
+    return this->getOption(explicitDrbOptionName).getArgumentByName("drb filename").getValueAsString();
+}
+
 bool IOSettings::isExplicitIMCASet() const {
     return this->getOption(explicitImcaOptionName).getHasOptionBeenSet();
 }
@@ -430,6 +526,21 @@ std::string IOSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool IOSettings::isConstantSweepSet() const {
+    return this->getOption(constantSweepOptionName).getHasOptionBeenSet();
+}
+
+std::vector<std::string> IOSettings::getConstantSweepDefinitionStrings() const {
+    std::vector<std::string> definitionStrings;
+    std::string sweepString = this->getOption(constantSweepOptionName).getArgumentByName("values").getValueAsString();
+    boost::split(definitionStrings, sweepString, boost::is_any_of(";"));
+    for (auto& definitionString : definitionStrings) {
+        boost::trim(definitionString);
+    }
+    definitionStrings.erase(std::remove(definitionStrings.begin(), definitionStrings.end(), ""), definitionStrings.end());
+    return definitionStrings;
+}
+
 bool IOSettings::isJaniPropertiesSet() const {
     return this->getOption(janiPropertyOptionName).getHasOptionBeenSet();
 }
@@ -522,6 +633,7 @@ bool IOSettings::check() const {
     // Ensure that not two explicit input models were given.
     uint64_t numExplicitInputs = isExplicitSet() ? 1 : 0;
     numExplicitInputs += isExplicitDRNSet() ? 1 : 0;
+    numExplicitInputs += isExplicitDRBSet() ? 1 : 0;
     numExplicitInputs += isExplicitIMCASet() ? 1 : 0;
     STORM_LOG_THROW(numExplicitInputs <= 1, storm::exceptions::InvalidSettingsException, "Multiple explicit input models");
 
@@ -533,6 +645,9 @@ bool IOSettings::check() const {
     STORM_LOG_THROW(!isPrismToJaniSet() || isPrismInputSet(), storm::exceptions::InvalidSettingsException,
                     "For the transformation from PRISM to JANI, the input model must be given in the prism format.");
 
+    STORM_LOG_THROW(!isResumeSet() || isSolverCheckpointsSet(), storm::exceptions::InvalidSettingsException,
+                    "Resuming requires the directory of the checkpoints (option '--" << solverCheckpointsOptionName << "').");
+
     return true;
 }
 
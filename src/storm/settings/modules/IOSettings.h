@@ -120,6 +120,46 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExportSchedulerFilename() const;
 
+    /*!
+     * Retrieves whether the per-iteration statistics of the equation solvers are to be exported.
+     */
+    bool isExportSolverTelemetrySet() const;
+
+    /*!
+     * Retrieves a filename to which the per-iteration statistics of the equation solvers will be exported.
+     */
+    std::string getExportSolverTelemetryFilename() const;
+
+    /*!
+     * Retrieves whether the iterative equation solvers store checkpoints.
+     */
+    bool isSolverCheckpointsSet() const;
+
+    /*!
+     * Retrieves the directory in which the iterative equation solvers store their checkpoints.
+     */
+    std::string getSolverCheckpointsDirectory() const;
+
+    /*!
+     * Retrieves the time (in seconds) between two checkpoints of a solver.
+     */
+    double getSolverCheckpointsInterval() const;
+
+    /*!
+     * Retrieves whether the iterative equation solvers resume from the checkpoints.
+     */
+    bool isResumeSet() const;
+
+    /*!
+     * Retrieves whether the statistics of the DD library are to be exported.
+     */
+    bool isExportDdStatisticsSet() const;
+
+    /*!
+     * Retrieves the filename to which the statistics of the DD library will be exported.
+     */
+    std::string getExportDdStatisticsFilename() const;
+
     /*!
      * Retrieves whether the check result should be exported.
      */
@@ -167,6 +207,20 @@ class IOSettings : public ModuleSettings {
      */
     std::string getExplicitDRNFilename() const;
 
+    /*!
+     * Retrieves whether the explicit option with the binary direct encoding (drb) was set.
+     *
+     * @return True if the explicit option with drb was set.
+     */
+    bool isExplicitDRBSet() const;
+
+    /*!
+     * Retrieves the name of the file that contains the model in the binary direct encoding (drb).
+     *
+     * @return The name of the drb file that contains the model.
+     */
+    std::string getExplicitDRBFilename() const;
+
     /*!
      * Retrieves whether we prevent the usage of placeholders in the explicit DRN format
      * @return
@@ -290,6 +344,20 @@ class IOSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the constant sweep option was set.
+     *
+     * @return True if the constant sweep option was set.
+     */
+    bool isConstantSweepSet() const;
+
+    /*!
+     * Retrieves the strings that define the swept constants at each point of the sweep.
+     *
+     * @return The strings that define the swept constants.
+     */
+    std::vector<std::string> getConstantSweepDefinitionStrings() const;
+
     /*!
      * Retrieves whether the jani-property option was set
      * @return
@@ -386,10 +454,16 @@ class IOSettings : public ModuleSettings {
     static const std::string exportCdfOptionShortName;
     static const std::string exportSchedulerOptionName;
     static const std::string exportCheckResultOptionName;
+    static const std::string exportSolverTelemetryOptionName;
+    static const std::string exportDdStatisticsOptionName;
+    static const std::string solverCheckpointsOptionName;
+    static const std::string resumeOptionName;
     static const std::string explicitOptionName;
     static const std::string explicitOptionShortName;
     static const std::string explicitDrnOptionName;
     static const std::string explicitDrnOptionShortName;
+    static const std::string explicitDrbOptionName;
+    static const std::string explicitDrbOptionShortName;
     static const std::string explicitImcaOptionName;
     static const std::string explicitImcaOptionShortName;
     static const std::string prismInputOptionName;
@@ -400,6 +474,7 @@ class IOSettings : public ModuleSettings {
     static const std::string choiceLabelingOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string constantSweepOptionName;
     static const std::string janiPropertyOptionName;
     static const std::string janiPropertyOptionShortName;
     static const std::string propertyOptionName;
@@ -19,6 +19,7 @@ const std::string LongRunAverageSolverSettings::maximalIterationsOptionShortName
 const std::string LongRunAverageSolverSettings::precisionOptionName = "precision";
 const std::string LongRunAverageSolverSettings::absoluteOptionName = "absolute";
 const std::string LongRunAverageSolverSettings::aperiodicFactorOptionName = "aperiodicfactor";
+const std::string LongRunAverageSolverSettings::threadsOptionName = "threads";
 
 LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> detLraMethods = {"gb", "gain-bias-equations", "distr", "lra-distribution-equations", "vi", "value-iteration"};
@@ -69,6 +70,15 @@ LongRunAverageSolverSettings::LongRunAverageSolverSettings() : ModuleSettings(mo
                                          .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used to compute the long run averages of different end components or BSCCs "
+                                                   "concurrently (only for value iteration).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means auto-detect.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::solver::LraMethod LongRunAverageSolverSettings::getDetLraMethod() const {
@@ -131,6 +141,10 @@ double LongRunAverageSolverSettings::getAperiodicFactor() const {
     return this->getOption(aperiodicFactorOptionName).getArgumentByName("value").getValueAsDouble();
 }
 
+uint64_t LongRunAverageSolverSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -19,12 +19,15 @@ const std::string MinMaxEquationSolverSettings::precisionOptionName = "precision
 const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string MinMaxEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
+const std::string MinMaxEquationSolverSettings::portfolioRaceOptionName = "portfolio-race";
+const std::string MinMaxEquationSolverSettings::policyEvaluationSweepsOptionName = "mpi-sweeps";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
         "vi",     "value-iteration",    "pi",  "policy-iteration",      "lp",  "linear-programming",         "rs",          "ratsearch",
         "ii",     "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi",
-        "acyclic"};
+        "acyclic", "portfolio", "auto", "aii", "asynchronous-interval-iteration", "mpi", "modified-policy-iteration"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.")
             .setIsAdvanced()
@@ -68,6 +71,27 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false,
+                                                   "If set, interval iteration first iterates in single precision and then refines the result in double "
+                                                   "precision, starting from bounds obtained from the single precision result.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, portfolioRaceOptionName, false,
+                                                   "If set, the portfolio method runs the two most promising techniques concurrently and takes the result of "
+                                                   "the one that finishes first.")
+                        .setIsAdvanced()
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyEvaluationSweepsOptionName, false,
+                                                   "The maximal number of sweeps with which modified policy iteration evaluates a policy.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of sweeps.")
+                                         .setDefaultValueUnsignedInteger(20)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -82,6 +106,8 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::RationalSearch;
     } else if (minMaxEquationSolvingTechnique == "interval-iteration" || minMaxEquationSolvingTechnique == "ii") {
         return storm::solver::MinMaxMethod::IntervalIteration;
+    } else if (minMaxEquationSolvingTechnique == "asynchronous-interval-iteration" || minMaxEquationSolvingTechnique == "aii") {
+        return storm::solver::MinMaxMethod::AsynchronousIntervalIteration;
     } else if (minMaxEquationSolvingTechnique == "sound-value-iteration" || minMaxEquationSolvingTechnique == "svi") {
         return storm::solver::MinMaxMethod::SoundValueIteration;
     } else if (minMaxEquationSolvingTechnique == "optimistic-value-iteration" || minMaxEquationSolvingTechnique == "ovi") {
@@ -92,6 +118,10 @@ storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvi
         return storm::solver::MinMaxMethod::ViToPi;
     } else if (minMaxEquationSolvingTechnique == "acyclic") {
         return storm::solver::MinMaxMethod::Acyclic;
+    } else if (minMaxEquationSolvingTechnique == "portfolio" || minMaxEquationSolvingTechnique == "auto") {
+        return storm::solver::MinMaxMethod::Portfolio;
+    } else if (minMaxEquationSolvingTechnique == "modified-policy-iteration" || minMaxEquationSolvingTechnique == "mpi") {
+        return storm::solver::MinMaxMethod::ModifiedPolicyIteration;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException,
@@ -146,6 +176,18 @@ bool MinMaxEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+    return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+}
+
+uint64_t MinMaxEquationSolverSettings::getPolicyEvaluationSweeps() const {
+    return this->getOption(policyEvaluationSweepsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool MinMaxEquationSolverSettings::isPortfolioRaceSet() const {
+    return this->getOption(portfolioRaceOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
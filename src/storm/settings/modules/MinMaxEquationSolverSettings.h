@@ -95,6 +95,21 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether interval iteration is to start with iterations in single precision.
+     */
+    bool isMixedPrecisionSet() const;
+
+    /*!
+     * Retrieves whether the portfolio method is to run two techniques concurrently.
+     */
+    bool isPortfolioRaceSet() const;
+
+    /*!
+     * Retrieves the maximal number of sweeps with which modified policy iteration evaluates a policy.
+     */
+    uint64_t getPolicyEvaluationSweeps() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -106,6 +121,9 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string valueIterationMultiplicationStyleOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
+    static const std::string mixedPrecisionOptionName;
+    static const std::string portfolioRaceOptionName;
+    static const std::string policyEvaluationSweepsOptionName;
     static const std::string forceBoundsOptionName;
 };
 
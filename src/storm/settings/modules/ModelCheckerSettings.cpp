@@ -14,6 +14,10 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltlPretranslationOptionName = "ltl-pretranslate";
+const std::string ModelCheckerSettings::batchOptionName = "batch";
+const std::string ModelCheckerSettings::hybridSccOptionName = "hybridscc";
+const std::string ModelCheckerSettings::parallelPropertiesOptionName = "parallel-properties";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +31,37 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltlPretranslationOptionName, false,
+                                                   "If set, the LTL formulas of all properties are translated into deterministic automata in background "
+                                                   "threads while the model is built.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchOptionName, false,
+                                                   "If set, compatible properties (step-bounded reachability and cumulative rewards with the same optimization "
+                                                   "direction on MDPs, time-bounded reachability with the same subformulas on CTMCs) are checked together, "
+                                                   "sharing the passes over the transition matrix.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridSccOptionName, false,
+                                                   "If set, the hybrid engine extracts and solves the equation systems of DTMCs one group of SCCs at a time (in "
+                                                   "topological order) such that only a small part of the matrix is stored explicitly.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "size", "The minimal number of states of a group. Consecutive SCCs are grouped until this size is reached.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelPropertiesOptionName, false,
+                                                   "If set, the properties are checked concurrently by the sparse engine (for models with floating point "
+                                                   "values). The results are printed in the original order.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "threads", "The number of properties that are checked at the same time (0 means one per hardware thread).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -37,6 +72,30 @@ bool ModelCheckerSettings::isLtl2daToolSet() const {
     return this->getOption(ltl2daToolOptionName).getHasOptionBeenSet();
 }
 
+bool ModelCheckerSettings::isLtlPretranslationSet() const {
+    return this->getOption(ltlPretranslationOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isBatchSet() const {
+    return this->getOption(batchOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isHybridSccSet() const {
+    return this->getOption(hybridSccOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getHybridSccBlockSize() const {
+    return this->getOption(hybridSccOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isParallelPropertiesSet() const {
+    return this->getOption(parallelPropertiesOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfParallelProperties() const {
+    return this->getOption(parallelPropertiesOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+}
+
 std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
@@ -35,6 +35,36 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether the LTL formulas of the properties are to be translated into automata while the model is built.
+     */
+    bool isLtlPretranslationSet() const;
+
+    /*!
+     * Retrieves whether compatible properties are to be checked in batches.
+     */
+    bool isBatchSet() const;
+
+    /*!
+     * Retrieves whether the hybrid engine is to extract and solve equation systems block-wise along the SCCs of the maybe-states.
+     */
+    bool isHybridSccSet() const;
+
+    /*!
+     * Retrieves the minimal number of states of a block that is extracted and solved by the hybrid engine if it proceeds SCC-wise.
+     */
+    uint64_t getHybridSccBlockSize() const;
+
+    /*!
+     * Retrieves whether independent properties are to be checked concurrently.
+     */
+    bool isParallelPropertiesSet() const;
+
+    /*!
+     * Retrieves the number of threads on which properties are checked concurrently, where 0 means 'auto-detect'.
+     */
+    uint64_t getNumberOfParallelProperties() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +72,10 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltlPretranslationOptionName;
+    static const std::string batchOptionName;
+    static const std::string hybridSccOptionName;
+    static const std::string parallelPropertiesOptionName;
 };
 
 }  // namespace modules
@@ -19,6 +19,7 @@ const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "pure
 const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
 const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
 const std::string MultiObjectiveSettings::lexicographicOptionName = "lex";
+const std::string MultiObjectiveSettings::threadsOptionName = "threads";
 
 MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -88,6 +89,15 @@ MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, lexicographicOptionName, false,
                                                    "If set, lexicographic model checking instead of normal multi objective is performed.")
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used to process independent facets concurrently (only for constraint-based "
+                                                   "methods). Each thread uses its own LP model.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means auto-detect.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -186,6 +196,10 @@ bool MultiObjectiveSettings::isLexicographicModelCheckingSet() const {
     return this->getOption(lexicographicOptionName).getHasOptionBeenSet();
 }
 
+uint64_t MultiObjectiveSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool MultiObjectiveSettings::check() const {
     std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
 
@@ -13,9 +13,12 @@ namespace modules {
 
 const std::string MultiplierSettings::moduleName = "multiplier";
 const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+const std::string MultiplierSettings::gaussSeidelThreadsOptionName = "gsthreads";
+const std::string MultiplierSettings::gaussSeidelBlockSizeOptionName = "gsblocksize";
+const std::string MultiplierSettings::temporalBlockingWindowOptionName = "tbwindow";
 
 MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+    std::vector<std::string> multiplierTypes = {"native", "gmmxx", "compact", "simd", "sell"};
     this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.")
@@ -23,6 +26,31 @@ MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("gmmxx")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, gaussSeidelThreadsOptionName, true,
+                                                   "Sets the number of threads for Gauss-Seidel style multiplications. With more than one thread, the rows "
+                                                   "are split into blocks which are processed in parallel (Gauss-Seidel within, Jacobi across blocks). "
+                                                   "Asynchronous interval iteration uses the same number of threads.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. 0 means auto-detect.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, gaussSeidelBlockSizeOptionName, true,
+                                                   "Sets the number of rows (or row groups) per block of parallel Gauss-Seidel style multiplications.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The block size.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(4096)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, temporalBlockingWindowOptionName, true,
+                                                   "Sets the number of matrix entries that are kept in cache while repeated multiplications (e.g. for "
+                                                   "step-bounded properties) advance several steps on one part of the matrix. 0 disables this.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The number of entries.")
+                                         .setDefaultValueUnsignedInteger(262144)
+                                         .build())
+                        .build());
 }
 
 storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -31,11 +59,29 @@ storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
         return storm::solver::MultiplierType::Native;
     } else if (type == "gmmxx") {
         return storm::solver::MultiplierType::Gmmxx;
+    } else if (type == "compact") {
+        return storm::solver::MultiplierType::Compact;
+    } else if (type == "simd") {
+        return storm::solver::MultiplierType::Simd;
+    } else if (type == "sell") {
+        return storm::solver::MultiplierType::Sell;
     }
 
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
 }
 
+uint64_t MultiplierSettings::getNumberOfGaussSeidelThreads() const {
+    return this->getOption(gaussSeidelThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t MultiplierSettings::getGaussSeidelBlockSize() const {
+    return this->getOption(gaussSeidelBlockSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+uint64_t MultiplierSettings::getTemporalBlockingWindow() const {
+    return this->getOption(temporalBlockingWindowOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+}
+
 bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
     return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
@@ -21,11 +21,29 @@ class MultiplierSettings : public ModuleSettings {
 
     bool isMultiplierTypeSetFromDefaultValue() const;
 
+    /*!
+     * Retrieves the number of threads used for Gauss-Seidel style multiplications (where 0 means 'auto-detect').
+     */
+    uint64_t getNumberOfGaussSeidelThreads() const;
+
+    /*!
+     * Retrieves the number of rows (or row groups) per block of parallel Gauss-Seidel style multiplications.
+     */
+    uint64_t getGaussSeidelBlockSize() const;
+
+    /*!
+     * Retrieves the number of matrix entries that a temporally blocked sweep of repeated multiplications keeps in cache (where 0 disables it).
+     */
+    uint64_t getTemporalBlockingWindow() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string multiplierTypeOptionName;
+    static const std::string gaussSeidelThreadsOptionName;
+    static const std::string gaussSeidelBlockSizeOptionName;
+    static const std::string temporalBlockingWindowOptionName;
 };
 
 }  // namespace modules
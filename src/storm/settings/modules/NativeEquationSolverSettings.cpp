@@ -24,11 +24,13 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::gaussSeidelOrderingOptionName = "gsorder";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
                                         "power",  "sound-value-iteration", "svi", "optimistic-value-iteration",
-                                        "ovi",    "interval-iteration",    "ii",  "ratsearch"};
+                                        "ovi",    "interval-iteration",    "ii",  "asynchronous-interval-iteration",
+                                        "aii",    "ratsearch"};
     this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true,
                                                    "The method to be used for solving linear equation systems with the native engine.")
                         .setIsAdvanced()
@@ -76,6 +78,17 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                          .build())
                         .build());
 
+    std::vector<std::string> gaussSeidelOrderings = {"index", "target-distance"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, gaussSeidelOrderingOptionName, false,
+                                                   "Sets the order in which Gauss-Seidel and SOR process the rows. 'target-distance' first processes the rows "
+                                                   "with non-zero right-hand side and then the remaining rows in the order of their distance to these.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the ordering.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(gaussSeidelOrderings))
+                                         .setDefaultValueString("index")
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false,
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
@@ -109,6 +122,8 @@ storm::solver::NativeLinearEquationSolverMethod NativeEquationSolverSettings::ge
         return storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration;
     } else if (linearEquationSystemTechniqueAsString == "interval-iteration" || linearEquationSystemTechniqueAsString == "ii") {
         return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
+    } else if (linearEquationSystemTechniqueAsString == "asynchronous-interval-iteration" || linearEquationSystemTechniqueAsString == "aii") {
+        return storm::solver::NativeLinearEquationSolverMethod::AsynchronousIntervalIteration;
     } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
         return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
     }
@@ -155,6 +170,16 @@ storm::solver::MultiplicationStyle NativeEquationSolverSettings::getPowerMethodM
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplication style '" << multiplicationStyleString << "'.");
 }
 
+storm::solver::GaussSeidelOrdering NativeEquationSolverSettings::getGaussSeidelOrdering() const {
+    std::string orderingString = this->getOption(gaussSeidelOrderingOptionName).getArgumentByName("name").getValueAsString();
+    if (orderingString == "index") {
+        return storm::solver::GaussSeidelOrdering::Index;
+    } else if (orderingString == "target-distance") {
+        return storm::solver::GaussSeidelOrdering::TargetDistance;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown Gauss-Seidel ordering '" << orderingString << "'.");
+}
+
 bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet() const {
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
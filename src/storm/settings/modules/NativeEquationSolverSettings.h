@@ -105,6 +105,13 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
 
+    /*!
+     * Retrieves the order in which Gauss-Seidel and SOR sweep over the rows.
+     *
+     * @return The ordering.
+     */
+    storm::solver::GaussSeidelOrdering getGaussSeidelOrdering() const;
+
     /*!
      * Retrieves whether the  force bounds option has been set.
      */
@@ -125,6 +132,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
+    static const std::string gaussSeidelOrderingOptionName;
     static const std::string forceBoundsOptionName;
 };
 
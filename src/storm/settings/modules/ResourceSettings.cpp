@@ -13,9 +13,14 @@ namespace modules {
 const std::string ResourceSettings::moduleName = "resources";
 const std::string ResourceSettings::timeoutOptionName = "timeout";
 const std::string ResourceSettings::timeoutOptionShortName = "t";
+const std::string ResourceSettings::memoryLimitOptionName = "memlimit";
+const std::string ResourceSettings::memoryLimitFallbackOptionName = "memlimit-fallback";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::exportProfileOptionName = "profile";
+const std::string ResourceSettings::exportProfileSummaryOptionName = "profile-summary";
+const std::string ResourceSettings::metricsOptionName = "metrics";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -25,6 +30,18 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(0)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitOptionName, false,
+                                                   "If given, the explicit model construction aborts before it would exceed the memory limit.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The memory limit in MB.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, memoryLimitFallbackOptionName, false,
+                                                   "If set, the model is built with the hybrid (and then the dd) engine if building it with the sparse "
+                                                   "(hybrid) engine would exceed the memory limit.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.")
                         .setShortName(printTimeAndMemoryOptionShortName)
                         .build());
@@ -35,6 +52,29 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportProfileOptionName, false,
+                                                   "Records the time and memory spent in parsing, building, preprocessing and solving and exports it in the "
+                                                   "Chrome trace format (viewable with chrome://tracing or ui.perfetto.dev).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the trace is written.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exportProfileSummaryOptionName, false,
+                                                   "Records the time and memory spent in parsing, building, preprocessing and solving and exports a json "
+                                                   "summary per region.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the summary is written.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, metricsOptionName, false,
+                                                   "Periodically publishes live metrics (e.g. explored states, memory and solver residuals) to a file. Files "
+                                                   "ending in .prom are written in the Prometheus text format, all others as json lines.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The file to which the metrics are written.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("interval", "The time between two publications (in seconds).")
+                                         .setDefaultValueDouble(10.0)
+                                         .makeOptional()
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -45,6 +85,18 @@ uint_fast64_t ResourceSettings::getTimeoutInSeconds() const {
     return this->getOption(timeoutOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isMemoryLimitSet() const {
+    return this->getOption(memoryLimitOptionName).getHasOptionBeenSet();
+}
+
+uint_fast64_t ResourceSettings::getMemoryLimitInMegabytes() const {
+    return this->getOption(memoryLimitOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isMemoryLimitFallbackSet() const {
+    return this->getOption(memoryLimitFallbackOptionName).getHasOptionBeenSet();
+}
+
 bool ResourceSettings::isPrintTimeAndMemorySet() const {
     return this->getOption(printTimeAndMemoryOptionName).getHasOptionBeenSet();
 }
@@ -53,6 +105,34 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isExportProfileSet() const {
+    return this->getOption(exportProfileOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportProfileFilename() const {
+    return this->getOption(exportProfileOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool ResourceSettings::isExportProfileSummarySet() const {
+    return this->getOption(exportProfileSummaryOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getExportProfileSummaryFilename() const {
+    return this->getOption(exportProfileSummaryOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+bool ResourceSettings::isMetricsSet() const {
+    return this->getOption(metricsOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getMetricsFilename() const {
+    return this->getOption(metricsOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+double ResourceSettings::getMetricsIntervalInSeconds() const {
+    return this->getOption(metricsOptionName).getArgumentByName("interval").getValueAsDouble();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -38,6 +38,22 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getTimeoutInSeconds() const;
 
+    /*!
+     * Retrieves whether the memory limit option was set.
+     */
+    bool isMemoryLimitSet() const;
+
+    /*!
+     * Retrieves the number of megabytes the computation may use in case the memory limit option was set.
+     */
+    uint_fast64_t getMemoryLimitInMegabytes() const;
+
+    /*!
+     * Retrieves whether another engine shall be used if building the model with the selected engine would exceed the
+     * memory limit.
+     */
+    bool isMemoryLimitFallbackSet() const;
+
     /*!
      * Retrieves the waiting time of the program after a signal.
      * If a signal to abort is handled, the program should terminate.
@@ -47,6 +63,41 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether a profile (in the Chrome trace format) of the run shall be exported.
+     */
+    bool isExportProfileSet() const;
+
+    /*!
+     * Retrieves the file to which the profile (in the Chrome trace format) shall be exported.
+     */
+    std::string getExportProfileFilename() const;
+
+    /*!
+     * Retrieves whether a json summary of the profile of the run shall be exported.
+     */
+    bool isExportProfileSummarySet() const;
+
+    /*!
+     * Retrieves the file to which the json summary of the profile shall be exported.
+     */
+    std::string getExportProfileSummaryFilename() const;
+
+    /*!
+     * Retrieves whether live metrics of the run shall be published.
+     */
+    bool isMetricsSet() const;
+
+    /*!
+     * Retrieves the file to which the metrics are published.
+     */
+    std::string getMetricsFilename() const;
+
+    /*!
+     * Retrieves the time between two publications of the metrics.
+     */
+    double getMetricsIntervalInSeconds() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -54,9 +105,14 @@ class ResourceSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string timeoutOptionName;
     static const std::string timeoutOptionShortName;
+    static const std::string memoryLimitOptionName;
+    static const std::string memoryLimitFallbackOptionName;
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string exportProfileOptionName;
+    static const std::string exportProfileSummaryOptionName;
+    static const std::string metricsOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -0,0 +1,144 @@
+#include "storm/settings/modules/SimulationSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string SimulationSettings::moduleName = "smc";
+const std::string SimulationSettings::estimationMethodOptionName = "method";
+const std::string SimulationSettings::precisionOptionName = "precision";
+const std::string SimulationSettings::confidenceOptionName = "confidence";
+const std::string SimulationSettings::indifferenceOptionName = "indifference";
+const std::string SimulationSettings::batchSizeOptionName = "batch";
+const std::string SimulationSettings::seedOptionName = "seed";
+const std::string SimulationSettings::cacheSizeOptionName = "cachesize";
+const std::string SimulationSettings::maximalNumberOfTracesOptionName = "maxtraces";
+
+SimulationSettings::SimulationSettings() : ModuleSettings(moduleName) {
+    std::vector<std::string> methods = {"cp", "chernoff"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, estimationMethodOptionName, false, "Sets the method used to estimate probabilities.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the method. 'cp' samples until the Clopper-Pearson interval is narrow enough, 'chernoff' samples the "
+                                         "number of traces given by the Chernoff-Hoeffding bound.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods))
+                                         .setDefaultValueString("cp")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false,
+                                                   "The maximal distance between the estimated and the actual probability.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, false, "The probability with which the result is correct.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "The half-width of the region around the threshold of a probability bound in which the result may be wrong.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width of the indifference region.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true,
+                                                   "Sets the number of traces each thread samples before the stopping criterion is checked.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false, "Sets the seed for the random number generators.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, cacheSizeOptionName, true,
+                                                   "Sets the number of states each thread caches before the cache is flushed.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maximalNumberOfTracesOptionName, true,
+                                                   "If set, the sampling stops after the given number of traces (even if the result is not yet confident).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+SimulationSettings::EstimationMethod SimulationSettings::getEstimationMethod() const {
+    std::string methodAsString = this->getOption(estimationMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (methodAsString == "cp") {
+        return SimulationSettings::EstimationMethod::ClopperPearson;
+    } else if (methodAsString == "chernoff") {
+        return SimulationSettings::EstimationMethod::ChernoffHoeffding;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown estimation method '" << methodAsString << "'.");
+}
+
+double SimulationSettings::getPrecision() const {
+    return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SimulationSettings::getConfidence() const {
+    return this->getOption(confidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SimulationSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+uint64_t SimulationSettings::getBatchSize() const {
+    return this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SimulationSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t SimulationSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t SimulationSettings::getCacheSize() const {
+    return this->getOption(cacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SimulationSettings::isMaximalNumberOfTracesSet() const {
+    return this->getOption(maximalNumberOfTracesOptionName).getHasOptionBeenSet();
+}
+
+uint64_t SimulationSettings::getMaximalNumberOfTraces() const {
+    return this->getOption(maximalNumberOfTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SimulationSettings::check() const {
+    bool optionsSet = false;
+    for (auto const& optionName : {estimationMethodOptionName, precisionOptionName, confidenceOptionName, indifferenceOptionName, batchSizeOptionName,
+                                   seedOptionName, cacheSizeOptionName, maximalNumberOfTracesOptionName}) {
+        optionsSet |= this->getOption(optionName).getHasOptionBeenSet();
+    }
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Simulation || !optionsSet,
+                        "Simulation engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the simulation-based (statistical) model checking engine.
+ */
+class SimulationSettings : public ModuleSettings {
+   public:
+    // The available methods to estimate probabilities.
+    enum class EstimationMethod { ClopperPearson, ChernoffHoeffding };
+
+    /*!
+     * Creates a new set of simulation settings.
+     */
+    SimulationSettings();
+
+    /*!
+     * Retrieves the method used to estimate probabilities.
+     */
+    EstimationMethod getEstimationMethod() const;
+
+    /*!
+     * Retrieves the maximal distance between the estimated and the actual probability.
+     */
+    double getPrecision() const;
+
+    /*!
+     * Retrieves the probability with which the results are correct, i.e., the estimates are precise and the answers of
+     * hypothesis tests are correct.
+     */
+    double getConfidence() const;
+
+    /*!
+     * Retrieves the half-width of the indifference region around the threshold of hypothesis tests.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the number of traces that each thread samples before the stopping criterion is checked.
+     */
+    uint64_t getBatchSize() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators was set.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the number of states that each thread caches before the cache is flushed.
+     */
+    uint64_t getCacheSize() const;
+
+    /*!
+     * Retrieves whether the number of traces is limited.
+     */
+    bool isMaximalNumberOfTracesSet() const;
+
+    /*!
+     * Retrieves the maximal number of traces.
+     */
+    uint64_t getMaximalNumberOfTraces() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string estimationMethodOptionName;
+    static const std::string precisionOptionName;
+    static const std::string confidenceOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string seedOptionName;
+    static const std::string cacheSizeOptionName;
+    static const std::string maximalNumberOfTracesOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -14,6 +14,7 @@ namespace modules {
 const std::string SylvanSettings::moduleName = "sylvan";
 const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
 const std::string SylvanSettings::threadCountOptionName = "threads";
+const std::string SylvanSettings::parallelTasksOptionName = "paralleltasks";
 
 SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.")
@@ -22,12 +23,18 @@ SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(4096)
                                          .build())
                         .build());
-    this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.")
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true,
+                                                   "Sets the number of threads used by Sylvan. If not given, the value of --threads is used (if set).")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
                                          "value", "The number of threads available to Sylvan (0 means 'auto-detect').")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelTasksOptionName, true,
+                                                   "Sets whether independent parts of symbolic computations (for example the translation of the commands and "
+                                                   "edges in the symbolic model builders) are executed as concurrent tasks on the Sylvan threads.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -38,6 +45,10 @@ bool SylvanSettings::isNumberOfThreadsSet() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
 }
 
+bool SylvanSettings::isParallelTasksSet() const {
+    return this->getOption(parallelTasksOptionName).getHasOptionBeenSet();
+}
+
 uint_fast64_t SylvanSettings::getNumberOfThreads() const {
     return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
 }
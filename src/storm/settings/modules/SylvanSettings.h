@@ -26,7 +26,8 @@ class SylvanSettings : public ModuleSettings {
 
     /*!
      * Retrieves the amount of threads available to Sylvan. Note that a value of zero means that the number
-     * of threads is auto-detected to fit the current machine.
+     * of threads is auto-detected to fit the current machine. If this is not set, the general number of threads
+     * is used (if set).
      *
      * @rreturn The number of threads.
      */
@@ -37,6 +38,12 @@ class SylvanSettings : public ModuleSettings {
      */
     bool isNumberOfThreadsSet() const;
 
+    /*!
+     * Retrieves whether independent parts of symbolic computations (such as the translation of the commands or
+     * edges of a model) are to be executed as concurrent tasks.
+     */
+    bool isParallelTasksSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -44,6 +51,7 @@ class SylvanSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string maximalMemoryOptionName;
     static const std::string threadCountOptionName;
+    static const std::string parallelTasksOptionName;
 };
 
 }  // namespace modules
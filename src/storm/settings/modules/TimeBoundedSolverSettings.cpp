@@ -13,9 +13,11 @@ namespace modules {
 const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
 
 const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::stepBoundedEarlyTerminationOptionName = "stepbounded-early";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -27,6 +29,17 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                                          .build())
                         .build());
 
+    std::vector<std::string> ctmcMethods = {"uniformization", "adaptive-uniformization", "krylov"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false,
+                                                   "The method to use to compute transient probabilities of CTMCs. Adaptive uniformization only applies to "
+                                                   "transient distributions, Krylov is suited for stiff models whose rates span several orders of magnitude.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                                         .setDefaultValueString("uniformization")
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
@@ -48,6 +61,12 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, stepBoundedEarlyTerminationOptionName, false,
+                                                   "Stops step-bounded reachability computations once the result is known up to the precision. This "
+                                                   "additionally iterates an upper bound, which doubles the cost per step.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -70,6 +89,16 @@ storm::solver::MaBoundedReachabilityMethod TimeBoundedSolverSettings::getMaMetho
     return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "adaptive-uniformization") {
+        return storm::solver::CtmcTransientMethod::AdaptiveUniformization;
+    } else if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
 bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
     return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
@@ -79,6 +108,10 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+bool TimeBoundedSolverSettings::isStepBoundedEarlyTerminationSet() const {
+    return this->getOption(stepBoundedEarlyTerminationOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -26,6 +26,11 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities of CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
     /*!
      * Retrieves whether the precision has been set.
      *
@@ -50,14 +55,21 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves whether step-bounded computations are to be stopped once their result is known up to the precision.
+     */
+    bool isStepBoundedEarlyTerminationSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string maMethodOptionName;
+    static const std::string ctmcMethodOptionName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string stepBoundedEarlyTerminationOptionName;
 };
 
 }  // namespace modules
@@ -60,6 +60,16 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
 
+    /*!
+     * Retrieves the number of threads used to solve SCCs concurrently (where 0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves the number of states up to which consecutive SCCs are solved as one task.
+     */
+    uint64_t getBatchSize() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -69,6 +79,8 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
+    static const std::string threadsOptionName;
+    static const std::string batchSizeOptionName;
 };
 
 }  // namespace modules
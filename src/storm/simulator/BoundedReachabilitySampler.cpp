@@ -0,0 +1,147 @@
+#include "storm/simulator/BoundedReachabilitySampler.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace simulator {
+
+template<typename ValueType>
+BoundedReachabilitySampler<ValueType>::BoundedReachabilitySampler(storm::prism::Program const& program,
+                                                                  storm::expressions::Expression const& conditionExpression,
+                                                                  storm::expressions::Expression const& targetExpression, uint64_t stepBound,
+                                                                  uint64_t maximalNumberOfCachedStates, uint64_t seed)
+    : conditionExpression(conditionExpression),
+      targetExpression(targetExpression),
+      stepBound(stepBound),
+      maximalNumberOfCachedStates(maximalNumberOfCachedStates),
+      stateGenerator(program),
+      generator(seed),
+      initialState(0) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC, storm::exceptions::NotSupportedException,
+                    "Sampling traces is only supported for discrete-time Markov chains.");
+    stateToIdCallback = [this](generator::CompressedState const& state) { return getOrAddStateIndex(state); };
+    flush();
+}
+
+template<typename ValueType>
+uint64_t BoundedReachabilitySampler<ValueType>::sampleBatch(uint64_t numberOfTraces) {
+    uint64_t numberOfSatisfyingTraces = 0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        if (stateKinds.size() > maximalNumberOfCachedStates) {
+            flush();
+        }
+        if (sampleTrace()) {
+            ++numberOfSatisfyingTraces;
+        }
+    }
+    return numberOfSatisfyingTraces;
+}
+
+template<typename ValueType>
+bool BoundedReachabilitySampler<ValueType>::sampleTrace() {
+    uint32_t state = initialState;
+    for (uint64_t step = 0;; ++step) {
+        if (stateKinds[state] == StateKind::Unexpanded) {
+            expand(state);
+        }
+        StateKind kind = stateKinds[state];
+        if (kind == StateKind::Target) {
+            return true;
+        } else if (kind == StateKind::Rejecting || step == stepBound) {
+            return false;
+        }
+
+        uint64_t first = firstSuccessor[state];
+        uint64_t last = lastSuccessor[state];
+        if (last - first == 1) {
+            state = successors[first];
+        } else {
+            auto cumulativeProbabilitiesBegin = cumulativeProbabilities.begin();
+            auto it = std::upper_bound(cumulativeProbabilitiesBegin + first, cumulativeProbabilitiesBegin + last, generator.random());
+            STORM_LOG_ASSERT(it != cumulativeProbabilitiesBegin + last, "Sampled value exceeds the cumulative probabilities.");
+            state = successors[std::distance(cumulativeProbabilitiesBegin, it)];
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t BoundedReachabilitySampler<ValueType>::getNumberOfCachedStates() const {
+    return stateKinds.size();
+}
+
+template<typename ValueType>
+void BoundedReachabilitySampler<ValueType>::expand(uint32_t state) {
+    // The compressed state is no longer needed once the state is expanded.
+    generator::CompressedState compressedState = std::move(unexpandedStates[state]);
+    unexpandedStates[state] = generator::CompressedState();
+
+    stateGenerator.load(compressedState);
+    if (stateGenerator.satisfies(targetExpression)) {
+        stateKinds[state] = StateKind::Target;
+        return;
+    } else if (!stateGenerator.satisfies(conditionExpression)) {
+        stateKinds[state] = StateKind::Rejecting;
+        return;
+    }
+
+    // Note that expanding the state may register new states, so references into the cache are invalidated.
+    storm::generator::StateBehavior<ValueType, uint32_t> behavior = stateGenerator.expand(stateToIdCallback);
+    STORM_LOG_THROW(behavior.getNumberOfChoices() <= 1, storm::exceptions::NotSupportedException,
+                    "Sampling traces is not supported for states with more than one choice.");
+    if (behavior.empty()) {
+        stateKinds[state] = StateKind::Rejecting;
+        return;
+    }
+
+    firstSuccessor[state] = successors.size();
+    double probabilitySum = 0.0;
+    for (auto const& entry : behavior.getChoices().front()) {
+        probabilitySum += storm::utility::convertNumber<double>(entry.second);
+        successors.push_back(entry.first);
+        cumulativeProbabilities.push_back(probabilitySum);
+    }
+    // Make sure that rounding errors do not let sampled values exceed the cumulative probabilities.
+    cumulativeProbabilities.back() = 1.0;
+    lastSuccessor[state] = successors.size();
+    stateKinds[state] = StateKind::Transient;
+}
+
+template<typename ValueType>
+uint32_t BoundedReachabilitySampler<ValueType>::getOrAddStateIndex(generator::CompressedState const& state) {
+    uint32_t newIndex = static_cast<uint32_t>(stateToId.size());
+
+    // Check, if the state was already registered.
+    std::pair<uint32_t, std::size_t> actualIndexBucketPair = stateToId.findOrAddAndGetBucket(state, newIndex);
+
+    uint32_t actualIndex = actualIndexBucketPair.first;
+    if (actualIndex == newIndex) {
+        unexpandedStates.push_back(state);
+        stateKinds.push_back(StateKind::Unexpanded);
+        firstSuccessor.push_back(0);
+        lastSuccessor.push_back(0);
+    }
+    return actualIndex;
+}
+
+template<typename ValueType>
+void BoundedReachabilitySampler<ValueType>::flush() {
+    stateToId = storm::storage::BitVectorHashMap<uint32_t>(stateGenerator.getStateSize());
+    unexpandedStates.clear();
+    stateKinds.clear();
+    firstSuccessor.clear();
+    lastSuccessor.clear();
+    successors.clear();
+    cumulativeProbabilities.clear();
+
+    std::vector<uint32_t> initialStates = stateGenerator.getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Program must have a unique initial state");
+    initialState = initialStates.front();
+}
+
+template class BoundedReachabilitySampler<double>;
+}  // namespace simulator
+}  // namespace storm
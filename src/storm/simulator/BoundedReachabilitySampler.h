@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class samples traces of a discrete-time prism program and checks whether they satisfy a step-bounded until
+ * property 'condition U<=k target'. It is meant for statistical model checking, where (many) millions of traces are
+ * sampled. In contrast to the DiscreteTimePrismProgramSimulator, states are expanded only once: their successor
+ * distributions are cached in flat arrays such that sampling a step amounts to drawing a random number and a binary
+ * search, without calls to the next state generator or allocations.
+ *
+ * The cache is flushed (between traces) as soon as it contains more than the given number of states, which bounds the
+ * memory consumption for models that are too large to be built.
+ *
+ * @tparam ValueType
+ */
+template<typename ValueType>
+class BoundedReachabilitySampler {
+   public:
+    /**
+     * Initialize the sampler for a given prism program.
+     *
+     * @param program The prism program. Must be a DTMC with a unique initial state.
+     * @param conditionExpression The expression describing the condition states.
+     * @param targetExpression The expression describing the target states.
+     * @param stepBound The maximal number of steps of a trace.
+     * @param maximalNumberOfCachedStates The number of states above which the cache is flushed.
+     * @param seed The seed for the random number generator.
+     */
+    BoundedReachabilitySampler(storm::prism::Program const& program, storm::expressions::Expression const& conditionExpression,
+                               storm::expressions::Expression const& targetExpression, uint64_t stepBound, uint64_t maximalNumberOfCachedStates,
+                               uint64_t seed);
+
+    /**
+     * Samples the given number of traces.
+     *
+     * @return The number of traces that satisfy the property.
+     */
+    uint64_t sampleBatch(uint64_t numberOfTraces);
+
+    /**
+     * Samples a single trace.
+     *
+     * @return true, if the trace satisfies the property.
+     */
+    bool sampleTrace();
+
+    /**
+     * The number of states that are currently cached.
+     */
+    uint64_t getNumberOfCachedStates() const;
+
+   private:
+    enum class StateKind : uint8_t { Unexpanded, Target, Rejecting, Transient };
+
+    /**
+     * Expands the given (cached) state, i.e., determines its kind and, if needed, its successor distribution.
+     */
+    void expand(uint32_t state);
+
+    /**
+     * Helper function for registering states with the cache.
+     */
+    uint32_t getOrAddStateIndex(generator::CompressedState const& state);
+
+    /**
+     * Clears the cache and re-registers the initial state.
+     */
+    void flush();
+
+    /// The expressions that describe the condition and target states.
+    storm::expressions::Expression conditionExpression;
+    storm::expressions::Expression targetExpression;
+    uint64_t stepBound;
+    uint64_t maximalNumberOfCachedStates;
+
+    /// Generator for the next states
+    storm::generator::PrismNextStateGenerator<ValueType, uint32_t> stateGenerator;
+    std::function<uint32_t(generator::CompressedState const&)> stateToIdCallback;
+    /// Random number generator
+    storm::utility::RandomProbabilityGenerator<double> generator;
+
+    /// The cached states. The compressed states are only kept until the state is expanded.
+    storm::storage::BitVectorHashMap<uint32_t> stateToId;
+    std::vector<generator::CompressedState> unexpandedStates;
+    std::vector<StateKind> stateKinds;
+    uint32_t initialState;
+
+    /// The successor distributions of the expanded transient states. As states are expanded in the order in which traces visit
+    /// them, the successors of state s are stored at the positions firstSuccessor[s], ..., lastSuccessor[s] - 1 together
+    /// with their cumulative probabilities.
+    std::vector<uint64_t> firstSuccessor;
+    std::vector<uint64_t> lastSuccessor;
+    std::vector<uint32_t> successors;
+    std::vector<double> cumulativeProbabilities;
+};
+}  // namespace simulator
+}  // namespace storm
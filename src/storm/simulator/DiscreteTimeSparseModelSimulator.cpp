@@ -1,12 +1,26 @@
 #include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/constants.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace storm {
 namespace simulator {
+
+namespace {
+// Rows with fewer entries are sampled by a linear scan, which is faster than a lookup in an alias table for such rows.
+uint64_t const minimalRowSizeForAliasTable = 8;
+uint64_t const noAliasTable = std::numeric_limits<uint64_t>::max();
+}  // namespace
+
 template<typename ValueType, typename RewardModelType>
 DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::DiscreteTimeSparseModelSimulator(
     storm::models::sparse::Model<ValueType, RewardModelType> const& model)
-    : model(model), currentState(*model.getInitialStates().begin()), zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()) {
+    : model(model),
+      currentState(*model.getInitialStates().begin()),
+      zeroRewards(model.getNumberOfRewardModels(), storm::utility::zero<ValueType>()),
+      aliasTableStarts(model.getTransitionMatrix().getRowCount(), noAliasTable) {
     STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
                         "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
     lastRewards = zeroRewards;
@@ -35,10 +49,7 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep()
 
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t action) {
-    // TODO lots of optimization potential.
-    //  E.g., do not sample random numbers if there is only a single transition
     lastRewards = zeroRewards;
-    ValueType probability = generator.random();
     STORM_LOG_ASSERT(action < model.getTransitionMatrix().getRowGroupSize(currentState), "Action index higher than number of actions");
     uint64_t row = model.getTransitionMatrix().getRowGroupIndices()[currentState] + action;
     uint64_t i = 0;
@@ -48,23 +59,162 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t
         }
         ++i;
     }
-    ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
-        sum += entry.getValue();
-        if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
+    if (model.getTransitionMatrix().getRow(row).getNumberOfEntries() == 0) {
+        // This position should never be reached
+        return false;
+    }
+    // Only sample a random number if there is a choice between several transitions.
+    if (model.getTransitionMatrix().getRow(row).getNumberOfEntries() == 1) {
+        currentState = model.getTransitionMatrix().getRow(row).begin()->getColumn();
+    } else {
+        currentState = sampleSuccessor(row, generator.random());
+    }
+    i = 0;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (rewModPair.second.hasStateRewards()) {
+            lastRewards[i] += rewModPair.second.getStateReward(currentState);
+        }
+        ++i;
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::sampleSuccessor(uint64_t row, ValueType const& probability) {
+    auto const& rowEntries = model.getTransitionMatrix().getRow(row);
+    uint64_t rowSize = rowEntries.getNumberOfEntries();
+    if (rowSize < minimalRowSizeForAliasTable) {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (auto const& entry : rowEntries) {
+            sum += entry.getValue();
+            if (sum >= probability) {
+                return entry.getColumn();
             }
-            return true;
+        }
+        // Due to rounding, the probabilities might not sum up to one.
+        return (rowEntries.end() - 1)->getColumn();
+    }
+
+    uint64_t tableStart = aliasTableStarts[row];
+    if (tableStart == noAliasTable) {
+        tableStart = buildAliasTable(row);
+    }
+    // The integral part of the scaled probability selects the entry of the table and the residual is compared with its threshold.
+    ValueType scaledProbability = probability * storm::utility::convertNumber<ValueType>(rowSize);
+    uint64_t index = std::min(storm::utility::convertNumber<uint64_t>(storm::utility::floor(scaledProbability)), rowSize - 1);
+    AliasTableEntry const& tableEntry = aliasTableEntries[tableStart + index];
+    if (scaledProbability - storm::utility::convertNumber<ValueType>(index) < tableEntry.threshold) {
+        return tableEntry.state;
+    } else {
+        return tableEntry.alias;
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::buildAliasTable(uint64_t row) {
+    auto const& rowEntries = model.getTransitionMatrix().getRow(row);
+    uint64_t rowSize = rowEntries.getNumberOfEntries();
+    uint64_t tableStart = aliasTableEntries.size();
+    aliasTableStarts[row] = tableStart;
+
+    // Scale the probabilities such that their average is one and split the entries into the ones below and above the average.
+    std::vector<ValueType> scaledProbabilities;
+    scaledProbabilities.reserve(rowSize);
+    std::vector<uint64_t> small, large;
+    for (auto const& entry : rowEntries) {
+        aliasTableEntries.push_back({storm::utility::one<ValueType>(), entry.getColumn(), entry.getColumn()});
+        scaledProbabilities.push_back(entry.getValue() * storm::utility::convertNumber<ValueType>(rowSize));
+        if (scaledProbabilities.back() < storm::utility::one<ValueType>()) {
+            small.push_back(scaledProbabilities.size() - 1);
+        } else {
+            large.push_back(scaledProbabilities.size() - 1);
         }
     }
-    // This position should never be reached
-    return false;
+
+    // Fill up each entry below the average with the probability of an entry above the average.
+    // Entries that remain in one of the lists (due to rounding) keep the threshold one, i.e., they never refer to their alias.
+    while (!small.empty() && !large.empty()) {
+        uint64_t smallIndex = small.back();
+        uint64_t largeIndex = large.back();
+        small.pop_back();
+        aliasTableEntries[tableStart + smallIndex].threshold = scaledProbabilities[smallIndex];
+        aliasTableEntries[tableStart + smallIndex].alias = aliasTableEntries[tableStart + largeIndex].state;
+        scaledProbabilities[largeIndex] = (scaledProbabilities[largeIndex] + scaledProbabilities[smallIndex]) - storm::utility::one<ValueType>();
+        if (scaledProbabilities[largeIndex] < storm::utility::one<ValueType>()) {
+            large.pop_back();
+            small.push_back(largeIndex);
+        }
+    }
+    return tableStart;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::initializeBatch(uint64_t numberOfTraces) {
+    uint64_t initialState = *model.getInitialStates().begin();
+    batchStates.assign(numberOfTraces, initialState);
+    batchRewards.assign(numberOfTraces * model.getNumberOfRewardModels(), storm::utility::zero<ValueType>());
+    batchRandomNumbers.resize(numberOfTraces);
+    uint64_t i = 0;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (rewModPair.second.hasStateRewards()) {
+            std::fill(batchRewards.begin() + i * numberOfTraces, batchRewards.begin() + (i + 1) * numberOfTraces,
+                      rewModPair.second.getStateReward(initialState));
+        }
+        ++i;
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStepBatch() {
+    auto const& matrix = model.getTransitionMatrix();
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    uint64_t numberOfTraces = batchStates.size();
+
+    // Draw the random numbers for all traces at once, which keeps the generator state hot.
+    for (auto& randomNumber : batchRandomNumbers) {
+        randomNumber = generator.random();
+    }
+
+    uint64_t numberOfSteps = 0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        uint64_t state = batchStates[trace];
+        uint64_t numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+        if (numberOfChoices == 0) {
+            continue;
+        }
+        uint64_t row = rowGroupIndices[state];
+        if (numberOfChoices > 1) {
+            row += generator.random_uint(0, numberOfChoices - 1);
+        }
+        uint64_t rowSize = matrix.getRow(row).getNumberOfEntries();
+        if (rowSize == 0) {
+            continue;
+        }
+        batchStates[trace] = rowSize == 1 ? matrix.getRow(row).begin()->getColumn() : sampleSuccessor(row, batchRandomNumbers[trace]);
+        ++numberOfSteps;
+
+        uint64_t i = 0;
+        for (auto const& rewModPair : model.getRewardModels()) {
+            if (rewModPair.second.hasStateActionRewards()) {
+                batchRewards[i * numberOfTraces + trace] += rewModPair.second.getStateActionReward(row);
+            }
+            if (rewModPair.second.hasStateRewards()) {
+                batchRewards[i * numberOfTraces + trace] += rewModPair.second.getStateReward(batchStates[trace]);
+            }
+            ++i;
+        }
+    }
+    return numberOfSteps;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<uint64_t> const& DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getBatchStates() const {
+    return batchStates;
+}
+
+template<typename ValueType, typename RewardModelType>
+std::vector<ValueType> const& DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::getBatchRewards() const {
+    return batchRewards;
 }
 
 template<typename ValueType, typename RewardModelType>
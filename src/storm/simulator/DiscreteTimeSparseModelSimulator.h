@@ -10,6 +10,9 @@ namespace simulator {
  * stored explicitly as a SparseModel.
  * Additional information about state, actions, should be obtained via the model itself.
  *
+ * Successors in rows with many entries are sampled via alias tables (Walker's method), which are built on the first visit of the row.
+ * Besides a single trace, a batch of traces can be advanced in lock step (see initializeBatch and randomStepBatch).
+ *
  * TODO: It may be nice to write a CPP wrapper that does not require to actually obtain such informations yourself.
  * @tparam ModelType
  */
@@ -24,12 +27,63 @@ class DiscreteTimeSparseModelSimulator {
     uint64_t getCurrentState() const;
     bool resetToInitial();
 
+    /*!
+     * Starts a batch of traces which all start in the initial state. The single trace (see step) is not affected.
+     *
+     * @param numberOfTraces The number of traces in the batch.
+     */
+    void initializeBatch(uint64_t numberOfTraces);
+
+    /*!
+     * Advances every trace of the batch by one step, where the action is chosen uniformly (like in randomStep).
+     * Traces in states without choices remain in their state.
+     *
+     * @return The number of traces that performed a step.
+     */
+    uint64_t randomStepBatch();
+
+    /*!
+     * Retrieves the current states of the traces of the batch.
+     */
+    std::vector<uint64_t> const& getBatchStates() const;
+
+    /*!
+     * Retrieves the rewards that the traces of the batch collected since the batch was initialized (including the rewards of the initial state).
+     * The reward of the trace with index t for the reward model with index r is at position r * numberOfTraces + t.
+     */
+    std::vector<ValueType> const& getBatchRewards() const;
+
    protected:
+    /*!
+     * Samples a successor of the given row, where the given probability is drawn uniformly from the unit interval.
+     */
+    uint64_t sampleSuccessor(uint64_t row, ValueType const& probability);
+
+    /*!
+     * Builds the alias table of the given row and returns the index of its first entry.
+     */
+    uint64_t buildAliasTable(uint64_t row);
+
+    struct AliasTableEntry {
+        ValueType threshold;
+        uint64_t state;  // the successor that is taken if the residual probability is below the threshold
+        uint64_t alias;  // the successor that is taken otherwise
+    };
+
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
     uint64_t currentState;
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+
+    // For every row, the index of the first entry of its alias table (if it has been built).
+    std::vector<uint64_t> aliasTableStarts;
+    std::vector<AliasTableEntry> aliasTableEntries;
+
+    // The state of the batch of traces.
+    std::vector<uint64_t> batchStates;
+    std::vector<ValueType> batchRewards;
+    std::vector<ValueType> batchRandomNumbers;
 };
 }  // namespace simulator
-}  // namespace storm
\ No newline at end of file
+}  // namespace storm
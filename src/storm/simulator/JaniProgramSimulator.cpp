@@ -0,0 +1,79 @@
+#include "storm/simulator/JaniProgramSimulator.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+using namespace storm::generator;
+
+namespace storm {
+namespace simulator {
+
+template<typename ValueType>
+DiscreteTimeJaniProgramSimulator<ValueType>::DiscreteTimeJaniProgramSimulator(storm::jani::Model const& model,
+                                                                              storm::generator::NextStateGeneratorOptions const& options)
+    : model(model), stateGenerator(model, options) {
+    STORM_LOG_THROW(stateGenerator.isDiscreteTimeModel(), storm::exceptions::NotSupportedException, "Only discrete-time models can be simulated.");
+    resetToInitial();
+}
+
+template<typename ValueType>
+void DiscreteTimeJaniProgramSimulator<ValueType>::setSeed(uint64_t newSeed) {
+    generator = storm::utility::RandomProbabilityGenerator<double>(newSeed);
+}
+
+template<typename ValueType>
+bool DiscreteTimeJaniProgramSimulator<ValueType>::step() {
+    if (!stateGenerator.sampleSuccessor(generator, successorState)) {
+        return false;
+    }
+    // Swapping keeps the buffers of both states.
+    std::swap(currentState, successorState);
+    stateGenerator.load(currentState);
+    return true;
+}
+
+template<typename ValueType>
+bool DiscreteTimeJaniProgramSimulator<ValueType>::satisfies(storm::expressions::Expression const& expression) const {
+    return stateGenerator.satisfies(expression);
+}
+
+template<typename ValueType>
+CompressedState const& DiscreteTimeJaniProgramSimulator<ValueType>::getCurrentState() const {
+    return currentState;
+}
+
+template<typename ValueType>
+expressions::SimpleValuation DiscreteTimeJaniProgramSimulator<ValueType>::getCurrentStateAsValuation() const {
+    return unpackStateIntoValuation(currentState, stateGenerator.getVariableInformation(), model.getManager());
+}
+
+template<typename ValueType>
+std::string DiscreteTimeJaniProgramSimulator<ValueType>::getCurrentStateString() const {
+    return stateGenerator.stateToString(currentState);
+}
+
+template<typename ValueType>
+bool DiscreteTimeJaniProgramSimulator<ValueType>::resetToInitial() {
+    std::vector<CompressedState> initialStates;
+    stateGenerator.getInitialStates([&initialStates](CompressedState const& state) {
+        initialStates.push_back(state);
+        return static_cast<uint32_t>(initialStates.size() - 1);
+    });
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Model must have a unique initial state");
+    return resetToState(initialStates.front());
+}
+
+template<typename ValueType>
+bool DiscreteTimeJaniProgramSimulator<ValueType>::resetToState(generator::CompressedState const& newState) {
+    currentState = newState;
+    successorState = newState;
+    stateGenerator.load(currentState);
+    return true;
+}
+
+template<typename ValueType>
+bool DiscreteTimeJaniProgramSimulator<ValueType>::resetToState(expressions::SimpleValuation const& valuation) {
+    return resetToState(generator::packStateFromValuation(valuation, stateGenerator.getVariableInformation(), true));
+}
+
+template class DiscreteTimeJaniProgramSimulator<double>;
+}  // namespace simulator
+}  // namespace storm
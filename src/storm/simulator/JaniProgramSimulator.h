@@ -0,0 +1,75 @@
+#pragma once
+
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/storage/expressions/SimpleValuation.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class simulates a discrete-time jani model without building its state space. In contrast to the
+ * DiscreteTimePrismProgramSimulator, a step does not expand the current state: only the guards of the edges and the
+ * destinations of the sampled edge(s) are evaluated (see JaniNextStateGenerator::sampleSuccessor). Expressions are
+ * compiled once by the evaluator of the next state generator and all buffers are reused, such that taking a step
+ * does not allocate memory. This makes it suitable as the inner loop of statistical model checking.
+ *
+ * Nondeterminism (if any) is resolved uniformly at random and rewards are not tracked.
+ *
+ * @tparam ValueType
+ */
+template<typename ValueType>
+class DiscreteTimeJaniProgramSimulator {
+   public:
+    /**
+     * Initialize the simulator for a given jani model.
+     *
+     * @param model The jani model. Should be discrete-time and have a unique initial state.
+     * @param options The generator options that are used to generate successor states.
+     */
+    DiscreteTimeJaniProgramSimulator(storm::jani::Model const& model, storm::generator::NextStateGeneratorOptions const& options);
+
+    /**
+     * Set the simulation seed.
+     */
+    void setSeed(uint64_t);
+
+    /**
+     * Make a step and randomly select the successor.
+     *
+     * @return true, if the current state has a successor. Otherwise, the current state is not changed.
+     */
+    bool step();
+
+    /**
+     * Checks whether the given expression (over the non-transient variables) holds in the current state.
+     */
+    bool satisfies(storm::expressions::Expression const& expression) const;
+
+    generator::CompressedState const& getCurrentState() const;
+    expressions::SimpleValuation getCurrentStateAsValuation() const;
+    std::string getCurrentStateString() const;
+
+    /**
+     * Reset to the (unique) initial state.
+     */
+    bool resetToInitial();
+
+    bool resetToState(generator::CompressedState const& compressedState);
+
+    bool resetToState(expressions::SimpleValuation const& valuationState);
+
+   protected:
+    /// The model that we are simulating.
+    storm::jani::Model const& model;
+    /// Generator for the next states
+    storm::generator::JaniNextStateGenerator<ValueType, uint32_t> stateGenerator;
+    /// The current state and a buffer for its successor, in their compressed form.
+    generator::CompressedState currentState;
+    generator::CompressedState successorState;
+    /// Random number generator
+    storm::utility::RandomProbabilityGenerator<double> generator;
+};
+}  // namespace simulator
+}  // namespace storm
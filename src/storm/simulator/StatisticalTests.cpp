@@ -0,0 +1,82 @@
+#include "storm/simulator/StatisticalTests.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace simulator {
+
+SequentialProbabilityRatioTest::SequentialProbabilityRatioTest(double threshold, double indifference, double alpha, double beta)
+    : logLikelihoodRatio(0.0), numberOfSamples(0), numberOfSuccesses(0) {
+    STORM_LOG_THROW(indifference > 0.0, storm::exceptions::InvalidArgumentException, "The indifference region must not be empty.");
+    STORM_LOG_THROW(alpha > 0.0 && alpha < 1.0 && beta > 0.0 && beta < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The error probabilities must be in (0,1).");
+    double aboveProbability = std::min(threshold + indifference, 1.0);
+    double belowProbability = std::max(threshold - indifference, 0.0);
+
+    // The log-likelihood ratio (of the hypothesis 'below' over 'above') is changed by these values for every success and
+    // failure, respectively. Note that they may be infinite if the indifference region touches zero or one.
+    logSuccessRatio = std::log(belowProbability) - std::log(aboveProbability);
+    logFailureRatio = std::log(1.0 - belowProbability) - std::log(1.0 - aboveProbability);
+    logBelowBound = std::log((1.0 - beta) / alpha);
+    logAboveBound = std::log(beta / (1.0 - alpha));
+}
+
+void SequentialProbabilityRatioTest::addSamples(uint64_t newSamples, uint64_t newSuccesses) {
+    STORM_LOG_ASSERT(newSuccesses <= newSamples, "More successes than samples.");
+    // Only add the terms for non-zero counts to avoid multiplying zero with an infinite ratio.
+    if (newSuccesses > 0) {
+        logLikelihoodRatio += newSuccesses * logSuccessRatio;
+    }
+    if (newSamples > newSuccesses) {
+        logLikelihoodRatio += (newSamples - newSuccesses) * logFailureRatio;
+    }
+    numberOfSamples += newSamples;
+    numberOfSuccesses += newSuccesses;
+}
+
+SequentialProbabilityRatioTest::Decision SequentialProbabilityRatioTest::getDecision() const {
+    if (std::isnan(logLikelihoodRatio)) {
+        // Both a success and a failure were observed although one of them is impossible under both hypotheses. This can only
+        // happen if the probability is exactly zero or one, which is excluded by the indifference region.
+        return Decision::Undecided;
+    } else if (logLikelihoodRatio >= logBelowBound) {
+        return Decision::BelowThreshold;
+    } else if (logLikelihoodRatio <= logAboveBound) {
+        return Decision::AboveThreshold;
+    }
+    return Decision::Undecided;
+}
+
+uint64_t SequentialProbabilityRatioTest::getNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+uint64_t SequentialProbabilityRatioTest::getNumberOfSuccesses() const {
+    return numberOfSuccesses;
+}
+
+uint64_t getChernoffHoeffdingNumberOfSamples(double epsilon, double alpha) {
+    STORM_LOG_THROW(epsilon > 0.0 && alpha > 0.0, storm::exceptions::InvalidArgumentException, "The precision and error probability must be positive.");
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / alpha) / (2.0 * epsilon * epsilon)));
+}
+
+std::pair<double, double> getClopperPearsonInterval(uint64_t numberOfSamples, uint64_t numberOfSuccesses, double alpha) {
+    STORM_LOG_ASSERT(numberOfSuccesses <= numberOfSamples, "More successes than samples.");
+    if (numberOfSamples == 0) {
+        return std::make_pair(0.0, 1.0);
+    }
+    double successes = static_cast<double>(numberOfSuccesses);
+    double failures = static_cast<double>(numberOfSamples - numberOfSuccesses);
+    double lower = numberOfSuccesses == 0 ? 0.0 : boost::math::ibeta_inv(successes, failures + 1.0, alpha / 2.0);
+    double upper = numberOfSuccesses == numberOfSamples ? 1.0 : boost::math::ibeta_inv(successes + 1.0, failures, 1.0 - alpha / 2.0);
+    return std::make_pair(lower, upper);
+}
+
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace storm {
+namespace simulator {
+
+/**
+ * Wald's sequential probability ratio test, which decides whether the (unknown) success probability p of a Bernoulli
+ * experiment lies above or below a given threshold t. For this, it tests the hypothesis p >= t + d against p <= t - d,
+ * where d is the half-width of the indifference region. If p does not lie within the indifference region, the probability
+ * of wrongly deciding for p < t (p > t) is at most alpha (beta).
+ */
+class SequentialProbabilityRatioTest {
+   public:
+    enum class Decision { Undecided, AboveThreshold, BelowThreshold };
+
+    /**
+     * @param threshold The threshold t.
+     * @param indifference The half-width d of the indifference region.
+     * @param alpha The probability of wrongly deciding that the probability is below the threshold.
+     * @param beta The probability of wrongly deciding that the probability is above the threshold.
+     */
+    SequentialProbabilityRatioTest(double threshold, double indifference, double alpha, double beta);
+
+    /**
+     * Adds the outcomes of the given number of experiments, of which the given number succeeded.
+     */
+    void addSamples(uint64_t numberOfSamples, uint64_t numberOfSuccesses);
+
+    /**
+     * Retrieves the decision based on the samples seen so far.
+     */
+    Decision getDecision() const;
+
+    uint64_t getNumberOfSamples() const;
+    uint64_t getNumberOfSuccesses() const;
+
+   private:
+    double logSuccessRatio;
+    double logFailureRatio;
+    double logAboveBound;
+    double logBelowBound;
+    double logLikelihoodRatio;
+    uint64_t numberOfSamples;
+    uint64_t numberOfSuccesses;
+};
+
+/**
+ * Computes the number of samples needed such that the estimated success probability deviates from the actual one by
+ * at least epsilon with probability at most alpha (using the Chernoff-Hoeffding bound).
+ */
+uint64_t getChernoffHoeffdingNumberOfSamples(double epsilon, double alpha);
+
+/**
+ * Computes the (exact) Clopper-Pearson interval that contains the success probability with probability at least
+ * 1 - alpha, given the number of samples and successes.
+ */
+std::pair<double, double> getClopperPearsonInterval(uint64_t numberOfSamples, uint64_t numberOfSuccesses, double alpha);
+
+}  // namespace simulator
+}  // namespace storm
@@ -265,18 +265,14 @@ void AbstractEquationSolver<ValueType>::createUpperBoundsVector(std::vector<Valu
 }
 
 template<typename ValueType>
-void AbstractEquationSolver<ValueType>::createUpperBoundsVector(std::unique_ptr<std::vector<ValueType>>& upperBoundsVector, uint64_t length) const {
+void AbstractEquationSolver<ValueType>::createUpperBoundsVector(Environment const& env, WorkspaceVector<ValueType>& upperBoundsVector,
+                                                                 uint64_t length) const {
     STORM_LOG_ASSERT(this->hasUpperBound(), "Expecting upper bound(s).");
+    STORM_LOG_ASSERT(!this->hasUpperBound(BoundType::Local) || length == this->getUpperBounds().size(), "Mismatching sizes.");
     if (!upperBoundsVector) {
-        if (this->hasUpperBound(BoundType::Local)) {
-            STORM_LOG_ASSERT(length == this->getUpperBounds().size(), "Mismatching sizes.");
-            upperBoundsVector = std::make_unique<std::vector<ValueType>>(this->getUpperBounds());
-        } else {
-            upperBoundsVector = std::make_unique<std::vector<ValueType>>(length, this->getUpperBound());
-        }
-    } else {
-        createUpperBoundsVector(*upperBoundsVector);
+        upperBoundsVector = SolverWorkspace::acquireVector<ValueType>(env, length);
     }
+    createUpperBoundsVector(*upperBoundsVector);
 }
 
 template<typename ValueType>
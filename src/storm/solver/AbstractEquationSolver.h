@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/SolverWorkspace.h"
 #include "storm/solver/TerminationCondition.h"
 #include "storm/utility/ProgressMeasurement.h"
 
@@ -200,7 +201,7 @@ class AbstractEquationSolver {
     std::unique_ptr<TerminationCondition<ValueType>> const& getTerminationConditionPointer() const;
 
     void createUpperBoundsVector(std::vector<ValueType>& upperBoundsVector) const;
-    void createUpperBoundsVector(std::unique_ptr<std::vector<ValueType>>& upperBoundsVector, uint64_t length) const;
+    void createUpperBoundsVector(Environment const& env, WorkspaceVector<ValueType>& upperBoundsVector, uint64_t length) const;
     void createLowerBoundsVector(std::vector<ValueType>& lowerBoundsVector) const;
 
     /*!
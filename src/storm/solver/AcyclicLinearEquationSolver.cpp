@@ -2,6 +2,8 @@
 
 #include "storm/solver/helper/AcyclicSolverHelper.cpp"
 
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -51,9 +53,23 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
     STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
 
+    // Rational functions are not processed concurrently as their (cached) representation is not thread-safe.
+    uint64_t numberOfThreads = std::is_same<ValueType, storm::RationalFunction>::value
+                                   ? 1
+                                   : storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    if (numberOfThreads > 1 && multiplier && !levelStarts) {
+        // The cached ordering is not sorted by levels.
+        this->clearCache();
+    }
+
     if (!multiplier) {
         // We have not allocated cache memory, yet
-        rowOrdering = helper::computeTopologicalGroupOrdering(*this->A);
+        if (numberOfThreads > 1) {
+            levelStarts = std::vector<uint64_t>();
+            rowOrdering = helper::computeLevelGroupOrdering(*this->A, *levelStarts);
+        } else {
+            rowOrdering = helper::computeTopologicalGroupOrdering(*this->A);
+        }
         if (!rowOrdering) {
             // It is not required to reorder the elements.
             this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
@@ -79,7 +95,14 @@ bool AcyclicLinearEquationSolver<ValueType>::internalSolveEquations(Environment
         xPtr = &auxiliaryRowVector2.get();
     }
 
-    this->multiplier->multiplyGaussSeidel(env, *xPtr, bPtr, true);
+    if (numberOfThreads > 1) {
+        helper::solveLevelsParallel(rowOrdering ? *orderedMatrix : *this->A, *levelStarts, *xPtr, *bPtr, numberOfThreads);
+    } else {
+        // A single sweep only yields the solution if all rows are processed sequentially.
+        storm::Environment sequentialEnv = env;
+        sequentialEnv.solver().multiplier().setNumberOfGaussSeidelThreads(1);
+        this->multiplier->multiplyGaussSeidel(sequentialEnv, *xPtr, bPtr, true);
+    }
 
     if (rowOrdering) {
         for (uint64_t newRow = 0; newRow < x.size(); ++newRow) {
@@ -111,6 +134,7 @@ void AcyclicLinearEquationSolver<ValueType>::clearCache() const {
     multiplier.reset();
     orderedMatrix = boost::none;
     rowOrdering = boost::none;
+    levelStarts = boost::none;
     auxiliaryRowVector = boost::none;
     auxiliaryRowVector2 = boost::none;
     bFactors.clear();
@@ -13,6 +13,8 @@ namespace solver {
 /*!
  * This solver can be used on equation systems that are known to be acyclic.
  * It is optimized for solving many instances of the equation system with the same underlying matrix.
+ * If several Gauss-Seidel threads are set in the multiplier environment, the rows are sorted by levels (see helper::computeLevelGroupOrdering) and
+ * the rows of each level are processed in parallel.
  */
 template<typename ValueType>
 class AcyclicLinearEquationSolver : public LinearEquationSolver<ValueType> {
@@ -51,6 +53,8 @@ class AcyclicLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable boost::optional<storm::storage::SparseMatrix<ValueType>> orderedMatrix;
     // cached row group ordering (only if not identity)
     mutable boost::optional<std::vector<uint64_t>> rowOrdering;  // A.rowGroupCount() entries
+    // cached first rows of the levels (only if the rows are processed level by level in parallel)
+    mutable boost::optional<std::vector<uint64_t>> levelStarts;
     // can be used if the entries in 'b' need to be reordered
     mutable boost::optional<std::vector<ValueType>> auxiliaryRowVector;  // A.rowCount() entries
     // can be used if the entries in 'x' need to be reordered
@@ -2,6 +2,8 @@
 
 #include "storm/solver/helper/AcyclicSolverHelper.cpp"
 
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -30,9 +32,20 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
     STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
     STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
 
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    if (numberOfThreads > 1 && multiplier && !levelStarts) {
+        // The cached ordering is not sorted by levels.
+        this->clearCache();
+    }
+
     if (!multiplier) {
         // We have not allocated cache memory, yet
-        rowGroupOrdering = helper::computeTopologicalGroupOrdering(*this->A);
+        if (numberOfThreads > 1) {
+            levelStarts = std::vector<uint64_t>();
+            rowGroupOrdering = helper::computeLevelGroupOrdering(*this->A, *levelStarts);
+        } else {
+            rowGroupOrdering = helper::computeTopologicalGroupOrdering(*this->A);
+        }
         if (!rowGroupOrdering) {
             // It is not required to reorder the elements.
             this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
@@ -86,8 +99,16 @@ bool AcyclicMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Enviro
         }
     }
 
-    // Since a topological ordering is guaranteed, we can solve the equations with a single matrix-vector Multiplication step.
-    this->multiplier->multiplyAndReduceGaussSeidel(env, dir, *xPtr, bPtr, choicesPtr, true);
+    if (numberOfThreads > 1) {
+        // The row groups of each level only depend on the levels behind it.
+        helper::solveLevelsParallel(rowGroupOrdering ? *orderedMatrix : *this->A, *levelStarts, dir, *xPtr, *bPtr, choicesPtr, numberOfThreads);
+    } else {
+        // Since a topological ordering is guaranteed, we can solve the equations with a single matrix-vector Multiplication step.
+        // This requires that all row groups are processed sequentially.
+        storm::Environment sequentialEnv = env;
+        sequentialEnv.solver().multiplier().setNumberOfGaussSeidelThreads(1);
+        this->multiplier->multiplyAndReduceGaussSeidel(sequentialEnv, dir, *xPtr, bPtr, choicesPtr, true);
+    }
 
     if (rowGroupOrdering) {
         // Restore the correct input-order for the output vector
@@ -122,6 +143,7 @@ void AcyclicMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     multiplier.reset();
     orderedMatrix = boost::none;
     rowGroupOrdering = boost::none;
+    levelStarts = boost::none;
     auxiliaryRowVector = boost::none;
     auxiliaryRowGroupVector = boost::none;
     auxiliaryRowGroupIndexVector = boost::none;
@@ -14,6 +14,8 @@ namespace solver {
 /*!
  * This solver can be used on equation systems that are known to be acyclic.
  * It is optimized for solving many instances of the equation system with the same underlying matrix.
+ * If several Gauss-Seidel threads are set in the multiplier environment, the row groups of each level (see helper::computeLevelGroupOrdering) are
+ * processed in parallel.
  */
 template<typename ValueType>
 class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType> {
@@ -41,6 +43,8 @@ class AcyclicMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSol
     mutable boost::optional<storm::storage::SparseMatrix<ValueType>> orderedMatrix;
     // cached row group ordering (only if not identity)
     mutable boost::optional<std::vector<uint64_t>> rowGroupOrdering;  // A.rowGroupCount() entries
+    // cached first row groups of the levels (only if the row groups are processed level by level in parallel)
+    mutable boost::optional<std::vector<uint64_t>> levelStarts;
     // can be used if the entries in 'b' need to be reordered
     mutable boost::optional<std::vector<ValueType>> auxiliaryRowVector;  // A.rowCount() entries
     // can be used if the entries in 'x' need to be reordered
@@ -0,0 +1,83 @@
+#include "storm/solver/AnytimeBounds.h"
+
+#include <cmath>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+
+AnytimeBounds::AnytimeBounds() : numberOfAbortedSolvers(0), allAbortedSolversHaveBounds(true), errorBound(0.0) {
+    // Intentionally left empty.
+}
+
+void AnytimeBounds::recordAbortedSolver(double bound) {
+    if (std::isnan(bound) || std::isinf(bound)) {
+        recordAbortedSolverWithoutBounds();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    ++numberOfAbortedSolvers;
+    errorBound += bound;
+}
+
+void AnytimeBounds::recordAbortedSolverWithoutBounds() {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++numberOfAbortedSolvers;
+    allAbortedSolversHaveBounds = false;
+}
+
+bool AnytimeBounds::hasAbortedSolver() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfAbortedSolvers > 0;
+}
+
+boost::optional<double> AnytimeBounds::getErrorBound() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!allAbortedSolversHaveBounds) {
+        return boost::none;
+    }
+    return errorBound;
+}
+
+void AnytimeBounds::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    numberOfAbortedSolvers = 0;
+    allAbortedSolversHaveBounds = true;
+    errorBound = 0.0;
+}
+
+void AnytimeBounds::recordAbortedSolver(Environment const& env, double errorBound) {
+    if (auto const& bounds = env.solver().getAnytimeBounds()) {
+        bounds->recordAbortedSolver(errorBound);
+    }
+}
+
+void AnytimeBounds::recordAbortedSolverWithoutBounds(Environment const& env) {
+    if (auto const& bounds = env.solver().getAnytimeBounds()) {
+        bounds->recordAbortedSolverWithoutBounds();
+    }
+}
+
+template<typename ValueType>
+void AnytimeBounds::recordAbortedSolver(Environment const& env, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX) {
+    if (!env.solver().getAnytimeBounds()) {
+        return;
+    }
+    // The mean of both bounds is within half of their distance of the exact solution.
+    ValueType maxGap = storm::utility::zero<ValueType>();
+    for (uint64_t i = 0; i < lowerX.size(); ++i) {
+        maxGap = storm::utility::max<ValueType>(maxGap, upperX[i] - lowerX[i]);
+    }
+    recordAbortedSolver(env, storm::utility::convertNumber<double>(maxGap) / 2.0);
+}
+
+template void AnytimeBounds::recordAbortedSolver(Environment const& env, std::vector<double> const& lowerX, std::vector<double> const& upperX);
+template void AnytimeBounds::recordAbortedSolver(Environment const& env, std::vector<storm::RationalNumber> const& lowerX,
+                                                 std::vector<storm::RationalNumber> const& upperX);
+
+}  // namespace solver
+}  // namespace storm
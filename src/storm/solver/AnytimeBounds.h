@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * Collects the error bounds of solvers that were aborted (e.g. because a deadline was reached) before they converged. Sound methods keep a lower and an
+ * upper bound on the solution at all times, so even an aborted invocation yields values whose distance to the exact solution is known. An instance is
+ * attached to the solver environment, so all solvers (and their copies of the environment) report to it. The bounds are thread-safe.
+ */
+class AnytimeBounds {
+   public:
+    AnytimeBounds();
+
+    /*!
+     * Records that a solver was aborted and that every entry of its result is within the given (absolute) distance of the exact solution.
+     */
+    void recordAbortedSolver(double errorBound);
+
+    /*!
+     * Records that a solver was aborted without knowing how far its result is from the exact solution.
+     */
+    void recordAbortedSolverWithoutBounds();
+
+    /*!
+     * Retrieves whether some solver was aborted since the last reset.
+     */
+    bool hasAbortedSolver() const;
+
+    /*!
+     * Retrieves a bound on the (absolute) error of the results computed since the last reset, i.e., the sum of the error bounds of all aborted solvers.
+     * If some aborted solver did not provide a bound, none is returned. Note that the sum bounds the error of probabilities, but it may underestimate
+     * the error of expected rewards that are computed from several solver invocations.
+     */
+    boost::optional<double> getErrorBound() const;
+
+    /*!
+     * Forgets all aborted solvers.
+     */
+    void reset();
+
+    /*!
+     * Records an aborted solver at the anytime bounds attached to the given environment (if any).
+     */
+    static void recordAbortedSolver(Environment const& env, double errorBound);
+    static void recordAbortedSolverWithoutBounds(Environment const& env);
+
+    /*!
+     * Records a solver that was aborted with the given lower and upper bounds and that returns the mean of both bounds as its result.
+     */
+    template<typename ValueType>
+    static void recordAbortedSolver(Environment const& env, std::vector<ValueType> const& lowerX, std::vector<ValueType> const& upperX);
+
+   private:
+    mutable std::mutex mutex;
+    uint64_t numberOfAbortedSolvers;
+    bool allAbortedSolversHaveBounds;
+    double errorBound;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -5,41 +5,59 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
 template<typename ValueType>
-EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver() {
+EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver() : localA(nullptr), A(nullptr) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
-EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) {
+EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
     this->setMatrix(A);
 }
 
 template<typename ValueType>
-EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) {
+EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
     this->setMatrix(std::move(A));
 }
 
 template<typename ValueType>
 void EigenLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
-    eigenA = storm::adapters::EigenAdapter::toEigenSparseMatrix<ValueType>(A);
+    localA.reset();
+    this->A = &A;
+    eigenA.reset();
     this->clearCache();
 }
 
 template<typename ValueType>
 void EigenLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
-    // Take ownership of the matrix so it is destroyed after we have translated it to Eigen's format.
-    storm::storage::SparseMatrix<ValueType> localA(std::move(A));
-    this->setMatrix(localA);
+    localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+    this->A = localA.get();
+    eigenA.reset();
     this->clearCache();
 }
 
+template<typename ValueType>
+void EigenLinearEquationSolver<ValueType>::updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const& changedRows) {
+    if (changedRows.empty() && this->A) {
+        STORM_LOG_ASSERT(this->A->getRowCount() == A.getRowCount() && this->A->getColumnCount() == A.getColumnCount(),
+                         "The dimensions of the matrix must not change.");
+        // The Eigen matrix and its factorization remain valid, only the parallel Krylov solver refers to the previous matrix.
+        localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+        this->A = localA.get();
+        parallelKrylovSolver.reset();
+        return;
+    }
+    setMatrix(std::move(A));
+}
+
 template<typename ValueType>
 EigenLinearEquationSolverMethod EigenLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
     // Adjust the method if none was specified and we are using rational numbers.
@@ -78,11 +96,7 @@ bool EigenLinearEquationSolver<storm::RationalNumber>::internalSolveEquations(En
     auto eigenX = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(x.data(), x.size());
     auto eigenB = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(b.data(), b.size());
 
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalNumber>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
-
-    return solver.info() == Eigen::ComputationInfo::Success;
+    return solveWithLuFactorization(eigenX, eigenB);
 }
 
 // Specialization for storm::RationalFunction
@@ -97,10 +111,21 @@ bool EigenLinearEquationSolver<storm::RationalFunction>::internalSolveEquations(
     auto eigenX = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(x.data(), x.size());
     auto eigenB = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(b.data(), b.size());
 
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalFunction>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
-    return solver.info() == Eigen::ComputationInfo::Success;
+    return solveWithLuFactorization(eigenX, eigenB);
+}
+
+template<>
+bool EigenLinearEquationSolver<storm::RationalNumber>::solveEquationsParallel(Environment const&, EigenLinearEquationSolverMethod,
+                                                                              std::vector<storm::RationalNumber>&,
+                                                                              std::vector<storm::RationalNumber> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The parallel Krylov solvers do not support rational numbers.");
+}
+
+template<>
+bool EigenLinearEquationSolver<storm::RationalFunction>::solveEquationsParallel(Environment const&, EigenLinearEquationSolverMethod,
+                                                                                std::vector<storm::RationalFunction>&,
+                                                                                std::vector<storm::RationalFunction> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The parallel Krylov solvers do not support rational functions.");
 }
 #endif
 
@@ -113,9 +138,10 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     auto solutionMethod = getMethod(env, env.solver().isForceExact());
     if (solutionMethod == EigenLinearEquationSolverMethod::SparseLU) {
         STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with sparse LU factorization (Eigen library).");
-        Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
-        solver.compute(*this->eigenA);
-        solver._solve_impl(eigenB, eigenX);
+        return solveWithLuFactorization(eigenX, eigenB);
+    } else if ((solutionMethod == EigenLinearEquationSolverMethod::Bicgstab || solutionMethod == EigenLinearEquationSolverMethod::Gmres) &&
+               storm::utility::parallel::getDefaultNumberOfThreads() > 1) {
+        return solveEquationsParallel(env, solutionMethod, x, b);
     } else {
         bool converged = false;
         uint64_t numberOfIterations = 0;
@@ -131,7 +157,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with BiCGSTAB with Ilu preconditioner (Eigen library).");
 
                 Eigen::BiCGSTAB<Eigen::SparseMatrix<ValueType>, Eigen::IncompleteLUT<ValueType>> solver;
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
@@ -143,7 +169,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 Eigen::BiCGSTAB<Eigen::SparseMatrix<ValueType>, Eigen::DiagonalPreconditioner<ValueType>> solver;
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -153,7 +179,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 Eigen::BiCGSTAB<Eigen::SparseMatrix<ValueType>, Eigen::IdentityPreconditioner> solver;
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 numberOfIterations = solver.iterations();
                 converged = solver.info() == Eigen::ComputationInfo::Success;
@@ -165,7 +191,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -176,7 +202,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -187,7 +213,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -201,7 +227,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -212,7 +238,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -223,7 +249,7 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
                 solver.setTolerance(precision);
                 solver.setMaxIterations(maxIter);
                 solver.set_restart(restartThreshold);
-                solver.compute(*this->eigenA);
+                solver.compute(getEigenMatrix());
                 eigenX = solver.solveWithGuess(eigenB, eigenX);
                 converged = solver.info() == Eigen::ComputationInfo::Success;
                 numberOfIterations = solver.iterations();
@@ -246,6 +272,80 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     return true;
 }
 
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::solveEquationsParallel(Environment const& env, EigenLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                                                 std::vector<ValueType> const& b) const {
+    uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    helper::KrylovPreconditioner preconditioner = helper::KrylovPreconditioner::None;
+    if (env.solver().eigen().getPreconditioner() == EigenLinearEquationSolverPreconditioner::Ilu) {
+        preconditioner = helper::KrylovPreconditioner::BlockIlu;
+    } else if (env.solver().eigen().getPreconditioner() == EigenLinearEquationSolverPreconditioner::Diagonal) {
+        preconditioner = helper::KrylovPreconditioner::Diagonal;
+    }
+    if (!parallelKrylovSolver || parallelKrylovSolver->getPreconditioner() != preconditioner || parallelKrylovSolver->getNumberOfThreads() != numberOfThreads) {
+        parallelKrylovSolver = std::make_unique<helper::ParallelKrylovSolver<ValueType>>(*this->A, preconditioner, numberOfThreads);
+    }
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with "
+                                                      << (method == EigenLinearEquationSolverMethod::Bicgstab ? "BiCGSTAB" : "GMRES") << " with "
+                                                      << toString(env.solver().eigen().getPreconditioner()) << " preconditioner on " << numberOfThreads
+                                                      << " threads.");
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().eigen().getPrecision());
+    uint64_t maxIter = env.solver().eigen().getMaximalNumberOfIterations();
+    std::pair<bool, uint64_t> result;
+    if (method == EigenLinearEquationSolverMethod::Bicgstab) {
+        result = parallelKrylovSolver->solveBicgstab(x, b, precision, maxIter);
+    } else {
+        result = parallelKrylovSolver->solveGmres(x, b, precision, maxIter, env.solver().eigen().getRestartThreshold());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    // Make sure that all results conform to the (global) bounds.
+    storm::utility::vector::clip(x, this->lowerBound, this->upperBound);
+
+    if (result.first) {
+        STORM_LOG_INFO("Iterative solver converged after " << result.second << " iterations.");
+    } else {
+        STORM_LOG_WARN("Iterative solver did not converge.");
+    }
+    return result.first;
+}
+
+template<typename ValueType>
+Eigen::SparseMatrix<ValueType> const& EigenLinearEquationSolver<ValueType>::getEigenMatrix() const {
+    if (!eigenA) {
+        eigenA = storm::adapters::EigenAdapter::toEigenSparseMatrix<ValueType>(*this->A);
+    }
+    return *eigenA;
+}
+
+template<typename ValueType>
+bool EigenLinearEquationSolver<ValueType>::solveWithLuFactorization(Eigen::Map<Eigen::Matrix<ValueType, Eigen::Dynamic, 1>>& eigenX,
+                                                                   Eigen::Map<Eigen::Matrix<ValueType, Eigen::Dynamic, 1> const> const& eigenB) const {
+    if (!luFactorization) {
+        luFactorization = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>>();
+        luFactorization->compute(getEigenMatrix());
+    } else {
+        STORM_LOG_DEBUG("Reusing the LU factorization of a previous solve.");
+    }
+    luFactorization->_solve_impl(eigenB, eigenX);
+    bool success = luFactorization->info() == Eigen::ComputationInfo::Success;
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return success;
+}
+
+template<typename ValueType>
+void EigenLinearEquationSolver<ValueType>::clearCache() const {
+    luFactorization.reset();
+    parallelKrylovSolver.reset();
+    LinearEquationSolver<ValueType>::clearCache();
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
     return LinearEquationSolverProblemFormat::EquationSystem;
@@ -253,12 +353,12 @@ LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquat
 
 template<typename ValueType>
 uint64_t EigenLinearEquationSolver<ValueType>::getMatrixRowCount() const {
-    return eigenA->rows();
+    return A->getRowCount();
 }
 
 template<typename ValueType>
 uint64_t EigenLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
-    return eigenA->cols();
+    return A->getColumnCount();
 }
 
 template<typename ValueType>
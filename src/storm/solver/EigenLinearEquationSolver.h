@@ -3,12 +3,15 @@
 #include "storm/adapters/eigen.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/ParallelKrylovSolver.h"
 
 namespace storm {
 namespace solver {
 
 /*!
- * A class that uses the Eigen library to implement the LinearEquationSolver interface.
+ * A class that uses the Eigen library to implement the LinearEquationSolver interface. If several threads are available (see
+ * storm::utility::parallel::getDefaultNumberOfThreads), BiCGSTAB and GMRES on doubles are instead performed on the SparseMatrix by a
+ * ParallelKrylovSolver. The matrix is only converted to Eigen's format when Eigen is used.
  */
 template<typename ValueType>
 class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
@@ -20,8 +23,16 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
 
+    /*!
+     * Keeps the cached LU factorization if no row changed. Otherwise, the matrix is refactorized upon the next solve, as
+     * the factorization can not be updated row-wise.
+     */
+    virtual void updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const& changedRows) override;
+
     virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
+    virtual void clearCache() const override;
+
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
@@ -31,8 +42,37 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual uint64_t getMatrixRowCount() const override;
     virtual uint64_t getMatrixColumnCount() const override;
 
-    // The (eigen) matrix associated with this equation solver.
-    std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
+    /*!
+     * Retrieves the matrix in Eigen's format, converting it first if necessary.
+     */
+    Eigen::SparseMatrix<ValueType> const& getEigenMatrix() const;
+
+    /*!
+     * Solves the equation system with the ParallelKrylovSolver.
+     */
+    bool solveEquationsParallel(Environment const& env, EigenLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                std::vector<ValueType> const& b) const;
+
+    // If the solver is given ownership of the matrix, it is stored here.
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+    // A pointer to the original sparse matrix given to this solver. If the solver takes possession of the matrix
+    // the pointer refers to localA.
+    storm::storage::SparseMatrix<ValueType> const* A;
+
+    // The (eigen) matrix associated with this equation solver, which is converted lazily.
+    mutable std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
+
+    // The solver used for BiCGSTAB and GMRES if several threads are available.
+    mutable std::unique_ptr<helper::ParallelKrylovSolver<ValueType>> parallelKrylovSolver;
+
+    // The LU factorization of the matrix. It is reused for further solves if caching is enabled.
+    mutable std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>> luFactorization;
+
+    /*!
+     * Solves the equation system with the (possibly cached) LU factorization.
+     */
+    bool solveWithLuFactorization(Eigen::Map<Eigen::Matrix<ValueType, Eigen::Dynamic, 1>>& eigenX, Eigen::Map<Eigen::Matrix<ValueType, Eigen::Dynamic, 1> const> const& eigenB) const;
 };
 
 template<typename ValueType>
@@ -1,5 +1,6 @@
 #include "storm/solver/EliminationLinearEquationSolver.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "storm/settings/SettingsManager.h"
@@ -8,8 +9,10 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/vector.h"
 
@@ -19,6 +22,94 @@ namespace solver {
 using namespace stateelimination;
 using namespace storm::utility::stateelimination;
 
+namespace {
+/*!
+ * Eliminates the given states in rounds. In every round, a set of states is selected (respecting the given order as far
+ * as possible) such that the eliminations of the selected states modify disjoint parts of the matrices and the
+ * solution vector. Eliminating a state modifies the forward transitions and values of the state and its
+ * predecessors as well as the backward transitions of the state and its successors, so the selected states need to
+ * have pairwise disjoint sets of these rows. The selected states are then eliminated concurrently.
+ */
+template<typename ValueType>
+void eliminateStatesConcurrently(storm::storage::FlexibleSparseMatrix<ValueType>& flexibleMatrix,
+                                 storm::storage::FlexibleSparseMatrix<ValueType>& flexibleBackwardTransitions, std::vector<ValueType>& x,
+                                 std::vector<storm::storage::sparse::state_type> const& orderedStates, uint64_t numberOfThreads) {
+    // The eliminators do not update priorities, so they can share a static priority queue.
+    std::vector<std::unique_ptr<PrioritizedStateEliminator<ValueType>>> eliminators;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        eliminators.push_back(std::make_unique<PrioritizedStateEliminator<ValueType>>(
+            flexibleMatrix, flexibleBackwardTransitions, std::vector<storm::storage::sparse::state_type>(), x));
+    }
+
+    // To avoid clearing the marks in every round, rows are marked with the (positive) index of the round.
+    std::vector<uint64_t> forwardRowMarks(x.size(), 0);
+    std::vector<uint64_t> backwardRowMarks(x.size(), 0);
+    auto isSelectable = [&](storm::storage::sparse::state_type state, uint64_t round) {
+        if (forwardRowMarks[state] == round || backwardRowMarks[state] == round) {
+            return false;
+        }
+        for (auto const& predecessorEntry : flexibleBackwardTransitions.getRow(state)) {
+            if (forwardRowMarks[predecessorEntry.getColumn()] == round) {
+                return false;
+            }
+        }
+        for (auto const& successorEntry : flexibleMatrix.getRow(state)) {
+            if (backwardRowMarks[successorEntry.getColumn()] == round) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto select = [&](storm::storage::sparse::state_type state, uint64_t round) {
+        forwardRowMarks[state] = round;
+        backwardRowMarks[state] = round;
+        for (auto const& predecessorEntry : flexibleBackwardTransitions.getRow(state)) {
+            forwardRowMarks[predecessorEntry.getColumn()] = round;
+        }
+        for (auto const& successorEntry : flexibleMatrix.getRow(state)) {
+            backwardRowMarks[successorEntry.getColumn()] = round;
+        }
+    };
+
+    // Only a window of the remaining states is considered in every round. This bounds the effort per round and keeps
+    // states that come late in the order from being eliminated too early.
+    uint64_t const maximalNumberOfSelectedStates = 256 * numberOfThreads;
+    uint64_t const windowSize = 16 * maximalNumberOfSelectedStates;
+    std::vector<storm::storage::sparse::state_type> remainingStates = orderedStates;
+    std::vector<storm::storage::sparse::state_type> selectedStates;
+    std::vector<storm::storage::sparse::state_type> deferredStates;
+    uint64_t firstRemainingState = 0;
+    uint64_t round = 0;
+    while (firstRemainingState < remainingStates.size()) {
+        ++round;
+        selectedStates.clear();
+        deferredStates.clear();
+        uint64_t windowEnd = std::min<uint64_t>(remainingStates.size(), firstRemainingState + windowSize);
+        for (uint64_t index = firstRemainingState; index < windowEnd; ++index) {
+            storm::storage::sparse::state_type state = remainingStates[index];
+            if (selectedStates.size() < maximalNumberOfSelectedStates && isSelectable(state, round)) {
+                select(state, round);
+                selectedStates.push_back(state);
+            } else {
+                deferredStates.push_back(state);
+            }
+        }
+        // Put the deferred states (in their original order) right before the states outside of the window.
+        firstRemainingState = windowEnd - deferredStates.size();
+        std::copy(deferredStates.begin(), deferredStates.end(), remainingStates.begin() + firstRemainingState);
+
+        uint64_t chunkSize = std::max<uint64_t>(1, selectedStates.size() / (4 * numberOfThreads));
+        storm::utility::parallel::forEachChunk(0, selectedStates.size(), chunkSize, numberOfThreads,
+                                               [&](uint64_t thread, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                   for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                                                       eliminators[thread]->eliminateState(selectedStates[index], false);
+                                                   }
+                                               });
+    }
+    STORM_LOG_INFO("Eliminated " << orderedStates.size() << " states in " << round << " rounds using " << numberOfThreads << " threads.");
+}
+}  // namespace
+
 template<typename ValueType>
 EliminationLinearEquationSolver<ValueType>::EliminationLinearEquationSolver() {
     // Intentionally left empty.
@@ -85,13 +176,30 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     std::shared_ptr<StatePriorityQueue> priorityQueue =
         createStatePriorityQueue<ValueType>(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, b, storm::storage::BitVector(x.size(), true));
 
-    // Create a state eliminator to perform the actual elimination.
-    PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+    uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads > 1 && std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Operations on rational functions share caches that are not thread-safe.
+        STORM_LOG_WARN("Eliminating states sequentially since concurrent elimination is not supported for rational functions.");
+        numberOfThreads = 1;
+    }
 
-    // Eliminate all states.
-    while (priorityQueue->hasNext()) {
-        auto state = priorityQueue->pop();
-        eliminator.eliminateState(state, false);
+    if (numberOfThreads > 1) {
+        // The order is fixed upfront, i.e., dynamic orders only consider the initial priorities of the states.
+        std::vector<storm::storage::sparse::state_type> orderedStates;
+        orderedStates.reserve(x.size());
+        while (priorityQueue->hasNext()) {
+            orderedStates.push_back(priorityQueue->pop());
+        }
+        eliminateStatesConcurrently(flexibleMatrix, flexibleBackwardTransitions, x, orderedStates, numberOfThreads);
+    } else {
+        // Create a state eliminator to perform the actual elimination.
+        PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
+
+        // Eliminate all states.
+        while (priorityQueue->hasNext()) {
+            auto state = priorityQueue->pop();
+            eliminator.eliminateState(state, false);
+        }
     }
 
     return true;
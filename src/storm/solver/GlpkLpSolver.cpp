@@ -25,7 +25,13 @@ namespace solver {
 #ifdef STORM_HAVE_GLPK
 template<typename ValueType>
 GlpkLpSolver<ValueType>::GlpkLpSolver(std::string const& name, OptimizationDirection const& optDir)
-    : LpSolver<ValueType>(optDir), lp(nullptr), variableToIndexMap(), modelContainsIntegerVariables(false), isInfeasibleFlag(false), isUnboundedFlag(false) {
+    : LpSolver<ValueType>(optDir),
+      lp(nullptr),
+      variableToIndexMap(),
+      modelContainsIntegerVariables(false),
+      isInfeasibleFlag(false),
+      isUnboundedFlag(false),
+      interruptRequested(false) {
     // Create the LP problem for glpk.
     lp = glp_create_prob();
 
@@ -234,9 +240,35 @@ void GlpkLpSolver<ValueType>::addConstraint(std::string const& name, storm::expr
     this->currentModelHasBeenOptimized = false;
 }
 
+template<typename ValueType>
+void GlpkLpSolver<ValueType>::setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    auto variableIndexPair = this->variableToIndexMap.find(variable);
+    STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidAccessException,
+                    "Changing objective function coefficient of unknown variable '" << variable.getName() << "'.");
+    glp_set_obj_coef(this->lp, variableIndexPair->second, storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    this->currentModelHasBeenOptimized = false;
+}
+
+// The information passed to the callback of the MIP solver.
+struct MipCallbackInfo {
+    // The maximal gap (first) and whether it is relative (second). Once the MIP solver terminates due to the gap, this is the achieved relative gap.
+    std::pair<double, bool> mipgap;
+    // Whether the MIP solver shall terminate as soon as the gap is reached.
+    bool terminateOnGap;
+    std::atomic<bool> const* interruptRequested;
+};
+
 // Method used within the MIP solver to terminate early
 void callback(glp_tree* t, void* info) {
-    auto& mipgap = *static_cast<std::pair<double, bool>*>(info);
+    auto& callbackInfo = *static_cast<MipCallbackInfo*>(info);
+    if (callbackInfo.interruptRequested->load(std::memory_order_relaxed)) {
+        glp_ios_terminate(t);
+        return;
+    }
+    if (!callbackInfo.terminateOnGap) {
+        return;
+    }
+    auto& mipgap = callbackInfo.mipgap;
     double actualRelativeGap = glp_ios_mip_gap(t);
     double factor = storm::utility::one<double>();
     if (!mipgap.second) {
@@ -257,6 +289,7 @@ void GlpkLpSolver<ValueType>::optimize() const {
     // First, reset the flags.
     this->isInfeasibleFlag = false;
     this->isUnboundedFlag = false;
+    this->interruptRequested.store(false, std::memory_order_relaxed);
 
     // Start by setting the model sense.
     glp_set_obj_dir(this->lp, this->getOptimizationDirection() == OptimizationDirection::Minimize ? GLP_MIN : GLP_MAX);
@@ -289,11 +322,11 @@ void GlpkLpSolver<ValueType>::optimize() const {
         if (!this->isInfeasibleFlag) {
             // Check whether we allow sub-optimal solutions via a non-zero MIP gap.
             // parameters->mip_gap = this->maxMILPGap; (only works for relative values. Also, we need to obtain the actual gap anyway.
-            std::pair<double, bool> mipgap(this->maxMILPGap, this->maxMILPGapRelative);
-            if (!storm::utility::isZero(this->maxMILPGap)) {
-                parameters->cb_func = &callback;
-                parameters->cb_info = &mipgap;
-            }
+            // The callback is always installed as it also handles interruptions.
+            MipCallbackInfo callbackInfo{std::make_pair(this->maxMILPGap, this->maxMILPGapRelative), !storm::utility::isZero(this->maxMILPGap),
+                                         &this->interruptRequested};
+            parameters->cb_func = &callback;
+            parameters->cb_info = &callbackInfo;
 
             // Invoke mip solving
             error = glp_intopt(this->lp, parameters);
@@ -301,7 +334,7 @@ void GlpkLpSolver<ValueType>::optimize() const {
             delete parameters;
 
             // mipgap.first has been set to the achieved mipgap (either within the callback function or because it has been set to this->maxMILPGap)
-            this->actualRelativeMILPGap = mipgap.first;
+            this->actualRelativeMILPGap = callbackInfo.mipgap.first;
 
             // In case the error is caused by an infeasible problem, we do not want to view this as an error and
             // reset the error code.
@@ -312,7 +345,7 @@ void GlpkLpSolver<ValueType>::optimize() const {
                 this->isUnboundedFlag = true;
                 error = 0;
             } else if (error == GLP_ESTOP) {
-                // Early termination due to achieved MIP Gap. That's fine.
+                // Early termination due to achieved MIP Gap or an interruption. That's fine.
                 error = 0;
             } else if (error == GLP_EBOUND) {
                 throw storm::exceptions::InvalidStateException()
@@ -529,6 +562,12 @@ void GlpkLpSolver<ValueType>::setMaximalMILPGap(ValueType const& gap, bool relat
     this->maxMILPGapRelative = relative;
 }
 
+template<typename ValueType>
+void GlpkLpSolver<ValueType>::interrupt() {
+    // The request is handled by the callback of the MIP solver. Pure LPs are not interrupted.
+    this->interruptRequested.store(true, std::memory_order_relaxed);
+}
+
 template<typename ValueType>
 ValueType GlpkLpSolver<ValueType>::getMILPGap(bool relative) const {
     STORM_LOG_ASSERT(this->isOptimal(), "Asked for the MILP gap although there is no (bounded) solution.");
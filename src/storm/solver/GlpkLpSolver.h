@@ -1,6 +1,7 @@
 #ifndef STORM_SOLVER_GLPKLPSOLVER_H_
 #define STORM_SOLVER_GLPKLPSOLVER_H_
 
+#include <atomic>
 #include <map>
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/solver/LpSolver.h"
@@ -84,6 +85,9 @@ class GlpkLpSolver : public LpSolver<ValueType> {
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) override;
 
+    // Methods to change the objective function.
+    virtual void setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -105,6 +109,8 @@ class GlpkLpSolver : public LpSolver<ValueType> {
     virtual void setMaximalMILPGap(ValueType const& gap, bool relative) override;
     virtual ValueType getMILPGap(bool relative) const override;
 
+    virtual void interrupt() override;
+
    private:
     /*!
      * Adds a variable with the given name, type, lower and upper bound and objective function coefficient.
@@ -136,6 +142,9 @@ class GlpkLpSolver : public LpSolver<ValueType> {
     mutable bool maxMILPGapRelative;
     mutable double actualRelativeMILPGap;
 
+    // A flag that is set to request the termination of a running MILP optimization.
+    std::atomic<bool> interruptRequested;
+
     struct IncrementalLevel {
         std::vector<storm::expressions::Variable> variables;
         int firstConstraintIndex;
@@ -232,6 +241,11 @@ class GlpkLpSolver : public LpSolver {
                                                               "requires this support. Please choose a version of support with glpk support.";
     }
 
+    virtual void setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) override {
+        throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for glpk. Yet, a method was called that "
+                                                              "requires this support. Please choose a version of support with glpk support.";
+    }
+
     virtual void optimize() const override {
         throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for glpk. Yet, a method was called that "
                                                               "requires this support. Please choose a version of support with glpk support.";
@@ -9,38 +9,84 @@
 #include "storm/exceptions/AbortException.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+// The fraction of the rows that may change before a cached ILU preconditioner is recomputed.
+double const maximalFractionOfRowChangesForIluReuse = 0.1;
+}  // namespace
+
 template<typename ValueType>
-GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver() {
+GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver() : localA(nullptr), A(nullptr) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
-GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) {
+GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
     this->setMatrix(A);
 }
 
 template<typename ValueType>
-GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) {
+GmmxxLinearEquationSolver<ValueType>::GmmxxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
     this->setMatrix(std::move(A));
 }
 
 template<typename ValueType>
 void GmmxxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
-    gmmxxA = storm::adapters::GmmxxAdapter<ValueType>::toGmmxxSparseMatrix(A);
+    localA.reset();
+    this->A = &A;
+    gmmxxA.reset();
     clearCache();
 }
 
 template<typename ValueType>
 void GmmxxLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
-    gmmxxA = storm::adapters::GmmxxAdapter<ValueType>::toGmmxxSparseMatrix(A);
+    localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+    this->A = localA.get();
+    gmmxxA.reset();
     clearCache();
 }
 
+template<typename ValueType>
+void GmmxxLinearEquationSolver<ValueType>::updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const& changedRows) {
+    STORM_LOG_ASSERT(this->A && A.getRowCount() == this->A->getRowCount() && A.getColumnCount() == this->A->getColumnCount(),
+                     "The dimensions of the matrix must not change.");
+    localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+    this->A = localA.get();
+    gmmxxA.reset();
+    // The parallel Krylov solver refers to the previous matrix.
+    parallelKrylovSolver.reset();
+
+    if (diagonalPreconditioner) {
+        for (auto row : changedRows) {
+            // Same as in gmm::diagonal_precond::build_with.
+            ValueType diagonalValue = storm::utility::zero<ValueType>();
+            for (auto const& entry : this->A->getRow(row)) {
+                if (entry.getColumn() == row) {
+                    diagonalValue = storm::utility::abs(entry.getValue());
+                    break;
+                }
+            }
+            if (storm::utility::isZero(diagonalValue)) {
+                diagonalValue = storm::utility::one<ValueType>();
+            }
+            diagonalPreconditioner->diag[row] = storm::utility::one<ValueType>() / diagonalValue;
+        }
+    }
+    if (iluPreconditioner) {
+        rowChangesSinceIluPreconditioner += changedRows.getNumberOfSetBits();
+        if (rowChangesSinceIluPreconditioner > maximalFractionOfRowChangesForIluReuse * this->A->getRowCount()) {
+            iluPreconditioner.reset();
+        } else {
+            STORM_LOG_DEBUG("Keeping the ILU preconditioner after " << rowChangesSinceIluPreconditioner << " row changes.");
+        }
+    }
+}
+
 template<typename ValueType>
 GmmxxLinearEquationSolverMethod GmmxxLinearEquationSolver<ValueType>::getMethod(Environment const& env) const {
     STORM_LOG_ERROR_COND(!env.solver().isForceSoundness(), "This linear equation solver does not support sound computations. Using unsound methods now...");
@@ -56,13 +102,21 @@ bool GmmxxLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with Gmmxx linear equation solver with method '" << toString(method)
                                                       << "' and preconditioner '" << toString(preconditioner) << "'.");
 
+    if ((method == GmmxxLinearEquationSolverMethod::Bicgstab || method == GmmxxLinearEquationSolverMethod::Gmres) &&
+        storm::utility::parallel::getDefaultNumberOfThreads() > 1) {
+        return solveEquationsParallel(env, x, b);
+    }
+
     if (method == GmmxxLinearEquationSolverMethod::Bicgstab || method == GmmxxLinearEquationSolverMethod::Qmr ||
         method == GmmxxLinearEquationSolverMethod::Gmres) {
+        auto const& gmmxxMatrix = getGmmxxMatrix();
+
         // Make sure that the requested preconditioner is available
         if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Ilu && !iluPreconditioner) {
-            iluPreconditioner = std::make_unique<gmm::ilu_precond<gmm::csr_matrix<ValueType>>>(*gmmxxA);
-        } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Diagonal) {
-            diagonalPreconditioner = std::make_unique<gmm::diagonal_precond<gmm::csr_matrix<ValueType>>>(*gmmxxA);
+            iluPreconditioner = std::make_unique<gmm::ilu_precond<gmm::csr_matrix<ValueType>>>(gmmxxMatrix);
+            rowChangesSinceIluPreconditioner = 0;
+        } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Diagonal && !diagonalPreconditioner) {
+            diagonalPreconditioner = std::make_unique<gmm::diagonal_precond<gmm::csr_matrix<ValueType>>>(gmmxxMatrix);
         }
 
         // Prepare an iteration object that determines the accuracy and the maximum number of iterations.
@@ -81,27 +135,27 @@ bool GmmxxLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
             // Invoke gmm with the corresponding settings
             if (method == GmmxxLinearEquationSolverMethod::Bicgstab) {
                 if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Ilu) {
-                    gmm::bicgstab(*gmmxxA, x, b, *iluPreconditioner, iter);
+                    gmm::bicgstab(gmmxxMatrix, x, b, *iluPreconditioner, iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Diagonal) {
-                    gmm::bicgstab(*gmmxxA, x, b, *diagonalPreconditioner, iter);
+                    gmm::bicgstab(gmmxxMatrix, x, b, *diagonalPreconditioner, iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::None) {
-                    gmm::bicgstab(*gmmxxA, x, b, gmm::identity_matrix(), iter);
+                    gmm::bicgstab(gmmxxMatrix, x, b, gmm::identity_matrix(), iter);
                 }
             } else if (method == GmmxxLinearEquationSolverMethod::Qmr) {
                 if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Ilu) {
-                    gmm::qmr(*gmmxxA, x, b, *iluPreconditioner, iter);
+                    gmm::qmr(gmmxxMatrix, x, b, *iluPreconditioner, iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Diagonal) {
-                    gmm::qmr(*gmmxxA, x, b, *diagonalPreconditioner, iter);
+                    gmm::qmr(gmmxxMatrix, x, b, *diagonalPreconditioner, iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::None) {
-                    gmm::qmr(*gmmxxA, x, b, gmm::identity_matrix(), iter);
+                    gmm::qmr(gmmxxMatrix, x, b, gmm::identity_matrix(), iter);
                 }
             } else if (method == GmmxxLinearEquationSolverMethod::Gmres) {
                 if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Ilu) {
-                    gmm::gmres(*gmmxxA, x, b, *iluPreconditioner, env.solver().gmmxx().getRestartThreshold(), iter);
+                    gmm::gmres(gmmxxMatrix, x, b, *iluPreconditioner, env.solver().gmmxx().getRestartThreshold(), iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::Diagonal) {
-                    gmm::gmres(*gmmxxA, x, b, *diagonalPreconditioner, env.solver().gmmxx().getRestartThreshold(), iter);
+                    gmm::gmres(gmmxxMatrix, x, b, *diagonalPreconditioner, env.solver().gmmxx().getRestartThreshold(), iter);
                 } else if (preconditioner == GmmxxLinearEquationSolverPreconditioner::None) {
-                    gmm::gmres(*gmmxxA, x, b, gmm::identity_matrix(), env.solver().gmmxx().getRestartThreshold(), iter);
+                    gmm::gmres(gmmxxMatrix, x, b, gmm::identity_matrix(), env.solver().gmmxx().getRestartThreshold(), iter);
                 }
             }
         } catch (storm::exceptions::AbortException const& e) {
@@ -129,6 +183,53 @@ bool GmmxxLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     return false;
 }
 
+template<typename ValueType>
+bool GmmxxLinearEquationSolver<ValueType>::solveEquationsParallel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    helper::KrylovPreconditioner preconditioner = helper::KrylovPreconditioner::None;
+    if (env.solver().gmmxx().getPreconditioner() == GmmxxLinearEquationSolverPreconditioner::Ilu) {
+        preconditioner = helper::KrylovPreconditioner::BlockIlu;
+    } else if (env.solver().gmmxx().getPreconditioner() == GmmxxLinearEquationSolverPreconditioner::Diagonal) {
+        preconditioner = helper::KrylovPreconditioner::Diagonal;
+    }
+    if (!parallelKrylovSolver || parallelKrylovSolver->getPreconditioner() != preconditioner || parallelKrylovSolver->getNumberOfThreads() != numberOfThreads) {
+        parallelKrylovSolver = std::make_unique<helper::ParallelKrylovSolver<ValueType>>(*this->A, preconditioner, numberOfThreads);
+    }
+    STORM_LOG_INFO("Using " << numberOfThreads << " threads for the matrix-vector and vector operations"
+                            << (preconditioner == helper::KrylovPreconditioner::BlockIlu ? " and a block ILU preconditioner." : "."));
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().gmmxx().getPrecision());
+    uint64_t maxIter = env.solver().gmmxx().getMaximalNumberOfIterations();
+    std::pair<bool, uint64_t> result;
+    if (getMethod(env) == GmmxxLinearEquationSolverMethod::Bicgstab) {
+        result = parallelKrylovSolver->solveBicgstab(x, b, precision, maxIter);
+    } else {
+        result = parallelKrylovSolver->solveGmres(x, b, precision, maxIter, env.solver().gmmxx().getRestartThreshold());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    // Make sure that all results conform to the bounds.
+    storm::utility::vector::clip(x, this->lowerBound, this->upperBound);
+
+    if (result.first) {
+        STORM_LOG_INFO("Iterative solver converged after " << result.second << " iteration(s).");
+    } else {
+        STORM_LOG_WARN("Iterative solver did not converge within " << result.second << " iteration(s).");
+    }
+    return result.first;
+}
+
+template<typename ValueType>
+gmm::csr_matrix<ValueType> const& GmmxxLinearEquationSolver<ValueType>::getGmmxxMatrix() const {
+    if (!gmmxxA) {
+        gmmxxA = storm::adapters::GmmxxAdapter<ValueType>::toGmmxxSparseMatrix(*this->A);
+    }
+    return *gmmxxA;
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat GmmxxLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     return LinearEquationSolverProblemFormat::EquationSystem;
@@ -138,17 +239,18 @@ template<typename ValueType>
 void GmmxxLinearEquationSolver<ValueType>::clearCache() const {
     iluPreconditioner.reset();
     diagonalPreconditioner.reset();
+    parallelKrylovSolver.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
 template<typename ValueType>
 uint64_t GmmxxLinearEquationSolver<ValueType>::getMatrixRowCount() const {
-    return gmmxxA->nr;
+    return A->getRowCount();
 }
 
 template<typename ValueType>
 uint64_t GmmxxLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
-    return gmmxxA->nc;
+    return A->getColumnCount();
 }
 
 template<typename ValueType>
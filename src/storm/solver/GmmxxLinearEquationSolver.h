@@ -7,12 +7,15 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/ParallelKrylovSolver.h"
 
 namespace storm {
 namespace solver {
 
 /*!
- * A class that uses the gmm++ library to implement the LinearEquationSolver interface.
+ * A class that uses the gmm++ library to implement the LinearEquationSolver interface. If several threads are available (see
+ * storm::utility::parallel::getDefaultNumberOfThreads), BiCGSTAB and GMRES are instead performed on the SparseMatrix by a ParallelKrylovSolver,
+ * which distributes the matrix-vector and vector operations over the threads. The matrix is only converted to gmm++'s format when gmm++ is used.
  */
 template<typename ValueType>
 class GmmxxLinearEquationSolver : public LinearEquationSolver<ValueType> {
@@ -24,6 +27,13 @@ class GmmxxLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
 
+    /*!
+     * Updates the diagonal preconditioner in the changed rows. A cached ILU preconditioner is kept as long as only few
+     * rows changed since it was computed: it then still approximates the inverse of the matrix well, and the iterative
+     * methods check convergence w.r.t. the new matrix anyway.
+     */
+    virtual void updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const& changedRows) override;
+
     virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
     virtual void clearCache() const override;
@@ -37,12 +47,32 @@ class GmmxxLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual uint64_t getMatrixRowCount() const override;
     virtual uint64_t getMatrixColumnCount() const override;
 
-    // The matrix in gmm++ format.
-    std::unique_ptr<gmm::csr_matrix<ValueType>> gmmxxA;
+    /*!
+     * Retrieves the matrix in gmm++ format, converting it first if necessary.
+     */
+    gmm::csr_matrix<ValueType> const& getGmmxxMatrix() const;
+
+    /*!
+     * Solves the equation system with the ParallelKrylovSolver.
+     */
+    bool solveEquationsParallel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    // If the solver is given ownership of the matrix, it is stored here.
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+    // A pointer to the original sparse matrix given to this solver. If the solver takes possession of the matrix
+    // the pointer refers to localA.
+    storm::storage::SparseMatrix<ValueType> const* A;
+
+    // The matrix in gmm++ format, which is converted lazily.
+    mutable std::unique_ptr<gmm::csr_matrix<ValueType>> gmmxxA;
 
     // cached data obtained during solving
     mutable std::unique_ptr<gmm::ilu_precond<gmm::csr_matrix<ValueType>>> iluPreconditioner;
     mutable std::unique_ptr<gmm::diagonal_precond<gmm::csr_matrix<ValueType>>> diagonalPreconditioner;
+    // The number of row changes since the ILU preconditioner was computed (rows that changed repeatedly are counted repeatedly).
+    mutable uint64_t rowChangesSinceIluPreconditioner = 0;
+    mutable std::unique_ptr<helper::ParallelKrylovSolver<ValueType>> parallelKrylovSolver;
 };
 
 template<typename ValueType>
@@ -288,6 +288,19 @@ void GurobiLpSolver<ValueType>::addConstraint(std::string const& name, storm::ex
                     "Could not assert constraint (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
 }
 
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    auto variableIndexPair = this->variableToIndexMap.find(variable);
+    STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidAccessException,
+                    "Changing objective function coefficient of unknown variable '" << variable.getName() << "'.");
+
+    // Gurobi keeps the basis of the previous optimization, so re-optimizing after this change is typically cheap.
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_OBJ, variableIndexPair->second, storm::utility::convertNumber<double>(objectiveFunctionCoefficient));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi objective function coefficient (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+    this->currentModelHasBeenOptimized = false;
+}
+
 template<typename ValueType>
 void GurobiLpSolver<ValueType>::optimize() const {
     // First incorporate all recent changes.
@@ -694,6 +707,22 @@ ValueType GurobiLpSolver<ValueType>::getMILPGap(bool relative) const {
     }
 }
 
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::setInitialValue(storm::expressions::Variable const& variable, ValueType const& value) {
+    auto variableIndexPair = this->variableToIndexMap.find(variable);
+    STORM_LOG_THROW(variableIndexPair != this->variableToIndexMap.end(), storm::exceptions::InvalidAccessException,
+                    "Setting start value of unknown variable '" << variable.getName() << "'.");
+    int error = GRBsetdblattrelement(model, GRB_DBL_ATTR_START, variableIndexPair->second, storm::utility::convertNumber<double>(value));
+    STORM_LOG_THROW(error == 0, storm::exceptions::InvalidStateException,
+                    "Unable to set Gurobi start value (" << GRBgeterrormsg(**environment) << ", error code " << error << ").");
+}
+
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::interrupt() {
+    // Gurobi explicitly allows terminating an optimization from another thread.
+    GRBterminate(model);
+}
+
 #else
 template<typename ValueType>
 GurobiLpSolver<ValueType>::GurobiLpSolver(std::shared_ptr<GurobiEnvironment> const&, std::string const&, OptimizationDirection const&) {
@@ -788,6 +817,12 @@ void GurobiLpSolver<ValueType>::addConstraint(std::string const&, storm::express
                                                           "requires this support. Please choose a version of support with Gurobi support.";
 }
 
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::setObjectiveFunctionCoefficient(storm::expressions::Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
 template<typename ValueType>
 void GurobiLpSolver<ValueType>::optimize() const {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
@@ -902,6 +937,18 @@ ValueType GurobiLpSolver<ValueType>::getMILPGap(bool) const {
                                                           "requires this support. Please choose a version of storm with Gurobi support.";
 }
 
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::setInitialValue(storm::expressions::Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
+template<typename ValueType>
+void GurobiLpSolver<ValueType>::interrupt() {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without support for Gurobi. Yet, a method was called that "
+                                                          "requires this support. Please choose a version of storm with Gurobi support.";
+}
+
 #endif
 
 std::string toString(GurobiSolverMethod const& method) {
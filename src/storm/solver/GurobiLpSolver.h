@@ -114,6 +114,9 @@ class GurobiLpSolver : public LpSolver<ValueType> {
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) override;
 
+    // Methods to change the objective function.
+    virtual void setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -134,6 +137,10 @@ class GurobiLpSolver : public LpSolver<ValueType> {
     virtual void setMaximalMILPGap(ValueType const& gap, bool relative) override;
     virtual ValueType getMILPGap(bool relative) const override;
 
+    virtual void setInitialValue(storm::expressions::Variable const& variable, ValueType const& value) override;
+
+    virtual void interrupt() override;
+
     // Methods to retrieve values of sub-optimal solutions found along the way.
     void setMaximalSolutionCount(uint64_t value);  // How many solutions will be stored (at max)
     uint64_t getSolutionCount() const;             // How many solutions have been found
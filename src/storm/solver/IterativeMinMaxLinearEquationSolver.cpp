@@ -4,17 +4,28 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/AnytimeBounds.h"
+#include "storm/solver/SolverCheckpoints.h"
+#include "storm/solver/SolverTelemetry.h"
+#include "storm/solver/helper/AsynchronousIntervalIterationHelper.h"
+#include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
+#include "storm/utility/MemoryUsage.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -47,7 +58,10 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
     auto method = env.solver().minMax().getMethod();
 
     if (isExactMode && method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::ViToPi) {
-        if (env.solver().minMax().isMethodSetFromDefault()) {
+        if (env.solver().minMax().isMethodSetFromDefault() && env.solver().isExactFloatFirst()) {
+            STORM_LOG_INFO("Selecting 'VI to PI' as the solution technique to obtain the policy in floating point arithmetic and verify it exactly.");
+            method = MinMaxMethod::ViToPi;
+        } else if (env.solver().minMax().isMethodSetFromDefault()) {
             STORM_LOG_INFO(
                 "Selecting 'Policy iteration' as the solution technique to guarantee exact results. If you want to override this, please explicitly specify a "
                 "different method.");
@@ -56,7 +70,8 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
             STORM_LOG_WARN("The selected solution method " << toString(method) << " does not guarantee exact results.");
         }
     } else if (env.solver().isForceSoundness() && method != MinMaxMethod::SoundValueIteration && method != MinMaxMethod::IntervalIteration &&
-               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration) {
+               method != MinMaxMethod::PolicyIteration && method != MinMaxMethod::RationalSearch && method != MinMaxMethod::OptimisticValueIteration &&
+               method != MinMaxMethod::AsynchronousIntervalIteration) {
         if (env.solver().minMax().isMethodSetFromDefault()) {
             method = MinMaxMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -67,9 +82,18 @@ MinMaxMethod IterativeMinMaxLinearEquationSolver<ValueType>::getMethod(Environme
             STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
         }
     }
+    if (!isExactMode && env.solver().minMax().isMixedPrecisionSet() && method != MinMaxMethod::IntervalIteration) {
+        if (env.solver().minMax().isMethodSetFromDefault()) {
+            STORM_LOG_INFO("Selecting 'interval iteration' as the solution technique as mixed precision is enabled.");
+            method = MinMaxMethod::IntervalIteration;
+        } else {
+            STORM_LOG_WARN("Mixed precision is only supported by interval iteration and is ignored for " << toString(method) << ".");
+        }
+    }
     STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
                         method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration ||
-                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi,
+                        method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi ||
+                        method == MinMaxMethod::AsynchronousIntervalIteration || method == MinMaxMethod::ModifiedPolicyIteration,
                     storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
     return method;
 }
@@ -78,7 +102,8 @@ template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                             std::vector<ValueType> const& b) const {
     bool result = false;
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    MinMaxMethod method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    switch (method) {
         case MinMaxMethod::ValueIteration:
             result = solveEquationsValueIteration(env, dir, x, b);
             break;
@@ -94,24 +119,110 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Envi
         case MinMaxMethod::IntervalIteration:
             result = solveEquationsIntervalIteration(env, dir, x, b);
             break;
+        case MinMaxMethod::AsynchronousIntervalIteration:
+            result = solveEquationsAsynchronousIntervalIteration(env, dir, x, b);
+            break;
         case MinMaxMethod::SoundValueIteration:
             result = solveEquationsSoundValueIteration(env, dir, x, b);
             break;
         case MinMaxMethod::ViToPi:
             result = solveEquationsViToPi(env, dir, x, b);
             break;
+        case MinMaxMethod::ModifiedPolicyIteration:
+            result = solveEquationsModifiedPolicyIteration(env, dir, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
 
+    // The sound methods record their bounds themselves. The results of the other methods give no guarantees if they are aborted.
+    bool soundMethod = method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::IntervalIteration ||
+                       method == MinMaxMethod::AsynchronousIntervalIteration || method == MinMaxMethod::SoundValueIteration;
+    if (!result && !soundMethod && storm::utility::resources::isTerminate()) {
+        AnytimeBounds::recordAbortedSolverWithoutBounds(env);
+    }
+
     return result;
 }
 
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir,
+                                                                                 std::vector<std::vector<ValueType>>& x,
+                                                                                 std::vector<std::vector<ValueType>> const& b) const {
+    MinMaxMethod method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    if (method != MinMaxMethod::ValueIteration || x.size() == 1 || this->hasInitialScheduler() || this->hasCustomTerminationCondition() ||
+        this->choiceFixedForRowGroup) {
+        return MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, dir, x, b);
+    }
+
+    if (!this->multiplierA) {
+        this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+    }
+
+    // Without a unique solution, start from the bound that makes the iteration converge to the correct fixed point.
+    if (!this->hasUniqueSolution()) {
+        for (auto& systemX : x) {
+            if (maximize(dir)) {
+                this->createLowerBoundsVector(systemX);
+            } else {
+                this->createUpperBoundsVector(systemX);
+            }
+        }
+    }
+
+    // Interleave the vectors such that the values of one state are adjacent. Note that the batched iteration always uses
+    // regular (Jacobi style) multiplications, since Gauss-Seidel updates would have to be performed per system.
+    uint64_t const batchSize = x.size();
+    uint64_t const rowGroupCount = this->A->getRowGroupCount();
+    uint64_t const rowCount = this->A->getRowCount();
+    std::vector<ValueType> currentX(rowGroupCount * batchSize);
+    std::vector<ValueType> newX(rowGroupCount * batchSize);
+    std::vector<ValueType> batchB(rowCount * batchSize);
+    for (uint64_t system = 0; system < batchSize; ++system) {
+        for (uint64_t group = 0; group < rowGroupCount; ++group) {
+            currentX[group * batchSize + system] = x[system][group];
+        }
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            batchB[row * batchSize + system] = b[system][row];
+        }
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    this->startMeasureProgress();
+    while (status == SolverStatus::InProgress) {
+        this->multiplierA->multiplyAndReduceBatch(env, dir, this->A->getRowGroupIndices(), batchSize, currentX, &batchB, newX);
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+        std::swap(currentX, newX);
+        ++iterations;
+        status = this->updateStatus(status, false, iterations, maximalNumberOfIterations);
+        this->showProgressIterative(iterations);
+    }
+    this->reportStatus(status, iterations);
+
+    for (uint64_t system = 0; system < batchSize; ++system) {
+        for (uint64_t group = 0; group < rowGroupCount; ++group) {
+            x[system][group] = currentX[group * batchSize + system];
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env,
                                                                                 std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
                                                                                 std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x,
-                                                                                std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+                                                                                std::vector<ValueType>& subB, std::vector<ValueType> const& originalB,
+                                                                                storm::storage::BitVector const* changedRowGroups) const {
     assert(subB.size() == x.size());
 
     // Resolve the nondeterminism according to the given scheduler.
@@ -130,6 +241,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(
         linearEquationSolver = this->linearEquationSolverFactory->create(env, std::move(submatrix));
         linearEquationSolver->setBoundsFromOtherSolver(*this);
         linearEquationSolver->setCachingEnabled(true);
+    } else if (changedRowGroups) {
+        // If only the choices of some row groups changed, the solver may update the data it derived from the matrix.
+        linearEquationSolver->updateMatrix(std::move(submatrix), *changedRowGroups);
     } else {
         // If the equation solver is already initialized, it suffices to update the matrix
         linearEquationSolver->setMatrix(std::move(submatrix));
@@ -153,7 +267,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
     // Get a vector for storing the right-hand side of the inner equation system.
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
     std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
@@ -182,13 +297,18 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
 
     SolverStatus status = SolverStatus::InProgress;
     uint64_t iterations = 0;
+    SolverTelemetryTracker telemetry(env, "IterativeMinMaxLinearEquationSolver", "policy iteration", *this->A);
     this->startMeasureProgress();
+    // The row groups whose choice changed in the last iteration, i.e. the rows in which consecutive induced matrices differ.
+    storm::storage::BitVector changedRowGroups(this->A->getRowGroupCount());
     do {
         // Solve the equation system for the 'DTMC'.
-        solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b, solver ? &changedRowGroups : nullptr);
+        changedRowGroups.clear();
 
         // Go through the multiplication result and see whether we can improve any of the choices.
         bool schedulerImproved = false;
+        uint64_t schedulerChanges = 0;
         // Group refers to the state number
         for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
             if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
@@ -216,6 +336,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
                         x[group] = std::move(choiceValue);
                     }
                 }
+                if (scheduler[group] != currentChoice) {
+                    ++schedulerChanges;
+                    changedRowGroups.set(group);
+                }
             }
         }
 
@@ -226,6 +350,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
 
         // Update environment variables.
         ++iterations;
+        telemetry.recordIteration(iterations, std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), schedulerChanges);
         status = this->updateStatus(status, x, dir == storm::OptimizationDirection::Minimize ? SolverGuarantee::GreaterOrEqual : SolverGuarantee::LessOrEqual,
                                     iterations, env.solver().minMax().getMaximalNumberOfIterations());
 
@@ -248,6 +373,108 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
 }
 
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsModifiedPolicyIteration(Environment const& env, OptimizationDirection dir,
+                                                                                           std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    // As for value iteration, we approach the smallest (largest) solution from below (above) if the solution is not unique.
+    SolverGuarantee guarantee = SolverGuarantee::None;
+    if (!this->hasUniqueSolution()) {
+        if (maximize(dir)) {
+            this->createLowerBoundsVector(x);
+            guarantee = SolverGuarantee::LessOrEqual;
+        } else {
+            this->createUpperBoundsVector(x);
+            guarantee = SolverGuarantee::GreaterOrEqual;
+        }
+    }
+
+    std::vector<uint64_t> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<uint64_t>(this->A->getRowGroupCount());
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    uint64_t maximalNumberOfSweeps = env.solver().minMax().getPolicyEvaluationSweeps();
+    auto computeRowValue = [this, &x, &b](uint64_t row) {
+        ValueType result = b[row];
+        for (auto const& entry : this->A->getRow(row)) {
+            result += entry.getValue() * x[entry.getColumn()];
+        }
+        return result;
+    };
+
+    SolverStatus status = SolverStatus::InProgress;
+    uint64_t iterations = 0;
+    uint64_t sweeps = 0;
+    SolverTelemetryTracker telemetry(env, "IterativeMinMaxLinearEquationSolver", "modified policy iteration", *this->A);
+    this->startMeasureProgress();
+    do {
+        // Improve the policy w.r.t. the current values, which are updated in place. Choices are only changed if this strictly
+        // improves the value, such that the policy does not alternate between equally good choices.
+        uint64_t schedulerChanges = 0;
+        bool valuesConverged = true;
+        for (uint64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+            uint64_t bestChoice = scheduler[group];
+            ValueType bestValue = computeRowValue(rowGroupIndices[group] + bestChoice);
+            if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+                for (uint64_t choice = 0; choice < rowGroupIndices[group + 1] - rowGroupIndices[group]; ++choice) {
+                    if (choice == scheduler[group]) {
+                        continue;
+                    }
+                    ValueType choiceValue = computeRowValue(rowGroupIndices[group] + choice);
+                    if (valueImproved(dir, bestValue, choiceValue)) {
+                        bestValue = std::move(choiceValue);
+                        bestChoice = choice;
+                    }
+                }
+            }
+            if (bestChoice != scheduler[group]) {
+                scheduler[group] = bestChoice;
+                ++schedulerChanges;
+            }
+            valuesConverged &= storm::utility::vector::equalModuloPrecision(x[group], bestValue, precision, relative);
+            x[group] = std::move(bestValue);
+        }
+        ++iterations;
+
+        if (schedulerChanges == 0 && valuesConverged) {
+            status = SolverStatus::Converged;
+        } else {
+            // Evaluate the policy approximately, starting from the values of the previous policy.
+            for (uint64_t sweep = 0; sweep < maximalNumberOfSweeps; ++sweep) {
+                bool sweepConverged = true;
+                for (uint64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+                    ValueType value = computeRowValue(rowGroupIndices[group] + scheduler[group]);
+                    sweepConverged &= storm::utility::vector::equalModuloPrecision(x[group], value, precision, relative);
+                    x[group] = std::move(value);
+                }
+                ++sweeps;
+                if (sweepConverged) {
+                    break;
+                }
+            }
+        }
+
+        telemetry.recordIteration(iterations, std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), schedulerChanges);
+        status = this->updateStatus(status, x, guarantee, iterations, env.solver().minMax().getMaximalNumberOfIterations());
+
+        // Potentially show progress.
+        this->showProgressIterative(iterations);
+    } while (status == SolverStatus::InProgress);
+
+    STORM_LOG_INFO("Number of iterations: " << iterations << " (with " << sweeps << " evaluation sweeps).");
+    this->reportStatus(status, iterations);
+
+    // If requested, we store the scheduler for retrieval.
+    if (this->isTrackSchedulerSet()) {
+        this->schedulerChoices = std::move(scheduler);
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const {
     if (dir == OptimizationDirection::Minimize) {
@@ -271,7 +498,8 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
                                                               ? MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env))
                                                               : MinMaxLinearEquationSolverRequirements();
 
-    if (method == MinMaxMethod::ValueIteration) {
+    if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::ModifiedPolicyIteration) {
+        // Modified policy iteration approaches the solution like value iteration, so it has the same requirements.
         if (!this->hasUniqueSolution()) {  // Traditional value iteration has no requirements if the solution is unique.
             // Computing a scheduler is only possible if the solution is unique
             if (this->isTrackSchedulerSet()) {
@@ -293,7 +521,7 @@ MinMaxLinearEquationSolverRequirements IterativeMinMaxLinearEquationSolver<Value
         }
         requirements.requireLowerBounds();
 
-    } else if (method == MinMaxMethod::IntervalIteration) {
+    } else if (method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::AsynchronousIntervalIteration) {
         // Interval iteration requires a unique solution and lower+upper bounds
         if (!this->hasUniqueSolution()) {
             requirements.requireUniqueSolution();
@@ -335,6 +563,7 @@ typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult It
     STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
                     "Fixing the scheduler choices in which choices are fixed is not implemented for value iteration, please pick a different solver");
     STORM_LOG_ASSERT(currentX != newX, "Vectors must not be aliased.");
+    STORM_PROFILE_SCOPE("value iteration");
 
     // Get handle to multiplier.
     storm::solver::Multiplier<ValueType> const& multiplier = *this->multiplierA;
@@ -344,31 +573,40 @@ typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult It
 
     // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
     uint64_t iterations = currentIterations;
+    SolverTelemetryTracker telemetry(env, "IterativeMinMaxLinearEquationSolver", "value iteration", *this->A);
+
+    // Continue from the latest checkpoint (if we are resuming). The restored iterate is a later iterate of the same sequence, so the guarantee still holds.
+    SolverCheckpointTracker<ValueType> checkpoints(env, "value iteration", *this->A, b);
+    checkpoints.restore({currentX}, iterations);
 
     SolverStatus status = SolverStatus::InProgress;
     while (status == SolverStatus::InProgress) {
-        // Compute x' = min/max(A*x + b).
+        // Compute x' = min/max(A*x + b) and determine whether the method converged in the same pass.
+        bool converged;
         if (useGaussSeidelMultiplication) {
             // Copy over the current vector so we can modify it in-place.
             *newX = *currentX;
-            multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+            converged = multiplier.multiplyAndReduceGaussSeidelWithConvergenceCheck(env, dir, *newX, &b, precision, relative);
         } else {
-            multiplier.multiplyAndReduce(env, dir, *currentX, &b, *newX);
+            converged = multiplier.multiplyAndReduceWithConvergenceCheck(env, dir, *currentX, &b, *newX, precision, relative);
         }
-
-        // Determine whether the method converged.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
+        if (converged) {
             status = SolverStatus::Converged;
         }
 
         // Update environment variables.
         std::swap(currentX, newX);
         ++iterations;
+        if (telemetry.isEnabled()) {
+            telemetry.recordIteration(iterations - currentIterations, SolverTelemetryTracker::computeMaxDiff(*currentX, *newX, relative));
+        }
         status = this->updateStatus(status, *currentX, guarantee, iterations, maximalNumberOfIterations);
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+        checkpoints.checkpoint({currentX}, iterations);
     }
+    checkpoints.finish({currentX}, iterations);
 
     return ValueIterationResult(iterations - currentIterations, status);
 }
@@ -407,7 +645,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
     if (!optimisticValueIterationHelper) {
         optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
@@ -425,6 +664,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsOptimisticVal
                                              storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
                                              env.solver().minMax().getMaximalNumberOfIterations(), dir, this->getOptionalRelevantValues(),
                                              this->choiceFixedForRowGroup, this->initialScheduler);
+    if (statusIters.first == SolverStatus::Aborted) {
+        // An aborted run may not have verified its guess for the upper bound yet.
+        if (helper.hasVerifiedUpperBound()) {
+            AnytimeBounds::recordAbortedSolver(env, *lowerX, *upperX);
+        } else {
+            AnytimeBounds::recordAbortedSolverWithoutBounds(env);
+        }
+    }
     auto two = storm::utility::convertNumber<ValueType>(2.0);
     storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
         *lowerX, *upperX, x, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
@@ -452,7 +699,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
 
     // By default, we can not provide any guarantee
@@ -556,7 +804,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
 
     // Allow aliased multiplications.
@@ -564,18 +813,33 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
     std::vector<ValueType>* lowerX = &x;
     this->createLowerBoundsVector(*lowerX);
-    this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
+    this->createUpperBoundsVector(env, this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
     std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
 
+    if (env.solver().minMax().isMixedPrecisionSet() && !storm::NumberTraits<ValueType>::IsExact) {
+        tightenBoundsWithSinglePrecision(env, dir, *lowerX, *upperX, b);
+    }
+
     std::vector<ValueType>* tmp = nullptr;
+    // When both bounds are improved, they are updated in a single pass over the matrix, which needs a second temporary vector.
+    WorkspaceVector<ValueType> upperTmpStorage;
+    std::vector<ValueType>* upperTmp = nullptr;
     if (!useGaussSeidelMultiplication) {
-        auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
+        auxiliaryRowGroupVector2 = SolverWorkspace::acquireVector<ValueType>(env, lowerX->size());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector2);
         tmp = auxiliaryRowGroupVector2.get();
+        upperTmpStorage = SolverWorkspace::acquireVector<ValueType>(env, lowerX->size());
+        storm::utility::memory::adviseMemory(*upperTmpStorage);
+        upperTmp = upperTmpStorage.get();
     }
 
     // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
     uint64_t iterations = 0;
 
+    // Continue with the bounds of the latest checkpoint (if we are resuming).
+    SolverCheckpointTracker<ValueType> checkpoints(env, "interval iteration", *this->A, b);
+    checkpoints.restore({lowerX, upperX}, iterations);
+
     SolverStatus status = SolverStatus::InProgress;
     bool doConvergenceCheck = true;
     bool useDiffs = this->hasRelevantValues() && !env.solver().minMax().isSymmetricUpdatesSet();
@@ -590,11 +854,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     if (!relative) {
         precision *= storm::utility::convertNumber<ValueType>(2.0);
     }
+    SolverTelemetryTracker telemetry(env, "IterativeMinMaxLinearEquationSolver", "interval iteration", *this->A);
     this->startMeasureProgress();
     while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
         // Remember in which directions we took steps in this iteration.
         bool lowerStep = false;
         bool upperStep = false;
+        // Set if the convergence of the bounds was already checked while updating them.
+        boost::optional<bool> boundsConverged;
 
         // In every thousandth iteration, we improve both bounds.
         if (iterations % 1000 == 0 || maxLowerDiff == maxUpperDiff) {
@@ -614,16 +881,16 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
                     maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                 }
             } else {
-                this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                bool converged = this->multiplierA->multiplyAndReduce2(env, dir, *lowerX, *upperX, &b, *tmp, *upperTmp, precision, relative);
+                if (!this->hasRelevantValues()) {
+                    boundsConverged = converged;
+                }
                 if (useDiffs) {
                     maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                    maxUpperDiff = computeMaxAbsDiff(*upperX, *upperTmp, this->getRelevantValues());
                 }
                 std::swap(lowerX, tmp);
-                this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
-                if (useDiffs) {
-                    maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                }
-                std::swap(upperX, tmp);
+                std::swap(upperX, upperTmp);
             }
         } else {
             // In the following iterations, we improve the bound with the greatest difference.
@@ -673,7 +940,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
         if (doConvergenceCheck) {
             // Determine whether the method converged.
-            if (this->hasRelevantValues()) {
+            if (boundsConverged) {
+                status = boundsConverged.get() ? SolverStatus::Converged : status;
+            } else if (this->hasRelevantValues()) {
                 status = storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *upperX, this->getRelevantValues(), precision, relative)
                              ? SolverStatus::Converged
                              : status;
@@ -684,6 +953,11 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
         // Update environment variables.
         ++iterations;
+        if (telemetry.isEnabled()) {
+            double maxDiff = useDiffs ? SolverTelemetryTracker::toDouble(std::max(maxLowerDiff, maxUpperDiff)) : std::numeric_limits<double>::quiet_NaN();
+            telemetry.recordIteration(iterations, maxDiff, SolverTelemetryTracker::computeMaxDiff(*upperX, *lowerX, relative), 0,
+                                      (lowerStep ? 1 : 0) + (upperStep ? 1 : 0));
+        }
         doConvergenceCheck = !doConvergenceCheck;
         if (lowerStep) {
             status = this->updateStatus(status, *lowerX, SolverGuarantee::LessOrEqual, iterations, env.solver().minMax().getMaximalNumberOfIterations());
@@ -694,9 +968,14 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+        checkpoints.checkpoint({lowerX, upperX}, iterations);
     }
+    checkpoints.finish({lowerX, upperX}, iterations);
 
     this->reportStatus(status, iterations);
+    if (status == SolverStatus::Aborted) {
+        AnytimeBounds::recordAbortedSolver(env, *lowerX, *upperX);
+    }
 
     // We take the means of the lower and upper bound so we guarantee the desired precision.
     ValueType two = storm::utility::convertNumber<ValueType>(2.0);
@@ -704,10 +983,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
         *lowerX, *upperX, *lowerX, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
 
     // Since we shuffled the pointer around, we need to write the actual results to the input/output vector x.
-    if (&x == tmp) {
-        std::swap(x, *tmp);
-    } else if (&x == this->auxiliaryRowGroupVector.get()) {
-        std::swap(x, *this->auxiliaryRowGroupVector);
+    if (lowerX != &x) {
+        std::swap(x, *lowerX);
     }
 
     // If requested, we store the scheduler for retrieval.
@@ -723,13 +1000,146 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     return status == SolverStatus::Converged;
 }
 
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsAsynchronousIntervalIteration(Environment const& env, OptimizationDirection dir,
+                                                                                                 std::vector<ValueType>& x,
+                                                                                                 std::vector<ValueType> const& b) const {
+    STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
+                    "Fixing scheduler choices not implemented for asynchronous interval iteration, please pick a different solver");
+    STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
+
+    if (!auxiliaryRowGroupVector) {
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
+    }
+    this->createLowerBoundsVector(x);
+    this->createUpperBoundsVector(env, this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
+
+    bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    if (!relative) {
+        precision *= storm::utility::convertNumber<ValueType>(2.0);
+    }
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    STORM_LOG_INFO("Solving min/max equation system (" << x.size() << " row groups) with asynchronous interval iteration on " << numberOfThreads
+                                                       << " threads.");
+
+    storm::solver::helper::AsynchronousIntervalIterationHelper<ValueType> helper(*this->A);
+    this->startMeasureProgress();
+    auto statusIters = helper.solveEquations(x, *auxiliaryRowGroupVector, b, relative, precision, env.solver().minMax().getMaximalNumberOfIterations(),
+                                             numberOfThreads, dir, this->getOptionalRelevantValues());
+    this->reportStatus(statusIters.first, statusIters.second);
+    if (statusIters.first == SolverStatus::Aborted) {
+        AnytimeBounds::recordAbortedSolver(env, x, *auxiliaryRowGroupVector);
+    }
+
+    // We take the means of the lower and upper bound so we guarantee the desired precision.
+    ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        x, *auxiliaryRowGroupVector, x, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+
+    // If requested, we store the scheduler for retrieval.
+    if (this->isTrackSchedulerSet()) {
+        this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+        this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector, &this->schedulerChoices.get());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return statusIters.first == SolverStatus::Converged;
+}
+
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::tightenBoundsWithSinglePrecision(Environment const&, OptimizationDirection, std::vector<ValueType>&,
+                                                                                      std::vector<ValueType>&, std::vector<ValueType> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Mixed precision is only supported for double precision.");
+}
+
+template<>
+void IterativeMinMaxLinearEquationSolver<double>::tightenBoundsWithSinglePrecision(Environment const& env, OptimizationDirection dir,
+                                                                                   std::vector<double>& lowerX, std::vector<double>& upperX,
+                                                                                   std::vector<double> const& b) const {
+    // Single precision can not resolve (relative) differences much below its machine epsilon.
+    float const precision = std::max(storm::utility::convertNumber<float>(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision())),
+                                     1e-6f);
+    uint64_t const maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+    bool const useGaussSeidelMultiplication = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+
+    // Perform value iteration in single precision, starting from the lower bound.
+    std::vector<double> estimate;
+    uint64_t iterations = 0;
+    {
+        storm::storage::SparseMatrix<float> impreciseA = this->A->template toValueType<float>();
+        std::unique_ptr<Multiplier<float>> impreciseMultiplier = std::make_unique<NativeMultiplier<float>>(impreciseA);
+        std::vector<float> impreciseB = storm::utility::vector::convertNumericVector<float>(b);
+        std::vector<float> impreciseX = storm::utility::vector::convertNumericVector<float>(lowerX);
+        std::vector<float> impreciseTmp(impreciseX.size());
+        bool converged = false;
+        while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+            if (useGaussSeidelMultiplication) {
+                impreciseTmp = impreciseX;
+                impreciseMultiplier->multiplyAndReduceGaussSeidel(env, dir, impreciseX, &impreciseB);
+            } else {
+                impreciseMultiplier->multiplyAndReduce(env, dir, impreciseX, &impreciseB, impreciseTmp);
+                std::swap(impreciseX, impreciseTmp);
+            }
+            converged = storm::utility::vector::equalModuloPrecision<float>(impreciseTmp, impreciseX, precision, true);
+            ++iterations;
+        }
+        estimate = storm::utility::vector::convertNumericVector<double>(impreciseX);
+    }
+
+    // Derive candidate bounds from the estimate and keep those that can be verified.
+    double const margin = 2.0 * static_cast<double>(precision);
+    std::vector<double> candidate(estimate.size());
+    storm::utility::vector::applyPointwise(estimate, candidate, [margin](double const& value) { return value - margin * std::abs(value); });
+    bool lowerVerified = tryVerifyBound(env, dir, candidate, b, true);
+    if (lowerVerified) {
+        storm::utility::vector::applyPointwise<double, double, double>(lowerX, candidate, lowerX,
+                                                                       [](double const& a, double const& c) { return std::max(a, c); });
+    }
+    storm::utility::vector::applyPointwise(estimate, candidate, [margin](double const& value) { return value + margin * std::abs(value); });
+    bool upperVerified = tryVerifyBound(env, dir, candidate, b, false);
+    if (upperVerified) {
+        storm::utility::vector::applyPointwise<double, double, double>(upperX, candidate, upperX,
+                                                                       [](double const& a, double const& c) { return std::min(a, c); });
+    }
+    STORM_LOG_INFO("Performed " << iterations << " iterations in single precision. The derived lower bound was " << (lowerVerified ? "" : "not ")
+                                << "verified, the derived upper bound was " << (upperVerified ? "" : "not ") << "verified.");
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::tryVerifyBound(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& candidate,
+                                                                    std::vector<ValueType> const& b, bool lowerBound) const {
+    // As the solution is unique, every x with x <= f(x) (resp. x >= f(x)) is a lower (resp. upper) bound, where f is the Bellman operator.
+    // Entries violating this are replaced by their value under f. This converges to such a vector, so a few sweeps usually suffice.
+    uint64_t const maximalNumberOfSweeps = 100;
+    std::vector<ValueType> image(candidate.size());
+    for (uint64_t sweep = 0; sweep < maximalNumberOfSweeps; ++sweep) {
+        this->multiplierA->multiplyAndReduce(env, dir, candidate, &b, image);
+        bool verified = true;
+        for (uint64_t index = 0; index < candidate.size(); ++index) {
+            if (lowerBound ? image[index] < candidate[index] : image[index] > candidate[index]) {
+                candidate[index] = image[index];
+                verified = false;
+            }
+        }
+        if (verified) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir,
                                                                                        std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
     // Prepare the solution vectors and the helper.
     assert(x.size() == this->A->getRowGroupCount());
     if (!this->auxiliaryRowGroupVector) {
-        this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>();
+        this->auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, x.size());
     }
     if (!this->soundValueIterationHelper) {
         this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(
@@ -740,6 +1150,8 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
             std::move(*this->soundValueIterationHelper), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(),
             storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
     }
+    this->soundValueIterationHelper->setNumberOfThreads(storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads()),
+                                                        env.solver().multiplier().getGaussSeidelBlockSize());
 
     // Prepare initial bounds for the solution (if given)
     if (this->hasLowerBound()) {
@@ -755,6 +1167,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
     }
 
     SolverStatus status = SolverStatus::InProgress;
+    SolverTelemetryTracker telemetry(env, "IterativeMinMaxLinearEquationSolver", "sound value iteration", *this->A);
     this->startMeasureProgress();
     uint64_t iterations = 0;
 
@@ -765,7 +1178,9 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
         } else {
             this->soundValueIterationHelper->performIterationStep(dir, b);
         }
-        if (this->soundValueIterationHelper->checkConvergenceUpdateBounds(dir, relevantValuesPtr)) {
+        bool converged = this->soundValueIterationHelper->checkConvergenceUpdateBounds(dir, relevantValuesPtr);
+        telemetry.recordIteration(iterations, std::numeric_limits<double>::quiet_NaN(), this->soundValueIterationHelper->getBoundsGap());
+        if (converged) {
             status = SolverStatus::Converged;
         } else {
             status = this->updateStatus(
@@ -777,6 +1192,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIte
         // Potentially show progress.
         this->showProgressIterative(iterations);
     }
+    if (status == SolverStatus::Aborted) {
+        // The solution is computed from the mean of both bounds, so it is within half of their distance of the exact solution.
+        AnytimeBounds::recordAbortedSolver(env, this->soundValueIterationHelper->getBoundsGap() / 2.0);
+    }
     this->soundValueIterationHelper->setSolutionVector();
 
     // If requested, we store the scheduler for retrieval.
@@ -802,6 +1221,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
     {
         Environment viEnv = env;
         viEnv.solver().minMax().setMethod(MinMaxMethod::ValueIteration);
+        viEnv.solver().setForceExact(false);
         auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->A->template toValueType<double>());
         impreciseSolver->setHasUniqueSolution(this->hasUniqueSolution());
         impreciseSolver->setTrackScheduler(true);
@@ -816,6 +1236,7 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsViToPi(Enviro
         impreciseSolver->solveEquations(viEnv, dir, xVi, bVi);
         initialSched = impreciseSolver->getSchedulerChoices();
     }
+    // Policy iteration evaluates the policy exactly (if needed) and only performs further improvements if the policy is not optimal.
     STORM_LOG_INFO("Found initial policy using Value Iteration. Starting Policy iteration now.");
     return performPolicyIteration(env, dir, x, b, std::move(initialSched));
 }
@@ -887,7 +1308,8 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
 
     // Forward the call to the core rational search routine.
@@ -919,7 +1341,8 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
     }
 
     if (!auxiliaryRowGroupVector) {
-        auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+        auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+        storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
     }
 
     // Forward the call to the core rational search routine.
@@ -983,7 +1406,8 @@ IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelp
         STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
 
         if (!auxiliaryRowGroupVector) {
-            auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
+            storm::utility::memory::adviseMemory(*auxiliaryRowGroupVector);
         }
 
         // Translate the imprecise value iteration result to the one we are going to use from now on.
@@ -1155,6 +1579,9 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::computeOptimalValueForRowGr
 
 template<typename ValueType>
 void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+    if (uint64_t cacheSize = getCacheSizeInBytes()) {
+        STORM_LOG_INFO("Releasing " << storm::utility::formatBytes(cacheSize) << " of solver workspace.");
+    }
     multiplierA.reset();
     auxiliaryRowGroupVector.reset();
     auxiliaryRowGroupVector2.reset();
@@ -1163,6 +1590,19 @@ void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
+template<typename ValueType>
+uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::getCacheSizeInBytes() const {
+    // The helpers and the multiplier are not taken into account.
+    uint64_t result = StandardMinMaxLinearEquationSolver<ValueType>::getCacheSizeInBytes();
+    if (auxiliaryRowGroupVector) {
+        result += auxiliaryRowGroupVector->capacity() * sizeof(ValueType);
+    }
+    if (auxiliaryRowGroupVector2) {
+        result += auxiliaryRowGroupVector2->capacity() * sizeof(ValueType);
+    }
+    return result;
+}
+
 template class IterativeMinMaxLinearEquationSolver<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -30,7 +30,15 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     virtual bool internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                         std::vector<ValueType> const& b) const override;
 
+    /*!
+     * If value iteration is selected, all systems are solved by a single value iteration that performs the
+     * multiplications for all right-hand sides in one pass over the matrix. Otherwise, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection dir, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const override;
+
     virtual void clearCache() const override;
+    virtual uint64_t getCacheSizeInBytes() const override;
 
     virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env,
                                                                    boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none,
@@ -41,16 +49,36 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
                                     std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB,
-                                    std::vector<ValueType> const& originalB) const;
+                                    std::vector<ValueType> const& originalB, storm::storage::BitVector const* changedRowGroups = nullptr) const;
     bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
     bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
 
+    /*!
+     * Solves the equations with modified policy iteration: Each policy is evaluated with a bounded number of (in-place)
+     * sweeps that start from the values of the previous policy. The rows of the current policy are read directly from
+     * the matrix, so no matrix is built for the induced systems.
+     */
+    bool solveEquationsModifiedPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                               std::vector<ValueType> const& b) const;
+
     bool solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool solveEquationsOptimisticValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                 std::vector<ValueType> const& b) const;
     bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    bool solveEquationsAsynchronousIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                     std::vector<ValueType> const& b) const;
+
+    /*!
+     * Tightens the given bounds for interval iteration: value iteration is performed in single precision and the bounds derived from its result
+     * are verified in the precision of the value type. Bounds that can not be verified are left unchanged, so the guarantees of interval
+     * iteration are preserved.
+     */
+    void tightenBoundsWithSinglePrecision(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX,
+                                          std::vector<ValueType> const& b) const;
+    bool tryVerifyBound(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& candidate, std::vector<ValueType> const& b,
+                        bool lowerBound) const;
     bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
@@ -104,8 +132,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
 
     // possibly cached data
     mutable std::unique_ptr<storm::solver::Multiplier<ValueType>> multiplierA;
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;   // A.rowGroupCount() entries
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2;  // A.rowGroupCount() entries
+    mutable WorkspaceVector<ValueType> auxiliaryRowGroupVector;   // A.rowGroupCount() entries
+    mutable WorkspaceVector<ValueType> auxiliaryRowGroupVector2;  // A.rowGroupCount() entries
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
 };
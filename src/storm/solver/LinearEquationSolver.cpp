@@ -14,8 +14,10 @@
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -28,9 +30,35 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_PROFILE_SCOPE("LinearEquationSolver::solveEquations");
     return this->internalSolveEquations(env, x, b);
 }
 
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                          std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors and right-hand sides differ.");
+    if (x.empty()) {
+        return true;
+    }
+    return this->internalSolveEquationsBatch(env, x, b);
+}
+
+template<typename ValueType>
+bool LinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                  std::vector<std::vector<ValueType>> const& b) const {
+    bool result = true;
+    for (uint64_t system = 0; system < x.size(); ++system) {
+        result &= this->internalSolveEquations(env, x[system], b[system]);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void LinearEquationSolver<ValueType>::updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const&) {
+    setMatrix(std::move(A));
+}
+
 template<typename ValueType>
 LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
     return LinearEquationSolverRequirements();
@@ -55,6 +83,11 @@ void LinearEquationSolver<ValueType>::clearCache() const {
     cachedRowVector.reset();
 }
 
+template<typename ValueType>
+uint64_t LinearEquationSolver<ValueType>::getCacheSizeInBytes() const {
+    return cachedRowVector ? cachedRowVector->capacity() * sizeof(ValueType) : 0;
+}
+
 template<typename ValueType>
 std::unique_ptr<LinearEquationSolver<ValueType>> LinearEquationSolverFactory<ValueType>::create(Environment const& env,
                                                                                                 storm::storage::SparseMatrix<ValueType> const& matrix) const {
@@ -90,6 +123,12 @@ template<>
 std::unique_ptr<LinearEquationSolver<storm::RationalNumber>> GeneralLinearEquationSolverFactory<storm::RationalNumber>::create(Environment const& env) const {
     EquationSolverType type = env.solver().getLinearEquationSolverType();
 
+    // Solve the SCCs in floating point arithmetic first if requested. The solutions are verified (and repaired) exactly.
+    if (env.solver().isExactFloatFirst() && env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
+        type = EquationSolverType::Topological;
+        STORM_LOG_INFO("Selecting '" + toString(type) + "' as the linear equation solver to solve in floating point arithmetic first.");
+    }
+
     // Adjust the solver type if it is not supported by this value type
     if (type != EquationSolverType::Eigen && type != EquationSolverType::Topological && type != EquationSolverType::Acyclic &&
         (env.solver().isLinearEquationSolverTypeSetFromDefaultValue() || type == EquationSolverType::Gmmxx)) {
@@ -156,7 +195,7 @@ std::unique_ptr<LinearEquationSolver<ValueType>> GeneralLinearEquationSolverFact
     if (env.solver().isForceExact() && type != EquationSolverType::Native && type != EquationSolverType::Eigen && type != EquationSolverType::Elimination &&
         type != EquationSolverType::Topological && type != EquationSolverType::Acyclic) {
         if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
-            type = EquationSolverType::Eigen;
+            type = env.solver().isExactFloatFirst() ? EquationSolverType::Topological : EquationSolverType::Eigen;
             STORM_LOG_INFO(
                 "Selecting '" + toString(type) +
                 "' as the linear equation solver to guarantee exact results. If you want to override this, please explicitly specify a different solver.");
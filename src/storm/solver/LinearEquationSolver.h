@@ -12,6 +12,7 @@
 
 #include "storm/utility/VectorHelper.h"
 
+#include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace storm {
@@ -35,6 +36,16 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) = 0;
     virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) = 0;
 
+    /*!
+     * Replaces the matrix by the given one that only differs from the current matrix in the given rows (as, for example,
+     * the matrices induced by two consecutive schedulers of a policy iteration). Solvers may use this to update the data
+     * they cached for the current matrix instead of recomputing it. By default, this is the same as setMatrix.
+     *
+     * @param A The new matrix. Its dimensions have to match the ones of the current matrix.
+     * @param changedRows The rows in which the new matrix differs from the current one.
+     */
+    virtual void updateMatrix(storm::storage::SparseMatrix<ValueType>&& A, storm::storage::BitVector const& changedRows);
+
     /*!
      * If the solver expects the equation system format, it solves Ax = b. If it it expects a fixed point
      * format, it solves Ax + b = x. In both versions, the matrix A is required to be square and the problem
@@ -48,6 +59,19 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation systems given by the matrix A of this solver and each of the given right-hand sides b_1, ..., b_k, see solveEquations.
+     * Depending on the solver, the matrix is traversed only once per iteration for all systems. Bounds that are set for this solver have to be
+     * valid for each of the systems.
+     *
+     * @param x The solution vectors that have to be computed. Each vector has to be initialized (e.g. with an initial guess) and its length must
+     * be equal to the number of rows of A.
+     * @param b The right-hand sides. There has to be one for each solution vector.
+     *
+     * @return true iff all systems were solved
+     */
+    bool solveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x, std::vector<std::vector<ValueType>> const& b) const;
+
     /*!
      * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
      * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -76,11 +100,22 @@ class LinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     virtual void clearCache() const;
 
+    /*!
+     * Retrieves the number of bytes of the data that is currently cached by the solver (its workspace).
+     */
+    virtual uint64_t getCacheSizeInBytes() const;
+
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves the given equation systems. By default, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const;
+
     // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
-    mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
+    mutable WorkspaceVector<ValueType> cachedRowVector;
 
    private:
     /*!
@@ -37,41 +37,30 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     STORM_LOG_THROW(env.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming, storm::exceptions::InvalidEnvironmentException,
                     "This min max solver does not support the selected technique.");
 
-    // Set up the LP solver
-    std::unique_ptr<storm::solver::LpSolver<ValueType>> solver = lpSolverFactory->create("");
-    solver->setOptimizationDirection(invert(dir));
-    // Create a variable for each row group
-    std::vector<storm::expressions::Expression> variableExpressions;
-    variableExpressions.reserve(this->A->getRowGroupCount());
-    for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
-        if (this->hasLowerBound()) {
-            ValueType lowerBound = this->getLowerBound(rowGroup);
-            if (this->hasUpperBound()) {
-                ValueType upperBound = this->getUpperBound(rowGroup);
-                if (lowerBound == upperBound) {
-                    // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
-                    // efficient anyways.
-                    variableExpressions.push_back(solver->getConstant(lowerBound));
-                } else {
-                    STORM_LOG_ASSERT(lowerBound <= upperBound,
-                                     "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
-                    variableExpressions.emplace_back(
-                        solver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
-                }
-            } else {
-                variableExpressions.emplace_back(
-                    solver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
-            }
-        } else {
-            if (this->upperBound) {
-                variableExpressions.emplace_back(
-                    solver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), this->getUpperBound(rowGroup), storm::utility::one<ValueType>()));
-            } else {
-                variableExpressions.emplace_back(solver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
-            }
+    // Collect the bounds of the variables. An empty vector indicates that there is no such bound.
+    std::vector<ValueType> lowerBounds, upperBounds;
+    if (this->hasLowerBound()) {
+        lowerBounds.reserve(this->A->getRowGroupCount());
+        for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+            lowerBounds.push_back(this->getLowerBound(rowGroup));
+        }
+    }
+    if (this->hasUpperBound()) {
+        upperBounds.reserve(this->A->getRowGroupCount());
+        for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+            upperBounds.push_back(this->getUpperBound(rowGroup));
         }
     }
-    solver->update();
+
+    // Set up the LP solver. If the variables of the previous call can be reused, we only remove its constraints.
+    if (lpSolver && variableExpressions.size() == this->A->getRowGroupCount() && lowerBounds == lpSolverLowerBounds && upperBounds == lpSolverUpperBounds) {
+        STORM_LOG_TRACE("Reusing the variables of the previously created LP.");
+        lpSolver->pop();
+    } else {
+        createLpSolver(lowerBounds, upperBounds);
+    }
+    lpSolver->setOptimizationDirection(invert(dir));
+    lpSolver->push();
 
     // Add a constraint for each row
     for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
@@ -88,9 +77,9 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
             auto row = this->A->getRow(rowIndex);
             std::vector<storm::expressions::Expression> summands;
             summands.reserve(1 + row.getNumberOfEntries());
-            summands.push_back(solver->getConstant(b[rowIndex]));
+            summands.push_back(lpSolver->getConstant(b[rowIndex]));
             for (auto const& entry : row) {
-                summands.push_back(solver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
+                summands.push_back(lpSolver->getConstant(entry.getValue()) * variableExpressions[entry.getColumn()]);
             }
             storm::expressions::Expression rowConstraint = storm::expressions::sum(summands);
             if (minimize(dir)) {
@@ -98,15 +87,15 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
             } else {
                 rowConstraint = variableExpressions[rowGroup] >= rowConstraint;
             }
-            solver->addConstraint("", rowConstraint);
+            lpSolver->addConstraint("", rowConstraint);
         }
     }
 
     // Invoke optimization
-    solver->optimize();
-    STORM_LOG_THROW(!solver->isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
-    STORM_LOG_THROW(!solver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
-    STORM_LOG_THROW(solver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
+    lpSolver->optimize();
+    STORM_LOG_THROW(!lpSolver->isInfeasible(), storm::exceptions::UnexpectedException, "The MinMax equation system is infeasible.");
+    STORM_LOG_THROW(!lpSolver->isUnbounded(), storm::exceptions::UnexpectedException, "The MinMax equation system is unbounded.");
+    STORM_LOG_THROW(lpSolver->isOptimal(), storm::exceptions::UnexpectedException, "Unable to find optimal solution for MinMax equation system.");
 
     // write the solution into the solution vector
     STORM_LOG_ASSERT(x.size() == variableExpressions.size(), "Dimension of x-vector does not match number of varibales.");
@@ -115,7 +104,7 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     for (; xIt != x.end(); ++xIt, ++vIt) {
         auto const& vBaseExpr = vIt->getBaseExpression();
         if (vBaseExpr.isVariable()) {
-            *xIt = solver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
+            *xIt = lpSolver->getContinuousValue(vBaseExpr.asVariableExpression().getVariable());
         } else {
             STORM_LOG_ASSERT(vBaseExpr.isRationalLiteralExpression(), "Variable expression has unexpected type.");
             *xIt = storm::utility::convertNumber<ValueType>(vBaseExpr.asRationalLiteralExpression().getValue());
@@ -146,8 +135,52 @@ bool LpMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment
     return true;
 }
 
+template<typename ValueType>
+void LpMinMaxLinearEquationSolver<ValueType>::createLpSolver(std::vector<ValueType> const& lowerBounds, std::vector<ValueType> const& upperBounds) const {
+    lpSolver = lpSolverFactory->create("");
+    lpSolverLowerBounds = lowerBounds;
+    lpSolverUpperBounds = upperBounds;
+
+    // Create a variable for each row group
+    variableExpressions.clear();
+    variableExpressions.reserve(this->A->getRowGroupCount());
+    for (uint64_t rowGroup = 0; rowGroup < this->A->getRowGroupCount(); ++rowGroup) {
+        if (!lowerBounds.empty()) {
+            ValueType const& lowerBound = lowerBounds[rowGroup];
+            if (!upperBounds.empty()) {
+                ValueType const& upperBound = upperBounds[rowGroup];
+                if (lowerBound == upperBound) {
+                    // Some solvers (like glpk) don't support variables with bounds [x,x]. We therefore just use a constant instead. This should be more
+                    // efficient anyways.
+                    variableExpressions.push_back(lpSolver->getConstant(lowerBound));
+                } else {
+                    STORM_LOG_ASSERT(lowerBound <= upperBound,
+                                     "Lower Bound at row group " << rowGroup << " is " << lowerBound << " which exceeds the upper bound " << upperBound << ".");
+                    variableExpressions.emplace_back(
+                        lpSolver->addBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, upperBound, storm::utility::one<ValueType>()));
+                }
+            } else {
+                variableExpressions.emplace_back(
+                    lpSolver->addLowerBoundedContinuousVariable("x" + std::to_string(rowGroup), lowerBound, storm::utility::one<ValueType>()));
+            }
+        } else {
+            if (!upperBounds.empty()) {
+                variableExpressions.emplace_back(
+                    lpSolver->addUpperBoundedContinuousVariable("x" + std::to_string(rowGroup), upperBounds[rowGroup], storm::utility::one<ValueType>()));
+            } else {
+                variableExpressions.emplace_back(lpSolver->addUnboundedContinuousVariable("x" + std::to_string(rowGroup), storm::utility::one<ValueType>()));
+            }
+        }
+    }
+    lpSolver->update();
+}
+
 template<typename ValueType>
 void LpMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+    lpSolver.reset();
+    variableExpressions.clear();
+    lpSolverLowerBounds.clear();
+    lpSolverUpperBounds.clear();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -2,6 +2,7 @@
 
 #include "storm/solver/LpSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+#include "storm/storage/expressions/Expression.h"
 #include "storm/utility/solver.h"
 
 namespace storm {
@@ -29,7 +30,19 @@ class LpMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<V
                                                                    bool const& hasInitialScheduler = false) const override;
 
    private:
+    /*!
+     * Creates a new LP solver with one variable for each row group (or a constant if the bounds of the row group coincide).
+     */
+    void createLpSolver(std::vector<ValueType> const& lowerBounds, std::vector<ValueType> const& upperBounds) const;
+
     std::unique_ptr<storm::utility::solver::LpSolverFactory<ValueType>> lpSolverFactory;
+
+    // The LP solver used in the most recent call, the expressions representing its variables and the bounds of the variables.
+    // The variables are reused as long as the bounds do not change, only the constraints are rebuilt.
+    mutable std::unique_ptr<storm::solver::LpSolver<ValueType>> lpSolver;
+    mutable std::vector<storm::expressions::Expression> variableExpressions;
+    mutable std::vector<ValueType> lpSolverLowerBounds;
+    mutable std::vector<ValueType> lpSolverUpperBounds;
 };
 
 }  // namespace solver
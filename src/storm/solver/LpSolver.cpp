@@ -60,6 +60,16 @@ storm::expressions::Expression LpSolver<ValueType>::getConstant(ValueType value)
     return manager->rational(value);
 }
 
+template<typename ValueType>
+void LpSolver<ValueType>::setInitialValue(storm::expressions::Variable const&, ValueType const&) {
+    // Intentionally left empty: By default, initial solutions are not supported.
+}
+
+template<typename ValueType>
+void LpSolver<ValueType>::interrupt() {
+    // Intentionally left empty: By default, interruption is not supported.
+}
+
 template class LpSolver<double>;
 template class LpSolver<storm::RationalNumber>;
 
@@ -187,6 +187,16 @@ class LpSolver {
      */
     virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) = 0;
 
+    /*!
+     * Changes the coefficient with which the given (already registered) variable appears in the objective function.
+     * In contrast to rebuilding the LP problem, this allows the solver to start the next optimization from the previous
+     * solution. The change is not reverted by a call to pop().
+     *
+     * @param variable The variable whose coefficient is changed.
+     * @param objectiveFunctionCoefficient The new coefficient of the variable in the objective function.
+     */
+    virtual void setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) = 0;
+
     /*!
      * Optimizes the LP problem previously constructed. Afterwards, the methods isInfeasible, isUnbounded and
      * isOptimal can be used to query the optimality status.
@@ -315,6 +325,19 @@ class LpSolver {
      */
     virtual ValueType getMILPGap(bool relative) const = 0;
 
+    /*!
+     * Provides a start value for the given variable. The solver might use the start values as (part of) an initial solution
+     * of a program with integer/boolean variables. Start values for only some of the variables are allowed.
+     * Solvers that do not support initial solutions ignore the given value.
+     */
+    virtual void setInitialValue(storm::expressions::Variable const& variable, ValueType const& value);
+
+    /*!
+     * Requests the termination of a running call to optimize(). In contrast to all other methods, this method may be called from another thread.
+     * The solution obtained by an interrupted call to optimize() is not meaningful. Solvers that do not support interruption ignore the request.
+     */
+    virtual void interrupt();
+
    protected:
     // The manager responsible for the variables.
     std::shared_ptr<storm::expressions::ExpressionManager> manager;
@@ -6,14 +6,17 @@
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/LpMinMaxLinearEquationSolver.h"
+#include "storm/solver/PortfolioMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalCudaMinMaxLinearEquationSolver.h"
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -36,6 +39,7 @@ bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
+    STORM_PROFILE_SCOPE("MinMaxLinearEquationSolver::solveEquations");
     return internalSolveEquations(env, d, x, b);
 }
 
@@ -45,6 +49,32 @@ void MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     solveEquations(env, convert(this->direction), x, b);
 }
 
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                                                std::vector<std::vector<ValueType>> const& b) const {
+    STORM_LOG_THROW(x.size() == b.size(), storm::exceptions::IllegalArgumentException, "The number of solution vectors and right-hand sides differ.");
+    STORM_LOG_THROW(!this->isTrackSchedulerSet(), storm::exceptions::IllegalFunctionCallException,
+                    "Schedulers can not be tracked when solving several equation systems at once.");
+    STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
+                              "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
+                              "as checked (if applicable).");
+    if (x.empty()) {
+        return true;
+    }
+    STORM_PROFILE_SCOPE("MinMaxLinearEquationSolver::solveEquationsBatch");
+    return internalSolveEquationsBatch(env, d, x, b);
+}
+
+template<typename ValueType>
+bool MinMaxLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                                                        std::vector<std::vector<ValueType>> const& b) const {
+    bool result = true;
+    for (uint64_t system = 0; system < x.size(); ++system) {
+        result &= internalSolveEquations(env, d, x[system], b[system]);
+    }
+    return result;
+}
+
 template<typename ValueType>
 void MinMaxLinearEquationSolver<ValueType>::setOptimizationDirection(OptimizationDirection d) {
     direction = convert(d);
@@ -130,6 +160,11 @@ void MinMaxLinearEquationSolver<ValueType>::clearCache() const {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+uint64_t MinMaxLinearEquationSolver<ValueType>::getCacheSizeInBytes() const {
+    return 0;
+}
+
 template<typename ValueType>
 void MinMaxLinearEquationSolver<ValueType>::setInitialScheduler(std::vector<uint_fast64_t>&& choices) {
     initialScheduler = std::move(choices);
@@ -221,7 +256,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquati
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsynchronousIntervalIteration || method == MinMaxMethod::ModifiedPolicyIteration) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<ValueType>>(std::make_unique<GeneralLinearEquationSolverFactory<ValueType>>());
     } else if (method == MinMaxMethod::Topological) {
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<ValueType>>();
@@ -231,6 +266,8 @@ std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> GeneralMinMaxLinearEquati
         result = std::make_unique<LpMinMaxLinearEquationSolver<ValueType>>(storm::utility::solver::getLpSolverFactory<ValueType>());
     } else if (method == MinMaxMethod::Acyclic) {
         result = std::make_unique<AcyclicMinMaxLinearEquationSolver<ValueType>>();
+    } else if (method == MinMaxMethod::Portfolio) {
+        result = std::make_unique<PortfolioMinMaxLinearEquationSolver<ValueType>>();
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
     }
@@ -245,7 +282,7 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
     auto method = env.solver().minMax().getMethod();
     if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch ||
         method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::OptimisticValueIteration ||
-        method == MinMaxMethod::ViToPi) {
+        method == MinMaxMethod::ViToPi || method == MinMaxMethod::AsynchronousIntervalIteration || method == MinMaxMethod::ModifiedPolicyIteration) {
         result = std::make_unique<IterativeMinMaxLinearEquationSolver<storm::RationalNumber>>(
             std::make_unique<GeneralLinearEquationSolverFactory<storm::RationalNumber>>());
     } else if (method == MinMaxMethod::LinearProgramming) {
@@ -254,6 +291,8 @@ std::unique_ptr<MinMaxLinearEquationSolver<storm::RationalNumber>> GeneralMinMax
         result = std::make_unique<AcyclicMinMaxLinearEquationSolver<storm::RationalNumber>>();
     } else if (method == MinMaxMethod::Topological) {
         result = std::make_unique<TopologicalMinMaxLinearEquationSolver<storm::RationalNumber>>();
+    } else if (method == MinMaxMethod::Portfolio) {
+        result = std::make_unique<PortfolioMinMaxLinearEquationSolver<storm::RationalNumber>>();
     } else {
         STORM_LOG_THROW(false, storm::exceptions::InvalidSettingsException, "Unsupported technique.");
     }
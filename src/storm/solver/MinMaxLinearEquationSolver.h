@@ -61,6 +61,19 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     void solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+    /*!
+     * Solves the equation systems x_j = min/max(A*x_j + b_j) for several right-hand sides b_1, ..., b_k that share the
+     * matrix A. Solvers may exploit this by traversing the matrix only once per iteration for all systems. Schedulers
+     * can not be tracked when solving several systems at once.
+     *
+     * @param d The optimization direction for all systems.
+     * @param x The solution vectors (one per system). The initial values represent a guess of the real values.
+     * @param b The right-hand sides (one per system).
+     * @return True if all systems were solved successfully.
+     */
+    bool solveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                             std::vector<std::vector<ValueType>> const& b) const;
+
     /*!
      * Sets an optimization direction to use for calls to methods that do not explicitly provide one.
      */
@@ -143,6 +156,11 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
      */
     virtual void clearCache() const;
 
+    /*!
+     * Retrieves the number of bytes of the data that is currently cached by the solver (its workspace).
+     */
+    virtual uint64_t getCacheSizeInBytes() const;
+
     /*!
      * Sets a valid initial scheduler that is required by some solvers (see requirements of solvers).
      */
@@ -180,6 +198,12 @@ class MinMaxLinearEquationSolver : public AbstractEquationSolver<ValueType> {
    protected:
     virtual bool internalSolveEquations(Environment const& env, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
 
+    /*!
+     * Solves several equation systems with the same matrix. By default, the systems are solved one after another.
+     */
+    virtual bool internalSolveEquationsBatch(Environment const& env, OptimizationDirection d, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const;
+
     /// The optimization direction to use for calls to functions that do not provide it explicitly. Can also be unset.
     OptimizationDirectionSetting direction;
 
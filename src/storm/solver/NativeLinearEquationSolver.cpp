@@ -1,7 +1,9 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include <algorithm>
 #include <limits>
 
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -9,14 +11,22 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/AnytimeBounds.h"
+#include "storm/solver/SolverCheckpoints.h"
+#include "storm/solver/SolverTelemetry.h"
+#include "storm/solver/helper/AsynchronousIntervalIterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
+#include "storm/utility/MemoryUsage.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/Profiler.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -51,15 +61,86 @@ void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatr
     clearCache();
 }
 
+template<typename ValueType>
+NativeLinearEquationSolver<ValueType>::SweepOrder::SweepOrder(storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& b) {
+    uint64_t numberOfRows = originalMatrix.getRowCount();
+    storm::storage::SparseMatrix<ValueType> transposedMatrix = originalMatrix.transpose();
+
+    // Perform a backward BFS from the rows with non-zero right-hand side.
+    std::vector<uint64_t> bfsOrder;
+    bfsOrder.reserve(numberOfRows);
+    storm::storage::BitVector found(numberOfRows, false);
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        if (!storm::utility::isZero(b[row])) {
+            bfsOrder.push_back(row);
+            found.set(row);
+        }
+    }
+    for (uint64_t position = 0; position < bfsOrder.size(); ++position) {
+        for (auto const& entry : transposedMatrix.getRow(bfsOrder[position])) {
+            if (!found.get(entry.getColumn()) && !storm::utility::isZero(entry.getValue())) {
+                bfsOrder.push_back(entry.getColumn());
+                found.set(entry.getColumn());
+            }
+        }
+    }
+    // The values of the remaining rows do not depend on the right-hand side, so they are processed last.
+    for (auto row : ~found) {
+        bfsOrder.push_back(row);
+    }
+
+    // The SOR step processes the rows from the last to the first one, so the order is reversed.
+    rows.assign(bfsOrder.rbegin(), bfsOrder.rend());
+    std::vector<uint64_t> originalToNewRow(numberOfRows);
+    for (uint64_t newRow = 0; newRow < numberOfRows; ++newRow) {
+        originalToNewRow[rows[newRow]] = newRow;
+    }
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, numberOfRows, originalMatrix.getEntryCount());
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    for (uint64_t newRow = 0; newRow < numberOfRows; ++newRow) {
+        rowEntries.clear();
+        for (auto const& entry : originalMatrix.getRow(rows[newRow])) {
+            rowEntries.emplace_back(originalToNewRow[entry.getColumn()], entry.getValue());
+        }
+        std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
+        for (auto const& entry : rowEntries) {
+            builder.addNextValue(newRow, entry.first, entry.second);
+        }
+    }
+    matrix = builder.build();
+}
+
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
                                                               ValueType const& omega) const {
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, getMatrixRowCount());
     }
 
+    // If requested, the rows are swept in the order of their distance to the rows with non-zero right-hand side. The order is determined for the
+    // first right-hand side and kept while the cache is not cleared, as any order yields the correct solution.
+    bool reorder = env.solver().native().getGaussSeidelOrdering() == GaussSeidelOrdering::TargetDistance;
+    std::vector<ValueType> orderedX, orderedB;
+    if (reorder) {
+        if (!sweepOrder) {
+            sweepOrder = std::make_unique<SweepOrder>(*A, b);
+        }
+        orderedX.resize(x.size());
+        orderedB.resize(b.size());
+        storm::utility::vector::selectVectorValues(orderedX, sweepOrder->rows, x);
+        storm::utility::vector::selectVectorValues(orderedB, sweepOrder->rows, b);
+    }
+    storm::storage::SparseMatrix<ValueType> const& matrix = reorder ? sweepOrder->matrix : *A;
+    std::vector<ValueType>& currentX = reorder ? orderedX : x;
+    std::vector<ValueType> const& currentB = reorder ? orderedB : b;
+    auto restoreOriginalOrder = [&]() {
+        for (uint64_t row = 0; row < orderedX.size(); ++row) {
+            x[sweepOrder->rows[row]] = orderedX[row];
+        }
+    };
+
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
     bool relative = env.solver().native().getRelativeTerminationCriterion();
@@ -70,15 +151,15 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
 
     this->startMeasureProgress();
     while (status == SolverStatus::InProgress && iterations < maxIter) {
-        A->performSuccessiveOverRelaxationStep(omega, x, b);
+        matrix.performSuccessiveOverRelaxationStep(omega, currentX, currentB);
 
         // Now check if the process already converged within our precision.
-        if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, currentX, precision, relative)) {
             status = SolverStatus::Converged;
         }
         // If we did not yet converge, we need to backup the contents of x.
         if (status != SolverStatus::Converged) {
-            *this->cachedRowVector = x;
+            *this->cachedRowVector = currentX;
         }
 
         // Potentially show progress.
@@ -87,8 +168,15 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
         // Increase iteration count so we can abort if convergence is too slow.
         ++iterations;
 
+        // Termination conditions refer to the original order of the rows.
+        if (reorder && this->hasCustomTerminationCondition()) {
+            restoreOriginalOrder();
+        }
         status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
     }
+    if (reorder) {
+        restoreOriginalOrder();
+    }
 
     if (!this->isCachingEnabled()) {
         clearCache();
@@ -112,7 +200,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Jacobi)");
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, getMatrixRowCount());
     }
 
     // Get a Jacobi decomposition of the matrix A.
@@ -318,9 +406,14 @@ typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinea
     Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision,
     bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maxIterations,
     storm::solver::MultiplicationStyle const& multiplicationStyle) const {
+    STORM_PROFILE_SCOPE("power iteration");
     bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
 
     uint64_t iterations = currentIterations;
+    SolverTelemetryTracker telemetry(env, "NativeLinearEquationSolver", "power iteration", *this->A);
+    // Continue from the latest checkpoint (if we are resuming).
+    SolverCheckpointTracker<ValueType> checkpoints(env, "power iteration", *this->A, b);
+    checkpoints.restore({currentX}, iterations);
     SolverStatus status = this->terminateNow(*currentX, guarantee) ? SolverStatus::TerminatedEarly : SolverStatus::InProgress;
     while (status == SolverStatus::InProgress && iterations < maxIterations) {
         if (useGaussSeidelMultiplication) {
@@ -338,12 +431,17 @@ typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinea
         // Check for termination.
         std::swap(currentX, newX);
         ++iterations;
+        if (telemetry.isEnabled()) {
+            telemetry.recordIteration(iterations - currentIterations, SolverTelemetryTracker::computeMaxDiff(*currentX, *newX, relative));
+        }
 
         status = this->updateStatus(status, *currentX, guarantee, iterations, maxIterations);
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+        checkpoints.checkpoint({currentX}, iterations);
     }
+    checkpoints.finish({currentX}, iterations);
 
     return PowerIterationResult(iterations - currentIterations, status);
 }
@@ -354,7 +452,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
 
     // Prepare the solution vectors.
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, getMatrixRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -427,13 +525,13 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
 
     std::vector<ValueType>* lowerX = &x;
     this->createLowerBoundsVector(*lowerX);
-    this->createUpperBoundsVector(this->cachedRowVector, this->getMatrixRowCount());
+    this->createUpperBoundsVector(env, this->cachedRowVector, this->getMatrixRowCount());
     std::vector<ValueType>* upperX = this->cachedRowVector.get();
 
     bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
     std::vector<ValueType>* tmp;
     if (!useGaussSeidelMultiplication) {
-        cachedRowVector2 = std::make_unique<std::vector<ValueType>>(x.size());
+        cachedRowVector2 = SolverWorkspace::acquireVector<ValueType>(env, x.size());
         tmp = cachedRowVector2.get();
     }
 
@@ -567,6 +665,9 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
         doConvergenceCheck = !doConvergenceCheck;
         status = this->updateStatus(status, false, iterations, maxIter);
     }
+    if (status == SolverStatus::Aborted) {
+        AnytimeBounds::recordAbortedSolver(env, *lowerX, *upperX);
+    }
 
     // We take the means of the lower and upper bound so we guarantee the desired precision.
     storm::utility::vector::applyPointwise(
@@ -587,13 +688,51 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
     return status == SolverStatus::Converged;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsAsynchronousIntervalIteration(Environment const& env, std::vector<ValueType>& x,
+                                                                                        std::vector<ValueType> const& b) const {
+    STORM_LOG_THROW(this->hasLowerBound(), storm::exceptions::UnmetRequirementException, "Solver requires lower bound, but none was given.");
+    STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (AsynchronousIntervalIteration) on "
+                                                      << numberOfThreads << " threads");
+
+    this->createLowerBoundsVector(x);
+    this->createUpperBoundsVector(env, this->cachedRowVector, this->getMatrixRowCount());
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    if (!relative) {
+        precision *= storm::utility::convertNumber<ValueType>(2.0);
+    }
+    storm::solver::helper::AsynchronousIntervalIterationHelper<ValueType> helper(*A);
+    this->startMeasureProgress();
+    auto statusIters = helper.solveEquations(x, *this->cachedRowVector, b, relative, precision, env.solver().native().getMaximalNumberOfIterations(),
+                                             numberOfThreads, boost::none, this->getOptionalRelevantValues());
+    if (statusIters.first == SolverStatus::Aborted) {
+        AnytimeBounds::recordAbortedSolver(env, x, *this->cachedRowVector);
+    }
+
+    // We take the means of the lower and upper bound so we guarantee the desired precision.
+    ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
+        x, *this->cachedRowVector, x, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    this->reportStatus(statusIters.first, statusIters.second);
+
+    return statusIters.first == SolverStatus::Converged;
+}
+
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, std::vector<ValueType>& x,
                                                                               std::vector<ValueType> const& b) const {
     // Prepare the solution vectors and the helper.
     assert(x.size() == this->A->getRowCount());
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>();
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, x.size());
     }
     if (!this->soundValueIterationHelper) {
         this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(
@@ -604,6 +743,8 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
             std::move(*this->soundValueIterationHelper), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(),
             storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
     }
+    this->soundValueIterationHelper->setNumberOfThreads(storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads()),
+                                                        env.solver().multiplier().getGaussSeidelBlockSize());
 
     // Prepare initial bounds for the solution (if given)
     if (this->hasLowerBound()) {
@@ -619,6 +760,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
     }
 
     SolverStatus status = SolverStatus::InProgress;
+    SolverTelemetryTracker telemetry(env, "NativeLinearEquationSolver", "sound value iteration", *this->A);
     this->startMeasureProgress();
     uint64_t iterations = 0;
 
@@ -630,6 +772,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
 
         // Update environment variables.
         ++iterations;
+        telemetry.recordIteration(iterations, std::numeric_limits<double>::quiet_NaN(), this->soundValueIterationHelper->getBoundsGap());
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
@@ -638,6 +781,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(En
             status, this->hasCustomTerminationCondition() && this->soundValueIterationHelper->checkCustomTerminationCondition(this->getTerminationCondition()),
             iterations, env.solver().native().getMaximalNumberOfIterations());
     }
+    if (status == SolverStatus::Aborted) {
+        // The solution is computed from the mean of both bounds, so it is within half of their distance of the exact solution.
+        AnytimeBounds::recordAbortedSolver(env, this->soundValueIterationHelper->getBoundsGap() / 2.0);
+    }
     this->soundValueIterationHelper->setSolutionVector();
 
     this->reportStatus(status, iterations);
@@ -659,7 +806,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
     }
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowCount());
     }
     if (!optimisticValueIterationHelper) {
         optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
@@ -677,6 +824,14 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
                                              env.solver().native().getMaximalNumberOfIterations(),
                                              boost::none,  // No optimization dir
                                              this->getOptionalRelevantValues());
+    if (statusIters.first == SolverStatus::Aborted) {
+        // An aborted run may not have verified its guess for the upper bound yet.
+        if (helper.hasVerifiedUpperBound()) {
+            AnytimeBounds::recordAbortedSolver(env, *lowerX, *upperX);
+        } else {
+            AnytimeBounds::recordAbortedSolverWithoutBounds(env);
+        }
+    }
     auto two = storm::utility::convertNumber<ValueType>(2.0);
     storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
         *lowerX, *upperX, x, [&two](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / two; });
@@ -691,7 +846,19 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsOptimisticValueIterati
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearch(Environment const& env, std::vector<ValueType>& x,
                                                                          std::vector<ValueType> const& b) const {
-    return solveEquationsRationalSearchHelper<double>(env, x, b);
+    bool converged = solveEquationsRationalSearchHelper<double>(env, x, b);
+    if (!converged && env.solver().isExactFloatFirst() && !storm::utility::resources::isTerminate()) {
+        // Repair the failed floating point attempt by solving the system with a sparse LU decomposition.
+        STORM_LOG_INFO("Rational search did not find the exact solution. Falling back to a sparse LU decomposition.");
+        storm::storage::SparseMatrix<ValueType> equationSystem(*this->A);
+        equationSystem.convertToEquationSystem();
+        Environment luEnv = env;
+        luEnv.solver().setLinearEquationSolverType(EquationSolverType::Eigen);
+        auto luSolver = GeneralLinearEquationSolverFactory<ValueType>().create(luEnv);
+        luSolver->setMatrix(std::move(equationSystem));
+        converged = luSolver->solveEquations(luEnv, x, b);
+    }
+    return converged;
 }
 
 template<typename RationalType, typename ImpreciseType>
@@ -817,7 +984,7 @@ NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelper(Enviro
     std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -848,7 +1015,7 @@ NativeLinearEquationSolver<ValueType>::solveEquationsRationalSearchHelper(Enviro
     // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
 
     if (!this->cachedRowVector) {
-        this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+        this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowCount());
     }
     if (!this->multiplier) {
         this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -908,10 +1075,15 @@ typename std::enable_if<!std::is_same<ValueType, ImpreciseType>::value, bool>::t
                                                                                  impreciseTmpX);
         impreciseSolver.clearCache();
     } catch (storm::exceptions::PrecisionExceededException const& e) {
+        if (env.solver().isExactFloatFirst()) {
+            // The caller falls back to an exact LU decomposition.
+            STORM_LOG_INFO("Precision of value type was exceeded, giving up on rational search.");
+            return false;
+        }
         STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
 
         if (!this->cachedRowVector) {
-            this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            this->cachedRowVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
         }
         if (!this->multiplier) {
             this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
@@ -1000,7 +1172,7 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
         }
     } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration &&
                method != NativeLinearEquationSolverMethod::OptimisticValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration &&
-               method != NativeLinearEquationSolverMethod::RationalSearch) {
+               method != NativeLinearEquationSolverMethod::AsynchronousIntervalIteration && method != NativeLinearEquationSolverMethod::RationalSearch) {
         if (env.solver().native().isMethodSetFromDefault()) {
             method = NativeLinearEquationSolverMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -1015,7 +1187,22 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
 
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    bool soundMethod = method == NativeLinearEquationSolverMethod::SoundValueIteration ||
+                       method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::IntervalIteration ||
+                       method == NativeLinearEquationSolverMethod::AsynchronousIntervalIteration;
+    bool result = solveEquationsWithMethod(env, method, x, b);
+    // The sound methods record their bounds themselves. The results of the other methods give no guarantees if they are aborted.
+    if (!result && !soundMethod && storm::utility::resources::isTerminate()) {
+        AnytimeBounds::recordAbortedSolverWithoutBounds(env);
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsWithMethod(Environment const& env, NativeLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                                                     std::vector<ValueType> const& b) const {
+    switch (method) {
         case NativeLinearEquationSolverMethod::SOR:
             return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
         case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -1032,6 +1219,8 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsOptimisticValueIteration(env, x, b);
         case NativeLinearEquationSolverMethod::IntervalIteration:
             return this->solveEquationsIntervalIteration(env, x, b);
+        case NativeLinearEquationSolverMethod::AsynchronousIntervalIteration:
+            return this->solveEquationsAsynchronousIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
     }
@@ -1039,12 +1228,71 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
     return false;
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                                                        std::vector<std::vector<ValueType>> const& b) const {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    if (method != NativeLinearEquationSolverMethod::Power || x.size() == 1 || this->hasCustomTerminationCondition()) {
+        return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, x, b);
+    }
+    STORM_LOG_INFO("Solving " << x.size() << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (Power, batched)");
+
+    if (!this->multiplier) {
+        this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+    }
+
+    // Interleave the vectors such that the values of one row are adjacent. Note that the batched iteration always uses
+    // regular (Jacobi style) multiplications, since Gauss-Seidel updates would have to be performed per system.
+    uint64_t const batchSize = x.size();
+    uint64_t const rowCount = getMatrixRowCount();
+    std::vector<ValueType> currentX(rowCount * batchSize);
+    std::vector<ValueType> newX(rowCount * batchSize);
+    std::vector<ValueType> batchB(rowCount * batchSize);
+    for (uint64_t system = 0; system < batchSize; ++system) {
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            currentX[row * batchSize + system] = x[system][row];
+            batchB[row * batchSize + system] = b[system][row];
+        }
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    this->startMeasureProgress();
+    while (status == SolverStatus::InProgress) {
+        this->multiplier->multiplyBatch(env, batchSize, currentX, &batchB, newX);
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(currentX, newX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+        std::swap(currentX, newX);
+        ++iterations;
+        status = this->updateStatus(status, false, iterations, maxIterations);
+        this->showProgressIterative(iterations);
+    }
+
+    for (uint64_t system = 0; system < batchSize; ++system) {
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            x[system][row] = currentX[row * batchSize + system];
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    this->logIterations(status == SolverStatus::Converged, status == SolverStatus::TerminatedEarly, iterations);
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
 template<typename ValueType>
 LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
     if (method == NativeLinearEquationSolverMethod::Power || method == NativeLinearEquationSolverMethod::SoundValueIteration ||
         method == NativeLinearEquationSolverMethod::OptimisticValueIteration || method == NativeLinearEquationSolverMethod::RationalSearch ||
-        method == NativeLinearEquationSolverMethod::IntervalIteration) {
+        method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::AsynchronousIntervalIteration) {
         return LinearEquationSolverProblemFormat::FixedPointSystem;
     } else {
         return LinearEquationSolverProblemFormat::EquationSystem;
@@ -1055,7 +1303,7 @@ template<typename ValueType>
 LinearEquationSolverRequirements NativeLinearEquationSolver<ValueType>::getRequirements(Environment const& env) const {
     LinearEquationSolverRequirements requirements;
     auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
-    if (method == NativeLinearEquationSolverMethod::IntervalIteration) {
+    if (method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::AsynchronousIntervalIteration) {
         requirements.requireBounds();
     } else if (method == NativeLinearEquationSolverMethod::RationalSearch || method == NativeLinearEquationSolverMethod::OptimisticValueIteration) {
         requirements.requireLowerBounds();
@@ -1067,7 +1315,11 @@ LinearEquationSolverRequirements NativeLinearEquationSolver<ValueType>::getRequi
 
 template<typename ValueType>
 void NativeLinearEquationSolver<ValueType>::clearCache() const {
+    if (uint64_t cacheSize = getCacheSizeInBytes()) {
+        STORM_LOG_INFO("Releasing " << storm::utility::formatBytes(cacheSize) << " of solver workspace.");
+    }
     jacobiDecomposition.reset();
+    sweepOrder.reset();
     cachedRowVector2.reset();
     walkerChaeData.reset();
     multiplier.reset();
@@ -1076,6 +1328,26 @@ void NativeLinearEquationSolver<ValueType>::clearCache() const {
     LinearEquationSolver<ValueType>::clearCache();
 }
 
+template<typename ValueType>
+uint64_t NativeLinearEquationSolver<ValueType>::getCacheSizeInBytes() const {
+    // The helpers and the multipliers are not taken into account.
+    uint64_t result = LinearEquationSolver<ValueType>::getCacheSizeInBytes();
+    if (cachedRowVector2) {
+        result += cachedRowVector2->capacity() * sizeof(ValueType);
+    }
+    if (jacobiDecomposition) {
+        result += jacobiDecomposition->LUMatrix.getSizeInBytes() + jacobiDecomposition->DVector.capacity() * sizeof(ValueType);
+    }
+    if (sweepOrder) {
+        result += sweepOrder->matrix.getSizeInBytes() + sweepOrder->rows.capacity() * sizeof(uint64_t);
+    }
+    if (walkerChaeData) {
+        result += walkerChaeData->matrix.getSizeInBytes();
+        result += (walkerChaeData->b.capacity() + walkerChaeData->columnSums.capacity() + walkerChaeData->newX.capacity()) * sizeof(ValueType);
+    }
+    return result;
+}
+
 template<typename ValueType>
 uint64_t NativeLinearEquationSolver<ValueType>::getMatrixRowCount() const {
     return this->A->getRowCount();
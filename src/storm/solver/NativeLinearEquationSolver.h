@@ -36,9 +36,12 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual LinearEquationSolverRequirements getRequirements(Environment const& env) const override;
 
     virtual void clearCache() const override;
+    virtual uint64_t getCacheSizeInBytes() const override;
 
    protected:
     virtual bool internalSolveEquations(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+    virtual bool internalSolveEquationsBatch(storm::Environment const& env, std::vector<std::vector<ValueType>>& x,
+                                             std::vector<std::vector<ValueType>> const& b) const override;
 
    private:
     struct PowerIterationResult {
@@ -64,6 +67,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual uint64_t getMatrixColumnCount() const override;
 
     NativeLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
+    bool solveEquationsWithMethod(storm::Environment const& env, NativeLinearEquationSolverMethod method, std::vector<ValueType>& x,
+                                  std::vector<ValueType> const& b) const;
 
     virtual bool solveEquationsSOR(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const;
     virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -72,6 +77,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsSoundValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsAsynchronousIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
     template<typename RationalType, typename ImpreciseType>
@@ -105,7 +112,7 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
 
     // cached auxiliary data
-    mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2;  // A.getRowCount() rows
+    mutable WorkspaceVector<ValueType> cachedRowVector2;  // A.getRowCount() rows
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
 
@@ -118,6 +125,19 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     };
     mutable std::unique_ptr<JacobiDecomposition> jacobiDecomposition;
 
+    struct SweepOrder {
+        /*!
+         * Orders the rows by their distance to the rows with non-zero right-hand side in the graph of the given matrix, such that a
+         * (backward) Gauss-Seidel sweep over the reordered matrix propagates the values from these rows to their predecessors.
+         */
+        SweepOrder(storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& b);
+
+        // The original index of each row of the reordered matrix.
+        std::vector<uint64_t> rows;
+        storm::storage::SparseMatrix<ValueType> matrix;
+    };
+    mutable std::unique_ptr<SweepOrder> sweepOrder;
+
     struct WalkerChaeData {
         WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB);
 
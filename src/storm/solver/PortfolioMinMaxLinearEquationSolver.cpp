@@ -0,0 +1,429 @@
+#include "storm/solver/PortfolioMinMaxLinearEquationSolver.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <limits>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/UncheckedRequirementException.h"
+#include "storm/solver/multiplier/CompactMultiplier.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+// The number of value iteration steps above which the convergence of value iteration is considered slow.
+uint64_t const slowConvergenceSteps = 1000;
+// The maximal number of states and the maximal average number of choices per state for which policy iteration is considered, as it solves a
+// linear equation system in every iteration and the number of iterations tends to grow with the number of choices.
+uint64_t const maximalNumberOfStatesForPolicyIteration = 100000;
+double const maximalAverageRowGroupSizeForPolicyIteration = 16.0;
+// The number of states above which exact computations first approximate the solution in floating point arithmetic (rational search).
+uint64_t const minimalNumberOfStatesForRationalSearch = 10000;
+// The number of matrix entries above which the multiplications operate on a compact copy of the matrix.
+uint64_t const minimalNumberOfEntriesForCompactMultiplier = 1ull << 20;
+
+/*!
+ * Terminates once a flag is set (if given) or once the given condition holds (if given).
+ */
+template<typename ValueType>
+class TerminateIfFlagIsSetOrConditionHolds : public TerminationCondition<ValueType> {
+   public:
+    TerminateIfFlagIsSetOrConditionHolds(std::atomic<bool> const* flag, TerminationCondition<ValueType> const* condition)
+        : flag(flag), condition(condition) {
+        // Intentionally left empty.
+    }
+
+    virtual bool terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter,
+                              SolverGuarantee const& guarantee = SolverGuarantee::None) const override {
+        return (flag != nullptr && flag->load()) || (condition != nullptr && condition->terminateNow(valueGetter, guarantee));
+    }
+
+    virtual bool requiresGuarantee(SolverGuarantee const& guarantee) const override {
+        return condition != nullptr && condition->requiresGuarantee(guarantee);
+    }
+
+   private:
+    std::atomic<bool> const* flag;
+    TerminationCondition<ValueType> const* condition;
+};
+}  // namespace
+
+double MinMaxProblemFeatures::getAverageRowGroupSize() const {
+    return numberOfRowGroups == 0 ? 0.0 : static_cast<double>(numberOfRows) / static_cast<double>(numberOfRowGroups);
+}
+
+double MinMaxProblemFeatures::getAverageBranchingFactor() const {
+    return numberOfRows == 0 ? 0.0 : static_cast<double>(numberOfEntries) / static_cast<double>(numberOfRows);
+}
+
+boost::optional<uint64_t> MinMaxProblemFeatures::estimateNumberOfValueIterationSteps(double precision) const {
+    if (!contractionFactor) {
+        return boost::none;
+    }
+    if (contractionFactor.get() <= 0.0) {
+        return 1;
+    }
+    if (contractionFactor.get() >= 1.0) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    double steps = std::ceil(std::log(precision) / std::log(contractionFactor.get()));
+    return steps >= static_cast<double>(std::numeric_limits<uint64_t>::max()) ? std::numeric_limits<uint64_t>::max()
+                                                                                : std::max<uint64_t>(1, static_cast<uint64_t>(steps));
+}
+
+template<typename ValueType>
+PortfolioMinMaxLinearEquationSolver<ValueType>::PortfolioMinMaxLinearEquationSolver() {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+PortfolioMinMaxLinearEquationSolver<ValueType>::PortfolioMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(A) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+PortfolioMinMaxLinearEquationSolver<ValueType>::PortfolioMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A)
+    : StandardMinMaxLinearEquationSolver<ValueType>(std::move(A)) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+MinMaxProblemFeatures PortfolioMinMaxLinearEquationSolver<ValueType>::computeFeatures(Environment const& env, OptimizationDirection dir,
+                                                                                      storm::storage::SparseMatrix<ValueType> const& A,
+                                                                                      std::vector<ValueType> const& b, uint64_t numberOfEstimationSteps) {
+    MinMaxProblemFeatures result;
+    result.numberOfRowGroups = A.getRowGroupCount();
+    result.numberOfRows = A.getRowCount();
+    result.numberOfEntries = A.getEntryCount();
+    for (uint64_t group = 0; group < A.getRowGroupCount(); ++group) {
+        result.maximalRowGroupSize = std::max<uint64_t>(result.maximalRowGroupSize, A.getRowGroupSize(group));
+    }
+
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> decomposition(A);
+    result.numberOfSccs = decomposition.size();
+    for (auto const& scc : decomposition) {
+        result.largestSccSize = std::max<uint64_t>(result.largestSccSize, scc.size());
+        bool nontrivial = scc.size() > 1;
+        if (!nontrivial) {
+            uint64_t state = *scc.begin();
+            for (auto const& entry : A.getRowGroup(state)) {
+                if (entry.getColumn() == state) {
+                    nontrivial = true;
+                    break;
+                }
+            }
+        }
+        if (nontrivial) {
+            ++result.numberOfNontrivialSccs;
+        }
+    }
+    result.acyclic = result.numberOfNontrivialSccs == 0;
+
+    if (numberOfEstimationSteps > 1 && !result.acyclic) {
+        // Starting from zero, the differences of consecutive steps decrease (roughly) geometrically with the contraction factor.
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, A);
+        std::vector<ValueType> currentX(A.getRowGroupCount(), storm::utility::zero<ValueType>());
+        std::vector<ValueType> newX = currentX;
+        double firstDifference = 0.0;
+        double lastDifference = 0.0;
+        for (uint64_t step = 0; step < numberOfEstimationSteps; ++step) {
+            multiplier->multiplyAndReduce(env, dir, currentX, &b, newX);
+            double difference = 0.0;
+            for (uint64_t state = 0; state < newX.size(); ++state) {
+                difference = std::max(difference, std::abs(storm::utility::convertNumber<double>(newX[state] - currentX[state])));
+            }
+            if (step == 0) {
+                firstDifference = difference;
+            }
+            lastDifference = difference;
+            std::swap(currentX, newX);
+        }
+        if (firstDifference == 0.0 || lastDifference == 0.0) {
+            result.contractionFactor = 0.0;
+        } else {
+            result.contractionFactor = std::pow(lastDifference / firstDifference, 1.0 / static_cast<double>(numberOfEstimationSteps - 1));
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<MinMaxMethod> PortfolioMinMaxLinearEquationSolver<ValueType>::rankMethods(Environment const& env, MinMaxProblemFeatures const& features) {
+    bool exact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    bool sound = env.solver().isForceSoundness();
+    std::vector<MinMaxMethod> result;
+    if (features.acyclic) {
+        result.push_back(MinMaxMethod::Acyclic);
+    }
+    // Solving the SCCs one after another pays off if a substantial part of the states is outside of the largest SCC.
+    if (features.numberOfSccs > 1 && features.largestSccSize * 10 < features.numberOfRowGroups * 9) {
+        result.push_back(MinMaxMethod::Topological);
+    }
+
+    if (exact) {
+        if (features.numberOfRowGroups >= minimalNumberOfStatesForRationalSearch) {
+            result.push_back(MinMaxMethod::RationalSearch);
+        }
+        result.push_back(MinMaxMethod::PolicyIteration);
+        return result;
+    }
+
+    auto steps = features.estimateNumberOfValueIterationSteps(storm::utility::convertNumber<double>(env.solver().minMax().getPrecision()));
+    bool slowConvergence = steps && steps.get() > slowConvergenceSteps;
+    bool policyIterationAffordable = features.numberOfRowGroups <= maximalNumberOfStatesForPolicyIteration &&
+                                     features.getAverageRowGroupSize() <= maximalAverageRowGroupSizeForPolicyIteration;
+    if (slowConvergence && policyIterationAffordable) {
+        result.push_back(MinMaxMethod::PolicyIteration);
+    }
+    if (sound) {
+        // Optimistic value iteration repeatedly fails to verify its guesses if value iteration converges slowly.
+        if (slowConvergence) {
+            result.push_back(MinMaxMethod::IntervalIteration);
+            result.push_back(MinMaxMethod::OptimisticValueIteration);
+        } else {
+            result.push_back(MinMaxMethod::OptimisticValueIteration);
+            result.push_back(MinMaxMethod::IntervalIteration);
+        }
+    } else {
+        result.push_back(MinMaxMethod::ValueIteration);
+    }
+    if (!slowConvergence && policyIterationAffordable) {
+        result.push_back(MinMaxMethod::PolicyIteration);
+    }
+    return result;
+}
+
+template<typename ValueType>
+storm::Environment PortfolioMinMaxLinearEquationSolver<ValueType>::getEnvironmentForMethod(storm::Environment const& env, MinMaxMethod method,
+                                                                                           std::vector<MinMaxMethod> const& ranking) const {
+    storm::Environment methodEnvironment(env);
+    // The method counts as set from default, such that it is silently adapted to exact and sound computations.
+    methodEnvironment.solver().minMax().setMethod(method, true);
+    if (method == MinMaxMethod::Topological) {
+        // The SCCs are solved with the most promising technique that is neither topological nor acyclic.
+        auto sccMethodIt =
+            std::find_if(ranking.begin(), ranking.end(), [](MinMaxMethod const& m) { return m != MinMaxMethod::Topological && m != MinMaxMethod::Acyclic; });
+        if (sccMethodIt != ranking.end()) {
+            methodEnvironment.solver().topological().setUnderlyingMinMaxMethod(*sccMethodIt);
+        }
+    }
+    if (std::is_same<ValueType, double>::value && env.solver().multiplier().isTypeSetFromDefault() && this->features &&
+        this->features->numberOfEntries >= minimalNumberOfEntriesForCompactMultiplier && CompactMultiplier<ValueType>::isApplicable(*this->A)) {
+        bool simd = storm::solver::simd::getBestSupportedInstructionSet() != storm::solver::simd::InstructionSet::Scalar;
+        methodEnvironment.solver().multiplier().setType(simd ? MultiplierType::Simd : MultiplierType::Compact, true);
+    }
+    return methodEnvironment;
+}
+
+template<typename ValueType>
+std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> PortfolioMinMaxLinearEquationSolver<ValueType>::createUnderlyingSolver(
+    storm::Environment const& methodEnvironment) const {
+    auto solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(methodEnvironment);
+    solver->setMatrix(*this->A);
+    initializeUnderlyingSolver(*solver);
+    return solver;
+}
+
+template<typename ValueType>
+void PortfolioMinMaxLinearEquationSolver<ValueType>::initializeUnderlyingSolver(MinMaxLinearEquationSolver<ValueType>& solver) const {
+    solver.setHasUniqueSolution(this->hasUniqueSolution());
+    solver.setHasNoEndComponents(this->hasNoEndComponents());
+    solver.setBoundsFromOtherSolver(*this);
+    solver.setTrackScheduler(this->isTrackSchedulerSet());
+    solver.setCachingEnabled(this->isCachingEnabled());
+    if (this->hasInitialScheduler()) {
+        auto choices = this->getInitialScheduler();
+        solver.setInitialScheduler(std::move(choices));
+    }
+    if (this->choiceFixedForRowGroup) {
+        auto choiceFixedForRowGroup = this->choiceFixedForRowGroup.get();
+        solver.setSchedulerFixedForRowGroup(std::move(choiceFixedForRowGroup));
+    }
+    if (this->hasCustomTerminationCondition()) {
+        solver.setTerminationCondition(std::make_unique<TerminateIfFlagIsSetOrConditionHolds<ValueType>>(nullptr, &this->getTerminationCondition()));
+    } else {
+        solver.resetTerminationCondition();
+    }
+}
+
+template<typename ValueType>
+bool PortfolioMinMaxLinearEquationSolver<ValueType>::requirementsFulfilled(storm::Environment const& methodEnvironment, OptimizationDirection dir,
+                                                                           MinMaxLinearEquationSolver<ValueType> const& solver) const {
+    auto req = solver.getRequirements(methodEnvironment, dir, this->hasInitialScheduler());
+    if (req.upperBounds() && this->hasUpperBound()) {
+        req.clearUpperBounds();
+    }
+    if (req.lowerBounds() && this->hasLowerBound()) {
+        req.clearLowerBounds();
+    }
+    if (req.validInitialScheduler() && this->hasInitialScheduler()) {
+        req.clearValidInitialScheduler();
+    }
+    if (req.uniqueSolution() && this->hasUniqueSolution()) {
+        req.clearUniqueSolution();
+    }
+    if (req.acyclic() && this->features && this->features->acyclic) {
+        req.clearAcyclic();
+    }
+    return !req.hasEnabledCriticalRequirement();
+}
+
+template<typename ValueType>
+bool PortfolioMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                            std::vector<ValueType> const& b) const {
+    STORM_LOG_ASSERT(x.size() == this->A->getRowGroupCount(), "Provided x-vector has invalid size.");
+    STORM_LOG_ASSERT(b.size() == this->A->getRowCount(), "Provided b-vector has invalid size.");
+
+    if (!this->features) {
+        // Estimating the contraction factor with exact arithmetic is not cheap.
+        this->features = computeFeatures(env, dir, *this->A, b, storm::NumberTraits<ValueType>::IsExact ? 0 : 8);
+        STORM_LOG_INFO("Features of the MinMax equation system: " << this->features->numberOfRowGroups << " states, " << this->features->numberOfRows
+                                                                  << " choices, branching factor " << this->features->getAverageBranchingFactor() << ", "
+                                                                  << this->features->numberOfSccs << " SCC(s) (" << this->features->numberOfNontrivialSccs
+                                                                  << " non-trivial, largest has " << this->features->largestSccSize << " states)"
+                                                                  << (this->features->contractionFactor
+                                                                          ? ", contraction factor " + std::to_string(this->features->contractionFactor.get())
+                                                                          : std::string())
+                                                                  << ".");
+    }
+
+    std::vector<MinMaxMethod> ranking = rankMethods(env, this->features.get());
+    if (this->choiceFixedForRowGroup) {
+        // Only the topological solver takes fixed choices into account for all of its underlying techniques.
+        ranking.erase(std::remove(ranking.begin(), ranking.end(), MinMaxMethod::Topological), ranking.end());
+        ranking.insert(ranking.begin(), MinMaxMethod::Topological);
+    }
+
+    // Pick the most promising techniques whose requirements are fulfilled. A race is not started if the first technique is linear in the
+    // size of the system anyway or if a custom termination condition (which might not be thread-safe) is set.
+    bool raceRequested = env.solver().minMax().isPortfolioRaceSet() && !this->hasCustomTerminationCondition();
+    std::vector<std::pair<storm::Environment, std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>>> candidates;
+    for (auto const& method : ranking) {
+        if (this->underlyingSolver && this->underlyingMethod == method && !raceRequested) {
+            // Reuse the solver (and the data it cached) from the previous call.
+            initializeUnderlyingSolver(*this->underlyingSolver);
+            candidates.emplace_back(getEnvironmentForMethod(env, method, ranking), std::move(this->underlyingSolver));
+            break;
+        }
+        storm::Environment methodEnvironment = getEnvironmentForMethod(env, method, ranking);
+        auto solver = createUnderlyingSolver(methodEnvironment);
+        if (requirementsFulfilled(methodEnvironment, dir, *solver)) {
+            candidates.emplace_back(std::move(methodEnvironment), std::move(solver));
+            if (!raceRequested || method == MinMaxMethod::Acyclic || candidates.size() == 2) {
+                break;
+            }
+        } else {
+            STORM_LOG_TRACE("Skipping " << toString(method) << " as its requirements are not fulfilled.");
+        }
+    }
+    STORM_LOG_THROW(!candidates.empty(), storm::exceptions::UncheckedRequirementException,
+                    "The requirements of none of the solution techniques of the portfolio are fulfilled.");
+
+    bool result;
+    if (candidates.size() == 2) {
+        STORM_LOG_INFO("Racing " << toString(candidates[0].first.solver().minMax().getMethod()) << " against "
+                                 << toString(candidates[1].first.solver().minMax().getMethod()) << ".");
+        result = race(candidates[0].first, std::move(candidates[0].second), candidates[1].first, std::move(candidates[1].second), dir, x, b);
+    } else {
+        auto& solver = candidates.front().second;
+        STORM_LOG_INFO("Selected " << toString(candidates.front().first.solver().minMax().getMethod()) << " as the solution technique.");
+        solver->setRequirementsChecked(true);
+        result = solver->solveEquations(candidates.front().first, dir, x, b);
+        if (this->isTrackSchedulerSet()) {
+            this->schedulerChoices = solver->getSchedulerChoices();
+        }
+        if (this->isCachingEnabled()) {
+            this->underlyingMethod = candidates.front().first.solver().minMax().getMethod();
+            this->underlyingSolver = std::move(solver);
+        }
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool PortfolioMinMaxLinearEquationSolver<ValueType>::race(storm::Environment const& firstEnvironment,
+                                                          std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>&& firstSolver,
+                                                          storm::Environment const& secondEnvironment,
+                                                          std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>&& secondSolver, OptimizationDirection dir,
+                                                          std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    std::atomic<bool> decided(false);
+    std::vector<storm::Environment const*> environments = {&firstEnvironment, &secondEnvironment};
+    std::vector<std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>> solvers;
+    solvers.push_back(std::move(firstSolver));
+    solvers.push_back(std::move(secondSolver));
+    std::vector<std::vector<ValueType>> solutions(2, x);
+    std::array<bool, 2> converged = {false, false};
+    std::vector<std::exception_ptr> errors(2);
+    uint64_t winner = 2;
+
+    storm::utility::parallel::forEachChunk(0, 2, 1, 2, [&](uint64_t, uint64_t index, uint64_t) {
+        try {
+            auto& solver = solvers[index];
+            solver->setTerminationCondition(std::make_unique<TerminateIfFlagIsSetOrConditionHolds<ValueType>>(&decided, nullptr));
+            solver->setRequirementsChecked(true);
+            converged[index] = solver->solveEquations(*environments[index], dir, solutions[index], b);
+            // The solver that finishes first wins. The other solver terminates (early) at the next check of its termination condition.
+            if (!decided.exchange(true)) {
+                winner = index;
+            }
+        } catch (...) {
+            errors[index] = std::current_exception();
+        }
+    });
+
+    if (winner == 2) {
+        STORM_LOG_ASSERT(errors[0] || errors[1], "No solver finished.");
+        std::rethrow_exception(errors[0] ? errors[0] : errors[1]);
+    }
+    STORM_LOG_INFO(toString(environments[winner]->solver().minMax().getMethod()) << " finished first.");
+    x = std::move(solutions[winner]);
+    if (this->isTrackSchedulerSet()) {
+        this->schedulerChoices = solvers[winner]->getSchedulerChoices();
+    }
+    return converged[winner];
+}
+
+template<typename ValueType>
+MinMaxLinearEquationSolverRequirements PortfolioMinMaxLinearEquationSolver<ValueType>::getRequirements(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& direction, bool const& hasInitialScheduler) const {
+    // The requirements of the fallback technique, which are satisfied by all techniques that are selected.
+    storm::Environment fallbackEnvironment(env);
+    fallbackEnvironment.solver().minMax().setMethod(MinMaxMethod::ValueIteration, true);
+    return GeneralMinMaxLinearEquationSolverFactory<ValueType>().getRequirements(fallbackEnvironment, this->hasUniqueSolution(), this->hasNoEndComponents(),
+                                                                                 direction, hasInitialScheduler, this->isTrackSchedulerSet());
+}
+
+template<typename ValueType>
+void PortfolioMinMaxLinearEquationSolver<ValueType>::clearCache() const {
+    features = boost::none;
+    underlyingMethod = boost::none;
+    underlyingSolver.reset();
+    StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
+}
+
+// Explicitly instantiate the min max linear equation solver.
+template class PortfolioMinMaxLinearEquationSolver<double>;
+
+#ifdef STORM_HAVE_CARL
+template class PortfolioMinMaxLinearEquationSolver<storm::RationalNumber>;
+#endif
+}  // namespace solver
+}  // namespace storm
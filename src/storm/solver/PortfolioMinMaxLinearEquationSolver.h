@@ -0,0 +1,111 @@
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "storm/solver/StandardMinMaxLinearEquationSolver.h"
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+/*!
+ * Cheap structural and numerical features of a MinMax equation system that are used to select a solution technique.
+ */
+struct MinMaxProblemFeatures {
+    uint64_t numberOfRowGroups = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    uint64_t maximalRowGroupSize = 0;
+
+    // The number of SCCs, the number of SCCs that consist of more than one state or of a state with a self-loop, and the size of the largest SCC.
+    uint64_t numberOfSccs = 0;
+    uint64_t numberOfNontrivialSccs = 0;
+    uint64_t largestSccSize = 0;
+    bool acyclic = false;
+
+    // An estimate of the factor by which the difference of two consecutive value iteration steps decreases in each step. It
+    // is one minus (an estimate of) the spectral gap of the system. Not set if the estimate was not computed.
+    boost::optional<double> contractionFactor;
+
+    double getAverageRowGroupSize() const;
+    double getAverageBranchingFactor() const;
+
+    /*!
+     * Estimates the number of value iteration steps that are needed to reach the given precision based on the contraction factor.
+     *
+     * @return The estimate or none if the contraction factor is unknown.
+     */
+    boost::optional<uint64_t> estimateNumberOfValueIterationSteps(double precision) const;
+};
+
+/*!
+ * A solver that probes cheap features of the equation system (SCC structure, branching, sizes of the row groups and the convergence
+ * speed of a few value iteration steps) and delegates to the technique that is most promising for these features. If requested, the two
+ * most promising techniques are run concurrently and the result of the technique that finishes first is taken.
+ * Only techniques whose requirements are fulfilled are considered. The requirements of this solver are those of value iteration
+ * (or its sound or exact counterpart), which serves as the fallback.
+ */
+template<typename ValueType>
+class PortfolioMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationSolver<ValueType> {
+   public:
+    PortfolioMinMaxLinearEquationSolver();
+    PortfolioMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+    PortfolioMinMaxLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+    virtual ~PortfolioMinMaxLinearEquationSolver() {}
+
+    virtual void clearCache() const override;
+
+    virtual MinMaxLinearEquationSolverRequirements getRequirements(Environment const& env,
+                                                                   boost::optional<storm::solver::OptimizationDirection> const& direction = boost::none,
+                                                                   bool const& hasInitialScheduler = false) const override;
+
+    /*!
+     * Computes the features of the given equation system.
+     *
+     * @param numberOfEstimationSteps The number of value iteration steps that are used for estimating the contraction factor. Zero disables
+     * the estimate.
+     */
+    static MinMaxProblemFeatures computeFeatures(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& A,
+                                                 std::vector<ValueType> const& b, uint64_t numberOfEstimationSteps);
+
+    /*!
+     * Ranks the techniques for solving an equation system with the given features, the most promising first.
+     * The ranking always contains value iteration (or its sound or exact counterpart).
+     */
+    static std::vector<MinMaxMethod> rankMethods(Environment const& env, MinMaxProblemFeatures const& features);
+
+   protected:
+    virtual bool internalSolveEquations(storm::Environment const& env, OptimizationDirection d, std::vector<ValueType>& x,
+                                        std::vector<ValueType> const& b) const override;
+
+   private:
+    // Retrieves the environment in which the given technique is invoked.
+    storm::Environment getEnvironmentForMethod(storm::Environment const& env, MinMaxMethod method, std::vector<MinMaxMethod> const& ranking) const;
+
+    // Creates a solver for the given environment that inherits the settings of this solver.
+    std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> createUnderlyingSolver(storm::Environment const& methodEnvironment) const;
+
+    // Passes the settings of this solver to the given solver.
+    void initializeUnderlyingSolver(MinMaxLinearEquationSolver<ValueType>& solver) const;
+
+    // Retrieves whether the requirements of the given solver are fulfilled.
+    bool requirementsFulfilled(storm::Environment const& methodEnvironment, OptimizationDirection dir,
+                               MinMaxLinearEquationSolver<ValueType> const& solver) const;
+
+    // Solves the equation system with the two given solvers concurrently.
+    bool race(storm::Environment const& firstEnvironment, std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>&& firstSolver,
+              storm::Environment const& secondEnvironment, std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>&& secondSolver, OptimizationDirection dir,
+              std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    // cached auxiliary data
+    mutable boost::optional<MinMaxProblemFeatures> features;
+    mutable boost::optional<MinMaxMethod> underlyingMethod;
+    mutable std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> underlyingSolver;
+};
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,274 @@
+#include "storm/solver/SolverCheckpoints.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+// The first bytes of every checkpoint file. The last character is the version of the format.
+char const checkpointMagic[8] = {'S', 'T', 'O', 'R', 'M', 'C', 'P', '1'};
+uint64_t const checkpointAlignment = 64;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint64_t fingerprint;
+    uint64_t iterations;
+    uint64_t valueSize;
+    uint64_t numberOfVectors;
+    uint64_t vectorSize;
+    uint64_t reserved[2];
+};
+static_assert(sizeof(CheckpointHeader) == checkpointAlignment, "Unexpected size of the checkpoint header.");
+
+uint64_t getPaddedSize(uint64_t size) {
+    return (size + checkpointAlignment - 1) / checkpointAlignment * checkpointAlignment;
+}
+
+// FNV-1a
+uint64_t hashBytes(uint64_t hash, void const* data, uint64_t size) {
+    auto bytes = static_cast<unsigned char const*>(data);
+    for (uint64_t index = 0; index < size; ++index) {
+        hash ^= bytes[index];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+}  // namespace
+
+SolverCheckpoints::SolverCheckpoints(std::string const& directory, std::chrono::milliseconds const& interval, bool resume)
+    : directory(directory),
+      interval(interval),
+      resume(resume),
+      writing(false),
+      stopWriter(false),
+      numberOfInvocations(0),
+      numberOfWrittenCheckpoints(0),
+      numberOfReadCheckpoints(0) {
+    writer = std::thread([this]() { runWriter(); });
+}
+
+SolverCheckpoints::~SolverCheckpoints() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopWriter = true;
+    }
+    pendingCondition.notify_all();
+    writer.join();
+}
+
+std::chrono::milliseconds const& SolverCheckpoints::getInterval() const {
+    return interval;
+}
+
+uint64_t SolverCheckpoints::startInvocation() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfInvocations++;
+}
+
+void SolverCheckpoints::write(uint64_t invocation, uint64_t fingerprint, uint64_t iterations, uint64_t valueSize, std::vector<std::vector<char>>&& vectors) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingCheckpoints[invocation] = PendingCheckpoint{fingerprint, iterations, valueSize, std::move(vectors)};
+    }
+    pendingCondition.notify_all();
+}
+
+bool SolverCheckpoints::read(uint64_t invocation, uint64_t fingerprint, uint64_t& iterations, uint64_t valueSize,
+                             std::vector<std::pair<char*, uint64_t>> const& vectors) {
+    if (!resume) {
+        return false;
+    }
+    std::ifstream stream(getFilename(invocation), std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+    CheckpointHeader header;
+    if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        STORM_LOG_WARN("Ignoring the truncated checkpoint '" << getFilename(invocation) << "'.");
+        return false;
+    }
+    bool matches = std::memcmp(header.magic, checkpointMagic, sizeof(checkpointMagic)) == 0 && header.fingerprint == fingerprint &&
+                   header.valueSize == valueSize && header.numberOfVectors == vectors.size();
+    for (auto const& vector : vectors) {
+        matches &= header.vectorSize == vector.second;
+    }
+    if (!matches) {
+        STORM_LOG_WARN("Ignoring the checkpoint '" << getFilename(invocation) << "' as it belongs to a different equation system.");
+        return false;
+    }
+
+    // We first read into a buffer, such that the vectors are left unchanged if the file is truncated.
+    uint64_t vectorBytes = header.vectorSize * valueSize;
+    std::vector<char> buffer(vectors.size() * getPaddedSize(vectorBytes));
+    if (!stream.read(buffer.data(), buffer.size())) {
+        STORM_LOG_WARN("Ignoring the truncated checkpoint '" << getFilename(invocation) << "'.");
+        return false;
+    }
+    for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
+        std::memcpy(vectors[vectorIndex].first, buffer.data() + vectorIndex * getPaddedSize(vectorBytes), vectorBytes);
+    }
+    iterations = header.iterations;
+    std::lock_guard<std::mutex> lock(mutex);
+    ++numberOfReadCheckpoints;
+    return true;
+}
+
+void SolverCheckpoints::waitForPendingWrites() {
+    std::unique_lock<std::mutex> lock(mutex);
+    writtenCondition.wait(lock, [this]() { return pendingCheckpoints.empty() && !writing; });
+}
+
+uint64_t SolverCheckpoints::getNumberOfWrittenCheckpoints() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfWrittenCheckpoints;
+}
+
+uint64_t SolverCheckpoints::getNumberOfReadCheckpoints() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfReadCheckpoints;
+}
+
+std::string SolverCheckpoints::getFilename(uint64_t invocation) const {
+    return directory + "/solver-" + std::to_string(invocation) + ".checkpoint";
+}
+
+void SolverCheckpoints::writeFile(uint64_t invocation, PendingCheckpoint const& checkpoint) {
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, checkpointMagic, sizeof(checkpointMagic));
+    header.fingerprint = checkpoint.fingerprint;
+    header.iterations = checkpoint.iterations;
+    header.valueSize = checkpoint.valueSize;
+    header.numberOfVectors = checkpoint.vectors.size();
+    header.vectorSize = checkpoint.vectors.empty() ? 0 : checkpoint.vectors.front().size() / checkpoint.valueSize;
+
+    // The checkpoint is written to a temporary file that then replaces the previous checkpoint, so an interruption never leaves a corrupted checkpoint.
+    std::string filename = getFilename(invocation);
+    std::string temporaryFilename = filename + ".tmp";
+    std::ofstream stream(temporaryFilename, std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unable to open the checkpoint file '" << temporaryFilename << "'.");
+    stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    std::vector<char> const padding(checkpointAlignment, 0);
+    for (auto const& vector : checkpoint.vectors) {
+        stream.write(vector.data(), vector.size());
+        stream.write(padding.data(), getPaddedSize(vector.size()) - vector.size());
+    }
+    stream.close();
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unable to write the checkpoint file '" << temporaryFilename << "'.");
+    STORM_LOG_THROW(std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, storm::exceptions::FileIoException,
+                    "Unable to replace the checkpoint file '" << filename << "'.");
+}
+
+void SolverCheckpoints::runWriter() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        pendingCondition.wait(lock, [this]() { return stopWriter || !pendingCheckpoints.empty(); });
+        if (pendingCheckpoints.empty()) {
+            // We only stop once all pending checkpoints are written.
+            return;
+        }
+        auto checkpointIt = pendingCheckpoints.begin();
+        uint64_t invocation = checkpointIt->first;
+        PendingCheckpoint checkpoint = std::move(checkpointIt->second);
+        pendingCheckpoints.erase(checkpointIt);
+        writing = true;
+        lock.unlock();
+        bool written = true;
+        try {
+            writeFile(invocation, checkpoint);
+        } catch (storm::exceptions::FileIoException const& e) {
+            // A failing checkpoint must not abort the computation.
+            STORM_LOG_WARN(e.what());
+            written = false;
+        }
+        lock.lock();
+        writing = false;
+        if (written) {
+            ++numberOfWrittenCheckpoints;
+        }
+        writtenCondition.notify_all();
+    }
+}
+
+template<typename ValueType>
+SolverCheckpointTracker<ValueType>::SolverCheckpointTracker(Environment const& env, std::string const& method,
+                                                            storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& b)
+    : invocation(0), fingerprint(0), hasWrittenCheckpoint(false) {
+    if (!env.solver().getCheckpoints()) {
+        return;
+    }
+    if (!std::is_trivially_copyable<ValueType>::value) {
+        STORM_LOG_DEBUG("Not checkpointing the " << method << " of a solver as its values are not trivially copyable.");
+        return;
+    }
+    checkpoints = env.solver().getCheckpoints();
+    invocation = checkpoints->startInvocation();
+    fingerprint = hashBytes(14695981039346656037ull, method.data(), method.size());
+    uint64_t const dimensions[3] = {matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount()};
+    fingerprint = hashBytes(fingerprint, dimensions, sizeof(dimensions));
+    fingerprint = hashBytes(fingerprint, b.data(), b.size() * sizeof(ValueType));
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+template<typename ValueType>
+bool SolverCheckpointTracker<ValueType>::restore(std::vector<std::vector<ValueType>*> const& vectors, uint64_t& iterations) {
+    if (!checkpoints) {
+        return false;
+    }
+    std::vector<std::pair<char*, uint64_t>> destinations;
+    for (auto vector : vectors) {
+        destinations.emplace_back(reinterpret_cast<char*>(vector->data()), vector->size());
+    }
+    if (checkpoints->read(invocation, fingerprint, iterations, sizeof(ValueType), destinations)) {
+        STORM_LOG_INFO("Resuming solver invocation " << invocation << " after " << iterations << " iterations.");
+        // The restored iterates are already stored.
+        hasWrittenCheckpoint = true;
+        return true;
+    }
+    return false;
+}
+
+template<typename ValueType>
+void SolverCheckpointTracker<ValueType>::checkpoint(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations) {
+    if (checkpoints && std::chrono::steady_clock::now() - lastCheckpoint >= checkpoints->getInterval()) {
+        write(vectors, iterations);
+    }
+}
+
+template<typename ValueType>
+void SolverCheckpointTracker<ValueType>::finish(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations) {
+    if (checkpoints && hasWrittenCheckpoint) {
+        write(vectors, iterations);
+    }
+}
+
+template<typename ValueType>
+void SolverCheckpointTracker<ValueType>::write(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations) {
+    // Copying the vectors is all the solver has to wait for.
+    std::vector<std::vector<char>> copies;
+    copies.reserve(vectors.size());
+    for (auto vector : vectors) {
+        char const* data = reinterpret_cast<char const*>(vector->data());
+        copies.emplace_back(data, data + vector->size() * sizeof(ValueType));
+    }
+    checkpoints->write(invocation, fingerprint, iterations, sizeof(ValueType), std::move(copies));
+    hasWrittenCheckpoint = true;
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+template class SolverCheckpointTracker<double>;
+template class SolverCheckpointTracker<storm::RationalNumber>;
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * Periodically stores the iterates of long-running iterative solvers on disk, such that a computation that was interrupted (e.g. because the machine
+ * was preempted) can be resumed from the latest checkpoints. Every solver invocation is identified by its position in the sequence of invocations,
+ * which is the same whenever the same input is checked with the same settings. In addition, every checkpoint carries a fingerprint of the equation
+ * system, so a checkpoint that does not belong to the invocation is ignored. An instance is attached to the solver environment, so all solvers (and
+ * their copies of the environment) use it.
+ *
+ * Checkpoints are written asynchronously by a background thread, so the solvers only pay for copying their vectors. A checkpoint file consists of a
+ * header of 64 bytes followed by the raw entries of the vectors, each of which starts at a multiple of 64 bytes, so the files can also be mapped into
+ * memory. Only vectors of trivially copyable values (e.g. double) are supported. The checkpoints are thread-safe.
+ */
+class SolverCheckpoints {
+   public:
+    /*!
+     * @param directory The (existing) directory in which the checkpoints are stored.
+     * @param interval The minimal time between two checkpoints of the same solver invocation.
+     * @param resume If true, solvers start from the checkpoints that are present in the directory.
+     */
+    SolverCheckpoints(std::string const& directory, std::chrono::milliseconds const& interval, bool resume);
+
+    /*!
+     * Waits until all pending checkpoints are written.
+     */
+    ~SolverCheckpoints();
+
+    std::chrono::milliseconds const& getInterval() const;
+
+    /*!
+     * Retrieves a fresh index identifying an invocation of a solver.
+     */
+    uint64_t startInvocation();
+
+    /*!
+     * Schedules writing the given vectors as the checkpoint of the given invocation. A checkpoint of the same invocation that is still pending is
+     * replaced.
+     */
+    void write(uint64_t invocation, uint64_t fingerprint, uint64_t iterations, uint64_t valueSize, std::vector<std::vector<char>>&& vectors);
+
+    /*!
+     * If resuming, reads the checkpoint of the given invocation into the given vectors. Nothing is changed if there is no such checkpoint or if it does
+     * not match the fingerprint, the number of vectors or their sizes.
+     *
+     * @return True iff a checkpoint was read.
+     */
+    bool read(uint64_t invocation, uint64_t fingerprint, uint64_t& iterations, uint64_t valueSize, std::vector<std::pair<char*, uint64_t>> const& vectors);
+
+    /*!
+     * Waits until all pending checkpoints are written.
+     */
+    void waitForPendingWrites();
+
+    /*!
+     * Retrieves the number of checkpoints that were written and read, respectively.
+     */
+    uint64_t getNumberOfWrittenCheckpoints() const;
+    uint64_t getNumberOfReadCheckpoints() const;
+
+   private:
+    struct PendingCheckpoint {
+        uint64_t fingerprint;
+        uint64_t iterations;
+        uint64_t valueSize;
+        std::vector<std::vector<char>> vectors;
+    };
+
+    std::string getFilename(uint64_t invocation) const;
+    void writeFile(uint64_t invocation, PendingCheckpoint const& checkpoint);
+    void runWriter();
+
+    std::string directory;
+    std::chrono::milliseconds interval;
+    bool resume;
+
+    mutable std::mutex mutex;
+    std::condition_variable pendingCondition;
+    std::condition_variable writtenCondition;
+    std::map<uint64_t, PendingCheckpoint> pendingCheckpoints;
+    bool writing;
+    bool stopWriter;
+    uint64_t numberOfInvocations;
+    uint64_t numberOfWrittenCheckpoints;
+    uint64_t numberOfReadCheckpoints;
+    std::thread writer;
+};
+
+/*!
+ * Handles the checkpoints of one solver invocation, using the checkpoints of the given environment. If the environment has no checkpoints or the values
+ * are not trivially copyable, all operations are no-ops.
+ */
+template<typename ValueType>
+class SolverCheckpointTracker {
+   public:
+    /*!
+     * @param method The solution method, which is part of the fingerprint.
+     * @param matrix The matrix of the equation system, whose dimensions are part of the fingerprint.
+     * @param b The right-hand side of the equation system, which is part of the fingerprint.
+     */
+    SolverCheckpointTracker(Environment const& env, std::string const& method, storm::storage::SparseMatrix<ValueType> const& matrix,
+                            std::vector<ValueType> const& b);
+
+    bool isEnabled() const {
+        return static_cast<bool>(checkpoints);
+    }
+
+    /*!
+     * Overwrites the given vectors (and the number of iterations) with the ones of the checkpoint of this invocation, if we are resuming and such a
+     * checkpoint exists.
+     *
+     * @return True iff a checkpoint was restored.
+     */
+    bool restore(std::vector<std::vector<ValueType>*> const& vectors, uint64_t& iterations);
+
+    /*!
+     * Writes a checkpoint of the given vectors if the interval has passed since the last checkpoint of this invocation.
+     */
+    void checkpoint(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations);
+
+    /*!
+     * Writes a final checkpoint of the given vectors, provided that a checkpoint of this invocation was written before. Resuming from the final
+     * checkpoint then makes the invocation converge right away. Short invocations that never reached the interval are not stored.
+     */
+    void finish(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations);
+
+   private:
+    void write(std::vector<std::vector<ValueType> const*> const& vectors, uint64_t iterations);
+
+    std::shared_ptr<SolverCheckpoints> checkpoints;
+    uint64_t invocation;
+    uint64_t fingerprint;
+    bool hasWrittenCheckpoint;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+};
+
+}  // namespace solver
+}  // namespace storm
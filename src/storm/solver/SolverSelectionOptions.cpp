@@ -20,12 +20,18 @@ std::string toString(MinMaxMethod m) {
             return "soundvalueiteration";
         case MinMaxMethod::OptimisticValueIteration:
             return "optimisticvalueiteration";
+        case MinMaxMethod::AsynchronousIntervalIteration:
+            return "asynchronousintervaliteration";
         case MinMaxMethod::TopologicalCuda:
             return "topologicalcuda";
         case MinMaxMethod::ViToPi:
             return "vi-to-pi";
         case MinMaxMethod::Acyclic:
             return "vi-to-pi";
+        case MinMaxMethod::Portfolio:
+            return "portfolio";
+        case MinMaxMethod::ModifiedPolicyIteration:
+            return "modifiedpolicy";
     }
     return "invalid";
 }
@@ -36,6 +42,12 @@ std::string toString(MultiplierType t) {
             return "Native";
         case MultiplierType::Gmmxx:
             return "Gmmxx";
+        case MultiplierType::Compact:
+            return "Compact";
+        case MultiplierType::Simd:
+            return "Simd";
+        case MultiplierType::Sell:
+            return "Sell";
     }
     return "invalid";
 }
@@ -46,6 +58,8 @@ std::string toString(GameMethod m) {
             return "valueiteration";
         case GameMethod::PolicyIteration:
             return "PolicyIteration";
+        case GameMethod::IntervalIteration:
+            return "intervaliteration";
     }
     return "invalid";
 }
@@ -74,6 +88,40 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "uniformization";
+        case CtmcTransientMethod::AdaptiveUniformization:
+            return "adaptive-uniformization";
+        case CtmcTransientMethod::Krylov:
+            return "krylov";
+    }
+    return "invalid";
+}
+
+std::string toString(DdTerminalRounding r) {
+    switch (r) {
+        case DdTerminalRounding::Nearest:
+            return "nearest";
+        case DdTerminalRounding::Down:
+            return "down";
+        case DdTerminalRounding::Up:
+            return "up";
+    }
+    return "invalid";
+}
+
+std::string toString(GaussSeidelOrdering o) {
+    switch (o) {
+        case GaussSeidelOrdering::Index:
+            return "index";
+        case GaussSeidelOrdering::TargetDistance:
+            return "target-distance";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -132,6 +180,8 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "optimisticvalueiteration";
         case NativeLinearEquationSolverMethod::IntervalIteration:
             return "IntervalIteration";
+        case NativeLinearEquationSolverMethod::AsynchronousIntervalIteration:
+            return "AsynchronousIntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
     }
@@ -6,17 +6,22 @@
 namespace storm {
 namespace solver {
 ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration,
-                              SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic)
-    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx) ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
+                              SoundValueIteration, OptimisticValueIteration, AsynchronousIntervalIteration, TopologicalCuda, ViToPi, Acyclic, Portfolio,
+                              ModifiedPolicyIteration)
+    ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx, Compact, Simd, Sell)
+        ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, IntervalIteration)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
             ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
+                ExtendEnumsWithSelectionField(CtmcTransientMethod, Uniformization, AdaptiveUniformization, Krylov)
+                    ExtendEnumsWithSelectionField(DdTerminalRounding, Nearest, Down, Up)
+                        ExtendEnumsWithSelectionField(GaussSeidelOrdering, Index, TargetDistance)
 
                 ExtendEnumsWithSelectionField(LpSolverType, Gurobi, Glpk, Z3)
                     ExtendEnumsWithSelectionField(EquationSolverType, Native, Gmmxx, Eigen, Elimination, Topological, Acyclic)
                         ExtendEnumsWithSelectionField(SmtSolverType, Z3, Mathsat)
 
                             ExtendEnumsWithSelectionField(NativeLinearEquationSolverMethod, Jacobi, GaussSeidel, SOR, WalkerChae, Power, SoundValueIteration,
-                                                          OptimisticValueIteration, IntervalIteration, RationalSearch)
+                                                          OptimisticValueIteration, IntervalIteration, AsynchronousIntervalIteration, RationalSearch)
                                 ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverMethod, Bicgstab, Qmr, Gmres)
                                     ExtendEnumsWithSelectionField(GmmxxLinearEquationSolverPreconditioner, Ilu, Diagonal, None)
                                         ExtendEnumsWithSelectionField(EigenLinearEquationSolverMethod, SparseLU, Bicgstab, DGmres, Gmres)
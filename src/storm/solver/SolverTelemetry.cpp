@@ -0,0 +1,203 @@
+#include "storm/solver/SolverTelemetry.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/Metrics.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+SolverTelemetry::SolverTelemetry(bool storeRecords) : storeRecords(storeRecords), numberOfInvocations(0) {
+    // Intentionally left empty.
+}
+
+void SolverTelemetry::setCallback(Callback const& newCallback) {
+    std::lock_guard<std::mutex> lock(mutex);
+    callback = newCallback;
+}
+
+uint64_t SolverTelemetry::startInvocation() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfInvocations++;
+}
+
+void SolverTelemetry::record(SolverIterationRecord const& record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (storeRecords) {
+        records.push_back(record);
+    }
+    if (callback) {
+        callback(record);
+    }
+}
+
+std::vector<SolverIterationRecord> SolverTelemetry::getRecords() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return records;
+}
+
+namespace {
+void writeCsvValue(std::ostream& out, double value) {
+    if (!std::isnan(value)) {
+        out << value;
+    }
+}
+}  // namespace
+
+void SolverTelemetry::exportCsv(std::ostream& out) const {
+    out << "solver,method,invocation,iteration,max_diff,bounds_gap,scheduler_changes,elapsed_s,iterations_per_s,multiplier_gb_per_s\n";
+    for (auto const& record : getRecords()) {
+        out << record.solver << ',' << record.method << ',' << record.invocation << ',' << record.iteration << ',';
+        writeCsvValue(out, record.maxDiff);
+        out << ',';
+        writeCsvValue(out, record.boundsGap);
+        out << ',' << record.schedulerChanges << ',';
+        writeCsvValue(out, record.elapsedSeconds);
+        out << ',';
+        writeCsvValue(out, record.iterationsPerSecond);
+        out << ',';
+        writeCsvValue(out, record.multiplierGigabytesPerSecond);
+        out << '\n';
+    }
+}
+
+void SolverTelemetry::exportJson(std::ostream& out) const {
+    auto toJson = [](double value) { return std::isnan(value) ? storm::json<double>() : storm::json<double>(value); };
+    storm::json<double> result = storm::json<double>::array();
+    for (auto const& record : getRecords()) {
+        storm::json<double> entry;
+        entry["solver"] = record.solver;
+        entry["method"] = record.method;
+        entry["invocation"] = record.invocation;
+        entry["iteration"] = record.iteration;
+        entry["max-diff"] = toJson(record.maxDiff);
+        entry["bounds-gap"] = toJson(record.boundsGap);
+        entry["scheduler-changes"] = record.schedulerChanges;
+        entry["elapsed-s"] = toJson(record.elapsedSeconds);
+        entry["iterations-per-s"] = toJson(record.iterationsPerSecond);
+        entry["multiplier-gb-per-s"] = toJson(record.multiplierGigabytesPerSecond);
+        result.push_back(std::move(entry));
+    }
+    out << result.dump(4) << '\n';
+}
+
+SolverTelemetryTracker::SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method, uint64_t bytesPerMultiplication)
+    : telemetry(env.solver().getTelemetry()),
+      solver(solver),
+      method(method),
+      invocation(0),
+      bytesPerMultiplication(bytesPerMultiplication),
+      numberOfMultiplications(0),
+      publishMetrics(storm::utility::Metrics::getInstance().isEnabled()),
+      lastPublishedIteration(0) {
+    if (telemetry) {
+        invocation = telemetry->startInvocation();
+    }
+    start = std::chrono::steady_clock::now();
+    nextMetricsUpdate = start;
+}
+
+template<typename ValueType>
+SolverTelemetryTracker::SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method,
+                                               storm::storage::SparseMatrix<ValueType> const& matrix)
+    : SolverTelemetryTracker(env, solver, method) {
+    if (telemetry) {
+        bytesPerMultiplication = getBytesPerMultiplication(matrix);
+    }
+}
+
+void SolverTelemetryTracker::recordIteration(uint64_t iteration, double maxDiff, double boundsGap, uint64_t schedulerChanges, uint64_t multiplications) {
+    numberOfMultiplications += multiplications;
+    auto now = std::chrono::steady_clock::now();
+    double elapsedSeconds = std::chrono::duration<double>(now - start).count();
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+
+    if (publishMetrics && now >= nextMetricsUpdate) {
+        auto& metrics = storm::utility::Metrics::getInstance();
+        // Some solvers restart counting the iterations, in which case all reported iterations are new.
+        uint64_t newIterations = iteration >= lastPublishedIteration ? iteration - lastPublishedIteration : iteration;
+        metrics.addToCounter("storm_solver_iterations_total", static_cast<double>(newIterations));
+        metrics.setGauge("storm_solver_iterations_per_second", elapsedSeconds > 0 ? iteration / elapsedSeconds : nan);
+        if (!std::isnan(maxDiff)) {
+            metrics.setGauge("storm_solver_residual", maxDiff);
+        }
+        if (!std::isnan(boundsGap)) {
+            metrics.setGauge("storm_solver_bounds_gap", boundsGap);
+        }
+        lastPublishedIteration = iteration;
+        nextMetricsUpdate = now + std::chrono::milliseconds(100);
+    }
+
+    if (!telemetry) {
+        return;
+    }
+
+    SolverIterationRecord record;
+    record.solver = solver;
+    record.method = method;
+    record.invocation = invocation;
+    record.iteration = iteration;
+    record.maxDiff = maxDiff;
+    record.boundsGap = boundsGap;
+    record.schedulerChanges = schedulerChanges;
+    record.elapsedSeconds = elapsedSeconds;
+    record.iterationsPerSecond = elapsedSeconds > 0 ? iteration / elapsedSeconds : nan;
+    double const gigabytes = static_cast<double>(bytesPerMultiplication) * numberOfMultiplications / 1e9;
+    record.multiplierGigabytesPerSecond = (elapsedSeconds > 0 && bytesPerMultiplication > 0) ? gigabytes / elapsedSeconds : nan;
+    telemetry->record(record);
+}
+
+template<typename ValueType>
+uint64_t SolverTelemetryTracker::getBytesPerMultiplication(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+    // Every entry is read once, together with the row pointers, the row group indices, the right-hand side and the operand.
+    uint64_t result = matrix.getEntryCount() * (sizeof(ValueType) + sizeof(IndexType));
+    result += (matrix.getRowCount() + matrix.getRowGroupCount()) * sizeof(IndexType);
+    result += (matrix.getRowCount() + matrix.getColumnCount()) * sizeof(ValueType);
+    // The result is written once per row group.
+    result += matrix.getRowGroupCount() * sizeof(ValueType);
+    return result;
+}
+
+template<typename ValueType>
+double SolverTelemetryTracker::computeMaxDiff(std::vector<ValueType> const& first, std::vector<ValueType> const& second, bool relative) {
+    STORM_LOG_ASSERT(first.size() == second.size(), "Vector sizes mismatch.");
+    double result = 0.0;
+    for (uint64_t index = 0; index < first.size(); ++index) {
+        double firstValue = storm::utility::convertNumber<double>(first[index]);
+        double diff = std::abs(firstValue - storm::utility::convertNumber<double>(second[index]));
+        if (relative && firstValue != 0.0) {
+            diff /= std::abs(firstValue);
+        }
+        result = std::max(result, diff);
+    }
+    return result;
+}
+
+template<typename ValueType>
+double SolverTelemetryTracker::toDouble(ValueType const& value) {
+    return storm::utility::convertNumber<double>(value);
+}
+
+template SolverTelemetryTracker::SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method,
+                                                        storm::storage::SparseMatrix<double> const& matrix);
+template uint64_t SolverTelemetryTracker::getBytesPerMultiplication(storm::storage::SparseMatrix<double> const& matrix);
+template double SolverTelemetryTracker::computeMaxDiff(std::vector<double> const& first, std::vector<double> const& second, bool relative);
+template double SolverTelemetryTracker::toDouble(double const& value);
+template SolverTelemetryTracker::SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method,
+                                                        storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+template uint64_t SolverTelemetryTracker::getBytesPerMultiplication(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+template double SolverTelemetryTracker::computeMaxDiff(std::vector<storm::RationalNumber> const& first, std::vector<storm::RationalNumber> const& second,
+                                                       bool relative);
+template double SolverTelemetryTracker::toDouble(storm::RationalNumber const& value);
+
+}  // namespace solver
+}  // namespace storm
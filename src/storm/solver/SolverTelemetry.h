@@ -0,0 +1,169 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace storm {
+
+class Environment;
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * The telemetry of a single iteration (or a batch of iterations) of an iterative solver.
+ * Values that are not available for the considered method are NaN.
+ */
+struct SolverIterationRecord {
+    // The solver and the method that produced the record.
+    std::string solver;
+    std::string method;
+
+    // Distinguishes the different invocations of solvers that report to the same telemetry.
+    uint64_t invocation;
+
+    // The number of iterations performed in this invocation so far.
+    uint64_t iteration;
+
+    // The maximal (possibly relative) difference between the last two iterates.
+    double maxDiff;
+
+    // The maximal (possibly relative) difference between the lower and the upper bound (for sound methods).
+    double boundsGap;
+
+    // The number of states whose choice was changed by the last improvement step (for policy iteration).
+    uint64_t schedulerChanges;
+
+    // The time since the start of the invocation and the achieved throughput.
+    double elapsedSeconds;
+    double iterationsPerSecond;
+    double multiplierGigabytesPerSecond;
+};
+
+/*!
+ * Collects the per-iteration telemetry of iterative solvers. An instance is attached to the solver environment, so all solvers (and their copies of
+ * the environment) report to it. The telemetry is thread-safe.
+ */
+class SolverTelemetry {
+   public:
+    typedef std::function<void(SolverIterationRecord const&)> Callback;
+
+    /*!
+     * @param storeRecords If true, the records are kept (for a later export). Otherwise, they are only passed to the callback.
+     */
+    SolverTelemetry(bool storeRecords = true);
+
+    /*!
+     * Sets a callback that is invoked (by the solving thread) for every new record.
+     */
+    void setCallback(Callback const& callback);
+
+    /*!
+     * Retrieves a fresh index identifying an invocation of a solver.
+     */
+    uint64_t startInvocation();
+
+    /*!
+     * Adds the given record.
+     */
+    void record(SolverIterationRecord const& record);
+
+    /*!
+     * Retrieves all stored records in the order they were added.
+     */
+    std::vector<SolverIterationRecord> getRecords() const;
+
+    /*!
+     * Writes all stored records as csv (with a header line). Unavailable values are left empty.
+     */
+    void exportCsv(std::ostream& out) const;
+
+    /*!
+     * Writes all stored records as a json array. Unavailable values are null.
+     */
+    void exportJson(std::ostream& out) const;
+
+   private:
+    bool storeRecords;
+    Callback callback;
+    uint64_t numberOfInvocations;
+    mutable std::mutex mutex;
+    std::vector<SolverIterationRecord> records;
+};
+
+/*!
+ * Reports the iterations of one solver invocation to the telemetry of the given environment. If metrics are collected, the progress is also
+ * published to the metrics (at most every 100ms). If neither is the case, all operations are no-ops, so callers should only compute expensive
+ * quantities (e.g. differences of iterates) if the tracker is enabled.
+ */
+class SolverTelemetryTracker {
+   public:
+    /*!
+     * @param bytesPerMultiplication The number of bytes that one multiplication with the matrix reads and writes (used to estimate the throughput).
+     */
+    SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method, uint64_t bytesPerMultiplication = 0);
+
+    /*!
+     * Creates a tracker for a solver that multiplies with the given matrix (once per iteration unless specified otherwise).
+     */
+    template<typename ValueType>
+    SolverTelemetryTracker(Environment const& env, std::string const& solver, std::string const& method, storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    bool isEnabled() const {
+        return static_cast<bool>(telemetry) || (publishMetrics && std::chrono::steady_clock::now() >= nextMetricsUpdate);
+    }
+
+    /*!
+     * Reports the given iteration.
+     *
+     * @param iteration The number of iterations performed in this invocation so far.
+     * @param multiplications The number of matrix multiplications performed since the last report.
+     */
+    void recordIteration(uint64_t iteration, double maxDiff, double boundsGap = std::numeric_limits<double>::quiet_NaN(), uint64_t schedulerChanges = 0,
+                         uint64_t multiplications = 1);
+
+    /*!
+     * Estimates the number of bytes one (reducing) multiplication with the given matrix reads and writes.
+     */
+    template<typename ValueType>
+    static uint64_t getBytesPerMultiplication(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Computes the maximal (relative) difference of the given vectors as double.
+     */
+    template<typename ValueType>
+    static double computeMaxDiff(std::vector<ValueType> const& first, std::vector<ValueType> const& second, bool relative);
+
+    /*!
+     * Converts the given value to double.
+     */
+    template<typename ValueType>
+    static double toDouble(ValueType const& value);
+
+   private:
+    std::shared_ptr<SolverTelemetry> telemetry;
+    std::string solver;
+    std::string method;
+    uint64_t invocation;
+    uint64_t bytesPerMultiplication;
+    uint64_t numberOfMultiplications;
+    std::chrono::steady_clock::time_point start;
+
+    bool publishMetrics;
+    uint64_t lastPublishedIteration;
+    std::chrono::steady_clock::time_point nextMetricsUpdate;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,136 @@
+#include "storm/solver/SolverWorkspace.h"
+
+#include <algorithm>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+WorkspaceVectorDeleter<ValueType>::WorkspaceVectorDeleter(std::shared_ptr<SolverWorkspace> const& workspace) : workspace(workspace) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+void WorkspaceVectorDeleter<ValueType>::operator()(std::vector<ValueType>* vector) const {
+    if (workspace) {
+        workspace->release(std::unique_ptr<std::vector<ValueType>>(vector));
+    } else {
+        delete vector;
+    }
+}
+
+SolverWorkspace::SolverWorkspace(uint64_t maximalNumberOfVectors) : maximalNumberOfVectors(maximalNumberOfVectors), numberOfReusedVectors(0) {
+    // Intentionally left empty.
+}
+
+template<>
+SolverWorkspace::VectorPool<double>& SolverWorkspace::getPool() {
+    return doublePool;
+}
+
+template<>
+SolverWorkspace::VectorPool<storm::RationalNumber>& SolverWorkspace::getPool() {
+    return rationalNumberPool;
+}
+
+template<>
+SolverWorkspace::VectorPool<storm::RationalFunction>& SolverWorkspace::getPool() {
+    return rationalFunctionPool;
+}
+
+template<typename ValueType>
+std::unique_ptr<std::vector<ValueType>> SolverWorkspace::acquire(uint64_t size) {
+    std::unique_ptr<std::vector<ValueType>> result;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& vectors = getPool<ValueType>().vectors;
+        if (!vectors.empty()) {
+            // The vectors are sorted by capacity, so we take the first one that is large enough. If there is none, the largest vector is grown.
+            auto it = std::find_if(vectors.begin(), vectors.end(), [size](auto const& vector) { return vector->capacity() >= size; });
+            if (it == vectors.end()) {
+                --it;
+            }
+            result = std::move(*it);
+            vectors.erase(it);
+            ++numberOfReusedVectors;
+        }
+    }
+    if (result) {
+        result->resize(size);
+    } else {
+        result = std::make_unique<std::vector<ValueType>>(size);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SolverWorkspace::release(std::unique_ptr<std::vector<ValueType>>&& vector) {
+    if (!vector || maximalNumberOfVectors == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& vectors = getPool<ValueType>().vectors;
+    auto position = std::lower_bound(vectors.begin(), vectors.end(), vector->capacity(),
+                                     [](auto const& pooledVector, uint64_t capacity) { return pooledVector->capacity() < capacity; });
+    vectors.insert(position, std::move(vector));
+    if (vectors.size() > maximalNumberOfVectors) {
+        vectors.erase(vectors.begin());
+    }
+}
+
+uint64_t SolverWorkspace::getNumberOfReusedVectors() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfReusedVectors;
+}
+
+uint64_t SolverWorkspace::getSizeInMemory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    uint64_t result = 0;
+    for (auto const& vector : doublePool.vectors) {
+        result += vector->capacity() * sizeof(double);
+    }
+    for (auto const& vector : rationalNumberPool.vectors) {
+        result += vector->capacity() * sizeof(storm::RationalNumber);
+    }
+    for (auto const& vector : rationalFunctionPool.vectors) {
+        result += vector->capacity() * sizeof(storm::RationalFunction);
+    }
+    return result;
+}
+
+void SolverWorkspace::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    doublePool.vectors.clear();
+    rationalNumberPool.vectors.clear();
+    rationalFunctionPool.vectors.clear();
+}
+
+template<typename ValueType>
+WorkspaceVector<ValueType> SolverWorkspace::acquireVector(Environment const& env, uint64_t size) {
+    if (auto const& workspace = env.solver().getWorkspace()) {
+        return WorkspaceVector<ValueType>(workspace->acquire<ValueType>(size).release(), WorkspaceVectorDeleter<ValueType>(workspace));
+    }
+    return WorkspaceVector<ValueType>(new std::vector<ValueType>(size));
+}
+
+template class WorkspaceVectorDeleter<double>;
+template class WorkspaceVectorDeleter<storm::RationalNumber>;
+template class WorkspaceVectorDeleter<storm::RationalFunction>;
+
+template std::unique_ptr<std::vector<double>> SolverWorkspace::acquire(uint64_t size);
+template std::unique_ptr<std::vector<storm::RationalNumber>> SolverWorkspace::acquire(uint64_t size);
+template std::unique_ptr<std::vector<storm::RationalFunction>> SolverWorkspace::acquire(uint64_t size);
+
+template void SolverWorkspace::release(std::unique_ptr<std::vector<double>>&& vector);
+template void SolverWorkspace::release(std::unique_ptr<std::vector<storm::RationalNumber>>&& vector);
+template void SolverWorkspace::release(std::unique_ptr<std::vector<storm::RationalFunction>>&& vector);
+
+template WorkspaceVector<double> SolverWorkspace::acquireVector(Environment const& env, uint64_t size);
+template WorkspaceVector<storm::RationalNumber> SolverWorkspace::acquireVector(Environment const& env, uint64_t size);
+template WorkspaceVector<storm::RationalFunction> SolverWorkspace::acquireVector(Environment const& env, uint64_t size);
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+
+class SolverWorkspace;
+
+/*!
+ * Returns a vector to the workspace it was acquired from (if any) instead of freeing it.
+ */
+template<typename ValueType>
+class WorkspaceVectorDeleter {
+   public:
+    WorkspaceVectorDeleter() = default;
+    explicit WorkspaceVectorDeleter(std::shared_ptr<SolverWorkspace> const& workspace);
+
+    void operator()(std::vector<ValueType>* vector) const;
+
+   private:
+    std::shared_ptr<SolverWorkspace> workspace;
+};
+
+/*!
+ * An auxiliary vector of a solver. Once the solver releases the vector (e.g. when clearing its cache), it is handed back to the workspace it was
+ * acquired from, so that the memory can be reused by the next solver.
+ */
+template<typename ValueType>
+using WorkspaceVector = std::unique_ptr<std::vector<ValueType>, WorkspaceVectorDeleter<ValueType>>;
+
+/*!
+ * Pools the auxiliary vectors of solvers across solver instances. Solving many small systems one after another (e.g. the SCCs of a topological
+ * solver, the end components of a long-run average computation or the epochs of a reward-bounded query) otherwise spends much of its time allocating
+ * and zeroing these vectors. An instance is attached to the solver environment, so all solvers (and their copies of the environment) share it.
+ * The workspace is thread-safe.
+ */
+class SolverWorkspace {
+   public:
+    /*!
+     * Creates a workspace that keeps at most the given number of released vectors (per value type).
+     */
+    SolverWorkspace(uint64_t maximalNumberOfVectors = 16);
+
+    /*!
+     * Retrieves a vector with the given number of entries. If a released vector is available, the one with the smallest sufficient capacity is reused
+     * and its entries hold arbitrary values. Otherwise, a new vector whose entries are zero is allocated.
+     */
+    template<typename ValueType>
+    std::unique_ptr<std::vector<ValueType>> acquire(uint64_t size);
+
+    /*!
+     * Hands the given vector back to the workspace. If the workspace is full, the vector with the smallest capacity is freed.
+     */
+    template<typename ValueType>
+    void release(std::unique_ptr<std::vector<ValueType>>&& vector);
+
+    /*!
+     * Retrieves the number of acquired vectors that reused a released vector.
+     */
+    uint64_t getNumberOfReusedVectors() const;
+
+    /*!
+     * Retrieves the number of bytes occupied by the released vectors.
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Frees all released vectors.
+     */
+    void clear();
+
+    /*!
+     * Retrieves a vector with the given number of entries from the workspace attached to the given environment. If the environment has no workspace,
+     * a new vector whose entries are zero is allocated. As for acquire, the entries of a reused vector hold arbitrary values.
+     */
+    template<typename ValueType>
+    static WorkspaceVector<ValueType> acquireVector(Environment const& env, uint64_t size);
+
+   private:
+    template<typename ValueType>
+    struct VectorPool {
+        std::vector<std::unique_ptr<std::vector<ValueType>>> vectors;
+    };
+
+    template<typename ValueType>
+    VectorPool<ValueType>& getPool();
+
+    mutable std::mutex mutex;
+    uint64_t maximalNumberOfVectors;
+    uint64_t numberOfReusedVectors;
+    VectorPool<double> doublePool;
+    VectorPool<storm::RationalNumber> rationalNumberPool;
+    VectorPool<storm::RationalFunction> rationalFunctionPool;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -92,7 +92,7 @@ GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool
         } else {
             STORM_LOG_WARN("The selected game method does not guarantee exact results.");
         }
-    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration) {
+    } else if (env.solver().isForceSoundness() && method != GameMethod::PolicyIteration && method != GameMethod::IntervalIteration) {
         if (env.solver().game().isMethodSetFromDefault()) {
             method = GameMethod::PolicyIteration;
             STORM_LOG_INFO("Changing game method to policy-iteration to guarantee sound results. If you want to override this, specify another method.");
@@ -114,6 +114,8 @@ bool StandardGameSolver<ValueType>::solveGame(Environment const& env, Optimizati
             return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         case GameMethod::PolicyIteration:
             return solveGamePolicyIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+        case GameMethod::IntervalIteration:
+            return solveGameIntervalIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
     }
@@ -303,6 +305,7 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     if (!multiplierPlayer2Matrix) {
         multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
     }
+    parallelPlayer1Reduction = env.solver().game().getNumberOfThreads() > 1;
 
     if (!auxiliaryP2RowGroupVector) {
         auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
@@ -400,12 +403,85 @@ bool StandardGameSolver<ValueType>::solveGameValueIteration(Environment const& e
     return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
 }
 
+template<typename ValueType>
+bool StandardGameSolver<ValueType>::solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                               std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                               std::vector<uint64_t>* player1Choices, std::vector<uint64_t>* player2Choices) const {
+    // Iterating from below and from above only converges to the same fixed point if the solution is unique.
+    if (!this->hasUniqueSolution() || !this->hasLowerBound() || !this->hasUpperBound()) {
+        STORM_LOG_WARN("Interval iteration for games requires a unique solution as well as lower and upper bounds. Falling back to value iteration.");
+        return solveGameValueIteration(env, player1Dir, player2Dir, x, b, player1Choices, player2Choices);
+    }
+
+    if (!multiplierPlayer2Matrix) {
+        multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
+    }
+    parallelPlayer1Reduction = env.solver().game().getNumberOfThreads() > 1;
+    if (!auxiliaryP2RowGroupVector) {
+        auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
+    }
+    if (!auxiliaryP1RowGroupVector) {
+        auxiliaryP1RowGroupVector = std::make_unique<std::vector<ValueType>>(this->getNumberOfPlayer1States());
+    }
+
+    // The midpoint of the two iterates is precise enough once their distance is at most twice the precision.
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision()) * storm::utility::convertNumber<ValueType>(2);
+    bool relative = env.solver().game().getRelativeTerminationCriterion();
+    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+
+    std::vector<ValueType> upperX(x.size());
+    this->createLowerBoundsVector(x);
+    this->createUpperBoundsVector(upperX);
+    std::vector<ValueType>* lowerX = &x;
+    std::vector<ValueType>* currentUpperX = &upperX;
+    std::vector<ValueType>* newX = auxiliaryP1RowGroupVector.get();
+
+    uint64_t iterations = 0;
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress) {
+        multiplyAndReduce(env, player1Dir, player2Dir, *lowerX, &b, *multiplierPlayer2Matrix, *auxiliaryP2RowGroupVector, *newX);
+        std::swap(lowerX, newX);
+        multiplyAndReduce(env, player1Dir, player2Dir, *currentUpperX, &b, *multiplierPlayer2Matrix, *auxiliaryP2RowGroupVector, *newX);
+        std::swap(currentUpperX, newX);
+
+        if (storm::utility::vector::equalModuloPrecision<ValueType>(*lowerX, *currentUpperX, precision, relative)) {
+            status = SolverStatus::Converged;
+        }
+
+        ++iterations;
+        status = this->updateStatus(status, *lowerX, SolverGuarantee::LessOrEqual, iterations, maxIter);
+    }
+
+    this->reportStatus(status, iterations);
+
+    // Return the midpoint of the two iterates in x. The vectors are combined elementwise, so x may coincide with one of them.
+    ValueType const two = storm::utility::convertNumber<ValueType>(2);
+    storm::utility::vector::applyPointwise(*lowerX, *currentUpperX, x,
+                                           [&two](ValueType const& lower, ValueType const& upper) { return (lower + upper) / two; });
+
+    // If requested, we store the scheduler for retrieval.
+    if (player1Choices && player2Choices) {
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, *player1Choices, *player2Choices);
+    } else if (this->isTrackSchedulersSet()) {
+        this->player1SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer1States(), 0);
+        this->player2SchedulerChoices = std::vector<uint_fast64_t>(this->getNumberOfPlayer2States(), 0);
+        extractChoices(env, player1Dir, player2Dir, x, b, *auxiliaryP2RowGroupVector, this->player1SchedulerChoices.get(), this->player2SchedulerChoices.get());
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return (status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly);
+}
+
 template<typename ValueType>
 void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                      std::vector<ValueType>& x, std::vector<ValueType> const* b, uint_fast64_t n) const {
     if (!multiplierPlayer2Matrix) {
         multiplierPlayer2Matrix = storm::solver::MultiplierFactory<ValueType>().create(env, player2Matrix);
     }
+    parallelPlayer1Reduction = env.solver().game().getNumberOfThreads() > 1;
 
     if (!auxiliaryP2RowGroupVector) {
         auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
@@ -431,29 +507,40 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
 
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
-        uint_fast64_t player1State = 0;
-        for (auto& result : player1ReducedResult) {
-            storm::storage::SparseMatrix<storm::storage::sparse::state_type>::const_rows relevantRows = this->getPlayer1Matrix().getRowGroup(player1State);
-            STORM_LOG_ASSERT(relevantRows.getNumberOfEntries() != 0, "There is a choice of player 1 that does not lead to any player 2 choice");
-            auto it = relevantRows.begin();
-            auto ite = relevantRows.end();
-
-            // Set the first value.
-            result = player2ReducedResult[it->getColumn()];
-            ++it;
-
-            // Now iterate through the different values and pick the extremal one.
-            if (player1Dir == OptimizationDirection::Minimize) {
-                for (; it != ite; ++it) {
-                    result = std::min(result, player2ReducedResult[it->getColumn()]);
-                }
-            } else {
-                for (; it != ite; ++it) {
-                    result = std::max(result, player2ReducedResult[it->getColumn()]);
+        auto reducePlayer1States = [&](uint64_t firstPlayer1State, uint64_t lastPlayer1State) {
+            for (uint64_t player1State = firstPlayer1State; player1State < lastPlayer1State; ++player1State) {
+                storm::storage::SparseMatrix<storm::storage::sparse::state_type>::const_rows relevantRows =
+                    this->getPlayer1Matrix().getRowGroup(player1State);
+                STORM_LOG_ASSERT(relevantRows.getNumberOfEntries() != 0, "There is a choice of player 1 that does not lead to any player 2 choice");
+                auto it = relevantRows.begin();
+                auto ite = relevantRows.end();
+                ValueType& result = player1ReducedResult[player1State];
+
+                // Set the first value.
+                result = player2ReducedResult[it->getColumn()];
+                ++it;
+
+                // Now iterate through the different values and pick the extremal one.
+                if (player1Dir == OptimizationDirection::Minimize) {
+                    for (; it != ite; ++it) {
+                        result = std::min(result, player2ReducedResult[it->getColumn()]);
+                    }
+                } else {
+                    for (; it != ite; ++it) {
+                        result = std::max(result, player2ReducedResult[it->getColumn()]);
+                    }
                 }
             }
-            ++player1State;
+        };
+        if (parallelPlayer1Reduction) {
+            storm::utility::vector::forEachRangeParallel(player1ReducedResult.size(), reducePlayer1States);
+        } else {
+            reducePlayer1States(0, player1ReducedResult.size());
         }
+    } else if (parallelPlayer1Reduction) {
+        // Player 1 represented by grouping of player 2 states (vector).
+        storm::utility::vector::reduceVectorMinOrMaxParallel(player1Dir, player2ReducedResult, player1ReducedResult, this->getPlayer1Grouping(),
+                                                             player1SchedulerChoices);
     } else {
         // Player 1 represented by grouping of player 2 states (vector).
         storm::utility::vector::reduceVectorMinOrMax(player1Dir, player2ReducedResult, player1ReducedResult, this->getPlayer1Grouping(),
@@ -43,8 +43,12 @@ class StandardGameSolver : public GameSolver<ValueType> {
     bool solveGameValueIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                                  std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
                                  std::vector<uint64_t>* player2Choices = nullptr) const;
+    bool solveGameIntervalIteration(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<uint64_t>* player1Choices = nullptr,
+                                    std::vector<uint64_t>* player2Choices = nullptr) const;
 
     // Computes p2Matrix * x + b, reduces the result w.r.t. player 2 choices, and then reduces the result w.r.t. player 1 choices.
+    // The multiplier distributes the player 2 reduction on its own, the player 1 states are reduced in parallel if parallelPlayer1Reduction is set.
     void multiplyAndReduce(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType>& x,
                            std::vector<ValueType> const* b, storm::solver::Multiplier<ValueType> const& multiplier,
                            std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
@@ -75,6 +79,8 @@ class StandardGameSolver : public GameSolver<ValueType> {
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP2RowVector;       // player2Matrix.rowCount() entries
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP2RowGroupVector;  // player2Matrix.rowGroupCount() entries
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryP1RowGroupVector;  // player1Matrix.rowGroupCount() entries
+    // Whether the player 1 states are reduced in parallel. Taken from the environment when a solving method starts.
+    mutable bool parallelPlayer1Reduction = false;
 
     /// The factory used to obtain linear equation solvers.
     std::unique_ptr<LinearEquationSolverFactory<ValueType>> linearEquationSolverFactory;
@@ -79,6 +79,7 @@ storm::dd::Add<DdType, ValueType> SymbolicEliminationLinearEquationSolver<DdType
     }
 
     STORM_LOG_INFO("Elimination completed in " << iterations << " iterations.");
+    ddManager.recordStatistics("solve");
 
     return solution.swapVariables(rowRowMetaVariablePairs);
 }
@@ -8,6 +8,7 @@
 #include "storm/utility/constants.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
@@ -77,20 +78,22 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
 
+    storm::dd::Add<DdType, ValueType> result;
     switch (getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
         case MinMaxMethod::ValueIteration:
-            return solveEquationsValueIteration(env, dir, x, b);
+            result = solveEquationsValueIteration(env, dir, x, b);
             break;
         case MinMaxMethod::PolicyIteration:
-            return solveEquationsPolicyIteration(env, dir, x, b);
+            result = solveEquationsPolicyIteration(env, dir, x, b);
             break;
         case MinMaxMethod::RationalSearch:
-            return solveEquationsRationalSearch(env, dir, x, b);
+            result = solveEquationsRationalSearch(env, dir, x, b);
             break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "The selected min max technique is not supported by this solver.");
     }
-    return storm::dd::Add<DdType, ValueType>();
+    this->getDdManager().recordStatistics("solve");
+    return result;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -98,7 +101,9 @@ typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationRe
 SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir,
                                                                              storm::dd::Add<DdType, ValueType> const& x,
                                                                              storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
-                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                             boost::optional<ValueType> const& roundingGrid,
+                                                                             DdTerminalRounding const& roundingMode) const {
     // Set up local variables.
     storm::dd::Add<DdType, ValueType> localX = x;
     uint64_t iterations = 0;
@@ -117,6 +122,9 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
         } else {
             tmp = tmp.maxAbstract(this->choiceVariables);
         }
+        if (roundingGrid) {
+            tmp = storm::utility::dd::roundToGrid(tmp, roundingGrid.get(), roundingMode);
+        }
 
         // Now check if the process already converged within our precision.
         if (localX.equalModuloPrecision(tmp, precision, relativeTerminationCriterion)) {
@@ -134,6 +142,9 @@ SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(sto
     if (status == SolverStatus::InProgress && iterations < maximalIterations) {
         status = SolverStatus::MaximalIterationsExceeded;
     }
+    if (roundingGrid) {
+        storm::utility::dd::reportRoundingError(roundingGrid.get(), roundingMode, iterations, precision, localX);
+    }
 
     return SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult(status, iterations, localX);
 }
@@ -333,8 +344,14 @@ storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, Val
     }
 
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+    boost::optional<ValueType> roundingGrid;
+    if (env.solver().getDdTerminalRoundingGrid()) {
+        STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact, "Rounding the values of an exact computation, the result will not be exact.");
+        roundingGrid = storm::utility::convertNumber<ValueType>(env.solver().getDdTerminalRoundingGrid().get());
+    }
     ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(),
-                                                          env.solver().minMax().getMaximalNumberOfIterations());
+                                                          env.solver().minMax().getMaximalNumberOfIterations(), roundingGrid,
+                                                          env.solver().getDdTerminalRoundingMode());
 
     if (viResult.status == SolverStatus::Converged) {
         STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
@@ -199,9 +199,14 @@ class SymbolicMinMaxLinearEquationSolver : public SymbolicEquationSolver<DdType,
         storm::dd::Add<DdType, ValueType> values;
     };
 
+    /*!
+     * Performs value iteration. If a rounding grid is given, the values are rounded to multiples of it after each iteration (see
+     * storm::utility::dd::roundToGrid). Rounding down (up) preserves that the values are lower (upper) bounds if the iteration starts from such bounds.
+     */
     ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x,
                                                storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion,
-                                               uint64_t maximalIterations) const;
+                                               uint64_t maximalIterations, boost::optional<ValueType> const& roundingGrid = boost::none,
+                                               DdTerminalRounding const& roundingMode = DdTerminalRounding::Nearest) const;
 
    protected:
     // The matrix defining the coefficients of the linear equation system.
@@ -1,6 +1,7 @@
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/storage/dd/Add.h"
@@ -69,17 +70,22 @@ template<storm::dd::DdType DdType, typename ValueType>
 storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquations(Environment const& env,
                                                                                                         storm::dd::Add<DdType, ValueType> const& x,
                                                                                                         storm::dd::Add<DdType, ValueType> const& b) const {
+    storm::dd::Add<DdType, ValueType> result;
     switch (getMethod(env, std::is_same<ValueType, storm::RationalNumber>::value)) {
         case NativeLinearEquationSolverMethod::Jacobi:
-            return solveEquationsJacobi(env, x, b);
+            result = solveEquationsJacobi(env, x, b);
+            break;
         case NativeLinearEquationSolverMethod::Power:
-            return solveEquationsPower(env, x, b);
+            result = solveEquationsPower(env, x, b);
+            break;
         case NativeLinearEquationSolverMethod::RationalSearch:
-            return solveEquationsRationalSearch(env, x, b);
+            result = solveEquationsRationalSearch(env, x, b);
+            break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The selected solution technique is not supported.");
-            return storm::dd::Add<DdType, ValueType>();
     }
+    this->getDdManager().recordStatistics("solve");
+    return result;
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -90,6 +96,7 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
     bool relative = env.solver().native().getRelativeTerminationCriterion();
+    boost::optional<ValueType> roundingGrid = getRoundingGrid(env);
 
     STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (jacobi)");
 
@@ -112,6 +119,9 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     while (!converged && iterationCount < maxIter) {
         storm::dd::Add<DdType, ValueType> xCopyAsColumn = xCopy.swapVariables(this->rowColumnMetaVariablePairs);
         storm::dd::Add<DdType, ValueType> tmp = scaledB - scaledLu.multiplyMatrix(xCopyAsColumn, this->columnMetaVariables);
+        if (roundingGrid) {
+            tmp = storm::utility::dd::roundToGrid(tmp, roundingGrid.get(), env.solver().getDdTerminalRoundingMode());
+        }
 
         // Now check if the process already converged within our precision.
         converged = tmp.equalModuloPrecision(xCopy, precision, relative);
@@ -127,6 +137,9 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     } else {
         STORM_LOG_WARN("Iterative solver (jacobi) did not converge in " << iterationCount << " iterations.");
     }
+    if (roundingGrid) {
+        storm::utility::dd::reportRoundingError(roundingGrid.get(), env.solver().getDdTerminalRoundingMode(), iterationCount, precision, xCopy);
+    }
 
     return xCopy;
 }
@@ -135,7 +148,9 @@ template<storm::dd::DdType DdType, typename ValueType>
 typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult
 SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x,
                                                                              storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision,
-                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+                                                                             bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                                                             boost::optional<ValueType> const& roundingGrid,
+                                                                             DdTerminalRounding const& roundingMode) const {
     // Set up additional environment variables.
     storm::dd::Add<DdType, ValueType> currentX = x;
     uint_fast64_t iterations = 0;
@@ -144,6 +159,9 @@ SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(sto
     while (status == SolverStatus::InProgress && iterations < maximalIterations) {
         storm::dd::Add<DdType, ValueType> currentXAsColumn = currentX.swapVariables(this->rowColumnMetaVariablePairs);
         storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(currentXAsColumn, this->columnMetaVariables) + b;
+        if (roundingGrid) {
+            tmp = storm::utility::dd::roundToGrid(tmp, roundingGrid.get(), roundingMode);
+        }
 
         // Now check if the process already converged within our precision.
         if (tmp.equalModuloPrecision(currentX, precision, relativeTerminationCriterion)) {
@@ -154,6 +172,9 @@ SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(sto
         ++iterations;
         currentX = tmp;
     }
+    if (roundingGrid) {
+        storm::utility::dd::reportRoundingError(roundingGrid.get(), roundingMode, iterations, precision, currentX);
+    }
 
     return PowerIterationResult(status, iterations, currentX);
 }
@@ -165,7 +186,8 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
     PowerIterationResult result =
-        performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+        performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(),
+                              getRoundingGrid(env), env.solver().getDdTerminalRoundingMode());
 
     if (result.status == SolverStatus::Converged) {
         STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
@@ -176,6 +198,15 @@ storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, Val
     return result.values;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+boost::optional<ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::getRoundingGrid(Environment const& env) const {
+    if (env.solver().getDdTerminalRoundingGrid()) {
+        STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact, "Rounding the values of an exact computation, the result will not be exact.");
+        return storm::utility::convertNumber<ValueType>(env.solver().getDdTerminalRoundingGrid().get());
+    }
+    return boost::none;
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 bool SymbolicNativeLinearEquationSolver<DdType, ValueType>::isSolutionFixedPoint(storm::dd::Add<DdType, ValueType> const& x,
                                                                                  storm::dd::Add<DdType, ValueType> const& b) const {
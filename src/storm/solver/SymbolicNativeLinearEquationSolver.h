@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/SymbolicLinearEquationSolver.h"
@@ -121,8 +123,19 @@ class SymbolicNativeLinearEquationSolver : public SymbolicLinearEquationSolver<D
         storm::dd::Add<DdType, ValueType> values;
     };
 
+    /*!
+     * Performs power iteration. If a rounding grid is given, the values are rounded to multiples of it after each iteration (see
+     * storm::utility::dd::roundToGrid).
+     */
     PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b,
-                                               ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+                                               ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations,
+                                               boost::optional<ValueType> const& roundingGrid = boost::none,
+                                               DdTerminalRounding const& roundingMode = DdTerminalRounding::Nearest) const;
+
+    /*!
+     * Retrieves the grid to which the values are rounded after each iteration (if any).
+     */
+    boost::optional<ValueType> getRoundingGrid(Environment const& env) const;
 };
 
 template<storm::dd::DdType DdType, typename ValueType>
@@ -1,14 +1,19 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -48,12 +53,21 @@ storm::Environment TopologicalLinearEquationSolver<ValueType>::getEnvironmentFor
     storm::Environment subEnv(env);
     subEnv.solver().setLinearEquationSolverType(env.solver().topological().getUnderlyingEquationSolverType(),
                                                 env.solver().topological().isUnderlyingEquationSolverTypeSetFromDefault());
+    if (env.solver().isExactFloatFirst() && env.solver().topological().isUnderlyingEquationSolverTypeSetFromDefault() &&
+        !std::is_same<ValueType, storm::RationalFunction>::value) {
+        // The SCCs are solved by rational search which falls back to an exact LU decomposition of the SCC if needed.
+        subEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    }
     if (adaptPrecision) {
         STORM_LOG_ASSERT(this->longestSccChainSize, "Did not compute the longest SCC chain size although it is needed.");
         auto subEnvPrec = subEnv.solver().getPrecisionOfLinearEquationSolver(subEnv.solver().getLinearEquationSolverType());
         subEnv.solver().setLinearEquationSolverPrecision(
             static_cast<storm::RationalNumber>(subEnvPrec.first.get() / storm::utility::convertNumber<storm::RationalNumber>(this->longestSccChainSize.get())));
     }
+    // The SCC solvers are reset for every SCC, so they obtain their auxiliary vectors from a shared workspace.
+    if (!subEnv.solver().getWorkspace()) {
+        subEnv.solver().setWorkspace(std::make_shared<SolverWorkspace>());
+    }
     return subEnv;
 }
 
@@ -91,26 +105,28 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+        if (numberOfThreads > 1 && std::is_same<ValueType, storm::RationalFunction>::value) {
+            // Operations on rational functions share caches that are not thread-safe.
+            STORM_LOG_WARN("Solving SCCs sequentially since concurrent solving is not supported for rational functions.");
+            numberOfThreads = 1;
+        }
+        if (numberOfThreads > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, env.solver().topological().getBatchSize(), x, b);
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                returnValue = solveScc(sccSolverEnvironment, scc, this->sccSolver, sccAsBitVector, x, b) && returnValue;
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -132,6 +148,68 @@ void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bo
     }
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads,
+                                                                       uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    helper::SccTaskGraph<ValueType> taskGraph(*this->A, *this->sortedSccDecomposition, batchSize);
+    numberOfThreads = std::min(numberOfThreads, taskGraph.getNumberOfTasks());
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCC(s) in " << taskGraph.getNumberOfTasks() << " task(s) using " << numberOfThreads
+                              << " threads.");
+
+    // Every thread gets its own solver and auxiliary bit vector. The first thread uses the solver that is also used for sequential solving.
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> sccSolvers(numberOfThreads);
+    sccSolvers[0] = std::move(this->sccSolver);
+    std::vector<storm::storage::BitVector> sccAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+
+    std::atomic<bool> allConverged(true);
+    std::atomic<bool> aborted(false);
+    std::atomic<uint64_t> numberOfSolvedStates(0);
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+
+    // Each SCC only reads the values of the SCCs it depends on and writes its own values, so tasks do not interfere.
+    storm::utility::parallel::forEachTaskInDependencyOrder(taskGraph.getDependencies(), numberOfThreads, [&](uint64_t threadIndex, uint64_t task) {
+        if (aborted.load()) {
+            return;
+        }
+        uint64_t numberOfStates = 0;
+        for (uint64_t sccIndex = taskGraph.getFirstScc(task); sccIndex < taskGraph.getEndScc(task); ++sccIndex) {
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+            if (!solveScc(sccSolverEnvironment, scc, sccSolvers[threadIndex], sccAsBitVectors[threadIndex], x, b)) {
+                allConverged.store(false);
+            }
+            numberOfStates += scc.size();
+        }
+        numberOfStates += numberOfSolvedStates.fetch_add(numberOfStates);
+        if (threadIndex == 0) {
+            progress.updateProgress(numberOfStates);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            aborted.store(true);
+        }
+    });
+
+    this->sccSolver = std::move(sccSolvers[0]);
+    STORM_LOG_WARN_COND(!aborted.load(), "Topological solver aborted after analyzing " << numberOfSolvedStates.load() << "/" << x.size() << " states.");
+    return allConverged.load();
+}
+
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::StronglyConnectedComponent const& scc,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver,
+                                                          storm::storage::BitVector& sccAsBitVector, std::vector<ValueType>& x,
+                                                          std::vector<ValueType> const& b) const {
+    if (scc.size() == 1) {
+        return solveTrivialScc(*scc.begin(), x, b);
+    }
+    sccAsBitVector.clear();
+    for (auto const& state : scc) {
+        sccAsBitVector.set(state, true);
+    }
+    return solveScc(sccSolverEnvironment, sccSolver, sccAsBitVector, x, b);
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX,
                                                                  std::vector<ValueType> const& globalB) const {
@@ -182,21 +260,23 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
-                                                          std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver,
+                                                          storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
+                                                          std::vector<ValueType> const& globalB) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -216,20 +296,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
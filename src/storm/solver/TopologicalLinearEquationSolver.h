@@ -44,9 +44,18 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     bool solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
-    // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    // ... for the remaining cases (1 < scc.size() < x.size()), using (and if necessary creating) the given solver
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+    // Solves the given SCC of any size (but not the whole system) with the given solver. The bit vector is used as auxiliary storage.
+    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::StronglyConnectedComponent const& scc,
+                  std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector& sccAsBitVector,
+                  std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    // Solves all SCCs using the given number of threads, where an SCC is solved once all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, uint64_t batchSize, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -1,5 +1,10 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -7,10 +12,12 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -34,16 +41,13 @@ TopologicalMinMaxLinearEquationSolver<ValueType>::TopologicalMinMaxLinearEquatio
 }
 
 template<typename ValueType>
-storm::Environment TopologicalMinMaxLinearEquationSolver<ValueType>::getEnvironmentForUnderlyingSolver(storm::Environment const& env,
-                                                                                                       bool adaptPrecision) const {
+storm::Environment TopologicalMinMaxLinearEquationSolver<ValueType>::getEnvironmentForUnderlyingSolver(storm::Environment const& env) const {
     storm::Environment subEnv(env);
     subEnv.solver().minMax().setMethod(env.solver().topological().getUnderlyingMinMaxMethod(),
                                        env.solver().topological().isUnderlyingMinMaxMethodSetFromDefault());
-    if (adaptPrecision) {
-        STORM_LOG_ASSERT(this->longestSccChainSize, "Did not compute the longest SCC chain size although it is needed.");
-        storm::RationalNumber subEnvPrec =
-            subEnv.solver().minMax().getPrecision() / storm::utility::convertNumber<storm::RationalNumber>(this->longestSccChainSize.get());
-        subEnv.solver().minMax().setPrecision(subEnvPrec);
+    // The SCC solvers are reset for every SCC, so they obtain their auxiliary vectors from a shared workspace.
+    if (!subEnv.solver().getWorkspace()) {
+        subEnv.solver().setWorkspace(std::make_shared<SolverWorkspace>());
     }
     return subEnv;
 }
@@ -57,7 +61,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
 
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
         createSortedSccDecomposition(needAdaptPrecision);
@@ -70,13 +74,15 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 
     // We do not need to adapt the precision if all SCCs are trivial (i.e., the system is acyclic)
     needAdaptPrecision = needAdaptPrecision && (this->sortedSccDecomposition->size() != this->A->getRowGroupCount());
-
-    storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env, needAdaptPrecision);
-
-    if (this->longestSccChainSize) {
-        STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get());
+    if (needAdaptPrecision) {
+        STORM_LOG_INFO("Longest SCC chain size is " << this->sortedSccDecomposition->getMaxSccDepth() + 1);
+        computeSccPrecisionFactors(env.solver().minMax().getRelativeTerminationCriterion());
+    } else {
+        sccPrecisionFactors.clear();
     }
 
+    storm::Environment sccSolverEnvironment = getEnvironmentForUnderlyingSolver(env);
+
     bool returnValue = true;
     if (this->sortedSccDecomposition->size() == 1 && (!this->choiceFixedForRowGroup || this->choiceFixedForRowGroup.get().empty())) {
         // Handle the case where there is just one large SCC, as there are no fixed choices for states, we solve it like this
@@ -90,46 +96,36 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
                 this->schedulerChoices = std::vector<uint64_t>(x.size());
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
+        uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().topological().getNumberOfThreads());
+        if (numberOfThreads > 1 && sccSolverEnvironment.solver().minMax().getMethod() == MinMaxMethod::LinearProgramming) {
+            // LP solvers are not guaranteed to be thread-safe.
+            STORM_LOG_WARN("Solving SCCs sequentially since the underlying minmax method is linear programming.");
+            numberOfThreads = 1;
+        }
+        if (numberOfThreads > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, numberOfThreads, env.solver().topological().getBatchSize(), dir, x, b);
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            while (sccIndex < this->sortedSccDecomposition->size()) {
+                returnValue = solveScc(sccSolverEnvironment, dir, sccIndex, this->sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
         // If requested, we store the scheduler for retrieval.
         if (this->isTrackSchedulerSet()) {
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = SolverWorkspace::acquireVector<ValueType>(env, this->A->getRowGroupCount());
             }
             this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
             this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
@@ -144,13 +140,216 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(En
 }
 
 template<typename ValueType>
-void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needSccDepths) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
-    if (needLongestChainSize) {
-        this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needSccDepths));
+}
+
+template<typename ValueType>
+void TopologicalMinMaxLinearEquationSolver<ValueType>::computeSccPrecisionFactors(bool relative) const {
+    // The error of an SCC propagates to every state that reaches it. For an absolute criterion, the error at a state s is thus bounded by the sum over all
+    // SCCs C of P_s(reach C) * precision(C). Trivial SCCs are solved exactly. As SCCs of the same depth can not reach each other, the probabilities of reaching
+    // them sum up to at most one. We therefore split the budget evenly among the depths of non-trivial SCCs and, within a depth, give SCCs that are unlikely
+    // to be reached from a relevant state a looser precision. For a relative criterion, we only split the budget among the depths.
+    auto const& sccs = *this->sortedSccDecomposition;
+    uint64_t const noLevel = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> levelOfDepth(sccs.getMaxSccDepth() + 1, noLevel);
+    uint64_t numberOfLevels = 0;
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        if (sccs.getBlock(sccIndex).size() > 1 && levelOfDepth[sccs.getSccDepth(sccIndex)] == noLevel) {
+            levelOfDepth[sccs.getSccDepth(sccIndex)] = numberOfLevels++;
+        }
+    }
+    sccPrecisionFactors.assign(sccs.size(), 1.0);
+    if (numberOfLevels == 0) {
+        return;
+    }
+    double const levelBudget = 1.0 / numberOfLevels;
+
+    std::vector<double> weights = (relative || !this->hasRelevantValues()) ? std::vector<double>(sccs.size(), 1.0) : computeSccReachabilityWeights();
+    std::vector<std::vector<uint64_t>> sccsOfLevel(numberOfLevels);
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        if (sccs.getBlock(sccIndex).size() > 1) {
+            // SCCs are never solved with a looser precision than the one requested for the whole system.
+            sccPrecisionFactors[sccIndex] = levelBudget / std::max(weights[sccIndex], levelBudget);
+            sccsOfLevel[levelOfDepth[sccs.getSccDepth(sccIndex)]].push_back(sccIndex);
+        }
+    }
+
+    // Within each level, determine the largest error a relevant state can receive and scale the precisions such that it stays within the budget.
+    double smallestFactor = 1.0;
+    double largestFactor = 0.0;
+    for (auto& level : sccsOfLevel) {
+        std::sort(level.begin(), level.end(), [this](uint64_t lhs, uint64_t rhs) { return sccPrecisionFactors[lhs] > sccPrecisionFactors[rhs]; });
+        double remainingProbability = 1.0;
+        double worstCaseError = 0.0;
+        for (auto sccIndex : level) {
+            double probability = std::min(weights[sccIndex], remainingProbability);
+            worstCaseError += probability * sccPrecisionFactors[sccIndex];
+            remainingProbability -= probability;
+            if (remainingProbability <= 0.0) {
+                break;
+            }
+        }
+        for (auto sccIndex : level) {
+            if (worstCaseError > levelBudget) {
+                sccPrecisionFactors[sccIndex] *= levelBudget / worstCaseError;
+            }
+            smallestFactor = std::min(smallestFactor, sccPrecisionFactors[sccIndex]);
+            largestFactor = std::max(largestFactor, sccPrecisionFactors[sccIndex]);
+        }
     }
+    STORM_LOG_INFO("Solving non-trivial SCCs in " << numberOfLevels << " level(s) with " << smallestFactor << " to " << largestFactor
+                                                  << " times the requested precision.");
+}
+
+template<typename ValueType>
+std::vector<double> TopologicalMinMaxLinearEquationSolver<ValueType>::computeSccReachabilityWeights() const {
+    auto const& sccs = *this->sortedSccDecomposition;
+    std::vector<uint64_t> stateToScc(this->A->getRowGroupCount());
+    for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+        for (auto state : sccs.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+    std::vector<double> weights(sccs.size(), 0.0);
+    for (auto state : this->getRelevantValues()) {
+        weights[stateToScc[state]] = 1.0;
+    }
+
+    // An SCC only depends on SCCs with a smaller index, so we push the weights from the SCCs with large indices to the ones with smaller indices.
+    std::unordered_map<uint64_t, double> exitProbabilities;
+    std::unordered_map<uint64_t, double> rowExitProbabilities;
+    for (uint64_t sccIndex = sccs.size(); sccIndex > 0;) {
+        --sccIndex;
+        weights[sccIndex] = std::min(weights[sccIndex], 1.0);
+        if (weights[sccIndex] == 0.0) {
+            continue;
+        }
+        auto const& scc = sccs.getBlock(sccIndex);
+        exitProbabilities.clear();
+        if (scc.size() == 1) {
+            // A single state is left towards another SCC with at most the largest probability of one of its choices (not counting self-loops).
+            uint64_t state = *scc.begin();
+            for (uint64_t row = this->A->getRowGroupIndices()[state]; row < this->A->getRowGroupIndices()[state + 1]; ++row) {
+                rowExitProbabilities.clear();
+                double selfLoopProbability = 0.0;
+                for (auto const& entry : this->A->getRow(row)) {
+                    double probability = storm::utility::convertNumber<double>(entry.getValue());
+                    if (entry.getColumn() == state) {
+                        selfLoopProbability += probability;
+                    } else if (probability > 0.0) {
+                        rowExitProbabilities[stateToScc[entry.getColumn()]] += probability;
+                    }
+                }
+                if (selfLoopProbability >= 1.0) {
+                    continue;
+                }
+                for (auto const& sccProbabilityPair : rowExitProbabilities) {
+                    double& exitProbability = exitProbabilities[sccProbabilityPair.first];
+                    exitProbability = std::max(exitProbability, sccProbabilityPair.second / (1.0 - selfLoopProbability));
+                }
+            }
+        } else {
+            // A non-trivial SCC might be left towards each of its successor SCCs with probability one.
+            for (auto state : scc) {
+                for (auto const& entry : this->A->getRowGroup(state)) {
+                    if (stateToScc[entry.getColumn()] != sccIndex && !storm::utility::isZero(entry.getValue())) {
+                        exitProbabilities[stateToScc[entry.getColumn()]] = 1.0;
+                    }
+                }
+            }
+        }
+        for (auto const& sccProbabilityPair : exitProbabilities) {
+            weights[sccProbabilityPair.first] += weights[sccIndex] * sccProbabilityPair.second;
+        }
+    }
+    return weights;
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads,
+                                                                             uint64_t batchSize, OptimizationDirection dir, std::vector<ValueType>& x,
+                                                                             std::vector<ValueType> const& b) const {
+    helper::SccTaskGraph<ValueType> taskGraph(*this->A, *this->sortedSccDecomposition, batchSize);
+    numberOfThreads = std::min(numberOfThreads, taskGraph.getNumberOfTasks());
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCC(s) in " << taskGraph.getNumberOfTasks() << " task(s) using " << numberOfThreads
+                              << " threads.");
+
+    // Every thread gets its own solver and auxiliary bit vectors. The first thread uses the solver that is also used for sequential solving.
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> sccSolvers(numberOfThreads);
+    sccSolvers[0] = std::move(this->sccSolver);
+    std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+    std::vector<storm::storage::BitVector> sccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+
+    std::atomic<bool> allConverged(true);
+    std::atomic<bool> aborted(false);
+    std::atomic<uint64_t> numberOfSolvedStates(0);
+    storm::utility::ProgressMeasurement progress("states");
+    progress.setMaxCount(x.size());
+    progress.startNewMeasurement(0);
+
+    // Each SCC only reads the values of the SCCs it depends on and writes its own values, so tasks do not interfere.
+    storm::utility::parallel::forEachTaskInDependencyOrder(taskGraph.getDependencies(), numberOfThreads, [&](uint64_t threadIndex, uint64_t task) {
+        if (aborted.load()) {
+            return;
+        }
+        uint64_t numberOfStates = 0;
+        for (uint64_t sccIndex = taskGraph.getFirstScc(task); sccIndex < taskGraph.getEndScc(task); ++sccIndex) {
+            if (!solveScc(sccSolverEnvironment, dir, sccIndex, sccSolvers[threadIndex], sccRowGroupsAsBitVectors[threadIndex], sccRowsAsBitVectors[threadIndex],
+                          x, b)) {
+                allConverged.store(false);
+            }
+            numberOfStates += this->sortedSccDecomposition->getBlock(sccIndex).size();
+        }
+        numberOfStates += numberOfSolvedStates.fetch_add(numberOfStates);
+        if (threadIndex == 0) {
+            progress.updateProgress(numberOfStates);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            aborted.store(true);
+        }
+    });
+
+    this->sccSolver = std::move(sccSolvers[0]);
+    STORM_LOG_WARN_COND(!aborted.load(), "Topological solver aborted after analyzing " << numberOfSolvedStates.load() << "/" << x.size() << " states.");
+    return allConverged.load();
+}
+
+template<typename ValueType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, uint64_t sccIndex,
+                                                                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver,
+                                                                storm::storage::BitVector& sccRowGroupsAsBitVector, storm::storage::BitVector& sccRowsAsBitVector,
+                                                                std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+    if (scc.size() == 1) {
+        return solveTrivialScc(*scc.begin(), dir, x, b);
+    }
+
+    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+    sccRowGroupsAsBitVector.clear();
+    sccRowsAsBitVector.clear();
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroupsAsBitVector.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRowsAsBitVector.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRowsAsBitVector.set(row, true);
+            STORM_LOG_INFO("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+    if (!sccPrecisionFactors.empty()) {
+        storm::Environment adaptedEnvironment(sccSolverEnvironment);
+        adaptedEnvironment.solver().minMax().setPrecision(sccSolverEnvironment.solver().minMax().getPrecision() *
+                                                          storm::utility::convertNumber<storm::RationalNumber>(sccPrecisionFactors[sccIndex]));
+        return solveScc(adaptedEnvironment, dir, sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b);
+    }
+    return solveScc(sccSolverEnvironment, dir, sccSolver, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b);
 }
 
 template<typename ValueType>
@@ -283,16 +482,17 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveFullyConnectedEquati
 
 template<typename ValueType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
+                                                                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver,
                                                                 storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows,
                                                                 std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
 
     storm::storage::SparseMatrix<ValueType> sccA;
     if (this->choiceFixedForRowGroup) {
@@ -306,7 +506,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -315,11 +515,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -339,18 +539,18 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
     }
 
     // Requirements
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
     if (req.upperBounds() && this->hasUpperBound()) {
         req.clearUpperBounds();
     }
@@ -365,14 +565,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environme
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
     }
 
     // Set solution
@@ -393,7 +593,7 @@ MinMaxLinearEquationSolverRequirements TopologicalMinMaxLinearEquationSolver<Val
 template<typename ValueType>
 void TopologicalMinMaxLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
-    longestSccChainSize = boost::none;
+    sccPrecisionFactors.clear();
     sccSolver.reset();
     auxiliaryRowGroupVector.reset();
     StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
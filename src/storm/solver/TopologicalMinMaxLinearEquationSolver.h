@@ -31,10 +31,16 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
                                         std::vector<ValueType> const& b) const override;
 
    private:
-    storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
+    storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env) const;
 
     // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    void createSortedSccDecomposition(bool needSccDepths) const;
+
+    // Distributes the error budget of a sound computation over the non-trivial SCCs (see sccPrecisionFactors).
+    void computeSccPrecisionFactors(bool relative) const;
+
+    // Computes for each SCC an upper bound on the probability to reach it from a relevant state (under any scheduler).
+    std::vector<double> computeSccReachabilityWeights() const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -42,15 +48,26 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
                                            std::vector<ValueType> const& b) const;
-    // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
+    // ... for the remaining cases (1 < scc.size() < x.size()), using (and if necessary creating) the given solver
+    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& sccRowGroups,
                   storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
 
+    // Solves the SCC with the given index of any size (but not the whole system) with the given solver. The bit vectors are used as auxiliary storage.
+    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, uint64_t sccIndex,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector& sccRowGroupsAsBitVector,
+                  storm::storage::BitVector& sccRowsAsBitVector, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    // Solves all SCCs using the given number of threads, where an SCC is solved once all SCCs it depends on are solved.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, uint64_t batchSize, OptimizationDirection d,
+                               std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
-    mutable boost::optional<uint64_t> longestSccChainSize;
+    // For sound computations, the precision of each SCC relative to the requested precision. Empty if the precision is not adapted.
+    mutable std::vector<double> sccPrecisionFactors;
     mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
-    mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
+    mutable WorkspaceVector<ValueType> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 }  // namespace solver
 }  // namespace storm
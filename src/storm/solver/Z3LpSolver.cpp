@@ -212,6 +212,25 @@ void Z3LpSolver<ValueType>::addConstraint(std::string const& name, storm::expres
     solver->add(expressionAdapter->translateExpression(constraint));
 }
 
+template<typename ValueType>
+void Z3LpSolver<ValueType>::setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) {
+    storm::expressions::Expression newSummand = this->manager->rational(objectiveFunctionCoefficient) * variable;
+    // Every summand refers to exactly one variable, so we can replace the summand of the given variable in place.
+    for (auto& summand : optimizationSummands) {
+        if (summand.containsVariable({variable})) {
+            summand = newSummand;
+            this->currentModelHasBeenOptimized = false;
+            return;
+        }
+    }
+    // The variable did not appear in the objective function so far. As the change is not to be reverted by pop(), we insert it at the front.
+    optimizationSummands.insert(optimizationSummands.begin(), newSummand);
+    for (auto& indicator : incrementaOptimizationSummandIndicators) {
+        ++indicator;
+    }
+    this->currentModelHasBeenOptimized = false;
+}
+
 template<typename ValueType>
 void Z3LpSolver<ValueType>::optimize() const {
     // First incorporate all recent changes.
@@ -468,6 +487,12 @@ void Z3LpSolver<ValueType>::addConstraint(std::string const&, storm::expressions
                                                           "Yet, a method was called that requires this support.";
 }
 
+template<typename ValueType>
+void Z3LpSolver<ValueType>::setObjectiveFunctionCoefficient(storm::expressions::Variable const&, ValueType const&) {
+    throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without Z3 or the version of Z3 does not support optimization. "
+                                                          "Yet, a method was called that requires this support.";
+}
+
 template<typename ValueType>
 void Z3LpSolver<ValueType>::optimize() const {
     throw storm::exceptions::NotImplementedException() << "This version of storm was compiled without Z3 or the version of Z3 does not support optimization. "
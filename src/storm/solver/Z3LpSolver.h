@@ -85,6 +85,9 @@ class Z3LpSolver : public LpSolver<ValueType> {
     // Methods to add constraints
     virtual void addConstraint(std::string const& name, storm::expressions::Expression const& constraint) override;
 
+    // Methods to change the objective function.
+    virtual void setObjectiveFunctionCoefficient(storm::expressions::Variable const& variable, ValueType const& objectiveFunctionCoefficient) override;
+
     // Methods to optimize and retrieve optimality status.
     virtual void optimize() const override;
     virtual bool isInfeasible() const override;
@@ -2,8 +2,10 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -11,6 +13,9 @@ namespace solver {
 
 namespace helper {
 
+// The number of row groups of a level that are processed as one chunk. Levels with fewer row groups are processed by the calling thread.
+uint64_t const levelChunkSize = 256;
+
 /*!
  * Returns a reordering of the matrix row(groups) and columns such that we can solve the (minmax or linear) equation system in one go.
  * More precisely, let x be the result and i an arbitrary rowgroup index. Solving for rowgroup x[i] only requires knowledge of the result at rowgroups x[i+1],
@@ -71,6 +76,143 @@ boost::optional<std::vector<uint64_t>> computeTopologicalGroupOrdering(storm::st
     }
 }
 
+/*!
+ * Returns a reordering like computeTopologicalGroupOrdering, in which the row groups are additionally sorted by their level, i.e., the length of the
+ * longest path from the row group to a row group without successors (selfloops are ignored). Row groups with higher levels come first. The row groups
+ * of one level thus only depend on row groups of lower levels, which come later, such that each level can be processed in parallel once the levels
+ * behind it are processed.
+ *
+ * @param levelStarts Is set to the (new) index of the first row group of each level followed by the number of row groups.
+ * @return The reordering or none if the identity is such a reordering.
+ */
+template<typename ValueType>
+boost::optional<std::vector<uint64_t>> computeLevelGroupOrdering(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t>& levelStarts) {
+    uint64_t numGroups = matrix.getRowGroupCount();
+    auto topologicalOrdering = computeTopologicalGroupOrdering(matrix);
+
+    // Successors come after their predecessors in the topological ordering, so the levels can be computed in one backward pass.
+    std::vector<uint64_t> levels(numGroups, 0);
+    uint64_t maxLevel = 0;
+    for (uint64_t index = numGroups; index > 0;) {
+        --index;
+        uint64_t group = topologicalOrdering ? (*topologicalOrdering)[index] : index;
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (entry.getColumn() != group && !storm::utility::isZero(entry.getValue())) {
+                levels[group] = std::max(levels[group], levels[entry.getColumn()] + 1);
+            }
+        }
+        maxLevel = std::max(maxLevel, levels[group]);
+    }
+
+    // Sort the row groups by descending level while preserving the topological ordering within each level.
+    levelStarts.assign(maxLevel + 2, 0);
+    for (auto const& level : levels) {
+        ++levelStarts[maxLevel - level + 1];
+    }
+    for (uint64_t i = 1; i < levelStarts.size(); ++i) {
+        levelStarts[i] += levelStarts[i - 1];
+    }
+    std::vector<uint64_t> result(numGroups);
+    std::vector<uint64_t> nextIndices(levelStarts.begin(), levelStarts.end() - 1);
+    bool isIdentity = true;
+    for (uint64_t index = 0; index < numGroups; ++index) {
+        uint64_t group = topologicalOrdering ? (*topologicalOrdering)[index] : index;
+        uint64_t newIndex = nextIndices[maxLevel - levels[group]]++;
+        result[newIndex] = group;
+        isIdentity &= newIndex == group;
+    }
+    STORM_LOG_DEBUG("Split " << numGroups << " row groups into " << (levelStarts.size() - 1) << " levels for acyclic solving.");
+    if (isIdentity) {
+        return boost::none;
+    }
+    return result;
+}
+
+/*!
+ * Solves the equation system x = A*x + b (for a matrix with trivial row grouping), where the rows are sorted by levels as in
+ * computeLevelGroupOrdering. The levels are processed from back to front and the rows of each level are distributed over the given threads.
+ */
+template<typename ValueType>
+void solveLevelsParallel(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& levelStarts, std::vector<ValueType>& x,
+                         std::vector<ValueType> const& b, uint64_t numberOfThreads) {
+    for (uint64_t level = levelStarts.size() - 1; level > 0; --level) {
+        storm::utility::parallel::forEachChunk(levelStarts[level - 1], levelStarts[level], levelChunkSize, numberOfThreads,
+                                               [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                   for (uint64_t row = chunkBegin; row < chunkEnd; ++row) {
+                                                       ValueType value = b[row];
+                                                       for (auto const& entry : matrix.getRow(row)) {
+                                                           value += entry.getValue() * x[entry.getColumn()];
+                                                       }
+                                                       x[row] = std::move(value);
+                                                   }
+                                               });
+    }
+}
+
+template<typename ValueType, typename Compare>
+void solveLevelsParallel(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& levelStarts, std::vector<ValueType>& x,
+                         std::vector<ValueType> const& b, std::vector<uint64_t>* choices, uint64_t numberOfThreads) {
+    Compare compare;
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (uint64_t level = levelStarts.size() - 1; level > 0; --level) {
+        storm::utility::parallel::forEachChunk(levelStarts[level - 1], levelStarts[level], levelChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin,
+                                                                                                                     uint64_t chunkEnd) {
+            for (uint64_t group = chunkBegin; group < chunkEnd; ++group) {
+                uint64_t const groupBegin = rowGroupIndices[group];
+                uint64_t const groupSize = rowGroupIndices[group + 1] - groupBegin;
+                if (groupSize == 0) {
+                    continue;
+                }
+                auto multiplyRow = [&](uint64_t row) {
+                    ValueType value = b[row];
+                    for (auto const& entry : matrix.getRow(row)) {
+                        value += entry.getValue() * x[entry.getColumn()];
+                    }
+                    return value;
+                };
+
+                // Like the sequential backward sweep, we consider the rows of a group in reverse order and choices are only updated if the new
+                // choice is strictly better than the previously selected one.
+                uint64_t localRow = groupSize - 1;
+                ValueType currentValue = multiplyRow(groupBegin + localRow);
+                uint64_t selectedChoice = localRow;
+                bool oldChoiceFound = choices && (*choices)[group] == localRow;
+                ValueType oldSelectedChoiceValue = currentValue;
+                for (uint64_t j = 1; j < groupSize; ++j) {
+                    localRow = groupSize - 1 - j;
+                    ValueType newValue = multiplyRow(groupBegin + localRow);
+                    if (choices && (*choices)[group] == localRow) {
+                        oldChoiceFound = true;
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = localRow;
+                    }
+                }
+                x[group] = currentValue;
+                if (choices && (!oldChoiceFound || compare(currentValue, oldSelectedChoiceValue))) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        });
+    }
+}
+
+/*!
+ * Solves the min-max equation system x = min/max(A*x + b), where the row groups are sorted by levels as in computeLevelGroupOrdering.
+ * The levels are processed from back to front and the row groups of each level are distributed over the given threads.
+ */
+template<typename ValueType>
+void solveLevelsParallel(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& levelStarts, OptimizationDirection dir,
+                         std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint64_t>* choices, uint64_t numberOfThreads) {
+    if (minimize(dir)) {
+        solveLevelsParallel<ValueType, storm::utility::ElementLess<ValueType>>(matrix, levelStarts, x, b, choices, numberOfThreads);
+    } else {
+        solveLevelsParallel<ValueType, storm::utility::ElementGreater<ValueType>>(matrix, levelStarts, x, b, choices, numberOfThreads);
+    }
+}
+
 /// reorders the row group such that the i'th row of the new matrix corresponds to the order[i]'th row of the source matrix.
 /// Also eliminates selfloops p>0 and inserts 1/p into the bFactors
 template<typename ValueType>
@@ -0,0 +1,170 @@
+#include "storm/solver/helper/AdaptiveUniformizationHelper.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+std::vector<ValueType> computeTransientDistributionAdaptiveUniformization(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                          std::vector<ValueType> const& exitRates,
+                                                                          std::vector<ValueType> const& initialDistribution, ValueType timeBound,
+                                                                          ValueType epsilon) {
+    uint64_t const numberOfStates = rateMatrix.getRowCount();
+
+    // Self-loops do not change the distribution, so they are ignored.
+    std::vector<ValueType> outRates = exitRates;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : rateMatrix.getRow(state)) {
+            if (entry.getColumn() == state) {
+                outRates[state] -= entry.getValue();
+            }
+        }
+    }
+
+    // Determine for each step the largest rate among the states that are reachable within that many steps.
+    std::vector<uint64_t> distances(numberOfStates, std::numeric_limits<uint64_t>::max());
+    std::vector<uint64_t> layer, nextLayer;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (initialDistribution[state] > 0) {
+            distances[state] = 0;
+            layer.push_back(state);
+        }
+    }
+    std::vector<ValueType> stepRates;
+    ValueType maximalRate = 0;
+    while (!layer.empty()) {
+        nextLayer.clear();
+        for (auto state : layer) {
+            maximalRate = std::max(maximalRate, outRates[state]);
+            for (auto const& entry : rateMatrix.getRow(state)) {
+                if (entry.getValue() > 0 && distances[entry.getColumn()] == std::numeric_limits<uint64_t>::max()) {
+                    distances[entry.getColumn()] = stepRates.size() + 1;
+                    nextLayer.push_back(entry.getColumn());
+                }
+            }
+        }
+        stepRates.push_back(maximalRate);
+        std::swap(layer, nextLayer);
+    }
+    if (maximalRate <= 0 || timeBound <= 0) {
+        return initialDistribution;
+    }
+    // From this step on, all steps are uniformized with the maximal rate.
+    uint64_t const fullRateStep = std::find(stepRates.begin(), stepRates.end(), maximalRate) - stepRates.begin();
+    STORM_LOG_DEBUG("Adaptive uniformization reaches the maximal rate " << maximalRate << " after " << fullRateStep << " steps.");
+
+    // The number of steps taken until the time bound follows a birth process that leaves level k with rate stepRates[k]. We uniformize this
+    // process with the maximal rate.
+    auto foxGlynnResult = storm::utility::numerical::foxGlynn(maximalRate * timeBound, epsilon);
+    auto poissonWeight = [&foxGlynnResult](uint64_t index) {
+        return index < foxGlynnResult.left || index > foxGlynnResult.right ? static_cast<ValueType>(0) : foxGlynnResult.weights[index - foxGlynnResult.left];
+    };
+
+    // For the levels below the full rate, we explicitly track the distribution of the uniformized birth process. enteringMass[m] is the probability
+    // to reach the full rate level in the m-th step. Negligible mass is dropped from the lower levels.
+    std::vector<ValueType> slowWeights(fullRateStep, 0);
+    std::vector<ValueType> enteringMass;
+    if (fullRateStep == 0) {
+        enteringMass.push_back(1);
+    } else {
+        ValueType const dropThreshold = epsilon / (2 * (foxGlynnResult.right + 1));
+        std::vector<ValueType> levels(fullRateStep, 0);
+        levels.front() = 1;
+        uint64_t lowest = 0, highest = 0;
+        enteringMass.push_back(0);
+        for (uint64_t step = 0; step <= foxGlynnResult.right && lowest <= highest; ++step) {
+            ValueType const weight = poissonWeight(step);
+            if (weight > 0) {
+                for (uint64_t level = lowest; level <= highest; ++level) {
+                    slowWeights[level] += weight * levels[level];
+                }
+            }
+            ValueType entering = 0;
+            for (uint64_t level = highest + 1; level > lowest; --level) {
+                ValueType const advance = levels[level - 1] * stepRates[level - 1] / maximalRate;
+                levels[level - 1] -= advance;
+                if (level < fullRateStep) {
+                    levels[level] += advance;
+                } else {
+                    entering = advance;
+                }
+            }
+            if (highest + 1 < fullRateStep) {
+                ++highest;
+            }
+            enteringMass.push_back(entering);
+            while (lowest <= highest && levels[lowest] < dropThreshold) {
+                levels[lowest] = 0;
+                ++lowest;
+            }
+        }
+    }
+
+    // Above the full rate level, the birth process behaves like a Poisson process.
+    std::vector<ValueType> fastWeights(foxGlynnResult.right + 1, 0);
+    for (uint64_t step = 0; step < enteringMass.size(); ++step) {
+        if (enteringMass[step] > 0) {
+            for (uint64_t index = std::max<uint64_t>(step, foxGlynnResult.left); index <= foxGlynnResult.right; ++index) {
+                fastWeights[index - step] += enteringMass[step] * foxGlynnResult.weights[index - foxGlynnResult.left];
+            }
+        }
+    }
+
+    uint64_t lastStep = 0;
+    for (uint64_t step = fullRateStep + fastWeights.size(); step > 0; --step) {
+        ValueType const weight = step - 1 < fullRateStep ? slowWeights[step - 1] : fastWeights[step - 1 - fullRateStep];
+        if (weight > 0) {
+            lastStep = step - 1;
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Adaptive uniformization performs " << lastStep << " steps (standard uniformization: " << foxGlynnResult.right << ").");
+
+    // Finally, accumulate the distributions of the uniformized chain weighted with the probabilities of the levels.
+    std::vector<ValueType> result(numberOfStates, 0);
+    std::vector<ValueType> current = initialDistribution;
+    std::vector<ValueType> next(numberOfStates);
+    for (uint64_t step = 0;; ++step) {
+        ValueType const weight = (step < fullRateStep ? slowWeights[step] : fastWeights[step - fullRateStep]) / foxGlynnResult.totalWeight;
+        if (weight > 0) {
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                result[state] += weight * current[state];
+            }
+        }
+        if (step == lastStep) {
+            break;
+        }
+
+        ValueType const rate = step < fullRateStep ? stepRates[step] : maximalRate;
+        std::fill(next.begin(), next.end(), 0);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            ValueType const probability = current[state];
+            if (probability == 0) {
+                continue;
+            }
+            next[state] += probability * (1 - outRates[state] / rate);
+            for (auto const& entry : rateMatrix.getRow(state)) {
+                if (entry.getColumn() != state) {
+                    next[entry.getColumn()] += probability * entry.getValue() / rate;
+                }
+            }
+        }
+        std::swap(current, next);
+    }
+    return result;
+}
+
+template std::vector<double> computeTransientDistributionAdaptiveUniformization(storm::storage::SparseMatrix<double> const& rateMatrix,
+                                                                                std::vector<double> const& exitRates,
+                                                                                std::vector<double> const& initialDistribution, double timeBound,
+                                                                                double epsilon);
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Computes the transient distribution of a CTMC at the given time bound with adaptive uniformization (van Moorsel and Sanders). Instead of
+ * uniformizing all steps with the largest exit rate, the n-th step is uniformized with the largest exit rate among the states that are reachable
+ * within n steps from the initial distribution. The numbers of steps then follow a pure birth process rather than a Poisson distribution. If the
+ * initially reachable states are slow, this saves matrix-vector multiplications compared to standard uniformization. Once all states are
+ * reachable, the remaining steps behave like standard uniformization.
+ *
+ * @param rateMatrix The rate matrix of the CTMC, where row s holds the rates of the transitions leaving state s.
+ * @param exitRates The exit rates of the states (including the rates of self-loops).
+ * @param initialDistribution The distribution at time zero.
+ * @param timeBound The time bound.
+ * @param epsilon The (absolute) truncation error.
+ * @return The distribution at the given time bound.
+ */
+template<typename ValueType>
+std::vector<ValueType> computeTransientDistributionAdaptiveUniformization(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                          std::vector<ValueType> const& exitRates,
+                                                                          std::vector<ValueType> const& initialDistribution, ValueType timeBound,
+                                                                          ValueType epsilon);
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
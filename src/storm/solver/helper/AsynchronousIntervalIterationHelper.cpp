@@ -0,0 +1,180 @@
+#include "storm/solver/helper/AsynchronousIntervalIterationHelper.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+
+// The values are shared between the threads. Since stale values are fine, all accesses are relaxed.
+typedef std::vector<std::atomic<double>> SharedValues;
+
+double multiplyRow(storm::storage::SparseMatrix<double> const& matrix, uint64_t row, SharedValues const& x, std::vector<double> const& b) {
+    double result = b[row];
+    for (auto const& entry : matrix.getRow(row)) {
+        result += entry.getValue() * x[entry.getColumn()].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+template<storm::solver::OptimizationDirection Dir>
+double multiplyRowGroup(storm::storage::SparseMatrix<double> const& matrix, std::vector<uint64_t> const& rowGroupIndices, uint64_t group,
+                        SharedValues const& x, std::vector<double> const& b) {
+    uint64_t row = rowGroupIndices[group];
+    uint64_t const rowEnd = rowGroupIndices[group + 1];
+    STORM_LOG_ASSERT(row < rowEnd, "Unexpected empty row group " << group << ".");
+    double result = multiplyRow(matrix, row, x, b);
+    for (++row; row < rowEnd; ++row) {
+        double rowValue = multiplyRow(matrix, row, x, b);
+        if (Dir == storm::solver::OptimizationDirection::Minimize ? rowValue < result : rowValue > result) {
+            result = rowValue;
+        }
+    }
+    return result;
+}
+
+/*!
+ * Updates both bounds of the row groups in the given range in place. A bound is only overwritten if it gets tighter, which keeps the
+ * bounds monotone even if the values of other ranges are read while they are being updated.
+ */
+template<storm::solver::OptimizationDirection Dir>
+void sweep(storm::storage::SparseMatrix<double> const& matrix, std::vector<uint64_t> const& rowGroupIndices, uint64_t begin, uint64_t end,
+           SharedValues& lowerX, SharedValues& upperX, std::vector<double> const& b) {
+    for (uint64_t group = begin; group < end; ++group) {
+        double newLower = multiplyRowGroup<Dir>(matrix, rowGroupIndices, group, lowerX, b);
+        if (newLower > lowerX[group].load(std::memory_order_relaxed)) {
+            lowerX[group].store(newLower, std::memory_order_relaxed);
+        }
+        double newUpper = multiplyRowGroup<Dir>(matrix, rowGroupIndices, group, upperX, b);
+        if (newUpper < upperX[group].load(std::memory_order_relaxed)) {
+            upperX[group].store(newUpper, std::memory_order_relaxed);
+        }
+    }
+}
+
+bool isRangeConverged(uint64_t begin, uint64_t end, SharedValues const& lowerX, SharedValues const& upperX, double precision, bool relative,
+                      boost::optional<storm::storage::BitVector> const& relevantValues) {
+    for (uint64_t group = begin; group < end; ++group) {
+        if (relevantValues && !relevantValues->get(group)) {
+            continue;
+        }
+        if (!storm::utility::vector::equalModuloPrecision<double>(lowerX[group].load(std::memory_order_relaxed),
+                                                                  upperX[group].load(std::memory_order_relaxed), precision, relative)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+template<typename ValueType>
+AsynchronousIntervalIterationHelper<ValueType>::AsynchronousIntervalIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : matrix(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::pair<SolverStatus, uint64_t> AsynchronousIntervalIterationHelper<ValueType>::solveEquations(
+    std::vector<ValueType>&, std::vector<ValueType>&, std::vector<ValueType> const&, bool, ValueType const&, uint64_t, uint64_t,
+    boost::optional<storm::solver::OptimizationDirection> const&, boost::optional<storm::storage::BitVector> const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Asynchronous interval iteration is only supported for double precision values.");
+    return {SolverStatus::Aborted, 0};
+}
+
+template<>
+std::pair<SolverStatus, uint64_t> AsynchronousIntervalIterationHelper<double>::solveEquations(
+    std::vector<double>& lowerX, std::vector<double>& upperX, std::vector<double> const& b, bool relative, double const& precision, uint64_t maxSweeps,
+    uint64_t numberOfThreads, boost::optional<storm::solver::OptimizationDirection> const& dir,
+    boost::optional<storm::storage::BitVector> const& relevantValues) const {
+    uint64_t const numberOfRowGroups = lowerX.size();
+    STORM_LOG_ASSERT(upperX.size() == numberOfRowGroups, "Unexpected size of the upper bound vector.");
+    STORM_LOG_ASSERT(dir || matrix.hasTrivialRowGrouping(), "Expected an optimization direction for a matrix with non-trivial row grouping.");
+    if (numberOfRowGroups == 0) {
+        return {SolverStatus::Converged, 0};
+    }
+    // Retrieve the row groups before any thread is started, as trivial row groupings are only created on demand.
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    SharedValues sharedLowerX(numberOfRowGroups);
+    SharedValues sharedUpperX(numberOfRowGroups);
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        sharedLowerX[group].store(lowerX[group], std::memory_order_relaxed);
+        sharedUpperX[group].store(upperX[group], std::memory_order_relaxed);
+    }
+
+    // Every thread owns exactly one range. As every range is processed until all ranges converged, there must not be more ranges than threads.
+    numberOfThreads = std::max<uint64_t>(1ull, std::min(numberOfThreads, numberOfRowGroups));
+    uint64_t const chunkSize = (numberOfRowGroups + numberOfThreads - 1) / numberOfThreads;
+    uint64_t const numberOfChunks = (numberOfRowGroups + chunkSize - 1) / chunkSize;
+    bool const minimize = !dir || storm::solver::minimize(dir.get());
+
+    std::atomic<uint64_t> convergedChunks(0);
+    std::atomic<bool> abort(false);
+    std::atomic<bool> sweepLimitReached(false);
+    std::vector<uint64_t> sweepsPerChunk(numberOfChunks, 0);
+    storm::utility::parallel::forEachChunk(0, numberOfRowGroups, chunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        uint64_t& sweeps = sweepsPerChunk[chunkBegin / chunkSize];
+        bool chunkConverged = false;
+        try {
+            while (convergedChunks.load(std::memory_order_acquire) < numberOfChunks && !abort.load(std::memory_order_relaxed)) {
+                if (sweeps >= maxSweeps) {
+                    sweepLimitReached.store(true);
+                    abort.store(true);
+                    break;
+                }
+                if (minimize) {
+                    sweep<storm::solver::OptimizationDirection::Minimize>(matrix, rowGroupIndices, chunkBegin, chunkEnd, sharedLowerX, sharedUpperX, b);
+                } else {
+                    sweep<storm::solver::OptimizationDirection::Maximize>(matrix, rowGroupIndices, chunkBegin, chunkEnd, sharedLowerX, sharedUpperX, b);
+                }
+                ++sweeps;
+                // Since the bounds only get tighter, a converged range can not become unconverged again.
+                if (!chunkConverged && isRangeConverged(chunkBegin, chunkEnd, sharedLowerX, sharedUpperX, precision, relative, relevantValues)) {
+                    chunkConverged = true;
+                    convergedChunks.fetch_add(1, std::memory_order_release);
+                }
+                if (storm::utility::resources::isTerminate()) {
+                    abort.store(true);
+                }
+            }
+        } catch (...) {
+            // Make sure the other threads do not wait for this range forever.
+            abort.store(true);
+            throw;
+        }
+    });
+
+    for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+        lowerX[group] = sharedLowerX[group].load(std::memory_order_relaxed);
+        upperX[group] = sharedUpperX[group].load(std::memory_order_relaxed);
+    }
+
+    SolverStatus status = SolverStatus::Aborted;
+    if (convergedChunks.load() == numberOfChunks) {
+        status = SolverStatus::Converged;
+    } else if (sweepLimitReached.load()) {
+        status = SolverStatus::MaximalIterationsExceeded;
+    }
+    return {status, *std::max_element(sweepsPerChunk.begin(), sweepsPerChunk.end())};
+}
+
+template class AsynchronousIntervalIterationHelper<double>;
+template class AsynchronousIntervalIterationHelper<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
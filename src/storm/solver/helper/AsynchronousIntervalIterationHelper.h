@@ -0,0 +1,61 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+
+class BitVector;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs interval iteration asynchronously (chaotically) on multiple threads.
+ *
+ * Every thread owns a contiguous range of row groups and repeatedly sweeps over it, updating the lower and the upper
+ * bound of its row groups in place. The values of other ranges are read without any synchronization, i.e., a thread
+ * may see values that are arbitrarily stale. This is sound since every value that is ever written is a valid bound
+ * (the updates are monotone and never weaken a bound), so the bounds still enclose the solution.
+ * Because the bounds only get tighter, a range whose bounds are within the precision stays within the precision.
+ * Each thread therefore reports the convergence of its range once and keeps sweeping until all ranges converged.
+ */
+template<typename ValueType>
+class AsynchronousIntervalIterationHelper {
+   public:
+    AsynchronousIntervalIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * @param lowerX A lower bound on the solution. Contains the improved lower bound upon termination.
+     * @param upperX An upper bound on the solution. Contains the improved upper bound upon termination.
+     * @param b The values added to each matrix row (the b in A*x+b).
+     * @param relative Whether the precision is relative.
+     * @param precision The precision that the difference between lower and upper bound has to meet.
+     * @param maxSweeps The maximal number of sweeps a single thread performs over its range.
+     * @param numberOfThreads The number of threads to use.
+     * @param dir The optimization direction. If none is given, the matrix must have a trivial row grouping.
+     * @param relevantValues If given, we only check the precision at the row groups with the given indices.
+     * @return The status upon termination as well as the maximal number of sweeps of a single thread.
+     */
+    std::pair<SolverStatus, uint64_t> solveEquations(std::vector<ValueType>& lowerX, std::vector<ValueType>& upperX, std::vector<ValueType> const& b,
+                                                     bool relative, ValueType const& precision, uint64_t maxSweeps, uint64_t numberOfThreads,
+                                                     boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                     boost::optional<storm::storage::BitVector> const& relevantValues) const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
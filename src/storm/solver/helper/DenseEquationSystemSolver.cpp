@@ -0,0 +1,96 @@
+#include "storm/solver/helper/DenseEquationSystemSolver.h"
+
+#include <cmath>
+#include <utility>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+/*!
+ * Retrieves the row (at or below the given column) that is used as pivot for the given column or dimension if there is none.
+ */
+template<typename ValueType>
+uint64_t findPivotRow(uint64_t dimension, std::vector<ValueType> const& matrix, uint64_t column) {
+    for (uint64_t row = column; row < dimension; ++row) {
+        if (!storm::utility::isZero(matrix[row * dimension + column])) {
+            return row;
+        }
+    }
+    return dimension;
+}
+
+template<>
+uint64_t findPivotRow(uint64_t dimension, std::vector<double> const& matrix, uint64_t column) {
+    uint64_t pivotRow = dimension;
+    double pivotValue = 0.0;
+    for (uint64_t row = column; row < dimension; ++row) {
+        double value = std::abs(matrix[row * dimension + column]);
+        if (value > pivotValue) {
+            pivotRow = row;
+            pivotValue = value;
+        }
+    }
+    return pivotRow;
+}
+}  // namespace
+
+template<typename ValueType>
+bool solveDenseEquationSystem(uint64_t dimension, std::vector<ValueType>& matrix, std::vector<ValueType>& b) {
+    STORM_LOG_ASSERT(matrix.size() == dimension * dimension, "Unexpected size of the dense matrix.");
+    STORM_LOG_ASSERT(b.size() == dimension, "Unexpected size of the right-hand side.");
+
+    // Forward elimination. We apply the row operations to b directly, so the factors of L do not need to be stored.
+    for (uint64_t column = 0; column < dimension; ++column) {
+        uint64_t pivotRow = findPivotRow(dimension, matrix, column);
+        if (pivotRow == dimension) {
+            return false;
+        }
+        if (pivotRow != column) {
+            for (uint64_t j = column; j < dimension; ++j) {
+                std::swap(matrix[pivotRow * dimension + j], matrix[column * dimension + j]);
+            }
+            std::swap(b[pivotRow], b[column]);
+        }
+        ValueType const& pivot = matrix[column * dimension + column];
+        for (uint64_t row = column + 1; row < dimension; ++row) {
+            ValueType& rowHead = matrix[row * dimension + column];
+            if (storm::utility::isZero(rowHead)) {
+                continue;
+            }
+            ValueType factor = rowHead / pivot;
+            rowHead = storm::utility::zero<ValueType>();
+            for (uint64_t j = column + 1; j < dimension; ++j) {
+                matrix[row * dimension + j] -= factor * matrix[column * dimension + j];
+            }
+            b[row] -= factor * b[column];
+        }
+    }
+
+    // Backward substitution.
+    for (uint64_t row = dimension; row > 0;) {
+        --row;
+        ValueType& value = b[row];
+        for (uint64_t j = row + 1; j < dimension; ++j) {
+            value -= matrix[row * dimension + j] * b[j];
+        }
+        value /= matrix[row * dimension + row];
+    }
+    return true;
+}
+
+template bool solveDenseEquationSystem(uint64_t dimension, std::vector<double>& matrix, std::vector<double>& b);
+
+#ifdef STORM_HAVE_CARL
+template bool solveDenseEquationSystem(uint64_t dimension, std::vector<storm::RationalNumber>& matrix, std::vector<storm::RationalNumber>& b);
+template bool solveDenseEquationSystem(uint64_t dimension, std::vector<storm::RationalFunction>& matrix, std::vector<storm::RationalFunction>& b);
+#endif
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
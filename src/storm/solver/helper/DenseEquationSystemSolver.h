@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Equation systems with at most this many variables are solved with a dense LU decomposition rather than with a
+ * (sparse) linear equation solver. For such tiny systems, setting up the sparse solver dominates the solving time.
+ */
+uint64_t const MaximalDenseEquationSystemSize = 32;
+
+/*!
+ * Solves the equation system A*x = b using an LU decomposition of the dense matrix A (i.e., Gaussian elimination with
+ * partial pivoting). For floating point numbers, the row with the largest absolute value in the pivot column is chosen
+ * as pivot row; for exact number types, the first row with a non-zero entry is chosen.
+ *
+ * @param dimension The number of variables (and equations).
+ * @param matrix The matrix A in row-major order (i.e., entry (i,j) is at position i*dimension+j). The matrix is
+ * overwritten by the decomposition.
+ * @param b The right-hand side. It is overwritten by the solution x.
+ * @return False iff the matrix is singular. In this case, the content of b is unspecified.
+ */
+template<typename ValueType>
+bool solveDenseEquationSystem(uint64_t dimension, std::vector<ValueType>& matrix, std::vector<ValueType>& b);
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
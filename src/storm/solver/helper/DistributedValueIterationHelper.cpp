@@ -0,0 +1,84 @@
+#include "storm/solver/helper/DistributedValueIterationHelper.h"
+
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// The status codes that are reduced over all ranks. Taking the maximum lets an abort dominate and a single unconverged rank keep all ranks going.
+uint64_t const CONVERGED_CODE = 0;
+uint64_t const IN_PROGRESS_CODE = 1;
+uint64_t const ABORT_CODE = 2;
+}  // namespace
+
+template<typename ValueType>
+DistributedValueIterationHelper<ValueType>::DistributedValueIterationHelper(storm::storage::distributed::DistributedSparseMatrix<ValueType> const& matrix)
+    : matrix(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::pair<SolverStatus, uint64_t> DistributedValueIterationHelper<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                                                            bool relative, ValueType const& precision,
+                                                                                            uint64_t maxIterations,
+                                                                                            boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                                                            storm::storage::BitVector const* fixedStates) const {
+    uint64_t const numberOfLocalStates = matrix.getNumberOfLocalStates();
+    STORM_LOG_ASSERT(x.size() == numberOfLocalStates, "Unexpected size of the vector.");
+    STORM_LOG_ASSERT(!fixedStates || fixedStates->size() == numberOfLocalStates, "Unexpected size of the fixed states.");
+
+    // The current values are followed by the values of the ghost states.
+    std::vector<ValueType> currentX(matrix.getNumberOfColumns());
+    std::copy(x.begin(), x.end(), currentX.begin());
+    std::vector<ValueType> newX(numberOfLocalStates);
+
+    uint64_t iterations = 0;
+    uint64_t globalCode = IN_PROGRESS_CODE;
+    while (globalCode == IN_PROGRESS_CODE && iterations < maxIterations) {
+        matrix.synchronizeGhostValues(currentX);
+        matrix.multiplyAndReduce(dir, currentX, b, newX);
+        if (fixedStates) {
+            for (auto const& state : *fixedStates) {
+                newX[state] = currentX[state];
+            }
+        }
+
+        bool localConverged = true;
+        for (uint64_t state = 0; state < numberOfLocalStates; ++state) {
+            if (localConverged && !storm::utility::vector::equalModuloPrecision<ValueType>(currentX[state], newX[state], precision, relative)) {
+                localConverged = false;
+            }
+            currentX[state] = newX[state];
+        }
+        ++iterations;
+
+        uint64_t localCode = storm::utility::resources::isTerminate() ? ABORT_CODE : (localConverged ? CONVERGED_CODE : IN_PROGRESS_CODE);
+        globalCode = matrix.getCommunicator().allreduceMax(localCode);
+    }
+    std::copy(currentX.begin(), currentX.begin() + numberOfLocalStates, x.begin());
+
+    SolverStatus status = SolverStatus::MaximalIterationsExceeded;
+    if (globalCode == CONVERGED_CODE) {
+        status = SolverStatus::Converged;
+    } else if (globalCode == ABORT_CODE) {
+        status = SolverStatus::Aborted;
+    }
+    if (matrix.getCommunicator().getRank() == 0) {
+        STORM_LOG_INFO("Distributed value iteration on " << matrix.getCommunicator().getNumberOfRanks() << " ranks terminated with status " << status
+                                                         << " after " << iterations << " iterations.");
+    }
+    return {status, iterations};
+}
+
+template class DistributedValueIterationHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/distributed/DistributedSparseMatrix.h"
+
+namespace storm {
+
+namespace storage {
+class BitVector;
+}
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs value iteration on a matrix that is distributed over several ranks. In every iteration, the ranks exchange
+ * the values of their ghost states, multiply their local rows and agree on whether to continue with a single
+ * reduction, so all ranks perform the same number of iterations.
+ */
+template<typename ValueType>
+class DistributedValueIterationHelper {
+   public:
+    DistributedValueIterationHelper(storm::storage::distributed::DistributedSparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Iterates x' = A*x + b (where the values of each row group are reduced according to the optimization direction)
+     * until the values of all ranks changed by at most the given precision. Has to be called on all ranks.
+     *
+     * @param x The initial values of the local states. Contains the values of the local states upon termination.
+     * @param b If given, the values added to each local row.
+     * @param relative Whether the precision is relative.
+     * @param precision The precision that the change of every value has to meet.
+     * @param maxIterations The maximal number of iterations.
+     * @param dir The optimization direction. If none is given, the local rows must have a trivial row grouping.
+     * @param fixedStates If given, the (local) states whose values are not updated.
+     * @return The status upon termination (which is the same on all ranks) as well as the number of iterations.
+     */
+    std::pair<SolverStatus, uint64_t> solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const* b, bool relative, ValueType const& precision,
+                                                     uint64_t maxIterations, boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                     storm::storage::BitVector const* fixedStates = nullptr) const;
+
+   private:
+    storm::storage::distributed::DistributedSparseMatrix<ValueType> const& matrix;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
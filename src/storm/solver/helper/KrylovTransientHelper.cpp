@@ -0,0 +1,364 @@
+#include "storm/solver/helper/KrylovTransientHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+
+template<typename ValueType>
+std::vector<ValueType> multiplyDense(uint64_t dimension, std::vector<ValueType> const& a, std::vector<ValueType> const& b) {
+    std::vector<ValueType> result(dimension * dimension, 0);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (uint64_t k = 0; k < dimension; ++k) {
+            ValueType const factor = a[row * dimension + k];
+            if (factor != 0) {
+                for (uint64_t column = 0; column < dimension; ++column) {
+                    result[row * dimension + column] += factor * b[k * dimension + column];
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/*!
+ * Solves A * X = B for the dense square matrices A and B (in row-major order) with Gaussian elimination with partial pivoting. Both A and B are
+ * overwritten, where B holds the solution afterwards.
+ */
+template<typename ValueType>
+void solveDense(uint64_t dimension, std::vector<ValueType>& a, std::vector<ValueType>& b) {
+    for (uint64_t column = 0; column < dimension; ++column) {
+        uint64_t pivotRow = column;
+        for (uint64_t row = column + 1; row < dimension; ++row) {
+            if (std::abs(a[row * dimension + column]) > std::abs(a[pivotRow * dimension + column])) {
+                pivotRow = row;
+            }
+        }
+        STORM_LOG_THROW(a[pivotRow * dimension + column] != 0, storm::exceptions::InvalidStateException,
+                        "Singular denominator in Padé approximation of the matrix exponential.");
+        if (pivotRow != column) {
+            std::swap_ranges(a.begin() + pivotRow * dimension, a.begin() + (pivotRow + 1) * dimension, a.begin() + column * dimension);
+            std::swap_ranges(b.begin() + pivotRow * dimension, b.begin() + (pivotRow + 1) * dimension, b.begin() + column * dimension);
+        }
+        for (uint64_t row = column + 1; row < dimension; ++row) {
+            ValueType const factor = a[row * dimension + column] / a[column * dimension + column];
+            if (factor != 0) {
+                for (uint64_t k = column; k < dimension; ++k) {
+                    a[row * dimension + k] -= factor * a[column * dimension + k];
+                }
+                for (uint64_t k = 0; k < dimension; ++k) {
+                    b[row * dimension + k] -= factor * b[column * dimension + k];
+                }
+            }
+        }
+    }
+    for (uint64_t column = dimension; column > 0; --column) {
+        uint64_t const row = column - 1;
+        for (uint64_t k = 0; k < dimension; ++k) {
+            ValueType value = b[row * dimension + k];
+            for (uint64_t other = row + 1; other < dimension; ++other) {
+                value -= a[row * dimension + other] * b[other * dimension + k];
+            }
+            b[row * dimension + k] = value / a[row * dimension + row];
+        }
+    }
+}
+
+template<typename ValueType>
+ValueType computeNorm(std::vector<ValueType> const& vector) {
+    ValueType result = 0;
+    for (auto const& value : vector) {
+        result += value * value;
+    }
+    return std::sqrt(result);
+}
+
+/*!
+ * Rounds the given step size up to two significant digits (as done by Expokit) to avoid step sizes that only differ by rounding errors.
+ */
+template<typename ValueType>
+ValueType roundStepSize(ValueType stepSize) {
+    ValueType const scale = std::pow(static_cast<ValueType>(10), std::floor(std::log10(stepSize)) - 1);
+    return std::ceil(stepSize / scale) * scale;
+}
+
+}  // namespace
+
+template<typename ValueType>
+std::vector<ValueType> computeDenseMatrixExponential(uint64_t dimension, std::vector<ValueType> const& matrix) {
+    uint64_t const degree = 6;
+
+    // Scale the matrix such that its norm is below 1/2.
+    ValueType norm = 0;
+    for (uint64_t row = 0; row < dimension; ++row) {
+        ValueType rowSum = 0;
+        for (uint64_t column = 0; column < dimension; ++column) {
+            rowSum += std::abs(matrix[row * dimension + column]);
+        }
+        norm = std::max(norm, rowSum);
+    }
+    int64_t const squarings = norm > 0 ? std::max<int64_t>(0, static_cast<int64_t>(std::floor(std::log2(norm))) + 2) : 0;
+    std::vector<ValueType> scaled = matrix;
+    ValueType const scaling = std::ldexp(static_cast<ValueType>(1), -static_cast<int>(squarings));
+    for (auto& value : scaled) {
+        value *= scaling;
+    }
+
+    // The coefficients of the Padé approximation.
+    std::vector<ValueType> coefficients(degree + 1, 1);
+    for (uint64_t k = 1; k <= degree; ++k) {
+        coefficients[k] = coefficients[k - 1] * static_cast<ValueType>(degree + 1 - k) / static_cast<ValueType>(k * (2 * degree + 1 - k));
+    }
+
+    // The numerator is V + U and the denominator is V - U, where V collects the even and U the odd powers.
+    std::vector<ValueType> const square = multiplyDense(dimension, scaled, scaled);
+    std::vector<ValueType> const fourth = multiplyDense(dimension, square, square);
+    std::vector<ValueType> const sixth = multiplyDense(dimension, fourth, square);
+    std::vector<ValueType> even(dimension * dimension), oddFactor(dimension * dimension);
+    for (uint64_t index = 0; index < dimension * dimension; ++index) {
+        even[index] = coefficients[2] * square[index] + coefficients[4] * fourth[index] + coefficients[6] * sixth[index];
+        oddFactor[index] = coefficients[3] * square[index] + coefficients[5] * fourth[index];
+    }
+    for (uint64_t diagonal = 0; diagonal < dimension; ++diagonal) {
+        even[diagonal * dimension + diagonal] += coefficients[0];
+        oddFactor[diagonal * dimension + diagonal] += coefficients[1];
+    }
+    std::vector<ValueType> const odd = multiplyDense(dimension, scaled, oddFactor);
+    std::vector<ValueType> numerator(dimension * dimension), denominator(dimension * dimension);
+    for (uint64_t index = 0; index < dimension * dimension; ++index) {
+        numerator[index] = even[index] + odd[index];
+        denominator[index] = even[index] - odd[index];
+    }
+    solveDense(dimension, denominator, numerator);
+
+    for (int64_t squaring = 0; squaring < squarings; ++squaring) {
+        numerator = multiplyDense(dimension, numerator, numerator);
+    }
+    return numerator;
+}
+
+template<typename ValueType>
+std::vector<std::vector<ValueType>> computeTransientProbabilitiesKrylov(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                        ValueType uniformizationRate, std::vector<ValueType> const* addVector,
+                                                                        std::vector<ValueType> const& values, std::vector<ValueType> const& timeBounds,
+                                                                        ValueType epsilon, bool cumulative, uint64_t subspaceDimension) {
+    STORM_LOG_ASSERT(!cumulative || addVector == nullptr, "Cumulative transient probabilities can not be computed with an add vector.");
+    STORM_LOG_ASSERT(std::is_sorted(timeBounds.begin(), timeBounds.end()), "Time bounds must be sorted.");
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+
+    // If there is an add vector (or the integral is to be computed), the system gets an additional dimension whose value stays one. The
+    // corresponding column of the generator holds the (scaled) add vector (or the initial values, respectively).
+    std::vector<ValueType> const* affineColumn = cumulative ? &values : addVector;
+    ValueType const affineFactor = cumulative ? static_cast<ValueType>(1) : uniformizationRate;
+    uint64_t const dimension = numberOfStates + (affineColumn ? 1 : 0);
+    auto multiply = [&](std::vector<ValueType> const& x, std::vector<ValueType>& y) {
+        for (uint64_t row = 0; row < numberOfStates; ++row) {
+            ValueType sum = -x[row];
+            for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                sum += entry.getValue() * x[entry.getColumn()];
+            }
+            sum *= uniformizationRate;
+            if (affineColumn) {
+                sum += affineFactor * (*affineColumn)[row] * x[numberOfStates];
+            }
+            y[row] = sum;
+        }
+        if (affineColumn) {
+            y[numberOfStates] = 0;
+        }
+    };
+
+    // The infinity norm of the generator.
+    ValueType generatorNorm = 0;
+    for (uint64_t row = 0; row < numberOfStates; ++row) {
+        ValueType diagonal = -1;
+        ValueType rowSum = 0;
+        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                diagonal += entry.getValue();
+            } else {
+                rowSum += std::abs(entry.getValue());
+            }
+        }
+        rowSum = uniformizationRate * (rowSum + std::abs(diagonal));
+        if (affineColumn) {
+            rowSum += std::abs(affineFactor * (*affineColumn)[row]);
+        }
+        generatorNorm = std::max(generatorNorm, rowSum);
+    }
+
+    std::vector<ValueType> current(dimension, 0);
+    if (cumulative) {
+        current[numberOfStates] = 1;
+    } else {
+        std::copy(values.begin(), values.end(), current.begin());
+        if (affineColumn) {
+            current[numberOfStates] = 1;
+        }
+    }
+    std::vector<std::vector<ValueType>> result;
+    auto addResult = [&]() {
+        // Rounding errors may yield (tiny) negative values.
+        result.emplace_back(current.begin(), current.begin() + numberOfStates);
+        for (auto& value : result.back()) {
+            value = std::max<ValueType>(value, 0);
+        }
+    };
+
+    uint64_t nextBound = 0;
+    ValueType currentTime = 0;
+    ValueType beta = computeNorm(current);
+    if (generatorNorm == 0 || beta == 0) {
+        // The vector does not change over time.
+        while (nextBound < timeBounds.size()) {
+            addResult();
+            ++nextBound;
+        }
+        return result;
+    }
+
+    // The parameters of the step size control as chosen by Expokit.
+    uint64_t const m = std::max<uint64_t>(2, std::min<uint64_t>(subspaceDimension, dimension));
+    ValueType const breakdownTolerance = static_cast<ValueType>(1e-7) * generatorNorm;
+    ValueType const roundoff = generatorNorm * std::numeric_limits<ValueType>::epsilon();
+    ValueType const gamma = 0.9;
+    ValueType const delta = 1.2;
+    uint64_t const maximalNumberOfRejections = 10;
+    ValueType const finalTime = timeBounds.empty() ? static_cast<ValueType>(0) : timeBounds.back();
+    ValueType const tolerance = epsilon / std::max<ValueType>(finalTime, 1);
+
+    ValueType xm = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+    ValueType const fact = std::pow((m + 1) / std::exp(static_cast<ValueType>(1)), static_cast<ValueType>(m + 1)) * std::sqrt(2 * M_PI * (m + 1));
+    ValueType nextStepSize = roundStepSize((1 / generatorNorm) * std::pow((fact * epsilon) / (4 * beta * generatorNorm), xm));
+
+    std::vector<std::vector<ValueType>> basis(m + 1, std::vector<ValueType>(dimension));
+    std::vector<ValueType> product(dimension);
+    uint64_t numberOfSteps = 0;
+    while (nextBound < timeBounds.size()) {
+        if (timeBounds[nextBound] <= currentTime) {
+            addResult();
+            ++nextBound;
+            continue;
+        }
+        ValueType stepSize = std::min(nextStepSize, timeBounds[nextBound] - currentTime);
+        bool reachesBound = stepSize == timeBounds[nextBound] - currentTime;
+
+        // Build an orthonormal basis of the Krylov subspace with the Arnoldi process.
+        uint64_t const hessenbergDimension = m + 2;
+        std::vector<ValueType> hessenberg(hessenbergDimension * hessenbergDimension, 0);
+        for (uint64_t index = 0; index < dimension; ++index) {
+            basis[0][index] = current[index] / beta;
+        }
+        uint64_t basisSize = m;
+        uint64_t extraDimensions = 2;
+        for (uint64_t j = 0; j < m; ++j) {
+            multiply(basis[j], product);
+            for (uint64_t i = 0; i <= j; ++i) {
+                ValueType dotProduct = 0;
+                for (uint64_t index = 0; index < dimension; ++index) {
+                    dotProduct += basis[i][index] * product[index];
+                }
+                hessenberg[i * hessenbergDimension + j] = dotProduct;
+                for (uint64_t index = 0; index < dimension; ++index) {
+                    product[index] -= dotProduct * basis[i][index];
+                }
+            }
+            ValueType const norm = computeNorm(product);
+            if (norm < breakdownTolerance) {
+                // The subspace is invariant under the generator (a 'happy breakdown'), so the exponential is exact for any step size.
+                extraDimensions = 0;
+                basisSize = j + 1;
+                stepSize = timeBounds[nextBound] - currentTime;
+                reachesBound = true;
+                break;
+            }
+            hessenberg[(j + 1) * hessenbergDimension + j] = norm;
+            for (uint64_t index = 0; index < dimension; ++index) {
+                basis[j + 1][index] = product[index] / norm;
+            }
+        }
+        ValueType nextBasisNorm = 0;
+        if (extraDimensions != 0) {
+            hessenberg[(m + 1) * hessenbergDimension + m] = 1;
+            multiply(basis[m], product);
+            nextBasisNorm = computeNorm(product);
+        }
+
+        // Compute the exponential of the (small) Hessenberg matrix, reducing the step size until the estimated error is small enough.
+        uint64_t const exponentialDimension = basisSize + extraDimensions;
+        std::vector<ValueType> exponential;
+        ValueType localError = 0;
+        for (uint64_t rejections = 0;; ++rejections) {
+            std::vector<ValueType> scaledHessenberg(exponentialDimension * exponentialDimension);
+            for (uint64_t row = 0; row < exponentialDimension; ++row) {
+                for (uint64_t column = 0; column < exponentialDimension; ++column) {
+                    scaledHessenberg[row * exponentialDimension + column] = stepSize * hessenberg[row * hessenbergDimension + column];
+                }
+            }
+            exponential = computeDenseMatrixExponential(exponentialDimension, scaledHessenberg);
+            if (extraDimensions == 0) {
+                localError = breakdownTolerance;
+                break;
+            }
+
+            ValueType const phi1 = std::abs(beta * exponential[m * exponentialDimension]);
+            ValueType const phi2 = std::abs(beta * exponential[(m + 1) * exponentialDimension] * nextBasisNorm);
+            if (phi1 > 10 * phi2) {
+                localError = phi2;
+                xm = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+            } else if (phi1 > phi2) {
+                localError = (phi1 * phi2) / (phi1 - phi2);
+                xm = static_cast<ValueType>(1) / static_cast<ValueType>(m);
+            } else {
+                localError = phi1;
+                xm = static_cast<ValueType>(1) / static_cast<ValueType>(m - 1);
+            }
+            if (localError <= delta * stepSize * tolerance) {
+                break;
+            }
+            STORM_LOG_THROW(rejections < maximalNumberOfRejections, storm::exceptions::InvalidStateException,
+                            "The Krylov method failed to reach the required precision.");
+            stepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, xm));
+            reachesBound = false;
+        }
+
+        // The new vector is the (scaled) first column of the exponential in terms of the basis.
+        uint64_t const usedBasisSize = basisSize + (extraDimensions == 0 ? 0 : 1);
+        std::fill(current.begin(), current.end(), 0);
+        for (uint64_t i = 0; i < usedBasisSize; ++i) {
+            ValueType const factor = beta * exponential[i * exponentialDimension];
+            for (uint64_t index = 0; index < dimension; ++index) {
+                current[index] += factor * basis[i][index];
+            }
+        }
+        beta = computeNorm(current);
+        currentTime = reachesBound ? timeBounds[nextBound] : currentTime + stepSize;
+        localError = std::max(localError, roundoff);
+        nextStepSize = roundStepSize(gamma * stepSize * std::pow(stepSize * tolerance / localError, xm));
+        ++numberOfSteps;
+        if (beta == 0) {
+            // All further vectors are zero.
+            currentTime = finalTime;
+        }
+    }
+    STORM_LOG_DEBUG("Krylov method took " << numberOfSteps << " steps with subspaces of dimension " << m << ".");
+    return result;
+}
+
+template std::vector<std::vector<double>> computeTransientProbabilitiesKrylov(storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                              double uniformizationRate, std::vector<double> const* addVector,
+                                                                              std::vector<double> const& values, std::vector<double> const& timeBounds,
+                                                                              double epsilon, bool cumulative, uint64_t subspaceDimension);
+template std::vector<double> computeDenseMatrixExponential(uint64_t dimension, std::vector<double> const& matrix);
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
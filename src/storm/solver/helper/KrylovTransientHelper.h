@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Computes transient probabilities of a CTMC with a Krylov subspace method (Arnoldi with adaptive time steps as in Expokit's expv). In contrast to
+ * uniformization, whose number of matrix-vector multiplications grows with the largest rate times the time bound, the number of steps adapts to the
+ * dynamics, which makes the method suited for stiff models whose rates span several orders of magnitude.
+ *
+ * The generator Q of the CTMC is given through the uniformized matrix P and the uniformization rate q with Q = q * (P - I), such that the result
+ * coincides with the one of SparseCtmcCslHelper::computeTransientProbabilities:
+ * - If no add vector b is given, the result for time bound t is exp(t * Q) * values.
+ * - Otherwise, the result is the expectation of v_N, where v_0 = values, v_{k+1} = P * v_k + b and N is Poisson distributed with parameter q*t.
+ * - If cumulative is set, the result is the integral of exp(s * Q) * values for s from 0 to t (mixed Poisson probabilities).
+ * The latter two are reduced to the first one by extending the system with an additional dimension.
+ *
+ * @param uniformizedMatrix The uniformized matrix P.
+ * @param uniformizationRate The uniformization rate q.
+ * @param addVector The vector that is added in each step (if any). It must not be given if cumulative is set.
+ * @param values The initial vector.
+ * @param timeBounds The time bounds in ascending order.
+ * @param epsilon The (absolute) precision of the result.
+ * @param cumulative Whether the integral over the transient probabilities is to be computed.
+ * @param subspaceDimension The dimension of the Krylov subspaces, which determines the number of vectors that are kept in memory.
+ * @return For each time bound, the resulting vector.
+ */
+template<typename ValueType>
+std::vector<std::vector<ValueType>> computeTransientProbabilitiesKrylov(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                        ValueType uniformizationRate, std::vector<ValueType> const* addVector,
+                                                                        std::vector<ValueType> const& values, std::vector<ValueType> const& timeBounds,
+                                                                        ValueType epsilon, bool cumulative = false, uint64_t subspaceDimension = 30);
+
+/*!
+ * Computes exp(matrix) of the given dense matrix with a diagonal Padé approximation of degree 6 and scaling and squaring.
+ *
+ * @param dimension The number of rows (and columns) of the matrix.
+ * @param matrix The matrix in row-major order.
+ * @return The exponential of the matrix in row-major order.
+ */
+template<typename ValueType>
+std::vector<ValueType> computeDenseMatrixExponential(uint64_t dimension, std::vector<ValueType> const& matrix);
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -1,8 +1,13 @@
 #include "OptimisticValueIterationHelper.h"
 
+#include <limits>
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
+#include "storm/solver/SolverTelemetry.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -281,10 +286,16 @@ ValueType IterationHelper<ValueType>::multiplyRowGroup(IndexType const& rowGroup
 }  // namespace oviinternal
 
 template<typename ValueType>
-OptimisticValueIterationHelper<ValueType>::OptimisticValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : iterationHelper(matrix) {
+OptimisticValueIterationHelper<ValueType>::OptimisticValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : iterationHelper(matrix), bytesPerMultiplication(SolverTelemetryTracker::getBytesPerMultiplication(matrix)), upperBoundVerified(false) {
     // Intentionally left empty.
 }
 
+template<typename ValueType>
+bool OptimisticValueIterationHelper<ValueType>::hasVerifiedUpperBound() const {
+    return upperBoundVerified;
+}
+
 template<typename ValueType>
 std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::solveEquations(
     Environment const& env, std::vector<ValueType>* lowerX, std::vector<ValueType>* upperX, std::vector<ValueType> const& b, bool relative, ValueType precision,
@@ -313,8 +324,15 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
         (storm::utility::one<ValueType>() + storm::utility::convertNumber<ValueType>(env.solver().ovi().getUpperBoundGuessingFactor()) * precision);
     // Initial precision for the value iteration calls
     ValueType iterationPrecision = precision;
+    // If several (Gauss-Seidel) threads are available, the lower bound is iterated speculatively while the upper bound is verified.
+    bool const concurrentVerification = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads()) > 1;
 
     SolverStatus status = SolverStatus::InProgress;
+    upperBoundVerified = false;
+
+    // Multiplications of the lower bound during the verification phase are reported together with the next upper bound iteration.
+    SolverTelemetryTracker telemetry(env, "OptimisticValueIterationHelper", "optimistic value iteration", bytesPerMultiplication);
+    uint64_t unreportedMultiplications = 0;
 
     storm::utility::ProgressMeasurement progress("iterations.");
     progress.startNewMeasurement(0);
@@ -324,8 +342,12 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
             dir ? iterationHelper.repeatedIterate(dir.get(), *lowerX, b, iterationPrecision, relative, schedulerFixedForRowgroup, scheduler)
                 : iterationHelper.repeatedIterate(*lowerX, b, iterationPrecision, relative, schedulerFixedForRowgroup, scheduler);
         overallIterations += lastValueIterationIterations;
+        telemetry.recordIteration(overallIterations, std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(), 0,
+                                  lastValueIterationIterations + unreportedMultiplications);
+        unreportedMultiplications = 0;
 
         bool intervalIterationNeeded = false;
+        upperBoundVerified = false;
         currentVerificationIterations = 0;
 
         if (relative) {
@@ -344,14 +366,43 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
             // Perform value iteration stepwise for lower bound and guessed upper bound
 
             // Upper bound iteration
-            auto upperBoundIterResult = dir ? iterationHelper.iterateUpper(dir.get(), *upperX, b, !noTerminationGuarantee)
-                                            : iterationHelper.iterateUpper(*upperX, b, !noTerminationGuarantee);
+            auto iterateUpper = [&]() {
+                return dir ? iterationHelper.iterateUpper(dir.get(), *upperX, b, !noTerminationGuarantee)
+                           : iterationHelper.iterateUpper(*upperX, b, !noTerminationGuarantee);
+            };
+            auto iterateLower = [&]() {
+                return dir ? iterationHelper.singleIterationWithDiff(dir.get(), *lowerX, b, relative)
+                           : iterationHelper.singleIterationWithDiff(*lowerX, b, relative);
+            };
+            typename oviinternal::IterationHelper<ValueType>::IterateResult upperBoundIterResult;
+            boost::optional<ValueType> lowerBoundDiff;
+            if (concurrentVerification) {
+                // The sweeps access disjoint vectors. Further iterations keep the lower bound valid, so the result of the lower sweep is simply
+                // dropped if it turns out that it is not needed (because the guess is refuted).
+                storm::utility::parallel::forEachChunk(0, 2, 1, 2, [&](uint64_t, uint64_t task, uint64_t) {
+                    if (task == 0) {
+                        upperBoundIterResult = iterateUpper();
+                    } else {
+                        lowerBoundDiff = iterateLower();
+                    }
+                });
+                ++unreportedMultiplications;
+            } else {
+                upperBoundIterResult = iterateUpper();
+            }
+            if (telemetry.isEnabled()) {
+                telemetry.recordIteration(overallIterations, std::numeric_limits<double>::quiet_NaN(),
+                                          SolverTelemetryTracker::computeMaxDiff(*upperX, *lowerX, relative), 0, unreportedMultiplications + 1);
+                unreportedMultiplications = 0;
+            }
 
             if (upperBoundIterResult == oviinternal::IterationHelper<ValueType>::IterateResult::AlwaysHigherOrEqual) {
+                upperBoundVerified = false;
                 // All values moved up (and did not stay the same)
                 // That means the guess for an upper bound is actually a lower bound
                 auto diff = dir ? iterationHelper.singleIterationWithDiff(dir.get(), *upperX, b, relative)
                                 : iterationHelper.singleIterationWithDiff(*upperX, b, relative);
+                ++unreportedMultiplications;
                 iterationPrecision = oviinternal::updateIterationPrecision(env, diff);
                 // We assume to have a single fixed point. We can thus safely set the new lower bound, to the wrongly guessed upper bound
                 // Set lowerX to the upper bound candidate
@@ -360,6 +411,8 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
             } else if (upperBoundIterResult == oviinternal::IterationHelper<ValueType>::IterateResult::AlwaysLowerOrEqual) {
                 // All values moved down (and stayed not the same)
                 // This is a valid upper bound. We still need to check the precision.
+                // Further iterations on a valid upper bound keep it valid.
+                upperBoundVerified = true;
                 // We can safely use twice the requested precision, as we calculate the center of both vectors
                 bool reachedPrecision;
                 if (relevantValues) {
@@ -391,10 +444,13 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
                 // In this case we will make one more iteration on the lower bound (mainly to obtain a new iterationPrecision)
             }
 
-            // Lower bound iteration (only if needed)
-            if (cancelGuess || intervalIterationNeeded || currentVerificationIterations > upperBoundOnlyIterations) {
-                auto diff = dir ? iterationHelper.singleIterationWithDiff(dir.get(), *lowerX, b, relative)
-                                : iterationHelper.singleIterationWithDiff(*lowerX, b, relative);
+            // Lower bound iteration (only if needed and not already done concurrently)
+            if (lowerBoundDiff || cancelGuess || intervalIterationNeeded || currentVerificationIterations > upperBoundOnlyIterations) {
+                if (!lowerBoundDiff) {
+                    lowerBoundDiff = iterateLower();
+                    ++unreportedMultiplications;
+                }
+                ValueType const& diff = lowerBoundDiff.get();
 
                 // Check whether the upper and lower bounds have crossed, i.e., the upper bound is smaller than the lower bound.
                 bool valuesCrossed = false;
@@ -407,6 +463,7 @@ std::pair<SolverStatus, uint64_t> OptimisticValueIterationHelper<ValueType>::sol
 
                 if (cancelGuess || valuesCrossed) {
                     // A new guess is needed.
+                    upperBoundVerified = false;
                     iterationPrecision = oviinternal::updateIterationPrecision(env, diff);
                     break;
                 }
@@ -97,8 +97,16 @@ class OptimisticValueIterationHelper {
                                                      boost::optional<storage::BitVector> const& schedulerFixedForRowgroup = boost::none,
                                                      boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
 
+    /*!
+     * Retrieves whether the upper vector of the last call to solveEquations is known to be an upper bound on the actual values. This is always the
+     * case upon convergence, but a call that was aborted might return an upper vector that is merely a guess.
+     */
+    bool hasVerifiedUpperBound() const;
+
    private:
     oviinternal::IterationHelper<ValueType> iterationHelper;
+    uint64_t bytesPerMultiplication;
+    bool upperBoundVerified;
 };
 }  // namespace helper
 }  // namespace solver
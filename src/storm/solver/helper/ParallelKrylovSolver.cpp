@@ -0,0 +1,351 @@
+#include "storm/solver/helper/ParallelKrylovSolver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// The number of vector entries that are processed as one chunk. Dot products are summed up per chunk first, so their result only depends on this size.
+uint64_t const vectorChunkSize = 4096;
+}  // namespace
+
+template<typename ValueType>
+ParallelKrylovSolver<ValueType>::ParallelKrylovSolver(storm::storage::SparseMatrix<ValueType> const& matrix, KrylovPreconditioner preconditioner,
+                                                      uint64_t numberOfThreads)
+    : matrix(matrix), preconditioner(preconditioner), numberOfThreads(std::max<uint64_t>(1, numberOfThreads)) {
+    STORM_LOG_ASSERT(matrix.getRowCount() == matrix.getColumnCount(), "The matrix must be square.");
+    if (preconditioner == KrylovPreconditioner::Diagonal) {
+        inverseDiagonal.assign(matrix.getRowCount(), storm::utility::one<ValueType>());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                if (entry.getColumn() == row) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        inverseDiagonal[row] = storm::utility::one<ValueType>() / storm::utility::abs(entry.getValue());
+                    }
+                    break;
+                }
+            }
+        }
+    } else if (preconditioner == KrylovPreconditioner::BlockIlu) {
+        computeBlockIlu();
+    }
+}
+
+template<typename ValueType>
+void ParallelKrylovSolver<ValueType>::computeBlockIlu() {
+    uint64_t const numberOfRows = matrix.getRowCount();
+    uint64_t const numberOfBlocks = std::max<uint64_t>(1, std::min(numberOfThreads, numberOfRows));
+    blockStarts.resize(numberOfBlocks + 1);
+    for (uint64_t block = 0; block <= numberOfBlocks; ++block) {
+        blockStarts[block] = block * numberOfRows / numberOfBlocks;
+    }
+
+    // Copy the entries of the diagonal blocks, inserting a (zero) diagonal entry where there is none.
+    iluRowIndications.assign(1, 0);
+    iluRowIndications.reserve(numberOfRows + 1);
+    iluDiagonalPositions.resize(numberOfRows);
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        for (uint64_t row = blockStarts[block]; row < blockStarts[block + 1]; ++row) {
+            bool hasDiagonal = false;
+            for (auto const& entry : matrix.getRow(row)) {
+                uint64_t column = entry.getColumn();
+                if (column < blockStarts[block] || column >= blockStarts[block + 1]) {
+                    continue;
+                }
+                if (!hasDiagonal && column >= row) {
+                    iluDiagonalPositions[row] = iluColumns.size();
+                    hasDiagonal = true;
+                    if (column > row) {
+                        iluColumns.push_back(row);
+                        iluValues.push_back(storm::utility::zero<ValueType>());
+                    }
+                }
+                iluColumns.push_back(column);
+                iluValues.push_back(entry.getValue());
+            }
+            if (!hasDiagonal) {
+                iluDiagonalPositions[row] = iluColumns.size();
+                iluColumns.push_back(row);
+                iluValues.push_back(storm::utility::zero<ValueType>());
+            }
+            iluRowIndications.push_back(iluColumns.size());
+        }
+    }
+
+    // Factorize the blocks independently. Zero pivots are replaced by one, which keeps the preconditioner regular.
+    storm::utility::parallel::forEachChunk(0, numberOfBlocks, 1, numberOfThreads, [this](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+        for (uint64_t block = blockBegin; block < blockEnd; ++block) {
+            uint64_t const firstRow = blockStarts[block];
+            std::vector<uint64_t> positionOfColumn(blockStarts[block + 1] - firstRow, std::numeric_limits<uint64_t>::max());
+            for (uint64_t row = firstRow; row < blockStarts[block + 1]; ++row) {
+                for (uint64_t position = iluRowIndications[row]; position < iluRowIndications[row + 1]; ++position) {
+                    positionOfColumn[iluColumns[position] - firstRow] = position;
+                }
+                for (uint64_t position = iluRowIndications[row]; position < iluDiagonalPositions[row]; ++position) {
+                    uint64_t const pivotRow = iluColumns[position];
+                    iluValues[position] /= iluValues[iluDiagonalPositions[pivotRow]];
+                    for (uint64_t pivotPosition = iluDiagonalPositions[pivotRow] + 1; pivotPosition < iluRowIndications[pivotRow + 1]; ++pivotPosition) {
+                        uint64_t targetPosition = positionOfColumn[iluColumns[pivotPosition] - firstRow];
+                        if (targetPosition != std::numeric_limits<uint64_t>::max()) {
+                            iluValues[targetPosition] -= iluValues[position] * iluValues[pivotPosition];
+                        }
+                    }
+                }
+                if (storm::utility::isZero(iluValues[iluDiagonalPositions[row]])) {
+                    iluValues[iluDiagonalPositions[row]] = storm::utility::one<ValueType>();
+                }
+                for (uint64_t position = iluRowIndications[row]; position < iluRowIndications[row + 1]; ++position) {
+                    positionOfColumn[iluColumns[position] - firstRow] = std::numeric_limits<uint64_t>::max();
+                }
+            }
+        }
+    });
+}
+
+template<typename ValueType>
+void ParallelKrylovSolver<ValueType>::applyPreconditioner(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+    if (preconditioner == KrylovPreconditioner::None) {
+        result = vector;
+    } else if (preconditioner == KrylovPreconditioner::Diagonal) {
+        storm::utility::parallel::forEachChunk(0, vector.size(), vectorChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                result[index] = inverseDiagonal[index] * vector[index];
+            }
+        });
+    } else {
+        storm::utility::parallel::forEachChunk(0, blockStarts.size() - 1, 1, numberOfThreads, [&](uint64_t, uint64_t blockBegin, uint64_t blockEnd) {
+            for (uint64_t block = blockBegin; block < blockEnd; ++block) {
+                // Forward substitution with L (whose diagonal is one).
+                for (uint64_t row = blockStarts[block]; row < blockStarts[block + 1]; ++row) {
+                    ValueType value = vector[row];
+                    for (uint64_t position = iluRowIndications[row]; position < iluDiagonalPositions[row]; ++position) {
+                        value -= iluValues[position] * result[iluColumns[position]];
+                    }
+                    result[row] = value;
+                }
+                // Backward substitution with U.
+                for (uint64_t row = blockStarts[block + 1]; row > blockStarts[block];) {
+                    --row;
+                    ValueType value = result[row];
+                    for (uint64_t position = iluDiagonalPositions[row] + 1; position < iluRowIndications[row + 1]; ++position) {
+                        value -= iluValues[position] * result[iluColumns[position]];
+                    }
+                    result[row] = value / iluValues[iluDiagonalPositions[row]];
+                }
+            }
+        });
+    }
+}
+
+template<typename ValueType>
+void ParallelKrylovSolver<ValueType>::computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const {
+    matrix.multiplyWithVectorParallel(x, result);
+    linearCombination(result, -storm::utility::one<ValueType>(), {{storm::utility::one<ValueType>(), &b}});
+}
+
+template<typename ValueType>
+ValueType ParallelKrylovSolver<ValueType>::dot(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const {
+    std::vector<ValueType> chunkSums((first.size() + vectorChunkSize - 1) / vectorChunkSize, storm::utility::zero<ValueType>());
+    storm::utility::parallel::forEachChunk(0, first.size(), vectorChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+            sum += first[index] * second[index];
+        }
+        chunkSums[chunkBegin / vectorChunkSize] = sum;
+    });
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& sum : chunkSums) {
+        result += sum;
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType ParallelKrylovSolver<ValueType>::norm(std::vector<ValueType> const& vector) const {
+    return std::sqrt(dot(vector, vector));
+}
+
+template<typename ValueType>
+void ParallelKrylovSolver<ValueType>::linearCombination(std::vector<ValueType>& target, ValueType const& targetFactor,
+                                                        std::vector<std::pair<ValueType, std::vector<ValueType> const*>> const& summands) const {
+    storm::utility::parallel::forEachChunk(0, target.size(), vectorChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+            ValueType value = targetFactor * target[index];
+            for (auto const& summand : summands) {
+                value += summand.first * (*summand.second)[index];
+            }
+            target[index] = value;
+        }
+    });
+}
+
+template<typename ValueType>
+std::pair<bool, uint64_t> ParallelKrylovSolver<ValueType>::solveBicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                         ValueType const& precision, uint64_t maximalNumberOfIterations) const {
+    ValueType const zero = storm::utility::zero<ValueType>();
+    ValueType const one = storm::utility::one<ValueType>();
+    ValueType const normB = norm(b);
+    if (storm::utility::isZero(normB)) {
+        std::fill(x.begin(), x.end(), zero);
+        return {true, 0};
+    }
+    ValueType const tolerance = precision * normB;
+
+    std::vector<ValueType> r(x.size()), rTilde, p(x.size(), zero), v(x.size(), zero), pHat(x.size()), s(x.size()), sHat(x.size()), t(x.size());
+    computeResidual(x, b, r);
+    rTilde = r;
+    ValueType rho = one, alpha = one, omega = one;
+    uint64_t iterations = 0;
+    for (; iterations < maximalNumberOfIterations; ++iterations) {
+        if (norm(r) <= tolerance) {
+            return {true, iterations};
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+        ValueType previousRho = rho;
+        rho = dot(rTilde, r);
+        if (storm::utility::isZero(rho) || storm::utility::isZero(omega)) {
+            STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations.");
+            break;
+        }
+        if (iterations == 0) {
+            p = r;
+        } else {
+            ValueType beta = (rho / previousRho) * (alpha / omega);
+            linearCombination(p, beta, {{one, &r}, {-beta * omega, &v}});
+        }
+        applyPreconditioner(p, pHat);
+        matrix.multiplyWithVectorParallel(pHat, v);
+        alpha = rho / dot(rTilde, v);
+        s = r;
+        linearCombination(s, one, {{-alpha, &v}});
+        if (norm(s) <= tolerance) {
+            linearCombination(x, one, {{alpha, &pHat}});
+            return {true, iterations + 1};
+        }
+        applyPreconditioner(s, sHat);
+        matrix.multiplyWithVectorParallel(sHat, t);
+        ValueType tt = dot(t, t);
+        omega = storm::utility::isZero(tt) ? zero : dot(t, s) / tt;
+        linearCombination(x, one, {{alpha, &pHat}, {omega, &sHat}});
+        r = s;
+        linearCombination(r, one, {{-omega, &t}});
+    }
+    return {norm(r) <= tolerance, iterations};
+}
+
+template<typename ValueType>
+std::pair<bool, uint64_t> ParallelKrylovSolver<ValueType>::solveGmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                                                                      uint64_t maximalNumberOfIterations, uint64_t restartThreshold) const {
+    ValueType const zero = storm::utility::zero<ValueType>();
+    ValueType const one = storm::utility::one<ValueType>();
+    ValueType const normB = norm(b);
+    if (storm::utility::isZero(normB)) {
+        std::fill(x.begin(), x.end(), zero);
+        return {true, 0};
+    }
+    ValueType const tolerance = precision * normB;
+    uint64_t const restart = std::max<uint64_t>(1, std::min<uint64_t>(restartThreshold, x.size()));
+
+    // The orthonormal basis of the Krylov subspace, the columns of the Hessenberg matrix and the Givens rotations that make it upper triangular.
+    std::vector<std::vector<ValueType>> basis(restart + 1, std::vector<ValueType>(x.size()));
+    std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1, zero));
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), z(x.size()), w(x.size());
+    uint64_t iterations = 0;
+    while (true) {
+        computeResidual(x, b, basis[0]);
+        ValueType beta = norm(basis[0]);
+        if (beta <= tolerance) {
+            return {true, iterations};
+        }
+        if (iterations >= maximalNumberOfIterations || storm::utility::resources::isTerminate()) {
+            return {false, iterations};
+        }
+        linearCombination(basis[0], one / beta, {});
+        std::fill(g.begin(), g.end(), zero);
+        g[0] = beta;
+
+        uint64_t dimension = 0;
+        while (dimension < restart && iterations < maximalNumberOfIterations) {
+            auto& column = hessenberg[dimension];
+            applyPreconditioner(basis[dimension], z);
+            matrix.multiplyWithVectorParallel(z, w);
+            // Modified Gram-Schmidt orthogonalization.
+            for (uint64_t i = 0; i <= dimension; ++i) {
+                column[i] = dot(w, basis[i]);
+                linearCombination(w, one, {{-column[i], &basis[i]}});
+            }
+            column[dimension + 1] = norm(w);
+            bool const breakdown = storm::utility::isZero(column[dimension + 1]);
+            if (!breakdown) {
+                basis[dimension + 1] = w;
+                linearCombination(basis[dimension + 1], one / column[dimension + 1], {});
+            }
+
+            // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+            for (uint64_t i = 0; i < dimension; ++i) {
+                ValueType tmp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                column[i + 1] = -sines[i] * column[i] + cosines[i] * column[i + 1];
+                column[i] = tmp;
+            }
+            ValueType radius = std::hypot(column[dimension], column[dimension + 1]);
+            cosines[dimension] = storm::utility::isZero(radius) ? one : column[dimension] / radius;
+            sines[dimension] = storm::utility::isZero(radius) ? zero : column[dimension + 1] / radius;
+            column[dimension] = radius;
+            column[dimension + 1] = zero;
+            g[dimension + 1] = -sines[dimension] * g[dimension];
+            g[dimension] = cosines[dimension] * g[dimension];
+
+            ++dimension;
+            ++iterations;
+            if (breakdown || std::abs(g[dimension]) <= tolerance) {
+                break;
+            }
+        }
+
+        // Solve the triangular system and update x with the preconditioned linear combination of the basis vectors.
+        std::vector<ValueType> y(dimension, zero);
+        for (uint64_t i = dimension; i > 0;) {
+            --i;
+            ValueType value = g[i];
+            for (uint64_t j = i + 1; j < dimension; ++j) {
+                value -= hessenberg[j][i] * y[j];
+            }
+            y[i] = storm::utility::isZero(hessenberg[i][i]) ? zero : value / hessenberg[i][i];
+        }
+        std::fill(w.begin(), w.end(), zero);
+        std::vector<std::pair<ValueType, std::vector<ValueType> const*>> summands;
+        for (uint64_t i = 0; i < dimension; ++i) {
+            summands.emplace_back(y[i], &basis[i]);
+        }
+        linearCombination(w, zero, summands);
+        applyPreconditioner(w, z);
+        linearCombination(x, one, {{one, &z}});
+    }
+}
+
+template<typename ValueType>
+KrylovPreconditioner ParallelKrylovSolver<ValueType>::getPreconditioner() const {
+    return preconditioner;
+}
+
+template<typename ValueType>
+uint64_t ParallelKrylovSolver<ValueType>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+template class ParallelKrylovSolver<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
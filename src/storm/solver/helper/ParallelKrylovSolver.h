@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * The preconditioners offered by ParallelKrylovSolver.
+ */
+enum class KrylovPreconditioner {
+    None,
+    // Scales by the inverse of the absolute value of the diagonal entry (or by one if it is zero), as gmm::diagonal_precond does.
+    Diagonal,
+    // An ILU(0) factorization of the diagonal blocks of the matrix, where the rows are split into one contiguous block per thread.
+    BlockIlu
+};
+
+/*!
+ * Solves the equation system A*x = b with preconditioned Krylov subspace methods directly on a SparseMatrix, i.e., without converting it to the
+ * format of a linear algebra library. The matrix-vector products use SparseMatrix::multiplyWithVectorParallel and the vector operations (including
+ * the dot products) are distributed over the given number of threads. Dot products are summed up in chunks of a fixed size, so the result does
+ * not depend on the number of threads.
+ *
+ * As in gmm++, a solution is considered converged once the residual norm ||b - A*x|| is at most the precision times ||b||.
+ */
+template<typename ValueType>
+class ParallelKrylovSolver {
+   public:
+    /*!
+     * Prepares the solver (and the preconditioner) for the given matrix, which needs to be kept alive as long as the solver is used.
+     *
+     * @param matrix The (square) matrix A of the equation system.
+     * @param preconditioner The preconditioner to use.
+     * @param numberOfThreads The number of threads to use. This also determines the blocks of the BlockIlu preconditioner.
+     */
+    ParallelKrylovSolver(storm::storage::SparseMatrix<ValueType> const& matrix, KrylovPreconditioner preconditioner, uint64_t numberOfThreads);
+
+    /*!
+     * Solves the equation system with right-preconditioned BiCGSTAB.
+     *
+     * @param x The initial guess, which contains the solution upon termination.
+     * @param b The right-hand side.
+     * @param precision The relative precision of the residual.
+     * @param maximalNumberOfIterations The maximal number of iterations.
+     * @return Whether the method converged as well as the number of performed iterations.
+     */
+    std::pair<bool, uint64_t> solveBicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                                            uint64_t maximalNumberOfIterations) const;
+
+    /*!
+     * Solves the equation system with right-preconditioned GMRES that restarts after the given number of iterations.
+     *
+     * @param x The initial guess, which contains the solution upon termination.
+     * @param b The right-hand side.
+     * @param precision The relative precision of the residual.
+     * @param maximalNumberOfIterations The maximal number of iterations.
+     * @param restartThreshold The number of iterations after which GMRES restarts, which is the number of basis vectors that are kept in memory.
+     * @return Whether the method converged as well as the number of performed iterations.
+     */
+    std::pair<bool, uint64_t> solveGmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                                         uint64_t maximalNumberOfIterations, uint64_t restartThreshold) const;
+
+    KrylovPreconditioner getPreconditioner() const;
+    uint64_t getNumberOfThreads() const;
+
+   private:
+    /*!
+     * Computes the block ILU(0) factorization.
+     */
+    void computeBlockIlu();
+
+    /*!
+     * Solves M*result = vector for the preconditioner M.
+     */
+    void applyPreconditioner(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+    /*!
+     * Computes result = b - A*x.
+     */
+    void computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& result) const;
+
+    // Parallel vector operations.
+    ValueType dot(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const;
+    ValueType norm(std::vector<ValueType> const& vector) const;
+    // Computes target = target * targetFactor + sum_i factor_i * vector_i.
+    void linearCombination(std::vector<ValueType>& target, ValueType const& targetFactor,
+                           std::vector<std::pair<ValueType, std::vector<ValueType> const*>> const& summands) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    KrylovPreconditioner preconditioner;
+    uint64_t numberOfThreads;
+
+    // For the diagonal preconditioner, the inverted (absolute) diagonal entries.
+    std::vector<ValueType> inverseDiagonal;
+
+    // For the block ILU preconditioner, the first row of each block (and the number of rows at the end) as well as the factors L and U in CSR format,
+    // where the unit diagonal of L is omitted and the position of the diagonal entry of U is stored for each row.
+    std::vector<uint64_t> blockStarts;
+    std::vector<uint64_t> iluRowIndications;
+    std::vector<uint64_t> iluColumns;
+    std::vector<ValueType> iluValues;
+    std::vector<uint64_t> iluDiagonalPositions;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
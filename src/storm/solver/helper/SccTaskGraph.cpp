@@ -0,0 +1,98 @@
+#include "storm/solver/helper/SccTaskGraph.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+SccTaskGraph<ValueType>::SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                      storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccs, uint64_t batchSize) {
+    // Merge consecutive SCCs into tasks.
+    std::vector<uint64_t> stateToTask(matrix.getRowGroupCount());
+    uint64_t statesInCurrentTask = 0;
+    for (uint64_t sccIndex = 0; sccIndex < sortedSccs.size(); ++sccIndex) {
+        auto const& scc = sortedSccs.getBlock(sccIndex);
+        if (taskStarts.empty() || statesInCurrentTask + scc.size() > batchSize) {
+            taskStarts.push_back(sccIndex);
+            statesInCurrentTask = 0;
+        }
+        statesInCurrentTask += scc.size();
+        for (auto const& state : scc) {
+            stateToTask[state] = taskStarts.size() - 1;
+        }
+    }
+    uint64_t const numberOfTasks = taskStarts.size();
+    taskStarts.push_back(sortedSccs.size());
+
+    // Collect the tasks that the states of a task have transitions into.
+    dependencies.resize(numberOfTasks);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        std::vector<uint64_t>& taskDependencies = dependencies[task];
+        for (uint64_t sccIndex = taskStarts[task]; sccIndex < taskStarts[task + 1]; ++sccIndex) {
+            for (auto const& state : sortedSccs.getBlock(sccIndex)) {
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        uint64_t successorTask = stateToTask[entry.getColumn()];
+                        if (successorTask != task) {
+                            STORM_LOG_ASSERT(successorTask < task, "The SCC decomposition is not sorted topologically.");
+                            taskDependencies.push_back(successorTask);
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(taskDependencies.begin(), taskDependencies.end());
+        taskDependencies.erase(std::unique(taskDependencies.begin(), taskDependencies.end()), taskDependencies.end());
+    }
+}
+
+template<typename ValueType>
+uint64_t SccTaskGraph<ValueType>::getNumberOfTasks() const {
+    return dependencies.size();
+}
+
+template<typename ValueType>
+uint64_t SccTaskGraph<ValueType>::getFirstScc(uint64_t task) const {
+    return taskStarts[task];
+}
+
+template<typename ValueType>
+uint64_t SccTaskGraph<ValueType>::getEndScc(uint64_t task) const {
+    return taskStarts[task + 1];
+}
+
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> const& SccTaskGraph<ValueType>::getDependencies() const {
+    return dependencies;
+}
+
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> SccTaskGraph<ValueType>::getReversedDependencies() const {
+    std::vector<std::vector<uint64_t>> result(dependencies.size());
+    // Iterating over the tasks in ascending order keeps the resulting lists sorted.
+    for (uint64_t task = 0; task < dependencies.size(); ++task) {
+        for (auto const& dependency : dependencies[task]) {
+            result[dependency].push_back(task);
+        }
+    }
+    return result;
+}
+
+template class SccTaskGraph<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SccTaskGraph<storm::RationalNumber>;
+template class SccTaskGraph<storm::RationalFunction>;
+#endif
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
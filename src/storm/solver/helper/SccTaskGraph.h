@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Groups the SCCs of a topologically sorted SCC decomposition into tasks that can be solved concurrently.
+ * A task consists of a range of consecutive SCCs (to be solved in the given order). Consecutive SCCs are merged
+ * into one task as long as the task contains at most the given number of states, which keeps the scheduling
+ * overhead low for many small SCCs. SCCs that are larger than this batch size form a task of their own.
+ * A task depends on another task if one of its states has a transition into one of the states of the other task.
+ */
+template<typename ValueType>
+class SccTaskGraph {
+   public:
+    /*!
+     * Creates the tasks for the given matrix and its SCC decomposition, which needs to be sorted topologically,
+     * i.e., an SCC may only have transitions into SCCs with smaller index.
+     */
+    SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sortedSccs,
+                 uint64_t batchSize);
+
+    uint64_t getNumberOfTasks() const;
+
+    /*!
+     * Retrieves the index of the first SCC of the given task.
+     */
+    uint64_t getFirstScc(uint64_t task) const;
+
+    /*!
+     * Retrieves the index past the last SCC of the given task.
+     */
+    uint64_t getEndScc(uint64_t task) const;
+
+    /*!
+     * Retrieves for each task the tasks that need to be finished before the task can be started.
+     */
+    std::vector<std::vector<uint64_t>> const& getDependencies() const;
+
+    /*!
+     * Retrieves for each task the tasks that depend on it. These are the dependencies if the tasks (and the SCCs
+     * within a task) are processed in reverse order, e.g., when values are propagated forward along the transitions.
+     */
+    std::vector<std::vector<uint64_t>> getReversedDependencies() const;
+
+   private:
+    // The first SCC of each task followed by the total number of SCCs.
+    std::vector<uint64_t> taskStarts;
+    std::vector<std::vector<uint64_t>> dependencies;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
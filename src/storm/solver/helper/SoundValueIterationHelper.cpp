@@ -1,9 +1,12 @@
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 
+#include <limits>
+
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -27,7 +30,10 @@ SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(storm::storage::
       maxIndex(0),
       relative(relative),
       precision(precision),
-      rowGroupIndices(nullptr) {
+      rowGroupIndices(nullptr),
+      numberOfThreads(1),
+      blockSize(1),
+      hasStepBounds(false) {
     STORM_LOG_THROW(matrix.getEntryCount() < std::numeric_limits<IndexType>::max(), storm::exceptions::NotSupportedException,
                     "The number of matrix entries is too large for the selected index type.");
     if (!matrix.hasTrivialRowGrouping()) {
@@ -77,7 +83,13 @@ SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(SoundValueIterat
       matrixValues(std::move(oldHelper.matrixValues)),
       matrixColumns(std::move(oldHelper.matrixColumns)),
       rowIndications(std::move(oldHelper.rowIndications)),
-      rowGroupIndices(oldHelper.rowGroupIndices) {
+      rowGroupIndices(oldHelper.rowGroupIndices),
+      numberOfThreads(oldHelper.numberOfThreads),
+      blockSize(oldHelper.blockSize),
+      previousX(std::move(oldHelper.previousX)),
+      previousY(std::move(oldHelper.previousY)),
+      threadData(std::move(oldHelper.threadData)),
+      hasStepBounds(false) {
     // If x0 is the obtained result, we want x0-eps <= x <= x0+eps for the actual solution x. Hence, the difference between the lower and upper bounds can be
     // 2*eps.
     this->precision *= storm::utility::convertNumber<ValueType>(2.0);
@@ -99,6 +111,21 @@ void SoundValueIterationHelper<ValueType>::setUpperBound(ValueType const& value)
     upperBound = value;
 }
 
+template<typename ValueType>
+void SoundValueIterationHelper<ValueType>::setNumberOfThreads(uint64_t numberOfThreads, uint64_t blockSize) {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Expected at least one thread.");
+    this->numberOfThreads = numberOfThreads;
+    this->blockSize = std::max<uint64_t>(1, blockSize);
+}
+
+template<typename ValueType>
+double SoundValueIterationHelper<ValueType>::getBoundsGap() const {
+    if (hasLowerBound && hasUpperBound) {
+        return storm::utility::convertNumber<double>(ValueType(upperBound - lowerBound));
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
 template<typename ValueType>
 void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi) {
     assert(rowIndex < numRows);
@@ -116,12 +143,37 @@ void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex
     yi = std::move(yRes);
 }
 
+template<typename ValueType>
+void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi, uint64_t blockBegin,
+                                                       uint64_t blockEnd) const {
+    assert(rowIndex < numRows);
+    ValueType xRes = bi;
+    ValueType yRes = storm::utility::zero<ValueType>();
+
+    auto entryIt = matrixValues.begin() + rowIndications[rowIndex];
+    auto entryItE = matrixValues.begin() + rowIndications[rowIndex + 1];
+    auto colIt = matrixColumns.begin() + rowIndications[rowIndex];
+    for (; entryIt != entryItE; ++entryIt, ++colIt) {
+        // Values of x and y are always taken from the same step, which is required for the obtained bounds to be sound.
+        if (*colIt >= blockBegin && *colIt < blockEnd) {
+            xRes += *entryIt * x[*colIt];
+            yRes += *entryIt * y[*colIt];
+        } else {
+            xRes += *entryIt * previousX[*colIt];
+            yRes += *entryIt * previousY[*colIt];
+        }
+    }
+    xi = std::move(xRes);
+    yi = std::move(yRes);
+}
+
 template<typename ValueType>
 void SoundValueIterationHelper<ValueType>::performIterationStep(OptimizationDirection const& dir, std::vector<ValueType> const& b,
                                                                 boost::optional<storage::BitVector> const& schedulerFixedForRowgroup,
                                                                 boost::optional<std::vector<uint_fast64_t>> const& scheduler) {
     STORM_LOG_ASSERT((!schedulerFixedForRowgroup && !scheduler) || (schedulerFixedForRowgroup && scheduler),
                      "Expecting scheduler and schedulerFixedForRowgroup to be both set or unset");
+    hasStepBounds = false;
     if (rowGroupIndices) {
         if (minimize(dir)) {
             performIterationStep<InternalOptimizationDirection::Minimize>(b, schedulerFixedForRowgroup, scheduler);
@@ -135,6 +187,11 @@ void SoundValueIterationHelper<ValueType>::performIterationStep(OptimizationDire
 
 template<typename ValueType>
 void SoundValueIterationHelper<ValueType>::performIterationStep(std::vector<ValueType> const& b) {
+    hasStepBounds = false;
+    if (numberOfThreads > 1) {
+        performIterationStepParallel<InternalOptimizationDirection::None>(b, boost::none, boost::none);
+        return;
+    }
     auto xIt = x.rbegin();
     auto yIt = y.rbegin();
     IndexType row = numRows;
@@ -153,153 +210,200 @@ void SoundValueIterationHelper<ValueType>::performIterationStep(std::vector<Valu
                                                                 boost::optional<std::vector<uint_fast64_t>> const& scheduler) {
     STORM_LOG_ASSERT((!schedulerFixedForRowgroup && !scheduler) || (schedulerFixedForRowgroup && scheduler),
                      "Expecting scheduler and schedulerFixedForRowgroup to be both set or unset");
+    assert(!decisionValueBlocks || decisionValue == getPrimaryBound<dir>());
 
-    if (!decisionValueBlocks) {
-        performIterationStepUpdateDecisionValue<dir>(b, schedulerFixedForRowgroup, scheduler);
-    } else {
-        assert(decisionValue == getPrimaryBound<dir>());
-        auto xIt = x.rbegin();
-        auto yIt = y.rbegin();
-        auto groupStartIt = rowGroupIndices->rbegin();
-        uint64_t groupEnd = *groupStartIt;
-        ++groupStartIt;
-        auto rowGroupIndex = rowGroupIndices->size();
-
-        for (auto groupStartIte = rowGroupIndices->rend(); groupStartIt != groupStartIte; groupEnd = *(groupStartIt++), ++xIt, ++yIt) {
-            rowGroupIndex--;
-
-            if (schedulerFixedForRowgroup && schedulerFixedForRowgroup.get()[rowGroupIndex]) {
-                // The scheduler is fixed for this rowgroup so we perform iteration only on this row.
-                IndexType row = *groupStartIt + scheduler.get()[rowGroupIndex];
-                multiplyRow(row, b[row], *xIt, *yIt);
+    if (numberOfThreads > 1) {
+        performIterationStepParallel<dir>(b, schedulerFixedForRowgroup, scheduler);
+        return;
+    }
+    auto multiplyRowFunction = [this](IndexType const& row, ValueType const& bi, ValueType& xi, ValueType& yi) { multiplyRow(row, bi, xi, yi); };
+    for (uint64_t rowGroupIndex = x.size(); rowGroupIndex > 0;) {
+        --rowGroupIndex;
+        processRowGroup<dir>(rowGroupIndex, b, schedulerFixedForRowgroup, scheduler, multiplyRowFunction, x[rowGroupIndex], y[rowGroupIndex], xTmp, yTmp,
+                             decisionValue, hasDecisionValue);
+    }
+}
+
+template<typename ValueType>
+template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+void SoundValueIterationHelper<ValueType>::performIterationStepParallel(std::vector<ValueType> const& b,
+                                                                        boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup,
+                                                                        boost::optional<std::vector<uint_fast64_t>> const& scheduler) {
+    previousX = x;
+    previousY = y;
+    uint64_t const numberOfStates = x.size();
+    uint64_t const numberOfBlocks = (numberOfStates + blockSize - 1) / blockSize;
+    // The bounds x_i / (1 - y_i) are only considered once every y value is below one.
+    bool const computeStepBounds = !convergencePhase1;
+    threadData.resize(numberOfThreads);
+    for (auto& data : threadData) {
+        data.xTmp.resize(xTmp.size());
+        data.yTmp.resize(yTmp.size());
+        data.hasDecisionValue = false;
+        data.hasBounds = false;
+    }
+
+    // Every block only writes the values of its own states and only reads these values from x and y, so the blocks can be processed concurrently.
+    storm::utility::parallel::forEachChunk(0, numberOfBlocks, 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t block, uint64_t) {
+        ThreadData& data = threadData[threadIndex];
+        uint64_t const blockBegin = block * blockSize;
+        uint64_t const blockEnd = std::min(blockBegin + blockSize, numberOfStates);
+        auto multiplyRowFunction = [this, blockBegin, blockEnd](IndexType const& row, ValueType const& bi, ValueType& xi, ValueType& yi) {
+            multiplyRow(row, bi, xi, yi, blockBegin, blockEnd);
+        };
+        for (uint64_t state = blockEnd; state > blockBegin;) {
+            --state;
+            if (dir == InternalOptimizationDirection::None) {
+                multiplyRowFunction(state, b[state], x[state], y[state]);
             } else {
-                // Perform the iteration for the first row in the group
-                IndexType row = *groupStartIt;
-                ValueType xBest, yBest;
-                multiplyRow(row, b[row], xBest, yBest);
-                ++row;
-                // Only do more work if there are still rows in this row group
-                if (row != groupEnd) {
-                    ValueType xi, yi;
-                    ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
-                    for (; row < groupEnd; ++row) {
-                        // Get the multiplication results
-                        multiplyRow(row, b[row], xi, yi);
-                        ValueType currentValue = xi + yi * getPrimaryBound<dir>();
-                        // Check if the current row is better then the previously found one
-                        if (better<dir>(currentValue, bestValue)) {
-                            xBest = std::move(xi);
-                            yBest = std::move(yi);
-                            bestValue = std::move(currentValue);
-                        } else if (currentValue == bestValue && yBest > yi) {
-                            // If the value for this row is not strictly better, it might still be equal and have a better y value
-                            xBest = std::move(xi);
-                            yBest = std::move(yi);
-                        }
-                    }
+                processRowGroup<dir>(state, b, schedulerFixedForRowgroup, scheduler, multiplyRowFunction, x[state], y[state], data.xTmp, data.yTmp,
+                                     data.decisionValue, data.hasDecisionValue);
+            }
+            if (computeStepBounds) {
+                ValueType currentBound = x[state] / (storm::utility::one<ValueType>() - y[state]);
+                if (!data.hasBounds) {
+                    data.minBound = currentBound;
+                    data.maxBound = std::move(currentBound);
+                    data.minIndex = state;
+                    data.maxIndex = state;
+                    data.hasBounds = true;
+                } else if (currentBound < data.minBound) {
+                    data.minBound = std::move(currentBound);
+                    data.minIndex = state;
+                } else if (currentBound > data.maxBound) {
+                    data.maxBound = std::move(currentBound);
+                    data.maxIndex = state;
                 }
-                *xIt = std::move(xBest);
-                *yIt = std::move(yBest);
             }
         }
+    });
+
+    // Combine the results of the threads.
+    for (auto& data : threadData) {
+        if (data.hasDecisionValue && (!hasDecisionValue || better<dir>(data.decisionValue, decisionValue))) {
+            decisionValue = std::move(data.decisionValue);
+            hasDecisionValue = true;
+        }
+        if (data.hasBounds) {
+            if (!hasStepBounds || data.minBound < stepMinBound) {
+                stepMinBound = std::move(data.minBound);
+                stepMinIndex = data.minIndex;
+            }
+            if (!hasStepBounds || data.maxBound > stepMaxBound) {
+                stepMaxBound = std::move(data.maxBound);
+                stepMaxIndex = data.maxIndex;
+            }
+            hasStepBounds = true;
+        }
     }
 }
 
 template<typename ValueType>
-template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
-void SoundValueIterationHelper<ValueType>::performIterationStepUpdateDecisionValue(std::vector<ValueType> const& b,
-                                                                                   boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup,
-                                                                                   boost::optional<std::vector<uint_fast64_t>> const& scheduler) {
-    STORM_LOG_ASSERT((!schedulerFixedForRowgroup && !scheduler) || (schedulerFixedForRowgroup && scheduler),
-                     "Expecting scheduler and schedulerFixedForRowgroup to be both set or unset");
-    auto xIt = x.rbegin();
-    auto yIt = y.rbegin();
-    auto groupStartIt = rowGroupIndices->rbegin();
-
-    uint64_t groupEnd = *groupStartIt;
-    ++groupStartIt;
-    auto rowGroupIndex = x.size() - 1;
-
-    for (auto groupStartIte = rowGroupIndices->rend(); groupStartIt != groupStartIte; groupEnd = *(groupStartIt++), ++xIt, ++yIt, --rowGroupIndex) {
-        if (schedulerFixedForRowgroup && schedulerFixedForRowgroup.get()[rowGroupIndex]) {
-            // The scheduler is fixed for this rowgroup so we perform iteration only on this entry.
-            IndexType row = *groupStartIt + scheduler.get()[rowGroupIndex];
-            ValueType xBest, yBest;
-            multiplyRow(row, b[row], *xIt, *yIt);
+template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir, typename MultiplyRowFunction>
+void SoundValueIterationHelper<ValueType>::processRowGroup(uint64_t rowGroupIndex, std::vector<ValueType> const& b,
+                                                           boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup,
+                                                           boost::optional<std::vector<uint_fast64_t>> const& scheduler,
+                                                           MultiplyRowFunction const& multiplyRowFunction, ValueType& xi, ValueType& yi,
+                                                           std::vector<ValueType>& xBuffer, std::vector<ValueType>& yBuffer, ValueType& localDecisionValue,
+                                                           bool& hasLocalDecisionValue) {
+    uint64_t const groupStart = (*rowGroupIndices)[rowGroupIndex];
+    uint64_t const groupEnd = (*rowGroupIndices)[rowGroupIndex + 1];
+    if (schedulerFixedForRowgroup && schedulerFixedForRowgroup.get()[rowGroupIndex]) {
+        // The scheduler is fixed for this rowgroup so we perform iteration only on this row.
+        IndexType row = groupStart + scheduler.get()[rowGroupIndex];
+        multiplyRowFunction(row, b[row], xi, yi);
+        return;
+    }
+
+    // Perform the iteration for the first row in the group
+    IndexType row = groupStart;
+    ValueType xBest, yBest;
+    multiplyRowFunction(row, b[row], xBest, yBest);
+    ++row;
+    // Only do more work if there are still rows in this row group
+    if (row != groupEnd) {
+        ValueType xRow, yRow;
+        if (decisionValueBlocks) {
+            ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
+            for (; row < groupEnd; ++row) {
+                // Get the multiplication results
+                multiplyRowFunction(row, b[row], xRow, yRow);
+                ValueType currentValue = xRow + yRow * getPrimaryBound<dir>();
+                // Check if the current row is better then the previously found one
+                if (better<dir>(currentValue, bestValue)) {
+                    xBest = std::move(xRow);
+                    yBest = std::move(yRow);
+                    bestValue = std::move(currentValue);
+                } else if (currentValue == bestValue && yBest > yRow) {
+                    // If the value for this row is not strictly better, it might still be equal and have a better y value
+                    xBest = std::move(xRow);
+                    yBest = std::move(yRow);
+                }
+            }
         } else {
-            // Perform the iteration for the first row in the group
-            uint64_t row = *groupStartIt;
-            ValueType xBest, yBest;
-            multiplyRow(row, b[row], xBest, yBest);
-            ++row;
-            // Only do more work if there are still rows in this row group
-            if (row != groupEnd) {
-                ValueType xi, yi;
-                uint64_t xyTmpIndex = 0;
-                if (hasPrimaryBound<dir>()) {
-                    ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
-                    for (; row < groupEnd; ++row) {
-                        // Get the multiplication results
-                        multiplyRow(row, b[row], xi, yi);
-                        ValueType currentValue = xi + yi * getPrimaryBound<dir>();
-                        // Check if the current row is better then the previously found one
-                        if (better<dir>(currentValue, bestValue)) {
-                            if (yBest < yi) {
-                                // We need to store the 'old' best value as it might be relevant for the decision value
-                                xTmp[xyTmpIndex] = std::move(xBest);
-                                yTmp[xyTmpIndex] = std::move(yBest);
-                                ++xyTmpIndex;
-                            }
-                            xBest = std::move(xi);
-                            yBest = std::move(yi);
-                            bestValue = std::move(currentValue);
-                        } else if (yBest > yi) {
-                            // If the value for this row is not strictly better, it might still be equal and have a better y value
-                            if (currentValue == bestValue) {
-                                xBest = std::move(xi);
-                                yBest = std::move(yi);
-                            } else {
-                                xTmp[xyTmpIndex] = std::move(xi);
-                                yTmp[xyTmpIndex] = std::move(yi);
-                                ++xyTmpIndex;
-                            }
-                        }
-                    }
-                } else {
-                    for (; row < groupEnd; ++row) {
-                        multiplyRow(row, b[row], xi, yi);
-                        // Update the best choice
-                        if (yi > yBest || (yi == yBest && better<dir>(xi, xBest))) {
-                            xTmp[xyTmpIndex] = std::move(xBest);
-                            yTmp[xyTmpIndex] = std::move(yBest);
+            uint64_t xyTmpIndex = 0;
+            if (hasPrimaryBound<dir>()) {
+                ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
+                for (; row < groupEnd; ++row) {
+                    // Get the multiplication results
+                    multiplyRowFunction(row, b[row], xRow, yRow);
+                    ValueType currentValue = xRow + yRow * getPrimaryBound<dir>();
+                    // Check if the current row is better then the previously found one
+                    if (better<dir>(currentValue, bestValue)) {
+                        if (yBest < yRow) {
+                            // We need to store the 'old' best value as it might be relevant for the decision value
+                            xBuffer[xyTmpIndex] = std::move(xBest);
+                            yBuffer[xyTmpIndex] = std::move(yBest);
                             ++xyTmpIndex;
-                            xBest = std::move(xi);
-                            yBest = std::move(yi);
+                        }
+                        xBest = std::move(xRow);
+                        yBest = std::move(yRow);
+                        bestValue = std::move(currentValue);
+                    } else if (yBest > yRow) {
+                        // If the value for this row is not strictly better, it might still be equal and have a better y value
+                        if (currentValue == bestValue) {
+                            xBest = std::move(xRow);
+                            yBest = std::move(yRow);
                         } else {
-                            xTmp[xyTmpIndex] = std::move(xi);
-                            yTmp[xyTmpIndex] = std::move(yi);
+                            xBuffer[xyTmpIndex] = std::move(xRow);
+                            yBuffer[xyTmpIndex] = std::move(yRow);
                             ++xyTmpIndex;
                         }
                     }
                 }
+            } else {
+                for (; row < groupEnd; ++row) {
+                    multiplyRowFunction(row, b[row], xRow, yRow);
+                    // Update the best choice
+                    if (yRow > yBest || (yRow == yBest && better<dir>(xRow, xBest))) {
+                        xBuffer[xyTmpIndex] = std::move(xBest);
+                        yBuffer[xyTmpIndex] = std::move(yBest);
+                        ++xyTmpIndex;
+                        xBest = std::move(xRow);
+                        yBest = std::move(yRow);
+                    } else {
+                        xBuffer[xyTmpIndex] = std::move(xRow);
+                        yBuffer[xyTmpIndex] = std::move(yRow);
+                        ++xyTmpIndex;
+                    }
+                }
+            }
 
-                // Update the decision value
-                for (uint64_t i = 0; i < xyTmpIndex; ++i) {
-                    ValueType deltaY = yBest - yTmp[i];
-                    if (deltaY > storm::utility::zero<ValueType>()) {
-                        ValueType newDecisionValue = (xTmp[i] - xBest) / deltaY;
-                        if (!hasDecisionValue || better<dir>(newDecisionValue, decisionValue)) {
-                            decisionValue = std::move(newDecisionValue);
-                            STORM_LOG_TRACE("Update decision value to " << decisionValue);
-                            hasDecisionValue = true;
-                        }
+            // Update the decision value
+            for (uint64_t i = 0; i < xyTmpIndex; ++i) {
+                ValueType deltaY = yBest - yBuffer[i];
+                if (deltaY > storm::utility::zero<ValueType>()) {
+                    ValueType newDecisionValue = (xBuffer[i] - xBest) / deltaY;
+                    if (!hasLocalDecisionValue || better<dir>(newDecisionValue, localDecisionValue)) {
+                        localDecisionValue = std::move(newDecisionValue);
+                        hasLocalDecisionValue = true;
                     }
                 }
             }
-            *xIt = std::move(xBest);
-            *yIt = std::move(yBest);
         }
     }
+    xi = std::move(xBest);
+    yi = std::move(yBest);
 }
 
 template<typename ValueType>
@@ -443,23 +547,43 @@ bool SoundValueIterationHelper<ValueType>::preliminaryConvergenceCheck(ValueType
 template<typename ValueType>
 template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
 void SoundValueIterationHelper<ValueType>::updateLowerUpperBound(ValueType& lowerBoundCandidate, ValueType& upperBoundCandidate) {
-    auto xIt = x.begin();
-    auto xIte = x.end();
-    auto yIt = y.begin();
-    for (uint64_t index = 0; xIt != xIte; ++xIt, ++yIt, ++index) {
-        ValueType currentBound = *xIt / (storm::utility::one<ValueType>() - *yIt);
+    if (hasStepBounds) {
+        // The extreme values were already determined during the iteration step.
         if (dir != InternalOptimizationDirection::None && decisionValueBlocks) {
-            if (better<dir>(getSecondaryBound<dir>(), currentBound)) {
-                getSecondaryIndex<dir>() = index;
-                getSecondaryBound<dir>() = std::move(currentBound);
+            ValueType const& stepBound = (dir == InternalOptimizationDirection::Maximize) ? stepMinBound : stepMaxBound;
+            if (better<dir>(getSecondaryBound<dir>(), stepBound)) {
+                getSecondaryIndex<dir>() = (dir == InternalOptimizationDirection::Maximize) ? stepMinIndex : stepMaxIndex;
+                getSecondaryBound<dir>() = stepBound;
             }
         } else {
-            if (currentBound < lowerBoundCandidate) {
-                minIndex = index;
-                lowerBoundCandidate = std::move(currentBound);
-            } else if (currentBound > upperBoundCandidate) {
-                maxIndex = index;
-                upperBoundCandidate = std::move(currentBound);
+            if (stepMinBound < lowerBoundCandidate) {
+                minIndex = stepMinIndex;
+                lowerBoundCandidate = stepMinBound;
+            }
+            if (stepMaxBound > upperBoundCandidate) {
+                maxIndex = stepMaxIndex;
+                upperBoundCandidate = stepMaxBound;
+            }
+        }
+    } else {
+        auto xIt = x.begin();
+        auto xIte = x.end();
+        auto yIt = y.begin();
+        for (uint64_t index = 0; xIt != xIte; ++xIt, ++yIt, ++index) {
+            ValueType currentBound = *xIt / (storm::utility::one<ValueType>() - *yIt);
+            if (dir != InternalOptimizationDirection::None && decisionValueBlocks) {
+                if (better<dir>(getSecondaryBound<dir>(), currentBound)) {
+                    getSecondaryIndex<dir>() = index;
+                    getSecondaryBound<dir>() = std::move(currentBound);
+                }
+            } else {
+                if (currentBound < lowerBoundCandidate) {
+                    minIndex = index;
+                    lowerBoundCandidate = std::move(currentBound);
+                } else if (currentBound > upperBoundCandidate) {
+                    maxIndex = index;
+                    upperBoundCandidate = std::move(currentBound);
+                }
             }
         }
     }
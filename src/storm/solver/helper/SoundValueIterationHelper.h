@@ -41,8 +41,21 @@ class SoundValueIterationHelper {
     void setLowerBound(ValueType const& value);
     void setUpperBound(ValueType const& value);
 
+    /*!
+     * Retrieves the difference between the currently known upper and lower bound, which bounds the difference of the
+     * lower and upper approximation of every value. If one of the bounds is not known yet, NaN is returned.
+     */
+    double getBoundsGap() const;
+
     void setSolutionVector();
 
+    /*!
+     * Sets the number of threads used for the iteration steps. If this is not one, the states are split into blocks of the given size that are
+     * processed concurrently, where updated values are only used within a block (and values of other blocks are taken from the previous step).
+     * The extreme values required to update the lower/upper bound are then also determined concurrently as part of the iteration step.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads, uint64_t blockSize);
+
     /*!
      * Performs one iteration step with respect to the given optimization direction.
      */
@@ -78,12 +91,25 @@ class SoundValueIterationHelper {
                               boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
 
     template<InternalOptimizationDirection dir>
-    void performIterationStepUpdateDecisionValue(std::vector<ValueType> const& b,
-                                                 boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup = boost::none,
-                                                 boost::optional<std::vector<uint_fast64_t>> const& scheduler = boost::none);
+    void performIterationStepParallel(std::vector<ValueType> const& b, boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup,
+                                      boost::optional<std::vector<uint_fast64_t>> const& scheduler);
+
+    /*!
+     * Computes the new values for the given row group. The decision value is only updated if it does not block yet.
+     */
+    template<InternalOptimizationDirection dir, typename MultiplyRowFunction>
+    void processRowGroup(uint64_t rowGroupIndex, std::vector<ValueType> const& b, boost::optional<storm::storage::BitVector> const& schedulerFixedForRowgroup,
+                         boost::optional<std::vector<uint_fast64_t>> const& scheduler, MultiplyRowFunction const& multiplyRowFunction, ValueType& xi,
+                         ValueType& yi, std::vector<ValueType>& xBuffer, std::vector<ValueType>& yBuffer, ValueType& localDecisionValue,
+                         bool& hasLocalDecisionValue);
 
     void multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi);
 
+    /*!
+     * Multiplies the given row, taking the values of columns outside of the given block from the previous step.
+     */
+    void multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi, uint64_t blockBegin, uint64_t blockEnd) const;
+
     template<InternalOptimizationDirection dir>
     bool checkConvergenceUpdateBounds(storm::storage::BitVector const* relevantValues = nullptr);
 
@@ -146,6 +172,22 @@ class SoundValueIterationHelper {
     std::vector<IndexType> matrixColumns;
     std::vector<IndexType> rowIndications;
     std::vector<uint_fast64_t> const* rowGroupIndices;
+
+    // Data for concurrent iteration steps
+    struct ThreadData {
+        std::vector<ValueType> xTmp, yTmp;
+        ValueType decisionValue, minBound, maxBound;
+        bool hasDecisionValue, hasBounds;
+        uint64_t minIndex, maxIndex;
+    };
+    uint64_t numberOfThreads;
+    uint64_t blockSize;
+    std::vector<ValueType> previousX, previousY;
+    std::vector<ThreadData> threadData;
+    // The extreme values of x_i / (1 - y_i) over all states, if they were determined during the last iteration step
+    bool hasStepBounds;
+    ValueType stepMinBound, stepMaxBound;
+    uint64_t stepMinIndex, stepMaxIndex;
 };
 
 }  // namespace helper
@@ -0,0 +1,126 @@
+#include "CompactMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+CompactMultiplier<ValueType>::CompactMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool CompactMultiplier<ValueType>::isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return storm::storage::CompactSparseMatrix<ValueType, uint32_t>::canRepresent(matrix);
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::initialize() const {
+    if (!compactMatrix) {
+        compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<ValueType, uint32_t>>(this->matrix, true);
+        STORM_LOG_TRACE("Created compact copy of the matrix with size " << compactMatrix->getSizeInMemory() << " bytes.");
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::clearCache() const {
+    compactMatrix.reset();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                            std::vector<ValueType>& result) const {
+    initialize();
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    compactMatrix->multiplyWithVector(x, *target, b);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                       bool backwards) const {
+    initialize();
+    if (backwards) {
+        compactMatrix->multiplyWithVectorBackward(x, x, b);
+    } else {
+        compactMatrix->multiplyWithVectorForward(0, compactMatrix->getRowCount(), x, x, b);
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                     std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                     std::vector<uint_fast64_t>* choices) const {
+    initialize();
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    compactMatrix->multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    initialize();
+    if (backwards) {
+        compactMatrix->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        compactMatrix->multiplyAndReduceForward(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, x, b, x, choices);
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    initialize();
+    for (auto const& entry : compactMatrix->getRow(rowIndex)) {
+        value += entry.getValue() * x[entry.getColumn()];
+    }
+}
+
+template<typename ValueType>
+void CompactMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                                                ValueType& val2) const {
+    initialize();
+    for (auto const& entry : compactMatrix->getRow(rowIndex)) {
+        val1 += entry.getValue() * x1[entry.getColumn()];
+        val2 += entry.getValue() * x2[entry.getColumn()];
+    }
+}
+
+template class CompactMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class CompactMultiplier<storm::RationalNumber>;
+template class CompactMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/solver/multiplier/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompactSparseMatrix.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that operates on a CompactSparseMatrix, i.e., a copy of the matrix that stores columns and values
+ * in separate arrays using 32-bit column indices. If the matrix has only few distinct values, they are stored in a value
+ * dictionary. This reduces the memory traffic of the multiplications at the cost of keeping a second copy of the matrix,
+ * which is created upon the first multiplication.
+ */
+template<typename ValueType>
+class CompactMultiplier : public Multiplier<ValueType> {
+   public:
+    CompactMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~CompactMultiplier() = default;
+
+    /*!
+     * Retrieves whether the given matrix can be handled by this multiplier.
+     */
+    static bool isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+    virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
+                              ValueType& val2) const override;
+    virtual void clearCache() const override;
+
+   protected:
+    void initialize() const;
+
+    mutable std::unique_ptr<storm::storage::CompactSparseMatrix<ValueType, uint32_t>> compactMatrix;
+};
+
+}  // namespace solver
+}  // namespace storm
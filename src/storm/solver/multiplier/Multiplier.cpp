@@ -7,18 +7,51 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "CompactMultiplier.h"
 #include "NativeMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/multiplier/GmmxxMultiplier.h"
+#include "storm/solver/multiplier/SellMultiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+template<typename ValueType>
+bool isImprovement(OptimizationDirection const& dir, ValueType const& newValue, ValueType const& oldValue) {
+    return minimize(dir) ? newValue < oldValue : newValue > oldValue;
+}
+
+template<typename ValueType>
+bool isConverged(std::vector<ValueType> const& oldValues, std::vector<ValueType> const& newValues, ValueType const& precision, bool relative) {
+    return storm::utility::vector::equalModuloPrecision<ValueType>(oldValues, newValues, precision, relative);
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+bool isImprovement(OptimizationDirection const&, storm::RationalFunction const&, storm::RationalFunction const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Reducing rational functions over row groups is not supported.");
+    return false;
+}
+
+template<>
+bool isConverged(std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&, storm::RationalFunction const&, bool) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking rational functions for convergence is not supported.");
+    return false;
+}
+#endif
+}  // namespace
+
 template<typename ValueType>
 Multiplier<ValueType>::Multiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
     // Intentionally left empty.
@@ -41,8 +74,65 @@ void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env,
     multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
 }
 
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
+                                                                  std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision,
+                                                                  bool relative) const {
+    return multiplyAndReduceWithConvergenceCheck(env, dir, this->matrix.getRowGroupIndices(), x, b, result, precision, relative);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                  std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                                  std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision,
+                                                                  bool relative) const {
+    STORM_LOG_ASSERT(&x != &result, "Vectors are aliased but are not allowed to be.");
+    multiplyAndReduce(env, dir, rowGroupIndices, x, b, result);
+    return isConverged(x, result, precision, relative);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                             std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                                                             ValueType const& precision, bool relative, bool backwards) const {
+    return multiplyAndReduceGaussSeidelWithConvergenceCheck(env, dir, this->matrix.getRowGroupIndices(), x, b, precision, relative, backwards);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                             std::vector<ValueType> const* b, ValueType const& precision, bool relative,
+                                                                             bool backwards) const {
+    // Keep a copy of the previous values for the comparison. The cached vector can not be used, as some multipliers need it for the multiplication.
+    std::vector<ValueType> previousX = x;
+    multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, nullptr, backwards);
+    return isConverged(previousX, x, precision, relative);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1,
+                                               std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1,
+                                               std::vector<ValueType>& result2, ValueType const& precision, bool relative, std::vector<uint_fast64_t>* choices1,
+                                               std::vector<uint_fast64_t>* choices2) const {
+    return multiplyAndReduce2(env, dir, this->matrix.getRowGroupIndices(), x1, x2, b, result1, result2, precision, relative, choices1, choices2);
+}
+
+template<typename ValueType>
+bool Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                               std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                               std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                               std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+    STORM_LOG_ASSERT(&x1 != &result1 && &x1 != &result2 && &x2 != &result1 && &x2 != &result2, "Vectors are aliased but are not allowed to be.");
+    multiplyAndReduce(env, dir, rowGroupIndices, x1, b, result1, choices1);
+    multiplyAndReduce(env, dir, rowGroupIndices, x2, b, result2, choices2);
+    return isConverged(result1, result2, precision, relative);
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
+    if (repeatedMultiplyTemporallyBlocked(env, nullptr, x, b, n)) {
+        return;
+    }
     storm::utility::ProgressMeasurement progress("multiplications");
     progress.setMaxCount(n);
     progress.startNewMeasurement(0);
@@ -59,6 +149,9 @@ void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector
 template<typename ValueType>
 void Multiplier<ValueType>::repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
                                                       std::vector<ValueType> const* b, uint64_t n) const {
+    if (repeatedMultiplyTemporallyBlocked(env, &dir, x, b, n)) {
+        return;
+    }
     storm::utility::ProgressMeasurement progress("multiplications");
     progress.setMaxCount(n);
     progress.startNewMeasurement(0);
@@ -71,6 +164,204 @@ void Multiplier<ValueType>::repeatedMultiplyAndReduce(Environment const& env, Op
     }
 }
 
+template<typename ValueType>
+bool Multiplier<ValueType>::repeatedMultiplyTemporallyBlocked(Environment const& env, OptimizationDirection const* dir, std::vector<ValueType>& x,
+                                                              std::vector<ValueType> const* b, uint64_t n) const {
+    uint64_t const window = env.solver().multiplier().getTemporalBlockingWindow();
+    uint64_t const numberOfGroups = dir ? matrix.getRowGroupCount() : matrix.getRowCount();
+    // If the matrix fits into the window, the multiplications do not need to fetch it from memory anyway.
+    if (window == 0 || n < 2 || numberOfGroups == 0 || matrix.getColumnCount() != numberOfGroups || matrix.getEntryCount() <= window) {
+        return false;
+    }
+    uint64_t const groupsInWindow = std::max<uint64_t>(1, window * numberOfGroups / matrix.getEntryCount());
+
+    // Determine the bandwidth, i.e., the largest distance between a row group and a column that one of its rows refers to.
+    // A block can only be advanced by several steps if these dependencies are local.
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    uint64_t bandwidth = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        uint64_t const rowBegin = dir ? rowGroupIndices[group] : group;
+        uint64_t const rowEnd = dir ? rowGroupIndices[group + 1] : group + 1;
+        if (rowBegin == rowEnd) {
+            // Empty row groups are handled by the multipliers in different ways, so we do not deal with them here.
+            return false;
+        }
+        for (auto const& entry : matrix.getRows(rowBegin, rowEnd)) {
+            bandwidth = std::max(bandwidth, entry.getColumn() > group ? entry.getColumn() - group : group - entry.getColumn());
+        }
+        if (2 * bandwidth > groupsInWindow) {
+            return false;
+        }
+    }
+
+    // Choose the number of row groups per block and the number of steps per sweep such that the part of the matrix that is touched while
+    // advancing a block by all steps of a sweep fits into the window.
+    uint64_t const blockSize = std::max<uint64_t>({bandwidth, groupsInWindow / 16, 1});
+    uint64_t const halo = (bandwidth + blockSize - 1) / blockSize;  // The number of neighbouring blocks (in each direction) a block depends on.
+    uint64_t const numberOfBlocks = (numberOfGroups + blockSize - 1) / blockSize;
+    uint64_t const stepsPerSweep = std::min<uint64_t>(n, groupsInWindow / (std::max<uint64_t>(halo, 1) * blockSize));
+    if (stepsPerSweep < 2) {
+        return false;
+    }
+    STORM_LOG_DEBUG("Performing " << n << " multiplications with temporal blocking using " << numberOfBlocks << " blocks of " << blockSize
+                                  << " row groups and " << stepsPerSweep << " steps per sweep.");
+
+    // The values of step i are stored in buffer i mod 2. The values of step i for some block overwrite the ones of step i - 2, which is safe as
+    // the blocks of step i - 1 that depend on them have already been computed at that point.
+    std::vector<ValueType> auxiliary(x.size());
+    std::vector<ValueType>* buffers[2] = {&x, &auxiliary};
+    auto computeBlock = [&](std::vector<ValueType> const& source, std::vector<ValueType>& target, uint64_t block) {
+        uint64_t const groupEnd = std::min((block + 1) * blockSize, numberOfGroups);
+        for (uint64_t group = block * blockSize; group < groupEnd; ++group) {
+            uint64_t const rowBegin = dir ? rowGroupIndices[group] : group;
+            uint64_t const rowEnd = dir ? rowGroupIndices[group + 1] : group + 1;
+            for (uint64_t row = rowBegin; row < rowEnd; ++row) {
+                ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : matrix.getRow(row)) {
+                    value += entry.getValue() * source[entry.getColumn()];
+                }
+                if (row == rowBegin || isImprovement(*dir, value, target[group])) {
+                    target[group] = std::move(value);
+                }
+            }
+        }
+    };
+
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(n);
+    progress.startNewMeasurement(0);
+    uint64_t step = 0;
+    while (step < n) {
+        uint64_t const steps = std::min(stepsPerSweep, n - step);
+        // In the given iteration, the t-th step of the sweep is performed for the block with index iteration - t * halo.
+        for (uint64_t iteration = 0; iteration < numberOfBlocks + (steps - 1) * halo; ++iteration) {
+            for (uint64_t t = 0; t < steps && t * halo <= iteration; ++t) {
+                uint64_t const block = iteration - t * halo;
+                if (block < numberOfBlocks) {
+                    computeBlock(*buffers[(step + t) % 2], *buffers[(step + t + 1) % 2], block);
+                }
+            }
+        }
+        step += steps;
+        progress.updateProgress(step);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << step << " of " << n << " multiplications.");
+            break;
+        }
+    }
+    if (step % 2 == 1) {
+        x.swap(auxiliary);
+    }
+    return true;
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndAccumulate(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                  std::vector<ValueType>& result, std::vector<ValueType> const& weights,
+                                                  std::vector<std::vector<ValueType>*> const& accumulators) const {
+    STORM_LOG_ASSERT(weights.size() == accumulators.size(), "Expected one weight per accumulator.");
+    multiply(env, x, b, result);
+    for (uint64_t j = 0; j < accumulators.size(); ++j) {
+        ValueType const& weight = weights[j];
+        auto accumulatorIt = accumulators[j]->begin();
+        for (auto const& value : result) {
+            *accumulatorIt += weight * value;
+            ++accumulatorIt;
+        }
+    }
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyBatch(Environment const&, uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                          std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            storm::utility::memory::adviseMemory(*this->cachedVector);
+        }
+        target = this->cachedVector.get();
+    }
+
+    for (uint64_t row = 0, rowCount = this->matrix.getRowCount(); row < rowCount; ++row) {
+        auto rowResult = target->begin() + row * batchSize;
+        if (b) {
+            std::copy(b->begin() + row * batchSize, b->begin() + (row + 1) * batchSize, rowResult);
+        } else {
+            std::fill(rowResult, rowResult + batchSize, storm::utility::zero<ValueType>());
+        }
+        for (auto const& entry : this->matrix.getRow(row)) {
+            auto columnValues = x.begin() + entry.getColumn() * batchSize;
+            for (uint64_t j = 0; j < batchSize; ++j) {
+                rowResult[j] += entry.getValue() * columnValues[j];
+            }
+        }
+    }
+
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, uint64_t batchSize,
+                                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+    multiplyAndReduceBatch(env, dir, this->matrix.getRowGroupIndices(), batchSize, x, b, result);
+}
+
+template<typename ValueType>
+void Multiplier<ValueType>::multiplyAndReduceBatch(Environment const&, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                   uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                   std::vector<ValueType>& result) const {
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            storm::utility::memory::adviseMemory(*this->cachedVector);
+        }
+        target = this->cachedVector.get();
+    }
+
+    std::vector<ValueType> rowValues(batchSize);
+    for (uint64_t group = 0, groupCount = rowGroupIndices.size() - 1; group < groupCount; ++group) {
+        auto groupResult = target->begin() + group * batchSize;
+        if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+            std::fill(groupResult, groupResult + batchSize, storm::utility::zero<ValueType>());
+            continue;
+        }
+        for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+            if (b) {
+                std::copy(b->begin() + row * batchSize, b->begin() + (row + 1) * batchSize, rowValues.begin());
+            } else {
+                std::fill(rowValues.begin(), rowValues.end(), storm::utility::zero<ValueType>());
+            }
+            for (auto const& entry : this->matrix.getRow(row)) {
+                auto columnValues = x.begin() + entry.getColumn() * batchSize;
+                for (uint64_t j = 0; j < batchSize; ++j) {
+                    rowValues[j] += entry.getValue() * columnValues[j];
+                }
+            }
+            if (row == rowGroupIndices[group]) {
+                std::copy(rowValues.begin(), rowValues.end(), groupResult);
+            } else {
+                for (uint64_t j = 0; j < batchSize; ++j) {
+                    if (isImprovement(dir, rowValues[j], groupResult[j])) {
+                        groupResult[j] = rowValues[j];
+                    }
+                }
+            }
+        }
+    }
+
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
 template<typename ValueType>
 void Multiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                                          ValueType& val2) const {
@@ -102,12 +393,31 @@ std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Envi
             return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
         case MultiplierType::Native:
             return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Compact:
+            if (CompactMultiplier<ValueType>::isApplicable(matrix)) {
+                return std::make_unique<CompactMultiplier<ValueType>>(matrix);
+            }
+            STORM_LOG_WARN("The matrix has too many columns for the compact multiplier. Falling back to the native multiplier.");
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Simd:
+            if (SimdMultiplier<ValueType>::isApplicable(matrix)) {
+                return std::make_unique<SimdMultiplier<ValueType>>(matrix);
+            }
+            STORM_LOG_WARN("The matrix has too many columns for the simd multiplier. Falling back to the native multiplier.");
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+        case MultiplierType::Sell:
+            if (SellMultiplier<ValueType>::isApplicable(matrix)) {
+                return std::make_unique<SellMultiplier<ValueType>>(matrix);
+            }
+            STORM_LOG_WARN("The matrix has too many columns for the sell multiplier. Falling back to the native multiplier.");
+            return std::make_unique<NativeMultiplier<ValueType>>(matrix);
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
 }
 
 template class Multiplier<double>;
 template class MultiplierFactory<double>;
+template class Multiplier<float>;
 
 #ifdef STORM_HAVE_CARL
 template class Multiplier<storm::RationalNumber>;
@@ -93,6 +93,59 @@ class Multiplier {
                                               std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
                                               bool backwards = true) const = 0;
 
+    /*!
+     * Performs multiplyAndReduce and additionally checks whether the result is equal to x up to the given precision
+     * (see storm::utility::vector::equalModuloPrecision). Multipliers may perform the check while the result is
+     * written, which saves an additional pass over both vectors. The matrix must have as many columns as row groups.
+     *
+     * @param result The target vector. Must not be the same as the x vector.
+     * @param precision The precision up to which the vectors have to be equal.
+     * @param relative If set, the difference is computed relative to the value of x.
+     * @return True iff the result is equal to x up to the precision.
+     */
+    bool multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x,
+                                               std::vector<ValueType> const* b, std::vector<ValueType>& result, ValueType const& precision,
+                                               bool relative) const;
+    virtual bool multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                       ValueType const& precision, bool relative) const;
+
+    /*!
+     * Performs multiplyAndReduceGaussSeidel and additionally checks whether the updated x is equal to the x before the
+     * update up to the given precision, see multiplyAndReduceWithConvergenceCheck.
+     *
+     * @return True iff the updated x is equal to the previous one up to the precision.
+     */
+    bool multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x,
+                                                          std::vector<ValueType> const* b, ValueType const& precision, bool relative,
+                                                          bool backwards = true) const;
+    virtual bool multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                  std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                  std::vector<ValueType> const* b, ValueType const& precision, bool relative,
+                                                                  bool backwards = true) const;
+
+    /*!
+     * Performs multiplyAndReduce for the two vectors x1 and x2 in a single pass over the matrix, i.e., every entry of the matrix is loaded once for
+     * both products. Interval iteration uses this to update the lower and the upper bounds at once. Additionally checks whether the two results are
+     * equal up to the given precision (see storm::utility::vector::equalModuloPrecision), which is the convergence criterion of interval iteration.
+     * The matrix must have as many columns as row groups.
+     *
+     * @param result1 The target vector for x1. Must not be the same as x1 or x2.
+     * @param result2 The target vector for x2. Must not be the same as x1 or x2.
+     * @param precision The precision up to which the results have to be equal.
+     * @param relative If set, the difference is computed relative to the value of result1.
+     * @param choices1 If given, the choices made in the reduction for x1 are written to this vector.
+     * @param choices2 If given, the choices made in the reduction for x2 are written to this vector.
+     * @return True iff the two results are equal up to the precision.
+     */
+    bool multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2,
+                            std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision,
+                            bool relative, std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+    virtual bool multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                    std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                    std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                    std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const;
+
     /*!
      * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
      * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -122,6 +175,56 @@ class Multiplier {
     void repeatedMultiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                    uint64_t n) const;
 
+    /*!
+     * Performs a matrix-vector multiplication x' = A*x + b and adds the scaled result to each of the given
+     * accumulators, i.e., a_j += w_j * x' for every accumulator a_j with weight w_j. This is, for example, used to sum
+     * up the Poisson-weighted vectors during uniformization without traversing the result vector once more.
+     *
+     * @param x The input vector with which to multiply the matrix. Its length must be equal
+     * to the number of columns of A.
+     * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+     * to the number of rows of A.
+     * @param result The target vector into which to write the multiplication result. Its length must be equal
+     * to the number of rows of A. Can be the same as the x vector.
+     * @param weights The weights w_j with which the result is scaled.
+     * @param accumulators The accumulators a_j. Each of them must have the length of the result.
+     */
+    virtual void multiplyAndAccumulate(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                       std::vector<ValueType>& result, std::vector<ValueType> const& weights,
+                                       std::vector<std::vector<ValueType>*> const& accumulators) const;
+
+    /*!
+     * Performs the matrix-vector multiplications x_j' = A*x_j + b_j for a batch of vectors x_1, ..., x_k at once. This
+     * traverses the matrix only once for all vectors. The vectors are stored interleaved, i.e., entry i of vector j is
+     * located at position i * k + j.
+     *
+     * @param batchSize The number k of vectors.
+     * @param x The input vectors. The length must be k times the number of columns of A.
+     * @param b If non-null, these vectors are added after the multiplication. If given, the length must be k times
+     * the number of rows of A.
+     * @param result The target vectors. The length must be k times the number of rows of A. Can be the same as x.
+     */
+    virtual void multiplyBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                               std::vector<ValueType>& result) const;
+
+    /*!
+     * Performs the matrix-vector multiplications x_j' = A*x_j + b_j for a batch of (interleaved) vectors and then
+     * minimizes/maximizes over the row groups, see multiplyBatch and multiplyAndReduce.
+     *
+     * @param dir The direction for the reduction step.
+     * @param rowGroupIndices A vector storing the row groups over which to reduce.
+     * @param batchSize The number k of vectors.
+     * @param x The input vectors. The length must be k times the number of columns of A.
+     * @param b If non-null, these vectors are added after the multiplication. If given, the length must be k times
+     * the number of rows of A.
+     * @param result The target vectors. The length must be k times the number of row groups. Can be the same as x.
+     */
+    void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, uint64_t batchSize, std::vector<ValueType> const& x,
+                                std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+    virtual void multiplyAndReduceBatch(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                        uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                        std::vector<ValueType>& result) const;
+
     /*!
      * Multiplies the row with the given index with x and adds the result to the provided value
      * @param rowIndex The index of the considered row
@@ -144,6 +247,18 @@ class Multiplier {
    protected:
     mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
     storm::storage::SparseMatrix<ValueType> const& matrix;
+
+   private:
+    /*!
+     * Performs repeated (reducing, if a direction is given) multiplications with a temporally blocked matrix powers kernel. The row groups are split
+     * into blocks and, within a sweep, a block is advanced by several steps as soon as the blocks it depends on have reached the previous step.
+     * Thereby, the part of the matrix that is needed for these steps is still in the cache. The results coincide with the ones of
+     * repeatedMultiply(AndReduce), where the computation is done on the matrix directly (irrespective of the type of the multiplier).
+     *
+     * @return False if temporal blocking is disabled or not beneficial for this matrix. In this case, x is not changed.
+     */
+    bool repeatedMultiplyTemporallyBlocked(Environment const& env, OptimizationDirection const* dir, std::vector<ValueType>& x,
+                                           std::vector<ValueType> const* b, uint64_t n) const;
 };
 
 template<typename ValueType>
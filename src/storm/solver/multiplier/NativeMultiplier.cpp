@@ -1,5 +1,8 @@
 #include "NativeMultiplier.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
@@ -12,7 +15,12 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
@@ -24,11 +32,7 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
 
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
-#ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
-#else
-    return false;
-#endif
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads() > 1;
 }
 
 template<typename ValueType>
@@ -40,6 +44,7 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
             this->cachedVector->resize(x.size());
         } else {
             this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            storm::utility::memory::adviseMemory(*this->cachedVector);
         }
         target = this->cachedVector.get();
     }
@@ -56,7 +61,10 @@ void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<V
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b,
                                                       bool backwards) const {
-    if (backwards) {
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    if (numberOfThreads > 1) {
+        multAddBlockGaussSeidel(numberOfThreads, env.solver().multiplier().getGaussSeidelBlockSize(), x, b, backwards);
+    } else if (backwards) {
         this->matrix.multiplyWithVectorBackward(x, x, b);
     } else {
         this->matrix.multiplyWithVectorForward(x, x, b);
@@ -73,6 +81,7 @@ void NativeMultiplier<ValueType>::multiplyAndReduce(Environment const& env, Opti
             this->cachedVector->resize(x.size());
         } else {
             this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            storm::utility::memory::adviseMemory(*this->cachedVector);
         }
         target = this->cachedVector.get();
     }
@@ -90,13 +99,124 @@ template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
                                                                std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-    if (backwards) {
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads());
+    if (numberOfThreads > 1) {
+        multAddReduceBlockGaussSeidel(numberOfThreads, env.solver().multiplier().getGaussSeidelBlockSize(), dir, rowGroupIndices, x, b, choices, backwards);
+    } else if (backwards) {
         this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
     } else {
         this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
     }
 }
 
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                        std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
+                                                                        std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                                        ValueType const& precision, bool relative) const {
+    if (parallelize(env)) {
+        return Multiplier<ValueType>::multiplyAndReduceWithConvergenceCheck(env, dir, rowGroupIndices, x, b, result, precision, relative);
+    }
+    STORM_LOG_ASSERT(&x != &result, "Vectors are aliased but are not allowed to be.");
+    return this->matrix.multiplyAndReduceForwardWithConvergenceCheck(dir, rowGroupIndices, x, b, result, precision, relative);
+}
+
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                                   std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                                   std::vector<ValueType> const* b, ValueType const& precision, bool relative,
+                                                                                   bool backwards) const {
+    if (storm::utility::parallel::getNumberOfThreads(env.solver().multiplier().getNumberOfGaussSeidelThreads()) > 1) {
+        return Multiplier<ValueType>::multiplyAndReduceGaussSeidelWithConvergenceCheck(env, dir, rowGroupIndices, x, b, precision, relative, backwards);
+    } else if (backwards) {
+        return this->matrix.multiplyAndReduceBackwardWithConvergenceCheck(dir, rowGroupIndices, x, b, x, precision, relative);
+    } else {
+        return this->matrix.multiplyAndReduceForwardWithConvergenceCheck(dir, rowGroupIndices, x, b, x, precision, relative);
+    }
+}
+
+template<typename ValueType>
+bool NativeMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                     std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                                     std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision,
+                                                     bool relative, std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+    STORM_LOG_ASSERT(&x1 != &result1 && &x1 != &result2 && &x2 != &result1 && &x2 != &result2, "Vectors are aliased but are not allowed to be.");
+    uint64_t const numberOfGroups = rowGroupIndices.size() - 1;
+    auto multiplyAndReduceGroups = [&](uint64_t startGroup, uint64_t endGroup) {
+        if (minimize(dir)) {
+            return multAddReduce2<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startGroup, endGroup, x1, x2, b, result1, result2, precision,
+                                                                           relative, choices1, choices2);
+        } else {
+            return multAddReduce2<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startGroup, endGroup, x1, x2, b, result1, result2, precision,
+                                                                              relative, choices1, choices2);
+        }
+    };
+    if (parallelize(env)) {
+        std::atomic<bool> converged(true);
+        storm::utility::vector::forEachRangeParallel(numberOfGroups, [&](uint64_t startGroup, uint64_t endGroup) {
+            if (!multiplyAndReduceGroups(startGroup, endGroup)) {
+                converged.store(false, std::memory_order_relaxed);
+            }
+        });
+        return converged.load();
+    } else {
+        return multiplyAndReduceGroups(0, numberOfGroups);
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+bool NativeMultiplier<storm::RationalFunction>::multiplyAndReduce2(Environment const&, OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                   std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const&,
+                                                                   std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&,
+                                                                   std::vector<storm::RationalFunction>&, storm::RationalFunction const&, bool,
+                                                                   std::vector<uint_fast64_t>*, std::vector<uint_fast64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Reducing rational functions over row groups is not supported.");
+    return false;
+}
+#endif
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multiplyAndAccumulate(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                        std::vector<ValueType>& result, std::vector<ValueType> const& weights,
+                                                        std::vector<std::vector<ValueType>*> const& accumulators) const {
+    STORM_LOG_ASSERT(weights.size() == accumulators.size(), "Expected one weight per accumulator.");
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            storm::utility::memory::adviseMemory(*this->cachedVector);
+        }
+        target = this->cachedVector.get();
+    }
+
+    // The value of each row is added to the accumulators right after it has been computed, i.e., while it is still in a register.
+    uint64_t const numberOfAccumulators = accumulators.size();
+    auto multiplyAndAccumulateRows = [&](uint64_t rowBegin, uint64_t rowEnd) {
+        for (uint64_t row = rowBegin; row < rowEnd; ++row) {
+            ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+            for (auto const& entry : this->matrix.getRow(row)) {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+            for (uint64_t j = 0; j < numberOfAccumulators; ++j) {
+                (*accumulators[j])[row] += weights[j] * value;
+            }
+            (*target)[row] = std::move(value);
+        }
+    };
+    if (parallelize(env)) {
+        storm::utility::vector::forEachRangeParallel(this->matrix.getRowCount(), multiplyAndAccumulateRows);
+    } else {
+        multiplyAndAccumulateRows(0, this->matrix.getRowCount());
+    }
+
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
     for (auto const& entry : this->matrix.getRow(rowIndex)) {
@@ -127,27 +247,196 @@ void NativeMultiplier<ValueType>::multAddReduce(storm::solver::OptimizationDirec
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
-#ifdef STORM_HAVE_INTELTBB
     this->matrix.multiplyWithVectorParallel(x, result, b);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAdd(x, b, result);
-#endif
 }
 
 template<typename ValueType>
 void NativeMultiplier<ValueType>::multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                                         std::vector<uint64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
     this->matrix.multiplyAndReduceParallel(dir, rowGroupIndices, x, b, result, choices);
-#else
-    STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential version.");
-    multAddReduce(dir, rowGroupIndices, x, b, result, choices);
+}
+
+template<typename ValueType>
+template<typename Compare>
+bool NativeMultiplier<ValueType>::multAddReduce2(std::vector<uint64_t> const& rowGroupIndices, uint64_t startGroup, uint64_t endGroup,
+                                                 std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                                 std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                                 std::vector<uint64_t>* choices1, std::vector<uint64_t>* choices2) const {
+    Compare compare;
+    bool converged = true;
+    for (uint64_t group = startGroup; group < endGroup; ++group) {
+        uint64_t const groupStart = rowGroupIndices[group];
+        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupSize == 0) {
+            continue;
+        }
+
+        // For both vectors, we keep the optimal value, the row that attains it and the value of the previously selected row.
+        ValueType optimalValue1 = storm::utility::zero<ValueType>();
+        ValueType optimalValue2 = storm::utility::zero<ValueType>();
+        ValueType oldSelectedChoiceValue1 = storm::utility::zero<ValueType>();
+        ValueType oldSelectedChoiceValue2 = storm::utility::zero<ValueType>();
+        uint64_t selectedChoice1 = 0;
+        uint64_t selectedChoice2 = 0;
+        for (uint64_t choice = 0; choice < groupSize; ++choice) {
+            ValueType value1 = b ? (*b)[groupStart + choice] : storm::utility::zero<ValueType>();
+            ValueType value2 = value1;
+            for (auto const& entry : this->matrix.getRow(groupStart + choice)) {
+                value1 += entry.getValue() * x1[entry.getColumn()];
+                value2 += entry.getValue() * x2[entry.getColumn()];
+            }
+            if (choices1 && choice == (*choices1)[group]) {
+                oldSelectedChoiceValue1 = value1;
+            }
+            if (choices2 && choice == (*choices2)[group]) {
+                oldSelectedChoiceValue2 = value2;
+            }
+            if (choice == 0 || compare(value1, optimalValue1)) {
+                optimalValue1 = std::move(value1);
+                selectedChoice1 = choice;
+            }
+            if (choice == 0 || compare(value2, optimalValue2)) {
+                optimalValue2 = std::move(value2);
+                selectedChoice2 = choice;
+            }
+        }
+
+        // Only update the choices if the new choice is strictly better than the previously selected one.
+        if (choices1 && ((*choices1)[group] >= groupSize || compare(optimalValue1, oldSelectedChoiceValue1))) {
+            (*choices1)[group] = selectedChoice1;
+        }
+        if (choices2 && ((*choices2)[group] >= groupSize || compare(optimalValue2, oldSelectedChoiceValue2))) {
+            (*choices2)[group] = selectedChoice2;
+        }
+        if (converged && !storm::utility::vector::equalModuloPrecision<ValueType>(optimalValue1, optimalValue2, precision, relative)) {
+            converged = false;
+        }
+        result1[group] = std::move(optimalValue1);
+        result2[group] = std::move(optimalValue2);
+    }
+    return converged;
+}
+
+template<typename ValueType>
+std::vector<ValueType> const& NativeMultiplier<ValueType>::copyToCachedVector(std::vector<ValueType> const& x) const {
+    if (this->cachedVector) {
+        *this->cachedVector = x;
+    } else {
+        this->cachedVector = std::make_unique<std::vector<ValueType>>(x);
+        storm::utility::memory::adviseMemory(*this->cachedVector);
+    }
+    return *this->cachedVector;
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, std::vector<ValueType>& x,
+                                                          std::vector<ValueType> const* b, bool backwards) const {
+    std::vector<ValueType> const& previousX = copyToCachedVector(x);
+    uint64_t const rowCount = this->matrix.getRowCount();
+    uint64_t const numberOfBlocks = (rowCount + blockSize - 1) / blockSize;
+
+    // Every block only writes the entries of x that belong to the block and only reads these entries from x, so the
+    // blocks can be processed concurrently.
+    storm::utility::parallel::forEachChunk(0, numberOfBlocks, 1, numberOfThreads, [&](uint64_t, uint64_t block, uint64_t) {
+        uint64_t const blockBegin = block * blockSize;
+        uint64_t const blockEnd = std::min(blockBegin + blockSize, rowCount);
+        for (uint64_t i = 0; i < blockEnd - blockBegin; ++i) {
+            uint64_t const row = backwards ? blockEnd - 1 - i : blockBegin + i;
+            ValueType newValue = b ? (*b)[row] : storm::utility::zero<ValueType>();
+            for (auto const& entry : this->matrix.getRow(row)) {
+                uint64_t const column = entry.getColumn();
+                newValue += entry.getValue() * ((column >= blockBegin && column < blockEnd) ? x[column] : previousX[column]);
+            }
+            x[row] = newValue;
+        }
+    });
+}
+
+template<typename ValueType>
+void NativeMultiplier<ValueType>::multAddReduceBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, storm::solver::OptimizationDirection const& dir,
+                                                                std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const {
+    if (dir == storm::OptimizationDirection::Minimize) {
+        multAddReduceBlockGaussSeidel<storm::utility::ElementLess<ValueType>>(numberOfThreads, blockSize, rowGroupIndices, x, b, choices, backwards);
+    } else {
+        multAddReduceBlockGaussSeidel<storm::utility::ElementGreater<ValueType>>(numberOfThreads, blockSize, rowGroupIndices, x, b, choices, backwards);
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void NativeMultiplier<storm::RationalFunction>::multAddReduceBlockGaussSeidel(uint64_t, uint64_t, storm::solver::OptimizationDirection const&,
+                                                                              std::vector<uint64_t> const&, std::vector<storm::RationalFunction>&,
+                                                                              std::vector<storm::RationalFunction> const*, std::vector<uint64_t>*, bool) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
 #endif
+
+template<typename ValueType>
+template<typename Compare>
+void NativeMultiplier<ValueType>::multAddReduceBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, std::vector<uint64_t> const& rowGroupIndices,
+                                                                std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint64_t>* choices,
+                                                                bool backwards) const {
+    Compare compare;
+    std::vector<ValueType> const& previousX = copyToCachedVector(x);
+    uint64_t const groupCount = rowGroupIndices.size() - 1;
+    uint64_t const numberOfBlocks = (groupCount + blockSize - 1) / blockSize;
+
+    storm::utility::parallel::forEachChunk(0, numberOfBlocks, 1, numberOfThreads, [&](uint64_t, uint64_t block, uint64_t) {
+        uint64_t const blockBegin = block * blockSize;
+        uint64_t const blockEnd = std::min(blockBegin + blockSize, groupCount);
+        auto multiplyRow = [&](uint64_t row) {
+            ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+            for (auto const& entry : this->matrix.getRow(row)) {
+                uint64_t const column = entry.getColumn();
+                value += entry.getValue() * ((column >= blockBegin && column < blockEnd) ? x[column] : previousX[column]);
+            }
+            return value;
+        };
+
+        for (uint64_t i = 0; i < blockEnd - blockBegin; ++i) {
+            uint64_t const group = backwards ? blockEnd - 1 - i : blockBegin + i;
+            uint64_t const groupBegin = rowGroupIndices[group];
+            uint64_t const groupSize = rowGroupIndices[group + 1] - groupBegin;
+
+            // Only multiply and reduce if there is at least one row in the group.
+            if (groupSize == 0) {
+                continue;
+            }
+
+            // Like the sequential kernels, we consider the rows of a group in reverse order for backward sweeps and choices are
+            // only updated if the new choice is strictly better than the previously selected one.
+            uint64_t localRow = backwards ? groupSize - 1 : 0;
+            ValueType currentValue = multiplyRow(groupBegin + localRow);
+            uint64_t selectedChoice = localRow;
+            bool oldChoiceFound = choices && (*choices)[group] == localRow;
+            ValueType oldSelectedChoiceValue = currentValue;
+            for (uint64_t j = 1; j < groupSize; ++j) {
+                localRow = backwards ? groupSize - 1 - j : j;
+                ValueType newValue = multiplyRow(groupBegin + localRow);
+                if (choices && (*choices)[group] == localRow) {
+                    oldChoiceFound = true;
+                    oldSelectedChoiceValue = newValue;
+                }
+                if (compare(newValue, currentValue)) {
+                    currentValue = newValue;
+                    selectedChoice = localRow;
+                }
+            }
+
+            x[group] = currentValue;
+            if (choices && (!oldChoiceFound || compare(currentValue, oldSelectedChoiceValue))) {
+                (*choices)[group] = selectedChoice;
+            }
+        }
+    });
 }
 
 template class NativeMultiplier<double>;
+template class NativeMultiplier<float>;
 #ifdef STORM_HAVE_CARL
 template class NativeMultiplier<storm::RationalNumber>;
 template class NativeMultiplier<storm::RationalFunction>;
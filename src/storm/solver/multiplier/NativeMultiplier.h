@@ -27,6 +27,20 @@ class NativeMultiplier : public Multiplier<ValueType> {
     virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                               std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
                                               bool backwards = true) const override;
+    virtual bool multiplyAndReduceWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                       ValueType const& precision, bool relative) const override;
+    virtual bool multiplyAndReduceGaussSeidelWithConvergenceCheck(Environment const& env, OptimizationDirection const& dir,
+                                                                  std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                                  std::vector<ValueType> const* b, ValueType const& precision, bool relative,
+                                                                  bool backwards = true) const override;
+    virtual bool multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                    std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                    std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                    std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const override;
+    virtual void multiplyAndAccumulate(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                       std::vector<ValueType>& result, std::vector<ValueType> const& weights,
+                                       std::vector<std::vector<ValueType>*> const& accumulators) const override;
     virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
     virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2,
                               ValueType& val2) const override;
@@ -42,6 +56,36 @@ class NativeMultiplier : public Multiplier<ValueType> {
     void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
     void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x,
                                std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * The kernel of multiplyAndReduce2 for the row groups in [startGroup, endGroup).
+     *
+     * @return True iff the results of these row groups are equal up to the precision.
+     */
+    template<typename Compare>
+    bool multAddReduce2(std::vector<uint64_t> const& rowGroupIndices, uint64_t startGroup, uint64_t endGroup, std::vector<ValueType> const& x1,
+                        std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2,
+                        ValueType const& precision, bool relative, std::vector<uint64_t>* choices1, std::vector<uint64_t>* choices2) const;
+
+    /*!
+     * Performs a Gauss-Seidel style multiplication in which the rows are split into blocks of consecutive rows that
+     * are processed in parallel. Within a block, the updated values are used immediately whereas values of other
+     * blocks are taken from the previous sweep. The result is thus independent of the scheduling of the threads.
+     */
+    void multAddBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                 bool backwards) const;
+    void multAddReduceBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, storm::solver::OptimizationDirection const& dir,
+                                       std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                       std::vector<uint64_t>* choices, bool backwards) const;
+    template<typename Compare>
+    void multAddReduceBlockGaussSeidel(uint64_t numberOfThreads, uint64_t blockSize, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                       std::vector<ValueType> const* b, std::vector<uint64_t>* choices, bool backwards) const;
+
+    /*!
+     * Prepares a copy of the given vector that holds the values of the previous sweep of a parallel Gauss-Seidel
+     * style multiplication.
+     */
+    std::vector<ValueType> const& copyToCachedVector(std::vector<ValueType> const& x) const;
 };
 
 }  // namespace solver
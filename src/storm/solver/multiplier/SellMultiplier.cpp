@@ -0,0 +1,105 @@
+#include "SellMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+SellMultiplier<ValueType>::SellMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool SellMultiplier<ValueType>::isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return storm::storage::SlicedEllpackMatrix<ValueType, uint32_t>::canRepresent(matrix);
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::initialize() const {
+    if (!sellMatrix) {
+        sellMatrix = std::make_unique<storm::storage::SlicedEllpackMatrix<ValueType, uint32_t>>(this->matrix);
+        STORM_LOG_TRACE("Created sliced ELLPACK copy of the matrix with size " << sellMatrix->getSizeInMemory() << " bytes and "
+                                                                                << sellMatrix->getNumberOfStoredEntries() - sellMatrix->getEntryCount()
+                                                                                << " padding entries.");
+    }
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::clearCache() const {
+    sellMatrix.reset();
+    rowValues.clear();
+    rowValues.shrink_to_fit();
+    Multiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    initialize();
+    std::vector<ValueType>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    sellMatrix->multiplyWithVector(x, *target, b);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyWithVectorBackward(x, x, b);
+    } else {
+        this->matrix.multiplyWithVectorForward(x, x, b);
+    }
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    initialize();
+    // The row values are computed completely before the reduction, so x and result may be aliased.
+    sellMatrix->multiplyAndReduce(dir, rowGroupIndices, x, b, result, choices, rowValues);
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    if (backwards) {
+        this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+    } else {
+        this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices);
+    }
+}
+
+template<typename ValueType>
+void SellMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+    for (auto const& entry : this->matrix.getRow(rowIndex)) {
+        value += entry.getValue() * x[entry.getColumn()];
+    }
+}
+
+template class SellMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SellMultiplier<storm::RationalNumber>;
+template class SellMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/solver/multiplier/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SlicedEllpackMatrix.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that operates on a SlicedEllpackMatrix, i.e., a copy of the matrix in the SELL-C-sigma format whose
+ * slices of rows are multiplied in lockstep. This pays off for matrices with many rows of similar length. The copy is
+ * created upon the first multiplication. Gauss-Seidel style multiplications need the original row order and are
+ * therefore performed on the original matrix.
+ */
+template<typename ValueType>
+class SellMultiplier : public Multiplier<ValueType> {
+   public:
+    SellMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SellMultiplier() = default;
+
+    /*!
+     * Retrieves whether the given matrix can be handled by this multiplier.
+     */
+    static bool isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+    virtual void clearCache() const override;
+
+   protected:
+    void initialize() const;
+
+    mutable std::unique_ptr<storm::storage::SlicedEllpackMatrix<ValueType, uint32_t>> sellMatrix;
+
+    // The values of the rows before the reduction.
+    mutable std::vector<ValueType> rowValues;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,500 @@
+#include "storm/solver/multiplier/SimdKernels.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+namespace {
+
+/*
+ * The kernels are written once (see Kernels below) and are parameterized with a class that provides
+ * the vectorized building blocks. The entry points for the individual instruction sets are compiled for the
+ * respective target and flattened, such that all building blocks are inlined with the right instruction set.
+ * This way, Storm does not need to be compiled with -mavx2 (or similar) and still runs on older CPUs.
+ */
+
+struct ScalarOperations {
+    static double dot(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x) {
+        double result = 0.0;
+        for (uint64_t i = 0; i < numberOfEntries; ++i) {
+            result += values[i] * x[columns[i]];
+        }
+        return result;
+    }
+
+    static void dot2(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x1, double const* x2, double& result1,
+                     double& result2) {
+        result1 = 0.0;
+        result2 = 0.0;
+        for (uint64_t i = 0; i < numberOfEntries; ++i) {
+            result1 += values[i] * x1[columns[i]];
+            result2 += values[i] * x2[columns[i]];
+        }
+    }
+
+    template<bool Minimize>
+    static double reduce(double const* values, uint64_t size) {
+        double result = values[0];
+        for (uint64_t i = 1; i < size; ++i) {
+            result = Minimize ? std::min(result, values[i]) : std::max(result, values[i]);
+        }
+        return result;
+    }
+};
+
+#ifdef STORM_SIMD_X86
+struct Avx2Operations {
+    __attribute__((target("avx2,fma"))) static double dot(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x) {
+        if (numberOfEntries < 4) {
+            return ScalarOperations::dot(columns, values, numberOfEntries, x);
+        }
+        __m256d sum = _mm256_setzero_pd();
+        uint64_t i = 0;
+        for (; i + 4 <= numberOfEntries; i += 4) {
+            // The gather treats the indices as signed offsets, which is fine as the columns are at most INT32_MAX (see CsrMatrixView).
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + i));
+            __m256d gathered = _mm256_i32gather_pd(x, indices, 8);
+            sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + i), gathered, sum);
+        }
+        __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+        double result = _mm_cvtsd_f64(_mm_add_sd(halves, _mm_unpackhi_pd(halves, halves)));
+        for (; i < numberOfEntries; ++i) {
+            result += values[i] * x[columns[i]];
+        }
+        return result;
+    }
+
+    __attribute__((target("avx2,fma"))) static void dot2(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x1,
+                                                         double const* x2, double& result1, double& result2) {
+        if (numberOfEntries < 4) {
+            ScalarOperations::dot2(columns, values, numberOfEntries, x1, x2, result1, result2);
+            return;
+        }
+        __m256d sum1 = _mm256_setzero_pd();
+        __m256d sum2 = _mm256_setzero_pd();
+        uint64_t i = 0;
+        for (; i + 4 <= numberOfEntries; i += 4) {
+            __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + i));
+            __m256d entries = _mm256_loadu_pd(values + i);
+            sum1 = _mm256_fmadd_pd(entries, _mm256_i32gather_pd(x1, indices, 8), sum1);
+            sum2 = _mm256_fmadd_pd(entries, _mm256_i32gather_pd(x2, indices, 8), sum2);
+        }
+        __m128d halves1 = _mm_add_pd(_mm256_castpd256_pd128(sum1), _mm256_extractf128_pd(sum1, 1));
+        __m128d halves2 = _mm_add_pd(_mm256_castpd256_pd128(sum2), _mm256_extractf128_pd(sum2, 1));
+        result1 = _mm_cvtsd_f64(_mm_add_sd(halves1, _mm_unpackhi_pd(halves1, halves1)));
+        result2 = _mm_cvtsd_f64(_mm_add_sd(halves2, _mm_unpackhi_pd(halves2, halves2)));
+        for (; i < numberOfEntries; ++i) {
+            result1 += values[i] * x1[columns[i]];
+            result2 += values[i] * x2[columns[i]];
+        }
+    }
+
+    template<bool Minimize>
+    __attribute__((target("avx2,fma"))) static double reduce(double const* values, uint64_t size) {
+        if (size < 8) {
+            return ScalarOperations::reduce<Minimize>(values, size);
+        }
+        __m256d current = _mm256_loadu_pd(values);
+        uint64_t i = 4;
+        for (; i + 4 <= size; i += 4) {
+            __m256d next = _mm256_loadu_pd(values + i);
+            current = Minimize ? _mm256_min_pd(current, next) : _mm256_max_pd(current, next);
+        }
+        __m128d halves = Minimize ? _mm_min_pd(_mm256_castpd256_pd128(current), _mm256_extractf128_pd(current, 1))
+                                  : _mm_max_pd(_mm256_castpd256_pd128(current), _mm256_extractf128_pd(current, 1));
+        double result = Minimize ? std::min(_mm_cvtsd_f64(halves), _mm_cvtsd_f64(_mm_unpackhi_pd(halves, halves)))
+                                 : std::max(_mm_cvtsd_f64(halves), _mm_cvtsd_f64(_mm_unpackhi_pd(halves, halves)));
+        for (; i < size; ++i) {
+            result = Minimize ? std::min(result, values[i]) : std::max(result, values[i]);
+        }
+        return result;
+    }
+};
+
+struct Avx512Operations {
+    __attribute__((target("avx512f,avx2,fma"))) static double dot(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x) {
+        if (numberOfEntries < 8) {
+            return Avx2Operations::dot(columns, values, numberOfEntries, x);
+        }
+        __m512d sum = _mm512_setzero_pd();
+        uint64_t i = 0;
+        for (; i + 8 <= numberOfEntries; i += 8) {
+            // The gather treats the indices as signed offsets, which is fine as the columns are at most INT32_MAX (see CsrMatrixView).
+            __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + i));
+            __m512d gathered = _mm512_i32gather_pd(indices, x, 8);
+            sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + i), gathered, sum);
+        }
+        if (i < numberOfEntries) {
+            // Process the remaining entries with masked loads. The indices of the inactive lanes are zero, which is
+            // a valid position in x.
+            __mmask8 mask = static_cast<__mmask8>((1u << (numberOfEntries - i)) - 1);
+            __m512i indices = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns + i);
+            __m512d gathered = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, _mm512_castsi512_si256(indices), x, 8);
+            sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + i), gathered, sum);
+        }
+        return _mm512_reduce_add_pd(sum);
+    }
+
+    __attribute__((target("avx512f,avx2,fma"))) static void dot2(uint32_t const* columns, double const* values, uint64_t numberOfEntries, double const* x1,
+                                                                 double const* x2, double& result1, double& result2) {
+        if (numberOfEntries < 8) {
+            Avx2Operations::dot2(columns, values, numberOfEntries, x1, x2, result1, result2);
+            return;
+        }
+        __m512d sum1 = _mm512_setzero_pd();
+        __m512d sum2 = _mm512_setzero_pd();
+        uint64_t i = 0;
+        for (; i + 8 <= numberOfEntries; i += 8) {
+            __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + i));
+            __m512d entries = _mm512_loadu_pd(values + i);
+            sum1 = _mm512_fmadd_pd(entries, _mm512_i32gather_pd(indices, x1, 8), sum1);
+            sum2 = _mm512_fmadd_pd(entries, _mm512_i32gather_pd(indices, x2, 8), sum2);
+        }
+        if (i < numberOfEntries) {
+            // As in dot, the remaining entries are processed with masked loads.
+            __mmask8 mask = static_cast<__mmask8>((1u << (numberOfEntries - i)) - 1);
+            __m256i indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns + i));
+            __m512d entries = _mm512_maskz_loadu_pd(mask, values + i);
+            sum1 = _mm512_fmadd_pd(entries, _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, x1, 8), sum1);
+            sum2 = _mm512_fmadd_pd(entries, _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, x2, 8), sum2);
+        }
+        result1 = _mm512_reduce_add_pd(sum1);
+        result2 = _mm512_reduce_add_pd(sum2);
+    }
+
+    template<bool Minimize>
+    __attribute__((target("avx512f,avx2,fma"))) static double reduce(double const* values, uint64_t size) {
+        if (size < 16) {
+            return Avx2Operations::reduce<Minimize>(values, size);
+        }
+        __m512d current = _mm512_loadu_pd(values);
+        uint64_t i = 8;
+        for (; i + 8 <= size; i += 8) {
+            __m512d next = _mm512_loadu_pd(values + i);
+            current = Minimize ? _mm512_min_pd(current, next) : _mm512_max_pd(current, next);
+        }
+        if (i < size) {
+            // Inactive lanes keep the values of the current vector, so they do not affect the result.
+            __mmask8 mask = static_cast<__mmask8>((1u << (size - i)) - 1);
+            __m512d next = _mm512_mask_loadu_pd(current, mask, values + i);
+            current = Minimize ? _mm512_min_pd(current, next) : _mm512_max_pd(current, next);
+        }
+        return Minimize ? _mm512_reduce_min_pd(current) : _mm512_reduce_max_pd(current);
+    }
+};
+#endif
+
+template<typename Operations>
+struct Kernels {
+    static void multiplyWithVector(CsrMatrixView const& matrix, uint64_t startRow, uint64_t endRow, double const* x, double const* summand, double* result,
+                                   bool backwards) {
+        if (backwards) {
+            for (uint64_t row = endRow; row > startRow;) {
+                --row;
+                result[row] = multiplyRow(matrix, row, x, summand);
+            }
+        } else {
+            for (uint64_t row = startRow; row < endRow; ++row) {
+                result[row] = multiplyRow(matrix, row, x, summand);
+            }
+        }
+    }
+
+    template<bool Minimize>
+    static void multiplyAndReduce(CsrMatrixView const& matrix, uint64_t const* rowGroupIndices, uint64_t startGroup, uint64_t endGroup, double const* x,
+                                  double const* summand, double* result, uint64_t* choices, bool backwards) {
+        // Buffer for the values of the rows of the current group.
+        std::vector<double> rowValues;
+        if (backwards) {
+            for (uint64_t group = endGroup; group > startGroup;) {
+                --group;
+                reduceGroup<Minimize>(matrix, rowGroupIndices, group, x, summand, result, choices, rowValues, true);
+            }
+        } else {
+            for (uint64_t group = startGroup; group < endGroup; ++group) {
+                reduceGroup<Minimize>(matrix, rowGroupIndices, group, x, summand, result, choices, rowValues, false);
+            }
+        }
+    }
+
+    template<bool Minimize>
+    static bool multiplyAndReduce2(CsrMatrixView const& matrix, uint64_t const* rowGroupIndices, uint64_t startGroup, uint64_t endGroup, double const* x1,
+                                   double const* x2, double const* summand, double* result1, double* result2, uint64_t* choices1, uint64_t* choices2,
+                                   double precision, bool relative) {
+        bool converged = true;
+        // Buffers for the values of the rows of the current group.
+        std::vector<double> rowValues1;
+        std::vector<double> rowValues2;
+        for (uint64_t group = startGroup; group < endGroup; ++group) {
+            uint64_t groupStart = rowGroupIndices[group];
+            uint64_t groupSize = rowGroupIndices[group + 1] - groupStart;
+
+            // Only multiply and reduce if there is at least one row in the group.
+            if (groupSize == 0) {
+                continue;
+            }
+
+            rowValues1.resize(groupSize);
+            rowValues2.resize(groupSize);
+            for (uint64_t i = 0; i < groupSize; ++i) {
+                uint64_t rowStart = matrix.rowIndications[groupStart + i];
+                Operations::dot2(matrix.columns + rowStart, matrix.values + rowStart, matrix.rowIndications[groupStart + i + 1] - rowStart, x1, x2,
+                                 rowValues1[i], rowValues2[i]);
+                if (summand) {
+                    rowValues1[i] += summand[groupStart + i];
+                    rowValues2[i] += summand[groupStart + i];
+                }
+            }
+            result1[group] = groupSize == 1 ? rowValues1[0] : Operations::template reduce<Minimize>(rowValues1.data(), groupSize);
+            result2[group] = groupSize == 1 ? rowValues2[0] : Operations::template reduce<Minimize>(rowValues2.data(), groupSize);
+            if (choices1) {
+                updateChoice<Minimize>(rowValues1, groupSize, result1[group], choices1[group], false);
+            }
+            if (choices2) {
+                updateChoice<Minimize>(rowValues2, groupSize, result2[group], choices2[group], false);
+            }
+            if (converged && !storm::utility::vector::equalModuloPrecision<double>(result1[group], result2[group], precision, relative)) {
+                converged = false;
+            }
+        }
+        return converged;
+    }
+
+   private:
+    static double multiplyRow(CsrMatrixView const& matrix, uint64_t row, double const* x, double const* summand) {
+        uint64_t rowStart = matrix.rowIndications[row];
+        double value = Operations::dot(matrix.columns + rowStart, matrix.values + rowStart, matrix.rowIndications[row + 1] - rowStart, x);
+        return summand ? summand[row] + value : value;
+    }
+
+    template<bool Minimize>
+    static void reduceGroup(CsrMatrixView const& matrix, uint64_t const* rowGroupIndices, uint64_t group, double const* x, double const* summand,
+                            double* result, uint64_t* choices, std::vector<double>& rowValues, bool backwards) {
+        uint64_t groupStart = rowGroupIndices[group];
+        uint64_t groupSize = rowGroupIndices[group + 1] - groupStart;
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupSize == 0) {
+            return;
+        } else if (groupSize == 1) {
+            result[group] = multiplyRow(matrix, groupStart, x, summand);
+            if (choices) {
+                choices[group] = 0;
+            }
+            return;
+        }
+
+        rowValues.resize(groupSize);
+        for (uint64_t i = 0; i < groupSize; ++i) {
+            rowValues[i] = multiplyRow(matrix, groupStart + i, x, summand);
+        }
+        double optimalValue = Operations::template reduce<Minimize>(rowValues.data(), groupSize);
+        result[group] = optimalValue;
+
+        if (choices) {
+            updateChoice<Minimize>(rowValues, groupSize, optimalValue, choices[group], backwards);
+        }
+    }
+
+    template<bool Minimize>
+    static void updateChoice(std::vector<double> const& rowValues, uint64_t groupSize, double optimalValue, uint64_t& choice, bool backwards) {
+        uint64_t selectedChoice = 0;
+        if (backwards) {
+            selectedChoice = groupSize - 1;
+            while (rowValues[selectedChoice] != optimalValue) {
+                --selectedChoice;
+            }
+        } else {
+            while (rowValues[selectedChoice] != optimalValue) {
+                ++selectedChoice;
+            }
+        }
+        // Only update the choice if the new choice is strictly better than the previously selected one.
+        typename std::conditional<Minimize, storm::utility::ElementLess<double>, storm::utility::ElementGreater<double>>::type compare;
+        if (choice >= groupSize || compare(optimalValue, rowValues[choice])) {
+            choice = selectedChoice;
+        }
+    }
+};
+
+#ifdef STORM_SIMD_X86
+__attribute__((target("avx2,fma"), flatten)) void multiplyWithVectorAvx2(CsrMatrixView const& matrix, uint64_t startRow, uint64_t endRow, double const* x,
+                                                                          double const* summand, double* result, bool backwards) {
+    Kernels<Avx2Operations>::multiplyWithVector(matrix, startRow, endRow, x, summand, result, backwards);
+}
+
+__attribute__((target("avx2,fma"), flatten)) void multiplyAndReduceAvx2(CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices,
+                                                                         uint64_t startGroup, uint64_t endGroup, double const* x, double const* summand,
+                                                                         double* result, uint64_t* choices, bool backwards) {
+    if (minimize) {
+        Kernels<Avx2Operations>::multiplyAndReduce<true>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+    } else {
+        Kernels<Avx2Operations>::multiplyAndReduce<false>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+    }
+}
+
+__attribute__((target("avx512f,avx2,fma"), flatten)) void multiplyWithVectorAvx512(CsrMatrixView const& matrix, uint64_t startRow, uint64_t endRow, double const* x,
+                                                                          double const* summand, double* result, bool backwards) {
+    Kernels<Avx512Operations>::multiplyWithVector(matrix, startRow, endRow, x, summand, result, backwards);
+}
+
+__attribute__((target("avx512f,avx2,fma"), flatten)) void multiplyAndReduceAvx512(CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices,
+                                                                         uint64_t startGroup, uint64_t endGroup, double const* x, double const* summand,
+                                                                         double* result, uint64_t* choices, bool backwards) {
+    if (minimize) {
+        Kernels<Avx512Operations>::multiplyAndReduce<true>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+    } else {
+        Kernels<Avx512Operations>::multiplyAndReduce<false>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+    }
+}
+
+__attribute__((target("avx2,fma"), flatten)) bool multiplyAndReduce2Avx2(CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices,
+                                                                          uint64_t startGroup, uint64_t endGroup, double const* x1, double const* x2,
+                                                                          double const* summand, double* result1, double* result2, uint64_t* choices1,
+                                                                          uint64_t* choices2, double precision, bool relative) {
+    if (minimize) {
+        return Kernels<Avx2Operations>::multiplyAndReduce2<true>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2, choices1,
+                                                                 choices2, precision, relative);
+    } else {
+        return Kernels<Avx2Operations>::multiplyAndReduce2<false>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2, choices1,
+                                                                  choices2, precision, relative);
+    }
+}
+
+__attribute__((target("avx512f,avx2,fma"), flatten)) bool multiplyAndReduce2Avx512(CsrMatrixView const& matrix, bool minimize,
+                                                                                    uint64_t const* rowGroupIndices, uint64_t startGroup, uint64_t endGroup,
+                                                                                    double const* x1, double const* x2, double const* summand,
+                                                                                    double* result1, double* result2, uint64_t* choices1,
+                                                                                    uint64_t* choices2, double precision, bool relative) {
+    if (minimize) {
+        return Kernels<Avx512Operations>::multiplyAndReduce2<true>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2,
+                                                                   choices1, choices2, precision, relative);
+    } else {
+        return Kernels<Avx512Operations>::multiplyAndReduce2<false>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2,
+                                                                    choices1, choices2, precision, relative);
+    }
+}
+#endif
+
+}  // namespace
+
+std::string toString(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            return "scalar";
+        case InstructionSet::Avx2:
+            return "AVX2";
+        case InstructionSet::Avx512:
+            return "AVX-512";
+    }
+    return "invalid";
+}
+
+bool isSupported(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            return true;
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case InstructionSet::Avx512:
+            return __builtin_cpu_supports("avx512f") && isSupported(InstructionSet::Avx2);
+#endif
+        default:
+            return false;
+    }
+}
+
+InstructionSet getBestSupportedInstructionSet() {
+    static const InstructionSet best = isSupported(InstructionSet::Avx512) ? InstructionSet::Avx512
+                                       : isSupported(InstructionSet::Avx2) ? InstructionSet::Avx2
+                                                                           : InstructionSet::Scalar;
+    return best;
+}
+
+void multiplyWithVector(InstructionSet instructionSet, CsrMatrixView const& matrix, uint64_t startRow, uint64_t endRow, double const* x,
+                        double const* summand, double* result, bool backwards) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            Kernels<ScalarOperations>::multiplyWithVector(matrix, startRow, endRow, x, summand, result, backwards);
+            return;
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx2:
+            multiplyWithVectorAvx2(matrix, startRow, endRow, x, summand, result, backwards);
+            return;
+        case InstructionSet::Avx512:
+            multiplyWithVectorAvx512(matrix, startRow, endRow, x, summand, result, backwards);
+            return;
+#endif
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Instruction set " << toString(instructionSet) << " is not supported.");
+    }
+}
+
+void multiplyAndReduce(InstructionSet instructionSet, CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices, uint64_t startGroup,
+                       uint64_t endGroup, double const* x, double const* summand, double* result, uint64_t* choices, bool backwards) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            if (minimize) {
+                Kernels<ScalarOperations>::multiplyAndReduce<true>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+            } else {
+                Kernels<ScalarOperations>::multiplyAndReduce<false>(matrix, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+            }
+            return;
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx2:
+            multiplyAndReduceAvx2(matrix, minimize, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+            return;
+        case InstructionSet::Avx512:
+            multiplyAndReduceAvx512(matrix, minimize, rowGroupIndices, startGroup, endGroup, x, summand, result, choices, backwards);
+            return;
+#endif
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Instruction set " << toString(instructionSet) << " is not supported.");
+    }
+}
+
+bool multiplyAndReduce2(InstructionSet instructionSet, CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices, uint64_t startGroup,
+                        uint64_t endGroup, double const* x1, double const* x2, double const* summand, double* result1, double* result2, uint64_t* choices1,
+                        uint64_t* choices2, double precision, bool relative) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            if (minimize) {
+                return Kernels<ScalarOperations>::multiplyAndReduce2<true>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2,
+                                                                           choices1, choices2, precision, relative);
+            } else {
+                return Kernels<ScalarOperations>::multiplyAndReduce2<false>(matrix, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2,
+                                                                            choices1, choices2, precision, relative);
+            }
+#ifdef STORM_SIMD_X86
+        case InstructionSet::Avx2:
+            return multiplyAndReduce2Avx2(matrix, minimize, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2, choices1, choices2,
+                                          precision, relative);
+        case InstructionSet::Avx512:
+            return multiplyAndReduce2Avx512(matrix, minimize, rowGroupIndices, startGroup, endGroup, x1, x2, summand, result1, result2, choices1, choices2,
+                                            precision, relative);
+#endif
+        default:
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Instruction set " << toString(instructionSet) << " is not supported.");
+    }
+    return false;
+}
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+/*!
+ * The instruction sets for which vectorized kernels are available.
+ */
+enum class InstructionSet { Scalar, Avx2, Avx512 };
+
+std::string toString(InstructionSet instructionSet);
+
+/*!
+ * Retrieves whether the CPU we are running on supports the given instruction set (and Storm was compiled with
+ * kernels for it).
+ */
+bool isSupported(InstructionSet instructionSet);
+
+/*!
+ * Retrieves the most powerful instruction set supported by the CPU we are running on.
+ */
+InstructionSet getBestSupportedInstructionSet();
+
+/*!
+ * A view on a (double-valued) matrix in compressed row storage with separate column and value arrays, as provided
+ * by a CompactSparseMatrix<double, uint32_t>. As the vectorized kernels gather with signed 32-bit offsets, all column
+ * indices must be at most INT32_MAX.
+ */
+struct CsrMatrixView {
+    uint64_t const* rowIndications;
+    uint32_t const* columns;
+    double const* values;
+};
+
+/*!
+ * Computes result[row] = A[row] * x + summand[row] for all rows in [startRow, endRow). Rows are processed in
+ * ascending order (or descending order if backwards is set). If x and result are the same, this performs a
+ * Gauss-Seidel sweep.
+ *
+ * As the entries of a row are summed up in a different order than in the scalar kernels, the results may differ
+ * in the last bits.
+ *
+ * @param summand If non-null, the summand is added to the result.
+ */
+void multiplyWithVector(InstructionSet instructionSet, CsrMatrixView const& matrix, uint64_t startRow, uint64_t endRow, double const* x,
+                        double const* summand, double* result, bool backwards = false);
+
+/*!
+ * Computes the (summand-augmented) products of the rows with x and writes the minimum (or maximum) over the rows of
+ * each row group in [startGroup, endGroup) to result. Row groups are processed in ascending order (or descending
+ * order if backwards is set). Groups without rows are skipped. If x and result are the same, this performs a
+ * Gauss-Seidel sweep.
+ *
+ * If choices is given, the choice of a group is only updated if the optimal row is strictly better than the row
+ * that was previously selected. Among several optimal rows, the first one (or last one if backwards is set) is
+ * selected, which matches SparseMatrix::multiplyAndReduceForward (and Backward).
+ */
+void multiplyAndReduce(InstructionSet instructionSet, CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices, uint64_t startGroup,
+                       uint64_t endGroup, double const* x, double const* summand, double* result, uint64_t* choices, bool backwards = false);
+
+/*!
+ * Like multiplyAndReduce (in ascending order), but computes the products of each row with the two vectors x1 and x2 at once, such that the matrix
+ * is only traversed once. The results must not be the same as x1 or x2.
+ *
+ * @return True iff result1 and result2 are equal up to the given precision in all groups in [startGroup, endGroup), see
+ * storm::utility::vector::equalModuloPrecision.
+ */
+bool multiplyAndReduce2(InstructionSet instructionSet, CsrMatrixView const& matrix, bool minimize, uint64_t const* rowGroupIndices, uint64_t startGroup,
+                        uint64_t endGroup, double const* x1, double const* x2, double const* summand, double* result1, double* result2, uint64_t* choices1,
+                        uint64_t* choices2, double precision, bool relative);
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,178 @@
+#include "SimdMultiplier.h"
+
+#include <limits>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+simd::CsrMatrixView getMatrixView(storm::storage::CompactSparseMatrix<double, uint32_t> const& matrix) {
+    return {matrix.getRowIndications().data(), matrix.getColumns().data(), matrix.getValues().data()};
+}
+}  // namespace
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : CompactMultiplier<ValueType>(matrix), instructionSet(simd::InstructionSet::Scalar) {
+    STORM_LOG_WARN("Vectorized multiplication is only supported for double values, using the compact multiplier instead.");
+}
+
+template<>
+SimdMultiplier<double>::SimdMultiplier(storm::storage::SparseMatrix<double> const& matrix)
+    : CompactMultiplier<double>(matrix), instructionSet(simd::getBestSupportedInstructionSet()) {
+    STORM_LOG_WARN_COND(instructionSet != simd::InstructionSet::Scalar,
+                        "The CPU does not support AVX2, using the compact multiplier without vectorization instead.");
+    if (instructionSet != simd::InstructionSet::Scalar && !isApplicable(matrix)) {
+        STORM_LOG_WARN("The matrix has too many columns for vectorized multiplication, using the compact multiplier without vectorization instead.");
+        instructionSet = simd::InstructionSet::Scalar;
+    }
+    STORM_LOG_TRACE("Using " << simd::toString(instructionSet) << " kernels for matrix-vector multiplication.");
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+}
+
+template<typename ValueType>
+simd::InstructionSet SimdMultiplier<ValueType>::getInstructionSet() const {
+    return instructionSet;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    CompactMultiplier<ValueType>::multiply(env, x, b, result);
+}
+
+template<>
+void SimdMultiplier<double>::multiply(Environment const& env, std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result) const {
+    if (instructionSet == simd::InstructionSet::Scalar) {
+        CompactMultiplier<double>::multiply(env, x, b, result);
+        return;
+    }
+    this->initialize();
+    std::vector<double>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<double>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    simd::multiplyWithVector(instructionSet, getMatrixView(*this->compactMatrix), 0, this->compactMatrix->getRowCount(), x.data(), b ? b->data() : nullptr,
+                             target->data());
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+    CompactMultiplier<ValueType>::multiplyGaussSeidel(env, x, b, backwards);
+}
+
+template<>
+void SimdMultiplier<double>::multiplyGaussSeidel(Environment const& env, std::vector<double>& x, std::vector<double> const* b, bool backwards) const {
+    if (instructionSet == simd::InstructionSet::Scalar) {
+        CompactMultiplier<double>::multiplyGaussSeidel(env, x, b, backwards);
+        return;
+    }
+    this->initialize();
+    simd::multiplyWithVector(instructionSet, getMatrixView(*this->compactMatrix), 0, this->compactMatrix->getRowCount(), x.data(), b ? b->data() : nullptr,
+                             x.data(), backwards);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    CompactMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+}
+
+template<>
+void SimdMultiplier<double>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                               std::vector<double> const& x, std::vector<double> const* b, std::vector<double>& result,
+                                               std::vector<uint_fast64_t>* choices) const {
+    if (instructionSet == simd::InstructionSet::Scalar) {
+        CompactMultiplier<double>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+        return;
+    }
+    this->initialize();
+    std::vector<double>* target = &result;
+    if (&x == &result) {
+        if (this->cachedVector) {
+            this->cachedVector->resize(x.size());
+        } else {
+            this->cachedVector = std::make_unique<std::vector<double>>(x.size());
+        }
+        target = this->cachedVector.get();
+    }
+    simd::multiplyAndReduce(instructionSet, getMatrixView(*this->compactMatrix), minimize(dir), rowGroupIndices.data(), 0, rowGroupIndices.size() - 1,
+                            x.data(), b ? b->data() : nullptr, target->data(), choices ? choices->data() : nullptr);
+    if (&x == &result) {
+        std::swap(result, *this->cachedVector);
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir,
+                                                             std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x,
+                                                             std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+    CompactMultiplier<ValueType>::multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+}
+
+template<>
+void SimdMultiplier<double>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                          std::vector<double>& x, std::vector<double> const* b, std::vector<uint_fast64_t>* choices,
+                                                          bool backwards) const {
+    if (instructionSet == simd::InstructionSet::Scalar) {
+        CompactMultiplier<double>::multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices, backwards);
+        return;
+    }
+    this->initialize();
+    simd::multiplyAndReduce(instructionSet, getMatrixView(*this->compactMatrix), minimize(dir), rowGroupIndices.data(), 0, rowGroupIndices.size() - 1,
+                            x.data(), b ? b->data() : nullptr, x.data(), choices ? choices->data() : nullptr, backwards);
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                   std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                                   std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                                   std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+    return CompactMultiplier<ValueType>::multiplyAndReduce2(env, dir, rowGroupIndices, x1, x2, b, result1, result2, precision, relative, choices1, choices2);
+}
+
+template<>
+bool SimdMultiplier<double>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                std::vector<double> const& x1, std::vector<double> const& x2, std::vector<double> const* b,
+                                                std::vector<double>& result1, std::vector<double>& result2, double const& precision, bool relative,
+                                                std::vector<uint_fast64_t>* choices1, std::vector<uint_fast64_t>* choices2) const {
+    if (instructionSet == simd::InstructionSet::Scalar) {
+        return CompactMultiplier<double>::multiplyAndReduce2(env, dir, rowGroupIndices, x1, x2, b, result1, result2, precision, relative, choices1, choices2);
+    }
+    STORM_LOG_ASSERT(&x1 != &result1 && &x1 != &result2 && &x2 != &result1 && &x2 != &result2, "Vectors are aliased but are not allowed to be.");
+    this->initialize();
+    return simd::multiplyAndReduce2(instructionSet, getMatrixView(*this->compactMatrix), minimize(dir), rowGroupIndices.data(), 0, rowGroupIndices.size() - 1,
+                                    x1.data(), x2.data(), b ? b->data() : nullptr, result1.data(), result2.data(), choices1 ? choices1->data() : nullptr,
+                                    choices2 ? choices2->data() : nullptr, precision, relative);
+}
+
+template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SimdMultiplier<storm::RationalNumber>;
+template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "storm/solver/multiplier/CompactMultiplier.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A multiplier that uses vectorized (AVX2 or AVX-512) kernels on the compact representation of the matrix. The
+ * instruction set is selected at runtime based on the capabilities of the CPU. Vectorized kernels are only
+ * available for double, for all other value types (and on CPUs without support for AVX2), this multiplier
+ * behaves like the CompactMultiplier.
+ *
+ * The gather instructions of the kernels interpret the column indices as signed 32-bit offsets, so the kernels are
+ * only used for matrices with at most INT32_MAX columns (see isApplicable).
+ */
+template<typename ValueType>
+class SimdMultiplier : public CompactMultiplier<ValueType> {
+   public:
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SimdMultiplier() = default;
+
+    /*!
+     * Retrieves whether the vectorized kernels can be applied to the given matrix, i.e., whether all column indices
+     * fit into a signed 32-bit integer.
+     */
+    static bool isApplicable(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+    virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                              std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr,
+                                              bool backwards = true) const override;
+    virtual bool multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                    std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b,
+                                    std::vector<ValueType>& result1, std::vector<ValueType>& result2, ValueType const& precision, bool relative,
+                                    std::vector<uint_fast64_t>* choices1 = nullptr, std::vector<uint_fast64_t>* choices2 = nullptr) const override;
+
+    /*!
+     * Retrieves the instruction set used by this multiplier.
+     */
+    simd::InstructionSet getInstructionSet() const;
+
+   private:
+    // The instruction set used by this multiplier.
+    simd::InstructionSet instructionSet;
+};
+
+}  // namespace solver
+}  // namespace storm
@@ -1,5 +1,9 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <iterator>
+#include <type_traits>
+
+#include "storm/utility/RationalFunctionOperationCache.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -12,11 +16,39 @@ namespace stateelimination {
 
 using namespace storm::utility::stateelimination;
 
+namespace {
+template<typename ValueType>
+ValueType multiplyAndSimplify(ValueType const& first, ValueType const& second, storm::utility::RationalFunctionOperationCache*) {
+    return storm::utility::simplify((ValueType)(first * second));
+}
+
+template<typename ValueType>
+ValueType addAndSimplify(ValueType const& first, ValueType const& second, storm::utility::RationalFunctionOperationCache*) {
+    return storm::utility::simplify((ValueType)(first + second));
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+storm::RationalFunction multiplyAndSimplify(storm::RationalFunction const& first, storm::RationalFunction const& second,
+                                            storm::utility::RationalFunctionOperationCache* cache) {
+    return cache ? cache->multiply(first, second) : storm::utility::simplify((storm::RationalFunction)(first * second));
+}
+
+template<>
+storm::RationalFunction addAndSimplify(storm::RationalFunction const& first, storm::RationalFunction const& second,
+                                       storm::utility::RationalFunctionOperationCache* cache) {
+    return cache ? cache->add(first, second) : storm::utility::simplify((storm::RationalFunction)(first + second));
+}
+#endif
+}  // namespace
+
 template<typename ValueType, ScalingMode Mode>
 EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix)
     : matrix(matrix), transposedMatrix(transposedMatrix) {
-    // Intentionally left empty.
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        operationCache = storm::utility::RationalFunctionOperationCache::getGlobalCache();
+    }
 }
 
 template<typename ValueType, ScalingMode Mode>
@@ -61,7 +93,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(multiplyAndSimplify(entryIt->getValue(), columnValue, operationCache.get()));
             }
         }
         updateValue(row, columnValue);
@@ -123,9 +155,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
-        newSuccessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+        rowBuffer.clear();
+        rowBuffer.reserve((last1 - first1) + (last2 - first2));
+        std::insert_iterator<FlexibleRowType> result(rowBuffer, rowBuffer.end());
 
         uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
         // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -150,7 +182,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                FlexibleEntryType successorEntry(first2->getColumn(), multiplyAndSimplify(first2->getValue(), multiplyFactor, operationCache.get()));
                 *result = successorEntry;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
                 ++first2;
@@ -159,9 +191,8 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                ValueType probability = addAndSimplify(first1->getValue(), multiplyAndSimplify(multiplyFactor, first2->getValue(), operationCache.get()),
+                                                       operationCache.get());
                 *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
                                                       typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
@@ -172,15 +203,15 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                FlexibleEntryType stateProbability(first2->getColumn(), multiplyAndSimplify(first2->getValue(), multiplyFactor, operationCache.get()));
                 *result = stateProbability;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
                 ++successorOffsetInNewBackwardTransitions;
             }
         }
 
-        // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        // Now move the new transitions in place. This reuses the memory of the row if it suffices.
+        predecessorForwardTransitions.assign(std::make_move_iterator(rowBuffer.begin()), std::make_move_iterator(rowBuffer.end()));
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -217,9 +248,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
-        newPredecessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+        rowBuffer.clear();
+        rowBuffer.reserve((last1 - first1) + (last2 - first2));
+        std::insert_iterator<FlexibleRowType> result(rowBuffer, rowBuffer.end());
 
         for (; first1 != last1; ++result) {
             if (first2 == last2) {
@@ -258,7 +289,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                          });
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        successorBackwardTransitions.assign(std::make_move_iterator(rowBuffer.begin()), std::make_move_iterator(rowBuffer.end()));
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -311,7 +342,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Scale the entries in a different column, set state transition probability to 0.
             if (entryIt->getColumn() != state) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(multiplyAndSimplify(entryIt->getValue(), columnValue, operationCache.get()));
             } else {
                 entryIt->setValue(storm::utility::zero<ValueType>());
             }
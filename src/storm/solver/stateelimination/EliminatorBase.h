@@ -1,10 +1,16 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
 namespace storm {
+namespace utility {
+class RationalFunctionOperationCache;
+}
+
 namespace solver {
 namespace stateelimination {
 
@@ -15,6 +21,7 @@ class EliminatorBase {
    public:
     typedef typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type FlexibleRowType;
     typedef typename FlexibleRowType::iterator FlexibleRowIterator;
+    typedef typename FlexibleRowType::value_type FlexibleEntryType;
 
     EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix);
     virtual ~EliminatorBase() = default;
@@ -34,6 +41,14 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    // A buffer in which modified rows are assembled. It is reused for all rows to avoid allocating memory for every
+    // modification.
+    FlexibleRowType rowBuffer;
+
+    // The cache for the operations on rational functions that is shared among all parametric computations (if any).
+    std::shared_ptr<storm::utility::RationalFunctionOperationCache> operationCache;
 };
 
 }  // namespace stateelimination
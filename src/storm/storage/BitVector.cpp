@@ -4,18 +4,171 @@
 
 #include "storm/storage/BitVector.h"
 
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/storage/BoostTypes.h"
 #include "storm/utility/Hash.h"
 #include "storm/utility/OsDetection.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
 
 #ifdef STORM_DEV
 #define ASSERT_BITVECTOR
 #endif
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_BITVECTOR_AVX2
+#include <immintrin.h>
+#endif
+
 namespace storm {
 namespace storage {
 
+namespace {
+
+/*
+ * The bulk operations on the buckets. As for the SIMD kernels of the multipliers, the AVX2 versions are compiled for
+ * their target only and selected at runtime, so Storm still runs on CPUs without AVX2.
+ */
+uint64_t popcountWord(uint64_t word) {
+#if (defined(__GNUG__) || defined(__clang__))
+    return __builtin_popcountll(word);
+#else
+    uint64_t result = 0;
+    for (; word; ++result) {
+        word &= word - 1;
+    }
+    return result;
+#endif
+}
+
+struct AndOperation {
+    static uint64_t apply(uint64_t a, uint64_t b) {
+        return a & b;
+    }
+#ifdef STORM_BITVECTOR_AVX2
+    __attribute__((target("avx2"))) static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_and_si256(a, b);
+    }
+#endif
+};
+
+struct OrOperation {
+    static uint64_t apply(uint64_t a, uint64_t b) {
+        return a | b;
+    }
+#ifdef STORM_BITVECTOR_AVX2
+    __attribute__((target("avx2"))) static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_or_si256(a, b);
+    }
+#endif
+};
+
+struct XorOperation {
+    static uint64_t apply(uint64_t a, uint64_t b) {
+        return a ^ b;
+    }
+#ifdef STORM_BITVECTOR_AVX2
+    __attribute__((target("avx2"))) static __m256i apply(__m256i a, __m256i b) {
+        return _mm256_xor_si256(a, b);
+    }
+#endif
+};
+
+#ifdef STORM_BITVECTOR_AVX2
+bool hasAvx2() {
+    static const bool result = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return result;
+}
+
+template<typename Operation>
+__attribute__((target("avx2"))) void transformWordsAvx2(uint64_t const* first, uint64_t const* second, uint64_t* result, uint64_t numberOfWords) {
+    uint64_t i = 0;
+    for (; i + 4 <= numberOfWords; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(second + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), Operation::apply(a, b));
+    }
+    for (; i < numberOfWords; ++i) {
+        result[i] = Operation::apply(first[i], second[i]);
+    }
+}
+
+__attribute__((target("avx2"))) void complementWordsAvx2(uint64_t const* words, uint64_t* result, uint64_t numberOfWords) {
+    __m256i const ones = _mm256_set1_epi64x(-1ll);
+    uint64_t i = 0;
+    for (; i + 4 <= numberOfWords; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(words + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), _mm256_xor_si256(a, ones));
+    }
+    for (; i < numberOfWords; ++i) {
+        result[i] = ~words[i];
+    }
+}
+
+// Counts the set bits by looking up the counts of the nibbles of each byte (Mula et al., "Faster population counts
+// using AVX2 instructions").
+__attribute__((target("avx2,popcnt"))) uint64_t popcountAvx2(uint64_t const* words, uint64_t numberOfWords) {
+    __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const lowMask = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    uint64_t i = 0;
+    for (; i + 4 <= numberOfWords; i += 4) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(words + i));
+        __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(a, lowMask));
+        __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(a, 4), lowMask));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+    uint64_t result = static_cast<uint64_t>(_mm256_extract_epi64(total, 0)) + static_cast<uint64_t>(_mm256_extract_epi64(total, 1)) +
+                      static_cast<uint64_t>(_mm256_extract_epi64(total, 2)) + static_cast<uint64_t>(_mm256_extract_epi64(total, 3));
+    for (; i < numberOfWords; ++i) {
+        result += __builtin_popcountll(words[i]);
+    }
+    return result;
+}
+#endif
+
+// Applies the given operation to the given words. The result may coincide with one of the inputs.
+template<typename Operation>
+void transformWords(uint64_t const* first, uint64_t const* second, uint64_t* result, uint64_t numberOfWords) {
+#ifdef STORM_BITVECTOR_AVX2
+    if (hasAvx2()) {
+        transformWordsAvx2<Operation>(first, second, result, numberOfWords);
+        return;
+    }
+#endif
+    for (uint64_t i = 0; i < numberOfWords; ++i) {
+        result[i] = Operation::apply(first[i], second[i]);
+    }
+}
+
+void complementWords(uint64_t const* words, uint64_t* result, uint64_t numberOfWords) {
+#ifdef STORM_BITVECTOR_AVX2
+    if (hasAvx2()) {
+        complementWordsAvx2(words, result, numberOfWords);
+        return;
+    }
+#endif
+    for (uint64_t i = 0; i < numberOfWords; ++i) {
+        result[i] = ~words[i];
+    }
+}
+
+uint64_t popcountWords(uint64_t const* words, uint64_t numberOfWords) {
+#ifdef STORM_BITVECTOR_AVX2
+    // The lookup only pays off for longer ranges.
+    if (numberOfWords >= 16 && hasAvx2()) {
+        return popcountAvx2(words, numberOfWords);
+    }
+#endif
+    uint64_t result = 0;
+    for (uint64_t i = 0; i < numberOfWords; ++i) {
+        result += popcountWord(words[i]);
+    }
+    return result;
+}
+
+}  // namespace
+
 BitVector::const_iterator::const_iterator(uint64_t const* dataPtr, uint_fast64_t startIndex, uint_fast64_t endIndex, bool setOnFirstBit)
     : dataPtr(dataPtr), endIndex(endIndex) {
     if (setOnFirstBit) {
@@ -83,6 +236,7 @@ BitVector::BitVector(uint_fast64_t length, bool init) : bitCount(length), bucket
     } else {
         buckets = new uint64_t[bucketCount]();
     }
+    storm::utility::memory::adviseMemory(buckets, bucketCount * sizeof(uint64_t));
 }
 
 BitVector::~BitVector() {
@@ -295,38 +449,33 @@ void BitVector::grow(uint_fast64_t minimumLength, bool init) {
 BitVector BitVector::operator&(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    transformWords<AndOperation>(this->buckets, other.buckets, result.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator&=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a & b; });
+    transformWords<AndOperation>(this->buckets, other.buckets, this->buckets, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator|(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    transformWords<OrOperation>(this->buckets, other.buckets, result.buckets, this->bucketCount());
     return result;
 }
 
 BitVector& BitVector::operator|=(BitVector const& other) {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, this->buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a | b; });
+    transformWords<OrOperation>(this->buckets, other.buckets, this->buckets, this->bucketCount());
     return *this;
 }
 
 BitVector BitVector::operator^(BitVector const& other) const {
     STORM_LOG_ASSERT(bitCount == other.bitCount, "Length of the bit vectors does not match.");
     BitVector result(bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), other.buckets, result.buckets,
-                   [](uint64_t const& a, uint64_t const& b) { return a ^ b; });
+    transformWords<XorOperation>(this->buckets, other.buckets, result.buckets, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
@@ -347,11 +496,12 @@ BitVector BitVector::operator%(BitVector const& filter) const {
             ++position;
         }
     } else {
-        // If the given bit vector had much fewer elements, we iterate over its elements and accept calling the
-        // more costly operation getNumberOfSetBitsBeforeIndex on the current bit vector.
+        // If the given bit vector had much fewer elements, we iterate over its elements and translate them with a
+        // rank index over the filter.
+        BitVectorRankIndex filterIndex(filter);
         for (auto bit : (*this)) {
             if (filter[bit]) {
-                result.set(filter.getNumberOfSetBitsBeforeIndex(bit));
+                result.set(filterIndex.rank(bit));
             }
         }
     }
@@ -361,13 +511,13 @@ BitVector BitVector::operator%(BitVector const& filter) const {
 
 BitVector BitVector::operator~() const {
     BitVector result(this->bitCount);
-    std::transform(this->buckets, this->buckets + this->bucketCount(), result.buckets, [](uint64_t const& a) { return ~a; });
+    complementWords(this->buckets, result.buckets, this->bucketCount());
     result.truncateLastBucket();
     return result;
 }
 
 void BitVector::complement() {
-    std::transform(this->buckets, this->buckets + this->bucketCount(), this->buckets, [](uint64_t const& a) { return ~a; });
+    complementWords(this->buckets, this->buckets, this->bucketCount());
     truncateLastBucket();
 }
 
@@ -634,44 +784,16 @@ uint_fast64_t BitVector::getNumberOfSetBits() const {
 }
 
 uint_fast64_t BitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
-    uint_fast64_t result = 0;
-
     // First, count all full buckets.
     uint_fast64_t bucket = index >> 6;
-    for (uint_fast64_t i = 0; i < bucket; ++i) {
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(buckets[i]);
-#elif defined WINDOWS
-#include <nmmintrin.h>
-        // If the target machine does not support SSE4, this will fail.
-        result += _mm_popcnt_u64(bucketVector[i]);
-#else
-        uint_fast32_t cnt;
-        uint_fast64_t bitset = buckets[i];
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
-    }
+    uint_fast64_t result = popcountWords(buckets, bucket);
 
     // Now check if we have to count part of a bucket.
     uint64_t tmp = index & mod64mask;
     if (tmp != 0) {
         tmp = ~((1ll << (64 - (tmp & mod64mask))) - 1ll);
         tmp &= buckets[bucket];
-        // Check if we are using g++ or clang++ and, if so, use the built-in function
-#if (defined(__GNUG__) || defined(__clang__))
-        result += __builtin_popcountll(tmp);
-#else
-        uint_fast32_t cnt;
-        uint64_t bitset = tmp;
-        for (cnt = 0; bitset; cnt++) {
-            bitset &= bitset - 1;
-        }
-        result += cnt;
-#endif
+        result += popcountWord(tmp);
     }
 
     return result;
@@ -1323,6 +1445,17 @@ BitVector BitVector::load(std::string const& description) {
     return bv;
 }
 
+uint64_t const* BitVector::getWords() const {
+    return buckets;
+}
+
+BitVector BitVector::fromWords(uint_fast64_t length, uint64_t const* words) {
+    BitVector result(length);
+    std::copy_n(words, result.bucketCount(), result.buckets);
+    result.truncateLastBucket();
+    return result;
+}
+
 // All necessary explicit template instantiations.
 template BitVector::BitVector(uint_fast64_t length, std::vector<uint_fast64_t>::iterator begin, std::vector<uint_fast64_t>::iterator end);
 template BitVector::BitVector(uint_fast64_t length, std::vector<uint_fast64_t>::const_iterator begin, std::vector<uint_fast64_t>::const_iterator end);
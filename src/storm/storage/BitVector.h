@@ -548,6 +548,20 @@ class BitVector {
     void store(std::ostream&) const;
     static BitVector load(std::string const& description);
 
+    /*!
+     * Retrieves the underlying storage of this bit vector, which consists of (size() + 63) / 64 words. The bit with
+     * index i is stored in word i / 64, where lower indices correspond to more significant bits.
+     */
+    uint64_t const* getWords() const;
+
+    /*!
+     * Creates a bit vector of the given length from the given words (in the layout returned by getWords()).
+     *
+     * @param length The number of bits of the bit vector.
+     * @param words The (length + 63) / 64 words that hold the bits.
+     */
+    static BitVector fromWords(uint_fast64_t length, uint64_t const* words);
+
     friend struct std::hash<storm::storage::BitVector>;
     friend struct FNV1aBitVectorHash;
 
@@ -15,12 +15,12 @@ BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::BitVectorHashMapIte
 }
 
 template<class ValueType, class Hash>
-bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator==(BitVectorHashMapIterator const& other) {
+bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator==(BitVectorHashMapIterator const& other) const {
     return &map == &other.map && *indexIt == *other.indexIt;
 }
 
 template<class ValueType, class Hash>
-bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator!=(BitVectorHashMapIterator const& other) {
+bool BitVectorHashMap<ValueType, Hash>::BitVectorHashMapIterator::operator!=(BitVectorHashMapIterator const& other) const {
     return !(*this == other);
 }
 
@@ -72,6 +72,12 @@ uint64_t BitVectorHashMap<ValueType, Hash>::capacity() const {
     return 1ull << currentSize;
 }
 
+template<class ValueType, class Hash>
+uint64_t BitVectorHashMap<ValueType, Hash>::getSizeInMemory() const {
+    return sizeof(*this) + buckets.getSizeInBytes() + occupied.getSizeInBytes() - 2 * sizeof(storm::storage::BitVector) +
+           values.capacity() * sizeof(ValueType);
+}
+
 template<class ValueType, class Hash>
 void BitVectorHashMap<ValueType, Hash>::increaseSize() {
     ++currentSize;
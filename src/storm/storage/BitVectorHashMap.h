@@ -29,8 +29,8 @@ class BitVectorHashMap {
         BitVectorHashMapIterator(BitVectorHashMap const& map, BitVector::const_iterator indexIt);
 
         // Methods to compare two iterators.
-        bool operator==(BitVectorHashMapIterator const& other);
-        bool operator!=(BitVectorHashMapIterator const& other);
+        bool operator==(BitVectorHashMapIterator const& other) const;
+        bool operator!=(BitVectorHashMapIterator const& other) const;
 
         // Methods to move iterator forward.
         BitVectorHashMapIterator& operator++(int);
@@ -145,6 +145,11 @@ class BitVectorHashMap {
      */
     uint64_t capacity() const;
 
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by the map.
+     */
+    uint64_t getSizeInMemory() const;
+
     /*!
      * Performs a remapping of all values stored by applying the given remapping.
      *
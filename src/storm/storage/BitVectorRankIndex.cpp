@@ -0,0 +1,66 @@
+#include "storm/storage/BitVectorRankIndex.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+BitVectorRankIndex::BitVectorRankIndex(BitVector const& bitVector) : bitVector(bitVector) {
+    uint64_t const numberOfWords = (bitVector.size() + 63) / 64;
+    uint64_t const* words = bitVector.getWords();
+    setBitsBeforeBlock.reserve((numberOfWords + wordsPerBlock - 1) / wordsPerBlock + 1);
+    uint64_t count = 0;
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        if (word % wordsPerBlock == 0) {
+            setBitsBeforeBlock.push_back(count);
+        }
+        count += __builtin_popcountll(words[word]);
+    }
+    setBitsBeforeBlock.push_back(count);
+}
+
+uint64_t BitVectorRankIndex::rank(uint64_t index) const {
+    STORM_LOG_ASSERT(index <= bitVector.size(), "Index " << index << " out of range.");
+    uint64_t const* words = bitVector.getWords();
+    uint64_t const lastWord = index >> 6;
+    uint64_t word = lastWord - lastWord % wordsPerBlock;
+    uint64_t result = setBitsBeforeBlock[word / wordsPerBlock];
+    for (; word < lastWord; ++word) {
+        result += __builtin_popcountll(words[word]);
+    }
+    if ((index & 63) != 0) {
+        result += __builtin_popcountll(words[lastWord] & ~(~0ull >> (index & 63)));
+    }
+    return result;
+}
+
+uint64_t BitVectorRankIndex::select(uint64_t rank) const {
+    if (rank >= getNumberOfSetBits()) {
+        return bitVector.size();
+    }
+    // Find the last block that has at most the given number of set bits before it.
+    uint64_t block = std::upper_bound(setBitsBeforeBlock.begin(), setBitsBeforeBlock.end(), rank) - setBitsBeforeBlock.begin() - 1;
+    uint64_t remaining = rank - setBitsBeforeBlock[block];
+    uint64_t const* words = bitVector.getWords();
+    for (uint64_t word = block * wordsPerBlock;; ++word) {
+        uint64_t bits = words[word];
+        uint64_t count = __builtin_popcountll(bits);
+        if (remaining < count) {
+            // Remove the leading set bits (which belong to smaller indices) until the requested one is the first.
+            for (; remaining > 0; --remaining) {
+                bits &= ~(1ull << (63 - __builtin_clzll(bits)));
+            }
+            return word * 64 + __builtin_clzll(bits);
+        }
+        remaining -= count;
+    }
+}
+
+uint64_t BitVectorRankIndex::getNumberOfSetBits() const {
+    return setBitsBeforeBlock.back();
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * An index over a bit vector that answers rank queries (how many bits are set before a given index) in constant time
+ * and select queries (at which index is the i-th set bit) in logarithmic time. It stores the number of set bits before
+ * every block of 512 bits, i.e., it takes an eighth of the memory of the bit vector, whereas
+ * BitVector::getNumberOfSetBitsBeforeIndices takes 64 bits per index.
+ *
+ * The index refers to the given bit vector, which must neither be modified nor destroyed while the index is in use.
+ */
+class BitVectorRankIndex {
+   public:
+    explicit BitVectorRankIndex(BitVector const& bitVector);
+
+    /*!
+     * Retrieves the number of bits set in the bit vector with an index strictly smaller than the given one. This
+     * coincides with BitVector::getNumberOfSetBitsBeforeIndex.
+     *
+     * @param index An index of at most the size of the bit vector.
+     */
+    uint64_t rank(uint64_t index) const;
+
+    /*!
+     * Retrieves the index of the set bit that has the given number of set bits before it, i.e., the inverse of rank on
+     * the set bits. If there are not enough set bits, the size of the bit vector is returned.
+     */
+    uint64_t select(uint64_t rank) const;
+
+    uint64_t getNumberOfSetBits() const;
+
+   private:
+    // The number of bits per block.
+    static constexpr uint64_t wordsPerBlock = 8;
+
+    BitVector const& bitVector;
+
+    // The number of bits set before each block followed by the total number of set bits.
+    std::vector<uint64_t> setBitsBeforeBlock;
+};
+
+}  // namespace storage
+}  // namespace storm
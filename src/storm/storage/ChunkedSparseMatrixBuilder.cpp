@@ -0,0 +1,216 @@
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+ChunkedSparseMatrixBuilder<ValueType>::ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping, index_type entriesPerBlock)
+    : hasCustomRowGrouping(hasCustomRowGrouping), entriesPerBlock(entriesPerBlock), numberOfEntries(0), highestColumn(0) {
+    STORM_LOG_THROW(entriesPerBlock > 0, storm::exceptions::InvalidArgumentException, "The blocks of a matrix need to hold at least one entry.");
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, value_type const& value) {
+    // Check that we did not move backwards wrt. the row. Rows are only started by adding an entry, so the last started row is the current one.
+    STORM_LOG_THROW(row + 1 >= rowIndications.size(), storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but an element in row " << (rowIndications.size() - 1) << " has already been added.");
+    // The rows that were moved into the blocks (through appending or replacing columns) can not be extended.
+    STORM_LOG_THROW(row >= rowIndications.size() || !currentRow.empty(), storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but the row was already finished.");
+
+    if (row >= rowIndications.size()) {
+        finishCurrentRow();
+        // Start all rows up to the given one.
+        rowIndications.resize(row + 1, numberOfEntries);
+    }
+    currentRow.emplace_back(column, value);
+    highestColumn = std::max(highestColumn, column);
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::finishCurrentRow() {
+    if (currentRow.empty()) {
+        return;
+    }
+
+    // Sort the entries of the row and sum up the ones with the same column.
+    std::stable_sort(currentRow.begin(), currentRow.end(), [](Entry const& a, Entry const& b) { return a.getColumn() < b.getColumn(); });
+    auto last = currentRow.begin();
+    for (auto it = currentRow.begin() + 1; it != currentRow.end(); ++it) {
+        if (it->getColumn() == last->getColumn()) {
+            last->setValue(last->getValue() + it->getValue());
+        } else {
+            *(++last) = std::move(*it);
+        }
+    }
+    currentRow.erase(last + 1, currentRow.end());
+
+    // Start a new block if the row does not fit into the current one.
+    if (blocks.empty() || blocks.back().size() + currentRow.size() > blocks.back().capacity()) {
+        blocks.emplace_back();
+        blocks.back().reserve(std::max<index_type>(entriesPerBlock, currentRow.size()));
+        blockStarts.push_back(numberOfEntries);
+    }
+    std::move(currentRow.begin(), currentRow.end(), std::back_inserter(blocks.back()));
+    numberOfEntries += currentRow.size();
+    currentRow.clear();
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+    STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidArgumentException, "Matrix was not created to have a custom row grouping.");
+    STORM_LOG_THROW(rowGroupIndices.empty() || startingRow >= rowGroupIndices.back(), storm::exceptions::InvalidArgumentException,
+                    "Illegal row group with negative size.");
+    STORM_LOG_THROW(startingRow >= rowIndications.size(), storm::exceptions::InvalidArgumentException,
+                    "Row group starts at row " << startingRow << ", but row " << (rowIndications.size() - 1) << " already has entries.");
+    rowGroupIndices.push_back(startingRow);
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getCurrentRowCount() const {
+    index_type rowCount = rowIndications.size();
+    if (hasCustomRowGrouping && !rowGroupIndices.empty()) {
+        rowCount = std::max(rowCount, rowGroupIndices.back() + 1);
+    }
+    return rowCount;
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::append(ChunkedSparseMatrixBuilder&& part) {
+    STORM_LOG_THROW(hasCustomRowGrouping == part.hasCustomRowGrouping, storm::exceptions::InvalidArgumentException,
+                    "Only matrices that agree on having a custom row grouping can be appended.");
+    finishCurrentRow();
+    part.finishCurrentRow();
+
+    // Pad the rows such that the rows of the part start at the right position.
+    index_type rowOffset = getCurrentRowCount();
+    rowIndications.resize(rowOffset, numberOfEntries);
+    for (auto const& rowStart : part.rowIndications) {
+        rowIndications.push_back(rowStart + numberOfEntries);
+    }
+    for (auto const& groupStart : part.rowGroupIndices) {
+        rowGroupIndices.push_back(groupStart + rowOffset);
+    }
+
+    // The blocks of the part are moved as a whole. As the last block of this builder may still be filled, the blocks do not need to be full.
+    for (uint64_t block = 0; block < part.blocks.size(); ++block) {
+        blocks.push_back(std::move(part.blocks[block]));
+        blockStarts.push_back(part.blockStarts[block] + numberOfEntries);
+    }
+    if (part.numberOfEntries > 0) {
+        highestColumn = std::max(highestColumn, part.highestColumn);
+    }
+    numberOfEntries += part.numberOfEntries;
+
+    part.blocks.clear();
+    part.blockStarts.clear();
+    part.rowIndications.clear();
+    part.rowGroupIndices.clear();
+    part.numberOfEntries = 0;
+    part.highestColumn = 0;
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+    return hasCustomRowGrouping ? rowGroupIndices.size() : rowIndications.size();
+}
+
+template<typename ValueType>
+typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getNumberOfEntries() const {
+    return numberOfEntries + currentRow.size();
+}
+
+template<typename ValueType>
+uint64_t ChunkedSparseMatrixBuilder<ValueType>::getReservedBytes() const {
+    uint64_t result = currentRow.capacity() * sizeof(Entry) + rowIndications.capacity() * sizeof(index_type) +
+                      (rowGroupIndices.capacity() + blockStarts.capacity()) * sizeof(index_type);
+    for (auto const& block : blocks) {
+        result += block.capacity() * sizeof(Entry);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void ChunkedSparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
+    finishCurrentRow();
+    index_type maxColumn = 0;
+
+    // As rows do not span blocks, the entries of each row are consecutive within one block.
+    uint64_t block = 0;
+    for (index_type row = 0; row < rowIndications.size(); ++row) {
+        index_type rowStart = rowIndications[row];
+        index_type rowEnd = row + 1 < rowIndications.size() ? rowIndications[row + 1] : numberOfEntries;
+        if (rowStart == rowEnd) {
+            continue;
+        }
+        while (blockStarts[block] + blocks[block].size() <= rowStart) {
+            ++block;
+        }
+        auto first = blocks[block].begin() + (rowStart - blockStarts[block]);
+        auto last = first + (rowEnd - rowStart);
+        bool changed = false;
+        for (auto entry = first; entry != last; ++entry) {
+            if (entry->getColumn() >= offset) {
+                entry->setColumn(replacements[entry->getColumn() - offset]);
+                changed = true;
+            }
+            maxColumn = std::max(maxColumn, entry->getColumn());
+        }
+        if (changed) {
+            std::sort(first, last, [](Entry const& a, Entry const& b) { return a.getColumn() < b.getColumn(); });
+        }
+    }
+    highestColumn = maxColumn;
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> ChunkedSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount,
+                                                                    index_type overriddenRowGroupCount) {
+    finishCurrentRow();
+
+    index_type rowCount = std::max(getCurrentRowCount(), overriddenRowCount);
+    rowIndications.resize(rowCount, numberOfEntries);
+    if (rowCount > 0) {
+        rowIndications.push_back(numberOfEntries);
+    }
+
+    index_type columnCount = numberOfEntries > 0 ? highestColumn + 1 : 0;
+    columnCount = std::max(columnCount, overriddenColumnCount);
+
+    boost::optional<std::vector<index_type>> finalRowGroupIndices;
+    if (hasCustomRowGrouping) {
+        index_type rowGroupCount = std::max<index_type>(rowGroupIndices.size(), overriddenRowGroupCount);
+        rowGroupIndices.resize(rowGroupCount + 1, rowCount);
+        finalRowGroupIndices = std::move(rowGroupIndices);
+    }
+
+    // Only reserve the entries (which does not touch the memory) and release each block once it is copied, so the memory that is actually used
+    // grows with the copied entries.
+    std::vector<Entry> entries;
+    entries.reserve(numberOfEntries);
+    for (auto& block : blocks) {
+        std::move(block.begin(), block.end(), std::back_inserter(entries));
+        std::vector<Entry>().swap(block);
+    }
+    blocks.clear();
+    blockStarts.clear();
+
+    return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(entries), std::move(finalRowGroupIndices));
+}
+
+template class ChunkedSparseMatrixBuilder<double>;
+#ifdef STORM_HAVE_CARL
+template class ChunkedSparseMatrixBuilder<storm::RationalNumber>;
+template class ChunkedSparseMatrixBuilder<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A builder for sparse matrices that keeps the entries in a list of fixed-size blocks instead of one vector that is grown geometrically. This avoids
+ * the copies of all entries whenever the vector is reallocated as well as the unused capacity of up to the number of entries that a grown vector
+ * carries. Upon building the matrix, the blocks are copied into the entry vector of the matrix one after the other and each block is released as
+ * soon as it is copied, so (apart from one block) the entries are not held twice.
+ *
+ * Entries have to be added row by row. Within a row, they may be added in any order and entries with the same column are summed up. A row never
+ * spans two blocks, so a block may be left partially filled if the next row does not fit into it.
+ *
+ * Builders for consecutive ranges of rows can be filled independently (e.g. by different threads) and then be appended to each other, which moves
+ * their blocks rather than copying the entries.
+ */
+template<typename ValueType>
+class ChunkedSparseMatrixBuilder {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * Constructs an empty builder.
+     *
+     * @param hasCustomRowGrouping If set, the matrix has a custom row grouping whose groups are started through calls to newRowGroup.
+     * @param entriesPerBlock The number of entries that fit into one block.
+     */
+    ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping = false, index_type entriesPerBlock = 1024 * 1024);
+
+    ChunkedSparseMatrixBuilder(ChunkedSparseMatrixBuilder&& other) = default;
+    ChunkedSparseMatrixBuilder& operator=(ChunkedSparseMatrixBuilder&& other) = default;
+
+    /*!
+     * Sets the matrix entry at the given row and column to the given value. The row must not be smaller than the row of the previously added entry.
+     * If the entry was already set in the current row, the given value is added to it.
+     *
+     * @param row The row in which the matrix entry is to be set.
+     * @param column The column in which the matrix entry is to be set.
+     * @param value The value that is to be set at the specified row and column.
+     */
+    void addNextValue(index_type row, index_type column, value_type const& value);
+
+    /*!
+     * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row group are added.
+     *
+     * @param startingRow The starting row of the new row group.
+     */
+    void newRowGroup(index_type startingRow);
+
+    /*!
+     * Appends the rows of the given builder, whose rows (and row groups) are numbered starting from zero, after the rows of this builder. The rows of
+     * this builder end with the last row that has entries or, with a custom row grouping, with the first row of the last row group (whichever is
+     * larger). The blocks of the given builder are moved, so it is empty afterwards.
+     *
+     * @param part The builder whose rows are appended. It needs to agree with this builder on whether there is a custom row grouping.
+     */
+    void append(ChunkedSparseMatrixBuilder&& part);
+
+    /*!
+     * Retrieves the number of row groups that were started so far (or the number of rows with entries if the matrix has no custom row grouping).
+     */
+    index_type getCurrentRowGroupCount() const;
+
+    /*!
+     * Retrieves the number of entries that were added so far.
+     */
+    index_type getNumberOfEntries() const;
+
+    /*!
+     * Retrieves the number of bytes that are currently reserved for the matrix.
+     */
+    uint64_t getReservedBytes() const;
+
+    /*!
+     * Replaces all columns with id >= offset according to replacements. Every state with id offset+i is replaced by the id in replacements[i]. The
+     * entries of the affected rows are sorted again afterwards.
+     *
+     * @param replacements Mapping indicating the replacements from offset+i -> value of i.
+     * @param offset Offset to add to each id in vector index.
+     */
+    void replaceColumns(std::vector<index_type> const& replacements, index_type offset);
+
+    /*!
+     * Assembles the matrix from the blocks. Afterwards, the builder must not be used anymore.
+     *
+     * @param overriddenRowCount If this is set to a value that is greater than the current number of rows, empty rows are appended.
+     * @param overriddenColumnCount If this is set to a value that is greater than the current number of columns, the column count is increased
+     * accordingly.
+     * @param overriddenRowGroupCount If this is set to a value that is greater than the current number of row groups, empty row groups are appended.
+     */
+    SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+   private:
+    typedef MatrixEntry<index_type, value_type> Entry;
+
+    // Sorts the entries of the current row, sums up entries with the same column and moves them into the blocks.
+    void finishCurrentRow();
+
+    // Retrieves the number of rows up to the last row with entries or the first row of the last row group.
+    index_type getCurrentRowCount() const;
+
+    bool hasCustomRowGrouping;
+    index_type entriesPerBlock;
+
+    // The blocks holding the entries of the finished rows and the (global) index of the first entry of each block.
+    std::vector<std::vector<Entry>> blocks;
+    std::vector<index_type> blockStarts;
+    index_type numberOfEntries;
+
+    // The entries of the row that is currently filled.
+    std::vector<Entry> currentRow;
+
+    // The start of the rows (and row groups) that were started so far.
+    std::vector<index_type> rowIndications;
+    std::vector<index_type> rowGroupIndices;
+
+    index_type highestColumn;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,365 @@
+#include "storm/storage/CompactScheduler.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// Identifies the binary scheduler format. The version has to be increased whenever the format changes.
+char const binaryMagic[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'C', 'H'};
+uint64_t const binaryVersion = 1;
+
+uint64_t getNumberOfBits(uint64_t maximalCode) {
+    uint64_t result = 1;
+    while (result < 64 && (maximalCode >> result) != 0) {
+        ++result;
+    }
+    return result;
+}
+
+uint64_t getNumberOfPackedBits(uint64_t numberOfModelStates, uint64_t bitsPerChoice) {
+    // Round up to full 64-bit words, which allows to export the packed choices word by word.
+    return ((numberOfModelStates * bitsPerChoice + 63) / 64) * 64;
+}
+
+void writeUint64(std::ostream& out, uint64_t value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+uint64_t readUint64(std::istream& in) {
+    uint64_t value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unexpected end of binary scheduler file.");
+    return value;
+}
+
+void writeDouble(std::ostream& out, double value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+double readDouble(std::istream& in) {
+    double value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unexpected end of binary scheduler file.");
+    return value;
+}
+
+uint64_t getMaximalChoice(std::vector<uint64_t> const& choices) {
+    return choices.empty() ? 0 : *std::max_element(choices.begin(), choices.end());
+}
+
+template<typename ValueType>
+uint64_t getMaximalChoice(Scheduler<ValueType> const& scheduler) {
+    STORM_LOG_THROW(scheduler.isMemorylessScheduler(), storm::exceptions::InvalidArgumentException,
+                    "Only memoryless schedulers can be converted to a compact scheduler.");
+    uint64_t result = 0;
+    for (uint64_t state = 0; state < scheduler.getNumberOfModelStates(); ++state) {
+        for (auto const& choiceProbPair : scheduler.getChoice(state).getChoiceAsDistribution()) {
+            result = std::max<uint64_t>(result, choiceProbPair.first);
+        }
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+CompactScheduler<ValueType>::CompactScheduler(uint64_t numberOfModelStates, uint64_t maximalNumberOfChoices)
+    : numberOfModelStates(numberOfModelStates), numberOfUndefinedChoices(numberOfModelStates) {
+    // Deterministic choices are stored with an offset of two, so the largest code is maximalNumberOfChoices + 1.
+    bitsPerChoice = getNumberOfBits(maximalNumberOfChoices + 1);
+    packedChoices = storm::storage::BitVector(getNumberOfPackedBits(numberOfModelStates, bitsPerChoice));
+}
+
+template<typename ValueType>
+CompactScheduler<ValueType>::CompactScheduler(std::vector<uint64_t> const& choices) : CompactScheduler(choices.size(), getMaximalChoice(choices) + 1) {
+    for (uint64_t state = 0; state < choices.size(); ++state) {
+        setChoice(state, choices[state]);
+    }
+}
+
+template<typename ValueType>
+CompactScheduler<ValueType>::CompactScheduler(Scheduler<ValueType> const& scheduler)
+    : CompactScheduler(scheduler.getNumberOfModelStates(), getMaximalChoice(scheduler) + 1) {
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
+        setChoice(scheduler.getChoice(state), state);
+    }
+}
+
+template<typename ValueType>
+uint64_t CompactScheduler<ValueType>::getCode(uint64_t modelState) const {
+    return packedChoices.getAsInt(modelState * bitsPerChoice, bitsPerChoice);
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::setCode(uint64_t modelState, uint64_t code) {
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    uint64_t oldCode = getCode(modelState);
+    if (oldCode == RANDOMIZED_CODE && code != RANDOMIZED_CODE) {
+        randomizedChoices.erase(modelState);
+    }
+    if (oldCode == UNDEFINED_CODE && code != UNDEFINED_CODE) {
+        --numberOfUndefinedChoices;
+    } else if (oldCode != UNDEFINED_CODE && code == UNDEFINED_CODE) {
+        ++numberOfUndefinedChoices;
+    }
+    packedChoices.setFromInt(modelState * bitsPerChoice, bitsPerChoice, code);
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::setChoice(uint64_t modelState, uint64_t choice) {
+    STORM_LOG_THROW(getNumberOfBits(choice + 2) <= bitsPerChoice, storm::exceptions::InvalidArgumentException,
+                    "Choice " << choice << " exceeds the maximal number of choices of this scheduler.");
+    setCode(modelState, choice + 2);
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::setChoice(SchedulerChoice<ValueType> const& choice, uint64_t modelState) {
+    if (!choice.isDefined()) {
+        clearChoice(modelState);
+    } else if (choice.isDeterministic()) {
+        setChoice(modelState, choice.getDeterministicChoice());
+    } else {
+        setCode(modelState, RANDOMIZED_CODE);
+        randomizedChoices[modelState] = choice.getChoiceAsDistribution();
+    }
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::clearChoice(uint64_t modelState) {
+    setCode(modelState, UNDEFINED_CODE);
+}
+
+template<typename ValueType>
+SchedulerChoice<ValueType> CompactScheduler<ValueType>::getChoice(uint64_t modelState) const {
+    STORM_LOG_ASSERT(modelState < numberOfModelStates, "Illegal model state index");
+    uint64_t code = getCode(modelState);
+    if (code == UNDEFINED_CODE) {
+        return SchedulerChoice<ValueType>();
+    } else if (code == RANDOMIZED_CODE) {
+        return SchedulerChoice<ValueType>(randomizedChoices.at(modelState));
+    } else {
+        return SchedulerChoice<ValueType>(code - 2);
+    }
+}
+
+template<typename ValueType>
+bool CompactScheduler<ValueType>::isChoiceDefined(uint64_t modelState) const {
+    return getCode(modelState) != UNDEFINED_CODE;
+}
+
+template<typename ValueType>
+bool CompactScheduler<ValueType>::isChoiceDeterministic(uint64_t modelState) const {
+    return getCode(modelState) > RANDOMIZED_CODE;
+}
+
+template<typename ValueType>
+uint64_t CompactScheduler<ValueType>::getDeterministicChoice(uint64_t modelState) const {
+    uint64_t code = getCode(modelState);
+    STORM_LOG_THROW(code > RANDOMIZED_CODE, storm::exceptions::InvalidOperationException,
+                    "Tried to obtain the deterministic choice of a scheduler, but the choice is not deterministic");
+    return code - 2;
+}
+
+template<typename ValueType>
+bool CompactScheduler<ValueType>::isPartialScheduler() const {
+    return numberOfUndefinedChoices != 0;
+}
+
+template<typename ValueType>
+bool CompactScheduler<ValueType>::isDeterministicScheduler() const {
+    return randomizedChoices.empty();
+}
+
+template<typename ValueType>
+uint64_t CompactScheduler<ValueType>::getNumberOfModelStates() const {
+    return numberOfModelStates;
+}
+
+template<typename ValueType>
+uint64_t CompactScheduler<ValueType>::getBitsPerChoice() const {
+    return bitsPerChoice;
+}
+
+template<typename ValueType>
+uint64_t CompactScheduler<ValueType>::getSizeInBytes() const {
+    uint64_t result = sizeof(*this) + packedChoices.getSizeInBytes();
+    for (auto const& stateDistributionPair : randomizedChoices) {
+        // Account for the node of the hash map and the entries of the distribution.
+        result += sizeof(stateDistributionPair) + 2 * sizeof(void*) + stateDistributionPair.second.size() * sizeof(std::pair<uint_fast64_t, ValueType>);
+    }
+    return result;
+}
+
+template<typename ValueType>
+Scheduler<ValueType> CompactScheduler<ValueType>::toScheduler() const {
+    Scheduler<ValueType> result(numberOfModelStates);
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
+        if (isChoiceDefined(state)) {
+            result.setChoice(getChoice(state), state);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::exportJson(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                             bool skipUniqueChoices) const {
+    STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() == numberOfModelStates, storm::exceptions::InvalidOperationException,
+                    "The given model is not compatible with this scheduler.");
+    STORM_LOG_WARN_COND(!(skipUniqueChoices && model == nullptr), "Can not skip unique choices if the model is not given.");
+
+    // Writes a single choice. Without a model, the local choice index is written.
+    auto writeChoice = [&out, &model](uint64_t state, uint64_t localChoice, storm::RationalNumber const& probability) {
+        uint64_t choiceIndex = localChoice;
+        out << '{';
+        if (model) {
+            choiceIndex += model->getTransitionMatrix().getRowGroupIndices()[state];
+            if (model->hasChoiceLabeling()) {
+                auto choiceLabels = model->getChoiceLabeling().getLabelsOfChoice(choiceIndex);
+                out << "\"labels\": " << storm::json<storm::RationalNumber>(std::vector<std::string>(choiceLabels.begin(), choiceLabels.end())).dump() << ", ";
+            }
+            if (model->hasChoiceOrigins() &&
+                model->getChoiceOrigins()->getIdentifier(choiceIndex) != model->getChoiceOrigins()->getIdentifierForChoicesWithNoOrigin()) {
+                out << "\"origin\": " << model->getChoiceOrigins()->getChoiceAsJson(choiceIndex).dump() << ", ";
+            }
+        }
+        out << "\"index\": " << choiceIndex << ", \"prob\": " << storm::json<storm::RationalNumber>(probability).dump() << '}';
+    };
+
+    storm::RationalNumber const one = storm::utility::one<storm::RationalNumber>();
+    bool firstState = true;
+    out << '[';
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
+        if (skipUniqueChoices && model != nullptr && model->getTransitionMatrix().getRowGroupSize(state) == 1) {
+            continue;
+        }
+        out << (firstState ? "\n" : ",\n") << "    {\"s\": ";
+        firstState = false;
+        if (model && model->hasStateValuations()) {
+            out << model->getStateValuations().template toJson<storm::RationalNumber>(state).dump();
+        } else {
+            out << state;
+        }
+        out << ", \"c\": ";
+        uint64_t code = getCode(state);
+        if (code == UNDEFINED_CODE) {
+            out << "\"undefined\"";
+        } else if (code == RANDOMIZED_CODE) {
+            bool firstChoice = true;
+            out << '[';
+            for (auto const& choiceProbPair : randomizedChoices.at(state)) {
+                if (!firstChoice) {
+                    out << ", ";
+                }
+                firstChoice = false;
+                writeChoice(state, choiceProbPair.first, storm::utility::convertNumber<storm::RationalNumber>(choiceProbPair.second));
+            }
+            out << ']';
+        } else {
+            out << '[';
+            writeChoice(state, code - 2, one);
+            out << ']';
+        }
+        out << '}';
+    }
+    out << "\n]\n";
+}
+
+template<typename ValueType>
+void CompactScheduler<ValueType>::exportBinary(std::ostream& out) const {
+    // The header consists of the magic bytes, the format version, the number of states and the number of bits per choice.
+    out.write(binaryMagic, sizeof(binaryMagic));
+    writeUint64(out, binaryVersion);
+    writeUint64(out, numberOfModelStates);
+    writeUint64(out, bitsPerChoice);
+
+    // The packed choices are written word by word.
+    for (uint64_t bitIndex = 0; bitIndex < packedChoices.size(); bitIndex += 64) {
+        writeUint64(out, packedChoices.getAsInt(bitIndex, 64));
+    }
+
+    // Finally, the randomized choices are written as (state, size, (choice, probability)*) in ascending order of the states.
+    std::vector<uint64_t> randomizedStates;
+    randomizedStates.reserve(randomizedChoices.size());
+    for (auto const& stateDistributionPair : randomizedChoices) {
+        randomizedStates.push_back(stateDistributionPair.first);
+    }
+    std::sort(randomizedStates.begin(), randomizedStates.end());
+    writeUint64(out, randomizedStates.size());
+    for (auto state : randomizedStates) {
+        auto const& distribution = randomizedChoices.at(state);
+        writeUint64(out, state);
+        writeUint64(out, distribution.size());
+        for (auto const& choiceProbPair : distribution) {
+            writeUint64(out, choiceProbPair.first);
+            writeDouble(out, storm::utility::convertNumber<double>(choiceProbPair.second));
+        }
+    }
+}
+
+template<typename ValueType>
+CompactScheduler<ValueType> CompactScheduler<ValueType>::importBinary(std::istream& in) {
+    char magic[sizeof(binaryMagic)];
+    in.read(magic, sizeof(magic));
+    STORM_LOG_THROW(in.good() && std::memcmp(magic, binaryMagic, sizeof(magic)) == 0, storm::exceptions::WrongFormatException,
+                    "The given input is not a binary scheduler.");
+    uint64_t version = readUint64(in);
+    STORM_LOG_THROW(version == binaryVersion, storm::exceptions::WrongFormatException, "Unsupported version " << version << " of binary scheduler.");
+    uint64_t numberOfModelStates = readUint64(in);
+    uint64_t bitsPerChoice = readUint64(in);
+    STORM_LOG_THROW(bitsPerChoice >= 1 && bitsPerChoice <= 64, storm::exceptions::WrongFormatException, "Illegal number of bits per choice.");
+
+    // This number of choices yields the stored number of bits per choice.
+    CompactScheduler<ValueType> result(numberOfModelStates, (1ull << (bitsPerChoice - 1)) - 1);
+    STORM_LOG_ASSERT(result.bitsPerChoice == bitsPerChoice, "Unexpected number of bits per choice.");
+    for (uint64_t bitIndex = 0; bitIndex < result.packedChoices.size(); bitIndex += 64) {
+        result.packedChoices.setFromInt(bitIndex, 64, readUint64(in));
+    }
+    result.numberOfUndefinedChoices = 0;
+    uint64_t numberOfRandomizedCodes = 0;
+    for (uint64_t state = 0; state < numberOfModelStates; ++state) {
+        uint64_t code = result.getCode(state);
+        if (code == UNDEFINED_CODE) {
+            ++result.numberOfUndefinedChoices;
+        } else if (code == RANDOMIZED_CODE) {
+            ++numberOfRandomizedCodes;
+        }
+    }
+
+    uint64_t numberOfRandomizedStates = readUint64(in);
+    STORM_LOG_THROW(numberOfRandomizedStates == numberOfRandomizedCodes, storm::exceptions::WrongFormatException,
+                    "Inconsistent number of randomized states in binary scheduler.");
+    for (uint64_t i = 0; i < numberOfRandomizedStates; ++i) {
+        uint64_t state = readUint64(in);
+        STORM_LOG_THROW(state < numberOfModelStates && result.getCode(state) == RANDOMIZED_CODE, storm::exceptions::WrongFormatException,
+                        "Illegal randomized state " << state << " in binary scheduler.");
+        uint64_t size = readUint64(in);
+        storm::storage::Distribution<ValueType, uint_fast64_t> distribution;
+        for (uint64_t j = 0; j < size; ++j) {
+            uint64_t choice = readUint64(in);
+            distribution.addProbability(choice, storm::utility::convertNumber<ValueType>(readDouble(in)));
+        }
+        result.randomizedChoices[state] = std::move(distribution);
+    }
+    STORM_LOG_THROW(result.randomizedChoices.size() == numberOfRandomizedStates, storm::exceptions::WrongFormatException,
+                    "Duplicate randomized state in binary scheduler.");
+    return result;
+}
+
+template class CompactScheduler<double>;
+template class CompactScheduler<storm::RationalNumber>;
+template class CompactScheduler<storm::RationalFunction>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Distribution.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/SchedulerChoice.h"
+
+namespace storm {
+
+namespace storage {
+
+/*!
+ * A memory-efficient representation of a memoryless scheduler. The (local) choice of every state is stored in a
+ * bit-packed array using the minimal number of bits needed to represent the largest choice index, so that a
+ * deterministic scheduler for a model with at most n choices per state takes ceil(log2(n+2)) bits per state (instead
+ * of a full Distribution per state as in the Scheduler). Only states with a randomized choice store a Distribution.
+ *
+ * In contrast to the Scheduler, the choices are returned by value and no memory structure is supported.
+ */
+template<typename ValueType>
+class CompactScheduler {
+   public:
+    /*!
+     * Initializes an undefined scheduler.
+     *
+     * @param numberOfModelStates The number of states of the considered model.
+     * @param maximalNumberOfChoices An upper bound on the number of choices of a single state. Determines the width of the stored choices.
+     */
+    CompactScheduler(uint64_t numberOfModelStates, uint64_t maximalNumberOfChoices);
+
+    /*!
+     * Initializes a deterministic scheduler from the given (local) choice indices, e.g., as produced by the model checking helpers.
+     */
+    explicit CompactScheduler(std::vector<uint64_t> const& choices);
+
+    /*!
+     * Initializes a scheduler with the same choices as the given memoryless scheduler.
+     */
+    explicit CompactScheduler(Scheduler<ValueType> const& scheduler);
+
+    /*!
+     * Sets the given (deterministic) choice at the given state.
+     */
+    void setChoice(uint64_t modelState, uint64_t choice);
+
+    /*!
+     * Sets the given choice at the given state. Only randomized choices are stored as a distribution.
+     */
+    void setChoice(SchedulerChoice<ValueType> const& choice, uint64_t modelState);
+
+    /*!
+     * Makes the choice at the given state undefined.
+     */
+    void clearChoice(uint64_t modelState);
+
+    /*!
+     * Retrieves the choice at the given state.
+     */
+    SchedulerChoice<ValueType> getChoice(uint64_t modelState) const;
+
+    /*!
+     * Retrieves whether the choice at the given state is defined.
+     */
+    bool isChoiceDefined(uint64_t modelState) const;
+
+    /*!
+     * Retrieves whether the choice at the given state is deterministic.
+     */
+    bool isChoiceDeterministic(uint64_t modelState) const;
+
+    /*!
+     * Retrieves the deterministic choice at the given state. The choice must be defined and deterministic.
+     */
+    uint64_t getDeterministicChoice(uint64_t modelState) const;
+
+    /*!
+     * Retrieves whether there is a state with an undefined choice.
+     */
+    bool isPartialScheduler() const;
+
+    /*!
+     * Retrieves whether all defined choices are deterministic.
+     */
+    bool isDeterministicScheduler() const;
+
+    uint64_t getNumberOfModelStates() const;
+
+    /*!
+     * Retrieves the number of bits used to store the choice of a single state.
+     */
+    uint64_t getBitsPerChoice() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by this scheduler.
+     */
+    uint64_t getSizeInBytes() const;
+
+    /*!
+     * Converts this scheduler to a (non-compact) Scheduler.
+     */
+    Scheduler<ValueType> toScheduler() const;
+
+    /*!
+     * Writes the scheduler as JSON to the given stream. The output has the same structure as Scheduler::printJsonToStream,
+     * but it is written state by state, i.e., no JSON object for the full scheduler is built in memory.
+     *
+     * @param model If given, the global choice indices, labels and origins of the choices as well as state valuations are written.
+     * @param skipUniqueChoices If set, states with a single choice are not written.
+     */
+    void exportJson(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model = nullptr,
+                    bool skipUniqueChoices = false) const;
+
+    /*!
+     * Writes the scheduler in a binary format to the given stream. Probabilities of randomized choices are stored as doubles.
+     * The stream has to be opened in binary mode.
+     */
+    void exportBinary(std::ostream& out) const;
+
+    /*!
+     * Reads a scheduler that was written with exportBinary.
+     */
+    static CompactScheduler<ValueType> importBinary(std::istream& in);
+
+   private:
+    // The code that marks a state with an undefined choice. Deterministic choices are stored with an offset of two.
+    static constexpr uint64_t UNDEFINED_CODE = 0;
+    // The code that marks a state whose choice is stored in the randomized choices.
+    static constexpr uint64_t RANDOMIZED_CODE = 1;
+
+    uint64_t getCode(uint64_t modelState) const;
+    void setCode(uint64_t modelState, uint64_t code);
+
+    uint64_t numberOfModelStates;
+    uint64_t bitsPerChoice;
+    storm::storage::BitVector packedChoices;
+    std::unordered_map<uint64_t, storm::storage::Distribution<ValueType, uint_fast64_t>> randomizedChoices;
+    uint64_t numberOfUndefinedChoices;
+};
+
+}  // namespace storage
+}  // namespace storm
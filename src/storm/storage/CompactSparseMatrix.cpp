@@ -0,0 +1,498 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include <limits>
+#include <unordered_map>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename IndexType>
+CompactSparseMatrix<ValueType, IndexType>::const_iterator::const_iterator(CompactSparseMatrix const& matrix, uint64_t entry)
+    : matrix(&matrix), entry(entry) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator const& CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator*() const {
+    return *this;
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator const* CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator->() const {
+    return this;
+}
+
+template<typename ValueType, typename IndexType>
+IndexType const& CompactSparseMatrix<ValueType, IndexType>::const_iterator::getColumn() const {
+    return matrix->columns[entry];
+}
+
+template<typename ValueType, typename IndexType>
+ValueType const& CompactSparseMatrix<ValueType, IndexType>::const_iterator::getValue() const {
+    return matrix->getValue(entry);
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator& CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator++() {
+    ++entry;
+    return *this;
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator++(int) {
+    const_iterator result = *this;
+    ++(*this);
+    return result;
+}
+
+template<typename ValueType, typename IndexType>
+bool CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator==(const_iterator const& other) const {
+    return entry == other.entry;
+}
+
+template<typename ValueType, typename IndexType>
+bool CompactSparseMatrix<ValueType, IndexType>::const_iterator::operator!=(const_iterator const& other) const {
+    return entry != other.entry;
+}
+
+template<typename ValueType, typename IndexType>
+CompactSparseMatrix<ValueType, IndexType>::const_rows::const_rows(const_iterator begin, const_iterator end, uint64_t entryCount)
+    : beginIterator(begin), endIterator(end), entryCount(entryCount) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator CompactSparseMatrix<ValueType, IndexType>::const_rows::begin() const {
+    return beginIterator;
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_iterator CompactSparseMatrix<ValueType, IndexType>::const_rows::end() const {
+    return endIterator;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t CompactSparseMatrix<ValueType, IndexType>::const_rows::getNumberOfEntries() const {
+    return entryCount;
+}
+
+template<typename ValueType, typename IndexType>
+CompactSparseMatrix<ValueType, IndexType>::CompactSparseMatrix() : columnCount(0), rowIndications(1, 0), valueEncoding(ValueEncoding::Plain) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename IndexType>
+CompactSparseMatrix<ValueType, IndexType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowValueDictionary)
+    : columnCount(matrix.getColumnCount()), valueEncoding(ValueEncoding::Plain) {
+    STORM_LOG_THROW(canRepresent(matrix), storm::exceptions::InvalidArgumentException,
+                    "The matrix has " << matrix.getColumnCount() << " columns, which exceeds the range of the index type.");
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    columns.reserve(matrix.getEntryCount());
+
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<IndexType>(entry.getColumn()));
+        }
+        rowIndications.push_back(columns.size());
+    }
+
+    if (allowValueDictionary) {
+        // Try to collect the distinct values. We give up as soon as there are too many of them.
+        uint64_t const maximalDictionarySize = static_cast<uint64_t>(std::numeric_limits<uint16_t>::max()) + 1;
+        std::unordered_map<ValueType, uint16_t> valueToIndex;
+        std::vector<uint16_t> indices;
+        indices.reserve(matrix.getEntryCount());
+        for (uint64_t row = 0; row < matrix.getRowCount() && valueDictionary.size() <= maximalDictionarySize; ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                auto valueIt = valueToIndex.find(entry.getValue());
+                if (valueIt == valueToIndex.end()) {
+                    if (valueDictionary.size() == maximalDictionarySize) {
+                        // Mark the dictionary as too large.
+                        valueDictionary.push_back(entry.getValue());
+                        break;
+                    }
+                    valueIt = valueToIndex.emplace(entry.getValue(), static_cast<uint16_t>(valueDictionary.size())).first;
+                    valueDictionary.push_back(entry.getValue());
+                }
+                indices.push_back(valueIt->second);
+            }
+        }
+
+        if (valueDictionary.size() > maximalDictionarySize) {
+            STORM_LOG_DEBUG("Not using a value dictionary as the matrix has more than " << maximalDictionarySize << " distinct values.");
+            valueDictionary.clear();
+            valueDictionary.shrink_to_fit();
+        } else if (valueDictionary.size() <= static_cast<uint64_t>(std::numeric_limits<uint8_t>::max()) + 1) {
+            valueEncoding = ValueEncoding::Dictionary8;
+            valueIndices8.assign(indices.begin(), indices.end());
+        } else {
+            valueEncoding = ValueEncoding::Dictionary16;
+            valueIndices16.assign(indices.begin(), indices.end());
+        }
+    }
+
+    if (valueEncoding == ValueEncoding::Plain) {
+        values.reserve(matrix.getEntryCount());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            for (auto const& entry : matrix.getRow(row)) {
+                values.push_back(entry.getValue());
+            }
+        }
+    } else {
+        STORM_LOG_DEBUG("Storing the values of the matrix in a dictionary with " << valueDictionary.size() << " distinct values.");
+    }
+}
+
+template<typename ValueType, typename IndexType>
+bool CompactSparseMatrix<ValueType, IndexType>::canRepresent(SparseMatrix<ValueType> const& matrix) {
+    return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<IndexType>::max());
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t CompactSparseMatrix<ValueType, IndexType>::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t CompactSparseMatrix<ValueType, IndexType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t CompactSparseMatrix<ValueType, IndexType>::getEntryCount() const {
+    return columns.size();
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t CompactSparseMatrix<ValueType, IndexType>::getSizeInMemory() const {
+    return rowIndications.size() * sizeof(uint64_t) + columns.size() * sizeof(IndexType) + values.size() * sizeof(ValueType) +
+           valueDictionary.size() * sizeof(ValueType) + valueIndices8.size() * sizeof(uint8_t) + valueIndices16.size() * sizeof(uint16_t);
+}
+
+template<typename ValueType, typename IndexType>
+typename CompactSparseMatrix<ValueType, IndexType>::const_rows CompactSparseMatrix<ValueType, IndexType>::getRow(uint64_t row) const {
+    uint64_t begin = rowIndications[row];
+    uint64_t end = rowIndications[row + 1];
+    return const_rows(const_iterator(*this, begin), const_iterator(*this, end), end - begin);
+}
+
+template<typename ValueType, typename IndexType>
+storm::utility::memory::AlignedVector<uint64_t> const& CompactSparseMatrix<ValueType, IndexType>::getRowIndications() const {
+    return rowIndications;
+}
+
+template<typename ValueType, typename IndexType>
+storm::utility::memory::AlignedVector<IndexType> const& CompactSparseMatrix<ValueType, IndexType>::getColumns() const {
+    return columns;
+}
+
+template<typename ValueType, typename IndexType>
+storm::utility::memory::AlignedVector<ValueType> const& CompactSparseMatrix<ValueType, IndexType>::getValues() const {
+    STORM_LOG_ASSERT(valueEncoding == ValueEncoding::Plain, "The values are stored in a value dictionary.");
+    return values;
+}
+
+template<typename ValueType, typename IndexType>
+bool CompactSparseMatrix<ValueType, IndexType>::hasValueDictionary() const {
+    return valueEncoding != ValueEncoding::Plain;
+}
+
+template<typename ValueType, typename IndexType>
+storm::utility::memory::AlignedVector<ValueType> const& CompactSparseMatrix<ValueType, IndexType>::getValueDictionary() const {
+    STORM_LOG_ASSERT(hasValueDictionary(), "The values are not stored in a value dictionary.");
+    return valueDictionary;
+}
+
+template<typename ValueType, typename IndexType>
+ValueType const& CompactSparseMatrix<ValueType, IndexType>::getValue(uint64_t entry) const {
+    switch (valueEncoding) {
+        case ValueEncoding::Dictionary8:
+            return valueDictionary[valueIndices8[entry]];
+        case ValueEncoding::Dictionary16:
+            return valueDictionary[valueIndices16[entry]];
+        default:
+            return values[entry];
+    }
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Function>
+void CompactSparseMatrix<ValueType, IndexType>::applyWithValues(Function const& function) const {
+    switch (valueEncoding) {
+        case ValueEncoding::Dictionary8:
+            function(DictionaryValues<uint8_t>{valueDictionary.data(), valueIndices8.data()});
+            break;
+        case ValueEncoding::Dictionary16:
+            function(DictionaryValues<uint16_t>{valueDictionary.data(), valueIndices16.data()});
+            break;
+        default:
+            function(values.data());
+    }
+}
+
+template<typename ValueType, typename IndexType>
+ValueType CompactSparseMatrix<ValueType, IndexType>::multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector) const {
+    ValueType result = storm::utility::zero<ValueType>();
+    applyWithValues([&](auto const& values) {
+        for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+            result += values[entry] * vector[columns[entry]];
+        }
+    });
+    return result;
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                   std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+    multiplyWithVectorForward(0, getRowCount(), vector, result, summand);
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVectorForward(uint64_t startRow, uint64_t endRow, std::vector<ValueType> const& vector,
+                                                                          std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+    applyWithValues([&](auto const& values) { this->multiplyWithVectorForward(values, startRow, endRow, vector, result, summand); });
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Values>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVectorForward(Values const& values, uint64_t startRow, uint64_t endRow,
+                                                                          std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                          std::vector<ValueType> const* summand) const {
+    uint64_t entry = rowIndications[startRow];
+    uint64_t const* rowIt = rowIndications.data() + startRow;
+    IndexType const* c = columns.data();
+    ValueType const* x = vector.data();
+    for (uint64_t row = startRow; row < endRow; ++row, ++rowIt) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (uint64_t entryEnd = *(rowIt + 1); entry != entryEnd; ++entry) {
+            newValue += values[entry] * x[c[entry]];
+        }
+        result[row] = newValue;
+    }
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                           std::vector<ValueType> const* summand) const {
+    applyWithValues([&](auto const& values) { this->multiplyWithVectorBackward(values, vector, result, summand); });
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Values>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyWithVectorBackward(Values const& values, std::vector<ValueType> const& vector,
+                                                                           std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+    ValueType const* x = vector.data();
+    for (uint64_t row = getRowCount(); row > 0;) {
+        --row;
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        // Iterate the entries in reverse order to match SparseMatrix::multiplyWithVectorBackward.
+        for (uint64_t entry = rowIndications[row + 1]; entry > rowIndications[row];) {
+            --entry;
+            newValue += values[entry] * x[columns[entry]];
+        }
+        result[row] = newValue;
+    }
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                  std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                  std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+    multiplyAndReduceForward(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, vector, summand, result, choices);
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduceForward(storm::solver::OptimizationDirection const& dir,
+                                                                         std::vector<uint64_t> const& rowGroupIndices, uint64_t startGroup, uint64_t endGroup,
+                                                                         std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                         std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    applyWithValues([&](auto const& values) {
+        if (dir == storm::OptimizationDirection::Minimize) {
+            this->template multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(values, rowGroupIndices, startGroup, endGroup, vector, summand,
+                                                                                            result, choices);
+        } else {
+            this->template multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(values, rowGroupIndices, startGroup, endGroup, vector, summand,
+                                                                                               result, choices);
+        }
+    });
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Compare, typename Values>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduceForward(Values const& values, std::vector<uint64_t> const& rowGroupIndices,
+                                                                         uint64_t startGroup, uint64_t endGroup, std::vector<ValueType> const& vector,
+                                                                         std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                         std::vector<uint64_t>* choices) const {
+    Compare compare;
+    IndexType const* c = columns.data();
+    ValueType const* x = vector.data();
+
+    // Variables for correctly tracking choices (only update if new choice is strictly better).
+    ValueType oldSelectedChoiceValue;
+    uint64_t selectedChoice;
+
+    for (uint64_t group = startGroup; group < endGroup; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t rowEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (row == rowEnd) {
+            continue;
+        }
+
+        uint64_t entry = rowIndications[row];
+
+        ValueType currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (uint64_t entryEnd = rowIndications[row + 1]; entry != entryEnd; ++entry) {
+            currentValue += values[entry] * x[c[entry]];
+        }
+        if (choices) {
+            selectedChoice = 0;
+            if ((*choices)[group] == 0) {
+                oldSelectedChoiceValue = currentValue;
+            }
+        }
+
+        for (++row; row < rowEnd; ++row) {
+            ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            for (uint64_t entryEnd = rowIndications[row + 1]; entry != entryEnd; ++entry) {
+                newValue += values[entry] * x[c[entry]];
+            }
+
+            if (choices && row == (*choices)[group] + rowGroupIndices[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
+
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                if (choices) {
+                    selectedChoice = row - rowGroupIndices[group];
+                }
+            }
+        }
+
+        // Finally write value to target vector.
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
+}
+
+template<typename ValueType, typename IndexType>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir,
+                                                                          std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                          std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                          std::vector<uint64_t>* choices) const {
+    applyWithValues([&](auto const& values) {
+        if (dir == storm::OptimizationDirection::Minimize) {
+            this->template multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(values, rowGroupIndices, vector, summand, result, choices);
+        } else {
+            this->template multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(values, rowGroupIndices, vector, summand, result, choices);
+        }
+    });
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Compare, typename Values>
+void CompactSparseMatrix<ValueType, IndexType>::multiplyAndReduceBackward(Values const& values, std::vector<uint64_t> const& rowGroupIndices,
+                                                                          std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                          std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    Compare compare;
+    ValueType const* x = vector.data();
+
+    // Variables for correctly tracking choices (only update if new choice is strictly better).
+    ValueType oldSelectedChoiceValue;
+    uint64_t selectedChoice;
+
+    // Like SparseMatrix::multiplyAndReduceBackward, the rows of each group as well as the entries of each row are
+    // processed in reverse order.
+    for (uint64_t group = rowGroupIndices.size() - 1; group > 0;) {
+        --group;
+        uint64_t rowBegin = rowGroupIndices[group];
+        uint64_t row = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (rowBegin == row) {
+            continue;
+        }
+
+        --row;
+        ValueType currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (uint64_t entry = rowIndications[row + 1]; entry > rowIndications[row];) {
+            --entry;
+            currentValue += values[entry] * x[columns[entry]];
+        }
+        if (choices) {
+            selectedChoice = row - rowBegin;
+            if ((*choices)[group] == selectedChoice) {
+                oldSelectedChoiceValue = currentValue;
+            }
+        }
+
+        while (row > rowBegin) {
+            --row;
+            ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            for (uint64_t entry = rowIndications[row + 1]; entry > rowIndications[row];) {
+                --entry;
+                newValue += values[entry] * x[columns[entry]];
+            }
+
+            if (choices && row == (*choices)[group] + rowBegin) {
+                oldSelectedChoiceValue = newValue;
+            }
+
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                if (choices) {
+                    selectedChoice = row - rowBegin;
+                }
+            }
+        }
+
+        // Finally write value to target vector.
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void CompactSparseMatrix<storm::RationalFunction, uint32_t>::multiplyAndReduceForward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                                      uint64_t, uint64_t, std::vector<storm::RationalFunction> const&,
+                                                                                      std::vector<storm::RationalFunction> const*,
+                                                                                      std::vector<storm::RationalFunction>&, std::vector<uint64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+
+template<>
+void CompactSparseMatrix<storm::RationalFunction, uint32_t>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&,
+                                                                                       std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&,
+                                                                                       std::vector<storm::RationalFunction> const*,
+                                                                                       std::vector<storm::RationalFunction>&, std::vector<uint64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+#endif
+
+template class CompactSparseMatrix<double, uint32_t>;
+template class CompactSparseMatrix<double, uint64_t>;
+
+#ifdef STORM_HAVE_CARL
+template class CompactSparseMatrix<storm::RationalNumber, uint32_t>;
+template class CompactSparseMatrix<storm::RationalFunction, uint32_t>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,620 @@
+#include "storm/storage/CompressedBitVector.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The mask that selects the bit with the given index (modulo 64) within a word in the layout of BitVector.
+uint64_t bitMask(uint64_t index) {
+    return 1ull << (63 - (index & 63));
+}
+
+// Clears all bits of the given bitmap whose index is at least the given length.
+void truncateWords(std::vector<uint64_t>& words, uint64_t length) {
+    uint64_t fullWords = length >> 6;
+    if ((length & 63) != 0) {
+        words[fullWords] &= ~(~0ull >> (length & 63));
+        ++fullWords;
+    }
+    std::fill(words.begin() + std::min<uint64_t>(fullWords, words.size()), words.end(), 0);
+}
+}  // namespace
+
+CompressedBitVector::const_iterator::const_iterator(CompressedBitVector const* bitVector, uint64_t containerIndex, uint64_t offset)
+    : bitVector(bitVector), containerIndex(containerIndex), position(offset) {
+    moveToSetBit();
+}
+
+void CompressedBitVector::const_iterator::moveToSetBit() {
+    auto const& containers = bitVector->containers;
+    while (containerIndex < containers.size()) {
+        Container const& container = containers[containerIndex];
+        if (container.type == ContainerType::Array) {
+            if (position < container.offsets.size()) {
+                return;
+            }
+        } else {
+            position = containerNextSetOffset(container, position, bitVector->getChunkLength(bitVector->keys[containerIndex]));
+            if (position < chunkSize) {
+                return;
+            }
+        }
+        ++containerIndex;
+        position = 0;
+    }
+}
+
+CompressedBitVector::const_iterator& CompressedBitVector::const_iterator::operator++() {
+    ++position;
+    moveToSetBit();
+    return *this;
+}
+
+uint_fast64_t CompressedBitVector::const_iterator::operator*() const {
+    Container const& container = bitVector->containers[containerIndex];
+    uint64_t offset = container.type == ContainerType::Array ? container.offsets[position] : position;
+    return bitVector->keys[containerIndex] * chunkSize + offset;
+}
+
+bool CompressedBitVector::const_iterator::operator!=(const_iterator const& other) const {
+    return !(*this == other);
+}
+
+bool CompressedBitVector::const_iterator::operator==(const_iterator const& other) const {
+    return containerIndex == other.containerIndex && position == other.position;
+}
+
+bool CompressedBitVector::Container::operator==(Container const& other) const {
+    return type == other.type && cardinality == other.cardinality && offsets == other.offsets && words == other.words;
+}
+
+CompressedBitVector::CompressedBitVector() : length(0) {
+    // Intentionally left empty.
+}
+
+CompressedBitVector::CompressedBitVector(uint_fast64_t length, bool init) : length(length) {
+    if (init) {
+        fill();
+    }
+}
+
+CompressedBitVector::CompressedBitVector(BitVector const& bitVector) : length(bitVector.size()) {
+    uint64_t const* words = bitVector.getWords();
+    uint64_t const numberOfWords = (length + 63) / 64;
+    for (uint64_t key = 0; key < getNumberOfChunks(); ++key) {
+        uint64_t firstWord = key * wordsPerChunk;
+        Container container = createContainer(words + firstWord, std::min(wordsPerChunk, numberOfWords - firstWord), getChunkLength(key));
+        if (container.cardinality > 0) {
+            keys.push_back(key);
+            containers.push_back(std::move(container));
+        }
+    }
+}
+
+BitVector CompressedBitVector::toBitVector() const {
+    std::vector<uint64_t> words((length + 63) / 64, 0);
+    for (uint64_t index = 0; index < containers.size(); ++index) {
+        uint64_t const firstWord = keys[index] * wordsPerChunk;
+        uint64_t const chunkLength = getChunkLength(keys[index]);
+        Container const& container = containers[index];
+        if (container.type == ContainerType::Array) {
+            for (auto const& offset : container.offsets) {
+                words[firstWord + (offset >> 6)] |= bitMask(offset);
+            }
+        } else {
+            std::vector<uint64_t> chunkWords = getWords(container, chunkLength);
+            std::copy_n(chunkWords.begin(), (chunkLength + 63) / 64, words.begin() + firstWord);
+        }
+    }
+    return BitVector::fromWords(length, words.data());
+}
+
+bool CompressedBitVector::operator==(CompressedBitVector const& other) const {
+    return length == other.length && keys == other.keys && containers == other.containers;
+}
+
+bool CompressedBitVector::operator!=(CompressedBitVector const& other) const {
+    return !(*this == other);
+}
+
+void CompressedBitVector::set(uint_fast64_t index, bool value) {
+    STORM_LOG_ASSERT(index < length, "Invalid call to CompressedBitVector::set: written index " << index << " out of bounds.");
+    uint64_t const key = index / chunkSize;
+    uint64_t const offset = index % chunkSize;
+    uint64_t const chunkLength = getChunkLength(key);
+    uint64_t position = findContainer(key);
+    bool const exists = position < keys.size() && keys[position] == key;
+
+    if (!exists) {
+        if (!value) {
+            return;
+        }
+        Container container{ContainerType::Array, 1, {static_cast<uint16_t>(offset)}, {}};
+        adjustRepresentation(container, chunkLength);
+        keys.insert(keys.begin() + position, key);
+        containers.insert(containers.begin() + position, std::move(container));
+        return;
+    }
+
+    Container& container = containers[position];
+    if (containerGet(container, offset) == value) {
+        return;
+    }
+    if (container.type == ContainerType::Full) {
+        container.words = getWords(container, chunkLength);
+        container.type = ContainerType::Bitmap;
+    }
+    if (container.type == ContainerType::Array) {
+        auto it = std::lower_bound(container.offsets.begin(), container.offsets.end(), offset);
+        if (value) {
+            container.offsets.insert(it, static_cast<uint16_t>(offset));
+        } else {
+            container.offsets.erase(it);
+        }
+    } else if (value) {
+        container.words[offset >> 6] |= bitMask(offset);
+    } else {
+        container.words[offset >> 6] &= ~bitMask(offset);
+    }
+    container.cardinality = value ? container.cardinality + 1 : container.cardinality - 1;
+
+    if (container.cardinality == 0) {
+        keys.erase(keys.begin() + position);
+        containers.erase(containers.begin() + position);
+    } else {
+        adjustRepresentation(container, chunkLength);
+    }
+}
+
+bool CompressedBitVector::get(uint_fast64_t index) const {
+    STORM_LOG_ASSERT(index < length, "Invalid call to CompressedBitVector::get: read index " << index << " out of bounds.");
+    uint64_t const key = index / chunkSize;
+    uint64_t position = findContainer(key);
+    return position < keys.size() && keys[position] == key && containerGet(containers[position], index % chunkSize);
+}
+
+bool CompressedBitVector::operator[](uint_fast64_t index) const {
+    return get(index);
+}
+
+CompressedBitVector CompressedBitVector::operator&(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(length == other.length, "Bit vectors of different size (" << length << " vs. " << other.length << ").");
+    CompressedBitVector result(length);
+    uint64_t first = 0;
+    uint64_t second = 0;
+    while (first < keys.size() && second < other.keys.size()) {
+        if (keys[first] < other.keys[second]) {
+            ++first;
+        } else if (keys[first] > other.keys[second]) {
+            ++second;
+        } else {
+            Container container = intersect(containers[first], other.containers[second], getChunkLength(keys[first]));
+            if (container.cardinality > 0) {
+                result.keys.push_back(keys[first]);
+                result.containers.push_back(std::move(container));
+            }
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector& CompressedBitVector::operator&=(CompressedBitVector const& other) {
+    *this = *this & other;
+    return *this;
+}
+
+CompressedBitVector CompressedBitVector::operator|(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(length == other.length, "Bit vectors of different size (" << length << " vs. " << other.length << ").");
+    CompressedBitVector result(length);
+    uint64_t first = 0;
+    uint64_t second = 0;
+    while (first < keys.size() || second < other.keys.size()) {
+        if (second == other.keys.size() || (first < keys.size() && keys[first] < other.keys[second])) {
+            result.keys.push_back(keys[first]);
+            result.containers.push_back(containers[first]);
+            ++first;
+        } else if (first == keys.size() || keys[first] > other.keys[second]) {
+            result.keys.push_back(other.keys[second]);
+            result.containers.push_back(other.containers[second]);
+            ++second;
+        } else {
+            result.keys.push_back(keys[first]);
+            result.containers.push_back(unite(containers[first], other.containers[second], getChunkLength(keys[first])));
+            ++first;
+            ++second;
+        }
+    }
+    return result;
+}
+
+CompressedBitVector& CompressedBitVector::operator|=(CompressedBitVector const& other) {
+    *this = *this | other;
+    return *this;
+}
+
+CompressedBitVector CompressedBitVector::operator~() const {
+    CompressedBitVector result(length);
+    uint64_t position = 0;
+    for (uint64_t key = 0; key < getNumberOfChunks(); ++key) {
+        uint64_t const chunkLength = getChunkLength(key);
+        if (position < keys.size() && keys[position] == key) {
+            Container const& container = containers[position];
+            ++position;
+            if (container.type == ContainerType::Full) {
+                continue;
+            }
+            std::vector<uint64_t> words = getWords(container, chunkLength);
+            for (auto& word : words) {
+                word = ~word;
+            }
+            truncateWords(words, chunkLength);
+            result.keys.push_back(key);
+            result.containers.push_back(createContainer(words.data(), words.size(), chunkLength));
+        } else {
+            result.keys.push_back(key);
+            result.containers.push_back(createFullContainer(chunkLength));
+        }
+    }
+    return result;
+}
+
+void CompressedBitVector::complement() {
+    *this = ~*this;
+}
+
+bool CompressedBitVector::isSubsetOf(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(length == other.length, "Bit vectors of different size (" << length << " vs. " << other.length << ").");
+    uint64_t second = 0;
+    for (uint64_t first = 0; first < keys.size(); ++first) {
+        while (second < other.keys.size() && other.keys[second] < keys[first]) {
+            ++second;
+        }
+        if (second == other.keys.size() || other.keys[second] != keys[first] || containers[first].cardinality > other.containers[second].cardinality) {
+            return false;
+        }
+        if (other.containers[second].type != ContainerType::Full &&
+            intersect(containers[first], other.containers[second], getChunkLength(keys[first])).cardinality != containers[first].cardinality) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::isDisjointFrom(CompressedBitVector const& other) const {
+    STORM_LOG_ASSERT(length == other.length, "Bit vectors of different size (" << length << " vs. " << other.length << ").");
+    uint64_t second = 0;
+    for (uint64_t first = 0; first < keys.size(); ++first) {
+        while (second < other.keys.size() && other.keys[second] < keys[first]) {
+            ++second;
+        }
+        if (second < other.keys.size() && other.keys[second] == keys[first] &&
+            intersect(containers[first], other.containers[second], getChunkLength(keys[first])).cardinality > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CompressedBitVector::empty() const {
+    return containers.empty();
+}
+
+bool CompressedBitVector::full() const {
+    return getNumberOfSetBits() == length;
+}
+
+void CompressedBitVector::clear() {
+    keys.clear();
+    containers.clear();
+}
+
+void CompressedBitVector::fill() {
+    clear();
+    keys.reserve(getNumberOfChunks());
+    containers.reserve(getNumberOfChunks());
+    for (uint64_t key = 0; key < getNumberOfChunks(); ++key) {
+        keys.push_back(key);
+        containers.push_back(createFullContainer(getChunkLength(key)));
+    }
+}
+
+uint_fast64_t CompressedBitVector::getNumberOfSetBits() const {
+    uint_fast64_t result = 0;
+    for (auto const& container : containers) {
+        result += container.cardinality;
+    }
+    return result;
+}
+
+uint_fast64_t CompressedBitVector::getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const {
+    uint64_t const key = index / chunkSize;
+    uint_fast64_t result = 0;
+    uint64_t position = 0;
+    for (; position < keys.size() && keys[position] < key; ++position) {
+        result += containers[position].cardinality;
+    }
+    if (position < keys.size() && keys[position] == key) {
+        result += containerNumberOfSetBitsBefore(containers[position], index % chunkSize);
+    }
+    return result;
+}
+
+size_t CompressedBitVector::size() const {
+    return static_cast<size_t>(length);
+}
+
+std::size_t CompressedBitVector::getSizeInBytes() const {
+    std::size_t result = sizeof(*this) + keys.capacity() * sizeof(uint64_t) + containers.capacity() * sizeof(Container);
+    for (auto const& container : containers) {
+        result += container.offsets.capacity() * sizeof(uint16_t) + container.words.capacity() * sizeof(uint64_t);
+    }
+    return result;
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::begin() const {
+    return const_iterator(this, 0, 0);
+}
+
+CompressedBitVector::const_iterator CompressedBitVector::end() const {
+    return const_iterator(this, containers.size(), 0);
+}
+
+uint_fast64_t CompressedBitVector::getNextSetIndex(uint_fast64_t startingIndex) const {
+    if (startingIndex >= length) {
+        return length;
+    }
+    uint64_t const key = startingIndex / chunkSize;
+    uint64_t position = findContainer(key);
+    if (position < keys.size() && keys[position] == key) {
+        uint64_t offset = containerNextSetOffset(containers[position], startingIndex % chunkSize, getChunkLength(key));
+        if (offset < chunkSize) {
+            return key * chunkSize + offset;
+        }
+        ++position;
+    }
+    if (position < keys.size()) {
+        return keys[position] * chunkSize + containerNextSetOffset(containers[position], 0, getChunkLength(keys[position]));
+    }
+    return length;
+}
+
+uint_fast64_t CompressedBitVector::getNextUnsetIndex(uint_fast64_t startingIndex) const {
+    uint64_t index = startingIndex;
+    while (index < length) {
+        uint64_t const key = index / chunkSize;
+        uint64_t const position = findContainer(key);
+        if (position == keys.size() || keys[position] != key) {
+            return index;
+        }
+        Container const& container = containers[position];
+        uint64_t const chunkLength = getChunkLength(key);
+        uint64_t offset = index % chunkSize;
+        if (container.type == ContainerType::Array) {
+            auto it = std::lower_bound(container.offsets.begin(), container.offsets.end(), offset);
+            for (; it != container.offsets.end() && *it == offset; ++it) {
+                ++offset;
+            }
+        } else if (container.type == ContainerType::Bitmap) {
+            uint64_t wordIndex = offset >> 6;
+            uint64_t word = ~container.words[wordIndex] & (~0ull >> (offset & 63));
+            while (word == 0 && ++wordIndex < wordsPerChunk) {
+                word = ~container.words[wordIndex];
+            }
+            offset = word == 0 ? chunkSize : (wordIndex << 6) + __builtin_clzll(word);
+        } else {
+            offset = chunkSize;
+        }
+        if (offset < chunkLength) {
+            return key * chunkSize + offset;
+        }
+        index = (key + 1) * chunkSize;
+    }
+    return length;
+}
+
+bool CompressedBitVector::isCompressionBeneficial(BitVector const& bitVector) {
+    uint64_t const* words = bitVector.getWords();
+    uint64_t const numberOfWords = (bitVector.size() + 63) / 64;
+    std::size_t compressedSize = sizeof(CompressedBitVector);
+    for (uint64_t firstWord = 0; firstWord < numberOfWords && compressedSize < bitVector.getSizeInBytes(); firstWord += wordsPerChunk) {
+        uint64_t const lastWord = std::min(firstWord + wordsPerChunk, numberOfWords);
+        uint64_t const chunkLength = std::min(chunkSize, bitVector.size() - firstWord * 64);
+        uint64_t cardinality = 0;
+        for (uint64_t word = firstWord; word < lastWord; ++word) {
+            cardinality += __builtin_popcountll(words[word]);
+        }
+        if (cardinality > 0) {
+            compressedSize += sizeof(uint64_t) + sizeof(Container);
+            if (cardinality <= maximalArraySize && cardinality < chunkLength) {
+                compressedSize += cardinality * sizeof(uint16_t);
+            } else if (cardinality < chunkLength) {
+                compressedSize += wordsPerChunk * sizeof(uint64_t);
+            }
+        }
+    }
+    return compressedSize < bitVector.getSizeInBytes();
+}
+
+std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector) {
+    out << "compressed bit vector(" << bitVector.getNumberOfSetBits() << "/" << bitVector.length << ") [";
+    for (auto index : bitVector) {
+        out << index << " ";
+    }
+    out << "]";
+    return out;
+}
+
+uint64_t CompressedBitVector::getChunkLength(uint64_t key) const {
+    return std::min(chunkSize, length - key * chunkSize);
+}
+
+uint64_t CompressedBitVector::getNumberOfChunks() const {
+    return (length + chunkSize - 1) / chunkSize;
+}
+
+uint64_t CompressedBitVector::findContainer(uint64_t key) const {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+}
+
+CompressedBitVector::Container CompressedBitVector::createContainer(uint64_t const* words, uint64_t numberOfWords, uint64_t chunkLength) {
+    STORM_LOG_ASSERT(numberOfWords <= wordsPerChunk, "Too many words for a single chunk.");
+    uint64_t cardinality = 0;
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        cardinality += __builtin_popcountll(words[word]);
+    }
+    if (cardinality == chunkLength) {
+        return createFullContainer(chunkLength);
+    }
+    Container result{ContainerType::Array, static_cast<uint32_t>(cardinality), {}, {}};
+    if (cardinality <= maximalArraySize) {
+        result.offsets.reserve(cardinality);
+        for (uint64_t word = 0; word < numberOfWords; ++word) {
+            for (uint64_t remaining = words[word]; remaining != 0;) {
+                uint64_t offset = __builtin_clzll(remaining);
+                result.offsets.push_back(static_cast<uint16_t>((word << 6) + offset));
+                remaining &= ~bitMask(offset);
+            }
+        }
+    } else {
+        result.type = ContainerType::Bitmap;
+        result.words.assign(wordsPerChunk, 0);
+        std::copy_n(words, numberOfWords, result.words.begin());
+    }
+    return result;
+}
+
+CompressedBitVector::Container CompressedBitVector::createFullContainer(uint64_t chunkLength) {
+    return Container{ContainerType::Full, static_cast<uint32_t>(chunkLength), {}, {}};
+}
+
+std::vector<uint64_t> CompressedBitVector::getWords(Container const& container, uint64_t chunkLength) {
+    if (container.type == ContainerType::Bitmap) {
+        return container.words;
+    }
+    std::vector<uint64_t> result(wordsPerChunk, 0);
+    if (container.type == ContainerType::Array) {
+        for (auto const& offset : container.offsets) {
+            result[offset >> 6] |= bitMask(offset);
+        }
+    } else {
+        std::fill(result.begin(), result.end(), ~0ull);
+        truncateWords(result, chunkLength);
+    }
+    return result;
+}
+
+void CompressedBitVector::adjustRepresentation(Container& container, uint64_t chunkLength) {
+    if (container.cardinality == chunkLength) {
+        container = createFullContainer(chunkLength);
+    } else if ((container.type == ContainerType::Array) != (container.cardinality <= maximalArraySize)) {
+        std::vector<uint64_t> words = getWords(container, chunkLength);
+        container = createContainer(words.data(), words.size(), chunkLength);
+    }
+}
+
+bool CompressedBitVector::containerGet(Container const& container, uint64_t offset) {
+    switch (container.type) {
+        case ContainerType::Array:
+            return std::binary_search(container.offsets.begin(), container.offsets.end(), offset);
+        case ContainerType::Bitmap:
+            return (container.words[offset >> 6] & bitMask(offset)) != 0;
+        default:
+            return true;
+    }
+}
+
+uint64_t CompressedBitVector::containerNextSetOffset(Container const& container, uint64_t offset, uint64_t chunkLength) {
+    switch (container.type) {
+        case ContainerType::Array: {
+            auto it = std::lower_bound(container.offsets.begin(), container.offsets.end(), offset);
+            return it == container.offsets.end() ? chunkSize : *it;
+        }
+        case ContainerType::Bitmap: {
+            if (offset >= chunkSize) {
+                return chunkSize;
+            }
+            uint64_t wordIndex = offset >> 6;
+            uint64_t word = container.words[wordIndex] & (~0ull >> (offset & 63));
+            while (word == 0 && ++wordIndex < wordsPerChunk) {
+                word = container.words[wordIndex];
+            }
+            return word == 0 ? chunkSize : (wordIndex << 6) + __builtin_clzll(word);
+        }
+        default:
+            return offset < chunkLength ? offset : chunkSize;
+    }
+}
+
+uint64_t CompressedBitVector::containerNumberOfSetBitsBefore(Container const& container, uint64_t offset) {
+    switch (container.type) {
+        case ContainerType::Array:
+            return std::lower_bound(container.offsets.begin(), container.offsets.end(), offset) - container.offsets.begin();
+        case ContainerType::Bitmap: {
+            uint64_t result = 0;
+            for (uint64_t word = 0; word < (offset >> 6); ++word) {
+                result += __builtin_popcountll(container.words[word]);
+            }
+            if ((offset & 63) != 0) {
+                result += __builtin_popcountll(container.words[offset >> 6] & ~(~0ull >> (offset & 63)));
+            }
+            return result;
+        }
+        default:
+            return offset;
+    }
+}
+
+CompressedBitVector::Container CompressedBitVector::intersect(Container const& first, Container const& second, uint64_t chunkLength) {
+    if (first.type == ContainerType::Full) {
+        return second;
+    } else if (second.type == ContainerType::Full) {
+        return first;
+    } else if (first.type == ContainerType::Bitmap && second.type == ContainerType::Bitmap) {
+        std::vector<uint64_t> words(wordsPerChunk);
+        for (uint64_t word = 0; word < wordsPerChunk; ++word) {
+            words[word] = first.words[word] & second.words[word];
+        }
+        return createContainer(words.data(), words.size(), chunkLength);
+    }
+
+    // At least one of the containers is an array, so the result is an array.
+    Container result{ContainerType::Array, 0, {}, {}};
+    if (first.type == ContainerType::Array && second.type == ContainerType::Array) {
+        std::set_intersection(first.offsets.begin(), first.offsets.end(), second.offsets.begin(), second.offsets.end(), std::back_inserter(result.offsets));
+    } else {
+        Container const& array = first.type == ContainerType::Array ? first : second;
+        Container const& bitmap = first.type == ContainerType::Array ? second : first;
+        std::copy_if(array.offsets.begin(), array.offsets.end(), std::back_inserter(result.offsets),
+                     [&bitmap](uint16_t offset) { return containerGet(bitmap, offset); });
+    }
+    result.cardinality = static_cast<uint32_t>(result.offsets.size());
+    adjustRepresentation(result, chunkLength);
+    return result;
+}
+
+CompressedBitVector::Container CompressedBitVector::unite(Container const& first, Container const& second, uint64_t chunkLength) {
+    if (first.type == ContainerType::Full || second.type == ContainerType::Full) {
+        return createFullContainer(chunkLength);
+    } else if (first.type == ContainerType::Array && second.type == ContainerType::Array) {
+        Container result{ContainerType::Array, 0, {}, {}};
+        std::set_union(first.offsets.begin(), first.offsets.end(), second.offsets.begin(), second.offsets.end(), std::back_inserter(result.offsets));
+        result.cardinality = static_cast<uint32_t>(result.offsets.size());
+        adjustRepresentation(result, chunkLength);
+        return result;
+    }
+    std::vector<uint64_t> words = getWords(first, chunkLength);
+    std::vector<uint64_t> secondWords = getWords(second, chunkLength);
+    for (uint64_t word = 0; word < wordsPerChunk; ++word) {
+        words[word] |= secondWords[word];
+    }
+    return createContainer(words.data(), words.size(), chunkLength);
+}
+
+}  // namespace storage
+}  // namespace storm
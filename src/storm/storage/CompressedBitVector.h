@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A bit vector that only stores the parts of the index range that contain set bits. The range is split into chunks of
+ * 2^16 indices and every chunk with at least one set bit is stored in a container (similar to Roaring bitmaps):
+ * - chunks with few set bits store the sorted (16-bit) offsets of the set bits,
+ * - chunks with many set bits store a bitmap of 2^16 bits and
+ * - chunks whose bits are all set store nothing but their key.
+ * Hence, sets that are sparse or consist of few large blocks take much less memory than in a BitVector, which needs
+ * size() / 8 bytes regardless of its contents. The set algebra works on the containers directly.
+ *
+ * The representation of a set is unique, so two compressed bit vectors are equal iff their containers are equal.
+ */
+class CompressedBitVector {
+   public:
+    /*!
+     * An iterator over the indices of the set bits in ascending order.
+     */
+    class const_iterator {
+        friend class CompressedBitVector;
+
+       public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = uint_fast64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = uint_fast64_t*;
+        using reference = uint_fast64_t&;
+
+        const_iterator& operator++();
+        uint_fast64_t operator*() const;
+        bool operator!=(const_iterator const& other) const;
+        bool operator==(const_iterator const& other) const;
+
+       private:
+        const_iterator(CompressedBitVector const* bitVector, uint64_t containerIndex, uint64_t offset);
+
+        // Moves the iterator to the first set bit at or after the current position.
+        void moveToSetBit();
+
+        CompressedBitVector const* bitVector;
+
+        // The index of the current container and the position within the container, i.e., the position in the offset
+        // array for array containers and the offset within the chunk otherwise.
+        uint64_t containerIndex;
+        uint64_t position;
+    };
+
+    /*!
+     * Constructs an empty bit vector of length 0.
+     */
+    CompressedBitVector();
+
+    /*!
+     * Constructs a bit vector of the given length whose bits are all set to the given value.
+     */
+    explicit CompressedBitVector(uint_fast64_t length, bool init = false);
+
+    /*!
+     * Constructs a compressed bit vector with the same contents as the given bit vector.
+     */
+    explicit CompressedBitVector(BitVector const& bitVector);
+
+    /*!
+     * Converts this bit vector into an (uncompressed) BitVector.
+     */
+    BitVector toBitVector() const;
+
+    bool operator==(CompressedBitVector const& other) const;
+    bool operator!=(CompressedBitVector const& other) const;
+
+    /*!
+     * Sets the bit at the given index to the given value.
+     */
+    void set(uint_fast64_t index, bool value = true);
+
+    /*!
+     * Retrieves the value of the bit at the given index.
+     */
+    bool get(uint_fast64_t index) const;
+    bool operator[](uint_fast64_t index) const;
+
+    /*!
+     * Performs a logical "and", "or" and "not", respectively. The operands of binary operations must have the same
+     * size.
+     */
+    CompressedBitVector operator&(CompressedBitVector const& other) const;
+    CompressedBitVector& operator&=(CompressedBitVector const& other);
+    CompressedBitVector operator|(CompressedBitVector const& other) const;
+    CompressedBitVector& operator|=(CompressedBitVector const& other);
+    CompressedBitVector operator~() const;
+    void complement();
+
+    /*!
+     * Checks whether all bits set in this bit vector are also set in the given one.
+     */
+    bool isSubsetOf(CompressedBitVector const& other) const;
+
+    /*!
+     * Checks whether none of the bits set in this bit vector are set in the given one.
+     */
+    bool isDisjointFrom(CompressedBitVector const& other) const;
+
+    bool empty() const;
+    bool full() const;
+    void clear();
+    void fill();
+
+    uint_fast64_t getNumberOfSetBits() const;
+
+    /*!
+     * Retrieves the number of bits set in this bit vector with an index strictly smaller than the given one.
+     */
+    uint_fast64_t getNumberOfSetBitsBeforeIndex(uint_fast64_t index) const;
+
+    size_t size() const;
+
+    /*!
+     * Returns (an approximation of) the size of the bit vector measured in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the index of the next set (unset) bit at or after the given index. If there is none, size() is
+     * returned.
+     */
+    uint_fast64_t getNextSetIndex(uint_fast64_t startingIndex) const;
+    uint_fast64_t getNextUnsetIndex(uint_fast64_t startingIndex) const;
+
+    /*!
+     * Retrieves whether the compressed representation of the given bit vector takes less memory than the bit vector
+     * itself. This can be used to decide which of the two representations to use for a given set.
+     */
+    static bool isCompressionBeneficial(BitVector const& bitVector);
+
+    friend std::ostream& operator<<(std::ostream& out, CompressedBitVector const& bitVector);
+
+   private:
+    enum class ContainerType : uint8_t { Array, Bitmap, Full };
+
+    struct Container {
+        bool operator==(Container const& other) const;
+
+        ContainerType type;
+        // The number of set bits in the chunk.
+        uint32_t cardinality;
+        // The sorted offsets of the set bits (array containers only).
+        std::vector<uint16_t> offsets;
+        // The bits of the chunk in the layout of BitVector (bitmap containers only).
+        std::vector<uint64_t> words;
+    };
+
+    // The number of indices of a chunk, the number of 64-bit words of a bitmap and the maximal size of an array.
+    static constexpr uint64_t chunkSize = 1ull << 16;
+    static constexpr uint64_t wordsPerChunk = chunkSize / 64;
+    static constexpr uint64_t maximalArraySize = 4096;
+
+    // Retrieves the number of indices of the given chunk, which is smaller than chunkSize only for the last chunk.
+    uint64_t getChunkLength(uint64_t key) const;
+    uint64_t getNumberOfChunks() const;
+
+    // Retrieves the position of the container with the given key, or the position at which it would be inserted.
+    uint64_t findContainer(uint64_t key) const;
+
+    // Creates a container for a chunk of the given length from the given (at most wordsPerChunk) words of a bitmap. The
+    // container has cardinality zero if the bitmap is empty.
+    static Container createContainer(uint64_t const* words, uint64_t numberOfWords, uint64_t chunkLength);
+    static Container createFullContainer(uint64_t chunkLength);
+    // Retrieves the bitmap (of wordsPerChunk words) of the given container.
+    static std::vector<uint64_t> getWords(Container const& container, uint64_t chunkLength);
+    // Switches to the representation that matches the cardinality of the given container.
+    static void adjustRepresentation(Container& container, uint64_t chunkLength);
+    static bool containerGet(Container const& container, uint64_t offset);
+
+    // Retrieves the first set offset at or after the given offset, or chunkSize if there is none.
+    static uint64_t containerNextSetOffset(Container const& container, uint64_t offset, uint64_t chunkLength);
+    static uint64_t containerNumberOfSetBitsBefore(Container const& container, uint64_t offset);
+
+    static Container intersect(Container const& first, Container const& second, uint64_t chunkLength);
+    static Container unite(Container const& first, Container const& second, uint64_t chunkLength);
+
+    uint64_t length;
+    // The keys (index / chunkSize) of the non-empty chunks in ascending order and their containers.
+    std::vector<uint64_t> keys;
+    std::vector<Container> containers;
+};
+
+}  // namespace storage
+}  // namespace storm
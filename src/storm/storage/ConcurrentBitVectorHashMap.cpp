@@ -0,0 +1,242 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                     uint64_t shard)
+    : map(&map), shard(shard) {
+    if (shard < map.shards.size()) {
+        shardIt.emplace(map.shards[shard]->map.begin());
+        skipExhaustedShards();
+    }
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipExhaustedShards() {
+    while (shard < map->shards.size() && shardIt.get() == map->shards[shard]->map.end()) {
+        ++shard;
+        if (shard < map->shards.size()) {
+            shardIt.emplace(map->shards[shard]->map.begin());
+        } else {
+            shardIt = boost::none;
+        }
+    }
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+    if (map != other.map || shard != other.shard) {
+        return false;
+    }
+    // Iterators past the last shard do not have a position within a shard.
+    return !shardIt || shardIt.get() == other.shardIt.get();
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+    return ++(*this);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    ++shardIt.get();
+    skipExhaustedShards();
+    return *this;
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    return *shardIt.get();
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Shard::Shard(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : map(bucketSize, initialSize, loadFactor) {
+    // Intentionally left empty.
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, uint64_t numberOfShards, double loadFactor)
+    : bucketSize(bucketSize), loadFactor(loadFactor), shardBits(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    while ((1ull << shardBits) < numberOfShards) {
+        ++shardBits;
+    }
+
+    uint64_t initialShardSize = std::max<uint64_t>(initialSize >> shardBits, 1ull);
+    shards.reserve(1ull << shardBits);
+    for (uint64_t shard = 0; shard < (1ull << shardBits); ++shard) {
+        shards.push_back(std::make_unique<Shard>(bucketSize, initialShardSize, loadFactor));
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const& other)
+    : bucketSize(other.bucketSize), loadFactor(other.loadFactor), shardBits(other.shardBits), hasher(other.hasher) {
+    shards.reserve(other.shards.size());
+    for (auto const& otherShard : other.shards) {
+        std::shared_lock<std::shared_mutex> lock(otherShard->mutex);
+        shards.push_back(std::make_unique<Shard>(bucketSize, 1, loadFactor));
+        shards.back()->map = otherShard->map;
+    }
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>& ConcurrentBitVectorHashMap<ValueType, Hash>::operator=(ConcurrentBitVectorHashMap const& other) {
+    if (this != &other) {
+        *this = ConcurrentBitVectorHashMap(other);
+    }
+    return *this;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getShardIndex(storm::storage::BitVector const& key) const {
+    if (shardBits == 0) {
+        return 0;
+    }
+    // The shards use the upper bits of the hash value to determine the bucket, so we scramble the hash value
+    // (Fibonacci hashing) to obtain a shard index that is independent of them.
+    return (static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull) >> (64 - shardBits);
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                   ValueType const& value) {
+    uint64_t shardIndex = getShardIndex(key);
+    Shard& shard = *shards[shardIndex];
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto valueBucketPair = shard.map.findOrAddAndGetBucket(key, value);
+    return std::make_pair(valueBucketPair.first, (valueBucketPair.second << shardBits) | shardIndex);
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddUsingGenerator(storm::storage::BitVector const& key,
+                                                                                                 std::function<ValueType()> const& valueGenerator) {
+    Shard& shard = *shards[getShardIndex(key)];
+    {
+        // Most lookups hit known keys, so we first try with a shared lock.
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        if (shard.map.contains(key)) {
+            return std::make_pair(shard.map.getValue(key), false);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    // Another thread may have inserted the key in the meantime.
+    if (shard.map.contains(key)) {
+        return std::make_pair(shard.map.getValue(key), false);
+    }
+    ValueType value = valueGenerator();
+    shard.map.findOrAdd(key, value);
+    return std::make_pair(value, true);
+}
+
+template<class ValueType, class Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    Shard const& shard = *shards[bucket & ((1ull << shardBits) - 1)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.getBucketAndValue(bucket >> shardBits);
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    Shard const& shard = *shards[getShardIndex(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.getValue(key);
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+    Shard const& shard = *shards[bucket & ((1ull << shardBits) - 1)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.getValue(bucket >> shardBits);
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    Shard const& shard = *shards[getShardIndex(key)];
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.contains(key);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, shards.size());
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    uint64_t result = 0;
+    for (auto const& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        result += shard->map.size();
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    uint64_t result = 0;
+    for (auto const& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard->mutex);
+        result += shard->map.capacity();
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketSize() const {
+    return bucketSize;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getNumberOfShards() const {
+    return shards.size();
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& shard : shards) {
+        shard->map.remap(remapping);
+    }
+}
+
+template<class ValueType, class Hash>
+BitVectorHashMap<ValueType, Hash> ConcurrentBitVectorHashMap<ValueType, Hash>::toBitVectorHashMap() const {
+    BitVectorHashMap<ValueType, Hash> result(bucketSize, std::max<uint64_t>(size(), 1ull), loadFactor);
+    for (auto const& shard : shards) {
+        for (auto const& keyValuePair : shard->map) {
+            result.findOrAdd(keyValuePair.first, keyValuePair.second);
+        }
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
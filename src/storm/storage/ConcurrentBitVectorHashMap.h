@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A hash-map whose keys are bit vectors that may be accessed by multiple threads concurrently. The map is split
+ * into a number of shards, each of which is a BitVectorHashMap guarded by its own lock. The shard of a key is
+ * determined by its hash value, so threads inserting different keys rarely contend. As every shard grows
+ * independently, a resize only rehashes the elements of a single shard while the other shards remain accessible,
+ * and the temporary memory overhead of a resize is limited to the size of one shard.
+ *
+ * Bucket indices returned by this map encode the shard in their lowest bits. Like the bucket indices of
+ * BitVectorHashMap, they are only stable as long as no further elements are inserted.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*!
+         * Creates an iterator that points to the first element of the given shard (or a later shard, if the given
+         * one is empty).
+         *
+         * @param map The map of the iterator.
+         * @param shard The index of the shard.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t shard);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++(int);
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        /*!
+         * Moves the iterator to the next non-empty shard (starting with the current one) if it reached the end of
+         * the current shard.
+         */
+        void skipExhaustedShards();
+
+        // The map this iterator refers to.
+        ConcurrentBitVectorHashMap const* map;
+
+        // The shard the iterator currently points into.
+        uint64_t shard;
+
+        // The position within the current shard.
+        boost::optional<typename BitVectorHashMap<ValueType, Hash>::const_iterator> shardIt;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (in total over all shards).
+     * @param numberOfShards The number of independently locked shards. This is rounded up to a power of two.
+     * @param loadFactor The load factor that determines at which point the size of a shard is increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, uint64_t numberOfShards = 64, double loadFactor = 0.75);
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const& other);
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap&&) = default;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const& other);
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap&&) = default;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the bucket into which the key
+     * was inserted.
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is not found, the key is inserted with the value obtained from
+     * the given generator. The generator is only invoked if the key is inserted and while the shard of the key is
+     * locked, which makes it possible to, e.g., hand out consecutive indices to new keys by means of an atomic
+     * counter. This method may be called concurrently.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator A function that yields the value for the key, if the key is inserted.
+     * @return A pair whose first component is the value of the key and whose second component indicates whether
+     * the key was inserted.
+     */
+    std::pair<ValueType, bool> findOrAddUsingGenerator(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+     *
+     * @param bucket The index of the bucket.
+     * @return The content and value of the named bucket.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined. This method may be called concurrently.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given bucket.
+     *
+     * @return The value associated with the given bucket (if any).
+     */
+    ValueType getValue(uint64_t bucket) const;
+
+    /*!
+     * Checks if the given key is already contained in the map. This method may be called concurrently.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map. The map must not be modified while it is iterated.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the capacity of the underlying containers (in total over all shards).
+     *
+     * @return The capacity of the underlying containers.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Retrieves the size of the buckets, i.e., the number of bits of the keys.
+     *
+     * @return The size of the buckets.
+     */
+    uint64_t getBucketSize() const;
+
+    /*!
+     * Retrieves the number of shards of this map.
+     *
+     * @return The number of shards.
+     */
+    uint64_t getNumberOfShards() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping. This must not be called
+     * concurrently with other methods.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+    /*!
+     * Copies the contents of this map into a (sequential) BitVectorHashMap. This must not be called concurrently
+     * with modifications of the map.
+     *
+     * @return A BitVectorHashMap with the same contents.
+     */
+    BitVectorHashMap<ValueType, Hash> toBitVectorHashMap() const;
+
+   private:
+    struct Shard {
+        Shard(uint64_t bucketSize, uint64_t initialSize, double loadFactor);
+
+        // The lock guarding the shard.
+        mutable std::shared_mutex mutex;
+
+        // The elements of the shard.
+        BitVectorHashMap<ValueType, Hash> map;
+    };
+
+    /*!
+     * Retrieves the index of the shard responsible for the given key.
+     */
+    uint64_t getShardIndex(storm::storage::BitVector const& key) const;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The load factor determining when the size of a shard is increased.
+    double loadFactor;
+
+    // The number of shards is 2^shardBits.
+    uint64_t shardBits;
+
+    // The shards holding the elements of the map.
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    // Functor object that is used to determine the shard of a key.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
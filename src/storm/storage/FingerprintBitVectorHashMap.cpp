@@ -0,0 +1,280 @@
+#include "storm/storage/FingerprintBitVectorHashMap.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+// SSE2 is part of x86-64, so the control bytes of a group can be compared with SSE2 without checking the CPU at runtime.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_FINGERPRINT_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace storm {
+namespace storage {
+
+namespace {
+
+// The number of slots whose control bytes are compared at once.
+uint64_t const groupWidth = 16;
+
+// The control byte of empty slots. Full slots hold a 7-bit fingerprint, i.e. their highest bit is not set.
+uint8_t const emptyControl = 0x80;
+
+// The constants of wyhash.
+uint64_t const wyPrime0 = 0xa0761d6478bd642full;
+uint64_t const wyPrime1 = 0xe7037ed1a0b428dbull;
+uint64_t const wyPrime2 = 0x8ebc6af09c88c6e3ull;
+
+/*
+ * Multiplies the given values and folds the upper half of the 128 bit product into the lower half.
+ */
+inline uint64_t wyMix(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    uint64_t const aLow = a & 0xffffffffull, aHigh = a >> 32, bLow = b & 0xffffffffull, bHigh = b >> 32;
+    uint64_t const lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+    uint64_t const middle = (lowLow >> 32) + (lowHigh & 0xffffffffull) + (highLow & 0xffffffffull);
+    uint64_t const low = (lowLow & 0xffffffffull) | (middle << 32);
+    uint64_t const high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return low ^ high;
+#endif
+}
+
+/*
+ * Retrieves a mask whose i-th bit is set iff the i-th of the (groupWidth many) given control bytes is equal to the given byte.
+ */
+inline uint32_t matchGroup(uint8_t const* group, uint8_t byte) {
+#ifdef STORM_FINGERPRINT_SSE2
+    __m128i const controlBytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(static_cast<char>(byte)))));
+#else
+    uint32_t result = 0;
+    for (uint64_t index = 0; index < groupWidth; ++index) {
+        if (group[index] == byte) {
+            result |= 1u << index;
+        }
+    }
+    return result;
+#endif
+}
+
+/*
+ * Retrieves the index of the lowest set bit of the given (non-zero) mask.
+ */
+inline uint64_t getLowestSetBit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    uint64_t result = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+}  // namespace
+
+uint64_t WyBitVectorHash::operator()(storm::storage::BitVector const& bv) const {
+    return hashWords(bv.getWords(), (bv.size() + 63) / 64);
+}
+
+uint64_t WyBitVectorHash::hashWords(uint64_t const* words, uint64_t numberOfWords) {
+    uint64_t const length = numberOfWords * 8;
+    uint64_t seed = wyPrime0 ^ length;
+    uint64_t index = 0;
+    for (; index + 1 < numberOfWords; index += 2) {
+        seed = wyMix(words[index] ^ wyPrime1, words[index + 1] ^ seed);
+    }
+    if (index < numberOfWords) {
+        seed = wyMix(words[index] ^ wyPrime1, seed ^ wyPrime2);
+    }
+    return wyMix(seed ^ wyPrime2, length ^ wyPrime1);
+}
+
+template<typename ValueType, typename Hash>
+FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::FingerprintBitVectorHashMapIterator(FingerprintBitVectorHashMap const& map,
+                                                                                                                      uint64_t entry)
+    : map(&map), entry(entry) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename Hash>
+bool FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::operator==(FingerprintBitVectorHashMapIterator const& other) const {
+    return map == other.map && entry == other.entry;
+}
+
+template<typename ValueType, typename Hash>
+bool FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::operator!=(FingerprintBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename ValueType, typename Hash>
+typename FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator&
+FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::operator++(int) {
+    ++entry;
+    return *this;
+}
+
+template<typename ValueType, typename Hash>
+typename FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator&
+FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::operator++() {
+    ++entry;
+    return *this;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<storm::storage::BitVector, ValueType> FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMapIterator::operator*() const {
+    return map->getBucketAndValue(entry);
+}
+
+template<typename ValueType, typename Hash>
+FingerprintBitVectorHashMap<ValueType, Hash>::FingerprintBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : bucketSize(bucketSize), wordsPerKey((bucketSize + 63) / 64), loadFactor(loadFactor) {
+    STORM_LOG_ASSERT(loadFactor > 0.0 && loadFactor < 1.0, "Illegal load factor " << loadFactor << ".");
+
+    // The number of slots is a power of two (and at least one group) such that the initial keys fit without growing the table.
+    uint64_t numberOfSlots = groupWidth;
+    while (static_cast<double>(numberOfSlots) * loadFactor <= static_cast<double>(initialSize)) {
+        numberOfSlots <<= 1;
+    }
+    control = std::vector<uint8_t>(numberOfSlots, emptyControl);
+    slots = std::vector<uint64_t>(numberOfSlots);
+    keys.reserve(initialSize * wordsPerKey);
+    values.reserve(initialSize);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<bool, uint64_t> FingerprintBitVectorHashMap<ValueType, Hash>::findSlot(uint64_t const* key, uint64_t hash) const {
+    uint64_t const groupMask = control.size() / groupWidth - 1;
+    uint8_t const fingerprint = static_cast<uint8_t>(hash & 0x7f);
+
+    // As the load factor is below one, there is an empty slot in some group, so the loop terminates.
+    for (uint64_t group = (hash >> 7) & groupMask;; group = (group + 1) & groupMask) {
+        uint8_t const* groupControl = control.data() + group * groupWidth;
+        for (uint32_t matches = matchGroup(groupControl, fingerprint); matches != 0; matches &= matches - 1) {
+            uint64_t const slot = group * groupWidth + getLowestSetBit(matches);
+            uint64_t const* candidate = keys.data() + slots[slot] * wordsPerKey;
+            if (std::equal(key, key + wordsPerKey, candidate)) {
+                return std::make_pair(true, slot);
+            }
+        }
+        // Since entries are never removed, the key can not be in a later group if this group has an empty slot.
+        uint32_t const empty = matchGroup(groupControl, emptyControl);
+        if (empty != 0) {
+            return std::make_pair(false, group * groupWidth + getLowestSetBit(empty));
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+void FingerprintBitVectorHashMap<ValueType, Hash>::increaseSize() {
+    uint64_t const numberOfSlots = 2 * control.size();
+    STORM_LOG_TRACE("Increasing number of slots of hash map from " << control.size() << " to " << numberOfSlots << ".");
+    control.assign(numberOfSlots, emptyControl);
+    slots.assign(numberOfSlots, 0);
+
+    // The keys stay in the arena, so only their slots need to be recomputed.
+    for (uint64_t entry = 0; entry < values.size(); ++entry) {
+        uint64_t const* key = keys.data() + entry * wordsPerKey;
+        uint64_t const hash = Hash::hashWords(key, wordsPerKey);
+        std::pair<bool, uint64_t> flagAndSlot = findSlot(key, hash);
+        STORM_LOG_ASSERT(!flagAndSlot.first, "Duplicate key in hash map.");
+        control[flagAndSlot.second] = static_cast<uint8_t>(hash & 0x7f);
+        slots[flagAndSlot.second] = entry;
+    }
+}
+
+template<typename ValueType, typename Hash>
+ValueType FingerprintBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, uint64_t> FingerprintBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key,
+                                                                                                   ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const* words = key.getWords();
+    uint64_t const hash = Hash::hashWords(words, wordsPerKey);
+    std::pair<bool, uint64_t> flagAndSlot = findSlot(words, hash);
+    if (flagAndSlot.first) {
+        uint64_t const entry = slots[flagAndSlot.second];
+        return std::make_pair(values[entry], entry);
+    }
+
+    // The table only grows if the key is actually inserted, which keeps lookups of known keys free of any bookkeeping.
+    if (static_cast<double>(values.size() + 1) > loadFactor * static_cast<double>(control.size())) {
+        increaseSize();
+        flagAndSlot = findSlot(words, hash);
+    }
+    uint64_t const entry = values.size();
+    control[flagAndSlot.second] = static_cast<uint8_t>(hash & 0x7f);
+    slots[flagAndSlot.second] = entry;
+    keys.insert(keys.end(), words, words + wordsPerKey);
+    values.push_back(value);
+    return std::make_pair(value, entry);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<storm::storage::BitVector, ValueType> FingerprintBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+    return std::make_pair(storm::storage::BitVector::fromWords(bucketSize, keys.data() + bucket * wordsPerKey), values[bucket]);
+}
+
+template<typename ValueType, typename Hash>
+ValueType FingerprintBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagAndSlot = findSlot(key.getWords(), Hash::hashWords(key.getWords(), wordsPerKey));
+    STORM_LOG_ASSERT(flagAndSlot.first, "Unknown key.");
+    return values[slots[flagAndSlot.second]];
+}
+
+template<typename ValueType, typename Hash>
+ValueType FingerprintBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+    return values[bucket];
+}
+
+template<typename ValueType, typename Hash>
+bool FingerprintBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return findSlot(key.getWords(), Hash::hashWords(key.getWords(), wordsPerKey)).first;
+}
+
+template<typename ValueType, typename Hash>
+typename FingerprintBitVectorHashMap<ValueType, Hash>::const_iterator FingerprintBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<typename ValueType, typename Hash>
+typename FingerprintBitVectorHashMap<ValueType, Hash>::const_iterator FingerprintBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, values.size());
+}
+
+template<typename ValueType, typename Hash>
+uint64_t FingerprintBitVectorHashMap<ValueType, Hash>::size() const {
+    return values.size();
+}
+
+template<typename ValueType, typename Hash>
+uint64_t FingerprintBitVectorHashMap<ValueType, Hash>::capacity() const {
+    return control.size();
+}
+
+template<typename ValueType, typename Hash>
+uint64_t FingerprintBitVectorHashMap<ValueType, Hash>::getSizeInMemory() const {
+    return sizeof(*this) + control.capacity() * sizeof(uint8_t) + slots.capacity() * sizeof(uint64_t) + keys.capacity() * sizeof(uint64_t) +
+           values.capacity() * sizeof(ValueType);
+}
+
+template<typename ValueType, typename Hash>
+void FingerprintBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& value : values) {
+        value = remapping(value);
+    }
+}
+
+template class FingerprintBitVectorHashMap<uint64_t>;
+template class FingerprintBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A fast (non-cryptographic) hash for bit vectors in the spirit of wyhash. It folds two words of the bit vector at a time into the state with a
+ * 64x64->128 bit multiplication.
+ */
+struct WyBitVectorHash {
+    uint64_t operator()(storm::storage::BitVector const& bv) const;
+
+    /*!
+     * Hashes the given words. Hashing the words of a bit vector yields the same value as hashing the bit vector.
+     */
+    static uint64_t hashWords(uint64_t const* words, uint64_t numberOfWords);
+};
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors of a fixed length. It offers the same interface as
+ * BitVectorHashMap, but uses a different layout that is tailored to maps in which most queried keys are already contained:
+ *
+ * - The table only holds one control byte (a 7-bit fingerprint of the hash of the key or a marker for empty slots) and the index of an entry per
+ * slot. The slots are probed in groups of 16, whose control bytes are compared to the fingerprint at once (using SSE2 if available). Keys are
+ * only compared if their fingerprints match, which rarely happens for keys other than the searched one.
+ * - The keys are stored contiguously in the order of their insertion in a separate arena. In contrast to BitVectorHashMap, the bucket of a key
+ * thus is the (stable) index of its entry, and growing the table neither moves the keys nor the values.
+ *
+ * The hash functor needs to provide a static method hashWords (like WyBitVectorHash), as keys are rehashed from the arena when the table grows.
+ */
+template<typename ValueType, typename Hash = WyBitVectorHash>
+class FingerprintBitVectorHashMap {
+   public:
+    class FingerprintBitVectorHashMapIterator {
+       public:
+        /*! Creates an iterator that points to the entry with the given index in the given map.
+         *
+         * @param map The map of the iterator.
+         * @param entry The index of the entry the iterator points to.
+         */
+        FingerprintBitVectorHashMapIterator(FingerprintBitVectorHashMap const& map, uint64_t entry);
+
+        // Methods to compare two iterators.
+        bool operator==(FingerprintBitVectorHashMapIterator const& other) const;
+        bool operator!=(FingerprintBitVectorHashMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        FingerprintBitVectorHashMapIterator& operator++(int);
+        FingerprintBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // The map this iterator refers to.
+        FingerprintBitVectorHashMap const* map;
+
+        // The index of the entry this iterator points to.
+        uint64_t entry;
+    };
+
+    typedef FingerprintBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map for keys of the given size.
+     *
+     * @param bucketSize The size of the keys that this map can hold. In contrast to BitVectorHashMap, this does not need to be a multiple of 64.
+     * @param initialSize The number of keys for which space is initially reserved.
+     * @param loadFactor The load factor that determines at which point the number of slots is increased.
+     */
+    FingerprintBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.875);
+
+    // The following methods behave like the ones of BitVectorHashMap, except that buckets are the indices of the entries in the order of insertion.
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+    ValueType getValue(storm::storage::BitVector const& key) const;
+    ValueType getValue(uint64_t bucket) const;
+    bool contains(storm::storage::BitVector const& key) const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    uint64_t size() const;
+    uint64_t getSizeInMemory() const;
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+    /*!
+     * Retrieves the number of slots of the table.
+     */
+    uint64_t capacity() const;
+
+   private:
+    /*!
+     * Searches for the slot of the given key.
+     *
+     * @param key The words of the key to search for.
+     * @param hash The hash of the key.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second component is the slot holding the
+     * key (if it is contained) or the empty slot into which the key is to be inserted (otherwise).
+     */
+    std::pair<bool, uint64_t> findSlot(uint64_t const* key, uint64_t hash) const;
+
+    /*!
+     * Doubles the number of slots and reinserts all entries.
+     */
+    void increaseSize();
+
+    // The number of bits of each key.
+    uint64_t bucketSize;
+
+    // The number of words of each key.
+    uint64_t wordsPerKey;
+
+    // The load factor determining when the number of slots is increased.
+    double loadFactor;
+
+    // The control bytes of the slots (one per slot). The highest bit marks empty slots, the remaining bits of a full slot hold the fingerprint.
+    std::vector<uint8_t> control;
+
+    // The index of the entry held by each slot.
+    std::vector<uint64_t> slots;
+
+    // The words of the keys, where the key of entry i occupies the words starting at i * wordsPerKey.
+    std::vector<uint64_t> keys;
+
+    // The values of the entries.
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
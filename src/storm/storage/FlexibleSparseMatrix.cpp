@@ -1,5 +1,7 @@
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -11,7 +13,7 @@
 namespace storm {
 namespace storage {
 template<typename ValueType>
-FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0) {
+FlexibleSparseMatrix<ValueType>::FlexibleSparseMatrix(index_type rows) : data(rows), columnCount(0), nonzeroEntryCount(0), trivialRowGrouping(true) {
     // Intentionally left empty.
 }
 
@@ -167,13 +169,9 @@ void FlexibleSparseMatrix<ValueType>::filterEntries(storm::storage::BitVector co
             row.shrink_to_fit();
             continue;
         }
-        row_type newRow;
-        for (auto const& element : row) {
-            if (columnConstraint.get(element.getColumn())) {
-                newRow.push_back(element);
-            }
-        }
-        row = std::move(newRow);
+        // Filter the row in place to avoid allocating a new one.
+        row.erase(std::remove_if(row.begin(), row.end(), [&columnConstraint](entry_type const& element) { return !columnConstraint.get(element.getColumn()); }),
+                  row.end());
     }
 }
 
@@ -1,9 +1,12 @@
 #ifndef STORM_STORAGE_FLEXIBLESPARSEMATRIX_H_
 #define STORM_STORAGE_FLEXIBLESPARSEMATRIX_H_
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/StateType.h"
 
@@ -16,6 +19,9 @@ class BitVector;
 
 /*!
  * The flexible sparse matrix is used during state elimination.
+ *
+ * Rows provide the interface of a vector. As most rows only have few entries, the entries of short rows are stored
+ * within the row itself, i.e., contiguously in the storage of the rows, and only longer rows allocate memory.
  */
 template<typename ValueType>
 class FlexibleSparseMatrix {
@@ -25,7 +31,12 @@ class FlexibleSparseMatrix {
 
     typedef uint_fast64_t index_type;
     typedef ValueType value_type;
-    typedef std::vector<storm::storage::MatrixEntry<index_type, value_type>> row_type;
+    typedef storm::storage::MatrixEntry<index_type, value_type> entry_type;
+
+    // The number of entries that are stored without allocating memory (such that they take up to 64 bytes).
+    static const std::size_t inlineRowCapacity = std::max<std::size_t>(1, 64 / sizeof(entry_type));
+
+    typedef boost::container::small_vector<entry_type, inlineRowCapacity> row_type;
     typedef typename row_type::iterator iterator;
     typedef typename row_type::const_iterator const_iterator;
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <limits>
 #include <list>
 #include <numeric>
 #include <queue>
@@ -6,6 +8,7 @@
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
@@ -19,7 +22,7 @@ template<typename ValueType>
 template<typename RewardModelType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(
     storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitionPattern());
 }
 
 template<typename ValueType>
@@ -43,10 +46,24 @@ MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(st
     performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
 }
 
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparsePattern const& backwardTransitions) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+}
+
+template<typename ValueType>
+MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                              storm::storage::SparsePattern const& backwardTransitions,
+                                                                              storm::storage::BitVector const& states,
+                                                                              storm::storage::BitVector const* choices) {
+    performMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, choices);
+}
+
 template<typename ValueType>
 MaximalEndComponentDecomposition<ValueType>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model,
                                                                               storm::storage::BitVector const& states) {
-    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states);
+    performMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitionPattern(), &states);
 }
 
 template<typename ValueType>
@@ -72,10 +89,17 @@ MaximalEndComponentDecomposition<ValueType>& MaximalEndComponentDecomposition<Va
 }
 
 template<typename ValueType>
+template<typename BackwardTransitionsType>
 void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                          storm::storage::SparseMatrix<ValueType> backwardTransitions,
+                                                                                          BackwardTransitionsType const& backwardTransitions,
                                                                                           storm::storage::BitVector const* states,
                                                                                           storm::storage::BitVector const* choices) {
+    uint64_t numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads > 1) {
+        performParallelMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, states, choices, numberOfThreads);
+        return;
+    }
+
     // Get some data for convenient access.
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -233,6 +257,165 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
 }
 
+template<typename ValueType>
+template<typename BackwardTransitionsType>
+void MaximalEndComponentDecomposition<ValueType>::performParallelMaximalEndComponentDecomposition(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, BackwardTransitionsType const& backwardTransitions,
+    storm::storage::BitVector const* states, storm::storage::BitVector const* choices, uint64_t numberOfThreads) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
+
+    // The choices that (still) might be part of a MEC. The bit vector is passed to the SCC decomposition, whereas the
+    // threads only write the byte vector (which is free of data races as every choice is handled by a single thread).
+    storm::storage::BitVector includedChoices;
+    if (choices) {
+        includedChoices = *choices;
+        if (states) {
+            includedChoices &= transitionMatrix.getRowFilter(*states, *states);
+        }
+    } else if (states) {
+        includedChoices = transitionMatrix.getRowFilter(*states, *states);
+    } else {
+        includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+    }
+    std::vector<uint8_t> choiceIncluded(transitionMatrix.getRowCount(), 0);
+    for (auto choice : includedChoices) {
+        choiceIncluded[choice] = 1;
+    }
+
+    storm::storage::BitVector candidateStates = states ? *states : storm::storage::BitVector(numberOfStates, true);
+    std::vector<uint64_t> stateToSccMapping(numberOfStates, noScc);
+    std::vector<uint8_t> stateRemoved(numberOfStates, 0);
+    std::vector<StateBlock> endComponentStateSets;
+
+    struct ThreadResult {
+        std::vector<uint64_t> removedChoices;
+        std::vector<uint64_t> removedStates;
+        std::vector<uint64_t> unchangedSccs;
+        std::vector<uint64_t> changedSccs;
+    };
+    std::vector<ThreadResult> threadResults(numberOfThreads);
+
+    while (!candidateStates.empty()) {
+        // All candidates are refined at once. Note that the included choices of the candidates do not leave them, so
+        // the SCCs of all candidates are the SCCs of their union.
+        StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions()
+                                                                                      .subsystem(&candidateStates)
+                                                                                      .choices(&includedChoices)
+                                                                                      .dropNaiveSccs()
+                                                                                      .numberOfThreads(numberOfThreads));
+        for (auto state : candidateStates) {
+            stateToSccMapping[state] = noScc;
+        }
+        storm::utility::parallel::forEachChunk(0, sccs.size(), 1, numberOfThreads, [&](uint64_t, uint64_t begin, uint64_t end) {
+            for (uint64_t sccIndex = begin; sccIndex < end; ++sccIndex) {
+                for (auto state : sccs[sccIndex]) {
+                    stateToSccMapping[state] = sccIndex;
+                }
+            }
+        });
+
+        // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
+        storm::utility::parallel::forEachChunk(0, sccs.size(), 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            ThreadResult& result = threadResults[threadIndex];
+            std::vector<uint64_t> statesToCheck;
+            std::vector<uint64_t> statesToRemove;
+            for (uint64_t sccIndex = begin; sccIndex < end; ++sccIndex) {
+                auto isInScc = [&](uint64_t state) { return stateToSccMapping[state] == sccIndex && !stateRemoved[state]; };
+                statesToCheck.assign(sccs[sccIndex].begin(), sccs[sccIndex].end());
+                bool sccChanged = false;
+                while (!statesToCheck.empty()) {
+                    statesToRemove.clear();
+                    for (auto state : statesToCheck) {
+                        bool keepStateInMEC = false;
+                        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                            if (!choiceIncluded[choice]) {
+                                continue;
+                            }
+                            bool choiceContainedInMEC = true;
+                            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                                if (!storm::utility::isZero(entry.getValue()) && !isInScc(entry.getColumn())) {
+                                    choiceIncluded[choice] = 0;
+                                    result.removedChoices.push_back(choice);
+                                    choiceContainedInMEC = false;
+                                    break;
+                                }
+                            }
+                            keepStateInMEC |= choiceContainedInMEC;
+                        }
+                        if (!keepStateInMEC) {
+                            statesToRemove.push_back(state);
+                        }
+                    }
+
+                    // Erase the states that have no option to stay inside the MEC and reconsider their predecessors.
+                    for (auto state : statesToRemove) {
+                        stateRemoved[state] = 1;
+                        result.removedStates.push_back(state);
+                    }
+                    sccChanged |= !statesToRemove.empty();
+                    statesToCheck.clear();
+                    for (auto state : statesToRemove) {
+                        for (auto const& entry : backwardTransitions.getRow(state)) {
+                            if (isInScc(entry.getColumn())) {
+                                statesToCheck.push_back(entry.getColumn());
+                            }
+                        }
+                    }
+                    std::sort(statesToCheck.begin(), statesToCheck.end());
+                    statesToCheck.erase(std::unique(statesToCheck.begin(), statesToCheck.end()), statesToCheck.end());
+                }
+                (sccChanged ? result.changedSccs : result.unchangedSccs).push_back(sccIndex);
+            }
+        });
+
+        // SCCs that did not change are MECs, whereas the remaining states of the other SCCs are the new candidates.
+        candidateStates.clear();
+        for (auto& result : threadResults) {
+            for (auto choice : result.removedChoices) {
+                includedChoices.set(choice, false);
+            }
+            for (auto state : result.removedStates) {
+                stateToSccMapping[state] = noScc;
+                stateRemoved[state] = 0;
+            }
+            for (auto sccIndex : result.changedSccs) {
+                for (auto state : sccs[sccIndex]) {
+                    if (stateToSccMapping[state] != noScc) {
+                        candidateStates.set(state, true);
+                    }
+                }
+            }
+            for (auto sccIndex : result.unchangedSccs) {
+                endComponentStateSets.push_back(std::move(sccs[sccIndex]));
+            }
+            result = ThreadResult();
+        }
+    }
+
+    // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
+    // contained in the MEC and store them as actual MECs.
+    this->blocks.clear();
+    this->blocks.resize(endComponentStateSets.size());
+    storm::utility::parallel::forEachChunk(0, endComponentStateSets.size(), 1, numberOfThreads, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t mecIndex = begin; mecIndex < end; ++mecIndex) {
+            for (auto state : endComponentStateSets[mecIndex]) {
+                MaximalEndComponent::set_type containedChoices;
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    if (choiceIncluded[choice]) {
+                        containedChoices.insert(choice);
+                    }
+                }
+                STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
+                this->blocks[mecIndex].addState(state, std::move(containedChoices));
+            }
+        }
+    });
+
+    STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s) using " << numberOfThreads << " thread(s).");
+}
+
 // Explicitly instantiate the MEC decomposition.
 template class MaximalEndComponentDecomposition<double>;
 template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
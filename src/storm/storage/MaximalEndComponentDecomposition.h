@@ -4,6 +4,7 @@
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/storage/Decomposition.h"
 #include "storm/storage/MaximalEndComponent.h"
+#include "storm/storage/SparsePattern.h"
 
 namespace storm {
 namespace storage {
@@ -58,6 +59,27 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states,
                                      storm::storage::BitVector const& choices);
 
+    /*
+     * Creates an MEC decomposition of the given model (represented by a row-grouped matrix), where the reversed
+     * transition relation is only given by its pattern.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransitions The pattern of the reversed transition relation.
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions);
+
+    /*
+     * Creates an MEC decomposition of the given subsystem of given model (represented by a row-grouped matrix), where
+     * the reversed transition relation is only given by its pattern.
+     *
+     * @param transitionMatrix The transition relation of model to decompose into MECs.
+     * @param backwardTransitions The pattern of the reversed transition relation.
+     * @param states The states of the subsystem to decompose.
+     * @param choices The choices of the subsystem to decompose (if given).
+     */
+    MaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions,
+                                     storm::storage::BitVector const& states, storm::storage::BitVector const* choices = nullptr);
+
     /*!
      * Creates an MEC decomposition of the given subsystem in the given model.
      *
@@ -100,13 +122,30 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      * this stores the MECs found in the current decomposition.
      *
      * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
-     * @param backwardTransitions The reversed transition relation.
+     * @param backwardTransitions The reversed transition relation (either a matrix or its pattern).
      * @param states The states of the subsystem to decompose.
      * @param choices The choices of the subsystem to decompose.
      */
+    template<typename BackwardTransitionsType>
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                 storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
+                                                 BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const* states = nullptr,
                                                  storm::storage::BitVector const* choices = nullptr);
+
+    /*!
+     * Performs the decomposition like performMaximalEndComponentDecomposition, but refines all MEC candidates at once using
+     * the given number of threads, based on a parallel SCC decomposition.
+     *
+     * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
+     * @param backwardTransitions The reversed transition relation (either a matrix or its pattern).
+     * @param states The states of the subsystem to decompose.
+     * @param choices The choices of the subsystem to decompose.
+     * @param numberOfThreads The number of threads to use.
+     */
+    template<typename BackwardTransitionsType>
+    void performParallelMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                         BackwardTransitionsType const& backwardTransitions,
+                                                         storm::storage::BitVector const* states, storm::storage::BitVector const* choices,
+                                                         uint64_t numberOfThreads);
 };
 }  // namespace storage
 }  // namespace storm
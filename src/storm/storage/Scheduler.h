@@ -100,6 +100,11 @@ class Scheduler {
      */
     bool isMemorylessScheduler() const;
 
+    /*!
+     * Retrieves the number of model states this scheduler considers.
+     */
+    uint_fast64_t getNumberOfModelStates() const;
+
     /*!
      * Retrieves the number of memory states this scheduler considers.
      */
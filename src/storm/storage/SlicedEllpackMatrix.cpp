@@ -0,0 +1,203 @@
+#include "storm/storage/SlicedEllpackMatrix.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename IndexType>
+SlicedEllpackMatrix<ValueType, IndexType>::SlicedEllpackMatrix(SparseMatrix<ValueType> const& matrix, uint64_t sliceSize, uint64_t sortingScope)
+    : rowCount(matrix.getRowCount()), columnCount(matrix.getColumnCount()), entryCount(matrix.getEntryCount()), sliceSize(sliceSize) {
+    STORM_LOG_THROW(canRepresent(matrix), storm::exceptions::InvalidArgumentException,
+                    "The matrix has " << matrix.getColumnCount() << " columns, which exceeds the range of the index type.");
+    STORM_LOG_THROW(sliceSize > 0, storm::exceptions::InvalidArgumentException, "The slice size must be positive.");
+    STORM_LOG_THROW(sortingScope > 0, storm::exceptions::InvalidArgumentException, "The sorting scope must be positive.");
+
+    // Sort the rows within each window of the sorting scope by their number of entries (longest first).
+    rowPermutation.resize(rowCount);
+    std::iota(rowPermutation.begin(), rowPermutation.end(), 0);
+    for (uint64_t windowStart = 0; windowStart < rowCount; windowStart += sortingScope) {
+        auto windowEnd = rowPermutation.begin() + std::min(rowCount, windowStart + sortingScope);
+        std::stable_sort(rowPermutation.begin() + windowStart, windowEnd, [&matrix](uint64_t first, uint64_t second) {
+            return matrix.getRow(first).getNumberOfEntries() > matrix.getRow(second).getNumberOfEntries();
+        });
+    }
+
+    // Determine the width of each slice.
+    uint64_t numberOfSlices = (rowCount + sliceSize - 1) / sliceSize;
+    rowLengths.assign(numberOfSlices * sliceSize, 0);
+    sliceOffsets.reserve(numberOfSlices + 1);
+    sliceOffsets.push_back(0);
+    for (uint64_t slice = 0; slice < numberOfSlices; ++slice) {
+        uint64_t width = 0;
+        for (uint64_t position = slice * sliceSize, positionEnd = std::min(rowCount, position + sliceSize); position < positionEnd; ++position) {
+            rowLengths[position] = static_cast<IndexType>(matrix.getRow(rowPermutation[position]).getNumberOfEntries());
+            width = std::max<uint64_t>(width, rowLengths[position]);
+        }
+        sliceOffsets.push_back(sliceOffsets.back() + width * sliceSize);
+    }
+
+    // Copy the entries. The padding refers to the first column with value zero, but it is never read.
+    columns.assign(sliceOffsets.back(), 0);
+    values.assign(sliceOffsets.back(), storm::utility::zero<ValueType>());
+    for (uint64_t position = 0; position < rowCount; ++position) {
+        uint64_t index = sliceOffsets[position / sliceSize] + position % sliceSize;
+        for (auto const& entry : matrix.getRow(rowPermutation[position])) {
+            columns[index] = static_cast<IndexType>(entry.getColumn());
+            values[index] = entry.getValue();
+            index += sliceSize;
+        }
+    }
+}
+
+template<typename ValueType, typename IndexType>
+bool SlicedEllpackMatrix<ValueType, IndexType>::canRepresent(SparseMatrix<ValueType> const& matrix) {
+    // The row lengths are stored with the index type as well, but they never exceed the number of columns.
+    return matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<IndexType>::max());
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getRowCount() const {
+    return rowCount;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getEntryCount() const {
+    return entryCount;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getSliceSize() const {
+    return sliceSize;
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getNumberOfStoredEntries() const {
+    return sliceOffsets.back();
+}
+
+template<typename ValueType, typename IndexType>
+uint64_t SlicedEllpackMatrix<ValueType, IndexType>::getSizeInMemory() const {
+    return sliceOffsets.size() * sizeof(uint64_t) + rowLengths.size() * sizeof(IndexType) + rowPermutation.size() * sizeof(uint64_t) +
+           columns.size() * sizeof(IndexType) + values.size() * sizeof(ValueType);
+}
+
+template<typename ValueType, typename IndexType>
+void SlicedEllpackMatrix<ValueType, IndexType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                   std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "Vectors are aliased but are not allowed to be.");
+    multiplyRows(vector, summand, result);
+}
+
+template<typename ValueType, typename IndexType>
+void SlicedEllpackMatrix<ValueType, IndexType>::multiplyRows(std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                             std::vector<ValueType>& rowValues) const {
+    ValueType const* x = vector.data();
+    std::vector<ValueType> accumulators(sliceSize);
+    for (uint64_t slice = 0, numberOfSlices = sliceOffsets.size() - 1; slice < numberOfSlices; ++slice) {
+        uint64_t const firstPosition = slice * sliceSize;
+        uint64_t const numberOfRows = std::min(sliceSize, rowCount - firstPosition);
+        uint64_t const width = (sliceOffsets[slice + 1] - sliceOffsets[slice]) / sliceSize;
+        IndexType const* lengths = rowLengths.data() + firstPosition;
+
+        // Start with the summand so that the values are accumulated in the same order as in SparseMatrix::multiplyWithVector.
+        for (uint64_t lane = 0; lane < numberOfRows; ++lane) {
+            accumulators[lane] = summand ? (*summand)[rowPermutation[firstPosition + lane]] : storm::utility::zero<ValueType>();
+        }
+
+        // Process the j-th entries of all rows of the slice at once. Padding entries are masked out rather than multiplied
+        // with zero, as the latter yields NaN for infinite values in the vector.
+        IndexType const* columnIt = columns.data() + sliceOffsets[slice];
+        ValueType const* valueIt = values.data() + sliceOffsets[slice];
+        for (uint64_t j = 0; j < width; ++j, columnIt += sliceSize, valueIt += sliceSize) {
+            for (uint64_t lane = 0; lane < numberOfRows; ++lane) {
+                if (j < lengths[lane]) {
+                    accumulators[lane] += valueIt[lane] * x[columnIt[lane]];
+                }
+            }
+        }
+
+        for (uint64_t lane = 0; lane < numberOfRows; ++lane) {
+            rowValues[rowPermutation[firstPosition + lane]] = accumulators[lane];
+        }
+    }
+}
+
+template<typename ValueType, typename IndexType>
+void SlicedEllpackMatrix<ValueType, IndexType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                  std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                  std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                                  std::vector<ValueType>& rowValues) const {
+    STORM_LOG_ASSERT(&vector != &rowValues && &result != &rowValues, "The workspace must not be aliased.");
+    rowValues.resize(rowCount);
+    multiplyRows(vector, summand, rowValues);
+    if (dir == storm::OptimizationDirection::Minimize) {
+        reduceRowValues<storm::utility::ElementLess<ValueType>>(rowGroupIndices, rowValues, result, choices);
+    } else {
+        reduceRowValues<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, rowValues, result, choices);
+    }
+}
+
+template<typename ValueType, typename IndexType>
+template<typename Compare>
+void SlicedEllpackMatrix<ValueType, IndexType>::reduceRowValues(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& rowValues,
+                                                                std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
+    Compare compare;
+    for (uint64_t group = 0, numberOfGroups = rowGroupIndices.size() - 1; group < numberOfGroups; ++group) {
+        uint64_t const groupBegin = rowGroupIndices[group];
+        uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+        // Only reduce if there is at least one row in the group.
+        if (groupBegin == groupEnd) {
+            continue;
+        }
+
+        // Only update the choice if the new choice is strictly better than the previously selected one.
+        uint64_t selectedRow = groupBegin;
+        for (uint64_t row = groupBegin + 1; row < groupEnd; ++row) {
+            if (compare(rowValues[row], rowValues[selectedRow])) {
+                selectedRow = row;
+            }
+        }
+        if (choices && compare(rowValues[selectedRow], rowValues[groupBegin + (*choices)[group]])) {
+            (*choices)[group] = selectedRow - groupBegin;
+        }
+        result[group] = rowValues[selectedRow];
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+void SlicedEllpackMatrix<storm::RationalFunction, uint32_t>::multiplyAndReduce(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                               std::vector<storm::RationalFunction> const&,
+                                                                               std::vector<storm::RationalFunction> const*,
+                                                                               std::vector<storm::RationalFunction>&, std::vector<uint64_t>*,
+                                                                               std::vector<storm::RationalFunction>&) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+}
+#endif
+
+template class SlicedEllpackMatrix<double, uint32_t>;
+template class SlicedEllpackMatrix<double, uint64_t>;
+
+#ifdef STORM_HAVE_CARL
+template class SlicedEllpackMatrix<storm::RationalNumber, uint32_t>;
+template class SlicedEllpackMatrix<storm::RationalFunction, uint32_t>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only representation of a sparse matrix in the sliced ELLPACK format with local row sorting (SELL-C-sigma).
+ * The rows are sorted by their number of entries in windows of sigma rows and then grouped into slices of C
+ * consecutive rows. Each slice is padded to the length of its longest row and stored column-major, i.e., the j-th
+ * entries of the C rows of a slice are adjacent in memory. The multiplication thus processes C rows in lockstep with
+ * unit-stride accesses to the matrix, which the compiler can vectorize, while the sorting keeps the padding small.
+ *
+ * As the rows are reordered, the multiplication first computes the values of all rows and then scatters (or reduces)
+ * them in the original order. Row groups are not stored in this matrix, the corresponding methods take the row group
+ * indices as an argument.
+ */
+template<typename ValueType, typename IndexType = uint32_t>
+class SlicedEllpackMatrix {
+   public:
+    /*!
+     * Creates a copy of the given matrix in the sliced ELLPACK format.
+     *
+     * @param matrix The matrix to copy. Its number of columns must be representable with the index type.
+     * @param sliceSize The number of rows per slice (C).
+     * @param sortingScope The number of consecutive rows that are sorted by their length (sigma). A value of one disables the sorting.
+     */
+    SlicedEllpackMatrix(SparseMatrix<ValueType> const& matrix, uint64_t sliceSize = 8, uint64_t sortingScope = 256);
+
+    /*!
+     * Retrieves whether the given matrix can be represented with the index type of this class.
+     */
+    static bool canRepresent(SparseMatrix<ValueType> const& matrix);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+    uint64_t getSliceSize() const;
+
+    /*!
+     * Retrieves the number of stored entries including the padding.
+     */
+    uint64_t getNumberOfStoredEntries() const;
+
+    /*!
+     * Retrieves the number of bytes occupied by the (dynamically allocated) contents of this matrix.
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Computes result = A * vector + summand. The vectors must not be aliased.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector, adds the summand and reduces the result of each row group to its
+     * min or max. Choices are only updated if the new choice is strictly better than the previously selected one,
+     * just as in SparseMatrix::multiplyAndReduce. As the values of all rows are computed before the reduction, vector
+     * and result may be the same.
+     *
+     * @param rowValues A workspace that is resized to the number of rows.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                           std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                           std::vector<ValueType>& rowValues) const;
+
+   private:
+    /*!
+     * Computes rowValues[row] = A[row] * vector + summand[row] for all rows, slice by slice.
+     */
+    void multiplyRows(std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& rowValues) const;
+
+    template<typename Compare>
+    void reduceRowValues(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& rowValues, std::vector<ValueType>& result,
+                         std::vector<uint64_t>* choices) const;
+
+    // The number of rows and columns of the matrix.
+    uint64_t rowCount;
+    uint64_t columnCount;
+
+    // The number of (non-padding) entries of the matrix.
+    uint64_t entryCount;
+
+    // The number of rows per slice.
+    uint64_t sliceSize;
+
+    // The offsets of the slices in the column and value arrays. The last entry is the number of stored entries.
+    std::vector<uint64_t> sliceOffsets;
+
+    // The number of entries of the row at each (sorted) position. Positions beyond the last row have no entries.
+    std::vector<IndexType> rowLengths;
+
+    // The original row at each (sorted) position.
+    std::vector<uint64_t> rowPermutation;
+
+    // The columns and values of the (padded) slices, stored column-major.
+    std::vector<IndexType> columns;
+    std::vector<ValueType> values;
+};
+
+}  // namespace storage
+}  // namespace storm
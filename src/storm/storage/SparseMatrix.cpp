@@ -5,8 +5,11 @@
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -17,11 +20,18 @@
 
 #include "storm/utility/macros.h"
 
+#include <atomic>
 #include <iterator>
 
 namespace storm {
 namespace storage {
 
+namespace {
+// Matrices with fewer entries are always transposed sequentially.
+uint64_t const PARALLEL_TRANSPOSE_MINIMAL_ENTRY_COUNT = 1ull << 16;
+uint64_t const PARALLEL_TRANSPOSE_CHUNK_SIZE = 1024;
+}  // namespace
+
 template<typename IndexType, typename ValueType>
 MatrixEntry<IndexType, ValueType>::MatrixEntry(IndexType column, ValueType value) : entry(column, value) {
     // Intentionally left empty.
@@ -369,6 +379,20 @@ typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueTyp
     return lastColumn;
 }
 
+template<typename ValueType>
+uint64_t SparseMatrixBuilder<ValueType>::getReservedBytes() const {
+    uint64_t result = columnsAndValues.capacity() * sizeof(MatrixEntry<index_type, value_type>) + rowIndications.capacity() * sizeof(index_type);
+    if (rowGroupIndices) {
+        result += rowGroupIndices->capacity() * sizeof(index_type);
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename SparseMatrixBuilder<ValueType>::index_type SparseMatrixBuilder<ValueType>::getNumberOfEntries() const {
+    return currentEntryCount;
+}
+
 // Debug method for printing the current matrix
 template<typename ValueType>
 void print(std::vector<typename SparseMatrix<ValueType>::index_type> const& rowGroupIndices,
@@ -509,7 +533,7 @@ SparseMatrix<ValueType>::SparseMatrix(SparseMatrix<ValueType> const& other)
       rowIndications(other.rowIndications),
       trivialRowGrouping(other.trivialRowGrouping),
       rowGroupIndices(other.rowGroupIndices) {
-    // Intentionally left empty.
+    applyMemoryPolicies();
 }
 
 template<typename ValueType>
@@ -548,6 +572,7 @@ SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_
       trivialRowGrouping(!rowGroupIndices),
       rowGroupIndices(rowGroupIndices) {
     this->updateNonzeroEntryCount();
+    applyMemoryPolicies();
 }
 
 template<typename ValueType>
@@ -565,6 +590,7 @@ SparseMatrix<ValueType>::SparseMatrix(index_type columnCount, std::vector<index_
     this->entryCount = this->columnsAndValues.size();
     this->trivialRowGrouping = !this->rowGroupIndices;
     this->updateNonzeroEntryCount();
+    applyMemoryPolicies();
 }
 
 template<typename ValueType>
@@ -580,6 +606,7 @@ SparseMatrix<ValueType>& SparseMatrix<ValueType>::operator=(SparseMatrix<ValueTy
         rowIndications = other.rowIndications;
         rowGroupIndices = other.rowGroupIndices;
         trivialRowGrouping = other.trivialRowGrouping;
+        applyMemoryPolicies();
     }
     return *this;
 }
@@ -699,6 +726,12 @@ void SparseMatrix<ValueType>::updateNonzeroEntryCount() const {
     }
 }
 
+template<typename ValueType>
+void SparseMatrix<ValueType>::applyMemoryPolicies() const {
+    storm::utility::memory::adviseMemory(columnsAndValues);
+    storm::utility::memory::adviseMemory(rowIndications);
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::updateNonzeroEntryCount(std::make_signed<index_type>::type difference) {
     this->nonzeroEntryCount += difference;
@@ -1166,14 +1199,10 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
     STORM_LOG_THROW(!rowGroupConstraint.empty() && !columnConstraint.empty(), storm::exceptions::InvalidArgumentException, "Cannot build empty submatrix.");
     index_type submatrixColumnCount = columnConstraint.getNumberOfSetBits();
 
-    // Start by creating a temporary vector that stores for each index whose bit is set to true the number of
-    // bits that were set before that particular index.
-    std::vector<index_type> columnBitsSetBeforeIndex = columnConstraint.getNumberOfSetBitsBeforeIndices();
-    std::unique_ptr<std::vector<index_type>> tmp;
-    if (rowGroupConstraint != columnConstraint) {
-        tmp = std::make_unique<std::vector<index_type>>(rowGroupConstraint.getNumberOfSetBitsBeforeIndices());
-    }
-    std::vector<index_type> const& rowBitsSetBeforeIndex = tmp ? *tmp : columnBitsSetBeforeIndex;
+    // Start by creating an index that retrieves for each column the number of columns that are kept before it, which
+    // is the column in the submatrix. As the row groups are traversed in ascending order, the index of the current row
+    // group in the submatrix is the number of row groups that were traversed before.
+    storm::storage::BitVectorRankIndex columnIndex(columnConstraint);
 
     // Then, we need to determine the number of entries and the number of rows of the submatrix.
     index_type subEntries = 0;
@@ -1188,7 +1217,7 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
                 if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
                     ++subEntries;
 
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
+                    if (columnIndex.rank(it->getColumn()) == rowGroupCount) {
                         foundDiagonalElement = true;
                     }
                 }
@@ -1218,14 +1247,15 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::getSubmatrix(storm::storage::Bi
 
             for (const_iterator it = this->begin(i), ite = this->end(i); it != ite; ++it) {
                 if (columnConstraint.get(it->getColumn()) && (makeZeroColumns.size() == 0 || !makeZeroColumns.get(it->getColumn()))) {
-                    if (columnBitsSetBeforeIndex[it->getColumn()] == rowBitsSetBeforeIndex[index]) {
+                    index_type column = columnIndex.rank(it->getColumn());
+                    if (column == rowGroupCount) {
                         insertedDiagonalElement = true;
-                    } else if (insertDiagonalEntries && !insertedDiagonalElement && columnBitsSetBeforeIndex[it->getColumn()] > rowBitsSetBeforeIndex[index]) {
+                    } else if (insertDiagonalEntries && !insertedDiagonalElement && column > rowGroupCount) {
                         matrixBuilder.addNextValue(rowCount, rowGroupCount, storm::utility::zero<ValueType>());
                         insertedDiagonalElement = true;
                     }
                     ++subEntries;
-                    matrixBuilder.addNextValue(rowCount, columnBitsSetBeforeIndex[it->getColumn()], it->getValue());
+                    matrixBuilder.addNextValue(rowCount, column, it->getValue());
                 }
             }
             if (insertDiagonalEntries && !insertedDiagonalElement && rowGroupCount < submatrixColumnCount) {
@@ -1462,6 +1492,70 @@ SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool
     std::vector<index_type> rowIndications(rowCount + 1);
     std::vector<MatrixEntry<index_type, ValueType>> columnsAndValues(entryCount);
 
+    uint64_t const numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    // Rational functions are not copied concurrently as their (cached) representation is not thread-safe.
+    if (numberOfThreads > 1 && entryCount >= PARALLEL_TRANSPOSE_MINIMAL_ENTRY_COUNT && !std::is_same<ValueType, storm::RationalFunction>::value) {
+        // The entries of (groups of) rows are distributed over the threads. Entries are placed into the columns of the
+        // transposed matrix using atomic counters and then sorted by their position in this matrix, so the result is
+        // the same as the one of the sequential transposition.
+        std::vector<index_type> const* groupIndices = joinGroups && !this->hasTrivialRowGrouping() ? &this->getRowGroupIndices() : nullptr;
+        auto forEachEntry = [&](std::function<void(index_type group, index_type entryIndex)> const& function) {
+            storm::utility::parallel::forEachChunk(0, columnCount, PARALLEL_TRANSPOSE_CHUNK_SIZE, numberOfThreads,
+                                                   [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                       for (index_type group = chunkBegin; group < chunkEnd; ++group) {
+                                                           index_type firstRow = groupIndices ? (*groupIndices)[group] : group;
+                                                           index_type lastRow = groupIndices ? (*groupIndices)[group + 1] : group + 1;
+                                                           for (index_type entryIndex = this->rowIndications[firstRow];
+                                                                entryIndex < this->rowIndications[lastRow]; ++entryIndex) {
+                                                               if (keepZeros || !storm::utility::isZero(this->columnsAndValues[entryIndex].getValue())) {
+                                                                   function(group, entryIndex);
+                                                               }
+                                                           }
+                                                       }
+                                                   });
+        };
+
+        std::vector<std::atomic<index_type>> nextIndices(rowCount);
+        forEachEntry([&](index_type, index_type entryIndex) {
+            nextIndices[this->columnsAndValues[entryIndex].getColumn()].fetch_add(1, std::memory_order_relaxed);
+        });
+        for (index_type i = 0; i < rowCount; ++i) {
+            rowIndications[i + 1] = rowIndications[i] + nextIndices[i].load(std::memory_order_relaxed);
+            nextIndices[i].store(rowIndications[i], std::memory_order_relaxed);
+        }
+
+        std::vector<index_type> sourceEntryIndices(entryCount);
+        forEachEntry([&](index_type group, index_type entryIndex) {
+            auto const& entry = this->columnsAndValues[entryIndex];
+            index_type position = nextIndices[entry.getColumn()].fetch_add(1, std::memory_order_relaxed);
+            columnsAndValues[position] = std::make_pair(group, entry.getValue());
+            sourceEntryIndices[position] = entryIndex;
+        });
+
+        storm::utility::parallel::forEachChunk(
+            0, rowCount, PARALLEL_TRANSPOSE_CHUNK_SIZE, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                std::vector<std::pair<index_type, MatrixEntry<index_type, ValueType>>> rowEntries;
+                for (index_type row = chunkBegin; row < chunkEnd; ++row) {
+                    auto sourceBegin = sourceEntryIndices.begin() + rowIndications[row];
+                    auto sourceEnd = sourceEntryIndices.begin() + rowIndications[row + 1];
+                    if (std::is_sorted(sourceBegin, sourceEnd)) {
+                        continue;
+                    }
+                    rowEntries.clear();
+                    for (index_type position = rowIndications[row]; position < rowIndications[row + 1]; ++position) {
+                        rowEntries.emplace_back(sourceEntryIndices[position], std::move(columnsAndValues[position]));
+                    }
+                    std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+                    index_type position = rowIndications[row];
+                    for (auto& rowEntry : rowEntries) {
+                        columnsAndValues[position++] = std::move(rowEntry.second);
+                    }
+                }
+            });
+
+        return storm::storage::SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
+    }
+
     // First, we need to count how many entries each column has.
     for (index_type group = 0; group < columnCount; ++group) {
         for (auto const& transition : joinGroups ? this->getRowGroup(group) : this->getRow(group)) {
@@ -1755,23 +1849,20 @@ void SparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType>
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<typename ValueType>
-class TbbMultAddFunctor {
+class MultAddFunctor {
    public:
     typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
 
-    TbbMultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications,
+    MultAddFunctor(std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries, std::vector<uint64_t> const& rowIndications,
                       std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<value_type> const* summand)
         : columnsAndEntries(columnsAndEntries), rowIndications(rowIndications), x(x), result(result), summand(summand) {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<index_type> const& range) const {
-        index_type startRow = range.begin();
-        index_type endRow = range.end();
+    void operator()(index_type startRow, index_type endRow) const {
         typename std::vector<index_type>::const_iterator rowIterator = rowIndications.begin() + startRow;
         const_iterator it = columnsAndEntries.begin() + *rowIterator;
         const_iterator ite;
@@ -1808,14 +1899,13 @@ void SparseMatrix<ValueType>::multiplyWithVectorParallel(std::vector<ValueType>
         STORM_LOG_WARN(
             "Matrix-vector-multiplication invoked but the target vector uses the same memory as the input vector. This requires to allocate auxiliary memory.");
         std::vector<ValueType> tmpVector(this->getRowCount());
-        multiplyWithVectorParallel(vector, tmpVector);
+        multiplyWithVectorParallel(vector, tmpVector, summand);
         result = std::move(tmpVector);
     } else {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, result.size(), 100),
-                          TbbMultAddFunctor<ValueType>(columnsAndValues, rowIndications, vector, result, summand));
+        MultAddFunctor<ValueType> functor(columnsAndValues, rowIndications, vector, result, summand);
+        storm::utility::vector::forEachRangeParallel(result.size(), functor);
     }
 }
-#endif
 
 template<typename ValueType>
 ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
@@ -1913,75 +2003,118 @@ template<typename Compare>
 void SparseMatrix<ValueType>::multiplyAndReduceForward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
                                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result,
                                                        std::vector<uint64_t>* choices) const {
-    Compare compare;
-    auto elementIt = this->begin();
-    auto rowGroupIt = rowGroupIndices.begin();
-    auto rowIt = rowIndications.begin();
-    typename std::vector<ValueType>::const_iterator summandIt;
     if (summand) {
-        summandIt = summand->begin();
-    }
-    typename std::vector<uint64_t>::iterator choiceIt;
-    if (choices) {
-        choiceIt = choices->begin();
+        if (choices) {
+            multiplyAndReduceForwardKernel<Compare, true, true, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        } else {
+            multiplyAndReduceForwardKernel<Compare, true, false, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        }
+    } else {
+        if (choices) {
+            multiplyAndReduceForwardKernel<Compare, false, true, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        } else {
+            multiplyAndReduceForwardKernel<Compare, false, false, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        }
     }
+}
+
+namespace {
+// Checks whether the new value of a row group is equal to the old one (see storm::utility::vector::equalModuloPrecision).
+template<typename ValueType>
+bool isWithinPrecision(ValueType const& oldValue, ValueType const& newValue, ValueType const& precision, bool relative) {
+    return storm::utility::vector::equalModuloPrecision<ValueType>(oldValue, newValue, precision, relative);
+}
+
+template<>
+bool isWithinPrecision(int const&, int const&, int const&, bool) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking integer values for convergence is not supported.");
+    return false;
+}
+
+template<>
+bool isWithinPrecision(storm::storage::sparse::state_type const&, storm::storage::sparse::state_type const&, storm::storage::sparse::state_type const&, bool) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking integer values for convergence is not supported.");
+    return false;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+bool isWithinPrecision(storm::Interval const&, storm::Interval const&, storm::Interval const&, bool) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Checking intervals for convergence is not supported.");
+    return false;
+}
+#endif
+}  // namespace
+
+template<typename ValueType>
+template<typename Compare, bool HasSummand, bool TrackChoices, bool CheckConvergence>
+void SparseMatrix<ValueType>::multiplyAndReduceForwardKernel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                             std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                             std::vector<uint64_t>* choices, ValueType const* precision, bool relative,
+                                                             bool* converged) const {
+    Compare compare;
+    auto elementIt = this->begin();
 
     // Variables for correctly tracking choices (only update if new choice is strictly better).
     ValueType oldSelectedChoiceValue;
     uint64_t selectedChoice;
 
-    uint64_t currentRow = 0;
-    for (auto resultIt = result.begin(), resultIte = result.end(); resultIt != resultIte; ++resultIt, ++choiceIt, ++rowGroupIt) {
-        ValueType currentValue = storm::utility::zero<ValueType>();
+    for (uint64_t group = 0, numberOfGroups = result.size(); group < numberOfGroups; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t const rowEnd = rowGroupIndices[group + 1];
 
         // Only multiply and reduce if there is at least one row in the group.
-        if (*rowGroupIt < *(rowGroupIt + 1)) {
-            if (summand) {
-                currentValue = *summandIt;
-                ++summandIt;
-            }
+        if (row == rowEnd) {
+            continue;
+        }
 
-            for (auto elementIte = this->begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
-            }
+        ValueType currentValue = HasSummand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (auto elementIte = this->begin() + rowIndications[row + 1]; elementIt != elementIte; ++elementIt) {
+            currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
+        }
 
-            if (choices) {
-                selectedChoice = 0;
-                if (*choiceIt == 0) {
-                    oldSelectedChoiceValue = currentValue;
-                }
+        // A group with a single row needs no reduction and its choice can not change.
+        if (row + 1 == rowEnd) {
+            if (CheckConvergence && *converged && !isWithinPrecision(vector[group], currentValue, *precision, relative)) {
+                *converged = false;
             }
+            result[group] = std::move(currentValue);
+            continue;
+        }
 
-            ++rowIt;
-            ++currentRow;
+        if (TrackChoices) {
+            selectedChoice = 0;
+            if ((*choices)[group] == 0) {
+                oldSelectedChoiceValue = currentValue;
+            }
+        }
 
-            for (; currentRow < *(rowGroupIt + 1); ++rowIt, ++currentRow) {
-                ValueType newValue = summand ? *summandIt : storm::utility::zero<ValueType>();
-                for (auto elementIte = this->begin() + *(rowIt + 1); elementIt != elementIte; ++elementIt) {
-                    newValue += elementIt->getValue() * vector[elementIt->getColumn()];
-                }
+        for (++row; row < rowEnd; ++row) {
+            ValueType newValue = HasSummand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            for (auto elementIte = this->begin() + rowIndications[row + 1]; elementIt != elementIte; ++elementIt) {
+                newValue += elementIt->getValue() * vector[elementIt->getColumn()];
+            }
 
-                if (choices && currentRow == *choiceIt + *rowGroupIt) {
-                    oldSelectedChoiceValue = newValue;
-                }
+            if (TrackChoices && row == (*choices)[group] + rowGroupIndices[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
 
-                if (compare(newValue, currentValue)) {
-                    currentValue = newValue;
-                    if (choices) {
-                        selectedChoice = currentRow - *rowGroupIt;
-                    }
-                }
-                if (summand) {
-                    ++summandIt;
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                if (TrackChoices) {
+                    selectedChoice = row - rowGroupIndices[group];
                 }
             }
+        }
 
-            // Finally write value to target vector.
-            *resultIt = currentValue;
-            if (choices && compare(currentValue, oldSelectedChoiceValue)) {
-                *choiceIt = selectedChoice;
-            }
+        // Finally write value to target vector.
+        if (TrackChoices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        if (CheckConvergence && *converged && !isWithinPrecision(vector[group], currentValue, *precision, relative)) {
+            *converged = false;
         }
+        result[group] = std::move(currentValue);
     }
 }
 
@@ -2011,70 +2144,95 @@ template<typename Compare>
 void SparseMatrix<ValueType>::multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
                                                         std::vector<ValueType> const* summand, std::vector<ValueType>& result,
                                                         std::vector<uint64_t>* choices) const {
-    Compare compare;
-    auto elementIt = this->end() - 1;
-    auto rowGroupIt = rowGroupIndices.end() - 2;
-    auto rowIt = rowIndications.end() - 2;
-    typename std::vector<ValueType>::const_iterator summandIt;
     if (summand) {
-        summandIt = summand->end() - 1;
-    }
-    typename std::vector<uint64_t>::iterator choiceIt;
-    if (choices) {
-        choiceIt = choices->end() - 1;
+        if (choices) {
+            multiplyAndReduceBackwardKernel<Compare, true, true, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        } else {
+            multiplyAndReduceBackwardKernel<Compare, true, false, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        }
+    } else {
+        if (choices) {
+            multiplyAndReduceBackwardKernel<Compare, false, true, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        } else {
+            multiplyAndReduceBackwardKernel<Compare, false, false, false>(rowGroupIndices, vector, summand, result, choices, nullptr, false, nullptr);
+        }
     }
+}
+
+template<typename ValueType>
+template<typename Compare, bool HasSummand, bool TrackChoices, bool CheckConvergence>
+void SparseMatrix<ValueType>::multiplyAndReduceBackwardKernel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                              std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                              std::vector<uint64_t>* choices, ValueType const* precision, bool relative,
+                                                              bool* converged) const {
+    Compare compare;
 
     // Variables for correctly tracking choices (only update if new choice is strictly better).
     ValueType oldSelectedChoiceValue;
     uint64_t selectedChoice;
 
-    uint64_t currentRow = this->getRowCount() - 1;
-    for (auto resultIt = result.end() - 1, resultIte = result.begin() - 1; resultIt != resultIte; --resultIt, --choiceIt, --rowGroupIt) {
-        ValueType currentValue = storm::utility::zero<ValueType>();
+    // The rows of each group as well as the entries of each row are processed in reverse order.
+    for (uint64_t group = result.size(); group > 0;) {
+        --group;
+        uint64_t const rowBegin = rowGroupIndices[group];
+        uint64_t row = rowGroupIndices[group + 1];
 
         // Only multiply and reduce if there is at least one row in the group.
-        if (*rowGroupIt < *(rowGroupIt + 1)) {
-            if (summand) {
-                currentValue = *summandIt;
-                --summandIt;
-            }
+        if (rowBegin == row) {
+            continue;
+        }
 
-            for (auto elementIte = this->begin() + *rowIt - 1; elementIt != elementIte; --elementIt) {
-                currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
+        --row;
+        ValueType currentValue = HasSummand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (auto elementIt = this->begin() + rowIndications[row + 1], elementIte = this->begin() + rowIndications[row]; elementIt != elementIte;) {
+            --elementIt;
+            currentValue += elementIt->getValue() * vector[elementIt->getColumn()];
+        }
+
+        // A group with a single row needs no reduction and its choice can not change.
+        if (row == rowBegin) {
+            if (CheckConvergence && *converged && !isWithinPrecision(vector[group], currentValue, *precision, relative)) {
+                *converged = false;
             }
-            if (choices) {
-                selectedChoice = currentRow - *rowGroupIt;
-                if (*choiceIt == selectedChoice) {
-                    oldSelectedChoiceValue = currentValue;
-                }
+            result[group] = std::move(currentValue);
+            continue;
+        }
+
+        if (TrackChoices) {
+            selectedChoice = row - rowBegin;
+            if ((*choices)[group] == selectedChoice) {
+                oldSelectedChoiceValue = currentValue;
             }
-            --rowIt;
-            --currentRow;
+        }
 
-            for (uint64_t i = *rowGroupIt + 1, end = *(rowGroupIt + 1); i < end; --rowIt, --currentRow, ++i, --summandIt) {
-                ValueType newValue = summand ? *summandIt : storm::utility::zero<ValueType>();
-                for (auto elementIte = this->begin() + *rowIt - 1; elementIt != elementIte; --elementIt) {
-                    newValue += elementIt->getValue() * vector[elementIt->getColumn()];
-                }
+        while (row > rowBegin) {
+            --row;
+            ValueType newValue = HasSummand ? (*summand)[row] : storm::utility::zero<ValueType>();
+            for (auto elementIt = this->begin() + rowIndications[row + 1], elementIte = this->begin() + rowIndications[row]; elementIt != elementIte;) {
+                --elementIt;
+                newValue += elementIt->getValue() * vector[elementIt->getColumn()];
+            }
 
-                if (choices && currentRow == *choiceIt + *rowGroupIt) {
-                    oldSelectedChoiceValue = newValue;
-                }
+            if (TrackChoices && row == (*choices)[group] + rowBegin) {
+                oldSelectedChoiceValue = newValue;
+            }
 
-                if (compare(newValue, currentValue)) {
-                    currentValue = newValue;
-                    if (choices) {
-                        selectedChoice = currentRow - *rowGroupIt;
-                    }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                if (TrackChoices) {
+                    selectedChoice = row - rowBegin;
                 }
             }
+        }
 
-            // Finally write value to target vector.
-            *resultIt = currentValue;
-            if (choices && compare(currentValue, oldSelectedChoiceValue)) {
-                *choiceIt = selectedChoice;
-            }
+        // Finally write value to target vector.
+        if (TrackChoices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+        if (CheckConvergence && *converged && !isWithinPrecision(vector[group], currentValue, *precision, relative)) {
+            *converged = false;
         }
+        result[group] = std::move(currentValue);
     }
 }
 
@@ -2088,15 +2246,110 @@ void SparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(Optimizati
 }
 #endif
 
-#ifdef STORM_HAVE_INTELTBB
+template<typename ValueType>
+bool SparseMatrix<ValueType>::multiplyAndReduceForwardWithConvergenceCheck(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                   std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                   std::vector<ValueType>& result, ValueType const& precision, bool relative,
+                                                                   std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(vector.size() == result.size(), "The convergence check requires as many columns as row groups.");
+    if (dir == storm::OptimizationDirection::Minimize) {
+        return multiplyAndReduceForwardWithConvergenceCheck<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices,
+                                                                                                    precision, relative);
+    } else {
+        return multiplyAndReduceForwardWithConvergenceCheck<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices,
+                                                                                                       precision, relative);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+bool SparseMatrix<ValueType>::multiplyAndReduceForwardWithConvergenceCheck(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                   std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                   std::vector<uint64_t>* choices, ValueType const& precision, bool relative) const {
+    bool converged = true;
+    if (summand) {
+        if (choices) {
+            multiplyAndReduceForwardKernel<Compare, true, true, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        } else {
+            multiplyAndReduceForwardKernel<Compare, true, false, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        }
+    } else {
+        if (choices) {
+            multiplyAndReduceForwardKernel<Compare, false, true, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        } else {
+            multiplyAndReduceForwardKernel<Compare, false, false, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        }
+    }
+    return converged;
+}
+
+template<typename ValueType>
+bool SparseMatrix<ValueType>::multiplyAndReduceBackwardWithConvergenceCheck(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                                   std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                                   std::vector<ValueType>& result, ValueType const& precision, bool relative,
+                                                                   std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(vector.size() == result.size(), "The convergence check requires as many columns as row groups.");
+    if (dir == storm::OptimizationDirection::Minimize) {
+        return multiplyAndReduceBackwardWithConvergenceCheck<storm::utility::ElementLess<ValueType>>(rowGroupIndices, vector, summand, result, choices,
+                                                                                                     precision, relative);
+    } else {
+        return multiplyAndReduceBackwardWithConvergenceCheck<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, vector, summand, result, choices,
+                                                                                                        precision, relative);
+    }
+}
+
+template<typename ValueType>
+template<typename Compare>
+bool SparseMatrix<ValueType>::multiplyAndReduceBackwardWithConvergenceCheck(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                                   std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                   std::vector<uint64_t>* choices, ValueType const& precision, bool relative) const {
+    bool converged = true;
+    if (summand) {
+        if (choices) {
+            multiplyAndReduceBackwardKernel<Compare, true, true, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        } else {
+            multiplyAndReduceBackwardKernel<Compare, true, false, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        }
+    } else {
+        if (choices) {
+            multiplyAndReduceBackwardKernel<Compare, false, true, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        } else {
+            multiplyAndReduceBackwardKernel<Compare, false, false, true>(rowGroupIndices, vector, summand, result, choices, &precision, relative, &converged);
+        }
+    }
+    return converged;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+bool SparseMatrix<storm::RationalFunction>::multiplyAndReduceForwardWithConvergenceCheck(OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                                 std::vector<storm::RationalFunction> const&,
+                                                                                 std::vector<storm::RationalFunction> const*,
+                                                                                 std::vector<storm::RationalFunction>&, storm::RationalFunction const&, bool,
+                                                                                 std::vector<uint64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    return false;
+}
+
+template<>
+bool SparseMatrix<storm::RationalFunction>::multiplyAndReduceBackwardWithConvergenceCheck(OptimizationDirection const&, std::vector<uint64_t> const&,
+                                                                                 std::vector<storm::RationalFunction> const&,
+                                                                                 std::vector<storm::RationalFunction> const*,
+                                                                                 std::vector<storm::RationalFunction>&, storm::RationalFunction const&, bool,
+                                                                                 std::vector<uint64_t>*) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    return false;
+}
+#endif
+
 template<typename ValueType, typename Compare>
-class TbbMultAddReduceFunctor {
+class MultAddReduceFunctor {
    public:
     typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::value_type value_type;
     typedef typename storm::storage::SparseMatrix<ValueType>::const_iterator const_iterator;
 
-    TbbMultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries,
+    MultAddReduceFunctor(std::vector<uint64_t> const& rowGroupIndices, std::vector<MatrixEntry<index_type, value_type>> const& columnsAndEntries,
                             std::vector<uint64_t> const& rowIndications, std::vector<ValueType> const& x, std::vector<ValueType>& result,
                             std::vector<value_type> const* summand, std::vector<uint64_t>* choices)
         : rowGroupIndices(rowGroupIndices),
@@ -2109,9 +2362,9 @@ class TbbMultAddReduceFunctor {
         // Intentionally left empty.
     }
 
-    void operator()(tbb::blocked_range<index_type> const& range) const {
-        auto groupIt = rowGroupIndices.begin() + range.begin();
-        auto groupIte = rowGroupIndices.begin() + range.end();
+    void operator()(index_type startGroup, index_type endGroup) const {
+        auto groupIt = rowGroupIndices.begin() + startGroup;
+        auto groupIte = rowGroupIndices.begin() + endGroup;
 
         auto rowIt = rowIndications.begin() + *groupIt;
         auto elementIt = columnsAndEntries.begin() + *rowIt;
@@ -2121,10 +2374,10 @@ class TbbMultAddReduceFunctor {
         }
         typename std::vector<uint64_t>::iterator choiceIt;
         if (choices) {
-            choiceIt = choices->begin() + range.begin();
+            choiceIt = choices->begin() + startGroup;
         }
 
-        auto resultIt = result.begin() + range.begin();
+        auto resultIt = result.begin() + startGroup;
 
         // Variables for correctly tracking choices (only update if new choice is strictly better).
         ValueType oldSelectedChoiceValue;
@@ -2197,14 +2450,19 @@ template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyAndReduceParallel(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                                         std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
                                                         std::vector<ValueType>& result, std::vector<uint64_t>* choices) const {
-    if (dir == storm::OptimizationDirection::Minimize) {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications, vector,
-                                                                                                     result, summand, choices));
+    if (&vector == &result) {
+        STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+        std::vector<ValueType> temporary(result.size());
+        multiplyAndReduceParallel(dir, rowGroupIndices, vector, summand, temporary, choices);
+        result = std::move(temporary);
+    } else if (dir == storm::OptimizationDirection::Minimize) {
+        MultAddReduceFunctor<ValueType, storm::utility::ElementLess<ValueType>> functor(rowGroupIndices, columnsAndValues, rowIndications, vector, result,
+                                                                                        summand, choices);
+        storm::utility::vector::forEachRangeParallel(rowGroupIndices.size() - 1, functor);
     } else {
-        tbb::parallel_for(tbb::blocked_range<index_type>(0, rowGroupIndices.size() - 1, 100),
-                          TbbMultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>>(rowGroupIndices, columnsAndValues, rowIndications,
-                                                                                                        vector, result, summand, choices));
+        MultAddReduceFunctor<ValueType, storm::utility::ElementGreater<ValueType>> functor(rowGroupIndices, columnsAndValues, rowIndications, vector, result,
+                                                                                           summand, choices);
+        storm::utility::vector::forEachRangeParallel(rowGroupIndices.size() - 1, functor);
     }
 }
 
@@ -2217,7 +2475,6 @@ void SparseMatrix<storm::RationalFunction>::multiplyAndReduceParallel(Optimizati
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
 }
 #endif
-#endif
 
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
@@ -2594,6 +2851,17 @@ std::size_t SparseMatrix<ValueType>::hash() const {
     return result;
 }
 
+template<typename ValueType>
+uint64_t SparseMatrix<ValueType>::getSizeInBytes() const {
+    uint64_t result = sizeof(*this);
+    result += columnsAndValues.capacity() * sizeof(MatrixEntry<index_type, value_type>);
+    result += rowIndications.capacity() * sizeof(index_type);
+    if (rowGroupIndices) {
+        result += rowGroupIndices.get().capacity() * sizeof(index_type);
+    }
+    return result;
+}
+
 #ifdef STORM_HAVE_CARL
 std::set<storm::RationalFunctionVariable> getVariables(SparseMatrix<storm::RationalFunction> const& matrix) {
     std::set<storm::RationalFunctionVariable> result;
@@ -2620,6 +2888,14 @@ template bool SparseMatrix<double>::isSubmatrixOf(SparseMatrix<double> const& ma
 template class MatrixEntry<uint32_t, double>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<uint32_t, double> const& entry);
 
+// float
+template class MatrixEntry<typename SparseMatrix<float>::index_type, float>;
+template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<float>::index_type, float> const& entry);
+template class SparseMatrixBuilder<float>;
+template class SparseMatrix<float>;
+template std::ostream& operator<<(std::ostream& out, SparseMatrix<float> const& matrix);
+template SparseMatrix<float> SparseMatrix<double>::toValueType() const;
+
 // int
 template class MatrixEntry<typename SparseMatrix<int>::index_type, int>;
 template std::ostream& operator<<(std::ostream& out, MatrixEntry<typename SparseMatrix<int>::index_type, int> const& entry);
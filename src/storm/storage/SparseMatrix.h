@@ -235,6 +235,16 @@ class SparseMatrixBuilder {
      */
     index_type getLastColumn() const;
 
+    /*!
+     * Retrieves the number of bytes reserved for the entries, row indications and row groups added so far.
+     */
+    uint64_t getReservedBytes() const;
+
+    /*!
+     * Retrieves the number of entries that were added so far.
+     */
+    index_type getNumberOfEntries() const;
+
     /*!
      * Replaces all columns with id > offset according to replacements.
      * Every state  with id offset+i is replaced by the id in replacements[i].
@@ -910,10 +920,14 @@ class SparseMatrix {
                                    std::vector<value_type> const* summand = nullptr) const;
     void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result,
                                     std::vector<value_type> const* summand = nullptr) const;
-#ifdef STORM_HAVE_INTELTBB
+
+    /*!
+     * Multiplies the matrix with the given vector (like multiplyWithVector) while distributing the rows over several
+     * threads. If Storm was built with TBB, TBB is used and otherwise the built-in thread pool with the number of
+     * threads given by storm::utility::parallel::getDefaultNumberOfThreads().
+     */
     void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result,
                                     std::vector<value_type> const* summand = nullptr) const;
-#endif
 
     /*!
      * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
@@ -945,14 +959,31 @@ class SparseMatrix {
     template<typename Compare>
     void multiplyAndReduceBackward(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
                                    std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
-#ifdef STORM_HAVE_INTELTBB
+
+    /*!
+     * Like multiplyAndReduceForward (Backward), but additionally checks whether the new value of each row group is equal to the previous one up to the
+     * given precision (see storm::utility::vector::equalModuloPrecision). The previous value of a row group is the entry of the given vector, which is
+     * read right before the new value is written. Hence, vector and result may be the same (Gauss-Seidel). This saves the additional pass over both
+     * vectors that is otherwise needed to check for convergence. The matrix must have as many columns as row groups.
+     *
+     * @return True iff the values of all (non-empty) row groups are equal to their previous values up to the precision.
+     */
+    bool multiplyAndReduceForwardWithConvergenceCheck(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                      std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                      std::vector<ValueType>& result, ValueType const& precision, bool relative,
+                                                      std::vector<uint64_t>* choices = nullptr) const;
+    bool multiplyAndReduceBackwardWithConvergenceCheck(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                       std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                                                       std::vector<ValueType>& result, ValueType const& precision, bool relative,
+                                                       std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector and reduces the result (like multiplyAndReduce) while distributing
+     * the row groups over several threads (see multiplyWithVectorParallel).
+     */
     void multiplyAndReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
                                    std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result,
                                    std::vector<uint64_t>* choices) const;
-    template<typename Compare>
-    void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b,
-                                   std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
-#endif
 
     /*!
      * Multiplies a single row of the matrix with the given vector and returns the result
@@ -1067,6 +1098,12 @@ class SparseMatrix {
      */
     std::size_t hash() const;
 
+    /*!
+     * Retrieves the number of bytes allocated by the matrix. Memory that is allocated by the values themselves (e.g. for
+     * rational numbers) is not taken into account.
+     */
+    uint64_t getSizeInBytes() const;
+
     /*!
      * Returns an object representing the consecutive rows given by the parameters.
      *
@@ -1198,6 +1235,33 @@ class SparseMatrix {
     }
 
    private:
+    /*!
+     * Applies the huge page and NUMA policies (see storm::utility::memory) to the entries and the row indications.
+     */
+    void applyMemoryPolicies() const;
+
+    /*!
+     * The kernels of multiplyAndReduceForward (and Backward). Whether a summand is given and whether choices are tracked is resolved at compile time,
+     * which removes the corresponding branches from the inner loops. Groups with a single row skip the reduction altogether. If CheckConvergence is
+     * set, converged is cleared as soon as the new value of a row group differs from its previous value by more than the precision.
+     */
+    template<typename Compare, bool HasSummand, bool TrackChoices, bool CheckConvergence>
+    void multiplyAndReduceForwardKernel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                        ValueType const* precision, bool relative, bool* converged) const;
+    template<typename Compare, bool HasSummand, bool TrackChoices, bool CheckConvergence>
+    void multiplyAndReduceBackwardKernel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                         std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                         ValueType const* precision, bool relative, bool* converged) const;
+    template<typename Compare>
+    bool multiplyAndReduceForwardWithConvergenceCheck(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                      std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                      ValueType const& precision, bool relative) const;
+    template<typename Compare>
+    bool multiplyAndReduceBackwardWithConvergenceCheck(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector,
+                                                       std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices,
+                                                       ValueType const& precision, bool relative) const;
+
     /*!
      * Creates a submatrix of the current matrix by keeping only row groups and columns in the given row group
      * and column constraint, respectively.
@@ -0,0 +1,193 @@
+#include "storm/storage/SparseMatrixView.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+SparseMatrixView<ValueType>::SparseMatrixView(SparseMatrix<ValueType> const& matrix, BitVector const& rowGroupConstraint, BitVector const& columnConstraint,
+                                              BitVector const& makeZeroColumns)
+    : matrix(matrix),
+      rowGroupConstraint(rowGroupConstraint),
+      columnConstraint(columnConstraint),
+      makeZeroColumns(makeZeroColumns),
+      columnIndex(this->columnConstraint),
+      allColumns(this->columnConstraint.full()) {
+    STORM_LOG_THROW(rowGroupConstraint.size() == matrix.getRowGroupCount(), storm::exceptions::InvalidArgumentException,
+                    "The row group constraint has size " << rowGroupConstraint.size() << " but the matrix has " << matrix.getRowGroupCount() << " row groups.");
+    STORM_LOG_THROW(columnConstraint.size() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The column constraint has size " << columnConstraint.size() << " but the matrix has " << matrix.getColumnCount() << " columns.");
+    STORM_LOG_THROW(makeZeroColumns.size() == 0 || makeZeroColumns.size() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "The zero columns have an unexpected size.");
+
+    rowGroupIndices.reserve(rowGroupConstraint.getNumberOfSetBits() + 1);
+    rowGroupIndices.push_back(0);
+    std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+    for (auto group : rowGroupConstraint) {
+        rowGroupIndices.push_back(rowGroupIndices.back() + originalRowGroupIndices[group + 1] - originalRowGroupIndices[group]);
+    }
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getRowCount() const {
+    return rowGroupIndices.back();
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getColumnCount() const {
+    return columnIndex.getNumberOfSetBits();
+}
+
+template<typename ValueType>
+typename SparseMatrixView<ValueType>::index_type SparseMatrixView<ValueType>::getRowGroupCount() const {
+    return rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType>
+std::vector<typename SparseMatrixView<ValueType>::index_type> const& SparseMatrixView<ValueType>::getRowGroupIndices() const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::setScaling(std::vector<ValueType>&& rowFactors, std::vector<ValueType>&& diagonalSummands) {
+    STORM_LOG_THROW(rowFactors.size() == getRowCount(), storm::exceptions::InvalidArgumentException, "Expected one factor per row of the view.");
+    if (!diagonalSummands.empty()) {
+        STORM_LOG_THROW(diagonalSummands.size() == getRowCount(), storm::exceptions::InvalidArgumentException,
+                        "Expected one diagonal summand per row of the view.");
+        STORM_LOG_THROW(rowGroupConstraint == columnConstraint && getRowCount() == getRowGroupCount(), storm::exceptions::InvalidArgumentException,
+                        "Diagonal summands require a view on a square matrix without nondeterminism.");
+    }
+    this->rowFactors = std::move(rowFactors);
+    this->diagonalSummands = std::move(diagonalSummands);
+}
+
+template<typename ValueType>
+ValueType SparseMatrixView<ValueType>::multiplyRow(index_type row, index_type viewRow, std::vector<ValueType> const& vector, ValueType result) const {
+    bool const hasZeroColumns = makeZeroColumns.size() > 0;
+    bool const isScaled = !rowFactors.empty();
+    ValueType product = isScaled ? storm::utility::zero<ValueType>() : std::move(result);
+    for (auto const& entry : matrix.getRow(row)) {
+        index_type column = entry.getColumn();
+        if (allColumns) {
+            if (!(hasZeroColumns && makeZeroColumns.get(column))) {
+                product += entry.getValue() * vector[column];
+            }
+        } else if (columnConstraint.get(column) && !(hasZeroColumns && makeZeroColumns.get(column))) {
+            product += entry.getValue() * vector[columnIndex.rank(column)];
+        }
+    }
+    if (!isScaled) {
+        return product;
+    }
+    result += rowFactors[viewRow] * product;
+    if (!diagonalSummands.empty()) {
+        result += diagonalSummands[viewRow] * vector[viewRow];
+    }
+    return result;
+}
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                     std::vector<ValueType> const* summand) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and output vector must be different.");
+    STORM_LOG_ASSERT(vector.size() == getColumnCount(), "Unexpected size of the input vector.");
+    STORM_LOG_ASSERT(result.size() == getRowCount(), "Unexpected size of the output vector.");
+    std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+    index_type row = 0;
+    for (auto group : rowGroupConstraint) {
+        for (index_type originalRow = originalRowGroupIndices[group]; originalRow < originalRowGroupIndices[group + 1]; ++originalRow, ++row) {
+            result[row] = multiplyRow(originalRow, row, vector, summand ? (*summand)[row] : storm::utility::zero<ValueType>());
+        }
+    }
+}
+
+namespace {
+template<typename ValueType>
+bool isStrictlyBetter(storm::solver::OptimizationDirection const& dir, ValueType const& newValue, ValueType const& oldValue) {
+    return storm::solver::minimize(dir) ? storm::utility::ElementLess<ValueType>()(newValue, oldValue)
+                                        : storm::utility::ElementGreater<ValueType>()(newValue, oldValue);
+}
+
+template<>
+bool isStrictlyBetter(storm::solver::OptimizationDirection const&, storm::RationalFunction const&, storm::RationalFunction const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+    return false;
+}
+}  // namespace
+
+template<typename ValueType>
+void SparseMatrixView<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector,
+                                                    std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                    std::vector<uint64_t>* choices) const {
+    STORM_LOG_ASSERT(&vector != &result, "The input and output vector must be different.");
+    STORM_LOG_ASSERT(vector.size() == getColumnCount(), "Unexpected size of the input vector.");
+    STORM_LOG_ASSERT(result.size() == getRowGroupCount(), "Unexpected size of the output vector.");
+    std::vector<index_type> const& originalRowGroupIndices = matrix.getRowGroupIndices();
+    index_type group = 0;
+    for (auto originalGroup : rowGroupConstraint) {
+        index_type const originalFirstRow = originalRowGroupIndices[originalGroup];
+        index_type const numberOfRows = originalRowGroupIndices[originalGroup + 1] - originalFirstRow;
+        // Groups without rows are skipped.
+        if (numberOfRows > 0) {
+            index_type const firstRow = rowGroupIndices[group];
+            ValueType bestValue;
+            ValueType oldChoiceValue;
+            uint64_t bestChoice = 0;
+            for (index_type choice = 0; choice < numberOfRows; ++choice) {
+                ValueType value = multiplyRow(originalFirstRow + choice, firstRow + choice, vector,
+                                              summand ? (*summand)[firstRow + choice] : storm::utility::zero<ValueType>());
+                if (choices && choice == (*choices)[group]) {
+                    oldChoiceValue = value;
+                }
+                if (choice == 0 || isStrictlyBetter(dir, value, bestValue)) {
+                    bestValue = std::move(value);
+                    bestChoice = choice;
+                }
+            }
+            // Only change the choice if the new one is strictly better than the previous one.
+            if (choices && (*choices)[group] != bestChoice && isStrictlyBetter(dir, bestValue, oldChoiceValue)) {
+                (*choices)[group] = bestChoice;
+            }
+            result[group] = std::move(bestValue);
+        }
+        ++group;
+    }
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> SparseMatrixView<ValueType>::materialize(bool insertDiagonalEntries) const {
+    SparseMatrix<ValueType> result =
+        matrix.getSubmatrix(true, rowGroupConstraint, columnConstraint, insertDiagonalEntries || !diagonalSummands.empty(), makeZeroColumns);
+    if (!rowFactors.empty()) {
+        for (index_type row = 0; row < result.getRowCount(); ++row) {
+            for (auto& entry : result.getRow(row)) {
+                ValueType value = rowFactors[row] * entry.getValue();
+                if (!diagonalSummands.empty() && entry.getColumn() == row) {
+                    value += diagonalSummands[row];
+                }
+                entry.setValue(std::move(value));
+            }
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::size_t SparseMatrixView<ValueType>::getSizeInBytes() const {
+    return sizeof(*this) + rowGroupConstraint.getSizeInBytes() + columnConstraint.getSizeInBytes() + makeZeroColumns.getSizeInBytes() +
+           (columnConstraint.size() / 512 + 2) * sizeof(uint64_t) + rowGroupIndices.capacity() * sizeof(index_type) +
+           (rowFactors.capacity() + diagonalSummands.capacity()) * sizeof(ValueType);
+}
+
+template class SparseMatrixView<double>;
+template class SparseMatrixView<storm::RationalNumber>;
+template class SparseMatrixView<storm::RationalFunction>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A view on the submatrix of a sparse matrix that consists of the given row groups and columns, i.e., the matrix that
+ * SparseMatrix::getSubmatrix(true, rowGroupConstraint, columnConstraint, false, makeZeroColumns) returns. In contrast to
+ * getSubmatrix, the view does not copy the entries: it works on the storage of the original matrix and translates the
+ * columns on the fly with a rank index over the column constraint. This saves the memory of a second matrix at the cost
+ * of a slightly slower multiplication, which pays off for large submatrices that are only multiplied with vectors.
+ *
+ * Optionally, the rows of the view can be scaled and a diagonal can be added on the fly (see setScaling), such that, e.g.,
+ * the embedded or uniformized matrix of a CTMC can be obtained from its rate matrix without copying it.
+ *
+ * The view refers to the given matrix, which must neither be modified nor destroyed while the view is in use.
+ */
+template<typename ValueType>
+class SparseMatrixView {
+   public:
+    typedef typename SparseMatrix<ValueType>::index_type index_type;
+
+    /*!
+     * Creates a view on the given matrix.
+     *
+     * @param matrix The matrix.
+     * @param rowGroupConstraint The row groups to keep.
+     * @param columnConstraint The columns to keep.
+     * @param makeZeroColumns If given, the entries in these columns are treated as zero (and are dropped).
+     */
+    SparseMatrixView(SparseMatrix<ValueType> const& matrix, BitVector const& rowGroupConstraint, BitVector const& columnConstraint,
+                     BitVector const& makeZeroColumns = BitVector());
+
+    // The rank index refers to the column constraint stored in this object, so views can not be copied.
+    SparseMatrixView(SparseMatrixView const& other) = delete;
+    SparseMatrixView& operator=(SparseMatrixView const& other) = delete;
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getRowGroupCount() const;
+
+    /*!
+     * Retrieves the row group indices of the view (relative to the rows of the view).
+     */
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    /*!
+     * Lets the view represent diag(rowFactors) * A + diag(diagonalSummands), where A is the (unscaled) submatrix, i.e., the
+     * value of row i is rowFactors[i] times the original value of the row plus diagonalSummands[i] times the i-th entry of
+     * the vector.
+     *
+     * @param rowFactors One factor per row of the view.
+     * @param diagonalSummands Either empty or one value per row of the view. In the latter case, the row group and column
+     * constraints must coincide and every row group must consist of a single row.
+     */
+    void setScaling(std::vector<ValueType>&& rowFactors, std::vector<ValueType>&& diagonalSummands = std::vector<ValueType>());
+
+    /*!
+     * Multiplies the view with the given vector and writes the result to the given result vector.
+     *
+     * @param vector A vector with one entry per column of the view.
+     * @param result The vector that receives one value per row of the view. Must be different from the input vector.
+     * @param summand If given, this vector (with one entry per row of the view) is added to the result.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the view with the given vector and reduces the values of each row group to their optimum.
+     *
+     * @param choices If given, the chosen rows (relative to the first row of their group) are stored in this vector.
+     * As for SparseMatrix::multiplyAndReduce, a choice is only changed if the new row is strictly better.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Creates the submatrix that this object is a view on (including the scaling). This is only needed for consumers that
+     * require the submatrix in contiguous storage (e.g., to convert it into the format of another library). If diagonal
+     * summands are set, diagonal entries are always inserted.
+     */
+    SparseMatrix<ValueType> materialize(bool insertDiagonalEntries = false) const;
+
+    /*!
+     * Returns (an approximation of) the memory taken by the view (excluding the viewed matrix) in bytes.
+     */
+    std::size_t getSizeInBytes() const;
+
+   private:
+    // Computes the product of the given row of the original matrix (which is the given row of the view) with the given
+    // vector and adds it to the given value.
+    ValueType multiplyRow(index_type row, index_type viewRow, std::vector<ValueType> const& vector, ValueType result) const;
+
+    SparseMatrix<ValueType> const& matrix;
+
+    BitVector rowGroupConstraint;
+    BitVector columnConstraint;
+    BitVector makeZeroColumns;
+    BitVectorRankIndex columnIndex;
+    // Set if all columns are kept, in which case the columns do not need to be translated.
+    bool allColumns;
+
+    std::vector<index_type> rowGroupIndices;
+
+    // The scaling of the view (if any).
+    std::vector<ValueType> rowFactors;
+    std::vector<ValueType> diagonalSummands;
+};
+
+}  // namespace storage
+}  // namespace storm
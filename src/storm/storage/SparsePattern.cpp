@@ -0,0 +1,163 @@
+#include "storm/storage/SparsePattern.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace storage {
+
+namespace {
+// The number of rows (or row groups) of the matrix that are processed at once.
+uint64_t const PATTERN_CHUNK_SIZE = 4096;
+}  // namespace
+
+SparsePattern::Entry::Entry(uint32_t column) : column(column) {
+    // Intentionally left empty.
+}
+
+uint64_t SparsePattern::Entry::getColumn() const {
+    return column;
+}
+
+SparsePattern::const_rows::const_rows(Entry const* beginIt, Entry const* endIt) : beginIt(beginIt), endIt(endIt) {
+    // Intentionally left empty.
+}
+
+SparsePattern::Entry const* SparsePattern::const_rows::begin() const {
+    return beginIt;
+}
+
+SparsePattern::Entry const* SparsePattern::const_rows::end() const {
+    return endIt;
+}
+
+uint64_t SparsePattern::const_rows::getNumberOfEntries() const {
+    return endIt - beginIt;
+}
+
+SparsePattern::SparsePattern() : rowIndications(1, 0), columnCount(0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+SparsePattern::SparsePattern(SparseMatrix<ValueType> const& matrix, bool transpose, bool joinGroups) {
+    std::vector<uint64_t> const* groupIndices = joinGroups && !matrix.hasTrivialRowGrouping() ? &matrix.getRowGroupIndices() : nullptr;
+    uint64_t const numberOfSources = joinGroups ? matrix.getRowGroupCount() : matrix.getRowCount();
+    uint64_t const rowCount = transpose ? matrix.getColumnCount() : numberOfSources;
+    columnCount = transpose ? numberOfSources : matrix.getColumnCount();
+    STORM_LOG_THROW(columnCount <= std::numeric_limits<uint32_t>::max(), storm::exceptions::InvalidArgumentException,
+                    "Unable to create a pattern with " << columnCount << " columns as columns are stored with 32 bits.");
+
+    // Rational functions are not processed concurrently as their (cached) representation is not thread-safe.
+    uint64_t const numberOfThreads =
+        std::is_same<ValueType, storm::RationalFunction>::value ? 1 : storm::utility::parallel::getDefaultNumberOfThreads();
+
+    // Calls the given function with the row and column (of the pattern) of every nonzero entry of the matrix. Sources
+    // are the rows or (if groups are joined) the row groups of the matrix.
+    auto forEachEntry = [&](std::function<void(uint64_t row, uint64_t column)> const& function) {
+        storm::utility::parallel::forEachChunk(0, numberOfSources, PATTERN_CHUNK_SIZE, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t source = chunkBegin; source < chunkEnd; ++source) {
+                uint64_t firstRow = groupIndices ? (*groupIndices)[source] : source;
+                uint64_t lastRow = groupIndices ? (*groupIndices)[source + 1] : source + 1;
+                for (auto const& entry : matrix.getRows(firstRow, lastRow)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        if (transpose) {
+                            function(entry.getColumn(), source);
+                        } else {
+                            function(source, entry.getColumn());
+                        }
+                    }
+                }
+            }
+        });
+    };
+
+    // Count the entries of each row and place them using atomic counters.
+    std::vector<std::atomic<uint64_t>> nextPositions(rowCount);
+    forEachEntry([&](uint64_t row, uint64_t) { nextPositions[row].fetch_add(1, std::memory_order_relaxed); });
+    rowIndications.resize(rowCount + 1);
+    rowIndications[0] = 0;
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        rowIndications[row + 1] = rowIndications[row] + nextPositions[row].load(std::memory_order_relaxed);
+        nextPositions[row].store(rowIndications[row], std::memory_order_relaxed);
+    }
+    entries.resize(rowIndications.back());
+    forEachEntry([&](uint64_t row, uint64_t column) {
+        entries[nextPositions[row].fetch_add(1, std::memory_order_relaxed)] = Entry(static_cast<uint32_t>(column));
+    });
+
+    // As the threads place the entries in arbitrary order, the rows are sorted afterwards. Joining rows may introduce
+    // duplicate entries, which are removed.
+    std::vector<uint64_t> uniqueEntryCounts(rowCount);
+    storm::utility::parallel::forEachChunk(0, rowCount, PATTERN_CHUNK_SIZE, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        auto lessColumn = [](Entry const& a, Entry const& b) { return a.getColumn() < b.getColumn(); };
+        auto equalColumn = [](Entry const& a, Entry const& b) { return a.getColumn() == b.getColumn(); };
+        for (uint64_t row = chunkBegin; row < chunkEnd; ++row) {
+            auto rowBegin = entries.begin() + rowIndications[row];
+            auto rowEnd = entries.begin() + rowIndications[row + 1];
+            std::sort(rowBegin, rowEnd, lessColumn);
+            uniqueEntryCounts[row] = std::unique(rowBegin, rowEnd, equalColumn) - rowBegin;
+        }
+    });
+    uint64_t position = 0;
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        uint64_t rowBegin = rowIndications[row];
+        if (position != rowBegin) {
+            std::copy(entries.begin() + rowBegin, entries.begin() + rowBegin + uniqueEntryCounts[row], entries.begin() + position);
+        }
+        rowIndications[row] = position;
+        position += uniqueEntryCounts[row];
+    }
+    rowIndications[rowCount] = position;
+    if (position != entries.size()) {
+        entries.resize(position);
+        entries.shrink_to_fit();
+    }
+}
+
+uint64_t SparsePattern::getRowCount() const {
+    return rowIndications.size() - 1;
+}
+
+uint64_t SparsePattern::getColumnCount() const {
+    return columnCount;
+}
+
+uint64_t SparsePattern::getEntryCount() const {
+    return entries.size();
+}
+
+uint64_t SparsePattern::getSizeInMemory() const {
+    return rowIndications.capacity() * sizeof(uint64_t) + entries.capacity() * sizeof(Entry);
+}
+
+SparsePattern::const_rows SparsePattern::getRow(uint64_t row) const {
+    return const_rows(entries.data() + rowIndications[row], entries.data() + rowIndications[row + 1]);
+}
+
+bool SparsePattern::operator==(SparsePattern const& other) const {
+    return columnCount == other.columnCount && rowIndications == other.rowIndications &&
+           std::equal(entries.begin(), entries.end(), other.entries.begin(), other.entries.end(),
+                      [](Entry const& a, Entry const& b) { return a.getColumn() == b.getColumn(); });
+}
+
+template SparsePattern::SparsePattern(SparseMatrix<double> const& matrix, bool transpose, bool joinGroups);
+
+#ifdef STORM_HAVE_CARL
+template SparsePattern::SparsePattern(SparseMatrix<storm::RationalNumber> const& matrix, bool transpose, bool joinGroups);
+template SparsePattern::SparsePattern(SparseMatrix<storm::RationalFunction> const& matrix, bool transpose, bool joinGroups);
+template SparsePattern::SparsePattern(SparseMatrix<storm::Interval> const& matrix, bool transpose, bool joinGroups);
+#endif
+
+}  // namespace storage
+}  // namespace storm
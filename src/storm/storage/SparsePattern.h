@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * The structure (i.e. the positions of the nonzero entries) of a sparse matrix in compressed row storage without any
+ * values. Columns are stored as 32-bit indices, so every entry occupies 4 bytes instead of the 16 bytes of a SparseMatrix
+ * entry for double values. This suits graph analyses, which only traverse the edges of a model and are bound by the memory
+ * bandwidth. In particular, the backward transitions that are used by the qualitative analyses are typically stored as
+ * such a pattern (see ModelAnalysisCache::getBackwardTransitionPattern).
+ *
+ * The entries of every row are sorted by column and every column occurs at most once per row.
+ */
+class SparsePattern {
+   public:
+    /*!
+     * An entry of the pattern. It provides the same interface for retrieving the column as the entries of a SparseMatrix,
+     * so algorithms that only need the columns can be written for both.
+     */
+    class Entry {
+       public:
+        Entry() = default;
+        explicit Entry(uint32_t column);
+
+        uint64_t getColumn() const;
+
+       private:
+        uint32_t column;
+    };
+
+    /*!
+     * The entries of a single row.
+     */
+    class const_rows {
+       public:
+        const_rows(Entry const* beginIt, Entry const* endIt);
+
+        Entry const* begin() const;
+        Entry const* end() const;
+        uint64_t getNumberOfEntries() const;
+
+       private:
+        Entry const* beginIt;
+        Entry const* endIt;
+    };
+
+    /*!
+     * Creates an empty pattern.
+     */
+    SparsePattern();
+
+    /*!
+     * Creates the pattern of the given matrix, where entries whose value is zero are omitted. The pattern is built in
+     * parallel using the default number of threads (see storm::utility::parallel).
+     *
+     * @param matrix The matrix whose pattern to create.
+     * @param transpose If set, the pattern of the transposed matrix is created.
+     * @param joinGroups If set, the rows of each row group are joined, i.e. the resulting pattern has one row (or column if
+     * transposed) per row group. In particular, the transposed pattern with joined groups yields the backward transitions.
+     */
+    template<typename ValueType>
+    explicit SparsePattern(SparseMatrix<ValueType> const& matrix, bool transpose = false, bool joinGroups = false);
+
+    uint64_t getRowCount() const;
+    uint64_t getColumnCount() const;
+    uint64_t getEntryCount() const;
+
+    /*!
+     * Retrieves the number of bytes occupied by the (dynamically allocated) contents of this pattern.
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Retrieves the entries of the given row.
+     */
+    const_rows getRow(uint64_t row) const;
+
+    bool operator==(SparsePattern const& other) const;
+
+   private:
+    // The offset of the first entry of every row and (in the last position) the number of entries.
+    std::vector<uint64_t> rowIndications;
+    std::vector<Entry> entries;
+    uint64_t columnCount;
+};
+
+}  // namespace storage
+}  // namespace storm
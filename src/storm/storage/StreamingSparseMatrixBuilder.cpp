@@ -0,0 +1,156 @@
+#include "storm/storage/StreamingSparseMatrixBuilder.h"
+
+#include <fcntl.h>
+#include <cstring>
+#include <filesystem>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+StreamingSparseMatrixBuilder<ValueType>::StreamingSparseMatrixBuilder(std::string const& filename, bool hasCustomRowGrouping)
+    : filename(filename), hasCustomRowGrouping(hasCustomRowGrouping), lastRow(0), lastColumn(0), highestColumn(0), numberOfEntries(0) {
+    STORM_LOG_THROW(std::is_trivially_copyable<ValueType>::value, storm::exceptions::NotSupportedException,
+                    "Streaming the entries of a matrix to disk is not supported for this value type.");
+    entryStream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(entryStream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+}
+
+template<typename ValueType>
+StreamingSparseMatrixBuilder<ValueType>::~StreamingSparseMatrixBuilder() {
+    entryStream.close();
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+}
+
+template<typename ValueType>
+void StreamingSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, value_type const& value) {
+    // Check that we did not move backwards wrt. the row and column.
+    STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+    // Rows are only started by adding an entry, so a started row is the row of the previous entry.
+    STORM_LOG_THROW(row >= rowIndications.size() || column > lastColumn, storm::exceptions::InvalidArgumentException,
+                    "Adding an element in column " << column << " in row " << row << ", but an element in column " << lastColumn
+                                                   << " has already been added in that row.");
+
+    // Start all rows up to the given one.
+    while (rowIndications.size() <= row) {
+        rowIndications.push_back(numberOfEntries);
+    }
+
+    MatrixEntry<index_type, value_type> entry(column, value);
+    entryStream.write(reinterpret_cast<char const*>(&entry), sizeof(entry));
+    STORM_LOG_THROW(entryStream, storm::exceptions::FileIoException, "Could not write to file " << filename << ".");
+
+    lastRow = row;
+    lastColumn = column;
+    highestColumn = std::max(highestColumn, column);
+    ++numberOfEntries;
+}
+
+template<typename ValueType>
+void StreamingSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+    STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidArgumentException, "Matrix was not created to have a custom row grouping.");
+    STORM_LOG_THROW(rowGroupIndices.empty() || startingRow >= rowGroupIndices.back(), storm::exceptions::InvalidArgumentException,
+                    "Illegal row group with negative size.");
+    STORM_LOG_THROW(startingRow >= rowIndications.size(), storm::exceptions::InvalidArgumentException,
+                    "Row group starts at row " << startingRow << ", but row " << (rowIndications.size() - 1) << " already has entries.");
+    rowGroupIndices.push_back(startingRow);
+}
+
+template<typename ValueType>
+typename StreamingSparseMatrixBuilder<ValueType>::index_type StreamingSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+    return hasCustomRowGrouping ? rowGroupIndices.size() : rowIndications.size();
+}
+
+template<typename ValueType>
+typename StreamingSparseMatrixBuilder<ValueType>::index_type StreamingSparseMatrixBuilder<ValueType>::getNumberOfEntries() const {
+    return numberOfEntries;
+}
+
+template<typename ValueType>
+SparseMatrix<ValueType> StreamingSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount,
+                                                                      index_type overriddenRowGroupCount) {
+    entryStream.close();
+    STORM_LOG_THROW(entryStream, storm::exceptions::FileIoException, "Could not write to file " << filename << ".");
+
+    index_type rowCount = rowIndications.size();
+    // If the last row group is empty, this empty row still needs to be counted.
+    if (hasCustomRowGrouping && !rowGroupIndices.empty()) {
+        rowCount = std::max(rowCount, rowGroupIndices.back() + 1);
+    }
+    rowCount = std::max(rowCount, overriddenRowCount);
+    while (rowIndications.size() < rowCount) {
+        rowIndications.push_back(numberOfEntries);
+    }
+    if (rowCount > 0) {
+        rowIndications.push_back(numberOfEntries);
+    }
+
+    index_type columnCount = numberOfEntries > 0 ? highestColumn + 1 : 0;
+    columnCount = std::max(columnCount, overriddenColumnCount);
+
+    boost::optional<std::vector<index_type>> finalRowGroupIndices;
+    if (hasCustomRowGrouping) {
+        index_type rowGroupCount = std::max<index_type>(rowGroupIndices.size(), overriddenRowGroupCount);
+        while (rowGroupIndices.size() <= rowGroupCount) {
+            rowGroupIndices.push_back(rowCount);
+        }
+        finalRowGroupIndices = std::move(rowGroupIndices);
+    }
+
+    std::vector<MatrixEntry<index_type, value_type>> entries;
+    readEntries(entries);
+    std::error_code error;
+    std::filesystem::remove(filename, error);
+
+    return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(entries), std::move(finalRowGroupIndices));
+}
+
+template<typename ValueType>
+void StreamingSparseMatrixBuilder<ValueType>::readEntries(std::vector<MatrixEntry<index_type, value_type>>& entries) const {
+    uint64_t const size = numberOfEntries * sizeof(MatrixEntry<index_type, value_type>);
+    if (size == 0) {
+        return;
+    }
+#if defined LINUX || defined MACOSX
+    int file = open(filename.c_str(), O_RDONLY);
+    STORM_LOG_THROW(file >= 0, storm::exceptions::FileIoException, "Could not open file " << filename << ": " << std::strerror(errno));
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (data == MAP_FAILED) {
+        close(file);
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Could not map file " << filename << ": " << std::strerror(errno));
+    }
+    // The entries are read once and in order, so the kernel may read ahead aggressively.
+    madvise(data, size, MADV_SEQUENTIAL);
+    auto first = static_cast<MatrixEntry<index_type, value_type> const*>(data);
+    entries.assign(first, first + numberOfEntries);
+    munmap(data, size);
+    close(file);
+#else
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+    entries.resize(numberOfEntries);
+    stream.read(reinterpret_cast<char*>(entries.data()), size);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not read file " << filename << ".");
+#endif
+}
+
+template class StreamingSparseMatrixBuilder<double>;
+#ifdef STORM_HAVE_CARL
+template class StreamingSparseMatrixBuilder<storm::RationalNumber>;
+template class StreamingSparseMatrixBuilder<storm::RationalFunction>;
+#endif
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A builder for sparse matrices that writes the entries to a (temporary) binary file instead of keeping them in
+ * memory. Only the row indications and row group indices are held in memory. Upon building the matrix, the file is
+ * mapped into memory and the entries are copied into the matrix in one go. Compared to the SparseMatrixBuilder, this
+ * avoids holding the entries twice while the entry vector is grown. Entries have to be added in the same order as for
+ * the SparseMatrixBuilder, i.e. row by row and with increasing columns within each row.
+ *
+ * As the entries are stored as they are held in memory, the builder is only available for trivially copyable value
+ * types (e.g. double).
+ */
+template<typename ValueType>
+class StreamingSparseMatrixBuilder {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ValueType value_type;
+
+    /*!
+     * Constructs a builder that writes the entries to the given file. The file is removed once the builder is
+     * destroyed.
+     *
+     * @param filename The name of the file holding the entries.
+     * @param hasCustomRowGrouping If set, the matrix has a custom row grouping whose groups are started through calls
+     * to newRowGroup.
+     */
+    StreamingSparseMatrixBuilder(std::string const& filename, bool hasCustomRowGrouping = false);
+
+    StreamingSparseMatrixBuilder(StreamingSparseMatrixBuilder const&) = delete;
+    StreamingSparseMatrixBuilder& operator=(StreamingSparseMatrixBuilder const&) = delete;
+
+    ~StreamingSparseMatrixBuilder();
+
+    /*!
+     * Sets the matrix entry at the given row and column to the given value. The row must not be smaller than the row
+     * of the previously added entry and, within the same row, the column must be larger than the previous one.
+     *
+     * @param row The row in which the matrix entry is to be set.
+     * @param column The column in which the matrix entry is to be set.
+     * @param value The value that is to be set at the specified row and column.
+     */
+    void addNextValue(index_type row, index_type column, value_type const& value);
+
+    /*!
+     * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row group
+     * are added.
+     *
+     * @param startingRow The starting row of the new row group.
+     */
+    void newRowGroup(index_type startingRow);
+
+    /*!
+     * Retrieves the number of row groups that were started so far (or the number of rows with entries if the matrix
+     * has no custom row grouping).
+     */
+    index_type getCurrentRowGroupCount() const;
+
+    /*!
+     * Retrieves the number of entries that were added so far.
+     */
+    index_type getNumberOfEntries() const;
+
+    /*!
+     * Assembles the matrix from the entries in the file. Afterwards, the builder must not be used anymore.
+     *
+     * @param overriddenRowCount If this is set to a value that is greater than the current number of rows, empty rows
+     * are appended.
+     * @param overriddenColumnCount If this is set to a value that is greater than the current number of columns, the
+     * column count is increased accordingly.
+     * @param overriddenRowGroupCount If this is set to a value that is greater than the current number of row groups,
+     * empty row groups are appended.
+     */
+    SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+   private:
+    // Reads the entries from the file into the given vector.
+    void readEntries(std::vector<MatrixEntry<index_type, value_type>>& entries) const;
+
+    // The file holding the entries and the stream writing to it.
+    std::string filename;
+    std::ofstream entryStream;
+
+    bool hasCustomRowGrouping;
+
+    // The start of the rows (and row groups) that were started so far.
+    std::vector<index_type> rowIndications;
+    std::vector<index_type> rowGroupIndices;
+
+    // The position of the last entry and the highest column that was seen.
+    index_type lastRow;
+    index_type lastColumn;
+    index_type highestColumn;
+    index_type numberOfEntries;
+};
+
+}  // namespace storage
+}  // namespace storm
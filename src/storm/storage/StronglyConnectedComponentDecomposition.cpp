@@ -5,6 +5,12 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -171,6 +177,12 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
     STORM_LOG_ASSERT(!options.choicesPtr || options.subsystemPtr, "Expecting subsystem if choices are given.");
 
+    uint64_t numberOfThreads = storm::utility::parallel::getNumberOfThreads(options.requestedNumberOfThreads);
+    if (numberOfThreads > 1 && !options.isTopologicalSortForced && !options.isComputeSccDepthsSet) {
+        performParallelSccDecomposition(transitionMatrix, options, numberOfThreads);
+        return;
+    }
+
     uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
     uint_fast64_t sccCount = 0;
 
@@ -257,6 +269,303 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
     }
 }
 
+namespace {
+/*!
+ * Data of the parallel forward-backward SCC decomposition that is shared by all threads. Tasks (i.e., sets of states that
+ * are a union of SCCs) are disjoint, so concurrently processed tasks never access the entries of the same state.
+ */
+struct ForwardBackwardSccData {
+    static constexpr uint64_t noTask = std::numeric_limits<uint64_t>::max();
+
+    /// The (non-selfloop) successors and predecessors of each state in the considered subsystem.
+    std::vector<uint64_t> successorIndications;
+    std::vector<uint64_t> successors;
+    std::vector<uint64_t> predecessorIndications;
+    std::vector<uint64_t> predecessors;
+    std::vector<uint8_t> hasSelfloop;
+
+    /// The task each state currently belongs to (or noTask if the SCC of the state is known).
+    std::vector<uint64_t> taskOfState;
+    std::atomic<uint64_t> nextTask;
+
+    /// Helper memory indexed by states.
+    std::vector<uint64_t> inDegree;
+    std::vector<uint64_t> outDegree;
+    std::vector<uint8_t> reached;
+};
+
+/*!
+ * The result of processing tasks on a single thread.
+ */
+struct ForwardBackwardSccThreadResult {
+    std::vector<std::vector<uint64_t>> newTasks;
+    std::vector<std::vector<uint64_t>> sccs;
+    std::vector<uint64_t> singletonSccs;
+};
+
+/*!
+ * Processes a task of the forward-backward algorithm: first, states without predecessors or successors in the task are
+ * split off as singleton SCCs (trimming). Then, the SCC of a pivot state is obtained as the intersection of its forward
+ * and backward reachable states. The remaining states are split into (at most) three new tasks.
+ */
+void processForwardBackwardSccTask(ForwardBackwardSccData& data, std::vector<uint64_t> const& states, ForwardBackwardSccThreadResult& result) {
+    uint64_t const task = data.taskOfState[states.front()];
+    auto const& successorIndications = data.successorIndications;
+    auto const& predecessorIndications = data.predecessorIndications;
+
+    // Trim states without predecessors or successors within the task.
+    std::vector<uint64_t> stack;
+    for (auto state : states) {
+        uint64_t& inDegree = data.inDegree[state];
+        uint64_t& outDegree = data.outDegree[state];
+        inDegree = 0;
+        outDegree = 0;
+        for (uint64_t i = successorIndications[state]; i < successorIndications[state + 1]; ++i) {
+            if (data.taskOfState[data.successors[i]] == task) {
+                ++outDegree;
+            }
+        }
+        for (uint64_t i = predecessorIndications[state]; i < predecessorIndications[state + 1]; ++i) {
+            if (data.taskOfState[data.predecessors[i]] == task) {
+                ++inDegree;
+            }
+        }
+        if (inDegree == 0 || outDegree == 0) {
+            stack.push_back(state);
+        }
+    }
+    while (!stack.empty()) {
+        uint64_t state = stack.back();
+        stack.pop_back();
+        if (data.taskOfState[state] != task) {
+            continue;
+        }
+        data.taskOfState[state] = ForwardBackwardSccData::noTask;
+        result.singletonSccs.push_back(state);
+        for (uint64_t i = successorIndications[state]; i < successorIndications[state + 1]; ++i) {
+            uint64_t successor = data.successors[i];
+            if (data.taskOfState[successor] == task && --data.inDegree[successor] == 0) {
+                stack.push_back(successor);
+            }
+        }
+        for (uint64_t i = predecessorIndications[state]; i < predecessorIndications[state + 1]; ++i) {
+            uint64_t predecessor = data.predecessors[i];
+            if (data.taskOfState[predecessor] == task && --data.outDegree[predecessor] == 0) {
+                stack.push_back(predecessor);
+            }
+        }
+    }
+
+    // Find a pivot among the remaining states.
+    auto pivotIt = std::find_if(states.begin(), states.end(), [&data, task](uint64_t state) { return data.taskOfState[state] == task; });
+    if (pivotIt == states.end()) {
+        return;
+    }
+
+    // Mark the states that are forward (1) and backward (2) reachable from the pivot.
+    auto search = [&data, &stack, task](uint64_t pivot, uint8_t flag, std::vector<uint64_t> const& indications, std::vector<uint64_t> const& targets) {
+        data.reached[pivot] |= flag;
+        stack.push_back(pivot);
+        while (!stack.empty()) {
+            uint64_t state = stack.back();
+            stack.pop_back();
+            for (uint64_t i = indications[state]; i < indications[state + 1]; ++i) {
+                uint64_t target = targets[i];
+                if (data.taskOfState[target] == task && (data.reached[target] & flag) == 0) {
+                    data.reached[target] |= flag;
+                    stack.push_back(target);
+                }
+            }
+        }
+    };
+    search(*pivotIt, 1, successorIndications, data.successors);
+    search(*pivotIt, 2, predecessorIndications, data.predecessors);
+
+    // Split the remaining states into the SCC of the pivot and the new tasks.
+    std::vector<uint64_t> scc;
+    std::vector<uint64_t> newTasks[3];
+    for (auto state : states) {
+        if (data.taskOfState[state] == task) {
+            uint8_t reached = data.reached[state];
+            data.reached[state] = 0;
+            if (reached == 3) {
+                scc.push_back(state);
+            } else {
+                newTasks[reached].push_back(state);
+            }
+        }
+    }
+    for (auto state : scc) {
+        data.taskOfState[state] = ForwardBackwardSccData::noTask;
+    }
+    if (scc.size() == 1) {
+        result.singletonSccs.push_back(scc.front());
+    } else {
+        result.sccs.push_back(std::move(scc));
+    }
+    for (auto& newTask : newTasks) {
+        if (!newTask.empty()) {
+            uint64_t newTaskIndex = data.nextTask++;
+            for (auto state : newTask) {
+                data.taskOfState[state] = newTaskIndex;
+            }
+            result.newTasks.push_back(std::move(newTask));
+        }
+    }
+}
+}  // namespace
+
+template<typename ValueType>
+void StronglyConnectedComponentDecomposition<ValueType>::performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                         StronglyConnectedComponentDecompositionOptions const& options,
+                                                                                         uint64_t numberOfThreads) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    uint64_t const chunkSize = 1024;
+    sccDepths = boost::none;
+    this->blocks.clear();
+
+    ForwardBackwardSccData data;
+    data.taskOfState.assign(numberOfStates, ForwardBackwardSccData::noTask);
+    std::vector<uint64_t> initialTask;
+    if (options.subsystemPtr) {
+        initialTask.reserve(options.subsystemPtr->getNumberOfSetBits());
+        initialTask.insert(initialTask.end(), options.subsystemPtr->begin(), options.subsystemPtr->end());
+    } else {
+        initialTask.resize(numberOfStates);
+        std::iota(initialTask.begin(), initialTask.end(), static_cast<uint64_t>(0));
+    }
+    if (initialTask.empty()) {
+        return;
+    }
+    for (auto state : initialTask) {
+        data.taskOfState[state] = 0;
+    }
+    data.nextTask = 1;
+
+    // Build the graph of the subsystem. The successors are counted and inserted in parallel.
+    data.successorIndications.assign(numberOfStates + 1, 0);
+    data.hasSelfloop.assign(numberOfStates, 0);
+    auto forEachSuccessor = [&transitionMatrix, &options](uint64_t state, auto const& function) {
+        for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+            if (options.choicesPtr && !options.choicesPtr->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!options.subsystemPtr || options.subsystemPtr->get(successor.getColumn())) && !storm::utility::isZero(successor.getValue())) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    };
+    storm::utility::parallel::forEachChunk(0, numberOfStates, chunkSize, numberOfThreads, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (data.taskOfState[state] == 0) {
+                forEachSuccessor(state, [&data, state](uint64_t successor) {
+                    if (successor == state) {
+                        data.hasSelfloop[state] = 1;
+                    } else {
+                        ++data.successorIndications[state + 1];
+                    }
+                });
+            }
+        }
+    });
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        data.successorIndications[state + 1] += data.successorIndications[state];
+    }
+    data.successors.resize(data.successorIndications.back());
+    storm::utility::parallel::forEachChunk(0, numberOfStates, chunkSize, numberOfThreads, [&](uint64_t, uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (data.taskOfState[state] == 0) {
+                uint64_t position = data.successorIndications[state];
+                forEachSuccessor(state, [&data, &position, state](uint64_t successor) {
+                    if (successor != state) {
+                        data.successors[position++] = successor;
+                    }
+                });
+            }
+        }
+    });
+    data.predecessorIndications.assign(numberOfStates + 1, 0);
+    for (auto successor : data.successors) {
+        ++data.predecessorIndications[successor + 1];
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        data.predecessorIndications[state + 1] += data.predecessorIndications[state];
+    }
+    data.predecessors.resize(data.successors.size());
+    {
+        std::vector<uint64_t> positions(data.predecessorIndications.begin(), data.predecessorIndications.end() - 1);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (uint64_t i = data.successorIndications[state]; i < data.successorIndications[state + 1]; ++i) {
+                data.predecessors[positions[data.successors[i]]++] = state;
+            }
+        }
+    }
+    data.inDegree.resize(numberOfStates);
+    data.outDegree.resize(numberOfStates);
+    data.reached.assign(numberOfStates, 0);
+
+    // Process the tasks in rounds. Tasks of the same round are independent and can thus be processed concurrently.
+    std::vector<ForwardBackwardSccThreadResult> threadResults(numberOfThreads);
+    std::vector<std::vector<uint64_t>> tasks;
+    tasks.push_back(std::move(initialTask));
+    while (!tasks.empty()) {
+        storm::utility::parallel::forEachChunk(0, tasks.size(), 1, numberOfThreads, [&](uint64_t threadIndex, uint64_t begin, uint64_t end) {
+            for (uint64_t task = begin; task < end; ++task) {
+                processForwardBackwardSccTask(data, tasks[task], threadResults[threadIndex]);
+            }
+        });
+        tasks.clear();
+        for (auto& threadResult : threadResults) {
+            std::move(threadResult.newTasks.begin(), threadResult.newTasks.end(), std::back_inserter(tasks));
+            threadResult.newTasks.clear();
+        }
+    }
+
+    // Build the blocks. Trivial SCCs are singletons without a selfloop.
+    std::vector<uint64_t>& stateToSccMapping = data.inDegree;
+    for (auto& threadResult : threadResults) {
+        for (auto state : threadResult.singletonSccs) {
+            stateToSccMapping[state] = this->blocks.size();
+            this->blocks.emplace_back();
+            this->blocks.back().insert(state);
+            this->blocks.back().setIsTrivial(!data.hasSelfloop[state]);
+        }
+        for (auto& scc : threadResult.sccs) {
+            std::sort(scc.begin(), scc.end());
+            this->blocks.emplace_back();
+            for (auto state : scc) {
+                stateToSccMapping[state] = this->blocks.size() - 1;
+                this->blocks.back().insert(this->blocks.back().end(), state);
+            }
+            this->blocks.back().setIsTrivial(false);
+        }
+    }
+    STORM_LOG_DEBUG("Parallel SCC decomposition found " << this->blocks.size() << " SCC(s) using " << numberOfThreads << " thread(s).");
+
+    // If requested, drop naive and non-bottom SCCs.
+    if (options.areOnlyBottomSccsConsidered || options.areNaiveSccsDropped) {
+        storm::storage::BitVector blocksToDrop(this->blocks.size());
+        for (uint64_t sccIndex = 0; sccIndex < this->blocks.size(); ++sccIndex) {
+            auto const& scc = this->blocks[sccIndex];
+            if (options.areNaiveSccsDropped && scc.isTrivial()) {
+                blocksToDrop.set(sccIndex, true);
+            } else if (options.areOnlyBottomSccsConsidered) {
+                for (auto state : scc) {
+                    auto successorsBegin = data.successors.begin() + data.successorIndications[state];
+                    auto successorsEnd = data.successors.begin() + data.successorIndications[state + 1];
+                    if (std::any_of(successorsBegin, successorsEnd, [&](uint64_t successor) { return stateToSccMapping[successor] != sccIndex; })) {
+                        blocksToDrop.set(sccIndex, true);
+                        break;
+                    }
+                }
+            }
+        }
+        storm::utility::vector::filterVectorInPlace(this->blocks, ~blocksToDrop);
+    }
+}
+
 template<typename ValueType>
 bool StronglyConnectedComponentDecomposition<ValueType>::hasSccDepth() const {
     return sccDepths.is_initialized();
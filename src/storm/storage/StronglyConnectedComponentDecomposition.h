@@ -49,6 +49,12 @@ struct StronglyConnectedComponentDecompositionOptions {
         isComputeSccDepthsSet = value;
         return *this;
     }
+    /// Sets the number of threads (where 0 means auto-detect). With more than one thread, a parallel forward-backward algorithm
+    /// is used unless a topological sort or scc depths are requested.
+    StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value) {
+        requestedNumberOfThreads = value;
+        return *this;
+    }
 
     storm::storage::BitVector const* subsystemPtr = nullptr;
     storm::storage::BitVector const* choicesPtr = nullptr;
@@ -56,6 +62,7 @@ struct StronglyConnectedComponentDecompositionOptions {
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t requestedNumberOfThreads = 1;
 };
 
 /*!
@@ -136,6 +143,16 @@ class StronglyConnectedComponentDecomposition : public Decomposition<StronglyCon
     void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                  StronglyConnectedComponentDecompositionOptions const& options);
 
+    /*
+     * Performs the SCC decomposition using the given number of threads. In contrast to performSccDecomposition,
+     * the SCCs are not sorted topologically.
+     *
+     * @param transitionMatrix The transition matrix of the system to decompose.
+     * @param numberOfThreads The number of threads to use.
+     */
+    void performParallelSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                         StronglyConnectedComponentDecompositionOptions const& options, uint64_t numberOfThreads);
+
     boost::optional<std::vector<uint_fast64_t>> sccDepths;
 };
 }  // namespace storage
@@ -0,0 +1,329 @@
+#include "storm/storage/TreeCompressedBitVectorMap.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/exceptions/OutOfRangeException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::TreeCompressedBitVectorMapIterator(TreeCompressedBitVectorMap const& map,
+                                                                                                              uint64_t index)
+    : map(&map), index(index) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::operator==(TreeCompressedBitVectorMapIterator const& other) const {
+    return map == other.map && index == other.index;
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::operator!=(TreeCompressedBitVectorMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator&
+TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::operator++(int) {
+    ++index;
+    return *this;
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator&
+TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::operator++() {
+    ++index;
+    return *this;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, ValueType> TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMapIterator::operator*() const {
+    return map->getBucketAndValue(index);
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorMap<ValueType>::InternTable::InternTable(uint64_t wordsPerEntry) : wordsPerEntry(wordsPerEntry), numberOfEntries(0), slots(16, 0) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::InternTable::hash(uint64_t const* entry) const {
+    // Mix the words of the entry with the finalizer of MurmurHash3.
+    uint64_t result = 0x9e3779b97f4a7c15ull ^ wordsPerEntry;
+    for (uint64_t word = 0; word < wordsPerEntry; ++word) {
+        uint64_t value = entry[word] ^ result;
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        result = value + 0x9e3779b97f4a7c15ull * (word + 1);
+    }
+    return result;
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::InternTable::findSlot(uint64_t const* entry) const {
+    // The number of slots is a power of two, so the slot can be obtained by masking.
+    uint64_t const mask = slots.size() - 1;
+    uint64_t slot = hash(entry) & mask;
+    while (slots[slot] != 0) {
+        uint64_t const* candidate = getEntry(slots[slot] - 1);
+        if (std::equal(entry, entry + wordsPerEntry, candidate)) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorMap<ValueType>::InternTable::increaseSize() {
+    slots.assign(slots.size() * 2, 0);
+    uint64_t const mask = slots.size() - 1;
+    for (uint64_t index = 0; index < numberOfEntries; ++index) {
+        uint64_t slot = hash(getEntry(index)) & mask;
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = static_cast<uint32_t>(index + 1);
+    }
+}
+
+template<typename ValueType>
+uint32_t TreeCompressedBitVectorMap<ValueType>::InternTable::findOrAdd(uint64_t const* entry) {
+    uint64_t slot = findSlot(entry);
+    if (slots[slot] != 0) {
+        return slots[slot] - 1;
+    }
+
+    // The slots hold the index plus one, so the largest index must be representable after this increment.
+    STORM_LOG_THROW(numberOfEntries + 1 < std::numeric_limits<uint32_t>::max(), storm::exceptions::OutOfRangeException,
+                    "Too many distinct entries in a table of the tree-compressed map.");
+    uint32_t index = static_cast<uint32_t>(numberOfEntries);
+    entries.insert(entries.end(), entry, entry + wordsPerEntry);
+    ++numberOfEntries;
+    slots[slot] = index + 1;
+
+    // Keep the load of the slots below 3/4.
+    if (4 * numberOfEntries > 3 * slots.size()) {
+        increaseSize();
+    }
+    return index;
+}
+
+template<typename ValueType>
+boost::optional<uint32_t> TreeCompressedBitVectorMap<ValueType>::InternTable::find(uint64_t const* entry) const {
+    uint64_t slot = findSlot(entry);
+    if (slots[slot] == 0) {
+        return boost::none;
+    }
+    return slots[slot] - 1;
+}
+
+template<typename ValueType>
+uint64_t const* TreeCompressedBitVectorMap<ValueType>::InternTable::getEntry(uint32_t index) const {
+    return entries.data() + index * wordsPerEntry;
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::InternTable::size() const {
+    return numberOfEntries;
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::InternTable::getSizeInMemory() const {
+    return sizeof(*this) + entries.capacity() * sizeof(uint64_t) + slots.capacity() * sizeof(uint32_t);
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorMap<ValueType>::Node::Node(uint64_t firstBit, uint64_t numberOfBits)
+    : leftChild(0), rightChild(0), firstBit(firstBit), numberOfBits(numberOfBits), table((numberOfBits + 63) / 64) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorMap<ValueType>::Node::Node(uint64_t leftChild, uint64_t rightChild, uint64_t firstBit, uint64_t numberOfBits)
+    : leftChild(leftChild), rightChild(rightChild), firstBit(firstBit), numberOfBits(numberOfBits), table(1) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorMap<ValueType>::Node::isLeaf() const {
+    return leftChild == rightChild;
+}
+
+template<typename ValueType>
+TreeCompressedBitVectorMap<ValueType>::TreeCompressedBitVectorMap(uint64_t bucketSize, std::vector<uint_fast64_t> const& componentOffsets)
+    : bucketSize(bucketSize) {
+    std::vector<uint_fast64_t> offsets = {0};
+    for (auto offset : componentOffsets) {
+        if (offset > offsets.back() && offset < bucketSize) {
+            offsets.push_back(offset);
+        }
+    }
+    offsets.push_back(bucketSize);
+
+    nodes.reserve(2 * (offsets.size() - 1) - 1);
+    createNodes(offsets, 0, offsets.size() - 1);
+
+    uint64_t maximalNumberOfWords = 1;
+    for (auto const& node : nodes) {
+        if (node.isLeaf()) {
+            maximalNumberOfWords = std::max<uint64_t>(maximalNumberOfWords, (node.numberOfBits + 63) / 64);
+        }
+    }
+    buffer.resize(maximalNumberOfWords);
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::createNodes(std::vector<uint_fast64_t> const& offsets, uint64_t firstComponent, uint64_t lastComponent) {
+    if (lastComponent - firstComponent == 1) {
+        nodes.emplace_back(offsets[firstComponent], offsets[lastComponent] - offsets[firstComponent]);
+    } else {
+        uint64_t middleComponent = firstComponent + (lastComponent - firstComponent) / 2;
+        uint64_t leftChild = createNodes(offsets, firstComponent, middleComponent);
+        uint64_t rightChild = createNodes(offsets, middleComponent, lastComponent);
+        nodes.emplace_back(leftChild, rightChild, offsets[firstComponent], offsets[lastComponent] - offsets[firstComponent]);
+    }
+    return nodes.size() - 1;
+}
+
+template<typename ValueType>
+uint32_t TreeCompressedBitVectorMap<ValueType>::findOrAddIndex(uint64_t node, storm::storage::BitVector const& key) {
+    Node& currentNode = nodes[node];
+    if (currentNode.isLeaf()) {
+        uint64_t word = 0;
+        for (uint64_t bit = 0; bit < currentNode.numberOfBits; bit += 64, ++word) {
+            buffer[word] = key.getAsInt(currentNode.firstBit + bit, std::min<uint64_t>(64, currentNode.numberOfBits - bit));
+        }
+        return currentNode.table.findOrAdd(buffer.data());
+    }
+
+    uint64_t entry = static_cast<uint64_t>(findOrAddIndex(currentNode.leftChild, key)) << 32;
+    entry |= findOrAddIndex(currentNode.rightChild, key);
+    return nodes[node].table.findOrAdd(&entry);
+}
+
+template<typename ValueType>
+boost::optional<uint32_t> TreeCompressedBitVectorMap<ValueType>::findIndex(uint64_t node, storm::storage::BitVector const& key) const {
+    Node const& currentNode = nodes[node];
+    if (currentNode.isLeaf()) {
+        uint64_t word = 0;
+        for (uint64_t bit = 0; bit < currentNode.numberOfBits; bit += 64, ++word) {
+            buffer[word] = key.getAsInt(currentNode.firstBit + bit, std::min<uint64_t>(64, currentNode.numberOfBits - bit));
+        }
+        return currentNode.table.find(buffer.data());
+    }
+
+    boost::optional<uint32_t> leftIndex = findIndex(currentNode.leftChild, key);
+    if (!leftIndex) {
+        return boost::none;
+    }
+    boost::optional<uint32_t> rightIndex = findIndex(currentNode.rightChild, key);
+    if (!rightIndex) {
+        return boost::none;
+    }
+    uint64_t entry = (static_cast<uint64_t>(leftIndex.get()) << 32) | rightIndex.get();
+    return currentNode.table.find(&entry);
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorMap<ValueType>::reconstruct(uint64_t node, uint32_t index, storm::storage::BitVector& key) const {
+    Node const& currentNode = nodes[node];
+    uint64_t const* entry = currentNode.table.getEntry(index);
+    if (currentNode.isLeaf()) {
+        uint64_t word = 0;
+        for (uint64_t bit = 0; bit < currentNode.numberOfBits; bit += 64, ++word) {
+            key.setFromInt(currentNode.firstBit + bit, std::min<uint64_t>(64, currentNode.numberOfBits - bit), entry[word]);
+        }
+    } else {
+        reconstruct(currentNode.leftChild, static_cast<uint32_t>(*entry >> 32), key);
+        reconstruct(currentNode.rightChild, static_cast<uint32_t>(*entry & 0xffffffffull), key);
+    }
+}
+
+template<typename ValueType>
+storm::storage::BitVector TreeCompressedBitVectorMap<ValueType>::getKey(uint64_t index) const {
+    storm::storage::BitVector key(bucketSize);
+    reconstruct(nodes.size() - 1, static_cast<uint32_t>(index), key);
+    return key;
+}
+
+template<typename ValueType>
+ValueType TreeCompressedBitVectorMap<ValueType>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddAndGetBucket(key, value).first;
+}
+
+template<typename ValueType>
+std::pair<ValueType, uint64_t> TreeCompressedBitVectorMap<ValueType>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Bit vector has invalid size.");
+    uint64_t index = findOrAddIndex(nodes.size() - 1, key);
+    // The indices of the root are handed out consecutively, so a new key is mapped to the next value.
+    if (index == values.size()) {
+        values.push_back(value);
+    }
+    return std::make_pair(values[index], index);
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, ValueType> TreeCompressedBitVectorMap<ValueType>::getBucketAndValue(uint64_t bucket) const {
+    return std::make_pair(getKey(bucket), values[bucket]);
+}
+
+template<typename ValueType>
+ValueType TreeCompressedBitVectorMap<ValueType>::getValue(storm::storage::BitVector const& key) const {
+    boost::optional<uint32_t> index = findIndex(nodes.size() - 1, key);
+    STORM_LOG_ASSERT(index, "Unknown key.");
+    return values[index.get()];
+}
+
+template<typename ValueType>
+bool TreeCompressedBitVectorMap<ValueType>::contains(storm::storage::BitVector const& key) const {
+    return static_cast<bool>(findIndex(nodes.size() - 1, key));
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorMap<ValueType>::const_iterator TreeCompressedBitVectorMap<ValueType>::begin() const {
+    return const_iterator(*this, 0);
+}
+
+template<typename ValueType>
+typename TreeCompressedBitVectorMap<ValueType>::const_iterator TreeCompressedBitVectorMap<ValueType>::end() const {
+    return const_iterator(*this, values.size());
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::size() const {
+    return values.size();
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::getNumberOfComponents() const {
+    return (nodes.size() + 1) / 2;
+}
+
+template<typename ValueType>
+uint64_t TreeCompressedBitVectorMap<ValueType>::getSizeInMemory() const {
+    uint64_t result = sizeof(*this) + values.capacity() * sizeof(ValueType) + buffer.capacity() * sizeof(uint64_t);
+    for (auto const& node : nodes) {
+        result += node.table.getSizeInMemory() + sizeof(Node) - sizeof(InternTable);
+    }
+    return result;
+}
+
+template<typename ValueType>
+void TreeCompressedBitVectorMap<ValueType>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+    for (auto& value : values) {
+        value = remapping(value);
+    }
+}
+
+template class TreeCompressedBitVectorMap<uint32_t>;
+template class TreeCompressedBitVectorMap<uint64_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a map whose keys are bit vectors that are stored in a tree-compressed form. The bits of the keys
+ * are split into components (e.g. the variables of the modules of a PRISM program). The components form the leaves of
+ * a balanced binary tree. Every node of the tree owns a table in which its distinct values are interned: a leaf interns
+ * the distinct values of its component and an interior node interns the distinct pairs of indices of its children. A
+ * key is thus identified by its index in the table of the root and the storage only grows with the number of distinct
+ * (partial) combinations of components. If the components change independently of each other (as the modules of a
+ * system), this is typically much smaller than storing every key in full.
+ *
+ * Like the BitVectorHashMap, only queries and insertions are supported.
+ */
+template<typename ValueType>
+class TreeCompressedBitVectorMap {
+   public:
+    class TreeCompressedBitVectorMapIterator {
+       public:
+        /*!
+         * Creates an iterator that points to the key with the given index in the given map.
+         *
+         * @param map The map of the iterator.
+         * @param index The index of the key the iterator points to.
+         */
+        TreeCompressedBitVectorMapIterator(TreeCompressedBitVectorMap const& map, uint64_t index);
+
+        // Methods to compare two iterators.
+        bool operator==(TreeCompressedBitVectorMapIterator const& other) const;
+        bool operator!=(TreeCompressedBitVectorMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        TreeCompressedBitVectorMapIterator& operator++(int);
+        TreeCompressedBitVectorMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // The map this iterator refers to.
+        TreeCompressedBitVectorMap const* map;
+
+        // The index of the key this iterator points to.
+        uint64_t index;
+    };
+
+    typedef TreeCompressedBitVectorMapIterator const_iterator;
+
+    /*!
+     * Creates a new map for keys of the given size whose components start at the given offsets.
+     *
+     * @param bucketSize The size of the keys that this map can hold.
+     * @param componentOffsets The (increasing) bit offsets at which the components of the keys start. Offsets that are
+     * not smaller than the bucket size are ignored and the first component always starts at offset zero.
+     */
+    TreeCompressedBitVectorMap(uint64_t bucketSize, std::vector<uint_fast64_t> const& componentOffsets);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return A pair whose first component is the found value if the key is already contained in the map and
+     * the provided new value otherwise and whose second component is the index of the key (which plays the role of
+     * the bucket of a hash map).
+     */
+    std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Retrieves the key with the given index and the value it is mapped to.
+     *
+     * @param bucket The index of the key.
+     * @return The key and value with the given index.
+     */
+    std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search.
+     * @return True if the key is already contained in the map.
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map. The elements are visited in the order in which they were
+     * inserted.
+     *
+     * @return The iterator.
+     */
+    const_iterator begin() const;
+
+    /*!
+     * Retrieves an iterator that points one past the elements of the map.
+     *
+     * @return The iterator.
+     */
+    const_iterator end() const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of components in which the keys are split.
+     */
+    uint64_t getNumberOfComponents() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by the map.
+     */
+    uint64_t getSizeInMemory() const;
+
+    /*!
+     * Performs a remapping of all values stored by applying the given remapping.
+     *
+     * @param remapping The remapping to apply.
+     */
+    void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+   private:
+    /*!
+     * A table that interns entries consisting of a fixed number of words. Every distinct entry is assigned a
+     * consecutive index.
+     */
+    class InternTable {
+       public:
+        InternTable(uint64_t wordsPerEntry);
+
+        /*!
+         * Retrieves the index of the given entry. If the entry is not yet contained, it is assigned the next index.
+         */
+        uint32_t findOrAdd(uint64_t const* entry);
+
+        /*!
+         * Retrieves the index of the given entry, if it is contained.
+         */
+        boost::optional<uint32_t> find(uint64_t const* entry) const;
+
+        /*!
+         * Retrieves the entry with the given index.
+         */
+        uint64_t const* getEntry(uint32_t index) const;
+
+        uint64_t size() const;
+        uint64_t getSizeInMemory() const;
+
+       private:
+        // Computes the hash value of the given entry.
+        uint64_t hash(uint64_t const* entry) const;
+
+        // Retrieves the slot that holds the given entry or the empty slot at which it would be inserted.
+        uint64_t findSlot(uint64_t const* entry) const;
+
+        // Doubles the number of slots.
+        void increaseSize();
+
+        uint64_t wordsPerEntry;
+        uint64_t numberOfEntries;
+
+        // The entries in the order in which they were added.
+        std::vector<uint64_t> entries;
+
+        // The open-addressing slots. Each slot holds one plus the index of the entry it refers to or zero if it is empty.
+        std::vector<uint32_t> slots;
+    };
+
+    /*!
+     * A node of the tree. Leaves refer to a component of the keys, interior nodes to two other nodes.
+     */
+    struct Node {
+        Node(uint64_t firstBit, uint64_t numberOfBits);
+        Node(uint64_t leftChild, uint64_t rightChild, uint64_t firstBit, uint64_t numberOfBits);
+
+        bool isLeaf() const;
+
+        // The children of interior nodes.
+        uint64_t leftChild;
+        uint64_t rightChild;
+
+        // The bits of the keys that are covered by this node.
+        uint64_t firstBit;
+        uint64_t numberOfBits;
+
+        InternTable table;
+    };
+
+    // Creates the nodes for the given range of components and returns the index of the subtree's root.
+    uint64_t createNodes(std::vector<uint_fast64_t> const& offsets, uint64_t firstComponent, uint64_t lastComponent);
+
+    // Retrieves the index of the given key in the table of the given node, where the key is inserted if necessary.
+    uint32_t findOrAddIndex(uint64_t node, storm::storage::BitVector const& key);
+
+    // Retrieves the index of the given key in the table of the given node (if it is contained).
+    boost::optional<uint32_t> findIndex(uint64_t node, storm::storage::BitVector const& key) const;
+
+    // Writes the bits that the given node represents with the given index into the key.
+    void reconstruct(uint64_t node, uint32_t index, storm::storage::BitVector& key) const;
+
+    // Retrieves the key with the given index.
+    storm::storage::BitVector getKey(uint64_t index) const;
+
+    // The size of the keys.
+    uint64_t bucketSize;
+
+    // The nodes of the tree. The root is stored last.
+    std::vector<Node> nodes;
+
+    // The values of the keys indexed by the index of the key in the table of the root.
+    std::vector<ValueType> values;
+
+    // A buffer that holds the words of a component while it is looked up.
+    mutable std::vector<uint64_t> buffer;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,5 +1,6 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include "storm/exceptions/AbortException.h"
@@ -24,12 +25,52 @@
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace storage {
 
 using namespace bisimulation;
 
+namespace {
+// The number of states whose signatures are computed in one go by a thread.
+uint64_t const signatureChunkSize = 1024;
+
+// The number of states from which on a block is sorted using several threads.
+uint64_t const parallelSortThreshold = 1 << 16;
+
+/*!
+ * Sorts the given range by sorting pieces of the range concurrently and merging the sorted pieces afterwards.
+ */
+template<typename IteratorType, typename LessType>
+void parallelSort(IteratorType first, IteratorType last, LessType const& less, uint64_t numberOfThreads) {
+    uint64_t size = std::distance(first, last);
+    uint64_t numberOfPieces = std::min(numberOfThreads, size);
+    std::vector<IteratorType> bounds;
+    for (uint64_t piece = 0; piece <= numberOfPieces; ++piece) {
+        bounds.push_back(first + size * piece / numberOfPieces);
+    }
+    storm::utility::parallel::forEachChunk(0, numberOfPieces, 1, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+        for (uint64_t piece = chunkBegin; piece < chunkEnd; ++piece) {
+            std::sort(bounds[piece], bounds[piece + 1], less);
+        }
+    });
+    for (uint64_t width = 1; width < numberOfPieces; width *= 2) {
+        storm::utility::parallel::forEachChunk(0, (numberOfPieces + 2 * width - 1) / (2 * width), 1, numberOfThreads,
+                                               [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                   for (uint64_t pair = chunkBegin; pair < chunkEnd; ++pair) {
+                                                       uint64_t left = 2 * width * pair;
+                                                       uint64_t middle = std::min(left + width, numberOfPieces);
+                                                       uint64_t right = std::min(left + 2 * width, numberOfPieces);
+                                                       if (middle < right) {
+                                                           std::inplace_merge(bounds[left], bounds[middle], bounds[right], less);
+                                                       }
+                                                   }
+                                               });
+    }
+}
+}  // namespace
+
 template<typename ModelType, typename BlockDataType>
 BisimulationDecomposition<ModelType, BlockDataType>::Options::Options(ModelType const& model, storm::logic::Formula const& formula) : Options() {
     this->preserveSingleFormula(model, formula);
@@ -59,6 +100,7 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -255,6 +297,14 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    if (options.signatureRefinement) {
+        if (this->supportsSignatureRefinement()) {
+            this->performSignatureRefinement();
+            return;
+        }
+        STORM_LOG_WARN("Signature-based refinement is not supported for this kind of bisimulation, falling back to splitter-based refinement.");
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -287,6 +337,137 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    uint64_t const numberOfStates = model.getNumberOfStates();
+    uint64_t const numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    uint64_t const numberOfChunks = (numberOfStates + signatureChunkSize - 1) / signatureChunkSize;
+
+    std::vector<Signature> signatures(numberOfStates);
+    auto less = [this, &signatures](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        return signatureLess(signatures[state1], signatures[state2]);
+    };
+    // Blocks consisting of a single state as well as absorbing blocks remain as they are.
+    auto possiblyNeedsRefinement = [](Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+
+    uint_fast64_t iterations = 0;
+    bool split = true;
+    while (split) {
+        ++iterations;
+        split = false;
+
+        // Compute the signatures of all states wrt. the current partition.
+        storm::utility::parallel::forEachChunk(0, numberOfStates, signatureChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t position = chunkBegin; position < chunkEnd; ++position) {
+                storm::storage::sparse::state_type state = partition.getState(position);
+                if (possiblyNeedsRefinement(partition.getBlock(state))) {
+                    computeSignature(state, signatures[state]);
+                }
+            }
+        });
+
+        // Sort the states of each block according to their signatures. Large blocks are sorted one after another
+        // using all threads, whereas the remaining blocks are distributed over the threads.
+        std::vector<Block<BlockDataType>*> smallBlocks;
+        for (auto const& block : partition.getBlocks()) {
+            if (!possiblyNeedsRefinement(*block)) {
+                continue;
+            }
+            if (numberOfThreads > 1 && block->getNumberOfStates() >= parallelSortThreshold) {
+                parallelSort(partition.begin(*block), partition.end(*block), less, numberOfThreads);
+                partition.mapStatesToPositions(*block);
+            } else {
+                smallBlocks.push_back(block.get());
+            }
+        }
+        storm::utility::parallel::forEachChunk(0, smallBlocks.size(), 1, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t blockIndex = chunkBegin; blockIndex < chunkEnd; ++blockIndex) {
+                std::sort(partition.begin(*smallBlocks[blockIndex]), partition.end(*smallBlocks[blockIndex]), less);
+                partition.mapStatesToPositions(*smallBlocks[blockIndex]);
+            }
+        });
+
+        // Determine the positions at which the signature changes within a block.
+        std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(numberOfChunks);
+        storm::utility::parallel::forEachChunk(0, numberOfStates, signatureChunkSize, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            auto& positions = splitPositions[chunkBegin / signatureChunkSize];
+            for (uint64_t position = chunkBegin; position < chunkEnd; ++position) {
+                Block<BlockDataType> const& block = partition.getBlock(partition.getState(position));
+                if (position != block.getBeginIndex() && possiblyNeedsRefinement(block) && less(partition.getState(position - 1), partition.getState(position))) {
+                    positions.push_back(position);
+                }
+            }
+        });
+
+        // Finally, split the blocks, which modifies the list of blocks and is therefore done sequentially. As the
+        // new block receives the states before the split position, the states after it still belong to the
+        // original block, so each block is split at its positions in ascending order.
+        for (auto const& positions : splitPositions) {
+            for (auto position : positions) {
+                Block<BlockDataType>& block = partition.getBlock(partition.getState(position));
+                auto newBlockIt = partition.splitBlock(block, position).first;
+                (*newBlockIt)->data().setHasRewards(block.data().hasRewards());
+                split = true;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based partition refinement took " << iterations << " iterations.");
+
+    this->postProcessSignatureRefinement();
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::postProcessSignatureRefinement() {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename BlockDataType>
+bool BisimulationDecomposition<ModelType, BlockDataType>::signatureLess(Signature const& signature1, Signature const& signature2) const {
+    if (signature1.size() != signature2.size()) {
+        return signature1.size() < signature2.size();
+    }
+    for (auto firstIt = signature1.begin(), secondIt = signature2.begin(); firstIt != signature1.end(); ++firstIt, ++secondIt) {
+        if (firstIt->first != secondIt->first) {
+            return firstIt->first < secondIt->first;
+        }
+        if (!comparator.isEqual(firstIt->second, secondIt->second)) {
+            return comparator.isLess(firstIt->second, secondIt->second);
+        }
+    }
+    return false;
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::appendBlockProbabilitiesToSignature(uint_fast64_t row, Signature& signature) const {
+    auto const firstEntry = signature.size();
+    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
+        signature.emplace_back(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+    }
+    std::sort(signature.begin() + firstEntry, signature.end(),
+              [](typename Signature::value_type const& a, typename Signature::value_type const& b) { return a.first < b.first; });
+
+    // Accumulate the probabilities of moving to the same block and drop the blocks that are reached with probability zero.
+    auto target = signature.begin() + firstEntry;
+    for (auto it = target, ite = signature.end(); it != ite;) {
+        auto block = it->first;
+        ValueType probability = it->second;
+        for (++it; it != ite && it->first == block; ++it) {
+            probability += it->second;
+        }
+        if (!comparator.isZero(probability)) {
+            target->first = block;
+            target->second = std::move(probability);
+            ++target;
+        }
+    }
+    signature.erase(target, signature.end());
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -47,6 +47,10 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
     typedef typename ModelType::ValueType ValueType;
     typedef typename ModelType::RewardModelType RewardModelType;
 
+    // The signature of a state is a sequence of (block, value) pairs that characterizes the behaviour of the state
+    // wrt. the current partition.
+    typedef std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> Signature;
+
     // A class that offers the possibility to customize the bisimulation.
     struct Options {
         // Creates an object representing the default values for all options.
@@ -103,6 +107,14 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
             return this->keepRewards;
         }
 
+        /*!
+         * Sets whether the rewards of the (unique) reward model are to be respected, independently of the
+         * preserved formulas.
+         */
+        void setKeepRewards(bool newValue) {
+            keepRewards = newValue;
+        }
+
         bool isOptimizationDirectionSet() const {
             return static_cast<bool>(optimalityType);
         }
@@ -126,6 +138,10 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that governs whether all blocks are refined at once based on the signatures of the states (which
+        /// are computed in parallel) instead of refining the partition one splitter at a time.
+        bool signatureRefinement;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +224,44 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement based on signatures. In every round, the signatures of all states in blocks
+     * that possibly need refinement are computed and each of these blocks is split into the ranges of states with
+     * equal signatures. The signatures are computed and the blocks are sorted concurrently. The refinement stops
+     * once a round did not split any block.
+     */
+    void performSignatureRefinement();
+
+    /*!
+     * Retrieves whether the partition can be refined using signatures.
+     */
+    virtual bool supportsSignatureRefinement() const = 0;
+
+    /*!
+     * Computes the signature of the given state wrt. the current partition. Two states of a block stay in the
+     * same block iff their signatures are equal. This may be called concurrently for different states.
+     *
+     * @param state The state whose signature to compute.
+     * @param signature The vector into which to write the signature.
+     */
+    virtual void computeSignature(storm::storage::sparse::state_type state, Signature& signature) const = 0;
+
+    /*!
+     * A function that can update auxiliary data structures after the partition was refined using signatures.
+     */
+    virtual void postProcessSignatureRefinement();
+
+    /*!
+     * Retrieves whether the first signature is considered to be less than the second one.
+     */
+    bool signatureLess(Signature const& signature1, Signature const& signature2) const;
+
+    /*!
+     * Appends the (non-zero) probabilities of moving from the given row of the transition matrix to the blocks of
+     * the current partition to the given signature. The appended entries are ordered by the block.
+     */
+    void appendBlockProbabilitiesToSignature(uint_fast64_t row, Signature& signature) const;
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
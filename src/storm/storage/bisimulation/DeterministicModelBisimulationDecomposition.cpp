@@ -133,13 +133,11 @@ void DeterministicModelBisimulationDecomposition<ModelType>::postProcessInitialP
 
         // Here, we assume that the initial partition already respects state (and action) rewards. Therefore, it suffices to
         // check the first state of each block for a non-zero reward.
-        boost::optional<std::vector<ValueType>> const& optionalStateRewardVector = this->model.getUniqueRewardModel().getOptionalStateRewardVector();
-        boost::optional<std::vector<ValueType>> const& optionalStateActionRewardVector =
-            this->model.getUniqueRewardModel().getOptionalStateActionRewardVector();
+        auto const& rewardModel = this->model.getUniqueRewardModel();
         for (auto& block : this->partition.getBlocks()) {
             auto state = *this->partition.begin(*block);
-            block->data().setHasRewards((optionalStateRewardVector && !storm::utility::isZero(optionalStateRewardVector.get()[state])) ||
-                                        (optionalStateActionRewardVector && !storm::utility::isZero(optionalStateActionRewardVector.get()[state])));
+            block->data().setHasRewards((rewardModel.hasStateRewards() && !storm::utility::isZero(rewardModel.getStateReward(state))) ||
+                                        (rewardModel.hasStateActionRewards() && !storm::utility::isZero(rewardModel.getStateActionReward(state))));
         }
     }
 }
@@ -593,6 +591,19 @@ void DeterministicModelBisimulationDecomposition<ModelType>::refinePartitionBase
     }
 }
 
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+    return this->options.getType() == BisimulationType::Strong;
+}
+
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    // For strong bisimulation, the signature is given by the probabilities (or rates) of moving to the blocks.
+    signature.clear();
+    this->appendBlockProbabilitiesToSignature(state, signature);
+}
+
 template<typename ModelType>
 void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
     // In order to create the quotient model, we need to construct
@@ -39,6 +39,11 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+    virtual bool supportsSignatureRefinement() const override;
+
+    virtual void computeSignature(storm::storage::sparse::state_type state,
+                                  typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+
    private:
     // Post-processes the initial partition to properly initialize it.
     void postProcessInitialPartition();
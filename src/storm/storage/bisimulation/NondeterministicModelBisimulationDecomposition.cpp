@@ -1,5 +1,8 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -445,6 +448,46 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::refinePartitionB
     splitBlockAccordingToCurrentQuotientDistributions(splitter, splitterQueue);
 }
 
+template<typename ModelType>
+bool NondeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureRefinement() const {
+    return true;
+}
+
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignature(
+    storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+    typedef typename BisimulationDecomposition<ModelType, BlockDataType>::Signature Signature;
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    bool keepActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+
+    // The signature of each choice starts with a separating entry that holds the reward of the choice.
+    std::vector<Signature> choiceSignatures(nondeterministicChoiceIndices[state + 1] - nondeterministicChoiceIndices[state]);
+    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+        Signature& choiceSignature = choiceSignatures[choice - nondeterministicChoiceIndices[state]];
+        choiceSignature.emplace_back(std::numeric_limits<storm::storage::sparse::state_type>::max(),
+                                     keepActionRewards ? this->model.getUniqueRewardModel().getStateActionReward(choice) : storm::utility::zero<ValueType>());
+        this->appendBlockProbabilitiesToSignature(choice, choiceSignature);
+    }
+
+    // The signature of the state is the set of signatures of its choices.
+    auto less = [this](Signature const& signature1, Signature const& signature2) { return this->signatureLess(signature1, signature2); };
+    std::sort(choiceSignatures.begin(), choiceSignatures.end(), less);
+    auto choiceSignaturesEnd = std::unique(choiceSignatures.begin(), choiceSignatures.end(), [&less](Signature const& signature1, Signature const& signature2) {
+        return !less(signature1, signature2) && !less(signature2, signature1);
+    });
+    signature.clear();
+    for (auto it = choiceSignatures.begin(); it != choiceSignaturesEnd; ++it) {
+        signature.insert(signature.end(), it->begin(), it->end());
+    }
+}
+
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::postProcessSignatureRefinement() {
+    // The quotient distributions still refer to the blocks of the initial partition, so we compute them anew.
+    quotientDistributions = std::vector<storm::storage::DistributionWithReward<ValueType>>(this->model.getNumberOfChoices());
+    this->initializeQuotientDistributions();
+}
+
 template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
 
 #ifdef STORM_HAVE_CARL
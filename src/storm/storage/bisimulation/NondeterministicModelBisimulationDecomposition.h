@@ -40,6 +40,13 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual bool supportsSignatureRefinement() const override;
+
+    virtual void computeSignature(storm::storage::sparse::state_type state,
+                                  typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+
+    virtual void postProcessSignatureRefinement() override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -13,15 +13,29 @@
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/MemoryLimitExceededException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/memory.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 namespace storm {
 namespace dd {
+
+namespace {
+/*!
+ * Makes sure that an explicit matrix with the given number of entries fits into the memory limit before it is allocated.
+ */
+template<typename ValueType>
+void checkMatrixMemoryLimit(uint64_t numberOfEntries) {
+    uint64_t bytes = numberOfEntries * sizeof(storm::storage::MatrixEntry<uint_fast64_t, ValueType>);
+    STORM_LOG_THROW(storm::utility::memory::isWithinMemoryLimit(bytes), storm::exceptions::MemoryLimitExceededException,
+                    "Translating the decision diagram to an explicit matrix with " << numberOfEntries << " entries would exceed the memory limit.");
+}
+}  // namespace
 template<DdType LibraryType, typename ValueType>
 Add<LibraryType, ValueType>::Add(DdManager<LibraryType> const& ddManager, InternalAdd<LibraryType, ValueType> const& internalAdd,
                                  std::set<storm::expressions::Variable> const& containedMetaVariables)
@@ -686,8 +700,10 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
 
     // Prepare the vectors that represent the matrix.
+    uint_fast64_t numberOfEntries = this->getNonZeroCount();
+    checkMatrixMemoryLimit<ValueType>(numberOfEntries);
     std::vector<uint_fast64_t> rowIndications(rowOdd.getTotalOffset() + 1);
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(numberOfEntries);
 
     // Create a trivial row grouping.
     std::vector<uint_fast64_t> trivialRowGroupIndices(rowIndications.size());
@@ -839,7 +855,9 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
     }
 
     // Create the actual storage for the non-zero entries.
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
+    uint_fast64_t numberOfEntries = this->getNonZeroCount();
+    checkMatrixMemoryLimit<ValueType>(numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(numberOfEntries);
 
     // Now compute the indices at which the individual rows start.
     std::vector<uint_fast64_t> rowIndications(rowGroupIndices.back() + 1);
@@ -1071,7 +1089,9 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
     }
 
     // Create the actual storage for the non-zero entries.
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
+    uint_fast64_t numberOfEntries = this->getNonZeroCount();
+    checkMatrixMemoryLimit<ValueType>(numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(numberOfEntries);
 
     // Now compute the indices at which the individual rows start.
     std::vector<uint_fast64_t> rowIndications(rowGroupIndices.back() + 1);
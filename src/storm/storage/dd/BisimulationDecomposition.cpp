@@ -1,5 +1,6 @@
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
+#include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/bisimulation/NondeterministicModelPartitionRefiner.h"
 #include "storm/storage/dd/bisimulation/PartialQuotientExtractor.h"
 #include "storm/storage/dd/bisimulation/Partition.h"
@@ -117,6 +118,7 @@ void BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(bisi
                    << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms (" << iterations
                    << " iterations, signature: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalSignatureTime()).count()
                    << "ms, refinement: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalRefinementTime()).count() << "ms).");
+    model.getManager().recordStatistics("bisimulation");
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -144,6 +146,7 @@ bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(uint
         }
     }
 
+    model.getManager().recordStatistics("bisimulation");
     return !refined;
 }
 
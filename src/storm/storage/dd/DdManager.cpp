@@ -1,5 +1,7 @@
 #include "storm/storage/dd/DdManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/IOSettings.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -12,13 +14,19 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 namespace storm {
 namespace dd {
 template<DdType LibraryType>
-DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()) {
+DdManager<LibraryType>::DdManager()
+    : internalDdManager(),
+      metaVariableMap(),
+      manager(new storm::expressions::ExpressionManager()),
+      recordStatisticsEnabled(storm::settings::getModule<storm::settings::modules::IOSettings>().isExportDdStatisticsSet()),
+      peakNodeCount(0) {
     // Intentionally left empty.
 }
 
@@ -514,6 +522,57 @@ void DdManager<LibraryType>::debugCheck() const {
     internalDdManager.debugCheck();
 }
 
+template<DdType LibraryType>
+void DdManager<LibraryType>::executeTasks(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+    internalDdManager.executeTasks(numberOfTasks, task);
+}
+
+template<DdType LibraryType>
+DdStatistics DdManager<LibraryType>::getStatistics() const {
+    DdStatistics result = internalDdManager.getStatistics();
+    peakNodeCount = std::max({peakNodeCount, result.peakNodeCount, result.nodeCount});
+    result.peakNodeCount = peakNodeCount;
+    return result;
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::setRecordStatistics(bool value) {
+    recordStatisticsEnabled = value;
+}
+
+template<DdType LibraryType>
+bool DdManager<LibraryType>::isRecordStatisticsSet() const {
+    return recordStatisticsEnabled;
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::recordStatistics(std::string const& phase) const {
+    if (recordStatisticsEnabled) {
+        recordedStatistics.emplace_back(phase, getStatistics());
+        STORM_LOG_DEBUG("DD statistics after " << phase << ": " << recordedStatistics.back().second << ".");
+    }
+}
+
+template<DdType LibraryType>
+std::vector<std::pair<std::string, DdStatistics>> const& DdManager<LibraryType>::getRecordedStatistics() const {
+    return recordedStatistics;
+}
+
+template<DdType LibraryType>
+void DdManager<LibraryType>::exportStatisticsAsJson(std::ostream& out) const {
+    storm::json<double> result;
+    result["library"] = LibraryType == DdType::CUDD ? "cudd" : "sylvan";
+    storm::json<double> phases = storm::json<double>::array();
+    for (auto const& phaseStatistics : recordedStatistics) {
+        storm::json<double> entry = phaseStatistics.second.toJson();
+        entry["phase"] = phaseStatistics.first;
+        phases.push_back(std::move(entry));
+    }
+    result["phases"] = std::move(phases);
+    result["final"] = getStatistics().toJson();
+    out << result.dump(4) << '\n';
+}
+
 template class DdManager<DdType::CUDD>;
 
 template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
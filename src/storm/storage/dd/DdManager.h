@@ -2,13 +2,18 @@
 #define STORM_STORAGE_DD_DDMANAGER_H_
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <ostream>
 #include <set>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/AddIterator.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/DdStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
 
@@ -333,6 +338,53 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
      */
     void debugCheck() const;
 
+    /*!
+     * Executes the given number of independent tasks, i.e. calls task(index) for every index. Depending on the
+     * library (and its settings), the tasks are executed concurrently, in which case the tasks must not modify
+     * any shared data (including this manager, e.g. by adding meta variables). Exceptions thrown by a task are
+     * rethrown once all tasks have finished.
+     *
+     * @param numberOfTasks The number of tasks.
+     * @param task The function that is called as task(index) for every task.
+     */
+    void executeTasks(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const;
+
+    /*!
+     * Retrieves the current statistics of the DD library. The peak node count also accounts for all statistics retrieved before.
+     *
+     * @return The statistics.
+     */
+    DdStatistics getStatistics() const;
+
+    /*!
+     * Sets whether statistics are recorded by recordStatistics. Initially, this is the case iff the DD statistics are to be exported.
+     */
+    void setRecordStatistics(bool value);
+
+    /*!
+     * Retrieves whether statistics are recorded by recordStatistics.
+     */
+    bool isRecordStatisticsSet() const;
+
+    /*!
+     * Records the current statistics at the end of the given phase (e.g. building, bisimulation or solving), if recording is enabled.
+     *
+     * @param phase The name of the phase.
+     */
+    void recordStatistics(std::string const& phase) const;
+
+    /*!
+     * Retrieves the statistics recorded so far together with the names of their phases (in the order of recording).
+     */
+    std::vector<std::pair<std::string, DdStatistics>> const& getRecordedStatistics() const;
+
+    /*!
+     * Writes the recorded statistics and the current statistics in the json format.
+     *
+     * @param out The stream to write to.
+     */
+    void exportStatisticsAsJson(std::ostream& out) const;
+
    private:
     /*!
      * Creates a meta variable with the given number of DD variables and layers.
@@ -399,6 +451,13 @@ class DdManager : public std::enable_shared_from_this<DdManager<LibraryType>> {
 
     // The manager responsible for the variables.
     std::shared_ptr<storm::expressions::ExpressionManager> manager;
+
+    // Whether statistics are recorded and the statistics recorded so far.
+    bool recordStatisticsEnabled;
+    mutable std::vector<std::pair<std::string, DdStatistics>> recordedStatistics;
+
+    // The maximal number of nodes observed so far (Sylvan does not track this itself).
+    mutable uint64_t peakNodeCount;
 };
 }  // namespace dd
 }  // namespace storm
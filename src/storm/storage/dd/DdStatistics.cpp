@@ -0,0 +1,46 @@
+#include "storm/storage/dd/DdStatistics.h"
+
+namespace storm {
+namespace dd {
+
+double DdStatistics::getCacheHitRate() const {
+    return cacheLookups == 0 ? 0.0 : static_cast<double>(cacheHits) / static_cast<double>(cacheLookups);
+}
+
+storm::json<double> DdStatistics::toJson() const {
+    storm::json<double> result;
+    result["nodes"] = nodeCount;
+    result["peak-nodes"] = peakNodeCount;
+    result["unique-table-slots"] = uniqueTableSlots;
+    result["cache-slots"] = cacheSlots;
+    if (hasCacheStatistics) {
+        result["cache-lookups"] = cacheLookups;
+        result["cache-hits"] = cacheHits;
+        result["cache-hit-rate"] = getCacheHitRate();
+    } else {
+        result["cache-lookups"] = nullptr;
+        result["cache-hits"] = nullptr;
+        result["cache-hit-rate"] = nullptr;
+    }
+    result["gc-count"] = garbageCollections;
+    result["gc-ms"] = garbageCollectionMilliseconds;
+    result["reorderings"] = reorderings;
+    result["reordering-ms"] = reorderingMilliseconds;
+    result["memory-bytes"] = memoryInBytes;
+    return result;
+}
+
+std::ostream& operator<<(std::ostream& out, DdStatistics const& statistics) {
+    out << "Nodes: " << statistics.nodeCount << " (peak " << statistics.peakNodeCount << "), unique table slots: " << statistics.uniqueTableSlots
+        << ", cache slots: " << statistics.cacheSlots;
+    if (statistics.hasCacheStatistics) {
+        out << ", cache hit rate: " << statistics.getCacheHitRate() << " (" << statistics.cacheHits << "/" << statistics.cacheLookups << ")";
+    }
+    out << ", garbage collections: " << statistics.garbageCollections << " (" << statistics.garbageCollectionMilliseconds
+        << "ms), reorderings: " << statistics.reorderings << " (" << statistics.reorderingMilliseconds << "ms), memory: " << statistics.memoryInBytes
+        << " bytes";
+    return out;
+}
+
+}  // namespace dd
+}  // namespace storm
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace dd {
+
+/*!
+ * A snapshot of the statistics of a DD library. Which of the values are available depends on the library (and how it was compiled).
+ */
+struct DdStatistics {
+    // The number of live nodes and the maximal number of nodes observed so far.
+    uint64_t nodeCount = 0;
+    uint64_t peakNodeCount = 0;
+
+    // The number of slots of the unique table(s) and of the operation cache.
+    uint64_t uniqueTableSlots = 0;
+    uint64_t cacheSlots = 0;
+
+    // The number of lookups in and hits of the operation cache. Sylvan only counts them if compiled with SYLVAN_STATS.
+    bool hasCacheStatistics = false;
+    uint64_t cacheLookups = 0;
+    uint64_t cacheHits = 0;
+
+    // The number of garbage collections and the time spent in them.
+    uint64_t garbageCollections = 0;
+    uint64_t garbageCollectionMilliseconds = 0;
+
+    // The number of variable reorderings and the time spent in them (only supported by CUDD).
+    uint64_t reorderings = 0;
+    uint64_t reorderingMilliseconds = 0;
+
+    // The memory used by the library in bytes (for Sylvan, this is estimated from the table and cache sizes).
+    uint64_t memoryInBytes = 0;
+
+    /*!
+     * Retrieves the fraction of cache lookups that were hits (or zero if no lookups were counted).
+     */
+    double getCacheHitRate() const;
+
+    storm::json<double> toJson() const;
+};
+
+std::ostream& operator<<(std::ostream& out, DdStatistics const& statistics);
+
+}  // namespace dd
+}  // namespace storm
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string/join.hpp>
 #include <fstream>
 #include <set>
+#include <unordered_map>
 
 #include "storm/storage/BitVector.h"
 
@@ -34,6 +35,7 @@ uint_fast64_t Odd::getElseOffset() const {
 
 void Odd::setElseOffset(uint_fast64_t newOffset) {
     this->elseOffset = newOffset;
+    this->flatOdd.reset();
 }
 
 uint_fast64_t Odd::getThenOffset() const {
@@ -42,6 +44,7 @@ uint_fast64_t Odd::getThenOffset() const {
 
 void Odd::setThenOffset(uint_fast64_t newOffset) {
     this->thenOffset = newOffset;
+    this->flatOdd.reset();
 }
 
 uint_fast64_t Odd::getTotalOffset() const {
@@ -203,6 +206,52 @@ void Odd::addToLevelToOddNodesMap(std::map<uint_fast64_t, std::unordered_set<sto
     }
 }
 
+FlatOdd const& Odd::getFlatOdd() const {
+    // Concurrent requests may both flatten the ODD, but only the first result is stored (and returned to all of them).
+    std::shared_ptr<FlatOdd const> result = std::atomic_load(&this->flatOdd);
+    if (!result) {
+        std::shared_ptr<FlatOdd const> newResult = std::make_shared<FlatOdd const>(*this);
+        if (std::atomic_compare_exchange_strong(&this->flatOdd, &result, newResult)) {
+            result = newResult;
+        }
+    }
+    return *result;
+}
+
+FlatOdd::FlatOdd(Odd const& odd) {
+    // Number the nodes level by level such that the nodes of the upper levels (which are visited most often) are close to each other.
+    std::unordered_map<Odd const*, uint64_t> nodeToIndexMap;
+    std::vector<Odd const*> currentLevel = {&odd};
+    nodeToIndexMap[&odd] = 0;
+    std::vector<Odd const*> oddNodes = {&odd};
+    while (!currentLevel.empty()) {
+        std::vector<Odd const*> nextLevel;
+        for (auto const* node : currentLevel) {
+            if (node->isTerminalNode()) {
+                continue;
+            }
+            for (auto const* successor : {&node->getElseSuccessor(), &node->getThenSuccessor()}) {
+                if (nodeToIndexMap.emplace(successor, oddNodes.size()).second) {
+                    oddNodes.push_back(successor);
+                    nextLevel.push_back(successor);
+                }
+            }
+        }
+        currentLevel = std::move(nextLevel);
+    }
+
+    nodes.reserve(oddNodes.size());
+    for (uint64_t index = 0; index < oddNodes.size(); ++index) {
+        Odd const& node = *oddNodes[index];
+        if (node.isTerminalNode()) {
+            nodes.push_back({node.getElseOffset(), node.getThenOffset(), index, index});
+        } else {
+            nodes.push_back({node.getElseOffset(), node.getThenOffset(), nodeToIndexMap.at(&node.getElseSuccessor()),
+                             nodeToIndexMap.at(&node.getThenSuccessor())});
+        }
+    }
+}
+
 template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<double> const& oldValues, std::vector<double>& newValues) const;
 template void Odd::expandExplicitVector(storm::dd::Odd const& newOdd, std::vector<storm::RationalNumber> const& oldValues,
                                         std::vector<storm::RationalNumber>& newValues) const;
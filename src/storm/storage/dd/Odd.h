@@ -13,6 +13,8 @@ class BitVector;
 }
 
 namespace dd {
+class FlatOdd;
+
 class Odd {
    public:
     /*!
@@ -150,6 +152,12 @@ class Odd {
      */
     storm::storage::BitVector getEncoding(uint64_t offset, uint64_t variableCount = 0) const;
 
+    /*!
+     * Retrieves the flattened representation of this ODD, which is used to translate between DDs and explicit representations.
+     * It is computed upon the first request and shared among all copies of this ODD.
+     */
+    FlatOdd const& getFlatOdd() const;
+
    private:
     /*!
      * Adds all nodes below the current one to the given mapping.
@@ -184,6 +192,66 @@ class Odd {
     // The offsets that need to be added if the then- or else-successor is taken, respectively.
     uint_fast64_t elseOffset;
     uint_fast64_t thenOffset;
+
+    // The flattened representation of this ODD (if it was already requested).
+    mutable std::shared_ptr<FlatOdd const> flatOdd;
+};
+
+/*!
+ * A flattened representation of an ODD: the nodes are stored contiguously (level by level, starting with the root) and refer to their
+ * successors by their index. Traversing a flat ODD thus avoids the pointer chasing of the (shared) ODD nodes.
+ */
+class FlatOdd {
+   public:
+    /*!
+     * Flattens the given ODD.
+     */
+    explicit FlatOdd(Odd const& odd);
+
+    /*!
+     * Retrieves the index of the root node.
+     */
+    uint64_t getRoot() const {
+        return 0;
+    }
+
+    uint64_t getElseSuccessor(uint64_t node) const {
+        return nodes[node].elseSuccessor;
+    }
+
+    uint64_t getThenSuccessor(uint64_t node) const {
+        return nodes[node].thenSuccessor;
+    }
+
+    uint64_t getElseOffset(uint64_t node) const {
+        return nodes[node].elseOffset;
+    }
+
+    uint64_t getThenOffset(uint64_t node) const {
+        return nodes[node].thenOffset;
+    }
+
+    uint64_t getTotalOffset(uint64_t node) const {
+        return nodes[node].elseOffset + nodes[node].thenOffset;
+    }
+
+    /*!
+     * Retrieves the number of (distinct) nodes.
+     */
+    uint64_t getNodeCount() const {
+        return nodes.size();
+    }
+
+   private:
+    struct Node {
+        uint64_t elseOffset;
+        uint64_t thenOffset;
+        // The successors of terminal nodes refer to the node itself.
+        uint64_t elseSuccessor;
+        uint64_t thenSuccessor;
+    };
+
+    std::vector<Node> nodes;
 };
 }  // namespace dd
 }  // namespace storm
@@ -1,5 +1,6 @@
 #include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "storm/storage/dd/DdManager.h"
@@ -25,6 +26,7 @@
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -688,13 +690,72 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
     }
 
    private:
+    // The arguments of a call to extractTransitionMatrixRec.
+    struct MatrixExtractionTask {
+        MTBDD transitionMatrixNode;
+        storm::dd::Odd const* sourceOdd;
+        uint64_t sourceOffset;
+        BDD targetPartitionNode;
+        BDD representativesNode;
+        BDD variables;
+        BDD nondeterminismVariables;
+        storm::dd::Odd const* stateOdd;
+        uint64_t stateOffset;
+    };
+
+    // The minimal number of rows for which the quotient matrix is extracted concurrently.
+    static const uint64_t parallelExtractionThreshold = 4096;
+
     virtual storm::storage::SparseMatrix<ExportValueType> extractMatrixInternal(storm::dd::Add<storm::dd::DdType::Sylvan, ValueType> const& matrix) override {
         this->createMatrixEntryStorage();
-        extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), this->isNondeterministic ? this->nondeterminismOdd : this->odd, 0,
+        storm::dd::Odd const& sourceOdd = this->isNondeterministic ? this->nondeterminismOdd : this->odd;
+        BDD variables = this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD();
+
+        // Rational functions are not converted concurrently as their (carl) caches are not thread-safe.
+        uint64_t numberOfThreads =
+            std::is_same<ValueType, storm::RationalFunction>::value ? 1 : storm::utility::parallel::getDefaultNumberOfThreads();
+        if (numberOfThreads <= 1 || sourceOdd.getTotalOffset() < parallelExtractionThreshold) {
+            extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), sourceOdd, 0,
+                                       this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(),
+                                       this->representatives.getInternalBdd().getSylvanBdd().GetBDD(), variables,
+                                       this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
+                                       this->isNondeterministic ? &this->odd : nullptr, 0);
+            return this->createMatrixFromEntries();
+        }
+
+        // Collect the calls at a depth that provides enough tasks for the threads.
+        uint64_t numberOfSourceVariables = 0;
+        for (BDD variable = variables; !sylvan_isconst(variable); variable = sylvan_high(variable)) {
+            ++numberOfSourceVariables;
+        }
+        uint64_t splitDepth = 0;
+        while (splitDepth < numberOfSourceVariables && (1ull << splitDepth) < numberOfThreads * 16) {
+            ++splitDepth;
+        }
+        std::vector<MatrixExtractionTask> tasks;
+        extractTransitionMatrixRec(matrix.getInternalAdd().getSylvanMtbdd().GetMTBDD(), sourceOdd, 0,
                                    this->partitionBdd.getInternalBdd().getSylvanBdd().GetBDD(), this->representatives.getInternalBdd().getSylvanBdd().GetBDD(),
-                                   this->allSourceVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
-                                   this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(), this->isNondeterministic ? &this->odd : nullptr,
-                                   0);
+                                   variables, this->nondeterminismVariablesCube.getInternalBdd().getSylvanBdd().GetBDD(),
+                                   this->isNondeterministic ? &this->odd : nullptr, 0, &tasks, splitDepth);
+
+        // All tasks are at the same level of the source variables, so tasks with different source offsets write to disjoint rows. The tasks with
+        // the same source offset are processed by the same thread. Reading the nodes of the MTBDDs does not require a Lace worker.
+        std::stable_sort(tasks.begin(), tasks.end(),
+                         [](MatrixExtractionTask const& first, MatrixExtractionTask const& second) { return first.sourceOffset < second.sourceOffset; });
+        std::vector<uint64_t> taskGroupStarts;
+        for (uint64_t task = 0; task < tasks.size(); ++task) {
+            if (task == 0 || tasks[task].sourceOffset != tasks[task - 1].sourceOffset) {
+                taskGroupStarts.push_back(task);
+            }
+        }
+        taskGroupStarts.push_back(tasks.size());
+        storm::utility::parallel::forEachChunk(0, taskGroupStarts.size() - 1, 1, numberOfThreads, [&](uint64_t, uint64_t firstGroup, uint64_t lastGroup) {
+            for (uint64_t task = taskGroupStarts[firstGroup]; task < taskGroupStarts[lastGroup]; ++task) {
+                MatrixExtractionTask const& t = tasks[task];
+                extractTransitionMatrixRec(t.transitionMatrixNode, *t.sourceOdd, t.sourceOffset, t.targetPartitionNode, t.representativesNode, t.variables,
+                                           t.nondeterminismVariables, t.stateOdd, t.stateOffset);
+            }
+        });
         return this->createMatrixFromEntries();
     }
 
@@ -782,14 +843,25 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
         }
     }
 
+    /*!
+     * Adds the entries of the given part of the matrix. If tasks are given, the recursion stops after the given number of (source) variables and
+     * the calls that would have been made at this depth are appended to the tasks instead.
+     */
     void extractTransitionMatrixRec(MTBDD transitionMatrixNode, storm::dd::Odd const& sourceOdd, uint64_t sourceOffset, BDD targetPartitionNode,
-                                    BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset) {
+                                    BDD representativesNode, BDD variables, BDD nondeterminismVariables, storm::dd::Odd const* stateOdd, uint64_t stateOffset,
+                                    std::vector<MatrixExtractionTask>* tasks = nullptr, uint64_t remainingDepth = 0) {
         // For the empty DD, we do not need to add any entries. Note that the partition nodes cannot be zero
         // as all states of the model have to be contained.
         if (mtbdd_iszero(transitionMatrixNode) || representativesNode == sylvan_false) {
             return;
         }
 
+        if (tasks != nullptr && remainingDepth == 0) {
+            tasks->push_back({transitionMatrixNode, &sourceOdd, sourceOffset, targetPartitionNode, representativesNode, variables, nondeterminismVariables,
+                              stateOdd, stateOffset});
+            return;
+        }
+
         // If we have moved through all source variables, we must have arrived at a target block encoding.
         if (sylvan_isconst(variables)) {
             STORM_LOG_ASSERT(mtbdd_isleaf(transitionMatrixNode), "Expected constant node.");
@@ -818,9 +890,9 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
 
                 STORM_LOG_ASSERT(stateOdd, "Expected separate state ODD.");
                 extractTransitionMatrixRec(e, sourceOdd.getElseSuccessor(), sourceOffset, targetPartitionNode, representativesNode, sylvan_high(variables),
-                                           sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
+                                           sylvan_high(nondeterminismVariables), stateOdd, stateOffset, tasks, remainingDepth - 1);
                 extractTransitionMatrixRec(t, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetPartitionNode, representativesNode,
-                                           sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset);
+                                           sylvan_high(variables), sylvan_high(nondeterminismVariables), stateOdd, stateOffset, tasks, remainingDepth - 1);
             } else {
                 MTBDD t;
                 MTBDD tt;
@@ -881,15 +953,17 @@ class InternalSparseQuotientExtractor<storm::dd::DdType::Sylvan, ValueType, Expo
                 }
 
                 extractTransitionMatrixRec(ee, sourceOdd.getElseSuccessor(), sourceOffset, targetE, representativesE, sylvan_high(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, tasks,
+                                           remainingDepth - 1);
                 extractTransitionMatrixRec(et, sourceOdd.getElseSuccessor(), sourceOffset, targetT, representativesE, sylvan_high(variables),
-                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset);
+                                           nondeterminismVariables, stateOdd ? &stateOdd->getElseSuccessor() : stateOdd, stateOffset, tasks,
+                                           remainingDepth - 1);
                 extractTransitionMatrixRec(te, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetE, representativesT,
                                            sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), tasks, remainingDepth - 1);
                 extractTransitionMatrixRec(tt, sourceOdd.getThenSuccessor(), sourceOffset + sourceOdd.getElseOffset(), targetT, representativesT,
                                            sylvan_high(variables), nondeterminismVariables, stateOdd ? &stateOdd->getThenSuccessor() : stateOdd,
-                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0));
+                                           stateOffset + (stateOdd ? stateOdd->getElseOffset() : 0), tasks, remainingDepth - 1);
             }
         }
     }
@@ -1,5 +1,8 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
@@ -12,9 +15,13 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace dd {
+// The minimal number of rows for which the entries of a matrix are extracted concurrently.
+static const uint64_t parallelMatrixExtractionThreshold = 4096;
+
 template<typename ValueType>
 InternalAdd<DdType::CUDD, ValueType>::InternalAdd(InternalDdManager<DdType::CUDD> const* ddManager, cudd::ADD cuddAdd)
     : ddManager(ddManager), cuddAdd(cuddAdd) {
@@ -520,21 +527,24 @@ template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                      std::vector<ValueType>& targetVector,
                                                                      std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices,
                [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::forEach(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                    std::function<void(uint64_t const&, ValueType const&)> const& function) const {
-    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices, function);
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                      std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector,
                                                                      std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getCuddDdNode(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices,
                [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
                    ValueType& targetValue = targetVector[offsets[offset]];
                    targetValue = function(targetValue, value);
@@ -542,9 +552,10 @@ void InternalAdd<DdType::CUDD, ValueType>::composeWithExplicitVector(storm::dd::
 }
 
 template<typename ValueType>
+template<typename Function>
 void InternalAdd<DdType::CUDD, ValueType>::forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset,
-                                                      Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                      std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+                                                      FlatOdd const& odd, uint64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                      Function const& function) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
@@ -556,12 +567,14 @@ void InternalAdd<DdType::CUDD, ValueType>::forEachRec(DdNode const* dd, uint_fas
     } else if (ddVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
         // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
         // and for the one in which it is not set.
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd, odd.getElseSuccessor(oddNode), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(oddNode), odd, odd.getThenSuccessor(oddNode), ddVariableIndices,
+                   function);
     } else {
         // Otherwise, we simply recursively call the function for both (different) cases.
-        forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(Cudd_E_const(dd), currentLevel + 1, maxLevel, currentOffset, odd, odd.getElseSuccessor(oddNode), ddVariableIndices, function);
+        forEachRec(Cudd_T_const(dd), currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(oddNode), odd, odd.getThenSuccessor(oddNode),
+                   ddVariableIndices, function);
     }
 }
 
@@ -729,24 +742,69 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_f
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                               Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+    FlatOdd const& flatRowOdd = rowOdd.getFlatOdd();
+    FlatOdd const& flatColumnOdd = columnOdd.getFlatOdd();
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+    // Rational functions are not converted concurrently as their (carl) caches are not thread-safe.
+    uint64_t numberOfThreads =
+        std::is_same<ValueType, storm::RationalFunction>::value ? 1 : storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads <= 1 || rowOdd.getTotalOffset() < parallelMatrixExtractionThreshold) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatRowOdd.getRoot(), flatColumnOdd,
+                              flatColumnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Collect the nodes at a level that provides enough tasks for the threads.
+    uint_fast64_t splitLevel = 0;
+    while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < numberOfThreads * 16) {
+        ++splitLevel;
+    }
+    std::vector<MatrixExtractionTask> tasks;
+    toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatRowOdd.getRoot(), flatColumnOdd,
+                          flatColumnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, &tasks, splitLevel);
+
+    // Tasks for different rows write to disjoint parts of the matrix. The tasks for the same rows are processed in their original order, which
+    // keeps the entries of each row sorted by column.
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [](MatrixExtractionTask const& first, MatrixExtractionTask const& second) { return first.rowOffset < second.rowOffset; });
+    std::vector<uint64_t> taskGroupStarts;
+    for (uint64_t task = 0; task < tasks.size(); ++task) {
+        if (task == 0 || tasks[task].rowOffset != tasks[task - 1].rowOffset) {
+            taskGroupStarts.push_back(task);
+        }
+    }
+    taskGroupStarts.push_back(tasks.size());
+    storm::utility::parallel::forEachChunk(0, taskGroupStarts.size() - 1, 1, numberOfThreads, [&](uint64_t, uint64_t firstGroup, uint64_t lastGroup) {
+        for (uint64_t task = taskGroupStarts[firstGroup]; task < taskGroupStarts[lastGroup]; ++task) {
+            MatrixExtractionTask const& currentTask = tasks[task];
+            toMatrixComponentsRec(currentTask.dd, rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, currentTask.rowOddNode, flatColumnOdd,
+                                  currentTask.columnOddNode, splitLevel, splitLevel, maxLevel, currentTask.rowOffset, currentTask.columnOffset,
+                                  ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+    });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets,
                                                                  std::vector<uint_fast64_t>& rowIndications,
                                                                  std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
-                                                                 Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
-                                                                 uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
-                                                                 uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                 FlatOdd const& rowOdd, uint64_t rowOddNode, FlatOdd const& columnOdd,
+                                                                 uint64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel,
+                                                                 uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                 std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                 std::vector<MatrixExtractionTask>* tasks, uint_fast64_t splitLevel) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    if (tasks != nullptr && currentRowLevel == splitLevel) {
+        tasks->push_back({dd, rowOddNode, columnOddNode, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -784,21 +842,24 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
         }
 
         // Visit else-else.
-        toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowOdd.getElseSuccessor(rowOddNode), columnOdd,
+                              columnOdd.getElseSuccessor(columnOddNode), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
+                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, tasks, splitLevel);
         // Visit else-then.
-        toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowOdd.getElseSuccessor(rowOddNode), columnOdd,
+                              columnOdd.getThenSuccessor(columnOddNode), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
+                              currentColumnOffset + columnOdd.getElseOffset(columnOddNode), ddRowVariableIndices, ddColumnVariableIndices, generateValues,
+                              tasks, splitLevel);
         // Visit then-else.
-        toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowOdd.getThenSuccessor(rowOddNode), columnOdd,
+                              columnOdd.getElseSuccessor(columnOddNode), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                              currentRowOffset + rowOdd.getElseOffset(rowOddNode), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                              generateValues, tasks, splitLevel);
         // Visit then-then.
-        toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(),
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowOdd.getThenSuccessor(rowOddNode), columnOdd,
+                              columnOdd.getThenSuccessor(columnOddNode), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                              currentRowOffset + rowOdd.getElseOffset(rowOddNode), currentColumnOffset + columnOdd.getElseOffset(columnOddNode),
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, tasks, splitLevel);
     }
 }
 
@@ -807,34 +868,36 @@ InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromV
                                                                                       std::vector<ValueType> const& values, storm::dd::Odd const& odd,
                                                                                       std::vector<uint_fast64_t> const& ddVariableIndices) {
     uint_fast64_t offset = 0;
-    return InternalAdd<DdType::CUDD, ValueType>(
-        ddManager, cudd::ADD(ddManager->getCuddManager(),
-                             fromVectorRec(ddManager->getCuddManager().getManager(), offset, 0, ddVariableIndices.size(), values, odd, ddVariableIndices)));
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    DdNode* result =
+        fromVectorRec(ddManager->getCuddManager().getManager(), offset, 0, ddVariableIndices.size(), values, flatOdd, flatOdd.getRoot(), ddVariableIndices);
+    return InternalAdd<DdType::CUDD, ValueType>(ddManager, cudd::ADD(ddManager->getCuddManager(), result));
 }
 
 template<typename ValueType>
 DdNode* InternalAdd<DdType::CUDD, ValueType>::fromVectorRec(::DdManager* manager, uint_fast64_t& currentOffset, uint_fast64_t currentLevel,
-                                                            uint_fast64_t maxLevel, std::vector<ValueType> const& values, Odd const& odd,
-                                                            std::vector<uint_fast64_t> const& ddVariableIndices) {
+                                                            uint_fast64_t maxLevel, std::vector<ValueType> const& values, FlatOdd const& odd,
+                                                            uint64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices) {
     if (currentLevel == maxLevel) {
         // If we are in a terminal node of the ODD, we need to check whether the then-offset of the ODD is one
         // (meaning the encoding is a valid one) or zero (meaning the encoding is not valid). Consequently, we
         // need to copy the next value of the vector iff the then-offset is greater than zero.
-        if (odd.getThenOffset() > 0) {
+        if (odd.getThenOffset(oddNode) > 0) {
             return Cudd_addConst(manager, values[currentOffset++]);
         } else {
             return Cudd_ReadZero(manager);
         }
     } else {
         // If the total offset is zero, we can just return the constant zero DD.
-        if (odd.getThenOffset() + odd.getElseOffset() == 0) {
+        if (odd.getThenOffset(oddNode) + odd.getElseOffset(oddNode) == 0) {
             return Cudd_ReadZero(manager);
         }
 
         // Determine the new else-successor.
         DdNode* elseSuccessor = nullptr;
-        if (odd.getElseOffset() > 0) {
-            elseSuccessor = fromVectorRec(manager, currentOffset, currentLevel + 1, maxLevel, values, odd.getElseSuccessor(), ddVariableIndices);
+        if (odd.getElseOffset(oddNode) > 0) {
+            elseSuccessor =
+                fromVectorRec(manager, currentOffset, currentLevel + 1, maxLevel, values, odd, odd.getElseSuccessor(oddNode), ddVariableIndices);
         } else {
             elseSuccessor = Cudd_ReadZero(manager);
         }
@@ -842,8 +905,9 @@ DdNode* InternalAdd<DdType::CUDD, ValueType>::fromVectorRec(::DdManager* manager
 
         // Determine the new then-successor.
         DdNode* thenSuccessor = nullptr;
-        if (odd.getThenOffset() > 0) {
-            thenSuccessor = fromVectorRec(manager, currentOffset, currentLevel + 1, maxLevel, values, odd.getThenSuccessor(), ddVariableIndices);
+        if (odd.getThenOffset(oddNode) > 0) {
+            thenSuccessor =
+                fromVectorRec(manager, currentOffset, currentLevel + 1, maxLevel, values, odd, odd.getThenSuccessor(oddNode), ddVariableIndices);
         } else {
             thenSuccessor = Cudd_ReadZero(manager);
         }
@@ -870,7 +934,8 @@ DdNode* InternalAdd<DdType::CUDD, ValueType>::fromVectorRec(::DdManager* manager
 template<>
 DdNode* InternalAdd<DdType::CUDD, storm::RationalNumber>::fromVectorRec(::DdManager* manager, uint_fast64_t& currentOffset, uint_fast64_t currentLevel,
                                                                         uint_fast64_t maxLevel, std::vector<storm::RationalNumber> const& values,
-                                                                        Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
+                                                                        FlatOdd const& odd, uint64_t oddNode,
+                                                                        std::vector<uint_fast64_t> const& ddVariableIndices) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation not supported");
 }
 
@@ -201,6 +201,30 @@ void InternalDdManager<DdType::CUDD>::debugCheck() const {
     this->getCuddManager().DebugCheck();
 }
 
+void InternalDdManager<DdType::CUDD>::executeTasks(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+    for (uint64_t index = 0; index < numberOfTasks; ++index) {
+        task(index);
+    }
+}
+
+DdStatistics InternalDdManager<DdType::CUDD>::getStatistics() const {
+    cudd::Cudd const& manager = this->getCuddManager();
+    DdStatistics result;
+    result.nodeCount = manager.ReadNodeCount();
+    result.peakNodeCount = manager.ReadPeakNodeCount();
+    result.uniqueTableSlots = manager.ReadSlots();
+    result.cacheSlots = manager.ReadCacheSlots();
+    result.hasCacheStatistics = true;
+    result.cacheLookups = static_cast<uint64_t>(manager.ReadCacheLookUps());
+    result.cacheHits = static_cast<uint64_t>(manager.ReadCacheHits());
+    result.garbageCollections = manager.ReadGarbageCollections();
+    result.garbageCollectionMilliseconds = manager.ReadGarbageCollectionTime();
+    result.reorderings = manager.ReadReorderings();
+    result.reorderingMilliseconds = manager.ReadReorderingTime();
+    result.memoryInBytes = manager.ReadMemoryInUse();
+    return result;
+}
+
 cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
     return cuddManager;
 }
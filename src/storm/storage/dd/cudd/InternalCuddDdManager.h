@@ -2,7 +2,9 @@
 #define STORM_STORAGE_DD_INTERNALCUDDDDMANAGER_H_
 
 #include <boost/optional.hpp>
+#include <functional>
 
+#include "storm/storage/dd/DdStatistics.h"
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
 
@@ -131,6 +133,15 @@ class InternalDdManager<DdType::CUDD> {
      */
     void debugCheck() const;
 
+    /*!
+     * Executes the given number of independent tasks. As CUDD is not thread-safe, the tasks are executed
+     * sequentially.
+     *
+     * @param numberOfTasks The number of tasks.
+     * @param task The function that is called as task(index) for every task.
+     */
+    void executeTasks(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const;
+
     /*!
      * Retrieves the number of DD variables managed by this manager.
      *
@@ -138,6 +149,13 @@ class InternalDdManager<DdType::CUDD> {
      */
     uint_fast64_t getNumberOfDdVariables() const;
 
+    /*!
+     * Retrieves the current statistics of the library.
+     *
+     * @return The statistics.
+     */
+    DdStatistics getStatistics() const;
+
     /*!
      * Retrieves the underlying CUDD manager.
      *
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
@@ -12,11 +14,15 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm-config.h"
 
 namespace storm {
 namespace dd {
+// The minimal number of rows for which the entries of a matrix are extracted concurrently.
+static const uint64_t parallelMatrixExtractionThreshold = 4096;
+
 template<typename ValueType>
 InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
     // Intentionally left empty.
@@ -966,7 +972,8 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices,
                [&function, &targetVector](uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
 }
 
@@ -974,7 +981,8 @@ template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                                        std::vector<uint_fast64_t> const& offsets, std::vector<ValueType>& targetVector,
                                                                        std::function<ValueType(ValueType const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices,
                [&function, &targetVector, &offsets](uint64_t const& offset, ValueType const& value) {
                    ValueType& targetValue = targetVector[offsets[offset]];
                    targetValue = function(targetValue, value);
@@ -984,13 +992,15 @@ void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::forEach(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
                                                      std::function<void(uint64_t const&, ValueType const&)> const& function) const {
-    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, flatOdd, flatOdd.getRoot(), ddVariableIndices, function);
 }
 
 template<typename ValueType>
+template<typename Function>
 void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset,
-                                                        Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices,
-                                                        std::function<void(uint64_t const&, ValueType const&)> const& function) const {
+                                                        FlatOdd const& odd, uint64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices,
+                                                        Function const& function) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
@@ -1002,15 +1012,17 @@ void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t
     } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
         // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
         // and for the one in which it is not set.
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd, odd.getElseSuccessor(oddNode), ddVariableIndices, function);
+        forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(oddNode), odd, odd.getThenSuccessor(oddNode), ddVariableIndices,
+                   function);
     } else {
         // Otherwise, we simply recursively call the function for both (different) cases.
         MTBDD thenNode = mtbdd_gethigh(dd);
         MTBDD elseNode = mtbdd_getlow(dd);
 
-        forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-        forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+        forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd, odd.getElseSuccessor(oddNode), ddVariableIndices, function);
+        forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(oddNode), odd, odd.getThenSuccessor(oddNode), ddVariableIndices,
+                   function);
     }
 }
 
@@ -1231,24 +1243,71 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    FlatOdd const& flatRowOdd = rowOdd.getFlatOdd();
+    FlatOdd const& flatColumnOdd = columnOdd.getFlatOdd();
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+
+    // Rational functions are not converted concurrently as their (carl) caches are not thread-safe.
+    uint64_t numberOfThreads =
+        std::is_same<ValueType, storm::RationalFunction>::value ? 1 : storm::utility::parallel::getDefaultNumberOfThreads();
+    if (numberOfThreads <= 1 || rowOdd.getTotalOffset() < parallelMatrixExtractionThreshold) {
+        toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatRowOdd.getRoot(),
+                              flatColumnOdd, flatColumnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        return;
+    }
+
+    // Collect the nodes at a level that provides enough tasks for the threads.
+    uint_fast64_t splitLevel = 0;
+    while (splitLevel < ddRowVariableIndices.size() && (1ull << splitLevel) < numberOfThreads * 16) {
+        ++splitLevel;
+    }
+    std::vector<MatrixExtractionTask> tasks;
+    toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatRowOdd.getRoot(),
+                          flatColumnOdd, flatColumnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, &tasks,
+                          splitLevel);
+
+    // Tasks for different rows write to disjoint parts of the matrix. The tasks for the same rows are processed in their original order, which
+    // keeps the entries of each row sorted by column. Reading the nodes of the MTBDD does not require a Lace worker.
+    std::stable_sort(tasks.begin(), tasks.end(),
+                     [](MatrixExtractionTask const& first, MatrixExtractionTask const& second) { return first.rowOffset < second.rowOffset; });
+    std::vector<uint64_t> taskGroupStarts;
+    for (uint64_t task = 0; task < tasks.size(); ++task) {
+        if (task == 0 || tasks[task].rowOffset != tasks[task - 1].rowOffset) {
+            taskGroupStarts.push_back(task);
+        }
+    }
+    taskGroupStarts.push_back(tasks.size());
+    storm::utility::parallel::forEachChunk(0, taskGroupStarts.size() - 1, 1, numberOfThreads, [&](uint64_t, uint64_t firstGroup, uint64_t lastGroup) {
+        for (uint64_t task = taskGroupStarts[firstGroup]; task < taskGroupStarts[lastGroup]; ++task) {
+            MatrixExtractionTask const& currentTask = tasks[task];
+            toMatrixComponentsRec(currentTask.dd, currentTask.negated, rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, currentTask.rowOddNode,
+                                  flatColumnOdd, currentTask.columnOddNode, splitLevel, splitLevel, maxLevel, currentTask.rowOffset,
+                                  currentTask.columnOffset, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+        }
+    });
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets,
                                                                    std::vector<uint_fast64_t>& rowIndications,
                                                                    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
-                                                                   Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
-                                                                   uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
-                                                                   uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   FlatOdd const& rowOdd, uint64_t rowOddNode, FlatOdd const& columnOdd,
+                                                                   uint64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel,
+                                                                   uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                   std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   std::vector<MatrixExtractionTask>* tasks, uint_fast64_t splitLevel) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
     }
 
+    if (tasks != nullptr && currentRowLevel == splitLevel) {
+        tasks->push_back({dd, negated, rowOddNode, columnOddNode, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -1286,22 +1345,26 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
         }
 
         // Visit else-else.
-        toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd,
+                              rowOdd.getElseSuccessor(rowOddNode), columnOdd, columnOdd.getElseSuccessor(columnOddNode), currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                              generateValues, tasks, splitLevel);
         // Visit else-then.
-        toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd,
+                              rowOdd.getElseSuccessor(rowOddNode), columnOdd, columnOdd.getThenSuccessor(columnOddNode), currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(columnOddNode),
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, tasks, splitLevel);
         // Visit then-else.
-        toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd,
+                              rowOdd.getThenSuccessor(rowOddNode), columnOdd, columnOdd.getElseSuccessor(columnOddNode), currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(rowOddNode), currentColumnOffset,
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, tasks, splitLevel);
         // Visit then-then.
-        toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd,
+                              rowOdd.getThenSuccessor(rowOddNode), columnOdd, columnOdd.getThenSuccessor(columnOddNode), currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(rowOddNode),
+                              currentColumnOffset + columnOdd.getElseOffset(columnOddNode), ddRowVariableIndices, ddColumnVariableIndices, generateValues,
+                              tasks, splitLevel);
     }
 }
 
@@ -1310,32 +1373,34 @@ InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::f
                                                                                           std::vector<ValueType> const& values, storm::dd::Odd const& odd,
                                                                                           std::vector<uint_fast64_t> const& ddVariableIndices) {
     uint_fast64_t offset = 0;
-    return InternalAdd<DdType::Sylvan, ValueType>(ddManager, sylvan::Mtbdd(fromVectorRec(offset, 0, ddVariableIndices.size(), values, odd, ddVariableIndices)));
+    FlatOdd const& flatOdd = odd.getFlatOdd();
+    return InternalAdd<DdType::Sylvan, ValueType>(
+        ddManager, sylvan::Mtbdd(fromVectorRec(offset, 0, ddVariableIndices.size(), values, flatOdd, flatOdd.getRoot(), ddVariableIndices)));
 }
 
 template<typename ValueType>
 MTBDD InternalAdd<DdType::Sylvan, ValueType>::fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel,
-                                                            std::vector<ValueType> const& values, Odd const& odd,
+                                                            std::vector<ValueType> const& values, FlatOdd const& odd, uint64_t oddNode,
                                                             std::vector<uint_fast64_t> const& ddVariableIndices) {
     if (currentLevel == maxLevel) {
         // If we are in a terminal node of the ODD, we need to check whether the then-offset of the ODD is one
         // (meaning the encoding is a valid one) or zero (meaning the encoding is not valid). Consequently, we
         // need to copy the next value of the vector iff the then-offset is greater than zero.
-        if (odd.getThenOffset() > 0) {
+        if (odd.getThenOffset(oddNode) > 0) {
             return getLeaf(values[currentOffset++]);
         } else {
             return getLeaf(storm::utility::zero<ValueType>());
         }
     } else {
         // If the total offset is zero, we can just return the constant zero DD.
-        if (odd.getThenOffset() + odd.getElseOffset() == 0) {
+        if (odd.getThenOffset(oddNode) + odd.getElseOffset(oddNode) == 0) {
             return getLeaf(storm::utility::zero<ValueType>());
         }
 
         // Determine the new else-successor.
         MTBDD elseSuccessor;
-        if (odd.getElseOffset() > 0) {
-            elseSuccessor = fromVectorRec(currentOffset, currentLevel + 1, maxLevel, values, odd.getElseSuccessor(), ddVariableIndices);
+        if (odd.getElseOffset(oddNode) > 0) {
+            elseSuccessor = fromVectorRec(currentOffset, currentLevel + 1, maxLevel, values, odd, odd.getElseSuccessor(oddNode), ddVariableIndices);
         } else {
             elseSuccessor = getLeaf(storm::utility::zero<ValueType>());
         }
@@ -1343,8 +1408,8 @@ MTBDD InternalAdd<DdType::Sylvan, ValueType>::fromVectorRec(uint_fast64_t& curre
 
         // Determine the new then-successor.
         MTBDD thenSuccessor;
-        if (odd.getThenOffset() > 0) {
-            thenSuccessor = fromVectorRec(currentOffset, currentLevel + 1, maxLevel, values, odd.getThenSuccessor(), ddVariableIndices);
+        if (odd.getThenOffset(oddNode) > 0) {
+            thenSuccessor = fromVectorRec(currentOffset, currentLevel + 1, maxLevel, values, odd, odd.getThenSuccessor(oddNode), ddVariableIndices);
         } else {
             thenSuccessor = getLeaf(storm::utility::zero<ValueType>());
         }
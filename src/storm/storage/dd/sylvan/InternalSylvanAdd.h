@@ -700,13 +700,15 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param currentLevel The currently considered level in the DD.
      * @param maxLevel The number of levels that need to be considered.
      * @param currentOffset The current offset.
-     * @param odd The ODD used for the translation.
+     * @param odd The (flattened) ODD used for the translation.
+     * @param oddNode The currently considered node of the ODD.
      * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
      * @param function The callback invoked for every element. The first argument is the offset and the second
      * is the value.
      */
-    void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd,
-                    std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void(uint64_t const&, ValueType const&)> const& function) const;
+    template<typename Function>
+    void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, FlatOdd const& odd, uint64_t oddNode,
+                    std::vector<uint_fast64_t> const& ddVariableIndices, Function const& function) const;
 
     /*!
      * Splits the given matrix DD into the labelings of the gropus using the given group variables.
@@ -774,12 +776,23 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param currentLevel The current level in the DD.
      * @param maxLevel The maximal level in the DD.
      * @param values The vector that is to be represented by the ADD.
-     * @param odd The ODD used for the translation.
+     * @param odd The (flattened) ODD used for the translation.
+     * @param oddNode The currently considered node of the ODD.
      * @param ddVariableIndices The (sorted) list of DD variable indices to use.
      * @return The resulting (Sylvan) MTBDD node.
      */
     static MTBDD fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values,
-                               Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
+                               FlatOdd const& odd, uint64_t oddNode, std::vector<uint_fast64_t> const& ddVariableIndices);
+
+    // The state of the matrix extraction at a node that is visited in toMatrixComponentsRec.
+    struct MatrixExtractionTask {
+        MTBDD dd;
+        bool negated;
+        uint64_t rowOddNode;
+        uint64_t columnOddNode;
+        uint_fast64_t rowOffset;
+        uint_fast64_t columnOffset;
+    };
 
     /*!
      * Helper function to convert the DD into a (sparse) matrix.
@@ -794,8 +807,10 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param columnsAndValues The vector that will hold the columns and values of non-zero entries upon successful
      * completion.
      * @param rowGroupOffsets The row offsets at which a given row group starts.
-     * @param rowOdd The ODD used for the row translation.
-     * @param columnOdd The ODD used for the column translation.
+     * @param rowOdd The (flattened) ODD used for the row translation.
+     * @param rowOddNode The currently considered node of the row ODD.
+     * @param columnOdd The (flattened) ODD used for the column translation.
+     * @param columnOddNode The currently considered node of the column ODD.
      * @param currentRowLevel The currently considered row level in the DD.
      * @param currentColumnLevel The currently considered row level in the DD.
      * @param maxLevel The number of levels that need to be considered.
@@ -806,12 +821,16 @@ class InternalAdd<DdType::Sylvan, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param tasks If given, the traversal stops at the given split level and the reached nodes are appended to this vector (in the order in
+     * which they would have been visited).
+     * @param splitLevel The row level at which the traversal stops if tasks are collected.
      */
     void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
-                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
-                               uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
-                               uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd, uint64_t rowOddNode,
+                               FlatOdd const& columnOdd, uint64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel,
+                               uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                               std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                               bool writeValues, std::vector<MatrixExtractionTask>* tasks = nullptr, uint_fast64_t splitLevel = 0) const;
 
     /*!
      * Retrieves the sylvan representation of the given double value.
@@ -1,9 +1,13 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <exception>
 #include <iostream>
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/SylvanSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
@@ -13,12 +17,20 @@
 
 #include "storm/adapters/sylvan.h"
 
+#include "sylvan_cache.h"
+
 #include "storm-config.h"
 
 namespace storm {
 namespace dd {
 
-#ifndef NDEBUG
+namespace {
+// Sylvan does not count the garbage collections (unless compiled with statistics), so we do this in the hooks.
+std::atomic<uint64_t> numberOfGarbageCollections(0);
+std::atomic<uint64_t> garbageCollectionNanoseconds(0);
+std::chrono::steady_clock::time_point garbageCollectionStart;
+}  // namespace
+
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wzero-length-array"
@@ -27,9 +39,13 @@ namespace dd {
 
 VOID_TASK_0(gc_start) {
     STORM_LOG_TRACE("Starting sylvan garbage collection...");
+    garbageCollectionStart = std::chrono::steady_clock::now();
 }
 
 VOID_TASK_0(gc_end) {
+    ++numberOfGarbageCollections;
+    garbageCollectionNanoseconds +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - garbageCollectionStart).count();
     STORM_LOG_TRACE("Sylvan garbage collection done.");
 }
 
@@ -37,6 +53,39 @@ VOID_TASK_0(gc_end) {
 #pragma clang diagnostic pop
 #endif
 
+namespace {
+struct TaskContext {
+    std::function<void(uint64_t)> const* task;
+    std::vector<std::exception_ptr>* exceptions;
+};
+}  // namespace
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+
+// Executes the tasks in [first, last) by recursively spawning the upper half. Exceptions must not propagate through
+// the Lace frames, so they are recorded and rethrown by the caller.
+VOID_TASK_3(execute_tasks, void*, context, uint64_t, first, uint64_t, last) {
+    if (last - first == 1) {
+        TaskContext const& taskContext = *static_cast<TaskContext const*>(context);
+        try {
+            (*taskContext.task)(first);
+        } catch (...) {
+            (*taskContext.exceptions)[first] = std::current_exception();
+        }
+    } else {
+        uint64_t middle = first + (last - first) / 2;
+        SPAWN(execute_tasks, context, middle, last);
+        CALL(execute_tasks, context, first, middle);
+        SYNC(execute_tasks);
+    }
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
 #endif
 
 uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -45,6 +94,8 @@ uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
 // some operations.
 uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
 
+bool InternalDdManager<DdType::Sylvan>::parallelTasks = false;
+
 uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
     for (uint_fast64_t index = 0; index < 64; ++index) {
         if ((number & (1ull << (63 - index))) != 0) {
@@ -57,12 +108,19 @@ uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
 InternalDdManager<DdType::Sylvan>::InternalDdManager() {
     if (numberOfInstances == 0) {
         storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
+        // If no thread count is given specifically for Sylvan, we fall back to the general one (if set) so that
+        // the Lace workers match the threads used by the remaining parallelized computations.
+        storm::settings::modules::CoreSettings const& coreSettings = storm::settings::getModule<storm::settings::modules::CoreSettings>();
         if (settings.isNumberOfThreadsSet()) {
             lace_init(settings.getNumberOfThreads(), 1024 * 1024 * 16);
+        } else if (coreSettings.isNumberOfThreadsSet()) {
+            lace_init(coreSettings.getNumberOfThreads(), 1024 * 1024 * 16);
         } else {
             lace_init(0, 1024 * 1024 * 16);
         }
         lace_startup(0, 0, 0);
+        parallelTasks = settings.isParallelTasksSet();
+        STORM_LOG_DEBUG("Started Lace with " << lace_workers() << " workers.");
 
         // Table/cache size computation taken from newer version of sylvan.
         uint64_t memorycap = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024;
@@ -104,10 +162,8 @@ InternalDdManager<DdType::Sylvan>::InternalDdManager() {
         sylvan::Sylvan::initMtbdd();
         sylvan::Sylvan::initCustomMtbdd();
 
-#ifndef NDEBUG
         sylvan_gc_hook_pregc(TASK(gc_start));
         sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
     }
     ++numberOfInstances;
 }
@@ -267,10 +323,56 @@ void InternalDdManager<DdType::Sylvan>::debugCheck() const {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
 }
 
+void InternalDdManager<DdType::Sylvan>::executeTasks(uint64_t numberOfTasks, std::function<void(uint64_t)> const& task) const {
+    if (!parallelTasks || numberOfTasks < 2 || lace_workers() < 2) {
+        for (uint64_t index = 0; index < numberOfTasks; ++index) {
+            task(index);
+        }
+        return;
+    }
+
+    std::vector<std::exception_ptr> exceptions(numberOfTasks);
+    TaskContext context{&task, &exceptions};
+    LACE_ME;
+    CALL(execute_tasks, &context, 0, numberOfTasks);
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
     return nextFreeVariableIndex;
 }
 
+DdStatistics InternalDdManager<DdType::Sylvan>::getStatistics() const {
+    DdStatistics result;
+    LACE_ME;
+    size_t filled = 0;
+    size_t total = 0;
+    sylvan_table_usage(&filled, &total);
+    result.nodeCount = filled;
+    result.peakNodeCount = filled;
+    result.uniqueTableSlots = total;
+    result.cacheSlots = cache_getsize();
+    // Estimate the memory with the sizes of the entries that are also used to determine the table sizes.
+    result.memoryInBytes = result.uniqueTableSlots * 24 + result.cacheSlots * 36;
+#if SYLVAN_STATS
+    sylvan_stats_t stats;
+    sylvan_stats_snapshot(&stats);
+    result.hasCacheStatistics = true;
+    // The counters of the operations come in triples of calls, cache insertions and cache hits.
+    for (size_t counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+        result.cacheLookups += stats.counters[counter];
+        result.cacheHits += stats.counters[counter + 2];
+    }
+#endif
+    result.garbageCollections = numberOfGarbageCollections;
+    result.garbageCollectionMilliseconds = garbageCollectionNanoseconds / 1000000;
+    return result;
+}
+
 template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
 template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
 
@@ -0,0 +1,216 @@
+#include "storm/storage/distributed/Communicator.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+struct SharedMemoryCommunicator::SharedState {
+    explicit SharedState(uint64_t numberOfRanks)
+        : numberOfRanks(numberOfRanks),
+          uint64Slots(numberOfRanks),
+          doubleSlots(numberOfRanks),
+          uint64Mailboxes(numberOfRanks, std::vector<std::vector<uint64_t>>(numberOfRanks)),
+          doubleMailboxes(numberOfRanks, std::vector<std::vector<double>>(numberOfRanks)) {
+        // Intentionally left empty.
+    }
+
+    // Blocks until all ranks arrived at the barrier.
+    void barrier() {
+        std::unique_lock<std::mutex> lock(mutex);
+        uint64_t currentGeneration = generation;
+        if (++arrivedRanks == numberOfRanks) {
+            arrivedRanks = 0;
+            ++generation;
+            allArrived.notify_all();
+        } else {
+            allArrived.wait(lock, [&] { return generation != currentGeneration; });
+        }
+    }
+
+    template<typename T, typename ReduceFunction>
+    T allreduce(uint64_t rank, T const& value, std::vector<T>& slots, ReduceFunction const& reduce) {
+        slots[rank] = value;
+        barrier();
+        T result = slots.front();
+        for (uint64_t otherRank = 1; otherRank < numberOfRanks; ++otherRank) {
+            result = reduce(result, slots[otherRank]);
+        }
+        // No rank may overwrite its slot before all ranks have read the slots.
+        barrier();
+        return result;
+    }
+
+    template<typename T>
+    std::vector<std::vector<T>> exchange(uint64_t rank, std::vector<std::vector<T>> const& sendBuffers, std::vector<std::vector<std::vector<T>>>& mailboxes) {
+        STORM_LOG_THROW(sendBuffers.size() == numberOfRanks, storm::exceptions::InvalidArgumentException,
+                        "Expected " << numberOfRanks << " send buffers but got " << sendBuffers.size() << ".");
+        for (uint64_t target = 0; target < numberOfRanks; ++target) {
+            mailboxes[rank][target] = sendBuffers[target];
+        }
+        barrier();
+        std::vector<std::vector<T>> result(numberOfRanks);
+        for (uint64_t source = 0; source < numberOfRanks; ++source) {
+            result[source] = std::move(mailboxes[source][rank]);
+        }
+        // No rank may write to a mailbox before its receiver has emptied it.
+        barrier();
+        return result;
+    }
+
+    uint64_t const numberOfRanks;
+
+    std::mutex mutex;
+    std::condition_variable allArrived;
+    uint64_t arrivedRanks = 0;
+    uint64_t generation = 0;
+
+    // One slot per rank for reductions.
+    std::vector<uint64_t> uint64Slots;
+    std::vector<double> doubleSlots;
+
+    // The buffers sent from rank i to rank j are stored in the mailbox [i][j].
+    std::vector<std::vector<std::vector<uint64_t>>> uint64Mailboxes;
+    std::vector<std::vector<std::vector<double>>> doubleMailboxes;
+};
+
+std::vector<std::shared_ptr<Communicator>> SharedMemoryCommunicator::create(uint64_t numberOfRanks) {
+    STORM_LOG_THROW(numberOfRanks > 0, storm::exceptions::InvalidArgumentException, "A communicator needs at least one rank.");
+    auto state = std::make_shared<SharedState>(numberOfRanks);
+    std::vector<std::shared_ptr<Communicator>> result;
+    result.reserve(numberOfRanks);
+    for (uint64_t rank = 0; rank < numberOfRanks; ++rank) {
+        result.push_back(std::shared_ptr<Communicator>(new SharedMemoryCommunicator(state, rank)));
+    }
+    return result;
+}
+
+SharedMemoryCommunicator::SharedMemoryCommunicator(std::shared_ptr<SharedState> const& state, uint64_t rank) : state(state), rank(rank) {
+    // Intentionally left empty.
+}
+
+uint64_t SharedMemoryCommunicator::getRank() const {
+    return rank;
+}
+
+uint64_t SharedMemoryCommunicator::getNumberOfRanks() const {
+    return state->numberOfRanks;
+}
+
+uint64_t SharedMemoryCommunicator::allreduceMax(uint64_t value) {
+    return state->allreduce(rank, value, state->uint64Slots, [](uint64_t a, uint64_t b) { return std::max(a, b); });
+}
+
+double SharedMemoryCommunicator::allreduceMax(double value) {
+    return state->allreduce(rank, value, state->doubleSlots, [](double a, double b) { return std::max(a, b); });
+}
+
+uint64_t SharedMemoryCommunicator::allreduceSum(uint64_t value) {
+    return state->allreduce(rank, value, state->uint64Slots, [](uint64_t a, uint64_t b) { return a + b; });
+}
+
+std::vector<std::vector<uint64_t>> SharedMemoryCommunicator::exchange(std::vector<std::vector<uint64_t>> const& sendBuffers) {
+    return state->exchange(rank, sendBuffers, state->uint64Mailboxes);
+}
+
+std::vector<std::vector<double>> SharedMemoryCommunicator::exchange(std::vector<std::vector<double>> const& sendBuffers) {
+    return state->exchange(rank, sendBuffers, state->doubleMailboxes);
+}
+
+#ifdef STORM_HAVE_MPI
+namespace {
+template<typename T>
+std::vector<std::vector<T>> exchangeMpi(MPI_Comm communicator, uint64_t numberOfRanks, std::vector<std::vector<T>> const& sendBuffers, MPI_Datatype type) {
+    STORM_LOG_THROW(sendBuffers.size() == numberOfRanks, storm::exceptions::InvalidArgumentException,
+                    "Expected " << numberOfRanks << " send buffers but got " << sendBuffers.size() << ".");
+    // MPI counts and displacements are ints.
+    std::vector<int> sendCounts(numberOfRanks), sendDisplacements(numberOfRanks);
+    std::vector<T> sendData;
+    for (uint64_t target = 0; target < numberOfRanks; ++target) {
+        STORM_LOG_THROW(sendData.size() + sendBuffers[target].size() <= static_cast<uint64_t>(std::numeric_limits<int>::max()),
+                        storm::exceptions::InvalidArgumentException, "The data to exchange exceeds the limits of MPI.");
+        sendDisplacements[target] = static_cast<int>(sendData.size());
+        sendCounts[target] = static_cast<int>(sendBuffers[target].size());
+        sendData.insert(sendData.end(), sendBuffers[target].begin(), sendBuffers[target].end());
+    }
+
+    std::vector<int> receiveCounts(numberOfRanks), receiveDisplacements(numberOfRanks);
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, communicator);
+    uint64_t receiveSize = 0;
+    for (uint64_t source = 0; source < numberOfRanks; ++source) {
+        STORM_LOG_THROW(receiveSize + receiveCounts[source] <= static_cast<uint64_t>(std::numeric_limits<int>::max()),
+                        storm::exceptions::InvalidArgumentException, "The data to exchange exceeds the limits of MPI.");
+        receiveDisplacements[source] = static_cast<int>(receiveSize);
+        receiveSize += receiveCounts[source];
+    }
+    std::vector<T> receiveData(receiveSize);
+    MPI_Alltoallv(sendData.data(), sendCounts.data(), sendDisplacements.data(), type, receiveData.data(), receiveCounts.data(), receiveDisplacements.data(),
+                  type, communicator);
+
+    std::vector<std::vector<T>> result(numberOfRanks);
+    for (uint64_t source = 0; source < numberOfRanks; ++source) {
+        auto begin = receiveData.begin() + receiveDisplacements[source];
+        result[source].assign(begin, begin + receiveCounts[source]);
+    }
+    return result;
+}
+}  // namespace
+
+MpiCommunicator::MpiCommunicator(MPI_Comm communicator) : communicator(communicator) {
+    int initialized = 0;
+    MPI_Initialized(&initialized);
+    STORM_LOG_THROW(initialized, storm::exceptions::InvalidStateException, "MPI has to be initialized before creating a communicator.");
+    int mpiRank = 0;
+    int mpiSize = 0;
+    MPI_Comm_rank(communicator, &mpiRank);
+    MPI_Comm_size(communicator, &mpiSize);
+    rank = static_cast<uint64_t>(mpiRank);
+    numberOfRanks = static_cast<uint64_t>(mpiSize);
+}
+
+uint64_t MpiCommunicator::getRank() const {
+    return rank;
+}
+
+uint64_t MpiCommunicator::getNumberOfRanks() const {
+    return numberOfRanks;
+}
+
+uint64_t MpiCommunicator::allreduceMax(uint64_t value) {
+    uint64_t result = 0;
+    MPI_Allreduce(&value, &result, 1, MPI_UINT64_T, MPI_MAX, communicator);
+    return result;
+}
+
+double MpiCommunicator::allreduceMax(double value) {
+    double result = 0.0;
+    MPI_Allreduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, communicator);
+    return result;
+}
+
+uint64_t MpiCommunicator::allreduceSum(uint64_t value) {
+    uint64_t result = 0;
+    MPI_Allreduce(&value, &result, 1, MPI_UINT64_T, MPI_SUM, communicator);
+    return result;
+}
+
+std::vector<std::vector<uint64_t>> MpiCommunicator::exchange(std::vector<std::vector<uint64_t>> const& sendBuffers) {
+    return exchangeMpi(communicator, numberOfRanks, sendBuffers, MPI_UINT64_T);
+}
+
+std::vector<std::vector<double>> MpiCommunicator::exchange(std::vector<std::vector<double>> const& sendBuffers) {
+    return exchangeMpi(communicator, numberOfRanks, sendBuffers, MPI_DOUBLE);
+}
+#endif
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MPI
+#include <mpi.h>
+#endif
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+/*!
+ * The collective operations that the distributed data structures need. All operations have to be called by all
+ * ranks in the same order.
+ */
+class Communicator {
+   public:
+    virtual ~Communicator() = default;
+
+    virtual uint64_t getRank() const = 0;
+    virtual uint64_t getNumberOfRanks() const = 0;
+
+    /*!
+     * Retrieves the maximum of the given values of all ranks.
+     */
+    virtual uint64_t allreduceMax(uint64_t value) = 0;
+    virtual double allreduceMax(double value) = 0;
+
+    /*!
+     * Retrieves the sum of the given values of all ranks.
+     */
+    virtual uint64_t allreduceSum(uint64_t value) = 0;
+
+    /*!
+     * Sends the i-th of the given buffers to rank i and retrieves the buffers that the other ranks sent to this rank.
+     *
+     * @param sendBuffers One buffer for every rank (including this rank).
+     * @return For every rank, the buffer that it sent to this rank.
+     */
+    virtual std::vector<std::vector<uint64_t>> exchange(std::vector<std::vector<uint64_t>> const& sendBuffers) = 0;
+    virtual std::vector<std::vector<double>> exchange(std::vector<std::vector<double>> const& sendBuffers) = 0;
+};
+
+/*!
+ * A communicator for ranks that are threads of the same process, for example to use the distributed algorithms on a
+ * single machine or to test them.
+ */
+class SharedMemoryCommunicator : public Communicator {
+   public:
+    /*!
+     * Creates connected communicators for the given number of ranks. The i-th communicator belongs to rank i and has
+     * to be used by exactly one thread.
+     */
+    static std::vector<std::shared_ptr<Communicator>> create(uint64_t numberOfRanks);
+
+    virtual uint64_t getRank() const override;
+    virtual uint64_t getNumberOfRanks() const override;
+    virtual uint64_t allreduceMax(uint64_t value) override;
+    virtual double allreduceMax(double value) override;
+    virtual uint64_t allreduceSum(uint64_t value) override;
+    virtual std::vector<std::vector<uint64_t>> exchange(std::vector<std::vector<uint64_t>> const& sendBuffers) override;
+    virtual std::vector<std::vector<double>> exchange(std::vector<std::vector<double>> const& sendBuffers) override;
+
+   private:
+    struct SharedState;
+
+    SharedMemoryCommunicator(std::shared_ptr<SharedState> const& state, uint64_t rank);
+
+    std::shared_ptr<SharedState> state;
+    uint64_t rank;
+};
+
+#ifdef STORM_HAVE_MPI
+/*!
+ * A communicator for the processes of an MPI communicator. MPI has to be initialized (and finalized) by the caller.
+ */
+class MpiCommunicator : public Communicator {
+   public:
+    explicit MpiCommunicator(MPI_Comm communicator = MPI_COMM_WORLD);
+
+    virtual uint64_t getRank() const override;
+    virtual uint64_t getNumberOfRanks() const override;
+    virtual uint64_t allreduceMax(uint64_t value) override;
+    virtual double allreduceMax(double value) override;
+    virtual uint64_t allreduceSum(uint64_t value) override;
+    virtual std::vector<std::vector<uint64_t>> exchange(std::vector<std::vector<uint64_t>> const& sendBuffers) override;
+    virtual std::vector<std::vector<double>> exchange(std::vector<std::vector<double>> const& sendBuffers) override;
+
+   private:
+    MPI_Comm communicator;
+    uint64_t rank;
+    uint64_t numberOfRanks;
+};
+#endif
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,196 @@
+#include "storm/storage/distributed/DistributedSparseMatrix.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+template<typename ValueType>
+DistributedSparseMatrix<ValueType>::DistributedSparseMatrix(storm::storage::SparseMatrix<ValueType> const& localRows, StatePartition const& partition,
+                                                            std::shared_ptr<Communicator> const& communicator)
+    : partition(partition), communicator(communicator) {
+    uint64_t const rank = communicator->getRank();
+    uint64_t const numberOfRanks = communicator->getNumberOfRanks();
+    STORM_LOG_THROW(partition.getNumberOfRanks() == numberOfRanks, storm::exceptions::InvalidArgumentException,
+                    "The partition is for " << partition.getNumberOfRanks() << " ranks, but the communicator connects " << numberOfRanks << " ranks.");
+    numberOfLocalStates = partition.getNumberOfLocalStates(rank);
+    STORM_LOG_THROW(localRows.getRowGroupCount() == numberOfLocalStates, storm::exceptions::InvalidArgumentException,
+                    "Expected " << numberOfLocalStates << " local row groups, but got " << localRows.getRowGroupCount() << ".");
+    STORM_LOG_THROW(localRows.getColumnCount() <= partition.getNumberOfStates(), storm::exceptions::InvalidArgumentException,
+                    "The local rows refer to more states than the partition contains.");
+
+    // Determine the ghost states, grouped by their owner.
+    std::vector<std::vector<uint64_t>> requests(numberOfRanks);
+    for (uint64_t row = 0; row < localRows.getRowCount(); ++row) {
+        for (auto const& entry : localRows.getRow(row)) {
+            uint64_t owner = partition.getOwner(entry.getColumn());
+            if (owner != rank) {
+                requests[owner].push_back(entry.getColumn());
+            }
+        }
+    }
+    receiveOffsets.reserve(numberOfRanks + 1);
+    for (auto& ownerRequests : requests) {
+        std::sort(ownerRequests.begin(), ownerRequests.end());
+        ownerRequests.erase(std::unique(ownerRequests.begin(), ownerRequests.end()), ownerRequests.end());
+        receiveOffsets.push_back(ghostStates.size());
+        ghostStates.insert(ghostStates.end(), ownerRequests.begin(), ownerRequests.end());
+    }
+    receiveOffsets.push_back(ghostStates.size());
+
+    // Tell the owners which of their values we need.
+    std::vector<std::vector<uint64_t>> requested = communicator->exchange(requests);
+    sendIndices.resize(numberOfRanks);
+    for (uint64_t source = 0; source < numberOfRanks; ++source) {
+        sendIndices[source].reserve(requested[source].size());
+        for (auto const& state : requested[source]) {
+            STORM_LOG_ASSERT(partition.getOwner(state) == rank, "Rank " << source << " requested state " << state << " from the wrong rank.");
+            sendIndices[source].push_back(partition.getLocalIndex(state));
+        }
+    }
+
+    // Translate the columns of the local rows. As the translation does not preserve the order, the entries of each row are sorted again.
+    bool const hasTrivialRowGrouping = localRows.hasTrivialRowGrouping();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(localRows.getRowCount(), getNumberOfColumns(), localRows.getEntryCount(), true,
+                                                           !hasTrivialRowGrouping, hasTrivialRowGrouping ? 0 : numberOfLocalStates);
+    std::vector<uint64_t> const& rowGroupIndices = localRows.getRowGroupIndices();
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    for (uint64_t group = 0; group < numberOfLocalStates; ++group) {
+        if (!hasTrivialRowGrouping) {
+            builder.newRowGroup(rowGroupIndices[group]);
+        }
+        for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+            rowEntries.clear();
+            for (auto const& entry : localRows.getRow(row)) {
+                uint64_t owner = partition.getOwner(entry.getColumn());
+                uint64_t column;
+                if (owner == rank) {
+                    column = partition.getLocalIndex(entry.getColumn());
+                } else {
+                    auto ownerBegin = ghostStates.begin() + receiveOffsets[owner];
+                    auto ownerEnd = ghostStates.begin() + receiveOffsets[owner + 1];
+                    column = numberOfLocalStates + (std::lower_bound(ownerBegin, ownerEnd, entry.getColumn()) - ghostStates.begin());
+                }
+                rowEntries.emplace_back(column, entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](std::pair<uint64_t, ValueType> const& a, std::pair<uint64_t, ValueType> const& b) { return a.first < b.first; });
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(row, entry.first, entry.second);
+            }
+        }
+    }
+    localMatrix = builder.build();
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> DistributedSparseMatrix<ValueType>::extractLocalRows(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                                             StatePartition const& partition, uint64_t rank) {
+    STORM_LOG_THROW(matrix.getRowGroupCount() == partition.getNumberOfStates(), storm::exceptions::InvalidArgumentException,
+                    "The matrix has " << matrix.getRowGroupCount() << " row groups, but the partition contains " << partition.getNumberOfStates()
+                                      << " states.");
+    uint64_t const numberOfLocalStates = partition.getNumberOfLocalStates(rank);
+    bool const hasTrivialRowGrouping = matrix.hasTrivialRowGrouping();
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    for (uint64_t localState = 0; localState < numberOfLocalStates; ++localState) {
+        uint64_t state = partition.getGlobalIndex(rank, localState);
+        numberOfRows += rowGroupIndices[state + 1] - rowGroupIndices[state];
+        numberOfEntries += matrix.getRowGroupEntryCount(state);
+    }
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, matrix.getColumnCount(), numberOfEntries, true, !hasTrivialRowGrouping,
+                                                           hasTrivialRowGrouping ? 0 : numberOfLocalStates);
+    uint64_t localRow = 0;
+    for (uint64_t localState = 0; localState < numberOfLocalStates; ++localState) {
+        uint64_t state = partition.getGlobalIndex(rank, localState);
+        if (!hasTrivialRowGrouping) {
+            builder.newRowGroup(localRow);
+        }
+        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++localRow) {
+            for (auto const& entry : matrix.getRow(row)) {
+                builder.addNextValue(localRow, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    return builder.build();
+}
+
+template<typename ValueType>
+void DistributedSparseMatrix<ValueType>::synchronizeGhostValues(std::vector<ValueType>& x) const {
+    STORM_LOG_ASSERT(x.size() == getNumberOfColumns(), "Unexpected size of the vector.");
+    uint64_t const numberOfRanks = communicator->getNumberOfRanks();
+    std::vector<std::vector<ValueType>> sendBuffers(numberOfRanks);
+    for (uint64_t target = 0; target < numberOfRanks; ++target) {
+        sendBuffers[target].reserve(sendIndices[target].size());
+        for (auto const& localIndex : sendIndices[target]) {
+            sendBuffers[target].push_back(x[localIndex]);
+        }
+    }
+    std::vector<std::vector<ValueType>> received = communicator->exchange(sendBuffers);
+    for (uint64_t source = 0; source < numberOfRanks; ++source) {
+        STORM_LOG_ASSERT(received[source].size() == receiveOffsets[source + 1] - receiveOffsets[source],
+                         "Received an unexpected number of values from rank " << source << ".");
+        std::copy(received[source].begin(), received[source].end(), x.begin() + numberOfLocalStates + receiveOffsets[source]);
+    }
+}
+
+template<typename ValueType>
+void DistributedSparseMatrix<ValueType>::multiplyAndReduce(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType> const& x,
+                                                           std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                           std::vector<uint64_t>* choices) const {
+    if (dir) {
+        localMatrix.multiplyAndReduce(dir.get(), localMatrix.getRowGroupIndices(), x, summand, result, choices);
+    } else {
+        STORM_LOG_ASSERT(localMatrix.hasTrivialRowGrouping(), "Expected an optimization direction for a matrix with non-trivial row grouping.");
+        localMatrix.multiplyWithVector(x, result, summand);
+    }
+}
+
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> const& DistributedSparseMatrix<ValueType>::getLocalMatrix() const {
+    return localMatrix;
+}
+
+template<typename ValueType>
+uint64_t DistributedSparseMatrix<ValueType>::getNumberOfLocalStates() const {
+    return numberOfLocalStates;
+}
+
+template<typename ValueType>
+uint64_t DistributedSparseMatrix<ValueType>::getNumberOfGhostStates() const {
+    return ghostStates.size();
+}
+
+template<typename ValueType>
+uint64_t DistributedSparseMatrix<ValueType>::getNumberOfColumns() const {
+    return numberOfLocalStates + ghostStates.size();
+}
+
+template<typename ValueType>
+std::vector<uint64_t> const& DistributedSparseMatrix<ValueType>::getGhostStates() const {
+    return ghostStates;
+}
+
+template<typename ValueType>
+StatePartition const& DistributedSparseMatrix<ValueType>::getPartition() const {
+    return partition;
+}
+
+template<typename ValueType>
+Communicator& DistributedSparseMatrix<ValueType>::getCommunicator() const {
+    return *communicator;
+}
+
+// The communicators only exchange doubles.
+template class DistributedSparseMatrix<double>;
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/distributed/Communicator.h"
+#include "storm/storage/distributed/StatePartition.h"
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+/*!
+ * The part of a sparse matrix that is owned by one rank, i.e., the row groups of the states that the partition assigns
+ * to the rank. Columns that refer to states of other ranks (ghost states) are mapped to indices behind the local
+ * states, so a vector for this matrix consists of the values of the local states followed by copies of the values of
+ * the ghost states. These copies are refreshed with synchronizeGhostValues, which sends each rank exactly the values it
+ * needs (halo exchange).
+ */
+template<typename ValueType>
+class DistributedSparseMatrix {
+   public:
+    /*!
+     * Creates the distributed matrix. Has to be called on all ranks.
+     *
+     * @param localRows The row groups of the states owned by this rank (ordered by their local index). The columns refer
+     * to global state indices. For matrices without nondeterminism, the row grouping has to be trivial.
+     * @param partition The partition of the states over the ranks.
+     * @param communicator The communicator connecting the ranks.
+     */
+    DistributedSparseMatrix(storm::storage::SparseMatrix<ValueType> const& localRows, StatePartition const& partition,
+                            std::shared_ptr<Communicator> const& communicator);
+
+    /*!
+     * Extracts the row groups of the states that the given rank owns from the given matrix. The columns still refer to
+     * global state indices. This is meant for matrices that fit into the memory of a single rank; otherwise, the local
+     * rows have to be built by each rank directly.
+     */
+    static storm::storage::SparseMatrix<ValueType> extractLocalRows(storm::storage::SparseMatrix<ValueType> const& matrix, StatePartition const& partition,
+                                                                    uint64_t rank);
+
+    /*!
+     * Overwrites the values of the ghost states in the given vector with the values of their owners. Has to be called
+     * on all ranks.
+     *
+     * @param x A vector with one entry per column of the local matrix.
+     */
+    void synchronizeGhostValues(std::vector<ValueType>& x) const;
+
+    /*!
+     * Multiplies the local matrix with the given vector and, if an optimization direction is given, reduces the values
+     * of each row group to their optimum. No communication is involved, so the ghost values have to be synchronized
+     * before.
+     *
+     * @param x A vector with one entry per column of the local matrix.
+     * @param summand If given, this vector (with one entry per local row) is added to the result.
+     * @param result The vector that receives one value per local state.
+     * @param choices If given, the chosen rows (relative to the first row of their group) are stored in this vector.
+     */
+    void multiplyAndReduce(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType> const& x,
+                           std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
+
+    /*!
+     * Retrieves the local matrix, whose columns are the local states followed by the ghost states.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getLocalMatrix() const;
+
+    uint64_t getNumberOfLocalStates() const;
+    uint64_t getNumberOfGhostStates() const;
+
+    /*!
+     * Retrieves the number of columns of the local matrix, i.e., the size of the vectors it is multiplied with.
+     */
+    uint64_t getNumberOfColumns() const;
+
+    /*!
+     * Retrieves the global indices of the ghost states (in the order in which they appear behind the local states).
+     */
+    std::vector<uint64_t> const& getGhostStates() const;
+
+    StatePartition const& getPartition() const;
+    Communicator& getCommunicator() const;
+
+   private:
+    StatePartition partition;
+    std::shared_ptr<Communicator> communicator;
+
+    storm::storage::SparseMatrix<ValueType> localMatrix;
+    uint64_t numberOfLocalStates;
+    std::vector<uint64_t> ghostStates;
+
+    // For each rank, the local indices of the states whose values it needs.
+    std::vector<std::vector<uint64_t>> sendIndices;
+    // For each rank, the position of its first ghost state among the ghost states (followed by the number of ghost
+    // states). The ghost states of a rank are contiguous and sorted.
+    std::vector<uint64_t> receiveOffsets;
+};
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,70 @@
+#include "storm/storage/distributed/StatePartition.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+StatePartition::StatePartition(uint64_t numberOfStates, uint64_t numberOfRanks, PartitioningMethod method)
+    : numberOfStates(numberOfStates), numberOfRanks(numberOfRanks), method(method) {
+    STORM_LOG_THROW(numberOfRanks > 0, storm::exceptions::InvalidArgumentException, "A partition needs at least one rank.");
+    blockSize = std::max<uint64_t>(1ull, (numberOfStates + numberOfRanks - 1) / numberOfRanks);
+}
+
+uint64_t StatePartition::getOwner(uint64_t state) const {
+    STORM_LOG_ASSERT(state < numberOfStates, "State index " << state << " out of range.");
+    if (method == PartitioningMethod::Block) {
+        return state / blockSize;
+    } else {
+        return state % numberOfRanks;
+    }
+}
+
+uint64_t StatePartition::getLocalIndex(uint64_t state) const {
+    STORM_LOG_ASSERT(state < numberOfStates, "State index " << state << " out of range.");
+    if (method == PartitioningMethod::Block) {
+        return state % blockSize;
+    } else {
+        return state / numberOfRanks;
+    }
+}
+
+uint64_t StatePartition::getGlobalIndex(uint64_t rank, uint64_t localIndex) const {
+    STORM_LOG_ASSERT(rank < numberOfRanks && localIndex < getNumberOfLocalStates(rank),
+                     "Local index " << localIndex << " of rank " << rank << " out of range.");
+    if (method == PartitioningMethod::Block) {
+        return rank * blockSize + localIndex;
+    } else {
+        return localIndex * numberOfRanks + rank;
+    }
+}
+
+uint64_t StatePartition::getNumberOfLocalStates(uint64_t rank) const {
+    STORM_LOG_ASSERT(rank < numberOfRanks, "Rank " << rank << " out of range.");
+    if (method == PartitioningMethod::Block) {
+        uint64_t begin = std::min(rank * blockSize, numberOfStates);
+        return std::min(begin + blockSize, numberOfStates) - begin;
+    } else {
+        return numberOfStates / numberOfRanks + (rank < numberOfStates % numberOfRanks ? 1 : 0);
+    }
+}
+
+uint64_t StatePartition::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+uint64_t StatePartition::getNumberOfRanks() const {
+    return numberOfRanks;
+}
+
+PartitioningMethod StatePartition::getMethod() const {
+    return method;
+}
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
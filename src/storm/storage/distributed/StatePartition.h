@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace storage {
+namespace distributed {
+
+enum class PartitioningMethod {
+    // Every rank owns a contiguous block of states.
+    Block,
+    // The states are distributed round-robin over the ranks.
+    Cyclic
+};
+
+/*!
+ * Assigns the states of a model to ranks. Every state is owned by exactly one rank and is identified on that rank by
+ * its local index. The mapping is computed arithmetically, so no rank needs to store information about all states.
+ */
+class StatePartition {
+   public:
+    StatePartition(uint64_t numberOfStates, uint64_t numberOfRanks, PartitioningMethod method = PartitioningMethod::Block);
+
+    /*!
+     * Retrieves the rank that owns the given (global) state.
+     */
+    uint64_t getOwner(uint64_t state) const;
+
+    /*!
+     * Retrieves the index of the given (global) state among the states of its owner.
+     */
+    uint64_t getLocalIndex(uint64_t state) const;
+
+    /*!
+     * Retrieves the global index of the state with the given local index on the given rank.
+     */
+    uint64_t getGlobalIndex(uint64_t rank, uint64_t localIndex) const;
+
+    /*!
+     * Retrieves the number of states owned by the given rank.
+     */
+    uint64_t getNumberOfLocalStates(uint64_t rank) const;
+
+    uint64_t getNumberOfStates() const;
+    uint64_t getNumberOfRanks() const;
+    PartitioningMethod getMethod() const;
+
+   private:
+    uint64_t numberOfStates;
+    uint64_t numberOfRanks;
+    PartitioningMethod method;
+    // The number of states per rank for block partitions.
+    uint64_t blockSize;
+};
+
+}  // namespace distributed
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,19 @@
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+
+namespace storm {
+namespace expressions {
+
+BytecodeCompiledExpression::BytecodeCompiledExpression(BytecodeProgram const& program) : program(program) {
+    // Intentionally left empty.
+}
+
+BytecodeProgram const& BytecodeCompiledExpression::getProgram() const {
+    return program;
+}
+
+bool BytecodeCompiledExpression::isBytecodeCompiledExpression() const {
+    return true;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "storm/storage/expressions/BytecodeProgram.h"
+#include "storm/storage/expressions/CompiledExpression.h"
+
+namespace storm {
+namespace expressions {
+
+class BytecodeCompiledExpression : public CompiledExpression {
+   public:
+    BytecodeCompiledExpression(BytecodeProgram const& program);
+
+    /*!
+     * Retrieves the program whose (only) output is the value of the expression.
+     */
+    BytecodeProgram const& getProgram() const;
+
+    virtual bool isBytecodeCompiledExpression() const override;
+
+   private:
+    BytecodeProgram program;
+};
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,314 @@
+#include "storm/storage/expressions/BytecodeCompiler.h"
+
+#include <cstring>
+
+#include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+uint64_t BytecodeCompiler::addExpression(Expression const& expression) {
+    program.outputs.push_back(compile(expression.getBaseExpression()));
+    // The register types are cached by the address of the subexpressions, which is only valid while the expression exists.
+    registerTypes.clear();
+    return program.outputs.size() - 1;
+}
+
+BytecodeProgram const& BytecodeCompiler::getProgram() const {
+    return program;
+}
+
+BytecodeCompiler::Output BytecodeCompiler::compile(BaseExpression const& expression) {
+    return boost::any_cast<Output>(expression.accept(*this, boost::none));
+}
+
+BytecodeCompiler::RegisterType BytecodeCompiler::getRegisterType(BaseExpression const& expression) {
+    if (expression.hasBooleanType()) {
+        return RegisterType::Boolean;
+    } else if (expression.hasRationalType()) {
+        return RegisterType::Rational;
+    }
+    STORM_LOG_THROW(expression.hasIntegerType(), storm::exceptions::NotSupportedException,
+                    "Expression '" << expression << "' has a type that is not supported by the bytecode compiler.");
+    if (expression.getArity() == 0) {
+        return RegisterType::Integer;
+    }
+    auto it = registerTypes.find(&expression);
+    if (it != registerTypes.end()) {
+        return it->second;
+    }
+
+    // Integer-typed expressions are computed on rationals if they involve a division or a power.
+    RegisterType result = RegisterType::Integer;
+    switch (expression.getOperator()) {
+        case OperatorType::Divide:
+        case OperatorType::Power:
+            result = RegisterType::Rational;
+            break;
+        case OperatorType::Floor:
+        case OperatorType::Ceil:
+            break;
+        case OperatorType::Ite:
+            if (getRegisterType(*expression.getOperand(1)) == RegisterType::Rational || getRegisterType(*expression.getOperand(2)) == RegisterType::Rational) {
+                result = RegisterType::Rational;
+            }
+            break;
+        default:
+            for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                if (getRegisterType(*expression.getOperand(operandIndex)) == RegisterType::Rational) {
+                    result = RegisterType::Rational;
+                }
+            }
+            break;
+    }
+    registerTypes.emplace(&expression, result);
+    return result;
+}
+
+BytecodeCompiler::Output BytecodeCompiler::emit(Opcode opcode, RegisterType resultType, uint32_t first, uint32_t second, bool commutative) {
+    if (commutative && second < first) {
+        std::swap(first, second);
+    }
+    InstructionKey key(opcode, first, second);
+    auto it = instructionCache.find(key);
+    if (it != instructionCache.end()) {
+        return Output{resultType, it->second};
+    }
+    Output result = allocateRegister(resultType);
+    program.instructions.push_back(BytecodeProgram::Instruction{opcode, result.index, first, second, 0});
+    instructionCache.emplace(key, result.index);
+    instructionLog.push_back(key);
+    return result;
+}
+
+BytecodeCompiler::Output BytecodeCompiler::allocateRegister(RegisterType type) {
+    switch (type) {
+        case RegisterType::Boolean:
+            return Output{type, program.numberOfBooleanRegisters++};
+        case RegisterType::Integer:
+            return Output{type, program.numberOfIntegerRegisters++};
+        case RegisterType::Rational:
+            return Output{type, program.numberOfRationalRegisters++};
+    }
+    STORM_LOG_ASSERT(false, "Unknown register type.");
+    return Output{type, 0};
+}
+
+BytecodeCompiler::Output BytecodeCompiler::getBooleanConstant(bool value) {
+    auto it = booleanConstants.find(value);
+    if (it == booleanConstants.end()) {
+        Output result = allocateRegister(RegisterType::Boolean);
+        program.booleanConstants.emplace_back(result.index, value ? 1 : 0);
+        it = booleanConstants.emplace(value, result.index).first;
+    }
+    return Output{RegisterType::Boolean, it->second};
+}
+
+BytecodeCompiler::Output BytecodeCompiler::getIntegerConstant(int64_t value) {
+    auto it = integerConstants.find(value);
+    if (it == integerConstants.end()) {
+        Output result = allocateRegister(RegisterType::Integer);
+        program.integerConstants.emplace_back(result.index, value);
+        it = integerConstants.emplace(value, result.index).first;
+    }
+    return Output{RegisterType::Integer, it->second};
+}
+
+BytecodeCompiler::Output BytecodeCompiler::getRationalConstant(double value) {
+    // Constants are identified by their bit pattern to distinguish, e.g., 0 and -0.
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    auto it = rationalConstants.find(bits);
+    if (it == rationalConstants.end()) {
+        Output result = allocateRegister(RegisterType::Rational);
+        program.rationalConstants.emplace_back(result.index, value);
+        it = rationalConstants.emplace(bits, result.index).first;
+    }
+    return Output{RegisterType::Rational, it->second};
+}
+
+BytecodeCompiler::Output BytecodeCompiler::convert(Output const& value, RegisterType type) {
+    if (value.type == type) {
+        return value;
+    }
+    STORM_LOG_THROW(value.type != RegisterType::Boolean && type != RegisterType::Boolean, storm::exceptions::InvalidTypeException,
+                    "Unable to convert between boolean and numerical values.");
+    if (type == RegisterType::Rational) {
+        return emit(Opcode::IntegerToRational, type, value.index);
+    } else {
+        return emit(Opcode::RationalToInteger, type, value.index);
+    }
+}
+
+boost::any BytecodeCompiler::visit(IfThenElseExpression const& expression, boost::any const&) {
+    Output condition = compile(*expression.getCondition());
+    RegisterType type = getRegisterType(expression);
+    Opcode select = type == RegisterType::Boolean ? Opcode::SelectBoolean : (type == RegisterType::Integer ? Opcode::SelectInteger : Opcode::SelectRational);
+
+    // The values computed in a branch are only available in this branch, so we forget about them afterwards. The result is
+    // selected after both branches, such that batch evaluations (which ignore jumps) can evaluate both branches.
+    uint64_t const scope = instructionLog.size();
+    auto leaveScope = [&]() {
+        while (instructionLog.size() > scope) {
+            instructionCache.erase(instructionLog.back());
+            instructionLog.pop_back();
+        }
+    };
+
+    uint64_t const jumpToElse = program.instructions.size();
+    program.instructions.push_back(BytecodeProgram::Instruction{Opcode::JumpIfFalse, 0, condition.index, 0, 0});
+    Output thenValue = convert(compile(*expression.getThenExpression()), type);
+    leaveScope();
+    uint64_t const jumpToEnd = program.instructions.size();
+    program.instructions.push_back(BytecodeProgram::Instruction{Opcode::Jump, 0, 0, 0, 0});
+
+    program.instructions[jumpToElse].target = program.instructions.size();
+    Output elseValue = convert(compile(*expression.getElseExpression()), type);
+    leaveScope();
+    program.instructions[jumpToEnd].target = program.instructions.size();
+
+    // The register of the value of the branch that was not taken is never read by the (scalar) selection.
+    Output result = allocateRegister(type);
+    program.instructions.push_back(BytecodeProgram::Instruction{select, result.index, thenValue.index, elseValue.index, condition.index});
+    return result;
+}
+
+boost::any BytecodeCompiler::visit(BinaryBooleanFunctionExpression const& expression, boost::any const&) {
+    Output first = compile(*expression.getFirstOperand());
+    Output second = compile(*expression.getSecondOperand());
+    switch (expression.getOperatorType()) {
+        case BinaryBooleanFunctionExpression::OperatorType::And:
+            return emit(Opcode::And, RegisterType::Boolean, first.index, second.index, true);
+        case BinaryBooleanFunctionExpression::OperatorType::Or:
+            return emit(Opcode::Or, RegisterType::Boolean, first.index, second.index, true);
+        case BinaryBooleanFunctionExpression::OperatorType::Xor:
+            return emit(Opcode::Xor, RegisterType::Boolean, first.index, second.index, true);
+        case BinaryBooleanFunctionExpression::OperatorType::Implies:
+            return emit(Opcode::Implies, RegisterType::Boolean, first.index, second.index);
+        case BinaryBooleanFunctionExpression::OperatorType::Iff:
+            return emit(Opcode::Iff, RegisterType::Boolean, first.index, second.index, true);
+    }
+    STORM_LOG_ASSERT(false, "Unknown boolean operator.");
+    return boost::any();
+}
+
+boost::any BytecodeCompiler::visit(BinaryNumericalFunctionExpression const& expression, boost::any const&) {
+    RegisterType type = getRegisterType(expression);
+    Output first = convert(compile(*expression.getFirstOperand()), type);
+    Output second = convert(compile(*expression.getSecondOperand()), type);
+    bool const isInteger = type == RegisterType::Integer;
+    switch (expression.getOperatorType()) {
+        case BinaryNumericalFunctionExpression::OperatorType::Plus:
+            return emit(isInteger ? Opcode::IntegerPlus : Opcode::RationalPlus, type, first.index, second.index, true);
+        case BinaryNumericalFunctionExpression::OperatorType::Minus:
+            return emit(isInteger ? Opcode::IntegerSubtract : Opcode::RationalSubtract, type, first.index, second.index);
+        case BinaryNumericalFunctionExpression::OperatorType::Times:
+            return emit(isInteger ? Opcode::IntegerTimes : Opcode::RationalTimes, type, first.index, second.index, true);
+        case BinaryNumericalFunctionExpression::OperatorType::Divide:
+            return emit(Opcode::RationalDivide, type, first.index, second.index);
+        case BinaryNumericalFunctionExpression::OperatorType::Min:
+            return emit(isInteger ? Opcode::IntegerMin : Opcode::RationalMin, type, first.index, second.index, true);
+        case BinaryNumericalFunctionExpression::OperatorType::Max:
+            return emit(isInteger ? Opcode::IntegerMax : Opcode::RationalMax, type, first.index, second.index, true);
+        case BinaryNumericalFunctionExpression::OperatorType::Power:
+            return emit(Opcode::RationalPower, type, first.index, second.index);
+        case BinaryNumericalFunctionExpression::OperatorType::Modulo:
+            return emit(isInteger ? Opcode::IntegerModulo : Opcode::RationalModulo, type, first.index, second.index);
+    }
+    STORM_LOG_ASSERT(false, "Unknown numerical operator.");
+    return boost::any();
+}
+
+boost::any BytecodeCompiler::visit(BinaryRelationExpression const& expression, boost::any const&) {
+    Output first = compile(*expression.getFirstOperand());
+    Output second = compile(*expression.getSecondOperand());
+    RegisterType type = first.type == RegisterType::Integer && second.type == RegisterType::Integer ? RegisterType::Integer : RegisterType::Rational;
+    first = convert(first, type);
+    second = convert(second, type);
+    bool const isInteger = type == RegisterType::Integer;
+    switch (expression.getRelationType()) {
+        case BinaryRelationExpression::RelationType::Equal:
+            return emit(isInteger ? Opcode::IntegerEqual : Opcode::RationalEqual, RegisterType::Boolean, first.index, second.index, true);
+        case BinaryRelationExpression::RelationType::NotEqual:
+            return emit(isInteger ? Opcode::IntegerNotEqual : Opcode::RationalNotEqual, RegisterType::Boolean, first.index, second.index, true);
+        case BinaryRelationExpression::RelationType::Less:
+            return emit(isInteger ? Opcode::IntegerLess : Opcode::RationalLess, RegisterType::Boolean, first.index, second.index);
+        case BinaryRelationExpression::RelationType::LessOrEqual:
+            return emit(isInteger ? Opcode::IntegerLessOrEqual : Opcode::RationalLessOrEqual, RegisterType::Boolean, first.index, second.index);
+        case BinaryRelationExpression::RelationType::Greater:
+            return emit(isInteger ? Opcode::IntegerLess : Opcode::RationalLess, RegisterType::Boolean, second.index, first.index);
+        case BinaryRelationExpression::RelationType::GreaterOrEqual:
+            return emit(isInteger ? Opcode::IntegerLessOrEqual : Opcode::RationalLessOrEqual, RegisterType::Boolean, second.index, first.index);
+    }
+    STORM_LOG_ASSERT(false, "Unknown relation.");
+    return boost::any();
+}
+
+boost::any BytecodeCompiler::visit(VariableExpression const& expression, boost::any const&) {
+    Variable const& variable = expression.getVariable();
+    if (variable.hasBooleanType()) {
+        return emit(Opcode::LoadBooleanVariable, RegisterType::Boolean, variable.getOffset());
+    } else if (variable.hasIntegerType()) {
+        return emit(Opcode::LoadIntegerVariable, RegisterType::Integer, variable.getOffset());
+    } else if (variable.hasRationalType()) {
+        return emit(Opcode::LoadRationalVariable, RegisterType::Rational, variable.getOffset());
+    }
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                    "Variable '" << variable.getName() << "' has a type that is not supported by the bytecode compiler.");
+}
+
+boost::any BytecodeCompiler::visit(UnaryBooleanFunctionExpression const& expression, boost::any const&) {
+    Output operand = compile(*expression.getOperand());
+    return emit(Opcode::Not, RegisterType::Boolean, operand.index);
+}
+
+boost::any BytecodeCompiler::visit(UnaryNumericalFunctionExpression const& expression, boost::any const&) {
+    Output operand = compile(*expression.getOperand());
+    switch (expression.getOperatorType()) {
+        case UnaryNumericalFunctionExpression::OperatorType::Minus:
+            return emit(operand.type == RegisterType::Integer ? Opcode::IntegerMinus : Opcode::RationalMinus, operand.type, operand.index);
+        case UnaryNumericalFunctionExpression::OperatorType::Floor:
+            return operand.type == RegisterType::Integer ? operand : emit(Opcode::Floor, RegisterType::Integer, operand.index);
+        case UnaryNumericalFunctionExpression::OperatorType::Ceil:
+            return operand.type == RegisterType::Integer ? operand : emit(Opcode::Ceil, RegisterType::Integer, operand.index);
+    }
+    STORM_LOG_ASSERT(false, "Unknown numerical operator.");
+    return boost::any();
+}
+
+boost::any BytecodeCompiler::visit(BooleanLiteralExpression const& expression, boost::any const&) {
+    return getBooleanConstant(expression.getValue());
+}
+
+boost::any BytecodeCompiler::visit(IntegerLiteralExpression const& expression, boost::any const&) {
+    return getIntegerConstant(expression.getValue());
+}
+
+boost::any BytecodeCompiler::visit(RationalLiteralExpression const& expression, boost::any const&) {
+    return getRationalConstant(expression.getValueAsDouble());
+}
+
+boost::any BytecodeCompiler::visit(PredicateExpression const& expression, boost::any const&) {
+    if (expression.getPredicateType() == PredicateExpression::PredicateType::AtLeastOneOf) {
+        Output result = getBooleanConstant(false);
+        for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+            result = emit(Opcode::Or, RegisterType::Boolean, result.index, compile(*expression.getOperand(operandIndex)).index, true);
+        }
+        return result;
+    }
+
+    // Count the operands that are true.
+    Output count = getIntegerConstant(0);
+    for (uint64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+        Output operand = emit(Opcode::BooleanToInteger, RegisterType::Integer, compile(*expression.getOperand(operandIndex)).index);
+        count = emit(Opcode::IntegerPlus, RegisterType::Integer, count.index, operand.index, true);
+    }
+    Opcode comparison = expression.getPredicateType() == PredicateExpression::PredicateType::AtMostOneOf ? Opcode::IntegerLessOrEqual : Opcode::IntegerEqual;
+    return emit(comparison, RegisterType::Boolean, count.index, getIntegerConstant(1).index);
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/expressions/BytecodeProgram.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * Compiles expressions into a program for the register-based virtual machine of BytecodeProgram.
+ *
+ * Several expressions can be compiled into the same program. Subexpressions that occur multiple times (also in different
+ * expressions, e.g. the same comparison in the guards of several commands) are computed only once. The branches of
+ * if-then-else expressions are only executed if they are taken (except in batch evaluations) and their result is
+ * selected afterwards; all other operations are evaluated eagerly, which is safe as no instruction can fail.
+ *
+ * Integer-typed expressions are computed on integers, except for divisions and powers which (as in PRISM and as in the
+ * tree-based evaluation of doubles) are computed on rationals.
+ */
+class BytecodeCompiler : public ExpressionVisitor {
+   public:
+    BytecodeCompiler() = default;
+
+    /*!
+     * Compiles the given expression into the program.
+     *
+     * @return The index of the output of the program that holds the value of the expression.
+     */
+    uint64_t addExpression(Expression const& expression);
+
+    /*!
+     * Retrieves the program compiled so far.
+     */
+    BytecodeProgram const& getProgram() const;
+
+    virtual boost::any visit(IfThenElseExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BinaryRelationExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(VariableExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(BooleanLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(IntegerLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(RationalLiteralExpression const& expression, boost::any const& data) override;
+    virtual boost::any visit(PredicateExpression const& expression, boost::any const& data) override;
+
+   private:
+    typedef BytecodeProgram::Opcode Opcode;
+    typedef BytecodeProgram::Output Output;
+    typedef BytecodeProgram::RegisterType RegisterType;
+    typedef std::tuple<Opcode, uint32_t, uint32_t> InstructionKey;
+
+    // Compiles the given expression and retrieves the register holding its value.
+    Output compile(BaseExpression const& expression);
+
+    // Retrieves the register type in which the value of the given expression is computed.
+    RegisterType getRegisterType(BaseExpression const& expression);
+
+    // Emits the given instruction (unless it was already emitted in the current scope) and retrieves its target register.
+    Output emit(Opcode opcode, RegisterType resultType, uint32_t first, uint32_t second = 0, bool commutative = false);
+
+    Output allocateRegister(RegisterType type);
+    Output getBooleanConstant(bool value);
+    Output getIntegerConstant(int64_t value);
+    Output getRationalConstant(double value);
+
+    // Converts the value of the given register to the given type.
+    Output convert(Output const& value, RegisterType type);
+
+    BytecodeProgram program;
+
+    // The instructions that were emitted so far (and whose target registers are valid in the current scope), and, in
+    // order of their emission, the keys of these instructions such that the ones emitted in a branch can be forgotten.
+    std::map<InstructionKey, uint32_t> instructionCache;
+    std::vector<InstructionKey> instructionLog;
+
+    std::map<bool, uint32_t> booleanConstants;
+    std::map<int64_t, uint32_t> integerConstants;
+    std::map<uint64_t, uint32_t> rationalConstants;
+
+    std::unordered_map<BaseExpression const*, RegisterType> registerTypes;
+};
+
+}  // namespace expressions
+}  // namespace storm
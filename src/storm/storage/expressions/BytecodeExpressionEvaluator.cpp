@@ -0,0 +1,71 @@
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/expressions/BytecodeCompiledExpression.h"
+#include "storm/storage/expressions/BytecodeCompiler.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace storm {
+namespace expressions {
+template<typename RationalType>
+BytecodeExpressionEvaluatorBase<RationalType>::BytecodeExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager)
+    : ExpressionEvaluatorBase<RationalType>(manager) {
+    registers.booleanVariables.resize(manager.getNumberOfBooleanVariables());
+    registers.integerVariables.resize(manager.getNumberOfIntegerVariables());
+    registers.rationalVariables.resize(manager.getNumberOfRationalVariables());
+}
+
+template<typename RationalType>
+bool BytecodeExpressionEvaluatorBase<RationalType>::asBool(Expression const& expression) const {
+    return evaluate(expression).getBooleanValue(registers, 0);
+}
+
+template<typename RationalType>
+int_fast64_t BytecodeExpressionEvaluatorBase<RationalType>::asInt(Expression const& expression) const {
+    return evaluate(expression).getIntegerValue(registers, 0);
+}
+
+template<typename RationalType>
+BytecodeProgram const& BytecodeExpressionEvaluatorBase<RationalType>::evaluate(Expression const& expression) const {
+    if (!expression.hasCompiledExpression() || !expression.getCompiledExpression().isBytecodeCompiledExpression()) {
+        BytecodeCompiler compiler;
+        compiler.addExpression(expression);
+        expression.setCompiledExpression(std::make_shared<BytecodeCompiledExpression>(compiler.getProgram()));
+    }
+    BytecodeProgram const& program = expression.getCompiledExpression().asBytecodeCompiledExpression().getProgram();
+    program.evaluate(registers);
+    return program;
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
+    registers.booleanVariables[variable.getOffset()] = value ? 1 : 0;
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
+    registers.integerVariables[variable.getOffset()] = value;
+}
+
+template<typename RationalType>
+void BytecodeExpressionEvaluatorBase<RationalType>::setRationalValue(storm::expressions::Variable const& variable, double value) {
+    registers.rationalVariables[variable.getOffset()] = value;
+}
+
+BytecodeExpressionEvaluator::BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
+    : BytecodeExpressionEvaluatorBase<double>(manager) {
+    // Intentionally left empty.
+}
+
+double BytecodeExpressionEvaluator::asRational(Expression const& expression) const {
+    return evaluate(expression).getRationalValue(registers, 0);
+}
+
+template class BytecodeExpressionEvaluatorBase<double>;
+
+#ifdef STORM_HAVE_CARL
+template class BytecodeExpressionEvaluatorBase<RationalNumber>;
+template class BytecodeExpressionEvaluatorBase<RationalFunction>;
+#endif
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "storm/storage/expressions/BytecodeProgram.h"
+#include "storm/storage/expressions/ExpressionEvaluatorBase.h"
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * An evaluator that compiles expressions to programs for the register-based virtual machine of BytecodeProgram. The
+ * values of the variables are directly stored in the (typed) variable registers of the machine. The compiled program
+ * is attached to the expression, so every expression is only compiled once.
+ */
+template<typename RationalType>
+class BytecodeExpressionEvaluatorBase : public ExpressionEvaluatorBase<RationalType> {
+   public:
+    BytecodeExpressionEvaluatorBase(storm::expressions::ExpressionManager const& manager);
+
+    bool asBool(Expression const& expression) const override;
+    int_fast64_t asInt(Expression const& expression) const override;
+
+    void setBooleanValue(storm::expressions::Variable const& variable, bool value) override;
+    void setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) override;
+    void setRationalValue(storm::expressions::Variable const& variable, double value) override;
+
+   protected:
+    /*!
+     * Evaluates the given expression, compiling it first if necessary, and retrieves the program that computed its value.
+     */
+    BytecodeProgram const& evaluate(Expression const& expression) const;
+
+    // The registers of the virtual machine, including the values of the variables.
+    mutable BytecodeRegisters registers;
+};
+
+class BytecodeExpressionEvaluator : public BytecodeExpressionEvaluatorBase<double> {
+   public:
+    /*!
+     * Creates an expression evaluator that is capable of evaluating expressions managed by the given manager.
+     *
+     * @param manager The manager responsible for the expressions.
+     */
+    BytecodeExpressionEvaluator(storm::expressions::ExpressionManager const& manager);
+
+    double asRational(Expression const& expression) const override;
+};
+
+}  // namespace expressions
+}  // namespace storm
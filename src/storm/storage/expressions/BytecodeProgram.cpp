@@ -0,0 +1,389 @@
+#include "storm/storage/expressions/BytecodeProgram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidTypeException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace expressions {
+
+namespace {
+// Integer arithmetic wraps around on overflow instead of being undefined.
+int64_t wrap(uint64_t value) {
+    return static_cast<int64_t>(value);
+}
+}  // namespace
+
+void BytecodeProgram::evaluate(BytecodeRegisters& registers) const {
+    if (registers.booleanRegisters.size() < numberOfBooleanRegisters) {
+        registers.booleanRegisters.resize(numberOfBooleanRegisters);
+    }
+    if (registers.integerRegisters.size() < numberOfIntegerRegisters) {
+        registers.integerRegisters.resize(numberOfIntegerRegisters);
+    }
+    if (registers.rationalRegisters.size() < numberOfRationalRegisters) {
+        registers.rationalRegisters.resize(numberOfRationalRegisters);
+    }
+
+    uint8_t* b = registers.booleanRegisters.data();
+    int64_t* i = registers.integerRegisters.data();
+    double* r = registers.rationalRegisters.data();
+    for (auto const& constant : booleanConstants) {
+        b[constant.first] = constant.second;
+    }
+    for (auto const& constant : integerConstants) {
+        i[constant.first] = constant.second;
+    }
+    for (auto const& constant : rationalConstants) {
+        r[constant.first] = constant.second;
+    }
+
+    Instruction const* program = instructions.data();
+    uint64_t const numberOfInstructions = instructions.size();
+    uint64_t pc = 0;
+    while (pc < numberOfInstructions) {
+        Instruction const& instruction = program[pc];
+        uint32_t const t = instruction.target;
+        uint32_t const x = instruction.first;
+        uint32_t const y = instruction.second;
+        ++pc;
+        switch (instruction.opcode) {
+            case Opcode::LoadBooleanVariable:
+                b[t] = registers.booleanVariables[x];
+                break;
+            case Opcode::LoadIntegerVariable:
+                i[t] = registers.integerVariables[x];
+                break;
+            case Opcode::LoadRationalVariable:
+                r[t] = registers.rationalVariables[x];
+                break;
+            case Opcode::IntegerToRational:
+                r[t] = static_cast<double>(i[x]);
+                break;
+            case Opcode::RationalToInteger:
+                i[t] = static_cast<int64_t>(r[x]);
+                break;
+            case Opcode::BooleanToInteger:
+                i[t] = b[x];
+                break;
+            case Opcode::Floor:
+                i[t] = static_cast<int64_t>(std::floor(r[x]));
+                break;
+            case Opcode::Ceil:
+                i[t] = static_cast<int64_t>(std::ceil(r[x]));
+                break;
+            case Opcode::Not:
+                b[t] = !b[x];
+                break;
+            case Opcode::And:
+                b[t] = b[x] & b[y];
+                break;
+            case Opcode::Or:
+                b[t] = b[x] | b[y];
+                break;
+            case Opcode::Xor:
+                b[t] = b[x] ^ b[y];
+                break;
+            case Opcode::Implies:
+                b[t] = !b[x] || b[y];
+                break;
+            case Opcode::Iff:
+                b[t] = b[x] == b[y];
+                break;
+            case Opcode::IntegerMinus:
+                i[t] = wrap(0ull - static_cast<uint64_t>(i[x]));
+                break;
+            case Opcode::IntegerPlus:
+                i[t] = wrap(static_cast<uint64_t>(i[x]) + static_cast<uint64_t>(i[y]));
+                break;
+            case Opcode::IntegerSubtract:
+                i[t] = wrap(static_cast<uint64_t>(i[x]) - static_cast<uint64_t>(i[y]));
+                break;
+            case Opcode::IntegerTimes:
+                i[t] = wrap(static_cast<uint64_t>(i[x]) * static_cast<uint64_t>(i[y]));
+                break;
+            case Opcode::IntegerModulo:
+                i[t] = i[y] == 0 ? 0 : i[x] % i[y];
+                break;
+            case Opcode::IntegerMin:
+                i[t] = std::min(i[x], i[y]);
+                break;
+            case Opcode::IntegerMax:
+                i[t] = std::max(i[x], i[y]);
+                break;
+            case Opcode::IntegerEqual:
+                b[t] = i[x] == i[y];
+                break;
+            case Opcode::IntegerNotEqual:
+                b[t] = i[x] != i[y];
+                break;
+            case Opcode::IntegerLess:
+                b[t] = i[x] < i[y];
+                break;
+            case Opcode::IntegerLessOrEqual:
+                b[t] = i[x] <= i[y];
+                break;
+            case Opcode::RationalMinus:
+                r[t] = -r[x];
+                break;
+            case Opcode::RationalPlus:
+                r[t] = r[x] + r[y];
+                break;
+            case Opcode::RationalSubtract:
+                r[t] = r[x] - r[y];
+                break;
+            case Opcode::RationalTimes:
+                r[t] = r[x] * r[y];
+                break;
+            case Opcode::RationalDivide:
+                r[t] = r[x] / r[y];
+                break;
+            case Opcode::RationalModulo:
+                r[t] = std::fmod(r[x], r[y]);
+                break;
+            case Opcode::RationalPower:
+                r[t] = std::pow(r[x], r[y]);
+                break;
+            case Opcode::RationalMin:
+                r[t] = std::min(r[x], r[y]);
+                break;
+            case Opcode::RationalMax:
+                r[t] = std::max(r[x], r[y]);
+                break;
+            case Opcode::RationalEqual:
+                b[t] = r[x] == r[y];
+                break;
+            case Opcode::RationalNotEqual:
+                b[t] = r[x] != r[y];
+                break;
+            case Opcode::RationalLess:
+                b[t] = r[x] < r[y];
+                break;
+            case Opcode::RationalLessOrEqual:
+                b[t] = r[x] <= r[y];
+                break;
+            case Opcode::SelectBoolean:
+                b[t] = b[instruction.third] ? b[x] : b[y];
+                break;
+            case Opcode::SelectInteger:
+                i[t] = b[instruction.third] ? i[x] : i[y];
+                break;
+            case Opcode::SelectRational:
+                r[t] = b[instruction.third] ? r[x] : r[y];
+                break;
+            case Opcode::Jump:
+                pc = t;
+                break;
+            case Opcode::JumpIfFalse:
+                if (!b[x]) {
+                    pc = t;
+                }
+                break;
+        }
+    }
+}
+
+// Applies the given operation to all lanes of the given registers. The loops are simple enough to be vectorized.
+#define STORM_BYTECODE_LANES(operation)                     \
+    for (uint64_t lane = 0; lane < numberOfLanes; ++lane) { \
+        operation;                                          \
+    }                                                       \
+    break;
+
+void BytecodeProgram::evaluateBatch(BytecodeBatchRegisters& registers) const {
+    uint64_t const numberOfLanes = registers.numberOfLanes;
+    if (registers.booleanRegisters.size() < numberOfBooleanRegisters * numberOfLanes) {
+        registers.booleanRegisters.resize(numberOfBooleanRegisters * numberOfLanes);
+    }
+    if (registers.integerRegisters.size() < numberOfIntegerRegisters * numberOfLanes) {
+        registers.integerRegisters.resize(numberOfIntegerRegisters * numberOfLanes);
+    }
+    if (registers.rationalRegisters.size() < numberOfRationalRegisters * numberOfLanes) {
+        registers.rationalRegisters.resize(numberOfRationalRegisters * numberOfLanes);
+    }
+
+    uint8_t* const b = registers.booleanRegisters.data();
+    int64_t* const i = registers.integerRegisters.data();
+    double* const r = registers.rationalRegisters.data();
+    for (auto const& constant : booleanConstants) {
+        std::fill_n(b + constant.first * numberOfLanes, numberOfLanes, constant.second);
+    }
+    for (auto const& constant : integerConstants) {
+        std::fill_n(i + constant.first * numberOfLanes, numberOfLanes, constant.second);
+    }
+    for (auto const& constant : rationalConstants) {
+        std::fill_n(r + constant.first * numberOfLanes, numberOfLanes, constant.second);
+    }
+
+    for (Instruction const& instruction : instructions) {
+        uint64_t const t = instruction.target * numberOfLanes;
+        uint64_t const x = instruction.first * numberOfLanes;
+        uint64_t const y = instruction.second * numberOfLanes;
+        uint64_t const z = instruction.third * numberOfLanes;
+        switch (instruction.opcode) {
+            case Opcode::LoadBooleanVariable:
+                std::copy_n(registers.booleanVariables.data() + x, numberOfLanes, b + t);
+                break;
+            case Opcode::LoadIntegerVariable:
+                std::copy_n(registers.integerVariables.data() + x, numberOfLanes, i + t);
+                break;
+            case Opcode::LoadRationalVariable:
+                std::copy_n(registers.rationalVariables.data() + x, numberOfLanes, r + t);
+                break;
+            case Opcode::IntegerToRational:
+                STORM_BYTECODE_LANES(r[t + lane] = static_cast<double>(i[x + lane]))
+            case Opcode::RationalToInteger:
+                STORM_BYTECODE_LANES(i[t + lane] = static_cast<int64_t>(r[x + lane]))
+            case Opcode::BooleanToInteger:
+                STORM_BYTECODE_LANES(i[t + lane] = b[x + lane])
+            case Opcode::Floor:
+                STORM_BYTECODE_LANES(i[t + lane] = static_cast<int64_t>(std::floor(r[x + lane])))
+            case Opcode::Ceil:
+                STORM_BYTECODE_LANES(i[t + lane] = static_cast<int64_t>(std::ceil(r[x + lane])))
+            case Opcode::Not:
+                STORM_BYTECODE_LANES(b[t + lane] = b[x + lane] ^ 1)
+            case Opcode::And:
+                STORM_BYTECODE_LANES(b[t + lane] = b[x + lane] & b[y + lane])
+            case Opcode::Or:
+                STORM_BYTECODE_LANES(b[t + lane] = b[x + lane] | b[y + lane])
+            case Opcode::Xor:
+                STORM_BYTECODE_LANES(b[t + lane] = b[x + lane] ^ b[y + lane])
+            case Opcode::Implies:
+                STORM_BYTECODE_LANES(b[t + lane] = (b[x + lane] ^ 1) | b[y + lane])
+            case Opcode::Iff:
+                STORM_BYTECODE_LANES(b[t + lane] = b[x + lane] == b[y + lane])
+            case Opcode::IntegerMinus:
+                STORM_BYTECODE_LANES(i[t + lane] = wrap(0ull - static_cast<uint64_t>(i[x + lane])))
+            case Opcode::IntegerPlus:
+                STORM_BYTECODE_LANES(i[t + lane] = wrap(static_cast<uint64_t>(i[x + lane]) + static_cast<uint64_t>(i[y + lane])))
+            case Opcode::IntegerSubtract:
+                STORM_BYTECODE_LANES(i[t + lane] = wrap(static_cast<uint64_t>(i[x + lane]) - static_cast<uint64_t>(i[y + lane])))
+            case Opcode::IntegerTimes:
+                STORM_BYTECODE_LANES(i[t + lane] = wrap(static_cast<uint64_t>(i[x + lane]) * static_cast<uint64_t>(i[y + lane])))
+            case Opcode::IntegerModulo:
+                STORM_BYTECODE_LANES(i[t + lane] = i[y + lane] == 0 ? 0 : i[x + lane] % i[y + lane])
+            case Opcode::IntegerMin:
+                STORM_BYTECODE_LANES(i[t + lane] = std::min(i[x + lane], i[y + lane]))
+            case Opcode::IntegerMax:
+                STORM_BYTECODE_LANES(i[t + lane] = std::max(i[x + lane], i[y + lane]))
+            case Opcode::IntegerEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = i[x + lane] == i[y + lane])
+            case Opcode::IntegerNotEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = i[x + lane] != i[y + lane])
+            case Opcode::IntegerLess:
+                STORM_BYTECODE_LANES(b[t + lane] = i[x + lane] < i[y + lane])
+            case Opcode::IntegerLessOrEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = i[x + lane] <= i[y + lane])
+            case Opcode::RationalMinus:
+                STORM_BYTECODE_LANES(r[t + lane] = -r[x + lane])
+            case Opcode::RationalPlus:
+                STORM_BYTECODE_LANES(r[t + lane] = r[x + lane] + r[y + lane])
+            case Opcode::RationalSubtract:
+                STORM_BYTECODE_LANES(r[t + lane] = r[x + lane] - r[y + lane])
+            case Opcode::RationalTimes:
+                STORM_BYTECODE_LANES(r[t + lane] = r[x + lane] * r[y + lane])
+            case Opcode::RationalDivide:
+                STORM_BYTECODE_LANES(r[t + lane] = r[x + lane] / r[y + lane])
+            case Opcode::RationalModulo:
+                STORM_BYTECODE_LANES(r[t + lane] = std::fmod(r[x + lane], r[y + lane]))
+            case Opcode::RationalPower:
+                STORM_BYTECODE_LANES(r[t + lane] = std::pow(r[x + lane], r[y + lane]))
+            case Opcode::RationalMin:
+                STORM_BYTECODE_LANES(r[t + lane] = std::min(r[x + lane], r[y + lane]))
+            case Opcode::RationalMax:
+                STORM_BYTECODE_LANES(r[t + lane] = std::max(r[x + lane], r[y + lane]))
+            case Opcode::RationalEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = r[x + lane] == r[y + lane])
+            case Opcode::RationalNotEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = r[x + lane] != r[y + lane])
+            case Opcode::RationalLess:
+                STORM_BYTECODE_LANES(b[t + lane] = r[x + lane] < r[y + lane])
+            case Opcode::RationalLessOrEqual:
+                STORM_BYTECODE_LANES(b[t + lane] = r[x + lane] <= r[y + lane])
+            case Opcode::SelectBoolean:
+                STORM_BYTECODE_LANES(b[t + lane] = b[z + lane] ? b[x + lane] : b[y + lane])
+            case Opcode::SelectInteger:
+                STORM_BYTECODE_LANES(i[t + lane] = b[z + lane] ? i[x + lane] : i[y + lane])
+            case Opcode::SelectRational:
+                STORM_BYTECODE_LANES(r[t + lane] = b[z + lane] ? r[x + lane] : r[y + lane])
+            case Opcode::Jump:
+            case Opcode::JumpIfFalse:
+                // All branches are evaluated for all lanes.
+                break;
+        }
+    }
+}
+
+#undef STORM_BYTECODE_LANES
+
+bool BytecodeProgram::getBooleanValue(BytecodeBatchRegisters const& registers, uint64_t output, uint64_t lane) const {
+    Output const& result = outputs[output];
+    STORM_LOG_THROW(result.type == RegisterType::Boolean, storm::exceptions::InvalidTypeException, "Unable to evaluate non-boolean expression as boolean.");
+    return registers.booleanRegisters[result.index * registers.numberOfLanes + lane];
+}
+
+bool BytecodeProgram::getBooleanValue(BytecodeRegisters const& registers, uint64_t output) const {
+    Output const& result = outputs[output];
+    STORM_LOG_THROW(result.type == RegisterType::Boolean, storm::exceptions::InvalidTypeException, "Unable to evaluate non-boolean expression as boolean.");
+    return registers.booleanRegisters[result.index];
+}
+
+int64_t BytecodeProgram::getIntegerValue(BytecodeRegisters const& registers, uint64_t output) const {
+    Output const& result = outputs[output];
+    if (result.type == RegisterType::Boolean) {
+        return registers.booleanRegisters[result.index];
+    } else if (result.type == RegisterType::Integer) {
+        return registers.integerRegisters[result.index];
+    }
+    return static_cast<int64_t>(registers.rationalRegisters[result.index]);
+}
+
+double BytecodeProgram::getRationalValue(BytecodeRegisters const& registers, uint64_t output) const {
+    Output const& result = outputs[output];
+    if (result.type == RegisterType::Boolean) {
+        return registers.booleanRegisters[result.index];
+    } else if (result.type == RegisterType::Integer) {
+        return static_cast<double>(registers.integerRegisters[result.index]);
+    }
+    return registers.rationalRegisters[result.index];
+}
+
+BytecodeProgram::Output const& BytecodeProgram::getOutput(uint64_t output) const {
+    return outputs[output];
+}
+
+uint64_t BytecodeProgram::getNumberOfOutputs() const {
+    return outputs.size();
+}
+
+uint64_t BytecodeProgram::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+std::ostream& operator<<(std::ostream& out, BytecodeProgram const& program) {
+    for (auto const& constant : program.booleanConstants) {
+        out << "b" << constant.first << " := " << (constant.second ? "true" : "false") << '\n';
+    }
+    for (auto const& constant : program.integerConstants) {
+        out << "i" << constant.first << " := " << constant.second << '\n';
+    }
+    for (auto const& constant : program.rationalConstants) {
+        out << "r" << constant.first << " := " << constant.second << '\n';
+    }
+    for (uint64_t index = 0; index < program.instructions.size(); ++index) {
+        auto const& instruction = program.instructions[index];
+        out << index << ": " << static_cast<uint64_t>(instruction.opcode) << " " << instruction.target << " " << instruction.first << " "
+            << instruction.second << " " << instruction.third << '\n';
+    }
+    for (uint64_t index = 0; index < program.outputs.size(); ++index) {
+        auto const& output = program.outputs[index];
+        char const prefix = output.type == BytecodeProgram::RegisterType::Boolean ? 'b' : (output.type == BytecodeProgram::RegisterType::Integer ? 'i' : 'r');
+        out << "output " << index << ": " << prefix << output.index << '\n';
+    }
+    return out;
+}
+
+}  // namespace expressions
+}  // namespace storm
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace expressions {
+
+/*!
+ * The registers on which bytecode programs operate. There is one register file per type. The variable registers hold the
+ * values of the variables (indexed by the offset of the variable), while the remaining registers hold the intermediate
+ * results of a program. Boolean values are stored as 0 and 1.
+ */
+struct BytecodeRegisters {
+    std::vector<uint8_t> booleanVariables;
+    std::vector<int64_t> integerVariables;
+    std::vector<double> rationalVariables;
+
+    std::vector<uint8_t> booleanRegisters;
+    std::vector<int64_t> integerRegisters;
+    std::vector<double> rationalRegisters;
+};
+
+/*!
+ * The registers for evaluating a program for several valuations (lanes) at once. Each register holds one value per lane
+ * and the values of a register are stored contiguously, i.e. the value of register (or variable) i in lane l is stored
+ * at position i * numberOfLanes + l.
+ */
+struct BytecodeBatchRegisters {
+    uint64_t numberOfLanes = 0;
+
+    std::vector<uint8_t> booleanVariables;
+    std::vector<int64_t> integerVariables;
+    std::vector<double> rationalVariables;
+
+    std::vector<uint8_t> booleanRegisters;
+    std::vector<int64_t> integerRegisters;
+    std::vector<double> rationalRegisters;
+};
+
+/*!
+ * A program for a register-based virtual machine that computes the values of one or more expressions. The instructions
+ * are typed, i.e. integer operations are carried out on integers (instead of doubles as in ExprTk) and each instruction
+ * reads and writes registers of a fixed register file. Programs are created by the BytecodeCompiler.
+ */
+class BytecodeProgram {
+   public:
+    enum class RegisterType : uint8_t { Boolean, Integer, Rational };
+
+    enum class Opcode : uint8_t {
+        // Loading of variables: target = variable register.
+        LoadBooleanVariable,
+        LoadIntegerVariable,
+        LoadRationalVariable,
+
+        // Conversions: target = op(first).
+        IntegerToRational,
+        RationalToInteger,
+        BooleanToInteger,
+        Floor,
+        Ceil,
+
+        // Boolean operations.
+        Not,
+        And,
+        Or,
+        Xor,
+        Implies,
+        Iff,
+
+        // Integer operations. Modulo by zero yields zero. There is no integer division as the division of integers is
+        // carried out on rationals (as in PRISM).
+        IntegerMinus,
+        IntegerPlus,
+        IntegerSubtract,
+        IntegerTimes,
+        IntegerModulo,
+        IntegerMin,
+        IntegerMax,
+        IntegerEqual,
+        IntegerNotEqual,
+        IntegerLess,
+        IntegerLessOrEqual,
+
+        // Rational operations.
+        RationalMinus,
+        RationalPlus,
+        RationalSubtract,
+        RationalTimes,
+        RationalDivide,
+        RationalModulo,
+        RationalPower,
+        RationalMin,
+        RationalMax,
+        RationalEqual,
+        RationalNotEqual,
+        RationalLess,
+        RationalLessOrEqual,
+
+        // Selections: target = third ? first : second, where third is a boolean register.
+        SelectBoolean,
+        SelectInteger,
+        SelectRational,
+
+        // Control flow: continues at instruction target (if the boolean register first is false).
+        Jump,
+        JumpIfFalse
+    };
+
+    struct Instruction {
+        Opcode opcode;
+        uint32_t target;
+        uint32_t first;
+        uint32_t second;
+        uint32_t third;
+    };
+
+    /*!
+     * The register that holds the value of an expression after the evaluation.
+     */
+    struct Output {
+        RegisterType type;
+        uint32_t index;
+    };
+
+    /*!
+     * Evaluates the program, i.e. computes the values of all its outputs, based on the values of the variables in the
+     * given registers.
+     */
+    void evaluate(BytecodeRegisters& registers) const;
+
+    /*!
+     * Evaluates the program for all lanes of the given registers at once. Every instruction is applied to all lanes
+     * before the next one is executed, which allows the compiler to vectorize the operations. As the lanes may take
+     * different branches of if-then-else expressions, both branches are evaluated for all lanes and the results are
+     * selected afterwards. This is safe as no instruction can fail.
+     */
+    void evaluateBatch(BytecodeBatchRegisters& registers) const;
+
+    /*!
+     * Retrieves the value of the given output. The value is only valid after the program has been evaluated. Boolean
+     * values can be retrieved as numbers (0 or 1), but numerical values can not be retrieved as booleans.
+     *
+     * @param registers The registers with which the program was evaluated.
+     * @param output The index of the output, as returned by the compiler.
+     */
+    bool getBooleanValue(BytecodeRegisters const& registers, uint64_t output) const;
+    int64_t getIntegerValue(BytecodeRegisters const& registers, uint64_t output) const;
+    double getRationalValue(BytecodeRegisters const& registers, uint64_t output) const;
+
+    /*!
+     * Retrieves the value of the given (boolean) output in the given lane after a batch evaluation.
+     */
+    bool getBooleanValue(BytecodeBatchRegisters const& registers, uint64_t output, uint64_t lane) const;
+
+    Output const& getOutput(uint64_t output) const;
+    uint64_t getNumberOfOutputs() const;
+    uint64_t getNumberOfInstructions() const;
+
+    friend std::ostream& operator<<(std::ostream& out, BytecodeProgram const& program);
+
+   private:
+    friend class BytecodeCompiler;
+
+    std::vector<Instruction> instructions;
+    std::vector<Output> outputs;
+
+    // The constants of the program as pairs of register and value. They are written before the instructions are executed.
+    std::vector<std::pair<uint32_t, uint8_t>> booleanConstants;
+    std::vector<std::pair<uint32_t, int64_t>> integerConstants;
+    std::vector<std::pair<uint32_t, double>> rationalConstants;
+
+    // The number of registers of each register file that the program uses (excluding the variable registers).
+    uint32_t numberOfBooleanRegisters = 0;
+    uint32_t numberOfIntegerRegisters = 0;
+    uint32_t numberOfRationalRegisters = 0;
+};
+
+}  // namespace expressions
+}  // namespace storm
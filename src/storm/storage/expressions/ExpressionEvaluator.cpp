@@ -5,59 +5,59 @@
 
 namespace storm {
 namespace expressions {
-ExpressionEvaluator<double>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager) : ExprtkExpressionEvaluator(manager) {
+ExpressionEvaluator<double>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager) : BytecodeExpressionEvaluator(manager) {
     // Intentionally left empty.
 }
 
 template<typename RationalType>
 ExpressionEvaluatorWithVariableToExpressionMap<RationalType>::ExpressionEvaluatorWithVariableToExpressionMap(
     storm::expressions::ExpressionManager const& manager)
-    : ExprtkExpressionEvaluatorBase<RationalType>(manager) {
+    : BytecodeExpressionEvaluatorBase<RationalType>(manager) {
     // Intentionally left empty.
 }
 
 template<typename RationalType>
 void ExpressionEvaluatorWithVariableToExpressionMap<RationalType>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
-    ExprtkExpressionEvaluatorBase<RationalType>::setBooleanValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalType>::setBooleanValue(variable, value);
     this->variableToExpressionMap[variable] = this->getManager().boolean(value);
 }
 
 template<typename RationalType>
 void ExpressionEvaluatorWithVariableToExpressionMap<RationalType>::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
-    ExprtkExpressionEvaluatorBase<RationalType>::setIntegerValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalType>::setIntegerValue(variable, value);
     this->variableToExpressionMap[variable] = this->getManager().integer(value);
 }
 
 template<typename RationalType>
 void ExpressionEvaluatorWithVariableToExpressionMap<RationalType>::setRationalValue(storm::expressions::Variable const& variable, double value) {
-    ExprtkExpressionEvaluatorBase<RationalType>::setRationalValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalType>::setRationalValue(variable, value);
     this->variableToExpressionMap[variable] = this->getManager().rational(value);
 }
 
 #ifdef STORM_HAVE_CARL
 ExpressionEvaluator<RationalNumber>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
-    : ExprtkExpressionEvaluatorBase<RationalNumber>(manager), rationalNumberVisitor(*this) {
+    : BytecodeExpressionEvaluatorBase<RationalNumber>(manager), rationalNumberVisitor(*this) {
     // Intentionally left empty.
 }
 
 void ExpressionEvaluator<RationalNumber>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
-    ExprtkExpressionEvaluatorBase<RationalNumber>::setBooleanValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalNumber>::setBooleanValue(variable, value);
 
     // Not forwarding value of variable to rational number visitor as it cannot treat boolean variables anyway.
 }
 
 void ExpressionEvaluator<RationalNumber>::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
-    ExprtkExpressionEvaluatorBase<RationalNumber>::setIntegerValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalNumber>::setIntegerValue(variable, value);
     rationalNumberVisitor.setMapping(variable, storm::utility::convertNumber<RationalNumber>(value));
 }
 
 void ExpressionEvaluator<RationalNumber>::setRationalValue(storm::expressions::Variable const& variable, double value) {
-    ExprtkExpressionEvaluatorBase<RationalNumber>::setRationalValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalNumber>::setRationalValue(variable, value);
     rationalNumberVisitor.setMapping(variable, storm::utility::convertNumber<RationalNumber>(value));
 }
 
 void ExpressionEvaluator<RationalNumber>::setRationalValue(storm::expressions::Variable const& variable, RationalNumber const& value) {
-    ExprtkExpressionEvaluatorBase<RationalNumber>::setRationalValue(variable, storm::utility::convertNumber<double>(value));
+    BytecodeExpressionEvaluatorBase<RationalNumber>::setRationalValue(variable, storm::utility::convertNumber<double>(value));
     rationalNumberVisitor.setMapping(variable, value);
 }
 
@@ -67,29 +67,29 @@ RationalNumber ExpressionEvaluator<RationalNumber>::asRational(Expression const&
 }
 
 ExpressionEvaluator<RationalFunction>::ExpressionEvaluator(storm::expressions::ExpressionManager const& manager)
-    : ExprtkExpressionEvaluatorBase<RationalFunction>(manager), rationalFunctionVisitor(*this) {
+    : BytecodeExpressionEvaluatorBase<RationalFunction>(manager), rationalFunctionVisitor(*this) {
     // Intentionally left empty.
 }
 
 void ExpressionEvaluator<RationalFunction>::setBooleanValue(storm::expressions::Variable const& variable, bool value) {
-    ExprtkExpressionEvaluatorBase<RationalFunction>::setBooleanValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalFunction>::setBooleanValue(variable, value);
 
     // Not forwarding value of variable to rational number visitor as it cannot treat boolean variables anyway.
 }
 
 void ExpressionEvaluator<RationalFunction>::setIntegerValue(storm::expressions::Variable const& variable, int_fast64_t value) {
-    ExprtkExpressionEvaluatorBase<RationalFunction>::setIntegerValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalFunction>::setIntegerValue(variable, value);
     rationalFunctionVisitor.setMapping(variable, storm::utility::convertNumber<RationalFunction>(value));
 }
 
 void ExpressionEvaluator<RationalFunction>::setRationalValue(storm::expressions::Variable const& variable, double value) {
-    ExprtkExpressionEvaluatorBase<RationalFunction>::setRationalValue(variable, value);
+    BytecodeExpressionEvaluatorBase<RationalFunction>::setRationalValue(variable, value);
     rationalFunctionVisitor.setMapping(variable, storm::utility::convertNumber<RationalFunction>(value));
 }
 
 void ExpressionEvaluator<RationalFunction>::setRationalValue(storm::expressions::Variable const& variable, RationalFunction const& value) {
     STORM_LOG_ASSERT(storm::utility::isConstant(value), "Value for rational variable is not a constant.");
-    ExprtkExpressionEvaluatorBase<RationalFunction>::setRationalValue(variable, storm::utility::convertNumber<double>(value));
+    BytecodeExpressionEvaluatorBase<RationalFunction>::setRationalValue(variable, storm::utility::convertNumber<double>(value));
     rationalFunctionVisitor.setMapping(variable, value);
 }
 
@@ -1,5 +1,8 @@
 #include "storm/storage/geometry/NativePolytope.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "storm/solver/SmtSolver.h"
 #include "storm/solver/Z3LpSolver.h"
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -16,6 +19,31 @@ namespace storm {
 namespace storage {
 namespace geometry {
 
+namespace {
+template<typename EigenVector, typename Point>
+std::vector<EigenVector> toEigenVectors(std::vector<Point> const& points) {
+    std::vector<EigenVector> result;
+    result.reserve(points.size());
+    for (auto const& p : points) {
+        result.emplace_back(storm::adapters::EigenAdapter::toEigenVector(p));
+    }
+    return result;
+}
+
+/*!
+ * Checks whether the given value of a constraint's left hand side matches the offset, i.e., whether the point lies on the boundary of the halfspace.
+ */
+template<typename ValueType>
+bool isOnBoundary(ValueType const& value, ValueType const& offset) {
+    return value == offset;
+}
+
+template<>
+bool isOnBoundary(double const& value, double const& offset) {
+    return std::abs(value - offset) <= 1e-9 * std::max(1.0, std::abs(offset));
+}
+}  // namespace
+
 template<typename ValueType>
 NativePolytope<ValueType>::NativePolytope(std::vector<Halfspace<ValueType>> const& halfspaces) {
     if (halfspaces.empty()) {
@@ -36,21 +64,23 @@ NativePolytope<ValueType>::NativePolytope(std::vector<Halfspace<ValueType>> cons
 }
 
 template<typename ValueType>
-NativePolytope<ValueType>::NativePolytope(std::vector<Point> const& points) {
+NativePolytope<ValueType>::NativePolytope(std::vector<Point> const& points) : NativePolytope(toEigenVectors<EigenVector>(points)) {
+    // Intentionally left empty
+}
+
+template<typename ValueType>
+NativePolytope<ValueType>::NativePolytope(std::vector<EigenVector>&& points) {
     if (points.empty()) {
         emptyStatus = EmptyStatus::Empty;
+        vertices = std::vector<EigenVector>();
     } else {
-        std::vector<EigenVector> eigenPoints;
-        eigenPoints.reserve(points.size());
-        for (auto const& p : points) {
-            eigenPoints.emplace_back(storm::adapters::EigenAdapter::toEigenVector(p));
-        }
-
         storm::storage::geometry::QuickHull<ValueType> qh;
-        qh.generateHalfspacesFromPoints(eigenPoints, false);
+        qh.generateHalfspacesFromPoints(points, false);
         A = std::move(qh.getResultMatrix());
         b = std::move(qh.getResultVector());
         emptyStatus = EmptyStatus::Nonempty;
+        // The vertices of the convex hull are among the given points.
+        vertexCandidates = std::move(points);
     }
 }
 
@@ -68,13 +98,18 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::create(boost::op
 }
 
 template<typename ValueType>
-NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other) : emptyStatus(other.emptyStatus), A(other.A), b(other.b) {
+NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType> const& other)
+    : emptyStatus(other.emptyStatus), A(other.A), b(other.b), vertices(other.vertices), vertexCandidates(other.vertexCandidates) {
     // Intentionally left empty
 }
 
 template<typename ValueType>
 NativePolytope<ValueType>::NativePolytope(NativePolytope<ValueType>&& other)
-    : emptyStatus(std::move(other.emptyStatus)), A(std::move(other.A)), b(std::move(other.b)) {
+    : emptyStatus(std::move(other.emptyStatus)),
+      A(std::move(other.A)),
+      b(std::move(other.b)),
+      vertices(std::move(other.vertices)),
+      vertexCandidates(std::move(other.vertexCandidates)) {
     // Intentionally left empty
 }
 
@@ -97,7 +132,7 @@ NativePolytope<ValueType>::~NativePolytope() {
 
 template<typename ValueType>
 std::vector<typename Polytope<ValueType>::Point> NativePolytope<ValueType>::getVertices() const {
-    std::vector<EigenVector> eigenVertices = getEigenVertices();
+    std::vector<EigenVector> const& eigenVertices = getEigenVertices();
     std::vector<Point> result;
     result.reserve(eigenVertices.size());
     for (auto const& p : eigenVertices) {
@@ -240,13 +275,10 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::convexUnion(std:
 
     STORM_LOG_WARN_COND_DEBUG(false, "Implementation of convex union of two polytopes only works if the polytopes are bounded. This is not checked.");
 
-    std::vector<EigenVector> rhsVertices = dynamic_cast<NativePolytope<ValueType> const&>(*rhs).getEigenVertices();
+    std::vector<EigenVector> const& rhsVertices = dynamic_cast<NativePolytope<ValueType> const&>(*rhs).getEigenVertices();
     std::vector<EigenVector> resultVertices = this->getEigenVertices();
-    resultVertices.insert(resultVertices.end(), std::make_move_iterator(rhsVertices.begin()), std::make_move_iterator(rhsVertices.end()));
-
-    storm::storage::geometry::QuickHull<ValueType> qh;
-    qh.generateHalfspacesFromPoints(resultVertices, false);
-    return std::make_shared<NativePolytope<ValueType>>(EmptyStatus::Nonempty, std::move(qh.getResultMatrix()), std::move(qh.getResultVector()));
+    resultVertices.insert(resultVertices.end(), rhsVertices.begin(), rhsVertices.end());
+    return std::shared_ptr<Polytope<ValueType>>(new NativePolytope<ValueType>(std::move(resultVertices)));
 }
 
 template<typename ValueType>
@@ -312,7 +344,21 @@ std::shared_ptr<Polytope<ValueType>> NativePolytope<ValueType>::affineTransforma
     }
     EigenMatrix newA = A * luMatrix.inverse();
     EigenVector newb = b + (newA * eigenVector);
-    return std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    auto result = std::make_shared<NativePolytope<ValueType>>(emptyStatus, std::move(newA), std::move(newb));
+    // The transformation maps vertices to vertices, so known (candidate) vertices are transformed as well.
+    if (vertices) {
+        result->vertices = std::vector<EigenVector>();
+        result->vertices->reserve(vertices->size());
+        for (auto const& v : vertices.get()) {
+            result->vertices->push_back(eigenMatrix * v + eigenVector);
+        }
+    } else {
+        result->vertexCandidates.reserve(vertexCandidates.size());
+        for (auto const& v : vertexCandidates) {
+            result->vertexCandidates.push_back(eigenMatrix * v + eigenVector);
+        }
+    }
+    return result;
 }
 
 template<typename ValueType>
@@ -381,10 +427,40 @@ bool NativePolytope<ValueType>::isNativePolytope() const {
     return true;
 }
 template<typename ValueType>
-std::vector<typename NativePolytope<ValueType>::EigenVector> NativePolytope<ValueType>::getEigenVertices() const {
-    storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
-    he.generateVerticesFromConstraints(A, b, false);
-    return he.getResultVertices();
+std::vector<typename NativePolytope<ValueType>::EigenVector> const& NativePolytope<ValueType>::getEigenVertices() const {
+    if (vertices) {
+        return vertices.get();
+    }
+    if (vertexCandidates.empty()) {
+        storm::storage::geometry::HyperplaneEnumeration<ValueType> he;
+        he.generateVerticesFromConstraints(A, b, false);
+        vertices = std::move(he.getResultVertices());
+    } else {
+        // A candidate is a vertex iff the constraints that are tight at the candidate have full rank.
+        // This only takes |candidates| * |constraints| evaluations whereas the vertex enumeration considers all subsets of the constraints.
+        vertices = std::vector<EigenVector>();
+        std::vector<Eigen::Index> tightRows;
+        for (auto& candidate : vertexCandidates) {
+            tightRows.clear();
+            for (Eigen::Index row = 0; row < A.rows(); ++row) {
+                if (isOnBoundary<ValueType>((A.row(row) * candidate)(0), b(row))) {
+                    tightRows.push_back(row);
+                }
+            }
+            if ((Eigen::Index)tightRows.size() < A.cols() || std::find(vertices->begin(), vertices->end(), candidate) != vertices->end()) {
+                continue;
+            }
+            EigenMatrix tightConstraints(tightRows.size(), A.cols());
+            for (uint64_t i = 0; i < tightRows.size(); ++i) {
+                tightConstraints.row(i) = A.row(tightRows[i]);
+            }
+            if (Eigen::FullPivLU<EigenMatrix>(tightConstraints).rank() == A.cols()) {
+                vertices->push_back(std::move(candidate));
+            }
+        }
+        vertexCandidates = std::vector<EigenVector>();
+    }
+    return vertices.get();
 }
 
 template<typename ValueType>
@@ -140,8 +140,13 @@ class NativePolytope : public Polytope<ValueType> {
     virtual std::shared_ptr<Polytope<ValueType>> clean() override;
 
    private:
+    /*!
+     * Creates the convex hull of the given points. The points are kept as candidates for the vertices of the polytope.
+     */
+    NativePolytope(std::vector<EigenVector>&& points);
+
     // returns the vertices of this polytope as EigenVectors
-    std::vector<EigenVector> getEigenVertices() const;
+    std::vector<EigenVector> const& getEigenVertices() const;
 
     // As optimize(..) but with EigenVectors
     std::pair<EigenVector, bool> optimize(EigenVector const& direction) const;
@@ -152,6 +157,12 @@ class NativePolytope : public Polytope<ValueType> {
     // Intern representation of the polytope as { x | Ax<=b }
     EigenMatrix A;
     EigenVector b;
+
+    // The vertices of the polytope. They are computed on demand and cached as the vertex enumeration is expensive.
+    mutable boost::optional<std::vector<EigenVector>> vertices;
+    // If the polytope is the convex hull of some points, these points are stored until the vertices are needed. The vertices are then obtained by
+    // filtering these points which avoids a vertex enumeration.
+    mutable std::vector<EigenVector> vertexCandidates;
 };
 
 }  // namespace geometry
@@ -7,6 +7,7 @@
 #include "storm/storage/geometry/HyproPolytope.h"
 #include "storm/storage/geometry/NativePolytope.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
 
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -15,6 +16,22 @@ namespace storm {
 namespace storage {
 namespace geometry {
 
+namespace {
+/*!
+ * Checks whether the given point lies in the selective downward closure of the other point, i.e., whether the point is not larger than the other point
+ * in the selected dimensions and coincides with the other point in the remaining dimensions.
+ */
+template<typename Point>
+bool isInSelectiveDownwardClosure(Point const& point, Point const& other, storm::storage::BitVector const& selectedDimensions) {
+    for (uint64_t dim = 0; dim < point.size(); ++dim) {
+        if (selectedDimensions.get(dim) ? point[dim] > other[dim] : point[dim] != other[dim]) {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
 template<typename ValueType>
 std::shared_ptr<Polytope<ValueType>> Polytope<ValueType>::create(std::vector<storm::storage::geometry::Halfspace<ValueType>> const& halfspaces) {
     return create(halfspaces, boost::none);
@@ -68,13 +85,27 @@ std::shared_ptr<Polytope<ValueType>> Polytope<ValueType>::createSelectiveDownwar
     }
     assert(points.front().size() == selectedDimensions.size());
 
+    // Points that lie in the selective downward closure of another point do not contribute to the result.
+    // Erasing them first reduces the number of (auxiliary) points for which the convex hull is built.
+    storm::storage::BitVector relevantPoints(points.size(), true);
+    for (uint64_t pointIndex = 0; pointIndex < points.size(); ++pointIndex) {
+        for (uint64_t otherIndex = 0; otherIndex < points.size(); ++otherIndex) {
+            if (pointIndex != otherIndex && relevantPoints.get(otherIndex) &&
+                isInSelectiveDownwardClosure(points[pointIndex], points[otherIndex], selectedDimensions)) {
+                relevantPoints.set(pointIndex, false);
+                break;
+            }
+        }
+    }
+    std::vector<Point> relevantPointsVector = storm::utility::vector::filterVector(points, relevantPoints);
+
     std::vector<Halfspace<ValueType>> halfspaces;
     // We build the convex hull of the given points.
     // However, auxiliary points (that will always be in the selective downward closure) are added.
     // Then, the halfspaces of the resulting polytope are a superset of the halfspaces of the downward closure.
-    std::vector<Point> auxiliaryPoints = points;
+    std::vector<Point> auxiliaryPoints = relevantPointsVector;
     auxiliaryPoints.reserve(auxiliaryPoints.size() * (1 + selectedDimensions.getNumberOfSetBits()));
-    for (auto const& point : points) {
+    for (auto const& point : relevantPointsVector) {
         for (auto dim : selectedDimensions) {
             auxiliaryPoints.push_back(point);
             auxiliaryPoints.back()[dim] -= storm::utility::one<ValueType>();
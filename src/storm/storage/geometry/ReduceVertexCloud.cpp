@@ -1,4 +1,7 @@
 #include "storm/storage/geometry/ReduceVertexCloud.h"
+
+#include <algorithm>
+
 #include "storm/utility/Stopwatch.h"
 #undef _DEBUG_REDUCE_VERTEX_CLOUD
 
@@ -61,6 +64,22 @@ std::pair<storm::storage::BitVector, bool> ReduceVertexCloud<ValueType>::elimina
 #ifdef _DEBUG_REUCE_VERTEX_CLOUD
         std::cout << pointIndex << " out of " << input.size() << '\n';
 #endif
+        // Only points whose support is a subset of the support of the current point can take part in a convex combination.
+        // If there is no such point, the current point is a vertex (unless it is the origin) and the solver does not need to be invoked.
+        bool hasPotentialSupport = false;
+        for (uint64_t potentialSupport = 0; potentialSupport < input.size(); ++potentialSupport) {
+            if (pointIndex != potentialSupport && (potentialSupport > pointIndex || vertices.get(potentialSupport)) &&
+                supports[potentialSupport].isSubsetOf(supports[pointIndex])) {
+                hasPotentialSupport = true;
+                break;
+            }
+        }
+        if (!hasPotentialSupport && std::any_of(input[pointIndex].begin(), input[pointIndex].end(),
+                                                [](std::pair<uint64_t const, ValueType> const& entry) { return !storm::utility::isZero(entry.second); })) {
+            vertices.set(pointIndex, true);
+            continue;
+        }
+
         smtSolver->push();
         std::map<uint64_t, std::vector<storm::expressions::Expression>> dimensionTerms;
         for (auto const& entry : input[pointIndex]) {
@@ -24,6 +24,7 @@
 #include "storm/storage/expressions/LinearityCheckVisitor.h"
 
 #include "storm/utility/combinatorics.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -166,11 +167,12 @@ storm::expressions::Expression createSynchronizedGuard(std::vector<std::referenc
     return result;
 }
 
-ConditionalMetaEdge createSynchronizedMetaEdge(Automaton& automaton, std::vector<std::reference_wrapper<Edge const>> const& edgesToSynchronize) {
+// Note that the template edge of the result is not yet registered with the automaton. This is done by the caller, which
+// allows to create the meta edges of different synchronization vectors in parallel.
+ConditionalMetaEdge createSynchronizedMetaEdge(std::vector<std::reference_wrapper<Edge const>> const& edgesToSynchronize) {
     ConditionalMetaEdge result;
 
     result.templateEdge = std::make_shared<TemplateEdge>(createSynchronizedGuard(edgesToSynchronize));
-    automaton.registerTemplateEdge(result.templateEdge);
 
     for (auto const& edge : edgesToSynchronize) {
         result.condition.push_back(edge.get().getSourceLocationIndex());
@@ -226,19 +228,32 @@ ConditionalMetaEdge createSynchronizedMetaEdge(Automaton& automaton, std::vector
     return result;
 }
 
-std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldModel, Model& newModel, Automaton& newAutomaton,
-                                                              std::vector<std::set<uint64_t>>& synchronizingActionIndices, SynchronizationVector const& vector,
-                                                              std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata,
-                                                              storm::solver::SmtSolver& solver) {
-    std::vector<ConditionalMetaEdge> result;
+// The synchronization of the edges of a synchronization vector. The solver holds the constraints whose solutions are the
+// combinations of edges that can synchronize.
+struct SynchronizationProblem {
+    std::vector<uint64_t> components;
+    uint64_t resultingActionIndex;
+    std::vector<std::vector<std::reference_wrapper<storm::jani::Edge const>>> possibleEdges;
+    std::vector<std::vector<storm::expressions::Variable>> edgeVariables;
+    std::vector<storm::expressions::Variable> allEdgeVariables;
+    // The solver or null if there is no combination of edges.
+    storm::solver::SmtSolver* solver;
+};
+
+// Prepares the synchronization of the given vector. As this declares variables and actions (and translating the guards
+// for the solver may declare auxiliary variables), this must not be called concurrently.
+SynchronizationProblem prepareSynchronization(Model const& oldModel, Model& newModel, std::vector<std::set<uint64_t>>& synchronizingActionIndices,
+                                              SynchronizationVector const& vector, std::vector<std::reference_wrapper<Automaton const>> const& composedAutomata,
+                                              storm::solver::SmtSolver& solver) {
+    SynchronizationProblem result;
+    result.solver = nullptr;
 
     // Gather all participating automata and the corresponding input symbols.
-    std::vector<uint64_t> components;
     std::vector<std::pair<std::reference_wrapper<Automaton const>, uint64_t>> participatingAutomataAndActions;
     for (uint64_t i = 0; i < composedAutomata.size(); ++i) {
         std::string const& actionName = vector.getInput(i);
         if (!SynchronizationVector::isNoActionInput(actionName)) {
-            components.push_back(i);
+            result.components.push_back(i);
             uint64_t actionIndex = oldModel.getActionIndex(actionName);
             // store that automaton occurs in the sync vector.
             participatingAutomataAndActions.push_back(std::make_pair(composedAutomata[i], actionIndex));
@@ -248,20 +263,17 @@ std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldMo
     }
 
     // What is the action label that should be attached to the composed actions
-    uint64_t resultingActionIndex = Model::SILENT_ACTION_INDEX;
+    result.resultingActionIndex = Model::SILENT_ACTION_INDEX;
     if (vector.getOutput() != Model::SILENT_ACTION_NAME) {
         if (newModel.hasAction(vector.getOutput())) {
-            resultingActionIndex = newModel.getActionIndex(vector.getOutput());
+            result.resultingActionIndex = newModel.getActionIndex(vector.getOutput());
         } else {
-            resultingActionIndex = newModel.addAction(vector.getOutput());
+            result.resultingActionIndex = newModel.addAction(vector.getOutput());
         }
     }
 
-    bool noCombinations = false;
-
     // Prepare the list that stores for each automaton the list of edges with the participating action.
-    std::vector<std::vector<std::reference_wrapper<storm::jani::Edge const>>> possibleEdges;
-
+    auto& possibleEdges = result.possibleEdges;
     for (auto const& automatonActionPair : participatingAutomataAndActions) {
         possibleEdges.emplace_back();
         for (auto const& edge : automatonActionPair.first.get().getEdges()) {
@@ -270,77 +282,87 @@ std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(Model const& oldMo
             }
         }
 
-        // If there were no edges with the participating action index, then there is no synchronization possible.
+        // If there were no edges with the participating action index, then there is no synchronization possible and
+        // we need to skip the generation of synchronizing edges.
         if (possibleEdges.back().empty()) {
-            noCombinations = true;
-            break;
+            return result;
         }
     }
 
-    // If there are no valid combinations for the action, we need to skip the generation of synchronizing edges.
-    if (!noCombinations) {
-        // Save state of solver so that we can always restore the point where we have exactly the constant values
-        // and variables bounds on the assertion stack.
-        solver.push();
-
-        // Start by creating a fresh auxiliary variable for each edge and link it with the guard.
-        std::vector<std::vector<storm::expressions::Variable>> edgeVariables(possibleEdges.size());
-        std::vector<storm::expressions::Variable> allEdgeVariables;
-        for (uint_fast64_t outerIndex = 0; outerIndex < possibleEdges.size(); ++outerIndex) {
-            // Create auxiliary variables and link them with the guards.
-            for (uint_fast64_t innerIndex = 0; innerIndex < possibleEdges[outerIndex].size(); ++innerIndex) {
-                edgeVariables[outerIndex].push_back(newModel.getManager().declareFreshBooleanVariable());
-                allEdgeVariables.push_back(edgeVariables[outerIndex].back());
-                storm::expressions::Expression guard = eliminateFunctionCallsInExpression(possibleEdges[outerIndex][innerIndex].get().getGuard(), oldModel);
-                solver.add(implies(edgeVariables[outerIndex].back(), guard));
-            }
+    // Save state of solver so that we can always restore the point where we have exactly the constant values
+    // and variables bounds on the assertion stack.
+    solver.push();
+    result.solver = &solver;
+
+    // Start by creating a fresh auxiliary variable for each edge and link it with the guard.
+    auto& edgeVariables = result.edgeVariables;
+    edgeVariables.resize(possibleEdges.size());
+    for (uint_fast64_t outerIndex = 0; outerIndex < possibleEdges.size(); ++outerIndex) {
+        // Create auxiliary variables and link them with the guards.
+        for (uint_fast64_t innerIndex = 0; innerIndex < possibleEdges[outerIndex].size(); ++innerIndex) {
+            edgeVariables[outerIndex].push_back(newModel.getManager().declareFreshBooleanVariable());
+            result.allEdgeVariables.push_back(edgeVariables[outerIndex].back());
+            storm::expressions::Expression guard = eliminateFunctionCallsInExpression(possibleEdges[outerIndex][innerIndex].get().getGuard(), oldModel);
+            solver.add(implies(edgeVariables[outerIndex].back(), guard));
+        }
 
-            storm::expressions::Expression atLeastOneEdgeFromAutomaton = newModel.getManager().boolean(false);
-            for (auto const& edgeVariable : edgeVariables[outerIndex]) {
-                atLeastOneEdgeFromAutomaton = atLeastOneEdgeFromAutomaton || edgeVariable;
-            }
-            solver.add(atLeastOneEdgeFromAutomaton);
+        storm::expressions::Expression atLeastOneEdgeFromAutomaton = newModel.getManager().boolean(false);
+        for (auto const& edgeVariable : edgeVariables[outerIndex]) {
+            atLeastOneEdgeFromAutomaton = atLeastOneEdgeFromAutomaton || edgeVariable;
+        }
+        solver.add(atLeastOneEdgeFromAutomaton);
 
-            storm::expressions::Expression atMostOneEdgeFromAutomaton = newModel.getManager().boolean(true);
-            for (uint64_t first = 0; first < possibleEdges[outerIndex].size(); ++first) {
-                for (uint64_t second = first + 1; second < possibleEdges[outerIndex].size(); ++second) {
-                    atMostOneEdgeFromAutomaton = atMostOneEdgeFromAutomaton && !(edgeVariables[outerIndex][first] && edgeVariables[outerIndex][second]);
-                }
+        storm::expressions::Expression atMostOneEdgeFromAutomaton = newModel.getManager().boolean(true);
+        for (uint64_t first = 0; first < possibleEdges[outerIndex].size(); ++first) {
+            for (uint64_t second = first + 1; second < possibleEdges[outerIndex].size(); ++second) {
+                atMostOneEdgeFromAutomaton = atMostOneEdgeFromAutomaton && !(edgeVariables[outerIndex][first] && edgeVariables[outerIndex][second]);
             }
-            solver.add(atMostOneEdgeFromAutomaton);
         }
+        solver.add(atMostOneEdgeFromAutomaton);
+    }
 
-        // Now enumerate all possible combinations.
-        solver.allSat(allEdgeVariables, [&](storm::solver::SmtSolver::ModelReference& modelReference) -> bool {
-            // Now we need to reconstruct the chosen edges from the valuation of the edge variables.
-            std::vector<std::reference_wrapper<Edge const>> chosenEdges;
+    return result;
+}
 
-            for (uint_fast64_t outerIndex = 0; outerIndex < edgeVariables.size(); ++outerIndex) {
-                for (uint_fast64_t innerIndex = 0; innerIndex < edgeVariables[outerIndex].size(); ++innerIndex) {
-                    if (modelReference.getBooleanValue(edgeVariables[outerIndex][innerIndex])) {
-                        chosenEdges.emplace_back(possibleEdges[outerIndex][innerIndex]);
-                        break;
-                    }
+// Enumerates the combinations of edges of the given (prepared) synchronization and creates the corresponding meta edges.
+// This neither modifies the models nor the expression manager and can therefore be called concurrently for problems
+// that use different solvers.
+std::vector<ConditionalMetaEdge> createSynchronizingMetaEdges(SynchronizationProblem const& problem) {
+    std::vector<ConditionalMetaEdge> result;
+    if (problem.solver == nullptr) {
+        return result;
+    }
+
+    // Now enumerate all possible combinations.
+    problem.solver->allSat(problem.allEdgeVariables, [&](storm::solver::SmtSolver::ModelReference& modelReference) -> bool {
+        // Now we need to reconstruct the chosen edges from the valuation of the edge variables.
+        std::vector<std::reference_wrapper<Edge const>> chosenEdges;
+
+        for (uint_fast64_t outerIndex = 0; outerIndex < problem.edgeVariables.size(); ++outerIndex) {
+            for (uint_fast64_t innerIndex = 0; innerIndex < problem.edgeVariables[outerIndex].size(); ++innerIndex) {
+                if (modelReference.getBooleanValue(problem.edgeVariables[outerIndex][innerIndex])) {
+                    chosenEdges.emplace_back(problem.possibleEdges[outerIndex][innerIndex]);
+                    break;
                 }
             }
+        }
 
-            // Get a basic conditional meta edge that represents the synchronization of the provided edges.
-            // Note that there is still information missing, which we need to add (like the action index etc.).
-            ConditionalMetaEdge conditionalMetaEdge = createSynchronizedMetaEdge(newAutomaton, chosenEdges);
+        // Get a basic conditional meta edge that represents the synchronization of the provided edges.
+        // Note that there is still information missing, which we need to add (like the action index etc.).
+        ConditionalMetaEdge conditionalMetaEdge = createSynchronizedMetaEdge(chosenEdges);
 
-            // Set the participating components.
-            conditionalMetaEdge.components = components;
+        // Set the participating components.
+        conditionalMetaEdge.components = problem.components;
 
-            // Set the action index.
-            conditionalMetaEdge.actionIndex = resultingActionIndex;
+        // Set the action index.
+        conditionalMetaEdge.actionIndex = problem.resultingActionIndex;
 
-            result.push_back(conditionalMetaEdge);
+        result.push_back(conditionalMetaEdge);
 
-            return true;
-        });
+        return true;
+    });
 
-        solver.pop();
-    }
+    problem.solver->pop();
 
     return result;
 }
@@ -464,9 +486,6 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
 
     flattenedModel.getModelFeatures() = getModelFeatures();
 
-    // Get an SMT solver for computing possible guard combinations.
-    std::unique_ptr<storm::solver::SmtSolver> solver = smtSolverFactory->create(*expressionManager);
-
     Composition const& systemComposition = getSystemComposition();
     if (systemComposition.isAutomatonComposition()) {
         AutomatonComposition const& automatonComposition = systemComposition.asAutomatonComposition();
@@ -518,35 +537,75 @@ Model Model::flattenComposition(std::shared_ptr<storm::utility::solver::SmtSolve
         }
     }
 
-    // Prepare the solver.
-    // Assert the values of the constants.
-    for (auto const& constant : this->getConstants()) {
-        if (constant.isDefined()) {
-            if (constant.isBooleanConstant()) {
-                solver->add(storm::expressions::iff(constant.getExpressionVariable(), constant.getExpression()));
-            } else {
-                solver->add(constant.getExpressionVariable() == constant.getExpression());
+    // Gather the synchronization vectors in which at least two automata participate (for the others, there is no
+    // need to perform a synchronization).
+    std::vector<std::reference_wrapper<SynchronizationVector const>> synchronizationVectors;
+    for (auto const& vector : parallelComposition.getSynchronizationVectors()) {
+        if (vector.getNumberOfActionInputs() > 1) {
+            synchronizationVectors.push_back(vector);
+        }
+    }
+
+    // Get the SMT solvers for computing possible guard combinations. The synchronization vectors are processed in
+    // batches such that the combinations of the vectors of a batch are enumerated in parallel (with one solver each).
+    uint64_t numberOfThreads = std::max<uint64_t>(
+        1, std::min<uint64_t>(storm::utility::parallel::getDefaultNumberOfThreads(), static_cast<uint64_t>(synchronizationVectors.size())));
+    std::vector<std::unique_ptr<storm::solver::SmtSolver>> solvers;
+    for (uint64_t solverIndex = 0; solverIndex < numberOfThreads; ++solverIndex) {
+        solvers.push_back(smtSolverFactory->create(*expressionManager));
+        storm::solver::SmtSolver& solver = *solvers.back();
+
+        // Assert the values of the constants.
+        for (auto const& constant : this->getConstants()) {
+            if (constant.isDefined()) {
+                if (constant.isBooleanConstant()) {
+                    solver.add(storm::expressions::iff(constant.getExpressionVariable(), constant.getExpression()));
+                } else {
+                    solver.add(constant.getExpressionVariable() == constant.getExpression());
+                }
             }
         }
+        // Assert the bounds of the global variables.
+        for (auto const& variable : newAutomaton.getVariables().getBoundedIntegerVariables()) {
+            solver.add(variable.getRangeExpression());
+        }
     }
-    // Assert the bounds of the global variables.
-    for (auto const& variable : newAutomaton.getVariables().getBoundedIntegerVariables()) {
-        solver->add(variable.getRangeExpression());
+    if (numberOfThreads > 1) {
+        // The types of the manager are created lazily, so we need to make sure they exist before expressions are
+        // created concurrently.
+        expressionManager->getBooleanType();
+        expressionManager->getIntegerType();
+        expressionManager->getRationalType();
     }
 
     // Perform all necessary synchronizations and keep track which action indices participate in synchronization.
     std::vector<std::set<uint64_t>> synchronizingActionIndices(composedAutomata.size());
     std::vector<ConditionalMetaEdge> conditionalMetaEdges;
-    for (auto const& vector : parallelComposition.getSynchronizationVectors()) {
-        // If less then 2 automata participate, there is no need to perform a synchronization.
-        if (vector.getNumberOfActionInputs() <= 1) {
-            continue;
+    for (uint64_t batchBegin = 0; batchBegin < synchronizationVectors.size(); batchBegin += numberOfThreads) {
+        uint64_t batchSize = std::min<uint64_t>(numberOfThreads, synchronizationVectors.size() - batchBegin);
+
+        // Declaring the auxiliary variables and actions modifies the models and the manager, so this is done sequentially.
+        std::vector<SynchronizationProblem> problems;
+        for (uint64_t offset = 0; offset < batchSize; ++offset) {
+            problems.push_back(prepareSynchronization(*this, flattenedModel, synchronizingActionIndices, synchronizationVectors[batchBegin + offset].get(),
+                                                      composedAutomata, *solvers[offset]));
         }
 
-        // Create all conditional template edges corresponding to this synchronization vector.
-        std::vector<ConditionalMetaEdge> newConditionalMetaEdges =
-            createSynchronizingMetaEdges(*this, flattenedModel, newAutomaton, synchronizingActionIndices, vector, composedAutomata, *solver);
-        conditionalMetaEdges.insert(conditionalMetaEdges.end(), newConditionalMetaEdges.begin(), newConditionalMetaEdges.end());
+        // Create all conditional template edges corresponding to the synchronization vectors of the batch.
+        std::vector<std::vector<ConditionalMetaEdge>> newConditionalMetaEdges(batchSize);
+        storm::utility::parallel::forEachChunk(0, batchSize, 1, numberOfThreads, [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t offset = chunkBegin; offset < chunkEnd; ++offset) {
+                newConditionalMetaEdges[offset] = createSynchronizingMetaEdges(problems[offset]);
+            }
+        });
+
+        // Register the template edges in the order of the synchronization vectors.
+        for (auto& metaEdges : newConditionalMetaEdges) {
+            for (auto& metaEdge : metaEdges) {
+                newAutomaton.registerTemplateEdge(metaEdge.templateEdge);
+                conditionalMetaEdges.push_back(std::move(metaEdge));
+            }
+        }
     }
 
     // Now add all edges with action indices that were not mentioned in synchronization vectors.
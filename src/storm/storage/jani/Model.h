@@ -104,7 +104,8 @@ class Model {
 
     /*!
      * Flatten the composition to obtain an equivalent model that contains exactly one automaton that has the
-     * standard composition.
+     * standard composition. The synchronizing edges of different synchronization vectors are enumerated in parallel
+     * (using the default number of threads).
      *
      * @param smtSolverFactory A factory that can be used to create new SMT solvers.
      */
@@ -633,6 +634,11 @@ class Model {
      */
     Model restrictEdges(storm::storage::FlatSet<uint_fast64_t> const& automataAndEdgeIndices) const;
 
+    /*!
+     * Creates a new model from the given automaton (which must be contained in the current model).
+     */
+    Model createModelFromAutomaton(Automaton const& automaton) const;
+
     void writeDotToStream(std::ostream& outStream = std::cout) const;
 
     /// The name of the silent action.
@@ -642,11 +648,6 @@ class Model {
     static const uint64_t SILENT_ACTION_INDEX;
 
    private:
-    /*!
-     * Creates a new model from the given automaton (which must be contained in the current model).
-     */
-    Model createModelFromAutomaton(Automaton const& automaton) const;
-
     /// The model name.
     std::string name;
 
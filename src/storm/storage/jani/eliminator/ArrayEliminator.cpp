@@ -627,22 +627,17 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
         } else {
             STORM_LOG_ASSERT(!replacement.isVariable(), "Are there too many nested array accesses?");
             auto indexExpr = indices[pos - 1];
-            storm::expressions::Expression result;
             if (indexExpr.containsVariables()) {
+                std::vector<std::pair<uint64_t, storm::expressions::Expression>> children;
                 for (uint64_t index = 0; index < replacement.size(); ++index) {
                     auto child = varElimHelper(replacement.at(index), indices, pos - 1);
                     if (child.isInitialized()) {  // i.e. there is no out-of-bounds situation for the child
-                        if (result.isInitialized()) {
-                            auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                            result = storm::expressions::ite(currIndexExpr, child, result);
-                        } else {
-                            result = child;
-                        }
+                        children.emplace_back(index, child);
                     }
                 }
-                // At this point result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
+                // The result remains uninitialized iff all childs are uninitialized (i.e. out-of-bounds).
                 // The underlying assumption here is that indexExpr will never evaluate to an index where the access is out-of-bounds.
-                return result;
+                return selectByIndex(indexExpr, children, 0, children.size());
             } else {
                 auto index = static_cast<uint64_t>(indexExpr.evaluateAsInt());
                 if (index < replacement.size()) {
@@ -741,18 +736,14 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
             STORM_LOG_THROW(!expression.size()->containsVariables(), storm::exceptions::NotSupportedException,
                             "Unable to eliminate array expression of unknown size.");
             auto exprSize = static_cast<uint64_t>(expression.size()->evaluateAsInt());
-            storm::expressions::Expression result;
+            std::vector<std::pair<uint64_t, storm::expressions::Expression>> children;
             for (uint64_t index = 0; index < exprSize; ++index) {
                 auto child = boost::any_cast<ResultType>(expression.at(index)->accept(*this, &childIndices));
                 if (!child.isArrayOutOfBounds()) {
-                    if (result.isInitialized()) {
-                        auto currIndexExpr = (indexExpr == indexExpr.getManager().integer(index));
-                        result = storm::expressions::ite(currIndexExpr, child.expr()->toExpression(), result);
-                    } else {
-                        result = child.expr()->toExpression();
-                    }
+                    children.emplace_back(index, child.expr()->toExpression());
                 }
             }
+            storm::expressions::Expression result = selectByIndex(indexExpr, children, 0, children.size());
             if (result.isInitialized()) {
                 return ResultType(result.getBaseExpressionPointer());
             } else {
@@ -802,6 +793,25 @@ class ArrayExpressionEliminationVisitor : public storm::expressions::ExpressionV
     }
 
    private:
+    /*!
+     * Builds an expression that evaluates to the child whose index is the value of the index expression, where the children are sorted by
+     * their index. The children are arranged in a balanced search tree over the index (instead of a chain of if-then-else expressions that
+     * compares the index with each child), so evaluating an array access takes a logarithmic number of comparisons in the size of the array.
+     * @return The expression or an uninitialized expression if there are no children
+     */
+    storm::expressions::Expression selectByIndex(storm::expressions::Expression const& indexExpr,
+                                                 std::vector<std::pair<uint64_t, storm::expressions::Expression>> const& children, uint64_t begin,
+                                                 uint64_t end) {
+        if (begin == end) {
+            return storm::expressions::Expression();
+        } else if (begin + 1 == end) {
+            return children[begin].second;
+        }
+        uint64_t middle = begin + (end - begin) / 2;
+        return storm::expressions::ite(indexExpr < indexExpr.getManager().integer(children[middle].first), selectByIndex(indexExpr, children, begin, middle),
+                                       selectByIndex(indexExpr, children, middle, end));
+    }
+
     std::unordered_map<storm::expressions::Variable, typename ArrayEliminatorData::Replacement> const& replacements;
 };
 
@@ -39,7 +39,7 @@ void EliminateAction::doAction(JaniLocalEliminator::Session& session) {
     while (stepsWithoutChange <= edges.size()) {
         Edge edge = edges[edgeIndex];
 
-        if (edge.getGuard().containsVariables() || edge.getGuard().evaluateAsBool()) {
+        if (!session.isGuardFalse(edge.getGuard())) {
             uint64_t destCount = edge.getNumberOfDestinations();
             for (uint64_t j = 0; j < destCount; j++) {
                 const EdgeDestination& dest = edge.getDestination(j);
@@ -65,7 +65,7 @@ void EliminateAction::doAction(JaniLocalEliminator::Session& session) {
     // The elimination is now complete. To make sure nothing went wrong, we go over all the edges one more
     // time. If any are still incident to the location we want to eliminate, something went wrong.
     for (Edge& edge : automaton.getEdges()) {
-        if (!edge.getGuard().containsVariables() && !edge.getGuard().evaluateAsBool())
+        if (session.isGuardFalse(edge.getGuard()))
             continue;
         for (const EdgeDestination& dest : edge.getDestinations()) {
             if (dest.getLocationIndex() == locIndex) {
@@ -85,7 +85,7 @@ void EliminateAction::eliminateDestination(JaniLocalEliminator::Session& session
         newEdges;  // Don't add the new edges immediately -- we cannot safely iterate over the outgoing edges while adding new edges to the structure
 
     for (Edge& outEdge : outgoing) {
-        if (!outEdge.getGuard().containsVariables() && !outEdge.getGuard().evaluateAsBool())
+        if (session.isGuardFalse(outEdge.getGuard()))
             continue;
 
         expressions::Expression newGuard = session.getNewGuard(edge, dest, outEdge);
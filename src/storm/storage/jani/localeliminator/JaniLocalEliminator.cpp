@@ -284,6 +284,7 @@ Model &JaniLocalEliminator::Session::getModel() {
 
 void JaniLocalEliminator::Session::setModel(const Model &model) {
     this->model = model;
+    simplifiedGuards.clear();
 }
 
 Property &JaniLocalEliminator::Session::getProperty() {
@@ -299,8 +300,24 @@ void JaniLocalEliminator::Session::setFinished(bool finished) {
 }
 
 expressions::Expression JaniLocalEliminator::Session::getNewGuard(const Edge &edge, const EdgeDestination &dest, const Edge &outgoing) {
-    expressions::Expression wp = outgoing.getGuard().substitute(dest.getAsVariableToExpressionMap()).simplify();
-    return (edge.getGuard() && wp).simplify();
+    expressions::Expression wp = getSimplifiedGuard(outgoing.getGuard()).substitute(dest.getAsVariableToExpressionMap()).simplify();
+    expressions::Expression newGuard = (getSimplifiedGuard(edge.getGuard()) && wp).simplify();
+    // The new guard is already simplified, so there is no need to simplify it again once it is encountered later.
+    simplifiedGuards.emplace(newGuard.getBaseExpressionPointer(), newGuard);
+    return newGuard;
+}
+
+expressions::Expression JaniLocalEliminator::Session::getSimplifiedGuard(const expressions::Expression &guard) {
+    auto it = simplifiedGuards.find(guard.getBaseExpressionPointer());
+    if (it == simplifiedGuards.end()) {
+        it = simplifiedGuards.emplace(guard.getBaseExpressionPointer(), guard.simplify()).first;
+    }
+    return it->second;
+}
+
+bool JaniLocalEliminator::Session::isGuardFalse(const expressions::Expression &guard) {
+    expressions::Expression simplified = getSimplifiedGuard(guard);
+    return !simplified.containsVariables() && !simplified.evaluateAsBool();
 }
 
 expressions::Expression JaniLocalEliminator::Session::getProbability(const EdgeDestination &first, const EdgeDestination &then) {
@@ -357,6 +374,7 @@ bool JaniLocalEliminator::Session::isVariablePartOfProperty(const std::string &e
 
 void JaniLocalEliminator::Session::flatten_automata() {
     model = model.flattenComposition();
+    simplifiedGuards.clear();
     automataInfo.clear();
     buildAutomataInfo();
 }
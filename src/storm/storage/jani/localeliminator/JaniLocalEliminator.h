@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <queue>
+#include <unordered_map>
 #include "boost/variant.hpp"
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
@@ -42,6 +44,9 @@ class JaniLocalEliminator {
         void addMissingGuards(const std::string &automatonName);
 
         expressions::Expression getNewGuard(const Edge &edge, const EdgeDestination &dest, const Edge &outgoing);
+        // Guards are simplified only once and the result is reused by all elimination actions.
+        expressions::Expression getSimplifiedGuard(const expressions::Expression &guard);
+        bool isGuardFalse(const expressions::Expression &guard);
         expressions::Expression getProbability(const EdgeDestination &first, const EdgeDestination &then);
         OrderedAssignments executeInSequence(const EdgeDestination &first, const EdgeDestination &then, std::set<std::string> &rewardVariables);
         bool isEliminable(const std::string &automatonName, std::string const &locationName);
@@ -68,6 +73,8 @@ class JaniLocalEliminator {
 
         std::map<std::string, AutomatonInfo> automataInfo;
         std::set<uint_fast64_t> expressionVarsInProperty;
+        // The simplified versions of the guards that were encountered so far (indexed by the original guard).
+        std::unordered_map<std::shared_ptr<expressions::BaseExpression const>, expressions::Expression> simplifiedGuards;
     };
 
    public:
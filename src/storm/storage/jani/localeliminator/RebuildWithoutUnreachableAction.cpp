@@ -28,7 +28,7 @@ void RebuildWithoutUnreachableAction::doAction(JaniLocalEliminator::Session &ses
         std::unordered_set<const Edge *> satisfiableEdges;
 
         for (auto &oldEdge : oldAutomaton.getEdges()) {
-            if (!oldEdge.getGuard().containsVariables() && !oldEdge.getGuard().evaluateAsBool())
+            if (session.isGuardFalse(oldEdge.getGuard()))
                 continue;
             satisfiableEdges.emplace(&oldEdge);
         }
@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 #include "storm/exceptions/FileIoException.h"
@@ -963,6 +964,24 @@ ExportJsonType buildFunctionsArray(std::unordered_map<std::string, FunctionDefin
     return functionDeclarations;
 }
 
+// Maps (the string representation of) expressions that are shared within an automaton to the name of the function that represents them.
+typedef std::unordered_map<std::string, std::string> SharedExpressionNames;
+
+ExportJsonType buildSharableExpression(storm::expressions::Expression const& exp, std::vector<storm::jani::Constant> const& constants,
+                                       VariableSet const& globalVariables, VariableSet const& localVariables, SharedExpressionNames const* sharedExpressions) {
+    if (sharedExpressions != nullptr) {
+        auto sharedIt = sharedExpressions->find(exp.toString());
+        if (sharedIt != sharedExpressions->end()) {
+            ExportJsonType opDecl;
+            opDecl["op"] = "call";
+            opDecl["function"] = sharedIt->second;
+            opDecl["args"] = std::vector<ExportJsonType>();
+            return opDecl;
+        }
+    }
+    return buildExpression(exp, constants, globalVariables, localVariables);
+}
+
 ExportJsonType buildLValue(storm::jani::LValue const& lValue, std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables,
                            VariableSet const& localVariables) {
     if (lValue.isVariable()) {
@@ -982,13 +1001,14 @@ ExportJsonType buildLValue(storm::jani::LValue const& lValue, std::vector<storm:
 }
 
 ExportJsonType buildAssignmentArray(storm::jani::OrderedAssignments const& orderedAssignments, std::vector<storm::jani::Constant> const& constants,
-                                    VariableSet const& globalVariables, VariableSet const& localVariables, bool commentExpressions) {
+                                    VariableSet const& globalVariables, VariableSet const& localVariables, bool commentExpressions,
+                                    SharedExpressionNames const* sharedExpressions = nullptr) {
     ExportJsonType assignmentDeclarations = std::vector<ExportJsonType>();
     bool addIndex = orderedAssignments.hasMultipleLevels();
     for (auto const& assignment : orderedAssignments) {
         ExportJsonType assignmentEntry;
         assignmentEntry["ref"] = buildLValue(assignment.getLValue(), constants, globalVariables, localVariables);
-        assignmentEntry["value"] = buildExpression(assignment.getAssignedExpression(), constants, globalVariables, localVariables);
+        assignmentEntry["value"] = buildSharableExpression(assignment.getAssignedExpression(), constants, globalVariables, localVariables, sharedExpressions);
         if (addIndex) {
             assignmentEntry["index"] = assignment.getLevel();
         }
@@ -1032,7 +1052,7 @@ ExportJsonType buildInitialLocations(storm::jani::Automaton const& automaton) {
 
 ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destinations, std::map<uint64_t, std::string> const& locationNames,
                                  std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables, VariableSet const& localVariables,
-                                 bool commentExpressions) {
+                                 bool commentExpressions, SharedExpressionNames const* sharedExpressions = nullptr) {
     assert(destinations.size() > 0);
     ExportJsonType destDeclarations = std::vector<ExportJsonType>();
     for (auto const& destination : destinations) {
@@ -1045,14 +1065,15 @@ ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destination
             }
         }
         if (!prob1) {
-            destEntry["probability"]["exp"] = buildExpression(destination.getProbability(), constants, globalVariables, localVariables);
+            destEntry["probability"]["exp"] =
+                buildSharableExpression(destination.getProbability(), constants, globalVariables, localVariables, sharedExpressions);
             if (commentExpressions) {
                 destEntry["probability"]["comment"] = destination.getProbability().toString();
             }
         }
         if (!destination.getOrderedAssignments().empty()) {
-            destEntry["assignments"] =
-                buildAssignmentArray(destination.getOrderedAssignments(), constants, globalVariables, localVariables, commentExpressions);
+            destEntry["assignments"] = buildAssignmentArray(destination.getOrderedAssignments(), constants, globalVariables, localVariables, commentExpressions,
+                                                            sharedExpressions);
         }
         destDeclarations.push_back(std::move(destEntry));
     }
@@ -1061,7 +1082,7 @@ ExportJsonType buildDestinations(std::vector<EdgeDestination> const& destination
 
 ExportJsonType buildEdge(Edge const& edge, std::map<uint64_t, std::string> const& actionNames, std::map<uint64_t, std::string> const& locationNames,
                          std::vector<storm::jani::Constant> const& constants, VariableSet const& globalVariables, VariableSet const& localVariables,
-                         bool commentExpressions) {
+                         bool commentExpressions, SharedExpressionNames const* sharedExpressions = nullptr) {
     STORM_LOG_THROW(edge.getDestinations().size() > 0, storm::exceptions::InvalidJaniException, "An edge without destinations is not allowed.");
     ExportJsonType edgeEntry;
     edgeEntry["location"] = locationNames.at(edge.getSourceLocationIndex());
@@ -1069,20 +1090,22 @@ ExportJsonType buildEdge(Edge const& edge, std::map<uint64_t, std::string> const
         edgeEntry["action"] = actionNames.at(edge.getActionIndex());
     }
     if (edge.hasRate()) {
-        edgeEntry["rate"]["exp"] = buildExpression(edge.getRate(), constants, globalVariables, localVariables);
+        edgeEntry["rate"]["exp"] = buildSharableExpression(edge.getRate(), constants, globalVariables, localVariables, sharedExpressions);
         if (commentExpressions) {
             edgeEntry["rate"]["comment"] = edge.getRate().toString();
         }
     }
     if (!edge.getGuard().isTrue()) {
-        edgeEntry["guard"]["exp"] = buildExpression(edge.getGuard(), constants, globalVariables, localVariables);
+        edgeEntry["guard"]["exp"] = buildSharableExpression(edge.getGuard(), constants, globalVariables, localVariables, sharedExpressions);
         if (commentExpressions) {
             edgeEntry["guard"]["comment"] = edge.getGuard().toString();
         }
     }
-    edgeEntry["destinations"] = buildDestinations(edge.getDestinations(), locationNames, constants, globalVariables, localVariables, commentExpressions);
+    edgeEntry["destinations"] =
+        buildDestinations(edge.getDestinations(), locationNames, constants, globalVariables, localVariables, commentExpressions, sharedExpressions);
     if (!edge.getAssignments().empty()) {
-        edgeEntry["assignments"] = buildAssignmentArray(edge.getAssignments(), constants, globalVariables, localVariables, commentExpressions);
+        edgeEntry["assignments"] =
+            buildAssignmentArray(edge.getAssignments(), constants, globalVariables, localVariables, commentExpressions, sharedExpressions);
     }
     return edgeEntry;
 }
@@ -1207,5 +1230,277 @@ ExportJsonType JsonExporter::finalize() {
     return jsonStruct;
 }
 
+/*!
+ * Writes json to a stream piece by piece. Values are given either as (small) json objects or by opening and closing objects and arrays.
+ * The output is buffered and produces the same layout as dumping the corresponding json object.
+ */
+class JsonStreamWriter {
+   public:
+    JsonStreamWriter(std::ostream& os, bool compact) : os(os), indent(compact ? -1 : 4), pendingKey(false) {}
+
+    void beginObject() {
+        beginValue();
+        buffer.push_back('{');
+        scopeIsEmpty.push_back(true);
+    }
+
+    void endObject() {
+        endScope('}');
+    }
+
+    void beginArray() {
+        beginValue();
+        buffer.push_back('[');
+        scopeIsEmpty.push_back(true);
+    }
+
+    void endArray() {
+        endScope(']');
+    }
+
+    void key(std::string const& name) {
+        beginElement();
+        buffer.append(ExportJsonType(name).dump());
+        buffer.append(indent < 0 ? ":" : ": ");
+        pendingKey = true;
+    }
+
+    void value(ExportJsonType const& json) {
+        beginValue();
+        std::string valueString = json.dump(indent);
+        if (indent < 0) {
+            buffer.append(valueString);
+        } else {
+            // Nested lines are indented relative to the current depth. Line breaks never occur within (escaped) json strings.
+            std::string const lineStart = "\n" + std::string(scopeIsEmpty.size() * indent, ' ');
+            for (auto const& c : valueString) {
+                if (c == '\n') {
+                    buffer.append(lineStart);
+                } else {
+                    buffer.push_back(c);
+                }
+            }
+        }
+        if (buffer.size() >= bufferSize) {
+            flush();
+        }
+    }
+
+    void flush() {
+        os << buffer;
+        buffer.clear();
+    }
+
+   private:
+    void beginValue() {
+        if (pendingKey) {
+            pendingKey = false;
+        } else if (!scopeIsEmpty.empty()) {
+            beginElement();
+        }
+    }
+
+    void beginElement() {
+        if (!scopeIsEmpty.back()) {
+            buffer.push_back(',');
+        }
+        scopeIsEmpty.back() = false;
+        newLine();
+    }
+
+    void endScope(char closingCharacter) {
+        bool isEmpty = scopeIsEmpty.back();
+        scopeIsEmpty.pop_back();
+        if (!isEmpty) {
+            newLine();
+        }
+        buffer.push_back(closingCharacter);
+    }
+
+    void newLine() {
+        if (indent >= 0) {
+            buffer.push_back('\n');
+            buffer.append(scopeIsEmpty.size() * indent, ' ');
+        }
+    }
+
+    static const uint64_t bufferSize = 1 << 20;
+
+    std::ostream& os;
+    int indent;
+    bool pendingKey;
+    std::vector<bool> scopeIsEmpty;
+    std::string buffer;
+};
+
+/*!
+ * Determines the expressions of the edges of the given automaton that occur multiple times and are large enough to be worth sharing.
+ * Each such expression gets a (fresh) name and a function definition without parameters that is returned as json.
+ */
+std::vector<ExportJsonType> buildSharedExpressionFunctions(storm::jani::Automaton const& automaton, storm::jani::Model const& model,
+                                                           SharedExpressionNames& sharedExpressions) {
+    // Sharing very small expressions would only increase the size of the output.
+    uint64_t const minimalSharedExpressionLength = 16;
+    std::unordered_map<std::string, uint64_t> occurrences;
+    std::vector<storm::expressions::Expression> candidates;
+    auto addCandidate = [&occurrences, &candidates](storm::expressions::Expression const& exp) {
+        std::string expString = exp.toString();
+        if (expString.size() >= minimalSharedExpressionLength && ++occurrences[expString] == 2) {
+            candidates.push_back(exp);
+        }
+    };
+    for (auto const& edge : automaton.getEdges()) {
+        if (edge.getGuard().isFalse()) {
+            continue;
+        }
+        addCandidate(edge.getGuard());
+        if (edge.hasRate()) {
+            addCandidate(edge.getRate());
+        }
+        for (auto const& assignment : edge.getAssignments()) {
+            addCandidate(assignment.getAssignedExpression());
+        }
+        for (auto const& destination : edge.getDestinations()) {
+            addCandidate(destination.getProbability());
+            for (auto const& assignment : destination.getOrderedAssignments()) {
+                addCandidate(assignment.getAssignedExpression());
+            }
+        }
+    }
+    occurrences.clear();
+
+    std::vector<ExportJsonType> functionDeclarations;
+    uint64_t nameIndex = 0;
+    for (auto const& exp : candidates) {
+        std::string name;
+        do {
+            name = "__shared" + std::to_string(nameIndex++);
+        } while (automaton.getFunctionDefinitions().count(name) > 0 || model.getGlobalFunctionDefinitions().count(name) > 0);
+        ExportJsonType funDefJson;
+        funDefJson["name"] = name;
+        funDefJson["type"] = buildTypeDescription(exp.getType());
+        funDefJson["parameters"] = std::vector<ExportJsonType>();
+        funDefJson["body"] = buildExpression(exp, model.getConstants(), model.getGlobalVariables(), automaton.getVariables());
+        functionDeclarations.push_back(std::move(funDefJson));
+        sharedExpressions.emplace(exp.toString(), std::move(name));
+    }
+    return functionDeclarations;
+}
+
+void JsonExporter::toFileIncrementally(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::string const& filepath,
+                                       bool checkValid, bool compact, bool shareExpressions) {
+    std::ofstream stream;
+    storm::utility::openFile(filepath, stream, false, true);
+    toStreamIncrementally(janiModel, formulas, stream, checkValid, compact, shareExpressions);
+    storm::utility::closeFile(stream);
+}
+
+void JsonExporter::toStreamIncrementally(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& os,
+                                         bool checkValid, bool compact, bool shareExpressions) {
+    if (checkValid) {
+        janiModel.checkValid();
+    }
+    bool const commentExpressions = !compact;
+    auto const& constants = janiModel.getConstants();
+    auto const& globalVariables = janiModel.getGlobalVariables();
+
+    // The properties are converted first as they might affect the model features.
+    JsonExporter exporter;
+    exporter.modelFeatures = janiModel.getModelFeatures();
+    STORM_LOG_INFO("Started to convert properties of model " << janiModel.getName() << ".");
+    exporter.convertProperties(formulas, janiModel);
+
+    STORM_LOG_INFO("Started to write model " << janiModel.getName() << " incrementally.");
+    JsonStreamWriter writer(os, compact);
+    writer.beginObject();
+    writer.key("jani-version");
+    writer.value(janiModel.getJaniVersion());
+    writer.key("name");
+    writer.value(janiModel.getName());
+    writer.key("type");
+    writer.value(to_string(janiModel.getModelType()));
+    writer.key("actions");
+    writer.value(buildActionArray(janiModel.getActions()));
+    writer.key("constants");
+    writer.value(buildConstantsArray(constants));
+    writer.key("variables");
+    writer.value(buildVariablesArray(globalVariables, constants, globalVariables));
+    if (!janiModel.getGlobalFunctionDefinitions().empty()) {
+        writer.key("functions");
+        writer.value(buildFunctionsArray(janiModel.getGlobalFunctionDefinitions(), constants, globalVariables));
+    }
+    writer.key("restrict-initial");
+    writer.beginObject();
+    writer.key("exp");
+    writer.value(buildExpression(janiModel.getInitialStatesRestriction(), constants, globalVariables));
+    writer.endObject();
+
+    auto const& actionNames = janiModel.getActionIndexToNameMap();
+    writer.key("automata");
+    writer.beginArray();
+    for (auto const& automaton : janiModel.getAutomata()) {
+        auto const& localVariables = automaton.getVariables();
+        SharedExpressionNames sharedExpressions;
+        ExportJsonType functionDeclarations = std::vector<ExportJsonType>();
+        if (!automaton.getFunctionDefinitions().empty()) {
+            functionDeclarations = buildFunctionsArray(automaton.getFunctionDefinitions(), constants, globalVariables, localVariables);
+        }
+        if (shareExpressions) {
+            for (auto& funDefJson : buildSharedExpressionFunctions(automaton, janiModel, sharedExpressions)) {
+                functionDeclarations.push_back(std::move(funDefJson));
+            }
+            if (!sharedExpressions.empty()) {
+                STORM_LOG_INFO("Sharing " << sharedExpressions.size() << " expressions of automaton " << automaton.getName() << " via functions.");
+                exporter.modelFeatures.add(storm::jani::ModelFeature::Functions);
+            }
+        }
+
+        writer.beginObject();
+        writer.key("name");
+        writer.value(automaton.getName());
+        writer.key("variables");
+        writer.value(buildVariablesArray(localVariables, constants, globalVariables, localVariables));
+        if (!functionDeclarations.empty()) {
+            writer.key("functions");
+            writer.value(functionDeclarations);
+        }
+        if (automaton.hasRestrictedInitialStates()) {
+            writer.key("restrict-initial");
+            writer.beginObject();
+            writer.key("exp");
+            writer.value(buildExpression(automaton.getInitialStatesRestriction(), constants, globalVariables, localVariables));
+            writer.endObject();
+        }
+        writer.key("locations");
+        writer.value(buildLocationsArray(automaton.getLocations(), constants, globalVariables, localVariables, commentExpressions));
+        writer.key("initial-locations");
+        writer.value(buildInitialLocations(automaton));
+        auto const locationNames = automaton.buildIdToLocationNameMap();
+        writer.key("edges");
+        writer.beginArray();
+        for (auto const& edge : automaton.getEdges()) {
+            if (edge.getGuard().isFalse()) {
+                continue;
+            }
+            writer.value(buildEdge(edge, actionNames, locationNames, constants, globalVariables, localVariables, commentExpressions,
+                                   shareExpressions ? &sharedExpressions : nullptr));
+        }
+        writer.endArray();
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.key("system");
+    writer.value(CompositionJsonExporter::translate(janiModel.getSystemComposition()));
+    writer.key("properties");
+    writer.value(exporter.jsonStruct["properties"]);
+    writer.key("features");
+    writer.value(ExportJsonType::parse(exporter.modelFeatures.toString()));
+    writer.endObject();
+    writer.flush();
+    os << '\n';
+    STORM_LOG_INFO("Conversion completed " << janiModel.getName() << ".");
+}
+
 }  // namespace jani
 }  // namespace storm
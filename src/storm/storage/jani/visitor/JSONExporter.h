@@ -97,6 +97,17 @@ class JsonExporter {
     static void toStream(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& ostream,
                          bool checkValid = false, bool compact = false);
 
+    /*!
+     * Writes the model and the properties to the given file or stream. In contrast to toFile and toStream, the json representation of the whole model
+     * is never built. Instead, the automata are written edge by edge.
+     * @param shareExpressions If set, expressions that occur multiple times within an automaton are written only once as a function (without
+     * parameters) of the automaton. The occurrences are replaced by calls of the function.
+     */
+    static void toFileIncrementally(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::string const& filepath,
+                                    bool checkValid = true, bool compact = false, bool shareExpressions = false);
+    static void toStreamIncrementally(storm::jani::Model const& janiModel, std::vector<storm::jani::Property> const& formulas, std::ostream& ostream,
+                                      bool checkValid = false, bool compact = false, bool shareExpressions = false);
+
     static ExportJsonType getEdgeAsJson(storm::jani::Model const& janiModel, uint64_t automatonIndex, uint64_t edgeIndex, bool commentExpressions = true);
 
    private:
@@ -12,6 +12,7 @@
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 
@@ -66,13 +67,8 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::initialize() {
 
         computeReachableStates(initialStates);
 
-        // Compute the mapping to the states of the result
-        uint64_t reachableStateCount = 0;
-        toResultStateMapping = std::vector<uint64_t>(model.getNumberOfStates() * memoryStateCount, std::numeric_limits<uint64_t>::max());
-        for (auto reachableState : reachableStates) {
-            toResultStateMapping[reachableState] = reachableStateCount;
-            ++reachableStateCount;
-        }
+        // The state of the result that represents a reachable state is given by the number of reachable states before it.
+        resultStateIndex = std::make_unique<storm::storage::BitVectorRankIndex>(reachableStates);
 
         isInitialized = true;
     }
@@ -98,10 +94,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
     storm::storage::SparseMatrix<ValueType> transitionMatrix;
     if (scheduler) {
         transitionMatrix = buildTransitionMatrixForScheduler();
-    } else if (model.getTransitionMatrix().hasTrivialRowGrouping()) {
-        transitionMatrix = buildDeterministicTransitionMatrix();
     } else {
-        transitionMatrix = buildNondeterministicTransitionMatrix();
+        transitionMatrix = buildTransitionMatrix();
     }
     storm::models::sparse::StateLabeling labeling = buildStateLabeling(transitionMatrix);
     std::unordered_map<std::string, RewardModelType> rewardModels = buildRewardModels(transitionMatrix);
@@ -118,10 +112,10 @@ bool SparseModelMemoryProduct<ValueType, RewardModelType>::isStateReachable(uint
 }
 
 template<typename ValueType, typename RewardModelType>
-uint64_t const& SparseModelMemoryProduct<ValueType, RewardModelType>::getResultState(uint64_t const& modelState, uint64_t const& memoryState) {
+uint64_t SparseModelMemoryProduct<ValueType, RewardModelType>::getResultState(uint64_t const& modelState, uint64_t const& memoryState) {
     initialize();
     STORM_LOG_ASSERT(isStateReachable(modelState, memoryState), "Tried to get unreachable product state (" << modelState << "," << memoryState << ")");
-    return toResultStateMapping[modelState * memoryStateCount + memoryState];
+    return resultStateIndex->rank(modelState * memoryStateCount + memoryState);
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -194,63 +188,51 @@ void SparseModelMemoryProduct<ValueType, RewardModelType>::computeReachableState
 }
 
 template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildDeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        numResTransitions += model.getTransitionMatrix().getRow(stateIndex / memoryStateCount).getNumberOfEntries();
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResStates, numResStates, numResTransitions, true);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
+storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildTransitionMatrix() {
+    auto const& modelMatrix = model.getTransitionMatrix();
+    bool const hasRowGroups = !modelMatrix.hasTrivialRowGrouping();
+    std::vector<uint64_t> const resStates(reachableStates.begin(), reachableStates.end());
+    uint64_t const numResStates = resStates.size();
+
+    // Compute the row groups and the rows of the result. As every row of the result is a copy of a row of the model
+    // (with different successor states), this determines the positions of all entries beforehand.
+    std::vector<storm::storage::SparseMatrixIndexType> rowGroupIndices;
+    rowGroupIndices.reserve(numResStates + 1);
+    rowGroupIndices.push_back(0);
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications;
+    rowIndications.push_back(0);
+    for (auto stateIndex : resStates) {
         uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
-        for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-            uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-            builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+        for (uint64_t modelRow = modelMatrix.getRowGroupIndices()[modelState]; modelRow < modelMatrix.getRowGroupIndices()[modelState + 1]; ++modelRow) {
+            rowIndications.push_back(rowIndications.back() + modelMatrix.getRow(modelRow).getNumberOfEntries());
         }
-        ++currentRow;
+        rowGroupIndices.push_back(rowIndications.size() - 1);
     }
 
-    return builder.build();
-}
-
-template<typename ValueType, typename RewardModelType>
-storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildNondeterministicTransitionMatrix() {
-    uint64_t numResStates = reachableStates.getNumberOfSetBits();
-    uint64_t numResChoices = 0;
-    uint64_t numResTransitions = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        for (uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRow < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRow) {
-            ++numResChoices;
-            numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
-        }
-    }
-
-    storm::storage::SparseMatrixBuilder<ValueType> builder(numResChoices, numResStates, numResTransitions, true, true, numResStates);
-    uint64_t currentRow = 0;
-    for (auto stateIndex : reachableStates) {
-        uint64_t modelState = stateIndex / memoryStateCount;
-        uint64_t memoryState = stateIndex % memoryStateCount;
-        builder.newRowGroup(currentRow);
-        for (uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState];
-             modelRowIndex < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRowIndex) {
-            auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
-            for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+    // Fill in the entries. Since the states of the result are ordered like the model states, the successors of a row
+    // remain ordered, so the rows can be filled independently of each other.
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> columnsAndValues(rowIndications.back());
+    storm::utility::parallel::forEachChunk(
+        0, numResStates, 1024, storm::utility::parallel::getDefaultNumberOfThreads(), [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+            for (uint64_t resState = chunkBegin; resState < chunkEnd; ++resState) {
+                uint64_t modelState = resStates[resState] / memoryStateCount;
+                uint64_t memoryState = resStates[resState] % memoryStateCount;
+                auto resEntryIt = columnsAndValues.begin() + rowIndications[rowGroupIndices[resState]];
+                auto const& modelRowGroup = modelMatrix.getRowGroup(modelState);
+                for (auto entryIt = modelRowGroup.begin(); entryIt != modelRowGroup.end(); ++entryIt, ++resEntryIt) {
+                    uint64_t transitionId = entryIt - modelMatrix.begin();
+                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                    resEntryIt->setColumn(resultStateIndex->rank(entryIt->getColumn() * memoryStateCount + successorMemoryState));
+                    resEntryIt->setValue(entryIt->getValue());
+                }
             }
-            ++currentRow;
-        }
-    }
+        });
 
-    return builder.build();
+    boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> resRowGroupIndices;
+    if (hasRowGroups) {
+        resRowGroupIndices = std::move(rowGroupIndices);
+    }
+    return storm::storage::SparseMatrix<ValueType>(numResStates, std::move(rowIndications), std::move(columnsAndValues), std::move(resRowGroupIndices));
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -352,8 +334,6 @@ storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, Rewa
 template<typename ValueType, typename RewardModelType>
 storm::models::sparse::StateLabeling SparseModelMemoryProduct<ValueType, RewardModelType>::buildStateLabeling(
     storm::storage::SparseMatrix<ValueType> const& resultTransitionMatrix) {
-    uint64_t modelStateCount = model.getNumberOfStates();
-
     uint64_t numResStates = resultTransitionMatrix.getRowGroupCount();
     storm::models::sparse::StateLabeling resultLabeling(numResStates);
 
@@ -370,19 +350,32 @@ storm::models::sparse::StateLabeling SparseModelMemoryProduct<ValueType, RewardM
             resultLabeling.addLabel(modelLabel, std::move(resLabeledStates));
         }
     }
-    for (std::string memoryLabel : memory.getStateLabeling().getLabels()) {
+    // The states of the memory labels are obtained in a single pass over the reachable states.
+    std::set<std::string> const memoryLabels = memory.getStateLabeling().getLabels();
+    std::vector<storm::storage::BitVector> resLabeledStatesOfMemoryLabels;
+    std::vector<std::vector<uint64_t>> memoryStateToLabels(memoryStateCount);
+    for (auto const& memoryLabel : memoryLabels) {
         STORM_LOG_THROW(!resultLabeling.containsLabel(memoryLabel), storm::exceptions::InvalidOperationException,
                         "Failed to build the product of model and memory structure: State labelings are not disjoint as both structures contain the label "
                             << memoryLabel << ".");
-        storm::storage::BitVector resLabeledStates(numResStates, false);
         for (auto memoryState : memory.getStateLabeling().getStates(memoryLabel)) {
-            for (uint64_t modelState = 0; modelState < modelStateCount; ++modelState) {
-                if (isStateReachable(modelState, memoryState)) {
-                    resLabeledStates.set(getResultState(modelState, memoryState), true);
-                }
+            memoryStateToLabels[memoryState].push_back(resLabeledStatesOfMemoryLabels.size());
+        }
+        resLabeledStatesOfMemoryLabels.emplace_back(numResStates, false);
+    }
+    if (!memoryLabels.empty()) {
+        uint64_t resState = 0;
+        for (auto stateIndex : reachableStates) {
+            for (auto labelIndex : memoryStateToLabels[stateIndex % memoryStateCount]) {
+                resLabeledStatesOfMemoryLabels[labelIndex].set(resState, true);
             }
+            ++resState;
         }
-        resultLabeling.addLabel(memoryLabel, std::move(resLabeledStates));
+    }
+    auto resLabeledStatesIt = resLabeledStatesOfMemoryLabels.begin();
+    for (auto const& memoryLabel : memoryLabels) {
+        resultLabeling.addLabel(memoryLabel, std::move(*resLabeledStatesIt));
+        ++resLabeledStatesIt;
     }
 
     storm::storage::BitVector initialStates(numResStates, false);
@@ -450,55 +443,53 @@ std::unordered_map<std::string, RewardModelType> SparseModelMemoryProduct<ValueT
         boost::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewards;
         if (rewardModel.second.hasTransitionRewards()) {
             storm::storage::SparseMatrixBuilder<RewardValueType> builder(resultTransitionMatrix.getRowCount(), resultTransitionMatrix.getColumnCount());
-            uint64_t stateIndex = 0;
-            for (auto const& resState : toResultStateMapping) {
-                if (resState < numResStates) {
-                    uint64_t modelState = stateIndex / memoryStateCount;
-                    uint64_t memoryState = stateIndex % memoryStateCount;
-                    uint64_t rowGroupSize = resultTransitionMatrix.getRowGroupSize(resState);
-                    if (scheduler && scheduler->getChoice(modelState, memoryState).isDefined()) {
-                        std::map<uint64_t, RewardValueType> rewards;
-                        for (uint64_t rowOffset = 0; rowOffset < rowGroupSize; ++rowOffset) {
-                            uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + rowOffset;
-                            auto transitionEntryIt = model.getTransitionMatrix().getRow(modelRowIndex).begin();
-                            for (auto const& rewardEntry : rewardModel.second.getTransitionRewardMatrix().getRow(modelRowIndex)) {
-                                while (transitionEntryIt->getColumn() != rewardEntry.getColumn()) {
-                                    STORM_LOG_ASSERT(transitionEntryIt != model.getTransitionMatrix().getRow(modelRowIndex).end(),
-                                                     "The reward transition matrix is not a submatrix of the model transition matrix.");
-                                    ++transitionEntryIt;
-                                }
-                                uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                                auto insertionRes =
-                                    rewards.insert(std::make_pair(getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue()));
-                                if (!insertionRes.second) {
-                                    insertionRes.first->second += rewardEntry.getValue();
-                                }
+            uint64_t resState = 0;
+            for (auto stateIndex : reachableStates) {
+                uint64_t modelState = stateIndex / memoryStateCount;
+                uint64_t memoryState = stateIndex % memoryStateCount;
+                uint64_t rowGroupSize = resultTransitionMatrix.getRowGroupSize(resState);
+                if (scheduler && scheduler->getChoice(modelState, memoryState).isDefined()) {
+                    std::map<uint64_t, RewardValueType> rewards;
+                    for (uint64_t rowOffset = 0; rowOffset < rowGroupSize; ++rowOffset) {
+                        uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + rowOffset;
+                        auto transitionEntryIt = model.getTransitionMatrix().getRow(modelRowIndex).begin();
+                        for (auto const& rewardEntry : rewardModel.second.getTransitionRewardMatrix().getRow(modelRowIndex)) {
+                            while (transitionEntryIt->getColumn() != rewardEntry.getColumn()) {
+                                STORM_LOG_ASSERT(transitionEntryIt != model.getTransitionMatrix().getRow(modelRowIndex).end(),
+                                                 "The reward transition matrix is not a submatrix of the model transition matrix.");
+                                ++transitionEntryIt;
+                            }
+                            uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
+                            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                            auto insertionRes =
+                                rewards.insert(std::make_pair(getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue()));
+                            if (!insertionRes.second) {
+                                insertionRes.first->second += rewardEntry.getValue();
                             }
                         }
-                        uint64_t resRowIndex = resultTransitionMatrix.getRowGroupIndices()[resState];
-                        for (auto& reward : rewards) {
-                            builder.addNextValue(resRowIndex, reward.first, reward.second);
-                        }
-                    } else {
-                        for (uint64_t rowOffset = 0; rowOffset < rowGroupSize; ++rowOffset) {
-                            uint64_t resRowIndex = resultTransitionMatrix.getRowGroupIndices()[resState] + rowOffset;
-                            uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + rowOffset;
-                            auto transitionEntryIt = model.getTransitionMatrix().getRow(modelRowIndex).begin();
-                            for (auto const& rewardEntry : rewardModel.second.getTransitionRewardMatrix().getRow(modelRowIndex)) {
-                                while (transitionEntryIt->getColumn() != rewardEntry.getColumn()) {
-                                    STORM_LOG_ASSERT(transitionEntryIt != model.getTransitionMatrix().getRow(modelRowIndex).end(),
-                                                     "The reward transition matrix is not a submatrix of the model transition matrix.");
-                                    ++transitionEntryIt;
-                                }
-                                uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
-                                uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                                builder.addNextValue(resRowIndex, getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue());
+                    }
+                    uint64_t resRowIndex = resultTransitionMatrix.getRowGroupIndices()[resState];
+                    for (auto& reward : rewards) {
+                        builder.addNextValue(resRowIndex, reward.first, reward.second);
+                    }
+                } else {
+                    for (uint64_t rowOffset = 0; rowOffset < rowGroupSize; ++rowOffset) {
+                        uint64_t resRowIndex = resultTransitionMatrix.getRowGroupIndices()[resState] + rowOffset;
+                        uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState] + rowOffset;
+                        auto transitionEntryIt = model.getTransitionMatrix().getRow(modelRowIndex).begin();
+                        for (auto const& rewardEntry : rewardModel.second.getTransitionRewardMatrix().getRow(modelRowIndex)) {
+                            while (transitionEntryIt->getColumn() != rewardEntry.getColumn()) {
+                                STORM_LOG_ASSERT(transitionEntryIt != model.getTransitionMatrix().getRow(modelRowIndex).end(),
+                                                 "The reward transition matrix is not a submatrix of the model transition matrix.");
+                                ++transitionEntryIt;
                             }
+                            uint64_t transitionId = transitionEntryIt - model.getTransitionMatrix().begin();
+                            uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
+                            builder.addNextValue(resRowIndex, getResultState(rewardEntry.getColumn(), successorMemoryState), rewardEntry.getValue());
                         }
                     }
                 }
-                ++stateIndex;
+                ++resState;
             }
             transitionRewards = builder.build();
         }
@@ -524,17 +515,12 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Sparse
         auto const& modelExitRates = dynamic_cast<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType> const&>(model).getExitRates();
         auto const& modelMarkovianStates = dynamic_cast<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType> const&>(model).getMarkovianStates();
 
-        uint64_t stateIndex = 0;
-        for (auto const& resState : toResultStateMapping) {
-            if (resState < numResStates) {
-                assert(resState == resultExitRates.size());
-                uint64_t modelState = stateIndex / memoryStateCount;
-                resultExitRates.push_back(modelExitRates[modelState]);
-                if (modelMarkovianStates.get(modelState)) {
-                    resultMarkovianStates.set(resState, true);
-                }
+        for (auto stateIndex : reachableStates) {
+            uint64_t modelState = stateIndex / memoryStateCount;
+            if (modelMarkovianStates.get(modelState)) {
+                resultMarkovianStates.set(resultExitRates.size(), true);
             }
-            ++stateIndex;
+            resultExitRates.push_back(modelExitRates[modelState]);
         }
         components.markovianStates = std::move(resultMarkovianStates);
         components.exitRates = std::move(resultExitRates);
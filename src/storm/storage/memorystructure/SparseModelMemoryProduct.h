@@ -7,6 +7,7 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/memorystructure/MemoryStructure.h"
 
@@ -44,7 +45,7 @@ class SparseModelMemoryProduct {
 
     // Retrieves the state of the resulting model that represents the given memory and model state.
     // This method should only be called if the given state is reachable.
-    uint64_t const& getResultState(uint64_t const& modelState, uint64_t const& memoryState);
+    uint64_t getResultState(uint64_t const& modelState, uint64_t const& memoryState);
 
     // Invokes the building of the product under the specified scheduler (if given).
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
@@ -64,10 +65,8 @@ class SparseModelMemoryProduct {
     void computeReachableStates(storm::storage::BitVector const& initialStates);
 
     // Methods that build the model components
-    // Matrix for deterministic models
-    storm::storage::SparseMatrix<ValueType> buildDeterministicTransitionMatrix();
-    // Matrix for nondeterministic models
-    storm::storage::SparseMatrix<ValueType> buildNondeterministicTransitionMatrix();
+    // Matrix for models that do not consider a scheduler. The rows of the result are filled in parallel (using the default number of threads).
+    storm::storage::SparseMatrix<ValueType> buildTransitionMatrix();
     // Matrix for models that consider a scheduler
     storm::storage::SparseMatrix<ValueType> buildTransitionMatrixForScheduler();
     // State labeling.
@@ -86,8 +85,9 @@ class SparseModelMemoryProduct {
     // stores the successor memory states for each transition in the product
     std::vector<uint64_t> memorySuccessors;
 
-    // Maps (modelState * memoryStateCount) + memoryState to the state in the result that represents (memoryState,modelState)
-    std::vector<uint64_t> toResultStateMapping;
+    // Maps (modelState * memoryStateCount) + memoryState to the state in the result that represents (memoryState,modelState), which is the number of
+    // reachable states before it. In contrast to an explicit mapping, this takes a fraction of a bit per state of the full product.
+    std::unique_ptr<storm::storage::BitVectorRankIndex> resultStateIndex;
 
     // Indicates which states are considered reachable. (s, m) is reachable if this BitVector is true at (s * memoryStateCount) + m
     storm::storage::BitVector reachableStates;
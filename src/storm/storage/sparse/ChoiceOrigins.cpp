@@ -113,6 +113,15 @@ storm::models::sparse::ChoiceLabeling ChoiceOrigins::toChoiceLabeling() const {
     }
     return result;
 }
+
+uint64_t ChoiceOrigins::getSizeInBytes() const {
+    uint64_t result = sizeof(*this) + indexToIdentifier.capacity() * sizeof(uint_fast64_t);
+    result += identifierToInfo.capacity() * sizeof(std::string);
+    for (auto const& info : identifierToInfo) {
+        result += info.capacity();
+    }
+    return result;
+}
 }  // namespace sparse
 }  // namespace storage
 }  // namespace storm
\ No newline at end of file
@@ -95,6 +95,11 @@ class ChoiceOrigins {
 
     virtual std::size_t hash() const = 0;
 
+    /*!
+     * Retrieves the (approximate) number of bytes allocated by the choice origins. Cached json representations are not taken into account.
+     */
+    virtual uint64_t getSizeInBytes() const;
+
    protected:
     ChoiceOrigins(std::vector<uint_fast64_t> const& indexToIdentifierMapping);
     ChoiceOrigins(std::vector<uint_fast64_t>&& indexToIdentifierMapping);
@@ -0,0 +1,324 @@
+#include "storm/storage/sparse/ExternalStateStorage.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <numeric>
+#include <queue>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+namespace {
+// Marks preliminary indices of candidates that were not visited before. The remaining bits hold the smallest
+// preliminary index of a candidate with the same state.
+uint64_t const newStateFlag = 1ull << 63;
+
+std::string const visitedFilename = "visited";
+std::string const newStatesFilename = "new";
+std::string const candidatesFilename = "candidates";
+std::string const layerFilename = "layer";
+std::string const nextLayerFilename = "layer.next";
+std::string const runFilename = "run";
+
+void openForWriting(std::string const& filename, std::ofstream& stream) {
+    stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+}
+
+void writeWords(std::ofstream& stream, uint64_t const* words, uint64_t numberOfWords) {
+    stream.write(reinterpret_cast<char const*>(words), numberOfWords * sizeof(uint64_t));
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write temporary file of state storage.");
+}
+
+/*!
+ * Reads a file of records, each of which consists of the words of a state followed by one word of payload.
+ */
+class RecordReader {
+   public:
+    RecordReader(std::string const& filename, uint64_t numberOfWords) : stream(filename, std::ios::in | std::ios::binary), record(numberOfWords + 1) {
+        STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+        advance();
+    }
+
+    bool isValid() const {
+        return valid;
+    }
+
+    uint64_t const* getState() const {
+        return record.data();
+    }
+
+    uint64_t getPayload() const {
+        return record.back();
+    }
+
+    void advance() {
+        valid = static_cast<bool>(stream.read(reinterpret_cast<char*>(record.data()), record.size() * sizeof(uint64_t)));
+    }
+
+   private:
+    std::ifstream stream;
+    std::vector<uint64_t> record;
+    bool valid;
+};
+
+int compareStates(uint64_t const* first, uint64_t const* second, uint64_t numberOfWords) {
+    for (uint64_t word = 0; word < numberOfWords; ++word) {
+        if (first[word] != second[word]) {
+            return first[word] < second[word] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+}  // namespace
+
+template<typename StateType>
+ExternalStateStorage<StateType>::ExternalStateStorage(std::string const& directory, uint64_t bitsPerState, uint64_t memoryLimit)
+    : directory(directory),
+      bitsPerState(bitsPerState),
+      numberOfWords((bitsPerState + 63) / 64),
+      candidates(bitsPerState, 1000),
+      numberOfCandidates(0),
+      numberOfRuns(0),
+      nextStateIndex(0),
+      numberOfStates(0),
+      numberOfLayers(0),
+      wordBuffer(numberOfWords) {
+    // Besides the buckets of the hash map (which is not filled completely), the candidates are copied once more when
+    // they are sorted.
+    uint64_t bytesPerCandidate = 3 * (numberOfWords + 1) * sizeof(uint64_t);
+    maximalNumberOfCandidatesInMemory = std::max<uint64_t>(memoryLimit / bytesPerCandidate, 1);
+
+    // Initially, no state was visited.
+    std::ofstream visitedStream;
+    openForWriting(getFilename(visitedFilename), visitedStream);
+    openForWriting(getFilename(candidatesFilename), candidateStream);
+    openForWriting(getFilename(nextLayerFilename), nextLayerStream);
+}
+
+template<typename StateType>
+ExternalStateStorage<StateType>::~ExternalStateStorage() {
+    candidateStream.close();
+    layerStream.close();
+    nextLayerStream.close();
+    std::error_code error;
+    for (auto const& name : {visitedFilename, newStatesFilename, candidatesFilename, layerFilename, nextLayerFilename}) {
+        std::filesystem::remove(getFilename(name), error);
+    }
+    for (uint64_t run = 0; run < numberOfRuns; ++run) {
+        std::filesystem::remove(getFilename(runFilename + std::to_string(run)), error);
+    }
+}
+
+template<typename StateType>
+StateType ExternalStateStorage<StateType>::registerCandidate(storm::storage::BitVector const& state) {
+    StateType newIndex = static_cast<StateType>(numberOfCandidates);
+    StateType index = candidates.findOrAdd(state, newIndex);
+    if (index == newIndex) {
+        writeWords(candidateStream, state.getWords(), numberOfWords);
+        ++numberOfCandidates;
+        if (candidates.size() >= maximalNumberOfCandidatesInMemory) {
+            flushCandidates();
+        }
+    }
+    return index;
+}
+
+template<typename StateType>
+void ExternalStateStorage<StateType>::flushCandidates() {
+    if (candidates.size() == 0) {
+        return;
+    }
+
+    // Copy the candidates to a contiguous buffer, sort them and write them to a new run.
+    uint64_t const recordSize = numberOfWords + 1;
+    std::vector<uint64_t> records;
+    records.reserve(candidates.size() * recordSize);
+    for (auto const& stateIndexPair : candidates) {
+        records.insert(records.end(), stateIndexPair.first.getWords(), stateIndexPair.first.getWords() + numberOfWords);
+        records.push_back(stateIndexPair.second);
+    }
+    candidates = storm::storage::BitVectorHashMap<StateType>(bitsPerState, 1000);
+
+    std::vector<uint64_t> order(records.size() / recordSize);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](uint64_t first, uint64_t second) {
+        return compareStates(records.data() + first * recordSize, records.data() + second * recordSize, numberOfWords) < 0;
+    });
+
+    std::ofstream runStream;
+    openForWriting(getFilename(runFilename + std::to_string(numberOfRuns)), runStream);
+    for (auto record : order) {
+        writeWords(runStream, records.data() + record * recordSize, recordSize);
+    }
+    ++numberOfRuns;
+}
+
+template<typename StateType>
+std::vector<uint64_t> const& ExternalStateStorage<StateType>::resolveCandidates() {
+    flushCandidates();
+    candidateStream.close();
+    candidateIndices.assign(numberOfCandidates, 0);
+
+    // First, merge the runs with the visited states. Candidates of visited states directly obtain their index. The
+    // (distinct) new states are written to a file in sorted order and their candidates are linked to the candidate
+    // that was registered first.
+    {
+        std::vector<std::unique_ptr<RecordReader>> runs;
+        for (uint64_t run = 0; run < numberOfRuns; ++run) {
+            runs.push_back(std::make_unique<RecordReader>(getFilename(runFilename + std::to_string(run)), numberOfWords));
+        }
+        auto runGreater = [&](uint64_t first, uint64_t second) { return compareStates(runs[first]->getState(), runs[second]->getState(), numberOfWords) > 0; };
+        std::priority_queue<uint64_t, std::vector<uint64_t>, decltype(runGreater)> queue(runGreater);
+        for (uint64_t run = 0; run < numberOfRuns; ++run) {
+            if (runs[run]->isValid()) {
+                queue.push(run);
+            }
+        }
+
+        RecordReader visited(getFilename(visitedFilename), numberOfWords);
+        std::ofstream newStatesStream;
+        openForWriting(getFilename(newStatesFilename), newStatesStream);
+        std::vector<uint64_t> state(numberOfWords);
+        std::vector<uint64_t> candidatesOfState;
+        while (!queue.empty()) {
+            std::copy_n(runs[queue.top()]->getState(), numberOfWords, state.begin());
+            candidatesOfState.clear();
+            while (!queue.empty() && compareStates(runs[queue.top()]->getState(), state.data(), numberOfWords) == 0) {
+                uint64_t run = queue.top();
+                queue.pop();
+                candidatesOfState.push_back(runs[run]->getPayload());
+                runs[run]->advance();
+                if (runs[run]->isValid()) {
+                    queue.push(run);
+                }
+            }
+
+            while (visited.isValid() && compareStates(visited.getState(), state.data(), numberOfWords) < 0) {
+                visited.advance();
+            }
+            if (visited.isValid() && compareStates(visited.getState(), state.data(), numberOfWords) == 0) {
+                for (auto candidate : candidatesOfState) {
+                    candidateIndices[candidate] = visited.getPayload();
+                }
+            } else {
+                uint64_t firstCandidate = *std::min_element(candidatesOfState.begin(), candidatesOfState.end());
+                for (auto candidate : candidatesOfState) {
+                    candidateIndices[candidate] = newStateFlag | firstCandidate;
+                }
+                writeWords(newStatesStream, state.data(), numberOfWords);
+                writeWords(newStatesStream, &firstCandidate, 1);
+            }
+        }
+    }
+
+    // Then, number the new states in the order of their first candidate, which also determines the order of the next
+    // layer.
+    {
+        std::ifstream registeredStream(getFilename(candidatesFilename), std::ios::in | std::ios::binary);
+        STORM_LOG_THROW(registeredStream, storm::exceptions::FileIoException, "Could not open file " << getFilename(candidatesFilename) << ".");
+        for (uint64_t candidate = 0; candidate < numberOfCandidates; ++candidate) {
+            registeredStream.read(reinterpret_cast<char*>(wordBuffer.data()), numberOfWords * sizeof(uint64_t));
+            STORM_LOG_THROW(registeredStream, storm::exceptions::FileIoException, "Could not read file " << getFilename(candidatesFilename) << ".");
+            uint64_t& index = candidateIndices[candidate];
+            if ((index & newStateFlag) == 0) {
+                continue;
+            }
+            uint64_t firstCandidate = index & ~newStateFlag;
+            if (firstCandidate == candidate) {
+                index = numberOfStates++;
+                writeWords(nextLayerStream, wordBuffer.data(), numberOfWords);
+            } else {
+                index = candidateIndices[firstCandidate];
+            }
+        }
+    }
+
+    // Finally, merge the new states into the visited states.
+    {
+        std::ofstream mergedStream;
+        openForWriting(getFilename(visitedFilename + ".next"), mergedStream);
+        RecordReader visited(getFilename(visitedFilename), numberOfWords);
+        RecordReader newStates(getFilename(newStatesFilename), numberOfWords);
+        while (visited.isValid() || newStates.isValid()) {
+            if (!newStates.isValid() || (visited.isValid() && compareStates(visited.getState(), newStates.getState(), numberOfWords) < 0)) {
+                writeWords(mergedStream, visited.getState(), numberOfWords + 1);
+                visited.advance();
+            } else {
+                uint64_t index = candidateIndices[newStates.getPayload()];
+                writeWords(mergedStream, newStates.getState(), numberOfWords);
+                writeWords(mergedStream, &index, 1);
+                newStates.advance();
+            }
+        }
+    }
+    std::filesystem::rename(getFilename(visitedFilename + ".next"), getFilename(visitedFilename));
+
+    // Clean up the files of the candidates.
+    std::error_code error;
+    std::filesystem::remove(getFilename(newStatesFilename), error);
+    for (uint64_t run = 0; run < numberOfRuns; ++run) {
+        std::filesystem::remove(getFilename(runFilename + std::to_string(run)), error);
+    }
+    numberOfRuns = 0;
+    numberOfCandidates = 0;
+    openForWriting(getFilename(candidatesFilename), candidateStream);
+
+    return candidateIndices;
+}
+
+template<typename StateType>
+bool ExternalStateStorage<StateType>::beginLayer() {
+    STORM_LOG_ASSERT(numberOfCandidates == 0, "Unresolved candidates when starting a new layer.");
+    nextStateIndex = numberOfStates - nextLayerStream.tellp() / (numberOfWords * sizeof(uint64_t));
+    nextLayerStream.close();
+    STORM_LOG_THROW(nextLayerStream, storm::exceptions::FileIoException, "Could not write file " << getFilename(nextLayerFilename) << ".");
+    if (nextStateIndex == numberOfStates) {
+        return false;
+    }
+
+    layerStream.close();
+    std::filesystem::rename(getFilename(nextLayerFilename), getFilename(layerFilename));
+    layerStream.clear();
+    layerStream.open(getFilename(layerFilename), std::ios::in | std::ios::binary);
+    STORM_LOG_THROW(layerStream, storm::exceptions::FileIoException, "Could not open file " << getFilename(layerFilename) << ".");
+    openForWriting(getFilename(nextLayerFilename), nextLayerStream);
+    ++numberOfLayers;
+    return true;
+}
+
+template<typename StateType>
+bool ExternalStateStorage<StateType>::getNextState(storm::storage::BitVector& state, StateType& index) {
+    if (!layerStream.is_open() || !layerStream.read(reinterpret_cast<char*>(wordBuffer.data()), numberOfWords * sizeof(uint64_t))) {
+        return false;
+    }
+    state = storm::storage::BitVector::fromWords(bitsPerState, wordBuffer.data());
+    index = static_cast<StateType>(nextStateIndex++);
+    return true;
+}
+
+template<typename StateType>
+uint64_t ExternalStateStorage<StateType>::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+template<typename StateType>
+uint64_t ExternalStateStorage<StateType>::getNumberOfLayers() const {
+    return numberOfLayers;
+}
+
+template<typename StateType>
+std::string ExternalStateStorage<StateType>::getFilename(std::string const& name) const {
+    return (std::filesystem::path(directory) / name).string();
+}
+
+template class ExternalStateStorage<uint32_t>;
+template class ExternalStateStorage<uint_fast64_t>;
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * A structure holding the reachable state space of a breadth-first exploration on disk. The states are explored layer
+ * by layer. While a layer is explored, the successor states are registered as candidates, which receive preliminary
+ * indices. Only a bounded number of candidates is kept in memory; once this bound is reached, the candidates are
+ * written to a sorted run on disk. After the layer has been explored, the runs are merged with the (sorted) set of
+ * visited states. This detects duplicates, assigns indices to the new states and yields the states of the next layer.
+ *
+ * New states are numbered in the order in which they were first registered as a candidate. Hence, the indices coincide
+ * with the indices that a breadth-first exploration with an in-memory state storage assigns.
+ */
+template<typename StateType>
+class ExternalStateStorage {
+   public:
+    /*!
+     * Creates an empty state storage whose files are placed in the given directory.
+     *
+     * @param directory The (existing) directory in which the files are created.
+     * @param bitsPerState The number of bits of each state.
+     * @param memoryLimit The (approximate) number of bytes that the candidates kept in memory may occupy.
+     */
+    ExternalStateStorage(std::string const& directory, uint64_t bitsPerState, uint64_t memoryLimit);
+
+    ExternalStateStorage(ExternalStateStorage const&) = delete;
+    ExternalStateStorage& operator=(ExternalStateStorage const&) = delete;
+
+    ~ExternalStateStorage();
+
+    /*!
+     * Registers the given state as a successor of the current layer.
+     *
+     * @return The preliminary index of the state, whose actual index is known after the candidates were resolved.
+     */
+    StateType registerCandidate(storm::storage::BitVector const& state);
+
+    /*!
+     * Resolves all candidates that were registered since the last call. Candidates that were not visited before are
+     * assigned new indices and become the states of the next layer.
+     *
+     * @return A vector that maps the preliminary indices to the actual indices. It remains valid until the next call.
+     */
+    std::vector<uint64_t> const& resolveCandidates();
+
+    /*!
+     * Starts the exploration of the next layer, i.e. the states that were newly found when resolving the candidates.
+     *
+     * @return False iff the next layer is empty, i.e. the exploration is complete.
+     */
+    bool beginLayer();
+
+    /*!
+     * Retrieves the next state of the current layer, if there is one.
+     *
+     * @param state If there is a state left, it is written to this bit vector.
+     * @param index If there is a state left, its index is written here.
+     * @return True iff there was a state left.
+     */
+    bool getNextState(storm::storage::BitVector& state, StateType& index);
+
+    /*!
+     * Retrieves the number of states that were assigned an index so far.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Retrieves the number of layers that were started so far.
+     */
+    uint64_t getNumberOfLayers() const;
+
+   private:
+    // Writes the candidates that are in memory to a sorted run on disk.
+    void flushCandidates();
+
+    std::string getFilename(std::string const& name) const;
+
+    std::string directory;
+    uint64_t bitsPerState;
+    uint64_t numberOfWords;
+
+    // The bound on the number of candidates in memory and the candidates themselves.
+    uint64_t maximalNumberOfCandidatesInMemory;
+    storm::storage::BitVectorHashMap<StateType> candidates;
+
+    // The number of candidates of the current layer and the candidates in the order in which they were registered.
+    uint64_t numberOfCandidates;
+    std::ofstream candidateStream;
+    uint64_t numberOfRuns;
+
+    // The actual indices of the candidates that were resolved last.
+    std::vector<uint64_t> candidateIndices;
+
+    // The states of the layer being explored and the layer that is to be explored next.
+    std::ifstream layerStream;
+    std::ofstream nextLayerStream;
+    uint64_t nextStateIndex;
+    uint64_t numberOfStates;
+    uint64_t numberOfLayers;
+    std::vector<uint64_t> wordBuffer;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -86,6 +86,15 @@ void JaniChoiceOrigins::computeIdentifierJson() const {
 std::size_t JaniChoiceOrigins::hash() const {
     return 0;
 }
+
+uint64_t JaniChoiceOrigins::getSizeInBytes() const {
+    uint64_t result = ChoiceOrigins::getSizeInBytes() + sizeof(*this) - sizeof(ChoiceOrigins);
+    result += identifierToEdgeIndexSet.capacity() * sizeof(identifierToEdgeIndexSet.front());
+    for (auto const& set : identifierToEdgeIndexSet) {
+        result += set.capacity() * sizeof(uint_fast64_t);
+    }
+    return result;
+}
 }  // namespace sparse
 }  // namespace storage
 }  // namespace storm
@@ -51,6 +51,8 @@ class JaniChoiceOrigins : public ChoiceOrigins {
 
     std::size_t hash() const override;
 
+    virtual uint64_t getSizeInBytes() const override;
+
    private:
     /*
      * Returns a copy of this object where the mapping of choice indices to origin identifiers is replaced by the given one.
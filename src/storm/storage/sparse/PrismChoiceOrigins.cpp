@@ -166,6 +166,15 @@ void PrismChoiceOrigins::computeIdentifierJson() const {
 std::size_t PrismChoiceOrigins::hash() const {
     return 0;
 }
+
+uint64_t PrismChoiceOrigins::getSizeInBytes() const {
+    uint64_t result = ChoiceOrigins::getSizeInBytes() + sizeof(*this) - sizeof(ChoiceOrigins);
+    result += identifierToCommandSet.capacity() * sizeof(identifierToCommandSet.front());
+    for (auto const& set : identifierToCommandSet) {
+        result += set.capacity() * sizeof(uint_fast64_t);
+    }
+    return result;
+}
 }  // namespace sparse
 }  // namespace storage
 }  // namespace storm
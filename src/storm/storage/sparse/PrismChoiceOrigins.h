@@ -52,6 +52,8 @@ class PrismChoiceOrigins : public ChoiceOrigins {
 
     std::size_t hash() const override;
 
+    virtual uint64_t getSizeInBytes() const override;
+
    protected:
     /*
      * Returns a copy of this object where the mapping of choice indices to origin identifiers is replaced by the given one.
@@ -5,8 +5,14 @@ namespace storage {
 namespace sparse {
 
 template<typename StateType>
-StateStorage<StateType>::StateStorage(uint64_t bitsPerState)
-    : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+StateStorage<StateType>::StateStorage(uint64_t bitsPerState, bool fingerprinted)
+    : stateToId(bitsPerState, 100000, fingerprinted), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+StateStorage<StateType>::StateStorage(uint64_t bitsPerState, std::vector<uint_fast64_t> const& componentBitOffsets)
+    : stateToId(bitsPerState, componentBitOffsets), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
     // Intentionally left empty.
 }
 
@@ -15,6 +21,11 @@ uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
     return stateToId.size();
 }
 
+template<typename StateType>
+uint64_t StateStorage<StateType>::getSizeInMemory() const {
+    return stateToId.getSizeInMemory() + (initialStateIndices.capacity() + deadlockStateIndices.capacity()) * sizeof(StateType);
+}
+
 template struct StateStorage<uint32_t>;
 template struct StateStorage<uint_fast64_t>;
 }  // namespace sparse
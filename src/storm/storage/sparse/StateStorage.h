@@ -1,8 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
-#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/sparse/StateToIdMap.h"
 
 namespace storm {
 namespace storage {
@@ -11,11 +12,16 @@ namespace sparse {
 // A structure holding information about the reachable state space while building it.
 template<typename StateType>
 struct StateStorage {
-    // Creates an empty state storage structure for storing states of the given bit width.
-    StateStorage(uint64_t bitsPerState);
+    // Creates an empty state storage structure for storing states of the given bit width. If requested, the states are
+    // stored in a FingerprintBitVectorHashMap.
+    StateStorage(uint64_t bitsPerState, bool fingerprinted = false);
+
+    // Creates an empty state storage structure for storing states of the given bit width that tree-compresses the
+    // states along the components starting at the given bit offsets.
+    StateStorage(uint64_t bitsPerState, std::vector<uint_fast64_t> const& componentBitOffsets);
 
     // This member stores all the states and maps them to their unique indices.
-    storm::storage::BitVectorHashMap<StateType> stateToId;
+    StateToIdMap<StateType> stateToId;
 
     // A list of initial states in terms of their global indices.
     std::vector<StateType> initialStateIndices;
@@ -28,6 +34,9 @@ struct StateStorage {
 
     // Get the number of states that were found in the exploration so far.
     uint64_t getNumberOfStates() const;
+
+    // Get the (approximate) number of bytes occupied by the stored states and indices.
+    uint64_t getSizeInMemory() const;
 };
 
 }  // namespace sparse
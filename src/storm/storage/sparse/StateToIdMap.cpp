@@ -0,0 +1,194 @@
+#include "storm/storage/sparse/StateToIdMap.h"
+
+#include <limits>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMapIterator::StateToIdMapIterator(typename storm::storage::BitVectorHashMap<StateType>::const_iterator const& iterator)
+    : uncompressedIterator(iterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMapIterator::StateToIdMapIterator(
+    typename storm::storage::FingerprintBitVectorHashMap<StateType>::const_iterator const& iterator)
+    : fingerprintedIterator(iterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMapIterator::StateToIdMapIterator(
+    typename storm::storage::TreeCompressedBitVectorMap<StateType>::const_iterator const& iterator)
+    : compressedIterator(iterator) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::StateToIdMapIterator::operator==(StateToIdMapIterator const& other) const {
+    if (compressedIterator) {
+        return other.compressedIterator && compressedIterator.get() == other.compressedIterator.get();
+    }
+    if (fingerprintedIterator) {
+        return other.fingerprintedIterator && fingerprintedIterator.get() == other.fingerprintedIterator.get();
+    }
+    return other.uncompressedIterator && uncompressedIterator.get() == other.uncompressedIterator.get();
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::StateToIdMapIterator::operator!=(StateToIdMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::StateToIdMapIterator& StateToIdMap<StateType>::StateToIdMapIterator::operator++(int) {
+    return ++(*this);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::StateToIdMapIterator& StateToIdMap<StateType>::StateToIdMapIterator::operator++() {
+    if (compressedIterator) {
+        ++compressedIterator.get();
+    } else if (fingerprintedIterator) {
+        ++fingerprintedIterator.get();
+    } else {
+        ++uncompressedIterator.get();
+    }
+    return *this;
+}
+
+template<typename StateType>
+std::pair<storm::storage::BitVector, StateType> StateToIdMap<StateType>::StateToIdMapIterator::operator*() const {
+    if (compressedIterator) {
+        return *compressedIterator.get();
+    }
+    return fingerprintedIterator ? *fingerprintedIterator.get() : *uncompressedIterator.get();
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, bool fingerprinted) {
+    if (fingerprinted) {
+        fingerprintedMap = storm::storage::FingerprintBitVectorHashMap<StateType>(bitsPerState, initialSize);
+    } else {
+        uncompressedMap = storm::storage::BitVectorHashMap<StateType>(bitsPerState, initialSize);
+    }
+}
+
+template<typename StateType>
+StateToIdMap<StateType>::StateToIdMap(uint64_t bitsPerState, std::vector<uint_fast64_t> const& componentBitOffsets)
+    : compressedMap(storm::storage::TreeCompressedBitVectorMap<StateType>(bitsPerState, componentBitOffsets)) {
+    // Intentionally left empty.
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::isCompressed() const {
+    return static_cast<bool>(compressedMap);
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::findOrAdd(storm::storage::BitVector const& state, StateType const& value) {
+    if (compressedMap) {
+        return compressedMap->findOrAdd(state, value);
+    }
+    return fingerprintedMap ? fingerprintedMap->findOrAdd(state, value) : uncompressedMap->findOrAdd(state, value);
+}
+
+template<typename StateType>
+std::pair<StateType, uint64_t> StateToIdMap<StateType>::findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& value) {
+    if (compressedMap) {
+        return compressedMap->findOrAddAndGetBucket(state, value);
+    }
+    return fingerprintedMap ? fingerprintedMap->findOrAddAndGetBucket(state, value) : uncompressedMap->findOrAddAndGetBucket(state, value);
+}
+
+template<typename StateType>
+std::pair<storm::storage::BitVector, StateType> StateToIdMap<StateType>::getBucketAndValue(uint64_t bucket) const {
+    if (compressedMap) {
+        return compressedMap->getBucketAndValue(bucket);
+    }
+    return fingerprintedMap ? fingerprintedMap->getBucketAndValue(bucket) : uncompressedMap->getBucketAndValue(bucket);
+}
+
+template<typename StateType>
+StateType StateToIdMap<StateType>::getValue(storm::storage::BitVector const& state) const {
+    if (compressedMap) {
+        return compressedMap->getValue(state);
+    }
+    return fingerprintedMap ? fingerprintedMap->getValue(state) : uncompressedMap->getValue(state);
+}
+
+template<typename StateType>
+bool StateToIdMap<StateType>::contains(storm::storage::BitVector const& state) const {
+    if (compressedMap) {
+        return compressedMap->contains(state);
+    }
+    return fingerprintedMap ? fingerprintedMap->contains(state) : uncompressedMap->contains(state);
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::begin() const {
+    if (compressedMap) {
+        return const_iterator(compressedMap->begin());
+    }
+    return fingerprintedMap ? const_iterator(fingerprintedMap->begin()) : const_iterator(uncompressedMap->begin());
+}
+
+template<typename StateType>
+typename StateToIdMap<StateType>::const_iterator StateToIdMap<StateType>::end() const {
+    if (compressedMap) {
+        return const_iterator(compressedMap->end());
+    }
+    return fingerprintedMap ? const_iterator(fingerprintedMap->end()) : const_iterator(uncompressedMap->end());
+}
+
+template<typename StateType>
+uint64_t StateToIdMap<StateType>::size() const {
+    if (compressedMap) {
+        return compressedMap->size();
+    }
+    return fingerprintedMap ? fingerprintedMap->size() : uncompressedMap->size();
+}
+
+template<typename StateType>
+uint64_t StateToIdMap<StateType>::getSizeInMemory() const {
+    if (compressedMap) {
+        return compressedMap->getSizeInMemory();
+    }
+    return fingerprintedMap ? fingerprintedMap->getSizeInMemory() : uncompressedMap->getSizeInMemory();
+}
+
+template<typename StateType>
+double StateToIdMap<StateType>::getLoadFactor() const {
+    if (compressedMap) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    uint64_t capacity = fingerprintedMap ? fingerprintedMap->capacity() : uncompressedMap->capacity();
+    return capacity == 0 ? 0.0 : static_cast<double>(size()) / capacity;
+}
+
+template<typename StateType>
+void StateToIdMap<StateType>::remap(std::function<StateType(StateType const&)> const& remapping) {
+    if (compressedMap) {
+        compressedMap->remap(remapping);
+    } else if (fingerprintedMap) {
+        fingerprintedMap->remap(remapping);
+    } else {
+        uncompressedMap->remap(remapping);
+    }
+}
+
+template<typename StateType>
+storm::storage::TreeCompressedBitVectorMap<StateType> const& StateToIdMap<StateType>::getCompressedMap() const {
+    STORM_LOG_ASSERT(compressedMap, "The states are not stored tree-compressed.");
+    return compressedMap.get();
+}
+
+template class StateToIdMap<uint32_t>;
+template class StateToIdMap<uint_fast64_t>;
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
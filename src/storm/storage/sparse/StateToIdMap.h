@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/FingerprintBitVectorHashMap.h"
+#include "storm/storage/TreeCompressedBitVectorMap.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * A map from states (in their bit vector encoding) to their indices. Depending on how it is constructed, the states are
+ * either stored in full in a BitVectorHashMap or a FingerprintBitVectorHashMap or tree-compressed in a
+ * TreeCompressedBitVectorMap. All of them offer the same interface, which is forwarded by this class.
+ */
+template<typename StateType>
+class StateToIdMap {
+   public:
+    class StateToIdMapIterator {
+       public:
+        StateToIdMapIterator(typename storm::storage::BitVectorHashMap<StateType>::const_iterator const& iterator);
+        StateToIdMapIterator(typename storm::storage::FingerprintBitVectorHashMap<StateType>::const_iterator const& iterator);
+        StateToIdMapIterator(typename storm::storage::TreeCompressedBitVectorMap<StateType>::const_iterator const& iterator);
+
+        // Methods to compare two iterators.
+        bool operator==(StateToIdMapIterator const& other) const;
+        bool operator!=(StateToIdMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        StateToIdMapIterator& operator++(int);
+        StateToIdMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to state and its index.
+        std::pair<storm::storage::BitVector, StateType> operator*() const;
+
+       private:
+        // Exactly one of the iterators is set.
+        boost::optional<typename storm::storage::BitVectorHashMap<StateType>::const_iterator> uncompressedIterator;
+        boost::optional<typename storm::storage::FingerprintBitVectorHashMap<StateType>::const_iterator> fingerprintedIterator;
+        boost::optional<typename storm::storage::TreeCompressedBitVectorMap<StateType>::const_iterator> compressedIterator;
+    };
+
+    typedef StateToIdMapIterator const_iterator;
+
+    /*!
+     * Creates a map that stores the states in full.
+     *
+     * @param bitsPerState The number of bits of each state.
+     * @param initialSize The number of states for which space is initially reserved.
+     * @param fingerprinted If set, the states are stored in a FingerprintBitVectorHashMap, which is faster if most
+     * of the looked up states are already contained.
+     */
+    StateToIdMap(uint64_t bitsPerState, uint64_t initialSize, bool fingerprinted = false);
+
+    /*!
+     * Creates a map that stores the states tree-compressed.
+     *
+     * @param bitsPerState The number of bits of each state.
+     * @param componentBitOffsets The bit offsets at which the components of the states start.
+     */
+    StateToIdMap(uint64_t bitsPerState, std::vector<uint_fast64_t> const& componentBitOffsets);
+
+    /*!
+     * Retrieves whether the states are stored tree-compressed.
+     */
+    bool isCompressed() const;
+
+    // The following methods are forwarded to the underlying map. See BitVectorHashMap for their documentation.
+    StateType findOrAdd(storm::storage::BitVector const& state, StateType const& value);
+    std::pair<StateType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& state, StateType const& value);
+    std::pair<storm::storage::BitVector, StateType> getBucketAndValue(uint64_t bucket) const;
+    StateType getValue(storm::storage::BitVector const& state) const;
+    bool contains(storm::storage::BitVector const& state) const;
+    const_iterator begin() const;
+    const_iterator end() const;
+    uint64_t size() const;
+    uint64_t getSizeInMemory() const;
+    void remap(std::function<StateType(StateType const&)> const& remapping);
+
+    /*!
+     * Retrieves the fraction of occupied buckets of the underlying hash map. As tree-compressed states are not hashed, this is NaN for them.
+     */
+    double getLoadFactor() const;
+
+    /*!
+     * Retrieves the compressed map. May only be called if the states are stored tree-compressed.
+     */
+    storm::storage::TreeCompressedBitVectorMap<StateType> const& getCompressedMap() const;
+
+   private:
+    // Exactly one of the maps is set.
+    boost::optional<storm::storage::BitVectorHashMap<StateType>> uncompressedMap;
+    boost::optional<storm::storage::FingerprintBitVectorHashMap<StateType>> fingerprintedMap;
+    boost::optional<storm::storage::TreeCompressedBitVectorMap<StateType>> compressedMap;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
@@ -1,5 +1,8 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/exceptions/InvalidTypeException.h"
@@ -10,19 +13,127 @@ namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+// The number of bits needed to store the given difference.
+static uint64_t getNumberOfBits(uint64_t difference) {
+    uint64_t result = 0;
+    while (result < 64 && (difference >> result) != 0) {
+        ++result;
+    }
+    return result;
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+int64_t StateValuations::IntegerColumn::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < size, "Invalid index " << index << " in column of size " << size << ".");
+    if (bitsPerValue == 0) {
+        return base;
+    }
+    // The arithmetic is performed on unsigned integers, such that differences of up to 64 bits do not overflow.
+    return static_cast<int64_t>(static_cast<uint64_t>(base) + bits.getAsInt(index * bitsPerValue, bitsPerValue));
+}
+
+void StateValuations::IntegerColumn::set(uint64_t index, int64_t value) {
+    STORM_LOG_ASSERT(index < size, "Invalid index " << index << " in column of size " << size << ".");
+    if (!hasValue) {
+        // All entries are unset, so we can simply move the base.
+        hasValue = true;
+        base = lowest = highest = value;
+    } else {
+        lowest = std::min(lowest, value);
+        highest = std::max(highest, value);
+        bool representable = bitsPerValue == 64 || (value >= base && static_cast<uint64_t>(value) - static_cast<uint64_t>(base) < (1ull << bitsPerValue));
+        if (!representable) {
+            // Add at least one bit, such that the column is re-packed at most 64 times.
+            uint64_t newBitsPerValue =
+                std::max(bitsPerValue + 1, getNumberOfBits(static_cast<uint64_t>(highest) - static_cast<uint64_t>(std::min(base, value))));
+            int64_t newBase = base;
+            if (value < base) {
+                // Use the additional bits to also represent values below the given one.
+                uint64_t maxDifference = newBitsPerValue == 64 ? -1ull : (1ull << newBitsPerValue) - 1;
+                uint64_t slack = maxDifference - (static_cast<uint64_t>(highest) - static_cast<uint64_t>(value));
+                uint64_t distanceToMinimum = static_cast<uint64_t>(value) - static_cast<uint64_t>(std::numeric_limits<int64_t>::min());
+                newBase = static_cast<int64_t>(static_cast<uint64_t>(value) - std::min(slack, distanceToMinimum));
+            }
+            repack(newBase, newBitsPerValue, bits.size() / std::max<uint64_t>(bitsPerValue, 1));
+        }
+    }
+    if (bitsPerValue > 0) {
+        bits.setFromInt(index * bitsPerValue, bitsPerValue, static_cast<uint64_t>(value) - static_cast<uint64_t>(base));
+    }
+}
+
+void StateValuations::IntegerColumn::grow(uint64_t newSize) {
+    if (newSize > size) {
+        size = newSize;
+        if (bitsPerValue > 0) {
+            bits.grow(size * bitsPerValue);
+        }
+    }
+}
+
+void StateValuations::IntegerColumn::shrinkToFit() {
+    if (hasValue) {
+        repack(lowest, getNumberOfBits(static_cast<uint64_t>(highest) - static_cast<uint64_t>(lowest)), size);
+    } else {
+        bits = storm::storage::BitVector();
+    }
+}
+
+uint64_t StateValuations::IntegerColumn::getAllocatedBytes() const {
+    return bits.getSizeInBytes() - sizeof(bits);
+}
+
+void StateValuations::IntegerColumn::repack(int64_t newBase, uint64_t newBitsPerValue, uint64_t capacity) {
+    storm::storage::BitVector newBits(std::max(capacity, size) * newBitsPerValue);
+    if (newBitsPerValue > 0) {
+        for (uint64_t index = 0; index < size; ++index) {
+            // Unset entries may lie outside of the range of set values. They get the value of the new base.
+            int64_t value = get(index);
+            if (value >= lowest && value <= highest) {
+                newBits.setFromInt(index * newBitsPerValue, newBitsPerValue, static_cast<uint64_t>(value) - static_cast<uint64_t>(newBase));
+            }
+        }
+    }
+    base = newBase;
+    bitsPerValue = newBitsPerValue;
+    bits = std::move(newBits);
+}
+
+storm::storage::BitVector StateValuations::IntegerColumn::getIndicesWithValue(int64_t value) const {
+    storm::storage::BitVector result(size, false);
+    if (!hasValue || value < lowest || value > highest) {
+        return result;
+    }
+    if (bitsPerValue == 0) {
+        result.complement();
+        return result;
+    }
+    // Compare the packed representations.
+    uint64_t const encodedValue = static_cast<uint64_t>(value) - static_cast<uint64_t>(base);
+    for (uint64_t index = 0, bitIndex = 0; index < size; ++index, bitIndex += bitsPerValue) {
+        if (bits.getAsInt(bitIndex, bitsPerValue) == encodedValue) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+typename StateValuations::IntegerColumn StateValuations::IntegerColumn::select(std::vector<uint64_t> const& indices) const {
+    IntegerColumn result;
+    result.size = indices.size();
+    result.base = base;
+    result.bitsPerValue = bitsPerValue;
+    result.lowest = lowest;
+    result.highest = highest;
+    result.hasValue = hasValue;
+    result.bits = storm::storage::BitVector(indices.size() * bitsPerValue);
+    if (bitsPerValue > 0) {
+        for (uint64_t index = 0; index < indices.size(); ++index) {
+            if (indices[index] < size) {
+                result.bits.setFromInt(index * bitsPerValue, bitsPerValue, bits.getAsInt(indices[index] * bitsPerValue, bitsPerValue));
+            }
+        }
+    }
+    return result;
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -30,14 +141,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
+                                                        StateValuations const* valuations, storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      valuations(valuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -77,28 +190,28 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return valuations->columns->booleanColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return valuations->columns->integerColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    STORM_LOG_ASSERT(labelIt->second < valuations->columns->labelColumns.size(),
+                     "Label index " << labelIt->second << " larger than number of labels " << valuations->columns->labelColumns.size());
+    return valuations->columns->labelColumns[labelIt->second].get(state);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return valuations->columns->rationalColumns[variableIt->second][state];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -125,42 +238,52 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations, state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations, state);
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && columns->statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return columns->booleanColumns[variableToIndexMap.at(booleanVariable)].get(stateIndex);
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && columns->statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return columns->integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    STORM_LOG_ASSERT(stateIndex < numberOfStates && columns->statesWithValuation.get(stateIndex), "Invalid state index.");
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return columns->rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return !columns->statesWithValuation.get(stateIndex) || (variableToIndexMap.empty() && observationLabels.empty());
+}
+
+storm::storage::BitVector StateValuations::getStatesWithBooleanValue(storm::expressions::Variable const& booleanVariable, bool value) const {
+    STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
+    storm::storage::BitVector const& column = columns->booleanColumns[variableToIndexMap.at(booleanVariable)];
+    return value ? (column & columns->statesWithValuation) : (~column & columns->statesWithValuation);
+}
+
+storm::storage::BitVector StateValuations::getStatesWithIntegerValue(storm::expressions::Variable const& integerVariable, int64_t value) const {
+    STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
+    return columns->integerColumns[variableToIndexMap.at(integerVariable)].getIndicesWithValue(value) & columns->statesWithValuation;
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -251,43 +374,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -295,40 +381,120 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
 }
 
 std::size_t StateValuations::hash() const {
     return 0;
 }
 
+uint64_t StateValuations::getSizeInBytes() const {
+    // For the maps, we account for the nodes (including the pointers for the tree structure) but not for the names.
+    uint64_t result = sizeof(*this) + sizeof(Columns) + columns->statesWithValuation.getSizeInBytes() - sizeof(columns->statesWithValuation);
+    result += variableToIndexMap.size() * (sizeof(std::pair<storm::expressions::Variable, uint64_t>) + 4 * sizeof(void*));
+    result += observationLabels.size() * (sizeof(std::pair<std::string, uint64_t>) + 4 * sizeof(void*));
+    result += columns->booleanColumns.capacity() * sizeof(storm::storage::BitVector);
+    for (auto const& column : columns->booleanColumns) {
+        result += column.getSizeInBytes() - sizeof(column);
+    }
+    result += (columns->integerColumns.capacity() + columns->labelColumns.capacity()) * sizeof(IntegerColumn);
+    for (auto const& column : columns->integerColumns) {
+        result += column.getAllocatedBytes();
+    }
+    for (auto const& column : columns->labelColumns) {
+        result += column.getAllocatedBytes();
+    }
+    result += columns->rationalColumns.capacity() * sizeof(std::vector<storm::RationalNumber>);
+    for (auto const& column : columns->rationalColumns) {
+        result += column.capacity() * sizeof(storm::RationalNumber);
+    }
+    return result;
+}
+
 StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+    return select(std::vector<uint64_t>(selectedStates.begin(), selectedStates.end()));
 }
 
 StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
-    for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
-        } else {
-            selectedValuations.emplace_back();
+    return select(selectedStates);
+}
+
+StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
+    STORM_LOG_ASSERT(std::all_of(mapNewToOld.begin(), mapNewToOld.end(), [this](uint64_t oldState) { return oldState < numberOfStates; }),
+                     "Invalid state index.");
+    return select(mapNewToOld);
+}
+
+StateValuations StateValuations::select(std::vector<uint64_t> const& states) const {
+    bool isIdentity = states.size() == numberOfStates;
+    for (uint64_t state = 0; isIdentity && state < states.size(); ++state) {
+        isIdentity = states[state] == state;
+    }
+    if (isIdentity) {
+        // All states are kept in their order, so the columns can be shared.
+        return *this;
+    }
+
+    StateValuations result;
+    result.variableToIndexMap = variableToIndexMap;
+    result.observationLabels = observationLabels;
+    result.numberOfStates = states.size();
+    result.columns->statesWithValuation = storm::storage::BitVector(states.size());
+    for (uint64_t state = 0; state < states.size(); ++state) {
+        if (states[state] < numberOfStates && columns->statesWithValuation.get(states[state])) {
+            result.columns->statesWithValuation.set(state);
+        }
+    }
+    for (auto const& column : columns->booleanColumns) {
+        result.columns->booleanColumns.emplace_back(states.size());
+        for (auto state : result.columns->statesWithValuation) {
+            result.columns->booleanColumns.back().set(state, column.get(states[state]));
+        }
+    }
+    for (auto const& column : columns->integerColumns) {
+        result.columns->integerColumns.push_back(column.select(states));
+    }
+    for (auto const& column : columns->rationalColumns) {
+        result.columns->rationalColumns.emplace_back(states.size());
+        for (auto state : result.columns->statesWithValuation) {
+            result.columns->rationalColumns.back()[state] = column[states[state]];
         }
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    for (auto const& column : columns->labelColumns) {
+        result.columns->labelColumns.push_back(column.select(states));
+    }
+    return result;
 }
 
-StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
+void StateValuations::shrinkToFit() {
+    Columns& modifiableColumns = getModifiableColumns();
+    modifiableColumns.statesWithValuation.resize(numberOfStates);
+    for (auto& column : modifiableColumns.booleanColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : modifiableColumns.integerColumns) {
+        column.grow(numberOfStates);
+        column.shrinkToFit();
+    }
+    for (auto& column : modifiableColumns.rationalColumns) {
+        column.resize(numberOfStates);
+        column.shrink_to_fit();
+    }
+    for (auto& column : modifiableColumns.labelColumns) {
+        column.grow(numberOfStates);
+        column.shrinkToFit();
+    }
+}
+
+StateValuations::Columns& StateValuations::getModifiableColumns() {
+    if (columns.use_count() > 1) {
+        columns = std::make_shared<Columns>(*columns);
     }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    return *columns;
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -336,35 +502,70 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+        currentStateValuations.columns->booleanColumns.emplace_back();
     }
     if (variable.hasIntegerType()) {
         currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+        currentStateValuations.columns->integerColumns.emplace_back();
     }
     if (variable.hasRationalType()) {
         currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+        currentStateValuations.columns->rationalColumns.emplace_back();
     }
 }
 
 void StateValuationsBuilder::addObservationLabel(const std::string& label) {
+    STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add an observation label, although a state has already been added before.");
     currentStateValuations.observationLabels[label] = labelCount++;
+    currentStateValuations.columns->labelColumns.emplace_back();
 }
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
+    // The valuations under construction are never shared, so their columns can be modified directly.
+    StateValuations& valuations = currentStateValuations;
+    if (state >= valuations.numberOfStates) {
+        // Reserve storage for further states such that the columns grow geometrically. The surplus is released when building.
+        valuations.numberOfStates = state + 1;
+        valuations.columns->statesWithValuation.grow(valuations.numberOfStates);
+        for (auto& column : valuations.columns->booleanColumns) {
+            column.grow(valuations.numberOfStates);
+        }
+        for (auto& column : valuations.columns->integerColumns) {
+            column.grow(valuations.numberOfStates);
+        }
+        for (auto& column : valuations.columns->rationalColumns) {
+            if (column.size() < valuations.numberOfStates) {
+                column.resize(valuations.numberOfStates);
+            }
+        }
+        for (auto& column : valuations.columns->labelColumns) {
+            column.grow(valuations.numberOfStates);
+        }
     }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
-    } else {
-        STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    if (booleanValues.empty() && integerValues.empty() && rationalValues.empty() && observationLabelValues.empty()) {
+        return;
+    }
+    STORM_LOG_ASSERT(!valuations.columns->statesWithValuation.get(state), "Adding a valuation to the same state multiple times.");
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount &&
+                         observationLabelValues.size() == labelCount,
+                     "Number of given values does not match the number of variables.");
+    valuations.columns->statesWithValuation.set(state);
+    for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+        valuations.columns->booleanColumns[index].set(state, booleanValues[index]);
+    }
+    for (uint64_t index = 0; index < integerValues.size(); ++index) {
+        valuations.columns->integerColumns[index].set(state, integerValues[index]);
+    }
+    for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+        valuations.columns->rationalColumns[index][state] = std::move(rationalValues[index]);
+    }
+    for (uint64_t index = 0; index < observationLabelValues.size(); ++index) {
+        valuations.columns->labelColumns[index].set(state, observationLabelValues[index]);
     }
 }
 
@@ -380,12 +581,15 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
     return labelCount;
 }
 
-StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-    return std::move(currentStateValuations);
+StateValuations StateValuationsBuilder::build(std::size_t) {
+    StateValuations result = std::move(currentStateValuations);
+    result.shrinkToFit();
+    currentStateValuations = StateValuations();
     booleanVarCount = 0;
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
+    return result;
 }
 
 template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const&,
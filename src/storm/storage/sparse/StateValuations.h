@@ -2,7 +2,10 @@
 
 #include <boost/variant.hpp>
 #include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "storm/adapters/JsonAdapter.h"
 #include "storm/models/sparse/StateAnnotation.h"
@@ -21,20 +24,6 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -42,7 +31,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -72,34 +62,51 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* valuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     StateValuations() = default;
+    StateValuations(StateValuations const& other) = default;
+    StateValuations(StateValuations&& other) = default;
+    StateValuations& operator=(StateValuations const& other) = default;
+    StateValuations& operator=(StateValuations&& other) = default;
     virtual ~StateValuations() = default;
     virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
     bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
 
+    /*!
+     * Retrieves the states (with a valuation) in which the given boolean variable has the given value.
+     */
+    storm::storage::BitVector getStatesWithBooleanValue(storm::expressions::Variable const& booleanVariable, bool value) const;
+
+    /*!
+     * Retrieves the states (with a valuation) in which the given integer variable has the given value, e.g., all states with x=3.
+     * The packed column of the variable is scanned without decoding the values.
+     */
+    storm::storage::BitVector getStatesWithIntegerValue(storm::expressions::Variable const& integerVariable, int64_t value) const;
+
     /*!
      * Returns a string representation of the valuation.
      *
@@ -136,15 +143,92 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
 
     virtual std::size_t hash() const;
 
+    /*!
+     * Retrieves the (approximate) number of bytes allocated by the state valuations.
+     */
+    uint64_t getSizeInBytes() const;
+
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    /*!
+     * A column of integers, one per state. The values are stored relative to a base value with the smallest number of bits that suffices for
+     * the values set so far. Setting a value outside of the representable range re-packs the column with (at least) one more bit.
+     * Entries that were never set have the base value.
+     */
+    class IntegerColumn {
+       public:
+        int64_t get(uint64_t index) const;
+        void set(uint64_t index, int64_t value);
+
+        /*!
+         * Enlarges the column to the given number of entries. The storage grows geometrically.
+         */
+        void grow(uint64_t newSize);
+
+        /*!
+         * Re-packs the column with the minimal number of bits for the set values and releases unused storage.
+         */
+        void shrinkToFit();
+
+        /*!
+         * Retrieves the entries with the given value.
+         */
+        storm::storage::BitVector getIndicesWithValue(int64_t value) const;
+
+        /*!
+         * Creates a column whose i-th entry is the entry of this column at the i-th given index (or unset if the index is out of range).
+         */
+        IntegerColumn select(std::vector<uint64_t> const& indices) const;
+
+        /*!
+         * Retrieves the number of bytes the column allocates in addition to its own size.
+         */
+        uint64_t getAllocatedBytes() const;
+
+       private:
+        void repack(int64_t newBase, uint64_t newBitsPerValue, uint64_t capacity);
+
+        uint64_t size = 0;
+        // The value of an entry is base + (the bitsPerValue bits of the entry).
+        int64_t base = 0;
+        uint64_t bitsPerValue = 0;
+        // The smallest and largest value that was set. Only meaningful if hasValue is set.
+        int64_t lowest = 0;
+        int64_t highest = 0;
+        bool hasValue = false;
+        storm::storage::BitVector bits;
+    };
+
+    /*!
+     * Creates state valuations with the variables and labels of this object whose i-th state has the valuation of the i-th given state.
+     * Out of range indices yield states without valuation.
+     */
+    StateValuations select(std::vector<uint64_t> const& states) const;
+
+    /*!
+     * Releases the storage reserved for states that were not added.
+     */
+    void shrinkToFit();
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+
+    // The valuations are stored column-wise: one column per variable (of the corresponding type) and observation label.
+    struct Columns {
+        storm::storage::BitVector statesWithValuation;
+        std::vector<storm::storage::BitVector> booleanColumns;
+        std::vector<IntegerColumn> integerColumns;
+        std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+        std::vector<IntegerColumn> labelColumns;
+    };
+
+    /*!
+     * Retrieves the columns for modification, copying them first if they are shared with other state valuations.
+     */
+    Columns& getModifiableColumns();
+
+    uint64_t numberOfStates = 0;
+    // The columns are shared between copies of the valuations (e.g. across model transformations that keep all states).
+    std::shared_ptr<Columns> columns = std::make_shared<Columns>();
 };
 
 class StateValuationsBuilder {
@@ -162,6 +246,7 @@ class StateValuationsBuilder {
      * Adds a new state.
      * The variable values have to be given in the same order as the variables have been added.
      * The number of given variable values for each type needs to match the number of added variables.
+     * If no values are given at all, the state does not get a valuation.
      * After calling this method, no more variables should be added.
      */
     void addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues = {}, std::vector<int64_t>&& integerValues = {},
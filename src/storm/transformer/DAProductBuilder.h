@@ -5,6 +5,7 @@
 #include "storm/transformer/DAProduct.h"
 #include "storm/transformer/Product.h"
 #include "storm/transformer/ProductBuilder.h"
+#include "storm/utility/parallel.h"
 
 #include <vector>
 
@@ -12,8 +13,39 @@ namespace storm {
 namespace transformer {
 class DAProductBuilder {
    public:
-    DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP)
-        : da(da), statesForAP(statesForAP) {}
+    /*!
+     * Prepares the product of a model with the given automaton. The labels of the model states are computed upfront (in parallel).
+     *
+     * @param statesForAP for each atomic proposition of the automaton, the model states that satisfy it
+     * @param collapseSinks if set, the product is explored on-the-fly only as long as the automaton can still change its state:
+     * all non-initial product states whose automaton state is a sink (i.e., it is never left) are merged into a single absorbing product state.
+     * As the acceptance of a run that reaches a sink only depends on the sink, this does not affect the probabilities of the states of interest.
+     * Merged product states can not be looked up via Product::getProductStateIndex.
+     */
+    DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP, bool collapseSinks = false)
+        : da(da), statesForAP(statesForAP) {
+        if (!statesForAP.empty()) {
+            uint64_t numberOfModelStates = statesForAP.front().size();
+            labels.resize(numberOfModelStates);
+            storm::utility::parallel::forEachChunk(0, numberOfModelStates, 4096, storm::utility::parallel::getDefaultNumberOfThreads(),
+                                                   [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                       for (uint64_t state = chunkBegin; state < chunkEnd; ++state) {
+                                                           labels[state] = computeLabelForState(state);
+                                                       }
+                                                   });
+        }
+        if (collapseSinks) {
+            sinks = storm::storage::BitVector(da.getNumberOfStates(), false);
+            for (storm::storage::sparse::state_type q = 0; q < da.getNumberOfStates(); ++q) {
+                bool isSink = true;
+                for (storm::automata::APSet::alphabet_element label = 0; isSink && label < da.getAPSet().alphabetSize(); ++label) {
+                    isSink = da.getSuccessor(q, label) == q;
+                }
+                sinks.set(q, isSink);
+            }
+            STORM_LOG_INFO("Deterministic automaton has " << sinks.getNumberOfSetBits() << " sink state(s).");
+        }
+    }
 
     template<typename Model>
     typename DAProduct<Model>::ptr build(const Model& originalModel, const storm::storage::BitVector& statesOfInterest) const {
@@ -38,11 +70,23 @@ class DAProductBuilder {
         return da.getSuccessor(automatonFrom, getLabelForState(modelTo));
     }
 
+    bool isCollapsedAutomatonState(storm::storage::sparse::state_type automatonState) const {
+        return sinks.size() > 0 && sinks.get(automatonState);
+    }
+
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    // the label of each model state
+    std::vector<storm::automata::APSet::alphabet_element> labels;
+    // the automaton states that are never left (only computed if sinks are collapsed)
+    storm::storage::BitVector sinks;
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
+        return labels.empty() ? da.getAPSet().elementAllFalse() : labels[s];
+    }
+
+    storm::automata::APSet::alphabet_element computeLabelForState(storm::storage::sparse::state_type s) const {
         storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
         for (unsigned int ap = 0; ap < da.getAPSet().size(); ap++) {
             if (statesForAP.at(ap).get(s)) {
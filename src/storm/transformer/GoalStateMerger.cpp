@@ -211,7 +211,7 @@ std::unordered_map<std::string, typename SparseModelType::RewardModelType> GoalS
 
     std::unordered_map<std::string, typename SparseModelType::RewardModelType> rewardModels;
     for (auto rewardModelName : selectedRewardModels) {
-        auto origRewardModel = originalModel.getRewardModel(rewardModelName);
+        auto const& origRewardModel = originalModel.getRewardModel(rewardModelName);
 
         boost::optional<std::vector<RewardValueType>> stateRewards;
         if (origRewardModel.hasStateRewards()) {
@@ -256,6 +256,7 @@ std::unordered_map<std::string, typename SparseModelType::RewardModelType> GoalS
         rewardModels.insert(std::make_pair(
             rewardModelName, typename SparseModelType::RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards))));
     }
+    storm::models::sparse::shareIdenticalRewards(rewardModels);
     return rewardModels;
 }
 
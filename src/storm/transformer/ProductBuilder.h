@@ -3,6 +3,8 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
 
 #include <deque>
 #include <map>
@@ -28,6 +30,8 @@ class ProductBuilder {
         std::map<product_state_type, state_type> productStateToProductIndex;
         std::vector<product_state_type> productIndexToProductState;
         std::vector<state_type> prodInitial;
+        // for each collapsed automaton state, the index of the product state that represents all non-initial product states with this automaton state
+        std::map<state_type, state_type> collapsedStateToProductIndex;
 
         // use deque for todo so that the states are handled in the order
         // of their index in the product model, which is required due to the
@@ -37,8 +41,6 @@ class ProductBuilder {
         for (state_type s_0 : statesOfInterest) {
             state_type q_0 = prodOp.getInitialState(s_0);
 
-            // std::cout << "Initial: " << s_0 << ", " << q_0 << " = " << nextState << "\n";
-
             product_state_type s_q(s_0, q_0);
             state_type index = nextState++;
             productStateToProductIndex[s_q] = index;
@@ -47,6 +49,31 @@ class ProductBuilder {
             todo.push_back(index);
         }
 
+        auto getOrAddProductState = [&](product_state_type const& t_p) {
+            if (prodOp.isCollapsedAutomatonState(t_p.second)) {
+                auto it = collapsedStateToProductIndex.find(t_p.second);
+                if (it != collapsedStateToProductIndex.end()) {
+                    return it->second;
+                }
+                state_type prodIndexTo = nextState++;
+                todo.push_back(prodIndexTo);
+                productIndexToProductState.push_back(t_p);
+                // the pair might already be an initial state
+                productStateToProductIndex.emplace(t_p, prodIndexTo);
+                collapsedStateToProductIndex.emplace(t_p.second, prodIndexTo);
+                return prodIndexTo;
+            }
+            auto it = productStateToProductIndex.find(t_p);
+            if (it != productStateToProductIndex.end()) {
+                return it->second;
+            }
+            state_type prodIndexTo = nextState++;
+            todo.push_back(prodIndexTo);
+            productIndexToProductState.push_back(t_p);
+            productStateToProductIndex[t_p] = prodIndexTo;
+            return prodIndexTo;
+        };
+
         storm::storage::SparseMatrixBuilder<typename Model::ValueType> builder(0, 0, 0, false, deterministic ? false : true, 0);
         std::size_t curRow = 0;
         while (!todo.empty()) {
@@ -54,30 +81,22 @@ class ProductBuilder {
             todo.pop_front();
 
             product_state_type from = productIndexToProductState.at(prodIndexFrom);
-            // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
+            auto collapsedIt = collapsedStateToProductIndex.find(from.second);
+            if (collapsedIt != collapsedStateToProductIndex.end() && collapsedIt->second == prodIndexFrom) {
+                // the automaton state is never left, so the behavior of the model does not matter anymore
+                if (!deterministic) {
+                    builder.newRowGroup(curRow);
+                }
+                builder.addNextValue(curRow, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                curRow++;
+            } else if (deterministic) {
                 typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
                 for (auto const& entry : row) {
                     state_type t = entry.getColumn();
                     state_type p = prodOp.getSuccessor(from.second, t);
-                    // std::cout << " p = " << p << "\n";
-                    product_state_type t_p(t, p);
-                    state_type prodIndexTo;
-                    auto it = productStateToProductIndex.find(t_p);
-                    if (it == productStateToProductIndex.end()) {
-                        prodIndexTo = nextState++;
-                        todo.push_back(prodIndexTo);
-                        productIndexToProductState.push_back(t_p);
-                        productStateToProductIndex[t_p] = prodIndexTo;
-                        // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                    } else {
-                        prodIndexTo = it->second;
-                    }
-                    // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                    // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                    builder.addNextValue(prodIndexFrom, prodIndexTo, entry.getValue());
+                    builder.addNextValue(curRow, getOrAddProductState(product_state_type(t, p)), entry.getValue());
                 }
+                curRow++;
             } else {
                 std::size_t numRows = originalMatrix.getRowGroupSize(from.first);
                 builder.newRowGroup(curRow);
@@ -86,28 +105,13 @@ class ProductBuilder {
                     for (auto const& entry : row) {
                         state_type t = entry.getColumn();
                         state_type p = prodOp.getSuccessor(from.second, t);
-                        // std::cout << " p = " << p << "\n";
-                        product_state_type t_p(t, p);
-                        state_type prodIndexTo;
-                        auto it = productStateToProductIndex.find(t_p);
-                        if (it == productStateToProductIndex.end()) {
-                            prodIndexTo = nextState++;
-                            todo.push_back(prodIndexTo);
-                            productIndexToProductState.push_back(t_p);
-                            productStateToProductIndex[t_p] = prodIndexTo;
-                            // std::cout << " Adding " << t_p.first << "," << t_p.second << " as " << prodIndexTo << "\n";
-                        } else {
-                            prodIndexTo = it->second;
-                        }
-                        // std::cout << " " << t_p.first << "," << t_p.second << ": to = " << prodIndexTo << "\n";
-
-                        // std::cout << " addNextValue(" << prodIndexFrom << "," << prodIndexTo << "," << entry.getValue() << ")\n";
-                        builder.addNextValue(curRow, prodIndexTo, entry.getValue());
+                        builder.addNextValue(curRow, getOrAddProductState(product_state_type(t, p)), entry.getValue());
                     }
                     curRow++;
                 }
             }
         }
+        STORM_LOG_INFO_COND(collapsedStateToProductIndex.empty(), "Collapsed the product states of " << collapsedStateToProductIndex.size() << " automaton states.");
 
         state_type numberOfProductStates = nextState;
 
@@ -0,0 +1,161 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace transformer {
+
+namespace {
+/*!
+ * Renumbers the row groups and the columns of the given matrix.
+ *
+ * @param rowGroupIndices The row groups of the states (which are not necessarily the row groups of the given matrix).
+ */
+template<typename ValueType>
+storm::storage::SparseMatrix<ValueType> permuteMatrix(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<uint64_t> const& rowGroupIndices,
+                                                      std::vector<uint64_t> const& inversePermutation, std::vector<uint64_t> const& permutation) {
+    bool customRowGrouping = !matrix.hasTrivialRowGrouping();
+    storm::storage::SparseMatrixBuilder<ValueType> builder(matrix.getRowCount(), matrix.getColumnCount(), matrix.getEntryCount(), true, customRowGrouping,
+                                                           customRowGrouping ? matrix.getRowGroupCount() : 0);
+    std::vector<storm::storage::MatrixEntry<uint64_t, ValueType>> rowEntries;
+    uint64_t newRow = 0;
+    for (auto oldState : inversePermutation) {
+        if (customRowGrouping) {
+            builder.newRowGroup(newRow);
+        }
+        for (uint64_t oldRow = rowGroupIndices[oldState]; oldRow < rowGroupIndices[oldState + 1]; ++oldRow, ++newRow) {
+            rowEntries.clear();
+            for (auto const& entry : matrix.getRow(oldRow)) {
+                rowEntries.emplace_back(permutation[entry.getColumn()], entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(),
+                      [](storm::storage::MatrixEntry<uint64_t, ValueType> const& first, storm::storage::MatrixEntry<uint64_t, ValueType> const& second) {
+                          return first.getColumn() < second.getColumn();
+                      });
+            for (auto const& entry : rowEntries) {
+                builder.addNextValue(newRow, entry.getColumn(), entry.getValue());
+            }
+        }
+    }
+    return builder.build();
+}
+
+template<typename RewardModelType>
+RewardModelType permuteRewardModel(RewardModelType const& rewardModel, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<uint64_t> const& inversePermutation, std::vector<uint64_t> const& permutation,
+                                   std::vector<uint64_t> const& inverseChoicePermutation) {
+    typedef typename RewardModelType::ValueType RewardValueType;
+    boost::optional<std::vector<RewardValueType>> stateRewardVector;
+    boost::optional<std::vector<RewardValueType>> stateActionRewardVector;
+    boost::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewardMatrix;
+    if (rewardModel.hasStateRewards()) {
+        stateRewardVector = storm::utility::vector::applyInversePermutation(inversePermutation, rewardModel.getStateRewardVector());
+    }
+    if (rewardModel.hasStateActionRewards()) {
+        stateActionRewardVector = storm::utility::vector::applyInversePermutation(inverseChoicePermutation, rewardModel.getStateActionRewardVector());
+    }
+    if (rewardModel.hasTransitionRewards()) {
+        transitionRewardMatrix = permuteMatrix(rewardModel.getTransitionRewardMatrix(), rowGroupIndices, inversePermutation, permutation);
+    }
+    return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
+}
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inversePermutation) {
+    STORM_LOG_THROW(inversePermutation.size() == originalModel.getNumberOfStates() && storm::utility::permutation::isValidPermutation(inversePermutation),
+                    storm::exceptions::InvalidArgumentException, "The given vector is not a permutation of the states of the model.");
+    STORM_LOG_THROW(!originalModel.isOfType(storm::models::ModelType::S2pg) && !originalModel.isOfType(storm::models::ModelType::Smg),
+                    storm::exceptions::NotSupportedException, "Renumbering the states of games is not supported.");
+    std::vector<uint64_t> permutation = storm::utility::permutation::invertPermutation(inversePermutation);
+    auto const& rowGroupIndices = originalModel.getTransitionMatrix().getRowGroupIndices();
+
+    // The choices keep their order within the states.
+    std::vector<uint64_t> inverseChoicePermutation;
+    inverseChoicePermutation.reserve(originalModel.getNumberOfChoices());
+    for (auto oldState : inversePermutation) {
+        for (uint64_t choice = rowGroupIndices[oldState]; choice < rowGroupIndices[oldState + 1]; ++choice) {
+            inverseChoicePermutation.push_back(choice);
+        }
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(
+        permuteMatrix(originalModel.getTransitionMatrix(), rowGroupIndices, inversePermutation, permutation), originalModel.getStateLabeling());
+    components.stateLabeling.permuteItems(inversePermutation);
+    for (auto const& rewardModel : originalModel.getRewardModels()) {
+        components.rewardModels.emplace(
+            rewardModel.first, permuteRewardModel(rewardModel.second, rowGroupIndices, inversePermutation, permutation, inverseChoicePermutation));
+    }
+    if (originalModel.hasChoiceLabeling()) {
+        components.choiceLabeling = originalModel.getChoiceLabeling();
+        components.choiceLabeling->permuteItems(inverseChoicePermutation);
+    }
+    if (originalModel.hasStateValuations()) {
+        components.stateValuations = originalModel.getStateValuations().selectStates(inversePermutation);
+    }
+    if (originalModel.hasChoiceOrigins()) {
+        components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(inverseChoicePermutation);
+    }
+
+    if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+        auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+        components.exitRates = storm::utility::vector::applyInversePermutation(inversePermutation, ctmc.getExitRateVector());
+        components.rateTransitions = true;
+    } else if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+        components.markovianStates = ma.getMarkovianStates().permute(inversePermutation);
+        components.exitRates = storm::utility::vector::applyInversePermutation(inversePermutation, ma.getExitRates());
+        // Note that the transition matrix of the original model contains probabilities.
+        components.rateTransitions = false;
+    } else if (originalModel.isOfType(storm::models::ModelType::Pomdp)) {
+        auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+        components.observabilityClasses = storm::utility::vector::applyInversePermutation(inversePermutation, pomdp.getObservations());
+        if (pomdp.hasObservationValuations()) {
+            components.observationValuations = pomdp.getObservationValuations();
+        }
+        // As the choices keep their order, the canonicity is preserved.
+        return std::make_shared<storm::models::sparse::Pomdp<ValueType, RewardModelType>>(std::move(components), pomdp.isCanonic());
+    }
+    return storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+}
+
+template<typename ValueType, typename RewardModelType>
+std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>>, std::vector<uint64_t>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, storm::utility::permutation::OrderKind order) {
+    std::vector<uint64_t> inversePermutation =
+        storm::utility::permutation::createStateOrder(order, originalModel.getTransitionMatrix(), originalModel.getInitialStates());
+    auto model = permuteStates(originalModel, inversePermutation);
+    return std::make_pair(std::move(model), std::move(inversePermutation));
+}
+
+template std::shared_ptr<storm::models::sparse::Model<double>> permuteStates(storm::models::sparse::Model<double> const& originalModel,
+                                                                             std::vector<uint64_t> const& inversePermutation);
+template std::pair<std::shared_ptr<storm::models::sparse::Model<double>>, std::vector<uint64_t>> permuteStates(
+    storm::models::sparse::Model<double> const& originalModel, storm::utility::permutation::OrderKind order);
+
+#ifdef STORM_HAVE_CARL
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+template std::pair<std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>>, std::vector<uint64_t>> permuteStates(
+    storm::models::sparse::Model<storm::RationalNumber> const& originalModel, storm::utility::permutation::OrderKind order);
+template std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+template std::pair<std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>>, std::vector<uint64_t>> permuteStates(
+    storm::models::sparse::Model<storm::RationalFunction> const& originalModel, storm::utility::permutation::OrderKind order);
+#endif
+
+}  // namespace transformer
+}  // namespace storm
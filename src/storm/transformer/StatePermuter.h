@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/permutation.h"
+
+namespace storm {
+namespace transformer {
+
+/*
+ * Renumbers the states of the given model, for example to improve the locality of memory accesses when working on the
+ * transition matrix. All components of the model (labelings, reward models, state valuations, choice origins, ...) are
+ * renumbered consistently. The choices of every state keep their order.
+ *
+ * Values computed on the resulting model can be mapped back to the states of the original model via
+ * storm::utility::vector::applyInversePermutation(storm::utility::permutation::invertPermutation(inversePermutation), values).
+ *
+ * @param originalModel The original model.
+ * @param inversePermutation For every state index i of the resulting model, the index of the corresponding state in the original model.
+ * @return The model with renumbered states.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& inversePermutation);
+
+/*
+ * Renumbers the states of the given model according to the given order.
+ *
+ * @param originalModel The original model.
+ * @param order The order in which the states are arranged.
+ * @return The model with renumbered states and, for every state of that model, the index of the corresponding state in the original model.
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+std::pair<std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>>, std::vector<uint64_t>> permuteStates(
+    storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, storm::utility::permutation::OrderKind order);
+
+}  // namespace transformer
+}  // namespace storm
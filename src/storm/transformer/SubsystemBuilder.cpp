@@ -44,6 +44,10 @@ void transformModelSpecificComponents(storm::models::sparse::Model<ValueType, Re
 template<typename RewardModelType>
 RewardModelType transformRewardModel(RewardModelType const& originalRewardModel, storm::storage::BitVector const& subsystem,
                                      storm::storage::BitVector const& subsystemActions) {
+    if (subsystem.full() && subsystemActions.full()) {
+        // The reward model is not affected, so the rewards are shared with the original model.
+        return originalRewardModel;
+    }
     boost::optional<std::vector<typename RewardModelType::ValueType>> stateRewardVector;
     boost::optional<std::vector<typename RewardModelType::ValueType>> stateActionRewardVector;
     boost::optional<storm::storage::SparseMatrix<typename RewardModelType::ValueType>> transitionRewardMatrix;
@@ -143,6 +147,7 @@ SubsystemBuilderReturnType<ValueType, RewardModelType> internalBuildSubsystem(st
     for (auto const& rewardModel : originalModel.getRewardModels()) {
         components.rewardModels.insert(std::make_pair(rewardModel.first, transformRewardModel(rewardModel.second, subsystemStates, keptActions)));
     }
+    storm::models::sparse::shareIdenticalRewards(components.rewardModels);
     if (originalModel.hasChoiceLabeling()) {
         components.choiceLabeling = originalModel.getChoiceLabeling().getSubLabeling(keptActions);
     }
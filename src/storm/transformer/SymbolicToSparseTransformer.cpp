@@ -1,5 +1,7 @@
 #include "SymbolicToSparseTransformer.h"
 
+#include <type_traits>
+
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/logic/AtomicLabelFormula.h"
@@ -10,6 +12,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace transformer {
@@ -35,45 +38,125 @@ struct LabelInformation {
     std::map<std::string, storm::expressions::Expression> expressionLabels;
 };
 
+template<typename ValueType>
+uint64_t getNumberOfTranslationThreads() {
+    // Rational functions are not translated concurrently as their (carl) caches are not thread-safe.
+    return std::is_same<ValueType, storm::RationalFunction>::value ? 1 : storm::utility::parallel::getDefaultNumberOfThreads();
+}
+
+/*!
+ * Translates the given vectors. Traversing the DDs does not modify them (or their manager), so the vectors are translated concurrently.
+ */
 template<storm::dd::DdType Type, typename ValueType>
-std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
-    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
-    this->odd = symbolicDtmc.getReachableStates().createOdd();
-    storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
-    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
-    for (auto const& rewardModelNameAndModel : symbolicDtmc.getRewardModels()) {
-        boost::optional<std::vector<ValueType>> stateRewards;
-        boost::optional<std::vector<ValueType>> stateActionRewards;
-        boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+std::vector<std::vector<ValueType>> translateVectors(std::vector<storm::dd::Add<Type, ValueType>> const& symbolicVectors, storm::dd::Odd const& odd) {
+    std::vector<std::vector<ValueType>> result(symbolicVectors.size());
+    // Flatten the ODD before it is used concurrently.
+    odd.getFlatOdd();
+    storm::utility::parallel::forEachChunk(0, symbolicVectors.size(), 1, getNumberOfTranslationThreads<ValueType>(),
+                                           [&](uint64_t, uint64_t first, uint64_t last) {
+                                               for (uint64_t index = first; index < last; ++index) {
+                                                   result[index] = symbolicVectors[index].toVector(odd);
+                                               }
+                                           });
+    return result;
+}
+
+template<typename ValueType>
+struct RewardVectors {
+    boost::optional<std::vector<ValueType>> stateRewards;
+    boost::optional<std::vector<ValueType>> stateActionRewards;
+};
+
+/*!
+ * Translates the state reward vectors (and, if requested, the state-action reward vectors) of all reward models of the given model concurrently.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+std::unordered_map<std::string, RewardVectors<ValueType>> translateRewardVectors(storm::models::symbolic::Model<Type, ValueType> const& symbolicModel,
+                                                                                 storm::dd::Odd const& odd, bool includeStateActionRewards) {
+    std::vector<storm::dd::Add<Type, ValueType>> symbolicVectors;
+    std::vector<std::pair<std::string, bool>> vectorOwners;
+    for (auto const& rewardModelNameAndModel : symbolicModel.getRewardModels()) {
         if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(this->odd);
+            symbolicVectors.push_back(rewardModelNameAndModel.second.getStateRewardVector());
+            vectorOwners.emplace_back(rewardModelNameAndModel.first, false);
         }
-        if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(this->odd);
+        if (includeStateActionRewards && rewardModelNameAndModel.second.hasStateActionRewards()) {
+            symbolicVectors.push_back(rewardModelNameAndModel.second.getStateActionRewardVector());
+            vectorOwners.emplace_back(rewardModelNameAndModel.first, true);
         }
-        if (rewardModelNameAndModel.second.hasTransitionRewards()) {
-            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd);
+    }
+    std::vector<std::vector<ValueType>> vectors = translateVectors(symbolicVectors, odd);
+
+    std::unordered_map<std::string, RewardVectors<ValueType>> result;
+    for (uint64_t index = 0; index < vectors.size(); ++index) {
+        RewardVectors<ValueType>& rewardVectors = result[vectorOwners[index].first];
+        if (vectorOwners[index].second) {
+            rewardVectors.stateActionRewards = std::move(vectors[index]);
+        } else {
+            rewardVectors.stateRewards = std::move(vectors[index]);
         }
-        rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
+    return result;
+}
 
-    labelling.addLabel("init", symbolicDtmc.getInitialStates().toVector(this->odd));
-    labelling.addLabel("deadlock", symbolicDtmc.getDeadlockStates().toVector(this->odd));
+/*!
+ * Translates the labels of the given model (or only those needed for the given formulas). The sets of states are computed first, as this involves
+ * operations of the DD manager, and then translated concurrently.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::models::sparse::StateLabeling translateLabeling(storm::models::symbolic::Model<Type, ValueType> const& symbolicModel,
+                                                       std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::dd::Odd const& odd) {
+    std::vector<std::string> labels = {"init", "deadlock"};
+    std::vector<storm::dd::Bdd<Type>> states = {symbolicModel.getInitialStates(), symbolicModel.getDeadlockStates()};
     if (formulas.empty()) {
-        for (auto const& label : symbolicDtmc.getLabels()) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+        for (auto const& label : symbolicModel.getLabels()) {
+            labels.push_back(label);
+            states.push_back(symbolicModel.getStates(label));
         }
     } else {
         LabelInformation labelInfo(formulas);
         for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicDtmc.getStates(label).toVector(this->odd));
+            labels.push_back(label);
+            states.push_back(symbolicModel.getStates(label));
         }
         for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
+            labels.push_back(expressionLabel.first);
+            states.push_back(symbolicModel.getStates(expressionLabel.second));
+        }
+    }
+
+    std::vector<storm::storage::BitVector> explicitStates(states.size());
+    storm::utility::parallel::forEachChunk(0, states.size(), 1, getNumberOfTranslationThreads<ValueType>(), [&](uint64_t, uint64_t first, uint64_t last) {
+        for (uint64_t index = first; index < last; ++index) {
+            explicitStates[index] = states[index].toVector(odd);
+        }
+    });
+
+    storm::models::sparse::StateLabeling labelling(odd.getTotalOffset());
+    for (uint64_t index = 0; index < labels.size(); ++index) {
+        labelling.addLabel(labels[index], std::move(explicitStates[index]));
+    }
+    return labelling;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmcTransformer<Type, ValueType>::translate(
+    storm::models::symbolic::Dtmc<Type, ValueType> const& symbolicDtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
+    this->odd = symbolicDtmc.getReachableStates().createOdd();
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicDtmc.getTransitionMatrix().toMatrix(this->odd, this->odd);
+    std::unordered_map<std::string, RewardVectors<ValueType>> rewardVectors = translateRewardVectors(symbolicDtmc, this->odd, true);
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    for (auto const& rewardModelNameAndModel : symbolicDtmc.getRewardModels()) {
+        boost::optional<std::vector<ValueType>> stateRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateRewards);
+        boost::optional<std::vector<ValueType>> stateActionRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateActionRewards);
+        boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (rewardModelNameAndModel.second.hasTransitionRewards()) {
+            transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd);
         }
+        rewardModels.emplace(rewardModelNameAndModel.first,
+                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicDtmc, formulas, this->odd);
     return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
 
@@ -108,14 +191,12 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
     }
 
     // Translate reward models
+    std::unordered_map<std::string, RewardVectors<ValueType>> rewardVectors = translateRewardVectors(symbolicMdp, odd, false);
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
     for (auto const& rewardModelNameAndModel : symbolicMdp.getRewardModels()) {
-        boost::optional<std::vector<ValueType>> stateRewards;
+        boost::optional<std::vector<ValueType>> stateRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateRewards);
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
         auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
         if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
             stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
@@ -126,23 +207,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMdp.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMdp.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMdp.getLabels()) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMdp.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMdp.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicMdp, formulas, odd);
 
     return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
@@ -152,40 +217,19 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
     storm::models::symbolic::Ctmc<Type, ValueType> const& symbolicCtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) {
     storm::dd::Odd odd = symbolicCtmc.getReachableStates().createOdd();
     storm::storage::SparseMatrix<ValueType> transitionMatrix = symbolicCtmc.getTransitionMatrix().toMatrix(odd, odd);
+    std::unordered_map<std::string, RewardVectors<ValueType>> rewardVectors = translateRewardVectors(symbolicCtmc, odd, true);
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
     for (auto const& rewardModelNameAndModel : symbolicCtmc.getRewardModels()) {
-        boost::optional<std::vector<ValueType>> stateRewards;
-        boost::optional<std::vector<ValueType>> stateActionRewards;
+        boost::optional<std::vector<ValueType>> stateRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateRewards);
+        boost::optional<std::vector<ValueType>> stateActionRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateActionRewards);
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
-        if (rewardModelNameAndModel.second.hasStateActionRewards()) {
-            stateActionRewards = rewardModelNameAndModel.second.getStateActionRewardVector().toVector(odd);
-        }
         if (rewardModelNameAndModel.second.hasTransitionRewards()) {
             transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(odd, odd);
         }
         rewardModels.emplace(rewardModelNameAndModel.first,
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicCtmc.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicCtmc.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicCtmc.getLabels()) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicCtmc.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicCtmc.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicCtmc, formulas, odd);
 
     return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
 }
@@ -215,14 +259,12 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
     }
 
     // Translate reward models
+    std::unordered_map<std::string, RewardVectors<ValueType>> rewardVectors = translateRewardVectors(symbolicMa, odd, false);
     std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
     for (auto const& rewardModelNameAndModel : symbolicMa.getRewardModels()) {
-        boost::optional<std::vector<ValueType>> stateRewards;
+        boost::optional<std::vector<ValueType>> stateRewards = std::move(rewardVectors[rewardModelNameAndModel.first].stateRewards);
         boost::optional<std::vector<ValueType>> stateActionRewards;
         boost::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
-        if (rewardModelNameAndModel.second.hasStateRewards()) {
-            stateRewards = rewardModelNameAndModel.second.getStateRewardVector().toVector(odd);
-        }
         auto actRewIndexIt = rewardNameToActionRewardIndexMap.find(rewardModelNameAndModel.first);
         if (actRewIndexIt != rewardNameToActionRewardIndexMap.end()) {
             stateActionRewards = std::move(actionRewardVectors[actRewIndexIt->second]);
@@ -233,23 +275,7 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
                              storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
     }
 
-    storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
-
-    labelling.addLabel("init", symbolicMa.getInitialStates().toVector(odd));
-    labelling.addLabel("deadlock", symbolicMa.getDeadlockStates().toVector(odd));
-    if (formulas.empty()) {
-        for (auto const& label : symbolicMa.getLabels()) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-    } else {
-        LabelInformation labelInfo(formulas);
-        for (auto const& label : labelInfo.atomicLabels) {
-            labelling.addLabel(label, symbolicMa.getStates(label).toVector(odd));
-        }
-        for (auto const& expressionLabel : labelInfo.expressionLabels) {
-            labelling.addLabel(expressionLabel.first, symbolicMa.getStates(expressionLabel.second).toVector(odd));
-        }
-    }
+    storm::models::sparse::StateLabeling labelling = translateLabeling(symbolicMa, formulas, odd);
     storm::storage::BitVector markovianStates = symbolicMa.getMarkovianStates().toVector(odd);
     storm::storage::sparse::ModelComponents<ValueType> components(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels), false,
                                                                   std::move(markovianStates));
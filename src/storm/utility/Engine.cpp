@@ -1,10 +1,13 @@
 #include "storm/utility/Engine.h"
 
+#include <type_traits>
+
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/simulation/StatisticalModelChecker.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
@@ -50,6 +53,8 @@ std::string toString(Engine const& engine) {
             return "expl";
         case Engine::AbstractionRefinement:
             return "abs";
+        case Engine::Simulation:
+            return "smc";
         case Engine::Automatic:
             return "automatic";
         case Engine::Unknown:
@@ -93,6 +98,8 @@ storm::builder::BuilderType getBuilderType(Engine const& engine) {
             return storm::builder::BuilderType::Explicit;
         case Engine::AbstractionRefinement:
             return storm::builder::BuilderType::Dd;
+        case Engine::Simulation:
+            return storm::builder::BuilderType::Explicit;
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The given engine has no builder type to it.");
             return storm::builder::BuilderType::Explicit;
@@ -155,6 +162,11 @@ bool canHandle(storm::utility::Engine const& engine, storm::storage::SymbolicMod
                     return false;
             }
             break;
+        case Engine::Simulation:
+            // Traces are sampled with floating point arithmetic.
+            return std::is_same<ValueType, double>::value && modelType == ModelType::DTMC &&
+                   storm::modelchecker::StatisticalModelChecker<storm::models::sparse::Dtmc<double>>::canHandleStatic(
+                       checkTask.template convertValueType<double>());
         default:
             STORM_LOG_ERROR("The selected engine " << engine << " is not considered.");
     }
@@ -214,6 +226,8 @@ bool canHandle<storm::RationalFunction>(storm::utility::Engine const& engine, st
                     return false;
             }
             break;
+        case Engine::Simulation:
+            return false;
         default:
             STORM_LOG_ERROR("The selected engine" << engine << " is not considered.");
     }
@@ -0,0 +1,163 @@
+#include "storm/utility/FileCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+std::string const keyExtension = ".key";
+std::string const dataExtension = ".data";
+
+std::string getTemporarySuffix() {
+    static thread_local std::mt19937_64 generator(std::random_device{}());
+    std::stringstream stream;
+    stream << ".tmp" << std::hex << generator();
+    return stream.str();
+}
+}  // namespace
+
+FileCache::FileCache(std::string const& directory, uint64_t maximalSize) : directory(directory), maximalSize(maximalSize) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    STORM_LOG_THROW(std::filesystem::is_directory(directory), storm::exceptions::FileIoException,
+                    "Could not create cache directory " << directory << ": " << error.message());
+}
+
+boost::optional<std::string> FileCache::lookup(std::string const& key) const {
+    std::filesystem::path basePath = std::filesystem::path(directory) / getBaseName(key);
+    std::filesystem::path keyPath = basePath.string() + keyExtension;
+    std::filesystem::path dataPath = basePath.string() + dataExtension;
+
+    std::ifstream keyFile(keyPath, std::ios::binary);
+    if (!keyFile || !std::filesystem::exists(dataPath)) {
+        return boost::none;
+    }
+    std::string storedKey((std::istreambuf_iterator<char>(keyFile)), std::istreambuf_iterator<char>());
+    if (storedKey != key) {
+        STORM_LOG_DEBUG("Hash collision in cache directory " << directory << ".");
+        return boost::none;
+    }
+
+    // Mark the entry as recently used. This may fail if the entry was evicted concurrently, which is fine.
+    std::error_code error;
+    std::filesystem::last_write_time(keyPath, std::filesystem::file_time_type::clock::now(), error);
+    return dataPath.string();
+}
+
+void FileCache::store(std::string const& key, std::function<void(std::string const& filename)> const& writeData) const {
+    std::string baseName = getBaseName(key);
+    std::filesystem::path basePath = std::filesystem::path(directory) / baseName;
+    std::string suffix = getTemporarySuffix();
+    std::filesystem::path temporaryKeyPath = basePath.string() + keyExtension + suffix;
+    std::filesystem::path temporaryDataPath = basePath.string() + dataExtension + suffix;
+
+    try {
+        writeData(temporaryDataPath.string());
+        std::ofstream keyFile(temporaryKeyPath, std::ios::binary);
+        keyFile << key;
+        keyFile.close();
+        STORM_LOG_THROW(keyFile, storm::exceptions::FileIoException, "Could not write file " << temporaryKeyPath << ".");
+
+        // The key is moved into place last such that lookups never find a key without its data.
+        std::filesystem::rename(temporaryDataPath, basePath.string() + dataExtension);
+        std::filesystem::rename(temporaryKeyPath, basePath.string() + keyExtension);
+    } catch (...) {
+        std::error_code error;
+        std::filesystem::remove(temporaryDataPath, error);
+        std::filesystem::remove(temporaryKeyPath, error);
+        throw;
+    }
+    evict(baseName);
+}
+
+uint64_t FileCache::getSize() const {
+    uint64_t result = 0;
+    std::error_code error;
+    for (auto const& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.path().extension() == dataExtension) {
+            auto size = std::filesystem::file_size(entry.path(), error);
+            result += error ? 0 : size;
+        }
+    }
+    return result;
+}
+
+void FileCache::evict(std::string const& keep) const {
+    struct Entry {
+        std::filesystem::path basePath;
+        std::filesystem::file_time_type lastUse;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    std::error_code error;
+    for (auto const& file : std::filesystem::directory_iterator(directory, error)) {
+        if (file.path().extension() != keyExtension) {
+            continue;
+        }
+        Entry entry;
+        entry.basePath = file.path();
+        entry.basePath.replace_extension();
+        entry.lastUse = std::filesystem::last_write_time(file.path(), error);
+        if (error) {
+            continue;
+        }
+        entry.size = std::filesystem::file_size(entry.basePath.string() + dataExtension, error);
+        if (error) {
+            entry.size = 0;
+        }
+        totalSize += entry.size;
+        entries.push_back(std::move(entry));
+    }
+
+    auto removeEntry = [&error](std::filesystem::path const& basePath) {
+        std::filesystem::remove(basePath.string() + keyExtension, error);
+        std::filesystem::remove(basePath.string() + dataExtension, error);
+    };
+
+    // An entry that does not fit into the cache at all is removed right away instead of evicting everything else.
+    auto keptEntry = std::find_if(entries.begin(), entries.end(), [&keep](Entry const& entry) { return entry.basePath.filename() == keep; });
+    if (keptEntry != entries.end() && keptEntry->size > maximalSize) {
+        STORM_LOG_WARN("The new entry exceeds the maximal size of the cache in " << directory << " and is therefore removed again.");
+        removeEntry(keptEntry->basePath);
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](Entry const& first, Entry const& second) { return first.lastUse < second.lastUse; });
+    for (auto const& entry : entries) {
+        if (totalSize <= maximalSize) {
+            break;
+        }
+        if (entry.basePath.filename() == keep) {
+            continue;
+        }
+        STORM_LOG_DEBUG("Evicting " << entry.basePath << " from the cache.");
+        removeEntry(entry.basePath);
+        totalSize -= entry.size;
+    }
+}
+
+std::string FileCache::getBaseName(std::string const& key) const {
+    // 64-bit FNV-1a, which (unlike std::hash) yields the same names across platforms and runs.
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char character : key) {
+        hash ^= character;
+        hash *= 1099511628211ull;
+    }
+    std::stringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return stream.str();
+}
+
+}  // namespace utility
+}  // namespace storm
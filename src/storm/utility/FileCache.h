@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * A persistent cache that stores files in a directory. Entries are identified by (arbitrarily long) keys. For each
+ * entry, the directory holds a file with the key (whose name is derived from a hash of the key) and a file with the
+ * data. The total size of the data files is bounded; if it is exceeded, the least recently used entries are removed.
+ *
+ * Entries are written to temporary files first and then renamed, such that several processes may share one cache
+ * directory.
+ */
+class FileCache {
+   public:
+    /*!
+     * Creates a cache in the given directory (which is created if it does not exist).
+     *
+     * @param directory The directory that holds the entries.
+     * @param maximalSize The maximal total size (in bytes) of the data of all entries.
+     */
+    FileCache(std::string const& directory, uint64_t maximalSize);
+
+    /*!
+     * Looks up the entry with the given key and marks it as recently used.
+     *
+     * @return The name of the file that holds the data of the entry (if there is one).
+     */
+    boost::optional<std::string> lookup(std::string const& key) const;
+
+    /*!
+     * Stores a new entry (replacing an existing entry with the same key) and evicts the least recently used entries
+     * if the cache became too large.
+     *
+     * @param key The key of the new entry.
+     * @param writeData A callback that writes the data of the entry to the file with the given name.
+     */
+    void store(std::string const& key, std::function<void(std::string const& filename)> const& writeData) const;
+
+    /*!
+     * Retrieves the total size (in bytes) of the data of all entries.
+     */
+    uint64_t getSize() const;
+
+   private:
+    /*!
+     * Removes the least recently used entries until the size of the cache does not exceed the maximal size.
+     *
+     * @param keep The base name of an entry that is not to be removed.
+     */
+    void evict(std::string const& keep) const;
+
+    std::string getBaseName(std::string const& key) const;
+
+    std::string directory;
+    uint64_t maximalSize;
+};
+
+}  // namespace utility
+}  // namespace storm
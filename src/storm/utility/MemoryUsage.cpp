@@ -0,0 +1,59 @@
+#include "storm/utility/MemoryUsage.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace storm {
+namespace utility {
+
+void MemoryUsage::add(std::string const& component, uint64_t bytes) {
+    components.emplace_back(component, bytes);
+}
+
+std::vector<std::pair<std::string, uint64_t>> const& MemoryUsage::getComponents() const {
+    return components;
+}
+
+uint64_t MemoryUsage::getTotalBytes() const {
+    uint64_t result = 0;
+    for (auto const& component : components) {
+        result += component.second;
+    }
+    return result;
+}
+
+void MemoryUsage::printToStream(std::ostream& out) const {
+    uint64_t total = getTotalBytes();
+    std::ios_base::fmtflags oldFlags = out.flags();
+    std::streamsize oldPrecision = out.precision();
+    for (auto const& component : components) {
+        out << "  * " << component.first << ": " << formatBytes(component.second);
+        if (total > 0) {
+            out << " (" << std::fixed << std::setprecision(1) << (100.0 * component.second / total) << "%)";
+            out.flags(oldFlags);
+            out.precision(oldPrecision);
+        }
+        out << '\n';
+    }
+    out << "  * total: " << formatBytes(total) << '\n';
+}
+
+std::string formatBytes(uint64_t bytes) {
+    static char const* const units[] = {"B", "KB", "MB", "GB", "TB"};
+    double value = static_cast<double>(bytes);
+    uint64_t unit = 0;
+    while (value >= 1024.0 && unit < 4) {
+        value /= 1024.0;
+        ++unit;
+    }
+    std::stringstream stream;
+    if (unit == 0) {
+        stream << bytes << units[0];
+    } else {
+        stream << std::fixed << std::setprecision(1) << value << units[unit];
+    }
+    return stream.str();
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * A breakdown of the memory used by a data structure into its components.
+ */
+class MemoryUsage {
+   public:
+    /*!
+     * Adds a component with the given number of bytes. Components are kept in the order in which they are added.
+     */
+    void add(std::string const& component, uint64_t bytes);
+
+    /*!
+     * Retrieves the components and their number of bytes.
+     */
+    std::vector<std::pair<std::string, uint64_t>> const& getComponents() const;
+
+    /*!
+     * Retrieves the number of bytes of all components.
+     */
+    uint64_t getTotalBytes() const;
+
+    /*!
+     * Prints one line per component (with its share of the total) followed by the total.
+     */
+    void printToStream(std::ostream& out) const;
+
+   private:
+    std::vector<std::pair<std::string, uint64_t>> components;
+};
+
+/*!
+ * Formats the given number of bytes in a human-readable way (e.g. 1.5MB).
+ */
+std::string formatBytes(uint64_t bytes);
+
+}  // namespace utility
+}  // namespace storm
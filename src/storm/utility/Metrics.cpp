@@ -0,0 +1,198 @@
+#include "storm/utility/Metrics.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+
+uint64_t getResidentSetSizeInBytes() {
+    // The current resident set size is only available on Linux, elsewhere we fall back to the peak resident set size.
+    std::ifstream statm("/proc/self/statm");
+    uint64_t totalPages, residentPages;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    // For Linux, this is returned in kilobytes.
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+void writeValue(std::ostream& out, double value, bool json) {
+    if (std::isnan(value)) {
+        out << (json ? "null" : "NaN");
+    } else if (std::isinf(value)) {
+        out << (json ? "null" : (value > 0 ? "+Inf" : "-Inf"));
+    } else {
+        out << value;
+    }
+}
+
+}  // namespace
+
+JsonLinesMetricsSink::JsonLinesMetricsSink(std::string const& filename) : filename(filename) {
+    // Start with an empty file.
+    std::ofstream stream(filename, std::ios::trunc);
+    STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Unable to open the metrics file '" << filename << "'.");
+}
+
+void JsonLinesMetricsSink::publish(std::vector<MetricSample> const& snapshot, double secondsSinceStart) {
+    std::ofstream stream(filename, std::ios::app);
+    STORM_LOG_WARN_COND(stream, "Unable to write the metrics file '" << filename << "'.");
+    Metrics::writeJsonLine(stream, snapshot, secondsSinceStart);
+}
+
+PrometheusMetricsSink::PrometheusMetricsSink(std::string const& filename) : filename(filename) {
+    // Intentionally left empty.
+}
+
+void PrometheusMetricsSink::publish(std::vector<MetricSample> const& snapshot, double) {
+    // Readers must never see a partially written file, so we replace the file with a temporary one.
+    std::string temporaryFilename = filename + ".tmp";
+    {
+        std::ofstream stream(temporaryFilename, std::ios::trunc);
+        if (!stream) {
+            STORM_LOG_WARN("Unable to write the metrics file '" << temporaryFilename << "'.");
+            return;
+        }
+        Metrics::writePrometheus(stream, snapshot);
+    }
+    STORM_LOG_WARN_COND(std::rename(temporaryFilename.c_str(), filename.c_str()) == 0, "Unable to replace the metrics file '" << filename << "'.");
+}
+
+Metrics& Metrics::getInstance() {
+    static Metrics instance;
+    return instance;
+}
+
+Metrics::Metrics() : enabled(false), stopPublisher(false) {
+    // Intentionally left empty.
+}
+
+Metrics::~Metrics() {
+    stopPublishing();
+}
+
+void Metrics::enable() {
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void Metrics::disable() {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+void Metrics::setGauge(std::string const& name, double value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    metrics[name] = MetricSample{name, MetricSample::Type::Gauge, value};
+}
+
+void Metrics::addToCounter(std::string const& name, double value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto insertionResult = metrics.emplace(name, MetricSample{name, MetricSample::Type::Counter, 0.0});
+    insertionResult.first->second.value += value;
+}
+
+std::vector<MetricSample> Metrics::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<MetricSample> result;
+    result.reserve(metrics.size());
+    for (auto const& metric : metrics) {
+        result.push_back(metric.second);
+    }
+    return result;
+}
+
+void Metrics::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    metrics.clear();
+}
+
+void Metrics::addSink(std::shared_ptr<MetricsSink> const& sink) {
+    std::lock_guard<std::mutex> lock(publishingMutex);
+    sinks.push_back(sink);
+}
+
+void Metrics::startPublishing(std::chrono::milliseconds const& interval) {
+    STORM_LOG_THROW(!publisher.joinable(), storm::exceptions::IllegalFunctionCallException, "The metrics are already published.");
+    enable();
+    publishingStart = std::chrono::steady_clock::now();
+    stopPublisher = false;
+    publisher = std::thread([this, interval]() {
+        std::unique_lock<std::mutex> lock(publishingMutex);
+        while (!publishingCondition.wait_for(lock, interval, [this]() { return stopPublisher; })) {
+            lock.unlock();
+            publish();
+            lock.lock();
+        }
+    });
+}
+
+void Metrics::stopPublishing() {
+    if (!publisher.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(publishingMutex);
+        stopPublisher = true;
+    }
+    publishingCondition.notify_all();
+    publisher.join();
+    publish();
+    std::lock_guard<std::mutex> lock(publishingMutex);
+    sinks.clear();
+}
+
+void Metrics::publish() {
+    setGauge("storm_resident_memory_bytes", static_cast<double>(getResidentSetSizeInBytes()));
+    auto snapshot = getSnapshot();
+    double secondsSinceStart = std::chrono::duration<double>(std::chrono::steady_clock::now() - publishingStart).count();
+    std::vector<std::shared_ptr<MetricsSink>> currentSinks;
+    {
+        std::lock_guard<std::mutex> lock(publishingMutex);
+        currentSinks = sinks;
+    }
+    for (auto const& sink : currentSinks) {
+        sink->publish(snapshot, secondsSinceStart);
+    }
+}
+
+void Metrics::writeJsonLine(std::ostream& out, std::vector<MetricSample> const& snapshot, double secondsSinceStart) {
+    out << std::setprecision(std::numeric_limits<double>::max_digits10) << "{\"time\":" << secondsSinceStart;
+    for (auto const& sample : snapshot) {
+        out << ",\"" << sample.name << "\":";
+        writeValue(out, sample.value, true);
+    }
+    out << "}\n";
+}
+
+void Metrics::writePrometheus(std::ostream& out, std::vector<MetricSample> const& snapshot) {
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (auto const& sample : snapshot) {
+        out << "# TYPE " << sample.name << (sample.type == MetricSample::Type::Gauge ? " gauge" : " counter") << '\n';
+        out << sample.name << ' ';
+        writeValue(out, sample.value, false);
+        out << '\n';
+    }
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * The value of a single metric at some point in time.
+ */
+struct MetricSample {
+    enum class Type { Gauge, Counter };
+
+    std::string name;
+    Type type;
+    double value;
+};
+
+/*!
+ * Receives the snapshots of the metrics that are published periodically.
+ */
+class MetricsSink {
+   public:
+    virtual ~MetricsSink() = default;
+
+    /*!
+     * Receives the given snapshot. This is called by the publishing thread.
+     *
+     * @param secondsSinceStart The time since the publishing was started.
+     */
+    virtual void publish(std::vector<MetricSample> const& snapshot, double secondsSinceStart) = 0;
+};
+
+/*!
+ * Appends every snapshot as a single line of json to the given file, e.g. {"time":12.5,"storm_explored_states":1000000,...}.
+ */
+class JsonLinesMetricsSink : public MetricsSink {
+   public:
+    JsonLinesMetricsSink(std::string const& filename);
+    virtual void publish(std::vector<MetricSample> const& snapshot, double secondsSinceStart) override;
+
+   private:
+    std::string filename;
+};
+
+/*!
+ * Replaces the given file by every snapshot in the Prometheus text exposition format. The file is replaced atomically, so it can be served by
+ * the textfile collector of the Prometheus node exporter.
+ */
+class PrometheusMetricsSink : public MetricsSink {
+   public:
+    PrometheusMetricsSink(std::string const& filename);
+    virtual void publish(std::vector<MetricSample> const& snapshot, double secondsSinceStart) override;
+
+   private:
+    std::string filename;
+};
+
+/*!
+ * Collects gauges and counters that describe the progress of long-running computations (e.g. the number of explored states, the size of the
+ * exploration frontier or the residual of a solver), such that an external scheduler can detect stalled or exploding jobs. The metrics are disabled
+ * by default, in which case updating a metric only costs a single check. While publishing, a background thread periodically adds the resident
+ * memory of the process and passes a snapshot of all metrics to the registered sinks. The metrics are thread-safe.
+ */
+class Metrics {
+   public:
+    /*!
+     * Retrieves the (unique) metrics.
+     */
+    static Metrics& getInstance();
+
+    /*!
+     * Retrieves whether metrics are collected. Producers should check this before computing the values of metrics.
+     */
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * Enables or disables the collection of metrics.
+     */
+    void enable();
+    void disable();
+
+    /*!
+     * Sets the gauge with the given name to the given value.
+     */
+    void setGauge(std::string const& name, double value);
+
+    /*!
+     * Increases the counter with the given name by the given value.
+     */
+    void addToCounter(std::string const& name, double value);
+
+    /*!
+     * Retrieves the current values of all metrics, ordered by their names.
+     */
+    std::vector<MetricSample> getSnapshot() const;
+
+    /*!
+     * Removes all metrics.
+     */
+    void reset();
+
+    /*!
+     * Registers a sink that receives the published snapshots.
+     */
+    void addSink(std::shared_ptr<MetricsSink> const& sink);
+
+    /*!
+     * Enables the metrics and starts publishing a snapshot to all sinks in the given interval.
+     */
+    void startPublishing(std::chrono::milliseconds const& interval);
+
+    /*!
+     * Publishes a final snapshot and stops publishing. The sinks are removed.
+     */
+    void stopPublishing();
+
+    /*!
+     * Writes the given snapshot as a single line of json.
+     */
+    static void writeJsonLine(std::ostream& out, std::vector<MetricSample> const& snapshot, double secondsSinceStart);
+
+    /*!
+     * Writes the given snapshot in the Prometheus text exposition format.
+     */
+    static void writePrometheus(std::ostream& out, std::vector<MetricSample> const& snapshot);
+
+   private:
+    Metrics();
+    ~Metrics();
+
+    void publish();
+
+    std::atomic<bool> enabled;
+    mutable std::mutex mutex;
+    std::map<std::string, MetricSample> metrics;
+
+    std::mutex publishingMutex;
+    std::condition_variable publishingCondition;
+    std::vector<std::shared_ptr<MetricsSink>> sinks;
+    bool stopPublisher;
+    std::thread publisher;
+    std::chrono::steady_clock::time_point publishingStart;
+};
+
+}  // namespace utility
+}  // namespace storm
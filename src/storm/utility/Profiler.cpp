@@ -0,0 +1,217 @@
+#include "storm/utility/Profiler.h"
+
+#include <algorithm>
+#include <map>
+
+#include <sys/resource.h>
+#include <time.h>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace storm {
+namespace utility {
+
+namespace {
+
+// The names of the regions the current thread is in (innermost last).
+thread_local std::vector<char const*> regionStack;
+
+std::atomic<uint64_t> numberOfProfiledThreads(0);
+
+uint64_t getThreadIndex() {
+    thread_local uint64_t threadIndex = numberOfProfiledThreads++;
+    return threadIndex;
+}
+
+uint64_t getThreadCpuTimeInNanoseconds() {
+    struct timespec time;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+}
+
+int64_t getHeapInUseInBytes() {
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2, 33)
+    struct mallinfo2 info = mallinfo2();
+    return static_cast<int64_t>(info.uordblks + info.hblkhd);
+#else
+    return 0;
+#endif
+#else
+    // The heap usage is not available on this platform.
+    return 0;
+#endif
+}
+
+uint64_t getPeakResidentSetSizeInBytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef MACOS
+    // For Mac OS, this is returned in bytes.
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    // For Linux, this is returned in kilobytes.
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+}  // namespace
+
+Profiler::Profiler() : enabled(false), startTime(std::chrono::steady_clock::now()) {
+    // Intentionally left empty.
+}
+
+Profiler& Profiler::getInstance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::enable() {
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::disable() {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    records.clear();
+    startTime = std::chrono::steady_clock::now();
+}
+
+std::vector<ProfilingRecord> Profiler::getRecords() const {
+    std::vector<ProfilingRecord> result;
+    {
+        std::lock_guard<std::mutex> lock(recordsMutex);
+        result = records;
+    }
+    // Regions are recorded when they are left, so enclosing regions appear after the enclosed ones.
+    std::stable_sort(result.begin(), result.end(), [](ProfilingRecord const& first, ProfilingRecord const& second) {
+        return first.startInNanoseconds < second.startInNanoseconds || (first.startInNanoseconds == second.startInNanoseconds && first.depth < second.depth);
+    });
+    return result;
+}
+
+void Profiler::exportChromeTrace(std::ostream& out) const {
+    storm::json<double> events = storm::json<double>::array();
+    for (auto const& record : getRecords()) {
+        storm::json<double> event;
+        event["name"] = record.name;
+        event["cat"] = "storm";
+        event["ph"] = "X";
+        event["pid"] = 0;
+        event["tid"] = record.threadIndex;
+        // Chrome traces use microseconds.
+        event["ts"] = record.startInNanoseconds / 1000.0;
+        event["dur"] = record.wallTimeInNanoseconds / 1000.0;
+        event["args"]["path"] = record.path;
+        event["args"]["cpu_ms"] = record.cpuTimeInNanoseconds / 1000000.0;
+        event["args"]["allocated_bytes"] = record.allocatedBytes;
+        event["args"]["peak_rss_increase_bytes"] = record.peakResidentSetSizeIncreaseInBytes;
+        events.push_back(std::move(event));
+    }
+    storm::json<double> trace;
+    trace["traceEvents"] = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    out << trace.dump() << '\n';
+}
+
+void Profiler::exportSummary(std::ostream& out) const {
+    struct Summary {
+        uint64_t depth = 0;
+        uint64_t calls = 0;
+        uint64_t wallTimeInNanoseconds = 0;
+        uint64_t cpuTimeInNanoseconds = 0;
+        int64_t allocatedBytes = 0;
+        uint64_t peakResidentSetSizeIncreaseInBytes = 0;
+    };
+    std::map<std::string, Summary> summaries;
+    for (auto const& record : getRecords()) {
+        Summary& summary = summaries[record.path];
+        summary.depth = record.depth;
+        ++summary.calls;
+        summary.wallTimeInNanoseconds += record.wallTimeInNanoseconds;
+        summary.cpuTimeInNanoseconds += record.cpuTimeInNanoseconds;
+        summary.allocatedBytes += record.allocatedBytes;
+        summary.peakResidentSetSizeIncreaseInBytes += record.peakResidentSetSizeIncreaseInBytes;
+    }
+
+    storm::json<double> regions = storm::json<double>::array();
+    for (auto const& pathSummary : summaries) {
+        storm::json<double> region;
+        region["path"] = pathSummary.first;
+        region["depth"] = pathSummary.second.depth;
+        region["calls"] = pathSummary.second.calls;
+        region["wall_ms"] = pathSummary.second.wallTimeInNanoseconds / 1000000.0;
+        region["cpu_ms"] = pathSummary.second.cpuTimeInNanoseconds / 1000000.0;
+        region["allocated_bytes"] = pathSummary.second.allocatedBytes;
+        region["peak_rss_increase_bytes"] = pathSummary.second.peakResidentSetSizeIncreaseInBytes;
+        regions.push_back(std::move(region));
+    }
+    storm::json<double> summary;
+    summary["regions"] = std::move(regions);
+    summary["peak_rss_bytes"] = getPeakResidentSetSizeInBytes();
+    out << summary.dump(4) << '\n';
+}
+
+void Profiler::addRecord(ProfilingRecord&& record) {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    records.push_back(std::move(record));
+}
+
+std::chrono::steady_clock::time_point Profiler::getStartTime() const {
+    std::lock_guard<std::mutex> lock(recordsMutex);
+    return startTime;
+}
+
+ScopedProfilingRegion::ScopedProfilingRegion(char const* name) : active(Profiler::getInstance().isEnabled()), name(name) {
+    if (active) {
+        regionStack.push_back(name);
+        peakResidentSetSizeStartInBytes = getPeakResidentSetSizeInBytes();
+        heapStartInBytes = getHeapInUseInBytes();
+        cpuStartInNanoseconds = getThreadCpuTimeInNanoseconds();
+        wallStart = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedProfilingRegion::~ScopedProfilingRegion() {
+    if (!active) {
+        return;
+    }
+    auto wallEnd = std::chrono::steady_clock::now();
+    uint64_t cpuEndInNanoseconds = getThreadCpuTimeInNanoseconds();
+
+    Profiler& profiler = Profiler::getInstance();
+    ProfilingRecord record;
+    record.name = name;
+    for (auto const& regionName : regionStack) {
+        if (!record.path.empty()) {
+            record.path += '/';
+        }
+        record.path += regionName;
+    }
+    record.threadIndex = getThreadIndex();
+    record.depth = regionStack.size() - 1;
+    // Regions that started before the last reset are clamped to the start of the profiler.
+    auto profilerStart = profiler.getStartTime();
+    record.startInNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(wallStart, profilerStart) - profilerStart).count();
+    record.wallTimeInNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - wallStart).count();
+    record.cpuTimeInNanoseconds = cpuEndInNanoseconds >= cpuStartInNanoseconds ? cpuEndInNanoseconds - cpuStartInNanoseconds : 0;
+    record.allocatedBytes = getHeapInUseInBytes() - heapStartInBytes;
+    record.peakResidentSetSizeIncreaseInBytes = getPeakResidentSetSizeInBytes() - peakResidentSetSizeStartInBytes;
+    STORM_LOG_ASSERT(!regionStack.empty() && regionStack.back() == name, "Profiling regions are not properly nested.");
+    regionStack.pop_back();
+    profiler.addRecord(std::move(record));
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "storm-config.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * The measurements of a single execution of a profiling region.
+ */
+struct ProfilingRecord {
+    // The name of the region and the path of names of all enclosing regions (separated by '/').
+    std::string name;
+    std::string path;
+
+    // A small index identifying the thread that executed the region and the nesting depth of the region on that thread.
+    uint64_t threadIndex;
+    uint64_t depth;
+
+    // The start of the region relative to the start of the profiler as well as the wall and CPU time (of the executing thread) spent in the region.
+    uint64_t startInNanoseconds;
+    uint64_t wallTimeInNanoseconds;
+    uint64_t cpuTimeInNanoseconds;
+
+    // The change of the number of heap bytes in use (of the whole process, if supported by the platform) during the region.
+    int64_t allocatedBytes;
+
+    // The increase of the peak resident set size of the process during the region.
+    uint64_t peakResidentSetSizeIncreaseInBytes;
+};
+
+/*!
+ * Collects the records of all profiling regions that are executed while profiling is enabled. Profiling is disabled by default, in which case
+ * entering and leaving a region only costs a single check. Regions are intended to be coarse-grained (parsing, building, solver invocations, ...).
+ */
+class Profiler {
+   public:
+    /*!
+     * Retrieves the (unique) profiler.
+     */
+    static Profiler& getInstance();
+
+    /*!
+     * Enables the recording of regions. Only regions that are entered while profiling is enabled are recorded.
+     */
+    void enable();
+
+    /*!
+     * Disables the recording of regions. Regions that were entered before are still recorded once they are left.
+     */
+    void disable();
+
+    /*!
+     * Retrieves whether regions are currently recorded.
+     */
+    bool isEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * Drops all records and restarts the clock of the profiler.
+     */
+    void reset();
+
+    /*!
+     * Retrieves all records collected so far, ordered by their start.
+     */
+    std::vector<ProfilingRecord> getRecords() const;
+
+    /*!
+     * Writes all records in the Chrome trace event format, which can be viewed with chrome://tracing or https://ui.perfetto.dev.
+     */
+    void exportChromeTrace(std::ostream& out) const;
+
+    /*!
+     * Writes a json summary that aggregates the records of each region path (number of calls, total times, allocations and memory increase).
+     */
+    void exportSummary(std::ostream& out) const;
+
+    /*!
+     * Adds the given record. This is typically done by a ScopedProfilingRegion.
+     */
+    void addRecord(ProfilingRecord&& record);
+
+    /*!
+     * Retrieves the point in time relative to which the starts of regions are recorded.
+     */
+    std::chrono::steady_clock::time_point getStartTime() const;
+
+   private:
+    Profiler();
+
+    std::atomic<bool> enabled;
+    mutable std::mutex recordsMutex;
+    std::chrono::steady_clock::time_point startTime;
+    std::vector<ProfilingRecord> records;
+};
+
+/*!
+ * Records the region between construction and destruction if profiling is enabled upon construction. Regions may be nested.
+ * Use the STORM_PROFILE_SCOPE macro instead of this class to allow disabling the profiling at compile time.
+ */
+class ScopedProfilingRegion {
+   public:
+    /*!
+     * Enters a region with the given name. The name needs to outlive the region (typically, it is a string literal).
+     */
+    explicit ScopedProfilingRegion(char const* name);
+    ~ScopedProfilingRegion();
+
+    ScopedProfilingRegion(ScopedProfilingRegion const&) = delete;
+    ScopedProfilingRegion& operator=(ScopedProfilingRegion const&) = delete;
+
+   private:
+    bool active;
+    char const* name;
+    std::chrono::steady_clock::time_point wallStart;
+    uint64_t cpuStartInNanoseconds;
+    int64_t heapStartInBytes;
+    uint64_t peakResidentSetSizeStartInBytes;
+};
+
+}  // namespace utility
+}  // namespace storm
+
+#define STORM_PROFILE_CONCAT_IMPL(a, b) a##b
+#define STORM_PROFILE_CONCAT(a, b) STORM_PROFILE_CONCAT_IMPL(a, b)
+
+// Define STORM_PROFILE_SCOPE which records the remainder of the enclosing scope as a profiling region (unless profiling is disabled at compile time).
+#ifdef STORM_DISABLE_PROFILING
+#define STORM_PROFILE_SCOPE(name)
+#else
+#define STORM_PROFILE_SCOPE(name) storm::utility::ScopedProfilingRegion STORM_PROFILE_CONCAT(stormProfilingRegion, __LINE__)(name)
+#endif
@@ -0,0 +1,65 @@
+#include "storm/utility/RationalFunctionOperationCache.h"
+
+#include <functional>
+#include <mutex>
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace utility {
+
+namespace {
+std::mutex globalCacheMutex;
+std::shared_ptr<RationalFunctionOperationCache> globalCache;
+}  // namespace
+
+RationalFunctionOperationCache::RationalFunctionOperationCache(uint64_t maximalNumberOfEntries) : cache(maximalNumberOfEntries) {
+    // Intentionally left empty.
+}
+
+storm::RationalFunction RationalFunctionOperationCache::multiply(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+    return cache.getOrCompute(createKey(Operation::Multiply, first, second),
+                              [&first, &second]() { return storm::utility::simplify((storm::RationalFunction)(first * second)); });
+}
+
+storm::RationalFunction RationalFunctionOperationCache::add(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+    return cache.getOrCompute(createKey(Operation::Add, first, second),
+                              [&first, &second]() { return storm::utility::simplify((storm::RationalFunction)(first + second)); });
+}
+
+CacheStatistics RationalFunctionOperationCache::getStatistics() const {
+    return cache.getStatistics();
+}
+
+std::shared_ptr<RationalFunctionOperationCache> RationalFunctionOperationCache::getGlobalCache() {
+    std::lock_guard<std::mutex> lock(globalCacheMutex);
+    return globalCache;
+}
+
+void RationalFunctionOperationCache::setGlobalCache(std::shared_ptr<RationalFunctionOperationCache> const& cache) {
+    std::lock_guard<std::mutex> lock(globalCacheMutex);
+    globalCache = cache;
+}
+
+bool RationalFunctionOperationCache::Key::operator==(Key const& other) const {
+    return operation == other.operation && first == other.first && second == other.second;
+}
+
+std::size_t RationalFunctionOperationCache::KeyHash::operator()(Key const& key) const {
+    std::size_t seed = static_cast<std::size_t>(key.operation);
+    carl::hash_add(seed, std::hash<storm::RationalFunction>()(key.first));
+    carl::hash_add(seed, std::hash<storm::RationalFunction>()(key.second));
+    return seed;
+}
+
+RationalFunctionOperationCache::Key RationalFunctionOperationCache::createKey(Operation operation, storm::RationalFunction const& first,
+                                                                              storm::RationalFunction const& second) {
+    std::hash<storm::RationalFunction> hasher;
+    if (hasher(second) < hasher(first)) {
+        return Key{operation, second, first};
+    }
+    return Key{operation, first, second};
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/ShardedCache.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Memoizes the (simplified) results of arithmetic operations on rational functions. As rational functions are kept in
+ * normal form, every product or sum involves computing the GCD of (factorized) polynomials, and state elimination and
+ * related transformations tend to combine the same functions over and over again. The cache is thread-safe and its
+ * size is bounded.
+ *
+ * Note that the factorizations of the polynomials themselves are still managed by carl, whose (global) factorization
+ * cache is not thread-safe. Only the lookups in this cache may thus be performed concurrently.
+ */
+class RationalFunctionOperationCache {
+   public:
+    /*!
+     * Creates an empty cache.
+     *
+     * @param maximalNumberOfEntries The maximal number of results that are stored.
+     */
+    explicit RationalFunctionOperationCache(uint64_t maximalNumberOfEntries);
+
+    /*!
+     * Retrieves the simplified product of the given functions.
+     */
+    storm::RationalFunction multiply(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+    /*!
+     * Retrieves the simplified sum of the given functions.
+     */
+    storm::RationalFunction add(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+    /*!
+     * Retrieves the statistics of the accesses so far.
+     */
+    CacheStatistics getStatistics() const;
+
+    /*!
+     * Retrieves the cache that is shared by all parametric computations (or null if no such cache is used).
+     */
+    static std::shared_ptr<RationalFunctionOperationCache> getGlobalCache();
+
+    /*!
+     * Sets the cache that is shared by all parametric computations. Null disables sharing.
+     */
+    static void setGlobalCache(std::shared_ptr<RationalFunctionOperationCache> const& cache);
+
+   private:
+    enum class Operation { Multiply, Add };
+
+    struct Key {
+        Operation operation;
+        storm::RationalFunction first;
+        storm::RationalFunction second;
+
+        bool operator==(Key const& other) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    /*!
+     * Creates the key for the given (commutative) operation, ordering the operands such that both orders share an entry.
+     */
+    static Key createKey(Operation operation, storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+    ShardedCache<Key, storm::RationalFunction, KeyHash> cache;
+};
+
+}  // namespace utility
+}  // namespace storm
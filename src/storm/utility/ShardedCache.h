@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Statistics of the accesses to a cache.
+ */
+struct CacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t entries = 0;
+
+    /*!
+     * Retrieves the fraction of lookups that found an entry.
+     */
+    double getHitRate() const {
+        return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(hits + misses);
+    }
+};
+
+/*!
+ * A cache that maps keys to values and that may be accessed concurrently. The entries are distributed over several
+ * shards according to the hash of their key. Every shard is guarded by its own mutex, such that threads rarely wait
+ * for each other. The number of entries is bounded; if a shard becomes full, all of its entries are evicted.
+ */
+template<typename KeyType, typename ValueType, typename HashType = std::hash<KeyType>>
+class ShardedCache {
+   public:
+    typedef CacheStatistics Statistics;
+
+    /*!
+     * Creates an empty cache.
+     *
+     * @param maximalNumberOfEntries The maximal number of entries of the cache.
+     * @param numberOfShards The number of shards over which the entries are distributed.
+     */
+    explicit ShardedCache(uint64_t maximalNumberOfEntries, uint64_t numberOfShards = 64)
+        : maximalNumberOfEntriesPerShard(std::max<uint64_t>(1, maximalNumberOfEntries / std::max<uint64_t>(1, numberOfShards))),
+          hits(0),
+          misses(0),
+          evictions(0) {
+        for (uint64_t shard = 0; shard < std::max<uint64_t>(1, numberOfShards); ++shard) {
+            shards.push_back(std::make_unique<Shard>());
+        }
+    }
+
+    /*!
+     * Retrieves the value stored for the given key (if any).
+     */
+    boost::optional<ValueType> lookup(KeyType const& key) const {
+        Shard& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.entries.find(key);
+        if (it == shard.entries.end()) {
+            ++misses;
+            return boost::none;
+        }
+        ++hits;
+        return it->second;
+    }
+
+    /*!
+     * Stores the value for the given key (unless there already is one).
+     */
+    void insert(KeyType const& key, ValueType const& value) {
+        Shard& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.entries.size() >= maximalNumberOfEntriesPerShard) {
+            evictions += shard.entries.size();
+            shard.entries.clear();
+        }
+        shard.entries.emplace(key, value);
+    }
+
+    /*!
+     * Retrieves the value stored for the given key. If there is none, it is computed with the given function (without
+     * holding a lock, so concurrent calls may compute the same value) and stored.
+     */
+    template<typename ComputeFunction>
+    ValueType getOrCompute(KeyType const& key, ComputeFunction const& compute) {
+        if (auto value = lookup(key)) {
+            return std::move(value.get());
+        }
+        ValueType value = compute();
+        insert(key, value);
+        return value;
+    }
+
+    /*!
+     * Removes all entries. The statistics are kept.
+     */
+    void clear() {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->entries.clear();
+        }
+    }
+
+    /*!
+     * Retrieves the statistics of the accesses so far.
+     */
+    Statistics getStatistics() const {
+        Statistics result;
+        result.hits = hits;
+        result.misses = misses;
+        result.evictions = evictions;
+        for (auto const& shard : shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result.entries += shard->entries.size();
+        }
+        return result;
+    }
+
+   private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<KeyType, ValueType, HashType> entries;
+    };
+
+    Shard& getShard(KeyType const& key) const {
+        // Mix the hash such that the shard does not depend on the same bits as the bucket within the shard.
+        uint64_t hash = static_cast<uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ull;
+        return *shards[(hash >> 32) % shards.size()];
+    }
+
+    HashType hasher;
+    uint64_t maximalNumberOfEntriesPerShard;
+    std::vector<std::unique_ptr<Shard>> shards;
+    mutable std::atomic<uint64_t> hits;
+    mutable std::atomic<uint64_t> misses;
+    std::atomic<uint64_t> evictions;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -10,6 +10,8 @@ namespace resources {
 // Maximal waiting time after abort signal before terminating
 int maxWaitTime = 0;
 
+thread_local std::atomic<bool> const* threadTerminationFlag = nullptr;
+
 SignalInformation::SignalInformation() : terminate(false), lastSignal(0) {}
 
 SignalInformation::~SignalInformation() {
@@ -30,7 +32,7 @@ SignalInformation& SignalInformation::infos() {
  * @param signal Exit code of signal.
  */
 void signalHandler(int signal) {
-    if (!isTerminate()) {
+    if (!SignalInformation::infos().isTerminate()) {
         // First time we get an abort signal
         // We give the program a number of seconds to print results obtained so far before termination
         std::cerr << "ERROR: The program received signal " << signal << " and will be aborted in " << maxWaitTime << "s.\n";
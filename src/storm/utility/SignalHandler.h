@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 
@@ -105,13 +106,27 @@ inline void resetTimeoutAlarm() {
     alarm(0);
 }
 
+// The termination flag of the calling thread (if any), see setThreadTerminationFlag.
+extern thread_local std::atomic<bool> const* threadTerminationFlag;
+
+/*!
+ * Sets a flag that tells the computations of the calling thread to terminate once it is set (in addition to abort
+ * signals). This allows to abort a single computation while others continue, e.g. in a server that answers several
+ * queries concurrently.
+ *
+ * @param flag The flag, which has to outlive the computations of the calling thread. Null removes the flag.
+ */
+inline void setThreadTerminationFlag(std::atomic<bool> const* flag) {
+    threadTerminationFlag = flag;
+}
+
 /*!
- * Check whether the program should terminate (due to some abort signal).
+ * Check whether the program (or the computation of the calling thread) should terminate (due to some abort signal).
  *
  * @return True iff program should terminate.
  */
 inline bool isTerminate() {
-    return SignalInformation::infos().isTerminate();
+    return SignalInformation::infos().isTerminate() || (threadTerminationFlag != nullptr && threadTerminationFlag->load(std::memory_order_relaxed));
 }
 
 /*!
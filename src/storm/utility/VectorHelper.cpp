@@ -9,7 +9,6 @@
 
 #include "storm/utility/vector.h"
 
-#include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
 
@@ -17,10 +16,8 @@ namespace storm {
 namespace utility {
 
 template<typename ValueType>
-VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
-#ifndef STORM_HAVE_INTELTBB
-    STORM_LOG_THROW(!doParallelize, storm::exceptions::InvalidSettingsException, "Cannot parallelize without TBB.");
-#endif
+VectorHelper<ValueType>::VectorHelper() : doParallelize(storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads() > 1) {
+    // Intentionally left empty.
 }
 
 template<typename ValueType>
@@ -31,15 +28,11 @@ bool VectorHelper<ValueType>::parallelize() const {
 template<typename ValueType>
 void VectorHelper<ValueType>::reduceVector(storm::solver::OptimizationDirection dir, std::vector<ValueType> const& source, std::vector<ValueType>& target,
                                            std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) const {
-#ifdef STORM_HAVE_INTELTBB
     if (this->parallelize()) {
         storm::utility::vector::reduceVectorMinOrMaxParallel(dir, source, target, rowGrouping, choices);
     } else {
         storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
     }
-#else
-    storm::utility::vector::reduceVectorMinOrMax(dir, source, target, rowGrouping, choices);
-#endif
 }
 
 template<>
@@ -53,6 +53,11 @@ bool isNan(double const& value) {
     return std::isnan(value);
 }
 
+template<>
+bool isNan(float const& value) {
+    return std::isnan(value);
+}
+
 template<typename ValueType>
 bool isAlmostZero(ValueType const& a) {
     return a < convertNumber<ValueType>(1e-12) && a > -convertNumber<ValueType>(1e-12);
@@ -952,6 +957,34 @@ template typename NumberTraits<double>::IntegerType trunc(double const& number);
 template double mod(double const& first, double const& second);
 template std::string to_string(double const& value);
 
+// float
+template float one();
+template float zero();
+template float infinity();
+template bool isOne(float const& value);
+template bool isZero(float const& value);
+template bool isAlmostZero(float const& value);
+template bool isAlmostOne(float const& value);
+template bool isConstant(float const& value);
+template bool isInfinity(float const& value);
+template bool isInteger(float const& number);
+template float simplify(float value);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, float> simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, float> matrixEntry);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, float>& simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, float>& matrixEntry);
+template storm::storage::MatrixEntry<storm::storage::sparse::state_type, float>&& simplify(
+    storm::storage::MatrixEntry<storm::storage::sparse::state_type, float>&& matrixEntry);
+template std::pair<float, float> minmax(std::vector<float> const&);
+template float minimum(std::vector<float> const&);
+template float maximum(std::vector<float> const&);
+template float max(float const& first, float const& second);
+template float min(float const& first, float const& second);
+template float abs(float const& number);
+template std::string to_string(float const& value);
+template float convertNumber(double const& number);
+template double convertNumber(float const& number);
+
 // int
 template int one();
 template int zero();
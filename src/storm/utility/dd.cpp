@@ -6,6 +6,8 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -94,6 +96,36 @@ storm::dd::Bdd<Type> getRowColumnDiagonal(
     return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Add<Type, ValueType> roundToGrid(storm::dd::Add<Type, ValueType> const& add, ValueType const& grid, storm::solver::DdTerminalRounding const& mode) {
+    storm::dd::Add<Type, ValueType> gridAdd = add.getDdManager().getConstant(grid);
+    storm::dd::Add<Type, ValueType> gridPoints = add / gridAdd;
+    switch (mode) {
+        case storm::solver::DdTerminalRounding::Down:
+            gridPoints = gridPoints.floor();
+            break;
+        case storm::solver::DdTerminalRounding::Up:
+            gridPoints = gridPoints.ceil();
+            break;
+        case storm::solver::DdTerminalRounding::Nearest:
+            gridPoints = (gridPoints + add.getDdManager().getConstant(storm::utility::convertNumber<ValueType>(0.5))).floor();
+            break;
+    }
+    return gridPoints * gridAdd;
+}
+
+template<storm::dd::DdType Type, typename ValueType>
+void reportRoundingError(ValueType const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations, ValueType const& precision,
+                         storm::dd::Add<Type, ValueType> const& values) {
+    ValueType errorPerIteration = mode == storm::solver::DdTerminalRounding::Nearest ? ValueType(grid / storm::utility::convertNumber<ValueType>(2)) : grid;
+    ValueType errorBound = errorPerIteration * storm::utility::convertNumber<ValueType>(iterations);
+    STORM_LOG_INFO("Rounded the values " << toString(mode) << " to a grid of distance " << grid << " in " << iterations << " iterations, resulting in "
+                                         << values.getLeafCount() << " terminals and " << values.getNodeCount()
+                                         << " nodes. The rounding changed the result by at most " << errorBound << ".");
+    STORM_LOG_WARN_COND(errorBound <= precision, "The bound " << errorBound << " on the error introduced by rounding the values to a grid exceeds the "
+                                                              << "precision " << precision << ". Consider choosing a finer grid.");
+}
+
 template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates,
                                                                                              storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions,
                                                                                              std::set<storm::expressions::Variable> const& rowMetaVariables,
@@ -120,6 +152,26 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(
     storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager,
     std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+template void reportRoundingError(double const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations, double const& precision,
+                                  storm::dd::Add<storm::dd::DdType::CUDD, double> const& values);
+template void reportRoundingError(double const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations, double const& precision,
+                                  storm::dd::Add<storm::dd::DdType::Sylvan, double> const& values);
+template void reportRoundingError(storm::RationalNumber const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations,
+                                  storm::RationalNumber const& precision, storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> const& values);
+template void reportRoundingError(storm::RationalNumber const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations,
+                                  storm::RationalNumber const& precision, storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> const& values);
+
+template storm::dd::Add<storm::dd::DdType::CUDD, double> roundToGrid(storm::dd::Add<storm::dd::DdType::CUDD, double> const& add, double const& grid,
+                                                                     storm::solver::DdTerminalRounding const& mode);
+template storm::dd::Add<storm::dd::DdType::Sylvan, double> roundToGrid(storm::dd::Add<storm::dd::DdType::Sylvan, double> const& add, double const& grid,
+                                                                       storm::solver::DdTerminalRounding const& mode);
+template storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> roundToGrid(storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> const& add,
+                                                                                    storm::RationalNumber const& grid,
+                                                                                    storm::solver::DdTerminalRounding const& mode);
+template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> roundToGrid(
+    storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> const& add, storm::RationalNumber const& grid,
+    storm::solver::DdTerminalRounding const& mode);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
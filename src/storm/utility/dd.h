@@ -21,6 +21,10 @@ template<storm::dd::DdType Type, typename ValueType>
 class Add;
 }  // namespace dd
 
+namespace solver {
+enum class DdTerminalRounding;
+}
+
 namespace utility {
 namespace dd {
 
@@ -43,6 +47,33 @@ template<storm::dd::DdType Type>
 storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager,
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+/*!
+ * Rounds all values of the given ADD to multiples of the given grid distance. As values that fall onto the same grid point share a terminal, this
+ * bounds the number of distinct terminals of ADDs whose values lie in a bounded interval.
+ *
+ * @param add The ADD whose values to round.
+ * @param grid The (positive) distance of the grid points.
+ * @param mode The direction in which to round. Rounding to the nearest grid point changes each value by at most half the grid distance, rounding
+ * down (up) by at most the grid distance, but never increases (decreases) a value.
+ * @return The rounded ADD.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+storm::dd::Add<Type, ValueType> roundToGrid(storm::dd::Add<Type, ValueType> const& add, ValueType const& grid, storm::solver::DdTerminalRounding const& mode);
+
+/*!
+ * Reports the error that rounding the values to a grid in each iteration of a (non-expansive) fixed point iteration may have introduced. This error
+ * accumulates over the iterations, so a warning is issued if the bound on it exceeds the precision of the iteration.
+ *
+ * @param grid The distance of the grid points.
+ * @param mode The direction in which the values were rounded.
+ * @param iterations The number of iterations in which the values were rounded.
+ * @param precision The precision of the iteration.
+ * @param values The values resulting from the iteration.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+void reportRoundingError(ValueType const& grid, storm::solver::DdTerminalRounding const& mode, uint64_t iterations, ValueType const& precision,
+                         storm::dd::Add<Type, ValueType> const& values);
+
 }  // namespace dd
 }  // namespace utility
 }  // namespace storm
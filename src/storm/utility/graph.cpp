@@ -12,6 +12,7 @@
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/abstraction/ExplicitGameStrategyPair.h"
+#include "storm/storage/SparsePattern.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/models/sparse/DeterministicModel.h"
@@ -25,6 +26,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include <queue>
 
@@ -113,6 +115,12 @@ storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> con
     return reachableStates;
 }
 
+template<typename T>
+storm::storage::BitVector getRelevantMaybeStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& relevantStates,
+                                                 storm::storage::BitVector const& maybeStates) {
+    return getReachableStates(transitionMatrix, relevantStates & maybeStates, maybeStates, storm::storage::BitVector(maybeStates.size()));
+}
+
 template<typename T>
 storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<T> const& transitionMatrix) {
     storm::storage::BitVector result(transitionMatrix.getRowGroupCount());
@@ -306,65 +314,104 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
     return distances;
 }
 
-template<typename T>
-storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-    // Prepare the resulting bit vector.
-    uint_fast64_t numberOfStates = phiStates.size();
-    storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-
-    // Add all psi states as they already satisfy the condition.
-    statesWithProbabilityGreater0 |= psiStates;
-
-    // Initialize the stack used for the DFS with the states.
-    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-
-    // Initialize the stack for the step bound, if the number of steps is bounded.
-    std::vector<uint_fast64_t> stepStack;
-    std::vector<uint_fast64_t> remainingSteps;
-    if (useStepBound) {
-        stepStack.reserve(numberOfStates);
-        stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-        remainingSteps.resize(numberOfStates);
-        for (auto state : psiStates) {
-            remainingSteps[state] = maximalSteps;
+namespace {
+
+// The number of states that are processed at once in a bottom-up step. As the chunks write to disjoint buckets of
+// the resulting bit vector, this has to be a multiple of 64.
+uint64_t const BOTTOM_UP_CHUNK_SIZE = 64 * 64;
+uint64_t const TOP_DOWN_CHUNK_SIZE = 1024;
+// A bottom-up step is performed if the frontier is larger than the given fraction of the states that were not yet found.
+uint64_t const BOTTOM_UP_FRONTIER_DIVISOR = 14;
+
+/*!
+ * Computes the phi states that can reach a psi state (within the given number of steps) by a direction-optimizing
+ * breadth-first search. Top-down steps expand the frontier along the backward transitions. Bottom-up steps check
+ * for every phi state that has not yet been found whether one of its successors (according to the transition matrix)
+ * was already found, which is cheaper for large frontiers and does not require the backward transitions. Both
+ * kinds of steps are parallelized over the default number of threads. If there are multiple choices per state,
+ * states are found if they have some choice that leads to a found state.
+ *
+ * @param transitionMatrix If not null, the transition matrix that is used for bottom-up steps.
+ * @param backwardTransitions If not null, the (row-group-joined) backward transitions that are used for top-down steps.
+ * They are either given as a matrix or as a pattern.
+ */
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performBackwardBreadthFirstSearch(storm::storage::SparseMatrix<T> const* transitionMatrix,
+                                                            BackwardTransitionsType const* backwardTransitions,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            bool useStepBound, uint_fast64_t maximalSteps) {
+    STORM_LOG_ASSERT(transitionMatrix || backwardTransitions, "Expected either forward or backward transitions.");
+    uint64_t const numberOfStates = phiStates.size();
+    uint64_t const numberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+
+    storm::storage::BitVector result = psiStates;
+    std::vector<uint64_t> frontier(psiStates.begin(), psiStates.end());
+    uint64_t remainingStates = phiStates.getNumberOfSetBits() - (phiStates & psiStates).getNumberOfSetBits();
+
+    for (uint64_t step = 0; !frontier.empty() && remainingStates > 0 && (!useStepBound || step < maximalSteps); ++step) {
+        std::vector<uint64_t> nextFrontier;
+        if (transitionMatrix && (!backwardTransitions || frontier.size() * BOTTOM_UP_FRONTIER_DIVISOR > remainingStates)) {
+            storm::storage::BitVector foundStates(numberOfStates);
+            storm::utility::parallel::forEachChunk(0, numberOfStates, BOTTOM_UP_CHUNK_SIZE, numberOfThreads,
+                                                   [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                       for (uint64_t state = phiStates.getNextSetIndex(chunkBegin); state < chunkEnd;
+                                                            state = phiStates.getNextSetIndex(state + 1)) {
+                                                           if (result.get(state)) {
+                                                               continue;
+                                                           }
+                                                           for (auto const& entry : transitionMatrix->getRowGroup(state)) {
+                                                               if (!storm::utility::isZero(entry.getValue()) && result.get(entry.getColumn())) {
+                                                                   foundStates.set(state);
+                                                                   break;
+                                                               }
+                                                           }
+                                                       }
+                                                   });
+            nextFrontier.assign(foundStates.begin(), foundStates.end());
+            result |= foundStates;
+        } else {
+            std::vector<std::vector<uint64_t>> foundStatesPerThread(numberOfThreads);
+            storm::utility::parallel::forEachChunk(0, frontier.size(), TOP_DOWN_CHUNK_SIZE, numberOfThreads,
+                                                   [&](uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                                       std::vector<uint64_t>& foundStates = foundStatesPerThread[threadIndex];
+                                                       for (uint64_t index = chunkBegin; index < chunkEnd; ++index) {
+                                                           for (auto const& entry : backwardTransitions->getRow(frontier[index])) {
+                                                               if (phiStates.get(entry.getColumn()) && !result.get(entry.getColumn())) {
+                                                                   foundStates.push_back(entry.getColumn());
+                                                               }
+                                                           }
+                                                       }
+                                                   });
+            for (auto const& foundStates : foundStatesPerThread) {
+                for (auto state : foundStates) {
+                    if (!result.get(state)) {
+                        result.set(state);
+                        nextFrontier.push_back(state);
+                    }
+                }
+            }
         }
+        remainingStates -= nextFrontier.size();
+        frontier = std::move(nextFrontier);
     }
 
-    // Perform the actual DFS.
-    uint_fast64_t currentState, currentStepBound;
-    while (!stack.empty()) {
-        currentState = stack.back();
-        stack.pop_back();
+    return result;
+}
 
-        if (useStepBound) {
-            currentStepBound = stepStack.back();
-            stepStack.pop_back();
-            if (currentStepBound == 0) {
-                continue;
-            }
-        }
+}  // namespace
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState),
-                                                                      entryIte = backwardTransitions.end(currentState);
-             entryIt != entryIte; ++entryIt) {
-            if (phiStates[entryIt->getColumn()] &&
-                (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-
-                // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                if (useStepBound) {
-                    // As there is at least one more step to go, we need to push the state and the new number of steps.
-                    remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                    stepStack.push_back(currentStepBound - 1);
-                }
-                stack.push_back(entryIt->getColumn());
-            }
-        }
-    }
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    return performBackwardBreadthFirstSearch<T>(nullptr, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
 
-    // Return result.
-    return statesWithProbabilityGreater0;
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound,
+                                              uint_fast64_t maximalSteps) {
+    return performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
 }
 
 template<typename T>
@@ -388,8 +435,14 @@ template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
+    return performProb01(model.getTransitionMatrix(), model.getBackwardTransitionPattern(), phiStates, psiStates);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
     result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
     result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
     result.first.complement();
@@ -397,7 +450,45 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
 }
 
 template<typename T>
-std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates);
+    result.second = performProbGreater0(transitionMatrix, backwardTransitions, ~psiStates, ~result.first);
+    result.second.complement();
+    result.first.complement();
+    return result;
+}
+
+storm::storage::BitVector performProbGreater0(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    // The value type is irrelevant as no transition matrix is given.
+    return performBackwardBreadthFirstSearch<double>(nullptr, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound,
+                                              uint_fast64_t maximalSteps) {
+    return performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+storm::storage::BitVector performProb1(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const&,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+    storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
+    statesWithProbability1.complement();
+    return statesWithProbability1;
+}
+
+storm::storage::BitVector performProb1(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbabilityGreater0 = performProbGreater0(backwardTransitions, phiStates, psiStates);
+    return performProb1(backwardTransitions, phiStates, psiStates, statesWithProbabilityGreater0);
+}
+
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparsePattern const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
@@ -407,6 +498,19 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
     return result;
 }
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparsePattern const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates);
+    result.second = performProbGreater0(transitionMatrix, backwardTransitions, ~psiStates, ~result.first);
+    result.second.complement();
+    result.first.complement();
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
                                          storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates,
@@ -433,6 +537,87 @@ storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, Va
     return statesWithProbabilityGreater0;
 }
 
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> getTopologicallyOrderedSccBlocks(storm::models::symbolic::Model<Type, ValueType> const& model,
+                                                                   storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& states,
+                                                                   uint64_t minimalBlockSize) {
+    storm::dd::DdManager<Type> const& manager = model.getManager();
+    std::vector<storm::dd::Bdd<Type>> result;
+    storm::dd::Bdd<Type> currentBlock = manager.getBddZero();
+    uint64_t currentBlockSize = 0;
+    auto addToBlock = [&](storm::dd::Bdd<Type> const& sccs) {
+        currentBlock |= sccs;
+        currentBlockSize += sccs.getNonZeroCount();
+        if (currentBlockSize >= minimalBlockSize) {
+            result.push_back(currentBlock);
+            currentBlock = manager.getBddZero();
+            currentBlockSize = 0;
+        }
+    };
+
+    // The sets that still need to be processed together with a flag that indicates whether the set is a single SCC. The set on top of the stack
+    // is always the next one in the topological order, i.e., all of its transitions lead to the states that were already added to a block, to the
+    // set itself or to the outside of the given states.
+    std::vector<std::pair<storm::dd::Bdd<Type>, bool>> stack;
+    stack.emplace_back(states, false);
+    while (!stack.empty()) {
+        storm::dd::Bdd<Type> remainingStates = std::move(stack.back().first);
+        bool isScc = stack.back().second;
+        stack.pop_back();
+        if (isScc) {
+            addToBlock(remainingStates);
+            continue;
+        }
+
+        // Split off the states without successors in the set. Each of them forms an SCC on its own.
+        while (!remainingStates.isZero()) {
+            storm::dd::Bdd<Type> statesWithSuccessor =
+                remainingStates.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables()) && remainingStates;
+            if (statesWithSuccessor == remainingStates) {
+                break;
+            }
+            addToBlock(remainingStates && !statesWithSuccessor);
+            remainingStates = statesWithSuccessor;
+        }
+        if (remainingStates.isZero()) {
+            continue;
+        }
+
+        // Determine the SCC of some state by a forward and a backward search within the set.
+        storm::dd::Bdd<Type> pivot = remainingStates.existsAbstractRepresentative(model.getRowVariables());
+        storm::dd::Bdd<Type> forwardStates = pivot;
+        storm::dd::Bdd<Type> frontier = pivot;
+        while (!frontier.isZero()) {
+            frontier = frontier.relationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables()) && remainingStates && !forwardStates;
+            forwardStates |= frontier;
+        }
+        storm::dd::Bdd<Type> backwardStates = pivot;
+        frontier = pivot;
+        while (!frontier.isZero()) {
+            frontier = frontier.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables()) && remainingStates &&
+                       !backwardStates;
+            backwardStates |= frontier;
+        }
+        storm::dd::Bdd<Type> scc = forwardStates && backwardStates;
+
+        // The states only reachable from the SCC come first and the states only reaching the SCC come last. The remaining states can neither reach
+        // nor be reached from the SCC, but they may reach states of the former and be reached from states of the latter set.
+        std::vector<std::pair<storm::dd::Bdd<Type>, bool>> parts = {{forwardStates && !scc, false},
+                                                                    {remainingStates && !forwardStates && !backwardStates, false},
+                                                                    {scc, true},
+                                                                    {backwardStates && !scc, false}};
+        for (auto partIt = parts.rbegin(); partIt != parts.rend(); ++partIt) {
+            if (!partIt->first.isZero()) {
+                stack.push_back(std::move(*partIt));
+            }
+        }
+    }
+    if (currentBlockSize > 0) {
+        result.push_back(currentBlock);
+    }
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> performProb1(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
                                   storm::dd::Bdd<Type> const&, storm::dd::Bdd<Type> const& psiStates,
@@ -680,61 +865,7 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-    size_t numberOfStates = phiStates.size();
-
-    // Prepare resulting bit vector.
-    storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-
-    // Add all psi states as the already satisfy the condition.
-    statesWithProbabilityGreater0 |= psiStates;
-
-    // Initialize the stack used for the DFS with the states
-    std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-
-    // Initialize the stack for the step bound, if the number of steps is bounded.
-    std::vector<uint_fast64_t> stepStack;
-    std::vector<uint_fast64_t> remainingSteps;
-    if (useStepBound) {
-        stepStack.reserve(numberOfStates);
-        stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-        remainingSteps.resize(numberOfStates);
-        for (auto state : psiStates) {
-            remainingSteps[state] = maximalSteps;
-        }
-    }
-
-    // Perform the actual DFS.
-    uint_fast64_t currentState, currentStepBound;
-    while (!stack.empty()) {
-        currentState = stack.back();
-        stack.pop_back();
-
-        if (useStepBound) {
-            currentStepBound = stepStack.back();
-            stepStack.pop_back();
-            if (currentStepBound == 0) {
-                continue;
-            }
-        }
-
-        for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState),
-                                                                      entryIte = backwardTransitions.end(currentState);
-             entryIt != entryIte; ++entryIt) {
-            if (phiStates.get(entryIt->getColumn()) &&
-                (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                if (useStepBound) {
-                    // If there is at least one more step to go, we need to push the state and the new number of steps.
-                    remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                    stepStack.push_back(currentStepBound - 1);
-                }
-                statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-                stack.push_back(entryIt->getColumn());
-            }
-        }
-    }
-
-    return statesWithProbabilityGreater0;
+    return performBackwardBreadthFirstSearch<T>(nullptr, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
 }
 
 template<typename T>
@@ -745,11 +876,25 @@ storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& b
     return statesWithProbability0;
 }
 
-template<typename T>
-storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+storm::storage::BitVector performProbGreater0E(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    // The value type is irrelevant as no transition matrix is given.
+    return performBackwardBreadthFirstSearch<double>(nullptr, &backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+storm::storage::BitVector performProb0A(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 = performProbGreater0E(backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProb1EHelper(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                              BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -769,8 +914,8 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
             currentState = stack.back();
             stack.pop_back();
 
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
+            auto predecessors = backwardTransitions.getRow(currentState);
+            for (auto predecessorEntryIt = predecessors.begin(), predecessorEntryIte = predecessors.end();
                  predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                 if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
                     // Check whether the predecessor has only successors in the current state set for one of the
@@ -815,6 +960,23 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
 
     return currentStates;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProb1EHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProb1EHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
 
 template<typename T, typename RM>
 storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<T, RM> const& model,
@@ -831,26 +993,39 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::BitVector const& psiStates) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
-    result.first = performProb0A(backwardTransitions, phiStates, psiStates);
+    result.first = ~performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, phiStates, psiStates, false, 0);
 
     result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     return result;
 }
 
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparsePattern const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = ~performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, phiStates, psiStates, false, 0);
+    result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    return result;
+}
+
 template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
+    return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitionPattern(), phiStates,
                             psiStates);
 }
 
-template<typename T>
-storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
-                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProbGreater0AHelper(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                     std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                     BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                     storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                     boost::optional<storm::storage::BitVector> const& choiceConstraint) {
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -888,8 +1063,8 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
             }
         }
 
-        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                      predecessorEntryIte = backwardTransitions.end(currentState);
+        auto predecessors = backwardTransitions.getRow(currentState);
+        for (auto predecessorEntryIt = predecessors.begin(), predecessorEntryIte = predecessors.end();
              predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
             if (phiStates.get(predecessorEntryIt->getColumn())) {
                 if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
@@ -963,6 +1138,27 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
 
     return statesWithProbabilityGreater0;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProbGreater0AHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps,
+                                      choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    return performProbGreater0AHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps,
+                                      choiceConstraint);
+}
 
 template<typename T, typename RM>
 storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<T, RM> const& model,
@@ -985,6 +1181,17 @@ storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& t
     return statesWithProbability0;
 }
 
+template<typename T>
+storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 =
+        performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
 template<typename T, typename RM>
 storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -992,11 +1199,12 @@ storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicM
     return performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
 }
 
-template<typename T>
-storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
-                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
-                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates) {
+namespace {
+template<typename T, typename BackwardTransitionsType>
+storm::storage::BitVector performProb1AHelper(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                              BackwardTransitionsType const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates) {
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -1016,8 +1224,8 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
             currentState = stack.back();
             stack.pop_back();
 
-            for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState),
-                                                                          predecessorEntryIte = backwardTransitions.end(currentState);
+            auto predecessors = backwardTransitions.getRow(currentState);
+            for (auto predecessorEntryIt = predecessors.begin(), predecessorEntryIte = predecessors.end();
                  predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
                 if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
                     // Check whether the predecessor has only successors in the current state set for all of the
@@ -1066,6 +1274,23 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
     }
     return currentStates;
 }
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    return performProb1AHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    return performProb1AHelper(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
 
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
@@ -1078,7 +1303,20 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
     // This is valid because, when minimizing probabilities, states that have prob1 cannot reach a state with prob 0 (and will eventually reach a psiState).
     // States that do not have prob1 will eventually reach a state with prob0.
-    result.second = performProb0A(backwardTransitions, ~psiStates, result.first);
+    result.second = ~performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, ~psiStates, result.first, false, 0);
+    return result;
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparsePattern const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    // See the overload above for why searching backwards from the Prob0E states yields the Prob1A states.
+    result.second = ~performBackwardBreadthFirstSearch(&transitionMatrix, &backwardTransitions, ~psiStates, result.first, false, 0);
     return result;
 }
 
@@ -1086,7 +1324,7 @@ template<typename T, typename RM>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::models::sparse::NondeterministicModel<T, RM> const& model,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates) {
-    return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates,
+    return performProb01Min(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitionPattern(), phiStates,
                             psiStates);
 }
 
@@ -1905,6 +2143,9 @@ template storm::storage::BitVector getReachableStates(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                       boost::optional<storm::storage::BitVector> const& choiceFilter);
 
+template storm::storage::BitVector getRelevantMaybeStates(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                          storm::storage::BitVector const& relevantStates, storm::storage::BitVector const& maybeStates);
+
 template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<double> const& transitionMatrix);
 
 template bool hasCycle(storm::storage::SparseMatrix<double> const& transitionMatrix, boost::optional<storm::storage::BitVector> const& subsystem);
@@ -1920,6 +2161,11 @@ template storm::storage::BitVector performProbGreater0(storm::storage::SparseMat
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                 storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
 
@@ -1934,6 +2180,11 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                        storm::storage::BitVector const& phiStates,
                                                                                        storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                       storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                       storm::storage::BitVector const& phiStates,
+                                                                                       storm::storage::BitVector const& psiStates);
+
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                             storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                             storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler,
@@ -2048,6 +2299,9 @@ template storm::storage::BitVector getReachableStates(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                       boost::optional<storm::storage::BitVector> const& choiceFilter);
 
+template storm::storage::BitVector getRelevantMaybeStates(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                          storm::storage::BitVector const& relevantStates, storm::storage::BitVector const& maybeStates);
+
 template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix);
 
 template bool hasCycle(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
@@ -2064,6 +2318,11 @@ template storm::storage::BitVector performProbGreater0(storm::storage::SparseMat
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                 storm::storage::BitVector const& statesWithProbabilityGreater0);
@@ -2079,6 +2338,10 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -2178,6 +2441,9 @@ template storm::storage::BitVector getReachableStates(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps,
                                                       boost::optional<storm::storage::BitVector> const& choiceFilter);
 
+template storm::storage::BitVector getRelevantMaybeStates(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                          storm::storage::BitVector const& relevantStates, storm::storage::BitVector const& maybeStates);
+
 template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix);
 
 template bool hasCycle(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
@@ -2194,6 +2460,11 @@ template storm::storage::BitVector performProbGreater0(storm::storage::SparseMat
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                 storm::storage::BitVector const& statesWithProbabilityGreater0);
@@ -2209,6 +2480,11 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates);
 
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates,
                                      storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                      storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -2278,6 +2554,107 @@ template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMat
                                                        std::vector<uint64_t> const& firstStates);
 #endif
 
+// Instantiations of the variants that take the pattern of the backward transitions.
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                       storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                       storm::storage::SparsePattern const& backwardTransitions,
+                                                                                       storm::storage::BitVector const& phiStates,
+                                                                                       storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparsePattern const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                        storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparsePattern const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+
+#ifdef STORM_HAVE_CARL
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                       storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                        storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                       storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                        storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+    storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+#endif
+
 // Instantiations for CUDD.
 
 template storm::dd::Bdd<storm::dd::DdType::CUDD> performProbGreater0(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model,
@@ -2286,6 +2663,10 @@ template storm::dd::Bdd<storm::dd::DdType::CUDD> performProbGreater0(storm::mode
                                                                      storm::dd::Bdd<storm::dd::DdType::CUDD> const& psiStates,
                                                                      boost::optional<uint_fast64_t> const& stepBound = boost::optional<uint_fast64_t>());
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> getTopologicallyOrderedSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix,
+    storm::dd::Bdd<storm::dd::DdType::CUDD> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::CUDD> performProb1(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model,
                                                               storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitionMatrix,
                                                               storm::dd::Bdd<storm::dd::DdType::CUDD> const& phiStates,
@@ -2385,6 +2766,10 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0(storm::mo
                                                                        storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates,
                                                                        boost::optional<uint_fast64_t> const& stepBound = boost::optional<uint_fast64_t>());
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> getTopologicallyOrderedSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProb1(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double> const& model,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
@@ -2482,6 +2867,10 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0(
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates, boost::optional<uint_fast64_t> const& stepBound = boost::optional<uint_fast64_t>());
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> getTopologicallyOrderedSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProb1(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalNumber> const& model,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
@@ -2580,6 +2969,10 @@ template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProbGreater0(
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
     storm::dd::Bdd<storm::dd::DdType::Sylvan> const& psiStates, boost::optional<uint_fast64_t> const& stepBound = boost::optional<uint_fast64_t>());
 
+template std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> getTopologicallyOrderedSccBlocks(
+    storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model,
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& states, uint64_t minimalBlockSize);
+
 template storm::dd::Bdd<storm::dd::DdType::Sylvan> performProb1(storm::models::symbolic::Model<storm::dd::DdType::Sylvan, storm::RationalFunction> const& model,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitionMatrix,
                                                                 storm::dd::Bdd<storm::dd::DdType::Sylvan> const& phiStates,
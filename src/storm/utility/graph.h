@@ -22,6 +22,7 @@ namespace storage {
 class BitVector;
 template<typename VT>
 class SparseMatrix;
+class SparsePattern;
 }  // namespace storage
 
 namespace models {
@@ -78,6 +79,19 @@ storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> con
                                              bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                              boost::optional<storm::storage::BitVector> const& choiceFilter = boost::none);
 
+/*!
+ * Restricts the given maybe states to the ones that are reachable from the given relevant states without leaving the maybe states. The values of
+ * the relevant maybe states only depend on the values of the states in the returned set (and the values of the non-maybe states).
+ *
+ * @param transitionMatrix The transition relation of the graph structure to search.
+ * @param relevantStates The states whose values are relevant.
+ * @param maybeStates The maybe states.
+ * @return The maybe states that are reachable from a relevant maybe state within the maybe states.
+ */
+template<typename T>
+storm::storage::BitVector getRelevantMaybeStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& relevantStates,
+                                                 storm::storage::BitVector const& maybeStates);
+
 /*!
  * Retrieves a set of states that covers als BSCCs of the system in the sense that for every BSCC exactly
  * one state is included in the cover.
@@ -123,7 +137,7 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
                                         boost::optional<storm::storage::BitVector> const& subsystem = boost::none);
 
 /*!
- * Performs a backward depth-first search trough the underlying graph structure
+ * Performs a backward breadth-first search trough the underlying graph structure
  * of the given model to determine which states of the model have a positive probability
  * of satisfying phi until psi. The resulting states are written to the given bit vector.
  *
@@ -138,6 +152,36 @@ template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
 
+/*!
+ * Determines the states that have a positive probability of satisfying phi until psi like the overload that only takes
+ * the backward transitions. As the transition matrix is also given, steps of the breadth-first search in which many
+ * states are found are performed bottom-up, i.e. by checking the successors of the states that were not yet found.
+ *
+ * @param transitionMatrix The transition relation of the graph structure to search.
+ * @param backwardTransitions The reversed transition relation of the graph structure to search.
+ * @param phiStates A bit vector of all states satisfying phi.
+ * @param psiStates A bit vector of all states satisfying psi.
+ * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
+ * @param maximalSteps The maximal number of steps to reach the psi states.
+ * @return A bit vector with all indices of states that have a probability greater than 0.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false,
+                                              uint_fast64_t maximalSteps = 0);
+
+/*!
+ * Variants of performProbGreater0 in which the backward transitions are only given by their pattern (see
+ * storm::storage::SparsePattern), which speeds up the search as only a fraction of the memory is traversed.
+ */
+storm::storage::BitVector performProbGreater0(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+template<typename T>
+storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparsePattern const& backwardTransitions,
+                                              storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false,
+                                              uint_fast64_t maximalSteps = 0);
+
 /*!
  * Computes the set of states of the given model for which all paths lead to
  * the given set of target states and only visit states from the filter set
@@ -172,6 +216,14 @@ template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                        storm::storage::BitVector const& psiStates);
 
+/*!
+ * Variants of performProb1 in which the backward transitions are only given by their pattern.
+ */
+storm::storage::BitVector performProb1(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+storm::storage::BitVector performProb1(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
  * deterministic model.
@@ -202,6 +254,36 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
                                                                               storm::storage::BitVector const& phiStates,
                                                                               storm::storage::BitVector const& psiStates);
 
+/*!
+ * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
+ * deterministic model. In contrast to the overload that only takes the backward transitions, the searches can
+ * perform bottom-up steps on the transition matrix.
+ *
+ * @param transitionMatrix The transition matrix of the model whose graph structure to search.
+ * @param backwardTransitions The backward transitions of the model whose graph structure to search.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @return A pair of bit vectors such that the first bit vector stores the indices of all states
+ * with probability 0 and the second stores all indices of states with probability 1.
+ */
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
+/*!
+ * Variants of performProb01 in which the backward transitions are only given by their pattern.
+ */
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparsePattern const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparsePattern const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the set of states that has a positive probability of reaching psi states after only passing
  * through phi states before.
@@ -217,6 +299,24 @@ template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix,
                                          storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates,
                                          boost::optional<uint_fast64_t> const& stepBound = boost::optional<uint_fast64_t>());
+
+/*!
+ * Decomposes the given states into blocks that are unions of strongly connected components (SCCs) of the given transition relation. The blocks are
+ * ordered topologically (bottom SCCs first), i.e., all transitions leaving a block lead to a block with a smaller index or to a state outside the given
+ * states. Consecutive SCCs are put into the same block until it contains at least the given number of states.
+ * States without successors among the remaining states are split off in layers and the other SCCs are obtained by forward-backward searches.
+ *
+ * @param model The (symbolic) model whose states are decomposed.
+ * @param transitionMatrix The transition relation as a BDD.
+ * @param states The states to decompose.
+ * @param minimalBlockSize The minimal number of states of a block (except for the last one).
+ * @return The blocks in topological order.
+ */
+template<storm::dd::DdType Type, typename ValueType>
+std::vector<storm::dd::Bdd<Type>> getTopologicallyOrderedSccBlocks(storm::models::symbolic::Model<Type, ValueType> const& model,
+                                                                   storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& states,
+                                                                   uint64_t minimalBlockSize);
+
 /*!
  * Computes the set of states that have a probability of one of reaching psi states after only passing
  * through phi states before.
@@ -380,6 +480,14 @@ template<typename T>
 storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+/*!
+ * Variants of performProbGreater0E and performProb0A in which the backward transitions are only given by their pattern.
+ */
+storm::storage::BitVector performProbGreater0E(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+storm::storage::BitVector performProb0A(storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -400,6 +508,16 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::BitVector const& psiStates,
                                         boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+/*!
+ * Variant of performProb1E in which the backward transitions are only given by their pattern.
+ */
+template<typename T>
+storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates,
+                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -423,6 +541,12 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparsePattern const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -461,6 +585,16 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
                                                boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
 
+/*!
+ * Variant of performProbGreater0A in which the backward transitions are only given by their pattern.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
 /*!
  * Computes the sets of states that have probability 0 of satisfying phi until psi under at least
  * one possible resolution of non-determinism in a non-deterministic model. Stated differently,
@@ -482,6 +616,11 @@ storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
+template<typename T>
+storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
 
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under all
@@ -505,6 +644,11 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
+template<typename T>
+storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparsePattern const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
 
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
@@ -512,6 +656,12 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparsePattern const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -0,0 +1,236 @@
+#include "storm/utility/memory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#ifdef LINUX
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+namespace storm {
+namespace utility {
+namespace memory {
+
+namespace {
+
+std::atomic<HugePagePolicy> hugePagePolicy(HugePagePolicy::None);
+std::atomic<NumaPolicy> numaPolicy(NumaPolicy::Default);
+std::atomic<uint64_t> allocatedBytes(0);
+std::atomic<uint64_t> memoryLimit(0);
+
+uint64_t const hugePageSize = 2 * 1024 * 1024;
+
+// The policies are only applied to areas of at least this size. Smaller areas can not benefit from huge pages anyway.
+uint64_t const largeAreaSize = hugePageSize;
+
+// Every allocation is preceded by a header (padded to the alignment) that records how the memory was obtained.
+struct AllocationHeader {
+    // The number of bytes that were mapped (including the header) or zero if the memory was obtained via aligned_alloc.
+    uint64_t mappedBytes;
+    // The number of bytes that were allocated (including the header).
+    uint64_t totalBytes;
+};
+static_assert(sizeof(AllocationHeader) <= alignment, "The allocation header does not fit into the alignment.");
+
+uint64_t roundUp(uint64_t value, uint64_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+bool hasDefaultPolicies() {
+    return hugePagePolicy.load() == HugePagePolicy::None && numaPolicy.load() == NumaPolicy::Default;
+}
+
+#ifdef LINUX
+void interleave(void* data, uint64_t bytes, bool movePages) {
+    // Retrieve the nodes on which this process may allocate memory.
+    unsigned long nodeMask[16] = {};
+    uint64_t const maxNode = sizeof(nodeMask) * 8;
+    if (syscall(SYS_get_mempolicy, nullptr, nodeMask, maxNode, nullptr, MPOL_F_MEMS_ALLOWED) != 0) {
+        STORM_LOG_DEBUG("Unable to retrieve the NUMA nodes of the process.");
+        return;
+    }
+    // The kernel expects the number of bits plus one.
+    if (syscall(SYS_mbind, data, bytes, MPOL_INTERLEAVE, nodeMask, maxNode + 1, movePages ? MPOL_MF_MOVE : 0) != 0) {
+        STORM_LOG_DEBUG("Unable to interleave memory area of " << bytes << " bytes over the NUMA nodes.");
+    }
+}
+
+void touchInParallel(char* data, uint64_t bytes) {
+    uint64_t const pageSize = sysconf(_SC_PAGESIZE);
+    // Every chunk covers a huge page, which is placed as a whole.
+    storm::utility::parallel::forEachChunk(0, bytes / pageSize, hugePageSize / pageSize, storm::utility::parallel::getDefaultNumberOfThreads(),
+                                           [&](uint64_t, uint64_t chunkBegin, uint64_t chunkEnd) {
+                                               for (uint64_t page = chunkBegin; page < chunkEnd; ++page) {
+                                                   data[page * pageSize] = 0;
+                                               }
+                                           });
+}
+
+// Maps an area of the given size (a multiple of the huge page size) according to the policies. Returns nullptr on failure.
+char* mapLargeArea(uint64_t bytes) {
+    void* area = MAP_FAILED;
+    if (hugePagePolicy.load() == HugePagePolicy::Explicit) {
+        area = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        static std::atomic<bool> warned(false);
+        if (area == MAP_FAILED && !warned.exchange(true)) {
+            STORM_LOG_WARN("Unable to allocate explicit huge pages. Falling back to transparent huge pages.");
+        }
+    }
+    if (area == MAP_FAILED) {
+        // Map an area that is aligned to the huge page size, so it can be backed by transparent huge pages entirely.
+        uint64_t mappedBytes = bytes + hugePageSize;
+        char* mappedArea = static_cast<char*>(mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (mappedArea == MAP_FAILED) {
+            return nullptr;
+        }
+        char* alignedArea = reinterpret_cast<char*>(roundUp(reinterpret_cast<uint64_t>(mappedArea), hugePageSize));
+        if (alignedArea != mappedArea) {
+            munmap(mappedArea, alignedArea - mappedArea);
+        }
+        if (alignedArea + bytes != mappedArea + mappedBytes) {
+            munmap(alignedArea + bytes, (mappedArea + mappedBytes) - (alignedArea + bytes));
+        }
+        area = alignedArea;
+        if (hugePagePolicy.load() != HugePagePolicy::None) {
+            madvise(area, bytes, MADV_HUGEPAGE);
+        }
+    }
+
+    if (numaPolicy.load() == NumaPolicy::Interleave) {
+        interleave(area, bytes, false);
+    } else if (numaPolicy.load() == NumaPolicy::FirstTouch) {
+        touchInParallel(static_cast<char*>(area), bytes);
+    }
+    return static_cast<char*>(area);
+}
+#endif
+
+}  // namespace
+
+void setHugePagePolicy(HugePagePolicy policy) {
+    hugePagePolicy = policy;
+}
+
+HugePagePolicy getHugePagePolicy() {
+    return hugePagePolicy.load();
+}
+
+void setNumaPolicy(NumaPolicy policy) {
+    numaPolicy = policy;
+}
+
+NumaPolicy getNumaPolicy() {
+    return numaPolicy.load();
+}
+
+void* allocate(uint64_t bytes) {
+    uint64_t totalBytes = roundUp(bytes + alignment, alignment);
+    char* area = nullptr;
+#ifdef LINUX
+    if (totalBytes >= largeAreaSize && !hasDefaultPolicies()) {
+        totalBytes = roundUp(totalBytes, hugePageSize);
+        area = mapLargeArea(totalBytes);
+        if (area) {
+            reinterpret_cast<AllocationHeader*>(area)->mappedBytes = totalBytes;
+            reinterpret_cast<AllocationHeader*>(area)->totalBytes = totalBytes;
+            allocatedBytes += totalBytes;
+            return area + alignment;
+        }
+    }
+#endif
+    area = static_cast<char*>(std::aligned_alloc(alignment, totalBytes));
+    if (!area) {
+        throw std::bad_alloc();
+    }
+    reinterpret_cast<AllocationHeader*>(area)->mappedBytes = 0;
+    reinterpret_cast<AllocationHeader*>(area)->totalBytes = totalBytes;
+    allocatedBytes += totalBytes;
+    return area + alignment;
+}
+
+void deallocate(void* pointer) {
+    if (!pointer) {
+        return;
+    }
+    char* area = static_cast<char*>(pointer) - alignment;
+    uint64_t mappedBytes = reinterpret_cast<AllocationHeader*>(area)->mappedBytes;
+    allocatedBytes -= reinterpret_cast<AllocationHeader*>(area)->totalBytes;
+    if (mappedBytes == 0) {
+        std::free(area);
+    } else {
+#ifdef LINUX
+        munmap(area, mappedBytes);
+#endif
+    }
+}
+
+void adviseMemory(void const* data, uint64_t bytes) {
+#ifdef LINUX
+    if (bytes < largeAreaSize || hasDefaultPolicies()) {
+        return;
+    }
+    // The advice can only be given for whole pages.
+    uint64_t const pageSize = sysconf(_SC_PAGESIZE);
+    uint64_t begin = roundUp(reinterpret_cast<uint64_t>(data), pageSize);
+    uint64_t end = (reinterpret_cast<uint64_t>(data) + bytes) / pageSize * pageSize;
+    if (begin >= end) {
+        return;
+    }
+    void* area = reinterpret_cast<void*>(begin);
+    if (hugePagePolicy.load() != HugePagePolicy::None) {
+        madvise(area, end - begin, MADV_HUGEPAGE);
+    }
+    if (numaPolicy.load() == NumaPolicy::Interleave) {
+        // The pages may already be in use, so they need to be moved.
+        interleave(area, end - begin, true);
+    }
+#else
+    (void)data;
+    (void)bytes;
+#endif
+}
+
+uint64_t getAllocatedBytes() {
+    return allocatedBytes.load();
+}
+
+uint64_t getResidentBytes() {
+#ifdef LINUX
+    // The second entry of statm is the number of resident pages.
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0, residentPages = 0;
+    if (statm >> size >> residentPages) {
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+uint64_t getUsedBytes() {
+    return std::max(getResidentBytes(), getAllocatedBytes());
+}
+
+void setMemoryLimit(uint64_t bytes) {
+    memoryLimit = bytes;
+}
+
+uint64_t getMemoryLimit() {
+    return memoryLimit.load();
+}
+
+bool isWithinMemoryLimit(uint64_t additionalBytes) {
+    uint64_t limit = memoryLimit.load();
+    return limit == 0 || getUsedBytes() + additionalBytes <= limit;
+}
+
+}  // namespace memory
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace memory {
+
+/*!
+ * Determines whether large memory areas are backed by huge pages.
+ */
+enum class HugePagePolicy {
+    // Use the pages provided by the system.
+    None,
+    // Request transparent huge pages for large memory areas.
+    Transparent,
+    // Allocate large memory areas from the pool of explicitly reserved huge pages (falling back to transparent huge
+    // pages if the pool is exhausted).
+    Explicit
+};
+
+/*!
+ * Determines how the pages of large memory areas are placed on the NUMA nodes.
+ */
+enum class NumaPolicy {
+    // Use the placement policy of the system.
+    Default,
+    // Distribute the pages round-robin over all NUMA nodes.
+    Interleave,
+    // Touch the pages of newly allocated areas with the threads used for parallelized operations, so that each page is
+    // placed on the node of the thread that touched it first.
+    FirstTouch
+};
+
+/*!
+ * The alignment (in bytes) of the memory provided by allocate. This is the size of a cache line (and of an AVX-512
+ * register).
+ */
+uint64_t const alignment = 64;
+
+void setHugePagePolicy(HugePagePolicy policy);
+HugePagePolicy getHugePagePolicy();
+
+void setNumaPolicy(NumaPolicy policy);
+NumaPolicy getNumaPolicy();
+
+/*!
+ * Allocates the given number of bytes aligned to the alignment. Large areas are placed according to the huge page
+ * and NUMA policies.
+ *
+ * @param bytes The number of bytes to allocate.
+ * @return A pointer to the allocated memory that has to be released with deallocate.
+ */
+void* allocate(uint64_t bytes);
+
+/*!
+ * Releases memory obtained by allocate.
+ */
+void deallocate(void* pointer);
+
+/*!
+ * Applies the huge page and NUMA policies to the (whole) pages in the given (already allocated) area if the area is
+ * large. As the memory was not obtained via allocate, explicit huge pages are replaced by transparent huge pages and
+ * first-touch placement is not possible. If the policies are the default ones, this does nothing.
+ *
+ * @param data The beginning of the area.
+ * @param bytes The size of the area.
+ */
+void adviseMemory(void const* data, uint64_t bytes);
+
+/*!
+ * Applies the huge page and NUMA policies to the contents of the given vector (see above).
+ */
+template<typename T, typename Allocator>
+void adviseMemory(std::vector<T, Allocator> const& vector) {
+    adviseMemory(vector.data(), vector.size() * sizeof(T));
+}
+
+/*!
+ * Retrieves the number of bytes that are currently allocated via allocate (including the headers).
+ */
+uint64_t getAllocatedBytes();
+
+/*!
+ * Retrieves the number of bytes of the process that currently reside in memory or zero if this can not be determined on
+ * this system.
+ */
+uint64_t getResidentBytes();
+
+/*!
+ * Retrieves the number of bytes currently used by the process. As memory obtained via allocate may not reside in memory
+ * yet, this is the maximum of the resident bytes and the bytes allocated via allocate.
+ */
+uint64_t getUsedBytes();
+
+/*!
+ * Sets the number of bytes the process may use. Zero means that there is no limit.
+ */
+void setMemoryLimit(uint64_t bytes);
+
+/*!
+ * Retrieves the number of bytes the process may use (zero if there is no limit).
+ */
+uint64_t getMemoryLimit();
+
+/*!
+ * Checks whether the memory used by the process stays within the memory limit if the given number of bytes is
+ * allocated in addition. This always holds if there is no limit.
+ *
+ * @param additionalBytes The number of bytes that are (projected to be) allocated in addition.
+ */
+bool isWithinMemoryLimit(uint64_t additionalBytes = 0);
+
+/*!
+ * An allocator that obtains its memory from allocate. Containers using this allocator are therefore aligned for SIMD
+ * operations and follow the huge page and NUMA policies.
+ */
+template<typename T>
+class AlignedAllocator {
+   public:
+    typedef T value_type;
+
+    AlignedAllocator() = default;
+
+    template<typename U>
+    AlignedAllocator(AlignedAllocator<U> const&) {
+        // Intentionally left empty.
+    }
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(storm::utility::memory::allocate(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t) {
+        storm::utility::memory::deallocate(pointer);
+    }
+
+    template<typename U>
+    bool operator==(AlignedAllocator<U> const&) const {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(AlignedAllocator<U> const&) const {
+        return false;
+    }
+};
+
+template<typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+}  // namespace memory
+}  // namespace utility
+}  // namespace storm
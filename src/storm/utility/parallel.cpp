@@ -0,0 +1,286 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/SignalHandler.h"
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+namespace {
+
+/*!
+ * A pool of worker threads that is kept alive between calls to forEachChunk, so that fine-grained parallel
+ * operations (like one matrix-vector multiplication per iteration of value iteration) do not pay for spawning and
+ * joining threads every time. At most one job runs on the pool at a time.
+ */
+class ThreadPool {
+   public:
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        jobAvailable.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /*!
+     * Tries to execute the given job on the calling thread (with index zero) and the given number of pool threads
+     * (with indices 1, ..., numberOfHelpers). Returns false (without executing anything) if the pool is already
+     * busy, e.g. because forEachChunk was called from within the body of another forEachChunk.
+     */
+    bool tryRun(uint64_t numberOfHelpers, std::function<void(uint64_t threadIndex)> const& job) {
+        std::unique_lock<std::mutex> runLock(runMutex, std::try_to_lock);
+        if (!runLock.owns_lock()) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (workers.size() < numberOfHelpers) {
+                uint64_t workerIndex = workers.size();
+                workers.emplace_back([this, workerIndex] { work(workerIndex); });
+            }
+            currentJob = &job;
+            participants = numberOfHelpers;
+            finishedParticipants = 0;
+            ++generation;
+        }
+        jobAvailable.notify_all();
+
+        job(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        jobFinished.wait(lock, [this] { return finishedParticipants == participants; });
+        currentJob = nullptr;
+        return true;
+    }
+
+   private:
+    void work(uint64_t workerIndex) {
+        uint64_t seenGeneration = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            jobAvailable.wait(lock, [&] { return stop || (generation != seenGeneration && workerIndex < participants); });
+            if (stop) {
+                return;
+            }
+            seenGeneration = generation;
+            std::function<void(uint64_t)> const* job = currentJob;
+            lock.unlock();
+            (*job)(workerIndex + 1);
+            lock.lock();
+            if (++finishedParticipants == participants) {
+                jobFinished.notify_one();
+            }
+        }
+    }
+
+    // Serializes the jobs that are executed on this pool.
+    std::mutex runMutex;
+
+    // Protects the members below.
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobFinished;
+    std::vector<std::thread> workers;
+    std::function<void(uint64_t)> const* currentJob = nullptr;
+    uint64_t participants = 0;
+    uint64_t finishedParticipants = 0;
+    uint64_t generation = 0;
+    bool stop = false;
+};
+
+ThreadPool& getThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+std::atomic<uint64_t> defaultNumberOfThreads(1);
+
+}  // namespace
+
+uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads) {
+    if (requestedNumberOfThreads == 0) {
+        return std::max<uint64_t>(1ull, std::thread::hardware_concurrency());
+    }
+    return requestedNumberOfThreads;
+}
+
+uint64_t getDefaultNumberOfThreads() {
+    return defaultNumberOfThreads.load();
+}
+
+void setDefaultNumberOfThreads(uint64_t numberOfThreads) {
+    defaultNumberOfThreads.store(getNumberOfThreads(numberOfThreads));
+}
+
+void forEachChunk(uint64_t begin, uint64_t end, uint64_t chunkSize, uint64_t numberOfThreads,
+                  std::function<void(uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd)> const& body) {
+    if (begin >= end) {
+        return;
+    }
+    chunkSize = std::max<uint64_t>(chunkSize, 1ull);
+    uint64_t numberOfChunks = (end - begin + chunkSize - 1) / chunkSize;
+    numberOfThreads = std::min(std::max<uint64_t>(numberOfThreads, 1ull), numberOfChunks);
+
+    if (numberOfThreads == 1) {
+        for (uint64_t chunkBegin = begin; chunkBegin < end; chunkBegin += chunkSize) {
+            body(0, chunkBegin, std::min(chunkBegin + chunkSize, end));
+        }
+        return;
+    }
+
+    std::atomic<uint64_t> nextChunk(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    // The termination flag is thread-local, so the helper threads adopt the one of the calling thread. Otherwise, they would not notice
+    // that the computation of the calling thread (e.g. a single query of a server) is aborted.
+    std::atomic<bool> const* terminationFlag = storm::utility::resources::threadTerminationFlag;
+    std::function<void(uint64_t)> worker = [&](uint64_t threadIndex) {
+        if (threadIndex != 0) {
+            storm::utility::resources::setThreadTerminationFlag(terminationFlag);
+        }
+        try {
+            for (uint64_t chunk = nextChunk.fetch_add(1); chunk < numberOfChunks && !failed.load(); chunk = nextChunk.fetch_add(1)) {
+                uint64_t chunkBegin = begin + chunk * chunkSize;
+                body(threadIndex, chunkBegin, std::min(chunkBegin + chunkSize, end));
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!firstException) {
+                firstException = std::current_exception();
+            }
+            failed.store(true);
+        }
+        if (threadIndex != 0) {
+            // Pool threads outlive this call and must not keep the flag.
+            storm::utility::resources::setThreadTerminationFlag(nullptr);
+        }
+    };
+
+    // If the pool is busy, we fall back to dedicated threads.
+    if (!getThreadPool().tryRun(numberOfThreads - 1, worker)) {
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfThreads - 1);
+        for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+            threads.emplace_back(worker, threadIndex);
+        }
+        worker(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+void forEachTaskInDependencyOrder(std::vector<std::vector<uint64_t>> const& dependencies, uint64_t numberOfThreads,
+                                  std::function<void(uint64_t threadIndex, uint64_t task)> const& body) {
+    uint64_t const numberOfTasks = dependencies.size();
+    if (numberOfTasks == 0) {
+        return;
+    }
+    numberOfThreads = std::min(std::max<uint64_t>(numberOfThreads, 1ull), numberOfTasks);
+
+    // Invert the dependencies and count the unfinished dependencies of each task.
+    std::vector<std::vector<uint64_t>> dependents(numberOfTasks);
+    std::vector<std::atomic<uint64_t>> remainingDependencies(numberOfTasks);
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        remainingDependencies[task].store(dependencies[task].size(), std::memory_order_relaxed);
+        for (auto const& dependency : dependencies[task]) {
+            dependents[dependency].push_back(task);
+        }
+    }
+
+    // One queue of ready tasks per thread. Initially ready tasks are distributed round-robin.
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<uint64_t> tasks;
+    };
+    std::vector<TaskQueue> queues(numberOfThreads);
+    uint64_t nextQueue = 0;
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        if (dependencies[task].empty()) {
+            queues[nextQueue].tasks.push_back(task);
+            nextQueue = (nextQueue + 1) % numberOfThreads;
+        }
+    }
+
+    std::atomic<uint64_t> finishedTasks(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto popOwnTask = [&](uint64_t threadIndex, uint64_t& task) {
+        std::lock_guard<std::mutex> lock(queues[threadIndex].mutex);
+        if (queues[threadIndex].tasks.empty()) {
+            return false;
+        }
+        task = queues[threadIndex].tasks.back();
+        queues[threadIndex].tasks.pop_back();
+        return true;
+    };
+    auto stealTask = [&](uint64_t threadIndex, uint64_t& task) {
+        for (uint64_t offset = 1; offset < numberOfThreads; ++offset) {
+            TaskQueue& victim = queues[(threadIndex + offset) % numberOfThreads];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    };
+
+    forEachChunk(0, numberOfThreads, 1, numberOfThreads, [&](uint64_t, uint64_t threadIndex, uint64_t) {
+        try {
+            while (finishedTasks.load() < numberOfTasks && !failed.load()) {
+                uint64_t task;
+                if (!popOwnTask(threadIndex, task) && !stealTask(threadIndex, task)) {
+                    // All ready tasks are being processed, so we wait until some of them finish.
+                    std::this_thread::yield();
+                    continue;
+                }
+                body(threadIndex, task);
+                for (auto const& dependent : dependents[task]) {
+                    if (remainingDependencies[dependent].fetch_sub(1) == 1) {
+                        std::lock_guard<std::mutex> lock(queues[threadIndex].mutex);
+                        queues[threadIndex].tasks.push_back(dependent);
+                    }
+                }
+                finishedTasks.fetch_add(1);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!firstException) {
+                firstException = std::current_exception();
+            }
+            failed.store(true);
+        }
+    });
+
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Retrieves the number of threads to use given the requested number of threads.
+ *
+ * @param requestedNumberOfThreads The requested number of threads where 0 means 'auto-detect'.
+ * @return The number of threads (at least one).
+ */
+uint64_t getNumberOfThreads(uint64_t requestedNumberOfThreads);
+
+/*!
+ * Retrieves the number of threads that parallelized operations (for example SparseMatrix::multiplyWithVectorParallel)
+ * use if no number is given explicitly. Unless set otherwise, this is one.
+ */
+uint64_t getDefaultNumberOfThreads();
+
+/*!
+ * Sets the number of threads that parallelized operations use if no number is given explicitly.
+ *
+ * @param numberOfThreads The number of threads where 0 means 'auto-detect'.
+ */
+void setDefaultNumberOfThreads(uint64_t numberOfThreads);
+
+/*!
+ * Splits the range [begin, end) into chunks of (at most) the given size and distributes them dynamically over
+ * the given number of threads. The calling thread participates as the thread with index zero. If only one thread
+ * is requested or the range consists of a single chunk, everything is executed in the calling thread.
+ * The other threads are taken from a pool that persists between calls, so this is also suited for operations that
+ * are repeated many times (such as matrix-vector multiplications). Nested calls use dedicated threads instead.
+ * Exceptions thrown by the body are rethrown in the calling thread once all threads have finished. The other threads
+ * use the termination flag of the calling thread (see storm::utility::resources::setThreadTerminationFlag).
+ *
+ * @param begin The first index of the range.
+ * @param end The index past the last index of the range.
+ * @param chunkSize The (maximal) number of indices per chunk.
+ * @param numberOfThreads The number of threads to use.
+ * @param body The function that is called as body(threadIndex, chunkBegin, chunkEnd) for every chunk.
+ */
+void forEachChunk(uint64_t begin, uint64_t end, uint64_t chunkSize, uint64_t numberOfThreads,
+                  std::function<void(uint64_t threadIndex, uint64_t chunkBegin, uint64_t chunkEnd)> const& body);
+
+/*!
+ * Executes the given tasks on the given number of threads such that a task is only started once all the tasks it
+ * depends on have finished. Tasks that become ready are put into the queue of the thread that finished their last
+ * dependency. Threads process their own queue in LIFO order (which favours locality along dependency chains) and
+ * steal from the queues of other threads once their own queue runs empty. The calling thread participates as the
+ * thread with index zero. Exceptions thrown by the body are rethrown in the calling thread once all threads have
+ * stopped; tasks that were not started by then are skipped.
+ *
+ * @param dependencies For each task, the tasks that need to be finished before it can be started. The dependencies
+ * must be acyclic.
+ * @param numberOfThreads The number of threads to use.
+ * @param body The function that is called as body(threadIndex, task) for every task. No two concurrent calls share
+ * the same thread index.
+ */
+void forEachTaskInDependencyOrder(std::vector<std::vector<uint64_t>> const& dependencies, uint64_t numberOfThreads,
+                                  std::function<void(uint64_t threadIndex, uint64_t task)> const& body);
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
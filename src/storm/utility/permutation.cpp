@@ -0,0 +1,182 @@
+#include "storm/utility/permutation.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace utility {
+namespace permutation {
+
+std::ostream& operator<<(std::ostream& out, OrderKind const& order) {
+    switch (order) {
+        case OrderKind::Bfs:
+            out << "bfs";
+            break;
+        case OrderKind::ReverseCuthillMcKee:
+            out << "rcm";
+            break;
+        case OrderKind::SccTopological:
+            out << "scc";
+            break;
+    }
+    return out;
+}
+
+namespace {
+template<typename ValueType>
+std::vector<uint64_t> createBfsOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector discoveredStates(numberOfStates, false);
+    auto search = [&](uint64_t firstResultIndex) {
+        // The result itself serves as the queue of the search.
+        for (uint64_t index = firstResultIndex; index < result.size(); ++index) {
+            for (auto const& entry : transitionMatrix.getRowGroup(result[index])) {
+                if (!discoveredStates.get(entry.getColumn())) {
+                    discoveredStates.set(entry.getColumn());
+                    result.push_back(entry.getColumn());
+                }
+            }
+        }
+    };
+
+    for (auto state : initialStates) {
+        discoveredStates.set(state);
+        result.push_back(state);
+    }
+    search(0);
+    // Continue with the states that are unreachable from the initial states.
+    for (uint64_t state = discoveredStates.getNextUnsetIndex(0); state < numberOfStates; state = discoveredStates.getNextUnsetIndex(state + 1)) {
+        uint64_t firstResultIndex = result.size();
+        discoveredStates.set(state);
+        result.push_back(state);
+        search(firstResultIndex);
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+    // The neighbours of a state are its successors and predecessors. For the degrees, states that are both are counted twice.
+    std::vector<uint64_t> degrees(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        degrees[state] = transitionMatrix.getRowGroupEntryCount(state) + backwardTransitions.getRow(state).getNumberOfEntries();
+    }
+    auto hasSmallerDegree = [&degrees](uint64_t first, uint64_t second) { return degrees[first] < degrees[second]; };
+
+    // Every connected component is searched starting from one of its states with minimal degree.
+    std::vector<uint64_t> statesByDegree(numberOfStates);
+    std::iota(statesByDegree.begin(), statesByDegree.end(), 0);
+    std::stable_sort(statesByDegree.begin(), statesByDegree.end(), hasSmallerDegree);
+
+    std::vector<uint64_t> result;
+    result.reserve(numberOfStates);
+    storm::storage::BitVector discoveredStates(numberOfStates, false);
+    std::vector<uint64_t> newNeighbours;
+    auto discover = [&](uint64_t state) {
+        if (!discoveredStates.get(state)) {
+            discoveredStates.set(state);
+            newNeighbours.push_back(state);
+        }
+    };
+    for (auto startState : statesByDegree) {
+        if (discoveredStates.get(startState)) {
+            continue;
+        }
+        discoveredStates.set(startState);
+        result.push_back(startState);
+        for (uint64_t index = result.size() - 1; index < result.size(); ++index) {
+            newNeighbours.clear();
+            for (auto const& entry : transitionMatrix.getRowGroup(result[index])) {
+                discover(entry.getColumn());
+            }
+            for (auto const& entry : backwardTransitions.getRow(result[index])) {
+                discover(entry.getColumn());
+            }
+            std::stable_sort(newNeighbours.begin(), newNeighbours.end(), hasSmallerDegree);
+            result.insert(result.end(), newNeighbours.begin(), newNeighbours.end());
+        }
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> createSccTopologicalOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    // The SCCs of the decomposition are sorted such that every SCC comes after the SCCs it can reach.
+    storm::storage::StronglyConnectedComponentDecomposition<ValueType> decomposition(
+        transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort());
+    std::vector<uint64_t> result;
+    result.reserve(transitionMatrix.getRowGroupCount());
+    for (auto const& scc : decomposition) {
+        result.insert(result.end(), scc.begin(), scc.end());
+    }
+    return result;
+}
+}  // namespace
+
+template<typename ValueType>
+std::vector<uint64_t> createStateOrder(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                       storm::storage::BitVector const& initialStates) {
+    STORM_LOG_THROW(transitionMatrix.getRowGroupCount() == transitionMatrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Expected a transition matrix with one row group per state.");
+    std::vector<uint64_t> result;
+    switch (order) {
+        case OrderKind::Bfs:
+            result = createBfsOrder(transitionMatrix, initialStates);
+            break;
+        case OrderKind::ReverseCuthillMcKee:
+            result = createReverseCuthillMcKeeOrder(transitionMatrix);
+            break;
+        case OrderKind::SccTopological:
+            result = createSccTopologicalOrder(transitionMatrix);
+            break;
+    }
+    STORM_LOG_ASSERT(isValidPermutation(result), "Computed order is not a permutation of the states.");
+    return result;
+}
+
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation) {
+    std::vector<uint64_t> result(permutation.size());
+    for (uint64_t index = 0; index < permutation.size(); ++index) {
+        result[permutation[index]] = index;
+    }
+    return result;
+}
+
+bool isValidPermutation(std::vector<uint64_t> const& permutation) {
+    storm::storage::BitVector occurringIndices(permutation.size(), false);
+    for (auto index : permutation) {
+        if (index >= permutation.size() || occurringIndices.get(index)) {
+            return false;
+        }
+        occurringIndices.set(index);
+    }
+    return true;
+}
+
+template std::vector<uint64_t> createStateOrder(OrderKind order, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                storm::storage::BitVector const& initialStates);
+
+#ifdef STORM_HAVE_CARL
+template std::vector<uint64_t> createStateOrder(OrderKind order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                storm::storage::BitVector const& initialStates);
+template std::vector<uint64_t> createStateOrder(OrderKind order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                storm::storage::BitVector const& initialStates);
+#endif
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace storm {
+namespace storage {
+class BitVector;
+template<typename ValueType>
+class SparseMatrix;
+}  // namespace storage
+
+namespace utility {
+namespace permutation {
+
+/*!
+ * The orders in which the states of a model can be arranged.
+ */
+enum class OrderKind {
+    // Breadth-first search from the initial states.
+    Bfs,
+    // Reverse Cuthill-McKee on the (undirected) transition graph, which keeps the entries of the matrix close to the diagonal.
+    ReverseCuthillMcKee,
+    // The states are grouped by SCCs and every SCC is placed after the SCCs it can reach.
+    SccTopological
+};
+
+std::ostream& operator<<(std::ostream& out, OrderKind const& order);
+
+/*!
+ * Computes an order of the states of the given transition matrix. States that have not been reached by the order (e.g., as they
+ * are unreachable from the initial states) are placed at the end.
+ *
+ * @param order The kind of order.
+ * @param transitionMatrix The transition matrix whose row groups correspond to the states.
+ * @param initialStates The initial states.
+ * @return For every index i, the (old) index of the state that is placed at index i. This is an inverse permutation as expected
+ * by, e.g., BitVector::permute.
+ */
+template<typename ValueType>
+std::vector<uint64_t> createStateOrder(OrderKind order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                       storm::storage::BitVector const& initialStates);
+
+/*!
+ * Inverts the given permutation.
+ */
+std::vector<uint64_t> invertPermutation(std::vector<uint64_t> const& permutation);
+
+/*!
+ * Checks whether the given vector is a permutation of 0, ..., n-1 (where n is the size of the vector).
+ */
+bool isValidPermutation(std::vector<uint64_t> const& permutation);
+
+}  // namespace permutation
+}  // namespace utility
+}  // namespace storm
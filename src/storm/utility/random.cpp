@@ -1,9 +1,17 @@
 #include "storm/utility/random.h"
 
+#include <array>
 #include <limits>
 
 namespace storm {
 namespace utility {
+uint64_t getSeedForStream(uint64_t seed, uint64_t stream) {
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    std::array<uint32_t, 2> result;
+    sequence.generate(result.begin(), result.end());
+    return (static_cast<uint64_t>(result[0]) << 32) | result[1];
+}
+
 RandomProbabilityGenerator<double>::RandomProbabilityGenerator() : distribution(0.0, 1.0) {
     std::random_device rd;
     engine = std::mt19937(rd());
@@ -6,6 +6,13 @@
 
 namespace storm {
 namespace utility {
+
+/*!
+ * Derives a seed for the given stream from the given seed. Generators that are seeded for distinct streams (e.g. one
+ * per thread) produce sequences of random numbers that are independent of each other.
+ */
+uint64_t getSeedForStream(uint64_t seed, uint64_t stream);
+
 template<typename ValueType>
 class RandomProbabilityGenerator {
    public:
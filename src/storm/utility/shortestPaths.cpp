@@ -112,6 +112,35 @@ std::vector<state_t> ShortestPathsGenerator<T>::getPathAsList(unsigned long k) {
     return backToFrontList;
 }
 
+template<typename T>
+EnumerationResult ShortestPathsGenerator<T>::enumeratePaths(
+    std::function<bool(OrderedStateList const& path, T const& probability, T const& cumulativeProbability)> const& callback, uint64_t memoryLimitInBytes) {
+    T cumulativeProbability = zero<T>();
+    for (unsigned long k = kShortestPaths[metaTarget].size() + 1;; ++k) {
+        if (getMemoryEstimate() > memoryLimitInBytes) {
+            STORM_LOG_DEBUG("KSP: memory limit reached after " << (k - 1) << " paths.");
+            return EnumerationResult::memoryLimitReached;
+        }
+        if (k > 1) {
+            computeNextPath(metaTarget, k);
+        }
+        if (kShortestPaths[metaTarget].size() < k) {
+            return EnumerationResult::noFurtherPath;
+        }
+        T const& probability = kShortestPaths[metaTarget][k - 1].distance;
+        cumulativeProbability += probability;
+        if (!callback(getPathAsList(k), probability, cumulativeProbability)) {
+            return EnumerationResult::stoppedByCallback;
+        }
+    }
+}
+
+template<typename T>
+uint64_t ShortestPathsGenerator<T>::getMemoryEstimate() const {
+    // candidates are stored in the nodes of a red-black tree (three pointers and a color)
+    return numberOfShortestPaths * sizeof(Path<T>) + numberOfCandidatePaths * (sizeof(Path<T>) + 4 * sizeof(void*));
+}
+
 template<typename T>
 void ShortestPathsGenerator<T>::computePredecessors() {
     assert(transitionMatrix.hasTrivialRowGrouping());
@@ -224,6 +253,7 @@ void ShortestPathsGenerator<T>::initializeShortestPaths() {
         // if current node is an initial state
         // in this case, the boost::optional copy of an uninitialized optional is hopefully also uninitialized
         kShortestPaths[currentNode].push_back(Path<T>{shortestPathPredecessors[currentNode], 1, shortestPathDistances[currentNode]});
+        ++numberOfShortestPaths;
     }
 }
 
@@ -264,12 +294,10 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // add shortest paths to predecessors plus edge to current node
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
                                                  shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
 
             // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
+            if (!(pathToPredecessorPlusEdge == shortestPathToNode) && candidatePaths[node].insert(pathToPredecessorPlusEdge).second) {
+                ++numberOfCandidatePaths;
             }
         }
     }
@@ -297,22 +325,20 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // take that path, add an edge to the current node; that's a candidate
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
                                                  kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            if (candidatePaths[node].insert(pathToPredecessorPlusEdge).second) {
+                ++numberOfCandidatePaths;
+            }
         }
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
     // Step B.6 in J&M paper
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        // candidates are ordered by decreasing distance
+        kShortestPaths[node].push_back(*candidatePaths[node].begin());
+        candidatePaths[node].erase(candidatePaths[node].begin());
+        ++numberOfShortestPaths;
+        --numberOfCandidatePaths;
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
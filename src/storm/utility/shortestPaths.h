@@ -2,6 +2,9 @@
 #define STORM_UTIL_SHORTESTPATHS_H_
 
 #include <boost/optional/optional.hpp>
+#include <functional>
+#include <limits>
+#include <set>
 #include <unordered_set>
 #include <vector>
 
@@ -55,6 +58,17 @@ struct Path {
     }
 };
 
+// orders candidate paths by decreasing distance, ties are broken by the (arbitrary) order of Path
+template<typename T>
+struct CandidatePathOrder {
+    bool operator()(Path<T> const& lhs, Path<T> const& rhs) const {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance > rhs.distance;
+        }
+        return lhs < rhs;
+    }
+};
+
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
@@ -63,6 +77,9 @@ std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 // format, which requires back-conversion of the entries
 enum class MatrixFormat { straight, iMinusP };
 
+// the reason why an enumeration of paths stopped
+enum class EnumerationResult { stoppedByCallback, noFurtherPath, memoryLimitReached };
+
 // -------------------------------------------------------------------------------------------------------
 
 template<typename T>
@@ -115,6 +132,22 @@ class ShortestPathsGenerator {
      */
     OrderedStateList getPathAsList(unsigned long k);
 
+    /*!
+     * Enumerates the paths in order of decreasing probability, starting with the path following the ones already computed.
+     * Each path is passed to the callback (as back-to-front traversal, see `getPathAsList`) together with its probability and
+     * the cumulative probability of all paths passed to the callback so far.
+     * Paths are computed lazily, i.e., only the (implicit) representations needed for the next path are computed.
+     * The enumeration stops once the callback returns false, no further path exists or the estimated memory
+     * occupied by the path representations exceeds the given limit.
+     */
+    EnumerationResult enumeratePaths(std::function<bool(OrderedStateList const& path, T const& probability, T const& cumulativeProbability)> const& callback,
+                                     uint64_t memoryLimitInBytes = std::numeric_limits<uint64_t>::max());
+
+    /*!
+     * Returns an estimate of the memory (in bytes) occupied by the computed and candidate path representations.
+     */
+    uint64_t getMemoryEstimate() const;
+
    private:
     Matrix const& transitionMatrix;
     state_t numStates;  // includes meta-target, i.e. states in model + 1
@@ -130,7 +163,10 @@ class ShortestPathsGenerator {
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    std::vector<std::set<Path<T>, CandidatePathOrder<T>>> candidatePaths;
+    // the number of entries in `kShortestPaths` and `candidatePaths`
+    uint64_t numberOfShortestPaths = 0;
+    uint64_t numberOfCandidatePaths = 0;
 
     /*!
      * Computes list of predecessors for all nodes.
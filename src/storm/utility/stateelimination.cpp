@@ -41,7 +41,8 @@ bool eliminationOrderNeedsReversedDistances(storm::settings::modules::Eliminatio
 bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
     return order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
            order == storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty ||
-           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression;
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree;
 }
 
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
@@ -100,6 +101,27 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyApproximateMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                          storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                          storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                          std::vector<ValueType> const&) {
+    // States that are both predecessor and successor are counted twice, which (as in approximate minimum degree
+    // orderings for sparse factorizations) saves merging the two rows.
+    uint_fast64_t degree = 0;
+    for (auto const& predecessor : backwardTransitions.getRow(state)) {
+        if (predecessor.getColumn() != state) {
+            ++degree;
+        }
+    }
+    for (auto const& successor : transitionMatrix.getRow(state)) {
+        if (successor.getColumn() != state) {
+            ++degree;
+        }
+    }
+    return degree;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -129,9 +151,12 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
             return std::make_unique<StaticStatePriorityQueue>(sortedStates);
         } else if (eliminationOrderIsPenaltyBased(order)) {
             std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> statePenalties(sortedStates.size());
-            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction =
-                order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression ? computeStatePenaltyRegularExpression<ValueType>
-                                                                                                            : computeStatePenalty<ValueType>;
+            typename DynamicStatePriorityQueue<ValueType>::PenaltyFunctionType penaltyFunction = computeStatePenalty<ValueType>;
+            if (order == storm::settings::modules::EliminationSettings::EliminationOrder::RegularExpression) {
+                penaltyFunction = computeStatePenaltyRegularExpression<ValueType>;
+            } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree) {
+                penaltyFunction = computeStatePenaltyApproximateMinimumDegree<ValueType>;
+            }
             for (uint_fast64_t index = 0; index < sortedStates.size(); ++index) {
                 statePenalties[index] =
                     std::make_pair(sortedStates[index], penaltyFunction(sortedStates[index], transitionMatrix, backwardTransitions, oneStepProbabilities));
@@ -241,6 +266,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
                                                             std::vector<double> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyApproximateMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                                   storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
+                                                                   storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+                                                                   std::vector<double> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<double> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates, std::vector<double> const& oneStepProbabilities,
@@ -265,6 +294,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                             std::vector<storm::RationalNumber> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyApproximateMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                                   storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                                   storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                                   std::vector<storm::RationalNumber> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
@@ -287,6 +320,10 @@ template uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::spar
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                             storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                             std::vector<storm::RationalFunction> const& oneStepProbabilities);
+template uint_fast64_t computeStatePenaltyApproximateMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                                   storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                                   storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                                   std::vector<storm::RationalFunction> const& oneStepProbabilities);
 template std::vector<uint_fast64_t> getDistanceBasedPriorities(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrixTransposed,
                                                                storm::storage::BitVector const& initialStates,
@@ -58,6 +58,16 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Computes the number of predecessors and successors of the given state (other than the state itself). Eliminating
+ * states with few neighbours first keeps the fill-in, i.e. the number of new transitions, low.
+ */
+template<typename ValueType>
+uint_fast64_t computeStatePenaltyApproximateMinimumDegree(storm::storage::sparse::state_type const& state,
+                                                          storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                          storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                          std::vector<ValueType> const& oneStepProbabilities);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
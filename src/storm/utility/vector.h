@@ -14,6 +14,7 @@
 #include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -346,15 +347,32 @@ void applyPointwiseTernary(std::vector<InValueType1> const& firstOperand, std::v
     }
 }
 
+/*!
+ * Splits [0, size) into ranges and calls body(rangeBegin, rangeEnd) for each of them in parallel. If Storm was
+ * built with TBB, the ranges are scheduled by TBB and otherwise by the built-in thread pool using
+ * storm::utility::parallel::getDefaultNumberOfThreads() threads.
+ *
+ * @param size The number of indices.
+ * @param body The function to call for each range.
+ */
+template<typename Body>
+void forEachRangeParallel(uint64_t size, Body const& body) {
 #ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size, 100), [&body](tbb::blocked_range<uint64_t> const& range) { body(range.begin(), range.end()); });
+#else
+    storm::utility::parallel::forEachChunk(0, size, 1024, storm::utility::parallel::getDefaultNumberOfThreads(),
+                                           [&body](uint64_t, uint64_t rangeBegin, uint64_t rangeEnd) { body(rangeBegin, rangeEnd); });
+#endif
+}
+
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseTernaryParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand,
                                    std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        auto firstIt = firstOperand.begin() + range.begin();
-        auto firstIte = firstOperand.begin() + range.end();
-        auto secondIt = secondOperand.begin() + range.begin();
-        auto targetIt = target.begin() + range.begin();
+    forEachRangeParallel(target.size(), [&](uint64_t rangeBegin, uint64_t rangeEnd) {
+        auto firstIt = firstOperand.begin() + rangeBegin;
+        auto firstIte = firstOperand.begin() + rangeEnd;
+        auto secondIt = secondOperand.begin() + rangeBegin;
+        auto targetIt = target.begin() + rangeBegin;
         while (firstIt != firstIte) {
             *targetIt = f(*firstIt, *secondIt, *targetIt);
             ++targetIt;
@@ -363,7 +381,6 @@ void applyPointwiseTernaryParallel(std::vector<InValueType1> const& firstOperand
         }
     });
 }
-#endif
 
 /*!
  * Applies the given operation pointwise on the two given vectors and writes the result to the third vector.
@@ -379,16 +396,13 @@ void applyPointwise(std::vector<InValueType1> const& firstOperand, std::vector<I
     std::transform(firstOperand.begin(), firstOperand.end(), secondOperand.begin(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class InValueType1, class InValueType2, class OutValueType, class Operation>
 void applyPointwiseParallel(std::vector<InValueType1> const& firstOperand, std::vector<InValueType2> const& secondOperand, std::vector<OutValueType>& target,
                             Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(firstOperand.begin() + range.begin(), firstOperand.begin() + range.end(), secondOperand.begin() + range.begin(),
-                       target.begin() + range.begin(), f);
+    forEachRangeParallel(target.size(), [&](uint64_t rangeBegin, uint64_t rangeEnd) {
+        std::transform(firstOperand.begin() + rangeBegin, firstOperand.begin() + rangeEnd, secondOperand.begin() + rangeBegin, target.begin() + rangeBegin, f);
     });
 }
-#endif
 
 /*!
  * Applies the given function pointwise on the given vector.
@@ -402,14 +416,12 @@ void applyPointwise(std::vector<InValueType> const& operand, std::vector<OutValu
     std::transform(operand.begin(), operand.end(), target.begin(), f);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class InValueType, class OutValueType, class Operation>
 void applyPointwiseParallel(std::vector<InValueType> const& operand, std::vector<OutValueType>& target, Operation f = Operation()) {
-    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, target.size()), [&](tbb::blocked_range<uint_fast64_t> const& range) {
-        std::transform(operand.begin() + range.begin(), operand.begin() + range.end(), target.begin() + range.begin(), f);
+    forEachRangeParallel(target.size(), [&](uint64_t rangeBegin, uint64_t rangeEnd) {
+        std::transform(operand.begin() + rangeBegin, operand.begin() + rangeEnd, target.begin() + rangeBegin, f);
     });
 }
-#endif
 
 /*!
  * Adds the two given vectors and writes the result to the target vector.
@@ -627,107 +639,37 @@ VT min_if(std::vector<VT> const& values, storm::storage::BitVector const& filter
     return current;
 }
 
-#ifdef STORM_HAVE_INTELTBB
-template<class T, class Filter>
-class TbbReduceVectorFunctor {
-   public:
-    TbbReduceVectorFunctor(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
-                           std::vector<uint_fast64_t>* choices, Filter const& f)
-        : source(source), target(target), rowGrouping(rowGrouping), choices(choices), f(f) {
-        // Intentionally left empty.
-    }
-
-    void operator()(tbb::blocked_range<uint64_t> const& range) const {
-        uint_fast64_t startRow = range.begin();
-        uint_fast64_t endRow = range.end();
-
-        typename std::vector<T>::iterator targetIt = target.begin() + startRow;
-        typename std::vector<T>::iterator targetIte = target.begin() + endRow;
-        typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startRow;
-        typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
-        typename std::vector<T>::const_iterator sourceIte;
-        typename std::vector<uint_fast64_t>::iterator choiceIt;
-        if (choices) {
-            choiceIt = choices->begin() + startRow;
-        }
-
-        // Variables for correctly tracking choices (only update if new choice is strictly better).
-        T oldSelectedChoiceValue;
-        uint64_t selectedChoice;
-
-        uint64_t currentRow = 0;
-        for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
-            // Only traverse elements if the row group is non-empty.
-            if (*rowGroupingIt != *(rowGroupingIt + 1)) {
-                *targetIt = *sourceIt;
-
-                if (choices) {
-                    selectedChoice = 0;
-                    if (*choiceIt == 0) {
-                        oldSelectedChoiceValue = *targetIt;
-                    }
-                }
-
-                ++sourceIt;
-                ++currentRow;
-
-                for (sourceIte = source.begin() + *(rowGroupingIt + 1); sourceIt != sourceIte; ++sourceIt, ++currentRow) {
-                    if (choices && *choiceIt + *rowGroupingIt == currentRow) {
-                        oldSelectedChoiceValue = *sourceIt;
-                    }
-
-                    if (f(*sourceIt, *targetIt)) {
-                        *targetIt = *sourceIt;
-                        if (choices) {
-                            selectedChoice = std::distance(source.begin(), sourceIt) - *rowGroupingIt;
-                        }
-                    }
-                }
-
-                if (choices && f(*targetIt, oldSelectedChoiceValue)) {
-                    *choiceIt = selectedChoice;
-                }
-            }
-        }
-    }
-
-   private:
-    std::vector<T> const& source;
-    std::vector<T>& target;
-    std::vector<uint_fast64_t> const& rowGrouping;
-    std::vector<uint_fast64_t>* choices;
-    Filter const& f;
-};
-#endif
 
 /*!
- * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+ * Reduces the row groups in [startGroup, endGroup) of the given source vector by selecting an element according
+ * to the given filter out of each row group.
  *
  * @param source The source vector which is to be reduced.
  * @param target The target vector into which a single element from each row group is written.
  * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
- * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
- * return true iff v1 is supposed to be taken instead of v2.
  * @param choices If non-null, this vector is used to store the choices made during the selection.
+ * @param startGroup The first row group to reduce.
+ * @param endGroup The row group past the last row group to reduce.
  */
 template<class T, class Filter>
-void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+void reduceVectorGroups(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
+                        std::vector<uint_fast64_t>* choices, uint64_t startGroup, uint64_t endGroup) {
     Filter f;
-    typename std::vector<T>::iterator targetIt = target.begin();
-    typename std::vector<T>::iterator targetIte = target.end();
-    typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin();
-    typename std::vector<T>::const_iterator sourceIt = source.begin();
+    typename std::vector<T>::iterator targetIt = target.begin() + startGroup;
+    typename std::vector<T>::iterator targetIte = target.begin() + endGroup;
+    typename std::vector<uint_fast64_t>::const_iterator rowGroupingIt = rowGrouping.begin() + startGroup;
+    typename std::vector<T>::const_iterator sourceIt = source.begin() + *rowGroupingIt;
     typename std::vector<T>::const_iterator sourceIte;
     typename std::vector<uint_fast64_t>::iterator choiceIt;
     if (choices) {
-        choiceIt = choices->begin();
+        choiceIt = choices->begin() + startGroup;
     }
 
     // Variables for correctly tracking choices (only update if new choice is strictly better).
     T oldSelectedChoiceValue;
     uint64_t selectedChoice;
 
-    uint64_t currentRow = 0;
+    uint64_t currentRow = *rowGroupingIt;
     for (; targetIt != targetIte; ++targetIt, ++rowGroupingIt, ++choiceIt) {
         // Only traverse elements if the row group is non-empty.
         if (*rowGroupingIt != *(rowGroupingIt + 1)) {
@@ -760,19 +702,39 @@ void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vec
                 *choiceIt = selectedChoice;
             }
         } else {
-            *choiceIt = 0;
+            if (choices) {
+                *choiceIt = 0;
+            }
             *targetIt = storm::utility::zero<T>();
         }
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
+/*!
+ * Reduces the given source vector by selecting an element according to the given filter out of each row group.
+ *
+ * @param source The source vector which is to be reduced.
+ * @param target The target vector into which a single element from each row group is written.
+ * @param rowGrouping A vector that specifies the begin and end of each group of elements in the values vector.
+ * @param filter A function that compares two elements v1 and v2 according to some filter criterion. This function must
+ * return true iff v1 is supposed to be taken instead of v2.
+ * @param choices If non-null, this vector is used to store the choices made during the selection.
+ */
+template<class T, class Filter>
+void reduceVector(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices) {
+    reduceVectorGroups<T, Filter>(source, target, rowGrouping, choices, 0, target.size());
+}
+
+/*!
+ * Reduces the given source vector like reduceVector, but distributes the row groups over several threads.
+ */
 template<class T, class Filter>
 void reduceVectorParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                           std::vector<uint_fast64_t>* choices) {
-    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, target.size()), TbbReduceVectorFunctor<T, Filter>(source, target, rowGrouping, choices, Filter()));
+    forEachRangeParallel(target.size(), [&](uint64_t rangeBegin, uint64_t rangeEnd) {
+        reduceVectorGroups<T, Filter>(source, target, rowGrouping, choices, rangeBegin, rangeEnd);
+    });
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the smallest element out of each row group.
@@ -788,13 +750,11 @@ void reduceVectorMin(std::vector<T> const& source, std::vector<T>& target, std::
     reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementLess<T>>(source, target, rowGrouping, choices);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting the largest element out of each row group.
@@ -810,13 +770,11 @@ void reduceVectorMax(std::vector<T> const& source, std::vector<T>& target, std::
     reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMaxParallel(std::vector<T> const& source, std::vector<T>& target, std::vector<uint_fast64_t> const& rowGrouping,
                              std::vector<uint_fast64_t>* choices = nullptr) {
-    reduceVector<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
+    reduceVectorParallel<T, storm::utility::ElementGreater<T>>(source, target, rowGrouping, choices);
 }
-#endif
 
 /*!
  * Reduces the given source vector by selecting either the smallest or the largest out of each row group.
@@ -837,7 +795,6 @@ void reduceVectorMinOrMax(storm::solver::OptimizationDirection dir, std::vector<
     }
 }
 
-#ifdef STORM_HAVE_INTELTBB
 template<class T>
 void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std::vector<T> const& source, std::vector<T>& target,
                                   std::vector<uint_fast64_t> const& rowGrouping, std::vector<uint_fast64_t>* choices = nullptr) {
@@ -847,7 +804,6 @@ void reduceVectorMinOrMaxParallel(storm::solver::OptimizationDirection dir, std:
         reduceVectorMaxParallel(source, target, rowGrouping, choices);
     }
 }
-#endif
 
 /*!
  * Compares the given elements and determines whether they are equal modulo the given precision. The provided flag
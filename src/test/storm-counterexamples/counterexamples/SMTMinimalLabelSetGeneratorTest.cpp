@@ -0,0 +1,91 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-counterexamples/api/counterexamples.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+#ifdef STORM_HAVE_Z3
+namespace {
+
+typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+typedef storm::storage::FlatSet<uint_fast64_t> LabelSet;
+
+// The commands are numbered in the order of their appearance.
+std::string const programString = R"(mdp
+module main
+    s : [0..4] init 0;
+    [] s=0 -> 0.5:(s'=1) + 0.5:(s'=2);
+    [] s=0 -> 0.5:(s'=2) + 0.5:(s'=4);
+    [] s=1 -> (s'=3);
+    [] s=2 -> 0.5:(s'=3) + 0.5:(s'=0);
+    [] s=2 -> (s'=2);
+    [] s=1 -> (s'=1);
+    [] s>=3 -> true;
+endmodule
+label "goal" = s=3;
+)";
+
+class SMTMinimalLabelSetGeneratorTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        symbolicModel = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parseFromString(programString, "testfile"));
+        storm::builder::BuilderOptions options(true, true);
+        options.setBuildChoiceOrigins(true);
+        model = storm::api::buildSparseModel<double>(symbolicModel, options);
+        phiStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+        psiStates = model->getStates("goal");
+    }
+
+    std::vector<LabelSet> computeMinimalLabelSets(double threshold, uint64_t portfolioSize, storm::storage::BitVector const& targetStates) {
+        Generator::Options options;
+        options.silent = true;
+        options.portfolioSize = portfolioSize;
+        Generator::GeneratorStats stats;
+        return Generator::getMinimalLabelSet(env, stats, symbolicModel, *model, phiStates, targetStates, {threshold}, boost::none, false, LabelSet(),
+                                             options);
+    }
+
+    storm::Environment env;
+    storm::storage::SymbolicModelDescription symbolicModel;
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    storm::storage::BitVector phiStates;
+    storm::storage::BitVector psiStates;
+};
+
+TEST_F(SMTMinimalLabelSetGeneratorTest, MinimalLabelSet) {
+    // Commands 0 and 2 reach the goal with probability 0.5, commands 1 and 3 with probability 1/3.
+    auto result = computeMinimalLabelSets(0.4, 1, psiStates);
+    ASSERT_EQ(1ull, result.size());
+    EXPECT_EQ(LabelSet({0, 2}), result.front());
+
+    // Exceeding 0.6 requires to extend {0, 2} by command 3, which lets the checker of the candidates start from the values of {0, 2}.
+    result = computeMinimalLabelSets(0.6, 1, psiStates);
+    ASSERT_EQ(1ull, result.size());
+    EXPECT_EQ(LabelSet({0, 2, 3}), result.front());
+}
+
+TEST_F(SMTMinimalLabelSetGeneratorTest, Portfolio) {
+    for (double threshold : {0.4, 0.6}) {
+        auto sequentialResult = computeMinimalLabelSets(threshold, 1, psiStates);
+        auto portfolioResult = computeMinimalLabelSets(threshold, 3, psiStates);
+        ASSERT_EQ(1ull, sequentialResult.size());
+        ASSERT_EQ(1ull, portfolioResult.size());
+        EXPECT_EQ(sequentialResult.front(), portfolioResult.front()) << "for threshold " << threshold;
+    }
+}
+
+TEST_F(SMTMinimalLabelSetGeneratorTest, NoRelevantLabels) {
+    // If the initial state is a target state, no label is needed.
+    for (uint64_t portfolioSize : {1, 3}) {
+        auto result = computeMinimalLabelSets(0.6, portfolioSize, model->getInitialStates());
+        ASSERT_EQ(1ull, result.size());
+        EXPECT_TRUE(result.front().empty());
+    }
+}
+
+}  // namespace
+#endif
@@ -0,0 +1,50 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <carl/core/VariablePool.h>
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/modelchecker/DftInstantiationChecker.h"
+#include "storm-dft/transformations/DftInstantiator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+TEST(DftInstantiationCheckerTest, SymmetryParam) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/symmetry_param.dft";
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> dft = storm::dft::api::loadDFTGalileoFile<storm::RationalFunction>(file);
+    dft = storm::dft::api::prepareForMarkovAnalysis<storm::RationalFunction>(*dft);
+    auto properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("T=? [F \"failed\"]; P=? [F<=1 \"failed\"]"));
+
+    storm::dft::modelchecker::DftInstantiationChecker checker(*dft);
+    EXPECT_EQ(2ul, checker.getParameters().size());
+
+    storm::RationalFunctionVariable const& x = carl::VariablePool::getInstance().findVariableWithName("x");
+    storm::RationalFunctionVariable const& y = carl::VariablePool::getInstance().findVariableWithName("y");
+    std::vector<storm::dft::modelchecker::DftInstantiationChecker::Valuation> valuations;
+    for (double xValue : {0.5, 1.0, 5.0}) {
+        for (double yValue : {0.01, 0.5}) {
+            valuations.emplace_back();
+            valuations.back()[x] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(xValue);
+            valuations.back()[y] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(yValue);
+        }
+    }
+    std::vector<std::vector<double>> results = checker.check(properties, valuations);
+    ASSERT_EQ(valuations.size(), results.size());
+
+    // Compare with building the state space of each instantiated DFT.
+    storm::dft::transformations::DftInstantiator<storm::RationalFunction, double> instantiator(*dft);
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        std::shared_ptr<storm::dft::storage::DFT<double>> instantiatedDft = instantiator.instantiate(valuations[i]);
+        auto expected = storm::dft::api::analyzeDFT<double>(*instantiatedDft, properties, true, false);
+        ASSERT_EQ(2ul, results[i].size());
+        EXPECT_NEAR(boost::get<double>(expected[0]), results[i][0], 1e-6);
+        EXPECT_NEAR(boost::get<double>(expected[1]), results[i][1], 1e-6);
+    }
+
+    valuations.back().erase(y);
+    STORM_SILENT_EXPECT_THROW(checker.check(properties, valuations), storm::exceptions::InvalidArgumentException);
+}
+}  // namespace
@@ -4,6 +4,7 @@
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/utility/parallel.h"
 
 namespace {
 
@@ -88,4 +89,31 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, MultiThreaded) {
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft";
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    dft->setRelevantEvents(storm::dft::utility::RelevantEvents({"all"}), false);
+
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+
+    // The model obtained with several threads has to coincide with the one obtained with a single thread
+    storm::utility::parallel::setDefaultNumberOfThreads(4);
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builderMultiThreaded(*dft, symmetries);
+    builderMultiThreaded.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> modelMultiThreaded = builderMultiThreaded.getModel();
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+
+    EXPECT_EQ(model->getNumberOfStates(), modelMultiThreaded->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), modelMultiThreaded->getNumberOfTransitions());
+    EXPECT_TRUE(model->getTransitionMatrix() == modelMultiThreaded->getTransitionMatrix());
+    EXPECT_TRUE(model->getStateLabeling() == modelMultiThreaded->getStateLabeling());
+}
+
 }  // namespace
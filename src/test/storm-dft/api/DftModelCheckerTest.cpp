@@ -248,4 +248,25 @@ TYPED_TEST(DftModelCheckerTest, HecsReliability) {
     double result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", 1.0);
     EXPECT_NEAR(result, 0.00021997582, this->precisionReliability());
 }
+
+TEST(DftModelCheckerHybridTest, HecsReliability) {
+    // The static top module is analysed via BDDs, only the spare modules via CTMCs
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft")));
+    std::vector<std::shared_ptr<storm::logic::Formula const>> properties =
+        storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=1 \"failed\"]; Pmin=? [F<=2 \"failed\"]"));
+    auto results = storm::dft::api::analyzeDFT<double>(*dft, properties, true, true, {}, false, 0.0, storm::dft::builder::ApproximationHeuristic::DEPTH,
+                                                       false, storm::transformer::EliminationLabelBehavior::KeepLabels, false, true);
+    ASSERT_EQ(2ul, results.size());
+    EXPECT_NEAR(boost::get<double>(results[0]), 0.00021997582, 1e-10);
+    auto resultsCtmc = storm::dft::api::analyzeDFT<double>(*dft, {properties[1]}, true, true);
+    EXPECT_NEAR(boost::get<double>(resultsCtmc[0]), boost::get<double>(results[1]), 1e-10);
+
+    // Properties on other events are not supported by the hybrid analysis, so the DFT is analysed via the CTMC
+    properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Pmin=? [F<=1 \"System_1_failed\"]"));
+    results = storm::dft::api::analyzeDFT<double>(*dft, properties, true, true, {"System_1"}, false, 0.0, storm::dft::builder::ApproximationHeuristic::DEPTH,
+                                                  false, storm::transformer::EliminationLabelBehavior::KeepLabels, false, true);
+    ASSERT_EQ(1ul, results.size());
+    EXPECT_GT(boost::get<double>(results[0]), 0.0);
+}
 }  // namespace
@@ -14,6 +14,7 @@
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/utility/parallel.h"
 #include "test/storm_gtest.h"
 #include "utility/vector.h"
 
@@ -122,6 +123,29 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, ImportanceMeasuresAtTimepoints) {
+    std::vector<double> const timepoints{0.1, 0.5, 1, 1.5, 2, 3, 4};
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(3);
+    auto const probabilities{checker->getProbabilitiesAtTimepoints(timepoints)};
+    auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, 2)};
+    auto const RAWs{checker->getAllRAWsAtTimepoints(timepoints)};
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    ASSERT_EQ(timepoints.size(), probabilities.size());
+    ASSERT_EQ(basicElements.size(), birnbaumFactors.size());
+    ASSERT_EQ(basicElements.size(), RAWs.size());
+    for (size_t i{0}; i < timepoints.size(); ++i) {
+        EXPECT_NEAR(checker->getProbabilityAtTimebound(timepoints[i]), probabilities[i], 1e-6);
+        // Compare with the evaluation for a single basic element
+        for (size_t be{0}; be < basicElements.size(); ++be) {
+            EXPECT_NEAR(checker->getBirnbaumFactorAtTimebound(basicElements[be]->name(), timepoints[i]), birnbaumFactors[be][i], 1e-6);
+            EXPECT_NEAR(checker->getRAWAtTimebound(basicElements[be]->name(), timepoints[i]), RAWs[be][i], 1e-6);
+        }
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
@@ -3,6 +3,7 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/modelchecker/DftModularizationChecker.h"
+#include "storm/utility/parallel.h"
 
 namespace {
 
@@ -83,7 +84,25 @@ static std::vector<ModularizerTestData> modularizerTestData{
         STORM_TEST_RESOURCES_DIR "/dft/mcs.dft",
         0.9984947969,
     },
+    {
+        "IsomorphicModules",
+        STORM_TEST_RESOURCES_DIR "/dft/modules_isomorphic.dft",
+        0.3794303399,
+    },
 };
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerTest, MultiThreaded) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/modules_isomorphic.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker{dft};
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(2);
+    auto probabilities = checker.getProbabilitiesAtTimepoints({0.5, 1, 2});
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+    ASSERT_EQ(3ul, probabilities.size());
+    EXPECT_NEAR(probabilities[1], 0.3794303399, 1e-6);
+    EXPECT_LT(probabilities[0], probabilities[1]);
+    EXPECT_LT(probabilities[1], probabilities[2]);
+}
+
 }  // namespace
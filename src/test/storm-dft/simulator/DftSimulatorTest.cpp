@@ -189,4 +189,23 @@ TEST(DftSimulatorTest, HecsUnreliability) {
     EXPECT_NEAR(result, 0.00021997582, 0.001);
 }
 
+TEST(DftSimulatorTest, ParallelUnreliability) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/spare3.dft")));
+    // All traces are simulated.
+    auto result = storm::dft::api::simulateDFT<double>(dft, 1, 10000, 0.0, 0.95, 4, 5u, 1000);
+    EXPECT_EQ(10000ul, result.numberOfTraces);
+    EXPECT_FALSE(result.converged);
+    EXPECT_NEAR(result.unreliability, 0.4660673246, 0.015);
+    EXPECT_LE(result.confidenceInterval.first, result.unreliability);
+    EXPECT_GE(result.confidenceInterval.second, result.unreliability);
+
+    // The simulation stops once the confidence interval is narrow enough.
+    result = storm::dft::api::simulateDFT<double>(dft, 1, 1000000, 0.02, 0.95, 4, 5u, 500);
+    EXPECT_TRUE(result.converged);
+    EXPECT_LT(result.numberOfTraces, 1000000ul);
+    EXPECT_LE(result.confidenceInterval.second - result.confidenceInterval.first, 0.04);
+    EXPECT_NEAR(result.unreliability, 0.4660673246, 0.03);
+}
+
 }  // namespace
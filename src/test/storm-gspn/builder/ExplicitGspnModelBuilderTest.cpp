@@ -0,0 +1,141 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm-gspn/builder/JaniGSPNBuilder.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+uint64_t getNumberOfTangibleStates(storm::models::sparse::Model<double> const& model) {
+    if (model.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+        return model.as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits();
+    }
+    return model.getNumberOfStates();
+}
+
+double checkInitialState(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+    EXPECT_TRUE(result != nullptr);
+    return result ? result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()] : -1.0;
+}
+
+/*
+ * Builds the model of the GSPN directly and via JANI. The JANI model keeps all vanishing markings, so only the tangible markings are compared.
+ * The formula is checked on both models.
+ */
+void checkAgainstJani(storm::gspn::GSPN const& gspn, std::string const& formulaString, uint64_t expectedStates, uint64_t expectedTangibleStates,
+                      double expectedValue) {
+    storm::builder::JaniGSPNBuilder janiBuilder(gspn);
+    std::unique_ptr<storm::jani::Model> janiModel(janiBuilder.build());
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForJaniModel(formulaString, *janiModel));
+    ASSERT_EQ(1ull, formulas.size());
+
+    std::vector<storm::expressions::Expression> labelExpressions;
+    for (auto const& atomicExpressionFormula : formulas.front()->getAtomicExpressionFormulas()) {
+        labelExpressions.push_back(atomicExpressionFormula->getExpression());
+    }
+    auto model = storm::api::buildSparseModel(gspn, labelExpressions);
+    auto janiSparseModel = storm::api::buildSparseModel<double>(storm::storage::SymbolicModelDescription(*janiModel), formulas);
+
+    EXPECT_EQ(expectedStates, model->getNumberOfStates());
+    EXPECT_EQ(expectedTangibleStates, getNumberOfTangibleStates(*model));
+    EXPECT_EQ(expectedTangibleStates, getNumberOfTangibleStates(*janiSparseModel));
+    EXPECT_NEAR(expectedValue, checkInitialState(model, formulas.front()), 1e-6);
+    EXPECT_NEAR(expectedValue, checkInitialState(janiSparseModel, formulas.front()), 1e-6);
+}
+
+TEST(ExplicitGspnModelBuilderTest, PrioritiesAndWeights) {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("priorities");
+    builder.addPlace(1, 1, "p0");
+    builder.addPlace(1, 0, "pA");
+    builder.addPlace(1, 0, "pB");
+    // tA and tB share a partition, tD (without weight) forms its own partition and thus a nondeterministic choice.
+    builder.addImmediateTransition(1, 1.0, "tA");
+    builder.addImmediateTransition(1, 3.0, "tB");
+    builder.addImmediateTransition(1, 0.0, "tD");
+    // Never fires as the transitions above have a higher priority.
+    builder.addImmediateTransition(0, 4.0, "tC");
+    builder.addTimedTransition(0, 1.0, "backA");
+    builder.addTimedTransition(0, 2.0, "backB");
+    builder.addNormalArc("p0", "tA");
+    builder.addNormalArc("tA", "pA");
+    builder.addNormalArc("p0", "tB");
+    builder.addNormalArc("tB", "pB");
+    builder.addNormalArc("p0", "tD");
+    builder.addNormalArc("tD", "pA");
+    builder.addNormalArc("p0", "tC");
+    builder.addNormalArc("tC", "pB");
+    builder.addNormalArc("pA", "backA");
+    builder.addNormalArc("backA", "p0");
+    builder.addNormalArc("pB", "backB");
+    builder.addNormalArc("backB", "p0");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    // The vanishing initial marking is kept. Choosing the partition of tA and tB yields E = 1/4 * (1 + E), i.e., E = 1/3.
+    checkAgainstJani(*gspn, "Tmin=? [F pB=1]", 3, 2, 1.0 / 3.0);
+}
+
+TEST(ExplicitGspnModelBuilderTest, InhibitorArcs) {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("inhibitor");
+    builder.addPlace(1, 0, "arrival");
+    builder.addPlace(3, 0, "buffer");
+    builder.addTimedTransition(0, 1.0, "produce");
+    builder.addImmediateTransition(1, 1.0, "enqueue");
+    builder.addImmediateTransition(0, 1.0, "discard");
+    builder.addTimedTransition(0, 2.0, "consume");
+    builder.addNormalArc("produce", "arrival");
+    builder.addNormalArc("arrival", "enqueue");
+    builder.addNormalArc("enqueue", "buffer");
+    builder.addInhibitionArc("buffer", "enqueue", 2);
+    builder.addNormalArc("arrival", "discard");
+    builder.addNormalArc("buffer", "consume");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    // All vanishing markings are eliminated, which yields a CTMC with a buffer of size 0, 1 or 2 and steady-state probabilities proportional
+    // to 1, 1/2 and 1/4. Without the inhibition arc, the buffer would reach size 3.
+    checkAgainstJani(*gspn, "LRAmin=? [buffer=2]", 3, 3, 1.0 / 7.0);
+    EXPECT_TRUE(storm::api::buildSparseModel(*gspn)->isOfType(storm::models::ModelType::Ctmc));
+}
+
+TEST(ExplicitGspnModelBuilderTest, VanishingLoop) {
+    storm::gspn::GspnBuilder builder;
+    builder.setGspnName("loop");
+    builder.addPlace(1, 1, "c");
+    builder.addPlace(1, 0, "a");
+    builder.addPlace(1, 0, "b");
+    builder.addPlace(1, 0, "d");
+    builder.addTimedTransition(0, 1.0, "start");
+    builder.addImmediateTransition(0, 1.0, "ab");
+    builder.addImmediateTransition(0, 1.0, "ba");
+    builder.addImmediateTransition(0, 1.0, "bc");
+    builder.addImmediateTransition(0, 2.0, "bd");
+    builder.addNormalArc("c", "start");
+    builder.addNormalArc("start", "a");
+    builder.addNormalArc("a", "ab");
+    builder.addNormalArc("ab", "b");
+    builder.addNormalArc("b", "ba");
+    builder.addNormalArc("ba", "a");
+    builder.addNormalArc("b", "bc");
+    builder.addNormalArc("bc", "c");
+    builder.addNormalArc("b", "bd");
+    builder.addNormalArc("bd", "d");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    // Marking a lies on the immediate cycle a -> b -> a and is kept, b is eliminated. From a, d is reached with probability 2/3 and c with 1/3.
+    // The expected time to reach d is thus E = 1 + 1/3 * E, i.e., E = 3/2.
+    checkAgainstJani(*gspn, "Tmin=? [F d=1]", 3, 2, 1.5);
+}
+
+}  // namespace
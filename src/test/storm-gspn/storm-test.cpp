@@ -0,0 +1,9 @@
+#include "test/storm_gtest.h"
+#include "storm/settings/SettingsManager.h"
+
+int main(int argc, char **argv) {
+  storm::settings::initializeAll("Storm-gspn (Functional) Testing Suite", "test-gspn");
+  storm::test::initialize();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
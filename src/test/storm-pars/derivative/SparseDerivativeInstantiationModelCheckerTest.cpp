@@ -155,6 +155,14 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             auto derivative = derivativeModelChecker.check(env(), instantiation, parameter);
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6) << instantiation;
         }
+
+        // All derivatives at once
+        std::vector<VariableType<storm::RationalFunction>> parameterVector(parameters.begin(), parameters.end());
+        auto batchDerivatives = derivativeModelChecker.check(env(), instantiation, parameterVector);
+        ASSERT_EQ(parameterVector.size(), batchDerivatives.size());
+        for (auto const& parameter : parameterVector) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(batchDerivatives.at(parameter)->getValueVector()[0]), storm::utility::convertNumber<double>(testCase.second.at(parameter)), 1e-6) << instantiation;
+        }
     }
 }
 
@@ -99,6 +99,116 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown,storm::modelchecker::RegionResult::Unknown, true));
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Subregions) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+
+        // The results for a subregion must not depend on the regions that were checked before (which are only reused to speed up the computation).
+        auto incrementalChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto parentRegion = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> subregions = {
+            storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.5,0.1<=pK<=0.5", modelParameters),
+            storm::api::parseRegion<storm::RationalFunction>("0.5<=pL<=0.9,0.1<=pK<=0.5", modelParameters),
+            storm::api::parseRegion<storm::RationalFunction>("0.5<=pL<=0.9,0.5<=pK<=0.9", modelParameters)};
+        for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+            incrementalChecker->getBoundAtInitState(this->env(), parentRegion, dir);
+        }
+        for (auto const& subregion : subregions) {
+            auto freshChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+            for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+                double incrementalResult = storm::utility::convertNumber<double>(incrementalChecker->getBoundAtInitState(this->env(), subregion, dir));
+                double freshResult = storm::utility::convertNumber<double>(freshChecker->getBoundAtInitState(this->env(), subregion, dir));
+                EXPECT_NEAR(freshResult, incrementalResult, 1e-6);
+            }
+        }
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ParallelRefinement) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+        auto createChecker = [&]() { return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task, true); };
+
+        auto sequentialResult = createChecker()->performRegionRefinement(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.05));
+        auto parallelChecker = createChecker();
+        parallelChecker->setRefinementWorkers(createChecker, 4);
+        auto parallelResult = parallelChecker->performRegionRefinement(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.05));
+
+        // The concurrent refinement may analyze more regions before it stops, but both cover the required fraction.
+        EXPECT_GE(parallelResult->getSatFraction() + parallelResult->getUnsatFraction(), storm::utility::convertNumber<typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType>(0.95));
+        EXPECT_GE(sequentialResult->getSatFraction() + sequentialResult->getUnsatFraction(), storm::utility::convertNumber<typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType>(0.95));
+
+        // Refining twice yields the same result.
+        auto parallelResult2 = parallelChecker->performRegionRefinement(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.05));
+        ASSERT_EQ(parallelResult->getRegionResults().size(), parallelResult2->getRegionResults().size());
+        for (uint64_t index = 0; index < parallelResult->getRegionResults().size(); ++index) {
+            EXPECT_EQ(parallelResult->getRegionResults()[index].second, parallelResult2->getRegionResults()[index].second);
+        }
+    }
+
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_Presampling) {
+        typedef typename TestFixture::ValueType ValueType;
+        typedef typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType CoefficientType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+
+        auto threshold = storm::utility::convertNumber<storm::RationalFunction>(0.05);
+        auto plainChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task, true);
+        auto plainResult = plainChecker->performRegionRefinement(this->env(), region, threshold);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task, true);
+        regionChecker->setPresampling(4);
+        auto presampledResult = regionChecker->performRegionRefinement(this->env(), region, threshold);
+
+        // Presampling only saves the analysis of regions that can not be conclusive, so the same area is classified.
+        EXPECT_GE(presampledResult->getSatFraction() + presampledResult->getUnsatFraction(), storm::utility::convertNumber<CoefficientType>(0.95));
+        EXPECT_EQ(plainResult->getSatFraction(), presampledResult->getSatFraction());
+        EXPECT_EQ(plainResult->getUnsatFraction(), presampledResult->getUnsatFraction());
+
+        // The samples agree with the results for the regions that contain them (see Brp_Prob_no_simplification).
+        auto satPoint = storm::api::parseRegion<storm::RationalFunction>("0.8<=pL<=0.8,0.9<=pK<=0.9", modelParameters).getLowerBoundaries();
+        auto violatedPoint = storm::api::parseRegion<storm::RationalFunction>("0.2<=pL<=0.2,0.2<=pK<=0.2", modelParameters).getLowerBoundaries();
+        auto samples = regionChecker->checkSamples(this->env(), {satPoint, violatedPoint});
+        ASSERT_EQ(2ull, samples.size());
+        EXPECT_TRUE(samples[0]);
+        EXPECT_FALSE(samples[1]);
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
@@ -139,6 +139,49 @@ TEST(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+
+    // More valuations than are evaluated together
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t i = 0; i < 100; ++i) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.01 + 0.0098 * i)));
+        valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.99 - 0.0098 * i)));
+        valuations.push_back(std::move(valuation));
+    }
+
+    auto batchValues = modelInstantiator.instantiateTransitionMatrixValues(valuations);
+    ASSERT_EQ(valuations.size(), batchValues.size());
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        ASSERT_EQ(dtmc->getTransitionMatrix().getEntryCount(), batchValues[i].size());
+        auto batchValueIt = batchValues[i].begin();
+        for (auto const& paramEntry : dtmc->getTransitionMatrix()) {
+            double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuations[i]));
+            EXPECT_NEAR(evaluatedValue, *batchValueIt, 1e-12);
+            ++batchValueIt;
+        }
+    }
+}
+
 TEST(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
     
@@ -9,6 +9,7 @@
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 
 
@@ -28,6 +29,7 @@ void graphalgorithm_test(std::string const& path, std::string const& constants,
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
             formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->resetAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 }
 
@@ -45,6 +47,7 @@ void oneshot_test(std::string const& path, std::string const& constants, std::st
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
             formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->resetAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
     std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
     storm::pomdp::OneShotPolicySearch<double> memlessSearch(*pomdp, targetStates,
@@ -68,6 +71,7 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
             formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->resetAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 
     std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
@@ -84,6 +88,41 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
 }
 
 
+void portfolio_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    // Run graph algorithm
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
+            formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->resetAnalysisCache();
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+    auto configurations = storm::pomdp::PolicySearchPortfolio<double>::createConfigurations(options);
+    EXPECT_EQ(3ull, configurations.size());
+    storm::pomdp::PolicySearchPortfolio<double> portfolio(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, configurations);
+    if (wr) {
+        search.computeWinningRegion(lookahead);
+        portfolio.computeWinningRegion(lookahead);
+        EXPECT_EQ(search.getLastWinningRegion().empty(), portfolio.getLastWinningRegion().empty());
+    } else {
+        // The portfolio contains the configuration of the single search.
+        bool searchResult = search.analyzeForInitialStates(lookahead);
+        bool portfolioResult = portfolio.analyzeForInitialStates(lookahead);
+        EXPECT_TRUE(!searchResult || portfolioResult);
+    }
+}
+
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
     program = storm::utility::prism::preprocess(program, constants);
@@ -98,6 +137,7 @@ void symbolicbelsup_test(std::string const& path, std::string const& constants,
     storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
             formula->asProbabilityOperatorFormula());
     pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    pomdp->resetAnalysisCache();
     storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
 
     storm::pomdp::qualitative::JaniBeliefSupportMdpGenerator<double> janicreator(*pomdp);
@@ -157,6 +197,13 @@ TEST(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST(QualitativeAnalysis, Portfolio_Maze) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", true);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
+}
+
 TEST(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
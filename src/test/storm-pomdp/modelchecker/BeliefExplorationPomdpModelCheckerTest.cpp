@@ -10,6 +10,7 @@
 #include "storm-pomdp/transformer/KnownProbabilityTransformer.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/utility/parallel.h"
 
 
 namespace {
@@ -429,6 +430,44 @@ namespace {
         // Use relative difference of bounds for this one
         EXPECT_LE(result.diff(), this->precision()) << "Result [" << result.lowerBound << ", " << result.upperBound << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
     }
+
+    TYPED_TEST(BeliefExplorationTest, refuel_Pmax_boundsCallback) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        auto options = this->options();
+        options.refineTimeLimit = 3600;
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, options);
+        std::vector<std::pair<ValueType, ValueType>> reportedBounds;
+        checker.setBoundsCallback([&reportedBounds](ValueType const& lowerBound, ValueType const& upperBound) { reportedBounds.emplace_back(lowerBound, upperBound); });
+        auto result = checker.check(*data.formula);
+
+        // The reported bounds only improve and the last ones are the final result
+        ASSERT_FALSE(reportedBounds.empty());
+        for (uint64_t i = 1; i < reportedBounds.size(); ++i) {
+            EXPECT_LE(reportedBounds[i - 1].first, reportedBounds[i].first);
+            EXPECT_GE(reportedBounds[i - 1].second, reportedBounds[i].second);
+        }
+        EXPECT_EQ(result.lowerBound, reportedBounds.back().first);
+        EXPECT_EQ(result.upperBound, reportedBounds.back().second);
+    }
+
+    TYPED_TEST(BeliefExplorationTest, refuel_Pmax_multithreaded) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> sequentialChecker(data.model, this->options());
+        auto sequentialResult = sequentialChecker.check(*data.formula);
+
+        // Successor beliefs are computed concurrently but the explored belief MDPs (and thus the results) have to coincide
+        storm::utility::parallel::setDefaultNumberOfThreads(4);
+        storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> parallelChecker(data.model, this->options());
+        auto parallelResult = parallelChecker.check(*data.formula);
+        storm::utility::parallel::setDefaultNumberOfThreads(1);
+
+        EXPECT_EQ(sequentialResult.lowerBound, parallelResult.lowerBound);
+        EXPECT_EQ(sequentialResult.upperBound, parallelResult.upperBound);
+    }
     
     
     
@@ -0,0 +1,67 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/generator/NondeterministicBeliefTracker.h"
+
+TEST(NondeterministicBeliefTracking, Maze) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    std::vector<double> risk(pomdp->getNumberOfStates(), 0.0);
+    for (auto state : pomdp->getStates("goal")) {
+        risk[state] = 1.0;
+    }
+
+    typedef storm::generator::NondeterministicBeliefTracker<double, storm::generator::SparseBeliefState<double>> Tracker;
+    Tracker::Options sequentialOptions;
+    sequentialOptions.wiggle = 0.0;
+    Tracker::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    Tracker::Options boundedOptions = sequentialOptions;
+    boundedOptions.maximalNumberOfBeliefs = 1;
+    std::vector<Tracker> trackers;
+    trackers.emplace_back(*pomdp, sequentialOptions);
+    trackers.emplace_back(*pomdp, parallelOptions);
+    trackers.emplace_back(*pomdp, boundedOptions);
+
+    uint64_t state = *pomdp->getInitialStates().begin();
+    for (auto& tracker : trackers) {
+        tracker.setRisk(risk);
+        EXPECT_TRUE(tracker.reset(pomdp->getObservation(state)));
+    }
+
+    // Follow a path of the POMDP and track its observations.
+    uint64_t const numberOfSteps = 10;
+    for (uint64_t step = 0; step < numberOfSteps; ++step) {
+        state = pomdp->getTransitionMatrix().getRow(pomdp->getTransitionMatrix().getRowGroupIndices()[state]).begin()->getColumn();
+        for (auto& tracker : trackers) {
+            EXPECT_TRUE(tracker.track(pomdp->getObservation(state)));
+        }
+        EXPECT_EQ(trackers[0].getNumberOfBeliefs(), trackers[1].getNumberOfBeliefs());
+        EXPECT_NEAR(trackers[0].getCurrentRisk(true), trackers[1].getCurrentRisk(true), 1e-6);
+        EXPECT_NEAR(trackers[0].getCurrentRisk(false), trackers[1].getCurrentRisk(false), 1e-6);
+        EXPECT_EQ(1ul, trackers[2].getNumberOfBeliefs());
+        for (auto const& belief : trackers[0].getCurrentBeliefs()) {
+            double sum = 0.0;
+            for (auto const& entry : belief.getBeliefMap()) {
+                EXPECT_EQ(pomdp->getObservation(state), pomdp->getObservation(entry.first));
+                sum += entry.second;
+            }
+            EXPECT_NEAR(1.0, sum, 1e-6);
+        }
+    }
+    EXPECT_EQ(numberOfSteps, trackers[0].getStatistics().numberOfSteps);
+    EXPECT_LE(trackers[0].getStatistics().maximalTime, trackers[0].getStatistics().totalTime);
+
+    // An observation that can not be made leads to no beliefs.
+    EXPECT_FALSE(trackers[0].track(pomdp->getNrObservations()));
+    EXPECT_EQ(0ul, trackers[0].getNumberOfBeliefs());
+}
@@ -0,0 +1,36 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-pomdp/storage/PomdpMemory.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm-pomdp/transformer/PomdpMemoryUnfolder.h"
+#include "storm/utility/graph.h"
+
+TEST(MemoryUnfolder, Maze) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism");
+    program = storm::utility::prism::preprocess(program, "sl=0.4");
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"goal\" ]", program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    pomdp = storm::transformer::MakePOMDPCanonic<double>(*pomdp).transform();
+
+    // Unfolding trivial memory yields the same POMDP.
+    storm::storage::PomdpMemory trivialMemory = storm::storage::PomdpMemoryBuilder().build(storm::storage::PomdpMemoryPattern::Trivial, 1);
+    auto unfolded = storm::transformer::PomdpMemoryUnfolder<double>(*pomdp, trivialMemory).transform();
+    EXPECT_EQ(pomdp->getNumberOfStates(), unfolded->getNumberOfStates());
+    EXPECT_EQ(pomdp->getNumberOfChoices(), unfolded->getNumberOfChoices());
+    EXPECT_EQ(pomdp->getNumberOfTransitions(), unfolded->getNumberOfTransitions());
+    EXPECT_EQ(pomdp->getNrObservations(), unfolded->getNrObservations());
+
+    // Only the reachable part of the product is built.
+    storm::storage::PomdpMemory memory = storm::storage::PomdpMemoryBuilder().build(storm::storage::PomdpMemoryPattern::Full, 2);
+    unfolded = storm::transformer::PomdpMemoryUnfolder<double>(*pomdp, memory, true).transform();
+    EXPECT_LE(unfolded->getNumberOfStates(), 2 * pomdp->getNumberOfStates());
+    EXPECT_LE(unfolded->getNrObservations(), 2 * pomdp->getNrObservations());
+    EXPECT_EQ(pomdp->getInitialStates().getNumberOfSetBits(), unfolded->getInitialStates().getNumberOfSetBits());
+    EXPECT_TRUE(unfolded->getStateLabeling().containsLabel("memstate_1"));
+    storm::storage::BitVector allStates(unfolded->getNumberOfStates(), true);
+    EXPECT_EQ(allStates, storm::utility::graph::getReachableStates(unfolded->getTransitionMatrix(), unfolded->getInitialStates(), allStates, ~allStates));
+}
@@ -0,0 +1,180 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "storm-server/ModelServer.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace {
+
+typedef storm::server::ModelServer::Json Json;
+
+// Waits (at most ten seconds) until the given condition holds.
+bool waitUntil(std::function<bool()> const& condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+/*!
+ * Runs a server in a separate thread, which is stopped via its termination flag.
+ */
+class ServerRunner {
+   public:
+    ServerRunner() : terminate(false), server(std::make_unique<storm::server::QueryScheduler>(2, boost::none, boost::none)) {
+        thread = std::thread([this]() {
+            storm::utility::resources::setThreadTerminationFlag(&terminate);
+            server.run(0);
+            storm::utility::resources::setThreadTerminationFlag(nullptr);
+        });
+    }
+
+    ~ServerRunner() {
+        terminate = true;
+        thread.join();
+    }
+
+    storm::server::ModelServer& getServer() {
+        return server;
+    }
+
+   private:
+    std::atomic<bool> terminate;
+    storm::server::ModelServer server;
+    std::thread thread;
+};
+
+/*!
+ * A client that sends one request at a time and waits for its response.
+ */
+class Client {
+   public:
+    explicit Client(uint16_t port) : socket(::socket(AF_INET, SOCK_STREAM, 0)), nextId(0) {
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        connected = ::connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    }
+
+    ~Client() {
+        close();
+    }
+
+    bool isConnected() const {
+        return connected;
+    }
+
+    void close() {
+        if (socket >= 0) {
+            ::close(socket);
+            socket = -1;
+        }
+    }
+
+    Json request(std::string const& method, Json const& parameters = Json::object()) {
+        Json message;
+        message["jsonrpc"] = "2.0";
+        message["id"] = nextId++;
+        message["method"] = method;
+        message["params"] = parameters;
+        std::string line = message.dump() + "\n";
+        EXPECT_EQ(static_cast<ssize_t>(line.size()), ::send(socket, line.data(), line.size(), MSG_NOSIGNAL));
+
+        std::size_t end;
+        while ((end = buffer.find('\n')) == std::string::npos) {
+            char data[4096];
+            ssize_t received = ::recv(socket, data, sizeof(data), 0);
+            if (received <= 0) {
+                return Json();
+            }
+            buffer.append(data, static_cast<std::size_t>(received));
+        }
+        Json response = Json::parse(buffer.substr(0, end));
+        buffer.erase(0, end + 1);
+        EXPECT_EQ(message["id"], response["id"]);
+        return response;
+    }
+
+   private:
+    int socket;
+    bool connected;
+    uint64_t nextId;
+    std::string buffer;
+};
+
+TEST(ModelServerTest, SessionLifetime) {
+    ServerRunner runner;
+    ASSERT_TRUE(waitUntil([&]() { return runner.getServer().getPort() != 0; }));
+    Client client(runner.getServer().getPort());
+    ASSERT_TRUE(client.isConnected());
+
+    Json parameters;
+    parameters["model"] = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    Json response = client.request("load", parameters);
+    ASSERT_EQ(1ull, response.count("result")) << response.dump();
+    uint64_t session = response["result"]["session"].get<uint64_t>();
+    EXPECT_EQ(13ull, response["result"]["states"].get<uint64_t>());
+
+    response = client.request("sessions");
+    ASSERT_EQ(1ull, response["result"].size());
+    EXPECT_EQ(session, response["result"][0]["session"].get<uint64_t>());
+
+    parameters = Json::object();
+    parameters["session"] = session;
+    parameters["properties"] = "P=? [F \"one\"]";
+    response = client.request("check", parameters);
+    ASSERT_EQ(1ull, response.count("result")) << response.dump();
+    EXPECT_NEAR(1.0 / 6.0, response["result"][0]["values"][0].get<double>(), 1e-6);
+
+    response = client.request("unload", parameters);
+    EXPECT_TRUE(response["result"].get<bool>());
+    response = client.request("sessions");
+    EXPECT_EQ(0ull, response["result"].size());
+
+    // The session is gone.
+    response = client.request("check", parameters);
+    ASSERT_EQ(1ull, response.count("error"));
+    EXPECT_EQ(-32602, response["error"]["code"].get<int64_t>());
+
+    response = client.request("unknown");
+    ASSERT_EQ(1ull, response.count("error"));
+    EXPECT_EQ(-32601, response["error"]["code"].get<int64_t>());
+}
+
+TEST(ModelServerTest, ConnectionsAreReaped) {
+    ServerRunner runner;
+    ASSERT_TRUE(waitUntil([&]() { return runner.getServer().getPort() != 0; }));
+    Client first(runner.getServer().getPort());
+    Client second(runner.getServer().getPort());
+    ASSERT_TRUE(first.isConnected());
+    ASSERT_TRUE(second.isConnected());
+    // A response ensures that the connections have been accepted.
+    EXPECT_EQ(1ull, first.request("sessions").count("result"));
+    EXPECT_EQ(1ull, second.request("sessions").count("result"));
+    EXPECT_EQ(2ull, runner.getServer().getNumberOfConnections());
+
+    first.close();
+    EXPECT_TRUE(waitUntil([&]() { return runner.getServer().getNumberOfConnections() == 1; }));
+    second.close();
+    EXPECT_TRUE(waitUntil([&]() { return runner.getServer().getNumberOfConnections() == 0; }));
+}
+
+}  // namespace
@@ -0,0 +1,46 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+
+#include "storm-server/ModelSession.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace {
+
+TEST(ModelSessionTest, CheckAndCache) {
+    storm::server::ModelSession session(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto information = session.getInformation();
+    EXPECT_EQ("dtmc", information["type"].get<std::string>());
+    EXPECT_EQ(13ull, information["states"].get<uint64_t>());
+    EXPECT_EQ(20ull, information["transitions"].get<uint64_t>());
+
+    auto results = session.check("P=? [F \"one\"]; R=? [F \"done\"]");
+    ASSERT_EQ(2ull, results.size());
+    ASSERT_EQ(1ull, results[0]["values"].size());
+    EXPECT_NEAR(1.0 / 6.0, results[0]["values"][0].get<double>(), 1e-6);
+    EXPECT_NEAR(11.0 / 3.0, results[1]["values"][0].get<double>(), 1e-6);
+
+    // The second check is answered from the cache.
+    results = session.check("P=? [F \"one\"]");
+    EXPECT_NEAR(1.0 / 6.0, results[0]["values"][0].get<double>(), 1e-6);
+    information = session.getInformation();
+    EXPECT_EQ(2ull, information["cached-results"].get<uint64_t>());
+    EXPECT_EQ(1ull, information["cache-hits"].get<uint64_t>());
+}
+
+TEST(ModelSessionTest, Cancellation) {
+    storm::server::ModelSession session(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::atomic<bool> terminate(true);
+    STORM_SILENT_EXPECT_THROW(session.check("P=? [F \"two\"]", &terminate), storm::exceptions::AbortException);
+    // The flag is only used for the aborted check.
+    EXPECT_FALSE(storm::utility::resources::isTerminate());
+
+    // Results of aborted checks are not cached.
+    EXPECT_EQ(0ull, session.getInformation()["cached-results"].get<uint64_t>());
+    auto results = session.check("P=? [F \"two\"]");
+    EXPECT_NEAR(1.0 / 6.0, results[0]["values"][0].get<double>(), 1e-6);
+}
+
+}  // namespace
@@ -0,0 +1,112 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+#include "storm-server/QueryScheduler.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+
+typedef storm::server::QueryScheduler QueryScheduler;
+
+// Waits (at most ten seconds) until the given condition holds.
+bool waitUntil(std::function<bool()> const& condition) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+TEST(QuerySchedulerTest, Scheduling) {
+    QueryScheduler scheduler(2, boost::none, boost::none);
+    std::atomic<bool> release(false);
+    std::atomic<uint64_t> finishedQueries(0);
+    for (uint64_t query = 0; query < 5; ++query) {
+        scheduler.submit([&](QueryScheduler::Cancellation const& cancellation) {
+            waitUntil([&]() { return release.load(); });
+            EXPECT_FALSE(cancellation.isCancelled());
+            ++finishedQueries;
+        });
+    }
+
+    // Only two queries run at the same time.
+    ASSERT_TRUE(waitUntil([&]() { return scheduler.getNumberOfRunningQueries() == 2; }));
+    EXPECT_EQ(3ull, scheduler.getNumberOfPendingQueries());
+    EXPECT_EQ(0ull, finishedQueries.load());
+
+    release = true;
+    ASSERT_TRUE(waitUntil([&]() { return finishedQueries.load() == 5; }));
+    ASSERT_TRUE(waitUntil([&]() { return scheduler.getNumberOfRunningQueries() == 0; }));
+    EXPECT_EQ(0ull, scheduler.getNumberOfPendingQueries());
+}
+
+TEST(QuerySchedulerTest, ExceptionsDoNotStopWorkers) {
+    QueryScheduler scheduler(1, boost::none, boost::none);
+    std::atomic<bool> done(false);
+    scheduler.submit([](QueryScheduler::Cancellation const&) { throw std::runtime_error("failing query"); });
+    scheduler.submit([&](QueryScheduler::Cancellation const&) { done = true; });
+    EXPECT_TRUE(waitUntil([&]() { return done.load(); }));
+}
+
+TEST(QuerySchedulerTest, Timeout) {
+    QueryScheduler scheduler(2, std::chrono::seconds(1), boost::none);
+    std::atomic<bool> done(false);
+    std::atomic<QueryScheduler::AbortReason> reason(QueryScheduler::AbortReason::None);
+    std::atomic<uint64_t> terminatedChunks(0);
+    scheduler.submit([&](QueryScheduler::Cancellation const& cancellation) {
+        // The helper threads have to notice the termination of this query as well.
+        storm::utility::parallel::forEachChunk(0, 4, 1, 4, [&](uint64_t, uint64_t, uint64_t) {
+            if (waitUntil([]() { return storm::utility::resources::isTerminate(); })) {
+                ++terminatedChunks;
+            }
+        });
+        EXPECT_TRUE(cancellation.isCancelled());
+        EXPECT_TRUE(cancellation.getTerminationFlag().load());
+        reason = cancellation.getAbortReason();
+        done = true;
+    });
+
+    // Queries that are not affected by the timeout continue.
+    std::atomic<bool> otherDone(false);
+    scheduler.submit([&](QueryScheduler::Cancellation const& cancellation) {
+        EXPECT_FALSE(storm::utility::resources::isTerminate());
+        EXPECT_EQ(QueryScheduler::AbortReason::None, cancellation.getAbortReason());
+        otherDone = true;
+    });
+
+    ASSERT_TRUE(waitUntil([&]() { return done.load() && otherDone.load(); }));
+    EXPECT_EQ(QueryScheduler::AbortReason::Timeout, reason.load());
+    EXPECT_EQ(4ull, terminatedChunks.load());
+}
+
+TEST(QuerySchedulerTest, Shutdown) {
+    std::atomic<bool> started(false);
+    std::atomic<QueryScheduler::AbortReason> reason(QueryScheduler::AbortReason::None);
+    std::atomic<bool> pendingQueryRun(false);
+    {
+        QueryScheduler scheduler(1, boost::none, boost::none);
+        scheduler.submit([&](QueryScheduler::Cancellation const& cancellation) {
+            started = true;
+            waitUntil([]() { return storm::utility::resources::isTerminate(); });
+            reason = cancellation.getAbortReason();
+        });
+        scheduler.submit([&](QueryScheduler::Cancellation const&) { pendingQueryRun = true; });
+        ASSERT_TRUE(waitUntil([&]() { return started.load(); }));
+        EXPECT_EQ(1ull, scheduler.getNumberOfPendingQueries());
+    }
+    EXPECT_EQ(QueryScheduler::AbortReason::Shutdown, reason.load());
+    EXPECT_FALSE(pendingQueryRun.load());
+    // The termination flag of a query is only installed while it runs.
+    EXPECT_FALSE(storm::utility::resources::isTerminate());
+}
+
+}  // namespace
@@ -0,0 +1,65 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/logic/AtomicLabelFormula.h"
+#include "storm/logic/EventuallyFormula.h"
+
+namespace {
+// Creates a fake ltl2da tool that counts its invocations and returns a fixed automaton.
+std::string createCountingTool(std::filesystem::path const& directory) {
+    std::filesystem::create_directories(directory);
+    std::string script = (directory / "ltl2da.sh").string();
+    std::ofstream out(script);
+    out << "#!/bin/sh\n"
+        << "echo call >> '" << (directory / "calls").string() << "'\n"
+        << "cp '" << STORM_TEST_RESOURCES_DIR "/hoa/automaton_UXp0p1.hoa' \"$2\"\n";
+    out.close();
+    std::filesystem::permissions(script, std::filesystem::perms::owner_all);
+    return script;
+}
+
+uint64_t countCalls(std::filesystem::path const& directory) {
+    std::ifstream in((directory / "calls").string());
+    uint64_t result = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        ++result;
+    }
+    return result;
+}
+}  // namespace
+
+TEST(LTL2DeterministicAutomatonTest, CachedTranslation) {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "storm_ltl2da_cache_test";
+    std::filesystem::remove_all(directory);
+    std::string tool = createCountingTool(directory);
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+
+    auto formula = std::make_shared<storm::logic::EventuallyFormula>(std::make_shared<storm::logic::AtomicLabelFormula>("p0"));
+    auto sameFormula = std::make_shared<storm::logic::EventuallyFormula>(std::make_shared<storm::logic::AtomicLabelFormula>("p0"));
+
+    storm::automata::DeterministicAutomaton::ptr da = storm::automata::LTL2DeterministicAutomaton::ltl2da(*formula, false, tool);
+    EXPECT_EQ(4ull, da->getNumberOfStates());
+    EXPECT_EQ(da, storm::automata::LTL2DeterministicAutomaton::ltl2da(*sameFormula, false, tool));
+    EXPECT_EQ(1ull, countCalls(directory));
+
+    // A pre-translated formula is translated only once as well.
+    auto otherFormula = std::make_shared<storm::logic::EventuallyFormula>(std::make_shared<storm::logic::AtomicLabelFormula>("p1"));
+    storm::automata::LTL2DeterministicAutomaton::startTranslation(otherFormula, false, tool);
+    storm::automata::DeterministicAutomaton::ptr otherDa = storm::automata::LTL2DeterministicAutomaton::ltl2da(*otherFormula, false, tool);
+    EXPECT_NE(da, otherDa);
+    EXPECT_EQ(2ull, countCalls(directory));
+
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+    storm::automata::LTL2DeterministicAutomaton::ltl2da(*formula, false, tool);
+    EXPECT_EQ(3ull, countCalls(directory));
+
+    storm::automata::LTL2DeterministicAutomaton::clearCache();
+    std::filesystem::remove_all(directory);
+}
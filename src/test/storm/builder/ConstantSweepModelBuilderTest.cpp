@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ConstantSweepModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace {
+void expectSameModel(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfTransitions(), actual.getNumberOfTransitions());
+    auto actualEntryIt = actual.getTransitionMatrix().begin();
+    for (auto const& expectedEntry : expected.getTransitionMatrix()) {
+        EXPECT_EQ(expectedEntry.getColumn(), actualEntryIt->getColumn());
+        EXPECT_NEAR(expectedEntry.getValue(), actualEntryIt->getValue(), 1e-12);
+        ++actualEntryIt;
+    }
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+}  // namespace
+
+TEST(ConstantSweepModelBuilderTest, Instantiate) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+    storm::storage::SymbolicModelDescription description(program);
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+    options.setBuildAllLabels();
+
+    storm::builder::ConstantSweepModelBuilder<double> builder(description, options);
+    EXPECT_TRUE(builder.isInstantiating());
+
+    for (std::string const& definition : {"p=0.5", "p=0.3", "p=0.9"}) {
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build(definition);
+        storm::prism::Program expectedProgram = description.preprocess(definition).asPrismProgram();
+        auto expectedModel = storm::builder::ExplicitModelBuilder<double>(expectedProgram, options).build();
+        expectSameModel(*expectedModel, *model);
+    }
+    EXPECT_EQ(1ul, builder.getNumberOfBuiltModels());
+    EXPECT_EQ(3ul, builder.getNumberOfInstantiatedModels());
+
+    // Transitions vanish for p=0, so the model is built from scratch.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build("p=0");
+    storm::prism::Program expectedProgram = description.preprocess("p=0").asPrismProgram();
+    auto expectedModel = storm::builder::ExplicitModelBuilder<double>(expectedProgram, options).build();
+    expectSameModel(*expectedModel, *model);
+    EXPECT_EQ(2ul, builder.getNumberOfBuiltModels());
+    EXPECT_EQ(3ul, builder.getNumberOfInstantiatedModels());
+}
+
+TEST(ConstantSweepModelBuilderTest, Rebuild) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm");
+    storm::storage::SymbolicModelDescription description(program);
+    storm::builder::BuilderOptions options;
+
+    // The crowd size influences the structure of the model.
+    storm::builder::ConstantSweepModelBuilder<double> builder(description, options);
+    EXPECT_FALSE(builder.isInstantiating());
+
+    for (std::string const& definition : {"CrowdSize=2", "CrowdSize=4"}) {
+        std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build(definition);
+        storm::prism::Program expectedProgram = description.preprocess(definition).asPrismProgram();
+        auto expectedModel = storm::builder::ExplicitModelBuilder<double>(expectedProgram, options).build();
+        expectSameModel(*expectedModel, *model);
+    }
+    EXPECT_EQ(2ul, builder.getNumberOfBuiltModels());
+    EXPECT_EQ(0ul, builder.getNumberOfInstantiatedModels());
+
+    STORM_SILENT_EXPECT_THROW(builder.build(""), storm::exceptions::InvalidArgumentException);
+}
@@ -0,0 +1,48 @@
+#include "storm-config.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "test/storm_gtest.h"
+
+TEST(DdVariableOrderingTest, ForceOnChain) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable x0 = manager.declareBooleanVariable("x0");
+    storm::expressions::Variable x1 = manager.declareBooleanVariable("x1");
+    storm::expressions::Variable x2 = manager.declareBooleanVariable("x2");
+    storm::expressions::Variable x3 = manager.declareBooleanVariable("x3");
+    storm::expressions::Variable unrelated = manager.declareBooleanVariable("unrelated");
+
+    // The variables form the chain x0 - x1 - x2 - x3, but are declared in an order that separates neighbours.
+    std::vector<std::set<storm::expressions::Variable>> hyperedges = {{x0, x1}, {x1, x2}, {x2, x3}, {unrelated}};
+    std::vector<storm::expressions::Variable> order = storm::builder::computeForceOrder({x0, x3, unrelated, x1, x2}, hyperedges);
+
+    ASSERT_EQ(5ul, order.size());
+    auto positionOf = [&order](storm::expressions::Variable const& variable) {
+        return static_cast<int64_t>(std::distance(order.begin(), std::find(order.begin(), order.end(), variable)));
+    };
+    EXPECT_LT(positionOf(unrelated), 5);
+    int64_t span = std::abs(positionOf(x0) - positionOf(x1)) + std::abs(positionOf(x1) - positionOf(x2)) + std::abs(positionOf(x2) - positionOf(x3));
+    // The initial order has a total span of 7. An optimal order only requires 3 plus possibly one for the unrelated variable in between.
+    EXPECT_LE(span, 4);
+}
+
+TEST(DdVariableOrderingTest, InteractingPrismVariables) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+
+    std::vector<std::set<storm::expressions::Variable>> hyperedges = storm::builder::getInteractingVariables(program);
+    // One set per command, die.pm has no synchronizing actions.
+    EXPECT_EQ(program.getNumberOfCommands(), hyperedges.size());
+    std::set<storm::expressions::Variable> allVariables = program.getAllExpressionVariables();
+    for (auto const& hyperedge : hyperedges) {
+        EXPECT_FALSE(hyperedge.empty());
+        for (auto const& variable : hyperedge) {
+            EXPECT_EQ(1ul, allVariables.count(variable));
+        }
+    }
+}
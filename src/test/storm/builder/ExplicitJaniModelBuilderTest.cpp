@@ -1,7 +1,9 @@
 #include "storm-config.h"
 #include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/parser/FormulaParser.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/storm.h"
+#include "storm/builder/CompositionalJaniModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/generator/JaniNextStateGenerator.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -204,3 +206,35 @@ TEST(ExplicitJaniModelBuilderTest, enumerateInitial) {
     EXPECT_EQ(145ul, model->getNumberOfTransitions());
     EXPECT_EQ(72ul, model->getInitialStates().getNumberOfSetBits());
 }
+
+TEST(ExplicitJaniModelBuilderTest, Compositional) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/independent_processes_local.nm");
+    storm::jani::Model janiModel = program.toJani(false);
+    storm::parser::FormulaParser formulaParser(program);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("Pmax=? [!d2 U d1]"),
+                                                                          formulaParser.parseSingleFormulaFromString("Pmin=? [!d2 U d1]")};
+
+    auto flatModel = storm::api::buildSparseModel<double>(janiModel, formulas);
+    storm::builder::CompositionalJaniModelBuilder<double> builder(janiModel, formulas);
+    auto compositionalModel = builder.build();
+
+    // The third process is not observed, so its final states are merged before it is composed.
+    EXPECT_EQ(125ul, flatModel->getNumberOfStates());
+    EXPECT_LT(builder.getPeakNumberOfStates(), flatModel->getNumberOfStates());
+    EXPECT_LT(compositionalModel->getNumberOfStates(), flatModel->getNumberOfStates());
+
+    std::vector<double> expectedResults = {0.8, 0.2 * 0.8};
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        auto task = storm::api::createTask<double>(formulas[formulaIndex], true);
+        auto flatResult = storm::api::verifyWithSparseEngine<double>(flatModel, task);
+        auto compositionalResult = storm::api::verifyWithSparseEngine<double>(compositionalModel, task);
+        EXPECT_NEAR(expectedResults[formulaIndex], flatResult->asExplicitQuantitativeCheckResult<double>()[*flatModel->getInitialStates().begin()], 1e-6);
+        EXPECT_NEAR(expectedResults[formulaIndex],
+                    compositionalResult->asExplicitQuantitativeCheckResult<double>()[*compositionalModel->getInitialStates().begin()], 1e-6);
+    }
+
+    // Atomic expressions that refer to several automata can not be preserved.
+    auto spanningFormula = formulaParser.parseSingleFormulaFromString("Pmax=? [F d1 & d2]");
+    STORM_SILENT_EXPECT_THROW(storm::builder::CompositionalJaniModelBuilder<double>(janiModel, {spanningFormula}).build(),
+                              storm::exceptions::NotSupportedException);
+}
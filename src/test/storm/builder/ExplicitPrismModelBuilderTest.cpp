@@ -1,10 +1,23 @@
 #include <storm/generator/PrismNextStateGenerator.h>
+#include <filesystem>
 #include "storm-config.h"
+#include "storm-parsers/parser/FormulaParser.h"
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/builder.h"
+#include "storm/api/verification.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/MemoryLimitExceededException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/VariableRangeExceededException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/generator/VariableRangeAnalysis.h"
+#include "storm/logic/Formulas.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
 #include "test/storm_gtest.h"
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -35,6 +48,57 @@ TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitPrismModelBuilderTest, TerminalStatesForMultipleFormulas) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> reachThree = formulaParser.parseSingleFormulaFromString("P=? [F s>=3]");
+    std::shared_ptr<storm::logic::Formula const> reachFour = formulaParser.parseSingleFormulaFromString("P=? [F s>=4]");
+    std::shared_ptr<storm::logic::Formula const> globally = formulaParser.parseSingleFormulaFromString("P=? [G s<7]");
+
+    // Exploration stops at the states with s>=3.
+    storm::builder::BuilderOptions options({reachThree}, program);
+    EXPECT_EQ(7ul, storm::builder::ExplicitModelBuilder<double>(program, options).build()->getNumberOfStates());
+
+    // Exploration only stops at states that are terminal for both formulas, i.e. the states with s>=4.
+    options = storm::builder::BuilderOptions({reachThree, reachFour}, program);
+    EXPECT_EQ(8ul, storm::builder::ExplicitModelBuilder<double>(program, options).build()->getNumberOfStates());
+
+    // The third formula requires the full model.
+    options = storm::builder::BuilderOptions({reachThree, reachFour, globally}, program);
+    EXPECT_FALSE(options.hasTerminalStates());
+    EXPECT_EQ(13ul, storm::builder::ExplicitModelBuilder<double>(program, options).build()->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialExploration) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    builderOptions.explorationBudget = 3;
+    storm::builder::ExplicitModelBuilder<double> builder(program, storm::generator::NextStateGeneratorOptions(), builderOptions);
+
+    // Only the first two layers are expanded, the successors of the second layer remain unexplored.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_TRUE(builder.hasUnexploredStates());
+    EXPECT_EQ(4ul, model->getStates(storm::builder::ExplicitModelBuilder<double>::getUnexploredLabel()).getNumberOfSetBits());
+
+    // Lifting the budget continues the exploration.
+    builder.setExplorationBudget(0);
+    model = builder.build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+    EXPECT_FALSE(builder.hasUnexploredStates());
+    EXPECT_TRUE(model->getStates(storm::builder::ExplicitModelBuilder<double>::getUnexploredLabel()).empty());
+
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F s=7&d=2]");
+    std::pair<double, double> bounds =
+        storm::api::computeBoundsWithPartialExploration<double>(storm::Environment(), program, formula, 1e-6, static_cast<uint64_t>(3));
+    EXPECT_LE(bounds.first, bounds.second);
+    EXPECT_NEAR(1.0 / 6.0, bounds.first, 1e-6);
+    EXPECT_NEAR(1.0 / 6.0, bounds.second, 1e-6);
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ctmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
 
@@ -218,3 +282,409 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getInitialStates(), parallelModel->getInitialStates()) << file;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExplorationParametric) {
+    // Rational functions can not be created concurrently, so the exploration falls back to a sequential one.
+    EXPECT_TRUE(storm::builder::ExplicitModelBuilder<double>::supportsConcurrentValueConstruction());
+    EXPECT_FALSE(storm::builder::ExplicitModelBuilder<storm::RationalFunction>::supportsConcurrentValueConstruction());
+
+    storm::builder::ExplicitModelBuilder<storm::RationalFunction>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<storm::RationalFunction>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    auto sequentialModel = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, generatorOptions, sequentialOptions).build();
+    auto parallelModel = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, generatorOptions, parallelOptions).build();
+    EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+}
+
+TEST(ExplicitPrismModelBuilderTest, ParallelModelComponents) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    parallelOptions.releaseStateStorage = true;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    generatorOptions.setBuildChoiceLabels();
+    generatorOptions.setBuildStateValuations();
+
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::utility::parallel::setDefaultNumberOfThreads(1);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+
+        // The labels are also evaluated with several threads.
+        storm::utility::parallel::setDefaultNumberOfThreads(4);
+        storm::builder::ExplicitModelBuilder<double> parallelBuilder(program, generatorOptions, parallelOptions);
+        auto parallelModel = parallelBuilder.build();
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling()) << file;
+        EXPECT_TRUE(sequentialModel->getChoiceLabeling() == parallelModel->getChoiceLabeling()) << file;
+        EXPECT_EQ(sequentialModel->getStateValuations().getNumberOfStates(), parallelModel->getStateValuations().getNumberOfStates()) << file;
+        ASSERT_EQ(sequentialModel->getRewardModels().size(), parallelModel->getRewardModels().size()) << file;
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards()) << file;
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards()) << file;
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector()) << file;
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+
+        // The explored states were released.
+        STORM_SILENT_EXPECT_THROW(parallelBuilder.exportExplicitStateLookup(), storm::exceptions::NotSupportedException);
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
+TEST(ExplicitPrismModelBuilderTest, ExternalExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options inMemoryOptions;
+    inMemoryOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    inMemoryOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options externalOptions = inMemoryOptions;
+    externalOptions.externalExplorationDirectory = std::filesystem::temp_directory_path().string();
+    // Use very little memory such that the candidates of a layer are spread over several runs.
+    externalOptions.externalExplorationMemoryLimit = 4096;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (std::string const& file : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto inMemoryModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, inMemoryOptions).build();
+        auto externalModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, externalOptions).build();
+        EXPECT_EQ(inMemoryModel->getNumberOfStates(), externalModel->getNumberOfStates()) << file;
+        EXPECT_TRUE(inMemoryModel->getTransitionMatrix() == externalModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(inMemoryModel->getStateLabeling() == externalModel->getStateLabeling()) << file;
+        EXPECT_EQ(inMemoryModel->getInitialStates(), externalModel->getInitialStates()) << file;
+        for (auto const& nameRewardModelPair : inMemoryModel->getRewardModels()) {
+            auto const& externalRewardModel = externalModel->getRewardModel(nameRewardModelPair.first);
+            EXPECT_EQ(nameRewardModelPair.second.hasStateRewards(), externalRewardModel.hasStateRewards()) << file;
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), externalRewardModel.getStateRewardVector()) << file;
+            }
+            EXPECT_EQ(nameRewardModelPair.second.hasStateActionRewards(), externalRewardModel.hasStateActionRewards()) << file;
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), externalRewardModel.getStateActionRewardVector()) << file;
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, MinimizingExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options plainOptions;
+    plainOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    plainOptions.numberOfThreads = 1;
+    plainOptions.bisimulationInterval = 0;
+    storm::builder::ExplicitModelBuilder<double>::Options minimizingOptions = plainOptions;
+    // Use an interval that does not divide the number of states such that closed states of several minimizations are merged.
+    minimizingOptions.bisimulationInterval = 97;
+
+    std::vector<std::pair<std::string, std::string>> filesAndFormulas = {{"/dtmc/crowds-5-5.pm", "P=? [F \"observe0Greater1\"]"},
+                                                                         {"/ctmc/embedded2.sm", "R{\"up\"}=? [C<=3600]"}};
+    for (auto const& fileAndFormula : filesAndFormulas) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileAndFormula.first, true);
+        storm::parser::FormulaParser formulaParser(program);
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(fileAndFormula.second);
+        storm::builder::BuilderOptions generatorOptions({formula}, program);
+
+        auto plainModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, plainOptions).build();
+        auto minimizedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, minimizingOptions).build();
+        EXPECT_EQ(plainModel->getType(), minimizedModel->getType()) << fileAndFormula.first;
+        EXPECT_LE(minimizedModel->getNumberOfStates(), plainModel->getNumberOfStates()) << fileAndFormula.first;
+        EXPECT_EQ(plainModel->getInitialStates().getNumberOfSetBits(), minimizedModel->getInitialStates().getNumberOfSetBits()) << fileAndFormula.first;
+
+        auto plainResult = storm::api::verifyWithSparseEngine<double>(plainModel, storm::api::createTask<double>(formula, true));
+        auto minimizedResult = storm::api::verifyWithSparseEngine<double>(minimizedModel, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(plainResult->asExplicitQuantitativeCheckResult<double>()[*plainModel->getInitialStates().begin()],
+                    minimizedResult->asExplicitQuantitativeCheckResult<double>()[*minimizedModel->getInitialStates().begin()], 1e-6)
+            << fileAndFormula.first;
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, StateCompression) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+
+    for (auto explorationOrder : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+        storm::builder::ExplicitModelBuilder<double>::Options uncompressedOptions;
+        uncompressedOptions.explorationOrder = explorationOrder;
+        uncompressedOptions.numberOfThreads = 1;
+        uncompressedOptions.stateCompression = false;
+        storm::builder::ExplicitModelBuilder<double>::Options compressedOptions = uncompressedOptions;
+        compressedOptions.stateCompression = true;
+
+        for (std::string const& file : {"/dtmc/leader-3-5.pm", "/mdp/csma2-2.nm", "/mdp/two_dice.nm", "/ma/stream2.ma"}) {
+            storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+            auto uncompressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, uncompressedOptions).build();
+            auto compressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedOptions).build();
+            EXPECT_EQ(uncompressedModel->getNumberOfStates(), compressedModel->getNumberOfStates()) << file;
+            EXPECT_TRUE(uncompressedModel->getTransitionMatrix() == compressedModel->getTransitionMatrix()) << file;
+            EXPECT_TRUE(uncompressedModel->getStateLabeling() == compressedModel->getStateLabeling()) << file;
+            EXPECT_EQ(uncompressedModel->getInitialStates(), compressedModel->getInitialStates()) << file;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"finished\" & \"all_coins_equal_1\"]");
+
+    storm::builder::BuilderOptions options({formula}, program);
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.setSymmetryReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    // The two processes are symmetric, so (almost) every state has a symmetric counterpart.
+    EXPECT_LT(reducedModel->getNumberOfStates(), fullModel->getNumberOfStates());
+    EXPECT_GE(2 * reducedModel->getNumberOfStates(), fullModel->getNumberOfStates());
+
+    auto fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, storm::api::createTask<double>(formula, true));
+    auto reducedResult = storm::api::verifyWithSparseEngine<double>(reducedModel, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(fullResult->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()],
+                reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6);
+
+    // A label that distinguishes the processes prevents the reduction.
+    options.addLabel(program.getManager().getVariableExpression("pc1") == program.getManager().integer(3));
+    auto unreducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(fullModel->getNumberOfStates(), unreducedModel->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, VariableRangeAnalysis) {
+    std::string programString = R"(dtmc
+const int N = 1000;
+module counter
+  x : [0..N] init 0;
+  c : [0..N] init 0;
+  k : [0..N] init 5;
+  y : int init 0;
+  [] x<3 -> 0.5:(x'=x+1) + 0.5:(c'=mod(c+1, 4));
+  [] x=3 -> (x'=0) & (k'=5) & (y'=max(y-1, 0));
+endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "testfile").substituteConstantsFormulas();
+    auto ranges = storm::generator::computeIntegerVariableRanges(program, 32);
+    auto& manager = program.getManager();
+    EXPECT_EQ(std::make_pair(0l, 3l), ranges.at(manager.getVariable("x")));
+    EXPECT_EQ(std::make_pair(0l, 3l), ranges.at(manager.getVariable("c")));
+    EXPECT_EQ(std::make_pair(5l, 5l), ranges.at(manager.getVariable("k")));
+    EXPECT_EQ(std::make_pair(0l, 0l), ranges.at(manager.getVariable("y")));
+
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    EXPECT_EQ(62ul, storm::generator::PrismNextStateGenerator<double>(program, options).getVariableInformation().getTotalBitOffset());
+    options.setVariableRangeAnalysis();
+    EXPECT_EQ(4ul, storm::generator::PrismNextStateGenerator<double>(program, options).getVariableInformation().getTotalBitOffset());
+
+    // The narrowed encoding does not change the built model.
+    for (std::string const& file : {"/dtmc/leader-3-5.pm", "/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-4.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::generator::NextStateGeneratorOptions declaredOptions;
+        declaredOptions.setBuildAllLabels();
+        storm::generator::NextStateGeneratorOptions narrowedOptions = declaredOptions;
+        narrowedOptions.setVariableRangeAnalysis();
+        auto declaredModel = storm::builder::ExplicitModelBuilder<double>(program, declaredOptions).build();
+        auto narrowedModel = storm::builder::ExplicitModelBuilder<double>(program, narrowedOptions).build();
+        EXPECT_EQ(declaredModel->getNumberOfStates(), narrowedModel->getNumberOfStates()) << file;
+        EXPECT_TRUE(declaredModel->getTransitionMatrix() == narrowedModel->getTransitionMatrix()) << file;
+        EXPECT_TRUE(declaredModel->getStateLabeling() == narrowedModel->getStateLabeling()) << file;
+    }
+
+    // Updates that leave the declared bounds also leave the narrowed ones, in which case the model is rebuilt with the declared bounds.
+    programString = R"(dtmc
+module m
+  y : [-10..10] init 0;
+  [] y<5 -> (y'=y+20);
+  [] y>=5 -> true;
+endmodule
+)";
+    program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+    storm::generator::NextStateGeneratorOptions narrowedOptions;
+    narrowedOptions.setVariableRangeAnalysis();
+    narrowedOptions.setExplorationChecks();
+    STORM_SILENT_EXPECT_THROW(storm::builder::ExplicitModelBuilder<double>(program, narrowedOptions).build(),
+                              storm::exceptions::VariableRangeExceededException);
+    STORM_SILENT_EXPECT_THROW(storm::api::buildSparseModel<double>(program, narrowedOptions), storm::exceptions::WrongFormatException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardTable) {
+    for (std::string const& file : {"/dtmc/leader-3-5.pm", "/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-4.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        storm::generator::NextStateGeneratorOptions uncachedOptions;
+        uncachedOptions.setBuildAllLabels();
+        uncachedOptions.setMaximalGuardTableBits(0);
+        auto uncachedModel = storm::builder::ExplicitModelBuilder<double>(program, uncachedOptions).build();
+
+        // Use few bits such that some guards are cached and others are not.
+        for (uint64_t bits : {4ull, 16ull}) {
+            storm::generator::NextStateGeneratorOptions cachedOptions = uncachedOptions;
+            cachedOptions.setMaximalGuardTableBits(bits);
+            auto cachedModel = storm::builder::ExplicitModelBuilder<double>(program, cachedOptions).build();
+            EXPECT_EQ(uncachedModel->getNumberOfStates(), cachedModel->getNumberOfStates()) << file;
+            EXPECT_TRUE(uncachedModel->getTransitionMatrix() == cachedModel->getTransitionMatrix()) << file;
+            EXPECT_TRUE(uncachedModel->getStateLabeling() == cachedModel->getStateLabeling()) << file;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardBatches) {
+    storm::builder::ExplicitModelBuilder<double>::Options unbatchedOptions;
+    unbatchedOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    unbatchedOptions.numberOfThreads = 1;
+    unbatchedOptions.guardBatchSize = 0;
+
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setMaximalGuardTableBits(0);
+
+    for (std::string const& file : {"/dtmc/leader-3-5.pm", "/dtmc/brp-16-2.pm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-4.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + file, true);
+        auto unbatchedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, unbatchedOptions).build();
+
+        // Use batch sizes that do not divide the sizes of the layers, also when expanding the states in parallel.
+        for (uint64_t threads : {1ull, 4ull}) {
+            storm::builder::ExplicitModelBuilder<double>::Options batchedOptions = unbatchedOptions;
+            batchedOptions.numberOfThreads = threads;
+            batchedOptions.guardBatchSize = 37;
+            auto batchedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, batchedOptions).build();
+            EXPECT_EQ(unbatchedModel->getNumberOfStates(), batchedModel->getNumberOfStates()) << file;
+            EXPECT_TRUE(unbatchedModel->getTransitionMatrix() == batchedModel->getTransitionMatrix()) << file;
+            EXPECT_TRUE(unbatchedModel->getStateLabeling() == batchedModel->getStateLabeling()) << file;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, Labels) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    for (std::string const& label : {"one", "two", "three"}) {
+        EXPECT_EQ(1ul, model->getStates(label).getNumberOfSetBits()) << label;
+    }
+    EXPECT_EQ(6ul, model->getStates("done").getNumberOfSetBits());
+
+    // Only the requested labels are built.
+    storm::generator::NextStateGeneratorOptions restrictedOptions;
+    restrictedOptions.addLabel("done");
+    auto restrictedModel = storm::builder::ExplicitModelBuilder<double>(program, restrictedOptions).build();
+    EXPECT_TRUE(restrictedModel->hasLabel("done"));
+    EXPECT_FALSE(restrictedModel->hasLabel("one"));
+    EXPECT_EQ(model->getStates("done"), restrictedModel->getStates("done"));
+}
+
+TEST(ExplicitPrismModelBuilderTest, LazyStateInformation) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions referenceOptions;
+    referenceOptions.setBuildStateValuations();
+    referenceOptions.setBuildChoiceOrigins();
+    auto referenceModel = storm::builder::ExplicitModelBuilder<double>(program, referenceOptions).build();
+    ASSERT_TRUE(referenceModel->hasStateValuations());
+    ASSERT_TRUE(referenceModel->hasChoiceOrigins());
+
+    storm::builder::ExplicitModelBuilder<double> builder(program);
+    auto model = builder.build();
+    EXPECT_FALSE(model->hasStateValuations());
+    EXPECT_FALSE(model->hasChoiceOrigins());
+    auto stateInformation = builder.exportLazyStateInformation();
+    ASSERT_EQ(model->getNumberOfStates(), stateInformation.getNumberOfStates());
+    ASSERT_EQ(referenceModel->getNumberOfStates(), model->getNumberOfStates());
+
+    auto const& rowGroupIndices = model->getTransitionMatrix().getRowGroupIndices();
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        auto valuation = stateInformation.getStateValuation(state);
+        for (auto const& module : program.getModules()) {
+            for (auto const& variable : module.getIntegerVariables()) {
+                EXPECT_EQ(referenceModel->getStateValuations().getIntegerValue(state, variable.getExpressionVariable()),
+                          valuation.getIntegerValue(variable.getExpressionVariable()))
+                    << "state " << state;
+            }
+        }
+        auto choiceOrigins = stateInformation.getChoiceOrigins(state);
+        ASSERT_EQ(rowGroupIndices[state + 1] - rowGroupIndices[state], choiceOrigins->getNumberOfChoices());
+        for (uint64_t choice = 0; choice < choiceOrigins->getNumberOfChoices(); ++choice) {
+            EXPECT_EQ(referenceModel->getChoiceOrigins()->getChoiceInfo(rowGroupIndices[state] + choice), choiceOrigins->getChoiceInfo(choice))
+                << "state " << state;
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/independent_processes.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("Pmax=? [F \"first\"]"),
+                                                                          formulaParser.parseSingleFormulaFromString("Pmin=? [F \"first\"]")};
+
+    storm::builder::BuilderOptions options(formulas, program);
+    auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.setPartialOrderReduction();
+    auto reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    // The local steps of the processes are only explored in one order.
+    EXPECT_EQ(125ul, fullModel->getNumberOfStates());
+    EXPECT_LT(reducedModel->getNumberOfStates(), fullModel->getNumberOfStates());
+
+    std::vector<double> expectedResults = {0.8, 0.04 * 0.8};
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        auto task = storm::api::createTask<double>(formulas[formulaIndex], true);
+        auto fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, task);
+        auto reducedResult = storm::api::verifyWithSparseEngine<double>(reducedModel, task);
+        EXPECT_NEAR(expectedResults[formulaIndex], fullResult->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()], 1e-6);
+        EXPECT_NEAR(expectedResults[formulaIndex], reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6);
+    }
+
+    // If the local steps are visible, they can not be reduced.
+    auto& manager = program.getManager();
+    options.addLabel(manager.getVariableExpression("s1") == manager.integer(1) || manager.getVariableExpression("s2") == manager.integer(1) ||
+                     manager.getVariableExpression("s3") == manager.integer(1));
+    auto unreducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(fullModel->getNumberOfStates(), unreducedModel->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, MemoryLimit) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+
+    // With a memory limit that can not be met, the exploration is aborted cleanly.
+    storm::utility::memory::setMemoryLimit(1);
+    EXPECT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::MemoryLimitExceededException);
+
+    storm::utility::memory::setMemoryLimit(0);
+    auto model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+}
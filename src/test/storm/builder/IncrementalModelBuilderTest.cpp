@@ -0,0 +1,102 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <map>
+#include <string>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/builder/IncrementalModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateValuations.h"
+
+namespace {
+// The transitions and state rewards of a model (with state valuations), identified by the valuations of the states. This does not depend on the
+// order of the states.
+std::map<std::string, std::pair<double, std::map<std::string, double>>> describe(storm::models::sparse::Model<double> const& model) {
+    std::map<std::string, std::pair<double, std::map<std::string, double>>> result;
+    auto const& valuations = model.getStateValuations();
+    for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+        auto& entry = result[valuations.toString(state)];
+        entry.first = model.getRewardModel("steps").getStateReward(state);
+        for (auto const& transition : model.getTransitionMatrix().getRowGroup(state)) {
+            entry.second[valuations.toString(transition.getColumn())] += transition.getValue();
+        }
+    }
+    return result;
+}
+
+storm::prism::Program parse(std::string const& commands) {
+    std::string programString =
+        "dtmc\n"
+        "const int N = 10;\n"
+        "module counter\n"
+        "    x : [0..10] init 0;\n" +
+        commands +
+        "endmodule\n"
+        "label \"done\" = x=N;\n"
+        "rewards \"steps\"\n"
+        "    x<N : 1;\n"
+        "endrewards\n";
+    return storm::parser::PrismParser::parseFromString(programString, "testfile");
+}
+}  // namespace
+
+TEST(IncrementalModelBuilderTest, Dtmc) {
+    storm::builder::BuilderOptions options(true, true);
+    storm::builder::IncrementalModelBuilder<double> builder(options);
+    storm::builder::BuilderOptions fullOptions = options;
+    fullOptions.setBuildStateValuations(true);
+
+    storm::prism::Program program = parse(
+        "    [] x<N -> 0.5:(x'=x+1) + 0.5:(x'=0);\n"
+        "    [] x=N -> true;\n");
+    auto model = builder.build(program);
+    EXPECT_FALSE(builder.wasLastBuildIncremental());
+    EXPECT_EQ(11ul, model->getNumberOfStates());
+
+    // Changing a command only expands the states in which it is enabled.
+    program = parse(
+        "    [] x<N & x!=5 -> 0.5:(x'=x+1) + 0.5:(x'=0);\n"
+        "    [] x=5 -> 0.25:(x'=x+1) + 0.75:(x'=0);\n"
+        "    [] x=N -> true;\n");
+    model = builder.build(program);
+    EXPECT_TRUE(builder.wasLastBuildIncremental());
+    EXPECT_EQ(10ul, builder.getNumberOfExpandedStates());
+    auto expected = storm::builder::ExplicitModelBuilder<double>(program, fullOptions).build();
+    EXPECT_EQ(expected->getNumberOfStates(), model->getNumberOfStates());
+    EXPECT_EQ(expected->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(describe(*expected), describe(*model));
+    EXPECT_EQ(expected->getStates("done"), model->getStates("done"));
+
+    // States that become unreachable are removed.
+    program = parse(
+        "    [] x<N & x!=5 -> 0.5:(x'=x+1) + 0.5:(x'=0);\n"
+        "    [] x=5 -> 0.25:(x'=N) + 0.75:(x'=0);\n"
+        "    [] x=N -> true;\n");
+    model = builder.build(program);
+    EXPECT_TRUE(builder.wasLastBuildIncremental());
+    EXPECT_EQ(1ul, builder.getNumberOfExpandedStates());
+    expected = storm::builder::ExplicitModelBuilder<double>(program, fullOptions).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getNumberOfTransitions(), model->getNumberOfTransitions());
+    EXPECT_EQ(describe(*expected), describe(*model));
+
+    // Changing the range of a variable changes the encoding of the states, so the model is built from scratch.
+    program = storm::parser::PrismParser::parseFromString(
+        "dtmc\n"
+        "const int N = 10;\n"
+        "module counter\n"
+        "    x : [0..12] init 0;\n"
+        "    [] x<N -> 0.5:(x'=x+1) + 0.5:(x'=0);\n"
+        "    [] x=N -> true;\n"
+        "endmodule\n"
+        "rewards \"steps\"\n"
+        "    x<N : 1;\n"
+        "endrewards\n",
+        "testfile");
+    model = builder.build(program);
+    EXPECT_FALSE(builder.wasLastBuildIncremental());
+    EXPECT_EQ(11ul, model->getNumberOfStates());
+}
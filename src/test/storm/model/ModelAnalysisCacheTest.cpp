@@ -0,0 +1,149 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+
+TEST(ModelAnalysisCacheTest, QualitativeResults) {
+    typedef storm::models::sparse::ModelAnalysisCache<double> CacheType;
+    storm::storage::BitVector phiStates(100, true);
+    std::vector<storm::storage::BitVector> psiStates = {storm::storage::BitVector(100, {1, 11}), storm::storage::BitVector(100, {2, 12}),
+                                                        storm::storage::BitVector(100, {3, 13})};
+    uint64_t numberOfComputations = 0;
+    auto compute = [&](storm::storage::BitVector const& psi) {
+        return [&]() {
+            ++numberOfComputations;
+            return std::make_pair(~psi, psi);
+        };
+    };
+
+    // Every result stores four bit vectors of the same size.
+    uint64_t sizeOfResult = 4 * phiStates.getSizeInBytes();
+    CacheType cache(2 * sizeOfResult);
+    EXPECT_TRUE(cache.empty());
+
+    auto result = cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Max, phiStates, psiStates[0], compute(psiStates[0]));
+    EXPECT_EQ(1ull, numberOfComputations);
+    EXPECT_EQ(psiStates[0], result.second);
+    result = cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Max, phiStates, psiStates[0], compute(psiStates[0]));
+    EXPECT_EQ(1ull, numberOfComputations);
+    EXPECT_EQ(psiStates[0], result.second);
+    EXPECT_EQ(~psiStates[0], result.first);
+
+    // Results of other analyses are stored separately.
+    cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Min, phiStates, psiStates[0], compute(psiStates[0]));
+    EXPECT_EQ(2ull, numberOfComputations);
+    EXPECT_EQ(2ull, cache.getNumberOfQualitativeResults());
+    EXPECT_EQ(2 * sizeOfResult, cache.getSizeOfQualitativeResults());
+
+    // Using the first result makes the second one the least recently used, which is thus evicted.
+    cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Max, phiStates, psiStates[0], compute(psiStates[0]));
+    cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Max, phiStates, psiStates[1], compute(psiStates[1]));
+    EXPECT_EQ(3ull, numberOfComputations);
+    EXPECT_EQ(2ull, cache.getNumberOfQualitativeResults());
+    cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Max, phiStates, psiStates[0], compute(psiStates[0]));
+    EXPECT_EQ(3ull, numberOfComputations);
+    cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01Min, phiStates, psiStates[0], compute(psiStates[0]));
+    EXPECT_EQ(4ull, numberOfComputations);
+
+    cache.setMaximalSizeOfQualitativeResults(sizeOfResult);
+    EXPECT_EQ(1ull, cache.getNumberOfQualitativeResults());
+    cache.setMaximalSizeOfQualitativeResults(sizeOfResult - 1);
+    EXPECT_EQ(0ull, cache.getNumberOfQualitativeResults());
+    EXPECT_TRUE(cache.empty());
+
+    // Results that are too large are not stored at all.
+    result = cache.getQualitativeResult(CacheType::QualitativeAnalysis::Prob01, phiStates, psiStates[2], compute(psiStates[2]));
+    EXPECT_EQ(5ull, numberOfComputations);
+    EXPECT_EQ(psiStates[2], result.second);
+    EXPECT_EQ(0ull, cache.getNumberOfQualitativeResults());
+}
+
+TEST(ModelAnalysisCacheTest, Mdp) {
+    std::string formulasString = "Pmin=? [F \"two\"]; Pmax=? [F \"two\"]; Pmax=? [true U \"two\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    std::shared_ptr<storm::models::sparse::Mdp<double> const> constMdp = mdp;
+
+    storm::Environment env;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*constMdp);
+    std::vector<double> results;
+    for (auto const& formula : formulas) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+        results.push_back(result->asExplicitQuantitativeCheckResult<double>()[*constMdp->getInitialStates().begin()]);
+    }
+    EXPECT_NEAR(1.0 / 36.0, results[0], 1e-6);
+    EXPECT_NEAR(1.0 / 36.0, results[1], 1e-6);
+    EXPECT_NEAR(1.0 / 36.0, results[2], 1e-6);
+
+    // The qualitative analysis of the third property coincides with the one of the second property.
+    EXPECT_EQ(2ull, constMdp->getAnalysisCache().getNumberOfQualitativeResults());
+    auto const& cachedBackwardTransitions = constMdp->getAnalysisCache().getBackwardTransitions(constMdp->getTransitionMatrix());
+    EXPECT_EQ(&cachedBackwardTransitions, &constMdp->getAnalysisCache().getBackwardTransitions(constMdp->getTransitionMatrix()));
+    EXPECT_TRUE(constMdp->getTransitionMatrix().transpose(true) == constMdp->getBackwardTransitions());
+    EXPECT_EQ(&constMdp->getMaximalEndComponentDecomposition(), &constMdp->getMaximalEndComponentDecomposition());
+
+    // Accessing the transition matrix in a modifiable way keeps the cached results, even if both accessors are used within one expression.
+    auto checkTransposed = [](storm::storage::SparseMatrix<double> const& matrix, storm::storage::SparseMatrix<double> const& backwardTransitions) {
+        return matrix.transpose(true) == backwardTransitions;
+    };
+    EXPECT_TRUE(checkTransposed(mdp->getTransitionMatrix(), mdp->getBackwardTransitions()));
+    EXPECT_EQ(2ull, constMdp->getAnalysisCache().getNumberOfQualitativeResults());
+    EXPECT_EQ(&cachedBackwardTransitions, &constMdp->getAnalysisCache().getBackwardTransitions(mdp->getTransitionMatrix()));
+
+    // Resetting the cache discards the cached results, but copies keep theirs.
+    storm::models::sparse::Mdp<double> copy(*mdp);
+    mdp->resetAnalysisCache();
+    EXPECT_TRUE(constMdp->getAnalysisCache().empty());
+    EXPECT_EQ(2ull, copy.getAnalysisCache().getNumberOfQualitativeResults());
+
+    // After modifying the matrix and resetting the cache, the backward transitions are recomputed for the modified matrix.
+    mdp->getBackwardTransitions();
+    mdp->getTransitionMatrix().makeRowGroupsAbsorbing(mdp->getInitialStates());
+    mdp->resetAnalysisCache();
+    EXPECT_TRUE(checkTransposed(mdp->getTransitionMatrix(), mdp->getBackwardTransitions()));
+    EXPECT_FALSE(checkTransposed(copy.getTransitionMatrix(), mdp->getBackwardTransitions()));
+}
+
+TEST(ModelAnalysisCacheTest, BisimulationQuotients) {
+    std::string formulasString = "P=? [F \"one\"]; P=? [F \"two\"]; P=? [F \"done\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    std::shared_ptr<storm::models::sparse::Model<double>> dtmc = storm::api::buildSparseModel<double>(program, formulas);
+
+    // The quotient preserving all properties is computed once.
+    auto quotient = storm::api::performBisimulationMinimization<double>(dtmc, formulas);
+    EXPECT_EQ(1ull, dtmc->getAnalysisCache().getNumberOfBisimulationQuotients());
+    EXPECT_EQ(quotient, storm::api::performBisimulationMinimization<double>(dtmc, formulas));
+
+    // The quotients for fewer labels are obtained from the stored quotient and coincide with the ones obtained from the model.
+    std::vector<std::shared_ptr<storm::logic::Formula const>> someFormulas = {formulas[0], formulas[2]};
+    auto smallerQuotient = storm::api::performBisimulationMinimization<double>(dtmc, someFormulas);
+    EXPECT_EQ(2ull, dtmc->getAnalysisCache().getNumberOfBisimulationQuotients());
+    std::shared_ptr<storm::models::sparse::Model<double>> otherDtmc = storm::api::buildSparseModel<double>(program, formulas);
+    auto expectedQuotient = storm::api::performBisimulationMinimization<double>(otherDtmc, someFormulas);
+    EXPECT_EQ(expectedQuotient->getNumberOfStates(), smallerQuotient->getNumberOfStates());
+    EXPECT_EQ(expectedQuotient->getNumberOfTransitions(), smallerQuotient->getNumberOfTransitions());
+    EXPECT_LE(smallerQuotient->getNumberOfStates(), quotient->getNumberOfStates());
+
+    // Quotients for a single formula are not stored.
+    auto singleQuotient = storm::api::performBisimulationMinimization<double>(dtmc, {formulas[1]});
+    EXPECT_EQ(2ull, dtmc->getAnalysisCache().getNumberOfBisimulationQuotients());
+    storm::Environment env;
+    auto result = storm::api::verifyWithSparseEngine<double>(env, singleQuotient, storm::api::createTask<double>(formulas[1], true));
+    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(singleQuotient->getInitialStates()));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>().getMin(), 1e-6);
+
+    // Changing the labels discards the stored quotients.
+    dtmc->getStateLabeling();
+    EXPECT_EQ(0ull, dtmc->getAnalysisCache().getNumberOfBisimulationQuotients());
+}
@@ -0,0 +1,43 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/MemoryUsage.h"
+
+TEST(ModelMemoryUsageTest, Components) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+    options.setBuildAllLabels();
+    options.setBuildStateValuations();
+    options.setBuildChoiceOrigins();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    storm::utility::MemoryUsage usage = model->getMemoryUsage();
+    std::vector<std::string> components;
+    for (auto const& component : usage.getComponents()) {
+        components.push_back(component.first);
+        EXPECT_GT(component.second, 0ul) << component.first;
+    }
+    std::vector<std::string> expectedComponents = {"transition matrix", "state labeling", "reward model 'coin_flips'", "state valuations", "choice origins"};
+    EXPECT_EQ(expectedComponents, components);
+
+    // Every entry of the matrix stores a column index and a value.
+    EXPECT_GE(usage.getComponents().front().second, model->getNumberOfTransitions() * (sizeof(double) + sizeof(uint64_t)));
+    EXPECT_EQ(model->getTransitionMatrix().getSizeInBytes(), usage.getComponents().front().second);
+
+    std::stringstream stream;
+    usage.printToStream(stream);
+    EXPECT_NE(std::string::npos, stream.str().find("  * state valuations: "));
+    EXPECT_NE(std::string::npos, stream.str().find("  * total: " + storm::utility::formatBytes(usage.getTotalBytes())));
+}
+
+TEST(ModelMemoryUsageTest, FormatBytes) {
+    EXPECT_EQ("512B", storm::utility::formatBytes(512));
+    EXPECT_EQ("1.5KB", storm::utility::formatBytes(1536));
+    EXPECT_EQ("2.0MB", storm::utility::formatBytes(2 * 1024 * 1024));
+}
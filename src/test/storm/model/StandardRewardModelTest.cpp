@@ -0,0 +1,55 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <unordered_map>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+
+typedef storm::models::sparse::StandardRewardModel<double> RewardModel;
+
+TEST(StandardRewardModelTest, CopyOnWrite) {
+    RewardModel original(std::vector<double>{1, 2, 3}, std::vector<double>{4, 5});
+    RewardModel const copy(original);
+    RewardModel const& constOriginal = original;
+
+    // Copies share the rewards.
+    EXPECT_EQ(&constOriginal.getStateRewardVector(), &copy.getStateRewardVector());
+    EXPECT_EQ(&constOriginal.getStateActionRewardVector(), &copy.getStateActionRewardVector());
+
+    // Modifying the rewards of one reward model does not affect the other.
+    original.setStateReward(0, 7.0);
+    EXPECT_EQ(7.0, original.getStateReward(0));
+    EXPECT_EQ(1.0, copy.getStateReward(0));
+    EXPECT_NE(&constOriginal.getStateRewardVector(), &copy.getStateRewardVector());
+    EXPECT_EQ(&constOriginal.getStateActionRewardVector(), &copy.getStateActionRewardVector());
+
+    // Restricting the actions keeps the state rewards shared.
+    RewardModel const restricted = copy.restrictActions(storm::storage::BitVector(2, std::vector<uint64_t>{1}));
+    EXPECT_EQ(&copy.getStateRewardVector(), &restricted.getStateRewardVector());
+    ASSERT_EQ(1ul, restricted.getStateActionRewardVector().size());
+    EXPECT_EQ(5.0, restricted.getStateActionReward(0));
+
+    boost::optional<std::vector<double>> stateRewards = copy.getOptionalStateRewardVector();
+    ASSERT_TRUE(stateRewards.is_initialized());
+    EXPECT_EQ(copy.getStateRewardVector(), stateRewards.get());
+    EXPECT_FALSE(copy.getOptionalTransitionRewardMatrix().is_initialized());
+}
+
+TEST(StandardRewardModelTest, ShareIdenticalRewards) {
+    std::unordered_map<std::string, RewardModel> rewardModels;
+    rewardModels.emplace("first", RewardModel(std::vector<double>{1, 2, 3}));
+    rewardModels.emplace("second", RewardModel(std::vector<double>{1, 2, 3}, std::vector<double>{1}));
+    rewardModels.emplace("third", RewardModel(std::vector<double>{1, 2, 4}));
+    storm::models::sparse::shareIdenticalRewards(rewardModels);
+
+    RewardModel const& first = rewardModels.at("first");
+    RewardModel const& second = rewardModels.at("second");
+    RewardModel const& third = rewardModels.at("third");
+    EXPECT_EQ(&first.getStateRewardVector(), &second.getStateRewardVector());
+    EXPECT_NE(&first.getStateRewardVector(), &third.getStateRewardVector());
+
+    rewardModels.at("first").getStateRewardVector()[0] = 9;
+    EXPECT_EQ(9.0, first.getStateReward(0));
+    EXPECT_EQ(1.0, second.getStateReward(0));
+}
@@ -31,3 +31,28 @@ TEST(StateLabelingTest, RemoveLabel) {
     EXPECT_EQ(1ul, labeling.getNumberOfLabels());
     EXPECT_TRUE(labeling.getStateHasLabel("test2", 5));
 }
+
+TEST(StateLabelingTest, CopyOnWrite) {
+    storm::models::sparse::StateLabeling labeling(10);
+    labeling.addLabel("test1", storm::storage::BitVector(10, {1, 4, 6, 7}));
+    labeling.addLabel("test2", storm::storage::BitVector(10, {2, 6}));
+
+    // Copies (and sub labelings that keep all states) share the labels.
+    storm::models::sparse::StateLabeling copy = labeling;
+    storm::models::sparse::StateLabeling subLabeling = labeling.getSubLabeling(storm::storage::BitVector(10, true));
+    EXPECT_EQ(&labeling.getStates("test1"), &copy.getStates("test1"));
+    EXPECT_EQ(&labeling.getStates("test2"), &subLabeling.getStates("test2"));
+
+    // Modifying a label of the copy does not affect the original.
+    copy.addLabelToState("test1", 5);
+    EXPECT_TRUE(copy.getStateHasLabel("test1", 5));
+    EXPECT_FALSE(labeling.getStateHasLabel("test1", 5));
+    EXPECT_NE(&labeling.getStates("test1"), &copy.getStates("test1"));
+    EXPECT_EQ(&labeling.getStates("test2"), &copy.getStates("test2"));
+
+    subLabeling.removeLabelFromState("test2", 6);
+    EXPECT_TRUE(labeling.getStateHasLabel("test2", 6));
+    EXPECT_EQ(storm::storage::BitVector(10, {2}), subLabeling.getStates("test2"));
+
+    EXPECT_EQ(storm::storage::BitVector(3, {0, 2}), labeling.getSubLabeling(storm::storage::BitVector(10, {4, 5, 6})).getStates("test1"));
+}
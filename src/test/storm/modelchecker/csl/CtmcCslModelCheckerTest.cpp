@@ -11,11 +11,13 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -429,12 +431,106 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     initialStates.set(0);
     storm::storage::BitVector phiStates(2);
     storm::storage::BitVector psiStates(2);
+    for (auto method : {storm::solver::CtmcTransientMethod::Uniformization, storm::solver::CtmcTransientMethod::AdaptiveUniformization,
+                        storm::solver::CtmcTransientMethod::Krylov}) {
+        storm::Environment env;
+        env.solver().timeBounded().setCtmcMethod(method);
+        std::vector<double> result =
+            storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(env, matrix, initialStates, phiStates, psiStates, exitRates, 1);
+
+        EXPECT_NEAR(0.404043, result[0], 1e-6) << storm::solver::toString(method);
+        EXPECT_NEAR(0.595957, result[1], 1e-6) << storm::solver::toString(method);
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, StiffTransientProbabilities) {
+    // A chain whose rates differ by six orders of magnitude: 0 -> 1 with rate 1e-3 and 1 -> 2 with rate 1e3.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 1e-3);
+    matrixBuilder.addNextValue(1, 2, 1e3);
+    matrixBuilder.addNextValue(2, 2, 0.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    std::vector<double> exitRates = {1e-3, 1e3, 0};
+    storm::storage::BitVector initialStates(3);
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(3);
+    storm::storage::BitVector psiStates(3);
+    double const timeBound = 10;
+    double const expected = 1 - (1e3 * std::exp(-1e-3 * timeBound) - 1e-3 * std::exp(-1e3 * timeBound)) / (1e3 - 1e-3);
+    for (auto method : {storm::solver::CtmcTransientMethod::AdaptiveUniformization, storm::solver::CtmcTransientMethod::Krylov}) {
+        storm::Environment env;
+        env.solver().timeBounded().setCtmcMethod(method);
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            env, matrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+
+        EXPECT_NEAR(std::exp(-1e-3 * timeBound), result[0], 1e-6) << storm::solver::toString(method);
+        EXPECT_NEAR(expected, result[2], 1e-6) << storm::solver::toString(method);
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, KrylovTimeBounded) {
+    std::string formulasString = "P=? [ F<=10 \"network_full\" ]";
+    formulasString += "; P=? [ F[1,10] \"network_full\" ]";
+    formulasString += "; R=? [ C<=10 ]";
+    formulasString += "; R=? [ I=10 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+    storm::Environment env, krylovEnv;
+    krylovEnv.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        auto expected = checker.check(env, task);
+        auto result = checker.check(krylovEnv, task);
+        auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& krylovValues = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), krylovValues.size());
+        for (uint64_t state = 0; state < expectedValues.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], krylovValues[state], 1e-5 * std::max(1.0, expectedValues[state])) << *formula;
+        }
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, BatchedTimeBounded) {
+    std::string formulasString = "P=? [ F<=10 \"network_full\" ]";
+    formulasString += "; P=? [ F<=0.5 \"network_full\" ]";
+    formulasString += "; P=? [ F<=0 \"network_full\" ]";
+    formulasString += "; P=? [ F<=2.5 \"network_full\" ]";
+    formulasString += "; P=? [ F<=10 \"first_queue_full\" ]";
+    formulasString += "; P=? [ F \"network_full\" ]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
     storm::Environment env;
-    std::vector<double> result =
-        storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(env, matrix, initialStates, phiStates, psiStates, exitRates, 1);
 
-    EXPECT_NEAR(0.404043, result[0], 1e-6);
-    EXPECT_NEAR(0.595957, result[1], 1e-6);
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& formula : formulas) {
+        tasks.emplace_back(*formula);
+    }
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+    ASSERT_NO_THROW(results = checker.checkBatch(env, tasks));
+    ASSERT_EQ(formulas.size(), results.size());
+
+    // The properties with a different target and without time bound are not part of a batch.
+    EXPECT_FALSE(results[4]);
+    EXPECT_FALSE(results[5]);
+
+    for (uint64_t index : {0ull, 1ull, 2ull, 3ull}) {
+        ASSERT_TRUE(results[index]);
+        std::unique_ptr<storm::modelchecker::CheckResult> expected = checker.check(env, tasks[index]);
+        auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& batchedValues = results[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), batchedValues.size());
+        for (uint64_t state = 0; state < expectedValues.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], batchedValues[state], 1e-9);
+        }
+    }
 }
 
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
@@ -10,12 +10,14 @@
 #include "storm/api/properties.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -25,6 +27,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/utility/parallel.h"
 
 namespace {
 
@@ -408,4 +411,24 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(MarkovAutomatonUnifPlusTest, ParallelBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/simple.ma");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F<1 s>2]; Pmax=? [F<1.3 s=3]", program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+    env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    for (uint64_t numberOfThreads : {1, 2}) {
+        storm::utility::parallel::setDefaultNumberOfThreads(numberOfThreads);
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0], true));
+        EXPECT_NEAR(0.6321205588, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+        result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1], true));
+        EXPECT_NEAR(0.727468207, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
 }  // namespace
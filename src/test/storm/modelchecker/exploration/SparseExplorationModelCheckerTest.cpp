@@ -101,3 +101,67 @@ TEST(SparseExplorationModelCheckerTest, Cicle) {
 
     EXPECT_NEAR(0.875, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, DiceConcurrent) {
+    storm::settings::mutableExplorationSettings().setNumberOfThreads(4);
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+
+    std::vector<std::pair<std::string, double>> const formulasAndResults = {
+        {"Pmin=? [F \"two\"]", 0.0277777612209320068},   {"Pmax=? [F \"two\"]", 0.0277777612209320068},
+        {"Pmin=? [F \"three\"]", 0.0555555224418640136}, {"Pmax=? [F \"three\"]", 0.0555555224418640136},
+        {"Pmin=? [F \"four\"]", 0.083333283662796020508}, {"Pmax=? [F \"four\"]", 0.083333283662796020508}};
+    for (auto const& formulaAndResult : formulasAndResults) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaAndResult.first);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+
+        EXPECT_NEAR(formulaAndResult.second, quantitativeResult[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision())
+            << formulaAndResult.first;
+    }
+    storm::settings::mutableExplorationSettings().restoreDefaults();
+}
+
+TEST(SparseExplorationModelCheckerTest, AsynchronousLeaderConcurrent) {
+    storm::settings::mutableExplorationSettings().setNumberOfThreads(4);
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+
+    for (std::string const formulaString : {"Pmin=? [F \"elected\"]", "Pmax=? [F \"elected\"]"}) {
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+        storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+
+        EXPECT_NEAR(1, quantitativeResult[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) << formulaString;
+    }
+    storm::settings::mutableExplorationSettings().restoreDefaults();
+}
+
+TEST(SparseExplorationModelCheckerTest, CicleConcurrent) {
+    // Many workers on a small model with end components, so workers frequently sample the same paths while end components are collapsed.
+    storm::settings::mutableExplorationSettings().setNumberOfThreads(8);
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/cicle.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [ F \"done\"]");
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+
+    EXPECT_NEAR(0.875, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    storm::settings::mutableExplorationSettings().restoreDefaults();
+}
@@ -138,6 +138,44 @@ TEST(MultiObjectiveSchedRestModelCheckerTest, steps) {
                                          << toString(actual, true);
 }
 
+TEST(MultiObjectiveSchedRestModelCheckerTest, concurrentFacets) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_stairs.nm";
+    std::string constantsString = "N=3";
+    std::string formulasAsString = "multi(Pmax=? [ F y=1], Pmax=? [ F y=2 ])";
+
+    // programm, model, formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsString);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    std::vector<Point> expected, actual;
+    std::set<Point> incorrectPoints, missingPoints;
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    // Independent facets are processed concurrently, each with its own LP.
+    storm::Environment env = getPositionalDeterministicEnvironment();
+    env.modelchecker().multi().setNumberOfThreads(2);
+
+    expected = parsePoints({"0.875,0", "0,0.875", "0.125,0.75", "0.25,0.625", "0.375,0.5", "0.5,0.375", "0.625,0.25", "0.75,0.125"});
+
+    env.modelchecker().multi().setEncodingType(storm::MultiObjectiveModelCheckerEnvironment::EncodingType::Flow);
+    result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+    ASSERT_TRUE(result->isParetoCurveCheckResult());
+    actual = result->asExplicitParetoCurveCheckResult<storm::RationalNumber>().getPoints();
+    missingPoints = setMinus(expected, actual);
+    EXPECT_TRUE(missingPoints.empty()) << "Some points of the expected solution are missing:\n"
+                                       << "Expected:\n"
+                                       << toString(expected, true) << "Actual:\n"
+                                       << toString(actual, true);
+    incorrectPoints = setMinus(actual, expected);
+    EXPECT_TRUE(incorrectPoints.empty()) << "Some points of the returned solution are not expected:\n"
+                                         << "Expected:\n"
+                                         << toString(expected, true) << "Actual:\n"
+                                         << toString(actual, true);
+}
+
 TEST(MultiObjectiveSchedRestModelCheckerTest, mecs) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_mecs.nm";
     std::string constantsString = "";
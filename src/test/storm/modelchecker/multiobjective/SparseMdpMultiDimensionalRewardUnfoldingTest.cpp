@@ -2,6 +2,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/storm.h"
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -14,6 +15,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_small) {
     storm::Environment env;
@@ -195,6 +197,96 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_zeroconf_dl) {
                 storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ multi( F{\"r\"}<=5 x=N, F{\"l\"}<=10 x=0 )]";
+    formulasAsString += "; \n Pmin=? [ multi( F{\"r\"}>=2 x=N, F{\"l\"}<=6 x=0 )]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    for (auto const& formula : formulas) {
+        storm::utility::parallel::setDefaultNumberOfThreads(1);
+        auto sequentialResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<double>(formula, true));
+        storm::utility::parallel::setDefaultNumberOfThreads(4);
+        auto parallelResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        // The solvers of the threads are warm-started with different epochs, so the results only coincide up to the precision.
+        EXPECT_NEAR(sequentialResult->asExplicitQuantitativeCheckResult<double>()[initState],
+                    parallelResult->asExplicitQuantitativeCheckResult<double>()[initState],
+                    storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_two_dims_unfolded_reference) {
+    // With two reward bounds, the analysis returns to the same epoch classes many times, i.e., it takes their epoch models from the cache.
+    // The results have to coincide with the ones on a model that tracks the accumulated rewards explicitly.
+    std::string walk = R"(mdp
+module walk
+    x : [0..3] init 0;
+    [a] x<3 -> 0.5:(x'=x+1) + 0.5:(x'=max(0,x-1));
+    [b] x<3 -> 0.75:(x'=min(3,x+2)) + 0.25:(x'=0);
+    [c] x=3 -> true;
+endmodule
+)";
+    std::string rewards = R"(
+rewards "steps"
+    [a] true : 1;
+    [b] true : 1;
+endrewards
+rewards "cost"
+    [b] true : 1;
+endrewards
+)";
+    std::string counters = R"(
+module counters
+    s : [0..7] init 0;
+    k : [0..3] init 0;
+    [a] true -> (s'=min(7,s+1));
+    [b] true -> (s'=min(7,s+1)) & (k'=min(3,k+1));
+    [c] true -> true;
+endmodule
+)";
+    std::vector<std::string> formulasAsString = {"Pmax=? [ F{\"steps\"}<=6,{\"cost\"}<=2 x=3 ]", "Pmin=? [ F{\"steps\"}<=6,{\"cost\"}<=2 x=3 ]"};
+    std::vector<std::string> referenceFormulasAsString = {"Pmax=? [ F (x=3 & s<=6 & k<=2) ]", "Pmin=? [ F (x=3 & s<=6 & k<=2) ]"};
+
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(walk + rewards, "walk");
+    storm::prism::Program referenceProgram = storm::parser::PrismParser::parseFromString(walk + counters, "reference");
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    for (uint64_t i = 0; i < formulasAsString.size(); ++i) {
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString[i], program));
+        auto referenceFormulas =
+            storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(referenceFormulasAsString[i], referenceProgram));
+        auto mdp = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+        auto referenceMdp =
+            storm::api::buildSparseModel<storm::RationalNumber>(referenceProgram, referenceFormulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+
+        auto referenceResult = storm::api::verifyWithSparseEngine(referenceMdp, storm::api::createTask<storm::RationalNumber>(referenceFormulas[0], true));
+        ASSERT_TRUE(referenceResult->isExplicitQuantitativeCheckResult());
+        storm::RationalNumber expectedResult =
+            referenceResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[*referenceMdp->getInitialStates().begin()];
+
+        // Concurrently analyzed epochs share the cached epoch models as well.
+        for (uint64_t numberOfThreads : {1, 4}) {
+            storm::utility::parallel::setDefaultNumberOfThreads(numberOfThreads);
+            auto result = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<storm::RationalNumber>(formulas[0], true));
+            ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+            EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[*mdp->getInitialStates().begin()])
+                << "for " << formulasAsString[i] << " with " << numberOfThreads << " threads";
+        }
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_csma) {
     storm::Environment env;
 
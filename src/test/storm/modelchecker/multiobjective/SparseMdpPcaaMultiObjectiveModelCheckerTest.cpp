@@ -18,6 +18,7 @@
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/storage/geometry/Polytope.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/utility/parallel.h"
 
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus) {
     if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
@@ -490,4 +491,47 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, resource_gathering) {
     }
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, parallel_pareto) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    storm::Environment env;
+    env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_simple_lra.nm";
+    std::string formulasAsString = "multi(R{\"first\"}min=? [ C ], R{\"second\"}max=? [ LRA ], R{\"third\"}max=? [ C ]);\n";  // pareto
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    // Check the weight vectors in parallel
+    storm::utility::parallel::setDefaultNumberOfThreads(3);
+    std::unique_ptr<storm::modelchecker::CheckResult> result =
+        storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+    ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+    std::vector<std::vector<std::string>> expectedPoints;
+    expectedPoints.emplace_back(std::vector<std::string>({"10/8", "0", "10/8"}));
+    expectedPoints.emplace_back(std::vector<std::string>({"7", "16", "2"}));
+    double eps = 1e-4;
+    EXPECT_TRUE(expectSubset(result->asExplicitParetoCurveCheckResult<double>().getPoints(), convertPointset<double>(expectedPoints), eps))
+        << "Non-Pareto point found.";
+    EXPECT_TRUE(expectSubset(convertPointset<double>(expectedPoints), result->asExplicitParetoCurveCheckResult<double>().getPoints(), eps))
+        << "Pareto point missing.";
+
+    // The sequential computation yields the same points
+    std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult =
+        storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+    ASSERT_TRUE(sequentialResult->isExplicitParetoCurveCheckResult());
+    EXPECT_TRUE(expectSubset(result->asExplicitParetoCurveCheckResult<double>().getPoints(),
+                             sequentialResult->asExplicitParetoCurveCheckResult<double>().getPoints(), eps));
+    EXPECT_TRUE(expectSubset(sequentialResult->asExplicitParetoCurveCheckResult<double>().getPoints(),
+                             result->asExplicitParetoCurveCheckResult<double>().getPoints(), eps));
+}
+
 #endif /* STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE */
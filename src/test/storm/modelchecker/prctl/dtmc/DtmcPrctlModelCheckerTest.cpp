@@ -8,6 +8,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -294,6 +295,24 @@ class SparseNativeRationalSearchEnvironment {
     }
 };
 
+class SparseTopologicalConcurrentEigenLUEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().topological().setBatchSize(1);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
 class SparseTopologicalEigenLUEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
@@ -342,6 +361,39 @@ class HybridCuddNativeJacobiEnvironment {
     }
 };
 
+class HybridCuddNativeJacobiSccEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    static const DtmcEngine engine = DtmcEngine::Hybrid;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.modelchecker().setHybridSccBlockSize(1);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+
+class HybridSylvanEigenRationalLUSccEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    static const DtmcEngine engine = DtmcEngine::Hybrid;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.modelchecker().setHybridSccBlockSize(10);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
 class HybridCuddNativeSoundValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -557,9 +609,11 @@ typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIlu
                          SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment, SparseEigenRationalLUEnvironment, SparseRationalEliminationEnvironment,
                          SparseNativeJacobiEnvironment, SparseNativeWalkerChaeEnvironment, SparseNativeSorEnvironment, SparseNativePowerEnvironment,
                          SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeIntervalIterationEnvironment,
-                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridSylvanGmmxxGmresEnvironment,
-                         HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment,
-                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
+                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, SparseTopologicalConcurrentEigenLUEnvironment,
+                         HybridSylvanGmmxxGmresEnvironment, HybridCuddNativeJacobiEnvironment, HybridCuddNativeJacobiSccEnvironment,
+                         HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment, HybridSylvanEigenRationalLUSccEnvironment,
+                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment,
+                         DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(DtmcPrctlModelCheckerTest, TestingTypes, );
@@ -7,6 +7,8 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/propositional/StateFormulaResultCache.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingMemento.h"
@@ -14,7 +16,9 @@
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 
 TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
@@ -68,6 +72,31 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
     EXPECT_NEAR(11.0 / 3.0, quantitativeResult4[0], precision);
 }
 
+TEST(ExplicitDtmcPrctlModelCheckerTest, DieLargeStepBound) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    storm::parser::FormulaParser formulaParser(std::make_shared<storm::expressions::ExpressionManager>());
+    double const precision = 1e-6;
+
+    // The iterates stop changing long before the step bound is reached, so the remaining steps are skipped.
+    storm::Environment env;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=1000000000000 \"one\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+
+    // Stop once the result is known up to the precision.
+    env.solver().timeBounded().setStepBoundedEarlyTermination(true);
+    env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    env.solver().timeBounded().setRelativeTerminationCriterion(false);
+    result = checker.check(env, *formula);
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=5 \"one\"]");
+    result = checker.check(env, *formula);
+    EXPECT_NEAR(0.140625, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+}
+
 TEST(ExplicitDtmcPrctlModelCheckerTest, Crowds) {
     storm::Environment env;
     double const precision = 1e-6;
@@ -158,3 +187,45 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979591836789, quantitativeResult3[0], precision);
 }
+
+TEST(ExplicitDtmcPrctlModelCheckerTest, DieStateFormulas) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::parser::FormulaParser formulaParser(std::make_shared<storm::expressions::ExpressionManager>());
+    storm::Environment env;
+    auto cache = std::make_shared<storm::modelchecker::StateFormulaResultCache>();
+    env.modelchecker().setStateFormulaResultCache(cache);
+
+    // Propositional formulas are evaluated directly on the labeling.
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    auto formula = formulaParser.parseSingleFormulaFromString("\"one\" | !\"done\" & \"two\" | !\"init\" & !\"done\"");
+    auto result = checker.check(env, *formula);
+    storm::storage::BitVector expected(13, true);
+    expected.set(0, false);
+    expected.set(8, false);
+    expected.set(9, false);
+    expected.set(10, false);
+    expected.set(11, false);
+    expected.set(12, false);
+    EXPECT_EQ(expected, result->asExplicitQualitativeCheckResult().getTruthValuesVector());
+
+    // The result of a nested operator is reused by later checks, also by other model checkers.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F (\"one\" | P>0.5 [F \"done\"])]");
+    result = checker.check(env, *formula);
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[0], 1e-6);
+    EXPECT_EQ(1ul, cache->getNumberOfResults());
+    EXPECT_EQ(0ul, cache->getNumberOfHits());
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> otherChecker(*dtmc);
+    result = otherChecker.check(env, *formulaParser.parseSingleFormulaFromString("P>0.5 [F \"done\"] & !\"done\""));
+    EXPECT_EQ(1ul, cache->getNumberOfHits());
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[7]);
+
+    // The operator is not checked at all if the other operand decides the initial states.
+    cache->clear();
+    formula = formulaParser.parseSingleFormulaFromString("\"done\" & P>0.5 [F \"one\"]");
+    result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[0]);
+    EXPECT_EQ(0ul, cache->getNumberOfResults());
+}
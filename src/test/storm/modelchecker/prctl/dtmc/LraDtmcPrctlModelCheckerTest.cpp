@@ -15,6 +15,7 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -114,6 +115,19 @@ class DistrGmmxxDoubleGmresEnvironment {
     }
 };
 
+class DistrGmmxxDoubleGmresConcurrentEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env = DistrGmmxxDoubleGmresEnvironment::createEnvironment();
+        env.solver().lra().setNumberOfThreads(2);
+        env.solver().topological().setNumberOfThreads(2);
+        env.solver().topological().setBatchSize(1);
+        return env;
+    }
+};
+
 class DistrEigenRationalLUEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -175,8 +189,8 @@ class LraDtmcPrctlModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<GBGmmxxDoubleGmresEnvironment, GBEigenDoubleDGmresEnvironment, GBEigenRationalLUEnvironment, GBNativeSorEnvironment,
-                         GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment,
-                         ValueIterationEnvironment>
+                         GBNativeWalkerChaeEnvironment, DistrGmmxxDoubleGmresEnvironment, DistrGmmxxDoubleGmresConcurrentEnvironment,
+                         DistrEigenRationalLUEnvironment, DistrNativeWalkerChaeEnvironment, ValueIterationEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(LraDtmcPrctlModelCheckerTest, TestingTypes, );
@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/ModelAnalysisCache.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/parallel.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+
+namespace {
+
+void checkConditionalDice() {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmax=? [F \"two\" || F d1=1]";
+    formulasString += "; Pmin=? [F \"two\" || F d1=1]";
+    formulasString += "; Pmax=? [F \"two\" || F \"done\"]";
+    formulasString += "; Pmax=? [F \"done\" || F d1=1]";
+    formulasString += "; Pmax=? [F \"two\" || F d1=7]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::Environment env;
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    auto check = [&](uint64_t index) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index], true));
+        return result->asExplicitQuantitativeCheckResult<double>()[initialState];
+    };
+
+    // The condition is satisfied with probability 1/6, in which case the target is reached with probability 1/6.
+    EXPECT_NEAR(1.0 / 6.0, check(0), 1e-6);
+    EXPECT_NEAR(1.0 / 6.0, check(1), 1e-6);
+    // The condition is satisfied almost surely.
+    EXPECT_NEAR(1.0 / 36.0, check(2), 1e-6);
+    // The target is reached almost surely.
+    EXPECT_NEAR(1.0, check(3), 1e-6);
+    // The condition is never satisfied.
+    EXPECT_EQ(storm::utility::infinity<double>(), check(4));
+
+    // The qualitative analyses are stored in the analysis cache of the model.
+    EXPECT_GT(mdp->getAnalysisCache().getNumberOfQualitativeResults(), 0ul);
+}
+
+TEST(ConditionalMdpPrctlModelCheckerTest, Dice) {
+    checkConditionalDice();
+}
+
+TEST(ConditionalMdpPrctlModelCheckerTest, DiceParallel) {
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(2);
+    checkConditionalDice();
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
+}  // namespace
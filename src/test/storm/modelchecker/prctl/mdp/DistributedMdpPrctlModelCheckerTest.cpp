@@ -0,0 +1,101 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/modelchecker/prctl/helper/SparseDistributedPrctlHelper.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/distributed/Communicator.h"
+
+namespace {
+
+class DistributedMdpPrctlModelCheckerTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        storm::builder::BuilderOptions options;
+        options.setBuildAllLabels().setBuildAllRewardModels();
+        mdp = storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Mdp<double>>();
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    }
+
+    // Restricts the given states to the states owned by the given rank.
+    storm::storage::BitVector getLocalStates(storm::storage::distributed::StatePartition const& partition, uint64_t rank,
+                                             storm::storage::BitVector const& states) const {
+        storm::storage::BitVector result(partition.getNumberOfLocalStates(rank));
+        for (uint64_t localState = 0; localState < result.size(); ++localState) {
+            result.set(localState, states.get(partition.getGlobalIndex(rank, localState)));
+        }
+        return result;
+    }
+
+    // Runs the given computation on the given number of ranks and returns the value of the initial state.
+    template<typename RankFunction>
+    double computeOnRanks(uint64_t numberOfRanks, storm::storage::distributed::PartitioningMethod method, RankFunction const& function) {
+        storm::storage::distributed::StatePartition partition(mdp->getNumberOfStates(), numberOfRanks, method);
+        uint64_t initialState = *mdp->getInitialStates().begin();
+        double result = -1.0;
+        auto communicators = storm::storage::distributed::SharedMemoryCommunicator::create(numberOfRanks);
+        std::vector<std::thread> threads;
+        for (uint64_t rank = 0; rank < numberOfRanks; ++rank) {
+            threads.emplace_back([&, rank]() {
+                auto localRows = storm::storage::distributed::DistributedSparseMatrix<double>::extractLocalRows(mdp->getTransitionMatrix(), partition, rank);
+                storm::storage::distributed::DistributedSparseMatrix<double> matrix(localRows, partition, communicators[rank]);
+                std::vector<double> values = function(matrix, partition, rank);
+                if (partition.getOwner(initialState) == rank) {
+                    result = values[partition.getLocalIndex(initialState)];
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return result;
+    }
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp;
+    storm::Environment env;
+};
+
+}  // namespace
+
+TEST_F(DistributedMdpPrctlModelCheckerTest, UntilProbabilities) {
+    typedef storm::modelchecker::helper::SparseDistributedPrctlHelper<double> HelperType;
+    storm::storage::BitVector allStates(mdp->getNumberOfStates(), true);
+    for (auto method : {storm::storage::distributed::PartitioningMethod::Block, storm::storage::distributed::PartitioningMethod::Cyclic}) {
+        double result = computeOnRanks(3, method, [&](auto const& matrix, auto const& partition, uint64_t rank) {
+            return HelperType::computeUntilProbabilities(env, storm::solver::OptimizationDirection::Maximize, matrix,
+                                                         getLocalStates(partition, rank, allStates), getLocalStates(partition, rank, mdp->getStates("two")));
+        });
+        EXPECT_NEAR(1.0 / 36.0, result, 1e-8);
+
+        result = computeOnRanks(2, method, [&](auto const& matrix, auto const& partition, uint64_t rank) {
+            return HelperType::computeUntilProbabilities(env, storm::solver::OptimizationDirection::Minimize, matrix,
+                                                         getLocalStates(partition, rank, allStates), getLocalStates(partition, rank, mdp->getStates("four")));
+        });
+        EXPECT_NEAR(3.0 / 36.0, result, 1e-8);
+    }
+}
+
+TEST_F(DistributedMdpPrctlModelCheckerTest, ReachabilityRewards) {
+    typedef storm::modelchecker::helper::SparseDistributedPrctlHelper<double> HelperType;
+    std::vector<double> choiceRewards = mdp->getRewardModel("coinflips").getTotalRewardVector(mdp->getTransitionMatrix());
+    std::vector<uint64_t> const& rowGroupIndices = mdp->getTransitionMatrix().getRowGroupIndices();
+    auto const method = storm::storage::distributed::PartitioningMethod::Cyclic;
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        double result = computeOnRanks(3, method, [&](auto const& matrix, auto const& partition, uint64_t rank) {
+            std::vector<double> localRewards;
+            for (uint64_t localState = 0; localState < partition.getNumberOfLocalStates(rank); ++localState) {
+                uint64_t state = partition.getGlobalIndex(rank, localState);
+                localRewards.insert(localRewards.end(), choiceRewards.begin() + rowGroupIndices[state], choiceRewards.begin() + rowGroupIndices[state + 1]);
+            }
+            return HelperType::computeReachabilityRewards(env, dir, matrix, localRewards, getLocalStates(partition, rank, mdp->getStates("done")));
+        });
+        EXPECT_NEAR(22.0 / 3.0, result, 1e-6);
+    }
+}
@@ -1,8 +1,12 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <filesystem>
+
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ResultHintStore.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -202,3 +206,138 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
 
     EXPECT_NEAR(30.0 / 7.0, quantitativeResult6[0], precision);
 }
+
+TEST(ExplicitMdpPrctlModelCheckerTest, BatchedStepBounded) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-12;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {
+        formulaParser.parseSingleFormulaFromString("Pmax=? [F<=5 \"two\"]"), formulaParser.parseSingleFormulaFromString("Pmin=? [F<=5 \"two\"]"),
+        formulaParser.parseSingleFormulaFromString("Pmax=? [F<=10 \"three\"]"), formulaParser.parseSingleFormulaFromString("Rmax=? [C<=5]"),
+        formulaParser.parseSingleFormulaFromString("Rmax=? [C<=7]"), formulaParser.parseSingleFormulaFromString("Pmax=? [F \"four\"]")};
+
+    std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+    for (auto const& formula : formulas) {
+        tasks.emplace_back(*formula);
+    }
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results;
+    ASSERT_NO_THROW(results = checker.checkBatch(env, tasks));
+    ASSERT_EQ(formulas.size(), results.size());
+
+    // The minimizing probability and the unbounded property are not part of a batch.
+    EXPECT_FALSE(results[1]);
+    EXPECT_FALSE(results[5]);
+
+    for (uint64_t index : {0ull, 2ull, 3ull, 4ull}) {
+        ASSERT_TRUE(results[index]);
+        std::unique_ptr<storm::modelchecker::CheckResult> expected = checker.check(env, tasks[index]);
+        auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        auto const& batchedValues = results[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(expectedValues.size(), batchedValues.size());
+        for (uint64_t state = 0; state < expectedValues.size(); ++state) {
+            EXPECT_NEAR(expectedValues[state], batchedValues[state], precision);
+        }
+    }
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ResultHints) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    storm::parser::FormulaParser formulaParser;
+
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::modelchecker::ResultHintStore<double> hintStore(*mdp);
+
+    // Step-bounded computations continue from the result for fewer steps.
+    for (uint64_t steps : {5, 10}) {
+        std::shared_ptr<storm::logic::Formula const> formula =
+            formulaParser.parseSingleFormulaFromString("Pmax=? [F<=" + std::to_string(steps) + " \"done\"]");
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        hintStore.provideHint(task);
+        EXPECT_EQ(steps == 10, task.getHint().isExplicitModelCheckerHint());
+        std::unique_ptr<storm::modelchecker::CheckResult> hintedResult = checker.check(env, task);
+        hintStore.storeResult(*formula, *hintedResult);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        for (uint64_t state = 0; state < mdp->getNumberOfStates(); ++state) {
+            EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[state], hintedResult->asExplicitQuantitativeCheckResult<double>()[state],
+                        precision);
+        }
+    }
+
+    // The scheduler of the reachability probability is used as hint for the reward with the same target. Schedulers are only stored if requested.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"done\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> probabilityTask(*formula);
+    hintStore.provideHint(probabilityTask);
+    EXPECT_FALSE(probabilityTask.isProduceSchedulersSet());
+    probabilityTask.setProduceSchedulers(true);
+    hintStore.storeResult(*formula, *checker.check(env, probabilityTask));
+
+    formula = formulaParser.parseSingleFormulaFromString("Rmax=? [F \"done\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> rewardTask(*formula);
+    hintStore.provideHint(rewardTask);
+    ASSERT_TRUE(rewardTask.getHint().isExplicitModelCheckerHint());
+    EXPECT_TRUE(rewardTask.getHint().asExplicitModelCheckerHint<double>().hasSchedulerHint());
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, rewardTask);
+    EXPECT_NEAR(22.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+}
+
+TEST(ExplicitMdpPrctlModelCheckerTest, ResultHintsImport) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab");
+    storm::Environment env;
+    double const precision = 1e-6;
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+
+    // The same structure with biased coins.
+    storm::storage::SparseMatrix<double> biasedMatrix = mdp->getTransitionMatrix();
+    for (uint64_t row = 0; row < biasedMatrix.getRowCount(); ++row) {
+        auto entries = biasedMatrix.getRow(row);
+        if (entries.getNumberOfEntries() == 2) {
+            entries.begin()->setValue(0.4);
+            (entries.begin() + 1)->setValue(0.6);
+        }
+    }
+    storm::models::sparse::Mdp<double> biasedMdp(biasedMatrix, mdp->getStateLabeling());
+
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_result_hints_import_test.txt").string();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    storm::modelchecker::ResultHintStore<double> hintStore(*mdp);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F<=5 \"done\"]");
+    hintStore.storeResult(*formula, *checker.check(env, *formula));
+    hintStore.exportToFile(filename);
+
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F<=10 \"done\"]");
+    storm::modelchecker::ResultHintStore<double> importedStore(*mdp);
+    importedStore.importFromFile(filename);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+    importedStore.provideHint(task);
+    EXPECT_TRUE(task.getHint().isExplicitModelCheckerHint());
+
+    // The step-bounded result is the exact starting point of the remaining steps, so it must not be used for different probabilities.
+    storm::modelchecker::ResultHintStore<double> biasedStore(biasedMdp);
+    biasedStore.importFromFile(filename);
+    std::filesystem::remove(filename);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> biasedTask(*formula);
+    biasedStore.provideHint(biasedTask);
+    EXPECT_FALSE(biasedTask.getHint().isExplicitModelCheckerHint());
+
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> biasedChecker(biasedMdp);
+    std::unique_ptr<storm::modelchecker::CheckResult> hintedResult = biasedChecker.check(env, biasedTask);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = biasedChecker.check(env, *formula);
+    for (uint64_t state = 0; state < biasedMdp.getNumberOfStates(); ++state) {
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[state], hintedResult->asExplicitQuantitativeCheckResult<double>()[state], precision);
+    }
+}
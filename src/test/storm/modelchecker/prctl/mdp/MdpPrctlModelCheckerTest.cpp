@@ -9,6 +9,7 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
@@ -181,6 +182,26 @@ class SparseDoubleTopologicalValueIterationEnvironment {
     }
 };
 
+class SparseDoubleTopologicalConcurrentSoundValueIterationEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
+    static const MdpEngine engine = MdpEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Mdp<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().topological().setBatchSize(1);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().minMax().setRelativeTerminationCriterion(false);
+        return env;
+    }
+};
+
 class SparseDoubleTopologicalSoundValueIterationEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // Unused for sparse models
@@ -518,7 +539,8 @@ typedef ::testing::Types<SparseDoubleValueIterationGmmxxGaussSeidelMultEnvironme
                          SparseDoubleValueIterationNativeGaussSeidelMultEnvironment, SparseDoubleValueIterationNativeRegularMultEnvironment,
                          JaniSparseDoubleValueIterationEnvironment, SparseDoubleIntervalIterationEnvironment, SparseDoubleSoundValueIterationEnvironment,
                          SparseDoubleOptimisticValueIterationEnvironment, SparseDoubleTopologicalValueIterationEnvironment,
-                         SparseDoubleTopologicalSoundValueIterationEnvironment, SparseDoubleLPEnvironment, SparseRationalPolicyIterationEnvironment,
+                         SparseDoubleTopologicalSoundValueIterationEnvironment, SparseDoubleTopologicalConcurrentSoundValueIterationEnvironment,
+                         SparseDoubleLPEnvironment, SparseRationalPolicyIterationEnvironment,
                          SparseRationalViToPiEnvironment, SparseRationalRationalSearchEnvironment, HybridCuddDoubleValueIterationEnvironment,
                          HybridSylvanDoubleValueIterationEnvironment, HybridCuddDoubleSoundValueIterationEnvironment,
                          HybridCuddDoubleOptimisticValueIterationEnvironment, HybridSylvanRationalPolicyIterationEnvironment,
@@ -863,4 +885,34 @@ TYPED_TEST(MdpPrctlModelCheckerTest, HOADice) {
     }
 }
 
+TEST(SymbolicMdpPrctlModelCheckerTest, DdTerminalRounding) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"two\"]", program));
+    typedef storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan> ModelType;
+    auto model = storm::api::buildSymbolicModel<storm::dd::DdType::Sylvan, double>(program, formulas)->as<ModelType>();
+    storm::modelchecker::SymbolicMdpPrctlModelChecker<ModelType> checker(*model);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas.front());
+    storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::Sylvan> initialStates(model->getReachableStates(), model->getInitialStates());
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    env.solver().minMax().setRelativeTerminationCriterion(false);
+    storm::RationalNumber grid = storm::utility::convertNumber<storm::RationalNumber>(std::string("1/10000"));
+
+    // Rounding down keeps the values of value iteration below the actual probability.
+    env.solver().setDdTerminalRounding(grid, storm::solver::DdTerminalRounding::Down);
+    auto result = checker.check(env, task);
+    result->filter(initialStates);
+    double value = result->asQuantitativeCheckResult<double>().getMin();
+    EXPECT_LE(value, 1.0 / 36 + 1e-12);
+    EXPECT_NEAR(1.0 / 36, value, 1e-2);
+    EXPECT_NEAR(0.0, value * 1e4 - std::round(value * 1e4), 1e-6);
+
+    env.solver().setDdTerminalRounding(grid, storm::solver::DdTerminalRounding::Nearest);
+    result = checker.check(env, task);
+    result->filter(initialStates);
+    EXPECT_NEAR(1.0 / 36, result->asQuantitativeCheckResult<double>().getMin(), 1e-2);
+}
+
 }  // namespace
@@ -19,6 +19,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/utility/parallel.h"
 
 namespace {
 
@@ -302,4 +303,24 @@ TYPED_TEST(QuantileQueryTest, resources) {
     compare = this->compareResult(model, result, expectedResult);
     EXPECT_TRUE(compare.first) << compare.second;
 }
+
+TYPED_TEST(QuantileQueryTest, resources_parallel) {
+    typedef storm::models::sparse::Mdp<typename TestFixture::ValueType> ModelType;
+
+    std::string formulasString = "quantile(max GOLD, max GEM, Pmax>0.95 [F{\"gold\"}>=GOLD,{\"gem\"}>=GEM,{\"steps\"}<=100 true]);\n";
+
+    auto modelFormulas = this->template buildModelFormulas<ModelType>(STORM_TEST_RESOURCES_DIR "/mdp/quantiles_resources.nm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->template createModelChecker<ModelType>(model);
+
+    // The sub-queries for the two dimensions are computed concurrently.
+    std::vector<std::string> expectedResult = {"0, 10", "1, 9", "4, 8", "7, 7", "8, 4", "9, 2", "10, 0"};
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(3);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker->check(this->env(), tasks[0]);
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+    auto compare = this->compareResult(model, result, expectedResult);
+    EXPECT_TRUE(compare.first) << compare.second;
+}
 }  // namespace
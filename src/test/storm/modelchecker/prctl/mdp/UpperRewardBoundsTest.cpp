@@ -0,0 +1,72 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/modelchecker/prctl/helper/SccUpperRewardBoundsComputer.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Builds a chain of gadgets. In the first state of a gadget, one can either move to the second state (reward 1) or skip to the next gadget
+// (reward 10). The second state (reward 1) returns to the first state or moves to the next gadget with probability 1/2 each. Leaving the last
+// gadget reaches the goal. Each gadget adds 4 to the minimal and 10 to the maximal expected rewards of its first state.
+void buildGadgetChain(uint64_t numberOfGadgets, storm::storage::SparseMatrix<double>& matrix, std::vector<double>& rewards,
+                      std::vector<double>& targetProbabilities) {
+    uint64_t const numberOfStates = 2 * numberOfGadgets;
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t gadget = 0; gadget < numberOfGadgets; ++gadget) {
+        uint64_t first = 2 * gadget;
+        uint64_t next = first + 2;
+        bool isLast = gadget + 1 == numberOfGadgets;
+
+        builder.newRowGroup(row);
+        builder.addNextValue(row, first + 1, 1.0);
+        rewards.push_back(1.0);
+        targetProbabilities.push_back(0.0);
+        ++row;
+        if (!isLast) {
+            builder.addNextValue(row, next, 1.0);
+        }
+        rewards.push_back(10.0);
+        targetProbabilities.push_back(isLast ? 1.0 : 0.0);
+        ++row;
+
+        builder.newRowGroup(row);
+        builder.addNextValue(row, first, 0.5);
+        if (!isLast) {
+            builder.addNextValue(row, next, 0.5);
+        }
+        rewards.push_back(1.0);
+        targetProbabilities.push_back(isLast ? 0.5 : 0.0);
+        ++row;
+    }
+    matrix = builder.build(row, numberOfStates, numberOfStates);
+}
+
+TEST(UpperRewardBoundsTest, SccBounds) {
+    storm::storage::SparseMatrix<double> matrix;
+    std::vector<double> rewards, targetProbabilities;
+    uint64_t const numberOfGadgets = 50;
+    buildGadgetChain(numberOfGadgets, matrix, rewards, targetProbabilities);
+
+    storm::modelchecker::helper::SccUpperRewardBoundsComputer<double> boundsComputer(matrix, rewards, targetProbabilities);
+    auto minBounds = boundsComputer.computeUpperBounds(storm::OptimizationDirection::Minimize);
+    auto maxBounds = boundsComputer.computeUpperBounds(storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(2 * numberOfGadgets, minBounds.size());
+    ASSERT_EQ(2 * numberOfGadgets, maxBounds.size());
+    for (uint64_t gadget = 0; gadget < numberOfGadgets; ++gadget) {
+        double remainingGadgets = static_cast<double>(numberOfGadgets - gadget);
+        EXPECT_GE(minBounds[2 * gadget] + 1e-9, 4.0 * remainingGadgets) << "gadget " << gadget;
+        EXPECT_GE(maxBounds[2 * gadget] + 1e-9, 10.0 * remainingGadgets) << "gadget " << gadget;
+    }
+    // Every gadget adds a constant to the bounds instead of multiplying the bounds of the subsequent gadgets.
+    EXPECT_LE(maxBounds[0], 25.0 * static_cast<double>(numberOfGadgets));
+    EXPECT_LE(minBounds[0], 25.0 * static_cast<double>(numberOfGadgets));
+
+    // Concurrent computations yield the same bounds.
+    EXPECT_EQ(minBounds, boundsComputer.computeUpperBounds(storm::OptimizationDirection::Minimize, 4, 1));
+    EXPECT_EQ(maxBounds, boundsComputer.computeUpperBounds(storm::OptimizationDirection::Maximize, 4, 1));
+    EXPECT_EQ(minBounds, boundsComputer.computeUpperBounds(storm::OptimizationDirection::Minimize, 4, 3));
+}
+
+}  // namespace
@@ -0,0 +1,123 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/export.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+namespace {
+
+std::string getTemporaryFilename(std::string const& name) {
+    return (std::filesystem::temp_directory_path() / ("storm_binary_model_test_" + name + ".drb")).string();
+}
+
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model,
+                                                                     std::string const& name,
+                                                                     storm::parser::BinaryModelParserOptions const& options = {}) {
+    std::string filename = getTemporaryFilename(name);
+    storm::api::exportSparseModelAsDrb(model, filename);
+    auto result = storm::parser::BinaryModelParser::parseModel(filename, options);
+    std::remove(filename.c_str());
+    return result;
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    EXPECT_EQ(expected.getNumberOfChoices(), actual.getNumberOfChoices());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+        EXPECT_EQ(rewardModel.second.hasTransitionRewards(), actualRewardModel.hasTransitionRewards());
+    }
+}
+
+}  // namespace
+
+TEST(BinaryModelParserTest, DtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    auto loaded = exportAndParse(model, "dtmc");
+    expectEqualModels(*model, *loaded);
+    EXPECT_TRUE(loaded->getTransitionMatrix().hasTrivialRowGrouping());
+}
+
+TEST(BinaryModelParserTest, MdpRoundTrip) {
+    storm::parser::DirectEncodingParserOptions drnOptions;
+    drnOptions.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", drnOptions);
+    auto loaded = exportAndParse(model, "mdp");
+    expectEqualModels(*model, *loaded);
+    ASSERT_TRUE(loaded->hasChoiceLabeling());
+    EXPECT_TRUE(model->getChoiceLabeling() == loaded->getChoiceLabeling());
+}
+
+TEST(BinaryModelParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    auto loaded = exportAndParse(model, "ctmc");
+    expectEqualModels(*model, *loaded);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(), loaded->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryModelParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    auto loaded = exportAndParse(model, "ma");
+    expectEqualModels(*model, *loaded);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto loadedMa = loaded->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getMarkovianStates(), loadedMa->getMarkovianStates());
+    EXPECT_EQ(ma->getExitRates(), loadedMa->getExitRates());
+}
+
+TEST(BinaryModelParserTest, StateValuations) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::builder::BuilderOptions builderOptions;
+    builderOptions.setBuildStateValuations();
+    auto model = storm::api::buildSparseModel<double>(program, builderOptions);
+    ASSERT_TRUE(model->hasStateValuations());
+
+    // Without an expression manager, the valuations are skipped.
+    auto loaded = exportAndParse(model, "valuations");
+    expectEqualModels(*model, *loaded);
+    EXPECT_FALSE(loaded->hasStateValuations());
+
+    storm::parser::BinaryModelParserOptions options;
+    options.expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+    loaded = exportAndParse(model, "valuations", options);
+    expectEqualModels(*model, *loaded);
+    ASSERT_TRUE(loaded->hasStateValuations());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(model->getStateValuations().toString(state), loaded->getStateValuations().toString(state));
+    }
+}
+
+TEST(BinaryModelParserTest, WrongFormat) {
+    std::string filename = getTemporaryFilename("wrong");
+    {
+        std::ofstream stream(filename, std::ios::binary);
+        stream << "@type: DTMC\n@parameters\n\n";
+    }
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryModelParser::parseModel(filename), storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+}
@@ -15,6 +15,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -178,6 +179,32 @@ TEST(DeterministicSparseTransitionParserTest, Whitespaces) {
                                .hash());
 }
 
+TEST(DeterministicSparseTransitionParserTest, ParallelParsing) {
+    // Parsing with several threads has to yield the same matrices as the sequential parser.
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::storage::SparseMatrix<double> transitionMatrix =
+        storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_general.tra");
+    storm::storage::SparseMatrix<double> rewardMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitionRewards(
+        STORM_TEST_RESOURCES_DIR "/rew/dtmc_general.trans.rew", transitionMatrix);
+    storm::storage::SparseMatrix<double> deadlockMatrix =
+        storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_deadlock.tra");
+
+    storm::utility::parallel::setDefaultNumberOfThreads(4);
+    EXPECT_EQ(transitionMatrix,
+              storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_general.tra"));
+    EXPECT_EQ(rewardMatrix, storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitionRewards(
+                                STORM_TEST_RESOURCES_DIR "/rew/dtmc_general.trans.rew", transitionMatrix));
+    EXPECT_EQ(deadlockMatrix,
+              storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_deadlock.tra"));
+    STORM_SILENT_EXPECT_THROW(
+        storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_mixedStateOrder.tra"),
+        storm::exceptions::InvalidArgumentException);
+    STORM_SILENT_EXPECT_THROW(
+        storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(STORM_TEST_RESOURCES_DIR "/tra/dtmc_doubledLines.tra"),
+        storm::exceptions::InvalidArgumentException);
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
 TEST(DeterministicSparseTransitionParserTest, MixedTransitionOrder) {
     // Since the MatrixBuilder needs sequential input of new elements reordering of transitions or states should throw an exception.
     STORM_SILENT_ASSERT_THROW(
@@ -1,7 +1,14 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/api/export.h"
+#include "storm/io/CompressedFile.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -87,3 +94,34 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelExport) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+
+    storm::exporter::DirectEncodingOptions exportOptions;
+    exportOptions.numberOfThreads = 1;
+    std::stringstream sequential;
+    storm::exporter::explicitExportSparseModel(sequential, model, {}, exportOptions);
+    exportOptions.numberOfThreads = 4;
+    std::stringstream parallel;
+    storm::exporter::explicitExportSparseModel(parallel, model, {}, exportOptions);
+    EXPECT_EQ(sequential.str(), parallel.str());
+}
+
+TEST(DirectEncodingParserTest, CompressedRoundTrip) {
+    if (!storm::utility::isCompressionSupported()) {
+        GTEST_SKIP() << "Storm was built without zlib.";
+    }
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_drn_compression_test.drn.gz").string();
+    storm::api::exportSparseModelAsDrn(model, filename);
+    auto loaded = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(model->getType(), loaded->getType());
+    EXPECT_EQ(model->getNumberOfStates(), loaded->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), loaded->getNumberOfTransitions());
+    EXPECT_TRUE(model->getStateLabeling() == loaded->getStateLabeling());
+}
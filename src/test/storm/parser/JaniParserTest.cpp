@@ -414,3 +414,42 @@ TEST(JaniParser, UnassignedVariablesTest) {
     EXPECT_TRUE(result.first.hasConstant("c"));
     EXPECT_EQ(2ul, result.first.getNumberOfAutomata());
 }
+
+TEST(JaniParser, DeclarationsAfterAutomataTest) {
+    // The automaton refers to a constant and a variable that are only declared after the automata.
+    std::string testInput = R"({
+	"jani-version": 1,
+	"name": "late-declarations",
+	"type": "dtmc",
+	"automata": [
+		{
+			"name": "counter",
+			"locations": [ { "name": "l" } ],
+			"initial-locations": [ "l" ],
+			"edges": [
+				{
+					"location": "l",
+					"guard": { "exp": { "op": "<", "left": "x", "right": "N" } },
+					"destinations": [
+						{
+							"location": "l",
+							"probability": { "exp": 1 },
+							"assignments": [ { "ref": "x", "value": { "op": "+", "left": "x", "right": 1 } } ]
+						}
+					]
+				}
+			]
+		}
+	],
+	"constants": [ { "name": "N", "type": "int", "value": 3 } ],
+	"variables": [ { "name": "x", "type": { "base": "int", "kind": "bounded", "lower-bound": 0, "upper-bound": 3 }, "initial-value": 0 } ],
+	"system": { "elements": [ { "automaton": "counter" } ] }
+})";
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> result;
+    EXPECT_NO_THROW(result = storm::api::parseJaniModelFromString(testInput));
+    EXPECT_EQ(storm::jani::ModelType::DTMC, result.first.getModelType());
+    EXPECT_TRUE(result.first.hasConstant("N"));
+    EXPECT_TRUE(result.first.hasGlobalVariable("x"));
+    ASSERT_EQ(1ul, result.first.getNumberOfAutomata());
+    EXPECT_EQ(1ul, result.first.getAutomaton("counter").getNumberOfEdges());
+}
@@ -1,5 +1,8 @@
 #include <storm/exceptions/InvalidArgumentException.h>
+#include <fstream>
+#include <sstream>
 #include "storm-config.h"
+#include "storm-parsers/parser/FastPrismParser.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "test/storm_gtest.h"
 
@@ -179,6 +182,102 @@ TEST(PrismParser, NAryPredicates) {
     EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
 }
 
+namespace {
+void expectEqualPrograms(std::string const& input) {
+    boost::optional<storm::prism::Program> fastResult;
+    ASSERT_NO_THROW(fastResult = storm::parser::FastPrismParser::parseFromString(input, "testfile"));
+    ASSERT_TRUE(fastResult.is_initialized());
+    storm::prism::Program spiritResult = storm::parser::PrismParser::parseFromString(input, "testfile", false, false);
+
+    std::stringstream fastStream, spiritStream;
+    fastStream << fastResult.get();
+    spiritStream << spiritResult;
+    EXPECT_EQ(spiritStream.str(), fastStream.str());
+    EXPECT_EQ(spiritResult.getActionNameToIndexMapping(), fastResult->getActionNameToIndexMapping());
+    ASSERT_EQ(spiritResult.getNumberOfModules(), fastResult->getNumberOfModules());
+    for (uint64_t moduleIndex = 0; moduleIndex < spiritResult.getNumberOfModules(); ++moduleIndex) {
+        auto const& spiritCommands = spiritResult.getModule(moduleIndex).getCommands();
+        auto const& fastCommands = fastResult->getModule(moduleIndex).getCommands();
+        ASSERT_EQ(spiritCommands.size(), fastCommands.size());
+        for (uint64_t commandIndex = 0; commandIndex < spiritCommands.size(); ++commandIndex) {
+            EXPECT_EQ(spiritCommands[commandIndex].getGlobalIndex(), fastCommands[commandIndex].getGlobalIndex());
+            EXPECT_EQ(spiritCommands[commandIndex].getActionIndex(), fastCommands[commandIndex].getActionIndex());
+            ASSERT_EQ(spiritCommands[commandIndex].getNumberOfUpdates(), fastCommands[commandIndex].getNumberOfUpdates());
+            for (uint64_t updateIndex = 0; updateIndex < spiritCommands[commandIndex].getNumberOfUpdates(); ++updateIndex) {
+                EXPECT_EQ(spiritCommands[commandIndex].getUpdate(updateIndex).getGlobalIndex(),
+                          fastCommands[commandIndex].getUpdate(updateIndex).getGlobalIndex());
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(PrismParser, FastParserTest) {
+    for (std::string const& filename : {"/mdp/coin2.nm", "/dtmc/crowds5_5.pm", "/mdp/csma2_2.nm", "/dtmc/die.pm", "/mdp/firewire.nm", "/mdp/leader3.nm",
+                                        "/dtmc/leader3_5.pm", "/mdp/two_dice.nm", "/mdp/wlan0_collide.nm"}) {
+        std::ifstream stream(STORM_TEST_RESOURCES_DIR + filename);
+        std::string input((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        expectEqualPrograms(input);
+    }
+
+    std::string testInput =
+        R"(mdp
+
+    const int N = 3;
+    const double p = 0.25;
+    const double q = 1.5e-1;
+    formula done = x = N & y = N;
+    formula step = min(N - x, 1, 2);
+
+    global g : bool;
+
+    module first
+        x : [0..N];
+        b : bool;
+        [a] !done & x < N -> p : (x'=x+step) & (b'=!b) + 1-p : true;
+        [reset] x = N -> (x'=0);
+        [] g => b -> 1 : (g'=false);
+    endmodule
+
+    module second = first [x=y, b=c, a=c1] endmodule
+
+    init
+        x = 0 & y = 0 & !g
+    endinit
+
+    rewards "steps"
+        [a] true : 1;
+        [c1] x > 0 -> true : q;
+        done : pow(2, x) + mod(y, 2) + floor(p) + ceil(q) + -x;
+    endrewards
+
+    label "done" = done | exactlyOneOf(b, c, g);
+    )";
+    expectEqualPrograms(testInput);
+
+    testInput =
+        R"(dtmc
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c < 3 -> 2 (c' = c+1);
+    endmodule)";
+    EXPECT_FALSE(storm::parser::FastPrismParser::parseFromString(testInput, "testfile").is_initialized());
+
+    testInput =
+        R"(dtmc
+
+    module mod1
+        c : [0 .. 8] init 1;
+        [] c < 3 -> 1: (c' = c+1);
+    endmodule
+
+    system mod1 endsystem)";
+    EXPECT_FALSE(storm::parser::FastPrismParser::parseFromString(testInput, "testfile").is_initialized());
+    storm::prism::Program result;
+    EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+}
+
 TEST(PrismParser, IllegalInputTest) {
     std::string testInput =
         R"(ctmc
@@ -6,6 +6,10 @@
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/permissivesched/PermissiveSchedulers.h"
+#include "storm/permissivesched/SmtBasedPermissiveSchedulers.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/solver.h"
 #include "test/storm_gtest.h"
 
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
@@ -60,3 +64,57 @@ TEST(SmtPermissiveSchedulerTest, DieSelection) {
 
     //
 }
+
+TEST(SmtPermissiveSchedulerTest, ReuseEncoding) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildAllLabels();
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::BitVector goalstates = mdp->getStates("one");
+    storm::storage::BitVector sinkstates =
+        storm::utility::graph::performProb0A(mdp->getBackwardTransitions(), storm::storage::BitVector(goalstates.size(), true), goalstates);
+
+    auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
+    auto solver = storm::utility::solver::getSmtSolver(*expressionManager);
+    storm::ps::SmtPermissiveSchedulerComputation<storm::models::sparse::StandardRewardModel<double>> comp(*solver, *mdp, goalstates, sinkstates);
+
+    // Reaching "one" with probability at most 0.16 requires disabling the fair coin in the initial state.
+    comp.calculatePermissiveScheduler(false, 0.16);
+    ASSERT_TRUE(comp.foundSolution());
+    EXPECT_EQ(mdp->getNumberOfChoices() - 1, comp.getScheduler().apply().getNumberOfChoices());
+
+    // The encoding is reused for other bounds and penalties.
+    comp.calculatePermissiveScheduler(false, 0.17);
+    ASSERT_TRUE(comp.foundSolution());
+    EXPECT_EQ(mdp->getNumberOfChoices(), comp.getScheduler().apply().getNumberOfChoices());
+    comp.calculatePermissiveScheduler(false, 0.05);
+    EXPECT_FALSE(comp.foundSolution());
+    comp.getPenalties().set(0, 1, 2.0);
+    comp.calculatePermissiveScheduler(false, 0.16);
+    ASSERT_TRUE(comp.foundSolution());
+    EXPECT_EQ(mdp->getNumberOfChoices() - 1, comp.getScheduler().apply().getNumberOfChoices());
+}
+
+TEST(SmtPermissiveSchedulerTest, Portfolio) {
+    storm::Environment env;
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    auto formulas = formulaParser.parseFromString("P>=0.10 [ F \"one\"];\nP<=0.05 [ F \"one\"];\n");
+    auto const& formula010 = formulas[0].getRawFormula()->asProbabilityOperatorFormula();
+    auto const& formula005b = formulas[1].getRawFormula()->asProbabilityOperatorFormula();
+
+    storm::generator::NextStateGeneratorOptions options(formula010);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+        storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    // Both computations agree on these properties, so the result does not depend on which computation finishes first.
+    boost::optional<storm::ps::SubMDPPermissiveScheduler<>> perms = storm::ps::computePermissiveSchedulerViaPortfolio<>(*mdp, formula010);
+    ASSERT_TRUE(perms.is_initialized());
+    EXPECT_FALSE(storm::ps::computePermissiveSchedulerViaPortfolio<>(*mdp, formula005b).is_initialized());
+
+    auto submdp = perms->apply();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(submdp);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, formula010);
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[0]);
+}
@@ -0,0 +1,85 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// State 0 moves to state i in {1, ..., 10} with probability i/55 and all other states move back to state 0.
+// The reward of a state is its index.
+storm::models::sparse::Dtmc<double> createWideRowDtmc() {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    for (uint64_t column = 1; column <= 10; ++column) {
+        builder.addNextValue(0, column, column / 55.0);
+    }
+    for (uint64_t row = 1; row <= 10; ++row) {
+        builder.addNextValue(row, 0, 1.0);
+    }
+    storm::models::sparse::StateLabeling labeling(11);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    std::vector<double> stateRewards;
+    for (uint64_t state = 0; state <= 10; ++state) {
+        stateRewards.push_back(state);
+    }
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+    rewardModels.emplace("index", storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards)));
+    return storm::models::sparse::Dtmc<double>(builder.build(), labeling, rewardModels);
+}
+
+TEST(DiscreteTimeSparseModelSimulatorTest, SingleTrace) {
+    auto dtmc = createWideRowDtmc();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(dtmc);
+    simulator.setSeed(42);
+
+    uint64_t const numberOfSamples = 20000;
+    std::vector<uint64_t> visits(11, 0);
+    for (uint64_t sample = 0; sample < numberOfSamples; ++sample) {
+        ASSERT_TRUE(simulator.randomStep());
+        uint64_t state = simulator.getCurrentState();
+        ASSERT_TRUE(state >= 1 && state <= 10);
+        EXPECT_EQ(static_cast<double>(state), simulator.getLastRewards()[0]);
+        ++visits[state];
+        ASSERT_TRUE(simulator.randomStep());
+        EXPECT_EQ(0ul, simulator.getCurrentState());
+    }
+    for (uint64_t state = 1; state <= 10; ++state) {
+        EXPECT_NEAR(state / 55.0, static_cast<double>(visits[state]) / numberOfSamples, 0.01);
+    }
+}
+
+TEST(DiscreteTimeSparseModelSimulatorTest, Batch) {
+    auto dtmc = createWideRowDtmc();
+    storm::simulator::DiscreteTimeSparseModelSimulator<double> simulator(dtmc);
+    simulator.setSeed(42);
+
+    uint64_t const numberOfTraces = 20000;
+    simulator.initializeBatch(numberOfTraces);
+    EXPECT_EQ(numberOfTraces, simulator.randomStepBatch());
+    EXPECT_EQ(numberOfTraces, simulator.randomStepBatch());
+    EXPECT_EQ(numberOfTraces, simulator.randomStepBatch());
+
+    // After three steps, every trace is in a state between 1 and 10 and collected the rewards of two such states.
+    std::vector<uint64_t> visits(11, 0);
+    ASSERT_EQ(numberOfTraces, simulator.getBatchStates().size());
+    ASSERT_EQ(numberOfTraces, simulator.getBatchRewards().size());
+    double totalReward = 0.0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        uint64_t state = simulator.getBatchStates()[trace];
+        ASSERT_TRUE(state >= 1 && state <= 10);
+        ++visits[state];
+        EXPECT_GE(simulator.getBatchRewards()[trace], 1.0 + state);
+        EXPECT_LE(simulator.getBatchRewards()[trace], 10.0 + state);
+        totalReward += simulator.getBatchRewards()[trace];
+    }
+    for (uint64_t state = 1; state <= 10; ++state) {
+        EXPECT_NEAR(state / 55.0, static_cast<double>(visits[state]) / numberOfTraces, 0.01);
+    }
+    // The expected reward of a visit of a state between 1 and 10 is 385/55 = 7.
+    EXPECT_NEAR(14.0, totalReward / numberOfTraces, 0.1);
+}
+
+}  // namespace
@@ -0,0 +1,54 @@
+#include "storm/simulator/JaniProgramSimulator.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/storage/jani/Model.h"
+#include "test/storm_gtest.h"
+
+TEST(JaniProgramSimulatorTest, DieTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::jani::Model model = program.toJani().substituteConstantsFunctions();
+    storm::expressions::Expression done = program.getLabelExpression("done");
+    storm::expressions::Expression one = program.getLabelExpression("one");
+
+    storm::simulator::DiscreteTimeJaniProgramSimulator<double> sim(model, storm::generator::NextStateGeneratorOptions());
+    sim.setSeed(42);
+    EXPECT_FALSE(sim.satisfies(done));
+
+    uint64_t numberOfTraces = 10000;
+    uint64_t numberOfOnes = 0;
+    for (uint64_t trace = 0; trace < numberOfTraces; ++trace) {
+        sim.resetToInitial();
+        uint64_t steps = 0;
+        while (!sim.satisfies(done)) {
+            ASSERT_TRUE(sim.step());
+            ++steps;
+        }
+        EXPECT_LE(3ul, steps);
+        if (sim.satisfies(one)) {
+            ++numberOfOnes;
+        }
+    }
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfOnes) / numberOfTraces, 0.02);
+
+    // The final states have a self-loop.
+    storm::expressions::SimpleValuation valuation = sim.getCurrentStateAsValuation();
+    EXPECT_TRUE(sim.step());
+    EXPECT_EQ(valuation, sim.getCurrentStateAsValuation());
+}
+
+TEST(JaniProgramSimulatorTest, SynchronizationTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    storm::jani::Model model = program.toJani().substituteConstantsFunctions();
+    storm::expressions::Expression elected = program.getLabelExpression("elected");
+
+    storm::simulator::DiscreteTimeJaniProgramSimulator<double> sim(model, storm::generator::NextStateGeneratorOptions());
+    sim.setSeed(42);
+    for (uint64_t trace = 0; trace < 100; ++trace) {
+        sim.resetToInitial();
+        uint64_t steps = 0;
+        while (!sim.satisfies(elected) && steps < 1000) {
+            ASSERT_TRUE(sim.step());
+            ++steps;
+        }
+        EXPECT_TRUE(sim.satisfies(elected));
+    }
+}
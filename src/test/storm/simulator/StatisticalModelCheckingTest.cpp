@@ -0,0 +1,53 @@
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/simulator/BoundedReachabilitySampler.h"
+#include "storm/simulator/StatisticalTests.h"
+
+TEST(StatisticalModelCheckingTest, SequentialProbabilityRatioTest) {
+    storm::simulator::SequentialProbabilityRatioTest above(0.5, 0.05, 0.01, 0.01);
+    EXPECT_EQ(storm::simulator::SequentialProbabilityRatioTest::Decision::Undecided, above.getDecision());
+    above.addSamples(1000, 800);
+    EXPECT_EQ(storm::simulator::SequentialProbabilityRatioTest::Decision::AboveThreshold, above.getDecision());
+    EXPECT_EQ(1000ul, above.getNumberOfSamples());
+    EXPECT_EQ(800ul, above.getNumberOfSuccesses());
+
+    storm::simulator::SequentialProbabilityRatioTest below(0.5, 0.05, 0.01, 0.01);
+    below.addSamples(1000, 200);
+    EXPECT_EQ(storm::simulator::SequentialProbabilityRatioTest::Decision::BelowThreshold, below.getDecision());
+
+    // The indifference region touches zero, so a single success rules out the lower hypothesis.
+    storm::simulator::SequentialProbabilityRatioTest border(0.01, 0.01, 0.01, 0.01);
+    border.addSamples(1, 1);
+    EXPECT_EQ(storm::simulator::SequentialProbabilityRatioTest::Decision::AboveThreshold, border.getDecision());
+}
+
+TEST(StatisticalModelCheckingTest, SampleSizes) {
+    EXPECT_EQ(18445ul, storm::simulator::getChernoffHoeffdingNumberOfSamples(0.01, 0.05));
+
+    auto interval = storm::simulator::getClopperPearsonInterval(100, 50, 0.05);
+    EXPECT_NEAR(0.3983, interval.first, 1e-4);
+    EXPECT_NEAR(0.6017, interval.second, 1e-4);
+
+    interval = storm::simulator::getClopperPearsonInterval(100, 0, 0.05);
+    EXPECT_EQ(0.0, interval.first);
+    EXPECT_NEAR(0.0362, interval.second, 1e-4);
+}
+
+TEST(StatisticalModelCheckingTest, SampleDieTraces) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::expressions::Expression condition = program.getManager().boolean(true);
+    storm::expressions::Expression target = program.getLabelExpression("one");
+
+    storm::simulator::BoundedReachabilitySampler<double> sampler(program, condition, target, 100, 1000, 42);
+    uint64_t numberOfTraces = 100000;
+    uint64_t numberOfSatisfyingTraces = sampler.sampleBatch(numberOfTraces);
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfSatisfyingTraces) / numberOfTraces, 0.01);
+    EXPECT_EQ(13ul, sampler.getNumberOfCachedStates());
+
+    // A small cache is flushed between traces, which does not affect the result.
+    storm::simulator::BoundedReachabilitySampler<double> smallSampler(program, condition, target, 100, 2, 42);
+    numberOfSatisfyingTraces = smallSampler.sampleBatch(numberOfTraces);
+    EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfSatisfyingTraces) / numberOfTraces, 0.01);
+    EXPECT_LE(smallSampler.getNumberOfCachedStates(), 13ul);
+}
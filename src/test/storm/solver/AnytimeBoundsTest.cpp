@@ -0,0 +1,89 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/AnytimeBounds.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace {
+
+/*!
+ * Solves a small system with the given method, but aborts the solver right away.
+ */
+std::shared_ptr<storm::solver::AnytimeBounds> solveAborted(storm::solver::MinMaxMethod const& method, double& result) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(method);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    auto bounds = std::make_shared<storm::solver::AnytimeBounds>();
+    env.solver().setAnytimeBounds(bounds);
+
+    // A single state with a self loop (probability 0.9) and a choice without outgoing transitions.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+
+    std::atomic<bool> terminate(true);
+    storm::utility::resources::setThreadTerminationFlag(&terminate);
+    EXPECT_FALSE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    storm::utility::resources::setThreadTerminationFlag(nullptr);
+    result = x[0];
+    return bounds;
+}
+
+TEST(AnytimeBoundsTest, IntervalIteration) {
+    double result;
+    auto bounds = solveAborted(storm::solver::MinMaxMethod::IntervalIteration, result);
+    EXPECT_TRUE(bounds->hasAbortedSolver());
+    ASSERT_TRUE(bounds->getErrorBound().is_initialized());
+    EXPECT_LE(bounds->getErrorBound().get(), 1.0);
+    EXPECT_LE(std::abs(result - 0.5), bounds->getErrorBound().get());
+}
+
+TEST(AnytimeBoundsTest, SoundValueIteration) {
+    double result;
+    auto bounds = solveAborted(storm::solver::MinMaxMethod::SoundValueIteration, result);
+    EXPECT_TRUE(bounds->hasAbortedSolver());
+    if (bounds->getErrorBound()) {
+        EXPECT_LE(std::abs(result - 0.5), bounds->getErrorBound().get());
+    }
+}
+
+TEST(AnytimeBoundsTest, ValueIteration) {
+    double result;
+    auto bounds = solveAborted(storm::solver::MinMaxMethod::ValueIteration, result);
+    // Value iteration gives no guarantees if it is aborted.
+    EXPECT_TRUE(bounds->hasAbortedSolver());
+    EXPECT_FALSE(bounds->getErrorBound().is_initialized());
+}
+
+TEST(AnytimeBoundsTest, Accumulation) {
+    storm::solver::AnytimeBounds bounds;
+    EXPECT_FALSE(bounds.hasAbortedSolver());
+    ASSERT_TRUE(bounds.getErrorBound().is_initialized());
+    EXPECT_EQ(0.0, bounds.getErrorBound().get());
+    bounds.recordAbortedSolver(0.25);
+    bounds.recordAbortedSolver(0.5);
+    EXPECT_TRUE(bounds.hasAbortedSolver());
+    EXPECT_EQ(0.75, bounds.getErrorBound().get());
+    bounds.recordAbortedSolver(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_FALSE(bounds.getErrorBound().is_initialized());
+    bounds.reset();
+    EXPECT_FALSE(bounds.hasAbortedSolver());
+    EXPECT_EQ(0.0, bounds.getErrorBound().get());
+}
+
+}  // namespace
@@ -0,0 +1,83 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
+#include "storm/solver/helper/DenseEquationSystemSolver.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+TEST(DenseEquationSystemSolverTest, Double) {
+    // The first pivot is zero, so rows have to be swapped.
+    std::vector<double> matrix = {0, 2, 1, 1, 1, 1, 2, 1, 0};
+    std::vector<double> b = {7, 6, 4};
+    ASSERT_TRUE(storm::solver::helper::solveDenseEquationSystem<double>(3, matrix, b));
+    EXPECT_NEAR(1.0, b[0], 1e-12);
+    EXPECT_NEAR(2.0, b[1], 1e-12);
+    EXPECT_NEAR(3.0, b[2], 1e-12);
+
+    std::vector<double> singular = {1, 1, 2, 2};
+    std::vector<double> c = {1, 2};
+    EXPECT_FALSE(storm::solver::helper::solveDenseEquationSystem<double>(2, singular, c));
+}
+
+TEST(DenseEquationSystemSolverTest, Rational) {
+    typedef storm::RationalNumber ValueType;
+    auto n = [](std::string const& input) { return storm::utility::convertNumber<ValueType>(input); };
+    std::vector<ValueType> matrix = {n("0"), n("1/2"), n("1/3"), n("1")};
+    std::vector<ValueType> b = {n("1"), n("1")};
+    ASSERT_TRUE(storm::solver::helper::solveDenseEquationSystem<ValueType>(2, matrix, b));
+    EXPECT_EQ(n("1/3"), b[0]);
+    EXPECT_EQ(n("2"), b[1]);
+}
+
+TEST(DenseEquationSystemSolverTest, ConcurrentVisitingTimes) {
+    // A chain of SCCs. Each SCC is a cycle that is left with probability 1/4 from its first state.
+    // The last state is absorbing. SCCs of up to 40 states are created such that both the dense and the sparse solver are used.
+    std::vector<uint64_t> sccSizes = {1, 2, 3, 5, 40, 7, 33, 1, 4};
+    uint64_t numberOfStates = 1;
+    for (auto const& size : sccSizes) {
+        numberOfStates += size;
+    }
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    // The first state of an SCC is visited four times on average, the remaining states are visited three times.
+    std::vector<double> expectedResult(numberOfStates, 3.0);
+    uint64_t first = 0;
+    for (auto const& size : sccSizes) {
+        expectedResult[first] = 4.0;
+        for (uint64_t state = first; state < first + size; ++state) {
+            if (state == first) {
+                builder.addNextValue(state, first + size, 0.25);
+                if (size > 1) {
+                    builder.addNextValue(state, state + 1, 0.75);
+                } else {
+                    builder.addNextValue(state, state, 0.75);
+                }
+            } else {
+                builder.addNextValue(state, state + 1 < first + size ? state + 1 : first, 1.0);
+            }
+        }
+        first += size;
+    }
+    builder.addNextValue(numberOfStates - 1, numberOfStates - 1, 1.0);
+    auto matrix = builder.build();
+
+    storm::Environment env;
+    storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<double> sequentialHelper(matrix);
+    auto sequentialResult = sequentialHelper.computeExpectedVisitingTimes(env, static_cast<uint64_t>(0));
+    env.solver().topological().setNumberOfThreads(4);
+    env.solver().topological().setBatchSize(4);
+    storm::modelchecker::helper::SparseDeterministicVisitingTimesHelper<double> concurrentHelper(matrix);
+    auto concurrentResult = concurrentHelper.computeExpectedVisitingTimes(env, static_cast<uint64_t>(0));
+
+    ASSERT_EQ(numberOfStates, concurrentResult.size());
+    for (uint64_t state = 0; state + 1 < numberOfStates; ++state) {
+        EXPECT_NEAR(expectedResult[state], sequentialResult[state], 1e-4) << "state " << state;
+        EXPECT_NEAR(expectedResult[state], concurrentResult[state], 1e-4) << "state " << state;
+    }
+    EXPECT_TRUE(storm::utility::isInfinity(concurrentResult.back()));
+}
+
+}  // namespace
@@ -23,6 +23,19 @@ class DoubleViEnvironment {
     }
 };
 
+class DoubleViParallelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().game().setMethod(storm::solver::GameMethod::ValueIteration);
+        env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().game().setNumberOfThreads(4);
+        return env;
+    }
+};
+
 class DoublePiEnvironment {
    public:
     typedef double ValueType;
@@ -68,7 +81,7 @@ class GameSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
+typedef ::testing::Types<DoubleViEnvironment, DoubleViParallelEnvironment, DoublePiEnvironment, RationalPiEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(GameSolverTest, TestingTypes, );
 
@@ -132,4 +145,40 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TEST(GameSolverTest, IntervalIteration) {
+    storm::Environment env;
+    env.solver().game().setMethod(storm::solver::GameMethod::IntervalIteration);
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    // Player 1 state 0 chooses between player 2 states 0 and 1, player 1 state 1 only has player 2 state 2.
+    storm::storage::SparseMatrixBuilder<double> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 0, 0.5);
+    player2MatrixBuilder.addNextValue(0, 1, 0.5);
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 0, 0.9);
+    player2MatrixBuilder.newRowGroup(3);
+    player2MatrixBuilder.addNextValue(4, 1, 0.5);
+    storm::storage::SparseMatrix<double> player2Matrix = player2MatrixBuilder.build(5, 2, 3);
+    std::vector<double> b = {0.0, 0.3, 0.05, 1.0, 0.25};
+
+    storm::solver::GameSolverFactory<double> factory;
+    auto solver = factory.create(env, std::vector<uint64_t>({0, 2, 3}), player2Matrix);
+    solver->setBounds(0.0, 1.0);
+    solver->setHasUniqueSolution(true);
+
+    std::vector<double> result(2);
+    solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Maximize, result, b);
+    EXPECT_NEAR(1.0, result[0], 1e-6);
+    EXPECT_NEAR(1.0, result[1], 1e-6);
+
+    solver->solveGame(env, storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Minimize, result, b);
+    EXPECT_NEAR(0.3, result[0], 1e-6);
+    EXPECT_NEAR(0.5, result[1], 1e-6);
+
+    solver->solveGame(env, storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, result, b);
+    EXPECT_NEAR(0.5, result[0], 1e-6);
+    EXPECT_NEAR(0.5, result[1], 1e-6);
+}
+
 }  // namespace
@@ -3,10 +3,16 @@
 
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/NativeLinearEquationSolver.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/utility/parallel.h"
+#include "storm/utility/stateelimination.h"
 #include "storm/utility/vector.h"
 namespace {
 
@@ -38,6 +44,23 @@ class NativeDoubleSoundValueIterationEnvironment {
     }
 };
 
+class NativeDoubleParallelSoundValueIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SoundValueIteration);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        env.solver().multiplier().setGaussSeidelBlockSize(1);
+        return env;
+    }
+};
+
 class NativeDoubleOptimisticValueIterationEnvironment {
    public:
     typedef double ValueType;
@@ -53,6 +76,22 @@ class NativeDoubleOptimisticValueIterationEnvironment {
     }
 };
 
+class NativeDoubleConcurrentOptimisticValueIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::OptimisticValueIteration);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        return env;
+    }
+};
+
 class NativeDoubleIntervalIterationEnvironment {
    public:
     typedef double ValueType;
@@ -68,6 +107,22 @@ class NativeDoubleIntervalIterationEnvironment {
     }
 };
 
+class NativeDoubleAsynchronousIntervalIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::AsynchronousIntervalIteration);
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        return env;
+    }
+};
+
 class NativeDoubleJacobiEnvironment {
    public:
     typedef double ValueType;
@@ -107,6 +162,20 @@ class NativeDoubleSorEnvironment {
     }
 };
 
+class NativeDoubleTargetDistanceGaussSeidelEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+        env.solver().native().setGaussSeidelOrdering(storm::solver::GaussSeidelOrdering::TargetDistance);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
 class NativeDoubleWalkerChaeEnvironment {
    public:
     typedef double ValueType;
@@ -133,6 +202,17 @@ class NativeRationalRationalSearchEnvironment {
     }
 };
 
+class RationalFloatFirstEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setExactFloatFirst(true);
+        return env;
+    }
+};
+
 class EliminationRationalEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -312,9 +392,13 @@ class LinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoubleSoundValueIterationEnvironment, NativeDoubleOptimisticValueIterationEnvironment,
-                         NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
-                         NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoubleSoundValueIterationEnvironment, NativeDoubleParallelSoundValueIterationEnvironment,
+                         NativeDoubleOptimisticValueIterationEnvironment, NativeDoubleConcurrentOptimisticValueIterationEnvironment,
+                         NativeDoubleIntervalIterationEnvironment,
+                         NativeDoubleAsynchronousIntervalIterationEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
+                         NativeDoubleTargetDistanceGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
+                         NativeRationalRationalSearchEnvironment, RationalFloatFirstEnvironment,
+                         EliminationRationalEnvironment,
                          GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment,
                          EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment,
                          EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment>
@@ -358,4 +442,223 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
-}  // namespace
\ No newline at end of file
+
+TYPED_TEST(LinearEquationSolverTest, solveEquationSystemBatch) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    builder.addNextValue(0, 0, this->parseNumber("1/5"));
+    builder.addNextValue(0, 1, this->parseNumber("2/5"));
+    builder.addNextValue(0, 2, this->parseNumber("2/5"));
+    builder.addNextValue(1, 0, this->parseNumber("1/50"));
+    builder.addNextValue(1, 1, this->parseNumber("48/50"));
+    builder.addNextValue(1, 2, this->parseNumber("1/50"));
+    builder.addNextValue(2, 0, this->parseNumber("4/10"));
+    builder.addNextValue(2, 1, this->parseNumber("3/10"));
+    builder.addNextValue(2, 2, this->parseNumber("0"));
+    storm::storage::SparseMatrix<ValueType> A = builder.build();
+
+    // The second right-hand side is the negated first one, so the solutions are negated as well.
+    std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(3));
+    std::vector<std::vector<ValueType>> b = {{this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")},
+                                             {this->parseNumber("-3"), this->parseNumber("0.01"), this->parseNumber("-12")}};
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+    }
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("481/9"), this->precision());
+    EXPECT_NEAR(x[0][1], this->parseNumber("457/9"), this->precision());
+    EXPECT_NEAR(x[0][2], this->parseNumber("875/18"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("-481/9"), this->precision());
+    EXPECT_NEAR(x[1][1], this->parseNumber("-457/9"), this->precision());
+    EXPECT_NEAR(x[1][2], this->parseNumber("-875/18"), this->precision());
+}
+
+TYPED_TEST(LinearEquationSolverTest, updateMatrix) {
+    typedef typename TestFixture::ValueType ValueType;
+    auto buildMatrix = [this](std::string const& lastRowFirstValue, std::string const& lastRowSecondValue) {
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        builder.addNextValue(0, 0, this->parseNumber("1/5"));
+        builder.addNextValue(0, 1, this->parseNumber("2/5"));
+        builder.addNextValue(0, 2, this->parseNumber("2/5"));
+        builder.addNextValue(1, 0, this->parseNumber("1/50"));
+        builder.addNextValue(1, 1, this->parseNumber("48/50"));
+        builder.addNextValue(1, 2, this->parseNumber("1/50"));
+        builder.addNextValue(2, 0, this->parseNumber(lastRowFirstValue));
+        builder.addNextValue(2, 1, this->parseNumber(lastRowSecondValue));
+        builder.addNextValue(2, 2, this->parseNumber("0"));
+        return builder.build();
+    };
+    storm::storage::SparseMatrix<ValueType> A = buildMatrix("4/10", "3/10");
+    storm::storage::SparseMatrix<ValueType> updatedA = buildMatrix("1/10", "6/10");
+
+    auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+    if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        A.convertToEquationSystem();
+        updatedA.convertToEquationSystem();
+    }
+    std::vector<ValueType> x(3);
+    std::vector<ValueType> b = {this->parseNumber("3"), this->parseNumber("-0.01"), this->parseNumber("12")};
+    auto solver = factory.create(this->env(), A);
+    solver->setBounds(this->parseNumber("-100"), this->parseNumber("100"));
+    solver->setCachingEnabled(true);
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("481/9"), this->precision());
+
+    // Data that was cached for the first matrix must not be used where the matrices differ.
+    storm::storage::BitVector changedRows(3);
+    changedRows.set(2);
+    solver->updateMatrix(std::move(updatedA), changedRows);
+    ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+    EXPECT_NEAR(x[0], this->parseNumber("457/9"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("433/9"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("827/18"), this->precision());
+}
+}  // namespace
+
+TEST(EliminationLinearEquationSolverTest, ConcurrentElimination) {
+    // A banded system in which many states share neighbours, such that the eliminations interfere.
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    std::vector<double> b(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<uint64_t> successors = {(state + numberOfStates - 1) % numberOfStates, (state + 1) % numberOfStates,
+                                            (state + 37) % numberOfStates};
+        std::sort(successors.begin(), successors.end());
+        for (auto successor : successors) {
+            builder.addNextValue(state, successor, 0.3);
+        }
+        b[state] = static_cast<double>(state % 7);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    storm::Environment env;
+    storm::solver::EliminationLinearEquationSolver<double> solver(A);
+    std::vector<double> sequentialResult(numberOfStates);
+    ASSERT_TRUE(solver.solveEquations(env, sequentialResult, b));
+
+    storm::utility::parallel::setDefaultNumberOfThreads(4);
+    std::vector<double> concurrentResult(numberOfStates);
+    ASSERT_TRUE(solver.solveEquations(env, concurrentResult, b));
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+
+    // The solution satisfies x = Ax + b.
+    std::vector<double> fixedPoint(numberOfStates);
+    A.multiplyWithVector(concurrentResult, fixedPoint, &b);
+    EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(concurrentResult, fixedPoint, 1e-8, false));
+    EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(sequentialResult, concurrentResult, 1e-8, false));
+}
+
+TEST(LinearEquationSolverTest, ParallelKrylovSolvers) {
+    uint64_t const numberOfStates = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    std::vector<double> b(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::vector<uint64_t> successors = {(state + numberOfStates - 1) % numberOfStates, (state + 1) % numberOfStates,
+                                            (state + 37) % numberOfStates};
+        std::sort(successors.begin(), successors.end());
+        for (auto successor : successors) {
+            builder.addNextValue(state, successor, 0.3);
+        }
+        b[state] = static_cast<double>(state % 7);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+    storm::storage::SparseMatrix<double> equationSystem = A;
+    equationSystem.convertToEquationSystem();
+
+    std::vector<storm::Environment> environments;
+    for (auto preconditioner : {storm::solver::GmmxxLinearEquationSolverPreconditioner::Ilu, storm::solver::GmmxxLinearEquationSolverPreconditioner::Diagonal,
+                                storm::solver::GmmxxLinearEquationSolverPreconditioner::None}) {
+        for (auto method : {storm::solver::GmmxxLinearEquationSolverMethod::Bicgstab, storm::solver::GmmxxLinearEquationSolverMethod::Gmres}) {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+            env.solver().gmmxx().setMethod(method);
+            env.solver().gmmxx().setPreconditioner(preconditioner);
+            env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            environments.push_back(env);
+        }
+    }
+    for (auto method : {storm::solver::EigenLinearEquationSolverMethod::Bicgstab, storm::solver::EigenLinearEquationSolverMethod::Gmres}) {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().eigen().setMethod(method);
+        env.solver().eigen().setPreconditioner(storm::solver::EigenLinearEquationSolverPreconditioner::Ilu);
+        env.solver().eigen().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        environments.push_back(env);
+    }
+
+    storm::solver::GeneralLinearEquationSolverFactory<double> factory;
+    for (auto const& env : environments) {
+        auto solver = factory.create(env, equationSystem);
+        std::vector<double> sequentialResult(numberOfStates);
+        ASSERT_TRUE(solver->solveEquations(env, sequentialResult, b));
+
+        storm::utility::parallel::setDefaultNumberOfThreads(4);
+        std::vector<double> parallelResult(numberOfStates);
+        bool converged = solver->solveEquations(env, parallelResult, b);
+        storm::utility::parallel::setDefaultNumberOfThreads(1);
+        ASSERT_TRUE(converged);
+
+        // The solution satisfies x = Ax + b.
+        std::vector<double> fixedPoint(numberOfStates);
+        A.multiplyWithVector(parallelResult, fixedPoint, &b);
+        EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(parallelResult, fixedPoint, 1e-6, false));
+        EXPECT_TRUE(storm::utility::vector::equalModuloPrecision(sequentialResult, parallelResult, 1e-6, false));
+    }
+}
+
+TEST(EliminationLinearEquationSolverTest, ApproximateMinimumDegree) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.25);
+    builder.addNextValue(0, 2, 0.25);
+    builder.addNextValue(1, 0, 0.5);
+    builder.addNextValue(2, 2, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = A.transpose();
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(A);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(backwardTransitions, true);
+    std::vector<double> oneStepProbabilities(3, 0.0);
+
+    // Self-loops are not counted, but states that are both predecessor and successor are counted twice.
+    EXPECT_EQ(3ull, storm::utility::stateelimination::computeStatePenaltyApproximateMinimumDegree<double>(0, flexibleMatrix, flexibleBackwardTransitions,
+                                                                                                            oneStepProbabilities));
+    EXPECT_EQ(2ull, storm::utility::stateelimination::computeStatePenaltyApproximateMinimumDegree<double>(1, flexibleMatrix, flexibleBackwardTransitions,
+                                                                                                            oneStepProbabilities));
+    EXPECT_EQ(1ull, storm::utility::stateelimination::computeStatePenaltyApproximateMinimumDegree<double>(2, flexibleMatrix, flexibleBackwardTransitions,
+                                                                                                            oneStepProbabilities));
+}
+
+TEST(NativeLinearEquationSolverTest, TargetDistanceGaussSeidelOrdering) {
+    // A chain in which the value of each row depends on the previous one, which is the worst case for the (backward) Gauss-Seidel sweep.
+    uint64_t const numberOfRows = 10;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfRows, numberOfRows);
+    builder.addNextValue(0, 0, 1.0);
+    for (uint64_t row = 1; row < numberOfRows; ++row) {
+        builder.addNextValue(row, row - 1, -0.5);
+        builder.addNextValue(row, row, 1.0);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b(numberOfRows, 0.0);
+    b[0] = 0.5;
+
+    storm::Environment env;
+    env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+    env.solver().native().setMaximalNumberOfIterations(3);
+    storm::solver::NativeLinearEquationSolver<double> solver(A);
+    std::vector<double> x(numberOfRows, 0.0);
+    EXPECT_FALSE(solver.solveEquations(env, x, b));
+
+    // Sweeping the rows in the order of their distance to the first row yields the solution after one sweep.
+    env.solver().native().setGaussSeidelOrdering(storm::solver::GaussSeidelOrdering::TargetDistance);
+    x.assign(numberOfRows, 0.0);
+    EXPECT_TRUE(solver.solveEquations(env, x, b));
+    double expected = 0.5;
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        EXPECT_NEAR(expected, x[row], 1e-12) << row;
+        expected *= 0.5;
+    }
+}
@@ -4,9 +4,12 @@
 #include "test/storm_gtest.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/PortfolioMinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
 
@@ -37,6 +40,21 @@ class DoubleSoundViEnvironment {
     }
 };
 
+class DoubleParallelSoundViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        env.solver().multiplier().setGaussSeidelBlockSize(1);
+        return env;
+    }
+};
+
 class DoubleIntervalIterationEnvironment {
    public:
     typedef double ValueType;
@@ -50,6 +68,34 @@ class DoubleIntervalIterationEnvironment {
     }
 };
 
+class DoubleMixedPrecisionIntervalIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setMixedPrecision(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
+class DoubleAsynchronousIntervalIterationEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::AsynchronousIntervalIteration);
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
 class DoubleOptimisticViEnvironment {
    public:
     typedef double ValueType;
@@ -63,6 +109,20 @@ class DoubleOptimisticViEnvironment {
     }
 };
 
+class DoubleConcurrentOptimisticViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::OptimisticValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+        return env;
+    }
+};
+
 class DoubleTopologicalViEnvironment {
    public:
     typedef double ValueType;
@@ -76,6 +136,20 @@ class DoubleTopologicalViEnvironment {
     }
 };
 
+class DoubleTopologicalSoundViEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+        env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
 class DoubleTopologicalCudaViEnvironment {
    public:
     typedef double ValueType;
@@ -101,6 +175,41 @@ class DoublePIEnvironment {
         return env;
     }
 };
+class DoubleModifiedPIEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ModifiedPolicyIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().minMax().setPolicyEvaluationSweeps(5);
+        return env;
+    }
+};
+class DoublePortfolioEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
+class DoublePortfolioRaceEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+        env.solver().minMax().setPortfolioRace(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+};
 class RationalPIEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -111,6 +220,16 @@ class RationalPIEnvironment {
         return env;
     }
 };
+class RationalPortfolioEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+        return env;
+    }
+};
 class RationalRationalSearchEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -121,6 +240,16 @@ class RationalRationalSearchEnvironment {
         return env;
     }
 };
+class RationalFloatFirstEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setExactFloatFirst(true);
+        return env;
+    }
+};
 
 template<typename TestType>
 class MinMaxLinearEquationSolverTest : public ::testing::Test {
@@ -141,9 +270,12 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
-                         DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleParallelSoundViEnvironment, DoubleIntervalIterationEnvironment,
+                         DoubleMixedPrecisionIntervalIterationEnvironment, DoubleAsynchronousIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
+                         DoubleConcurrentOptimisticViEnvironment, DoubleTopologicalViEnvironment, DoubleTopologicalSoundViEnvironment,
+                         DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, DoubleModifiedPIEnvironment, DoublePortfolioEnvironment,
+                         DoublePortfolioRaceEnvironment, RationalPIEnvironment, RationalPortfolioEnvironment, RationalRationalSearchEnvironment,
+                         RationalFloatFirstEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -175,4 +307,178 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquationsBatch) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build(2));
+
+    std::vector<std::vector<ValueType>> x(2, std::vector<ValueType>(1));
+    std::vector<std::vector<ValueType>> b = {{this->parseNumber("0.099"), this->parseNumber("0.5")}, {this->parseNumber("0.05"), this->parseNumber("0.1")}};
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>();
+    auto solver = factory.create(this->env(), A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(this->parseNumber("0"), this->parseNumber("2"));
+    ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("0.1"), this->precision());
+
+    ASSERT_NO_THROW(solver->solveEquationsBatch(this->env(), storm::OptimizationDirection::Maximize, x, b));
+    EXPECT_NEAR(x[0][0], this->parseNumber("0.99"), this->precision());
+    EXPECT_NEAR(x[1][0], this->parseNumber("0.5"), this->precision());
+
+    b.pop_back();
+    EXPECT_THROW(solver->solveEquationsBatch(this->env(), storm::OptimizationDirection::Maximize, x, b), storm::exceptions::IllegalArgumentException);
+}
+
+TEST(TopologicalMinMaxLinearEquationSolverTest, SoundSccPrecisions) {
+    storm::Environment env = DoubleTopologicalSoundViEnvironment::createEnvironment();
+
+    // The relevant state 0 is in the SCC {0,1} and reaches the SCC {2,3} with a small probability.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.001);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 0, 0.9);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 3, 0.5);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 2, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(4, 4, 4);
+    std::vector<double> b = {0.2, 0.1, 0.25, 0.25};
+
+    for (bool relevantValuesSet : {false, true}) {
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        solver->setRequirementsChecked();
+        if (relevantValuesSet) {
+            solver->setRelevantValues(storm::storage::BitVector(4, std::vector<uint_fast64_t>({0})));
+        }
+        std::vector<double> x(4);
+        ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        // x2 = x3 = 0.5 and x0 = 0.5 * (0.9 * x0 + 0.1) + 0.001 * x2 + 0.2.
+        EXPECT_NEAR(0.2505 / 0.55, x[0], 1e-6);
+        EXPECT_NEAR(0.9 * 0.2505 / 0.55 + 0.1, x[1], 1e-6);
+        if (!relevantValuesSet) {
+            EXPECT_NEAR(0.5, x[2], 1e-6);
+        }
+    }
+}
+
+TEST(AcyclicMinMaxLinearEquationSolverTest, LevelParallelSolving) {
+    // Layers of states with two choices each that lead to the next layer. The last layer comes first, so the row groups need to be reordered.
+    uint64_t const numberOfLayers = 5;
+    uint64_t const layerWidth = 1000;
+    auto stateIndex = [&](uint64_t layer, uint64_t i) { return (numberOfLayers - 1 - layer) * layerWidth + i; };
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfLayers * layerWidth; ++state) {
+        uint64_t layer = numberOfLayers - 1 - state / layerWidth;
+        uint64_t i = state % layerWidth;
+        builder.newRowGroup(row);
+        if (layer + 1 == numberOfLayers) {
+            b.push_back(1.0);
+            ++row;
+            continue;
+        }
+        builder.addNextValue(row, stateIndex(layer + 1, (i + 1) % layerWidth), 0.5);
+        b.push_back(0.1 * (i % 5));
+        ++row;
+        builder.addNextValue(row, stateIndex(layer + 1, (7 * i + 3) % layerWidth), 0.6);
+        b.push_back(0.1 * (i % 3));
+        ++row;
+    }
+    storm::storage::SparseMatrix<double> A = builder.build(row, numberOfLayers * layerWidth, numberOfLayers * layerWidth);
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Acyclic);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<std::vector<double>> results;
+        for (uint64_t threads : {1, 4}) {
+            env.solver().multiplier().setNumberOfGaussSeidelThreads(threads);
+            auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+            solver->setCachingEnabled(true);
+            solver->setRequirementsChecked();
+            std::vector<double> x(A.getRowGroupCount());
+            ASSERT_TRUE(solver->solveEquations(env, dir, x, b));
+            // A second solve reuses the cached ordering and levels.
+            std::vector<double> x2(A.getRowGroupCount());
+            ASSERT_TRUE(solver->solveEquations(env, dir, x2, b));
+            EXPECT_EQ(x, x2);
+            results.push_back(x);
+        }
+        for (uint64_t state = 0; state < A.getRowGroupCount(); ++state) {
+            EXPECT_NEAR(results[0][state], results[1][state], 1e-12);
+        }
+    }
+}
+
+TEST(PortfolioMinMaxLinearEquationSolverTest, SelectMethods) {
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+
+    // Three states without cycles.
+    storm::storage::SparseMatrixBuilder<double> acyclicBuilder(0, 0, 0, false, true);
+    acyclicBuilder.newRowGroup(0);
+    acyclicBuilder.addNextValue(0, 1, 0.5);
+    acyclicBuilder.addNextValue(1, 2, 0.5);
+    acyclicBuilder.newRowGroup(2);
+    acyclicBuilder.addNextValue(2, 2, 0.5);
+    acyclicBuilder.newRowGroup(3);
+    storm::storage::SparseMatrix<double> acyclicMatrix = acyclicBuilder.build(4, 3, 3);
+    std::vector<double> acyclicB = {0.5, 0.2, 0.5, 1.0};
+    auto features = storm::solver::PortfolioMinMaxLinearEquationSolver<double>::computeFeatures(env, storm::OptimizationDirection::Maximize, acyclicMatrix,
+                                                                                                acyclicB, 8);
+    EXPECT_EQ(3ull, features.numberOfSccs);
+    EXPECT_EQ(0ull, features.numberOfNontrivialSccs);
+    EXPECT_TRUE(features.acyclic);
+    EXPECT_EQ(2ull, features.maximalRowGroupSize);
+    auto ranking = storm::solver::PortfolioMinMaxLinearEquationSolver<double>::rankMethods(env, features);
+    ASSERT_FALSE(ranking.empty());
+    EXPECT_EQ(storm::solver::MinMaxMethod::Acyclic, ranking.front());
+
+    // A single state whose self-loops make value iteration converge slowly.
+    storm::storage::SparseMatrixBuilder<double> slowBuilder(0, 0, 0, false, true);
+    slowBuilder.newRowGroup(0);
+    slowBuilder.addNextValue(0, 0, 0.9999);
+    slowBuilder.addNextValue(1, 0, 0.99995);
+    storm::storage::SparseMatrix<double> slowMatrix = slowBuilder.build(2);
+    std::vector<double> slowB = {0.0001, 0.00005};
+    features =
+        storm::solver::PortfolioMinMaxLinearEquationSolver<double>::computeFeatures(env, storm::OptimizationDirection::Maximize, slowMatrix, slowB, 8);
+    EXPECT_FALSE(features.acyclic);
+    ASSERT_TRUE(static_cast<bool>(features.contractionFactor));
+    EXPECT_NEAR(0.9999, features.contractionFactor.get(), 1e-6);
+    ranking = storm::solver::PortfolioMinMaxLinearEquationSolver<double>::rankMethods(env, features);
+    ASSERT_FALSE(ranking.empty());
+    EXPECT_EQ(storm::solver::MinMaxMethod::PolicyIteration, ranking.front());
+    EXPECT_NE(ranking.end(), std::find(ranking.begin(), ranking.end(), storm::solver::MinMaxMethod::ValueIteration));
+
+    env.solver().setForceSoundness(true);
+    ranking = storm::solver::PortfolioMinMaxLinearEquationSolver<double>::rankMethods(env, features);
+    EXPECT_EQ(ranking.end(), std::find(ranking.begin(), ranking.end(), storm::solver::MinMaxMethod::ValueIteration));
+    EXPECT_NE(ranking.end(), std::find(ranking.begin(), ranking.end(), storm::solver::MinMaxMethod::OptimisticValueIteration));
+
+    // The portfolio solver has to deliver the solution of the slowly converging system.
+    env.solver().setForceSoundness(false);
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Portfolio);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, slowMatrix);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setRequirementsChecked();
+    std::vector<double> x(1);
+    ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, slowB));
+    EXPECT_NEAR(1.0, x[0], 1e-6);
+}
 }  // namespace
@@ -3,6 +3,8 @@
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/NativeMultiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/utility/vector.h"
@@ -30,6 +32,39 @@ class GmmxxEnvironment {
     }
 };
 
+class CompactEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Compact);
+        return env;
+    }
+};
+
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
+class SellEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Sell);
+        return env;
+    }
+};
+
 template<typename TestType>
 class MultiplierTest : public ::testing::Test {
    public:
@@ -49,7 +84,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment, CompactEnvironment, SimdEnvironment, SellEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -78,6 +113,41 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyTest) {
     EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
 }
 
+TYPED_TEST(MultiplierTest, multiplyAndAccumulateTest) {
+    typedef typename TestFixture::ValueType ValueType;
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.25")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0.75")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    std::vector<ValueType> x = {this->parseNumber("1"), this->parseNumber("0"), this->parseNumber("0")};
+    std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0.5"), this->parseNumber("0")};
+    std::vector<ValueType> first(3, this->parseNumber("1"));
+    std::vector<ValueType> second(3);
+    std::vector<ValueType> weights = {this->parseNumber("2"), this->parseNumber("0.5")};
+
+    auto factory = storm::solver::MultiplierFactory<ValueType>();
+    auto multiplier = factory.create(this->env(), A);
+    ASSERT_NO_THROW(multiplier->multiplyAndAccumulate(this->env(), x, &b, x, weights, {&first, &second}));
+    ASSERT_NO_THROW(multiplier->multiplyAndAccumulate(this->env(), x, &b, x, weights, {&first, &second}));
+
+    // The iterates are (0, 0.5, 0.25) and (0.375, 0.75, 0.1875).
+    EXPECT_NEAR(x[0], this->parseNumber("0.375"), this->precision());
+    EXPECT_NEAR(x[1], this->parseNumber("0.75"), this->precision());
+    EXPECT_NEAR(x[2], this->parseNumber("0.1875"), this->precision());
+    EXPECT_NEAR(first[0], this->parseNumber("1.75"), this->precision());
+    EXPECT_NEAR(first[1], this->parseNumber("3.5"), this->precision());
+    EXPECT_NEAR(first[2], this->parseNumber("1.875"), this->precision());
+    EXPECT_NEAR(second[0], this->parseNumber("0.1875"), this->precision());
+    EXPECT_NEAR(second[1], this->parseNumber("0.625"), this->precision());
+    EXPECT_NEAR(second[2], this->parseNumber("0.21875"), this->precision());
+}
+
 TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     typedef typename TestFixture::ValueType ValueType;
 
@@ -123,4 +193,256 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
-}  // namespace
\ No newline at end of file
+TYPED_TEST(MultiplierTest, blockGaussSeidelTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder;
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 3, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(2, 4, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(3, 4, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.addNextValue(4, 4, this->parseNumber("1")));
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    storm::Environment env = this->env();
+    env.solver().multiplier().setNumberOfGaussSeidelThreads(2);
+    env.solver().multiplier().setGaussSeidelBlockSize(2);
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, A);
+
+    std::vector<ValueType> x(5);
+    x[4] = this->parseNumber("1");
+    for (uint64_t iteration = 0; iteration < 4; ++iteration) {
+        ASSERT_NO_THROW(multiplier->multiplyGaussSeidel(env, x, nullptr, true));
+    }
+    EXPECT_NEAR(x[0], this->parseNumber("1"), this->precision());
+
+    storm::storage::SparseMatrixBuilder<ValueType> mdpBuilder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(mdpBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(mdpBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(mdpBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(mdpBuilder.addNextValue(3, 2, this->parseNumber("1")));
+    storm::storage::SparseMatrix<ValueType> B;
+    ASSERT_NO_THROW(B = mdpBuilder.build());
+
+    env.solver().multiplier().setGaussSeidelBlockSize(1);
+    multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, B);
+    std::vector<ValueType> initialX = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+    std::vector<uint64_t> choices(3, 0);
+
+    x = initialX;
+    for (uint64_t iteration = 0; iteration < 500; ++iteration) {
+        ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Maximize, x, nullptr, &choices));
+    }
+    EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->parseNumber("1e-9"));
+    EXPECT_EQ(0ull, choices[0]);
+
+    x = initialX;
+    ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Minimize, x, nullptr, &choices));
+    EXPECT_NEAR(x[0], this->parseNumber("0.099"), this->precision());
+    EXPECT_EQ(0ull, choices[0]);
+    ASSERT_NO_THROW(multiplier->multiplyAndReduceGaussSeidel(env, storm::OptimizationDirection::Minimize, x, nullptr, &choices));
+    EXPECT_NEAR(x[0], this->parseNumber("0.1881"), this->precision());
+}
+
+TYPED_TEST(MultiplierTest, batchMultiplyAndReduceTest) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(this->env(), A);
+
+    std::vector<ValueType> x1 = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+    std::vector<ValueType> x2 = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("1")};
+    std::vector<ValueType> b1 = {this->parseNumber("0"), this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0")};
+    std::vector<ValueType> b2 = {this->parseNumber("0.2"), this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("0.3")};
+
+    // Entry i of vector j is at position i * 2 + j.
+    std::vector<ValueType> x(6), b(8);
+    for (uint64_t i = 0; i < 3; ++i) {
+        x[2 * i] = x1[i];
+        x[2 * i + 1] = x2[i];
+    }
+    for (uint64_t i = 0; i < 4; ++i) {
+        b[2 * i] = b1[i];
+        b[2 * i + 1] = b2[i];
+    }
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<ValueType> expected1 = x1, expected2 = x2, result = x;
+        for (uint64_t iteration = 0; iteration < 3; ++iteration) {
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, expected1, &b1, expected1));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, expected2, &b2, expected2));
+            ASSERT_NO_THROW(multiplier->multiplyAndReduceBatch(this->env(), dir, 2, result, &b, result));
+        }
+        for (uint64_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(expected1[i], result[2 * i], this->precision());
+            EXPECT_NEAR(expected2[i], result[2 * i + 1], this->precision());
+        }
+    }
+
+    std::vector<ValueType> result(8);
+    ASSERT_NO_THROW(multiplier->multiplyBatch(this->env(), 2, x, &b, result));
+    EXPECT_NEAR(result[2], this->parseNumber("0.6"), this->precision());
+    EXPECT_NEAR(result[3], this->parseNumber("0.5"), this->precision());
+    EXPECT_NEAR(result[7], this->parseNumber("1.3"), this->precision());
+}
+
+TYPED_TEST(MultiplierTest, multiplyAndReduce2Test) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.9")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.099")));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("0.001")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.5")));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, this->parseNumber("1")));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1")));
+
+    storm::storage::SparseMatrix<ValueType> A;
+    ASSERT_NO_THROW(A = builder.build());
+
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(this->env(), A);
+
+    std::vector<ValueType> lower = {this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("1")};
+    std::vector<ValueType> upper = {this->parseNumber("1"), this->parseNumber("1"), this->parseNumber("1")};
+    std::vector<ValueType> b = {this->parseNumber("0"), this->parseNumber("0.1"), this->parseNumber("0"), this->parseNumber("0")};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<ValueType> expected1(3), expected2(3), result1(3), result2(3);
+        std::vector<uint_fast64_t> expectedChoices1(3), expectedChoices2(3), choices1(3), choices2(3);
+        ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, lower, &b, expected1, &expectedChoices1));
+        ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, upper, &b, expected2, &expectedChoices2));
+        bool converged = true;
+        ASSERT_NO_THROW(converged = multiplier->multiplyAndReduce2(this->env(), dir, lower, upper, &b, result1, result2, this->parseNumber("1e-6"), false,
+                                                                   &choices1, &choices2));
+        EXPECT_FALSE(converged);
+        for (uint64_t i = 0; i < 3; ++i) {
+            EXPECT_NEAR(expected1[i], result1[i], this->precision());
+            EXPECT_NEAR(expected2[i], result2[i], this->precision());
+        }
+        EXPECT_EQ(expectedChoices1, choices1);
+        EXPECT_EQ(expectedChoices2, choices2);
+
+        // Equal bounds yield equal results.
+        ASSERT_NO_THROW(converged = multiplier->multiplyAndReduce2(this->env(), dir, upper, upper, &b, result1, result2, this->parseNumber("1e-6"), true));
+        EXPECT_TRUE(converged);
+    }
+}
+
+TEST(MultiplierTest, simdColumnBound) {
+    // The vectorized kernels gather with signed 32-bit offsets, so matrices with more columns are multiplied natively.
+    uint64_t const numberOfColumns = static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 2;
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, numberOfColumns - 1, 0.5);
+    storm::storage::SparseMatrix<double> A = builder.build(1, numberOfColumns);
+    EXPECT_TRUE(storm::solver::CompactMultiplier<double>::isApplicable(A));
+    EXPECT_FALSE(storm::solver::SimdMultiplier<double>::isApplicable(A));
+
+    storm::Environment env;
+    env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, A);
+    EXPECT_NE(nullptr, dynamic_cast<storm::solver::NativeMultiplier<double>*>(multiplier.get()));
+    EXPECT_EQ(storm::solver::simd::InstructionSet::Scalar, storm::solver::SimdMultiplier<double>(A).getInstructionSet());
+}
+
+TEST(MultiplierTest, singlePrecisionNativeMultiplyAndReduceTest) {
+    storm::storage::SparseMatrixBuilder<float> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9f));
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.099f));
+    ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.001f));
+    ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.5f));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.5f));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(2, 1, 1.0f));
+    ASSERT_NO_THROW(builder.newRowGroup(3));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, 1.0f));
+
+    storm::storage::SparseMatrix<float> A;
+    ASSERT_NO_THROW(A = builder.build());
+    EXPECT_TRUE(A == A.toValueType<double>().toValueType<float>());
+
+    storm::Environment env;
+    std::unique_ptr<storm::solver::Multiplier<float>> multiplier = std::make_unique<storm::solver::NativeMultiplier<float>>(A);
+    std::vector<float> x = {0.0f, 1.0f, 0.0f};
+    ASSERT_NO_THROW(multiplier->repeatedMultiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, 20));
+    EXPECT_NEAR(x[0], 0.923808265834023387639f, 1e-6f);
+}
+
+TEST(MultiplierTest, temporallyBlockedRepeatedMultiplyTest) {
+    // A banded matrix with two rows per row group, where the rows of group i refer to the columns i - 2, ..., i + 2.
+    uint64_t const numberOfGroups = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(2 * group);
+        for (uint64_t choice = 0; choice < 2; ++choice) {
+            for (uint64_t column = std::max<uint64_t>(group, 2) - 2; column <= std::min(group + 2, numberOfGroups - 1); ++column) {
+                builder.addNextValue(2 * group + choice, column, 0.1 + 0.03 * ((group + 3 * choice + column) % 5));
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+    std::vector<double> b(A.getRowCount());
+    for (uint64_t row = 0; row < b.size(); ++row) {
+        b[row] = 0.01 * (row % 7);
+    }
+    std::vector<double> initial(numberOfGroups);
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        initial[group] = (group % 3) * 0.5;
+    }
+
+    storm::Environment env;
+    storm::Environment blockedEnv;
+    env.solver().multiplier().setTemporalBlockingWindow(0);
+    blockedEnv.solver().multiplier().setTemporalBlockingWindow(200);
+    storm::solver::NativeMultiplier<double> multiplier(A);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected = initial, result = initial;
+        ASSERT_NO_THROW(multiplier.repeatedMultiplyAndReduce(env, dir, expected, &b, 37));
+        ASSERT_NO_THROW(multiplier.repeatedMultiplyAndReduce(blockedEnv, dir, result, &b, 37));
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            EXPECT_NEAR(expected[group], result[group], 1e-12);
+        }
+    }
+
+    // Without reduction, each row is multiplied, so we consider the (square) matrix that consists of the first rows of the groups.
+    storm::storage::SparseMatrix<double> squareA = A.selectRowsFromRowGroups(std::vector<uint64_t>(numberOfGroups, 0), false);
+    std::vector<double> squareB(b.begin(), b.begin() + numberOfGroups);
+    storm::solver::NativeMultiplier<double> squareMultiplier(squareA);
+    std::vector<double> expected = initial, result = initial;
+    ASSERT_NO_THROW(squareMultiplier.repeatedMultiply(env, expected, &squareB, 37));
+    ASSERT_NO_THROW(squareMultiplier.repeatedMultiply(blockedEnv, result, &squareB, 37));
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        EXPECT_NEAR(expected[group], result[group], 1e-12);
+    }
+}
+
+}  // namespace
@@ -0,0 +1,133 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <random>
+#include <vector>
+
+#include "storm/solver/multiplier/SimdKernels.h"
+
+namespace {
+
+using storm::solver::simd::InstructionSet;
+
+// A randomly generated matrix with row groups of varying size rows of varying length.
+class RandomGroupedMatrix {
+   public:
+    RandomGroupedMatrix(uint64_t numberOfGroups, uint64_t seed) : rowGroupIndices(1, 0), rowIndications(1, 0) {
+        std::mt19937_64 generator(seed);
+        std::uniform_int_distribution<uint64_t> groupSizeDistribution(0, 20);
+        std::uniform_int_distribution<uint64_t> rowLengthDistribution(1, 19);
+        std::uniform_int_distribution<uint32_t> columnDistribution(0, numberOfGroups - 1);
+        std::uniform_real_distribution<double> valueDistribution(0.0, 1.0);
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            uint64_t groupSize = groupSizeDistribution(generator);
+            for (uint64_t row = 0; row < groupSize; ++row) {
+                uint64_t rowLength = rowLengthDistribution(generator);
+                for (uint64_t entry = 0; entry < rowLength; ++entry) {
+                    columns.push_back(columnDistribution(generator));
+                    values.push_back(valueDistribution(generator) / rowLength);
+                }
+                rowIndications.push_back(columns.size());
+                summand.push_back(valueDistribution(generator));
+            }
+            rowGroupIndices.push_back(rowIndications.size() - 1);
+        }
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            x.push_back(valueDistribution(generator));
+        }
+    }
+
+    storm::solver::simd::CsrMatrixView getView() const {
+        return {rowIndications.data(), columns.data(), values.data()};
+    }
+
+    uint64_t getRowCount() const {
+        return rowIndications.size() - 1;
+    }
+
+    uint64_t getRowGroupCount() const {
+        return rowGroupIndices.size() - 1;
+    }
+
+    std::vector<uint64_t> rowGroupIndices;
+    std::vector<uint64_t> rowIndications;
+    std::vector<uint32_t> columns;
+    std::vector<double> values;
+    std::vector<double> summand;
+    std::vector<double> x;
+};
+
+std::vector<InstructionSet> getSupportedInstructionSets() {
+    std::vector<InstructionSet> result;
+    for (auto instructionSet : {InstructionSet::Avx2, InstructionSet::Avx512}) {
+        if (storm::solver::simd::isSupported(instructionSet)) {
+            result.push_back(instructionSet);
+        }
+    }
+    return result;
+}
+
+TEST(SimdKernelsTest, MultiplyWithVector) {
+    RandomGroupedMatrix matrix(500, 42);
+    std::vector<double> expected(matrix.getRowCount());
+    storm::solver::simd::multiplyWithVector(InstructionSet::Scalar, matrix.getView(), 0, matrix.getRowCount(), matrix.x.data(), matrix.summand.data(),
+                                            expected.data());
+
+    for (auto instructionSet : getSupportedInstructionSets()) {
+        std::vector<double> result(matrix.getRowCount());
+        storm::solver::simd::multiplyWithVector(instructionSet, matrix.getView(), 0, matrix.getRowCount(), matrix.x.data(), matrix.summand.data(),
+                                                result.data());
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            EXPECT_NEAR(expected[row], result[row], 1e-12) << "Row " << row << " with " << storm::solver::simd::toString(instructionSet);
+        }
+    }
+}
+
+TEST(SimdKernelsTest, MultiplyAndReduce) {
+    RandomGroupedMatrix matrix(500, 1337);
+    for (bool minimize : {true, false}) {
+        for (bool backwards : {false, true}) {
+            std::vector<double> expected(matrix.getRowGroupCount(), -1.0);
+            std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+            storm::solver::simd::multiplyAndReduce(InstructionSet::Scalar, matrix.getView(), minimize, matrix.rowGroupIndices.data(), 0,
+                                                   matrix.getRowGroupCount(), matrix.x.data(), matrix.summand.data(), expected.data(),
+                                                   expectedChoices.data(), backwards);
+
+            for (auto instructionSet : getSupportedInstructionSets()) {
+                std::vector<double> result(matrix.getRowGroupCount(), -1.0);
+                std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+                storm::solver::simd::multiplyAndReduce(instructionSet, matrix.getView(), minimize, matrix.rowGroupIndices.data(), 0,
+                                                       matrix.getRowGroupCount(), matrix.x.data(), matrix.summand.data(), result.data(), choices.data(),
+                                                       backwards);
+                for (uint64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+                    EXPECT_NEAR(expected[group], result[group], 1e-12) << "Group " << group << " with " << storm::solver::simd::toString(instructionSet);
+                    EXPECT_EQ(expectedChoices[group], choices[group]) << "Group " << group << " with " << storm::solver::simd::toString(instructionSet);
+                }
+            }
+        }
+    }
+}
+
+TEST(SimdKernelsTest, ChoicesOnlyChangeIfStrictlyBetter) {
+    // One group with three rows; the second and third row yield the same value.
+    std::vector<uint64_t> rowGroupIndices = {0, 3};
+    std::vector<uint64_t> rowIndications = {0, 1, 2, 3};
+    std::vector<uint32_t> columns = {0, 0, 0};
+    std::vector<double> values = {0.2, 0.5, 0.5};
+    storm::solver::simd::CsrMatrixView view{rowIndications.data(), columns.data(), values.data()};
+    std::vector<double> x = {1.0};
+
+    for (auto instructionSet : getSupportedInstructionSets()) {
+        std::vector<double> result(1);
+        std::vector<uint64_t> choices = {2};
+        storm::solver::simd::multiplyAndReduce(instructionSet, view, false, rowGroupIndices.data(), 0, 1, x.data(), nullptr, result.data(), choices.data());
+        EXPECT_EQ(0.5, result[0]);
+        EXPECT_EQ(2ull, choices[0]);
+
+        choices = {0};
+        storm::solver::simd::multiplyAndReduce(instructionSet, view, false, rowGroupIndices.data(), 0, 1, x.data(), nullptr, result.data(), choices.data());
+        EXPECT_EQ(1ull, choices[0]);
+    }
+}
+
+}  // namespace
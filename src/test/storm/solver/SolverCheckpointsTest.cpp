@@ -0,0 +1,89 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverCheckpoints.h"
+#include "storm/solver/SolverTelemetry.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+class SolverCheckpointsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        directory = std::filesystem::temp_directory_path() / "storm_solver_checkpoints_test";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+
+        // A single state with a self loop (probability 0.9) and a choice without outgoing transitions.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.9);
+        A = builder.build(2);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    storm::Environment createEnvironment(std::shared_ptr<storm::solver::SolverCheckpoints> const& checkpoints) {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setCheckpoints(checkpoints);
+        return env;
+    }
+
+    double solve(storm::Environment const& env, std::vector<double> const& b) {
+        std::vector<double> x(1);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        EXPECT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        return x[0];
+    }
+
+    std::filesystem::path directory;
+    storm::storage::SparseMatrix<double> A;
+};
+
+TEST_F(SolverCheckpointsTest, WriteAndResume) {
+    std::vector<double> b = {0.099, 0.5};
+    {
+        // Checkpoint after every iteration.
+        auto checkpoints = std::make_shared<storm::solver::SolverCheckpoints>(directory.string(), std::chrono::milliseconds(0), false);
+        EXPECT_NEAR(0.5, solve(createEnvironment(checkpoints), b), 1e-6);
+        checkpoints->waitForPendingWrites();
+        EXPECT_GT(checkpoints->getNumberOfWrittenCheckpoints(), 0ul);
+        EXPECT_EQ(0ul, checkpoints->getNumberOfReadCheckpoints());
+    }
+    EXPECT_TRUE(std::filesystem::exists(directory / "solver-0.checkpoint"));
+
+    // Resuming starts from the final checkpoint, so the solver converges right away.
+    auto checkpoints = std::make_shared<storm::solver::SolverCheckpoints>(directory.string(), std::chrono::hours(1), true);
+    auto env = createEnvironment(checkpoints);
+    auto telemetry = std::make_shared<storm::solver::SolverTelemetry>();
+    env.solver().setTelemetry(telemetry);
+    EXPECT_NEAR(0.5, solve(env, b), 1e-6);
+    EXPECT_EQ(1ul, checkpoints->getNumberOfReadCheckpoints());
+    EXPECT_LE(telemetry->getRecords().size(), 2ul);
+}
+
+TEST_F(SolverCheckpointsTest, IgnoreOtherEquationSystems) {
+    {
+        auto checkpoints = std::make_shared<storm::solver::SolverCheckpoints>(directory.string(), std::chrono::milliseconds(0), false);
+        solve(createEnvironment(checkpoints), {0.099, 0.5});
+    }
+
+    // The checkpoint of the first invocation belongs to a different right-hand side.
+    auto checkpoints = std::make_shared<storm::solver::SolverCheckpoints>(directory.string(), std::chrono::hours(1), true);
+    EXPECT_NEAR(0.2, solve(createEnvironment(checkpoints), {0.099, 0.2}), 1e-6);
+    EXPECT_EQ(0ul, checkpoints->getNumberOfReadCheckpoints());
+}
+
+}  // namespace
@@ -0,0 +1,90 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverTelemetry.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createMatrix() {
+    // A single state with a self loop (probability 0.9) and a choice without outgoing transitions.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    return builder.build(2);
+}
+
+std::vector<storm::solver::SolverIterationRecord> solve(storm::solver::MinMaxMethod const& method) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(method);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    auto telemetry = std::make_shared<storm::solver::SolverTelemetry>();
+    env.solver().setTelemetry(telemetry);
+
+    storm::storage::SparseMatrix<double> A = createMatrix();
+    std::vector<double> x(1);
+    std::vector<double> b = {0.099, 0.5};
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+    EXPECT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+    EXPECT_NEAR(0.5, x[0], 1e-6);
+    return telemetry->getRecords();
+}
+
+TEST(SolverTelemetryTest, ValueIteration) {
+    auto records = solve(storm::solver::MinMaxMethod::ValueIteration);
+    ASSERT_FALSE(records.empty());
+    for (uint64_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ("value iteration", records[i].method);
+        EXPECT_EQ(i + 1, records[i].iteration);
+        EXPECT_FALSE(std::isnan(records[i].maxDiff));
+        EXPECT_TRUE(std::isnan(records[i].boundsGap));
+    }
+    EXPECT_LT(records.back().maxDiff, records.front().maxDiff);
+}
+
+TEST(SolverTelemetryTest, PolicyIteration) {
+    auto records = solve(storm::solver::MinMaxMethod::PolicyIteration);
+    uint64_t policyIterationRecords = 0;
+    uint64_t schedulerChanges = 0;
+    for (auto const& record : records) {
+        if (record.method == "policy iteration") {
+            ++policyIterationRecords;
+            schedulerChanges += record.schedulerChanges;
+        }
+    }
+    EXPECT_GE(policyIterationRecords, 1ul);
+    // The initial scheduler selects the first choice, which is not optimal.
+    EXPECT_EQ(1ul, schedulerChanges);
+}
+
+TEST(SolverTelemetryTest, Export) {
+    storm::solver::SolverTelemetry telemetry;
+    uint64_t callbackInvocations = 0;
+    telemetry.setCallback([&callbackInvocations](storm::solver::SolverIterationRecord const&) { ++callbackInvocations; });
+    storm::solver::SolverIterationRecord record{"solver", "method", 0, 1, 0.5, std::numeric_limits<double>::quiet_NaN(), 0, 1.0, 1.0, 2.0};
+    telemetry.record(record);
+    EXPECT_EQ(1ul, callbackInvocations);
+
+    std::stringstream csv;
+    telemetry.exportCsv(csv);
+    EXPECT_EQ(
+        "solver,method,invocation,iteration,max_diff,bounds_gap,scheduler_changes,elapsed_s,iterations_per_s,multiplier_gb_per_s\n"
+        "solver,method,0,1,0.5,,0,1,1,2\n",
+        csv.str());
+
+    std::stringstream json;
+    telemetry.exportJson(json);
+    EXPECT_NE(std::string::npos, json.str().find("\"bounds-gap\": null"));
+}
+
+}  // namespace
@@ -0,0 +1,85 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/SolverWorkspace.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+TEST(SolverWorkspaceTest, Pooling) {
+    storm::solver::SolverWorkspace workspace(2);
+    auto first = workspace.acquire<double>(10);
+    ASSERT_EQ(10ul, first->size());
+    EXPECT_EQ(0.0, (*first)[9]);
+    auto second = workspace.acquire<double>(100);
+    auto third = workspace.acquire<double>(1000);
+    EXPECT_EQ(0ul, workspace.getNumberOfReusedVectors());
+
+    double* firstData = first->data();
+    double* secondData = second->data();
+    workspace.release(std::move(first));
+    workspace.release(std::move(second));
+    workspace.release(std::move(third));
+    // Only the two largest vectors are kept.
+    EXPECT_EQ(1100 * sizeof(double), workspace.getSizeInMemory());
+
+    // The smallest sufficient vector is reused.
+    auto reused = workspace.acquire<double>(50);
+    EXPECT_EQ(1ul, workspace.getNumberOfReusedVectors());
+    EXPECT_EQ(50ul, reused->size());
+    EXPECT_EQ(secondData, reused->data());
+    EXPECT_NE(firstData, reused->data());
+
+    // Vectors of other value types are pooled separately.
+    auto rational = workspace.acquire<storm::RationalNumber>(10);
+    EXPECT_EQ(1ul, workspace.getNumberOfReusedVectors());
+    workspace.clear();
+    EXPECT_EQ(0ul, workspace.getSizeInMemory());
+}
+
+TEST(SolverWorkspaceTest, AcquireFromEnvironment) {
+    storm::Environment env;
+    auto vector = storm::solver::SolverWorkspace::acquireVector<double>(env, 5);
+    EXPECT_EQ(5ul, vector->size());
+    vector.reset();
+
+    auto workspace = std::make_shared<storm::solver::SolverWorkspace>();
+    env.solver().setWorkspace(workspace);
+    vector = storm::solver::SolverWorkspace::acquireVector<double>(env, 5);
+    EXPECT_EQ(0ul, workspace->getSizeInMemory());
+    // Releasing the vector hands it back to the workspace.
+    vector.reset();
+    EXPECT_EQ(5 * sizeof(double), workspace->getSizeInMemory());
+}
+
+TEST(SolverWorkspaceTest, SharedBySolvers) {
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    auto workspace = std::make_shared<storm::solver::SolverWorkspace>();
+    env.solver().setWorkspace(workspace);
+
+    // A single state with a self loop (probability 0.9) and a choice without outgoing transitions.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> b = {0.099, 0.5};
+
+    for (uint64_t invocation = 0; invocation < 2; ++invocation) {
+        std::vector<double> x(1);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        ASSERT_TRUE(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(0.5, x[0], 1e-6);
+    }
+    // The second solver reuses the vectors of the first one.
+    EXPECT_GT(workspace->getNumberOfReusedVectors(), 0ul);
+}
+
+}  // namespace
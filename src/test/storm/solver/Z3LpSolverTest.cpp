@@ -267,6 +267,40 @@ TEST(Z3LpSolver, MILPUnbounded) {
     STORM_SILENT_ASSERT_THROW(solver.getObjectiveValue(), storm::exceptions::InvalidAccessException);
 }
 
+TEST(Z3LpSolver, ChangeObjective) {
+    auto solverPtr = storm::utility::solver::Z3LpSolverFactory<double>().create("");
+    auto& solver = static_cast<storm::solver::Z3LpSolver<double>&>(*solverPtr);
+    solver.setOptimizationDirection(storm::OptimizationDirection::Maximize);
+    storm::expressions::Variable x, y;
+    ASSERT_NO_THROW(x = solver.addBoundedContinuousVariable("x", 0, 1, 1));
+    ASSERT_NO_THROW(y = solver.addBoundedContinuousVariable("y", 0, 2));
+    ASSERT_NO_THROW(solver.update());
+    ASSERT_NO_THROW(solver.addConstraint("", x + y <= solver.getConstant(2)));
+    ASSERT_NO_THROW(solver.update());
+
+    // max x s.t. x + y <= 2
+    ASSERT_NO_THROW(solver.optimize());
+    ASSERT_TRUE(solver.isOptimal());
+    EXPECT_EQ(1.0, solver.getObjectiveValue());
+
+    // max y s.t. x + y <= 2. The changed objective survives the pop.
+    solver.push();
+    ASSERT_NO_THROW(solver.setObjectiveFunctionCoefficient(x, 0));
+    ASSERT_NO_THROW(solver.setObjectiveFunctionCoefficient(y, 1));
+    solver.pop();
+    ASSERT_NO_THROW(solver.optimize());
+    ASSERT_TRUE(solver.isOptimal());
+    EXPECT_EQ(2.0, solver.getObjectiveValue());
+    EXPECT_EQ(2.0, solver.getContinuousValue(y));
+
+    // max 3x + y s.t. x + y <= 2
+    ASSERT_NO_THROW(solver.setObjectiveFunctionCoefficient(x, 3));
+    ASSERT_NO_THROW(solver.optimize());
+    ASSERT_TRUE(solver.isOptimal());
+    EXPECT_EQ(4.0, solver.getObjectiveValue());
+    EXPECT_EQ(1.0, solver.getContinuousValue(x));
+}
+
 TEST(Z3LpSolver, Incremental) {
     auto solverPtr = storm::utility::solver::Z3LpSolverFactory<double>().create("");
     auto& solver = static_cast<storm::solver::Z3LpSolver<double>&>(*solverPtr);
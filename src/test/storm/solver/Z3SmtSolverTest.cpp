@@ -112,6 +112,44 @@ TEST(Z3SmtSolver, Backtracking) {
     ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Sat);
 }
 
+TEST(Z3SmtSolver, RepeatedAssertions) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::solver::Z3SmtSolver s(*manager);
+    storm::solver::SmtSolver::CheckResult result = storm::solver::SmtSolver::CheckResult::Unknown;
+
+    storm::expressions::Variable a = manager->declareIntegerVariable("a");
+    storm::expressions::Variable b = manager->declareIntegerVariable("b");
+    storm::expressions::Variable r = manager->declareRationalVariable("r");
+
+    // The same predicate is asserted several times within different scopes, so its translation is reused.
+    storm::expressions::Expression predicate = a + b > manager->integer(3);
+    for (uint64_t round = 0; round < 3; ++round) {
+        ASSERT_NO_THROW(s.push());
+        ASSERT_NO_THROW(s.add(predicate));
+        ASSERT_NO_THROW(s.add(a < manager->integer(2) && b < manager->integer(2)));
+        ASSERT_NO_THROW(result = s.check());
+        ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Unsat);
+        ASSERT_NO_THROW(s.pop());
+        ASSERT_NO_THROW(s.push());
+        ASSERT_NO_THROW(s.add(predicate));
+        ASSERT_NO_THROW(result = s.check());
+        ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Sat);
+        ASSERT_NO_THROW(s.pop());
+    }
+
+    // Translating floor introduces auxiliary constraints that have to be asserted again after backtracking.
+    storm::expressions::Expression floorPredicate = storm::expressions::floor(r.getExpression()) >= manager->integer(1);
+    for (uint64_t round = 0; round < 3; ++round) {
+        ASSERT_NO_THROW(s.push());
+        ASSERT_NO_THROW(s.add(r < manager->rational(1.0)));
+        ASSERT_NO_THROW(s.add(floorPredicate));
+        ASSERT_NO_THROW(result = s.check());
+        ASSERT_TRUE(result == storm::solver::SmtSolver::CheckResult::Unsat);
+        ASSERT_NO_THROW(s.pop());
+    }
+}
+
 TEST(Z3SmtSolver, Assumptions) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
 
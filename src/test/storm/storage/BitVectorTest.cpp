@@ -1,6 +1,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorRankIndex.h"
 #include "test/storm_gtest.h"
 
 TEST(BitVectorTest, InitToZero) {
@@ -601,3 +602,50 @@ TEST(BitVectorTest, Assignment) {
     v1.set(9999);
     ASSERT_TRUE(v1.get(9999));
 }
+
+TEST(BitVectorTest, BulkOperations) {
+    // Long enough for the vectorized operations, including a remainder that is processed word by word.
+    storm::storage::BitVector vector1(64 * 37 + 11);
+    storm::storage::BitVector vector2(64 * 37 + 11);
+    for (uint_fast64_t i = 0; i < vector1.size(); ++i) {
+        vector1.set(i, i % 3 == 0);
+        vector2.set(i, i % 5 == 0);
+    }
+
+    storm::storage::BitVector andResult = vector1 & vector2;
+    storm::storage::BitVector orResult = vector1 | vector2;
+    storm::storage::BitVector xorResult = vector1 ^ vector2;
+    storm::storage::BitVector complementResult = ~vector1;
+    for (uint_fast64_t i = 0; i < vector1.size(); ++i) {
+        ASSERT_EQ(i % 15 == 0, andResult.get(i));
+        ASSERT_EQ(i % 3 == 0 || i % 5 == 0, orResult.get(i));
+        ASSERT_EQ((i % 3 == 0) != (i % 5 == 0), xorResult.get(i));
+        ASSERT_EQ(i % 3 != 0, complementResult.get(i));
+    }
+    EXPECT_EQ((vector1.size() + 2) / 3, vector1.getNumberOfSetBits());
+    EXPECT_EQ(vector1.size() - vector1.getNumberOfSetBits(), complementResult.getNumberOfSetBits());
+    EXPECT_EQ(334ul, vector1.getNumberOfSetBitsBeforeIndex(1000));
+}
+
+TEST(BitVectorTest, RankIndex) {
+    storm::storage::BitVector vector(3000);
+    for (uint_fast64_t i = 0; i < vector.size(); ++i) {
+        vector.set(i, i % 7 == 0 || (i > 1000 && i < 1600));
+    }
+    storm::storage::BitVectorRankIndex index(vector);
+    EXPECT_EQ(vector.getNumberOfSetBits(), index.getNumberOfSetBits());
+    for (uint_fast64_t i = 0; i <= vector.size(); ++i) {
+        ASSERT_EQ(vector.getNumberOfSetBitsBeforeIndex(i), index.rank(i));
+    }
+    uint_fast64_t rank = 0;
+    for (auto i : vector) {
+        ASSERT_EQ(i, index.select(rank));
+        ++rank;
+    }
+    EXPECT_EQ(vector.size(), index.select(rank));
+
+    storm::storage::BitVector empty(0);
+    storm::storage::BitVectorRankIndex emptyIndex(empty);
+    EXPECT_EQ(0ul, emptyIndex.rank(0));
+    EXPECT_EQ(0ul, emptyIndex.select(0));
+}
@@ -0,0 +1,90 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(ChunkedSparseMatrixBuilderTest, Build) {
+    // Use tiny blocks such that the rows are distributed over several blocks.
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedBuilder(false, 3);
+    storm::storage::SparseMatrixBuilder<double> builder;
+    for (uint64_t row = 0; row < 20; ++row) {
+        if (row % 7 == 3) {
+            continue;
+        }
+        for (uint64_t column = 0; column < row % 4 + 1; ++column) {
+            chunkedBuilder.addNextValue(row, (row + 5 * column) % 20, 0.1 * (column + 1));
+            builder.addNextValue(row, (row + 5 * column) % 20, 0.1 * (column + 1));
+        }
+    }
+    // Entries with the same column are summed up.
+    chunkedBuilder.addNextValue(19, 19, 0.5);
+    builder.addNextValue(19, 19, 0.5);
+
+    EXPECT_EQ(builder.getCurrentRowGroupCount(), chunkedBuilder.getCurrentRowGroupCount());
+    STORM_SILENT_EXPECT_THROW(chunkedBuilder.addNextValue(18, 0, 1.0), storm::exceptions::InvalidArgumentException);
+
+    storm::storage::SparseMatrix<double> matrix = chunkedBuilder.build(22);
+    EXPECT_EQ(22ul, matrix.getRowCount());
+    EXPECT_EQ(builder.build(22), matrix);
+}
+
+TEST(ChunkedSparseMatrixBuilderTest, RowGroupsAndAppend) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    storm::storage::ChunkedSparseMatrixBuilder<double> first(true, 4);
+    storm::storage::ChunkedSparseMatrixBuilder<double> second(true, 4);
+
+    // The first part covers row groups 0 and 1, the second one covers row groups 2 to 4 (where row group 4 is empty).
+    builder.newRowGroup(0);
+    first.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    first.addNextValue(0, 3, 0.5);
+    first.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 0, 1.0);
+    first.addNextValue(1, 0, 1.0);
+    builder.newRowGroup(2);
+    first.newRowGroup(2);
+    builder.addNextValue(2, 2, 1.0);
+    first.addNextValue(2, 2, 1.0);
+
+    builder.newRowGroup(3);
+    second.newRowGroup(0);
+    builder.addNextValue(3, 0, 0.25);
+    builder.addNextValue(3, 1, 0.25);
+    builder.addNextValue(3, 2, 0.25);
+    builder.addNextValue(3, 3, 0.25);
+    builder.addNextValue(3, 4, 1.0);
+    second.addNextValue(0, 0, 0.25);
+    second.addNextValue(0, 1, 0.25);
+    second.addNextValue(0, 2, 0.25);
+    second.addNextValue(0, 3, 0.25);
+    second.addNextValue(0, 4, 1.0);
+    builder.newRowGroup(4);
+    second.newRowGroup(1);
+    builder.addNextValue(5, 3, 1.0);
+    second.addNextValue(2, 3, 1.0);
+    builder.newRowGroup(6);
+    second.newRowGroup(3);
+
+    first.append(std::move(second));
+    EXPECT_EQ(5ul, first.getCurrentRowGroupCount());
+    EXPECT_EQ(10ul, first.getNumberOfEntries());
+    EXPECT_EQ(builder.build(), first.build());
+}
+
+TEST(ChunkedSparseMatrixBuilderTest, ReplaceColumns) {
+    storm::storage::SparseMatrixBuilder<double> builder;
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedBuilder(false, 2);
+    for (uint64_t row = 0; row < 4; ++row) {
+        for (uint64_t column = 0; column < 4; column += row % 2 + 1) {
+            builder.addNextValue(row, column, 1.0 + row + 0.1 * column);
+            chunkedBuilder.addNextValue(row, column, 1.0 + row + 0.1 * column);
+        }
+    }
+    std::vector<uint64_t> replacements = {3, 2, 0, 1};
+    builder.replaceColumns(replacements, 0);
+    chunkedBuilder.replaceColumns(replacements, 0);
+    EXPECT_EQ(builder.build(), chunkedBuilder.build());
+}
@@ -0,0 +1,83 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/storage/CompactScheduler.h"
+
+TEST(CompactSchedulerTest, DeterministicScheduler) {
+    storm::storage::CompactScheduler<double> scheduler(std::vector<uint64_t>({1, 3, 5, 4}));
+    // Five is the largest choice, so the codes range up to seven.
+    EXPECT_EQ(3ul, scheduler.getBitsPerChoice());
+    EXPECT_FALSE(scheduler.isPartialScheduler());
+    EXPECT_TRUE(scheduler.isDeterministicScheduler());
+    EXPECT_EQ(1ul, scheduler.getDeterministicChoice(0));
+    EXPECT_EQ(3ul, scheduler.getDeterministicChoice(1));
+    EXPECT_EQ(5ul, scheduler.getDeterministicChoice(2));
+    EXPECT_EQ(4ul, scheduler.getChoice(3).getDeterministicChoice());
+
+    scheduler.clearChoice(2);
+    EXPECT_TRUE(scheduler.isPartialScheduler());
+    EXPECT_FALSE(scheduler.getChoice(2).isDefined());
+    EXPECT_EQ(4ul, scheduler.getDeterministicChoice(3));
+    STORM_SILENT_EXPECT_THROW(scheduler.setChoice(0, 6), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(CompactSchedulerTest, RandomizedScheduler) {
+    storm::storage::Scheduler<double> original(3);
+    original.setChoice(2, 0);
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.25);
+    distribution.addProbability(1, 0.75);
+    original.setChoice(distribution, 1);
+
+    storm::storage::CompactScheduler<double> scheduler(original);
+    EXPECT_TRUE(scheduler.isPartialScheduler());
+    EXPECT_FALSE(scheduler.isDeterministicScheduler());
+    EXPECT_TRUE(scheduler.isChoiceDeterministic(0));
+    EXPECT_FALSE(scheduler.isChoiceDeterministic(1));
+    EXPECT_FALSE(scheduler.isChoiceDefined(2));
+    EXPECT_EQ(0.75, scheduler.getChoice(1).getChoiceAsDistribution().getProbability(1));
+
+    storm::storage::Scheduler<double> converted = scheduler.toScheduler();
+    EXPECT_EQ(2ul, converted.getChoice(0).getDeterministicChoice());
+    EXPECT_EQ(0.25, converted.getChoice(1).getChoiceAsDistribution().getProbability(0));
+    EXPECT_FALSE(converted.getChoice(2).isDefined());
+
+    // Replacing the randomized choice releases its distribution.
+    scheduler.setChoice(1, 1);
+    EXPECT_TRUE(scheduler.isDeterministicScheduler());
+}
+
+TEST(CompactSchedulerTest, Export) {
+    storm::storage::CompactScheduler<double> scheduler(3, 2);
+    scheduler.setChoice(0, 1);
+    storm::storage::Distribution<double, uint_fast64_t> distribution;
+    distribution.addProbability(0, 0.5);
+    distribution.addProbability(1, 0.5);
+    scheduler.setChoice(storm::storage::SchedulerChoice<double>(distribution), 1);
+
+    std::stringstream json;
+    scheduler.exportJson(json);
+    EXPECT_EQ(
+        "[\n"
+        "    {\"s\": 0, \"c\": [{\"index\": 1, \"prob\": 1}]},\n"
+        "    {\"s\": 1, \"c\": [{\"index\": 0, \"prob\": 0.5}, {\"index\": 1, \"prob\": 0.5}]},\n"
+        "    {\"s\": 2, \"c\": \"undefined\"}\n"
+        "]\n",
+        json.str());
+
+    std::stringstream binary;
+    scheduler.exportBinary(binary);
+    auto imported = storm::storage::CompactScheduler<double>::importBinary(binary);
+    EXPECT_EQ(scheduler.getBitsPerChoice(), imported.getBitsPerChoice());
+    EXPECT_EQ(1ul, imported.getDeterministicChoice(0));
+    EXPECT_EQ(0.5, imported.getChoice(1).getChoiceAsDistribution().getProbability(1));
+    EXPECT_FALSE(imported.isChoiceDefined(2));
+    EXPECT_TRUE(imported.isPartialScheduler());
+
+    std::stringstream invalid("not a scheduler");
+    STORM_SILENT_EXPECT_THROW(storm::storage::CompactScheduler<double>::importBinary(invalid), storm::exceptions::WrongFormatException);
+}
@@ -0,0 +1,157 @@
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createTestMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    builder.addNextValue(0, 1, 0.099);
+    builder.addNextValue(0, 2, 0.001);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    builder.newRowGroup(3);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.25);
+    builder.addNextValue(3, 3, 0.75);
+    builder.addNextValue(4, 2, 1.0);
+    return builder.build(5, 4, 4);
+}
+
+}  // namespace
+
+TEST(CompactSparseMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    ASSERT_TRUE((storm::storage::CompactSparseMatrix<double, uint32_t>::canRepresent(matrix)));
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_LT(compactMatrix.getSizeInMemory(), matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint64_t, double>) +
+                                                   (matrix.getRowCount() + 1) * sizeof(uint64_t));
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto compactRow = compactMatrix.getRow(row);
+        ASSERT_EQ(matrix.getRow(row).getNumberOfEntries(), compactRow.getNumberOfEntries());
+        auto compactIt = compactRow.begin();
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), compactIt->getColumn());
+            EXPECT_EQ(entry.getValue(), compactIt->getValue());
+            ++compactIt;
+        }
+        EXPECT_TRUE(compactIt == compactRow.end());
+    }
+}
+
+TEST(CompactSparseMatrix, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+    std::vector<double> x = {0.1, 0.7, 0.3, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05};
+
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_EQ(matrix.multiplyRowWithVector(row, x), compactMatrix.multiplyRowWithVector(row, x));
+    }
+
+    // Gauss-Seidel style multiplications on a square submatrix.
+    storm::storage::BitVector rows(5, true);
+    rows.set(4, false);
+    storm::storage::SparseMatrix<double> square = matrix.getSubmatrix(false, rows, storm::storage::BitVector(4, true));
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactSquare(square);
+    std::vector<double> squareB(b.begin(), b.begin() + 4);
+    std::vector<double> expectedGs = x;
+    std::vector<double> resultGs = x;
+    square.multiplyWithVectorForward(expectedGs, expectedGs, &squareB);
+    compactSquare.multiplyWithVectorForward(0, compactSquare.getRowCount(), resultGs, resultGs, &squareB);
+    EXPECT_EQ(expectedGs, resultGs);
+
+    expectedGs = x;
+    resultGs = x;
+    square.multiplyWithVectorBackward(expectedGs, expectedGs, &squareB);
+    compactSquare.multiplyWithVectorBackward(resultGs, resultGs, &squareB);
+    EXPECT_EQ(expectedGs, resultGs);
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = {0.0, 1.0, 0.0, 0.4};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount(), 0.5);
+        std::vector<double> result = expected;
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> resultChoices = expectedChoices;
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, nullptr, expected, &expectedChoices);
+        compactMatrix.multiplyAndReduce(dir, rowGroupIndices, x, nullptr, result, &resultChoices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, resultChoices);
+
+        // In-place (Gauss-Seidel) variants.
+        std::vector<double> expectedGs = x;
+        std::vector<double> resultGs = x;
+        matrix.multiplyAndReduceForward(dir, rowGroupIndices, expectedGs, nullptr, expectedGs, &expectedChoices);
+        compactMatrix.multiplyAndReduceForward(dir, rowGroupIndices, 0, rowGroupIndices.size() - 1, resultGs, nullptr, resultGs, &resultChoices);
+        EXPECT_EQ(expectedGs, resultGs);
+        EXPECT_EQ(expectedChoices, resultChoices);
+
+        expectedGs = x;
+        resultGs = x;
+        matrix.multiplyAndReduceBackward(dir, rowGroupIndices, expectedGs, nullptr, expectedGs, &expectedChoices);
+        compactMatrix.multiplyAndReduceBackward(dir, rowGroupIndices, resultGs, nullptr, resultGs, &resultChoices);
+        EXPECT_EQ(expectedGs, resultGs);
+        EXPECT_EQ(expectedChoices, resultChoices);
+    }
+}
+
+TEST(CompactSparseMatrix, ValueDictionary) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::CompactSparseMatrix<double, uint32_t> plainMatrix(matrix);
+    storm::storage::CompactSparseMatrix<double, uint32_t> compactMatrix(matrix, true);
+    EXPECT_FALSE(plainMatrix.hasValueDictionary());
+    ASSERT_TRUE(compactMatrix.hasValueDictionary());
+    auto const& valueDictionary = compactMatrix.getValueDictionary();
+    EXPECT_EQ(std::vector<double>({0.9, 0.099, 0.001, 0.5, 1.0, 0.25, 0.75}), std::vector<double>(valueDictionary.begin(), valueDictionary.end()));
+    EXPECT_LT(compactMatrix.getSizeInMemory(), plainMatrix.getSizeInMemory());
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto compactIt = compactMatrix.getRow(row).begin();
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), compactIt->getColumn());
+            EXPECT_EQ(entry.getValue(), compactIt->getValue());
+            ++compactIt;
+        }
+    }
+
+    std::vector<double> x = {0.1, 0.7, 0.3, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05};
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(matrix.getRowGroupCount());
+        std::vector<double> resultReduced(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> resultChoices = expectedChoices;
+        matrix.multiplyAndReduce(dir, rowGroupIndices, x, nullptr, expectedReduced, &expectedChoices);
+        compactMatrix.multiplyAndReduce(dir, rowGroupIndices, x, nullptr, resultReduced, &resultChoices);
+        EXPECT_EQ(expectedReduced, resultReduced);
+        EXPECT_EQ(expectedChoices, resultChoices);
+    }
+}
@@ -0,0 +1,109 @@
+#include "storm/storage/BitVector.h"
+#include "storm/storage/CompressedBitVector.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+// Creates a bit vector that has chunks with few set bits, many set bits, all bits set and no bits set, respectively.
+storm::storage::BitVector createTestVector(uint64_t length, uint64_t shift) {
+    storm::storage::BitVector result(length);
+    for (uint64_t index = shift; index < length; ++index) {
+        uint64_t chunk = index >> 16;
+        if ((chunk % 4 == 0 && index % 1000 == 0) || (chunk % 4 == 1 && index % 3 != 0) || chunk % 4 == 2) {
+            result.set(index);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(CompressedBitVectorTest, Conversion) {
+    storm::storage::BitVector vector = createTestVector(300000, 0);
+    storm::storage::CompressedBitVector compressed(vector);
+    EXPECT_EQ(vector.size(), compressed.size());
+    EXPECT_EQ(vector.getNumberOfSetBits(), compressed.getNumberOfSetBits());
+    EXPECT_EQ(vector, compressed.toBitVector());
+    EXPECT_EQ(std::vector<uint64_t>(vector.begin(), vector.end()), std::vector<uint64_t>(compressed.begin(), compressed.end()));
+
+    for (uint64_t index : {0ul, 999ul, 1000ul, 65536ul, 65537ul, 65538ul, 140000ul, 200000ul, 299999ul}) {
+        EXPECT_EQ(vector.get(index), compressed.get(index)) << "at index " << index;
+        EXPECT_EQ(vector.getNextSetIndex(index), compressed.getNextSetIndex(index)) << "at index " << index;
+        EXPECT_EQ(vector.getNextUnsetIndex(index), compressed.getNextUnsetIndex(index)) << "at index " << index;
+        EXPECT_EQ(vector.getNumberOfSetBitsBeforeIndex(index), compressed.getNumberOfSetBitsBeforeIndex(index)) << "at index " << index;
+    }
+
+    storm::storage::CompressedBitVector empty(300000);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(300000ul, empty.getNextSetIndex(0));
+    storm::storage::CompressedBitVector full(300000, true);
+    EXPECT_TRUE(full.full());
+    EXPECT_EQ(300000ul, full.getNextUnsetIndex(0));
+    EXPECT_EQ(storm::storage::BitVector(300000, true), full.toBitVector());
+}
+
+TEST(CompressedBitVectorTest, SetAlgebra) {
+    storm::storage::BitVector first = createTestVector(300000, 0);
+    storm::storage::BitVector second = createTestVector(300000, 70000);
+    second.set(5);
+    storm::storage::CompressedBitVector compressedFirst(first);
+    storm::storage::CompressedBitVector compressedSecond(second);
+
+    EXPECT_EQ(storm::storage::CompressedBitVector(first & second), compressedFirst & compressedSecond);
+    EXPECT_EQ(storm::storage::CompressedBitVector(first | second), compressedFirst | compressedSecond);
+    EXPECT_EQ(storm::storage::CompressedBitVector(~first), ~compressedFirst);
+    EXPECT_EQ(~first, (~compressedFirst).toBitVector());
+
+    EXPECT_FALSE(compressedFirst.isSubsetOf(compressedSecond));
+    EXPECT_TRUE((compressedFirst & compressedSecond).isSubsetOf(compressedSecond));
+    EXPECT_TRUE(compressedFirst.isDisjointFrom(~compressedFirst));
+    EXPECT_FALSE(compressedFirst.isDisjointFrom(compressedSecond));
+
+    storm::storage::CompressedBitVector result = compressedFirst;
+    result |= compressedSecond;
+    result &= ~compressedSecond;
+    EXPECT_EQ(storm::storage::CompressedBitVector(first & ~second), result);
+}
+
+TEST(CompressedBitVectorTest, SetAndClear) {
+    storm::storage::BitVector vector(200000);
+    storm::storage::CompressedBitVector compressed(200000);
+    // Fill a chunk until its representation changes from an array to a bitmap and a full chunk, and clear it again.
+    for (uint64_t index = 65536; index < 2 * 65536; ++index) {
+        vector.set(index);
+        compressed.set(index);
+    }
+    EXPECT_EQ(storm::storage::CompressedBitVector(vector), compressed);
+    for (uint64_t index = 65536; index < 2 * 65536; index += 2) {
+        vector.set(index, false);
+        compressed.set(index, false);
+    }
+    EXPECT_EQ(storm::storage::CompressedBitVector(vector), compressed);
+    EXPECT_EQ(vector, compressed.toBitVector());
+    for (uint64_t index = 65537; index < 2 * 65536; index += 2) {
+        compressed.set(index, false);
+    }
+    EXPECT_TRUE(compressed.empty());
+
+    // The last chunk is shorter than the others.
+    for (uint64_t index = 3 * 65536; index < 200000; ++index) {
+        compressed.set(index);
+    }
+    EXPECT_EQ(200000ul - 3 * 65536, compressed.getNumberOfSetBits());
+    EXPECT_EQ(3ul * 65536, compressed.getNextSetIndex(0));
+    EXPECT_EQ(200000ul, compressed.getNextUnsetIndex(3 * 65536));
+}
+
+TEST(CompressedBitVectorTest, Size) {
+    storm::storage::BitVector sparse(10000000);
+    sparse.set(17);
+    sparse.set(5000000);
+    EXPECT_TRUE(storm::storage::CompressedBitVector::isCompressionBeneficial(sparse));
+    EXPECT_LT(storm::storage::CompressedBitVector(sparse).getSizeInBytes() * 100, sparse.getSizeInBytes());
+
+    storm::storage::BitVector dense(10000000);
+    for (uint64_t index = 0; index < dense.size(); index += 3) {
+        dense.set(index);
+    }
+    EXPECT_FALSE(storm::storage::CompressedBitVector::isCompressionBeneficial(dense));
+}
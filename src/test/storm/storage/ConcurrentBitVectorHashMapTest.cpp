@@ -0,0 +1,87 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+storm::storage::BitVector keyFor(uint64_t number) {
+    storm::storage::BitVector result(128);
+    result.setFromInt(0, 64, number);
+    result.setFromInt(64, 64, number * 31 + 7);
+    return result;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 4, 8);
+
+    for (uint64_t number = 0; number < 10000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(keyFor(number), number));
+    }
+    EXPECT_EQ(10000ul, map.size());
+    EXPECT_EQ(8ul, map.getNumberOfShards());
+    EXPECT_EQ(128ul, map.getBucketSize());
+
+    for (uint64_t number = 0; number < 10000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(keyFor(number), 0));
+        EXPECT_TRUE(map.contains(keyFor(number)));
+        EXPECT_EQ(number, map.getValue(keyFor(number)));
+    }
+    EXPECT_FALSE(map.contains(keyFor(10000)));
+
+    auto valueBucketPair = map.findOrAddAndGetBucket(keyFor(42), 0);
+    EXPECT_EQ(42ul, valueBucketPair.first);
+    EXPECT_EQ(keyFor(42), map.getBucketAndValue(valueBucketPair.second).first);
+    EXPECT_EQ(42ul, map.getValue(valueBucketPair.second));
+
+    uint64_t numberOfElements = 0;
+    storm::storage::BitVector seen(10000);
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyFor(keyValuePair.second), keyValuePair.first);
+        seen.set(keyValuePair.second);
+        ++numberOfElements;
+    }
+    EXPECT_EQ(10000ul, numberOfElements);
+    EXPECT_TRUE(seen.full());
+
+    auto sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(10000ul, sequentialMap.size());
+    EXPECT_EQ(1234ul, sequentialMap.getValue(keyFor(1234)));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 16);
+    std::atomic<uint32_t> nextIndex(0);
+    uint64_t const numberOfKeys = 20000;
+
+    // All threads insert the same keys, so every key must be assigned exactly one index.
+    std::vector<std::thread> threads;
+    std::vector<std::vector<uint32_t>> indices(4, std::vector<uint32_t>(numberOfKeys));
+    for (uint64_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint64_t number = 0; number < numberOfKeys; ++number) {
+                uint64_t key = (number * 7919 + thread * 4241) % numberOfKeys;
+                indices[thread][key] = map.findOrAddUsingGenerator(keyFor(key), [&nextIndex]() { return nextIndex++; }).first;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextIndex.load());
+    storm::storage::BitVector assigned(numberOfKeys);
+    for (uint64_t key = 0; key < numberOfKeys; ++key) {
+        for (uint64_t thread = 1; thread < 4; ++thread) {
+            EXPECT_EQ(indices[0][key], indices[thread][key]);
+        }
+        EXPECT_FALSE(assigned.get(indices[0][key]));
+        assigned.set(indices[0][key]);
+    }
+}
@@ -3,6 +3,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdStatistics.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/expressions/Expression.h"
@@ -11,6 +12,8 @@
 
 #include "storm/storage/SparseMatrix.h"
 
+#include <sstream>
+
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     storm::dd::Add<storm::dd::DdType::CUDD, double> zero;
@@ -767,3 +770,30 @@ TEST(CuddDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, Statistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first);
+
+    // Recording is disabled unless the statistics are to be exported.
+    manager->recordStatistics("ignored");
+    EXPECT_EQ(0ul, manager->getRecordedStatistics().size());
+    manager->setRecordStatistics(true);
+    manager->recordStatistics("build");
+    ASSERT_EQ(1ul, manager->getRecordedStatistics().size());
+    EXPECT_EQ("build", manager->getRecordedStatistics().front().first);
+
+    storm::dd::DdStatistics statistics = manager->getStatistics();
+    EXPECT_GE(statistics.nodeCount, dd.getNodeCount());
+    EXPECT_GE(statistics.peakNodeCount, statistics.nodeCount);
+    EXPECT_GT(statistics.uniqueTableSlots, 0ul);
+    EXPECT_LE(statistics.cacheHits, statistics.cacheLookups);
+
+    std::stringstream stream;
+    manager->exportStatisticsAsJson(stream);
+    storm::json<double> json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(1ul, json["phases"].size());
+    EXPECT_EQ("build", json["phases"][0]["phase"].template get<std::string>());
+    EXPECT_EQ(1ul, json["final"].count("nodes"));
+}
@@ -0,0 +1,145 @@
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/distributed/Communicator.h"
+#include "storm/storage/distributed/DistributedSparseMatrix.h"
+#include "storm/storage/distributed/StatePartition.h"
+#include "test/storm_gtest.h"
+
+#include <thread>
+
+namespace {
+
+storm::storage::SparseMatrix<double> createTestMatrix() {
+    // Seven states, two of which have two choices.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 6, 0.5);
+    builder.addNextValue(1, 3, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.2);
+    builder.addNextValue(2, 2, 0.8);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 4, 1.0);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 0, 0.1);
+    builder.addNextValue(4, 5, 0.9);
+    builder.addNextValue(5, 3, 1.0);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 2, 0.3);
+    builder.addNextValue(6, 6, 0.7);
+    builder.newRowGroup(7);
+    builder.addNextValue(7, 1, 0.6);
+    builder.addNextValue(7, 5, 0.4);
+    builder.newRowGroup(8);
+    builder.addNextValue(8, 6, 1.0);
+    return builder.build(9, 7, 7);
+}
+
+// Runs the given function on the given number of ranks, each of which runs in its own thread.
+template<typename RankFunction>
+void runOnRanks(uint64_t numberOfRanks, RankFunction const& function) {
+    auto communicators = storm::storage::distributed::SharedMemoryCommunicator::create(numberOfRanks);
+    std::vector<std::thread> threads;
+    for (uint64_t rank = 0; rank < numberOfRanks; ++rank) {
+        threads.emplace_back([&function, &communicators, rank]() { function(communicators[rank]); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+TEST(DistributedSparseMatrixTest, StatePartition) {
+    for (auto method : {storm::storage::distributed::PartitioningMethod::Block, storm::storage::distributed::PartitioningMethod::Cyclic}) {
+        for (uint64_t numberOfRanks : {1ul, 3ul, 4ul, 12ul}) {
+            storm::storage::distributed::StatePartition partition(10, numberOfRanks, method);
+            uint64_t numberOfStates = 0;
+            for (uint64_t rank = 0; rank < numberOfRanks; ++rank) {
+                uint64_t numberOfLocalStates = partition.getNumberOfLocalStates(rank);
+                numberOfStates += numberOfLocalStates;
+                for (uint64_t localIndex = 0; localIndex < numberOfLocalStates; ++localIndex) {
+                    uint64_t state = partition.getGlobalIndex(rank, localIndex);
+                    EXPECT_EQ(rank, partition.getOwner(state));
+                    EXPECT_EQ(localIndex, partition.getLocalIndex(state));
+                }
+            }
+            EXPECT_EQ(10ul, numberOfStates);
+        }
+    }
+
+    // All blocks but the last one have the same size.
+    storm::storage::distributed::StatePartition partition(10, 4);
+    EXPECT_EQ(3ul, partition.getNumberOfLocalStates(0));
+    EXPECT_EQ(1ul, partition.getNumberOfLocalStates(3));
+    EXPECT_EQ(1ul, partition.getOwner(3));
+}
+
+TEST(DistributedSparseMatrixTest, Communicator) {
+    std::vector<uint64_t> maxima(3), sums(3);
+    std::vector<std::vector<std::vector<uint64_t>>> received(3);
+    runOnRanks(3, [&](std::shared_ptr<storm::storage::distributed::Communicator> const& communicator) {
+        uint64_t rank = communicator->getRank();
+        maxima[rank] = communicator->allreduceMax(rank * 10);
+        sums[rank] = communicator->allreduceSum(rank + 1);
+        // Every rank sends its rank to all ranks with a larger rank.
+        std::vector<std::vector<uint64_t>> sendBuffers(3);
+        for (uint64_t target = rank + 1; target < 3; ++target) {
+            sendBuffers[target].push_back(rank);
+        }
+        received[rank] = communicator->exchange(sendBuffers);
+    });
+    for (uint64_t rank = 0; rank < 3; ++rank) {
+        EXPECT_EQ(20ul, maxima[rank]);
+        EXPECT_EQ(6ul, sums[rank]);
+        for (uint64_t source = 0; source < 3; ++source) {
+            EXPECT_EQ(source < rank ? std::vector<uint64_t>({source}) : std::vector<uint64_t>(), received[rank][source]);
+        }
+    }
+}
+
+TEST(DistributedSparseMatrixTest, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    std::vector<double> x = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+    std::vector<double> b = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+    std::vector<double> expected(matrix.getRowGroupCount());
+    matrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, expected);
+
+    for (auto method : {storm::storage::distributed::PartitioningMethod::Block, storm::storage::distributed::PartitioningMethod::Cyclic}) {
+        storm::storage::distributed::StatePartition partition(matrix.getRowGroupCount(), 3, method);
+        std::vector<double> result(matrix.getRowGroupCount());
+        runOnRanks(3, [&](std::shared_ptr<storm::storage::distributed::Communicator> const& communicator) {
+            uint64_t rank = communicator->getRank();
+            auto localRows = storm::storage::distributed::DistributedSparseMatrix<double>::extractLocalRows(matrix, partition, rank);
+            storm::storage::distributed::DistributedSparseMatrix<double> distributedMatrix(localRows, partition, communicator);
+
+            // Only the values of the local states are known before the synchronization.
+            std::vector<double> localX(distributedMatrix.getNumberOfColumns(), -1.0);
+            std::vector<double> localB;
+            for (uint64_t localState = 0; localState < distributedMatrix.getNumberOfLocalStates(); ++localState) {
+                uint64_t state = partition.getGlobalIndex(rank, localState);
+                localX[localState] = x[state];
+                for (uint64_t row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+                    localB.push_back(b[row]);
+                }
+            }
+            distributedMatrix.synchronizeGhostValues(localX);
+            std::vector<double> localResult(distributedMatrix.getNumberOfLocalStates());
+            distributedMatrix.multiplyAndReduce(storm::solver::OptimizationDirection::Maximize, localX, &localB, localResult);
+            for (uint64_t localState = 0; localState < localResult.size(); ++localState) {
+                result[partition.getGlobalIndex(rank, localState)] = localResult[localState];
+            }
+        });
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], result[state], 1e-12) << "in state " << state << ".";
+        }
+    }
+}
+
+TEST(DistributedSparseMatrixTest, IllegalPartition) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::distributed::StatePartition partition(matrix.getRowGroupCount() + 1, 1);
+    STORM_SILENT_EXPECT_THROW(storm::storage::distributed::DistributedSparseMatrix<double>::extractLocalRows(matrix, partition, 0),
+                              storm::exceptions::InvalidArgumentException);
+}
@@ -1,6 +1,8 @@
 #include "adapters/RationalNumberAdapter.h"
 #include "storage/expressions/OperatorType.h"
 #include "storm-parsers/parser/ExpressionCreator.h"
+#include "storm/storage/expressions/BytecodeCompiler.h"
+#include "storm/storage/expressions/BytecodeExpressionEvaluator.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
@@ -93,3 +95,145 @@ TEST(ExpressionEvaluation, NegativeModulo) {
     EXPECT_NEAR(result3, expectedDouble, 1e-6);
     EXPECT_NEAR(result4, expectedDouble, 1e-6);
 }
+
+TEST(ExpressionEvaluation, BytecodeEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+
+    storm::expressions::Expression iteExpression = storm::expressions::ite(x, y + z, manager->integer(3) * z);
+    storm::expressions::BytecodeExpressionEvaluator eval(*manager);
+
+    eval.setRationalValue(z, 5.5);
+    eval.setBooleanValue(x, true);
+    for (int_fast64_t i = 0; i < 1000; ++i) {
+        eval.setIntegerValue(y, 3 + i);
+        EXPECT_NEAR(8.5 + i, eval.asRational(iteExpression), 1e-6);
+    }
+
+    eval.setBooleanValue(x, false);
+    for (int_fast64_t i = 0; i < 1000; ++i) {
+        double zValue = i / static_cast<double>(10);
+        eval.setRationalValue(z, zValue);
+        EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
+    }
+
+    storm::expressions::Expression guard = (x || y > 2) && !(z >= manager->rational(1.5)) && storm::expressions::iff(x, y == manager->integer(3));
+    eval.setBooleanValue(x, false);
+    eval.setIntegerValue(y, 4);
+    eval.setRationalValue(z, 1.0);
+    EXPECT_TRUE(eval.asBool(guard));
+    eval.setRationalValue(z, 1.5);
+    EXPECT_FALSE(eval.asBool(guard));
+    eval.setRationalValue(z, 1.0);
+    eval.setIntegerValue(y, 3);
+    EXPECT_FALSE(eval.asBool(guard));
+    eval.setBooleanValue(x, true);
+    EXPECT_TRUE(eval.asBool(guard));
+
+    std::vector<storm::expressions::Expression> operands = {x.getExpression(), y > 0, z > 0};
+    eval.setIntegerValue(y, 0);
+    EXPECT_TRUE(eval.asBool(storm::expressions::atLeastOneOf(operands)));
+    EXPECT_FALSE(eval.asBool(storm::expressions::atMostOneOf(operands)));
+    EXPECT_FALSE(eval.asBool(storm::expressions::exactlyOneOf(operands)));
+    eval.setBooleanValue(x, false);
+    EXPECT_TRUE(eval.asBool(storm::expressions::atMostOneOf(operands)));
+    EXPECT_TRUE(eval.asBool(storm::expressions::exactlyOneOf(operands)));
+}
+
+TEST(ExpressionEvaluation, BytecodeIntegerSemantics) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::BytecodeExpressionEvaluator eval(*manager);
+
+    // Integers are not rounded to doubles.
+    int_fast64_t const large = (1ll << 53) + 1;
+    eval.setIntegerValue(y, large);
+    EXPECT_EQ(large + 1, eval.asInt(y + 1));
+    EXPECT_TRUE(eval.asBool(y + 1 > manager->integer(large)));
+
+    // The division of integers yields a rational (as in PRISM).
+    eval.setIntegerValue(y, 3);
+    EXPECT_TRUE(eval.asBool(y / manager->integer(2) > 1));
+    EXPECT_NEAR(1.5, eval.asRational(y / manager->integer(2)), 1e-12);
+    EXPECT_EQ(1, eval.asInt(storm::expressions::floor(y / manager->integer(2))));
+    EXPECT_EQ(2, eval.asInt(storm::expressions::ceil(y / manager->integer(2))));
+    EXPECT_EQ(9, eval.asInt(storm::expressions::pow(y, manager->integer(2), true)));
+
+    eval.setIntegerValue(y, -7);
+    EXPECT_EQ(2, eval.asInt(y % manager->integer(3)));
+    EXPECT_EQ(-7, eval.asInt(storm::expressions::minimum(y, -y)));
+    EXPECT_EQ(7, eval.asInt(storm::expressions::maximum(y, -y)));
+}
+
+TEST(ExpressionEvaluation, BytecodeSharedSubexpressions) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+
+    // Both guards compare y with 3, which is computed only once.
+    storm::expressions::BytecodeCompiler compiler;
+    uint64_t first = compiler.addExpression(x && y < 3);
+    uint64_t second = compiler.addExpression(!x && y < 3);
+    storm::expressions::BytecodeProgram const& program = compiler.getProgram();
+    EXPECT_EQ(6ul, program.getNumberOfInstructions());
+
+    storm::expressions::BytecodeRegisters registers;
+    registers.booleanVariables.resize(manager->getNumberOfBooleanVariables());
+    registers.integerVariables.resize(manager->getNumberOfIntegerVariables());
+    registers.booleanVariables[x.getOffset()] = 0;
+    registers.integerVariables[y.getOffset()] = 2;
+    program.evaluate(registers);
+    EXPECT_FALSE(program.getBooleanValue(registers, first));
+    EXPECT_TRUE(program.getBooleanValue(registers, second));
+
+    // Values computed in a branch of an if-then-else expression are not reused outside of the branch.
+    uint64_t third = compiler.addExpression(storm::expressions::ite(x, y * manager->integer(2), y * manager->integer(3)) + y * manager->integer(3));
+    registers.booleanVariables[x.getOffset()] = 1;
+    compiler.getProgram().evaluate(registers);
+    EXPECT_EQ(10, compiler.getProgram().getIntegerValue(registers, third));
+}
+
+TEST(ExpressionEvaluation, BytecodeBatchEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareRationalVariable("z");
+
+    storm::expressions::BytecodeCompiler compiler;
+    std::vector<uint64_t> outputs;
+    outputs.push_back(compiler.addExpression(x && y < 3));
+    outputs.push_back(compiler.addExpression(storm::expressions::ite(x, y % manager->integer(4) == manager->integer(1), z / y > manager->rational(0.5))));
+    outputs.push_back(compiler.addExpression(storm::expressions::ite(y > 2, z * manager->integer(2), z + y) >= manager->rational(3.0)));
+    storm::expressions::BytecodeProgram const& program = compiler.getProgram();
+
+    // The batch evaluation yields the same values as the evaluation of the lanes one by one.
+    uint64_t const numberOfLanes = 37;
+    storm::expressions::BytecodeBatchRegisters batchRegisters;
+    batchRegisters.numberOfLanes = numberOfLanes;
+    batchRegisters.booleanVariables.resize(numberOfLanes);
+    batchRegisters.integerVariables.resize(numberOfLanes);
+    batchRegisters.rationalVariables.resize(numberOfLanes);
+    for (uint64_t lane = 0; lane < numberOfLanes; ++lane) {
+        batchRegisters.booleanVariables[x.getOffset() * numberOfLanes + lane] = lane % 2;
+        batchRegisters.integerVariables[y.getOffset() * numberOfLanes + lane] = static_cast<int64_t>(lane % 7) - 1;
+        batchRegisters.rationalVariables[z.getOffset() * numberOfLanes + lane] = lane / 10.0;
+    }
+    program.evaluateBatch(batchRegisters);
+
+    storm::expressions::BytecodeRegisters registers;
+    registers.booleanVariables.resize(1);
+    registers.integerVariables.resize(1);
+    registers.rationalVariables.resize(1);
+    for (uint64_t lane = 0; lane < numberOfLanes; ++lane) {
+        registers.booleanVariables[x.getOffset()] = batchRegisters.booleanVariables[lane];
+        registers.integerVariables[y.getOffset()] = batchRegisters.integerVariables[lane];
+        registers.rationalVariables[z.getOffset()] = batchRegisters.rationalVariables[lane];
+        program.evaluate(registers);
+        for (uint64_t output : outputs) {
+            EXPECT_EQ(program.getBooleanValue(registers, output), program.getBooleanValue(batchRegisters, output, lane)) << "in lane " << lane;
+        }
+    }
+}
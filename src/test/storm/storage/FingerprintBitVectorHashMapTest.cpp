@@ -0,0 +1,74 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/FingerprintBitVectorHashMap.h"
+
+TEST(FingerprintBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::FingerprintBitVectorHashMap<uint64_t> map(128, 3);
+
+    storm::storage::BitVector first(128);
+    first.set(4);
+    first.set(100);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(128);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    // Buckets are the indices of the entries in the order of insertion.
+    storm::storage::BitVector third(128);
+    third.set(10);
+    third.set(127);
+    std::pair<uint64_t, uint64_t> valueBucketPair = map.findOrAddAndGetBucket(third, 3);
+    EXPECT_EQ(3ul, valueBucketPair.first);
+    EXPECT_EQ(2ul, valueBucketPair.second);
+    EXPECT_EQ(3ul, map.size());
+
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_FALSE(map.contains(storm::storage::BitVector(128)));
+    EXPECT_EQ(2ul, map.getValue(second));
+    EXPECT_EQ(third, map.getBucketAndValue(2).first);
+    EXPECT_EQ(3ul, map.getBucketAndValue(2).second);
+}
+
+TEST(FingerprintBitVectorHashMapTest, AgreesWithBitVectorHashMap) {
+    uint64_t const bitsPerKey = 192;
+    storm::storage::FingerprintBitVectorHashMap<uint32_t> map(bitsPerKey, 10);
+    storm::storage::BitVectorHashMap<uint32_t> referenceMap(bitsPerKey, 10);
+
+    // Few distinct values per word, such that many keys are found repeatedly and the table grows several times.
+    std::mt19937_64 generator(42);
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t index = 0; index < 20000; ++index) {
+        storm::storage::BitVector key(bitsPerKey);
+        for (uint64_t bitIndex = 0; bitIndex < bitsPerKey; bitIndex += 64) {
+            key.setFromInt(bitIndex, 64, generator() % 23);
+        }
+        keys.push_back(key);
+        EXPECT_EQ(referenceMap.findOrAdd(key, referenceMap.size()), map.findOrAdd(key, map.size()));
+    }
+    EXPECT_EQ(referenceMap.size(), map.size());
+    EXPECT_GT(map.capacity(), map.size());
+
+    // The entries are iterated in the order of insertion.
+    uint32_t expectedValue = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(expectedValue, keyValuePair.second);
+        EXPECT_EQ(keyValuePair.second, referenceMap.getValue(keyValuePair.first));
+        ++expectedValue;
+    }
+    EXPECT_EQ(map.size(), expectedValue);
+
+    map.remap([](uint32_t const& value) { return value + 1; });
+    for (auto const& key : keys) {
+        EXPECT_EQ(referenceMap.getValue(key) + 1, map.getValue(key));
+    }
+}
@@ -0,0 +1,50 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+TEST(FlexibleSparseMatrix, ConversionFromAndToSparseMatrix) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 10);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    for (uint64_t column = 0; column < 10; ++column) {
+        builder.addNextValue(1, column, 0.1);
+    }
+    builder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    EXPECT_EQ(3ull, flexibleMatrix.getRowCount());
+    EXPECT_EQ(10ull, flexibleMatrix.getColumnCount());
+    EXPECT_EQ(13ull, flexibleMatrix.getNonzeroEntryCount());
+    EXPECT_EQ(2ull, flexibleMatrix.getRow(0).size());
+    EXPECT_EQ(10ull, flexibleMatrix.getRow(1).size());
+    EXPECT_TRUE(flexibleMatrix.rowHasDiagonalElement(2));
+    EXPECT_FALSE(flexibleMatrix.rowHasDiagonalElement(0));
+    EXPECT_TRUE(matrix == flexibleMatrix.createSparseMatrix());
+}
+
+TEST(FlexibleSparseMatrix, ModifyRows) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(2);
+    auto& row = flexibleMatrix.getRow(0);
+
+    // Grow the row beyond the entries that are stored inline and shrink it again.
+    uint64_t numberOfEntries = 2 * storm::storage::FlexibleSparseMatrix<double>::inlineRowCapacity + 1;
+    for (uint64_t column = 0; column < numberOfEntries; ++column) {
+        row.emplace_back(numberOfEntries - column - 1, static_cast<double>(column));
+    }
+    std::sort(row.begin(), row.end(), [](auto const& first, auto const& second) { return first.getColumn() < second.getColumn(); });
+    EXPECT_EQ(numberOfEntries, row.size());
+    EXPECT_EQ(0ull, row.front().getColumn());
+    EXPECT_EQ(static_cast<double>(numberOfEntries - 1), row.front().getValue());
+
+    row.erase(row.begin() + 1, row.end());
+    row.shrink_to_fit();
+    EXPECT_EQ(1ull, row.size());
+    flexibleMatrix.getRow(1) = row;
+    flexibleMatrix.updateDimensions();
+    EXPECT_EQ(2ull, flexibleMatrix.getNonzeroEntryCount());
+    EXPECT_EQ(1ull, flexibleMatrix.getColumnCount());
+    EXPECT_EQ(row, flexibleMatrix.getRow(1));
+}
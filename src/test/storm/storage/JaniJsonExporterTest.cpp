@@ -0,0 +1,48 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm-parsers/parser/JaniParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/visitor/JSONExporter.h"
+
+namespace {
+
+// Guards and updates of the commands repeat such that they can be shared.
+std::string const programString = R"(mdp
+module main
+    x : [0..10] init 0;
+    y : [0..10] init 0;
+    [] x<10 & y<10 & x+y<15 -> 0.5:(x'=min(x+1,10)) + 0.5:(y'=min(y+1,10));
+    [] x<10 & y<10 & x+y<15 -> (x'=min(x+1,10));
+    [] x=10 | y=10 | x+y>=15 -> true;
+endmodule
+)";
+
+TEST(JaniJsonExporterTest, IncrementalExport) {
+    storm::jani::Model janiModel = storm::parser::PrismParser::parseFromString(programString, "inline").toJani();
+    for (bool compact : {false, true}) {
+        std::stringstream domStream, incrementalStream;
+        storm::jani::JsonExporter::toStream(janiModel, {}, domStream, true, compact);
+        storm::jani::JsonExporter::toStreamIncrementally(janiModel, {}, incrementalStream, true, compact);
+        // The order of the entries may differ, so we compare the parsed json
+        EXPECT_EQ(storm::jani::ExportJsonType::parse(domStream.str()), storm::jani::ExportJsonType::parse(incrementalStream.str()));
+    }
+
+    std::stringstream sharedStream;
+    storm::jani::JsonExporter::toStreamIncrementally(janiModel, {}, sharedStream, true, true, true);
+    auto sharedModel = storm::parser::JaniParser<storm::RationalNumber>::parseFromString(sharedStream.str(), false).first;
+    EXPECT_TRUE(sharedModel.getModelFeatures().hasFunctions());
+    EXPECT_FALSE(sharedModel.getAutomaton(0).getFunctionDefinitions().empty());
+
+    auto model = storm::builder::ExplicitModelBuilder<double>(janiModel.substituteConstantsFunctions()).build();
+    auto sharedExplicitModel = storm::builder::ExplicitModelBuilder<double>(sharedModel.substituteConstantsFunctions()).build();
+    EXPECT_EQ(model->getNumberOfStates(), sharedExplicitModel->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), sharedExplicitModel->getNumberOfTransitions());
+}
+
+}  // namespace
@@ -1,10 +1,14 @@
 #include "storm-config.h"
+#include "storm-parsers/api/model_descriptions.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "test/storm_gtest.h"
 
 #include "storm/utility/solver.h"
 
+#include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/storage/jani/eliminator/ArrayEliminator.h"
 
 #ifdef STORM_HAVE_MSAT
 TEST(JaniModelTest, FlattenComposition) {
@@ -165,3 +169,81 @@ TEST(JaniModelTest, FlattenComposition_Dice_Z3) {
     EXPECT_EQ(16ull, janiModel.getAutomaton(0).getNumberOfEdges());
 }
 #endif
+
+TEST(JaniModelTest, EliminateArraysWithVariableIndices) {
+    // The transient variables read arrays with variable indices: va = a[i], vi = a[a[i]-1], vn = n[i][j], and from the array value
+    // vl = [[2,7],[1],[8,2,8]][i][j] and vs = [[2,7],[1],[8,2,8]][i][1]. As n is ragged, some cells are out of bounds, e.g., there is no
+    // cell with index 1 in the second row, so vs only selects between the first and the last row.
+    std::string const nestedArrayValue =
+        R"({"op": "av", "elements": [{"op": "av", "elements": [2, 7]}, {"op": "av", "elements": [1]}, {"op": "av", "elements": [8, 2, 8]}]})";
+    std::string const janiString = R"({
+        "jani-version": 1, "name": "array_reads", "type": "dtmc", "features": ["arrays"], "actions": [], "constants": [], "properties": [],
+        "variables": [
+            {"name": "a", "type": {"kind": "array", "base": "int"}, "initial-value": {"op": "av", "elements": [3, 1, 4, 1, 5]}},
+            {"name": "n", "type": {"kind": "array", "base": {"kind": "array", "base": "int"}}, "initial-value": )" +
+                                   nestedArrayValue + R"(},
+            {"name": "i", "type": {"kind": "bounded", "base": "int", "lower-bound": 0, "upper-bound": 4}, "initial-value": 0},
+            {"name": "j", "type": {"kind": "bounded", "base": "int", "lower-bound": 0, "upper-bound": 2}, "initial-value": 0},
+            {"name": "va", "type": "int", "transient": true, "initial-value": 0},
+            {"name": "vi", "type": "int", "transient": true, "initial-value": 0},
+            {"name": "vn", "type": "int", "transient": true, "initial-value": 0},
+            {"name": "vl", "type": "int", "transient": true, "initial-value": 0},
+            {"name": "vs", "type": "int", "transient": true, "initial-value": 0}
+        ],
+        "automata": [{
+            "name": "reader",
+            "locations": [{"name": "l", "transient-values": [
+                {"ref": "va", "value": {"op": "aa", "exp": "a", "index": "i"}},
+                {"ref": "vi", "value": {"op": "aa", "exp": "a", "index": {"op": "-", "left": {"op": "aa", "exp": "a", "index": "i"}, "right": 1}}},
+                {"ref": "vn", "value": {"op": "aa", "exp": {"op": "aa", "exp": "n", "index": "i"}, "index": "j"}},
+                {"ref": "vl", "value": {"op": "aa", "exp": {"op": "aa", "exp": )" +
+                                   nestedArrayValue + R"(, "index": "i"}, "index": "j"}},
+                {"ref": "vs", "value": {"op": "aa", "exp": {"op": "aa", "exp": )" +
+                                   nestedArrayValue + R"(, "index": "i"}, "index": 1}}
+            ]}],
+            "initial-locations": ["l"],
+            "edges": [{"location": "l", "destinations": [{"location": "l"}]}]
+        }],
+        "system": {"elements": [{"automaton": "reader"}]}
+    })";
+
+    storm::jani::Model janiModel = storm::api::parseJaniModelFromString(janiString).first;
+    ASSERT_TRUE(janiModel.containsArrayVariables());
+    janiModel.eliminateArrays();
+    ASSERT_FALSE(janiModel.containsArrayVariables());
+
+    // The variables replacing the array cells keep their initial values.
+    storm::expressions::ExpressionManager& manager = janiModel.getManager();
+    std::map<storm::expressions::Variable, storm::expressions::Expression> valuation;
+    for (auto const& variable : janiModel.getGlobalVariables()) {
+        if (!variable.isTransient() && variable.hasInitExpression()) {
+            valuation[variable.getExpressionVariable()] = variable.getInitExpression();
+        }
+    }
+    std::map<std::string, storm::expressions::Expression> reads;
+    for (auto const& assignment : janiModel.getAutomaton(0).getLocation(0).getAssignments()) {
+        reads[assignment.getVariable().getName()] = assignment.getAssignedExpression();
+    }
+    ASSERT_EQ(5ull, reads.size());
+
+    auto evaluate = [&](std::string const& read, int64_t i, int64_t j) {
+        valuation[manager.getVariable("i")] = manager.integer(i);
+        valuation[manager.getVariable("j")] = manager.integer(j);
+        return reads.at(read).substitute(valuation).evaluateAsInt();
+    };
+    std::vector<int64_t> const a = {3, 1, 4, 1, 5};
+    std::vector<std::vector<int64_t>> const n = {{2, 7}, {1}, {8, 2, 8}};
+    for (int64_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(a[i], evaluate("va", i, 0)) << "i=" << i;
+        EXPECT_EQ(a[a[i] - 1], evaluate("vi", i, 0)) << "i=" << i;
+    }
+    for (int64_t i = 0; i < 3; ++i) {
+        for (int64_t j = 0; j < static_cast<int64_t>(n[i].size()); ++j) {
+            EXPECT_EQ(n[i][j], evaluate("vn", i, j)) << "i=" << i << ", j=" << j;
+            EXPECT_EQ(n[i][j], evaluate("vl", i, j)) << "i=" << i << ", j=" << j;
+        }
+        if (n[i].size() > 1) {
+            EXPECT_EQ(n[i][1], evaluate("vs", i, 0)) << "i=" << i;
+        }
+    }
+}
@@ -7,8 +7,11 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/parallel.h"
 #include "test/storm_gtest.h"
 
+#include <algorithm>
+
 TEST(MaximalEndComponentDecomposition, FullSystem1) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
         storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
@@ -179,3 +182,37 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, Parallel) {
+    auto getSortedMecs = [](storm::storage::MaximalEndComponentDecomposition<double> const& decomposition) {
+        std::vector<std::vector<std::pair<uint64_t, std::vector<uint64_t>>>> result;
+        for (auto const& mec : decomposition) {
+            std::vector<std::pair<uint64_t, std::vector<uint64_t>>> stateChoicesPairs;
+            for (auto const& stateChoicesPair : mec) {
+                stateChoicesPairs.emplace_back(stateChoicesPair.first, std::vector<uint64_t>(stateChoicesPair.second.begin(), stateChoicesPair.second.end()));
+            }
+            std::sort(stateChoicesPairs.begin(), stateChoicesPairs.end());
+            result.push_back(std::move(stateChoicesPairs));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    for (std::string const& prismModelPath : {STORM_TEST_RESOURCES_DIR "/mdp/prism-mec-example2.nm", STORM_TEST_RESOURCES_DIR "/mdp/leader4.nm",
+                                             STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm"}) {
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(prismModelPath);
+        storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+        std::shared_ptr<storm::models::sparse::Mdp<double>> mdp =
+            storm::builder::ExplicitModelBuilder<double>(program).build()->as<storm::models::sparse::Mdp<double>>();
+
+        storm::storage::MaximalEndComponentDecomposition<double> sequentialDecomposition(*mdp);
+        storm::utility::parallel::setDefaultNumberOfThreads(4);
+        storm::storage::MaximalEndComponentDecomposition<double> parallelDecomposition(*mdp);
+        storm::utility::parallel::setDefaultNumberOfThreads(1);
+        EXPECT_EQ(getSortedMecs(sequentialDecomposition), getSortedMecs(parallelDecomposition)) << prismModelPath;
+
+        // The decomposition stored in the model is computed once and then reused.
+        EXPECT_EQ(sequentialDecomposition.size(), mdp->getMaximalEndComponentDecomposition().size());
+        EXPECT_EQ(&mdp->getMaximalEndComponentDecomposition(), &mdp->getMaximalEndComponentDecomposition());
+    }
+}
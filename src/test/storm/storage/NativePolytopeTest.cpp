@@ -0,0 +1,88 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/storage/geometry/NativePolytope.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+typedef std::vector<double> Point;
+
+// The vertices of the unit hypercube of the given dimension, shifted by the given offset.
+std::vector<Point> getHypercubeVertices(uint64_t dimension, double offset) {
+    std::vector<Point> result;
+    for (uint64_t mask = 0; mask < (1ull << dimension); ++mask) {
+        Point p(dimension, offset);
+        for (uint64_t dim = 0; dim < dimension; ++dim) {
+            if (mask & (1ull << dim)) {
+                p[dim] += 1.0;
+            }
+        }
+        result.push_back(p);
+    }
+    return result;
+}
+
+bool containsPoint(std::vector<Point> const& points, Point const& point) {
+    return std::find(points.begin(), points.end(), point) != points.end();
+}
+
+TEST(NativePolytopeTest, VerticesOfConvexHull) {
+    uint64_t const dimension = 4;
+    std::vector<Point> expectedVertices = getHypercubeVertices(dimension, 0.0);
+    std::vector<Point> points = expectedVertices;
+    // Add the center, a point on a facet, and a point on an edge of the cube as well as a duplicate vertex.
+    points.push_back(Point(dimension, 0.5));
+    points.push_back({1.0, 0.5, 0.5, 0.5});
+    points.push_back({1.0, 1.0, 1.0, 0.5});
+    points.push_back(expectedVertices.back());
+
+    auto polytope = storm::storage::geometry::NativePolytope<double>::create(boost::none, points);
+    auto vertices = polytope->getVertices();
+    EXPECT_EQ(expectedVertices.size(), vertices.size());
+    for (auto const& v : expectedVertices) {
+        EXPECT_TRUE(containsPoint(vertices, v));
+    }
+
+    // The convex union with a shifted cube has the vertices of both cubes except the ones inside the union
+    auto shifted = storm::storage::geometry::NativePolytope<double>::create(boost::none, getHypercubeVertices(dimension, 0.5));
+    auto unionVertices = polytope->convexUnion(shifted)->getVertices();
+    EXPECT_EQ(2 * expectedVertices.size() - 2, unionVertices.size());
+    EXPECT_TRUE(containsPoint(unionVertices, Point(dimension, 0.0)));
+    EXPECT_TRUE(containsPoint(unionVertices, Point(dimension, 1.5)));
+    EXPECT_FALSE(containsPoint(unionVertices, Point(dimension, 1.0)));
+
+    // Vertices are transformed along with the polytope
+    std::vector<Point> matrix(dimension, Point(dimension, 0.0));
+    for (uint64_t dim = 0; dim < dimension; ++dim) {
+        matrix[dim][dim] = -2.0;
+    }
+    auto transformedVertices = polytope->affineTransformation(matrix, Point(dimension, 1.0))->getVertices();
+    EXPECT_EQ(expectedVertices.size(), transformedVertices.size());
+    EXPECT_TRUE(containsPoint(transformedVertices, Point(dimension, -1.0)));
+    EXPECT_TRUE(containsPoint(transformedVertices, Point(dimension, 1.0)));
+}
+
+TEST(NativePolytopeTest, DownwardClosureWithDominatedPoints) {
+    typedef storm::RationalNumber ValueType;
+    auto n = [](std::string const& input) { return storm::utility::convertNumber<ValueType>(input); };
+    std::vector<std::vector<ValueType>> paretoPoints = {{n("1"), n("0"), n("0")}, {n("0"), n("1"), n("0")}, {n("0"), n("0"), n("1")}};
+    std::vector<std::vector<ValueType>> points = paretoPoints;
+    points.push_back({n("1/2"), n("0"), n("0")});
+    points.push_back({n("1/4"), n("1/4"), n("1/4")});
+    points.push_back({n("0"), n("0"), n("1")});
+
+    // Additional (dominated) points within the downward closure do not change it
+    auto downwardClosure = storm::storage::geometry::Polytope<ValueType>::createDownwardClosure(points);
+    for (auto const& p : paretoPoints) {
+        EXPECT_TRUE(downwardClosure->contains(p));
+    }
+    EXPECT_TRUE(downwardClosure->contains(std::vector<ValueType>({n("1/3"), n("1/3"), n("1/3")})));
+    EXPECT_TRUE(downwardClosure->contains(std::vector<ValueType>({n("-5"), n("1"), n("-7")})));
+    EXPECT_FALSE(downwardClosure->contains(std::vector<ValueType>({n("2/5"), n("2/5"), n("2/5")})));
+    EXPECT_FALSE(downwardClosure->contains(std::vector<ValueType>({n("1"), n("1/100"), n("0")})));
+}
+
+}  // namespace
@@ -0,0 +1,103 @@
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/SlicedEllpackMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+namespace {
+
+storm::storage::SparseMatrix<double> createTestMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    builder.addNextValue(0, 1, 0.099);
+    builder.addNextValue(0, 2, 0.001);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    builder.newRowGroup(3);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.25);
+    builder.addNextValue(3, 3, 0.75);
+    builder.addNextValue(4, 2, 1.0);
+    return builder.build(5, 4, 4);
+}
+
+}  // namespace
+
+TEST(SlicedEllpackMatrix, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    ASSERT_TRUE((storm::storage::SlicedEllpackMatrix<double, uint32_t>::canRepresent(matrix)));
+
+    // A single slice of width three.
+    storm::storage::SlicedEllpackMatrix<double, uint32_t> unsortedMatrix(matrix, 8, 1);
+    EXPECT_EQ(matrix.getRowCount(), unsortedMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), unsortedMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), unsortedMatrix.getEntryCount());
+    EXPECT_EQ(24ul, unsortedMatrix.getNumberOfStoredEntries());
+
+    // Slices of two rows with the (sorted) row lengths 3,2 | 2,1 | 1.
+    storm::storage::SlicedEllpackMatrix<double, uint32_t> sortedMatrix(matrix, 2, 256);
+    EXPECT_EQ(2ul, sortedMatrix.getSliceSize());
+    EXPECT_EQ(6ul + 4ul + 2ul, sortedMatrix.getNumberOfStoredEntries());
+    EXPECT_LT(sortedMatrix.getSizeInMemory(), unsortedMatrix.getSizeInMemory());
+
+    STORM_SILENT_EXPECT_THROW((storm::storage::SlicedEllpackMatrix<double, uint32_t>(matrix, 0)), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(SlicedEllpackMatrix, MultiplyWithVector) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    std::vector<double> x = {0.1, 0.7, 0.3, 1.0};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05};
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+
+    for (uint64_t sliceSize : {1ul, 2ul, 3ul, 8ul}) {
+        storm::storage::SlicedEllpackMatrix<double, uint32_t> sellMatrix(matrix, sliceSize, 2);
+        std::vector<double> result(matrix.getRowCount());
+        sellMatrix.multiplyWithVector(x, result, &b);
+        EXPECT_EQ(expected, result) << "slice size " << sliceSize;
+    }
+
+    // Padding entries must not turn infinite values into NaN.
+    storm::storage::SlicedEllpackMatrix<double, uint32_t> sellMatrix(matrix, 4, 256);
+    std::vector<double> infinityX = {std::numeric_limits<double>::infinity(), 0.0, 0.0, 0.0};
+    std::vector<double> result(matrix.getRowCount());
+    sellMatrix.multiplyWithVector(infinityX, result);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), result[0]);
+    EXPECT_EQ(0.0, result[1]);
+    EXPECT_EQ(0.0, result[2]);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), result[3]);
+    EXPECT_EQ(0.0, result[4]);
+}
+
+TEST(SlicedEllpackMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::SlicedEllpackMatrix<double, uint32_t> sellMatrix(matrix, 2, 256);
+    std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<double> x = {0.0, 1.0, 0.0, 0.4};
+    std::vector<double> b = {0.01, 0.02, 0.03, 0.04, 0.05};
+    std::vector<double> rowValues;
+    std::vector<std::vector<double> const*> summands = {nullptr, &b};
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        for (std::vector<double> const* summand : summands) {
+            std::vector<double> expected(matrix.getRowGroupCount(), 0.5);
+            std::vector<double> result = expected;
+            std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 1);
+            expectedChoices[1] = 0;
+            std::vector<uint64_t> resultChoices = expectedChoices;
+            matrix.multiplyAndReduce(dir, rowGroupIndices, x, summand, expected, &expectedChoices);
+            sellMatrix.multiplyAndReduce(dir, rowGroupIndices, x, summand, result, &resultChoices, rowValues);
+            EXPECT_EQ(expected, result);
+            EXPECT_EQ(expectedChoices, resultChoices);
+
+            // The vector may be overwritten with the result.
+            std::vector<double> inPlace = x;
+            sellMatrix.multiplyAndReduce(dir, rowGroupIndices, inPlace, summand, inPlace, nullptr, rowValues);
+            EXPECT_EQ(expected, inPlace);
+        }
+    }
+}
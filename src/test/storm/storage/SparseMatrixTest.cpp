@@ -3,6 +3,7 @@
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
 #include "test/storm_gtest.h"
 
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
@@ -597,6 +598,52 @@ TEST(SparseMatrix, Transpose) {
     ASSERT_TRUE(transposeResult == matrix2);
 }
 
+TEST(SparseMatrix, ParallelTranspose) {
+    // Enough entries such that the matrix is transposed in parallel. Different choices of a row group share a successor
+    // and some entries are zero.
+    uint64_t const numberOfGroups = 40000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < group % 3 + 1; ++choice, ++row) {
+            uint64_t first = (group * 7 + choice) % numberOfGroups;
+            uint64_t second = (group * 13 + 5) % numberOfGroups;
+            matrixBuilder.addNextValue(row, std::min(first, second), group % 11 == 0 ? 0.0 : 0.3 + 0.1 * choice);
+            if (first != second) {
+                matrixBuilder.addNextValue(row, std::max(first, second), 0.6 - 0.1 * choice);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::SparseMatrix<double> expectedJoined = matrix.transpose(true);
+    storm::storage::SparseMatrix<double> expectedRows = matrix.transpose(false);
+    storm::storage::SparseMatrix<double> expectedWithZeros = matrix.transpose(true, true);
+
+    storm::utility::parallel::setDefaultNumberOfThreads(4);
+    storm::storage::SparseMatrix<double> joined = matrix.transpose(true);
+    storm::storage::SparseMatrix<double> rows = matrix.transpose(false);
+    storm::storage::SparseMatrix<double> withZeros = matrix.transpose(true, true);
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+
+    // The entries (including the order of entries with the same column) have to coincide exactly.
+    auto expectIdentical = [](storm::storage::SparseMatrix<double> const& expected, storm::storage::SparseMatrix<double> const& actual) {
+        ASSERT_EQ(expected.getRowCount(), actual.getRowCount());
+        ASSERT_EQ(expected.getEntryCount(), actual.getEntryCount());
+        for (uint64_t row = 0; row < expected.getRowCount(); ++row) {
+            ASSERT_EQ(expected.getRow(row).getNumberOfEntries(), actual.getRow(row).getNumberOfEntries());
+            for (auto it1 = expected.begin(row), it2 = actual.begin(row); it1 != expected.end(row); ++it1, ++it2) {
+                EXPECT_EQ(it1->getColumn(), it2->getColumn());
+                EXPECT_EQ(it1->getValue(), it2->getValue());
+            }
+        }
+    };
+    expectIdentical(expectedJoined, joined);
+    expectIdentical(expectedRows, rows);
+    expectIdentical(expectedWithZeros, withZeros);
+}
+
 TEST(SparseMatrix, EquationSystem) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 7);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 1.1));
@@ -712,6 +759,71 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, ParallelMultiplication) {
+    // Enough row groups such that the work is split into several chunks.
+    uint64_t const numberOfGroups = 5000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t choice = 0; choice < group % 3 + 1; ++choice, ++row) {
+            matrixBuilder.addNextValue(row, (group * 7 + choice) % numberOfGroups, 0.3 + 0.1 * choice);
+            matrixBuilder.addNextValue(row, (group * 13 + 5) % numberOfGroups, 0.6 - 0.1 * choice);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t state = 0; state < numberOfGroups; ++state) {
+        x[state] = static_cast<double>(state % 17) / 17.0;
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.01);
+
+    std::vector<double> expected(matrix.getRowCount());
+    matrix.multiplyWithVector(x, expected, &b);
+    std::vector<uint64_t> expectedChoices(numberOfGroups, 0);
+    std::vector<double> expectedReduced(numberOfGroups);
+    matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+
+    storm::utility::parallel::setDefaultNumberOfThreads(4);
+    std::vector<double> result(matrix.getRowCount());
+    matrix.multiplyWithVectorParallel(x, result, &b);
+    std::vector<uint64_t> choices(numberOfGroups, 0);
+    std::vector<double> reduced(numberOfGroups);
+    matrix.multiplyAndReduceParallel(storm::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, &b, reduced, &choices);
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+
+    EXPECT_EQ(expected, result);
+    EXPECT_EQ(expectedReduced, reduced);
+    EXPECT_EQ(expectedChoices, choices);
+}
+
+TEST(SparseMatrix, MultiplyAndReduceWithConvergenceCheck) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 2, 0, false, true);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 0, 0.5);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.addNextValue(1, 1, 1.0);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 1, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+
+    std::vector<double> x = {0.5, 1.0};
+    std::vector<double> expected(2);
+    std::vector<double> result(2);
+    matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, expected, nullptr);
+    EXPECT_FALSE(matrix.multiplyAndReduceForwardWithConvergenceCheck(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, result, 1e-6, false));
+    EXPECT_EQ(expected, result);
+    EXPECT_TRUE(matrix.multiplyAndReduceForwardWithConvergenceCheck(storm::OptimizationDirection::Maximize, rowGroupIndices, result, nullptr, x, 1e-6, false));
+
+    // In-place (Gauss-Seidel) variant compares with the values before the update.
+    x = {0.5, 1.0};
+    EXPECT_FALSE(matrix.multiplyAndReduceBackwardWithConvergenceCheck(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, x, 1e-6, true));
+    EXPECT_EQ(expected, x);
+    EXPECT_TRUE(matrix.multiplyAndReduceBackwardWithConvergenceCheck(storm::OptimizationDirection::Maximize, rowGroupIndices, x, nullptr, x, 1e-6, true));
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -0,0 +1,145 @@
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SparseMatrixView.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createTestMatrix() {
+    // Five states, two of which have two choices.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 4, 0.5);
+    builder.addNextValue(1, 3, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 0, 0.2);
+    builder.addNextValue(2, 2, 0.8);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 1, 0.4);
+    builder.addNextValue(3, 2, 0.6);
+    builder.addNextValue(4, 4, 1.0);
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 0, 0.3);
+    builder.addNextValue(5, 3, 0.7);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 2, 0.9);
+    builder.addNextValue(6, 4, 0.1);
+    return builder.build(7, 5, 5);
+}
+
+}  // namespace
+
+TEST(SparseMatrixViewTest, Multiply) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::BitVector constraint(5, true);
+    constraint.set(3, false);
+    storm::storage::BitVector makeZeroColumns(5);
+    makeZeroColumns.set(2);
+
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(true, constraint, constraint, false, makeZeroColumns);
+    storm::storage::SparseMatrixView<double> view(matrix, constraint, constraint, makeZeroColumns);
+    EXPECT_EQ(submatrix.getRowCount(), view.getRowCount());
+    EXPECT_EQ(submatrix.getColumnCount(), view.getColumnCount());
+    EXPECT_EQ(submatrix.getRowGroupCount(), view.getRowGroupCount());
+    EXPECT_EQ(submatrix.getRowGroupIndices(), view.getRowGroupIndices());
+    EXPECT_EQ(submatrix, view.materialize());
+    EXPECT_EQ(matrix.getSubmatrix(true, constraint, constraint, true, makeZeroColumns), view.materialize(true));
+
+    std::vector<double> x = {0.1, 0.2, 0.3, 0.4};
+    std::vector<double> b(submatrix.getRowCount());
+    for (uint64_t row = 0; row < b.size(); ++row) {
+        b[row] = 0.5 * row;
+    }
+    std::vector<double> expected(submatrix.getRowCount()), result(view.getRowCount());
+    submatrix.multiplyWithVector(x, expected, &b);
+    view.multiplyWithVector(x, result, &b);
+    for (uint64_t row = 0; row < expected.size(); ++row) {
+        EXPECT_NEAR(expected[row], result[row], 1e-12) << "in row " << row << ".";
+    }
+
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expectedReduced(submatrix.getRowGroupCount()), reduced(view.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(submatrix.getRowGroupCount()), choices(view.getRowGroupCount());
+        submatrix.multiplyAndReduce(dir, submatrix.getRowGroupIndices(), x, nullptr, expectedReduced, &expectedChoices);
+        view.multiplyAndReduce(dir, x, nullptr, reduced, &choices);
+        for (uint64_t group = 0; group < expectedReduced.size(); ++group) {
+            EXPECT_NEAR(expectedReduced[group], reduced[group], 1e-12) << "in group " << group << ".";
+        }
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(SparseMatrixViewTest, Unconstrained) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::BitVector constraint(5, true);
+    storm::storage::SparseMatrixView<double> view(matrix, constraint, constraint);
+    EXPECT_EQ(matrix, view.materialize());
+}
+
+TEST(SparseMatrixViewTest, Scaling) {
+    // A rate matrix with a self loop, which is scaled into the uniformized matrix of its first, second and fourth state.
+    storm::storage::SparseMatrixBuilder<double> builder;
+    builder.addNextValue(0, 1, 2.0);
+    builder.addNextValue(0, 3, 1.0);
+    builder.addNextValue(1, 1, 1.0);
+    builder.addNextValue(1, 2, 3.0);
+    builder.addNextValue(2, 0, 1.0);
+    builder.addNextValue(3, 0, 4.0);
+    storm::storage::SparseMatrix<double> rateMatrix = builder.build(4, 4);
+    std::vector<double> exitRates = {3.0, 4.0, 1.0, 4.0};
+    double uniformizationRate = 5.0;
+    storm::storage::BitVector constraint(4, true);
+    constraint.set(2, false);
+
+    storm::storage::SparseMatrix<double> expected = rateMatrix.getSubmatrix(false, constraint, constraint, true);
+    uint64_t row = 0;
+    for (auto state : constraint) {
+        for (auto& entry : expected.getRow(row)) {
+            double diagonal = entry.getColumn() == row ? 1.0 - exitRates[state] / uniformizationRate : 0.0;
+            entry.setValue(entry.getValue() / uniformizationRate + diagonal);
+        }
+        ++row;
+    }
+
+    storm::storage::SparseMatrixView<double> view(rateMatrix, constraint, constraint);
+    std::vector<double> rowFactors(3, 1.0 / uniformizationRate);
+    std::vector<double> diagonalSummands;
+    for (auto state : constraint) {
+        diagonalSummands.push_back(1.0 - exitRates[state] / uniformizationRate);
+    }
+    view.setScaling(std::move(rowFactors), std::move(diagonalSummands));
+
+    storm::storage::SparseMatrix<double> materialized = view.materialize();
+    ASSERT_EQ(expected.getEntryCount(), materialized.getEntryCount());
+    for (row = 0; row < expected.getRowCount(); ++row) {
+        auto expectedEntry = expected.getRow(row).begin();
+        for (auto const& entry : materialized.getRow(row)) {
+            EXPECT_EQ(expectedEntry->getColumn(), entry.getColumn());
+            EXPECT_NEAR(expectedEntry->getValue(), entry.getValue(), 1e-12) << "in row " << row << ".";
+            ++expectedEntry;
+        }
+    }
+
+    std::vector<double> x = {0.2, 0.3, 0.5};
+    std::vector<double> b = {0.1, 0.0, 0.2};
+    std::vector<double> expectedResult(3), result(3);
+    expected.multiplyWithVector(x, expectedResult, &b);
+    view.multiplyWithVector(x, result, &b);
+    for (row = 0; row < expectedResult.size(); ++row) {
+        EXPECT_NEAR(expectedResult[row], result[row], 1e-12) << "in row " << row << ".";
+    }
+
+    // Without diagonal summands, the rows of the view on the full matrix are scaled with the inverse exit rates.
+    storm::storage::BitVector allStates(4, true);
+    storm::storage::SparseMatrixView<double> embedded(rateMatrix, allStates, allStates);
+    embedded.setScaling({1.0 / 3.0, 0.25, 1.0, 0.25});
+    std::vector<double> y = {1.0, 0.0, 1.0, 0.0};
+    std::vector<double> embeddedResult(4);
+    embedded.multiplyWithVector(y, embeddedResult);
+    EXPECT_NEAR(0.0, embeddedResult[0], 1e-12);
+    EXPECT_NEAR(0.75, embeddedResult[1], 1e-12);
+    EXPECT_NEAR(1.0, embeddedResult[2], 1e-12);
+    EXPECT_NEAR(1.0, embeddedResult[3], 1e-12);
+    EXPECT_THROW(embedded.setScaling({1.0}), storm::exceptions::InvalidArgumentException);
+}
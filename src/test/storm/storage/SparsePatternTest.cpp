@@ -0,0 +1,79 @@
+#include "storm/storage/SparsePattern.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/parallel.h"
+#include "test/storm_gtest.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createTestMatrix() {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    builder.addNextValue(0, 1, 0.1);
+    builder.addNextValue(0, 2, 0.0);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 2, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 1, 1.0);
+    builder.newRowGroup(3);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, 0.25);
+    builder.addNextValue(3, 3, 0.75);
+    builder.addNextValue(4, 2, 1.0);
+    return builder.build(5, 4, 4);
+}
+
+std::vector<uint64_t> getColumns(storm::storage::SparsePattern const& pattern, uint64_t row) {
+    std::vector<uint64_t> result;
+    for (auto const& entry : pattern.getRow(row)) {
+        result.push_back(entry.getColumn());
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(SparsePattern, Creation) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::SparsePattern pattern(matrix);
+
+    // The zero entry is omitted.
+    EXPECT_EQ(5ul, pattern.getRowCount());
+    EXPECT_EQ(4ul, pattern.getColumnCount());
+    EXPECT_EQ(8ul, pattern.getEntryCount());
+    EXPECT_EQ(std::vector<uint64_t>({0, 1}), getColumns(pattern, 0));
+    EXPECT_EQ(std::vector<uint64_t>({1, 2}), getColumns(pattern, 1));
+    EXPECT_EQ(std::vector<uint64_t>({0, 3}), getColumns(pattern, 3));
+
+    // Joining the groups removes duplicate entries.
+    storm::storage::SparsePattern joinedPattern(matrix, false, true);
+    EXPECT_EQ(4ul, joinedPattern.getRowCount());
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 2}), getColumns(joinedPattern, 0));
+    EXPECT_EQ(std::vector<uint64_t>(), getColumns(joinedPattern, 2));
+    EXPECT_EQ(std::vector<uint64_t>({0, 2, 3}), getColumns(joinedPattern, 3));
+    EXPECT_LT(joinedPattern.getSizeInMemory(), matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint64_t, double>));
+}
+
+TEST(SparsePattern, BackwardTransitions) {
+    storm::storage::SparseMatrix<double> matrix = createTestMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    for (uint64_t numberOfThreads : {1ul, 4ul}) {
+        storm::utility::parallel::setDefaultNumberOfThreads(numberOfThreads);
+        storm::storage::SparsePattern pattern(matrix, true, true);
+        ASSERT_EQ(backwardTransitions.getRowCount(), pattern.getRowCount());
+        EXPECT_EQ(backwardTransitions.getColumnCount(), pattern.getColumnCount());
+        for (uint64_t row = 0; row < pattern.getRowCount(); ++row) {
+            std::vector<uint64_t> expectedColumns;
+            for (auto const& entry : backwardTransitions.getRow(row)) {
+                if (expectedColumns.empty() || expectedColumns.back() != entry.getColumn()) {
+                    expectedColumns.push_back(entry.getColumn());
+                }
+            }
+            EXPECT_EQ(expectedColumns, getColumns(pattern, row));
+        }
+        EXPECT_TRUE(pattern == storm::storage::SparsePattern(matrix, true, true));
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
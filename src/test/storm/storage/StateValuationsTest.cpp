@@ -0,0 +1,79 @@
+#include "storm-config.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+#include "test/storm_gtest.h"
+
+TEST(StateValuationsTest, BuildAndAccess) {
+    storm::expressions::ExpressionManager manager;
+    storm::expressions::Variable b = manager.declareBooleanVariable("b");
+    storm::expressions::Variable x = manager.declareIntegerVariable("x");
+    storm::expressions::Variable y = manager.declareIntegerVariable("y");
+    storm::expressions::Variable r = manager.declareRationalVariable("r");
+
+    storm::storage::sparse::StateValuationsBuilder builder;
+    builder.addVariable(b);
+    builder.addVariable(x);
+    builder.addVariable(y);
+    builder.addVariable(r);
+    // The values of y require re-packing the column several times.
+    std::vector<int64_t> yValues = {3, 3, 7, -2, 1000, std::numeric_limits<int64_t>::min(), 5};
+    for (uint64_t state = 0; state < yValues.size(); ++state) {
+        if (state == 4) {
+            // State 4 has no valuation.
+            continue;
+        }
+        builder.addState(state, {state % 2 == 0}, {static_cast<int64_t>(state % 3), yValues[state]}, {storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint_fast64_t>(state))});
+    }
+    builder.addState(4);
+    storm::storage::sparse::StateValuations valuations = builder.build(yValues.size());
+
+    ASSERT_EQ(7ul, valuations.getNumberOfStates());
+    EXPECT_TRUE(valuations.isEmpty(4));
+    for (uint64_t state = 0; state < yValues.size(); ++state) {
+        if (state == 4) {
+            continue;
+        }
+        EXPECT_FALSE(valuations.isEmpty(state));
+        EXPECT_EQ(state % 2 == 0, valuations.getBooleanValue(state, b));
+        EXPECT_EQ(static_cast<int64_t>(state % 3), valuations.getIntegerValue(state, x));
+        EXPECT_EQ(yValues[state], valuations.getIntegerValue(state, y));
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint_fast64_t>(state)), valuations.getRationalValue(state, r));
+    }
+
+    EXPECT_EQ(storm::storage::BitVector(7, {0, 2, 6}), valuations.getStatesWithBooleanValue(b, true));
+    EXPECT_EQ(storm::storage::BitVector(7, {1, 3, 5}), valuations.getStatesWithBooleanValue(b, false));
+    EXPECT_EQ(storm::storage::BitVector(7, {0, 3, 6}), valuations.getStatesWithIntegerValue(x, 0));
+    EXPECT_EQ(storm::storage::BitVector(7, {0, 1}), valuations.getStatesWithIntegerValue(y, 3));
+    EXPECT_EQ(storm::storage::BitVector(7, {5}), valuations.getStatesWithIntegerValue(y, std::numeric_limits<int64_t>::min()));
+    EXPECT_TRUE(valuations.getStatesWithIntegerValue(y, 1000).empty());
+    EXPECT_TRUE(valuations.getStatesWithIntegerValue(y, 4).empty());
+
+    // Select states 5, 4 and 2 and a non-existing state.
+    storm::storage::sparse::StateValuations selected = valuations.selectStates(std::vector<uint64_t>({5, 4, 2, 42}));
+    ASSERT_EQ(4ul, selected.getNumberOfStates());
+    EXPECT_FALSE(selected.isEmpty(0));
+    EXPECT_TRUE(selected.isEmpty(1));
+    EXPECT_FALSE(selected.isEmpty(2));
+    EXPECT_TRUE(selected.isEmpty(3));
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), selected.getIntegerValue(0, y));
+    EXPECT_EQ(7, selected.getIntegerValue(2, y));
+    EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(static_cast<uint_fast64_t>(2)), selected.getRationalValue(2, r));
+    EXPECT_EQ(valuations.toString(5), selected.toString(0));
+
+    storm::storage::sparse::StateValuations blownUp = valuations.blowup({6, 6, 1});
+    ASSERT_EQ(3ul, blownUp.getNumberOfStates());
+    EXPECT_EQ(storm::storage::BitVector(3, {0, 1}), blownUp.getStatesWithIntegerValue(y, 5));
+    EXPECT_EQ(valuations.toString(1), blownUp.toString(2));
+
+    // Selecting all states shares the columns with the original valuations.
+    storm::storage::sparse::StateValuations all = valuations.selectStates(storm::storage::BitVector(7, true));
+    ASSERT_EQ(7ul, all.getNumberOfStates());
+    EXPECT_EQ(&valuations.getRationalValue(3, r), &all.getRationalValue(3, r));
+    EXPECT_NE(&valuations.getRationalValue(3, r), &selected.getRationalValue(2, r));
+    EXPECT_EQ(valuations.toString(6), all.toString(6));
+}
@@ -6,6 +6,9 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include "test/storm_gtest.h"
 
+#include <random>
+#include <set>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -90,3 +93,43 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, Parallel) {
+    // Build a random graph with many SCCs of different sizes.
+    uint64_t const numberOfStates = 5000;
+    std::minstd_rand generator(17);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        std::set<uint64_t> successors;
+        successors.insert(generator() % 3 == 0 ? (state + 1) % numberOfStates : state / 2);
+        successors.insert(std::max<uint64_t>(state, 10) - generator() % 10);
+        for (auto successor : successors) {
+            matrixBuilder.addNextValue(state, successor, 1.0 / successors.size());
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+
+    auto getSortedSccs = [](storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::vector<std::pair<std::vector<uint64_t>, bool>> result;
+        for (auto const& scc : decomposition) {
+            result.emplace_back(std::vector<uint64_t>(scc.begin(), scc.end()), scc.isTrivial());
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    std::vector<storm::storage::StronglyConnectedComponentDecompositionOptions> optionsList(4);
+    optionsList[1].dropNaiveSccs();
+    optionsList[2].onlyBottomSccs();
+    optionsList[3].subsystem(&subsystem).dropNaiveSccs();
+    for (auto options : optionsList) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options.numberOfThreads(4));
+        EXPECT_FALSE(parallelDecomposition.hasSccDepth());
+        EXPECT_EQ(getSortedSccs(sequentialDecomposition), getSortedSccs(parallelDecomposition));
+    }
+}
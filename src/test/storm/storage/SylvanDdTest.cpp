@@ -6,6 +6,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdStatistics.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/Odd.h"
 
@@ -13,6 +14,7 @@
 
 #include <iostream>
 #include <memory>
+#include <sstream>
 
 TEST(SylvanDd, Constants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
@@ -61,6 +63,30 @@ TEST(SylvanDd, BddConstants) {
     EXPECT_EQ(1ul, one.getNodeCount());
 }
 
+TEST(SylvanDd, ExecuteTasks) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 9);
+
+    std::vector<storm::dd::Add<storm::dd::DdType::Sylvan, double>> encodings(10);
+    ASSERT_NO_THROW(manager->executeTasks(
+        encodings.size(), [&](uint64_t index) { encodings[index] = manager->getEncoding(x.first, index).template toAdd<double>() * manager->getConstant(2.0); }));
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> sum = manager->template getAddZero<double>();
+    for (auto const& encoding : encodings) {
+        sum += encoding;
+    }
+    EXPECT_EQ(10ul, sum.getNonZeroCount());
+    EXPECT_EQ(20.0, sum.sumAbstract({x.first}).getValue());
+
+    EXPECT_THROW(manager->executeTasks(5,
+                                       [](uint64_t index) {
+                                           if (index == 3) {
+                                               throw storm::exceptions::InvalidArgumentException();
+                                           }
+                                       }),
+                 storm::exceptions::InvalidArgumentException);
+}
+
 TEST(SylvanDd, BddExistAbstractRepresentative) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
 
@@ -951,3 +977,30 @@ TEST(SylvanDd, BddToExpressionTest) {
 
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, Statistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first);
+
+    // Recording is disabled unless the statistics are to be exported.
+    manager->recordStatistics("ignored");
+    EXPECT_EQ(0ul, manager->getRecordedStatistics().size());
+    manager->setRecordStatistics(true);
+    manager->recordStatistics("build");
+    ASSERT_EQ(1ul, manager->getRecordedStatistics().size());
+    EXPECT_EQ("build", manager->getRecordedStatistics().front().first);
+
+    storm::dd::DdStatistics statistics = manager->getStatistics();
+    EXPECT_GE(statistics.nodeCount, dd.getNodeCount());
+    EXPECT_GE(statistics.peakNodeCount, statistics.nodeCount);
+    EXPECT_GT(statistics.uniqueTableSlots, 0ul);
+    EXPECT_LE(statistics.cacheHits, statistics.cacheLookups);
+
+    std::stringstream stream;
+    manager->exportStatisticsAsJson(stream);
+    storm::json<double> json = storm::json<double>::parse(stream.str());
+    ASSERT_EQ(1ul, json["phases"].size());
+    EXPECT_EQ("build", json["phases"][0]["phase"].template get<std::string>());
+    EXPECT_EQ(1ul, json["final"].count("nodes"));
+}
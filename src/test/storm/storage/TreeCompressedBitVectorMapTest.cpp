@@ -0,0 +1,102 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <map>
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/TreeCompressedBitVectorMap.h"
+
+TEST(TreeCompressedBitVectorMapTest, FindOrAdd) {
+    // Three components of 10, 54 and 64 bits.
+    storm::storage::TreeCompressedBitVectorMap<uint64_t> map(128, {0, 10, 64});
+    EXPECT_EQ(3ul, map.getNumberOfComponents());
+
+    storm::storage::BitVector first(128);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    // Shares the first two components with the first key.
+    storm::storage::BitVector second = first;
+    second.set(100);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(128);
+    third.set(10);
+    third.set(127);
+    std::pair<uint64_t, uint64_t> valueBucketPair = map.findOrAddAndGetBucket(third, 3);
+    EXPECT_EQ(3ul, valueBucketPair.first);
+    EXPECT_EQ(2ul, valueBucketPair.second);
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 0));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 0));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 0));
+    EXPECT_EQ(3ul, map.size());
+
+    EXPECT_EQ(third, map.getBucketAndValue(2).first);
+    EXPECT_EQ(3ul, map.getBucketAndValue(2).second);
+}
+
+TEST(TreeCompressedBitVectorMapTest, Contains) {
+    storm::storage::TreeCompressedBitVectorMap<uint32_t> map(64, {0, 8, 16, 32});
+
+    storm::storage::BitVector first(64);
+    first.set(1);
+    first.set(20);
+    map.findOrAdd(first, 1);
+
+    storm::storage::BitVector second(64);
+    second.set(9);
+    second.set(40);
+    map.findOrAdd(second, 2);
+
+    EXPECT_TRUE(map.contains(first));
+    EXPECT_TRUE(map.contains(second));
+    EXPECT_EQ(1u, map.getValue(first));
+    EXPECT_EQ(2u, map.getValue(second));
+
+    // All components of this key are known, but not in this combination.
+    storm::storage::BitVector mixed(64);
+    mixed.set(1);
+    mixed.set(40);
+    EXPECT_FALSE(map.contains(mixed));
+
+    // Looking up a key must not insert it.
+    EXPECT_EQ(2ul, map.size());
+}
+
+TEST(TreeCompressedBitVectorMapTest, IterateAndRemap) {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint64_t> distribution(0, 15);
+
+    // Keys consisting of five components of which only few values occur.
+    storm::storage::TreeCompressedBitVectorMap<uint64_t> map(256, {0, 13, 64, 100, 200});
+    std::map<storm::storage::BitVector, uint64_t> expected;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        storm::storage::BitVector key(256);
+        for (uint64_t offset : {0, 13, 64, 100, 200}) {
+            key.setFromInt(offset, 4, distribution(generator));
+        }
+        key.setFromInt(252, 4, distribution(generator) % 2);
+        auto insertionResult = expected.emplace(key, expected.size());
+        EXPECT_EQ(insertionResult.first->second, map.findOrAdd(key, expected.size() - 1));
+    }
+    EXPECT_EQ(expected.size(), map.size());
+
+    map.remap([](uint64_t const& value) { return value + 1; });
+
+    uint64_t index = 0;
+    for (auto const& keyValuePair : map) {
+        auto it = expected.find(keyValuePair.first);
+        ASSERT_TRUE(it != expected.end());
+        EXPECT_EQ(index, it->second);
+        EXPECT_EQ(index + 1, keyValuePair.second);
+        EXPECT_EQ(index + 1, map.getValue(keyValuePair.first));
+        ++index;
+    }
+    EXPECT_EQ(expected.size(), index);
+}
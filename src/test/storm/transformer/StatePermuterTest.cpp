@@ -0,0 +1,61 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/transformer/StatePermuter.h"
+#include "storm/utility/vector.h"
+
+TEST(StatePermuterTest, PermutedModelsAgree) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string formulasString = "Pmin=? [ F \"two\" ];Rmax{\"coinflips\"}=? [ F \"done\" ]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas);
+    auto const& labeling = model->getStateLabeling();
+
+    std::vector<std::vector<double>> originalResults;
+    for (auto const& formula : formulas) {
+        auto result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, false));
+        originalResults.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    }
+
+    for (auto order : {storm::utility::permutation::OrderKind::Bfs, storm::utility::permutation::OrderKind::ReverseCuthillMcKee,
+                       storm::utility::permutation::OrderKind::SccTopological}) {
+        auto permuted = storm::transformer::permuteStates(*model, order);
+        auto const& inversePermutation = permuted.second;
+        ASSERT_EQ(model->getNumberOfStates(), inversePermutation.size());
+        ASSERT_TRUE(storm::utility::permutation::isValidPermutation(inversePermutation));
+        EXPECT_EQ(inversePermutation, storm::utility::permutation::invertPermutation(storm::utility::permutation::invertPermutation(inversePermutation)));
+        EXPECT_EQ(model->getNumberOfChoices(), permuted.first->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), permuted.first->getNumberOfTransitions());
+        EXPECT_EQ(model->getInitialStates().getNumberOfSetBits(), permuted.first->getInitialStates().getNumberOfSetBits());
+
+        for (uint64_t state = 0; state < inversePermutation.size(); ++state) {
+            EXPECT_EQ(labeling.getLabelsOfState(inversePermutation[state]), permuted.first->getStateLabeling().getLabelsOfState(state));
+        }
+
+        auto permutation = storm::utility::permutation::invertPermutation(inversePermutation);
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            auto result = storm::api::verifyWithSparseEngine(permuted.first, storm::api::createTask<double>(formulas[index], false));
+            auto mappedResult =
+                storm::utility::vector::applyInversePermutation(permutation, result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+            ASSERT_EQ(originalResults[index].size(), mappedResult.size());
+            for (uint64_t state = 0; state < mappedResult.size(); ++state) {
+                EXPECT_NEAR(originalResults[index][state], mappedResult[state], 1e-6)
+                    << "order " << order << ", property " << index << ", state " << state;
+            }
+        }
+    }
+}
+
+TEST(StatePermuterTest, InvalidPermutation) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto model = storm::api::buildSparseModel<double>(program, std::vector<std::shared_ptr<storm::logic::Formula const>>());
+    std::vector<uint64_t> inversePermutation(model->getNumberOfStates(), 0);
+    STORM_SILENT_EXPECT_THROW(storm::transformer::permuteStates(*model, inversePermutation), storm::exceptions::InvalidArgumentException);
+    inversePermutation.resize(model->getNumberOfStates() - 1);
+    STORM_SILENT_EXPECT_THROW(storm::transformer::permuteStates(*model, inversePermutation), storm::exceptions::InvalidArgumentException);
+}
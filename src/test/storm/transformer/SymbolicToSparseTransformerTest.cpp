@@ -0,0 +1,56 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/transformer/SymbolicToSparseTransformer.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::Dtmc<double>> translate(storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double> const& symbolicDtmc,
+                                                               uint64_t numberOfThreads) {
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(numberOfThreads);
+    storm::transformer::SymbolicDtmcToSparseDtmcTransformer<storm::dd::DdType::Sylvan, double> transformer;
+    auto result = transformer.translate(symbolicDtmc);
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+    return result;
+}
+
+void checkParallelTranslation(std::string const& path, uint64_t expectedNumberOfStates) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(path);
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    auto symbolicDtmc = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program)->template as<
+        storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>();
+
+    auto sequential = translate(*symbolicDtmc, 1);
+    auto parallel = translate(*symbolicDtmc, 4);
+    EXPECT_EQ(expectedNumberOfStates, parallel->getNumberOfStates());
+    EXPECT_EQ(sequential->getTransitionMatrix(), parallel->getTransitionMatrix());
+    EXPECT_EQ(sequential->getStateLabeling(), parallel->getStateLabeling());
+    ASSERT_EQ(sequential->getRewardModels().size(), parallel->getRewardModels().size());
+    for (auto const& nameAndRewardModel : sequential->getRewardModels()) {
+        auto const& parallelRewardModel = parallel->getRewardModel(nameAndRewardModel.first);
+        ASSERT_EQ(nameAndRewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+        if (nameAndRewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(nameAndRewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(nameAndRewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+        if (nameAndRewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(nameAndRewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+        }
+    }
+}
+
+TEST(SymbolicToSparseTransformerTest, ParallelTranslation) {
+    checkParallelTranslation(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", 677ull);
+    checkParallelTranslation(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", 8607ull);
+}
+
+}  // namespace
@@ -0,0 +1,97 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+#include "storm/utility/FileCache.h"
+
+namespace {
+
+class FileCacheTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        directory = (std::filesystem::temp_directory_path() / "storm_file_cache_test").string();
+        std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    static std::function<void(std::string const&)> writer(std::string const& content) {
+        return [content](std::string const& filename) {
+            std::ofstream stream(filename, std::ios::binary);
+            stream << content;
+        };
+    }
+
+    static std::string read(std::string const& filename) {
+        std::ifstream stream(filename, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    }
+
+    std::string directory;
+};
+
+TEST_F(FileCacheTest, StoreAndLookup) {
+    storm::utility::FileCache cache(directory, 1024);
+    EXPECT_FALSE(cache.lookup("first").is_initialized());
+
+    cache.store("first", writer("data of first"));
+    auto filename = cache.lookup("first");
+    ASSERT_TRUE(filename.is_initialized());
+    EXPECT_EQ("data of first", read(filename.get()));
+    EXPECT_FALSE(cache.lookup("second").is_initialized());
+    EXPECT_EQ(13ull, cache.getSize());
+
+    // Storing the same key again replaces the entry.
+    cache.store("first", writer("new data"));
+    EXPECT_EQ("new data", read(cache.lookup("first").get()));
+    EXPECT_EQ(8ull, cache.getSize());
+
+    // Another cache object on the same directory sees the entry.
+    storm::utility::FileCache otherCache(directory, 1024);
+    EXPECT_TRUE(otherCache.lookup("first").is_initialized());
+}
+
+TEST_F(FileCacheTest, FailingWriter) {
+    storm::utility::FileCache cache(directory, 1024);
+    EXPECT_THROW(cache.store("key", [](std::string const&) { throw std::runtime_error("failure"); }), std::runtime_error);
+    EXPECT_FALSE(cache.lookup("key").is_initialized());
+    EXPECT_TRUE(std::filesystem::is_empty(directory));
+}
+
+TEST_F(FileCacheTest, LeastRecentlyUsedEviction) {
+    storm::utility::FileCache cache(directory, 25);
+    cache.store("a", writer("0123456789"));
+    cache.store("b", writer("0123456789"));
+
+    // Make the order of uses independent of the resolution of file times.
+    auto setLastUse = [this](std::string const& key, int secondsAgo) {
+        for (auto const& entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.path().extension() == ".key" && read(entry.path().string()) == key) {
+                std::filesystem::last_write_time(entry.path(), std::filesystem::file_time_type::clock::now() - std::chrono::seconds(secondsAgo));
+            }
+        }
+    };
+    setLastUse("a", 20);
+    setLastUse("b", 10);
+    ASSERT_TRUE(cache.lookup("a").is_initialized());
+    setLastUse("b", 30);
+
+    // "b" is now the least recently used entry and has to make room for "c".
+    cache.store("c", writer("0123456789"));
+    EXPECT_TRUE(cache.lookup("a").is_initialized());
+    EXPECT_FALSE(cache.lookup("b").is_initialized());
+    EXPECT_TRUE(cache.lookup("c").is_initialized());
+    EXPECT_EQ(20ull, cache.getSize());
+
+    // An entry that is larger than the whole cache is not kept and does not evict other entries.
+    cache.store("d", writer(std::string(30, 'x')));
+    EXPECT_FALSE(cache.lookup("d").is_initialized());
+    EXPECT_TRUE(cache.lookup("a").is_initialized());
+    EXPECT_TRUE(cache.lookup("c").is_initialized());
+}
+
+}  // namespace
@@ -10,11 +10,14 @@
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparsePattern.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
 
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
@@ -772,3 +775,98 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitRelevantMaybeStates) {
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5, 8);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 3, 0.5);
+    builder.addNextValue(1, 1, 0.5);
+    builder.addNextValue(1, 4, 0.5);
+    builder.addNextValue(2, 1, 0.5);
+    builder.addNextValue(2, 3, 0.5);
+    builder.addNextValue(3, 3, 1.0);
+    builder.addNextValue(4, 4, 1.0);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::BitVector maybeStates(5, std::vector<uint64_t>{0, 1, 2});
+
+    storm::storage::BitVector relevantMaybeStates =
+        storm::utility::graph::getRelevantMaybeStates(matrix, storm::storage::BitVector(5, std::vector<uint64_t>{0}), maybeStates);
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint64_t>{0, 1}), relevantMaybeStates);
+
+    relevantMaybeStates = storm::utility::graph::getRelevantMaybeStates(matrix, storm::storage::BitVector(5, std::vector<uint64_t>{2, 3}), maybeStates);
+    EXPECT_EQ(storm::storage::BitVector(5, std::vector<uint64_t>{1, 2}), relevantMaybeStates);
+
+    relevantMaybeStates = storm::utility::graph::getRelevantMaybeStates(matrix, storm::storage::BitVector(5, std::vector<uint64_t>{3}), maybeStates);
+    EXPECT_TRUE(relevantMaybeStates.empty());
+}
+
+TEST(GraphTest, ExplicitProbGreater0BottomUp) {
+    // A chain in which every state can also move to the first state. The search from the last state therefore has small
+    // frontiers (top-down steps) and the search from the first state has a large frontier (bottom-up steps).
+    uint64_t const numberOfStates = 10000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.addNextValue(state, 0, 0.5);
+        builder.addNextValue(state, std::min(state + 1, numberOfStates - 1), 0.5);
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector phiStates(numberOfStates, true);
+    phiStates.set(5000, false);
+
+    for (uint64_t numberOfThreads : {1, 4}) {
+        storm::utility::parallel::setDefaultNumberOfThreads(numberOfThreads);
+        for (uint64_t target : {static_cast<uint64_t>(0), numberOfStates - 1}) {
+            storm::storage::BitVector psiStates(numberOfStates);
+            psiStates.set(target);
+            storm::storage::BitVector expected = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+            EXPECT_EQ(expected, storm::utility::graph::performProbGreater0(matrix, backwardTransitions, phiStates, psiStates));
+            EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, 10),
+                      storm::utility::graph::performProbGreater0(matrix, backwardTransitions, phiStates, psiStates, true, 10));
+
+            auto expectedProb01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            auto prob01 = storm::utility::graph::performProb01(matrix, backwardTransitions, phiStates, psiStates);
+            EXPECT_EQ(expectedProb01.first, prob01.first);
+            EXPECT_EQ(expectedProb01.second, prob01.second);
+        }
+    }
+    storm::utility::parallel::setDefaultNumberOfThreads(1);
+
+    storm::storage::BitVector psiStates(numberOfStates);
+    psiStates.set(numberOfStates - 1);
+    EXPECT_EQ(numberOfStates - 5001, storm::utility::graph::performProbGreater0(matrix, backwardTransitions, phiStates, psiStates).getNumberOfSetBits());
+    EXPECT_EQ(11ull, storm::utility::graph::performProbGreater0(matrix, backwardTransitions, phiStates, psiStates, true, 10).getNumberOfSetBits());
+}
+
+TEST(GraphTest, ExplicitProb01MinMaxWithPattern) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+    storm::storage::SparseMatrix<double> const& matrix = mdp->getTransitionMatrix();
+    storm::storage::SparseMatrix<double> const& backwardTransitions = mdp->getBackwardTransitions();
+    storm::storage::SparsePattern const& backwardPattern = mdp->getBackwardTransitionPattern();
+    EXPECT_LT(backwardPattern.getSizeInMemory(), backwardTransitions.getEntryCount() * sizeof(storm::storage::MatrixEntry<uint64_t, double>));
+
+    storm::storage::BitVector phiStates(mdp->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = mdp->getStates("all_coins_equal_0");
+    EXPECT_EQ(storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb01Min(matrix, matrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProb1A(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb1A(matrix, matrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates));
+    EXPECT_EQ(storm::utility::graph::performProbGreater0A(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates, true, 10),
+              storm::utility::graph::performProbGreater0A(matrix, matrix.getRowGroupIndices(), backwardPattern, phiStates, psiStates, true, 10));
+    EXPECT_EQ(storm::utility::graph::performProb0A(backwardTransitions, phiStates, psiStates),
+              storm::utility::graph::performProb0A(backwardPattern, phiStates, psiStates));
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecs(matrix, backwardTransitions);
+    storm::storage::MaximalEndComponentDecomposition<double> patternMecs(matrix, backwardPattern);
+    ASSERT_EQ(mecs.size(), patternMecs.size());
+    for (uint64_t i = 0; i < mecs.size(); ++i) {
+        EXPECT_EQ(mecs[i].getStateSet(), patternMecs[i].getStateSet());
+    }
+}
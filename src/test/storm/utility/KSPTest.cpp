@@ -105,3 +105,43 @@ TEST(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST(KSPTest, enumeratePaths) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+    storm::utility::ksp::ShortestPathsGenerator<double> reference(*model, testState);
+
+    unsigned long k = 0;
+    double sum = 0;
+    auto result = spg.enumeratePaths([&](storm::utility::ksp::OrderedStateList const& path, double const& probability, double const& cumulativeProbability) {
+        ++k;
+        sum += reference.getDistance(k);
+        EXPECT_NEAR(reference.getDistance(k), probability, 1e-12);
+        EXPECT_NEAR(sum, cumulativeProbability, 1e-12);
+        EXPECT_EQ(reference.getPathAsList(k), path);
+        return k < 100;
+    });
+    EXPECT_EQ(storm::utility::ksp::EnumerationResult::stoppedByCallback, result);
+    EXPECT_EQ(100ul, k);
+
+    // Enumeration continues with the next path
+    spg.enumeratePaths([&](storm::utility::ksp::OrderedStateList const&, double const& probability, double const&) {
+        EXPECT_NEAR(reference.getDistance(101), probability, 1e-12);
+        return false;
+    });
+}
+
+TEST(KSPTest, enumeratePathsLimits) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, stateWithOnlyOnePath);
+    unsigned long k = 0;
+    auto result = spg.enumeratePaths([&](storm::utility::ksp::OrderedStateList const&, double const&, double const&) { return ++k < 10; });
+    EXPECT_EQ(storm::utility::ksp::EnumerationResult::noFurtherPath, result);
+    EXPECT_EQ(1ul, k);
+
+    storm::utility::ksp::ShortestPathsGenerator<double> spg2(*model, testState);
+    uint64_t memoryLimit = spg2.getMemoryEstimate() + 10000;
+    result = spg2.enumeratePaths([&](storm::utility::ksp::OrderedStateList const&, double const&, double const&) { return true; }, memoryLimit);
+    EXPECT_EQ(storm::utility::ksp::EnumerationResult::memoryLimitReached, result);
+    EXPECT_GT(spg2.getMemoryEstimate(), memoryLimit);
+}
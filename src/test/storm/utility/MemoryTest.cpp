@@ -0,0 +1,64 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <numeric>
+
+#include "storm/utility/memory.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+
+void checkAllocations() {
+    for (uint64_t size : {1ull, 100ull, 5000000ull}) {
+        storm::utility::memory::AlignedVector<double> vector(size);
+        EXPECT_EQ(0ull, reinterpret_cast<uint64_t>(vector.data()) % storm::utility::memory::alignment);
+        std::iota(vector.begin(), vector.end(), 0.0);
+        EXPECT_EQ(static_cast<double>(size - 1), vector.back());
+
+        std::vector<uint64_t> plainVector(size, 1);
+        storm::utility::memory::adviseMemory(plainVector);
+        EXPECT_EQ(size, std::accumulate(plainVector.begin(), plainVector.end(), 0ull));
+    }
+}
+
+}  // namespace
+
+TEST(MemoryTest, DefaultPolicies) {
+    checkAllocations();
+}
+
+TEST(MemoryTest, HugePagesAndNuma) {
+    uint64_t defaultNumberOfThreads = storm::utility::parallel::getDefaultNumberOfThreads();
+    storm::utility::parallel::setDefaultNumberOfThreads(2);
+    using storm::utility::memory::HugePagePolicy;
+    using storm::utility::memory::NumaPolicy;
+    for (auto hugePagePolicy : {HugePagePolicy::None, HugePagePolicy::Transparent, HugePagePolicy::Explicit}) {
+        for (auto numaPolicy : {NumaPolicy::Default, NumaPolicy::Interleave, NumaPolicy::FirstTouch}) {
+            // The policies are hints, so the allocations have to succeed (and behave the same) regardless of the support of the system.
+            storm::utility::memory::setHugePagePolicy(hugePagePolicy);
+            storm::utility::memory::setNumaPolicy(numaPolicy);
+            checkAllocations();
+        }
+    }
+    storm::utility::memory::setHugePagePolicy(HugePagePolicy::None);
+    storm::utility::memory::setNumaPolicy(NumaPolicy::Default);
+    storm::utility::parallel::setDefaultNumberOfThreads(defaultNumberOfThreads);
+}
+
+TEST(MemoryTest, MemoryLimit) {
+    uint64_t allocatedBytes = storm::utility::memory::getAllocatedBytes();
+    {
+        storm::utility::memory::AlignedVector<double> vector(1000);
+        EXPECT_GE(storm::utility::memory::getAllocatedBytes(), allocatedBytes + 1000 * sizeof(double));
+        EXPECT_GE(storm::utility::memory::getUsedBytes(), storm::utility::memory::getAllocatedBytes());
+    }
+    EXPECT_EQ(allocatedBytes, storm::utility::memory::getAllocatedBytes());
+
+    EXPECT_EQ(0ull, storm::utility::memory::getMemoryLimit());
+    EXPECT_TRUE(storm::utility::memory::isWithinMemoryLimit(1ull << 60));
+    uint64_t usedBytes = storm::utility::memory::getUsedBytes();
+    storm::utility::memory::setMemoryLimit(usedBytes + (1ull << 30));
+    EXPECT_TRUE(storm::utility::memory::isWithinMemoryLimit(1024));
+    EXPECT_FALSE(storm::utility::memory::isWithinMemoryLimit(1ull << 31));
+    storm::utility::memory::setMemoryLimit(0);
+}
@@ -0,0 +1,73 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "storm/utility/Metrics.h"
+
+namespace {
+
+class RecordingMetricsSink : public storm::utility::MetricsSink {
+   public:
+    virtual void publish(std::vector<storm::utility::MetricSample> const& snapshot, double) override {
+        snapshots.push_back(snapshot);
+    }
+
+    std::vector<std::vector<storm::utility::MetricSample>> snapshots;
+};
+
+TEST(MetricsTest, GaugesAndCounters) {
+    storm::utility::Metrics& metrics = storm::utility::Metrics::getInstance();
+    metrics.reset();
+    metrics.setGauge("storm_test_gauge", 2.0);
+    metrics.setGauge("storm_test_gauge", 3.0);
+    metrics.addToCounter("storm_test_counter", 2.0);
+    metrics.addToCounter("storm_test_counter", 3.0);
+
+    auto snapshot = metrics.getSnapshot();
+    ASSERT_EQ(2ul, snapshot.size());
+    EXPECT_EQ("storm_test_counter", snapshot[0].name);
+    EXPECT_EQ(storm::utility::MetricSample::Type::Counter, snapshot[0].type);
+    EXPECT_EQ(5.0, snapshot[0].value);
+    EXPECT_EQ("storm_test_gauge", snapshot[1].name);
+    EXPECT_EQ(storm::utility::MetricSample::Type::Gauge, snapshot[1].type);
+    EXPECT_EQ(3.0, snapshot[1].value);
+
+    std::stringstream prometheus;
+    storm::utility::Metrics::writePrometheus(prometheus, snapshot);
+    EXPECT_EQ("# TYPE storm_test_counter counter\nstorm_test_counter 5\n# TYPE storm_test_gauge gauge\nstorm_test_gauge 3\n", prometheus.str());
+
+    std::stringstream json;
+    snapshot.push_back(storm::utility::MetricSample{"storm_test_nan", storm::utility::MetricSample::Type::Gauge, std::nan("")});
+    storm::utility::Metrics::writeJsonLine(json, snapshot, 1.5);
+    EXPECT_EQ("{\"time\":1.5,\"storm_test_counter\":5,\"storm_test_gauge\":3,\"storm_test_nan\":null}\n", json.str());
+    metrics.reset();
+}
+
+TEST(MetricsTest, Publishing) {
+    storm::utility::Metrics& metrics = storm::utility::Metrics::getInstance();
+    metrics.reset();
+    auto sink = std::make_shared<RecordingMetricsSink>();
+    metrics.addSink(sink);
+    metrics.startPublishing(std::chrono::hours(1));
+    EXPECT_TRUE(metrics.isEnabled());
+    metrics.setGauge("storm_test_gauge", 1.0);
+    metrics.stopPublishing();
+    metrics.disable();
+
+    // Stopping publishes a final snapshot that includes the resident memory.
+    ASSERT_EQ(1ul, sink->snapshots.size());
+    bool foundMemory = false;
+    for (auto const& sample : sink->snapshots.front()) {
+        if (sample.name == "storm_resident_memory_bytes") {
+            foundMemory = true;
+            EXPECT_GT(sample.value, 0.0);
+        }
+    }
+    EXPECT_TRUE(foundMemory);
+    metrics.reset();
+}
+
+}  // namespace
@@ -0,0 +1,60 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/Profiler.h"
+
+TEST(ProfilerTest, NestedRegions) {
+    storm::utility::Profiler& profiler = storm::utility::Profiler::getInstance();
+    profiler.reset();
+    {
+        // Regions entered while profiling is disabled are not recorded.
+        storm::utility::ScopedProfilingRegion ignored("ignored");
+    }
+    profiler.enable();
+    {
+        storm::utility::ScopedProfilingRegion outer("outer");
+        for (uint64_t i = 0; i < 2; ++i) {
+            storm::utility::ScopedProfilingRegion inner("inner");
+            std::vector<uint64_t> values(100000, i);
+            EXPECT_EQ(100000ul, values.size());
+        }
+    }
+    profiler.disable();
+
+    auto records = profiler.getRecords();
+    ASSERT_EQ(3ul, records.size());
+    EXPECT_EQ("outer", records[0].name);
+    EXPECT_EQ("outer", records[0].path);
+    EXPECT_EQ(0ul, records[0].depth);
+    for (uint64_t i = 1; i < 3; ++i) {
+        EXPECT_EQ("inner", records[i].name);
+        EXPECT_EQ("outer/inner", records[i].path);
+        EXPECT_EQ(1ul, records[i].depth);
+        EXPECT_EQ(records[0].threadIndex, records[i].threadIndex);
+        EXPECT_LE(records[0].startInNanoseconds, records[i].startInNanoseconds);
+        EXPECT_LE(records[i].wallTimeInNanoseconds, records[0].wallTimeInNanoseconds);
+    }
+
+    std::stringstream traceStream;
+    profiler.exportChromeTrace(traceStream);
+    auto trace = storm::json<double>::parse(traceStream.str());
+    ASSERT_EQ(3ul, trace["traceEvents"].size());
+    EXPECT_EQ("outer", trace["traceEvents"][0]["name"].get<std::string>());
+    EXPECT_EQ("X", trace["traceEvents"][0]["ph"].get<std::string>());
+
+    std::stringstream summaryStream;
+    profiler.exportSummary(summaryStream);
+    auto summary = storm::json<double>::parse(summaryStream.str());
+    ASSERT_EQ(2ul, summary["regions"].size());
+    EXPECT_EQ("outer", summary["regions"][0]["path"].get<std::string>());
+    EXPECT_EQ(1ul, summary["regions"][0]["calls"].get<uint64_t>());
+    EXPECT_EQ("outer/inner", summary["regions"][1]["path"].get<std::string>());
+    EXPECT_EQ(2ul, summary["regions"][1]["calls"].get<uint64_t>());
+
+    profiler.reset();
+    EXPECT_TRUE(profiler.getRecords().empty());
+}
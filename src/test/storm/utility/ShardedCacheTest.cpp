@@ -0,0 +1,84 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/RationalFunctionOperationCache.h"
+#include "storm/utility/ShardedCache.h"
+
+namespace {
+
+TEST(ShardedCacheTest, LookupAndInsert) {
+    storm::utility::ShardedCache<uint64_t, std::string> cache(100, 4);
+    EXPECT_FALSE(cache.lookup(1).is_initialized());
+    cache.insert(1, "one");
+    ASSERT_TRUE(cache.lookup(1).is_initialized());
+    EXPECT_EQ("one", cache.lookup(1).get());
+
+    uint64_t computations = 0;
+    auto compute = [&computations]() {
+        ++computations;
+        return std::string("two");
+    };
+    EXPECT_EQ("two", cache.getOrCompute(2, compute));
+    EXPECT_EQ("two", cache.getOrCompute(2, compute));
+    EXPECT_EQ(1ull, computations);
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(3ull, statistics.hits);
+    EXPECT_EQ(2ull, statistics.misses);
+    EXPECT_EQ(2ull, statistics.entries);
+    EXPECT_NEAR(0.6, statistics.getHitRate(), 1e-9);
+}
+
+TEST(ShardedCacheTest, Eviction) {
+    storm::utility::ShardedCache<uint64_t, uint64_t> cache(8, 1);
+    for (uint64_t key = 0; key < 20; ++key) {
+        cache.insert(key, key * key);
+    }
+    auto statistics = cache.getStatistics();
+    EXPECT_LE(statistics.entries, 8ull);
+    EXPECT_EQ(20ull, statistics.entries + statistics.evictions);
+    EXPECT_EQ(361ull, cache.lookup(19).get());
+}
+
+TEST(ShardedCacheTest, Concurrent) {
+    storm::utility::ShardedCache<uint64_t, uint64_t> cache(1000, 8);
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&cache]() {
+            for (uint64_t key = 0; key < 500; ++key) {
+                EXPECT_EQ(2 * key, cache.getOrCompute(key, [key]() { return 2 * key; }));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(2000ull, statistics.hits + statistics.misses);
+    EXPECT_EQ(500ull, statistics.entries);
+}
+
+TEST(ShardedCacheTest, RationalFunctionOperations) {
+    auto x = storm::createRFVariable("x");
+    auto y = storm::createRFVariable("y");
+    std::shared_ptr<storm::RawPolynomialCache> polynomialCache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunction fx(storm::Polynomial(storm::RawPolynomial(x), polynomialCache));
+    storm::RationalFunction fy(storm::Polynomial(storm::RawPolynomial(y), polynomialCache));
+    storm::RationalFunction quotient = fx / fy;
+
+    storm::utility::RationalFunctionOperationCache cache(100);
+    EXPECT_EQ(fx, cache.multiply(quotient, fy));
+    // The operands are commutated, so the result is found in the cache.
+    EXPECT_EQ(fx, cache.multiply(fy, quotient));
+    EXPECT_EQ(quotient + fx, cache.add(quotient, fx));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1ull, statistics.hits);
+    EXPECT_EQ(2ull, statistics.misses);
+}
+
+}  // namespace